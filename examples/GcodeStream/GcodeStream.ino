@@ -0,0 +1,66 @@
+#include "FasGcode.h"
+#include "FastAccelStepper.h"
+
+// G-code is received on the serial port and each line is answered with "ok"
+// or "error:<code>", after it has been accepted. So the host can send the
+// next line after the answer.
+
+#if defined(ARDUINO_ARCH_AVR)
+// for avr: either use pin 9 or 10 aka OC1A or OC1B
+#define stepPinX 9
+#define dirPinX 5
+#define stepPinY 10
+#define dirPinY 7
+#else
+#define stepPinX 17
+#define dirPinX 18
+#define stepPinY 19
+#define dirPinY 21
+#endif
+
+FastAccelStepperEngine engine = FastAccelStepperEngine();
+FasGcode gcode;
+
+void setup() {
+  Serial.begin(115200);
+  engine.init();
+  FastAccelStepper *x = engine.stepperConnectToPin(stepPinX);
+  FastAccelStepper *y = engine.stepperConnectToPin(stepPinY);
+  if (x) {
+    x->setDirectionPin(dirPinX);
+  }
+  if (y) {
+    y->setDirectionPin(dirPinY);
+  }
+  gcode.init(x, y, NULL);
+  // 200 steps/revolution, 16 microsteps and 8 mm per revolution
+  gcode.setStepsPerMM(0, 400);
+  gcode.setStepsPerMM(1, 400);
+  gcode.setRapidSpeed(6000);
+  gcode.setAcceleration(500);
+  Serial.println("Demo GcodeStream");
+}
+
+bool pending = false;
+char ch;
+
+void loop() {
+  if (!pending && (Serial.available() > 0)) {
+    ch = Serial.read();
+    pending = true;
+  }
+  // feed() does not take the end of line, while the ring of segments is full
+  if (pending && (gcode.feed(&ch, 1) == 1)) {
+    pending = false;
+    if (ch == '\n') {
+      int8_t err = gcode.getError();
+      if (err == GCODE_OK) {
+        Serial.println("ok");
+      } else {
+        Serial.print("error:");
+        Serial.println(err);
+      }
+    }
+  }
+  gcode.process();
+}
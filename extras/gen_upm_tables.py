@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+#
+# Generator for the lookup tables used by PoorManFloat.cpp
+#
+# The tables are written to src/PoorManFloat_tables.h as PROGMEM arrays.
+# Three variants are emitted and selected at compile time via UPM_TABLE_SIZE:
+#
+#   UPM_TABLE_SIZE == 0   small:   tables sampled at reduced resolution
+#   UPM_TABLE_SIZE == 1   default: the original tables (avr)
+#   UPM_TABLE_SIZE == 2   large:   higher resolution log/exp tables (esp32)
+#
+# The worst case error of each upm operation for each variant is reported by
+# tests/test_06 (make -C tests test_06_small test_06_default test_06_large).
+#
+# Usage:
+#   python3 extras/gen_upm_tables.py [--small-shift N] [--large-log-steps N]
+#                                    [-o src/PoorManFloat_tables.h]
+#
+import argparse
+import math
+import sys
+
+
+def clip(v, lo, hi):
+    return max(lo, min(hi, v))
+
+
+# The small and default variants share the same algorithm:
+#
+#   log_adjust[(m - 64) >> shift]     log of mantissa 64..255 mapped to 0..255
+#   exp_mul_64[d >> shift]            inverse of log_adjust, result 64..255
+#   isqrt_tab[(m - 64) >> shift]      sqrt of mantissa 64..255
+#
+# With shift = 0 these are identical to the tables used up to now.
+def log_adjust(shift):
+    step = 1 << shift
+    res = []
+    for i in range(0, 192, step):
+        m = 64 + i + (step - 1) / 2.0
+        res.append(clip(round(255 * math.log(m / 64) / math.log(255 / 64)), 0, 255))
+    return res
+
+
+def exp_mul_64(shift):
+    step = 1 << shift
+    res = []
+    for i in range(0, 256, step):
+        d = i + (step - 1) / 2.0
+        res.append(clip(round(64 * (255 / 64) ** (d / 255)), 64, 255))
+    return res
+
+
+def isqrt_tab(shift):
+    step = 1 << shift
+    res = []
+    for i in range(0, 192, step):
+        m = 64 + i + (step - 1) / 2.0
+        res.append(clip(round(math.sqrt(m * 256)), 128, 255))
+    return res
+
+
+# The large variant works on the normalized mantissa 128..255 only:
+#
+#   log_tab[m - 128]                  log2(m/128) * steps, 0..steps-1
+#   exp_tab[d]                        128 * 2^(d/steps), 128..255
+#   isqrt_tab[(m - 128) | odd << 7]   sqrt(m/128) resp. sqrt(m/64) as 128..255
+#
+# This avoids the loss of the mantissa's lsb on halving and doubling.
+def log_tab_large(steps):
+    return [clip(round(steps * math.log2(m / 128)), 0, steps - 1)
+            for m in range(128, 256)]
+
+
+def exp_tab_large(steps):
+    return [clip(round(128 * 2 ** (d / steps)), 128, 255) for d in range(steps)]
+
+
+def isqrt_tab_large():
+    even = [clip(round(128 * math.sqrt(m / 128)), 128, 255) for m in range(128, 256)]
+    odd = [clip(round(128 * math.sqrt(m / 64)), 128, 255) for m in range(128, 256)]
+    return even + odd
+
+
+def emit(out, ctype, name, values):
+    out.append("const PROGMEM %s %s[%d] = {" % (ctype, name, len(values)))
+    line = "   "
+    for v in values:
+        item = " %d," % v
+        if len(line) + len(item) > 80:
+            out.append(line)
+            line = "   "
+        line += item
+    out.append(line[:-1] + "};")
+
+
+def table_error(name, values, ideal):
+    worst = max(abs(v - i) / i for v, i in zip(values, ideal))
+    sys.stderr.write("  %-12s %4d entries  max rel. error %.4f%%\n" %
+                     (name, len(values), 100 * worst))
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--small-shift", type=int, default=1)
+    parser.add_argument("--large-log-steps", type=int, default=512)
+    parser.add_argument("-o", "--output", default="src/PoorManFloat_tables.h")
+    args = parser.parse_args()
+
+    ss = args.small_shift
+    ls = args.large_log_steps
+
+    out = []
+    out.append("// This file is generated by extras/gen_upm_tables.py - do not edit")
+    out.append("//")
+    out.append("// Command line: --small-shift %d --large-log-steps %d" % (ss, ls))
+    out.append("")
+    out.append("#if (UPM_TABLE_SIZE == 0)")
+    out.append("#define UPM_MANT_SHIFT %d" % ss)
+    emit(out, "uint8_t", "isqrt_tab", isqrt_tab(ss))
+    emit(out, "uint8_t", "log_adjust", log_adjust(ss))
+    emit(out, "uint8_t", "exp_mul_64", exp_mul_64(ss))
+    out.append("#elif (UPM_TABLE_SIZE == 1)")
+    out.append("#define UPM_MANT_SHIFT 0")
+    emit(out, "uint8_t", "isqrt_tab", isqrt_tab(0))
+    emit(out, "uint8_t", "log_adjust", log_adjust(0))
+    emit(out, "uint8_t", "exp_mul_64", exp_mul_64(0))
+    out.append("#elif (UPM_TABLE_SIZE == 2)")
+    out.append("#define UPM_LOG_STEPS %d" % ls)
+    emit(out, "uint8_t", "isqrt_tab", isqrt_tab_large())
+    emit(out, "uint16_t", "log_tab", log_tab_large(ls))
+    emit(out, "uint8_t", "exp_tab", exp_tab_large(ls))
+    out.append("#else")
+    out.append("#error \"UPM_TABLE_SIZE must be 0, 1 or 2\"")
+    out.append("#endif")
+
+    with open(args.output, "w") as f:
+        f.write("\n".join(out) + "\n")
+
+    for variant, shift in (("small", ss), ("default", 0)):
+        step = 1 << shift
+        sys.stderr.write("%s (shift %d):\n" % (variant, shift))
+        table_error("isqrt_tab", isqrt_tab(shift),
+                    [math.sqrt((64 + i) * 256) for i in range(0, 192, step)])
+        table_error("exp_mul_64", exp_mul_64(shift),
+                    [64 * (255 / 64) ** (i / 255) for i in range(0, 256, step)])
+    sys.stderr.write("large (%d log steps per octave):\n" % ls)
+    table_error("exp_tab", exp_tab_large(ls),
+                [128 * 2 ** (d / ls) for d in range(ls)])
+    sys.stderr.write("Worst case error of the upm operations: make -C tests test\n")
+
+
+if __name__ == "__main__":
+    main()
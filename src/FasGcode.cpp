@@ -0,0 +1,592 @@
+#include "FasGcode.h"
+
+#include "StepperISR.h"
+
+// This define in order to not shoot myself.
+#ifndef TEST
+#define printf DO_NOT_USE_PRINTF
+#endif
+
+//*************************************************************************************************
+// Streaming G-code front-end
+//
+// The planner works on the squared speed v² along the path. A segment can
+// be entered with at most:
+//   - the junction speed to the previous segment
+//   - the speed, from which it can decelerate to the entry speed of the
+//     next segment: v² = v_next² + 2 * a * length
+//   - the speed, which is reached from the entry speed of the previous
+//     segment: v² = v_prev² + 2 * a * length_prev
+// The last segment ends with speed 0, so the steppers stop, if the stream
+// runs dry. Appending a segment only increases the entry speeds. So the
+// entry speed of the segment after the executing one is fixed at the start
+// of the execution.
+//
+// The junction speed follows the junction deviation model: the steppers
+// pass the corner on a circle, which touches both segments and deviates at
+// most by the junction deviation from the corner, with the centripetal
+// acceleration a:
+//   v² = a * deviation * sin(θ/2) / (1 - sin(θ/2))
+// θ is the angle between the segments, so sin(θ/2) is 1 for a straight line
+// and 0 for a reversal.
+//
+// A segment is executed by the ramp generator along the path. Its exit
+// speed is reached by a ramp to a virtual target beyond the end of the
+// segment by v_exit² / (2 * a), which is cut at the end of the segment. The
+// next segment continues with the period of the last ramp command.
+//*************************************************************************************************
+
+// Plan ahead of the time base and start delay of a move from standstill
+#define GCODE_FILL_AHEAD_TICKS (TICKS_PER_S / 50)
+#define GCODE_START_TICKS (TICKS_PER_S / 500)
+
+#define GCODE_SEGMENTS_MASK (GCODE_SEGMENTS - 1)
+#define GCODE_MAX_V (TICKS_PER_S / MIN_DELTA_TICKS)
+
+static uint32_t gcode_isqrt(uint64_t v) {
+  uint64_t res = 0;
+  uint64_t bit = (uint64_t)1 << 62;
+  while (bit > v) {
+    bit >>= 2;
+  }
+  while (bit != 0) {
+    if (v >= res + bit) {
+      v -= res + bit;
+      res = (res >> 1) + bit;
+    } else {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+  return res;
+}
+
+// The direction of a move with components below 2^20 for the junction
+static void gcode_direction(const int32_t um[], int32_t dir[]) {
+  uint32_t m = 0;
+  for (uint8_t i = 0; i < GCODE_AXES; i++) {
+    m |= abs(um[i]);
+  }
+  uint8_t shift = 0;
+  while ((m >> shift) >= ((uint32_t)1 << 20)) {
+    shift++;
+  }
+  for (uint8_t i = 0; i < GCODE_AXES; i++) {
+    dir[i] = um[i] / (1L << shift);
+  }
+}
+
+// sin(θ/2) of the junction as fixed point number with 16 bit fraction
+static uint32_t gcode_sin_half(const int32_t a_um[], const int32_t b_um[]) {
+  int32_t a[GCODE_AXES];
+  int32_t b[GCODE_AXES];
+  gcode_direction(a_um, a);
+  gcode_direction(b_um, b);
+  int64_t dot = 0;
+  uint64_t len_a = 0;
+  uint64_t len_b = 0;
+  for (uint8_t i = 0; i < GCODE_AXES; i++) {
+    dot += (int64_t)a[i] * b[i];
+    len_a += (int64_t)a[i] * a[i];
+    len_b += (int64_t)b[i] * b[i];
+  }
+  int64_t len = (int64_t)gcode_isqrt(len_a) * gcode_isqrt(len_b);
+  if (len == 0) {
+    return 0;
+  }
+  // cos of the angle between the directions and sin(θ/2)² = (1 + cos) / 2
+  int64_t cos_q16 = dot * 65536 / len;
+  cos_q16 = max(min(cos_q16, 65536), -65536);
+  return gcode_isqrt((uint64_t)((65536 + cos_q16) / 2) << 16);
+}
+
+//*************************************************************************************************
+void FasGcode::init(FastAccelStepper* x, FastAccelStepper* y,
+                    FastAccelStepper* z) {
+  _stepper[0] = x;
+  _stepper[1] = y;
+  _stepper[2] = z;
+  _line_len = 0;
+  _line_overflow = false;
+  _in_comment = false;
+  _skip_to_eol = false;
+  _line_count = 0;
+  _error = GCODE_OK;
+  _error_line = 0;
+  _relative = false;
+  _motion = 0;
+  _feed_v = 0;
+  _last_v2 = 0;
+  _head = 0;
+  _tail = 0;
+  _seg_active = false;
+  _fixed_v2 = 0;
+  _rg.init();
+  _ramp_ticks = TICKS_FOR_STOPPED_MOTOR;
+  setRapidSpeed(3000);
+  setAcceleration(1000);
+  setJunctionDeviation(20);
+
+  struct coordinated_move_s* c = &_coord;
+  c->active = false;
+  c->started = false;
+  c->is_arc = false;
+  c->elapsed = 0;
+  c->axis[0].stepper = NULL;
+  c->axis[0].done = 0;
+  c->n = 1;
+  for (uint8_t i = 0; i < GCODE_AXES; i++) {
+    FastAccelStepper* s = _stepper[i];
+    _steps_per_mm[i] = 100;
+    _pos_um[i] = 0;
+    _pos_steps[i] = 0;
+    _origin_steps[i] = 0;
+    _last_um[i] = 0;
+    _axis_idx[i] = -1;
+    if (s == NULL) {
+      continue;
+    }
+    _origin_steps[i] = s->getPositionAfterCommandsCompleted();
+    _axis_idx[i] = c->n;
+    struct coordinated_axis_s* f = &c->axis[c->n++];
+    f->stepper = s;
+    f->steps = 0;
+    f->done = 0;
+    f->step_at = 0;
+    f->dir_high = s->_dirHighCountsUp;
+    f->run_steps = 0;
+  }
+}
+
+void FasGcode::setStepsPerMM(uint8_t axis, uint32_t steps_per_mm) {
+  if (axis < GCODE_AXES) {
+    _steps_per_mm[axis] = steps_per_mm;
+  }
+}
+void FasGcode::setRapidSpeed(uint32_t mm_per_min) {
+  _rapid_v = (uint64_t)mm_per_min * 1000 / (60 * GCODE_PATH_UNIT_UM);
+}
+void FasGcode::setAcceleration(uint32_t mm_per_s2) {
+  _accel = max((uint64_t)mm_per_s2 * 1000 / GCODE_PATH_UNIT_UM, 1);
+}
+void FasGcode::setJunctionDeviation(uint32_t um) { _junction_um = um; }
+
+int8_t FasGcode::getError() {
+  int8_t res = _error;
+  _error = GCODE_OK;
+  return res;
+}
+
+bool FasGcode::isIdle() {
+  if (_seg_active || (_head != _tail)) {
+    return false;
+  }
+  for (uint8_t i = 0; i < GCODE_AXES; i++) {
+    if ((_stepper[i] != NULL) && _stepper[i]->isRunning()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+//*************************************************************************************************
+uint16_t FasGcode::feed(const char* data, uint16_t len) {
+  for (uint16_t i = 0; i < len; i++) {
+    char ch = data[i];
+    if ((ch == '\n') || (ch == '\r')) {
+      if ((_line_len > 0) || _line_overflow) {
+        // each line adds at most one segment
+        if ((uint8_t)(_head - _tail) == GCODE_SEGMENTS) {
+          return i;
+        }
+        _line_count++;
+        int8_t res =
+            _line_overflow ? GCODE_ERR_LINE_TOO_LONG : _parseLine();
+        if (res != GCODE_OK) {
+          _error = res;
+          _error_line = _line_count;
+        }
+      }
+      _line_len = 0;
+      _line_overflow = false;
+      _in_comment = false;
+      _skip_to_eol = false;
+      continue;
+    }
+    if (_skip_to_eol) {
+      continue;
+    }
+    if (_in_comment) {
+      _in_comment = (ch != ')');
+      continue;
+    }
+    if (ch == '(') {
+      _in_comment = true;
+    } else if (ch == ';') {
+      _skip_to_eol = true;
+    } else if ((ch == ' ') || (ch == '\t')) {
+      // white space is ignored
+    } else if (_line_len < GCODE_LINE_LEN - 1) {
+      if ((ch >= 'a') && (ch <= 'z')) {
+        ch -= 'a' - 'A';
+      }
+      _line[_line_len++] = ch;
+    } else {
+      _line_overflow = true;
+    }
+  }
+  return len;
+}
+
+// The numbers are returned in 1/1000 with up to three decimals
+static bool gcode_number(const char* line, uint8_t len, uint8_t* p,
+                         int32_t* value) {
+  bool negative = false;
+  if ((*p < len) && ((line[*p] == '-') || (line[*p] == '+'))) {
+    negative = (line[(*p)++] == '-');
+  }
+  int32_t v = 0;
+  uint8_t digits = 0;
+  while ((*p < len) && (line[*p] >= '0') && (line[*p] <= '9')) {
+    if (v >= 2000000000L / 10) {
+      return false;
+    }
+    v = v * 10 + (line[(*p)++] - '0');
+    digits++;
+  }
+  if (v > 2000000) {
+    return false;
+  }
+  v *= 1000;
+  if ((*p < len) && (line[*p] == '.')) {
+    (*p)++;
+    int32_t scale = 100;
+    while ((*p < len) && (line[*p] >= '0') && (line[*p] <= '9')) {
+      v += (line[(*p)++] - '0') * scale;
+      scale /= 10;
+      digits++;
+    }
+  }
+  *value = negative ? -v : v;
+  return digits > 0;
+}
+
+int8_t FasGcode::_parseLine() {
+  bool has_axis[GCODE_AXES] = {false, false, false};
+  int32_t value[GCODE_AXES];
+  uint8_t motion = _motion;
+  bool relative = _relative;
+  uint32_t feed_v = _feed_v;
+  bool dwell = false;
+  int32_t dwell_ms = -1;
+  uint8_t p = 0;
+  while (p < _line_len) {
+    char letter = _line[p++];
+    int32_t v;
+    if ((letter < 'A') || (letter > 'Z') ||
+        !gcode_number(_line, _line_len, &p, &v)) {
+      return GCODE_ERR_SYNTAX;
+    }
+    switch (letter) {
+      case 'G':
+        if ((v < 0) || (v % 1000 != 0)) {
+          return GCODE_ERR_UNSUPPORTED;
+        }
+        switch (v / 1000) {
+          case 0:
+          case 1:
+            motion = v / 1000;
+            break;
+          case 4:
+            dwell = true;
+            break;
+          case 21:
+            break;
+          case 90:
+            relative = false;
+            break;
+          case 91:
+            relative = true;
+            break;
+          default:
+            return GCODE_ERR_UNSUPPORTED;
+        }
+        break;
+      case 'X':
+      case 'Y':
+      case 'Z':
+        has_axis[letter - 'X'] = true;
+        value[letter - 'X'] = v;
+        break;
+      case 'F':
+        // mm/min in 1/1000 is µm/min
+        if (v <= 0) {
+          return GCODE_ERR_SYNTAX;
+        }
+        feed_v = max(v / (60 * GCODE_PATH_UNIT_UM), 1);
+        break;
+      case 'P':
+        dwell_ms = v / 1000;
+        break;
+      case 'S':
+        dwell_ms = v;
+        break;
+      case 'N':
+        break;
+      default:
+        return GCODE_ERR_UNSUPPORTED;
+    }
+  }
+  bool move = has_axis[0] || has_axis[1] || has_axis[2];
+  if (dwell && (move || (dwell_ms < 0))) {
+    return GCODE_ERR_SYNTAX;
+  }
+  if (dwell && (dwell_ms > GCODE_MAX_DWELL_MS)) {
+    return GCODE_ERR_DWELL_TOO_LONG;
+  }
+  _motion = motion;
+  _relative = relative;
+  _feed_v = feed_v;
+  if (dwell) {
+    _addDwell((uint32_t)dwell_ms * (TICKS_PER_S / 1000));
+    return GCODE_OK;
+  }
+  if (!move) {
+    return GCODE_OK;
+  }
+  int32_t target[GCODE_AXES];
+  for (uint8_t i = 0; i < GCODE_AXES; i++) {
+    target[i] = _pos_um[i];
+    if (has_axis[i]) {
+      target[i] = relative ? target[i] + value[i] : value[i];
+    }
+  }
+  return _addMove(target, motion == 0);
+}
+
+//*************************************************************************************************
+int8_t FasGcode::_addMove(const int32_t target_um[], bool rapid) {
+  uint32_t v = rapid ? _rapid_v : _feed_v;
+  if (v == 0) {
+    return GCODE_ERR_NO_FEEDRATE;
+  }
+  struct gcode_segment_s seg;
+  int32_t target_steps[GCODE_AXES];
+  int32_t d_um[GCODE_AXES];
+  uint64_t len2 = 0;
+  uint32_t max_steps = 0;
+  for (uint8_t i = 0; i < GCODE_AXES; i++) {
+    // rounded to the nearest step
+    int64_t s = (int64_t)target_um[i] * _steps_per_mm[i];
+    s = (s >= 0) ? s + 500 : s - 500;
+    target_steps[i] = s / 1000;
+    seg.steps[i] = target_steps[i] - _pos_steps[i];
+    d_um[i] = 0;
+    FastAccelStepper* stepper = _stepper[i];
+    if (stepper == NULL) {
+      seg.steps[i] = 0;
+      continue;
+    }
+    if ((seg.steps[i] < 0) && (stepper->_dirPin == PIN_UNDEFINED)) {
+      return GCODE_ERR_NO_DIRECTION_PIN;
+    }
+    if ((seg.steps[i] != 0) &&
+        stepper->rg.isOutsideLimits(_origin_steps[i] + target_steps[i])) {
+      return GCODE_ERR_POSITION_LIMIT;
+    }
+    d_um[i] = target_um[i] - _pos_um[i];
+    len2 += (int64_t)d_um[i] * d_um[i];
+    max_steps = max(max_steps, (uint32_t)abs(seg.steps[i]));
+  }
+  for (uint8_t i = 0; i < GCODE_AXES; i++) {
+    _pos_um[i] = target_um[i];
+    _pos_steps[i] = target_steps[i];
+  }
+  if (max_steps == 0) {
+    return GCODE_OK;
+  }
+  seg.length = (gcode_isqrt(len2) + GCODE_PATH_UNIT_UM / 2) / GCODE_PATH_UNIT_UM;
+  seg.length = max(seg.length, 1);
+  seg.dwell_ticks = 0;
+  // no axis steps faster than the stepper interrupt allows
+  uint64_t v_max = (uint64_t)GCODE_MAX_V * seg.length / max_steps;
+  v = min(v, min(v_max, GCODE_MAX_V));
+  v = max(v, 1);
+  seg.min_step_us = max(1000000L / v, 1);
+  seg.nominal_v2 = v * v;
+  seg.max_entry_v2 = 0;
+  if (_last_v2 != 0) {
+    uint32_t sin_half = gcode_sin_half(_last_um, d_um);
+    uint64_t v2 = min(_last_v2, seg.nominal_v2);
+    if (sin_half < 65536) {
+      uint64_t vj2 = (uint64_t)_accel * _junction_um * sin_half /
+                     ((uint64_t)GCODE_PATH_UNIT_UM * (65536 - sin_half));
+      v2 = min(v2, vj2);
+    }
+    seg.max_entry_v2 = v2;
+  }
+  seg.entry_v2 = 0;
+  for (uint8_t i = 0; i < GCODE_AXES; i++) {
+    _last_um[i] = d_um[i];
+  }
+  _last_v2 = seg.nominal_v2;
+  _seg[_head & GCODE_SEGMENTS_MASK] = seg;
+  _head++;
+  _plan();
+  return GCODE_OK;
+}
+
+void FasGcode::_addDwell(uint32_t ticks) {
+  struct gcode_segment_s* seg = &_seg[_head & GCODE_SEGMENTS_MASK];
+  for (uint8_t i = 0; i < GCODE_AXES; i++) {
+    seg->steps[i] = 0;
+  }
+  seg->length = 0;
+  seg->dwell_ticks = ticks;
+  seg->min_step_us = 0;
+  seg->nominal_v2 = 0;
+  seg->max_entry_v2 = 0;
+  seg->entry_v2 = 0;
+  _last_v2 = 0;
+  _head++;
+  _plan();
+}
+
+void FasGcode::_plan() {
+  // The entry of the executing segment cannot be changed anymore
+  uint8_t first = _tail + (_seg_active ? 1 : 0);
+  if (first == _head) {
+    return;
+  }
+  uint64_t two_a = 2 * (uint64_t)_accel;
+  // backward pass from the stop at the end
+  uint64_t next_v2 = 0;
+  uint8_t j = _head;
+  do {
+    j--;
+    struct gcode_segment_s* seg = &_seg[j & GCODE_SEGMENTS_MASK];
+    uint64_t v2 = next_v2 + two_a * seg->length;
+    v2 = min(v2, seg->max_entry_v2);
+    if (j == first) {
+      v2 = min(v2, _fixed_v2);
+    }
+    seg->entry_v2 = v2;
+    next_v2 = v2;
+  } while (j != first);
+  // forward pass from the fixed entry speed
+  for (j = first; (uint8_t)(j + 1) != _head; j++) {
+    struct gcode_segment_s* seg = &_seg[j & GCODE_SEGMENTS_MASK];
+    struct gcode_segment_s* next = &_seg[(j + 1) & GCODE_SEGMENTS_MASK];
+    uint64_t v2 = seg->entry_v2 + two_a * seg->length;
+    if (next->entry_v2 > v2) {
+      next->entry_v2 = v2;
+    }
+  }
+}
+
+//*************************************************************************************************
+// Returns false, if there is no segment to start
+bool FasGcode::_startSegment() {
+  if (_tail == _head) {
+    return false;
+  }
+  struct coordinated_move_s* c = &_coord;
+  struct gcode_segment_s* seg = &_seg[_tail & GCODE_SEGMENTS_MASK];
+  if (seg->entry_v2 == 0) {
+    // From standstill the time base is moved to now, if all steppers have
+    // stopped or if it is not yet started
+    bool stopped = true;
+    for (uint8_t i = 1; i < c->n; i++) {
+      stopped &= !c->axis[i].stepper->isRunning();
+    }
+    uint32_t now = fas_get_ticks();
+    int32_t ahead = c->start_ticks + c->elapsed - now;
+    if (!c->started || (stopped && (ahead < (int32_t)GCODE_START_TICKS))) {
+      c->start_ticks = now + GCODE_START_TICKS - c->elapsed;
+      c->started = true;
+      c->active = true;
+    }
+    _ramp_ticks = TICKS_FOR_STOPPED_MOTOR;
+  }
+  if (seg->length == 0) {
+    c->elapsed += seg->dwell_ticks;
+    _fixed_v2 = 0;
+    _tail++;
+    return true;
+  }
+  uint32_t exit_v2 = 0;
+  if ((uint8_t)(_tail + 1) != _head) {
+    exit_v2 = _seg[(_tail + 1) & GCODE_SEGMENTS_MASK].entry_v2;
+  }
+  _fixed_v2 = exit_v2;
+  c->axis[0].steps = seg->length;
+  c->axis[0].done = 0;
+  for (uint8_t i = 0; i < GCODE_AXES; i++) {
+    if (_axis_idx[i] < 0) {
+      continue;
+    }
+    struct coordinated_axis_s* f = &c->axis[_axis_idx[i]];
+    int32_t steps = seg->steps[i];
+    f->steps = abs(steps);
+    f->done = 0;
+    if (steps != 0) {
+      f->dir_high = ((steps > 0) == f->stepper->_dirHighCountsUp);
+    }
+  }
+  // The ramp to the virtual target passes the end with the exit speed
+  uint32_t beyond = exit_v2 / (2 * _accel);
+  _rg.abort();
+  _rg.setSpeed(seg->min_step_us);
+  _rg.setAcceleration(_accel);
+  _rg.moveTo(seg->length + beyond, 0, _ramp_ticks);
+  _seg_active = true;
+  return true;
+}
+
+void FasGcode::process() {
+  struct coordinated_move_s* c = &_coord;
+  while (true) {
+    int32_t ahead;
+    if (!_seg_active) {
+      if (!_startSegment()) {
+        return;
+      }
+      // after a dwell, so the dwells do not add up beyond 32 bit
+      ahead = c->start_ticks + c->elapsed - fas_get_ticks();
+      if (!_seg_active && (ahead > (int32_t)GCODE_FILL_AHEAD_TICKS)) {
+        return;
+      }
+      continue;
+    }
+    ahead = c->start_ticks + c->elapsed - fas_get_ticks();
+    if (ahead > (int32_t)GCODE_FILL_AHEAD_TICKS) {
+      return;
+    }
+    if (!FastAccelStepper::_followersHaveSpace(c)) {
+      return;
+    }
+    struct coordinated_axis_s* path = &c->axis[0];
+    uint32_t left = path->steps - path->done;
+    struct ramp_command_s cmd;
+    if (!_rg.getNextCommand(_ramp_ticks, path->done, &cmd)) {
+      // The ramp has ended early by rounding, so the rest is done slowly
+      cmd.ticks = min(_ramp_ticks, ABSOLUTE_MAX_TICKS);
+      cmd.steps = 1;
+    }
+    uint16_t steps = min(cmd.steps, left);
+    _ramp_ticks = cmd.ticks;
+    if (!FastAccelStepper::_addFollowerEntries(c, cmd.ticks, steps)) {
+      _rg.abort();
+      _seg_active = false;
+      _tail = _head;
+      c->active = false;
+      _error = GCODE_ERR_QUEUE;
+      _error_line = 0;
+      return;
+    }
+    if (path->done == path->steps) {
+      _seg_active = false;
+      _tail++;
+    }
+  }
+}
@@ -0,0 +1,149 @@
+#ifndef FAS_GCODE_H
+#define FAS_GCODE_H
+#include "FastAccelStepper.h"
+
+// Streaming G-code front-end for up to three steppers (X, Y, Z).
+//
+// The G-code is passed as byte stream to feed(), which may split the lines
+// at any position. Each complete line is parsed and its move is appended to
+// a ring of segments. The lookahead planner sets the speed at the junctions
+// of the segments, so the steppers do not stop between them. process() adds
+// the commands of the planned segments to the stepper queues and must be
+// called regularly from loop(), at least every 10 ms while moving.
+//
+// Supported are:
+//   G0, G1     linear move with rapid speed resp. feed rate F (mm/min)
+//   G4         dwell for P milliseconds or S seconds, up to
+//              GCODE_MAX_DWELL_MS
+//   G90, G91   absolute resp. relative coordinates
+//   G21        millimeters (the only unit)
+//   F          feed rate, N line numbers and comments in () or after ;
+// The coordinates are in mm with up to three decimals. Other words are
+// rejected with GCODE_ERR_UNSUPPORTED and the line is skipped.
+//
+// The ramp is planned along the path in units of GCODE_PATH_UNIT_UM µm,
+// so the speed along the path is limited to 50000 units/s (500 mm/s). The
+// steps of the axes are derived from the position along the path like the
+// followers of FastAccelStepperEngine::moveLinear(). Speed and acceleration
+// apply to the path and not to the single axes.
+//
+// The steppers must not be moved otherwise, while they are used by the
+// G-code front-end.
+
+#define GCODE_AXES 3
+#define GCODE_PATH_UNIT_UM 10
+
+// Number of segments for the lookahead and maximum line length
+#if defined(ARDUINO_ARCH_AVR)
+#define GCODE_SEGMENTS 8
+#define GCODE_LINE_LEN 64
+#else
+#define GCODE_SEGMENTS 16
+#define GCODE_LINE_LEN 96
+#endif
+
+// Longest dwell of G4, so the time planned ahead fits into 32 bit ticks
+#define GCODE_MAX_DWELL_MS 60000
+
+// Return codes of getError()
+#define GCODE_OK 0
+#define GCODE_ERR_SYNTAX -1
+#define GCODE_ERR_UNSUPPORTED -2
+#define GCODE_ERR_LINE_TOO_LONG -3
+#define GCODE_ERR_NO_FEEDRATE -4
+#define GCODE_ERR_NO_DIRECTION_PIN -5
+#define GCODE_ERR_DWELL_TOO_LONG -6
+// A stepper queue has rejected a command. The move is stopped and the
+// remaining segments are dropped, so init() has to be called again. The
+// error line is 0.
+#define GCODE_ERR_QUEUE -7
+// The target of an axis is outside of its setPositionLimits()
+#define GCODE_ERR_POSITION_LIMIT -8
+
+// One line of G-code in the ring of segments. A dwell has length 0.
+struct gcode_segment_s {
+  int32_t steps[GCODE_AXES];
+  uint32_t length;        // in path units
+  uint32_t dwell_ticks;
+  uint32_t min_step_us;   // nominal speed
+  uint32_t nominal_v2;    // (path units/s)²
+  uint32_t max_entry_v2;  // limit of the junction to the previous segment
+  uint32_t entry_v2;      // planned speed at the start
+};
+
+class FasGcode {
+ public:
+  // The axes without stepper are NULL. Their coordinates are accepted and
+  // ignored. The current positions of the steppers are the origin.
+  void init(FastAccelStepper* x, FastAccelStepper* y, FastAccelStepper* z);
+
+  // Configuration, which applies to the lines parsed afterwards
+  void setStepsPerMM(uint8_t axis, uint32_t steps_per_mm);
+  void setRapidSpeed(uint32_t mm_per_min);
+  void setAcceleration(uint32_t mm_per_s2);
+  // Allowed deviation from the path at a corner, which sets the junction
+  // speed. Default is 20 µm.
+  void setJunctionDeviation(uint32_t um);
+
+  // Consumes the bytes of the G-code stream. Returns the number of bytes
+  // consumed, which is less than len, if the ring of segments is full. Then
+  // the remaining bytes have to be fed again after process().
+  uint16_t feed(const char* data, uint16_t len);
+
+  // Adds the commands of the planned segments to the stepper queues
+  void process();
+
+  // true, if all segments have been added to the queues and the steppers
+  // have stopped
+  bool isIdle();
+
+  // Returns the last error and clears it. getErrorLine() is the number of the
+  // line with the error counted from 1.
+  int8_t getError();
+  uint32_t getErrorLine() { return _error_line; }
+
+ private:
+  FastAccelStepper* _stepper[GCODE_AXES];
+  uint32_t _steps_per_mm[GCODE_AXES];
+  uint32_t _rapid_v;  // path units/s
+  uint32_t _accel;    // path units/s²
+  uint32_t _junction_um;
+
+  // parser
+  char _line[GCODE_LINE_LEN];
+  uint8_t _line_len;
+  bool _line_overflow;
+  bool _in_comment;     // within ( )
+  bool _skip_to_eol;    // after ;
+  uint32_t _line_count;
+  int8_t _error;
+  uint32_t _error_line;
+  bool _relative;
+  uint8_t _motion;      // 0 or 1
+  uint32_t _feed_v;     // path units/s, 0 = not set
+  int32_t _pos_um[GCODE_AXES];
+  int32_t _pos_steps[GCODE_AXES];
+  int32_t _origin_steps[GCODE_AXES];  // stepper position at init()
+  int32_t _last_um[GCODE_AXES];  // direction of the last move
+  uint32_t _last_v2;             // nominal speed of the last move, 0 = none
+
+  // ring of segments: _tail is the next or executing segment
+  struct gcode_segment_s _seg[GCODE_SEGMENTS];
+  uint8_t _head;
+  uint8_t _tail;
+  bool _seg_active;
+  uint32_t _fixed_v2;  // speed at the end of the executing segment
+
+  // execution along the path
+  RampGenerator _rg;
+  uint32_t _ramp_ticks;
+  struct coordinated_move_s _coord;
+  int8_t _axis_idx[GCODE_AXES];  // index in _coord.axis or -1
+
+  int8_t _parseLine();
+  int8_t _addMove(const int32_t target_um[], bool rapid);
+  void _addDwell(uint32_t ticks);
+  void _plan();
+  bool _startSegment();
+};
+#endif
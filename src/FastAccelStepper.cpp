@@ -13,34 +13,31 @@
 
 // Here are the global variables to interface with the interrupts
 
+#if (FAS_DEBUG_LED == 1)
 // To realize the 1 Hz debug led
 static uint8_t fas_ledPin = PIN_UNDEFINED;
 static uint16_t fas_debug_led_cnt = 0;
+static uint16_t fas_debug_led_half_period = 50;
+#endif
+
+// Period of manageSteppers() as set by FastAccelStepperEngine::init()
+static uint32_t fas_manage_period_us = 10000;
+// The queue is filled for at least this time ahead
+static uint32_t fas_fill_ahead_ticks = TICKS_PER_S / 100;
 #if defined(ARDUINO_ARCH_AVR)
-#define DEBUG_LED_HALF_PERIOD 144
-#elif defined(ARDUINO_ARCH_ESP32)
-#define DEBUG_LED_HALF_PERIOD 50
-#else
-#define DEBUG_LED_HALF_PERIOD 50
+// manageSteppers() is called every fas_ovf_per_manage timer 1 overflows
+static uint8_t fas_ovf_per_manage = 1;
+static uint8_t fas_ovf_manage_cnt = 0;
 #endif
 
 #if defined(ARDUINO_ARCH_AVR)
 // this is needed to give the background task isr access to engine
 static FastAccelStepperEngine* fas_engine = NULL;
 
-// dynamic allocation seems to not work so well on avr
-FastAccelStepper fas_stepper[MAX_STEPPER] = {FastAccelStepper(),
-                                             FastAccelStepper()};
-#endif
-#if defined(ARDUINO_ARCH_ESP32)
-FastAccelStepper fas_stepper[MAX_STEPPER] = {
-    FastAccelStepper(), FastAccelStepper(), FastAccelStepper(),
-    FastAccelStepper(), FastAccelStepper(), FastAccelStepper()};
-#endif
-#if defined(TEST)
-FastAccelStepper fas_stepper[MAX_STEPPER] = {FastAccelStepper(),
-                                             FastAccelStepper()};
 #endif
+// dynamic allocation seems to not work so well on avr. Like all globals the
+// steppers are zero initialized and only MAX_STEPPER are allocated.
+FastAccelStepper fas_stepper[MAX_STEPPER];
 
 //*************************************************************************************************
 //*************************************************************************************************
@@ -50,22 +47,59 @@ FastAccelStepper fas_stepper[MAX_STEPPER] = {FastAccelStepper(),
 //
 //*************************************************************************************************
 #if defined(ARDUINO_ARCH_ESP32)
-#define TASK_DELAY_MS 10
+// Notified by the stepper ISR on low queue level
+TaskHandle_t fas_stepper_task = NULL;
+
 void StepperTask(void* parameter) {
   FastAccelStepperEngine* engine = (FastAccelStepperEngine*)parameter;
-  const TickType_t delay =
-      TASK_DELAY_MS / portTICK_PERIOD_MS;  // block for 10ms
+  TickType_t delay = fas_manage_period_us / 1000 / portTICK_PERIOD_MS;
+  if (delay == 0) {
+    delay = 1;
+  }
   while (true) {
     engine->manageSteppers();
-    vTaskDelay(delay);
+    // sleep till the period has passed or a queue runs low
+    ulTaskNotifyTake(pdTRUE, delay);
   }
 }
 #endif
 //*************************************************************************************************
 void FastAccelStepperEngine::init() {
+  struct engine_config_s config = ENGINE_CONFIG_DEFAULT;
+  init(config);
+}
+void FastAccelStepperEngine::init(const struct engine_config_s& config) {
 #if (TICKS_PER_S != 16000000L)
   upm_timer_freq = upm_from((uint32_t)TICKS_PER_S);
 #endif
+  uint32_t period_us = (uint32_t)config.manage_period_ms * 1000;
+#if defined(ARDUINO_ARCH_AVR)
+  // round to timer 1 overflows
+  uint32_t ovf_us = (uint32_t)(65536000000LL / TICKS_PER_S);
+  uint32_t n_ovf = (period_us + ovf_us / 2) / ovf_us;
+  if (n_ovf == 0) {
+    n_ovf = 1;
+  } else if (n_ovf > 255) {
+    n_ovf = 255;
+  }
+  fas_ovf_per_manage = n_ovf;
+  period_us = n_ovf * ovf_us;
+#endif
+  if (period_us == 0) {
+    period_us = 1000;
+  }
+  fas_manage_period_us = period_us;
+#if (FAS_DEBUG_LED == 1)
+  fas_debug_led_half_period = 500000L / period_us;
+  if (fas_debug_led_half_period == 0) {
+    fas_debug_led_half_period = 1;
+  }
+#endif
+  // A longer period needs the queue to be filled further ahead
+  fas_fill_ahead_ticks = TICKS_PER_S / 100;
+  if (period_us > 10000) {
+    fas_fill_ahead_ticks = US_TO_TICKS(period_us);
+  }
 #if defined(ARDUINO_ARCH_AVR)
   fas_engine = this;
 
@@ -85,15 +119,622 @@ void FastAccelStepperEngine::init() {
   interrupts();
 #endif
 #if defined(ARDUINO_ARCH_ESP32)
-#define STACK_SIZE 1000
-#define PRIORITY 1
-  xTaskCreate(StepperTask, "StepperTask", STACK_SIZE, this, PRIORITY, NULL);
+  if (config.task_core < 0) {
+    xTaskCreate(StepperTask, "StepperTask", config.task_stack_size, this,
+                config.task_priority, &fas_stepper_task);
+  } else {
+    xTaskCreatePinnedToCore(StepperTask, "StepperTask",
+                            config.task_stack_size, this,
+                            config.task_priority, &fas_stepper_task,
+                            config.task_core);
+  }
+#endif
+#if defined(FAS_LINUX)
+  fas_linux_start(this, config, period_us);
 #endif
 }
 //*************************************************************************************************
+uint32_t FastAccelStepperEngine::getTicks() { return fas_get_ticks(); }
+//*************************************************************************************************
+// Delay from startGroup() to the start of the steppers. This must cover the
+// time to start all group members.
+#define GROUP_START_DELAY_TICKS (TICKS_PER_S / 500)
+bool FastAccelStepperEngine::armGroup(FastAccelStepper* const steppers[],
+                                      uint8_t n) {
+  for (uint8_t i = 0; i < n; i++) {
+    if (steppers[i]->isRunning()) {
+      return false;
+    }
+  }
+  for (uint8_t i = 0; i < n; i++) {
+    fas_queue[steppers[i]->_queue_num].group_armed = true;
+  }
+  return true;
+}
+void FastAccelStepperEngine::startGroup(FastAccelStepper* const steppers[],
+                                        uint8_t n) {
+  // All members start at the same time. Members with empty queue start on
+  // their first command, but not before this time.
+  uint32_t start_ticks = fas_get_ticks() + GROUP_START_DELAY_TICKS;
+  for (uint8_t i = 0; i < n; i++) {
+    StepperQueue* q = &fas_queue[steppers[i]->_queue_num];
+    noInterrupts();
+    q->start_at_ticks = start_ticks;
+    q->start_at_valid = true;
+    q->group_armed = false;
+    if (!q->isRunning && !q->isQueueEmpty()) {
+      q->startQueue();
+    }
+    interrupts();
+  }
+}
+void FastAccelStepperEngine::forceStopGroup(FastAccelStepper* const steppers[],
+                                            uint8_t n) {
+  struct {
+    int32_t pos;
+    bool count_up;
+    uint8_t rp;
+    uint8_t wp;
+    uint16_t in_progress;
+  } snapshot[MAX_STEPPER];
+  if (n > MAX_STEPPER) {
+    n = MAX_STEPPER;
+  }
+
+  // first stop the ramp generators
+  for (uint8_t i = 0; i < n; i++) {
+    steppers[i]->rg.abort();
+  }
+
+  // stop the stepper interrupts at once and empty the queues
+  noInterrupts();
+  for (uint8_t i = 0; i < n; i++) {
+    StepperQueue* q = &fas_queue[steppers[i]->_queue_num];
+    snapshot[i].pos = q->pos_at_queue_end;
+    snapshot[i].count_up = (q->dir_at_queue_end == q->dirHighCountsUp);
+    snapshot[i].rp = q->read_idx;
+    snapshot[i].wp = q->next_write_idx;
+    snapshot[i].in_progress = q->stepsInProgress();
+    q->group_armed = false;
+    q->forceStop();
+    q->read_idx = q->next_write_idx;
+    q->period_at_queue_end_valid = false;
+  }
+  interrupts();
+
+  // the steppers keep the position of the stop
+  for (uint8_t i = 0; i < n; i++) {
+    StepperQueue* q = &fas_queue[steppers[i]->_queue_num];
+    q->pos_at_queue_end = q->positionBefore(
+        snapshot[i].rp, snapshot[i].wp, snapshot[i].pos, snapshot[i].count_up,
+        snapshot[i].in_progress);
+  }
+}
+//*************************************************************************************************
+int8_t FastAccelStepperEngine::moveLinear(FastAccelStepper* const steppers[],
+                                          const int32_t positions[],
+                                          uint8_t n, uint32_t min_step_us,
+                                          uint32_t accel) {
+  struct coordinated_move_s* c = &_coord;
+  if (n > MAX_STEPPER) {
+    n = MAX_STEPPER;
+  }
+  if (min_step_us == 0) {
+    return MOVE_ERR_SPEED_IS_UNDEFINED;
+  }
+  if (accel == 0) {
+    return MOVE_ERR_ACCELERATION_IS_UNDEFINED;
+  }
+  if (c->active) {
+    return MOVE_ERR_STEPPER_RUNNING;
+  }
+
+  // collect the axes to move with the lead axis first
+  FastAccelStepper* group[MAX_STEPPER];
+  int32_t lead_target = 0;
+  uint8_t m = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    FastAccelStepper* s = steppers[i];
+    if (s->isRunning() || s->isRampGeneratorActive()) {
+      return MOVE_ERR_STEPPER_RUNNING;
+    }
+    int32_t delta = positions[i] - s->getPositionAfterCommandsCompleted();
+    if (delta == 0) {
+      continue;
+    }
+    if ((delta < 0) && (s->_dirPin == PIN_UNDEFINED)) {
+      return MOVE_ERR_NO_DIRECTION_PIN;
+    }
+    if (s->rg.isOutsideLimits(positions[i])) {
+      return MOVE_ERR_POSITION_LIMIT;
+    }
+    struct coordinated_axis_s* a = &c->axis[m];
+    a->stepper = s;
+    a->steps = (delta > 0) ? delta : -delta;
+    a->done = 0;
+    a->step_at = 0;
+    a->dir_high = ((delta > 0) == s->_dirHighCountsUp);
+    if ((m == 0) || (a->steps > c->axis[0].steps)) {
+      struct coordinated_axis_s tmp = c->axis[0];
+      c->axis[0] = *a;
+      *a = tmp;
+      lead_target = positions[i];
+    }
+    m++;
+  }
+  if (m == 0) {
+    return MOVE_OK;
+  }
+  for (uint8_t i = 0; i < m; i++) {
+    group[i] = c->axis[i].stepper;
+  }
+
+  // The lead axis moves with the speed and acceleration along the path
+  // scaled by its share of the path length
+  FastAccelStepper* lead = group[0];
+  uint32_t lead_step_us = min_step_us;
+  uint32_t lead_accel = accel;
+  if (m > 1) {
+    upm_float len2 = upm_square(upm_from(c->axis[0].steps));
+    for (uint8_t i = 1; i < m; i++) {
+      len2 = upm_sum(len2, upm_square(upm_from(c->axis[i].steps)));
+    }
+    upm_float share = upm_divide(upm_from(c->axis[0].steps), upm_sqrt(len2));
+    lead_step_us = upm_to_u32(upm_divide(upm_from(min_step_us), share));
+    lead_accel = upm_to_u32(upm_multiply(upm_from(accel), share));
+    if (lead_accel == 0) {
+      lead_accel = 1;
+    }
+  }
+
+  c->is_arc = false;
+  return _startCoordinated(group, m,
+                           lead->getPositionAfterCommandsCompleted(),
+                           lead_target, lead_step_us, lead_accel);
+}
+
+// The ramp generator of group[0] plans the move from ramp_from to ramp_to
+int8_t FastAccelStepperEngine::_startCoordinated(
+    FastAccelStepper* const group[], uint8_t n, int32_t ramp_from,
+    int32_t ramp_to, uint32_t min_step_us, uint32_t accel) {
+  struct coordinated_move_s* c = &_coord;
+  if (!armGroup(group, n)) {
+    return MOVE_ERR_STEPPER_RUNNING;
+  }
+  c->n = n;
+  c->elapsed = 0;
+  c->started = false;
+  c->active = true;
+  // The lead axis fills the queues of all axes. The ramp generator takes
+  // the values from _config on moveTo(), so the configured ones are restored
+  // afterwards
+  FastAccelStepper* lead = group[0];
+  lead->_coord = c;
+  struct ramp_config_s saved = lead->rg._config;
+  lead->setSpeed(min_step_us);
+  lead->setAcceleration(accel);
+  int8_t res = lead->rg.moveTo(ramp_to, ramp_from,
+                               fas_queue[lead->_queue_num].ticks_at_queue_end);
+  lead->rg._config = saved;
+  if (res != MOVE_OK) {
+    lead->_coord = NULL;
+    c->active = false;
+    for (uint8_t i = 0; i < n; i++) {
+      fas_queue[group[i]->_queue_num].group_armed = false;
+    }
+    return res;
+  }
+  lead->isr_fill_queue();
+  startGroup(group, n);
+  // Queues, which run empty, are restarted relative to this time
+  c->start_ticks = fas_queue[lead->_queue_num].start_at_ticks;
+  c->started = true;
+  return MOVE_OK;
+}
+//*************************************************************************************************
+int8_t FastAccelStepper::addPositionEvent(int32_t position,
+                                          position_event_callback_t callback,
+                                          void* arg, uint8_t pin) {
+  StepperQueue* q = &fas_queue[_queue_num];
+  if (pin != PIN_UNDEFINED) {
+    digitalWrite(pin, LOW);
+    pinMode(pin, OUTPUT);
+  }
+  // The queue fill arms the events
+  while (!_lock_fill()) {
+  }
+  int8_t id = -1;
+  for (uint8_t i = 0; i < POSITION_EVENTS; i++) {
+    struct position_event_s* ev = &q->events[i];
+    if ((ev->state == EVENT_ARMED) && (ev->position == position)) {
+      id = -1;
+      break;
+    }
+    if ((id < 0) && ((ev->state == EVENT_FREE) || (ev->state == EVENT_FIRED))) {
+      id = i;
+    }
+  }
+  if (id >= 0) {
+    struct position_event_s* ev = &q->events[id];
+    ev->position = position;
+    ev->callback = callback;
+    ev->arg = arg;
+    q->setEventPin(ev, pin);
+    ev->state = EVENT_ARMED;
+  }
+  _unlock_fill();
+  return id;
+}
+bool FastAccelStepper::removePositionEvent(uint8_t id) {
+  if (id >= POSITION_EVENTS) {
+    return false;
+  }
+  while (!_lock_fill()) {
+  }
+  struct position_event_s* ev = &fas_queue[_queue_num].events[id];
+  bool res = (ev->state == EVENT_ARMED);
+  if (res) {
+    ev->state = EVENT_FREE;
+  }
+  _unlock_fill();
+  return res;
+}
+bool FastAccelStepper::getPositionEvent(uint8_t id, uint32_t* ticks) {
+  if (id >= POSITION_EVENTS) {
+    return false;
+  }
+  struct position_event_s* ev = &fas_queue[_queue_num].events[id];
+  if (ev->state != EVENT_FIRED) {
+    return false;
+  }
+  *ticks = ev->ticks;
+  return true;
+}
+
+//*************************************************************************************************
+// Synchronized move: Scaled by the distance d of its axis, each ramp
+// generator has to run the same profile. For speed v and acceleration a the
+// profile is limited by v/d and a/d. So the limiting axis has the largest
+// min_travel_ticks * d for the speed and the largest upm_inv_accel2 * d for
+// the acceleration, which may be different axes. The other axes get
+// min_travel_ticks and upm_inv_accel2 of these scaled by d_limit / d. Then
+// the ramp_steps of each axis are proportional to d and all ramps take the
+// same time.
+//*************************************************************************************************
+int8_t FastAccelStepperEngine::moveSynchronized(
+    FastAccelStepper* const steppers[], const int32_t positions[], uint8_t n) {
+  FastAccelStepper* group[MAX_STEPPER];
+  int32_t target[MAX_STEPPER];
+  uint32_t dist[MAX_STEPPER];
+  if (n > MAX_STEPPER) {
+    n = MAX_STEPPER;
+  }
+  uint64_t coast = 0;
+  upm_float accel_ref = 0;
+  uint8_t m = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    FastAccelStepper* s = steppers[i];
+    if (s->isRunning() || s->isRampGeneratorActive()) {
+      return MOVE_ERR_STEPPER_RUNNING;
+    }
+    int32_t delta = positions[i] - s->getPositionAfterCommandsCompleted();
+    if (delta == 0) {
+      continue;
+    }
+    if ((delta < 0) && (s->_dirPin == PIN_UNDEFINED)) {
+      return MOVE_ERR_NO_DIRECTION_PIN;
+    }
+    if (s->rg.isOutsideLimits(positions[i])) {
+      return MOVE_ERR_POSITION_LIMIT;
+    }
+    struct ramp_config_s* cfg = &s->rg._config;
+    if (cfg->min_travel_ticks == 0) {
+      return MOVE_ERR_SPEED_IS_UNDEFINED;
+    }
+    if (cfg->upm_inv_accel2 == 0) {
+      return MOVE_ERR_ACCELERATION_IS_UNDEFINED;
+    }
+    uint32_t d = (delta > 0) ? delta : -delta;
+    uint64_t t = (uint64_t)cfg->min_travel_ticks * d;
+    if (t > coast) {
+      coast = t;
+    }
+    upm_float a = upm_multiply(cfg->upm_inv_accel2, upm_from(d));
+    // upm_float with positive values compares like its value
+    if ((m == 0) || (a > accel_ref)) {
+      accel_ref = a;
+    }
+    group[m] = s;
+    target[m] = positions[i];
+    dist[m++] = d;
+  }
+  if (m == 0) {
+    return MOVE_OK;
+  }
+  if (!armGroup(group, m)) {
+    return MOVE_ERR_STEPPER_RUNNING;
+  }
+  // All axes are planned, before any queue is filled. So a rejected axis
+  // leaves the others at rest.
+  for (uint8_t i = 0; i < m; i++) {
+    FastAccelStepper* s = group[i];
+    uint64_t t = (coast + dist[i] - 1) / dist[i];
+    if (t > 0xffffffff) {
+      t = 0xffffffff;
+    }
+    // The ramp generator takes the values from _config on moveTo(), so the
+    // configured ones are restored afterwards
+    struct ramp_config_s saved = s->rg._config;
+    s->rg.setConfig(t, upm_divide(accel_ref, upm_from(dist[i])));
+    int8_t res = s->rg.moveTo(target[i], s->getPositionAfterCommandsCompleted(),
+                              fas_queue[s->_queue_num].ticks_at_queue_end);
+    s->rg._config = saved;
+    if (res != MOVE_OK) {
+      for (uint8_t j = 0; j < m; j++) {
+        if (j < i) {
+          group[j]->rg.abort();
+        }
+        fas_queue[group[j]->_queue_num].group_armed = false;
+      }
+      return res;
+    }
+  }
+  for (uint8_t i = 0; i < m; i++) {
+    group[i]->isr_fill_queue();
+  }
+  startGroup(group, m);
+  return MOVE_OK;
+}
+
+//*************************************************************************************************
+// Arc: The path is walked with the midpoint circle algorithm. Within 45° of
+// an axis, the other coordinate is the major one and changes with each step.
+// The minor coordinate follows, if the midpoint between its two choices is
+// on the other side of the circle. So the walk visits for each value of the
+// major coordinate the point closest to the circle. It switches the major
+// coordinate, when this has become the larger one.
+//
+// For a circle with r² = R2, this happens at |major| = y_s, the smallest y
+// with y >= round(sqrt(R2 - y²)), and the other coordinate is then
+// x_s = round(sqrt(R2 - y_s²)). Thus each section of the walk around an axis
+// runs from |major| = x_s to the other side with |major| = y_s, which gives
+// the number of steps along the path in advance.
+//*************************************************************************************************
+static uint32_t arc_isqrt(uint64_t v) {
+  uint64_t res = 0;
+  uint64_t bit = (uint64_t)1 << 62;
+  while (bit > v) {
+    bit >>= 2;
+  }
+  while (bit != 0) {
+    if (v >= res + bit) {
+      v -= res + bit;
+      res = (res >> 1) + bit;
+    } else {
+      res >>= 1;
+    }
+    bit >>= 2;
+  }
+  return res;
+}
+
+// direction of the major coordinate for the given sign of the minor one
+static int8_t arc_major_dir(bool y_major, bool ccw, bool minor_positive) {
+  // the tangent is (-y, x) for counter clockwise
+  if (y_major) {
+    return (minor_positive == ccw) ? 1 : -1;
+  }
+  return (minor_positive == ccw) ? -1 : 1;
+}
+
+// Returns the number of steps along the path or 0, if the walk misses the
+// end position
+static uint32_t arc_path_steps(const struct coordinated_arc_s* a,
+                               uint32_t x_s, uint32_t y_s) {
+  bool y_major = a->y_major;
+  int32_t m = y_major ? a->y : a->x;
+  bool side = (y_major ? a->x : a->y) > 0;
+  uint32_t steps = 0;
+  // the first section, three full ones and the first one again
+  for (uint8_t i = 0; i < 6; i++) {
+    int8_t dir = arc_major_dir(y_major, a->ccw, side);
+    int32_t exit_m = dir * (int32_t)y_s;
+    uint32_t len = (exit_m - m) * dir;
+    int32_t end_m = y_major ? a->end_y : a->end_x;
+    int32_t end_n = y_major ? a->end_x : a->end_y;
+    if ((end_n != 0) && ((end_n > 0) == side)) {
+      int32_t d = (end_m - m) * dir;
+      if ((d > 0) && ((uint32_t)d <= len)) {
+        return steps + d;
+      }
+    }
+    steps += len;
+    m = side ? (int32_t)x_s : -(int32_t)x_s;
+    side = (dir > 0);
+    y_major = !y_major;
+  }
+  return 0;
+}
+
+// Quadrant of a point for the counter clockwise walk. Entering quadrant
+// 1, 2, 3 resp. 0 passes the point on the axis (0,r), (-r,0), (0,-r) resp.
+// (r,0).
+static uint8_t arc_quadrant(int32_t x, int32_t y) {
+  if ((x > 0) && (y >= 0)) {
+    return 0;
+  }
+  if ((x <= 0) && (y > 0)) {
+    return 1;
+  }
+  if ((x < 0) && (y <= 0)) {
+    return 2;
+  }
+  return 3;
+}
+
+// Range of the path relative to the center: the start, the end and the
+// points on the axes, which the path passes. r is the radius of these.
+// A clockwise arc is walked counter clockwise with y mirrored.
+static void arc_range(const struct coordinated_arc_s* a, int32_t r,
+                      int32_t lo[2], int32_t hi[2]) {
+  int32_t sign = a->ccw ? 1 : -1;
+  int32_t sy = sign * a->y;
+  int32_t ey = sign * a->end_y;
+  lo[0] = min(a->x, a->end_x);
+  hi[0] = max(a->x, a->end_x);
+  lo[1] = min(a->y, a->end_y);
+  hi[1] = max(a->y, a->end_y);
+  uint8_t q = arc_quadrant(a->x, sy);
+  uint8_t n = (arc_quadrant(a->end_x, ey) - q) & 3;
+  if ((n == 0) && ((int64_t)a->x * ey - (int64_t)sy * a->end_x <= 0)) {
+    // the end is behind the start or the same point: around the circle
+    n = 4;
+  }
+  static const int8_t axis_x[4] = {1, 0, -1, 0};
+  static const int8_t axis_y[4] = {0, 1, 0, -1};
+  for (uint8_t i = 0; i < n; i++) {
+    q = (q + 1) & 3;
+    int32_t px = axis_x[q] * r;
+    int32_t py = sign * axis_y[q] * r;
+    lo[0] = min(lo[0], px);
+    hi[0] = max(hi[0], px);
+    lo[1] = min(lo[1], py);
+    hi[1] = max(hi[1], py);
+  }
+}
+
+// Performs one step along the path and returns the steps of x and y
+static void arc_walk(struct coordinated_arc_s* a, int8_t* step_x,
+                     int8_t* step_y) {
+  int32_t* m = a->y_major ? &a->y : &a->x;
+  int32_t* n = a->y_major ? &a->x : &a->y;
+  int8_t dm = arc_major_dir(a->y_major, a->ccw, *n > 0);
+  uint32_t m_abs = abs(*m);
+  a->err += 2 * *m * dm + 1;
+  *m += dm;
+  int32_t n_abs = abs(*n);
+  int8_t dn = 0;
+  if ((uint32_t)abs(*m) > m_abs) {
+    // moving away from the axis, so the minor coordinate may shrink
+    if (4 * a->err - 4 * n_abs + 1 > 0) {
+      dn = (*n > 0) ? -1 : 1;
+    }
+  } else if (4 * a->err + 4 * n_abs + 1 < 0) {
+    dn = (*n > 0) ? 1 : -1;
+  }
+  if (dn != 0) {
+    a->err += 2 * *n * dn + 1;
+    *n += dn;
+  }
+  *step_x = a->y_major ? dn : dm;
+  *step_y = a->y_major ? dm : dn;
+  if (abs(*m) >= abs(*n)) {
+    a->y_major = !a->y_major;
+  }
+}
+
+int8_t FastAccelStepperEngine::arcTo(FastAccelStepper* x, FastAccelStepper* y,
+                                     int32_t center_x, int32_t center_y,
+                                     int32_t end_x, int32_t end_y,
+                                     bool clockwise, uint32_t min_step_us,
+                                     uint32_t accel) {
+  struct coordinated_move_s* c = &_coord;
+  if (min_step_us == 0) {
+    return MOVE_ERR_SPEED_IS_UNDEFINED;
+  }
+  if (accel == 0) {
+    return MOVE_ERR_ACCELERATION_IS_UNDEFINED;
+  }
+  if (c->active || (x == y)) {
+    return MOVE_ERR_STEPPER_RUNNING;
+  }
+  FastAccelStepper* group[2] = {x, y};
+  for (uint8_t i = 0; i < 2; i++) {
+    FastAccelStepper* s = group[i];
+    if (s->isRunning() || s->isRampGeneratorActive()) {
+      return MOVE_ERR_STEPPER_RUNNING;
+    }
+    if (s->_dirPin == PIN_UNDEFINED) {
+      return MOVE_ERR_NO_DIRECTION_PIN;
+    }
+  }
+
+  struct coordinated_arc_s* a = &c->arc;
+  a->x = x->getPositionAfterCommandsCompleted() - center_x;
+  a->y = y->getPositionAfterCommandsCompleted() - center_y;
+  a->end_x = end_x - center_x;
+  a->end_y = end_y - center_y;
+  int64_t r2 = (int64_t)a->x * a->x + (int64_t)a->y * a->y;
+  if ((r2 == 0) || (r2 > (int64_t)ARC_MAX_RADIUS * ARC_MAX_RADIUS) ||
+      (abs(a->end_x) > ARC_MAX_RADIUS + 1) ||
+      (abs(a->end_y) > ARC_MAX_RADIUS + 1)) {
+    return MOVE_ERR_ARC_GEOMETRY;
+  }
+  uint32_t r = arc_isqrt(r2);
+  int64_t e2 = (int64_t)a->end_x * a->end_x + (int64_t)a->end_y * a->end_y;
+  int64_t dr2 = e2 - r2;
+  if ((dr2 > 2 * (int64_t)r + 1) || (-dr2 > 2 * (int64_t)r + 1)) {
+    return MOVE_ERR_ARC_GEOMETRY;
+  }
+  // smallest y with 8y² + 4y + 1 >= 4R2
+  uint64_t y_s = arc_isqrt(r2 / 2);
+  while (8 * y_s * y_s + 4 * y_s + 1 < 4 * (uint64_t)r2) {
+    y_s++;
+  }
+  while ((y_s > 0) &&
+         (8 * (y_s - 1) * (y_s - 1) + 4 * (y_s - 1) + 1 >= 4 * (uint64_t)r2)) {
+    y_s--;
+  }
+  uint64_t v = r2 - y_s * y_s;
+  uint64_t x_s = arc_isqrt(v);
+  if (v > x_s * x_s + x_s) {
+    x_s++;
+  }
+
+  a->ccw = !clockwise;
+  a->err = 0;
+  a->radius = r;
+  uint32_t x_abs = abs(a->x);
+  uint32_t y_abs = abs(a->y);
+  a->y_major = (y_abs < x_abs);
+  if (y_abs == x_abs) {
+    // on the diagonal the major coordinate moves towards its axis
+    a->y_major = (arc_major_dir(true, a->ccw, a->x > 0) > 0) != (a->y > 0);
+  }
+  uint32_t steps = arc_path_steps(a, x_s, y_s);
+  if (steps == 0) {
+    return MOVE_ERR_ARC_GEOMETRY;
+  }
+  // the walk passes the axes at the lattice point closest to the circle
+  int32_t r_axis = r + ((r2 > (int64_t)r * r + r) ? 1 : 0);
+  int32_t lo[2];
+  int32_t hi[2];
+  arc_range(a, r_axis, lo, hi);
+  if (x->rg.isOutsideLimits(center_x + lo[0]) ||
+      x->rg.isOutsideLimits(center_x + hi[0]) ||
+      y->rg.isOutsideLimits(center_y + lo[1]) ||
+      y->rg.isOutsideLimits(center_y + hi[1])) {
+    return MOVE_ERR_POSITION_LIMIT;
+  }
+  a->remaining = steps;
+  a->target = end_x;
+  a->ramp_ticks = TICKS_FOR_STOPPED_MOTOR;
+  a->cmd_steps = 0;
+  for (uint8_t i = 0; i < 2; i++) {
+    c->axis[i].stepper = group[i];
+    c->axis[i].step_at = 0;
+    c->axis[i].run_steps = 0;
+  }
+  c->is_arc = true;
+  return _startCoordinated(group, 2, end_x - steps, end_x, min_step_us, accel);
+}
+//*************************************************************************************************
 bool FastAccelStepperEngine::_isValidStepPin(uint8_t step_pin) {
-#if defined(ARDUINO_ARCH_AVR)
-  return ((step_pin == stepPinStepperA) || (step_pin == stepPinStepperB));
+#if defined(ARDUINO_ARCH_AVR) && (FAS_SOFT_TIMER == 1)
+  return true;  // other pins use software timer channels
+#elif defined(ARDUINO_ARCH_AVR)
+  return ((step_pin == stepPinStepperA) ||
+          ((NUM_HW_QUEUES > 1) && (step_pin == stepPinStepperB)));
 #elif defined(ARDUINO_ARCH_ESP32)
   return true;  // for now
 #else
@@ -103,6 +744,18 @@ bool FastAccelStepperEngine::_isValidStepPin(uint8_t step_pin) {
 //*************************************************************************************************
 FastAccelStepper* FastAccelStepperEngine::stepperConnectToPin(
     uint8_t step_pin) {
+  // The default queue buffers are only allocated, if this function is used.
+  // Every successful connect increments _next_stepper_num, so each stepper
+  // gets its own buffer.
+  static StepperQueueBuffer<QUEUE_LEN> queue_buffer[MAX_STEPPER];
+  if (_next_stepper_num >= MAX_STEPPER) {
+    return NULL;
+  }
+  return _stepperConnectToPin(step_pin, queue_buffer[_next_stepper_num].entry,
+                              QUEUE_LEN);
+}
+FastAccelStepper* FastAccelStepperEngine::_stepperConnectToPin(
+    uint8_t step_pin, union queue_unit* queue_unit, uint8_t queue_len) {
   // Check if already connected
   for (uint8_t i = 0; i < MAX_STEPPER; i++) {
     FastAccelStepper* s = _stepper[i];
@@ -120,11 +773,23 @@ FastAccelStepper* FastAccelStepperEngine::stepperConnectToPin(
   // The stepper connection is hardcoded for AVR
   if (step_pin == stepPinStepperA) {
     fas_stepper_num = 0;
-  } else {
+  } else if ((NUM_HW_QUEUES > 1) && (step_pin == stepPinStepperB)) {
     fas_stepper_num = 1;
+  } else {
+    // next software timer channel after the ones in use
+    fas_stepper_num = NUM_HW_QUEUES;
+    for (uint8_t i = 0; i < _next_stepper_num; i++) {
+      uint8_t queue_num = _stepper[i]->_queue_num;
+      if (queue_num >= fas_stepper_num) {
+        fas_stepper_num = queue_num + 1;
+      }
+    }
+    if (fas_stepper_num >= MAX_STEPPER) {
+      return NULL;
+    }
   }
 #endif
-#if defined(ARDUINO_ARCH_ESP32)
+#if defined(ARDUINO_ARCH_ESP32) || defined(FAS_LINUX) || defined(TEST)
   if (_next_stepper_num >= MAX_STEPPER) {
     return NULL;
   }
@@ -133,9 +798,11 @@ FastAccelStepper* FastAccelStepperEngine::stepperConnectToPin(
   uint8_t stepper_num = _next_stepper_num;
   _next_stepper_num++;
 
-#if defined(ARDUINO_ARCH_AVR) || defined(ESP32) || defined(TEST)
+#if defined(ARDUINO_ARCH_AVR) || defined(ESP32) || defined(FAS_LINUX) || \
+    defined(TEST)
   FastAccelStepper* s = &fas_stepper[fas_stepper_num];
   _stepper[stepper_num] = s;
+  fas_queue[fas_stepper_num].attachBuffer(queue_unit, queue_len);
   s->init(fas_stepper_num, step_pin);
   return s;
 #else
@@ -143,31 +810,65 @@ FastAccelStepper* FastAccelStepperEngine::stepperConnectToPin(
 #endif
 }
 //*************************************************************************************************
+#if (FAS_DEBUG_LED == 1)
 void FastAccelStepperEngine::setDebugLed(uint8_t ledPin) {
   fas_ledPin = ledPin;
   pinMode(fas_ledPin, OUTPUT);
   digitalWrite(fas_ledPin, LOW);
 }
+#endif
 //*************************************************************************************************
 void FastAccelStepperEngine::manageSteppers() {
-#ifndef TEST
+#if !defined(ARDUINO_ARCH_ESP32)
+  fas_refill_pending = false;
+#endif
+#if !defined(TEST) && (FAS_DEBUG_LED == 1)
   if (fas_ledPin != PIN_UNDEFINED) {
     fas_debug_led_cnt++;
-    if (fas_debug_led_cnt == DEBUG_LED_HALF_PERIOD) {
+    if (fas_debug_led_cnt == fas_debug_led_half_period) {
       digitalWrite(fas_ledPin, HIGH);
     }
-    if (fas_debug_led_cnt == 2 * DEBUG_LED_HALF_PERIOD) {
+    if (fas_debug_led_cnt == 2 * fas_debug_led_half_period) {
       digitalWrite(fas_ledPin, LOW);
       fas_debug_led_cnt = 0;
     }
   }
 #endif
+  // Earliest deadline first: The stepper with the least buffered time gets
+  // the next command, so a stepper late in the list does not run empty, while
+  // the others are topped up. A stepper drops out, if it needs no more
+  // commands.
+  bool need_fill[MAX_STEPPER];
+  uint32_t buffered[MAX_STEPPER];
+  for (uint8_t i = 0; i < _next_stepper_num; i++) {
+    FastAccelStepper* s = _stepper[i];
+    need_fill[i] = (s != NULL);
+    if (s) {
+      buffered[i] =
+          fas_queue[s->_queue_num].ticksInQueue(fas_fill_ahead_ticks);
+    }
+  }
+  while (true) {
+    uint8_t next = MAX_STEPPER;
+    for (uint8_t i = 0; i < _next_stepper_num; i++) {
+      if (need_fill[i] &&
+          ((next == MAX_STEPPER) || (buffered[i] < buffered[next]))) {
+        next = i;
+      }
+    }
+    if (next == MAX_STEPPER) {
+      break;
+    }
+    need_fill[next] = _stepper[next]->isr_single_fill_queue(&buffered[next]);
+  }
+#if (FAS_AUTO_ENABLE == 1)
   for (uint8_t i = 0; i < _next_stepper_num; i++) {
     FastAccelStepper* s = _stepper[i];
     if (s) {
-      s->manage();
+      s->check_for_auto_disable();
     }
   }
+#endif
 }
 
 //*************************************************************************************************
@@ -183,11 +884,13 @@ void FastAccelStepperEngine::manageSteppers() {
 //*************************************************************************************************
 
 //*************************************************************************************************
-int8_t FastAccelStepper::addQueueEntry(uint32_t delta_ticks, uint8_t steps,
+int8_t FastAccelStepper::addQueueEntry(uint32_t delta_ticks, uint16_t steps,
                                        bool dir_high) {
-  if (steps >= 128) {
+#if (MAX_STEPS_PER_COMMAND < 65535)
+  if (steps > MAX_STEPS_PER_COMMAND) {
     return AQE_STEPS_ERROR;
   }
+#endif
   if (steps == 0) {
     return AQE_STEPS_ERROR;
   }
@@ -196,7 +899,11 @@ int8_t FastAccelStepper::addQueueEntry(uint32_t delta_ticks, uint8_t steps,
   }
 
   StepperQueue* q = &fas_queue[_queue_num];
+  if (delta_ticks <= q->step_pulse_ticks) {
+    return AQE_TOO_LOW;
+  }
   int res = AQE_OK;
+#if (FAS_AUTO_ENABLE == 1)
   if (_autoEnable) {
     noInterrupts();
     uint16_t delay_counter = _auto_disable_delay_counter;
@@ -215,9 +922,11 @@ int8_t FastAccelStepper::addQueueEntry(uint32_t delta_ticks, uint8_t steps,
       }
     }
   }
+#endif
   if (steps > 0) {
     res = q->addQueueEntry(delta_ticks, steps, dir_high);
   }
+#if (FAS_AUTO_ENABLE == 1)
   if (_autoEnable) {
     if (res == AQE_OK) {
       noInterrupts();
@@ -225,10 +934,72 @@ int8_t FastAccelStepper::addQueueEntry(uint32_t delta_ticks, uint8_t steps,
       interrupts();
     }
   }
+#endif
 
   return res;
 }
 
+uint8_t FastAccelStepper::addQueueEntries(const struct stepper_command_s* cmd,
+                                          uint8_t n) {
+  // find the valid commands
+  uint16_t min_ticks = fas_queue[_queue_num].step_pulse_ticks;
+  uint8_t valid = 0;
+  while (valid < n) {
+    const struct stepper_command_s* c = &cmd[valid];
+    if ((c->steps == 0) || (c->ticks > ABSOLUTE_MAX_TICKS) ||
+        (c->ticks <= min_ticks)) {
+      break;
+    }
+#if (MAX_STEPS_PER_COMMAND < 65535)
+    if (c->steps > MAX_STEPS_PER_COMMAND) {
+      break;
+    }
+#endif
+    valid++;
+  }
+  if (valid == 0) {
+    return 0;
+  }
+
+  uint8_t added = 0;
+#if (FAS_AUTO_ENABLE == 1)
+  if (_autoEnable) {
+    noInterrupts();
+    uint16_t delay_counter = _auto_disable_delay_counter;
+    interrupts();
+    if (delay_counter == 0) {
+      // outputs are disabled, so the first command may need the on delay
+      if (addQueueEntry(cmd->ticks, cmd->steps, cmd->dir_high) != AQE_OK) {
+        return 0;
+      }
+      added = 1;
+    }
+  }
+#endif
+  StepperQueue* q = &fas_queue[_queue_num];
+  added += q->addQueueEntries(&cmd[added], valid - added);
+#if (FAS_AUTO_ENABLE == 1)
+  if (_autoEnable) {
+    if (added > 0) {
+      noInterrupts();
+      _auto_disable_delay_counter = _off_delay_count;
+      interrupts();
+    }
+  }
+#endif
+  return added;
+}
+
+bool FastAccelStepper::setStartTime(uint32_t start_ticks) {
+  StepperQueue* q = &fas_queue[_queue_num];
+  if (q->isRunning) {
+    return false;
+  }
+  q->start_at_ticks = start_ticks;
+  q->start_at_valid = true;
+  return true;
+}
+
 //*************************************************************************************************
 // fill_queue generates commands to the stepper for executing a ramp
 //
@@ -250,54 +1021,669 @@ int8_t FastAccelStepper::addQueueEntry(uint32_t delta_ticks, uint8_t steps,
 //
 //*************************************************************************************************
 
+bool FastAccelStepper::_lock_fill() {
+  // The queue can be filled from the stepper task/ISR and by stopMoveNow()
+#if defined(ARDUINO_ARCH_AVR)
+  noInterrupts();
+  bool busy = _fill_busy;
+  _fill_busy = true;
+  interrupts();
+#else
+  bool busy = __atomic_test_and_set(&_fill_busy, __ATOMIC_ACQUIRE);
+#endif
+  return !busy;
+}
+
+void FastAccelStepper::_unlock_fill() {
+#if defined(ARDUINO_ARCH_AVR)
+  _fill_busy = false;
+#else
+  __atomic_clear(&_fill_busy, __ATOMIC_RELEASE);
+#endif
+}
+
 void FastAccelStepper::isr_fill_queue() {
+  if (!_lock_fill()) {
+    return;
+  }
+  uint32_t buffered;
+  while (_fill_queue_once(&buffered)) {
+  }
+  _unlock_fill();
+}
+
+bool FastAccelStepper::isr_single_fill_queue(uint32_t* buffered) {
+  if (!_lock_fill()) {
+    return false;
+  }
+  bool more = _fill_queue_once(buffered);
+  _unlock_fill();
+  return more;
+}
+
+bool FastAccelStepper::_fill_queue_once(uint32_t* buffered) {
+  if ((_coord != NULL) && _coord->is_arc) {
+    return _fill_arc_once(buffered);
+  }
   // Check preconditions to be allowed to fill the queue
   if (!rg.isRampGeneratorActive()) {
-    return;
+    _truncate_queue = false;
+    if ((_coord != NULL) && _coord->started) {
+      // the coordinated move is completely in the queues
+      _coord->active = false;
+      _coord = NULL;
+    }
+    return false;
   }
-  if (rg._config.min_travel_ticks == 0) {
+  // a coordinated move does not use the configured values
+  if ((_coord == NULL) && (rg._config.min_travel_ticks == 0)) {
 #ifdef TEST
     assert(false);
 #endif
-    return;
+    return false;
   }
 
-  // preconditions are fulfilled, so create the command(s)
+  // preconditions are fulfilled, so create the command
   struct ramp_command_s cmd;
   StepperQueue* q = &fas_queue[_queue_num];
-  // Plan ahead for max. 10 ms. Currently hard coded
-  while (!isQueueFull() && !q->hasTicksInQueue(TICKS_PER_S / 100)) {
+  if (_truncate_queue) {
+    // stopMove() has been called
+    _truncate_queue = false;
+    // The queues of a coordinated move or a gear master are not truncated,
+    // because the commands of the other axes cannot be matched to the
+    // removed ones
+    if ((_coord == NULL) && (_gear_first == NULL) && q->truncateTail()) {
+      rg.restartStop(q->ticks_at_queue_end,
+                     q->dir_at_queue_end == _dirHighCountsUp);
+    }
+  }
+  // Plan ahead for max. 10 ms or the manage period
+  uint32_t queued_ticks = q->ticksInQueue(fas_fill_ahead_ticks);
+  if (isQueueFull() || (queued_ticks >= fas_fill_ahead_ticks)) {
+    return false;
+  }
+  if ((_coord != NULL) && !_followersHaveSpace(_coord)) {
+    return false;
+  }
+  if ((_gear_first != NULL) && !_gearFollowersHaveSpace()) {
+    return false;
+  }
 #if (TEST_MEASURE_ISR_SINGLE_FILL == 1)
-    // For run time measurement
-    uint32_t runtime_us = micros();
+  // For run time measurement
+  uint32_t runtime_us = micros();
 #endif
-    int8_t res = AQE_OK;
-    bool have_command = rg.getNextCommand(
-        q->ticks_at_queue_end, getPositionAfterCommandsCompleted(), &cmd);
-    if (have_command) {
-      res =
-          addQueueEntry(cmd.ticks, cmd.steps, cmd.count_up == _dirHighCountsUp);
+  int8_t res = AQE_OK;
+  bool have_command = rg.getNextCommand(
+      q->ticks_at_queue_end, getPositionAfterCommandsCompleted(), &cmd);
+  if (have_command) {
+    bool dir_high = (cmd.count_up == _dirHighCountsUp);
+    if (_coord != NULL) {
+      res = _addCoordinatedEntry(_coord, _coord->elapsed, cmd.ticks,
+                                 cmd.steps, dir_high);
+      if ((res == AQE_OK) && !_addFollowerEntries(_coord, cmd.ticks,
+                                                  cmd.steps)) {
+        // A follower would lose steps, so the move ends after the queued
+        // commands
+        rg.abort();
+        return false;
+      }
+    } else if (_gear_first != NULL) {
+      res = _addMasterEntry(cmd.ticks, cmd.steps, cmd.count_up);
+    } else {
+      res = addQueueEntry(cmd.ticks, cmd.steps, dir_high);
     }
+  }
 
 #if (TEST_MEASURE_ISR_SINGLE_FILL == 1)
-    // For run time measurement
-    runtime_us = micros() - runtime_us;
-    max_micros = max(max_micros, runtime_us);
+  // For run time measurement
+  runtime_us = micros() - runtime_us;
+  max_micros = max(max_micros, runtime_us);
 #endif
-    if (!have_command) {
-      break;
+  if (!have_command) {
+    return false;
+  }
+  if (res == AQE_FULL) {
+    return false;
+  } else if (res != AQE_OK) {
+    // TODO: How to deal with these error ?
+    rg.abort();
+    return false;
+  }
+  // The queue walk is not repeated for the added command. Its time is
+  // capped like in ticksInQueue().
+  uint32_t ahead = fas_fill_ahead_ticks - queued_ticks;
+  if (cmd.steps >= ahead / cmd.ticks) {
+    *buffered = fas_fill_ahead_ticks;
+  } else {
+    *buffered = queued_ticks + cmd.steps * cmd.ticks;
+  }
+  return true;
+}
+
+//*************************************************************************************************
+// Coordinated move: The lead axis adds its command and the steps of the
+// other axes (followers), which fall into the time of this command. A
+// follower with D steps makes its step j, when the lead axis with L steps
+// passes j * L / D. Within the lead command, the lead axis passes s0 + x
+// after x * ticks, so the times of the follower steps are calculated from
+// the integer positions without accumulating errors.
+//
+// A follower command is added as one step for the gap to the follower's
+// last step and one command for the remaining steps of this window. If the
+// gap matches the period of the remaining steps, one command is used.
+//*************************************************************************************************
+bool FastAccelStepper::_followersHaveSpace(struct coordinated_move_s* c) {
+  // two commands, one of them may be split for the direction setup time
+  for (uint8_t i = 1; i < c->n; i++) {
+    FastAccelStepper* s = c->axis[i].stepper;
+    if (!fas_queue[s->_queue_num].hasSpaceForCommands(3)) {
+      return false;
     }
-    if (res == AQE_FULL) {
-      break;
-    } else if (res != AQE_OK) {
-      // TODO: How to deal with these error ?
+  }
+  return true;
+}
+
+// ticks * num / den for num / den < 65536 without overflow
+static uint64_t coord_scale(uint32_t ticks, uint64_t num, uint32_t den) {
+  uint64_t res = ticks;
+  res *= num / den;
+  res += (uint64_t)ticks * (num % den) / den;
+  return res;
+}
+
+bool FastAccelStepper::_addFollowerEntries(struct coordinated_move_s* c,
+                                           uint32_t ticks, uint16_t steps) {
+  bool ok = true;
+  uint32_t lead_steps = c->axis[0].steps;
+  uint64_t s0 = c->axis[0].done;
+  uint32_t s1 = s0 + steps;
+  uint32_t window_at = c->elapsed;
+  c->axis[0].done = s1;
+  c->elapsed += ticks * steps;
+  c->axis[0].step_at = c->elapsed;
+  for (uint8_t i = 1; i < c->n; i++) {
+    struct coordinated_axis_s* f = &c->axis[i];
+    uint32_t last = (uint64_t)s1 * f->steps / lead_steps;
+    if (last == f->done) {
+      continue;
+    }
+    uint16_t k = last - f->done;
+    // offsets of the first and last step from the window start
+    uint64_t first_off = coord_scale(
+        ticks, (uint64_t)(f->done + 1) * lead_steps - s0 * f->steps, f->steps);
+    uint64_t last_off = coord_scale(
+        ticks, (uint64_t)last * lead_steps - s0 * f->steps, f->steps);
+    f->done = last;
+    uint32_t first_at = window_at + (uint32_t)first_off;
+    uint32_t period = 0;
+    if (k > 1) {
+      uint64_t p = (last_off - first_off) / (k - 1);
+      period = (p > ABSOLUTE_MAX_TICKS) ? ABSOLUTE_MAX_TICKS : p;
+    }
+    FastAccelStepper* s = f->stepper;
+    uint32_t gap = first_at - f->step_at;
+    if (c->started && !s->isRunning()) {
+      // The follower has run empty after its last step, so the queue is
+      // restarted shortly before the first step
+      gap = MIN_DELTA_TICKS;
+    } else if (gap > ABSOLUTE_MAX_TICKS) {
+      gap = ABSOLUTE_MAX_TICKS;
+    } else if (gap < MIN_DELTA_TICKS) {
+      gap = MIN_DELTA_TICKS;
+    }
+    uint32_t diff = (gap > period) ? gap - period : period - gap;
+    uint32_t entry_at = first_at - gap;
+    int8_t res;
+    if ((k > 1) && (diff <= (period >> 8) + 1)) {
+      // the deviation is corrected with the next gap
+      res = s->_addCoordinatedEntry(c, entry_at, period, k, f->dir_high);
+      f->step_at = entry_at + (uint32_t)k * period;
+    } else {
+      res = s->_addCoordinatedEntry(c, entry_at, gap, 1, f->dir_high);
+      if ((res == AQE_OK) && (k > 1)) {
+        res = s->_addCoordinatedEntry(c, entry_at + gap, period, k - 1,
+                                      f->dir_high);
+      }
+      f->step_at = entry_at + gap + (uint32_t)(k - 1) * period;
+    }
+    if (res != AQE_OK) {
+      ok = false;
+    }
+  }
+  return ok;
+}
+
+// entry_at is the time, at which the command should start, if the queue has
+// run empty. A running queue continues with the command anyway.
+int8_t FastAccelStepper::_addCoordinatedEntry(struct coordinated_move_s* c,
+                                              uint32_t entry_at,
+                                              uint32_t ticks, uint16_t steps,
+                                              bool dir_high) {
+  if (!c->started) {
+    // the group start applies
+    return addQueueEntry(ticks, steps, dir_high);
+  }
+  StepperQueue* q = &fas_queue[_queue_num];
+  uint32_t start_ticks = c->start_ticks + entry_at;
+  bool stopped = !q->isRunning;
+  uint32_t now = fas_get_ticks();
+  int32_t late = now - start_ticks;
+  if (stopped && (steps == 1) && (late > -(int32_t)MIN_DELTA_TICKS)) {
+    // The queue has run empty after the step was planned, so the start
+    // time is (almost) over. The period before the single step is
+    // shortened, so the step is still in time.
+    uint32_t shorten = late + MIN_DELTA_TICKS;
+    if (ticks > shorten + MIN_DELTA_TICKS) {
+      ticks -= shorten;
+      start_ticks += shorten;
+      late = 0;
+    }
+  }
+  q->start_at_ticks = start_ticks;
+  q->start_at_valid = true;
+  int8_t res = addQueueEntry(ticks, steps, dir_high);
+  // used by startQueue() or not needed
+  q->start_at_valid = false;
+  if (stopped && (res == AQE_OK) && (late > 0) &&
+      (c->axis[0].stepper == this)) {
+    // The lead axis has run empty and is restarted late. The other axes
+    // follow its timing.
+    c->start_ticks += late;
+  }
+  return res;
+}
+
+//*************************************************************************************************
+// Electronic gearing: Each command of the master moves it from m0 to m1.
+// The follower position changes, where master_position * num crosses a
+// multiple of den. These crossings are equidistant, so the follower steps
+// of one master command are added like the followers of a coordinated move:
+// one step for the gap to the follower's last step and one command for the
+// remaining steps. The times are absolute time base values, which are
+// started with the master.
+//*************************************************************************************************
+// Delay of the start of the master, so the followers are in time
+#define GEAR_START_TICKS (TICKS_PER_S / 1000)
+
+static int64_t gear_floor_div(int64_t a, uint32_t b) {
+  int64_t q = a / (int64_t)b;
+  if ((a % (int64_t)b) < 0) {
+    q--;
+  }
+  return q;
+}
+
+int32_t FastAccelStepper::_gearPosition(int32_t master_pos) {
+  return _gear_offset +
+         gear_floor_div((int64_t)master_pos * _gear_num, _gear_den);
+}
+
+int8_t FastAccelStepper::followMaster(FastAccelStepper* master, int32_t num,
+                                      uint32_t den) {
+  if ((master == NULL) || (den == 0)) {
+    return MOVE_ERR_GEAR;
+  }
+  int64_t geared = gear_floor_div(
+      (int64_t)master->getPositionAfterCommandsCompleted() * num, den);
+  return followMaster(master, num, den,
+                      getPositionAfterCommandsCompleted() - (int32_t)geared);
+}
+
+int8_t FastAccelStepper::followMaster(FastAccelStepper* master, int32_t num,
+                                      uint32_t den, int32_t offset) {
+  if ((master == NULL) || (master == this) || (num == 0) || (den == 0)) {
+    return MOVE_ERR_GEAR;
+  }
+  if ((_gear_master != NULL) || (_gear_first != NULL) ||
+      (master->_gear_master != NULL)) {
+    return MOVE_ERR_GEAR;
+  }
+  if (_dirPin == PIN_UNDEFINED) {
+    return MOVE_ERR_NO_DIRECTION_PIN;
+  }
+  if (isRunning() || isRampGeneratorActive() || (_coord != NULL) ||
+      master->isRunning() || master->isRampGeneratorActive() ||
+      (master->_coord != NULL)) {
+    return MOVE_ERR_STEPPER_RUNNING;
+  }
+  _gear_num = num;
+  _gear_den = den;
+  _gear_offset = offset;
+  if (_gearPosition(master->getPositionAfterCommandsCompleted()) !=
+      getPositionAfterCommandsCompleted()) {
+    return MOVE_ERR_GEAR;
+  }
+  // The master's queue fill must not run meanwhile
+  while (!master->_lock_fill()) {
+  }
+  _gear_master = master;
+  _gear_next = master->_gear_first;
+  master->_gear_first = this;
+  master->_unlock_fill();
+  return MOVE_OK;
+}
+
+void FastAccelStepper::releaseMaster() {
+  FastAccelStepper* master = _gear_master;
+  if (master == NULL) {
+    return;
+  }
+  while (!master->_lock_fill()) {
+  }
+  FastAccelStepper** p = &master->_gear_first;
+  while (*p != this) {
+    p = &(*p)->_gear_next;
+  }
+  *p = _gear_next;
+  _gear_master = NULL;
+  _gear_next = NULL;
+  master->_unlock_fill();
+}
+
+bool FastAccelStepper::_gearBeyondLimits(int32_t master_target) {
+  for (FastAccelStepper* f = _gear_first; f != NULL; f = f->_gear_next) {
+    if (f->rg.isBeyondLimit(f->getPositionAfterCommandsCompleted(),
+                            f->_gearPosition(master_target))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool FastAccelStepper::_gearFollowersHaveSpace() {
+  // two commands, one of them may be split for the direction setup time
+  for (FastAccelStepper* f = _gear_first; f != NULL; f = f->_gear_next) {
+    if (!fas_queue[f->_queue_num].hasSpaceFor(3 * QUEUE_ENTRY_MAX_UNITS)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int8_t FastAccelStepper::_addMasterEntry(uint32_t ticks, uint16_t steps,
+                                         bool count_up) {
+  StepperQueue* q = &fas_queue[_queue_num];
+  int32_t m0 = getPositionAfterCommandsCompleted();
+  if (!q->isRunning) {
+    _gear_ticks = fas_get_ticks() + GEAR_START_TICKS;
+    q->start_at_ticks = _gear_ticks;
+    q->start_at_valid = true;
+  }
+  int8_t res = addQueueEntry(ticks, steps, count_up == _dirHighCountsUp);
+  // used by startQueue() or not needed
+  q->start_at_valid = false;
+  if (res != AQE_OK) {
+    return res;
+  }
+  uint32_t window_at = _gear_ticks;
+  _gear_ticks += ticks * steps;
+  int32_t m1 = count_up ? m0 + steps : m0 - steps;
+  bool ok = true;
+  for (FastAccelStepper* f = _gear_first; f != NULL; f = f->_gear_next) {
+    if (f->_addGearEntries(window_at, ticks, m0, m1) != AQE_OK) {
+      ok = false;
+    }
+  }
+  if (!ok) {
+    // A follower would lose steps, so the master stops after the queued
+    // commands and the followers are released. The queue fill is locked.
+    rg.abort();
+    FastAccelStepper* f = _gear_first;
+    while (f != NULL) {
+      FastAccelStepper* next = f->_gear_next;
+      f->_gear_master = NULL;
+      f->_gear_next = NULL;
+      f = next;
+    }
+    _gear_first = NULL;
+  }
+  return res;
+}
+
+int8_t FastAccelStepper::_addGearEntries(uint32_t window_at, uint32_t ticks,
+                                         int32_t m0, int32_t m1) {
+  int32_t pos = getPositionAfterCommandsCompleted();
+  int32_t delta = _gearPosition(m1) - pos;
+  if (delta == 0) {
+    return AQE_OK;
+  }
+  bool up = (delta > 0);
+  uint32_t k = up ? delta : -delta;
+  if (k > MAX_STEPS_PER_COMMAND) {
+    return AQE_STEPS_ERROR;
+  }
+  if (rg.isBeyondLimit(pos, pos + delta)) {
+    // e.g. a master with keepRunning(), so the gear stops
+    return AQE_STEPS_ERROR;
+  }
+  StepperQueue* q = &fas_queue[_queue_num];
+  // A ratio above 1 can ask for a step rate beyond the stepper interrupt.
+  // Then the follower runs at its maximum rate and lags behind.
+  uint32_t min_ticks = MIN_DELTA_TICKS;
+#if (FAS_SOFT_TIMER == 1)
+  if (q->isSoft) {
+    min_ticks = SOFT_MIN_DELTA_TICKS;
+  }
+#endif
+  if (min_ticks <= q->step_pulse_ticks) {
+    min_ticks = q->step_pulse_ticks + 1;
+  }
+  // crossings of the first and last step in 1/den follower steps and their
+  // distance from the master's start in master steps * num
+  int64_t u0 = (int64_t)m0 * _gear_num;
+  int64_t b_first = ((int64_t)(up ? pos + 1 : pos) - _gear_offset) * _gear_den;
+  int64_t b_last = b_first + (up ? 1 : -1) * (int64_t)(k - 1) * _gear_den;
+  uint32_t abs_num = (_gear_num > 0) ? _gear_num : -_gear_num;
+  uint64_t d_first = (b_first > u0) ? b_first - u0 : u0 - b_first;
+  uint64_t d_last = (b_last > u0) ? b_last - u0 : u0 - b_last;
+  uint64_t first_off = coord_scale(ticks, d_first, abs_num);
+  uint64_t last_off = coord_scale(ticks, d_last, abs_num);
+  uint32_t first_at = window_at + (uint32_t)first_off;
+  uint32_t period = 0;
+  if (k > 1) {
+    uint64_t p = (last_off - first_off) / (k - 1);
+    period = (p > ABSOLUTE_MAX_TICKS) ? ABSOLUTE_MAX_TICKS : p;
+    if (period < min_ticks) {
+      period = min_ticks;
+    }
+  }
+  bool dir_high = (up == _dirHighCountsUp);
+  // negative, if the follower lags behind
+  int32_t gap = first_at - _gear_ticks;
+  uint32_t entry_at = _gear_ticks;
+  if (!q->isRunning) {
+    // restart shortly before the first step
+    gap = min_ticks;
+    entry_at = first_at - gap;
+    q->start_at_ticks = entry_at;
+    q->start_at_valid = true;
+  } else if (gap < (int32_t)min_ticks) {
+    gap = min_ticks;
+  } else if (gap > (int32_t)ABSOLUTE_MAX_TICKS) {
+    gap = ABSOLUTE_MAX_TICKS;
+  }
+  uint32_t diff = ((uint32_t)gap > period) ? gap - period : period - gap;
+  int8_t res;
+  if ((k > 1) && (diff <= (period >> 8) + 1)) {
+    // the deviation is corrected with the next gap
+    res = addQueueEntry(period, k, dir_high);
+    _gear_ticks = entry_at + k * period;
+  } else {
+    res = addQueueEntry(gap, 1, dir_high);
+    if ((res == AQE_OK) && (k > 1)) {
+      res = addQueueEntry(period, k - 1, dir_high);
+    }
+    _gear_ticks = entry_at + gap + (k - 1) * period;
+  }
+  q->start_at_valid = false;
+  return res;
+}
+
+//*************************************************************************************************
+// Arc: The ramp generator of the lead axis plans the steps along the path.
+// Each ramp command is walked step by step, while both queues have space.
+// The steps of an axis are collected into equidistant runs, so the major
+// axis needs one queue entry per command and the minor axis one per change
+// of its step pattern.
+//*************************************************************************************************
+bool FastAccelStepper::_fill_arc_once(uint32_t* buffered) {
+  struct coordinated_move_s* c = _coord;
+  struct coordinated_arc_s* a = &c->arc;
+  // The queues of a coordinated move are not truncated
+  _truncate_queue = false;
+  for (uint8_t i = 0; i < 2; i++) {
+    // A step may add the previous run and leave a run to be added. Each
+    // may be split for the direction setup time.
+    FastAccelStepper* s = c->axis[i].stepper;
+    if (!fas_queue[s->_queue_num].hasSpaceForCommands(4)) {
+      return false;
+    }
+  }
+  if (a->cmd_steps == 0) {
+    // The step of an axis, which has run empty, must be added before its
+    // start time. So plan ahead twice the time of the ramp generator.
+    int32_t ahead = c->elapsed;
+    if (c->started) {
+      ahead += c->start_ticks - fas_get_ticks();
+    }
+    if (ahead > 2 * (int32_t)fas_fill_ahead_ticks) {
+      return false;
+    }
+    struct ramp_command_s cmd;
+    if ((a->remaining == 0) ||
+        !rg.getNextCommand(a->ramp_ticks, a->target - a->remaining, &cmd)) {
+      if (a->remaining == 0) {
+        // a walk off by a step is corrected at the end
+        int32_t d[2] = {a->end_x - a->x, a->end_y - a->y};
+        for (uint8_t i = 0; i < 2; i++) {
+          bool count_up = (d[i] > 0);
+          FastAccelStepper* s = c->axis[i].stepper;
+          uint32_t t = c->elapsed;
+          for (int32_t j = abs(d[i]); j > 0; j--) {
+            t += a->cmd_ticks;
+            _addArcStep(&c->axis[i], t, count_up == s->_dirHighCountsUp);
+          }
+          _flushArcSteps(&c->axis[i]);
+        }
+      }
+      // the arc has completed or stopMove() has been called
       rg.abort();
+      c->active = false;
+      _coord = NULL;
+      return false;
+    }
+    a->ramp_ticks = cmd.ticks;
+    a->cmd_steps = min(cmd.steps, a->remaining);
+    a->scale_steps = 0;
+  }
+  bool ok = true;
+  while (a->cmd_steps > 0) {
+    if (a->scale_steps == 0) {
+      // The ramp generator's speed applies to the path, so the period is
+      // stretched by the path length per step: r / |minor|. This is updated
+      // every 1/64 radian.
+      uint32_t minor = abs(a->y_major ? a->x : a->y);
+      uint64_t ticks = a->ramp_ticks;
+      ticks = ticks * ((a->radius << 8) / max(minor, 1)) >> 8;
+      a->cmd_ticks = min(ticks, (uint64_t)ABSOLUTE_MAX_TICKS);
+      a->scale_steps = max(a->radius >> 6, 1);
+    }
+    a->scale_steps--;
+    int8_t step[2];
+    arc_walk(a, &step[0], &step[1]);
+    a->cmd_steps--;
+    a->remaining--;
+    c->elapsed += a->cmd_ticks;
+    for (uint8_t i = 0; i < 2; i++) {
+      if (step[i] != 0) {
+        FastAccelStepper* s = c->axis[i].stepper;
+        ok = _addArcStep(&c->axis[i], c->elapsed,
+                         (step[i] > 0) == s->_dirHighCountsUp) &&
+             ok;
+      }
+    }
+    bool space = true;
+    for (uint8_t i = 0; i < 2; i++) {
+      FastAccelStepper* s = c->axis[i].stepper;
+      space &= fas_queue[s->_queue_num].hasSpaceForCommands(4);
+    }
+    if (!space) {
+      break;
+    }
+  }
+  for (uint8_t i = 0; i < 2; i++) {
+    ok = _flushArcSteps(&c->axis[i]) && ok;
+  }
+  if (!ok) {
+    // An axis would lose steps, so the arc ends after the queued commands
+    rg.abort();
+    c->active = false;
+    _coord = NULL;
+    return false;
+  }
+  // The buffered time of the arc is the time planned ahead
+  int32_t ahead = c->elapsed;
+  if (c->started) {
+    ahead += c->start_ticks - fas_get_ticks();
+  }
+  if (ahead < 0) {
+    ahead = 0;
+  }
+  *buffered = min((uint32_t)ahead, fas_fill_ahead_ticks);
+  return true;
+}
+
+bool FastAccelStepper::_addArcStep(struct coordinated_axis_s* f,
+                                   uint32_t step_at, bool dir_high) {
+  uint32_t gap = step_at - f->step_at;
+  bool ok = true;
+  if (f->run_steps > 0) {
+    if ((dir_high == f->dir_high) && (gap == f->run_ticks) &&
+        (f->run_steps < MAX_STEPS_PER_COMMAND)) {
+      f->run_steps++;
+      f->step_at = step_at;
+      return true;
     }
+    ok = _flushArcSteps(f);
+  }
+  FastAccelStepper* s = f->stepper;
+  if (_coord->started && !s->isRunning()) {
+    // restart shortly before the step
+    gap = MIN_DELTA_TICKS;
+  } else if (gap > ABSOLUTE_MAX_TICKS) {
+    gap = ABSOLUTE_MAX_TICKS;
+  } else if (gap < MIN_DELTA_TICKS) {
+    gap = MIN_DELTA_TICKS;
+  }
+  f->run_at = step_at - gap;
+  f->run_ticks = gap;
+  f->run_steps = 1;
+  f->dir_high = dir_high;
+  f->step_at = step_at;
+  return ok;
+}
+
+bool FastAccelStepper::_flushArcSteps(struct coordinated_axis_s* f) {
+  if (f->run_steps == 0) {
+    return true;
   }
+  int8_t res = f->stepper->_addCoordinatedEntry(
+      _coord, f->run_at, f->run_ticks, f->run_steps, f->dir_high);
+  f->run_steps = 0;
+  return (res == AQE_OK);
 }
 
 #if defined(ARDUINO_ARCH_AVR)
 ISR(TIMER1_OVF_vect) {
+  // extend timer 1 for fas_get_ticks()
+  fas_timer1_ovf_cnt++;
+
+  // a stepper with low queue level is refilled without waiting for the period
+  if (!fas_refill_pending && (++fas_ovf_manage_cnt < fas_ovf_per_manage)) {
+    return;
+  }
+  fas_ovf_manage_cnt = 0;
+
   // disable OVF interrupt to avoid nesting
   TIMSK1 &= ~_BV(TOIE1);
 
@@ -313,12 +1699,29 @@ ISR(TIMER1_OVF_vect) {
   // enable OVF interrupt again
   TIMSK1 |= _BV(TOIE1);
 }
+void fas_avr_refill() {
+  // A disabled OVF interrupt marks a running manageSteppers(). This is
+  // nested, so it gets the pending flag and the next overflow refills.
+  if ((fas_engine == NULL) || !(TIMSK1 & _BV(TOIE1))) {
+    fas_refill_pending = true;
+    return;
+  }
+  // same as in TIMER1_OVF_vect. The step interrupt has updated its compare
+  // unit already, so it can be nested by the next step.
+  TIMSK1 &= ~_BV(TOIE1);
+  interrupts();
+  fas_engine->manageSteppers();
+  noInterrupts();
+  TIMSK1 |= _BV(TOIE1);
+}
 #endif
 
+#if (FAS_AUTO_ENABLE == 1)
 void FastAccelStepper::check_for_auto_disable() {
   noInterrupts();
   if (_auto_disable_delay_counter > 0) {
-    if (!isRunning()) {
+    // an armed group member keeps the outputs enabled
+    if (!isRunning() && !fas_queue[_queue_num].group_armed) {
       _auto_disable_delay_counter--;
       if (_auto_disable_delay_counter == 0) {
         disableOutputs();
@@ -327,27 +1730,37 @@ void FastAccelStepper::check_for_auto_disable() {
   }
   interrupts();
 }
+#endif
 
 void FastAccelStepper::init(uint8_t num, uint8_t step_pin) {
 #if (TEST_MEASURE_ISR_SINGLE_FILL == 1)
   // For run time measurement
   max_micros = 0;
 #endif
+#if (FAS_ENABLE_PINS == 2)
+  _enablePinLowActive = PIN_UNDEFINED;
+  _enablePinHighActive = PIN_UNDEFINED;
+#elif (FAS_ENABLE_PINS == 1)
+  _enablePin = PIN_UNDEFINED;
+#endif
+#if (FAS_AUTO_ENABLE == 1)
   _autoEnable = false;
   _on_delay_ticks = 0;
   _off_delay_count = 0;
   _auto_disable_delay_counter = 0;
+#endif
+  _truncate_queue = false;
+  _coord = NULL;
+  _gear_master = NULL;
+  _gear_first = NULL;
+  _gear_next = NULL;
+  _fill_busy = false;
   _stepPin = step_pin;
+  _dirPin = PIN_UNDEFINED;
   _dirHighCountsUp = true;
   rg.init();
 
-#if defined(ARDUINO_ARCH_AVR)
-  _queue_num = step_pin == stepPinStepperA ? 0 : 1;
-#elif defined(ARDUINO_ARCH_ESP32)
   _queue_num = num;
-#else
-  _queue_num = num;
-#endif
   fas_queue[_queue_num].init(_queue_num, step_pin);
 }
 uint8_t FastAccelStepper::getStepPin() { return _stepPin; }
@@ -356,9 +1769,10 @@ void FastAccelStepper::setDirectionPin(uint8_t dirPin, bool dirHighCountsUp) {
   _dirHighCountsUp = dirHighCountsUp;
   digitalWrite(dirPin, HIGH);
   pinMode(dirPin, OUTPUT);
-  fas_queue[_queue_num].dirPin = dirPin;
+  fas_queue[_queue_num].setDirPin(dirPin);
   fas_queue[_queue_num].dirHighCountsUp = dirHighCountsUp;
 }
+#if (FAS_ENABLE_PINS == 2)
 void FastAccelStepper::setEnablePin(uint8_t enablePin,
                                     bool low_active_enables_stepper) {
   if (low_active_enables_stepper) {
@@ -377,6 +1791,16 @@ void FastAccelStepper::setEnablePin(uint8_t enablePin,
     }
   }
 }
+#elif (FAS_ENABLE_PINS == 1)
+void FastAccelStepper::setEnablePin(uint8_t enablePin,
+                                    bool low_active_enables_stepper) {
+  _enablePin = enablePin;
+  _enableLowActive = low_active_enables_stepper;
+  disableOutputs();
+  pinMode(enablePin, OUTPUT);
+}
+#endif
+#if (FAS_AUTO_ENABLE == 1)
 void FastAccelStepper::setAutoEnable(bool auto_enable) {
   _autoEnable = auto_enable;
 }
@@ -391,27 +1815,61 @@ int FastAccelStepper::setDelayToEnable(uint32_t delay_us) {
   _on_delay_ticks = delay_ticks;
   return DELAY_OK;
 }
-void FastAccelStepper::setDelayToDisable(uint16_t delay_ms) {
-  uint16_t delay_count = 0;
-#if defined(ARDUINO_ARCH_ESP32)
-  delay_count = delay_ms / TASK_DELAY_MS;
-#endif
-#if defined(ARDUINO_ARCH_AVR)
-  delay_count = delay_ms / (65536000 / TICKS_PER_S);
 #endif
+void FastAccelStepper::setQueueLowWatermark(uint8_t units) {
+  StepperQueue* q = &fas_queue[_queue_num];
+  q->low_watermark = min(units, q->queue_len_mask);
+}
+int FastAccelStepper::setStepPulseWidth(uint16_t pulse_ns) {
+  // round up to full ticks
+  uint32_t pulse_ticks =
+      ((uint32_t)pulse_ns * (TICKS_PER_S / 1000000L) + 999) / 1000;
+  if (pulse_ticks == 0) {
+    return DELAY_TOO_LOW;
+  }
+  if (pulse_ticks > MIN_DELTA_TICKS / 2) {
+    return DELAY_TOO_HIGH;
+  }
+  fas_queue[_queue_num].setStepPulseTicks(pulse_ticks);
+  return DELAY_OK;
+}
+int FastAccelStepper::setDirectionSetupTime(uint16_t setup_ns) {
+  uint32_t setup_ticks =
+      ((uint32_t)setup_ns * (TICKS_PER_S / 1000000L) + 999) / 1000;
+  StepperQueue* q = &fas_queue[_queue_num];
+  if ((setup_ticks != 0) && (setup_ticks <= q->step_pulse_ticks)) {
+    return DELAY_TOO_LOW;
+  }
+  q->dir_setup_ticks = setup_ticks;
+  return DELAY_OK;
+}
+#if (FAS_AUTO_ENABLE == 1)
+void FastAccelStepper::setDelayToDisable(uint16_t delay_ms) {
+  // counted down in manageSteppers()
+  uint16_t delay_count = (uint32_t)delay_ms * 1000 / fas_manage_period_us;
   if ((delay_ms > 0) && (delay_count < 2)) {
     // ensure minimum time
     delay_count = 2;
   }
   _off_delay_count = delay_count;
 }
+#endif
 void FastAccelStepper::setSpeed(uint32_t min_step_us) {
+#if (FAS_SOFT_TIMER == 1)
+  if (fas_queue[_queue_num].isSoft &&
+      (US_TO_TICKS(min_step_us) < SOFT_MIN_DELTA_TICKS)) {
+    min_step_us = TICKS_TO_US(SOFT_MIN_DELTA_TICKS);
+  }
+#endif
   rg.setSpeed(min_step_us);
 }
 void FastAccelStepper::setAcceleration(uint32_t accel) {
   rg.setAcceleration(accel);
 }
 int8_t FastAccelStepper::moveTo(int32_t position) {
+  if (_gearBeyondLimits(position)) {
+    return MOVE_ERR_POSITION_LIMIT;
+  }
   uint32_t ticks = fas_queue[_queue_num].ticks_at_queue_end;
   return rg.moveTo(position, getPositionAfterCommandsCompleted(), ticks);
 }
@@ -419,11 +1877,29 @@ int8_t FastAccelStepper::move(int32_t move) {
   if ((move < 0) && (_dirPin == PIN_UNDEFINED)) {
     return MOVE_ERR_NO_DIRECTION_PIN;
   }
+  if (_gear_first != NULL) {
+    // the target like in RampGenerator::move()
+    int32_t pos = getPositionAfterCommandsCompleted();
+    if (rg.isRampGeneratorActive() && !rg.isRunningContinuously()) {
+      pos = rg.targetPosition();
+    }
+    if (_gearBeyondLimits(pos + move)) {
+      return MOVE_ERR_POSITION_LIMIT;
+    }
+  }
   uint32_t ticks = fas_queue[_queue_num].ticks_at_queue_end;
   return rg.move(move, getPositionAfterCommandsCompleted(), ticks);
 }
 void FastAccelStepper::keepRunning() { rg.setKeepRunning(); }
-void FastAccelStepper::stopMove() { rg.initiate_stop(); }
+void FastAccelStepper::stopMove() {
+  rg.initiate_stop();
+  _truncate_queue = true;
+}
+void FastAccelStepper::stopMoveNow() {
+  stopMove();
+  // if the queue is just filled, then the running fill performs the stop
+  isr_fill_queue();
+}
 void FastAccelStepper::applySpeedAcceleration() {
   uint32_t ticks = fas_queue[_queue_num].ticks_at_queue_end;
   rg.applySpeedAcceleration(ticks);
@@ -440,6 +1916,7 @@ void FastAccelStepper::forceStopAndNewPosition(uint32_t new_pos) {
   // set the new position
   q->pos_at_queue_end = new_pos;
 }
+#if (FAS_ENABLE_PINS == 2)
 void FastAccelStepper::disableOutputs() {
   if (_enablePinLowActive != PIN_UNDEFINED) {
     digitalWrite(_enablePinLowActive, HIGH);
@@ -456,6 +1933,18 @@ void FastAccelStepper::enableOutputs() {
     digitalWrite(_enablePinHighActive, HIGH);
   }
 }
+#elif (FAS_ENABLE_PINS == 1)
+void FastAccelStepper::disableOutputs() {
+  if (_enablePin != PIN_UNDEFINED) {
+    digitalWrite(_enablePin, _enableLowActive ? HIGH : LOW);
+  }
+}
+void FastAccelStepper::enableOutputs() {
+  if (_enablePin != PIN_UNDEFINED) {
+    digitalWrite(_enablePin, _enableLowActive ? LOW : HIGH);
+  }
+}
+#endif
 int32_t FastAccelStepper::getPositionAfterCommandsCompleted() {
   return fas_queue[_queue_num].pos_at_queue_end;
 }
@@ -473,20 +1962,9 @@ int32_t FastAccelStepper::getCurrentPosition() {
   bool countUp = (q->dir_at_queue_end == q->dirHighCountsUp);
   uint8_t wp = q->next_write_idx;
   uint8_t rp = q->read_idx;
+  uint16_t in_progress = q->stepsInProgress();
   interrupts();
-  while (rp != wp) {
-    wp--;
-    uint8_t steps_dir = q->entry[wp & QUEUE_LEN_MASK].steps;
-    if (countUp) {
-      pos -= steps_dir >> 1;
-    } else {
-      pos += steps_dir >> 1;
-    }
-    if (steps_dir & 1) {
-      countUp = !countUp;
-    }
-  }
-  return pos;
+  return q->positionBefore(rp, wp, pos, countUp, in_progress);
 }
 void FastAccelStepper::setCurrentPosition(int32_t new_pos) {
   int32_t delta = new_pos - getCurrentPosition();
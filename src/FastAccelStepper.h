@@ -2,6 +2,8 @@
 #define FASTACCELSTEPPER_H
 #if defined(ARDUINO_ARCH_ESP32) || defined(ARDUINO_ARCH_AVR)
 #include <Arduino.h>
+#elif defined(FAS_LINUX)
+#include "FastAccelStepper_linux.h"
 #else
 #include <math.h>
 #include <stdio.h>
@@ -21,6 +23,28 @@
 #define TEST_CREATE_QUEUE_CHECKSUM 0
 #endif
 
+// Optional features, which can be compiled out by build flags to save RAM
+// and flash on small products. The functions of a compiled out feature are
+// not declared, so their use fails to compile.
+//   FAS_DEBUG_LED    1: engine.setDebugLed()
+//   FAS_ENABLE_PINS  2: a low and a high active enable pin per stepper
+//                    1: one enable pin per stepper
+//                    0: no enable pin, enableOutputs() and disableOutputs()
+//   FAS_AUTO_ENABLE  1: setAutoEnable(), setDelayToEnable() and
+//                       setDelayToDisable(), needs an enable pin
+#ifndef FAS_DEBUG_LED
+#define FAS_DEBUG_LED 1
+#endif
+#ifndef FAS_ENABLE_PINS
+#define FAS_ENABLE_PINS 2
+#endif
+#ifndef FAS_AUTO_ENABLE
+#define FAS_AUTO_ENABLE 1
+#endif
+#if (FAS_ENABLE_PINS == 0) && (FAS_AUTO_ENABLE == 1)
+#error "FAS_AUTO_ENABLE needs FAS_ENABLE_PINS > 0"
+#endif
+
 #if !defined(ARDUINO_ARCH_ESP32) && !defined(ARDUINO_ARCH_AVR)
 #ifndef F_CPU
 #define F_CPU 16000000L
@@ -39,6 +63,17 @@
 #define MIN_DELTA_TICKS (TICKS_PER_S / 50000)
 #endif
 
+// Lower limit of the ramp generator's step period on software timer channels
+#define SOFT_MIN_DELTA_TICKS (TICKS_PER_S / 5000)
+
+// Max. number of steps of one command. The queue entry can hold 16 bits, but
+// the esp32 pulse counter is limited to 15 bits.
+#if defined(ARDUINO_ARCH_ESP32)
+#define MAX_STEPS_PER_COMMAND 32767
+#else
+#define MAX_STEPS_PER_COMMAND 65535
+#endif
+
 // this fixed value ensures max tick count of 255*62489 + 65535 = 16000230
 // ticks. With 16MHz frequency, the maximum time between two steps is 1s. This
 // ensures too - that in case of esp32 - two interrupts do not occur within
@@ -48,6 +83,168 @@
 
 #define PIN_UNDEFINED 255
 
+// Limit of FastAccelStepperEngine::arcTo()
+#define ARC_MAX_RADIUS 1000000L
+
+// The command queue stores the entries in units of 2 bytes. An entry takes:
+//
+//  - 1 unit in compact form:
+//      steps, code = 0ddddddd
+//    The period is the one of the previous entry plus the 7 bit signed
+//    delta ddddddd. Delta = 0 repeats the previous period.
+//
+//  - 2 or 3 units in full form:
+//      steps, code = 1xxxxvet
+//      period
+//      n_periods, steps_hi      (only if e = 1)
+//    t = 1 toggles the direction pin before the steps
+//    v = 1 fires the next position event after the last step
+//    The step count is steps + 256 * steps_hi.
+//
+// The producer uses the compact form, whenever possible. The third unit is
+// only needed for n_periods > 0 or more than 255 steps.
+union queue_unit {
+  struct {
+    uint8_t steps;
+    uint8_t code;
+  } cmd;
+  uint16_t period;
+  struct {
+    uint8_t n_periods;
+    uint8_t steps_hi;
+  } ext;
+};
+#define QUEUE_CODE_FULL 0x80
+#define QUEUE_CODE_EXTENDED 0x02
+#define QUEUE_CODE_TOGGLE_DIR 0x01
+#define QUEUE_CODE_EVENT 0x04
+#define QUEUE_ENTRY_HAS_EVENT(code)                   \
+  (((code) & (QUEUE_CODE_FULL | QUEUE_CODE_EVENT)) == \
+   (QUEUE_CODE_FULL | QUEUE_CODE_EVENT))
+#define QUEUE_ENTRY_UNITS(code) \
+  (((code)&QUEUE_CODE_FULL) ? (((code)&QUEUE_CODE_EXTENDED) ? 3 : 2) : 1)
+#define QUEUE_ENTRY_MAX_UNITS 3
+
+// One command of the stepper queue in decoded form
+struct queue_entry {
+  uint16_t steps;     // number of steps
+  uint8_t n_periods;  // number of PERIOD_TICKS delays
+  uint16_t period;    // remaining period time in addition to
+                      // n_periods*PERIOD_TICKS delays
+  bool toggle_dir;    // toggle direction pin before the steps
+  bool event;         // fire a position event after the last step
+};
+
+// Position events, see FastAccelStepper::addPositionEvent(). The number of
+// events per stepper is a power of two.
+#if defined(ARDUINO_ARCH_AVR)
+#define POSITION_EVENTS 2
+#else
+#define POSITION_EVENTS 4
+#endif
+#define EVENT_FREE 0
+#define EVENT_ARMED 1   // waiting for the steps to the position
+#define EVENT_QUEUED 2  // the entry with the step is in the queue
+#define EVENT_FIRED 3
+typedef void (*position_event_callback_t)(void* arg);
+struct position_event_s {
+  int32_t position;
+  position_event_callback_t callback;
+  void* arg;
+  uint8_t pin;  // PIN_UNDEFINED or the pin to toggle
+  bool pin_high;
+  // pin resolved like the direction pin, see StepperQueue::setEventPin()
+#if defined(ARDUINO_ARCH_AVR)
+  volatile uint8_t* pin_toggle_reg;
+  uint8_t pin_mask;
+#elif defined(ARDUINO_ARCH_ESP32)
+  volatile uint32_t* pin_set_reg;
+  volatile uint32_t* pin_clear_reg;
+  uint32_t pin_mask;
+#endif
+  volatile uint32_t ticks;  // time base value, when fired
+  volatile uint8_t state;
+};
+
+// One command for FastAccelStepper::addQueueEntries()
+struct stepper_command_s {
+  uint32_t ticks;  // same as delta_ticks of addQueueEntry()
+  uint16_t steps;  // 1..MAX_STEPS_PER_COMMAND
+  bool dir_high;
+};
+
+// State of a coordinated move, see FastAccelStepperEngine::moveLinear() and
+// arcTo(). The times are in ticks relative to the start of the move. FasGcode
+// uses axis[0] without stepper for the position along the path.
+class FastAccelStepper;
+struct coordinated_axis_s {
+  FastAccelStepper* stepper;
+  uint32_t steps;    // steps of the move
+  uint32_t done;     // steps added to the queue
+  uint32_t step_at;  // time of the last step added to the queue
+  bool dir_high;
+  // arc: equidistant steps, which are not yet added to the queue
+  uint32_t run_at;  // start of the first period
+  uint32_t run_ticks;
+  uint16_t run_steps;
+};
+struct coordinated_arc_s {
+  int32_t x, y;          // position relative to the center
+  int32_t end_x, end_y;  // end position relative to the center
+  int32_t err;           // x² + y² - r²
+  uint32_t radius;
+  uint32_t remaining;   // steps along the path to the end
+  int32_t target;       // ramp position at the end
+  uint32_t ramp_ticks;  // period of the last ramp command
+  uint32_t cmd_ticks;   // period of the current command along the path
+  uint16_t cmd_steps;   // remaining steps of the current command
+  uint16_t scale_steps;  // remaining steps with the current cmd_ticks
+  bool y_major;         // y steps with each step along the path
+  bool ccw;
+};
+struct coordinated_move_s {
+  volatile bool active;
+  volatile bool started;
+  bool is_arc;
+  uint32_t start_ticks;  // time base value at the start of the move
+  uint32_t elapsed;      // time at the end of the lead axis' commands
+  uint8_t n;
+  struct coordinated_axis_s axis[MAX_STEPPER];  // axis[0] is the lead
+  struct coordinated_arc_s arc;
+};
+
+// Configuration for FastAccelStepperEngine::init(config)
+//   manage_period_ms: period of the queue refill. On avr this is done in the
+//                     timer 1 overflow interrupt, so it is rounded to a
+//                     multiple of 65536 ticks (4.096ms at 16 MHz).
+//   task_priority, task_stack_size, task_core: for the esp32 stepper task.
+//                     task_core < 0 lets the task run on any core.
+// ENGINE_CONFIG_DEFAULT is the configuration used by init().
+struct engine_config_s {
+  uint16_t manage_period_ms;
+  uint8_t task_priority;
+  uint16_t task_stack_size;
+  int8_t task_core;
+};
+#if defined(ARDUINO_ARCH_AVR)
+#define ENGINE_CONFIG_DEFAULT {4, 1, 1000, -1}
+#else
+#define ENGINE_CONFIG_DEFAULT {10, 1, 1000, -1}
+#endif
+
+// Storage for the command queue of one stepper with QUEUE_DEPTH units of
+// 2 bytes. An entry needs 1 to 3 units. See
+// FastAccelStepperEngine::stepperConnectToPin()
+template <uint8_t QUEUE_DEPTH>
+class StepperQueueBuffer {
+  static_assert((QUEUE_DEPTH >= 4) && (QUEUE_DEPTH <= 128) &&
+                    ((QUEUE_DEPTH & (QUEUE_DEPTH - 1)) == 0),
+                "QUEUE_DEPTH must be a power of two in the range 4..128");
+
+ public:
+  union queue_unit entry[QUEUE_DEPTH];
+};
+
 class FastAccelStepper {
  public:
   // This should be only called by FastAccelStepperEngine !
@@ -59,6 +256,7 @@ class FastAccelStepper {
   // if direction pin is connected, call this function
   void setDirectionPin(uint8_t dirPin, bool dirHighCountsUp = true);
 
+#if (FAS_ENABLE_PINS > 0)
   // if enable pin is connected, then use this function.
   //
   // In case there are two enable pins: one low and one high active, then
@@ -66,11 +264,13 @@ class FastAccelStepper {
   //	setEnablePin(pin1, true);
   //	setEnablePin(pin2, false);
   // If pin1 and pin2 are same, then the last call will be used.
+  // With FAS_ENABLE_PINS=1 only the pin of the last call is operated.
   void setEnablePin(uint8_t enablePin, bool low_active_enables_stepper = true);
 
   // using enableOutputs/disableOutputs the stepper can be enabled and disabled
   void enableOutputs();
   void disableOutputs();
+#endif
 
   // In auto enable mode, the stepper is enabled before stepping and disabled
   // afterwards. The delay from stepper enabled till first step and from
@@ -78,25 +278,39 @@ class FastAccelStepper {
   // The delay from enable to first step is done in ticks and as such is limited
   // to ABSOLUTE_MAX_TICKS, which translates approximately to 1s (for esp32 and
   // avr at 16 MHz). The delay till disable is done in period interrupt/task
-  // with 4 or 10 ms repetition rate and as such is with several ms jitter.
+  // with 4 or 10 ms repetition rate (see engine_config_s) and as such is with
+  // several ms jitter.
+#if (FAS_AUTO_ENABLE == 1)
   void setAutoEnable(bool auto_enable);
   int setDelayToEnable(uint32_t delay_us);
   void setDelayToDisable(uint16_t delay_ms);
+#endif
 #define DELAY_OK 0
 #define DELAY_TOO_LOW -1
 #define DELAY_TOO_HIGH -2
 
+  // High time of the step pulse in ns. The default is 10us for esp32. On avr
+  // the pulse ends, as soon as the step interrupt is entered (approx. 3us at
+  // 16 MHz). A longer pulse is ended by a second compare match. The pulse
+  // width is limited to half of MIN_DELTA_TICKS and queue commands must have
+  // longer periods (else AQE_TOO_LOW).
+  int setStepPulseWidth(uint16_t pulse_ns);
+  // Minimum time in ns from a change of the direction pin to the next step.
+  // If needed, the first step after a direction change is delayed. The
+  // direction pin is changed by the interrupt, so its latency should be
+  // included. Default is 0. A setup time not longer than the step pulse
+  // width is rejected with DELAY_TOO_LOW.
+  int setDirectionSetupTime(uint16_t setup_ns);
+
   // Retrieve the current position of the stepper - either in standstill or
   // while moving
-  //    for esp32: the position while moving may deviate by the currently
-  //    executed queue command's steps
+  //    for esp32: the steps of the currently executed queue command are read
+  //    from the pulse counter. A step pulse in progress may be counted or not
   int32_t getCurrentPosition();
 
   // Set the current position of the stepper - either in standstill or while
-  // moving.
-  //    for esp32: the implementation uses getCurrentPosition(), which does not
-  //               consider the steps of the current command
-  //               => recommend to use only in standstill
+  // moving. A step performed between the read of the current position and
+  // the update is not considered, so this is recommended in standstill.
   void setCurrentPosition(int32_t new_pos);
 
   // is true while the stepper is running
@@ -144,6 +358,69 @@ class FastAccelStepper {
 #define MOVE_ERR_SPEED_IS_UNDEFINED -2
 #define MOVE_ERR_ACCELERATION_IS_UNDEFINED -3
 #define MOVE_ERR_STOP_ONGOING -4
+#define MOVE_ERR_STEPPER_RUNNING \
+  -5 /* FastAccelStepperEngine::moveLinear() with a moving stepper */
+#define MOVE_ERR_ARC_GEOMETRY \
+  -6 /* FastAccelStepperEngine::arcTo() with the end not on the circle */
+#define MOVE_ERR_GEAR \
+  -7 /* followMaster() with invalid ratio, master or follower position */
+#define MOVE_ERR_POSITION_LIMIT \
+  -8 /* move()/moveTo() with a target outside of setPositionLimits() */
+
+  // Electronic gearing: this stepper follows the master at the position
+  //      offset + master_position * num / den    (rounded down)
+  // The follower's commands are derived from each command of the master, when
+  // it is planned. So the follower is exact and needs no polling. The steps
+  // of the follower are placed at the (fractional) master position, where
+  // the follower position changes.
+  // Both steppers must be stopped and the follower needs a direction pin.
+  // Without offset, the current positions are related. With offset, the
+  // follower must be at its gear position already, else MOVE_ERR_GEAR is
+  // returned. A master can have several followers, but a follower cannot be
+  // a master. The master must be moved by move(), moveTo() or keepRunning()
+  // and the follower must not be moved otherwise. If the ratio asks for a
+  // step rate beyond the stepper interrupt (MIN_DELTA_TICKS, resp.
+  // SOFT_MIN_DELTA_TICKS), the follower runs at this rate and lags behind.
+  // If a follower command cannot be queued (e.g. more than
+  // MAX_STEPS_PER_COMMAND follower steps for one master command), the master
+  // stops after its queued commands and all followers are released, so
+  // isFollowing() returns false.
+  int8_t followMaster(FastAccelStepper* master, int32_t num, uint32_t den);
+  int8_t followMaster(FastAccelStepper* master, int32_t num, uint32_t den,
+                      int32_t offset);
+  // The follower keeps its queued commands, but does not follow anymore
+  void releaseMaster();
+  bool isFollowing() { return _gear_master != NULL; }
+
+  // Position events: When a step reaches the position, the stepper interrupt
+  // calls callback(arg), toggles the pin and latches the time base value of
+  // the step (see engine.getTicks()). Either callback may be NULL or pin
+  // PIN_UNDEFINED. The pin is set to output and low by addPositionEvent().
+  //
+  // The commands are split, so that the step to the position ends a queue
+  // entry. Thus an event is only found in the commands added afterwards. At
+  // the position after the queued commands, it fires only, if the stepper
+  // returns to it. An event fires once and then its slot is free. An event
+  // can be added for each position, up to POSITION_EVENTS per stepper. Each
+  // event needs space for another queue entry.
+  //
+  // The callback runs in interrupt context, so it must be short and must
+  // not call any function of this library. On esp32 the interrupts are
+  // registered with ESP_INTR_FLAG_IRAM and may run, while the flash cache is
+  // disabled. So the callback must be IRAM_ATTR and use only data in RAM.
+  //
+  // addPositionEvent() and removePositionEvent() wait for the queue fill of
+  // manageSteppers() to finish. They must not be called from an interrupt
+  // or the callback, because this wait has no bound there.
+  //
+  // Returns the id of the event or -1, if no slot is free or an event for
+  // this position is already armed.
+  int8_t addPositionEvent(int32_t position, position_event_callback_t callback,
+                          void* arg, uint8_t pin);
+  // An event, whose step is not yet in the queue, can be removed.
+  bool removePositionEvent(uint8_t id);
+  // Returns true, if the event has fired. Then ticks is the time of the step.
+  bool getPositionEvent(uint8_t id, uint32_t* ticks);
 
   // This command flags the stepper to keep run continuously into current
   // direction. It can be stopped by stopMove.
@@ -153,6 +430,23 @@ class FastAccelStepper {
   void keepRunning();
   bool isRunningContinuously() { return rg.isRunningContinuously(); }
 
+  // Software limits of the position, which are checked by the ramp
+  // generator. move()/moveTo() to a target outside of the limits returns
+  // MOVE_ERR_POSITION_LIMIT. keepRunning() decelerates to stop exactly at
+  // the limit. Limits set during a move apply to the not yet planned
+  // commands, so a deceleration may be shortened to stop at the limit. Only
+  // the limit in the direction of the movement applies, so a stepper beyond
+  // a limit can move back. min_pos > max_pos returns MOVE_ERR_POSITION_LIMIT.
+  // The axes of moveLinear(), moveSynchronized() and arcTo() (the range of
+  // the arc), the geared targets of followMaster() followers and the axes of
+  // FasGcode are checked before the move and rejected with
+  // MOVE_ERR_POSITION_LIMIT resp. GCODE_ERR_POSITION_LIMIT. A gear follower,
+  // which would pass its limit with a running master, stops the gear.
+  int8_t setPositionLimits(int32_t min_pos, int32_t max_pos) {
+    return rg.setPositionLimits(min_pos, max_pos);
+  }
+  void clearPositionLimits() { rg.clearPositionLimits(); }
+
   // forwardStep()/backwardstep() can be called, while stepper is not moving
   // If stepper is moving, this is a no-op.
   // backwardStep() is a no-op, if no direction pin defined
@@ -165,8 +459,15 @@ class FastAccelStepper {
   // This only sets a flag and can be called from an interrupt !
   // Another move/moveTo must wait, till the motor has stopped.
   // Similarly keepRunning() is ignored, too.
+  // On next queue fill, the not yet started commands are removed from the
+  // queue and the deceleration starts from the speed of the running command.
   void stopMove();
 
+  // same as stopMove(), but the queue is truncated and the deceleration is
+  // planned immediately. This saves up to one stepper task period for
+  // reaction critical stops. Do not call this from an interrupt on avr.
+  void stopMoveNow();
+
   // stop the running stepper immediately and set new_pos as new position
   // This can be called from an interrupt !
   void forceStopAndNewPosition(uint32_t new_pos);
@@ -177,8 +478,31 @@ class FastAccelStepper {
   // Low level acccess via command queue
   // stepper queue management (low level access)
   //	delta_ticks is multiplied by (1/TICKS_PER_S) s
-  //	steps must be less than 128 aka 7 bits
-  int8_t addQueueEntry(uint32_t delta_ticks, uint8_t steps, bool dir_high);
+  //	steps must be in the range 1..MAX_STEPS_PER_COMMAND
+  int8_t addQueueEntry(uint32_t delta_ticks, uint16_t steps, bool dir_high);
+
+  // Add up to n commands at once. The commands are checked like for
+  // addQueueEntry() and the batch is made visible to the stepper interrupt
+  // with one update. This is cheaper than n calls of addQueueEntry().
+  // Returns the number of added commands. If this is less than n, then the
+  // queue is full or cmd[return value] is invalid. addQueueEntry() for this
+  // command returns the reason.
+  uint8_t addQueueEntries(const struct stepper_command_s* cmd, uint8_t n);
+
+  // The stepper interrupt wakes up the queue refill, if less than this number
+  // of queue units (one entry takes 1 to 3 units) is left, instead of waiting
+  // for the next manage period. 0 disables this. Default is 4 units.
+  // On esp32 the stepper task is notified, on avr the step interrupt does the
+  // refill with interrupts enabled.
+  void setQueueLowWatermark(uint8_t units);
+
+  // Let the next start of the stopped stepper wait till the time base
+  // FastAccelStepperEngine::getTicks() reaches start_ticks. Steppers with the
+  // same start time start in sync. This applies to raw queue commands and to
+  // moves. start_ticks should be at most ABSOLUTE_MAX_TICKS in the future and
+  // a start time in the past starts immediately.
+  // Returns false, if the stepper is already running.
+  bool setStartTime(uint32_t start_ticks);
 
   // Return codes for addQueueEntry
 #define AQE_OK 0
@@ -223,7 +547,9 @@ class FastAccelStepper {
   // application
   inline void manage() {
     isr_fill_queue();
+#if (FAS_AUTO_ENABLE == 1)
     check_for_auto_disable();
+#endif
   }
 
 #if (TEST_MEASURE_ISR_SINGLE_FILL == 1)
@@ -234,42 +560,226 @@ class FastAccelStepper {
 #endif
 
  private:
+  friend class FastAccelStepperEngine;
+  friend class FasGcode;
   RampGenerator rg;
   uint8_t _stepPin;
   uint8_t _dirPin;
   bool _dirHighCountsUp;
-  bool _autoEnable;
+#if (FAS_ENABLE_PINS == 2)
   uint8_t _enablePinLowActive;
   uint8_t _enablePinHighActive;
+#elif (FAS_ENABLE_PINS == 1)
+  uint8_t _enablePin;
+  bool _enableLowActive;
+#endif
   uint8_t _queue_num;
 
+#if (FAS_AUTO_ENABLE == 1)
+  bool _autoEnable;
   uint32_t _on_delay_ticks;
   uint16_t _off_delay_count;
   uint16_t _auto_disable_delay_counter;
+#endif
+  volatile bool _truncate_queue;
+  // set on the lead axis of a coordinated move
+  struct coordinated_move_s* _coord;
+  // set while the queue is filled to avoid concurrent fills
+  bool _fill_busy;
+  bool _lock_fill();
+  void _unlock_fill();
   void isr_fill_queue();
-  void isr_single_fill_queue();
+  // Adds at most one command. Returns true, if more commands can be added.
+  // Then buffered is set to the ticks in the queue (see ticksInQueue()).
+  bool isr_single_fill_queue(uint32_t* buffered);
+  bool _fill_queue_once(uint32_t* buffered);
+  static bool _followersHaveSpace(struct coordinated_move_s* c);
+  // Returns false, if an entry of a follower has not been added
+  static bool _addFollowerEntries(struct coordinated_move_s* c,
+                                  uint32_t ticks, uint16_t steps);
+  int8_t _addCoordinatedEntry(struct coordinated_move_s* c, uint32_t entry_at,
+                              uint32_t ticks, uint16_t steps, bool dir_high);
+  bool _fill_arc_once(uint32_t* buffered);
+  // These return false, if a queue entry has not been added
+  bool _addArcStep(struct coordinated_axis_s* f, uint32_t step_at,
+                   bool dir_high);
+  bool _flushArcSteps(struct coordinated_axis_s* f);
+  // electronic gearing: a master links its followers with _gear_next.
+  // _gear_ticks is the time base value at the master's queue end resp. of
+  // the follower's last step.
+  FastAccelStepper* _gear_master;
+  FastAccelStepper* _gear_first;
+  FastAccelStepper* _gear_next;
+  int32_t _gear_num;
+  uint32_t _gear_den;
+  int32_t _gear_offset;
+  uint32_t _gear_ticks;
+  int32_t _gearPosition(int32_t master_pos);
+  bool _gearFollowersHaveSpace();
+  // true, if a follower would pass its position limit
+  bool _gearBeyondLimits(int32_t master_target);
+  int8_t _addMasterEntry(uint32_t ticks, uint16_t steps, bool count_up);
+  int8_t _addGearEntries(uint32_t window_at, uint32_t ticks, int32_t m0,
+                         int32_t m1);
+#if (FAS_AUTO_ENABLE == 1)
   void check_for_auto_disable();
+#endif
 };
 
 class FastAccelStepperEngine {
  public:
   // stable API functions
   void init();
+  // Same as init() with an adjusted configuration, e.g. for pinning the
+  // esp32 stepper task to a core:
+  //      struct engine_config_s config = ENGINE_CONFIG_DEFAULT;
+  //      config.task_core = 1;
+  //      engine.init(config);
+  // With a longer manage period the queue is filled further ahead, so the
+  // queue depth must suffice.
+  void init(const struct engine_config_s& config);
 
   // ESP32:
-  // The first three steppers use mcpwm0, the next three steppers use mcpwm1
+  // The first three steppers use mcpwm0, the next three steppers use mcpwm1.
+  // Further steppers use the software timer channels.
   //
   // AVR:
-  // Only the pins connected to OC1A and OC1B are allowed
+  // The pins connected to OC1A and OC1B use the hardware channels. Other pins
+  // are only allowed with software timer channels (-DFAS_SOFT_CHANNELS=n).
+  //
+  // With -DFAS_HW_CHANNELS=n only the first n hardware channels are used
+  // (avr: 1 is OC1A only).
+  //
+  // The software timer channels (FAS_SOFT_CHANNELS, default esp32: 4,
+  // avr: 0) share one timer interrupt (esp32: timer 1 of timer group 1,
+  // avr: timer 2). They are meant for slow auxiliary axes and setSpeed()
+  // limits these to SOFT_MIN_DELTA_TICKS.
   //
   // If no stepper resources available or pin is wrong, then NULL is returned
+  //
+  // The first variant uses a command queue with the default depth
+  // (AVR: 32 units, ESP32: 64 units, or -DQUEUE_LEN=n).
+  //
+  // The second variant uses the provided queue buffer, which must have
+  // static lifetime. So fast axes can use a deep queue and slow auxiliary
+  // axes a small one. The default queue buffers are only linked in, if the
+  // first variant is used. Example:
+  //      StepperQueueBuffer<16> aux_queue;
+  //      stepper = engine.stepperConnectToPin(stepPin, aux_queue);
+  //
+  // The queue depth limits the buffered time. The ramp generator fills the
+  // queue up to 10ms (or the longer manage period) ahead, so a small queue
+  // may be insufficient for high step rates.
   FastAccelStepper* stepperConnectToPin(uint8_t step_pin);
+  template <uint8_t QUEUE_DEPTH>
+  FastAccelStepper* stepperConnectToPin(
+      uint8_t step_pin, StepperQueueBuffer<QUEUE_DEPTH>& queue_buffer) {
+    return _stepperConnectToPin(step_pin, queue_buffer.entry, QUEUE_DEPTH);
+  }
+
+  // Stepper groups for steppers, which need to start or stop together,
+  // like the two motors of a gantry axis. A group is an array of n steppers.
+  //
+  // armGroup() keeps the steppers stopped, while commands are added to their
+  // queues by addQueueEntry() or a move. Returns false, if a stepper is
+  // running.
+  //
+  // startGroup() starts all steppers of the group in the same timer tick
+  // approx. 2ms later. Steppers without queued commands start with their
+  // first command, but not before this time.
+  //    for esp32: the hardware channels are started by one callback of the
+  //    esp_timer task, which syncs the mcpwm timers. The channels of one
+  //    mcpwm unit (0-2, 3-5) start in the same tick, the second unit a few
+  //    ticks after the first. All start later, if other
+  //    esp_timer callbacks are due at that time. The software timer channels
+  //    start in the same tick.
+  //
+  // forceStopGroup() stops all steppers of the group immediately and empties
+  // their queues. Each stepper keeps the position reached at the stop.
+  bool armGroup(FastAccelStepper* const steppers[], uint8_t n);
+  void startGroup(FastAccelStepper* const steppers[], uint8_t n);
+  void forceStopGroup(FastAccelStepper* const steppers[], uint8_t n);
+
+  // Moves the n steppers on a straight line to the positions. min_step_us
+  // and accel are the speed and acceleration along the path, which is
+  // measured in steps: A move of 300 steps in x and 400 steps in y has a path
+  // length of 500 steps.
+  //
+  // The axis with the most steps is the lead axis. Its ramp generator plans
+  // the ramp with the speed and acceleration projected on it. The configured
+  // values of setSpeed()/setAcceleration() are kept for later moves. The steps
+  // of the other axes are placed at the times, when the lead axis passes
+  // their share of the path. All axes start together as a group (see
+  // startGroup()) and finish with the last step of the lead axis.
+  //
+  // A stopMove() of the lead axis decelerates all axes on the path after the
+  // already queued commands. The queues of the other axes need space for
+  // three entries per command of the lead axis and one more per armed
+  // position event, so they should have a depth of at least 16 units. If an
+  // entry of an axis is rejected nevertheless, the move ends after the
+  // queued commands. The delay of setDelayToEnable() is not coordinated.
+  //
+  // Only one coordinated move can be active. Returns MOVE_OK or an error
+  // code of move(). MOVE_ERR_STEPPER_RUNNING is returned, if a stepper or
+  // the previous coordinated move is still running.
+  int8_t moveLinear(FastAccelStepper* const steppers[],
+                    const int32_t positions[], uint8_t n,
+                    uint32_t min_step_us, uint32_t accel);
+
+  // Moves the steppers x and y on a circular arc around the center to the
+  // end position. The radius is the distance of the current position to the
+  // center. The end position must be within one step of the circle and may
+  // equal the current position for a full circle. Positive directions of x
+  // and y span the plane, so counter clockwise runs from +x to +y.
+  //
+  // The steps follow the midpoint circle algorithm with integer math: Each
+  // step along the path moves the faster axis and, if this stays closer to
+  // the circle, the other axis. min_step_us and accel are the tangential
+  // speed and acceleration. The period of the steps is stretched by the path
+  // length per step, so the tangential speed is constant on the whole arc.
+  //
+  // Like moveLinear(), x is the lead axis, whose ramp generator plans the
+  // ramp along the path with min_step_us and accel. A stopMove() of x
+  // decelerates on the arc. Both steppers need a direction pin and the radius
+  // is limited to ARC_MAX_RADIUS steps. Returns MOVE_OK, an error code of
+  // move(), MOVE_ERR_STEPPER_RUNNING or MOVE_ERR_ARC_GEOMETRY.
+  int8_t arcTo(FastAccelStepper* x, FastAccelStepper* y, int32_t center_x,
+               int32_t center_y, int32_t end_x, int32_t end_y, bool clockwise,
+               uint32_t min_step_us, uint32_t accel);
+
+  // Moves the n steppers independently to the positions, so that all of them
+  // start together and finish together. The speed and acceleration of each
+  // stepper (setSpeed()/setAcceleration()) are its limits. The move time is
+  // given by the limiting axis and the other axes are slowed down to the
+  // same ramp and coasting times, so all axes accelerate, coast and
+  // decelerate together. The axes are not interpolated, so the path is only
+  // a straight line within the rounding of the ramps. The configured speed
+  // and acceleration of the steppers are kept for later moves.
+  //
+  // Returns MOVE_OK or an error code of move(). MOVE_ERR_STEPPER_RUNNING is
+  // returned, if a stepper is still running. All targets are checked against
+  // the position limits and on any error no stepper moves.
+  int8_t moveSynchronized(FastAccelStepper* const steppers[],
+                          const int32_t positions[], uint8_t n);
+
+  // Time base shared by all steppers in ticks, which wraps around.
+  // avr: timer 1 and its overflow count, esp32: esp_timer,
+  // linux: CLOCK_MONOTONIC
+  uint32_t getTicks();
+
+#if defined(FAS_LINUX)
+  // The outputs of all steppers are passed to this sink. Without sink, the
+  // outputs are dropped.
+  void setOutputSink(FasOutputSink* sink);
+#endif
 
   // unstable API functions
   //
+#if (FAS_DEBUG_LED == 1)
   // If this is called, then the periodic task will let the associated LED
   // blink with 1 Hz
   void setDebugLed(uint8_t ledPin);
+#endif
 
   // This should be only called from ISR or stepper task
   void manageSteppers();
@@ -277,7 +787,14 @@ class FastAccelStepperEngine {
  private:
   uint8_t _next_stepper_num;
   FastAccelStepper* _stepper[MAX_STEPPER];
+  struct coordinated_move_s _coord;
 
   bool _isValidStepPin(uint8_t step_pin);
+  int8_t _startCoordinated(FastAccelStepper* const group[], uint8_t n,
+                           int32_t ramp_from, int32_t ramp_to,
+                           uint32_t min_step_us, uint32_t accel);
+  FastAccelStepper* _stepperConnectToPin(uint8_t step_pin,
+                                         union queue_unit* queue_unit,
+                                         uint8_t queue_len);
 };
 #endif
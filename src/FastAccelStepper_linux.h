@@ -0,0 +1,101 @@
+#ifndef FASTACCELSTEPPER_LINUX_H
+#define FASTACCELSTEPPER_LINUX_H
+// Linux user space backend, which is selected by defining FAS_LINUX.
+//
+// The stepper interrupt is replaced by a timer thread, which consumes the
+// command queues and passes the steps to an output sink. The stepper task is
+// replaced by a manage thread. This file provides the Arduino functions used
+// by the library and the output sinks.
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+
+#define abs(x) ((x) > 0 ? (x) : -(x))
+#define min(a, b) ((a) > (b) ? (b) : (a))
+#define max(a, b) ((a) > (b) ? (a) : (b))
+
+// noInterrupts() locks out the timer thread. Calls may be nested.
+void noInterrupts();
+void interrupts();
+// Pin outputs are passed to the output sink
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+uint32_t micros();
+
+// Receives the outputs of the steppers. Times are in ticks of
+// FastAccelStepperEngine::getTicks(). For the steps this is the planned time,
+// which can be earlier than the actual call on a late timer thread.
+// step() is called from the timer thread, pinWrite() from any thread.
+class FasOutputSink {
+ public:
+  virtual ~FasOutputSink() {}
+  virtual void step(uint8_t step_pin, uint32_t ticks, uint16_t pulse_ticks) = 0;
+  virtual void pinWrite(uint8_t pin, bool high, uint32_t ticks) = 0;
+};
+
+// One output recorded by FasRecorderSink
+struct fas_output_event_s {
+  uint32_t ticks;
+  uint8_t pin;
+  bool step;  // true: step pulse, false: pin level change
+  bool high;  // new pin level
+};
+
+// Records the outputs into the provided buffer. Outputs beyond the buffer
+// size are dropped.
+class FasRecorderSink : public FasOutputSink {
+ public:
+  FasRecorderSink(struct fas_output_event_s* buffer, uint32_t size);
+  void step(uint8_t step_pin, uint32_t ticks, uint16_t pulse_ticks);
+  void pinWrite(uint8_t pin, bool high, uint32_t ticks);
+  uint32_t count() { return _count; }
+  const struct fas_output_event_s* events() { return _buffer; }
+  void clear();
+
+ private:
+  void _add(uint32_t ticks, uint8_t pin, bool step, bool high);
+  struct fas_output_event_s* _buffer;
+  uint32_t _size;
+  volatile uint32_t _count;
+  pthread_mutex_t _mutex;
+};
+
+// Writes one line per output to the file:
+//   <ticks> S <step_pin>
+//   <ticks> P <pin> <level>
+class FasFileSink : public FasOutputSink {
+ public:
+  FasFileSink(FILE* file);
+  void step(uint8_t step_pin, uint32_t ticks, uint16_t pulse_ticks);
+  void pinWrite(uint8_t pin, bool high, uint32_t ticks);
+
+ private:
+  FILE* _file;
+  pthread_mutex_t _mutex;
+};
+
+// Drives the lines of a GPIO character device like /dev/gpiochip0. The pin
+// numbers are the line offsets of the chip. The step pulse is generated by
+// the timer thread with a busy wait of the pulse width.
+class FasGpioChipSink : public FasOutputSink {
+ public:
+  FasGpioChipSink(const char* chip_path);
+  ~FasGpioChipSink();
+  // false, if the chip could not be opened
+  bool isOpen() { return _chip_fd >= 0; }
+  void step(uint8_t step_pin, uint32_t ticks, uint16_t pulse_ticks);
+  void pinWrite(uint8_t pin, bool high, uint32_t ticks);
+
+ private:
+  int _lineFd(uint8_t pin);
+  void _setLine(int fd, bool high);
+  int _chip_fd;
+  int _line_fd[256];
+  pthread_mutex_t _mutex;
+};
+#endif
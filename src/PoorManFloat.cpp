@@ -7,6 +7,7 @@
 #else
 #define PROGMEM
 #define pgm_read_byte_near(x) (*(x))
+#define pgm_read_word_near(x) (*(x))
 #endif
 #include "PoorManFloat.h"
 
@@ -22,55 +23,9 @@
 //
 //  0x8080 => is 1
 
-const PROGMEM uint8_t isqrt_tab[256] = {
-    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 139, 140, 141,
-    142, 143, 144, 145, 146, 147, 148, 148, 149, 150, 151, 152, 153, 153, 154,
-    155, 156, 157, 158, 158, 159, 160, 161, 162, 162, 163, 164, 165, 166, 166,
-    167, 168, 169, 169, 170, 171, 172, 172, 173, 174, 175, 175, 176, 177, 177,
-    178, 179, 180, 180, 181, 182, 182, 183, 184, 185, 185, 186, 187, 187, 188,
-    189, 189, 190, 191, 191, 192, 193, 193, 194, 195, 195, 196, 197, 197, 198,
-    199, 199, 200, 200, 201, 202, 202, 203, 204, 204, 205, 206, 206, 207, 207,
-    208, 209, 209, 210, 210, 211, 212, 212, 213, 213, 214, 215, 215, 216, 216,
-    217, 218, 218, 219, 219, 220, 221, 221, 222, 222, 223, 223, 224, 225, 225,
-    226, 226, 227, 227, 228, 229, 229, 230, 230, 231, 231, 232, 232, 233, 234,
-    234, 235, 235, 236, 236, 237, 237, 238, 238, 239, 239, 240, 241, 241, 242,
-    242, 243, 243, 244, 244, 245, 245, 246, 246, 247, 247, 248, 248, 249, 249,
-    250, 250, 251, 251, 252, 252, 253, 253, 254, 254, 255, 255};
-#ifdef LOG_DIVIDE
-const PROGMEM uint8_t log_adjust[192] = {
-    0,   3,   6,   8,   11,  14,  17,  19,  22,  24,  27,  29,  32,  34,  36,
-    39,  41,  43,  46,  48,  50,  52,  55,  57,  59,  61,  63,  65,  67,  69,
-    71,  73,  75,  77,  79,  80,  82,  84,  86,  88,  90,  91,  93,  95,  97,
-    98,  100, 102, 103, 105, 106, 108, 110, 111, 113, 114, 116, 117, 119, 121,
-    122, 123, 125, 126, 128, 129, 131, 132, 134, 135, 136, 138, 139, 140, 142,
-    143, 144, 146, 147, 148, 150, 151, 152, 153, 155, 156, 157, 158, 160, 161,
-    162, 163, 164, 166, 167, 168, 169, 170, 171, 172, 174, 175, 176, 177, 178,
-    179, 180, 181, 182, 183, 184, 186, 187, 188, 189, 190, 191, 192, 193, 194,
-    195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 206, 207, 208,
-    209, 210, 211, 212, 213, 214, 215, 216, 217, 217, 218, 219, 220, 221, 222,
-    223, 224, 224, 225, 226, 227, 228, 229, 229, 230, 231, 232, 233, 234, 234,
-    235, 236, 237, 238, 238, 239, 240, 241, 241, 242, 243, 244, 245, 245, 246,
-    247, 248, 248, 249, 250, 251, 251, 252, 253, 254, 254, 255};
-const PROGMEM uint8_t exp_mul_64[256] = {
-    64,  64,  65,  65,  65,  66,  66,  66,  67,  67,  68,  68,  68,  69,  69,
-    69,  70,  70,  71,  71,  71,  72,  72,  72,  73,  73,  74,  74,  74,  75,
-    75,  76,  76,  77,  77,  77,  78,  78,  79,  79,  79,  80,  80,  81,  81,
-    82,  82,  83,  83,  83,  84,  84,  85,  85,  86,  86,  87,  87,  88,  88,
-    89,  89,  90,  90,  91,  91,  92,  92,  93,  93,  94,  94,  95,  95,  96,
-    96,  97,  97,  98,  98,  99,  99,  100, 100, 101, 101, 102, 103, 103, 104,
-    104, 105, 105, 106, 107, 107, 108, 108, 109, 109, 110, 111, 111, 112, 112,
-    113, 114, 114, 115, 116, 116, 117, 117, 118, 119, 119, 120, 121, 121, 122,
-    123, 123, 124, 125, 125, 126, 127, 127, 128, 129, 129, 130, 131, 132, 132,
-    133, 134, 135, 135, 136, 137, 137, 138, 139, 140, 140, 141, 142, 143, 144,
-    144, 145, 146, 147, 147, 148, 149, 150, 151, 152, 152, 153, 154, 155, 156,
-    157, 157, 158, 159, 160, 161, 162, 163, 163, 164, 165, 166, 167, 168, 169,
-    170, 171, 172, 173, 174, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183,
-    184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 196, 197, 198, 199,
-    200, 201, 202, 203, 204, 205, 206, 208, 209, 210, 211, 212, 213, 214, 216,
-    217, 218, 219, 220, 221, 223, 224, 225, 226, 228, 229, 230, 231, 233, 234,
-    235, 236, 238, 239, 240, 242, 243, 244, 246, 247, 248, 250, 251, 252, 254,
-    255};
-#endif
+// The lookup tables are generated by extras/gen_upm_tables.py.
+// UPM_TABLE_SIZE selects the variant (see PoorManFloat.h)
+#include "PoorManFloat_tables.h"
 
 upm_float upm_from(uint8_t x) {
   uint16_t res;
@@ -186,6 +141,88 @@ upm_float upm_square(upm_float x) {
   return aa;
 }
 #ifdef LOG_DIVIDE
+// upm_log_divide() calculates x/y or sqrt(x/y) in one pass via the log/exp
+// tables. The square root is just a halving of the log difference, so the
+// fused operation avoids the rounding and table lookups of a separate
+// upm_sqrt().
+#if (UPM_TABLE_SIZE == 2)
+static inline upm_float upm_log_divide(upm_float x, upm_float y,
+                                       bool take_sqrt) {
+  uint8_t exp_x = x >> 8;
+  uint8_t exp_y = y >> 8;
+  uint8_t mant_x = x & 255;
+  uint8_t mant_y = y & 255;
+
+  uint16_t log_x = pgm_read_word_near(&log_tab[mant_x - 128]);
+  uint16_t log_y = pgm_read_word_near(&log_tab[mant_y - 128]);
+  uint8_t exp_res = exp_x - exp_y;
+  if (log_x < log_y) {
+    log_x += UPM_LOG_STEPS;
+    exp_res -= 1;
+  }
+  uint16_t log_x_y = log_x - log_y;
+  if (take_sqrt) {
+    // an odd exponent is moved as one octave into the log difference
+    if (exp_res & 1) {
+      log_x_y += UPM_LOG_STEPS;
+      exp_res -= 1;
+    }
+    log_x_y >>= 1;
+    exp_res = ((int8_t)exp_res) >> 1;
+  }
+  uint8_t mant_res = pgm_read_byte_near(&exp_tab[log_x_y]);
+  exp_res += 128;
+
+  uint16_t res = exp_res;
+  res <<= 8;
+  res |= mant_res;
+  return res;
+}
+#else
+// For the small/default tables one octave is 128 in log_adjust units.
+// The log difference is normalized to one octave, so only the upper half
+// of exp_mul_64 is used and the result keeps the full mantissa.
+static inline upm_float upm_log_divide(upm_float x, upm_float y,
+                                       bool take_sqrt) {
+  uint8_t exp_x = x >> 8;
+  uint8_t exp_y = y >> 8;
+  uint8_t mant_x = x & 255;
+  uint8_t mant_y = y & 255;
+
+  uint8_t log_x =
+      pgm_read_byte_near(&log_adjust[(mant_x - 64) >> UPM_MANT_SHIFT]);
+  uint8_t log_y =
+      pgm_read_byte_near(&log_adjust[(mant_y - 64) >> UPM_MANT_SHIFT]);
+  int16_t log_x_y = log_x - log_y;
+  uint8_t exp_res = exp_x - exp_y;
+  if (take_sqrt) {
+    // an odd exponent is moved as one octave into the log difference
+    if (exp_res & 1) {
+      log_x_y += 128;
+      exp_res -= 1;
+    }
+    log_x_y >>= 1;
+    exp_res = ((int8_t)exp_res) >> 1;
+  }
+  if (log_x_y < 0) {
+    log_x_y += 128;
+    exp_res -= 1;
+  }
+  uint8_t mant_res =
+      pgm_read_byte_near(&exp_mul_64[(log_x_y + 128) >> UPM_MANT_SHIFT]);
+  exp_res += 128;
+
+  uint16_t res = exp_res;
+  res <<= 8;
+  res |= mant_res;
+  return res;
+}
+#endif
+#if (UPM_TABLE_SIZE == 2)
+upm_float upm_divide(upm_float x, upm_float y) {
+  return upm_log_divide(x, y, false);
+}
+#else
 upm_float upm_divide(upm_float x, upm_float y) {
   uint8_t exp_x = x >> 8;
   uint8_t exp_y = y >> 8;
@@ -196,10 +233,13 @@ upm_float upm_divide(upm_float x, upm_float y) {
     mant_y >>= 1;
     exp_y += 1;
   }
-  uint8_t log_x = pgm_read_byte_near(&log_adjust[mant_x - 64]);
-  uint8_t log_y = pgm_read_byte_near(&log_adjust[mant_y - 64]);
+  uint8_t log_x =
+      pgm_read_byte_near(&log_adjust[(mant_x - 64) >> UPM_MANT_SHIFT]);
+  uint8_t log_y =
+      pgm_read_byte_near(&log_adjust[(mant_y - 64) >> UPM_MANT_SHIFT]);
   uint8_t log_x_y = log_x - log_y;
-  uint8_t mant_res = pgm_read_byte_near(&exp_mul_64[log_x_y]);
+  uint8_t mant_res =
+      pgm_read_byte_near(&exp_mul_64[log_x_y >> UPM_MANT_SHIFT]);
   uint8_t exp_res = exp_x - exp_y + 128 - 6 +
                     7;  // 6 for table_64 factor. 7 for shift of upm_float
 
@@ -213,6 +253,14 @@ upm_float upm_divide(upm_float x, upm_float y) {
   res |= mant_res;
   return res;
 }
+#endif
+upm_float upm_reciprocal(upm_float x) {
+  return upm_log_divide(UPM_ONE, x, false);
+}
+upm_float upm_sqrt_div(upm_float x, upm_float y) {
+  return upm_log_divide(x, y, true);
+}
+upm_float upm_rsqrt(upm_float x) { return upm_log_divide(UPM_ONE, x, true); }
 #else
 upm_float upm_divide(upm_float x, upm_float y) {
   if (x < y) {
@@ -243,6 +291,11 @@ upm_float upm_divide(upm_float x, upm_float y) {
   res |= mantissa;
   return res;
 }
+upm_float upm_reciprocal(upm_float x) { return upm_divide(UPM_ONE, x); }
+upm_float upm_sqrt_div(upm_float x, upm_float y) {
+  return upm_sqrt(upm_divide(x, y));
+}
+upm_float upm_rsqrt(upm_float x) { return upm_sqrt(upm_divide(UPM_ONE, x)); }
 #endif
 uint16_t upm_to_u16(upm_float x) {
   uint8_t exponent = x >> 8;
@@ -343,12 +396,23 @@ upm_float upm_shr(upm_float x, uint8_t n) { return x - (((uint16_t)n) << 8); }
 upm_float upm_sqrt(upm_float x) {
   uint8_t mantissa = x & 0x00ff;
   uint8_t exponent = x >> 8;
+#if (UPM_TABLE_SIZE == 2)
+  // first half of the table is for even, second half for odd exponent
+  uint8_t index = mantissa - 128;
+  if ((exponent & 0x01) != 0) {
+    index |= 0x80;
+  }
+  exponent |= 0x01;
+  uint8_t sqrt_mantissa = pgm_read_byte_near(&isqrt_tab[index]);
+#else
   if ((exponent & 0x01) == 0) {
     exponent += 1;
     mantissa >>= 1;
   }
   mantissa -= 64;
-  uint8_t sqrt_mantissa = pgm_read_byte_near(&isqrt_tab[mantissa]);
+  uint8_t sqrt_mantissa =
+      pgm_read_byte_near(&isqrt_tab[mantissa >> UPM_MANT_SHIFT]);
+#endif
   if (exponent >= 128) {
     exponent -= 128;
     exponent >>= 1;
@@ -4,8 +4,25 @@
 #define max(a, b) ((a) > (b) ? (a) : (b))
 #endif
 
+// Size of the lookup tables for upm_divide() and upm_sqrt():
+//   0: small tables for flash constraint devices (reduced accuracy)
+//   1: default tables
+//   2: large tables with improved accuracy at same execution speed
+// The tables are generated by extras/gen_upm_tables.py and the worst case
+// error of the operations for each size is reported by tests/test_06.
+#ifndef UPM_TABLE_SIZE
+#if defined(ARDUINO_ARCH_ESP32)
+#define UPM_TABLE_SIZE 2
+#else
+#define UPM_TABLE_SIZE 1
+#endif
+#endif
+
 typedef uint16_t upm_float;
 
+#define UPM_ONE ((upm_float)0x8080)
+#define UPM_HALF ((upm_float)0x7f80)
+
 upm_float upm_from(uint8_t x);
 upm_float upm_from(uint16_t x);
 upm_float upm_from(uint32_t x);
@@ -21,3 +38,12 @@ upm_float upm_shl(upm_float x, uint8_t n);
 upm_float upm_shr(upm_float x, uint8_t n);
 upm_float upm_square(upm_float x);
 upm_float upm_sqrt(upm_float x);
+
+// Fused operations, which are calculated in one pass and are more accurate
+// than the composition of the basic operations:
+//   upm_reciprocal(x) = 1/x
+//   upm_rsqrt(x)      = 1/sqrt(x)
+//   upm_sqrt_div(x,y) = sqrt(x/y)
+upm_float upm_reciprocal(upm_float x);
+upm_float upm_rsqrt(upm_float x);
+upm_float upm_sqrt_div(upm_float x, upm_float y);
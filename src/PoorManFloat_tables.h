@@ -0,0 +1,148 @@
+// This file is generated by extras/gen_upm_tables.py - do not edit
+//
+// Command line: --small-shift 1 --large-log-steps 512
+
+#if (UPM_TABLE_SIZE == 0)
+#define UPM_MANT_SHIFT 1
+const PROGMEM uint8_t isqrt_tab[96] = {
+    128, 130, 132, 134, 136, 138, 140, 142, 144, 145, 147, 149, 151, 152, 154,
+    156, 157, 159, 160, 162, 164, 165, 167, 168, 170, 171, 173, 174, 176, 177,
+    179, 180, 181, 183, 184, 186, 187, 188, 190, 191, 192, 194, 195, 196, 198,
+    199, 200, 201, 203, 204, 205, 206, 208, 209, 210, 211, 213, 214, 215, 216,
+    217, 219, 220, 221, 222, 223, 224, 225, 227, 228, 229, 230, 231, 232, 233,
+    234, 235, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249,
+    250, 251, 252, 253, 254, 255};
+const PROGMEM uint8_t log_adjust[96] = {
+    1, 7, 13, 18, 23, 28, 33, 38, 42, 47, 51, 56, 60, 64, 68, 72, 76, 80, 83,
+    87, 90, 94, 97, 101, 104, 107, 110, 114, 117, 120, 123, 126, 129, 131, 134,
+    137, 140, 142, 145, 148, 150, 153, 155, 158, 160, 163, 165, 167, 170, 172,
+    174, 176, 179, 181, 183, 185, 187, 189, 191, 193, 195, 197, 199, 201, 203,
+    205, 207, 209, 211, 212, 214, 216, 218, 220, 221, 223, 225, 227, 228, 230,
+    232, 233, 235, 236, 238, 240, 241, 243, 244, 246, 247, 249, 250, 252, 253,
+    255};
+const PROGMEM uint8_t exp_mul_64[128] = {
+    64, 65, 66, 66, 67, 68, 68, 69, 70, 71, 72, 72, 73, 74, 75, 76, 76, 77, 78,
+    79, 80, 81, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96,
+    97, 98, 99, 100, 101, 102, 103, 105, 106, 107, 108, 109, 110, 112, 113, 114,
+    115, 117, 118, 119, 120, 122, 123, 124, 126, 127, 128, 130, 131, 133, 134,
+    136, 137, 139, 140, 142, 143, 145, 146, 148, 149, 151, 153, 154, 156, 158,
+    160, 161, 163, 165, 167, 168, 170, 172, 174, 176, 178, 180, 182, 184, 186,
+    188, 190, 192, 194, 196, 198, 200, 203, 205, 207, 209, 212, 214, 216, 218,
+    221, 223, 226, 228, 231, 233, 236, 238, 241, 244, 246, 249, 252, 254};
+#elif (UPM_TABLE_SIZE == 1)
+#define UPM_MANT_SHIFT 0
+const PROGMEM uint8_t isqrt_tab[192] = {
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 139, 140, 141,
+    142, 143, 144, 145, 146, 147, 148, 148, 149, 150, 151, 152, 153, 153, 154,
+    155, 156, 157, 158, 158, 159, 160, 161, 162, 162, 163, 164, 165, 166, 166,
+    167, 168, 169, 169, 170, 171, 172, 172, 173, 174, 175, 175, 176, 177, 177,
+    178, 179, 180, 180, 181, 182, 182, 183, 184, 185, 185, 186, 187, 187, 188,
+    189, 189, 190, 191, 191, 192, 193, 193, 194, 195, 195, 196, 197, 197, 198,
+    199, 199, 200, 200, 201, 202, 202, 203, 204, 204, 205, 206, 206, 207, 207,
+    208, 209, 209, 210, 210, 211, 212, 212, 213, 213, 214, 215, 215, 216, 216,
+    217, 218, 218, 219, 219, 220, 221, 221, 222, 222, 223, 223, 224, 225, 225,
+    226, 226, 227, 227, 228, 229, 229, 230, 230, 231, 231, 232, 232, 233, 234,
+    234, 235, 235, 236, 236, 237, 237, 238, 238, 239, 239, 240, 241, 241, 242,
+    242, 243, 243, 244, 244, 245, 245, 246, 246, 247, 247, 248, 248, 249, 249,
+    250, 250, 251, 251, 252, 252, 253, 253, 254, 254, 255, 255};
+const PROGMEM uint8_t log_adjust[192] = {
+    0, 3, 6, 8, 11, 14, 17, 19, 22, 24, 27, 29, 32, 34, 36, 39, 41, 43, 46, 48,
+    50, 52, 55, 57, 59, 61, 63, 65, 67, 69, 71, 73, 75, 77, 79, 80, 82, 84, 86,
+    88, 90, 91, 93, 95, 97, 98, 100, 102, 103, 105, 106, 108, 110, 111, 113,
+    114, 116, 117, 119, 121, 122, 123, 125, 126, 128, 129, 131, 132, 134, 135,
+    136, 138, 139, 140, 142, 143, 144, 146, 147, 148, 150, 151, 152, 153, 155,
+    156, 157, 158, 160, 161, 162, 163, 164, 166, 167, 168, 169, 170, 171, 172,
+    174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 186, 187, 188, 189,
+    190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204,
+    205, 206, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 217,
+    218, 219, 220, 221, 222, 223, 224, 224, 225, 226, 227, 228, 229, 229, 230,
+    231, 232, 233, 234, 234, 235, 236, 237, 238, 238, 239, 240, 241, 241, 242,
+    243, 244, 245, 245, 246, 247, 248, 248, 249, 250, 251, 251, 252, 253, 254,
+    254, 255};
+const PROGMEM uint8_t exp_mul_64[256] = {
+    64, 64, 65, 65, 65, 66, 66, 66, 67, 67, 68, 68, 68, 69, 69, 69, 70, 70, 71,
+    71, 71, 72, 72, 72, 73, 73, 74, 74, 74, 75, 75, 76, 76, 77, 77, 77, 78, 78,
+    79, 79, 79, 80, 80, 81, 81, 82, 82, 83, 83, 83, 84, 84, 85, 85, 86, 86, 87,
+    87, 88, 88, 89, 89, 90, 90, 91, 91, 92, 92, 93, 93, 94, 94, 95, 95, 96, 96,
+    97, 97, 98, 98, 99, 99, 100, 100, 101, 101, 102, 103, 103, 104, 104, 105,
+    105, 106, 107, 107, 108, 108, 109, 109, 110, 111, 111, 112, 112, 113, 114,
+    114, 115, 116, 116, 117, 117, 118, 119, 119, 120, 121, 121, 122, 123, 123,
+    124, 125, 125, 126, 127, 127, 128, 129, 129, 130, 131, 132, 132, 133, 134,
+    135, 135, 136, 137, 137, 138, 139, 140, 140, 141, 142, 143, 144, 144, 145,
+    146, 147, 147, 148, 149, 150, 151, 152, 152, 153, 154, 155, 156, 157, 157,
+    158, 159, 160, 161, 162, 163, 163, 164, 165, 166, 167, 168, 169, 170, 171,
+    172, 173, 174, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185,
+    186, 187, 188, 189, 190, 191, 192, 193, 194, 196, 197, 198, 199, 200, 201,
+    202, 203, 204, 205, 206, 208, 209, 210, 211, 212, 213, 214, 216, 217, 218,
+    219, 220, 221, 223, 224, 225, 226, 228, 229, 230, 231, 233, 234, 235, 236,
+    238, 239, 240, 242, 243, 244, 246, 247, 248, 250, 251, 252, 254, 255};
+#elif (UPM_TABLE_SIZE == 2)
+#define UPM_LOG_STEPS 512
+const PROGMEM uint8_t isqrt_tab[256] = {
+    128, 128, 129, 129, 130, 130, 131, 131, 132, 132, 133, 133, 134, 134, 135,
+    135, 136, 136, 137, 137, 138, 138, 139, 139, 139, 140, 140, 141, 141, 142,
+    142, 143, 143, 144, 144, 144, 145, 145, 146, 146, 147, 147, 148, 148, 148,
+    149, 149, 150, 150, 151, 151, 151, 152, 152, 153, 153, 153, 154, 154, 155,
+    155, 156, 156, 156, 157, 157, 158, 158, 158, 159, 159, 160, 160, 160, 161,
+    161, 162, 162, 162, 163, 163, 164, 164, 164, 165, 165, 166, 166, 166, 167,
+    167, 167, 168, 168, 169, 169, 169, 170, 170, 170, 171, 171, 172, 172, 172,
+    173, 173, 173, 174, 174, 175, 175, 175, 176, 176, 176, 177, 177, 177, 178,
+    178, 179, 179, 179, 180, 180, 180, 181, 181, 182, 182, 183, 184, 185, 185,
+    186, 187, 187, 188, 189, 189, 190, 191, 191, 192, 193, 193, 194, 195, 195,
+    196, 197, 197, 198, 199, 199, 200, 200, 201, 202, 202, 203, 204, 204, 205,
+    206, 206, 207, 207, 208, 209, 209, 210, 210, 211, 212, 212, 213, 213, 214,
+    215, 215, 216, 216, 217, 218, 218, 219, 219, 220, 221, 221, 222, 222, 223,
+    223, 224, 225, 225, 226, 226, 227, 227, 228, 229, 229, 230, 230, 231, 231,
+    232, 232, 233, 234, 234, 235, 235, 236, 236, 237, 237, 238, 238, 239, 239,
+    240, 241, 241, 242, 242, 243, 243, 244, 244, 245, 245, 246, 246, 247, 247,
+    248, 248, 249, 249, 250, 250, 251, 251, 252, 252, 253, 253, 254, 254, 255,
+    255};
+const PROGMEM uint16_t log_tab[128] = {
+    0, 6, 11, 17, 23, 28, 34, 39, 45, 50, 56, 61, 66, 71, 77, 82, 87, 92, 97,
+    102, 107, 112, 117, 122, 127, 132, 137, 141, 146, 151, 156, 160, 165, 169,
+    174, 179, 183, 188, 192, 196, 201, 205, 210, 214, 218, 223, 227, 231, 235,
+    239, 244, 248, 252, 256, 260, 264, 268, 272, 276, 280, 284, 288, 292, 296,
+    300, 303, 307, 311, 315, 318, 322, 326, 330, 333, 337, 341, 344, 348, 351,
+    355, 359, 362, 366, 369, 373, 376, 380, 383, 387, 390, 393, 397, 400, 403,
+    407, 410, 413, 417, 420, 423, 426, 430, 433, 436, 439, 442, 446, 449, 452,
+    455, 458, 461, 464, 467, 470, 474, 477, 480, 483, 486, 489, 492, 494, 497,
+    500, 503, 506, 509};
+const PROGMEM uint8_t exp_tab[512] = {
+    128, 128, 128, 129, 129, 129, 129, 129, 129, 130, 130, 130, 130, 130, 130,
+    131, 131, 131, 131, 131, 132, 132, 132, 132, 132, 132, 133, 133, 133, 133,
+    133, 133, 134, 134, 134, 134, 134, 135, 135, 135, 135, 135, 135, 136, 136,
+    136, 136, 136, 137, 137, 137, 137, 137, 138, 138, 138, 138, 138, 138, 139,
+    139, 139, 139, 139, 140, 140, 140, 140, 140, 141, 141, 141, 141, 141, 141,
+    142, 142, 142, 142, 142, 143, 143, 143, 143, 143, 144, 144, 144, 144, 144,
+    145, 145, 145, 145, 145, 146, 146, 146, 146, 146, 147, 147, 147, 147, 147,
+    148, 148, 148, 148, 148, 149, 149, 149, 149, 149, 150, 150, 150, 150, 150,
+    151, 151, 151, 151, 151, 152, 152, 152, 152, 152, 153, 153, 153, 153, 153,
+    154, 154, 154, 154, 155, 155, 155, 155, 155, 156, 156, 156, 156, 156, 157,
+    157, 157, 157, 157, 158, 158, 158, 158, 159, 159, 159, 159, 159, 160, 160,
+    160, 160, 160, 161, 161, 161, 161, 162, 162, 162, 162, 162, 163, 163, 163,
+    163, 164, 164, 164, 164, 164, 165, 165, 165, 165, 166, 166, 166, 166, 166,
+    167, 167, 167, 167, 168, 168, 168, 168, 168, 169, 169, 169, 169, 170, 170,
+    170, 170, 171, 171, 171, 171, 171, 172, 172, 172, 172, 173, 173, 173, 173,
+    174, 174, 174, 174, 175, 175, 175, 175, 175, 176, 176, 176, 176, 177, 177,
+    177, 177, 178, 178, 178, 178, 179, 179, 179, 179, 180, 180, 180, 180, 181,
+    181, 181, 181, 182, 182, 182, 182, 182, 183, 183, 183, 183, 184, 184, 184,
+    184, 185, 185, 185, 185, 186, 186, 186, 186, 187, 187, 187, 188, 188, 188,
+    188, 189, 189, 189, 189, 190, 190, 190, 190, 191, 191, 191, 191, 192, 192,
+    192, 192, 193, 193, 193, 193, 194, 194, 194, 194, 195, 195, 195, 196, 196,
+    196, 196, 197, 197, 197, 197, 198, 198, 198, 198, 199, 199, 199, 200, 200,
+    200, 200, 201, 201, 201, 201, 202, 202, 202, 203, 203, 203, 203, 204, 204,
+    204, 204, 205, 205, 205, 206, 206, 206, 206, 207, 207, 207, 208, 208, 208,
+    208, 209, 209, 209, 210, 210, 210, 210, 211, 211, 211, 212, 212, 212, 212,
+    213, 213, 213, 214, 214, 214, 214, 215, 215, 215, 216, 216, 216, 216, 217,
+    217, 217, 218, 218, 218, 218, 219, 219, 219, 220, 220, 220, 221, 221, 221,
+    221, 222, 222, 222, 223, 223, 223, 224, 224, 224, 224, 225, 225, 225, 226,
+    226, 226, 227, 227, 227, 228, 228, 228, 228, 229, 229, 229, 230, 230, 230,
+    231, 231, 231, 232, 232, 232, 233, 233, 233, 233, 234, 234, 234, 235, 235,
+    235, 236, 236, 236, 237, 237, 237, 238, 238, 238, 239, 239, 239, 240, 240,
+    240, 241, 241, 241, 242, 242, 242, 243, 243, 243, 243, 244, 244, 244, 245,
+    245, 245, 246, 246, 246, 247, 247, 247, 248, 248, 248, 249, 249, 249, 250,
+    250, 251, 251, 251, 252, 252, 252, 253, 253, 253, 254, 254, 254, 255, 255,
+    255, 255};
+#else
+#error "UPM_TABLE_SIZE must be 0, 1 or 2"
+#endif
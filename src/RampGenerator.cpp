@@ -38,12 +38,17 @@ void RampGenerator::init() {
   _config.min_travel_ticks = 0;
   _config.upm_inv_accel2 = 0;
   _ro.target_pos = 0;
+  _ro.limits = false;
   _rw.ramp_state = RAMP_STATE_IDLE;
 #if (TICKS_PER_S != 16000000L)
   upm_timer_freq = upm_from((uint32_t)TICKS_PER_S);
 #endif
 }
 void RampGenerator::update_ramp_steps() {
+  if ((_config.min_travel_ticks == 0) || (_config.upm_inv_accel2 == 0)) {
+    // speed or acceleration not yet defined
+    return;
+  }
   _config.ramp_steps = upm_to_u32(upm_divide(
       _config.upm_inv_accel2, upm_square(upm_from(_config.min_travel_ticks))));
 }
@@ -66,8 +71,18 @@ void RampGenerator::setAcceleration(uint32_t accel) {
   _config.upm_inv_accel2 = upm_multiply(UPM_TICKS_PER_S, upm_inv_accel);
   update_ramp_steps();
 }
+void RampGenerator::setConfig(uint32_t min_travel_ticks,
+                              upm_float upm_inv_accel2) {
+  _config.min_travel_ticks = min_travel_ticks;
+  _config.upm_inv_accel2 = upm_inv_accel2;
+  update_ramp_steps();
+}
 void RampGenerator::_applySpeedAcceleration(uint32_t ticks_at_queue_end,
                                             int32_t target_pos) {
+  // This should never be true
+  if (ticks_at_queue_end == 0) {
+    ticks_at_queue_end = TICKS_FOR_STOPPED_MOTOR;
+  }
   uint32_t performed_ramp_up_steps = upm_to_u32(upm_divide(
       _config.upm_inv_accel2, upm_square(upm_from(ticks_at_queue_end))));
 
@@ -90,6 +105,9 @@ int RampGenerator::calculateMoveTo(int32_t target_pos,
   if (_config.upm_inv_accel2 == 0) {
     return MOVE_ERR_ACCELERATION_IS_UNDEFINED;
   }
+  if (isOutsideLimits(target_pos)) {
+    return MOVE_ERR_POSITION_LIMIT;
+  }
 
   _applySpeedAcceleration(ticks_at_queue_end, target_pos);
 
@@ -131,6 +149,33 @@ int RampGenerator::calculateMoveTo(int32_t target_pos,
   return MOVE_OK;
 }
 
+// The command queue has been truncated. So decelerate from the speed and
+// direction at the new queue end.
+void RampGenerator::restartStop(uint32_t ticks_at_queue_end, bool count_up) {
+  uint32_t performed_ramp_up_steps = upm_to_u32(upm_divide(
+      _ro.upm_inv_accel2, upm_square(upm_from(ticks_at_queue_end))));
+  // at least one step to reach the stop state
+  performed_ramp_up_steps = max(performed_ramp_up_steps, 1);
+  noInterrupts();
+  _ro.force_stop = true;
+  _rw.keep_running = false;
+  _rw.performed_ramp_up_steps = performed_ramp_up_steps;
+  _rw.ramp_state = RAMP_STATE_DECELERATE_TO_STOP |
+                   (count_up ? RAMP_MOVE_UP : RAMP_MOVE_DOWN);
+  interrupts();
+}
+int8_t RampGenerator::setPositionLimits(int32_t min_pos, int32_t max_pos) {
+  if (min_pos > max_pos) {
+    return MOVE_ERR_POSITION_LIMIT;
+  }
+  noInterrupts();
+  _ro.min_pos = min_pos;
+  _ro.max_pos = max_pos;
+  _ro.limits = true;
+  interrupts();
+  return MOVE_OK;
+}
+void RampGenerator::clearPositionLimits() { _ro.limits = false; }
 int8_t RampGenerator::moveTo(int32_t position, int32_t pos_at_queue_end,
                              uint32_t ticks_at_queue_end) {
   int32_t curr_pos;
@@ -217,6 +262,35 @@ static bool _getNextCommand(const struct ramp_ro_s *ro, struct ramp_rw_s *rw,
     next_state |= move_state;
   }
 
+  // The software limit in the direction of the movement ends each ramp at
+  // the latest. A deceleration, which is too long, is shortened to stop
+  // there. A limit behind the stepper does not apply.
+  if (ro->limits) {
+    int32_t limit = count_up ? ro->max_pos : ro->min_pos;
+    bool ahead = count_up ? (position_at_queue_end < limit)
+                          : (position_at_queue_end > limit);
+    if (!ahead) {
+      rw->performed_ramp_up_steps = 0;
+      if (!ro->force_stop && (count_up != need_count_up)) {
+        // The pending reversal starts at the limit
+        rw->ramp_state = RAMP_STATE_ACCELERATE | (move_state ^ RAMP_MOVE_MASK);
+        return _getNextCommand(ro, rw, ticks_at_queue_end,
+                               position_at_queue_end, command);
+      }
+      rw->ramp_state = RAMP_STATE_IDLE;
+      return false;
+    }
+    // the limit is ahead, so the unsigned difference does not overflow
+    uint32_t d = count_up ? (uint32_t)limit - (uint32_t)position_at_queue_end
+                          : (uint32_t)position_at_queue_end - (uint32_t)limit;
+    if (remaining_steps > d) {
+      remaining_steps = d;
+      if (remaining_steps <= rw->performed_ramp_up_steps) {
+        next_state = RAMP_STATE_DECELERATE_TO_STOP | move_state;
+      }
+    }
+  }
+
   // Forward planning of 1ms or more on slow speed.
   uint32_t planning_steps = max((TICKS_PER_S / 1000) / ticks_at_queue_end, 1);
   uint32_t next_ticks;
@@ -265,13 +339,16 @@ static bool _getNextCommand(const struct ramp_ro_s *ro, struct ramp_rw_s *rw,
     upm_float upm_d_ticks_new;
     case RAMP_STATE_COAST:
       next_ticks = ro->min_travel_ticks;
+      // Coasting needs no speed updates, so plan for the queue fill time of
+      // 10ms. This reduces the number of commands at high speed.
+      planning_steps = max((TICKS_PER_S / 100) / next_ticks, 1);
       // do not overshoot ramp down start
       planning_steps =
           min(planning_steps, remaining_steps - rw->performed_ramp_up_steps);
       break;
     case RAMP_STATE_ACCELERATE:
       upm_rem_steps = upm_from(rw->performed_ramp_up_steps + planning_steps);
-      upm_d_ticks_new = upm_sqrt(upm_divide(ro->upm_inv_accel2, upm_rem_steps));
+      upm_d_ticks_new = upm_sqrt_div(ro->upm_inv_accel2, upm_rem_steps);
 
       d_ticks_new = upm_to_u32(upm_d_ticks_new);
 
@@ -292,15 +369,18 @@ static bool _getNextCommand(const struct ramp_ro_s *ro, struct ramp_rw_s *rw,
       break;
     case RAMP_STATE_DECELERATE:
       upm_rem_steps = upm_from(rw->performed_ramp_up_steps + planning_steps);
-      upm_d_ticks_new = upm_sqrt(upm_divide(ro->upm_inv_accel2, upm_rem_steps));
+      upm_d_ticks_new = upm_sqrt_div(ro->upm_inv_accel2, upm_rem_steps);
 
       d_ticks_new = upm_to_u32(upm_d_ticks_new);
 
       // avoid undershoot
       next_ticks = min(d_ticks_new, ro->min_travel_ticks);
 
-      // CLIPPING: avoid reduction
-      next_ticks = max(next_ticks, curr_ticks);
+      // CLIPPING: avoid reduction. After a queue underrun, the deceleration
+      // continues from the planned speed.
+      if (curr_ticks != TICKS_FOR_STOPPED_MOTOR) {
+        next_ticks = max(next_ticks, curr_ticks);
+      }
 
 #ifdef TEST
       printf("decelerate ticks => %d  during %d steps (d_ticks_new = %u)",
@@ -309,16 +389,24 @@ static bool _getNextCommand(const struct ramp_ro_s *ro, struct ramp_rw_s *rw,
 #endif
       break;
     case RAMP_STATE_DECELERATE_TO_STOP:
-      upm_rem_steps = upm_from(remaining_steps - planning_steps);
-      upm_d_ticks_new = upm_sqrt(upm_divide(ro->upm_inv_accel2, upm_rem_steps));
+      if (remaining_steps == planning_steps) {
+        // upm_float cannot represent 0 => use 0.5 steps for the last step
+        upm_rem_steps = UPM_HALF;
+      } else {
+        upm_rem_steps = upm_from(remaining_steps - planning_steps);
+      }
+      upm_d_ticks_new = upm_sqrt_div(ro->upm_inv_accel2, upm_rem_steps);
 
       d_ticks_new = upm_to_u32(upm_d_ticks_new);
 
       // avoid undershoot
       next_ticks = max(d_ticks_new, ro->min_travel_ticks);
 
-      // CLIPPING: avoid reduction
-      next_ticks = max(next_ticks, curr_ticks);
+      // CLIPPING: avoid reduction. After a queue underrun, the deceleration
+      // continues from the planned speed.
+      if (curr_ticks != TICKS_FOR_STOPPED_MOTOR) {
+        next_ticks = max(next_ticks, curr_ticks);
+      }
 #ifdef TEST
       printf("decelerate ticks => %d  during %d steps (d_ticks_new = %u)\n",
              next_ticks, planning_steps, d_ticks_new);
@@ -336,6 +424,7 @@ static bool _getNextCommand(const struct ramp_ro_s *ro, struct ramp_rw_s *rw,
   next_ticks = min(next_ticks, ABSOLUTE_MAX_TICKS);
 
   // Number of steps to execute with limitation to min 1 and max remaining steps
+  planning_steps = min(planning_steps, MAX_STEPS_PER_COMMAND);
   uint16_t steps = planning_steps;
 #ifdef TEST
   printf(
@@ -345,7 +434,6 @@ static bool _getNextCommand(const struct ramp_ro_s *ro, struct ramp_rw_s *rw,
 #endif
   steps = max(steps, 1);
   steps = min(steps, abs(remaining_steps));
-  steps = min(127, steps);
 
   switch (next_state & RAMP_STATE_MASK) {
     case RAMP_STATE_COAST:
@@ -368,6 +456,8 @@ static bool _getNextCommand(const struct ramp_ro_s *ro, struct ramp_rw_s *rw,
   command->count_up = count_up;
 
   if (steps == abs(remaining_steps)) {
+    // A deceleration shortened by a limit ends with speed left
+    rw->performed_ramp_up_steps = 0;
     if (count_up != need_count_up) {
       rw->ramp_state = RAMP_STATE_ACCELERATE | (move_state ^ RAMP_MOVE_MASK);
 #ifdef TEST
@@ -1,25 +1,56 @@
 #ifndef RAMP_GENERATOR_H
 #define RAMP_GENERATOR_H
 
+// Number of software timer channels, which follow the hardware channels.
+// These share one timer interrupt (see StepperISR_soft.cpp). On avr these
+// are opt-in, because timer 2 is used.
+#ifndef FAS_SOFT_CHANNELS
 #if defined(TEST)
-#define MAX_STEPPER 2
+#define FAS_SOFT_CHANNELS 2
+#elif defined(ARDUINO_ARCH_ESP32)
+#define FAS_SOFT_CHANNELS 4
+#else
+#define FAS_SOFT_CHANNELS 0
+#endif
+#endif
+
+#if defined(TEST)
+#define MAX_HW_STEPPER 2
 #define TICKS_PER_S 16000000L
 #elif defined(ARDUINO_ARCH_AVR)
-#define MAX_STEPPER 2
+#define MAX_HW_STEPPER 2
 #define TICKS_PER_S F_CPU
 #elif defined(ARDUINO_ARCH_ESP32)
-#define MAX_STEPPER 6
+#define MAX_HW_STEPPER 6
 #define TICKS_PER_S 16000000L
 #else
-#define MAX_STEPPER 6
+#define MAX_HW_STEPPER 6
 #define TICKS_PER_S 16000000L
 #endif
 
+// Number of hardware channels in use. With less than MAX_HW_STEPPER the
+// unused steppers and queues are not allocated, e.g. a single axis on avr
+// with -DFAS_HW_CHANNELS=1 has only channel A (pin 9).
+#ifndef FAS_HW_CHANNELS
+#define FAS_HW_CHANNELS MAX_HW_STEPPER
+#endif
+#if (FAS_HW_CHANNELS < 1) || (FAS_HW_CHANNELS > MAX_HW_STEPPER)
+#error "FAS_HW_CHANNELS must be 1..MAX_HW_STEPPER"
+#endif
+#define MAX_STEPPER (FAS_HW_CHANNELS + FAS_SOFT_CHANNELS)
+
+// The linux timer thread serves all queues alike
+#if (FAS_SOFT_CHANNELS > 0) && !defined(FAS_LINUX)
+#define FAS_SOFT_TIMER 1
+#else
+#define FAS_SOFT_TIMER 0
+#endif
+
 class FastAccelStepper;
 
 struct ramp_command_s {
   uint32_t ticks;
-  uint8_t steps;
+  uint16_t steps;
   bool count_up;
 };
 
@@ -49,6 +80,10 @@ struct ramp_ro_s {
   uint32_t min_travel_ticks;
   upm_float upm_inv_accel2;
   bool force_stop;
+  // software limits of the position, if limits is set
+  bool limits;
+  int32_t min_pos;
+  int32_t max_pos;
 };
 struct ramp_rw_s {
   bool keep_running;
@@ -84,6 +119,9 @@ class RampGenerator {
   }
   void setSpeed(uint32_t min_step_us);
   void setAcceleration(uint32_t accel);
+  // Speed and acceleration as stored in _config. This is used by
+  // FastAccelStepperEngine::moveSynchronized() to scale the axes.
+  void setConfig(uint32_t min_travel_ticks, upm_float upm_inv_accel2);
 
  private:
   void _applySpeedAcceleration(uint32_t ticks_at_queue_end, int32_t target_pos);
@@ -95,6 +133,18 @@ class RampGenerator {
   int8_t moveTo(int32_t position, int32_t position_at_queue_end,
                 uint32_t ticks_at_queue_end);
   void initiate_stop() { _ro.force_stop = true; }
+  int8_t setPositionLimits(int32_t min_pos, int32_t max_pos);
+  void clearPositionLimits();
+  bool isOutsideLimits(int32_t position) {
+    return _ro.limits &&
+           ((position < _ro.min_pos) || (position > _ro.max_pos));
+  }
+  // true, if the move from..to ends beyond the limit in its direction
+  bool isBeyondLimit(int32_t from, int32_t to) {
+    return _ro.limits && (((to > from) && (to > _ro.max_pos)) ||
+                          ((to < from) && (to < _ro.min_pos)));
+  }
+  void restartStop(uint32_t ticks_at_queue_end, bool count_up);
   bool isStopping() { return _ro.force_stop && isRampGeneratorActive(); }
   bool isRampGeneratorActive();
   void abort();
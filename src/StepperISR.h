@@ -12,24 +12,37 @@
 
 // Here are the global variables to interface with the interrupts
 
-// CURRENT QUEUE IMPLEMENTATION WASTES ONE UNUSED ENTRY => BUG/TODO
-
-#if defined(TEST)
-#define NUM_QUEUES 2
-#define fas_queue_A fas_queue[0]
-#define fas_queue_B fas_queue[1]
-#define QUEUE_LEN 16
-#elif defined(ARDUINO_ARCH_AVR)
-#define NUM_QUEUES 2
+// QUEUE_LEN is the queue depth in units used by stepperConnectToPin(step_pin)
+// and can be set by -DQUEUE_LEN=n (a power of two from 4 to 128). Other
+// depths can be provided per stepper by StepperQueueBuffer.
+// The queues of the hardware channels come first, followed by the software
+// timer channels.
+#if defined(TEST) || defined(ARDUINO_ARCH_AVR)
 #define fas_queue_A fas_queue[0]
 #define fas_queue_B fas_queue[1]
-#define QUEUE_LEN 16
-#elif defined(ARDUINO_ARCH_ESP32)
-#define NUM_QUEUES 6
+#endif
+#ifndef QUEUE_LEN
+#if defined(TEST) || defined(ARDUINO_ARCH_AVR)
 #define QUEUE_LEN 32
 #else
-#define NUM_QUEUES 6
-#define QUEUE_LEN 32
+#define QUEUE_LEN 64
+#endif
+#endif
+#define NUM_HW_QUEUES FAS_HW_CHANNELS
+#define NUM_QUEUES MAX_STEPPER
+
+// High time of the step pulse in ticks, if not set by setStepPulseTicks().
+// On avr 0 means the pulse is ended as soon as the interrupt is entered.
+// The software timer channels end the pulse by busy waiting in the interrupt.
+#if defined(ARDUINO_ARCH_ESP32)
+#define DEFAULT_STEP_PULSE_TICKS 160
+#define DEFAULT_SOFT_STEP_PULSE_TICKS 160
+#elif defined(ARDUINO_ARCH_AVR)
+#define DEFAULT_STEP_PULSE_TICKS 0
+#define DEFAULT_SOFT_STEP_PULSE_TICKS (TICKS_PER_S / 500000)
+#else
+#define DEFAULT_STEP_PULSE_TICKS 0
+#define DEFAULT_SOFT_STEP_PULSE_TICKS 0
 #endif
 
 // These variables control the stepper timing behaviour
@@ -41,13 +54,44 @@
 
 #define TICKS_FOR_STOPPED_MOTOR 0xffffffff
 
+// The command queue is a single producer/single consumer ring buffer:
+// next_write_idx is only written by the producer (addQueueEntry) and
+// read_idx only by the consumer (stepper ISR). Both indices are single bytes
+// and as such read and written atomically without disabling interrupts.
+// These macros ensure, that an entry is completely written before
+// next_write_idx is published, and read only after next_write_idx is loaded.
+#if defined(ARDUINO_ARCH_AVR)
+// single core: a compiler barrier is sufficient
+#define fas_memory_fence() __asm__ __volatile__("" ::: "memory")
+#define fas_idx_load(x)                    \
+  ({                                       \
+    uint8_t _v = *(volatile uint8_t*)&(x); \
+    fas_memory_fence();                    \
+    _v;                                    \
+  })
+#define fas_idx_store(x, v)         \
+  {                                 \
+    fas_memory_fence();             \
+    *(volatile uint8_t*)&(x) = (v); \
+  }
+#else
+// esp32 ISR and stepper task may run on different cores
+#define fas_memory_fence() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#define fas_idx_load(x) __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define fas_idx_store(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#endif
+
 #if defined(ARDUINO_ARCH_ESP32)
 #include <driver/mcpwm.h>
 #include <driver/pcnt.h>
+#include <driver/timer.h>
+#include <esp_timer.h>
+#include <soc/gpio_struct.h>
 #include <soc/mcpwm_reg.h>
 #include <soc/mcpwm_struct.h>
 #include <soc/pcnt_reg.h>
 #include <soc/pcnt_struct.h>
+#include <soc/timer_group_struct.h>
 struct mapping_s {
   mcpwm_unit_t mcpwm_unit;
   uint8_t timer;
@@ -59,60 +103,413 @@ struct mapping_s {
 };
 #endif
 
-struct queue_entry {
-  uint8_t steps;      // coding is bit7..1 is nr of steps and bit 0 is direction
-  uint8_t n_periods;  // number of PERIOD_TICKS delays
-  uint16_t period;    // remaining period time in addition to
-                      // n_periods*PERIOD_TICKS delays
-};
 class StepperQueue {
  public:
-  struct queue_entry entry[QUEUE_LEN];
+  // The indices are free running and masked with queue_len_mask on access.
+  // They count units of the buffer and one entry takes 1 to 3 units
+  // (see FastAccelStepper.h).
+  union queue_unit* entry;
+  uint8_t queue_len_mask;
   uint8_t read_idx;  // ISR stops if readptr == next_writeptr
   uint8_t next_write_idx;
   uint8_t dirPin;
   bool dirHighCountsUp;
+  // dirPin resolved by setDirPin(), so the ISR can toggle without pin lookup.
+  // dirPinMask is 0 without direction pin.
+#if defined(ARDUINO_ARCH_AVR)
+  // Writing the mask to the PINx register toggles the output
+  volatile uint8_t* dirPinToggleReg;
+  uint8_t dirPinMask;
+#elif defined(ARDUINO_ARCH_ESP32)
+  volatile uint32_t* dirPinOutReg;
+  volatile uint32_t* dirPinSetReg;
+  volatile uint32_t* dirPinClearReg;
+  uint32_t dirPinMask;
+#else
+  // The host has no pin, so the edges are recorded
+  uint8_t dirPinMask;
+  bool dirPinLevel;
+  uint16_t dirPinEdges;
+#endif
   volatile bool isRunning;
 #if defined(ARDUINO_ARCH_ESP32)
   const struct mapping_s* mapping;
   // These two variables are for the mcpwm interrupt
   uint8_t current_period;
   uint8_t current_n_periods;
+  // Steps of the entry in progress, which are counted by the pcnt unit.
+  // 0 while stopped.
+  uint16_t current_steps;
+  // Performs a delayed start of the queue
+  esp_timer_handle_t start_timer;
 #endif
 #if defined(ARDUINO_ARCH_AVR)
   bool isChannelA;
   // This is used in the timer compare unit as extension of the 16 timer
   uint8_t skip;
+  uint8_t n_periods;
+  // High byte of the remaining steps of the entry in progress
+  uint8_t steps_hi;
+  // Number of compare matches to wait before the first entry is started.
+  // With hold_half the last one moves the compare value by half a wrap.
+  uint8_t hold_off;
+  bool hold_half;
+  // The compare unit clears the step pin at the next match
+  bool pulse_high;
 #endif
+#if defined(TEST)
+  // Virtual time, at which the queue has been started
+  uint32_t started_at_ticks;
+#endif
+#if (FAS_SOFT_TIMER == 1)
+  // Software timer channel, see StepperISR_soft.cpp. The entries are
+  // consumed like on the hardware channels of the architecture.
+  bool isSoft;
+  uint8_t soft_heap_pos;      // SOFT_NOT_SCHEDULED, if not in the timer heap
+  uint16_t soft_steps_left;   // of the entry in progress
+  uint32_t soft_entry_ticks;  // of the entry in progress
+  uint32_t soft_next_ticks;   // time of the next step or entry start
+#if defined(ARDUINO_ARCH_AVR)
+  volatile uint8_t* stepPinOutReg;
+  uint8_t stepPinMask;
+#elif defined(ARDUINO_ARCH_ESP32)
+  volatile uint32_t* stepPinSetReg;
+  volatile uint32_t* stepPinClearReg;
+  uint32_t stepPinMask;
+#else
+  // The host has no pin, so the pulses are counted
+  uint16_t stepPinPulses;
+#endif
+#endif
+#if defined(FAS_LINUX)
+  uint8_t step_pin;
+  // These are used by the timer thread and are changed under noInterrupts()
+  bool timer_active;
+  uint16_t steps_left;   // of the entry in progress
+  uint32_t entry_ticks;  // of the entry in progress
+  uint64_t next_event;   // absolute time in ticks
+#endif
+  // High time of the step pulse and minimum time from direction change to
+  // the next step, both in ticks
+  uint16_t step_pulse_ticks;
+  uint16_t dir_setup_ticks;
+  // period of the last started entry. Compact entries are relative to this
   uint16_t period;
+#if !defined(ARDUINO_ARCH_AVR)
+  // n_periods of the last started entry, which is the one in progress
+  uint8_t started_n_periods;
+#endif
 #if (TEST_CREATE_QUEUE_CHECKSUM == 1)
   uint8_t checksum;
 #endif
 
   bool dir_at_queue_end;
+  bool period_at_queue_end_valid;  // false => next entry uses full form
+  uint16_t period_at_queue_end;
   int32_t pos_at_queue_end;     // in steps
   uint32_t ticks_at_queue_end;  // in timer ticks, 0 on stopped stepper
 
+  // If valid, the next startQueue() holds off the first entry till
+  // fas_get_ticks() reaches start_at_ticks
+  bool start_at_valid;
+  uint32_t start_at_ticks;
+  // An armed queue of a stepper group is not started by addQueueEntry()
+  bool group_armed;
+  // The ISR requests a refill, if less than this number of units is left in
+  // the queue after an entry has been taken. 0 disables the request.
+  uint8_t low_watermark;
+
+  // Position events: The producer splits the commands, so that the step to
+  // an armed event is the last one of an entry with QUEUE_CODE_EVENT, and
+  // appends the event to event_ring. The ISR fires the events of the ring in
+  // this order. Consumers, which release an entry on its start, keep the flag
+  // of the entry in progress in entry_event.
+  struct position_event_s events[POSITION_EVENTS];
+  uint8_t event_ring[POSITION_EVENTS];
+  uint8_t event_wr;
+  uint8_t event_rd;
+  volatile bool entry_event;
+
   void init(uint8_t queue_num, uint8_t step_pin);
+  void setStepPulseTicks(uint16_t ticks);
+  // Pin is set to output and high level before
+  void setDirPin(uint8_t dir_pin) {
+    dirPin = dir_pin;
+#if defined(ARDUINO_ARCH_AVR)
+    dirPinToggleReg = portInputRegister(digitalPinToPort(dir_pin));
+    dirPinMask = digitalPinToBitMask(dir_pin);
+#elif defined(ARDUINO_ARCH_ESP32)
+    if (dir_pin < 32) {
+      dirPinOutReg = &GPIO.out;
+      dirPinSetReg = &GPIO.out_w1ts;
+      dirPinClearReg = &GPIO.out_w1tc;
+      dirPinMask = 1UL << dir_pin;
+    } else {
+      dirPinOutReg = &GPIO.out1.val;
+      dirPinSetReg = &GPIO.out1_w1ts.val;
+      dirPinClearReg = &GPIO.out1_w1tc.val;
+      dirPinMask = 1UL << (dir_pin - 32);
+    }
+#else
+    dirPinMask = 1;
+    dirPinLevel = true;
+    dirPinEdges = 0;
+#endif
+  }
+  // Called from the ISR for an entry with toggle_dir set
+  inline void toggleDirPin() {
+    if (dirPinMask == 0) {
+      return;
+    }
+#if defined(ARDUINO_ARCH_AVR)
+    *dirPinToggleReg = dirPinMask;
+#elif defined(ARDUINO_ARCH_ESP32)
+    if (*dirPinOutReg & dirPinMask) {
+      *dirPinClearReg = dirPinMask;
+    } else {
+      *dirPinSetReg = dirPinMask;
+    }
+#else
+    dirPinLevel = !dirPinLevel;
+    dirPinEdges++;
+#endif
+  }
+#if (FAS_SOFT_TIMER == 1)
+  void _softInit(uint8_t step_pin);
+  void _softStartQueue();
+  void _softForceStop();
+  void setSoftStepPin(uint8_t step_pin) {
+#if defined(ARDUINO_ARCH_AVR)
+    stepPinOutReg = portOutputRegister(digitalPinToPort(step_pin));
+    stepPinMask = digitalPinToBitMask(step_pin);
+#elif defined(ARDUINO_ARCH_ESP32)
+    if (step_pin < 32) {
+      stepPinSetReg = &GPIO.out_w1ts;
+      stepPinClearReg = &GPIO.out_w1tc;
+      stepPinMask = 1UL << step_pin;
+    } else {
+      stepPinSetReg = &GPIO.out1_w1ts.val;
+      stepPinClearReg = &GPIO.out1_w1tc.val;
+      stepPinMask = 1UL << (step_pin - 32);
+    }
+#else
+    stepPinPulses = 0;
+#endif
+  }
+  // Called from the software timer interrupt
+  inline void softStepPin(bool high) {
+#if defined(ARDUINO_ARCH_AVR)
+    if (high) {
+      *stepPinOutReg |= stepPinMask;
+    } else {
+      *stepPinOutReg &= ~stepPinMask;
+    }
+#elif defined(ARDUINO_ARCH_ESP32)
+    if (high) {
+      *stepPinSetReg = stepPinMask;
+    } else {
+      *stepPinClearReg = stepPinMask;
+    }
+#else
+    if (high) {
+      stepPinPulses++;
+    }
+#endif
+  }
+#endif
+  // The buffer must be attached before init() and queue_len must be a power
+  // of two in the range 4..128
+  void attachBuffer(union queue_unit* queue_unit, uint8_t queue_len) {
+    entry = queue_unit;
+    queue_len_mask = queue_len - 1;
+    low_watermark = QUEUE_ENTRY_MAX_UNITS + 1;
+  }
+  // Called by the ISR with the read index after taking an entry
+  inline bool isBelowLowWatermark(uint8_t rp) {
+    uint8_t wp = fas_idx_load(next_write_idx);
+    return (uint8_t)(wp - rp) < low_watermark;
+  }
   inline bool isQueueFull() {
-    noInterrupts();
-    uint8_t rp = read_idx;
+    uint8_t rp = fas_idx_load(read_idx);
     uint8_t wp = next_write_idx;
-    interrupts();
-    rp += QUEUE_LEN;
-    return (wp == rp);
+    // there must be space for the largest entry
+    return ((uint8_t)(wp - rp) > queue_len_mask - QUEUE_ENTRY_MAX_UNITS + 1);
+  }
+  // true, if the given number of units can be added
+  inline bool hasSpaceFor(uint8_t units) {
+    uint8_t rp = fas_idx_load(read_idx);
+    uint8_t wp = next_write_idx;
+    return ((uint8_t)(wp - rp) + units <= queue_len_mask + 1);
+  }
+  // true, if n commands can be added. Each may be split for the direction
+  // setup time (counted in n) and at each armed position event.
+  bool hasSpaceForCommands(uint8_t n) {
+    uint8_t units = n * QUEUE_ENTRY_MAX_UNITS;
+    for (uint8_t i = 0; i < POSITION_EVENTS; i++) {
+      if (events[i].state == EVENT_ARMED) {
+        units += QUEUE_ENTRY_MAX_UNITS;
+      }
+    }
+    // A queue too short for this is filled up to the end. Then an entry
+    // may be rejected with AQE_FULL.
+    return hasSpaceFor(min(units, (uint8_t)(queue_len_mask + 1)));
   }
   inline bool isQueueEmpty() {
-    noInterrupts();
-    bool res = (next_write_idx == read_idx);
-    interrupts();
+    bool res = (next_write_idx == fas_idx_load(read_idx));
     inject_fill_interrupt(0);
     return res;
   }
-  int addQueueEntry(uint32_t ticks, uint8_t steps, bool dir) {
-    if (isQueueFull()) {
+  // Decodes the entry at index idx. The period of a compact entry is relative
+  // to the period of the previously started entry, so this updates period.
+  // Returns the number of units of the entry.
+  inline __attribute__((always_inline)) uint8_t decodeEntry(
+      uint8_t idx, struct queue_entry* e) {
+    union queue_unit* u = &entry[idx & queue_len_mask];
+    uint8_t code = u->cmd.code;
+    e->steps = u->cmd.steps;
+    if ((code & QUEUE_CODE_FULL) == 0) {
+      // sign extend 7 bit delta
+      period += (int8_t)(code << 1) >> 1;
+      e->period = period;
+      e->n_periods = 0;
+      e->toggle_dir = false;
+      e->event = false;
+#if !defined(ARDUINO_ARCH_AVR)
+      started_n_periods = 0;
+#endif
+      return 1;
+    }
+    e->toggle_dir = (code & QUEUE_CODE_TOGGLE_DIR) != 0;
+    e->event = (code & QUEUE_CODE_EVENT) != 0;
+    period = entry[(idx + 1) & queue_len_mask].period;
+    e->period = period;
+    if (code & QUEUE_CODE_EXTENDED) {
+      union queue_unit* ext = &entry[(idx + 2) & queue_len_mask];
+      e->n_periods = ext->ext.n_periods;
+      e->steps |= (uint16_t)ext->ext.steps_hi << 8;
+#if !defined(ARDUINO_ARCH_AVR)
+      started_n_periods = e->n_periods;
+#endif
+      return 3;
+    }
+    e->n_periods = 0;
+#if !defined(ARDUINO_ARCH_AVR)
+    started_n_periods = 0;
+#endif
+    return 2;
+  }
+  int addQueueEntry(uint32_t ticks, uint16_t steps, bool dir) {
+    uint8_t wp = next_write_idx;
+    uint8_t new_wp = _encodeCommand(fas_idx_load(read_idx), wp, ticks, steps,
+                                    dir);
+    if (new_wp == wp) {
       return AQE_FULL;
     }
+    _publish(new_wp);
+    return AQE_OK;
+  }
+  // Adds up to n commands with one update of next_write_idx. The commands
+  // must have been validated by the caller.
+  // Returns the number of added commands, which is less than n on full queue.
+  uint8_t addQueueEntries(const struct stepper_command_s* cmd, uint8_t n) {
+    uint8_t rp = fas_idx_load(read_idx);
+    uint8_t wp = next_write_idx;
+    uint8_t added = 0;
+    while (added < n) {
+      uint8_t new_wp =
+          _encodeCommand(rp, wp, cmd->ticks, cmd->steps, cmd->dir_high);
+      if (new_wp == wp) {
+        break;
+      }
+      wp = new_wp;
+      cmd++;
+      added++;
+    }
+    if (added > 0) {
+      _publish(wp);
+    }
+    return added;
+  }
+  // Writes one command at index wp without publishing it. After a direction
+  // change the first step is delayed to dir_setup_ticks. The direction pin is
+  // toggled by the ISR at the start of this period, so dir_setup_ticks has to
+  // include the ISR latency. For this a second entry may be needed. Each
+  // armed position event within the steps needs another entry.
+  // Returns the index after the command or wp, if the queue is full.
+  uint8_t _encodeCommand(uint8_t rp, uint8_t wp, uint32_t ticks,
+                         uint16_t steps, bool dir) {
+    bool setup = (dir != dir_at_queue_end) && (ticks < dir_setup_ticks);
+    uint8_t units = QUEUE_ENTRY_MAX_UNITS;
+    if (setup && (steps > 1)) {
+      units += QUEUE_ENTRY_MAX_UNITS;
+    }
+    units += QUEUE_ENTRY_MAX_UNITS * _eventsWithin(steps, dir);
+    // there must be space for the largest entries
+    if ((uint8_t)(wp - rp) > queue_len_mask - units + 1) {
+      return wp;
+    }
+    if (setup) {
+      wp = _encodeSteps(wp, dir_setup_ticks, 1, dir);
+      if (--steps == 0) {
+        return wp;
+      }
+    }
+    return _encodeSteps(wp, ticks, steps, dir);
+  }
+  // Returns the distance of the armed event to the queue end in the
+  // direction dir or 0, if it is behind or at the queue end
+  uint32_t _eventDistance(uint8_t i, bool dir) {
+    if (events[i].state != EVENT_ARMED) {
+      return 0;
+    }
+    int32_t d = events[i].position - pos_at_queue_end;
+    if (dir != dirHighCountsUp) {
+      d = -d;
+    }
+    return (d > 0) ? d : 0;
+  }
+  uint8_t _eventsWithin(uint16_t steps, bool dir) {
+    uint8_t n = 0;
+    for (uint8_t i = 0; i < POSITION_EVENTS; i++) {
+      uint32_t d = _eventDistance(i, dir);
+      if ((d > 0) && (d <= steps)) {
+        n++;
+      }
+    }
+    return n;
+  }
+  // Writes the steps as entries, which end at the armed events
+  uint8_t _encodeSteps(uint8_t wp, uint32_t ticks, uint16_t steps, bool dir) {
+    while (true) {
+      uint8_t next = POSITION_EVENTS;
+      uint16_t n = steps;
+      for (uint8_t i = 0; i < POSITION_EVENTS; i++) {
+        uint32_t d = _eventDistance(i, dir);
+        if ((d > 0) && (d <= n)) {
+          next = i;
+          n = d;
+        }
+      }
+      if (next == POSITION_EVENTS) {
+        return _encodeEntry(wp, ticks, steps, dir, false);
+      }
+      events[next].state = EVENT_QUEUED;
+      event_ring[event_wr & (POSITION_EVENTS - 1)] = next;
+      event_wr++;
+      wp = _encodeEntry(wp, ticks, n, dir, true);
+      steps -= n;
+      if (steps == 0) {
+        return wp;
+      }
+    }
+  }
+  // Writes the entry at index wp without publishing it.
+  // Returns the index after the entry.
+  uint8_t _encodeEntry(uint8_t wp, uint32_t ticks, uint16_t steps, bool dir,
+                       bool event) {
+#if (TEST_CREATE_QUEUE_CHECKSUM == 1)
+    uint8_t start_wp = wp;
+#endif
     // For ticks > 65536, there will be several fixed delays with PERIOD_TICKS
     // inserted. The formula behind is:
     //		ticks = n_periods * PERIOD_TICKS + period
@@ -146,83 +543,362 @@ class StepperQueue {
     }
     uint16_t period = period_ticks;
 
-    uint8_t wp = next_write_idx;
-    struct queue_entry* e = &entry[wp & QUEUE_LEN_MASK];
+    union queue_unit* u = &entry[wp & queue_len_mask];
     pos_at_queue_end += (dir == dirHighCountsUp) ? steps : -steps;
     ticks_at_queue_end = ticks;
-    steps <<= 1;
-    e->period = period;
-    e->n_periods = n_periods;
+    u->cmd.steps = steps & 0xff;
+    uint8_t steps_hi = steps >> 8;
     // check for dir pin value change
-    e->steps = (dir != dir_at_queue_end) ? steps | 0x01 : steps;
+    bool toggle_dir = (dir != dir_at_queue_end);
     dir_at_queue_end = dir;
+    int16_t delta = period - period_at_queue_end;
+    if (!toggle_dir && !event && (n_periods == 0) && (steps_hi == 0) &&
+        period_at_queue_end_valid && (delta >= -64) && (delta <= 63)) {
+      // compact form: just the delta to the previous period
+      u->cmd.code = delta & 0x7f;
+      wp += 1;
+    } else {
+      uint8_t code = QUEUE_CODE_FULL;
+      if (toggle_dir) {
+        code |= QUEUE_CODE_TOGGLE_DIR;
+      }
+      if (event) {
+        code |= QUEUE_CODE_EVENT;
+      }
+      entry[(wp + 1) & queue_len_mask].period = period;
+      if ((n_periods > 0) || (steps_hi > 0)) {
+        code |= QUEUE_CODE_EXTENDED;
+        union queue_unit* ext = &entry[(wp + 2) & queue_len_mask];
+        ext->ext.n_periods = n_periods;
+        ext->ext.steps_hi = steps_hi;
+        wp += 3;
+      } else {
+        wp += 2;
+      }
+      u->cmd.code = code;
+    }
+    period_at_queue_end = period;
+    period_at_queue_end_valid = true;
 #if (TEST_CREATE_QUEUE_CHECKSUM == 1)
     {
       // checksum is in the struct and will updated here
-      unsigned char* x = (unsigned char*)e;
-      for (uint8_t i = 0; i < sizeof(struct queue_entry); i++) {
-        if (checksum & 0x80) {
-          checksum <<= 1;
-          checksum ^= 0xde;
-        } else {
-          checksum <<= 1;
+      for (uint8_t idx = start_wp; idx != wp; idx++) {
+        unsigned char* x = (unsigned char*)&entry[idx & queue_len_mask];
+        for (uint8_t i = 0; i < sizeof(union queue_unit); i++) {
+          if (checksum & 0x80) {
+            checksum <<= 1;
+            checksum ^= 0xde;
+          } else {
+            checksum <<= 1;
+          }
+          checksum ^= *x++;
         }
-        checksum ^= *x++;
       }
     }
 #endif
-    wp++;
-    noInterrupts();
-    next_write_idx = wp;
+    return wp;
+  }
+  void _publish(uint8_t wp) {
+    fas_idx_store(next_write_idx, wp);
+    // The ISR clears isRunning on empty queue and checks the queue again
+    // afterwards. So either the ISR sees the new entry or isRunning reads
+    // false here.
+    fas_memory_fence();
     bool run = isRunning;
-    interrupts();
-    if (!run) {
+    if (!run && !group_armed) {
       startQueue();
     }
-    return AQE_OK;
   }
-  bool hasTicksInQueue(uint32_t min_ticks) {
+  // Removes all entries, which have not been started, from the queue tail.
+  // avr keeps the entry in progress at read_idx, so the queue is cut after
+  // it. esp32 and linux have released the entry in progress already and
+  // read_idx points to the next one, so the queue is cut at read_idx. Without
+  // steps in progress, the entry at read_idx may just be started and is kept.
+  // This must be called from the producer context. Returns true, if entries
+  // have been removed.
+  bool truncateTail() {
     noInterrupts();
-    uint8_t rp = read_idx;
+    uint8_t rp = fas_idx_load(read_idx);
     uint8_t wp = next_write_idx;
+    uint8_t code = entry[rp & queue_len_mask].cmd.code;
+    uint8_t new_wp = rp + QUEUE_ENTRY_UNITS(code);
+#if !defined(ARDUINO_ARCH_AVR)
+    bool released = (rp != wp) && (stepsInProgress() > 0);
+    // ticks of the released entry in progress
+    uint32_t released_ticks = PERIOD_TICKS;
+    released_ticks *= started_n_periods;
+    released_ticks += period;
+    if (released) {
+      new_wp = rp;
+    }
+#endif
+    bool truncate = (rp != wp) && (new_wp != wp);
+    if (truncate) {
+      fas_idx_store(next_write_idx, new_wp);
+    }
     interrupts();
+    if (!truncate) {
+      return false;
+    }
+
+    // The removed entries are still in the buffer to update the queue end
+    bool count_up = (dir_at_queue_end == dirHighCountsUp);
+    pos_at_queue_end =
+        positionBefore(new_wp, wp, pos_at_queue_end, count_up, 0);
+    for (uint8_t idx = new_wp; idx != wp;) {
+      uint8_t c = entry[idx & queue_len_mask].cmd.code;
+      if ((c & (QUEUE_CODE_FULL | QUEUE_CODE_TOGGLE_DIR)) ==
+          (QUEUE_CODE_FULL | QUEUE_CODE_TOGGLE_DIR)) {
+        dir_at_queue_end = !dir_at_queue_end;
+      }
+      if (QUEUE_ENTRY_HAS_EVENT(c)) {
+        // the events of the removed entries are the last ones in the ring
+        event_wr--;
+        events[event_ring[event_wr & (POSITION_EVENTS - 1)]].state =
+            EVENT_ARMED;
+      }
+      idx += QUEUE_ENTRY_UNITS(c);
+    }
+    uint32_t ticks;
+    if (code & QUEUE_CODE_FULL) {
+      ticks = entry[(rp + 1) & queue_len_mask].period;
+      if (code & QUEUE_CODE_EXTENDED) {
+        uint32_t fixed_ticks = PERIOD_TICKS;
+        fixed_ticks *= entry[(rp + 2) & queue_len_mask].ext.n_periods;
+        ticks += fixed_ticks;
+      }
+    } else {
+      ticks = period;
+#if !defined(ARDUINO_ARCH_AVR)
+      // see hasTicksInQueue()
+      ticks += (int8_t)(code << 1) >> 1;
+#endif
+    }
+#if !defined(ARDUINO_ARCH_AVR)
+    if (released) {
+      ticks = released_ticks;
+    }
+#endif
+    ticks_at_queue_end = ticks;
+    // ISR period and period_at_queue_end may differ now
+    period_at_queue_end_valid = false;
+    return true;
+  }
+  // Returns the position before the entries from rp to wp, if pos is the
+  // position after them and count_up the direction of the last entry.
+  // in_progress are the steps still to be done of an entry before rp, which
+  // has been released already (see stepsInProgress()).
+  int32_t positionBefore(uint8_t rp, uint8_t wp, int32_t pos, bool count_up,
+                         uint16_t in_progress) {
+    // The entries can be parsed only forward. So sum up the steps with the
+    // direction of the first entry and correct the sign with the direction
+    // at the end.
+    int32_t steps = 0;
+    bool sameDir = true;
+    bool first = true;
+    bool firstToggles = false;
+    while (rp != wp) {
+      union queue_unit* u = &entry[rp & queue_len_mask];
+      uint8_t code = u->cmd.code;
+      if ((code & (QUEUE_CODE_FULL | QUEUE_CODE_TOGGLE_DIR)) ==
+          (QUEUE_CODE_FULL | QUEUE_CODE_TOGGLE_DIR)) {
+        if (first) {
+          firstToggles = true;
+        } else {
+          sameDir = !sameDir;
+        }
+      }
+      first = false;
+      uint16_t entry_steps = u->cmd.steps;
+      if (QUEUE_ENTRY_UNITS(code) == 3) {
+        // The avr ISR counts down the steps of the entry in progress. Retry
+        // if the low byte changes while reading the high byte.
+        volatile uint8_t* lo = &u->cmd.steps;
+        volatile uint8_t* hi = &entry[(rp + 2) & queue_len_mask].ext.steps_hi;
+        uint8_t l;
+        do {
+          l = *lo;
+          entry_steps = ((uint16_t)*hi << 8) | l;
+        } while (l != *lo);
+      }
+      if (sameDir) {
+        steps += entry_steps;
+      } else {
+        steps -= entry_steps;
+      }
+      rp += QUEUE_ENTRY_UNITS(code);
+    }
+    // The entry in progress runs in the direction before the first entry
+    if (firstToggles) {
+      steps -= in_progress;
+    } else {
+      steps += in_progress;
+    }
+    if (sameDir == count_up) {
+      pos -= steps;
+    } else {
+      pos += steps;
+    }
+    return pos;
+  }
+  bool hasTicksInQueue(uint32_t min_ticks) {
+    return ticksInQueue(min_ticks) >= min_ticks;
+  }
+  // Sum of the ticks of the queued entries without the one in progress.
+  // The walk ends, as soon as max_ticks is reached, so max_ticks is the
+  // highest result.
+  uint32_t ticksInQueue(uint32_t max_ticks) {
+    uint32_t remaining = max_ticks;
+    // The ISR updates read_idx and period together. Retry on concurrent update
+    uint16_t p;
+    uint8_t rp;
+    do {
+      p = *(volatile uint16_t*)&period;
+      rp = fas_idx_load(read_idx);
+    } while (p != *(volatile uint16_t*)&period);
+    uint8_t wp = next_write_idx;
     if (wp == rp) {
       return 0;
     }
-    rp++;  // ignore currently processed entry
+    // ignore currently processed entry
+    union queue_unit* u = &entry[rp & queue_len_mask];
+    uint8_t code = u->cmd.code;
+    if (code & QUEUE_CODE_FULL) {
+      p = entry[(rp + 1) & queue_len_mask].period;
+    } else {
+#if !defined(ARDUINO_ARCH_AVR)
+      // avr has already applied the delta of the entry in progress. For esp32
+      // read_idx points to the entry after the one in progress.
+      p += (int8_t)(code << 1) >> 1;
+#endif
+    }
+    rp += QUEUE_ENTRY_UNITS(code);
     while (wp != rp) {
-      struct queue_entry* e = &entry[rp & QUEUE_LEN_MASK];
-      uint8_t steps = e->steps >> 1;
-      uint32_t tmp = e->period;
+      u = &entry[rp & queue_len_mask];
+      code = u->cmd.code;
+      uint32_t steps = u->cmd.steps;
+      uint8_t n_periods = 0;
+      if (code & QUEUE_CODE_FULL) {
+        p = entry[(rp + 1) & queue_len_mask].period;
+        if (code & QUEUE_CODE_EXTENDED) {
+          union queue_unit* ext = &entry[(rp + 2) & queue_len_mask];
+          n_periods = ext->ext.n_periods;
+          steps |= (uint16_t)ext->ext.steps_hi << 8;
+        }
+      } else {
+        p += (int8_t)(code << 1) >> 1;
+      }
+      uint32_t tmp = p;
       tmp *= steps;
-      if (tmp >= min_ticks) {
-        return true;
+      if (tmp >= remaining) {
+        return max_ticks;
       }
-      min_ticks -= tmp;
-      tmp = e->n_periods;
+      remaining -= tmp;
+      tmp = n_periods;
       tmp *= steps;
+      if (tmp >= 65536) {
+        // would overflow and is anyway more than 65536 * PERIOD_TICKS
+        return max_ticks;
+      }
       tmp *= PERIOD_TICKS;
-      if (tmp >= min_ticks) {
-        return true;
+      if (tmp >= remaining) {
+        return max_ticks;
       }
-      min_ticks -= tmp;
-      rp++;
+      remaining -= tmp;
+      rp += QUEUE_ENTRY_UNITS(code);
+    }
+    return max_ticks - remaining;
+  }
+
+  // Called by the ISR after the last step of an entry with QUEUE_CODE_EVENT.
+  // Toggles the pin and latches the time. The caller calls the callback,
+  // e.g. after leaving a critical section.
+  inline __attribute__((always_inline)) struct position_event_s*
+  takePositionEvent(uint32_t ticks) {
+    struct position_event_s* ev =
+        &events[event_ring[event_rd & (POSITION_EVENTS - 1)]];
+    event_rd++;
+    if (ev->pin != PIN_UNDEFINED) {
+      ev->pin_high = !ev->pin_high;
+#if defined(ARDUINO_ARCH_AVR)
+      *ev->pin_toggle_reg = ev->pin_mask;
+#elif defined(ARDUINO_ARCH_ESP32)
+      *(ev->pin_high ? ev->pin_set_reg : ev->pin_clear_reg) = ev->pin_mask;
+#else
+      digitalWrite(ev->pin, ev->pin_high ? HIGH : LOW);
+#endif
+    }
+    ev->ticks = ticks;
+    ev->state = EVENT_FIRED;
+    return ev;
+  }
+  inline __attribute__((always_inline)) void firePositionEvent(
+      uint32_t ticks) {
+    struct position_event_s* ev = takePositionEvent(ticks);
+    if (ev->callback != NULL) {
+      ev->callback(ev->arg);
+    }
+  }
+  // The pin is set to output and low level before
+  void setEventPin(struct position_event_s* ev, uint8_t pin) {
+    ev->pin = pin;
+    ev->pin_high = false;
+    if (pin == PIN_UNDEFINED) {
+      return;
+    }
+#if defined(ARDUINO_ARCH_AVR)
+    ev->pin_toggle_reg = portInputRegister(digitalPinToPort(pin));
+    ev->pin_mask = digitalPinToBitMask(pin);
+#elif defined(ARDUINO_ARCH_ESP32)
+    if (pin < 32) {
+      ev->pin_set_reg = &GPIO.out_w1ts;
+      ev->pin_clear_reg = &GPIO.out_w1tc;
+      ev->pin_mask = 1UL << pin;
+    } else {
+      ev->pin_set_reg = &GPIO.out1_w1ts.val;
+      ev->pin_clear_reg = &GPIO.out1_w1tc.val;
+      ev->pin_mask = 1UL << (pin - 32);
+    }
+#endif
+  }
+  // The queue has been emptied by forceStop(), so the queued events are
+  // armed again
+  void _rearmQueuedEvents() {
+    while (event_rd != event_wr) {
+      events[event_ring[event_rd & (POSITION_EVENTS - 1)]].state = EVENT_ARMED;
+      event_rd++;
     }
-    return false;
+    entry_event = false;
   }
 
   // startQueue is called, if motor is not running.
   void startQueue();
   void forceStop();
+  // Steps still to be done of the entry in progress, if the consumer has
+  // released it already on its start (esp32 and linux). The avr ISR counts
+  // down the steps in the queue, so this is 0 there.
+  uint16_t stepsInProgress();
   void _initVars() {
     dirPin = PIN_UNDEFINED;
+    dirPinMask = 0;
+    step_pulse_ticks = DEFAULT_STEP_PULSE_TICKS;
+    dir_setup_ticks = 0;
     read_idx = 0;
     next_write_idx = 0;
     dir_at_queue_end = true;
     dirHighCountsUp = true;
+    period_at_queue_end_valid = false;
+    start_at_valid = false;
+    group_armed = false;
     pos_at_queue_end = 0;
     ticks_at_queue_end = TICKS_FOR_STOPPED_MOTOR;
     isRunning = false;
+    for (uint8_t i = 0; i < POSITION_EVENTS; i++) {
+      events[i].state = EVENT_FREE;
+    }
+    event_wr = 0;
+    event_rd = 0;
+    entry_event = false;
 #if (TEST_CREATE_QUEUE_CHECKSUM == 1)
     checksum = 0;
 #endif
@@ -230,3 +906,125 @@ class StepperQueue {
 };
 
 extern StepperQueue fas_queue[NUM_QUEUES];
+
+// Set by the stepper ISR on low queue level, so the manager refills early
+#if defined(ARDUINO_ARCH_AVR)
+extern volatile bool fas_refill_pending;
+#elif defined(ARDUINO_ARCH_ESP32)
+extern TaskHandle_t fas_stepper_task;
+#else
+extern volatile bool fas_refill_pending;
+#endif
+
+// Time base shared by all steppers in timer ticks, which wraps around.
+//   avr:   timer 1 extended by the overflow count
+//   esp32: esp_timer
+//   linux: CLOCK_MONOTONIC
+//   test:  virtual time, which is advanced by the test
+uint32_t fas_get_ticks();
+#if defined(FAS_LINUX)
+// Starts the timer and the manage thread or updates the manage period
+void fas_linux_start(FastAccelStepperEngine* engine,
+                     const struct engine_config_s& config, uint32_t period_us);
+#endif
+#if (FAS_SOFT_TIMER == 1)
+#define SOFT_NOT_SCHEDULED 0xff
+// Called by the software timer interrupt with the current time. Performs the
+// due steps of all software timer channels and arms the timer for the next.
+void fas_soft_timer_isr(uint32_t now);
+// These are implemented per architecture. fas_soft_timer_arm() makes the
+// timer call fas_soft_timer_isr() after approx. delta_ticks.
+void fas_soft_timer_init();
+void fas_soft_timer_arm(uint32_t delta_ticks);
+void fas_soft_timer_disarm();
+void fas_soft_pulse_wait(uint16_t ticks);
+#endif
+#if defined(ARDUINO_ARCH_AVR)
+extern volatile uint16_t fas_timer1_ovf_cnt;
+// Called by the step interrupts on low queue level as their last action.
+// Refills the queues with interrupts enabled.
+void fas_avr_refill();
+#endif
+#if defined(ARDUINO_ARCH_AVR) || defined(TEST)
+// Start of an avr hardware channel at start_at_ticks: Timer 1 matches the
+// compare value ocr every 65536 ticks and the first entry is started at the
+// match after hold_off matches. A compare value less than
+// AVR_START_MIN_TICKS ahead of the timer may be missed, so then the
+// hold-off counts the matches half a wrap earlier and the last one moves ocr
+// by half a wrap (hold_half). Start times less than AVR_START_MIN_TICKS
+// ahead or in the past are started immediately.
+#define AVR_START_MIN_TICKS 40
+struct avr_start_s {
+  uint16_t ocr;
+  uint8_t hold_off;
+  bool hold_half;
+};
+static inline void fas_avr_plan_start(uint32_t now, uint32_t start_at_ticks,
+                                      struct avr_start_s* s) {
+  s->ocr = now + AVR_START_MIN_TICKS;
+  s->hold_off = 0;
+  s->hold_half = false;
+  uint32_t delta = start_at_ticks - now;
+  if ((delta < AVR_START_MIN_TICKS) || (delta >= 0x80000000)) {
+    return;
+  }
+  s->ocr = start_at_ticks;
+  if ((uint16_t)delta < AVR_START_MIN_TICKS) {
+    // delta is at least one wrap, so the first match half a wrap earlier is
+    // still ahead
+    s->ocr += 0x8000;
+    s->hold_half = true;
+  }
+  uint32_t wraps = delta >> 16;
+  s->hold_off = wraps > 255 ? 255 : wraps;
+}
+#endif
+#if defined(ARDUINO_ARCH_ESP32) || defined(TEST)
+// Delayed starts of esp32 hardware channels with the same start time are
+// collected in one start set, which is started by a single esp_timer
+// callback. So the members of a group start together. A channel with
+// another start time, while the set is in use, needs its own timer.
+// The set must be accessed under a lock.
+#define FAS_START_SET_ARM 0     // first member: the timer has to be armed
+#define FAS_START_SET_JOINED 1  // the timer is armed already
+#define FAS_START_SET_BUSY 2    // the set waits for another start time
+struct fas_start_set_s {
+  uint8_t members;  // one bit per hardware queue
+  uint32_t start_ticks;
+};
+static inline uint8_t fas_start_set_add(struct fas_start_set_s* s,
+                                        uint8_t queue_num,
+                                        uint32_t start_ticks) {
+  if (s->members == 0) {
+    s->members = 1 << queue_num;
+    s->start_ticks = start_ticks;
+    return FAS_START_SET_ARM;
+  }
+  if (s->start_ticks != start_ticks) {
+    return FAS_START_SET_BUSY;
+  }
+  s->members |= 1 << queue_num;
+  return FAS_START_SET_JOINED;
+}
+static inline void fas_start_set_remove(struct fas_start_set_s* s,
+                                        uint8_t queue_num) {
+  s->members &= ~(1 << queue_num);
+}
+// Returns and removes the members to be started by the timer callback at
+// now. The timer fires up to 1us early due to its resolution. A callback of
+// an emptied set, which is already in flight, may see the members of the next
+// set, which starts at least 100us later. Then it returns 0.
+static inline uint8_t fas_start_set_take(struct fas_start_set_s* s,
+                                         uint32_t now) {
+  int32_t due = now - s->start_ticks;
+  if (due < -(int32_t)(TICKS_PER_S / 20000)) {
+    return 0;
+  }
+  uint8_t members = s->members;
+  s->members = 0;
+  return members;
+}
+#endif
+#if defined(TEST)
+extern uint32_t fas_virtual_ticks;
+#endif
@@ -13,9 +13,46 @@
 // Here are the global variables to interface with the interrupts
 StepperQueue fas_queue[NUM_QUEUES];
 
+// Incremented by TIMER1_OVF_vect
+volatile uint16_t fas_timer1_ovf_cnt = 0;
+
+// Makes the next TIMER1_OVF_vect call manageSteppers(), if the step
+// interrupt cannot refill at once
+volatile bool fas_refill_pending = false;
+
+// must be called with interrupts disabled
+static uint32_t get_ticks_locked() {
+  uint16_t tcnt = TCNT1;
+  uint16_t ovf_cnt = fas_timer1_ovf_cnt;
+  if ((TIFR1 & _BV(TOV1)) && (tcnt < 0x8000)) {
+    // overflow is pending and not yet counted
+    ovf_cnt++;
+  }
+  uint32_t ticks = ovf_cnt;
+  ticks <<= 16;
+  return ticks | tcnt;
+}
+
+uint32_t fas_get_ticks() {
+  noInterrupts();
+  uint32_t ticks = get_ticks_locked();
+  interrupts();
+  return ticks;
+}
+
 void StepperQueue::init(uint8_t queue_num, uint8_t step_pin) {
+#if (FAS_SOFT_TIMER == 1)
+  isSoft = (queue_num >= NUM_HW_QUEUES);
+  if (isSoft) {
+    _softInit(step_pin);
+    return;
+  }
+#endif
   _initVars();
   skip = 0;
+  hold_off = 0;
+  hold_half = false;
+  pulse_high = false;
   digitalWrite(step_pin, LOW);
   pinMode(step_pin, OUTPUT);
   if (step_pin == stepPinStepperA) {
@@ -36,77 +73,152 @@ void StepperQueue::init(uint8_t queue_num, uint8_t step_pin) {
   }
 }
 
-#define AVR_STEPPER_ISR(CHANNEL, queue, ocr, foc)                   \
-  ISR(TIMER1_COMP##CHANNEL##_vect) {                                \
-    if (queue.skip) {                                               \
-      if ((--queue.skip) == 0) {                                    \
-        Stepper_Toggle(CHANNEL);                                    \
-      }                                                             \
-      ocr += PERIOD_TICKS;                                          \
-      return;                                                       \
-    }                                                               \
-    uint8_t rp = queue.read_idx;                                    \
-    if (Stepper_IsToggling(CHANNEL)) {                              \
-      TCCR1C = _BV(foc); /* clear bit */                            \
-      struct queue_entry* e = &queue.entry[rp & QUEUE_LEN_MASK];    \
-      if ((e->steps -= 2) > 1) {                                    \
-        /* perform another step with this queue entry */            \
-        ocr += queue.period;                                        \
-        /* assign to skip and test for not zero */                  \
-        if (0 != (queue.skip = e->n_periods)) {                     \
-          Stepper_Zero(CHANNEL);                                    \
-        }                                                           \
-        return;                                                     \
-      }                                                             \
-      rp++;                                                         \
-      queue.read_idx = rp;                                          \
-    }                                                               \
-    if (rp == queue.next_write_idx) {                               \
-      /* queue is empty => set to disconnect */                     \
-      Stepper_Disconnect(CHANNEL);                                  \
-      /* disable compare interrupt */                               \
-      TIMSK1 &= ~_BV(OCIE1##CHANNEL);                               \
-      /* force compare to ensure disconnect */                      \
-      TCCR1C = _BV(FOC1##CHANNEL);                                  \
-      queue.isRunning = false;                                      \
-      queue.ticks_at_queue_end = TICKS_FOR_STOPPED_MOTOR;           \
-      return;                                                       \
-    }                                                               \
-    /* command in queue */                                          \
-    struct queue_entry* e = &queue.entry[rp & QUEUE_LEN_MASK];      \
-    ocr += (queue.period = e->period);                              \
-    /* assign to skip and test for not zero */                      \
-    if (0 != (queue.skip = e->n_periods)) {                         \
-      Stepper_Zero(CHANNEL);                                        \
-    } else {                                                        \
-      Stepper_Toggle(CHANNEL);                                      \
-    }                                                               \
-    uint8_t steps = e->steps;                                       \
-    if ((steps & 0x01) != 0) {                                      \
-      digitalWrite(queue.dirPin,                                    \
-                   digitalRead(queue.dirPin) == HIGH ? LOW : HIGH); \
-    }                                                               \
+// A step pulse longer than the interrupt latency is ended by a second
+// compare match, if at least this number of ticks is left of it. Else the
+// interrupt waits for the end of the pulse.
+#define AVR_PULSE_END_MIN_TICKS 32
+
+#define AVR_STEPPER_ISR(CHANNEL, queue, ocr, foc)                    \
+  ISR(TIMER1_COMP##CHANNEL##_vect) {                                 \
+    if (queue.skip) {                                                \
+      if ((--queue.skip) == 0) {                                     \
+        Stepper_Toggle(CHANNEL);                                     \
+      }                                                              \
+      ocr += PERIOD_TICKS;                                           \
+      return;                                                        \
+    }                                                                \
+    uint8_t rp = queue.read_idx;                                     \
+    bool refill = false;                                             \
+    /* time of the compare match, which has started the step */      \
+    uint16_t rise = ocr;                                             \
+    bool step = queue.pulse_high;                                    \
+    if (step) {                                                      \
+      /* this compare match has ended the step pulse */              \
+      queue.pulse_high = false;                                      \
+      rise -= queue.step_pulse_ticks;                                \
+    } else if (Stepper_IsToggling(CHANNEL)) {                        \
+      step = true;                                                   \
+      uint16_t high = TCNT1 - rise;                                  \
+      if (queue.step_pulse_ticks > high + AVR_PULSE_END_MIN_TICKS) { \
+        /* clear the pin with the next compare match */              \
+        Stepper_Zero(CHANNEL);                                       \
+        ocr = rise + queue.step_pulse_ticks;                         \
+        queue.pulse_high = true;                                     \
+        return;                                                      \
+      }                                                              \
+      /* the rest of the pulse is too short for another interrupt */ \
+      while ((uint16_t)(TCNT1 - rise) < queue.step_pulse_ticks) {    \
+      }                                                              \
+      TCCR1C = _BV(foc); /* clear bit */                             \
+    }                                                                \
+    if (step) {                                                      \
+      union queue_unit* u = &queue.entry[rp & queue.queue_len_mask]; \
+      /* 16 bit step count is decremented in the queue entry */      \
+      if (u->cmd.steps-- == 0) {                                     \
+        queue.entry[(rp + 2) & queue.queue_len_mask].ext.steps_hi =  \
+            --queue.steps_hi;                                        \
+      }                                                              \
+      if ((u->cmd.steps | queue.steps_hi) != 0) {                    \
+        /* perform another step with this queue entry */             \
+        ocr = rise + queue.period;                                   \
+        /* assign to skip and test for not zero */                   \
+        if (0 != (queue.skip = queue.n_periods)) {                   \
+          Stepper_Zero(CHANNEL);                                     \
+        } else {                                                     \
+          Stepper_Toggle(CHANNEL);                                   \
+        }                                                            \
+        return;                                                      \
+      }                                                              \
+      if (QUEUE_ENTRY_HAS_EVENT(u->cmd.code)) {                      \
+        queue.firePositionEvent(get_ticks_locked());                 \
+      }                                                              \
+      rp += QUEUE_ENTRY_UNITS(u->cmd.code);                          \
+      fas_idx_store(queue.read_idx, rp);                             \
+      refill = queue.isBelowLowWatermark(rp);                        \
+    } else if (queue.hold_off) {                                     \
+      /* delayed start: wait for another timer 1 wrap around */      \
+      if ((--queue.hold_off == 0) && queue.hold_half) {              \
+        /* the start time is half a wrap after this match */         \
+        ocr += 0x8000;                                               \
+      }                                                              \
+      return;                                                        \
+    }                                                                \
+    if (rp == fas_idx_load(queue.next_write_idx)) {                  \
+      /* queue is empty => set to disconnect */                      \
+      Stepper_Disconnect(CHANNEL);                                   \
+      /* disable compare interrupt */                                \
+      TIMSK1 &= ~_BV(OCIE1##CHANNEL);                                \
+      /* force compare to ensure disconnect */                       \
+      TCCR1C = _BV(FOC1##CHANNEL);                                   \
+      queue.isRunning = false;                                       \
+      queue.ticks_at_queue_end = TICKS_FOR_STOPPED_MOTOR;            \
+      if (refill) {                                                  \
+        fas_avr_refill();                                            \
+      }                                                              \
+      return;                                                        \
+    }                                                                \
+    /* command in queue */                                           \
+    struct queue_entry e;                                            \
+    queue.decodeEntry(rp, &e);                                       \
+    ocr = rise + e.period;                                           \
+    queue.steps_hi = e.steps >> 8;                                   \
+    /* assign to skip and test for not zero */                       \
+    if (0 != (queue.skip = queue.n_periods = e.n_periods)) {         \
+      Stepper_Zero(CHANNEL);                                         \
+    } else {                                                         \
+      Stepper_Toggle(CHANNEL);                                       \
+    }                                                                \
+    if (e.toggle_dir) {                                              \
+      queue.toggleDirPin();                                          \
+    }                                                                \
+    if (refill) {                                                    \
+      fas_avr_refill();                                              \
+    }                                                                \
   }
 AVR_STEPPER_ISR(A, fas_queue_A, OCR1A, FOC1A)
+#if (NUM_HW_QUEUES > 1)
 AVR_STEPPER_ISR(B, fas_queue_B, OCR1B, FOC1B)
+#endif
+
+void StepperQueue::setStepPulseTicks(uint16_t ticks) {
+  step_pulse_ticks = ticks;
+}
 
 void StepperQueue::startQueue() {
+#if (FAS_SOFT_TIMER == 1)
+  if (isSoft) {
+    _softStartQueue();
+    return;
+  }
+#endif
   isRunning = true;
+  noInterrupts();
+  uint32_t now = get_ticks_locked();
+  // without start time the start is AVR_START_MIN_TICKS ahead
+  struct avr_start_s plan;
+  fas_avr_plan_start(now, start_at_valid ? start_at_ticks : now, &plan);
+  start_at_valid = false;
+  uint16_t start = plan.ocr;
+  hold_off = plan.hold_off;
+  hold_half = plan.hold_half;
   if (isChannelA) {
-    noInterrupts();
     TIFR1 = _BV(OCF1A);     // clear interrupt flag
     TIMSK1 |= _BV(OCIE1A);  // enable compare A interrupt
-    OCR1A = TCNT1 + 40;     // definite start point
-    interrupts();
+    OCR1A = start;
   } else {
-    noInterrupts();
     TIFR1 = _BV(OCF1B);     // clear interrupt flag
     TIMSK1 |= _BV(OCIE1B);  // enable compare A interrupt
-    OCR1B = TCNT1 + 40;     // definite start point
-    interrupts();
+    OCR1B = start;
   }
+  interrupts();
 }
 void StepperQueue::forceStop() {
+#if (FAS_SOFT_TIMER == 1)
+  if (isSoft) {
+    _softForceStop();
+    return;
+  }
+#endif
   if (isChannelA) {
     /* disable compare interrupt */
     TIMSK1 &= ~_BV(OCIE1A);
@@ -124,8 +236,54 @@ void StepperQueue::forceStop() {
   }
   isRunning = false;
   ticks_at_queue_end = TICKS_FOR_STOPPED_MOTOR;
+  hold_off = 0;
+  hold_half = false;
+  pulse_high = false;
+  start_at_valid = false;
 
-  // empty the queue
+  // empty the queue. Next entry needs the full form
   read_idx = next_write_idx;
+  period_at_queue_end_valid = false;
+  _rearmQueuedEvents();
+}
+uint16_t StepperQueue::stepsInProgress() {
+  // The remaining steps are kept in the queue also by the software timer
+  // channels
+  return 0;
 }
+
+#if (FAS_SOFT_TIMER == 1)
+// Timer 2 wakes up the software timer channels. It runs with prescaler 32,
+// so one count is 32 ticks. A wake up further away than 250 counts is done
+// in several steps. tone() and analogWrite() on pins 3/11 cannot be used.
+#define SOFT_TIMER_SHIFT 5
+#define SOFT_TIMER_MAX_COUNTS 250
+void fas_soft_timer_init() {
+  noInterrupts();
+  TIMSK2 &= ~(_BV(OCIE2A) | _BV(OCIE2B) | _BV(TOIE2));
+  TCCR2A = 0;                      // normal mode, outputs disconnected
+  TCCR2B = _BV(CS21) | _BV(CS20);  // prescaler 32
+  interrupts();
+}
+// must be called with interrupts disabled
+void fas_soft_timer_arm(uint32_t delta_ticks) {
+  uint32_t counts = delta_ticks >> SOFT_TIMER_SHIFT;
+  if (counts < 2) {
+    // the compare match must be ahead of TCNT2
+    counts = 2;
+  } else if (counts > SOFT_TIMER_MAX_COUNTS) {
+    counts = SOFT_TIMER_MAX_COUNTS;
+  }
+  OCR2A = TCNT2 + (uint8_t)counts;
+  TIFR2 = _BV(OCF2A);     // clear interrupt flag
+  TIMSK2 |= _BV(OCIE2A);  // enable compare A interrupt
+}
+void fas_soft_timer_disarm() { TIMSK2 &= ~_BV(OCIE2A); }
+void fas_soft_pulse_wait(uint16_t ticks) {
+  uint16_t start = TCNT1;
+  while ((uint16_t)(TCNT1 - start) < ticks) {
+  }
+}
+ISR(TIMER2_COMPA_vect) { fas_soft_timer_isr(get_ticks_locked()); }
+#endif
 #endif
@@ -3,7 +3,8 @@
 
 #if defined(ARDUINO_ARCH_ESP32)
 
-// H-Period of Step signal is 10 us
+// The timer is below this value shortly after wrap around. Same as the
+// default H-Period of the step signal of 10 us.
 #define TIMER_H_L_TRANSITION 160
 
 // cannot be updated while timer is running => fix it to 0
@@ -13,7 +14,7 @@
 StepperQueue fas_queue[NUM_QUEUES];
 
 // Here the associated mapping from queue to mcpwm/pcnt units
-static const struct mapping_s queue2mapping[NUM_QUEUES] = {
+static const struct mapping_s queue2mapping[MAX_HW_STEPPER] = {
     {
       mcpwm_unit : MCPWM_UNIT_0,
       timer : 0,
@@ -70,21 +71,23 @@ static const struct mapping_s queue2mapping[NUM_QUEUES] = {
     },
 };
 
-void IRAM_ATTR next_command(StepperQueue *queue, struct queue_entry *e) {
+// Starts the entry at index rp and returns its number of units
+uint8_t IRAM_ATTR next_command(StepperQueue *queue, uint8_t rp) {
   const struct mapping_s *mapping = queue->mapping;
   mcpwm_unit_t mcpwm_unit = mapping->mcpwm_unit;
   mcpwm_dev_t *mcpwm = mcpwm_unit == MCPWM_UNIT_0 ? &MCPWM0 : &MCPWM1;
   uint8_t timer = mapping->timer;
-  uint8_t steps = e->steps;
-  PCNT.conf_unit[timer].conf2.cnt_h_lim =
-      steps >> 1;  // is updated only on zero
-  if ((steps & 0x01) != 0) {
-    uint8_t dirPin = queue->dirPin;
-    digitalWrite(dirPin, digitalRead(dirPin) == HIGH ? LOW : HIGH);
+  struct queue_entry e;
+  uint8_t units = queue->decodeEntry(rp, &e);
+  // is updated only on zero
+  PCNT.conf_unit[mapping->pcnt_unit].conf2.cnt_h_lim = e.steps;
+  queue->current_steps = e.steps;
+  if (e.toggle_dir) {
+    queue->toggleDirPin();
   }
-  uint8_t n_periods = e->n_periods;
-  uint16_t period = e->period;
-  queue->period = period;
+  queue->entry_event = e.event;
+  uint8_t n_periods = e.n_periods;
+  uint16_t period = e.period;
   if (n_periods == 0) {
     mcpwm->timer[timer].period.period = period;
     mcpwm->channel[timer].generator[0].utez = 2;  // high at zero
@@ -98,26 +101,84 @@ void IRAM_ATTR next_command(StepperQueue *queue, struct queue_entry *e) {
     mcpwm->int_clr.val = mapping->timer_tez_int_clr;
     mcpwm->int_ena.val |= mapping->timer_tez_int_ena;
   }
+  return units;
+}
+
+uint32_t IRAM_ATTR fas_get_ticks() {
+  uint64_t us = esp_timer_get_time();
+  return (uint32_t)(us * (TICKS_PER_S / 1000000));
+}
+
+// esp_timer callback for a delayed start of the queue
+static void start_timer_callback(void *arg);
+
+// Delayed starts with the same start time, see fas_start_set_s
+static portMUX_TYPE start_mux = portMUX_INITIALIZER_UNLOCKED;
+static struct fas_start_set_s start_set;
+static esp_timer_handle_t start_set_timer = NULL;
+static void start_set_callback(void *arg);
+
+// Bits of MCPWM_TIMERx_SYNC_REG and MCPWM_TIMER_SYNCI_CFG_REG (esp32 TRM).
+// The phase is 0, so a sync resets the timer to zero. Each change of SYNC_SW
+// triggers a software sync.
+#define SYNC_IN_EN 1
+#define SYNC_SW 2
+#define SYNC_OUT_SW (3 << 2)  // sync output is the software sync
+#define SYNCI_SEL_SHIFT(timer) (3 * (timer))
+#define SYNCI_SEL_MASK 7
+#define SYNCI_SEL_TIMER_OUT(timer) ((timer) + 1)
+
+// The producer on one core and the ISR on the other may both find the queue
+// stopped with a new entry. Only the one, which sets isRunning, runs it.
+static inline bool IRAM_ATTR claim_running(StepperQueue *q) {
+  bool expected = false;
+  return __atomic_compare_exchange_n((bool *)&q->isRunning, &expected, true,
+                                     false, __ATOMIC_SEQ_CST,
+                                     __ATOMIC_SEQ_CST);
 }
 
 static void IRAM_ATTR pcnt_isr_service(void *arg) {
   StepperQueue *q = (StepperQueue *)arg;
+  // the entry in progress has completed
+  if (q->entry_event) {
+    q->entry_event = false;
+    q->firePositionEvent(fas_get_ticks());
+  }
+  const struct mapping_s *mapping = q->mapping;
+  mcpwm_unit_t mcpwm_unit = mapping->mcpwm_unit;
+  mcpwm_dev_t *mcpwm = mcpwm_unit == MCPWM_UNIT_0 ? &MCPWM0 : &MCPWM1;
+  uint8_t timer = mapping->timer;
   uint8_t rp = q->read_idx;
-  if (rp != q->next_write_idx) {
-    struct queue_entry *e = &q->entry[rp & QUEUE_LEN_MASK];
-    rp++;
-    q->read_idx = rp;
-    next_command(q, e);
-  } else {
+  if (rp == fas_idx_load(q->next_write_idx)) {
     // no more commands: stop timer at period end
-    const struct mapping_s *mapping = q->mapping;
-    mcpwm_unit_t mcpwm_unit = mapping->mcpwm_unit;
-    mcpwm_dev_t *mcpwm = mcpwm_unit == MCPWM_UNIT_0 ? &MCPWM0 : &MCPWM1;
-    uint8_t timer = mapping->timer;
     mcpwm->timer[timer].mode.start = 1;           // stop at TEP
     mcpwm->channel[timer].generator[0].utez = 1;  // low at zero
+    // The producer checks for a stopped queue after publishing. So either
+    // it sees isRunning false and starts the queue or the new entry is seen
+    // here.
     q->isRunning = false;
-    q->ticks_at_queue_end = TICKS_FOR_STOPPED_MOTOR;
+    fas_memory_fence();
+    if (rp == fas_idx_load(q->next_write_idx)) {
+      q->current_steps = 0;
+      q->ticks_at_queue_end = TICKS_FOR_STOPPED_MOTOR;
+      return;
+    }
+    if (!claim_running(q)) {
+      // the producer has started the queue again
+      return;
+    }
+    // the entry has arrived in time: keep the timer running
+    mcpwm->timer[timer].mode.start = 2;  // free run
+  }
+  rp += next_command(q, rp);
+  // release the entry only after it has been read
+  fas_idx_store(q->read_idx, rp);
+  if (q->isBelowLowWatermark(rp) && (fas_stepper_task != NULL)) {
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(fas_stepper_task, &woken);
+    if (woken == pdTRUE) {
+      portYIELD_FROM_ISR();
+    }
   }
 }
 
@@ -154,12 +215,37 @@ static void IRAM_ATTR mcpwm1_isr_service(void *arg) {
 }
 
 void StepperQueue::init(uint8_t queue_num, uint8_t step_pin) {
+#if (FAS_SOFT_TIMER == 1)
+  isSoft = (queue_num >= NUM_HW_QUEUES);
+  if (isSoft) {
+    _softInit(step_pin);
+    return;
+  }
+#endif
   _initVars();
 
   digitalWrite(step_pin, LOW);
   pinMode(step_pin, OUTPUT);
   mapping = &queue2mapping[queue_num];
   isRunning = false;
+  current_steps = 0;
+
+  esp_timer_create_args_t timer_args = {
+    callback : start_timer_callback,
+    arg : this,
+    dispatch_method : ESP_TIMER_TASK,
+    name : "fas_start"
+  };
+  esp_timer_create(&timer_args, &start_timer);
+  if (start_set_timer == NULL) {
+    esp_timer_create_args_t set_timer_args = {
+      callback : start_set_callback,
+      arg : NULL,
+      dispatch_method : ESP_TIMER_TASK,
+      name : "fas_start_set"
+    };
+    esp_timer_create(&set_timer_args, &start_set_timer);
+  }
 
   mcpwm_unit_t mcpwm_unit = mapping->mcpwm_unit;
   mcpwm_dev_t *mcpwm = mcpwm_unit == MCPWM_UNIT_0 ? &MCPWM0 : &MCPWM1;
@@ -213,7 +299,8 @@ void StepperQueue::init(uint8_t queue_num, uint8_t step_pin) {
   mcpwm->timer[timer].mode.val = 0;  // freeze
   mcpwm->timer[timer].sync.val = 0;  // no sync
   mcpwm->channel[timer].cmpr_cfg.a_upmethod = 0;
-  mcpwm->channel[timer].cmpr_value[0].cmpr_val = TIMER_H_L_TRANSITION;
+  // H-Period of Step signal
+  mcpwm->channel[timer].cmpr_value[0].cmpr_val = step_pulse_ticks;
   mcpwm->channel[timer].generator[0].val = 0;
   mcpwm->channel[timer].generator[1].val = 0;
   // mcpwm->channel[timer].generator[0].utez = 2;  // high at zero
@@ -227,6 +314,19 @@ void StepperQueue::init(uint8_t queue_num, uint8_t step_pin) {
   gpio_iomux_in(step_pin, input_sig_index);
 }
 
+void StepperQueue::setStepPulseTicks(uint16_t ticks) {
+  step_pulse_ticks = ticks;
+#if (FAS_SOFT_TIMER == 1)
+  if (isSoft) {
+    return;
+  }
+#endif
+  mcpwm_dev_t *mcpwm =
+      mapping->mcpwm_unit == MCPWM_UNIT_0 ? &MCPWM0 : &MCPWM1;
+  // immediate update, so takes effect with the next step pulse
+  mcpwm->channel[mapping->timer].cmpr_value[0].cmpr_val = ticks;
+}
+
 // Mechanism is like this, starting from stopped motor:
 //
 // *	init counter
@@ -242,7 +342,9 @@ void StepperQueue::init(uint8_t queue_num, uint8_t step_pin) {
 //		- 	without next command: set mcpwm to stop mode on reaching
 // period
 
-void StepperQueue::startQueue() {
+// Lets the stopped timer run with the longest period and the step pin low
+static void prepare_start(StepperQueue *queue) {
+  const struct mapping_s *mapping = queue->mapping;
   mcpwm_unit_t mcpwm_unit = mapping->mcpwm_unit;
   mcpwm_dev_t *mcpwm = mcpwm_unit == MCPWM_UNIT_0 ? &MCPWM0 : &MCPWM1;
   uint8_t timer = mapping->timer;
@@ -252,9 +354,15 @@ void StepperQueue::startQueue() {
   mcpwm->timer[timer].period.upmethod = 0;      // 0 = immediate update, 1 = TEZ
   // period will be overwritten later in next_command
   mcpwm->timer[timer].period.period = 65535;
-  isRunning = true;
 
   mcpwm->timer[timer].mode.val = 10;  // free run incrementing
+}
+static void start_queue_now(StepperQueue *queue) {
+  prepare_start(queue);
+  const struct mapping_s *mapping = queue->mapping;
+  mcpwm_unit_t mcpwm_unit = mapping->mcpwm_unit;
+  mcpwm_dev_t *mcpwm = mcpwm_unit == MCPWM_UNIT_0 ? &MCPWM0 : &MCPWM1;
+  uint8_t timer = mapping->timer;
 
   // busy wait period for timer zero
   while (mcpwm->timer[timer].status.value >= TIMER_H_L_TRANSITION) {
@@ -262,16 +370,200 @@ void StepperQueue::startQueue() {
 
   // my interrupt cannot be called in this state, so modifying read_idx without
   // interrupts disabled is ok
-  struct queue_entry *e = &entry[read_idx++ & QUEUE_LEN_MASK];
-  next_command(this, e);
+  queue->read_idx += next_command(queue, queue->read_idx);
+}
+static void start_timer_callback(void *arg) {
+  start_queue_now((StepperQueue *)arg);
+}
+
+// Starts the members of the start set in the same tick: The first member of
+// each mcpwm unit passes its software sync to the timers of the other
+// members, which resets them all to zero. Instead of busy waiting for the
+// wrap around, the first entries are then started right after zero. The two
+// mcpwm units are synced one after the other.
+static void start_set_now(uint8_t members) {
+  for (uint8_t q = 0; q < NUM_HW_QUEUES; q++) {
+    if ((members & (1 << q)) && !fas_queue[q].isRunning) {
+      // stopped by forceStop() meanwhile
+      members &= ~(1 << q);
+    }
+  }
+  for (uint8_t q = 0; q < NUM_HW_QUEUES; q++) {
+    if (members & (1 << q)) {
+      prepare_start(&fas_queue[q]);
+    }
+  }
+  noInterrupts();
+  for (uint8_t u = 0; u < 2; u++) {
+    mcpwm_dev_t *mcpwm = u == 0 ? &MCPWM0 : &MCPWM1;
+    int8_t lead = -1;
+    for (uint8_t q = 0; q < NUM_HW_QUEUES; q++) {
+      const struct mapping_s *mapping = queue2mapping + q;
+      if (((members & (1 << q)) == 0) ||
+          (mapping->mcpwm_unit != (u == 0 ? MCPWM_UNIT_0 : MCPWM_UNIT_1))) {
+        continue;
+      }
+      uint8_t timer = mapping->timer;
+      if (lead < 0) {
+        lead = timer;
+        mcpwm->timer[timer].sync.val |= SYNC_IN_EN | SYNC_OUT_SW;
+      } else {
+        uint32_t cfg = mcpwm->timer_synci_cfg.val;
+        cfg &= ~(SYNCI_SEL_MASK << SYNCI_SEL_SHIFT(timer));
+        cfg |= SYNCI_SEL_TIMER_OUT(lead) << SYNCI_SEL_SHIFT(timer);
+        mcpwm->timer_synci_cfg.val = cfg;
+        mcpwm->timer[timer].sync.val |= SYNC_IN_EN;
+      }
+    }
+    if (lead >= 0) {
+      // toggling the bit triggers the software sync
+      mcpwm->timer[lead].sync.val ^= SYNC_SW;
+    }
+  }
+  for (uint8_t q = 0; q < NUM_HW_QUEUES; q++) {
+    if (members & (1 << q)) {
+      StepperQueue *queue = &fas_queue[q];
+      queue->read_idx += next_command(queue, queue->read_idx);
+    }
+  }
+  interrupts();
+  for (uint8_t q = 0; q < NUM_HW_QUEUES; q++) {
+    if (members & (1 << q)) {
+      const struct mapping_s *mapping = queue2mapping + q;
+      mcpwm_dev_t *mcpwm =
+          mapping->mcpwm_unit == MCPWM_UNIT_0 ? &MCPWM0 : &MCPWM1;
+      // no sync. SYNC_SW is kept, because each change triggers a sync.
+      mcpwm->timer[mapping->timer].sync.val &= ~(SYNC_IN_EN | SYNC_OUT_SW);
+    }
+  }
+}
+static void start_set_callback(void *arg) {
+  portENTER_CRITICAL(&start_mux);
+  uint32_t now = fas_get_ticks();
+  uint8_t members = fas_start_set_take(&start_set, now);
+  // a callback of an emptied set, which has been replaced by another one
+  bool pending = (start_set.members != 0);
+  uint32_t delta = start_set.start_ticks - now;
+  portEXIT_CRITICAL(&start_mux);
+  if (members != 0) {
+    start_set_now(members);
+  } else if (pending && (delta < 0x80000000)) {
+    // fails, if the timer of the new set is armed already
+    esp_timer_start_once(start_set_timer, delta / (TICKS_PER_S / 1000000));
+  }
+}
+void StepperQueue::startQueue() {
+#if (FAS_SOFT_TIMER == 1)
+  if (isSoft) {
+    _softStartQueue();
+    return;
+  }
+#endif
+  if (!claim_running(this)) {
+    // the ISR has taken the new entry
+    return;
+  }
+  if (start_at_valid) {
+    start_at_valid = false;
+    uint32_t delta = start_at_ticks - fas_get_ticks();
+    // start times in the past are started immediately
+    if ((delta >= TICKS_PER_S / 10000) && (delta < 0x80000000)) {
+      uint64_t us = delta / (TICKS_PER_S / 1000000);
+      portENTER_CRITICAL(&start_mux);
+      uint8_t res = fas_start_set_add(&start_set, this - fas_queue,
+                                      start_at_ticks);
+      portEXIT_CRITICAL(&start_mux);
+      if (res == FAS_START_SET_ARM) {
+        // the timer of an emptied set may still be armed
+        esp_timer_stop(start_set_timer);
+        esp_timer_start_once(start_set_timer, us);
+      } else if (res == FAS_START_SET_BUSY) {
+        esp_timer_start_once(start_timer, us);
+      }
+      return;
+    }
+  }
+  start_queue_now(this);
 }
 void StepperQueue::forceStop() {
+#if (FAS_SOFT_TIMER == 1)
+  if (isSoft) {
+    _softForceStop();
+    return;
+  }
+#endif
   mcpwm_unit_t mcpwm_unit = mapping->mcpwm_unit;
   mcpwm_dev_t *mcpwm = mcpwm_unit == MCPWM_UNIT_0 ? &MCPWM0 : &MCPWM1;
   uint8_t timer = mapping->timer;
   mcpwm->timer[timer].mode.start = 1;           // stop at TEP
   mcpwm->channel[timer].generator[0].utez = 1;  // low at zero
+  esp_timer_stop(start_timer);  // a pending delayed start
+  portENTER_CRITICAL(&start_mux);
+  fas_start_set_remove(&start_set, this - fas_queue);
+  portEXIT_CRITICAL(&start_mux);
+  start_at_valid = false;
   isRunning = false;
+  current_steps = 0;
   ticks_at_queue_end = TICKS_FOR_STOPPED_MOTOR;
 }
+uint16_t StepperQueue::stepsInProgress() {
+#if (FAS_SOFT_TIMER == 1)
+  if (isSoft) {
+    return soft_steps_left;
+  }
+#endif
+  uint16_t steps = current_steps;
+  if (steps == 0) {
+    return 0;
+  }
+  pcnt_unit_t pcnt_unit = mapping->pcnt_unit;
+  if (PCNT.int_st.val & (1UL << pcnt_unit)) {
+    // the counter has reached the steps and the interrupt is pending
+    return 0;
+  }
+  uint16_t done = PCNT.cnt_unit[pcnt_unit].cnt_val;
+  return (done < steps) ? steps - done : 0;
+}
+
+#if (FAS_SOFT_TIMER == 1)
+// Timer 1 of timer group 1 wakes up the software timer channels. It counts
+// with 16 MHz and restarts from zero on each arm.
+#define SOFT_TIMER_MIN_TICKS 32
+static void IRAM_ATTR soft_timer_isr_service(void *arg) {
+  TIMERG1.int_clr_timers.t1 = 1;
+  fas_soft_timer_isr(fas_get_ticks());
+}
+void fas_soft_timer_init() {
+  timer_config_t config = {};  // alarm disabled, paused, no auto reload
+  config.intr_type = TIMER_INTR_LEVEL;
+  config.counter_dir = TIMER_COUNT_UP;
+  config.divider = 5;  // 80 MHz APB => 16 MHz
+  timer_init(TIMER_GROUP_1, TIMER_1, &config);
+  timer_set_counter_value(TIMER_GROUP_1, TIMER_1, 0);
+  timer_enable_intr(TIMER_GROUP_1, TIMER_1);
+  timer_isr_register(TIMER_GROUP_1, TIMER_1, soft_timer_isr_service, NULL,
+                     ESP_INTR_FLAG_IRAM, NULL);
+  timer_start(TIMER_GROUP_1, TIMER_1);
+}
+void IRAM_ATTR fas_soft_timer_arm(uint32_t delta_ticks) {
+  // the alarm must be ahead of the counter after the register updates
+  if (delta_ticks < SOFT_TIMER_MIN_TICKS) {
+    delta_ticks = SOFT_TIMER_MIN_TICKS;
+  }
+  TIMERG1.hw_timer[1].load_high = 0;
+  TIMERG1.hw_timer[1].load_low = 0;
+  TIMERG1.hw_timer[1].reload = 1;
+  TIMERG1.hw_timer[1].alarm_high = 0;
+  TIMERG1.hw_timer[1].alarm_low = delta_ticks;
+  TIMERG1.hw_timer[1].config.alarm_en = 1;
+}
+void IRAM_ATTR fas_soft_timer_disarm() {
+  TIMERG1.hw_timer[1].config.alarm_en = 0;
+}
+void IRAM_ATTR fas_soft_pulse_wait(uint16_t ticks) {
+  uint32_t start = fas_get_ticks();
+  while ((fas_get_ticks() - start) < ticks) {
+  }
+}
+#endif
 #endif
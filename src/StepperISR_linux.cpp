@@ -0,0 +1,403 @@
+#include "FastAccelStepper.h"
+#include "StepperISR.h"
+
+#if defined(FAS_LINUX)
+#include <fcntl.h>
+#include <linux/gpio.h>
+#include <sched.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+
+// The stepper interrupts are emulated by one timer thread for all queues.
+// noInterrupts() takes fas_isr_mutex, which is held by the timer thread while
+// it processes the queues, so the library code sees the same exclusion as
+// with disabled interrupts on the targets.
+//
+// The timer thread uses the consumer semantics of esp32: read_idx points to
+// the entry after the one in progress.
+
+// Here are the global variables to interface with the interrupts
+StepperQueue fas_queue[NUM_QUEUES];
+
+// Makes the manage thread call manageSteppers() without waiting for the period
+volatile bool fas_refill_pending = false;
+
+static pthread_once_t fas_isr_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t fas_isr_mutex;
+// Signaled on a queue start, so the timer thread recalculates its wake up
+static pthread_cond_t fas_timer_kick;
+
+static pthread_mutex_t fas_manage_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t fas_manage_kick;
+static uint32_t fas_manage_period_us;
+
+static bool fas_threads_started = false;
+static FasOutputSink* fas_sink = NULL;
+
+static void init_isr_mutex() {
+  pthread_mutexattr_t attr;
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&fas_isr_mutex, &attr);
+  pthread_mutexattr_destroy(&attr);
+
+  // the timed waits use the same clock as the time base
+  pthread_condattr_t cattr;
+  pthread_condattr_init(&cattr);
+  pthread_condattr_setclock(&cattr, CLOCK_MONOTONIC);
+  pthread_cond_init(&fas_timer_kick, &cattr);
+  pthread_cond_init(&fas_manage_kick, &cattr);
+  pthread_condattr_destroy(&cattr);
+}
+
+void noInterrupts() {
+  pthread_once(&fas_isr_once, init_isr_mutex);
+  pthread_mutex_lock(&fas_isr_mutex);
+}
+void interrupts() { pthread_mutex_unlock(&fas_isr_mutex); }
+
+//*************************************************************************************************
+// Time base: CLOCK_MONOTONIC in ticks of 1/16 us
+static uint64_t get_ticks64() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  uint64_t us = (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+  uint32_t sub_us_ticks =
+      (ts.tv_nsec % 1000) * (TICKS_PER_S / 1000000) / 1000;
+  return us * (TICKS_PER_S / 1000000) + sub_us_ticks;
+}
+static struct timespec ticks_to_timespec(uint64_t ticks) {
+  uint64_t us = ticks / (TICKS_PER_S / 1000000);
+  uint32_t sub_us_ticks = ticks % (TICKS_PER_S / 1000000);
+  struct timespec ts;
+  ts.tv_sec = us / 1000000;
+  ts.tv_nsec =
+      (us % 1000000) * 1000 + sub_us_ticks * 1000 / (TICKS_PER_S / 1000000);
+  return ts;
+}
+uint32_t fas_get_ticks() { return (uint32_t)get_ticks64(); }
+uint32_t micros() {
+  return (uint32_t)(get_ticks64() / (TICKS_PER_S / 1000000));
+}
+
+void pinMode(uint8_t /*pin*/, uint8_t /*mode*/) {}
+void digitalWrite(uint8_t pin, uint8_t value) {
+  noInterrupts();
+  if (fas_sink != NULL) {
+    fas_sink->pinWrite(pin, value != LOW, fas_get_ticks());
+  }
+  interrupts();
+}
+
+//*************************************************************************************************
+// Processes all events of the queue up to now. Must be called with
+// fas_isr_mutex held. An event either performs a step or starts the next
+// entry, which happens at the same time as the last step of an entry.
+static void process_queue(StepperQueue* q, uint64_t now) {
+  while (q->timer_active && (q->next_event <= now)) {
+    if (q->steps_left > 0) {
+      if (fas_sink != NULL) {
+        fas_sink->step(q->step_pin, (uint32_t)q->next_event,
+                       q->step_pulse_ticks);
+      }
+      if (--q->steps_left > 0) {
+        q->next_event += q->entry_ticks;
+        continue;
+      }
+      if (q->entry_event) {
+        q->entry_event = false;
+        q->firePositionEvent((uint32_t)q->next_event);
+      }
+    }
+    uint8_t rp = q->read_idx;
+    if (rp == fas_idx_load(q->next_write_idx)) {
+      // The producer checks for a stopped queue after publishing. So either
+      // it sees isRunning false and starts the queue or the new entry is
+      // seen here.
+      q->isRunning = false;
+      fas_memory_fence();
+      if (rp == fas_idx_load(q->next_write_idx)) {
+        q->timer_active = false;
+        q->ticks_at_queue_end = TICKS_FOR_STOPPED_MOTOR;
+        return;
+      }
+      q->isRunning = true;
+    }
+    struct queue_entry e;
+    rp += q->decodeEntry(rp, &e);
+    // release the entry only after it has been read
+    fas_idx_store(q->read_idx, rp);
+    if (e.toggle_dir) {
+      q->toggleDirPin();
+      if ((fas_sink != NULL) && (q->dirPinMask != 0)) {
+        fas_sink->pinWrite(q->dirPin, q->dirPinLevel,
+                           (uint32_t)q->next_event);
+      }
+    }
+    uint32_t ticks = e.n_periods;
+    ticks *= PERIOD_TICKS;
+    ticks += e.period;
+    q->entry_ticks = ticks;
+    q->steps_left = e.steps;
+    q->entry_event = e.event;
+    q->next_event += ticks;
+    if (q->isBelowLowWatermark(rp)) {
+      pthread_mutex_lock(&fas_manage_mutex);
+      fas_refill_pending = true;
+      pthread_cond_signal(&fas_manage_kick);
+      pthread_mutex_unlock(&fas_manage_mutex);
+    }
+  }
+}
+
+static void* timer_thread(void* /*arg*/) {
+  noInterrupts();
+  while (true) {
+    uint64_t now = get_ticks64();
+    uint64_t next = 0;
+    bool active = false;
+    for (uint8_t i = 0; i < NUM_QUEUES; i++) {
+      StepperQueue* q = &fas_queue[i];
+      process_queue(q, now);
+      if (q->timer_active && (!active || (q->next_event < next))) {
+        next = q->next_event;
+        active = true;
+      }
+    }
+    if (active) {
+      struct timespec ts = ticks_to_timespec(next);
+      pthread_cond_timedwait(&fas_timer_kick, &fas_isr_mutex, &ts);
+    } else {
+      pthread_cond_wait(&fas_timer_kick, &fas_isr_mutex);
+    }
+  }
+  return NULL;
+}
+
+static void* manage_thread(void* arg) {
+  FastAccelStepperEngine* engine = (FastAccelStepperEngine*)arg;
+  while (true) {
+    engine->manageSteppers();
+    // sleep till the period has passed or a queue runs low
+    pthread_mutex_lock(&fas_manage_mutex);
+    if (!fas_refill_pending) {
+      uint64_t wake = fas_manage_period_us;
+      wake *= TICKS_PER_S / 1000000;
+      struct timespec ts = ticks_to_timespec(get_ticks64() + wake);
+      pthread_cond_timedwait(&fas_manage_kick, &fas_manage_mutex, &ts);
+    }
+    pthread_mutex_unlock(&fas_manage_mutex);
+  }
+  return NULL;
+}
+
+// Real time scheduling needs privileges. Without them, the threads run with
+// the default policy.
+static void start_thread(void* (*func)(void*), void* arg, int priority,
+                         int8_t core) {
+  pthread_t thread;
+  if (pthread_create(&thread, NULL, func, arg) != 0) {
+    return;
+  }
+  pthread_detach(thread);
+  struct sched_param param;
+  memset(&param, 0, sizeof(param));
+  param.sched_priority = priority;
+  pthread_setschedparam(thread, SCHED_FIFO, &param);
+  if (core >= 0) {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(core, &cpus);
+    pthread_setaffinity_np(thread, sizeof(cpus), &cpus);
+  }
+}
+
+void fas_linux_start(FastAccelStepperEngine* engine,
+                     const struct engine_config_s& config, uint32_t period_us) {
+  pthread_once(&fas_isr_once, init_isr_mutex);
+  fas_manage_period_us = period_us;
+  noInterrupts();
+  bool started = fas_threads_started;
+  fas_threads_started = true;
+  interrupts();
+  if (started) {
+    return;
+  }
+  // The timer thread preempts the manage thread like the stepper ISR
+  // preempts the stepper task. task_stack_size is not used.
+  start_thread(timer_thread, NULL, config.task_priority + 1, config.task_core);
+  start_thread(manage_thread, engine, config.task_priority, config.task_core);
+}
+
+void FastAccelStepperEngine::setOutputSink(FasOutputSink* sink) {
+  noInterrupts();
+  fas_sink = sink;
+  interrupts();
+}
+
+//*************************************************************************************************
+void StepperQueue::init(uint8_t /*queue_num*/, uint8_t step_pin) {
+  noInterrupts();
+  _initVars();
+  this->step_pin = step_pin;
+  timer_active = false;
+  steps_left = 0;
+  interrupts();
+  digitalWrite(step_pin, LOW);
+  pinMode(step_pin, OUTPUT);
+}
+
+void StepperQueue::setStepPulseTicks(uint16_t ticks) {
+  step_pulse_ticks = ticks;
+}
+
+void StepperQueue::startQueue() {
+  noInterrupts();
+  isRunning = true;
+  if (!timer_active) {
+    uint64_t now = get_ticks64();
+    next_event = now;
+    if (start_at_valid) {
+      start_at_valid = false;
+      uint32_t delta = start_at_ticks - (uint32_t)now;
+      // start times in the past are started immediately
+      if (delta < 0x80000000) {
+        next_event += delta;
+      }
+    }
+    steps_left = 0;
+    timer_active = true;
+    pthread_cond_signal(&fas_timer_kick);
+  }
+  interrupts();
+}
+void StepperQueue::forceStop() {
+  noInterrupts();
+  timer_active = false;
+  steps_left = 0;
+  isRunning = false;
+  ticks_at_queue_end = TICKS_FOR_STOPPED_MOTOR;
+  start_at_valid = false;
+
+  // empty the queue. Next entry needs the full form
+  read_idx = next_write_idx;
+  period_at_queue_end_valid = false;
+  _rearmQueuedEvents();
+  interrupts();
+}
+uint16_t StepperQueue::stepsInProgress() { return steps_left; }
+
+//*************************************************************************************************
+// Output sinks
+FasRecorderSink::FasRecorderSink(struct fas_output_event_s* buffer,
+                                 uint32_t size) {
+  _buffer = buffer;
+  _size = size;
+  _count = 0;
+  pthread_mutex_init(&_mutex, NULL);
+}
+void FasRecorderSink::_add(uint32_t ticks, uint8_t pin, bool step, bool high) {
+  pthread_mutex_lock(&_mutex);
+  if (_count < _size) {
+    struct fas_output_event_s* ev = &_buffer[_count];
+    ev->ticks = ticks;
+    ev->pin = pin;
+    ev->step = step;
+    ev->high = high;
+    _count = _count + 1;
+  }
+  pthread_mutex_unlock(&_mutex);
+}
+void FasRecorderSink::step(uint8_t step_pin, uint32_t ticks,
+                           uint16_t /*pulse_ticks*/) {
+  _add(ticks, step_pin, true, true);
+}
+void FasRecorderSink::pinWrite(uint8_t pin, bool high, uint32_t ticks) {
+  _add(ticks, pin, false, high);
+}
+void FasRecorderSink::clear() {
+  pthread_mutex_lock(&_mutex);
+  _count = 0;
+  pthread_mutex_unlock(&_mutex);
+}
+
+FasFileSink::FasFileSink(FILE* file) {
+  _file = file;
+  pthread_mutex_init(&_mutex, NULL);
+}
+void FasFileSink::step(uint8_t step_pin, uint32_t ticks,
+                       uint16_t /*pulse_ticks*/) {
+  pthread_mutex_lock(&_mutex);
+  fprintf(_file, "%u S %u\n", ticks, step_pin);
+  pthread_mutex_unlock(&_mutex);
+}
+void FasFileSink::pinWrite(uint8_t pin, bool high, uint32_t ticks) {
+  pthread_mutex_lock(&_mutex);
+  fprintf(_file, "%u P %u %d\n", ticks, pin, high ? 1 : 0);
+  pthread_mutex_unlock(&_mutex);
+}
+
+FasGpioChipSink::FasGpioChipSink(const char* chip_path) {
+  _chip_fd = open(chip_path, O_RDWR | O_CLOEXEC);
+  for (uint16_t i = 0; i < 256; i++) {
+    _line_fd[i] = -1;
+  }
+  pthread_mutex_init(&_mutex, NULL);
+}
+FasGpioChipSink::~FasGpioChipSink() {
+  for (uint16_t i = 0; i < 256; i++) {
+    if (_line_fd[i] >= 0) {
+      close(_line_fd[i]);
+    }
+  }
+  if (_chip_fd >= 0) {
+    close(_chip_fd);
+  }
+}
+// The line is requested as output on first use
+int FasGpioChipSink::_lineFd(uint8_t pin) {
+  pthread_mutex_lock(&_mutex);
+  int fd = _line_fd[pin];
+  if ((fd < 0) && (_chip_fd >= 0)) {
+    struct gpiohandle_request req;
+    memset(&req, 0, sizeof(req));
+    req.lineoffsets[0] = pin;
+    req.lines = 1;
+    req.flags = GPIOHANDLE_REQUEST_OUTPUT;
+    strncpy(req.consumer_label, "FastAccelStepper",
+            sizeof(req.consumer_label) - 1);
+    if (ioctl(_chip_fd, GPIO_GET_LINEHANDLE_IOCTL, &req) == 0) {
+      fd = req.fd;
+      _line_fd[pin] = fd;
+    }
+  }
+  pthread_mutex_unlock(&_mutex);
+  return fd;
+}
+void FasGpioChipSink::_setLine(int fd, bool high) {
+  struct gpiohandle_data data;
+  memset(&data, 0, sizeof(data));
+  data.values[0] = high ? 1 : 0;
+  ioctl(fd, GPIOHANDLE_SET_LINE_VALUES_IOCTL, &data);
+}
+void FasGpioChipSink::step(uint8_t step_pin, uint32_t /*ticks*/,
+                           uint16_t pulse_ticks) {
+  int fd = _lineFd(step_pin);
+  if (fd < 0) {
+    return;
+  }
+  _setLine(fd, true);
+  uint64_t end = get_ticks64() + pulse_ticks;
+  while (get_ticks64() < end) {
+  }
+  _setLine(fd, false);
+}
+void FasGpioChipSink::pinWrite(uint8_t pin, bool high, uint32_t /*ticks*/) {
+  int fd = _lineFd(pin);
+  if (fd >= 0) {
+    _setLine(fd, high);
+  }
+}
+#endif
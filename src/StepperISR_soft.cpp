@@ -0,0 +1,338 @@
+#include "FastAccelStepper.h"
+#include "StepperISR.h"
+
+#if (FAS_SOFT_TIMER == 1)
+
+// Software timer channels
+//
+// Steppers beyond the hardware channels are driven by one timer interrupt.
+// The scheduled channels are kept in a min-heap ordered by the time of their
+// next event. The interrupt performs all due events, re-sorts the affected
+// channels and arms the timer for the earliest remaining one.
+//
+// An event either starts the next queue entry or performs a step. Like on
+// avr, the first step of an entry follows the entry start by one period.
+// The step pins of all due channels are raised first and lowered together
+// after busy waiting the longest step_pulse_ticks once, so these channels
+// are meant for slow steppers.
+//
+// The queue entries are consumed with the semantics of the hardware channels
+// of the architecture: avr keeps read_idx at the entry in progress and counts
+// down its steps in the queue, esp32 advances read_idx on entry start.
+
+#if defined(ARDUINO_ARCH_ESP32)
+// The interrupt may run on the other core
+static portMUX_TYPE soft_mux = portMUX_INITIALIZER_UNLOCKED;
+#define SOFT_LOCK() portENTER_CRITICAL(&soft_mux)
+#define SOFT_UNLOCK() portEXIT_CRITICAL(&soft_mux)
+#define SOFT_LOCK_ISR() portENTER_CRITICAL_ISR(&soft_mux)
+#define SOFT_UNLOCK_ISR() portEXIT_CRITICAL_ISR(&soft_mux)
+#define SOFT_IRAM IRAM_ATTR
+#else
+// single core: the interrupt does not nest
+#define SOFT_LOCK() noInterrupts()
+#define SOFT_UNLOCK() interrupts()
+#define SOFT_LOCK_ISR()
+#define SOFT_UNLOCK_ISR()
+#define SOFT_IRAM
+#endif
+
+static uint8_t soft_heap[FAS_SOFT_CHANNELS];
+static uint8_t soft_heap_size = 0;
+static bool soft_timer_initialized = false;
+
+//*************************************************************************************************
+// The times wrap around, so they are compared by their difference
+static SOFT_IRAM bool soft_before(uint8_t a, uint8_t b) {
+  int32_t delta = fas_queue[soft_heap[a]].soft_next_ticks -
+                  fas_queue[soft_heap[b]].soft_next_ticks;
+  return delta < 0;
+}
+static SOFT_IRAM void soft_swap(uint8_t a, uint8_t b) {
+  uint8_t qa = soft_heap[a];
+  uint8_t qb = soft_heap[b];
+  soft_heap[a] = qb;
+  soft_heap[b] = qa;
+  fas_queue[qb].soft_heap_pos = a;
+  fas_queue[qa].soft_heap_pos = b;
+}
+static SOFT_IRAM void soft_sift_up(uint8_t pos) {
+  while (pos > 0) {
+    uint8_t parent = (pos - 1) >> 1;
+    if (!soft_before(pos, parent)) {
+      return;
+    }
+    soft_swap(pos, parent);
+    pos = parent;
+  }
+}
+static SOFT_IRAM void soft_sift_down(uint8_t pos) {
+  while (true) {
+    uint8_t first = pos;
+    uint8_t child = 2 * pos + 1;
+    if ((child < soft_heap_size) && soft_before(child, first)) {
+      first = child;
+    }
+    child++;
+    if ((child < soft_heap_size) && soft_before(child, first)) {
+      first = child;
+    }
+    if (first == pos) {
+      return;
+    }
+    soft_swap(pos, first);
+    pos = first;
+  }
+}
+static void soft_heap_insert(uint8_t queue_num) {
+  uint8_t pos = soft_heap_size++;
+  soft_heap[pos] = queue_num;
+  fas_queue[queue_num].soft_heap_pos = pos;
+  soft_sift_up(pos);
+}
+static SOFT_IRAM void soft_heap_remove(uint8_t pos) {
+  fas_queue[soft_heap[pos]].soft_heap_pos = SOFT_NOT_SCHEDULED;
+  uint8_t last = --soft_heap_size;
+  if (pos == last) {
+    return;
+  }
+  soft_heap[pos] = soft_heap[last];
+  fas_queue[soft_heap[pos]].soft_heap_pos = pos;
+  soft_sift_down(pos);
+  soft_sift_up(pos);
+}
+static SOFT_IRAM void soft_arm(uint32_t now) {
+  if (soft_heap_size == 0) {
+    fas_soft_timer_disarm();
+    return;
+  }
+  uint32_t delta = fas_queue[soft_heap[0]].soft_next_ticks - now;
+  if (delta >= 0x80000000) {
+    // already due
+    delta = 0;
+  }
+  fas_soft_timer_arm(delta);
+}
+
+//*************************************************************************************************
+// State of one interrupt. The callbacks of the fired position events are
+// called after leaving the critical section. Each queue has at most
+// POSITION_EVENTS events.
+#define SOFT_FIRED_MAX (FAS_SOFT_CHANNELS * POSITION_EVENTS)
+struct soft_isr_s {
+  bool refill;
+  uint8_t n_fired;
+  position_event_callback_t callback[SOFT_FIRED_MAX];
+  void* arg[SOFT_FIRED_MAX];
+  // channels with raised step pin and the longest pulse of these
+  uint8_t n_high;
+  uint16_t pulse_ticks;
+  StepperQueue* high[FAS_SOFT_CHANNELS];
+};
+
+static SOFT_IRAM void soft_pulse_end(struct soft_isr_s* isr) {
+  if (isr->n_high == 0) {
+    return;
+  }
+  fas_soft_pulse_wait(isr->pulse_ticks);
+  for (uint8_t i = 0; i < isr->n_high; i++) {
+    isr->high[i]->softStepPin(false);
+  }
+  isr->n_high = 0;
+  isr->pulse_ticks = 0;
+}
+
+// Ends the pending pulses, if the step pin of q is still high. This happens
+// on a late interrupt, which performs two events of the same channel.
+static SOFT_IRAM void soft_pulse_end_of(struct soft_isr_s* isr,
+                                        StepperQueue* q) {
+  for (uint8_t i = 0; i < isr->n_high; i++) {
+    if (isr->high[i] == q) {
+      soft_pulse_end(isr);
+      return;
+    }
+  }
+}
+
+// Performs the due event of the queue. Returns false, if the queue has run
+// empty and is stopped. isr->refill is set on low queue level.
+static SOFT_IRAM bool soft_event(StepperQueue* q, struct soft_isr_s* isr) {
+  uint8_t rp = q->read_idx;
+  if (q->soft_steps_left > 0) {
+    soft_pulse_end_of(isr, q);
+    q->softStepPin(true);
+    isr->high[isr->n_high++] = q;
+    if (q->step_pulse_ticks > isr->pulse_ticks) {
+      isr->pulse_ticks = q->step_pulse_ticks;
+    }
+    uint16_t steps = --q->soft_steps_left;
+#if defined(ARDUINO_ARCH_AVR)
+    // The remaining steps are kept in the queue like in the avr ISR. The
+    // high byte is written first for positionBefore().
+    union queue_unit* u = &q->entry[rp & q->queue_len_mask];
+    uint8_t units = QUEUE_ENTRY_UNITS(u->cmd.code);
+    if (units == 3) {
+      q->entry[(rp + 2) & q->queue_len_mask].ext.steps_hi = steps >> 8;
+    }
+    u->cmd.steps = steps & 0xff;
+#endif
+    if (steps > 0) {
+      q->soft_next_ticks += q->soft_entry_ticks;
+      return true;
+    }
+    if (q->entry_event) {
+      q->entry_event = false;
+      struct position_event_s* ev = q->takePositionEvent(q->soft_next_ticks);
+      if ((ev->callback != NULL) && (isr->n_fired < SOFT_FIRED_MAX)) {
+        isr->callback[isr->n_fired] = ev->callback;
+        isr->arg[isr->n_fired++] = ev->arg;
+      }
+    }
+#if defined(ARDUINO_ARCH_AVR)
+    rp += units;
+    fas_idx_store(q->read_idx, rp);
+    if (q->isBelowLowWatermark(rp)) {
+      isr->refill = true;
+    }
+#endif
+  }
+  if (rp == fas_idx_load(q->next_write_idx)) {
+    // The producer checks for a stopped queue after publishing. So either
+    // it sees isRunning false and starts the queue or the new entry is seen
+    // here.
+    q->isRunning = false;
+    fas_memory_fence();
+    if (rp == fas_idx_load(q->next_write_idx)) {
+      q->ticks_at_queue_end = TICKS_FOR_STOPPED_MOTOR;
+      return false;
+    }
+    q->isRunning = true;
+  }
+  struct queue_entry e;
+  uint8_t units = q->decodeEntry(rp, &e);
+#if !defined(ARDUINO_ARCH_AVR)
+  // release the entry only after it has been read
+  rp += units;
+  fas_idx_store(q->read_idx, rp);
+  if (q->isBelowLowWatermark(rp)) {
+    isr->refill = true;
+  }
+#else
+  (void)units;
+#endif
+  if (e.toggle_dir) {
+    soft_pulse_end_of(isr, q);
+    q->toggleDirPin();
+  }
+  q->entry_event = e.event;
+  uint32_t ticks = e.n_periods;
+  ticks *= PERIOD_TICKS;
+  ticks += e.period;
+  q->soft_entry_ticks = ticks;
+  q->soft_steps_left = e.steps;
+  q->soft_next_ticks += ticks;
+  return true;
+}
+
+void SOFT_IRAM fas_soft_timer_isr(uint32_t now) {
+  struct soft_isr_s isr;
+  isr.refill = false;
+  isr.n_fired = 0;
+  isr.n_high = 0;
+  isr.pulse_ticks = 0;
+  SOFT_LOCK_ISR();
+  // Each event moves the time of its queue ahead, so this terminates even
+  // if the interrupt is late
+  while (soft_heap_size > 0) {
+    StepperQueue* q = &fas_queue[soft_heap[0]];
+    int32_t due = now - q->soft_next_ticks;
+    if (due < 0) {
+      break;
+    }
+    if (soft_event(q, &isr)) {
+      soft_sift_down(0);
+    } else {
+      soft_heap_remove(0);
+    }
+  }
+  soft_pulse_end(&isr);
+  soft_arm(now);
+  SOFT_UNLOCK_ISR();
+  for (uint8_t i = 0; i < isr.n_fired; i++) {
+    isr.callback[i](isr.arg[i]);
+  }
+  if (isr.refill) {
+#if defined(ARDUINO_ARCH_ESP32)
+    if (fas_stepper_task != NULL) {
+      BaseType_t woken = pdFALSE;
+      vTaskNotifyGiveFromISR(fas_stepper_task, &woken);
+      if (woken == pdTRUE) {
+        portYIELD_FROM_ISR();
+      }
+    }
+#elif defined(ARDUINO_ARCH_AVR)
+    fas_avr_refill();
+#else
+    fas_refill_pending = true;
+#endif
+  }
+}
+
+//*************************************************************************************************
+void StepperQueue::_softInit(uint8_t step_pin) {
+  _initVars();
+  isSoft = true;
+  soft_heap_pos = SOFT_NOT_SCHEDULED;
+  soft_steps_left = 0;
+  step_pulse_ticks = DEFAULT_SOFT_STEP_PULSE_TICKS;
+  digitalWrite(step_pin, LOW);
+  pinMode(step_pin, OUTPUT);
+  setSoftStepPin(step_pin);
+  // The timer is only taken, if a software timer channel is in use
+  if (!soft_timer_initialized) {
+    soft_timer_initialized = true;
+    fas_soft_timer_init();
+  }
+}
+
+void StepperQueue::_softStartQueue() {
+  SOFT_LOCK();
+  isRunning = true;
+  if (soft_heap_pos == SOFT_NOT_SCHEDULED) {
+    uint32_t now = fas_get_ticks();
+    soft_next_ticks = now;
+    if (start_at_valid) {
+      start_at_valid = false;
+      uint32_t delta = start_at_ticks - now;
+      // start times in the past are started immediately
+      if (delta < 0x80000000) {
+        soft_next_ticks = start_at_ticks;
+      }
+    }
+    soft_steps_left = 0;
+    soft_heap_insert(this - fas_queue);
+    if (soft_heap_pos == 0) {
+      // the earliest event has changed
+      soft_arm(now);
+    }
+  }
+  SOFT_UNLOCK();
+}
+
+void StepperQueue::_softForceStop() {
+  SOFT_LOCK();
+  if (soft_heap_pos != SOFT_NOT_SCHEDULED) {
+    soft_heap_remove(soft_heap_pos);
+  }
+  soft_steps_left = 0;
+  isRunning = false;
+  ticks_at_queue_end = TICKS_FOR_STOPPED_MOTOR;
+  start_at_valid = false;
+
+  // empty the queue. Next entry needs the full form
+  read_idx = next_write_idx;
+  period_at_queue_end_valid = false;
+  _rearmQueuedEvents();
+  SOFT_UNLOCK();
+}
+#endif
@@ -0,0 +1 @@
+../src/FasGcode.cpp
\ No newline at end of file
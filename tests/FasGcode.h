@@ -0,0 +1 @@
+../src/FasGcode.h
\ No newline at end of file
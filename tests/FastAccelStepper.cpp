@@ -0,0 +1 @@
+../src/FastAccelStepper.cpp
\ No newline at end of file
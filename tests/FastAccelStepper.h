@@ -0,0 +1 @@
+../src/FastAccelStepper.h
\ No newline at end of file
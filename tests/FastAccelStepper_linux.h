@@ -0,0 +1 @@
+../src/FastAccelStepper_linux.h
\ No newline at end of file
@@ -0,0 +1 @@
+../src/PoorManFloat.cpp
\ No newline at end of file
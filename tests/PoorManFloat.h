@@ -0,0 +1 @@
+../src/PoorManFloat.h
\ No newline at end of file
@@ -0,0 +1 @@
+../src/PoorManFloat_tables.h
\ No newline at end of file
@@ -0,0 +1 @@
+../src/RampGenerator.cpp
\ No newline at end of file
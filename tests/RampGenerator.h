@@ -0,0 +1 @@
+../src/RampGenerator.h
\ No newline at end of file
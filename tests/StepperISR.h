@@ -0,0 +1 @@
+../src/StepperISR.h
\ No newline at end of file
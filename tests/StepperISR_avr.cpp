@@ -0,0 +1 @@
+../src/StepperISR_avr.cpp
\ No newline at end of file
@@ -0,0 +1 @@
+../src/StepperISR_esp32.cpp
\ No newline at end of file
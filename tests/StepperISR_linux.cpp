@@ -0,0 +1 @@
+../src/StepperISR_linux.cpp
\ No newline at end of file
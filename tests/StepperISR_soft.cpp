@@ -0,0 +1 @@
+../src/StepperISR_soft.cpp
\ No newline at end of file
@@ -5,11 +5,74 @@
 // Here are the global variables to interface with the interrupts
 //StepperQueue fas_queue[NUM_QUEUES];
 
+volatile bool fas_refill_pending = false;
+
+// Virtual time for fas_get_ticks(), which is advanced by the tests
+uint32_t fas_virtual_ticks = 0;
+
+uint32_t fas_get_ticks() {
+	return fas_virtual_ticks;
+}
+
 void StepperQueue::init(uint8_t queue_num, uint8_t step_pin) {
+	isSoft = (queue_num >= NUM_HW_QUEUES);
+	if (isSoft) {
+		_softInit(step_pin);
+		return;
+	}
 	_initVars();
 }
+void StepperQueue::setStepPulseTicks(uint16_t ticks) {
+	step_pulse_ticks = ticks;
+}
 void StepperQueue::startQueue() {
+	if (isSoft) {
+		_softStartQueue();
+		return;
+	}
 	isRunning = true;
+	started_at_ticks = fas_virtual_ticks;
+	if (start_at_valid) {
+		start_at_valid = false;
+		uint32_t delta = start_at_ticks - fas_virtual_ticks;
+		// start times in the past are started immediately
+		if (delta < 0x80000000) {
+			started_at_ticks = start_at_ticks;
+		}
+	}
 }
 void StepperQueue::forceStop() {
+	if (isSoft) {
+		_softForceStop();
+		return;
+	}
+	start_at_valid = false;
+}
+uint16_t StepperQueue::stepsInProgress() {
+	// The hardware channels of the tests keep read_idx at the entry in
+	// progress
+	if (isSoft) {
+		return soft_steps_left;
+	}
+	return 0;
+}
+
+// The software timer is armed with the delay to the next call of
+// fas_soft_timer_isr(), which is done by the tests
+bool fas_soft_timer_armed = false;
+uint32_t fas_soft_timer_delta = 0;
+// Number of busy waits for the end of the step pulses
+uint16_t fas_soft_pulse_waits = 0;
+
+void fas_soft_timer_init() {
+}
+void fas_soft_timer_arm(uint32_t delta_ticks) {
+	fas_soft_timer_armed = true;
+	fas_soft_timer_delta = delta_ticks;
+}
+void fas_soft_timer_disarm() {
+	fas_soft_timer_armed = false;
+}
+void fas_soft_pulse_wait(uint16_t ticks) {
+	fas_soft_pulse_waits++;
 }
@@ -3,6 +3,7 @@
 
 #define PROGMEM
 #define pgm_read_byte_near(x) (*(x))
+#define pgm_read_word_near(x) (*(x))
 
 // For inducing interrupts while testing
 void noInterrupts();
@@ -1,6 +1,7 @@
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "FastAccelStepper.h"
 #include "StepperISR.h"
@@ -14,9 +15,26 @@ unsigned short OCR1A;
 unsigned short OCR1B;
 
 StepperQueue fas_queue[NUM_QUEUES];
+StepperQueueBuffer<QUEUE_LEN> fas_queue_buffer[NUM_QUEUES];
+
+// Records the order, in which the queues are filled
+bool record_fill_order = false;
+uint8_t fill_order[100];
+uint8_t fill_order_len;
+uint8_t last_write_idx[NUM_QUEUES];
+void record_fill() {
+  for (uint8_t i = 0; i < NUM_QUEUES; i++) {
+    if (fas_queue[i].next_write_idx != last_write_idx[i]) {
+      last_write_idx[i] = fas_queue[i].next_write_idx;
+      if (record_fill_order && (fill_order_len < 100)) {
+        fill_order[fill_order_len++] = i;
+      }
+    }
+  }
+}
 
 void inject_fill_interrupt(int mark) {}
-void noInterrupts() {}
+void noInterrupts() { record_fill(); }
 void interrupts() {}
 
 void init_queue() {
@@ -24,6 +42,8 @@ void init_queue() {
   fas_queue[0].next_write_idx = 0;
   fas_queue[1].read_idx = 0;
   fas_queue[1].next_write_idx = 0;
+  fas_queue[0].attachBuffer(fas_queue_buffer[0].entry, QUEUE_LEN);
+  fas_queue[1].attachBuffer(fas_queue_buffer[1].entry, QUEUE_LEN);
 }
 
 void basic_test() {
@@ -44,20 +64,321 @@ void queue_full() {
   assert(0 == s.getCurrentPosition());
   assert(s.isQueueEmpty());
   assert(s.isQueueEmpty());
-  printf("Queue read/write = %d/%d\n", fas_queue[0].read_idx,
-         fas_queue[0].next_write_idx);
-  for (int i = 0; i < QUEUE_LEN - 1; i++) {
-    s.addQueueEntry(10000, 100, true);
+  // alternating periods need the full form with 2 units per entry
+  int n = 0;
+  while (!s.isQueueFull()) {
+    test(s.addQueueEntry(10000 + (n & 1) * 1000, 100, true) == AQE_OK,
+         "entry not accepted");
     assert(!s.isQueueEmpty());
-    assert(!s.isQueueFull());
     printf("Queue read/write = %d/%d\n", fas_queue[0].read_idx,
            fas_queue[0].next_write_idx);
+    n++;
   }
-  s.addQueueEntry(10000, 100, true);
-  printf("Queue read/write = %d/%d\n", fas_queue[0].read_idx,
-         fas_queue[0].next_write_idx);
-  assert(!s.isQueueEmpty());
+  test(n == QUEUE_LEN / 2 - 1, "wrong queue capacity for full form");
+  test(s.addQueueEntry(10000, 100, true) == AQE_FULL, "queue should be full");
+  puts("...done");
+}
+
+void compact_queue_full() {
+  puts("compact_queue_full...");
+  init_queue();
+  FastAccelStepper s = FastAccelStepper();
+  s.init(0, 0);
+  // first entry is in full form, all others are compact with 1 unit
+  int n = 0;
+  while (!s.isQueueFull()) {
+    test(s.addQueueEntry(10000 - n, 100, true) == AQE_OK, "entry not accepted");
+    n++;
+  }
+  test(n == QUEUE_LEN - 3, "wrong queue capacity for compact form");
+  test(s.addQueueEntry(10000, 100, true) == AQE_FULL, "queue should be full");
+  puts("...done");
+}
+
+void small_queue_full() {
+  puts("small_queue_full...");
+  init_queue();
+  StepperQueueBuffer<8> small_buffer;
+  fas_queue[0].attachBuffer(small_buffer.entry, 8);
+  FastAccelStepper s = FastAccelStepper();
+  s.init(0, 0);
+  for (int i = 0; i < 4; i++) {
+    test(s.addQueueEntry(10000, 100, true) == AQE_OK, "entry not accepted");
+    assert(!s.isQueueFull());
+  }
+  test(s.addQueueEntry(10000, 100, true) == AQE_OK, "last entry not accepted");
+  assert(s.isQueueFull());
+  test(s.addQueueEntry(10000, 100, true) == AQE_FULL, "queue should be full");
+  test(s.getPositionAfterCommandsCompleted() == 500, "wrong end position");
+  test(s.getCurrentPosition() == 0, "wrong current position");
+  puts("...done");
+}
+
+void encoding_test() {
+  puts("encoding_test...");
+  init_queue();
+  StepperQueueBuffer<128> buffer;
+  fas_queue[0].attachBuffer(buffer.entry, 128);
+  FastAccelStepper s = FastAccelStepper();
+  s.init(0, 0);
+  struct {
+    uint32_t ticks;
+    uint16_t steps;
+    bool dir;
+    uint8_t units;
+  } cmds[] = {
+      {10000, 1, true, 2},    // first entry needs full form
+      {10000, 2, true, 1},    // repeat
+      {10063, 3, true, 1},    // max positive delta
+      {9999, 4, true, 1},     // max negative delta
+      {10063, 5, true, 2},    // delta too large
+      {10063, 6, false, 2},   // direction change
+      {10000, 7, false, 1},   //
+      {100000, 8, false, 3},  // n_periods > 0
+      {37520, 9, false, 1},   // delta to period of previous entry
+      {37520, 10, true, 2},   // direction change
+      {200, 127, true, 2},    // delta too large
+      {200, 255, true, 1},    // max steps for compact form
+      {200, 256, true, 3},    // 16 bit step count
+      {200, 65535, true, 3},  // max 16 bit step count
+      {100000, 1000, true, 3},
+  };
+  int n = sizeof(cmds) / sizeof(cmds[0]);
+  int32_t pos = 0;
+  for (int i = 0; i < n; i++) {
+    uint8_t wp = fas_queue[0].next_write_idx;
+    test(s.addQueueEntry(cmds[i].ticks, cmds[i].steps, cmds[i].dir) == AQE_OK,
+         "entry not accepted");
+    printf("entry %d: %d units\n", i, fas_queue[0].next_write_idx - wp);
+    test((uint8_t)(fas_queue[0].next_write_idx - wp) == cmds[i].units,
+         "wrong number of units");
+    pos += cmds[i].dir ? cmds[i].steps : -cmds[i].steps;
+  }
+  test(s.getPositionAfterCommandsCompleted() == pos, "wrong end position");
+
+  // consume the entries like the esp32 ISR
+  bool dir = true;
+  pos = 0;
+  for (int i = 0; i < n; i++) {
+    test(s.getCurrentPosition() == pos, "wrong current position");
+    struct queue_entry e;
+    fas_queue[0].read_idx +=
+        fas_queue[0].decodeEntry(fas_queue[0].read_idx, &e);
+    test(e.steps == cmds[i].steps, "wrong steps");
+    test(e.toggle_dir == (dir != cmds[i].dir), "wrong direction toggle");
+    test(e.n_periods * PERIOD_TICKS + e.period == cmds[i].ticks,
+         "wrong ticks");
+    dir = cmds[i].dir;
+    pos += cmds[i].dir ? cmds[i].steps : -cmds[i].steps;
+  }
+  test(s.isQueueEmpty(), "queue should be empty");
+  test(s.getCurrentPosition() == pos, "wrong current position");
+  puts("...done");
+}
+
+void bulk_test() {
+  puts("bulk_test...");
+  init_queue();
+  FastAccelStepper s = FastAccelStepper();
+  s.init(0, 0);
+  struct stepper_command_s cmd[40];
+  for (int i = 0; i < 40; i++) {
+    cmd[i].ticks = 10000 + i;
+    cmd[i].steps = 10;
+    cmd[i].dir_high = true;
+  }
+  // invalid command stops the batch
+  cmd[3].steps = 0;
+  test(s.addQueueEntries(cmd, 40) == 3, "batch should stop at invalid entry");
+  test(s.addQueueEntry(cmd[3].ticks, cmd[3].steps, cmd[3].dir_high) ==
+           AQE_STEPS_ERROR,
+       "wrong error code");
+  test(s.getPositionAfterCommandsCompleted() == 30, "wrong end position");
+  cmd[3].steps = 10;
+  // the batch is limited by the queue space
+  test(s.addQueueEntries(&cmd[3], 37) == QUEUE_LEN - 3 - 3,
+       "batch should stop on full queue");
   assert(s.isQueueFull());
+  test(s.addQueueEntries(cmd, 40) == 0, "no entry should be accepted");
+  test(s.getPositionAfterCommandsCompleted() == 10 * (QUEUE_LEN - 3),
+       "wrong end position");
+
+  // the queue content matches single addQueueEntry() calls
+  init_queue();
+  s.init(0, 0);
+  FastAccelStepper s1 = FastAccelStepper();
+  s1.init(1, 1);
+  cmd[5].dir_high = false;
+  cmd[9].ticks = 100000;
+  test(s.addQueueEntries(cmd, 12) == 12, "batch not accepted");
+  for (int i = 0; i < 12; i++) {
+    test(s1.addQueueEntry(cmd[i].ticks, cmd[i].steps, cmd[i].dir_high) ==
+             AQE_OK,
+         "entry not accepted");
+  }
+  test(fas_queue[0].next_write_idx == fas_queue[1].next_write_idx,
+       "different queue usage");
+  test(memcmp(fas_queue[0].entry, fas_queue[1].entry,
+              fas_queue[0].next_write_idx * sizeof(union queue_unit)) == 0,
+       "different queue content");
+  test(s.getPositionAfterCommandsCompleted() ==
+           s1.getPositionAfterCommandsCompleted(),
+       "different end position");
+  puts("...done");
+}
+
+void start_time_test() {
+  puts("start_time_test...");
+  init_queue();
+  FastAccelStepperEngine engine = FastAccelStepperEngine();
+  FastAccelStepper s0 = FastAccelStepper();
+  FastAccelStepper s1 = FastAccelStepper();
+  s0.init(0, 0);
+  s1.init(1, 1);
+
+  // both steppers are started by loop() at different times
+  fas_virtual_ticks = 1000;
+  test(engine.getTicks() == 1000, "wrong time base");
+  test(s0.setStartTime(50000), "start time not accepted");
+  test(s0.addQueueEntry(10000, 10, true) == AQE_OK, "entry not accepted");
+  test(!s0.setStartTime(60000), "start time accepted for running stepper");
+  fas_virtual_ticks = 3000;
+  test(s1.setStartTime(50000), "start time not accepted");
+  test(s1.addQueueEntry(10000, 10, true) == AQE_OK, "entry not accepted");
+  test(fas_queue[0].started_at_ticks == 50000, "wrong start time");
+  test(fas_queue[1].started_at_ticks == 50000, "wrong start time");
+
+  // start time is used only once
+  init_queue();
+  s0.init(0, 0);
+  s1.init(1, 1);
+  test(s0.setStartTime(2000), "start time not accepted");
+  test(s0.addQueueEntry(10000, 10, true) == AQE_OK, "entry not accepted");
+  test(fas_queue[0].started_at_ticks == 3000, "past start time not immediate");
+  fas_queue[0].isRunning = false;
+  test(s0.addQueueEntry(10000, 10, true) == AQE_OK, "entry not accepted");
+  test(fas_queue[0].started_at_ticks == 3000, "wrong start time");
+
+  // start time wraps around
+  fas_virtual_ticks = 0xfffff000;
+  test(s1.setStartTime(0x1000), "start time not accepted");
+  test(s1.addQueueEntry(10000, 10, true) == AQE_OK, "entry not accepted");
+  test(fas_queue[1].started_at_ticks == 0x1000, "wrong start time on wrap");
+  fas_virtual_ticks = 0;
+  puts("...done");
+}
+
+// Returns the time of the timer 1 match, which starts the first entry of an
+// avr hardware channel, like the hold-off of AVR_STEPPER_ISR
+static uint32_t avr_start_at(uint32_t now, struct avr_start_s* s) {
+  uint16_t ocr = s->ocr;
+  uint16_t d = ocr - (uint16_t)now;
+  test(d >= AVR_START_MIN_TICKS, "compare value too close to the timer");
+  uint32_t t = now + d;
+  uint8_t hold_off = s->hold_off;
+  while (hold_off > 0) {
+    if ((--hold_off == 0) && s->hold_half) {
+      ocr += 0x8000;
+      t += 0x8000;
+    } else {
+      t += 0x10000;
+    }
+  }
+  return t;
+}
+
+void avr_start_test() {
+  puts("avr_start_test...");
+  const uint32_t nows[] = {0, 0x1234, 0xffd0, 0x1fff0, 0xfffffff0};
+  const uint32_t deltas[] = {40,      41,      0xffff,   0x10000,
+                             0x10005, 0x10027, 0x10028,  0x30001,
+                             0x30027, 0x3ffff, 0xff0010, 0xff0030};
+  for (uint8_t i = 0; i < sizeof(nows) / sizeof(nows[0]); i++) {
+    for (uint8_t j = 0; j < sizeof(deltas) / sizeof(deltas[0]); j++) {
+      struct avr_start_s s;
+      uint32_t start = nows[i] + deltas[j];
+      fas_avr_plan_start(nows[i], start, &s);
+      test(avr_start_at(nows[i], &s) == start, "avr start not in time");
+    }
+    // past and too close start times are started immediately
+    struct avr_start_s s;
+    fas_avr_plan_start(nows[i], nows[i] + 39, &s);
+    test(avr_start_at(nows[i], &s) == nows[i] + AVR_START_MIN_TICKS,
+         "close start time not immediate");
+    fas_avr_plan_start(nows[i], nows[i] - 1, &s);
+    test(avr_start_at(nows[i], &s) == nows[i] + AVR_START_MIN_TICKS,
+         "past start time not immediate");
+  }
+  puts("...done");
+}
+
+void esp32_start_set_test() {
+  puts("esp32_start_set_test...");
+  struct fas_start_set_s set;
+  set.members = 0;
+  // The members of a group share the timer of the first one
+  uint32_t start = 0xfffff000;  // across the wrap around
+  test(fas_start_set_add(&set, 0, start) == FAS_START_SET_ARM, "not armed");
+  test(fas_start_set_add(&set, 1, start) == FAS_START_SET_JOINED,
+       "not joined");
+  test(fas_start_set_add(&set, 2, start + 1) == FAS_START_SET_BUSY,
+       "other start time joined");
+  // a member without command joins with its first command
+  test(fas_start_set_add(&set, 5, start) == FAS_START_SET_JOINED,
+       "late member not joined");
+  fas_start_set_remove(&set, 1);
+
+  // A callback of a previous set leaves the members alone
+  test(fas_start_set_take(&set, start - TICKS_PER_S / 10000) == 0,
+       "taken by the callback of another set");
+  test(set.members == 0x21, "members lost");
+  // All members are started by one callback, so they start in the same
+  // tick, even if the timer fires up to 1us early
+  uint8_t members = fas_start_set_take(&set, start - TICKS_PER_S / 1000000);
+  test(members == 0x21, "members not started together");
+  test(set.members == 0, "set not emptied");
+  test(fas_start_set_add(&set, 2, start + 2000) == FAS_START_SET_ARM,
+       "emptied set not reused");
+  puts("...done");
+}
+
+void group_test() {
+  puts("group_test...");
+  init_queue();
+  FastAccelStepperEngine engine = FastAccelStepperEngine();
+  FastAccelStepper s0 = FastAccelStepper();
+  FastAccelStepper s1 = FastAccelStepper();
+  s0.init(0, 0);
+  s1.init(1, 1);
+  FastAccelStepper* group[2] = {&s0, &s1};
+
+  // armed steppers do not start on addQueueEntry()
+  fas_virtual_ticks = 1000;
+  test(engine.armGroup(group, 2), "group not armed");
+  test(s0.addQueueEntry(10000, 10, true) == AQE_OK, "entry not accepted");
+  fas_virtual_ticks = 2000;
+  test(s1.addQueueEntry(10000, 20, false) == AQE_OK, "entry not accepted");
+  test(s1.addQueueEntry(10000, 30, false) == AQE_OK, "entry not accepted");
+  test(!s0.isRunning() && !s1.isRunning(), "armed stepper is running");
+
+  // both steppers start at the same time
+  fas_virtual_ticks = 3000;
+  engine.startGroup(group, 2);
+  test(s0.isRunning() && s1.isRunning(), "group not started");
+  test(fas_queue[0].started_at_ticks == fas_queue[1].started_at_ticks,
+       "group members started at different times");
+  test(fas_queue[0].started_at_ticks > 3000, "group started too early");
+  test(!engine.armGroup(group, 2), "running group armed");
+
+  // first entry of s0 is in progress and first entry of s1 is done
+  struct queue_entry e;
+  fas_queue[1].read_idx += fas_queue[1].decodeEntry(fas_queue[1].read_idx, &e);
+  engine.forceStopGroup(group, 2);
+  test(s0.isQueueEmpty() && s1.isQueueEmpty(), "queue not empty");
+  test(s0.getCurrentPosition() == 0, "wrong position after stop");
+  test(s1.getCurrentPosition() == -20, "wrong position after stop");
+  test(s1.getPositionAfterCommandsCompleted() == -20, "wrong end position");
+  fas_virtual_ticks = 0;
   puts("...done");
 }
 
@@ -76,15 +397,355 @@ void queue_out_of_range() {
   test(res == AQE_TOO_HIGH, "Too high provided should trigger error");
   assert(s.isQueueEmpty());
 
-  res = s.addQueueEntry(65535, 128, true);
-  test(res == AQE_STEPS_ERROR, "Too high step count should trigger an error");
+  res = s.addQueueEntry(65535, 0, true);
+  test(res == AQE_STEPS_ERROR, "Zero step count should trigger an error");
   assert(s.isQueueEmpty());
 
+  res = s.addQueueEntry(65535, MAX_STEPS_PER_COMMAND, true);
+  test(res == AQE_OK, "Max step count should be accepted");
+  assert(!s.isQueueEmpty());
+
   res = s.addQueueEntry(ABSOLUTE_MAX_TICKS, 100, true);
   test(res == AQE_OK, "In range should be accepted");
   assert(!s.isQueueEmpty());
 }
 
+void dir_pin_test() {
+  puts("dir_pin_test...");
+  init_queue();
+  FastAccelStepper s = FastAccelStepper();
+  s.init(0, 0);
+  // without direction pin a toggle is ignored
+  fas_queue[0].toggleDirPin();
+  test(fas_queue[0].dirPinEdges == 0, "edge without direction pin");
+  s.setDirectionPin(3);
+  test(fas_queue[0].dirPinLevel, "direction pin should start high");
+  bool dir[6] = {true, false, false, true, false, false};
+  for (int i = 0; i < 6; i++) {
+    test(s.addQueueEntry(10000, 10, dir[i]) == AQE_OK, "entry not accepted");
+  }
+  // consume the queue like the stepper ISR
+  while (!s.isQueueEmpty()) {
+    struct queue_entry e;
+    fas_queue[0].read_idx +=
+        fas_queue[0].decodeEntry(fas_queue[0].read_idx, &e);
+    if (e.toggle_dir) {
+      fas_queue[0].toggleDirPin();
+    }
+  }
+  test(fas_queue[0].dirPinEdges == 3, "wrong number of direction edges");
+  test(fas_queue[0].dirPinLevel == fas_queue[0].dir_at_queue_end,
+       "direction pin does not match queue end");
+  puts("...done");
+}
+
+void pulse_and_dir_setup_test() {
+  puts("pulse_and_dir_setup_test...");
+  init_queue();
+  FastAccelStepper s = FastAccelStepper();
+  s.init(0, 0);
+  s.setDirectionPin(3);
+  test(s.setStepPulseWidth(0) == DELAY_TOO_LOW, "pulse width 0 accepted");
+  test(s.setStepPulseWidth(60000) == DELAY_TOO_HIGH, "pulse width too long");
+  test(s.setStepPulseWidth(2500) == DELAY_OK, "pulse width not accepted");
+  test(fas_queue[0].step_pulse_ticks == 40, "wrong pulse ticks");
+  test(s.addQueueEntry(40, 1, true) == AQE_TOO_LOW, "period below pulse");
+  struct stepper_command_s cmd = {40, 1, true};
+  test(s.addQueueEntries(&cmd, 1) == 0, "period below pulse in batch");
+
+  test(s.setDirectionSetupTime(2500) == DELAY_TOO_LOW,
+       "setup not longer than the pulse accepted");
+  test(s.setDirectionSetupTime(50000) == DELAY_OK, "setup not accepted");
+  test(fas_queue[0].dir_setup_ticks == 800, "wrong setup ticks");
+  test(s.addQueueEntry(400, 10, true) == AQE_OK, "entry not accepted");
+  test(s.addQueueEntry(400, 10, false) == AQE_OK, "entry not accepted");
+  test(s.addQueueEntry(400, 1, true) == AQE_OK, "entry not accepted");
+  test(s.addQueueEntry(400, 5, true) == AQE_OK, "entry not accepted");
+  test(s.addQueueEntry(1000, 2, false) == AQE_OK, "entry not accepted");
+  test(s.getPositionAfterCommandsCompleted() == 4, "wrong end position");
+  // the first step after a direction change is delayed
+  uint16_t steps[6] = {10, 1, 9, 1, 5, 2};
+  uint16_t period[6] = {400, 800, 400, 800, 400, 1000};
+  bool toggle[6] = {false, true, false, true, false, true};
+  for (int i = 0; i < 6; i++) {
+    struct queue_entry e;
+    fas_queue[0].read_idx +=
+        fas_queue[0].decodeEntry(fas_queue[0].read_idx, &e);
+    test(e.steps == steps[i], "wrong steps");
+    test(e.period == period[i], "wrong period");
+    test(e.toggle_dir == toggle[i], "wrong direction toggle");
+  }
+  test(s.isQueueEmpty(), "too many entries");
+  puts("...done");
+}
+
+void low_watermark_test() {
+  puts("low_watermark_test...");
+  init_queue();
+  FastAccelStepper s = FastAccelStepper();
+  s.init(0, 0);
+  test(fas_queue[0].low_watermark == 4, "wrong default watermark");
+  s.setQueueLowWatermark(200);
+  test(fas_queue[0].low_watermark == QUEUE_LEN - 1, "watermark not limited");
+  s.setQueueLowWatermark(5);
+  // full entries with 2 units
+  for (int i = 0; i < 4; i++) {
+    test(s.addQueueEntry(10000, 10, (i & 1) == 0) == AQE_OK,
+         "entry not accepted");
+  }
+  // consume the queue like the stepper ISR
+  bool below[4] = {false, true, true, true};
+  for (int i = 0; i < 4; i++) {
+    struct queue_entry e;
+    uint8_t rp = fas_queue[0].read_idx;
+    rp += fas_queue[0].decodeEntry(rp, &e);
+    fas_queue[0].read_idx = rp;
+    test(fas_queue[0].isBelowLowWatermark(rp) == below[i],
+         "wrong low watermark detection");
+  }
+  s.setQueueLowWatermark(0);
+  test(!fas_queue[0].isBelowLowWatermark(fas_queue[0].read_idx),
+       "disabled watermark triggers");
+  puts("...done");
+}
+
+void drain_queue(uint8_t q) {
+  while (fas_queue[q].read_idx != fas_queue[q].next_write_idx) {
+    struct queue_entry e;
+    fas_queue[q].read_idx +=
+        fas_queue[q].decodeEntry(fas_queue[q].read_idx, &e);
+  }
+}
+
+void refill_order_test() {
+  puts("refill_order_test...");
+  FastAccelStepperEngine engine = FastAccelStepperEngine();
+  engine.init();
+  FastAccelStepper* s[2];
+  for (int i = 0; i < 2; i++) {
+    s[i] = engine.stepperConnectToPin(i);
+    test(s[i] != NULL, "stepper not connected");
+    // auto enable calls noInterrupts() for every command
+    s[i]->setAutoEnable(true);
+    s[i]->setSpeed(20);
+    s[i]->setAcceleration(100000);
+    test(s[i]->move(100000) == MOVE_OK, "move not accepted");
+  }
+  engine.manageSteppers();
+
+  // The second stepper has run empty and is refilled first
+  drain_queue(1);
+  record_fill();
+  fill_order_len = 0;
+  record_fill_order = true;
+  engine.manageSteppers();
+  record_fill();
+  record_fill_order = false;
+  test(fill_order_len > 0, "no refill");
+  test(fill_order[0] == 1, "stepper with empty queue is not first");
+
+  // Both empty => the refill alternates
+  drain_queue(0);
+  drain_queue(1);
+  record_fill();
+  fill_order_len = 0;
+  record_fill_order = true;
+  engine.manageSteppers();
+  record_fill();
+  record_fill_order = false;
+  test(fill_order_len >= 10, "no refill");
+  // The first entry of an empty queue counts as in progress, so each
+  // stepper may get two commands in a row.
+  for (int i = 2; i < fill_order_len; i++) {
+    test((fill_order[i] != fill_order[i - 1]) ||
+             (fill_order[i] != fill_order[i - 2]),
+         "refill does not alternate");
+  }
+  for (int i = 0; i < 2; i++) {
+    test(fas_queue[i].hasTicksInQueue(TICKS_PER_S / 100) ||
+             s[i]->isQueueFull(),
+         "queue not refilled");
+  }
+  puts("...done");
+}
+
+extern bool fas_soft_timer_armed;
+extern uint32_t fas_soft_timer_delta;
+extern uint16_t fas_soft_pulse_waits;
+
+// Number of steps on a channel, which starts at time 0 with the given entries
+static uint16_t expected_soft_steps(uint32_t t, const uint32_t* ticks,
+                                    const uint16_t* steps, uint8_t n) {
+  uint16_t res = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    uint32_t k = t / ticks[i];
+    if (k < steps[i]) {
+      return res + k;
+    }
+    res += steps[i];
+    t -= steps[i] * ticks[i];
+  }
+  return res;
+}
+
+static void soft_event_callback(void* arg) { (*(uint16_t*)arg)++; }
+
+void soft_channel_test() {
+  puts("soft_channel_test...");
+  test(NUM_QUEUES == NUM_HW_QUEUES + 2, "no software timer channels");
+  for (uint8_t q = NUM_HW_QUEUES; q < NUM_QUEUES; q++) {
+    fas_queue[q].attachBuffer(fas_queue_buffer[q].entry, QUEUE_LEN);
+    fas_queue[q].init(q, 20 + q);
+    test(fas_queue[q].isSoft, "not a software timer channel");
+  }
+  StepperQueue* q2 = &fas_queue[2];
+  StepperQueue* q3 = &fas_queue[3];
+  q3->setDirPin(30);
+  test(!fas_soft_timer_armed, "timer armed without command");
+
+  // Two channels with different periods share the timer. The first step of
+  // an entry follows the entry start by one period.
+  const uint32_t ticks2[] = {3200};
+  const uint16_t steps2[] = {10};
+  const uint32_t ticks3[] = {8000, 4000};
+  const uint16_t steps3[] = {5, 5};
+  uint32_t t0 = 0xfffff000;  // across the wrap around
+  fas_virtual_ticks = t0;
+  test(q2->addQueueEntry(ticks2[0], steps2[0], true) == AQE_OK, "add failed");
+  test(fas_soft_timer_armed, "timer not armed");
+  test(fas_soft_timer_delta == 0, "start is not immediate");
+  test(q3->addQueueEntry(ticks3[0], steps3[0], true) == AQE_OK, "add failed");
+  test(q3->addQueueEntry(ticks3[1], steps3[1], false) == AQE_OK,
+       "add failed");
+  uint32_t stopped_at[NUM_QUEUES] = {0};
+  uint16_t calls = 0;
+  uint8_t shared_steps = 0;
+  while (fas_soft_timer_armed) {
+    test(calls++ < 100, "too many interrupts");
+    uint16_t pulses = q2->stepPinPulses + q3->stepPinPulses;
+    uint16_t waits = fas_soft_pulse_waits;
+    fas_virtual_ticks += fas_soft_timer_delta;
+    fas_soft_timer_isr(fas_virtual_ticks);
+    // The pulses of all channels stepping together end after one wait
+    pulses = q2->stepPinPulses + q3->stepPinPulses - pulses;
+    test(fas_soft_pulse_waits - waits == (pulses > 0 ? 1 : 0),
+         "not one pulse wait per interrupt");
+    if (pulses == 2) {
+      shared_steps++;
+    }
+    uint32_t t = fas_virtual_ticks - t0;
+    test(q2->stepPinPulses == expected_soft_steps(t, ticks2, steps2, 1),
+         "wrong steps on channel 2");
+    test(q3->stepPinPulses == expected_soft_steps(t, ticks3, steps3, 2),
+         "wrong steps on channel 3");
+    for (uint8_t q = NUM_HW_QUEUES; q < NUM_QUEUES; q++) {
+      if (!fas_queue[q].isRunning && (stopped_at[q] == 0)) {
+        stopped_at[q] = t;
+      }
+    }
+  }
+  test(stopped_at[2] == 32000, "channel 2 stopped at wrong time");
+  test(stopped_at[3] == 60000, "channel 3 stopped at wrong time");
+  test(q3->dirPinEdges == 1, "direction not toggled");
+  // one call per distinct event time: 11 for each channel, 3 are shared
+  test(calls == 19, "interrupt not only at event times");
+  test(shared_steps > 0, "no steps of both channels in one interrupt");
+  test(q2->isQueueEmpty() && q3->isQueueEmpty(), "queues not empty");
+
+  // A forced stop removes the channel from the timer
+  test(q2->addQueueEntry(3200, 10, true) == AQE_OK, "add failed");
+  for (uint8_t i = 0; i < 3; i++) {
+    fas_virtual_ticks += fas_soft_timer_delta;
+    fas_soft_timer_isr(fas_virtual_ticks);
+  }
+  // A late interrupt ends each pulse of a channel before its next step
+  uint16_t pulses = q2->stepPinPulses;
+  uint16_t waits = fas_soft_pulse_waits;
+  fas_virtual_ticks += 2 * 3200;
+  fas_soft_timer_isr(fas_virtual_ticks);
+  test(q2->stepPinPulses - pulses == 2, "late steps missing");
+  test(fas_soft_pulse_waits - waits == 2, "late steps not separated");
+  pulses = q2->stepPinPulses;
+  q2->forceStop();
+  test(!q2->isRunning && q2->isQueueEmpty(), "not stopped");
+  fas_virtual_ticks += 100000;
+  fas_soft_timer_isr(fas_virtual_ticks);
+  test(!fas_soft_timer_armed, "timer still armed");
+  test(q2->stepPinPulses == pulses, "steps after forced stop");
+
+  // The engine connects steppers beyond the hardware channels to these
+  FastAccelStepperEngine engine = FastAccelStepperEngine();
+  engine.init();
+  FastAccelStepper* s[NUM_QUEUES];
+  for (uint8_t i = 0; i < NUM_QUEUES; i++) {
+    s[i] = engine.stepperConnectToPin(i);
+    test(s[i] != NULL, "stepper not connected");
+  }
+  test(engine.stepperConnectToPin(NUM_QUEUES) == NULL,
+       "more steppers than channels");
+  test(!fas_queue[NUM_HW_QUEUES - 1].isSoft, "hardware channel expected");
+  test(fas_queue[NUM_HW_QUEUES].isSoft, "software channel expected");
+
+  // The entry in progress has been released from the queue. Its remaining
+  // steps count for the position, also in the direction before a reversal.
+  FastAccelStepper* ss = s[NUM_HW_QUEUES];
+  ss->setDirectionPin(30);
+  test(ss->addQueueEntry(3200, 10, true) == AQE_OK, "add failed");
+  test(ss->addQueueEntry(3200, 5, false) == AQE_OK, "add failed");
+  for (uint8_t i = 0; i < 4; i++) {
+    fas_virtual_ticks += fas_soft_timer_delta;
+    fas_soft_timer_isr(fas_virtual_ticks);
+  }
+  test(q2->stepPinPulses == 3, "wrong steps on channel 2");
+  test(ss->getCurrentPosition() == 3, "wrong position while running");
+  test(ss->getPositionAfterCommandsCompleted() == 5, "wrong end position");
+  engine.forceStopGroup(&ss, 1);
+  test(!q2->isRunning, "not stopped");
+  test(ss->getCurrentPosition() == 3, "wrong position after stop");
+
+  // A position event is fired at the end of the timer interrupt
+  uint16_t fired = 0;
+  int8_t id = ss->addPositionEvent(5, soft_event_callback, &fired, 31);
+  test(id >= 0, "event not added");
+  test(ss->addQueueEntry(3200, 4, true) == AQE_OK, "add failed");
+  while (fas_soft_timer_armed) {
+    fas_virtual_ticks += fas_soft_timer_delta;
+    fas_soft_timer_isr(fas_virtual_ticks);
+  }
+  uint32_t ticks;
+  test(fired == 1, "callback not called once");
+  test(ss->getPositionEvent(id, &ticks), "event not fired");
+  test(ss->getCurrentPosition() == 7, "wrong position after the event");
+
+  // The tail is cut right after the released entry in progress. Before its
+  // start, the entry at read_idx is kept.
+  const uint32_t slow_ticks = 200000;  // with n_periods
+  test(ss->addQueueEntry(slow_ticks, 3, true) == AQE_OK, "add failed");
+  test(ss->addQueueEntry(3200, 5, true) == AQE_OK, "add failed");
+  test(ss->addQueueEntry(3200, 5, true) == AQE_OK, "add failed");
+  test(q2->truncateTail(), "not truncated before start");
+  test(ss->getPositionAfterCommandsCompleted() == 10, "start not kept");
+  test(ss->addQueueEntry(3200, 5, true) == AQE_OK, "add failed");
+  for (uint8_t i = 0; i < 2; i++) {
+    fas_virtual_ticks += fas_soft_timer_delta;
+    fas_soft_timer_isr(fas_virtual_ticks);
+  }
+  test(q2->stepsInProgress() == 2, "slow entry not in progress");
+  test(!q2->isQueueEmpty(), "next entry started");
+  test(q2->truncateTail(), "not truncated");
+  test(q2->isQueueEmpty(), "next entry kept");
+  test(ss->getPositionAfterCommandsCompleted() == 10, "wrong end position");
+  test(q2->ticks_at_queue_end == slow_ticks, "wrong ticks at queue end");
+  test(!q2->truncateTail(), "truncated the entry in progress");
+  while (fas_soft_timer_armed) {
+    fas_virtual_ticks += fas_soft_timer_delta;
+    fas_soft_timer_isr(fas_virtual_ticks);
+  }
+  test(ss->getCurrentPosition() == 10, "wrong position after truncation");
+  fas_virtual_ticks = 0;
+  puts("...done");
+}
+
 void end_pos_test() {
   init_queue();
   FastAccelStepper s = FastAccelStepper();
@@ -99,6 +760,19 @@ int main() {
   basic_test();
   queue_out_of_range();
   queue_full();
+  compact_queue_full();
+  small_queue_full();
+  encoding_test();
+  bulk_test();
+  start_time_test();
+  avr_start_test();
+  esp32_start_set_test();
+  group_test();
+  dir_pin_test();
+  pulse_and_dir_setup_test();
+  low_watermark_test();
+  refill_order_test();
+  soft_channel_test();
   end_pos_test();
   printf("TEST_01 PASSED\n");
 }
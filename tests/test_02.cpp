@@ -14,6 +14,7 @@ unsigned short OCR1A;
 unsigned short OCR1B;
 
 StepperQueue fas_queue[NUM_QUEUES];
+StepperQueueBuffer<QUEUE_LEN> fas_queue_buffer[NUM_QUEUES];
 
 void inject_fill_interrupt(int mark) {}
 void noInterrupts() {}
@@ -50,9 +51,8 @@ RampChecker::RampChecker() {
 void RampChecker::check_section(struct queue_entry *e) {
   uint8_t steps = e->steps;
   if (!first) {
-    assert((steps & 1) == 0);
+    assert(!e->toggle_dir);
   }
-  steps >>= 1;
   assert(steps >= 1);
   pos += steps;
   uint32_t start_dt = PERIOD_TICKS;
@@ -96,6 +96,8 @@ void init_queue() {
   fas_queue[1].read_idx = 0;
   fas_queue[0].next_write_idx = 0;
   fas_queue[1].next_write_idx = 0;
+  fas_queue[0].attachBuffer(fas_queue_buffer[0].entry, QUEUE_LEN);
+  fas_queue[1].attachBuffer(fas_queue_buffer[1].entry, QUEUE_LEN);
 }
 
 void basic_test_with_empty_queue() {
@@ -127,9 +129,10 @@ void basic_test_with_empty_queue() {
     }
     s.manage();
     while (!s.isQueueEmpty()) {
-      rc.check_section(
-          &fas_queue_A.entry[fas_queue[0].read_idx & QUEUE_LEN_MASK]);
-      fas_queue[0].read_idx++;
+      struct queue_entry e;
+      fas_queue[0].read_idx +=
+          fas_queue[0].decodeEntry(fas_queue[0].read_idx, &e);
+      rc.check_section(&e);
     }
   }
   test(!s.isRampGeneratorActive(), "too many commands created");
@@ -176,9 +179,10 @@ void test_with_pars(const char *name, int32_t steps, uint32_t travel_dt,
     s.manage();
     uint32_t from_dt = rc.total_ticks;
     while (!s.isQueueEmpty()) {
-      rc.check_section(
-          &fas_queue_A.entry[fas_queue[0].read_idx & QUEUE_LEN_MASK]);
-      fas_queue[0].read_idx++;
+      struct queue_entry e;
+      fas_queue[0].read_idx +=
+          fas_queue[0].decodeEntry(fas_queue[0].read_idx, &e);
+      rc.check_section(&e);
       fprintf(gp_file, "%.6f %.2f %d\n", rc.total_ticks / 1000000.0,
               16000000.0 / rc.last_dt, rc.last_dt);
     }
@@ -232,8 +236,858 @@ void test_with_pars(const char *name, int32_t steps, uint32_t travel_dt,
 #endif
 }
 
+// Stop during acceleration. The not yet started commands must be removed and
+// the deceleration must start right after the running command.
+void stop_test(bool now) {
+  printf("stop_test %s...\n", now ? "stopMoveNow" : "stopMove");
+  init_queue();
+  FastAccelStepper s = FastAccelStepper();
+  s.init(0, 0);
+  s.setSpeed(20);
+  s.setAcceleration(1000);
+  s.move(1000000);
+  for (int i = 0; i < 100; i++) {
+    s.manage();
+    while (!s.isQueueEmpty()) {
+      struct queue_entry e;
+      fas_queue[0].read_idx +=
+          fas_queue[0].decodeEntry(fas_queue[0].read_idx, &e);
+    }
+  }
+  s.manage();
+  test((s.rampState() & RAMP_STATE_MASK) == RAMP_STATE_ACCELERATE,
+       "should accelerate");
+  // first command is running
+  struct queue_entry e;
+  fas_queue[0].read_idx += fas_queue[0].decodeEntry(fas_queue[0].read_idx, &e);
+  int32_t pos_queue_end = s.getPositionAfterCommandsCompleted();
+  uint32_t ticks = fas_queue[0].ticks_at_queue_end;
+  if (now) {
+    s.stopMoveNow();
+  } else {
+    s.stopMove();
+    s.manage();
+  }
+  test(s.getPositionAfterCommandsCompleted() != pos_queue_end,
+       "queue not truncated");
+  test(fas_queue[0].ticks_at_queue_end > ticks, "no deceleration");
+  // all remaining commands decelerate
+  uint32_t last_ticks = 0;
+  while (s.isRampGeneratorActive() || !s.isQueueEmpty()) {
+    s.manage();
+    while (!s.isQueueEmpty()) {
+      fas_queue[0].read_idx +=
+          fas_queue[0].decodeEntry(fas_queue[0].read_idx, &e);
+      uint32_t ticks = e.n_periods * PERIOD_TICKS + e.period;
+      test(ticks >= last_ticks, "speed increased after stop");
+      last_ticks = ticks;
+    }
+  }
+  // Still accelerating from standstill, so a stop starting at the queue end
+  // would need about pos_queue_end steps to come to rest.
+  test(s.getCurrentPosition() < 2 * pos_queue_end, "stop too late");
+  puts("...done");
+}
+
+// A longer manage period needs the queue to be filled further ahead
+void engine_config_test() {
+  puts("engine_config_test...");
+  FastAccelStepperEngine engine = FastAccelStepperEngine();
+  struct engine_config_s config = ENGINE_CONFIG_DEFAULT;
+  for (int i = 0; i < 2; i++) {
+    config.manage_period_ms = (i == 0) ? 10 : 50;
+    engine.init(config);
+    init_queue();
+    FastAccelStepper s = FastAccelStepper();
+    s.init(0, 0);
+    s.setSpeed(1000);
+    s.setAcceleration(100000);
+    s.move(100000);
+    s.manage();
+    bool has_50ms = fas_queue[0].hasTicksInQueue(TICKS_PER_S / 20);
+    test(has_50ms == (i == 1), "queue not filled for the manage period");
+  }
+  engine.init();
+  puts("...done");
+}
+
+// Drains the queue and records the step times starting at *t
+static uint32_t drain_steps(uint8_t q, uint64_t* t, uint64_t* times,
+                            uint32_t n, uint32_t max_n) {
+  while (!fas_queue[q].isQueueEmpty()) {
+    struct queue_entry e;
+    fas_queue[q].read_idx +=
+        fas_queue[q].decodeEntry(fas_queue[q].read_idx, &e);
+    uint32_t ticks = e.n_periods * PERIOD_TICKS + e.period;
+    for (uint16_t i = 0; i < e.steps; i++) {
+      *t += ticks;
+      test(n < max_n, "too many steps");
+      times[n++] = *t;
+    }
+  }
+  return n;
+}
+
+// The follower steps must be at the times, when the lead axis passes their
+// share of the path
+void linear_move_test() {
+  puts("linear_move_test...");
+  init_queue();
+  FastAccelStepperEngine engine = FastAccelStepperEngine();
+  FastAccelStepper s0 = FastAccelStepper();
+  FastAccelStepper s1 = FastAccelStepper();
+  s0.init(0, 0);
+  s1.init(1, 1);
+  s1.setDirectionPin(2);
+  const uint32_t lead_n = 3000;
+  const uint32_t follow_n = 1234;
+  static uint64_t lead_t[3000];
+  static uint64_t follow_t[1234];
+  FastAccelStepper* axes[2] = {&s1, &s0};
+  int32_t pos[2] = {-(int32_t)follow_n, (int32_t)lead_n};
+  test(engine.moveLinear(axes, pos, 2, 100, 100000) == MOVE_OK,
+       "move not accepted");
+  test(engine.moveLinear(axes, pos, 2, 100, 100000) == MOVE_ERR_STEPPER_RUNNING,
+       "second move accepted");
+  test(s0.isRunning() && s1.isRunning(), "axes not started");
+  test(fas_queue[0].started_at_ticks == fas_queue[1].started_at_ticks,
+       "axes started at different times");
+
+  uint64_t t0 = fas_queue[0].started_at_ticks;
+  uint64_t t1 = t0;
+  uint32_t n0 = 0;
+  uint32_t n1 = 0;
+  for (int i = 0; i < 100000; i++) {
+    n0 = drain_steps(0, &t0, lead_t, n0, lead_n);
+    n1 = drain_steps(1, &t1, follow_t, n1, follow_n);
+    if (!s0.isRampGeneratorActive()) {
+      break;
+    }
+    s0.manage();
+  }
+  test(n0 == lead_n, "wrong step count of lead axis");
+  test(n1 == follow_n, "wrong step count of follower");
+  test(s0.getCurrentPosition() == (int32_t)lead_n, "lead not at target");
+  test(s1.getCurrentPosition() == -(int32_t)follow_n, "follower not at target");
+  test(fas_queue[1].dir_at_queue_end == false, "wrong follower direction");
+
+  // path speed 10000 steps/s => lead axis with 3000/3244.5 of this
+  uint64_t min_dt = ~0;
+  for (uint32_t i = 1; i < lead_n; i++) {
+    min_dt = min(min_dt, lead_t[i] - lead_t[i - 1]);
+  }
+  test(min_dt >= US_TO_TICKS(108) - 16, "lead axis too fast");
+  test(min_dt <= US_TO_TICKS(108) + 16, "lead axis too slow");
+
+  // follower step j is due, when the lead axis is at j * lead_n / follow_n
+  double max_err = 0;
+  for (uint32_t j = 1; j <= follow_n; j++) {
+    double x = (double)j * lead_n / follow_n;
+    uint32_t i = (uint32_t)x;
+    double t_lo = (i == 0) ? (double)fas_queue[0].started_at_ticks
+                           : (double)lead_t[i - 1];
+    double t_ideal = t_lo;
+    if (i < lead_n) {
+      t_ideal += (lead_t[i] - t_lo) * (x - i);
+    }
+    double err = fabs((double)follow_t[j - 1] - t_ideal);
+    max_err = (err > max_err) ? err : max_err;
+  }
+  printf("max. follower deviation: %.1f ticks\n", max_err);
+  // The period of a follower command is rounded down and the first step is
+  // merged into it for a small deviation. At 10000 steps/s the follower
+  // period is approx. 4000 ticks
+  test(max_err <= 64, "follower off the path");
+  test(follow_t[follow_n - 1] + 64 >= lead_t[lead_n - 1], "follower early");
+  test(follow_t[follow_n - 1] <= lead_t[lead_n - 1] + 64, "follower late");
+
+  // the coordinated move has completed and the lead axis has kept its
+  // configuration without speed
+  s0.manage();
+  test(s0.move(10) == MOVE_ERR_SPEED_IS_UNDEFINED,
+       "lead axis keeps the speed of the path");
+  pos[1] = 0;
+  test(engine.moveLinear(axes, pos, 2, 100, 0) ==
+           MOVE_ERR_ACCELERATION_IS_UNDEFINED,
+       "acceleration not checked");
+  fas_queue[0].isRunning = false;
+  fas_queue[1].isRunning = false;
+  // the lead axis moves back
+  s0.setDirectionPin(3);
+  test(engine.moveLinear(axes, pos, 2, 100, 100000) == MOVE_OK,
+       "next move not accepted");
+  puts("...done");
+}
+
+// Drains the queue and records the time and the direction of each step
+static uint32_t drain_arc_steps(uint8_t q, uint64_t* t, bool* count_up,
+                                uint64_t* times, int8_t* dirs, uint32_t n,
+                                uint32_t max_n) {
+  while (!fas_queue[q].isQueueEmpty()) {
+    struct queue_entry e;
+    fas_queue[q].read_idx +=
+        fas_queue[q].decodeEntry(fas_queue[q].read_idx, &e);
+    if (e.toggle_dir) {
+      *count_up = !*count_up;
+    }
+    uint32_t ticks = e.n_periods * PERIOD_TICKS + e.period;
+    for (uint16_t i = 0; i < e.steps; i++) {
+      *t += ticks;
+      test(n < max_n, "too many steps");
+      dirs[n] = *count_up ? 1 : -1;
+      times[n++] = *t;
+    }
+  }
+  return n;
+}
+
+#define ARC_MAX_STEPS 12000
+// Runs the arc from (0,0) and checks, that the steps stay within a step of
+// the circle and the tangential speed does not exceed 10000 steps/s. stop_at
+// > 0 calls stopMove() after this number of fills.
+void arc_test(int32_t cx, int32_t cy, int32_t ex, int32_t ey, bool clockwise,
+              uint32_t stop_at) {
+  printf("arc_test around (%d,%d) to (%d,%d)...\n", cx, cy, ex, ey);
+  init_queue();
+  FastAccelStepperEngine engine = FastAccelStepperEngine();
+  FastAccelStepper s0 = FastAccelStepper();
+  FastAccelStepper s1 = FastAccelStepper();
+  s0.init(0, 0);
+  s1.init(1, 1);
+  s0.setDirectionPin(2);
+  s1.setDirectionPin(3);
+  static uint64_t t_x[ARC_MAX_STEPS];
+  static uint64_t t_y[ARC_MAX_STEPS];
+  static int8_t d_x[ARC_MAX_STEPS];
+  static int8_t d_y[ARC_MAX_STEPS];
+  bool up_x = fas_queue[0].dir_at_queue_end;
+  bool up_y = fas_queue[1].dir_at_queue_end;
+  test(engine.arcTo(&s0, &s1, cx, cy, ex, ey, clockwise, 100, 100000) ==
+           MOVE_OK,
+       "arc not accepted");
+  test(engine.arcTo(&s0, &s1, cx, cy, ex, ey, clockwise, 100, 100000) ==
+           MOVE_ERR_STEPPER_RUNNING,
+       "second arc accepted");
+  // On an axis the other one is the major one. So x starts later with a
+  // start time relative to the start of y.
+  uint64_t t_start = fas_queue[fas_queue[0].isRunning ? 0 : 1].started_at_ticks;
+  uint64_t tx = 0;
+  uint64_t ty = 0;
+  uint32_t nx = 0;
+  uint32_t ny = 0;
+  for (uint32_t i = 0; i < 100000; i++) {
+    if (nx == 0) {
+      tx = fas_queue[0].started_at_ticks;
+    }
+    if (ny == 0) {
+      ty = fas_queue[1].started_at_ticks;
+    }
+    nx = drain_arc_steps(0, &tx, &up_x, t_x, d_x, nx, ARC_MAX_STEPS);
+    ny = drain_arc_steps(1, &ty, &up_y, t_y, d_y, ny, ARC_MAX_STEPS);
+    fas_virtual_ticks = (uint32_t)max(tx, ty);
+    if (!s0.isRampGeneratorActive()) {
+      break;
+    }
+    if ((stop_at > 0) && (i == stop_at)) {
+      s0.stopMove();
+    }
+    s0.manage();
+  }
+  if (stop_at == 0) {
+    test(s0.getCurrentPosition() == ex, "x not at end");
+    test(s1.getCurrentPosition() == ey, "y not at end");
+  } else {
+    test(s0.getCurrentPosition() != ex, "arc not stopped");
+  }
+
+  // replay the steps in time order. The speed is taken over 64 points to
+  // average the path length of the single steps.
+  static int32_t p_x[2 * ARC_MAX_STEPS];
+  static int32_t p_y[2 * ARC_MAX_STEPS];
+  static uint64_t p_t[2 * ARC_MAX_STEPS];
+  int64_t r2 = (int64_t)cx * cx + (int64_t)cy * cy;
+  double r = sqrt((double)r2);
+  int32_t x = 0;
+  int32_t y = 0;
+  uint32_t ix = 0;
+  uint32_t iy = 0;
+  uint32_t np = 0;
+  double max_speed = 0;
+  double max_dr = 0;
+  while ((ix < nx) || (iy < ny)) {
+    uint64_t next = (iy == ny) || ((ix < nx) && (t_x[ix] <= t_y[iy]))
+                        ? t_x[ix]
+                        : t_y[iy];
+    int32_t dx = 0;
+    int32_t dy = 0;
+    while ((ix < nx) && (t_x[ix] == next)) {
+      dx += d_x[ix++];
+    }
+    while ((iy < ny) && (t_y[iy] == next)) {
+      dy += d_y[iy++];
+    }
+    test((abs(dx) <= 1) && (abs(dy) <= 1), "axis steps too close");
+    x += dx;
+    y += dy;
+    double dr = fabs(hypot(x - cx, y - cy) - r);
+    max_dr = (dr > max_dr) ? dr : max_dr;
+    p_x[np] = x;
+    p_y[np] = y;
+    p_t[np] = next;
+    if (np >= 64) {
+      double speed = hypot(x - p_x[np - 64], y - p_y[np - 64]) * TICKS_PER_S /
+                     (next - p_t[np - 64]);
+      max_speed = (speed > max_speed) ? speed : max_speed;
+    }
+    np++;
+  }
+  printf("max. distance to the circle: %.2f steps, max. speed: %.0f\n",
+         max_dr, max_speed);
+  test(max_dr <= 0.75, "steps off the circle");
+  test(max_speed <= 10000 * 1.03, "tangential speed too high");
+  test((stop_at > 0) || (max_speed >= 10000 * 0.97),
+       "tangential speed not reached");
+  test(x == s0.getCurrentPosition(), "x steps do not match the position");
+  test(y == s1.getCurrentPosition(), "y steps do not match the position");
+  puts("...done");
+}
+
+// arcTo() of the half circle of arc_test() with limits of x and y
+static int8_t arc_with_limits(int32_t x_min, int32_t x_max, int32_t y_min,
+                              int32_t y_max) {
+  init_queue();
+  FastAccelStepperEngine engine = FastAccelStepperEngine();
+  FastAccelStepper s0 = FastAccelStepper();
+  FastAccelStepper s1 = FastAccelStepper();
+  s0.init(0, 0);
+  s1.init(1, 1);
+  s0.setDirectionPin(2);
+  s1.setDirectionPin(3);
+  s0.setPositionLimits(x_min, x_max);
+  s1.setPositionLimits(y_min, y_max);
+  int8_t res =
+      engine.arcTo(&s0, &s1, -300, -400, -600, -800, true, 100, 100000);
+  test((res == MOVE_OK) || fas_queue[0].isQueueEmpty(), "x queued");
+  test((res == MOVE_OK) || fas_queue[1].isQueueEmpty(), "y queued");
+  return res;
+}
+
+// The axes of coordinated moves, arcs and electronic gears are checked
+// against their position limits
+void follower_limit_test() {
+  puts("follower_limit_test...");
+  init_queue();
+  FastAccelStepperEngine engine = FastAccelStepperEngine();
+  FastAccelStepper s0 = FastAccelStepper();
+  FastAccelStepper s1 = FastAccelStepper();
+  s0.init(0, 0);
+  s1.init(1, 1);
+  s0.setDirectionPin(2);
+  s1.setDirectionPin(3);
+  FastAccelStepper* axes[2] = {&s0, &s1};
+  int32_t pos[2] = {1000, 300};
+  s1.setPositionLimits(-100, 200);
+  test(engine.moveLinear(axes, pos, 2, 100, 100000) ==
+           MOVE_ERR_POSITION_LIMIT,
+       "follower target outside of the limits accepted");
+  test(!s0.isRampGeneratorActive(), "lead axis planned");
+  test(fas_queue[0].isQueueEmpty() && fas_queue[1].isQueueEmpty(),
+       "axis has moved");
+
+  // the clockwise half circle passes (200,-400) and (-300,-900)
+  test(arc_with_limits(-600, 200, -900, 0) == MOVE_OK, "arc not accepted");
+  test(arc_with_limits(-600, 199, -900, 0) == MOVE_ERR_POSITION_LIMIT,
+       "arc beyond x max accepted");
+  test(arc_with_limits(-599, 200, -900, 0) == MOVE_ERR_POSITION_LIMIT,
+       "arc beyond x min accepted");
+  test(arc_with_limits(-600, 200, -899, 0) == MOVE_ERR_POSITION_LIMIT,
+       "arc beyond y min accepted");
+  test(arc_with_limits(-600, 200, -900, -1) == MOVE_ERR_POSITION_LIMIT,
+       "arc beyond y max accepted");
+
+  // the geared target of the follower
+  init_queue();
+  s0 = FastAccelStepper();
+  s1 = FastAccelStepper();
+  s0.init(0, 0);
+  s1.init(1, 1);
+  s0.setDirectionPin(2);
+  s1.setDirectionPin(3);
+  s0.setSpeed(100);
+  s0.setAcceleration(100000);
+  s1.setPositionLimits(-100, 200);
+  test(s1.followMaster(&s0, 2, 1) == MOVE_OK, "gear not accepted");
+  test(s0.moveTo(101) == MOVE_ERR_POSITION_LIMIT,
+       "geared target beyond the limit accepted");
+  test(s0.move(-51) == MOVE_ERR_POSITION_LIMIT,
+       "geared target beyond the limit accepted");
+  test(s0.moveTo(100) == MOVE_OK, "geared target within the limits rejected");
+  test(s0.move(-151) == MOVE_ERR_POSITION_LIMIT,
+       "move relative to the current target not checked");
+  s1.releaseMaster();
+  puts("...done");
+}
+
+#define GEAR_MAX_STEPS 8000
+// The follower of an electronic gear must be at its gear position, whenever
+// the master steps. The master reverses while running.
+void gear_test(int32_t num, uint32_t den) {
+  printf("gear_test with ratio %d/%u...\n", num, den);
+  init_queue();
+  FastAccelStepper s0 = FastAccelStepper();
+  FastAccelStepper s1 = FastAccelStepper();
+  s0.init(0, 0);
+  s1.init(1, 1);
+  s0.setDirectionPin(2);
+  test(s1.followMaster(&s0, num, den) == MOVE_ERR_NO_DIRECTION_PIN,
+       "direction pin not checked");
+  s1.setDirectionPin(3);
+  test(s1.followMaster(&s1, num, den) == MOVE_ERR_GEAR, "self accepted");
+  test(s1.followMaster(&s0, num, 0) == MOVE_ERR_GEAR, "den 0 accepted");
+  test(s1.followMaster(&s0, num, den, 5) == MOVE_ERR_GEAR,
+       "follower off its gear position accepted");
+  test(s1.followMaster(&s0, num, den) == MOVE_OK, "gear not accepted");
+  test(s0.followMaster(&s1, 1, 1) == MOVE_ERR_GEAR, "chain accepted");
+  test(s1.isFollowing(), "not following");
+
+  static uint64_t t_m[GEAR_MAX_STEPS];
+  static uint64_t t_f[GEAR_MAX_STEPS];
+  static int8_t d_m[GEAR_MAX_STEPS];
+  static int8_t d_f[GEAR_MAX_STEPS];
+  bool up_m = fas_queue[0].dir_at_queue_end;
+  bool up_f = fas_queue[1].dir_at_queue_end;
+  uint64_t tm = 0;
+  uint64_t tf = 0;
+  uint32_t nm = 0;
+  uint32_t nf = 0;
+  bool reversed = false;
+  fas_virtual_ticks = 0;
+  s0.setSpeed(100);
+  s0.setAcceleration(100000);
+  s0.moveTo(3000);
+  for (uint32_t i = 0; i < 100000; i++) {
+    if (nm == 0) {
+      tm = fas_queue[0].started_at_ticks;
+    }
+    if (nf == 0) {
+      tf = fas_queue[1].started_at_ticks;
+    }
+    nm = drain_arc_steps(0, &tm, &up_m, t_m, d_m, nm, GEAR_MAX_STEPS);
+    nf = drain_arc_steps(1, &tf, &up_f, t_f, d_f, nf, GEAR_MAX_STEPS);
+    fas_virtual_ticks = (uint32_t)tm;
+    if ((nm >= 1500) && !reversed) {
+      reversed = true;
+      s0.moveTo(-1000);
+    }
+    if (!s0.isRampGeneratorActive()) {
+      break;
+    }
+    s0.manage();
+  }
+  test(s0.getCurrentPosition() == -1000, "master not at target");
+  int32_t f_end = (int32_t)floor(-1000.0 * num / den);
+  test(s1.getCurrentPosition() == f_end, "follower not at gear position");
+
+  // replay: at each master step the follower has done the steps up to it.
+  // A follower step at the time of a master step may be late by the
+  // rounding of its period.
+  int32_t m = 0;
+  int32_t f = 0;
+  uint32_t j = 0;
+  for (uint32_t i = 0; i < nm; i++) {
+    m += d_m[i];
+    while ((j < nf) && (t_f[j] <= t_m[i])) {
+      f += d_f[j++];
+    }
+    int32_t geared = (int32_t)floor((double)m * num / den);
+    test(abs(f - geared) <= 1, "follower off the gear position");
+  }
+  s1.releaseMaster();
+  test(!s1.isFollowing(), "still following");
+  fas_queue[0].isRunning = false;
+  fas_queue[1].isRunning = false;
+  test(s0.followMaster(&s1, 1, 1) == MOVE_OK, "reversed gear not accepted");
+  puts("...done");
+}
+
+// A ratio beyond the step rate of the follower lets it lag behind at its
+// maximum rate. A follower command, which cannot be queued, stops the
+// master and releases the follower.
+void gear_limit_test() {
+  puts("gear_limit_test...");
+  init_queue();
+  FastAccelStepper s0 = FastAccelStepper();
+  FastAccelStepper s1 = FastAccelStepper();
+  s0.init(0, 0);
+  s1.init(1, 1);
+  s0.setDirectionPin(2);
+  s1.setDirectionPin(3);
+  // 10 * 10000 steps/s is beyond MIN_DELTA_TICKS
+  test(s1.followMaster(&s0, 10, 1) == MOVE_OK, "gear not accepted");
+  static uint64_t t_m[GEAR_MAX_STEPS];
+  static uint64_t t_f[GEAR_MAX_STEPS];
+  static int8_t d_m[GEAR_MAX_STEPS];
+  static int8_t d_f[GEAR_MAX_STEPS];
+  bool up_m = fas_queue[0].dir_at_queue_end;
+  bool up_f = fas_queue[1].dir_at_queue_end;
+  uint64_t tm = 0;
+  uint64_t tf = 0;
+  uint32_t nm = 0;
+  uint32_t nf = 0;
+  fas_virtual_ticks = 0;
+  s0.setSpeed(100);
+  s0.setAcceleration(100000);
+  s0.moveTo(400);
+  for (uint32_t i = 0; i < 100000; i++) {
+    if (nm == 0) {
+      tm = fas_queue[0].started_at_ticks;
+    }
+    if (nf == 0) {
+      tf = fas_queue[1].started_at_ticks;
+    }
+    nm = drain_arc_steps(0, &tm, &up_m, t_m, d_m, nm, GEAR_MAX_STEPS);
+    nf = drain_arc_steps(1, &tf, &up_f, t_f, d_f, nf, GEAR_MAX_STEPS);
+    fas_virtual_ticks = (uint32_t)tm;
+    if (!s0.isRampGeneratorActive()) {
+      break;
+    }
+    s0.manage();
+  }
+  nf = drain_arc_steps(1, &tf, &up_f, t_f, d_f, nf, GEAR_MAX_STEPS);
+  test(s1.isFollowing(), "follower released");
+  test(nm == 400, "master not at target");
+  test(nf == 4000, "follower has lost steps");
+  for (uint32_t i = 1; i < nf; i++) {
+    test(t_f[i] - t_f[i - 1] >= MIN_DELTA_TICKS, "follower too fast");
+  }
+  s1.releaseMaster();
+
+  // a master step needs 100000 follower steps
+  init_queue();
+  s0 = FastAccelStepper();
+  s1 = FastAccelStepper();
+  s0.init(0, 0);
+  s1.init(1, 1);
+  s0.setDirectionPin(2);
+  s1.setDirectionPin(3);
+  test(s1.followMaster(&s0, 100000, 1) == MOVE_OK, "gear not accepted");
+  s0.setSpeed(100);
+  s0.setAcceleration(100000);
+  s0.moveTo(400);
+  s0.manage();
+  test(!s1.isFollowing(), "follower not released");
+  test(!s0.isRampGeneratorActive(), "master not stopped");
+  test(s0.getPositionAfterCommandsCompleted() < 400, "master not stopped");
+  puts("...done");
+}
+
+// Both axes of a synchronized move reach the same share of their distance
+// at the same time
+void sync_test() {
+  puts("sync_test...");
+  init_queue();
+  FastAccelStepperEngine engine = FastAccelStepperEngine();
+  FastAccelStepper s0 = FastAccelStepper();
+  FastAccelStepper s1 = FastAccelStepper();
+  s0.init(0, 0);
+  s1.init(1, 1);
+  s1.setDirectionPin(2);
+  // s1 is faster, but has a third of the distance
+  s0.setSpeed(100);
+  s0.setAcceleration(100000);
+  s1.setSpeed(50);
+  s1.setAcceleration(400000);
+  static uint64_t t0[3000];
+  static uint64_t t1[1000];
+  FastAccelStepper* axes[2] = {&s0, &s1};
+  int32_t pos[2] = {3000, -1000};
+  fas_virtual_ticks = 0;
+  // an axis with the target outside of its limits rejects the whole move
+  s1.setPositionLimits(-500, 500);
+  test(engine.moveSynchronized(axes, pos, 2) == MOVE_ERR_POSITION_LIMIT,
+       "target outside of the limits accepted");
+  for (uint8_t i = 0; i < 2; i++) {
+    test(!axes[i]->isRampGeneratorActive(), "axis planned");
+    test(fas_queue[i].isQueueEmpty(), "axis has moved");
+    test(!fas_queue[i].group_armed, "group still armed");
+  }
+  s1.clearPositionLimits();
+  test(engine.moveSynchronized(axes, pos, 2) == MOVE_OK, "move not accepted");
+  test(engine.moveSynchronized(axes, pos, 2) == MOVE_ERR_STEPPER_RUNNING,
+       "second move accepted");
+  test(fas_queue[0].started_at_ticks == fas_queue[1].started_at_ticks,
+       "axes started at different times");
+  uint64_t tt0 = fas_queue[0].started_at_ticks;
+  uint64_t tt1 = tt0;
+  uint32_t n0 = 0;
+  uint32_t n1 = 0;
+  for (int i = 0; i < 100000; i++) {
+    n0 = drain_steps(0, &tt0, t0, n0, 3000);
+    n1 = drain_steps(1, &tt1, t1, n1, 1000);
+    fas_virtual_ticks = (uint32_t)min(tt0, tt1);
+    if (!s0.isRampGeneratorActive() && !s1.isRampGeneratorActive()) {
+      break;
+    }
+    s0.manage();
+    s1.manage();
+  }
+  test(n0 == 3000, "wrong step count of s0");
+  test(n1 == 1000, "wrong step count of s1");
+  test(s1.getCurrentPosition() == -1000, "s1 not at target");
+  // s0 limits the speed and the acceleration: 0.1 s per ramp of 500 steps
+  // and 0.2 s coasting
+  uint64_t total = t0[2999] - fas_queue[0].started_at_ticks;
+  printf("s0: %u ticks, s1: %u ticks\n", (uint32_t)total,
+         (uint32_t)(t1[999] - fas_queue[0].started_at_ticks));
+  test(total < TICKS_PER_S * 4 / 10 + TICKS_PER_S / 100, "move too slow");
+  for (uint32_t q = 1; q <= 4; q++) {
+    int64_t dt = t0[q * 750 - 1] - t1[q * 250 - 1];
+    test(abs(dt) < (int64_t)(total / 100), "axes not synchronized");
+  }
+  // s1 runs with a third of the speed of s0
+  uint64_t min_dt = ~0;
+  for (uint32_t i = 1; i < 1000; i++) {
+    min_dt = min(min_dt, t1[i] - t1[i - 1]);
+  }
+  test(min_dt >= US_TO_TICKS(300) - 16, "s1 too fast");
+  puts("...done");
+}
+
+// Drains the queue like the stepper ISR and fires the position events. The
+// callback records the position of the last step.
+static int32_t event_drain_pos;
+static int32_t event_cb_pos[4];
+static uint8_t event_cb_count;
+static void event_callback(void* arg) {
+  test(event_cb_count < 4, "too many callbacks");
+  event_cb_pos[event_cb_count++] = event_drain_pos;
+  *(uint32_t*)arg += 1;
+}
+static void drain_events(uint8_t q, uint64_t* t, bool* count_up) {
+  while (!fas_queue[q].isQueueEmpty()) {
+    struct queue_entry e;
+    fas_queue[q].read_idx +=
+        fas_queue[q].decodeEntry(fas_queue[q].read_idx, &e);
+    if (e.toggle_dir) {
+      *count_up = !*count_up;
+    }
+    uint32_t ticks = e.n_periods * PERIOD_TICKS + e.period;
+    *t += ticks * e.steps;
+    event_drain_pos += *count_up ? e.steps : -e.steps;
+    if (e.event) {
+      fas_queue[q].firePositionEvent((uint32_t)*t);
+    }
+  }
+}
+
+// The position events fire after the step to their position
+void position_event_test() {
+  puts("position_event_test...");
+  init_queue();
+  FastAccelStepper s0 = FastAccelStepper();
+  s0.init(0, 0);
+  s0.setDirectionPin(2);
+  s0.setSpeed(100);
+  s0.setAcceleration(100000);
+  uint32_t calls = 0;
+  event_cb_count = 0;
+  event_drain_pos = 0;
+  int8_t id_a = s0.addPositionEvent(100, event_callback, &calls, 5);
+  int8_t id_b = s0.addPositionEvent(1777, event_callback, &calls,
+                                    PIN_UNDEFINED);
+  int8_t id_c = s0.addPositionEvent(3000, NULL, NULL, 6);
+  int8_t id_d = s0.addPositionEvent(2000, event_callback, &calls,
+                                    PIN_UNDEFINED);
+  test((id_a >= 0) && (id_b >= 0) && (id_c >= 0) && (id_d >= 0),
+       "event not added");
+  test(s0.addPositionEvent(100, NULL, NULL, PIN_UNDEFINED) == -1,
+       "second event at the same position accepted");
+  test(s0.addPositionEvent(1, NULL, NULL, PIN_UNDEFINED) == -1,
+       "more events than slots accepted");
+  test(s0.removePositionEvent(id_d), "event not removed");
+  uint32_t ticks;
+  test(!s0.getPositionEvent(id_a, &ticks), "event fired too early");
+
+  bool up = fas_queue[0].dir_at_queue_end;
+  uint64_t t = 0;
+  fas_virtual_ticks = 0;
+  s0.moveTo(3000);
+  uint64_t t_start = fas_queue[0].started_at_ticks;
+  t = t_start;
+  bool back = false;
+  for (int i = 0; i < 100000; i++) {
+    drain_events(0, &t, &up);
+    fas_virtual_ticks = (uint32_t)t;
+    if (!s0.isRampGeneratorActive()) {
+      if (back) {
+        break;
+      }
+      // back to 0 passes 100 again
+      back = true;
+      id_a = s0.addPositionEvent(100, event_callback, &calls, PIN_UNDEFINED);
+      test(id_a >= 0, "event not added");
+      s0.moveTo(0);
+    }
+    s0.manage();
+  }
+  test(s0.getCurrentPosition() == 0, "not back at 0");
+  test(calls == 3, "wrong number of callbacks");
+  test(event_cb_pos[0] == 100, "event at 100 not at its step");
+  test(event_cb_pos[1] == 1777, "event at 1777 not at its step");
+  test(event_cb_pos[2] == 100, "event at 100 not at its step on the way back");
+  test(s0.getPositionEvent(id_c, &ticks), "event at the end not fired");
+  test(fas_queue[0].events[id_c].pin_high, "pin not toggled");
+  // 3000 steps with 500 steps per ramp: 0.1 s per ramp and 0.2 s coasting
+  uint32_t dt = ticks - (uint32_t)t_start;
+  test((dt > TICKS_PER_S * 4 / 10 - TICKS_PER_S / 100) &&
+           (dt < TICKS_PER_S * 4 / 10 + TICKS_PER_S / 100),
+       "wrong time of the event");
+  test(!s0.removePositionEvent(id_c), "fired event removed");
+  puts("...done");
+}
+
+// Runs the ramp generator of s till it stops and returns the highest resp.
+// lowest position and the period of the last step. With limit_at, a limit is
+// set, when this position is passed. With reverse, the stepper is sent back
+// to 0 and the limit is set at the queue end.
+static void run_to_stop(FastAccelStepper* s, int32_t* max_pos,
+                        int32_t* min_pos, uint32_t* last_ticks,
+                        int32_t limit_at = 0, bool reverse = false) {
+  int32_t pos = s->getCurrentPosition();
+  bool up = fas_queue[0].dir_at_queue_end;
+  *max_pos = pos;
+  *min_pos = pos;
+  for (int i = 0; i < 100000; i++) {
+    while (!fas_queue[0].isQueueEmpty()) {
+      struct queue_entry e;
+      fas_queue[0].read_idx +=
+          fas_queue[0].decodeEntry(fas_queue[0].read_idx, &e);
+      if (e.toggle_dir) {
+        up = !up;
+      }
+      pos += up ? e.steps : -e.steps;
+      *max_pos = max(*max_pos, pos);
+      *min_pos = min(*min_pos, pos);
+      *last_ticks = e.n_periods * PERIOD_TICKS + e.period;
+    }
+    if ((limit_at != 0) && (pos >= limit_at)) {
+      // the limit is set shortly ahead of the running stepper
+      int32_t queue_end = s->getPositionAfterCommandsCompleted();
+      if (reverse) {
+        test(s->moveTo(0) == MOVE_OK, "reversal not accepted");
+        s->setPositionLimits(-100000, queue_end);
+      } else {
+        s->setPositionLimits(-100000, queue_end + 50);
+      }
+      limit_at = 0;
+    }
+    if (!s->isRampGeneratorActive()) {
+      break;
+    }
+    s->manage();
+  }
+  // stopped
+  fas_queue[0].ticks_at_queue_end = TICKS_FOR_STOPPED_MOTOR;
+}
+
+// keepRunning() stops at the software limits and a move beyond is rejected
+void limit_test() {
+  puts("limit_test...");
+  init_queue();
+  FastAccelStepper s0 = FastAccelStepper();
+  s0.init(0, 0);
+  s0.setDirectionPin(2);
+  s0.setSpeed(100);
+  s0.setAcceleration(100000);
+  s0.setPositionLimits(-500, 2000);
+  test(s0.moveTo(2001) == MOVE_ERR_POSITION_LIMIT, "target above accepted");
+  test(s0.move(-501) == MOVE_ERR_POSITION_LIMIT, "target below accepted");
+  int32_t max_pos, min_pos;
+  uint32_t last_ticks;
+  test(s0.moveTo(1000) == MOVE_OK, "move not accepted");
+  s0.keepRunning();
+  run_to_stop(&s0, &max_pos, &min_pos, &last_ticks);
+  test(max_pos == 2000, "upper limit passed");
+  test(s0.getCurrentPosition() == 2000, "not stopped at the upper limit");
+  // decelerated from 1600 ticks
+  test(last_ticks > 10 * US_TO_TICKS(100), "stop without deceleration");
+
+  test(s0.moveTo(0) == MOVE_OK, "move back not accepted");
+  s0.keepRunning();
+  run_to_stop(&s0, &max_pos, &min_pos, &last_ticks);
+  test(min_pos == -500, "lower limit passed");
+  test(s0.getCurrentPosition() == -500, "not stopped at the lower limit");
+  test(last_ticks > 10 * US_TO_TICKS(100), "stop without deceleration");
+
+  // A limit set at full speed 50 steps ahead shortens the deceleration
+  s0.clearPositionLimits();
+  test(s0.moveTo(100000) == MOVE_OK, "move without limits not accepted");
+  run_to_stop(&s0, &max_pos, &min_pos, &last_ticks, 1500);
+  test(s0.getCurrentPosition() == max_pos, "limit passed");
+  test(max_pos < 1500 + 200, "late stop at the limit");
+
+  // A limit at the queue end keeps the pending reversal
+  test(s0.moveTo(0) == MOVE_OK, "move back not accepted");
+  run_to_stop(&s0, &max_pos, &min_pos, &last_ticks);
+  s0.clearPositionLimits();
+  test(s0.moveTo(100000) == MOVE_OK, "move without limits not accepted");
+  run_to_stop(&s0, &max_pos, &min_pos, &last_ticks, 1500, true);
+  test(s0.getCurrentPosition() == 0, "reversal at the limit dropped");
+  test(max_pos < 1500 + 200, "limit passed");
+  // the lower limit is behind the stepper
+  test(s0.setPositionLimits(100, 200) == MOVE_OK, "limits not accepted");
+  test(s0.setPositionLimits(200, 100) == MOVE_ERR_POSITION_LIMIT,
+       "min_pos > max_pos accepted");
+  test(s0.moveTo(150) == MOVE_OK, "move into the limits not accepted");
+  run_to_stop(&s0, &max_pos, &min_pos, &last_ticks);
+  test(s0.getCurrentPosition() == 150, "move into the limits stopped");
+  puts("...done");
+}
+
+void arc_error_test() {
+  puts("arc_error_test...");
+  init_queue();
+  FastAccelStepperEngine engine = FastAccelStepperEngine();
+  FastAccelStepper s0 = FastAccelStepper();
+  FastAccelStepper s1 = FastAccelStepper();
+  s0.init(0, 0);
+  s1.init(1, 1);
+  s0.setDirectionPin(2);
+  test(engine.arcTo(&s0, &s1, 100, 0, 200, 0, false, 100, 100000) ==
+           MOVE_ERR_NO_DIRECTION_PIN,
+       "direction pin not checked");
+  s1.setDirectionPin(3);
+  test(engine.arcTo(&s0, &s1, 100, 0, 203, 0, false, 100, 100000) ==
+           MOVE_ERR_ARC_GEOMETRY,
+       "end off the circle accepted");
+  test(engine.arcTo(&s0, &s1, 0, 0, 0, 0, false, 100, 100000) ==
+           MOVE_ERR_ARC_GEOMETRY,
+       "radius 0 accepted");
+  test(engine.arcTo(&s0, &s1, 100, 0, 200, 0, false, 100, 0) ==
+           MOVE_ERR_ACCELERATION_IS_UNDEFINED,
+       "acceleration not checked");
+  puts("...done");
+}
+
 int main() {
   basic_test_with_empty_queue();
+  linear_move_test();
+  // full circle, half circle with r = 500 and an end off the lattice circle
+  arc_test(-1000, 0, 0, 0, false, 0);
+  arc_test(-300, -400, -600, -800, true, 0);
+  arc_test(-707, 0, -1414, -1, true, 0);
+  arc_test(0, 600, -600, 600, false, 10);
+  arc_error_test();
+  gear_test(1, 2);
+  gear_test(-3, 2);
+  gear_limit_test();
+  follower_limit_test();
+  sync_test();
+  position_event_test();
+  limit_test();
+  engine_config_test();
+  stop_test(false);
+  stop_test(true);
   //             steps  ticks_us  accel    maxspeed  min/max_total_time
   // jumps in speed in real on esp32
   test_with_pars("f1", 1000, 4300, 10000, true, 4.5 - 0.2, 4.5 + 0.2, 0.5);
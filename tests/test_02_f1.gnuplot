@@ -0,0 +1,507 @@
+$data <<EOF
+0.112640 142.05 112640
+0.192512 200.32 79872
+0.261312 232.56 68800
+0.398912 232.56 68800
+0.536512 232.56 68800
+0.674112 232.56 68800
+0.811712 232.56 68800
+0.949312 232.56 68800
+1.086912 232.56 68800
+1.224512 232.56 68800
+1.362112 232.56 68800
+1.499712 232.56 68800
+1.637312 232.56 68800
+1.774912 232.56 68800
+1.912512 232.56 68800
+2.050112 232.56 68800
+2.187712 232.56 68800
+2.325312 232.56 68800
+2.462912 232.56 68800
+2.600512 232.56 68800
+2.738112 232.56 68800
+2.875712 232.56 68800
+3.013312 232.56 68800
+3.150912 232.56 68800
+3.288512 232.56 68800
+3.426112 232.56 68800
+3.563712 232.56 68800
+3.701312 232.56 68800
+3.838912 232.56 68800
+3.976512 232.56 68800
+4.114112 232.56 68800
+4.251712 232.56 68800
+4.389312 232.56 68800
+4.526912 232.56 68800
+4.664512 232.56 68800
+4.802112 232.56 68800
+4.939712 232.56 68800
+5.077312 232.56 68800
+5.214912 232.56 68800
+5.352512 232.56 68800
+5.490112 232.56 68800
+5.627712 232.56 68800
+5.765312 232.56 68800
+5.902912 232.56 68800
+6.040512 232.56 68800
+6.178112 232.56 68800
+6.315712 232.56 68800
+6.453312 232.56 68800
+6.590912 232.56 68800
+6.728512 232.56 68800
+6.866112 232.56 68800
+7.003712 232.56 68800
+7.141312 232.56 68800
+7.278912 232.56 68800
+7.416512 232.56 68800
+7.554112 232.56 68800
+7.691712 232.56 68800
+7.829312 232.56 68800
+7.966912 232.56 68800
+8.104512 232.56 68800
+8.242112 232.56 68800
+8.379712 232.56 68800
+8.517312 232.56 68800
+8.654912 232.56 68800
+8.792512 232.56 68800
+8.930112 232.56 68800
+9.067712 232.56 68800
+9.205312 232.56 68800
+9.342912 232.56 68800
+9.480512 232.56 68800
+9.618112 232.56 68800
+9.755712 232.56 68800
+9.893312 232.56 68800
+10.030912 232.56 68800
+10.168512 232.56 68800
+10.306112 232.56 68800
+10.443712 232.56 68800
+10.581312 232.56 68800
+10.718912 232.56 68800
+10.856512 232.56 68800
+10.994112 232.56 68800
+11.131712 232.56 68800
+11.269312 232.56 68800
+11.406912 232.56 68800
+11.544512 232.56 68800
+11.682112 232.56 68800
+11.819712 232.56 68800
+11.957312 232.56 68800
+12.094912 232.56 68800
+12.232512 232.56 68800
+12.370112 232.56 68800
+12.507712 232.56 68800
+12.645312 232.56 68800
+12.782912 232.56 68800
+12.920512 232.56 68800
+13.058112 232.56 68800
+13.195712 232.56 68800
+13.333312 232.56 68800
+13.470912 232.56 68800
+13.608512 232.56 68800
+13.746112 232.56 68800
+13.883712 232.56 68800
+14.021312 232.56 68800
+14.158912 232.56 68800
+14.296512 232.56 68800
+14.434112 232.56 68800
+14.571712 232.56 68800
+14.709312 232.56 68800
+14.846912 232.56 68800
+14.984512 232.56 68800
+15.122112 232.56 68800
+15.259712 232.56 68800
+15.397312 232.56 68800
+15.534912 232.56 68800
+15.672512 232.56 68800
+15.810112 232.56 68800
+15.947712 232.56 68800
+16.085312 232.56 68800
+16.222912 232.56 68800
+16.360512 232.56 68800
+16.498112 232.56 68800
+16.635712 232.56 68800
+16.773312 232.56 68800
+16.910912 232.56 68800
+17.048512 232.56 68800
+17.186112 232.56 68800
+17.323712 232.56 68800
+17.461312 232.56 68800
+17.598912 232.56 68800
+17.736512 232.56 68800
+17.874112 232.56 68800
+18.011712 232.56 68800
+18.149312 232.56 68800
+18.286912 232.56 68800
+18.424512 232.56 68800
+18.562112 232.56 68800
+18.699712 232.56 68800
+18.837312 232.56 68800
+18.974912 232.56 68800
+19.112512 232.56 68800
+19.250112 232.56 68800
+19.387712 232.56 68800
+19.525312 232.56 68800
+19.662912 232.56 68800
+19.800512 232.56 68800
+19.938112 232.56 68800
+20.075712 232.56 68800
+20.213312 232.56 68800
+20.350912 232.56 68800
+20.488512 232.56 68800
+20.626112 232.56 68800
+20.763712 232.56 68800
+20.901312 232.56 68800
+21.038912 232.56 68800
+21.176512 232.56 68800
+21.314112 232.56 68800
+21.451712 232.56 68800
+21.589312 232.56 68800
+21.726912 232.56 68800
+21.864512 232.56 68800
+22.002112 232.56 68800
+22.139712 232.56 68800
+22.277312 232.56 68800
+22.414912 232.56 68800
+22.552512 232.56 68800
+22.690112 232.56 68800
+22.827712 232.56 68800
+22.965312 232.56 68800
+23.102912 232.56 68800
+23.240512 232.56 68800
+23.378112 232.56 68800
+23.515712 232.56 68800
+23.653312 232.56 68800
+23.790912 232.56 68800
+23.928512 232.56 68800
+24.066112 232.56 68800
+24.203712 232.56 68800
+24.341312 232.56 68800
+24.478912 232.56 68800
+24.616512 232.56 68800
+24.754112 232.56 68800
+24.891712 232.56 68800
+25.029312 232.56 68800
+25.166912 232.56 68800
+25.304512 232.56 68800
+25.442112 232.56 68800
+25.579712 232.56 68800
+25.717312 232.56 68800
+25.854912 232.56 68800
+25.992512 232.56 68800
+26.130112 232.56 68800
+26.267712 232.56 68800
+26.405312 232.56 68800
+26.542912 232.56 68800
+26.680512 232.56 68800
+26.818112 232.56 68800
+26.955712 232.56 68800
+27.093312 232.56 68800
+27.230912 232.56 68800
+27.368512 232.56 68800
+27.506112 232.56 68800
+27.643712 232.56 68800
+27.781312 232.56 68800
+27.918912 232.56 68800
+28.056512 232.56 68800
+28.194112 232.56 68800
+28.331712 232.56 68800
+28.469312 232.56 68800
+28.606912 232.56 68800
+28.744512 232.56 68800
+28.882112 232.56 68800
+29.019712 232.56 68800
+29.157312 232.56 68800
+29.294912 232.56 68800
+29.432512 232.56 68800
+29.570112 232.56 68800
+29.707712 232.56 68800
+29.845312 232.56 68800
+29.982912 232.56 68800
+30.120512 232.56 68800
+30.258112 232.56 68800
+30.395712 232.56 68800
+30.533312 232.56 68800
+30.670912 232.56 68800
+30.808512 232.56 68800
+30.946112 232.56 68800
+31.083712 232.56 68800
+31.221312 232.56 68800
+31.358912 232.56 68800
+31.496512 232.56 68800
+31.634112 232.56 68800
+31.771712 232.56 68800
+31.909312 232.56 68800
+32.046912 232.56 68800
+32.184512 232.56 68800
+32.322112 232.56 68800
+32.459712 232.56 68800
+32.597312 232.56 68800
+32.734912 232.56 68800
+32.872512 232.56 68800
+33.010112 232.56 68800
+33.147712 232.56 68800
+33.285312 232.56 68800
+33.422912 232.56 68800
+33.560512 232.56 68800
+33.698112 232.56 68800
+33.835712 232.56 68800
+33.973312 232.56 68800
+34.110912 232.56 68800
+34.248512 232.56 68800
+34.386112 232.56 68800
+34.523712 232.56 68800
+34.661312 232.56 68800
+34.798912 232.56 68800
+34.936512 232.56 68800
+35.074112 232.56 68800
+35.211712 232.56 68800
+35.349312 232.56 68800
+35.486912 232.56 68800
+35.624512 232.56 68800
+35.762112 232.56 68800
+35.899712 232.56 68800
+36.037312 232.56 68800
+36.174912 232.56 68800
+36.312512 232.56 68800
+36.450112 232.56 68800
+36.587712 232.56 68800
+36.725312 232.56 68800
+36.862912 232.56 68800
+37.000512 232.56 68800
+37.138112 232.56 68800
+37.275712 232.56 68800
+37.413312 232.56 68800
+37.550912 232.56 68800
+37.688512 232.56 68800
+37.826112 232.56 68800
+37.963712 232.56 68800
+38.101312 232.56 68800
+38.238912 232.56 68800
+38.376512 232.56 68800
+38.514112 232.56 68800
+38.651712 232.56 68800
+38.789312 232.56 68800
+38.926912 232.56 68800
+39.064512 232.56 68800
+39.202112 232.56 68800
+39.339712 232.56 68800
+39.477312 232.56 68800
+39.614912 232.56 68800
+39.752512 232.56 68800
+39.890112 232.56 68800
+40.027712 232.56 68800
+40.165312 232.56 68800
+40.302912 232.56 68800
+40.440512 232.56 68800
+40.578112 232.56 68800
+40.715712 232.56 68800
+40.853312 232.56 68800
+40.990912 232.56 68800
+41.128512 232.56 68800
+41.266112 232.56 68800
+41.403712 232.56 68800
+41.541312 232.56 68800
+41.678912 232.56 68800
+41.816512 232.56 68800
+41.954112 232.56 68800
+42.091712 232.56 68800
+42.229312 232.56 68800
+42.366912 232.56 68800
+42.504512 232.56 68800
+42.642112 232.56 68800
+42.779712 232.56 68800
+42.917312 232.56 68800
+43.054912 232.56 68800
+43.192512 232.56 68800
+43.330112 232.56 68800
+43.467712 232.56 68800
+43.605312 232.56 68800
+43.742912 232.56 68800
+43.880512 232.56 68800
+44.018112 232.56 68800
+44.155712 232.56 68800
+44.293312 232.56 68800
+44.430912 232.56 68800
+44.568512 232.56 68800
+44.706112 232.56 68800
+44.843712 232.56 68800
+44.981312 232.56 68800
+45.118912 232.56 68800
+45.256512 232.56 68800
+45.394112 232.56 68800
+45.531712 232.56 68800
+45.669312 232.56 68800
+45.806912 232.56 68800
+45.944512 232.56 68800
+46.082112 232.56 68800
+46.219712 232.56 68800
+46.357312 232.56 68800
+46.494912 232.56 68800
+46.632512 232.56 68800
+46.770112 232.56 68800
+46.907712 232.56 68800
+47.045312 232.56 68800
+47.182912 232.56 68800
+47.320512 232.56 68800
+47.458112 232.56 68800
+47.595712 232.56 68800
+47.733312 232.56 68800
+47.870912 232.56 68800
+48.008512 232.56 68800
+48.146112 232.56 68800
+48.283712 232.56 68800
+48.421312 232.56 68800
+48.558912 232.56 68800
+48.696512 232.56 68800
+48.834112 232.56 68800
+48.971712 232.56 68800
+49.109312 232.56 68800
+49.246912 232.56 68800
+49.384512 232.56 68800
+49.522112 232.56 68800
+49.659712 232.56 68800
+49.797312 232.56 68800
+49.934912 232.56 68800
+50.072512 232.56 68800
+50.210112 232.56 68800
+50.347712 232.56 68800
+50.485312 232.56 68800
+50.622912 232.56 68800
+50.760512 232.56 68800
+50.898112 232.56 68800
+51.035712 232.56 68800
+51.173312 232.56 68800
+51.310912 232.56 68800
+51.448512 232.56 68800
+51.586112 232.56 68800
+51.723712 232.56 68800
+51.861312 232.56 68800
+51.998912 232.56 68800
+52.136512 232.56 68800
+52.274112 232.56 68800
+52.411712 232.56 68800
+52.549312 232.56 68800
+52.686912 232.56 68800
+52.824512 232.56 68800
+52.962112 232.56 68800
+53.099712 232.56 68800
+53.237312 232.56 68800
+53.374912 232.56 68800
+53.512512 232.56 68800
+53.650112 232.56 68800
+53.787712 232.56 68800
+53.925312 232.56 68800
+54.062912 232.56 68800
+54.200512 232.56 68800
+54.338112 232.56 68800
+54.475712 232.56 68800
+54.613312 232.56 68800
+54.750912 232.56 68800
+54.888512 232.56 68800
+55.026112 232.56 68800
+55.163712 232.56 68800
+55.301312 232.56 68800
+55.438912 232.56 68800
+55.576512 232.56 68800
+55.714112 232.56 68800
+55.851712 232.56 68800
+55.989312 232.56 68800
+56.126912 232.56 68800
+56.264512 232.56 68800
+56.402112 232.56 68800
+56.539712 232.56 68800
+56.677312 232.56 68800
+56.814912 232.56 68800
+56.952512 232.56 68800
+57.090112 232.56 68800
+57.227712 232.56 68800
+57.365312 232.56 68800
+57.502912 232.56 68800
+57.640512 232.56 68800
+57.778112 232.56 68800
+57.915712 232.56 68800
+58.053312 232.56 68800
+58.190912 232.56 68800
+58.328512 232.56 68800
+58.466112 232.56 68800
+58.603712 232.56 68800
+58.741312 232.56 68800
+58.878912 232.56 68800
+59.016512 232.56 68800
+59.154112 232.56 68800
+59.291712 232.56 68800
+59.429312 232.56 68800
+59.566912 232.56 68800
+59.704512 232.56 68800
+59.842112 232.56 68800
+59.979712 232.56 68800
+60.117312 232.56 68800
+60.254912 232.56 68800
+60.392512 232.56 68800
+60.530112 232.56 68800
+60.667712 232.56 68800
+60.805312 232.56 68800
+60.942912 232.56 68800
+61.080512 232.56 68800
+61.218112 232.56 68800
+61.355712 232.56 68800
+61.493312 232.56 68800
+61.630912 232.56 68800
+61.768512 232.56 68800
+61.906112 232.56 68800
+62.043712 232.56 68800
+62.181312 232.56 68800
+62.318912 232.56 68800
+62.456512 232.56 68800
+62.594112 232.56 68800
+62.731712 232.56 68800
+62.869312 232.56 68800
+63.006912 232.56 68800
+63.144512 232.56 68800
+63.282112 232.56 68800
+63.419712 232.56 68800
+63.557312 232.56 68800
+63.694912 232.56 68800
+63.832512 232.56 68800
+63.970112 232.56 68800
+64.107712 232.56 68800
+64.245312 232.56 68800
+64.382912 232.56 68800
+64.520512 232.56 68800
+64.658112 232.56 68800
+64.795712 232.56 68800
+64.933312 232.56 68800
+65.070912 232.56 68800
+65.208512 232.56 68800
+65.346112 232.56 68800
+65.483712 232.56 68800
+65.621312 232.56 68800
+65.758912 232.56 68800
+65.896512 232.56 68800
+66.034112 232.56 68800
+66.171712 232.56 68800
+66.309312 232.56 68800
+66.446912 232.56 68800
+66.584512 232.56 68800
+66.722112 232.56 68800
+66.859712 232.56 68800
+66.997312 232.56 68800
+67.134912 232.56 68800
+67.272512 232.56 68800
+67.410112 232.56 68800
+67.547712 232.56 68800
+67.685312 232.56 68800
+67.822912 232.56 68800
+67.960512 232.56 68800
+68.098112 232.56 68800
+68.235712 232.56 68800
+68.373312 232.56 68800
+68.510912 232.56 68800
+68.648512 232.56 68800
+68.728384 200.32 79872
+68.841024 142.05 112640
+69.000768 100.16 159744
+EOF
+plot $data using 1:2 with linespoints
+pause -1
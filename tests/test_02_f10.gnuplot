@@ -0,0 +1,9513 @@
+$data <<EOF
+0.356352 44.90 356352
+0.609280 63.26 252928
+0.815104 77.74 205824
+0.993280 89.80 178176
+1.153024 100.16 159744
+1.298432 110.04 145408
+1.433600 118.37 135168
+1.560064 126.52 126464
+1.679360 134.12 119296
+1.792000 142.05 112640
+1.899520 148.81 107520
+2.002432 155.47 102912
+2.101248 161.92 98816
+2.196480 168.01 95232
+2.288640 173.61 92160
+2.377728 179.60 89088
+2.464256 184.91 86528
+2.548224 190.55 83968
+2.630144 195.31 81920
+2.710016 200.32 79872
+2.787840 205.59 77824
+2.863616 211.15 75776
+2.937856 215.52 74240
+3.010560 220.07 72704
+3.082240 223.21 71680
+3.152384 228.10 70144
+3.221504 231.48 69120
+3.289088 236.74 67584
+3.355136 242.25 66048
+3.420416 245.10 65280
+3.484672 249.00 64256
+3.547904 253.04 63232
+3.610112 257.20 62208
+3.671296 261.51 61184
+3.731712 264.83 60416
+3.791360 268.24 59648
+3.849984 272.93 58624
+3.907840 276.55 57856
+3.965184 279.02 57344
+4.021504 284.09 56320
+4.077312 286.70 55808
+4.132608 289.35 55296
+4.187136 293.43 54528
+4.240896 297.62 53760
+4.294144 300.48 53248
+4.346624 304.88 52480
+4.398592 307.88 51968
+4.450048 310.95 51456
+4.501248 312.50 51200
+4.551936 315.66 50688
+4.602112 318.88 50176
+4.651520 323.83 49408
+4.700416 327.23 48896
+4.749056 328.95 48640
+4.797184 332.45 48128
+4.844800 336.02 47616
+4.892160 337.84 47360
+4.939008 341.53 46848
+4.985344 345.30 46336
+5.031424 347.22 46080
+5.076992 351.12 45568
+5.122304 353.11 45312
+5.167104 357.14 44800
+5.211648 359.20 44544
+5.255936 361.27 44288
+5.299968 363.37 44032
+5.343744 365.50 43776
+5.387008 369.82 43264
+5.430016 372.02 43008
+5.472768 374.25 42752
+5.515008 378.79 42240
+5.556992 381.10 41984
+5.598720 383.44 41728
+5.640192 385.80 41472
+5.681408 388.20 41216
+5.722368 390.62 40960
+5.763072 393.08 40704
+5.803520 395.57 40448
+5.843712 398.09 40192
+5.883648 400.64 39936
+5.923328 403.23 39680
+5.962752 405.84 39424
+6.001920 408.50 39168
+6.040832 411.18 38912
+6.079744 411.18 38912
+6.118400 413.91 38656
+6.156800 416.67 38400
+6.194688 422.30 37888
+6.232320 425.17 37632
+6.269952 425.17 37632
+6.307328 428.08 37376
+6.344448 431.03 37120
+6.381312 434.03 36864
+6.418176 434.03 36864
+6.454784 437.06 36608
+6.491136 440.14 36352
+6.527232 443.26 36096
+6.563328 443.26 36096
+6.599168 446.43 35840
+6.635008 446.43 35840
+6.670592 449.64 35584
+6.705920 452.90 35328
+6.740992 456.20 35072
+6.776064 456.20 35072
+6.810880 459.56 34816
+6.845440 462.96 34560
+6.880000 462.96 34560
+6.914560 462.96 34560
+6.948864 466.42 34304
+6.982912 469.92 34048
+7.016704 473.48 33792
+7.050496 473.48 33792
+7.084032 477.10 33536
+7.117568 477.10 33536
+7.150848 480.77 33280
+7.183872 484.50 33024
+7.216896 484.50 33024
+7.249664 488.28 32768
+7.282432 488.28 32768
+7.315072 490.20 32640
+7.347584 492.13 32512
+7.379840 496.03 32256
+7.412096 496.03 32256
+7.444224 498.01 32128
+7.476224 500.00 32000
+7.507968 504.03 31744
+7.539712 504.03 31744
+7.571328 506.07 31616
+7.602816 508.13 31488
+7.634048 512.30 31232
+7.665280 512.30 31232
+7.696384 514.40 31104
+7.727360 516.53 30976
+7.758336 516.53 30976
+7.789056 520.83 30720
+7.819648 523.01 30592
+7.850240 523.01 30592
+7.880704 525.21 30464
+7.910912 529.66 30208
+7.941120 529.66 30208
+7.971200 531.91 30080
+8.001152 534.19 29952
+8.031104 534.19 29952
+8.060928 536.48 29824
+8.090496 541.13 29568
+8.120064 541.13 29568
+8.149504 543.48 29440
+8.178816 545.85 29312
+8.208128 545.85 29312
+8.237312 548.25 29184
+8.266496 548.25 29184
+8.295424 553.10 28928
+8.324224 555.56 28800
+8.353024 555.56 28800
+8.381696 558.04 28672
+8.410368 558.04 28672
+8.438912 560.54 28544
+8.467200 565.61 28288
+8.495488 565.61 28288
+8.523648 568.18 28160
+8.551808 568.18 28160
+8.579840 570.78 28032
+8.607872 570.78 28032
+8.635776 573.39 27904
+8.663552 576.04 27776
+8.691328 576.04 27776
+8.718976 578.70 27648
+8.746624 578.70 27648
+8.774016 584.11 27392
+8.801408 584.11 27392
+8.828672 586.85 27264
+8.855936 586.85 27264
+8.883072 589.62 27136
+8.910208 589.62 27136
+8.937216 592.42 27008
+8.964096 595.24 26880
+8.990976 595.24 26880
+9.017728 598.09 26752
+9.044480 598.09 26752
+9.071104 600.96 26624
+9.097728 600.96 26624
+9.124096 606.80 26368
+9.150464 606.80 26368
+9.176704 609.76 26240
+9.202944 609.76 26240
+9.229056 612.75 26112
+9.255168 612.75 26112
+9.281152 615.76 25984
+9.307136 615.76 25984
+9.332992 618.81 25856
+9.358848 618.81 25856
+9.384576 621.89 25728
+9.410304 621.89 25728
+9.435904 625.00 25600
+9.461504 625.00 25600
+9.487104 625.00 25600
+9.512576 628.14 25472
+9.538048 628.14 25472
+9.563392 631.31 25344
+9.588736 631.31 25344
+9.613952 634.52 25216
+9.639168 634.52 25216
+9.664256 637.76 25088
+9.689344 637.76 25088
+9.714176 644.33 24832
+9.739008 644.33 24832
+9.763712 647.67 24704
+9.788416 647.67 24704
+9.813120 647.67 24704
+9.837696 651.04 24576
+9.862272 651.04 24576
+9.886720 654.45 24448
+9.911168 654.45 24448
+9.935488 657.89 24320
+9.959808 657.89 24320
+9.984128 657.89 24320
+10.008320 661.38 24192
+10.032512 661.38 24192
+10.056576 664.89 24064
+10.080640 664.89 24064
+10.104576 668.45 23936
+10.128512 668.45 23936
+10.152448 668.45 23936
+10.176256 672.04 23808
+10.200064 672.04 23808
+10.223744 675.68 23680
+10.247424 675.68 23680
+10.271104 675.68 23680
+10.294656 679.35 23552
+10.318208 679.35 23552
+10.341632 683.06 23424
+10.365056 683.06 23424
+10.388480 683.06 23424
+10.411776 686.81 23296
+10.435072 686.81 23296
+10.458240 690.61 23168
+10.481408 690.61 23168
+10.504576 690.61 23168
+10.527616 694.44 23040
+10.550656 694.44 23040
+10.573568 698.32 22912
+10.596480 698.32 22912
+10.619392 698.32 22912
+10.642176 702.25 22784
+10.664960 702.25 22784
+10.687744 702.25 22784
+10.710400 706.21 22656
+10.733056 706.21 22656
+10.755584 710.23 22528
+10.778112 710.23 22528
+10.800640 710.23 22528
+10.823040 714.29 22400
+10.845440 714.29 22400
+10.867840 714.29 22400
+10.890112 718.39 22272
+10.912384 718.39 22272
+10.934656 718.39 22272
+10.956928 718.39 22272
+10.979200 718.39 22272
+11.001344 722.54 22144
+11.023488 722.54 22144
+11.045632 722.54 22144
+11.067776 722.54 22144
+11.089792 726.74 22016
+11.111808 726.74 22016
+11.133696 730.99 21888
+11.155584 730.99 21888
+11.177472 730.99 21888
+11.199360 730.99 21888
+11.221120 735.29 21760
+11.242880 735.29 21760
+11.264512 739.64 21632
+11.286144 739.64 21632
+11.307776 739.64 21632
+11.329408 739.64 21632
+11.350912 744.05 21504
+11.372416 744.05 21504
+11.393792 748.50 21376
+11.415168 748.50 21376
+11.436544 748.50 21376
+11.457920 748.50 21376
+11.479168 753.01 21248
+11.500416 753.01 21248
+11.521536 757.58 21120
+11.542656 757.58 21120
+11.563776 757.58 21120
+11.584896 757.58 21120
+11.605888 762.20 20992
+11.626880 762.20 20992
+11.647744 766.87 20864
+11.668608 766.87 20864
+11.689472 766.87 20864
+11.710336 766.87 20864
+11.731200 766.87 20864
+11.752064 766.87 20864
+11.772800 771.60 20736
+11.793536 771.60 20736
+11.814272 771.60 20736
+11.835008 771.60 20736
+11.855616 776.40 20608
+11.876224 776.40 20608
+11.896832 776.40 20608
+11.917440 776.40 20608
+11.937920 781.25 20480
+11.958400 781.25 20480
+11.978752 786.16 20352
+11.999104 786.16 20352
+12.019456 786.16 20352
+12.039808 786.16 20352
+12.060032 791.14 20224
+12.080256 791.14 20224
+12.100480 791.14 20224
+12.120704 791.14 20224
+12.140800 796.18 20096
+12.160896 796.18 20096
+12.180992 796.18 20096
+12.201088 796.18 20096
+12.221184 796.18 20096
+12.241280 796.18 20096
+12.261248 801.28 19968
+12.281216 801.28 19968
+12.301184 801.28 19968
+12.321152 801.28 19968
+12.340992 806.45 19840
+12.360832 806.45 19840
+12.380672 806.45 19840
+12.400512 806.45 19840
+12.420224 811.69 19712
+12.439936 811.69 19712
+12.459520 816.99 19584
+12.479104 816.99 19584
+12.498688 816.99 19584
+12.518272 816.99 19584
+12.537728 822.37 19456
+12.557184 822.37 19456
+12.576640 822.37 19456
+12.596096 822.37 19456
+12.615552 822.37 19456
+12.635008 822.37 19456
+12.654464 822.37 19456
+12.673920 822.37 19456
+12.693248 827.81 19328
+12.712576 827.81 19328
+12.731904 827.81 19328
+12.751232 827.81 19328
+12.770432 833.33 19200
+12.789632 833.33 19200
+12.808832 833.33 19200
+12.828032 833.33 19200
+12.847104 838.93 19072
+12.866176 838.93 19072
+12.885120 844.59 18944
+12.904064 844.59 18944
+12.923008 844.59 18944
+12.941952 844.59 18944
+12.960768 850.34 18816
+12.979584 850.34 18816
+12.998400 850.34 18816
+13.017216 850.34 18816
+13.036032 850.34 18816
+13.054848 850.34 18816
+13.073664 850.34 18816
+13.092480 850.34 18816
+13.111168 856.16 18688
+13.129856 856.16 18688
+13.148544 856.16 18688
+13.167232 856.16 18688
+13.185792 862.07 18560
+13.204352 862.07 18560
+13.222912 862.07 18560
+13.241472 862.07 18560
+13.259904 868.06 18432
+13.278336 868.06 18432
+13.296768 868.06 18432
+13.315200 868.06 18432
+13.333632 868.06 18432
+13.352064 868.06 18432
+13.370496 868.06 18432
+13.388928 868.06 18432
+13.407232 874.13 18304
+13.425536 874.13 18304
+13.443840 874.13 18304
+13.462144 874.13 18304
+13.480320 880.28 18176
+13.498496 880.28 18176
+13.516672 880.28 18176
+13.534848 880.28 18176
+13.552896 886.52 18048
+13.570944 886.52 18048
+13.588992 886.52 18048
+13.607040 886.52 18048
+13.625088 886.52 18048
+13.643136 886.52 18048
+13.661056 892.86 17920
+13.678976 892.86 17920
+13.696896 892.86 17920
+13.714816 892.86 17920
+13.732736 892.86 17920
+13.750656 892.86 17920
+13.768576 892.86 17920
+13.786496 892.86 17920
+13.804288 899.28 17792
+13.822080 899.28 17792
+13.839872 899.28 17792
+13.857664 899.28 17792
+13.875328 905.80 17664
+13.892992 905.80 17664
+13.910656 905.80 17664
+13.928320 905.80 17664
+13.945856 912.41 17536
+13.963392 912.41 17536
+13.980928 912.41 17536
+13.998464 912.41 17536
+14.016000 912.41 17536
+14.033536 912.41 17536
+14.051072 912.41 17536
+14.068608 912.41 17536
+14.086144 912.41 17536
+14.103680 912.41 17536
+14.121088 919.12 17408
+14.138496 919.12 17408
+14.155904 919.12 17408
+14.173312 919.12 17408
+14.190592 925.93 17280
+14.207872 925.93 17280
+14.225152 925.93 17280
+14.242432 925.93 17280
+14.259712 925.93 17280
+14.276992 925.93 17280
+14.294272 925.93 17280
+14.311552 925.93 17280
+14.328832 925.93 17280
+14.346112 925.93 17280
+14.363264 932.84 17152
+14.380416 932.84 17152
+14.397568 932.84 17152
+14.414720 932.84 17152
+14.431744 939.85 17024
+14.448768 939.85 17024
+14.465792 939.85 17024
+14.482816 939.85 17024
+14.499712 946.97 16896
+14.516608 946.97 16896
+14.533504 946.97 16896
+14.550400 946.97 16896
+14.567296 946.97 16896
+14.584192 946.97 16896
+14.601088 946.97 16896
+14.617984 946.97 16896
+14.634880 946.97 16896
+14.651776 946.97 16896
+14.668544 954.20 16768
+14.685312 954.20 16768
+14.702080 954.20 16768
+14.718848 954.20 16768
+14.735616 954.20 16768
+14.752384 954.20 16768
+14.769024 961.54 16640
+14.785664 961.54 16640
+14.802304 961.54 16640
+14.818944 961.54 16640
+14.835456 968.99 16512
+14.851968 968.99 16512
+14.868480 968.99 16512
+14.884992 968.99 16512
+14.901504 968.99 16512
+14.918016 968.99 16512
+14.934528 968.99 16512
+14.951040 968.99 16512
+14.967552 968.99 16512
+14.984064 968.99 16512
+15.000448 976.56 16384
+15.016832 976.56 16384
+15.033216 976.56 16384
+15.049600 976.56 16384
+15.065984 976.56 16384
+15.082368 976.56 16384
+15.098688 980.39 16320
+15.115008 980.39 16320
+15.131328 980.39 16320
+15.147648 980.39 16320
+15.163904 984.25 16256
+15.180160 984.25 16256
+15.196416 984.25 16256
+15.212672 984.25 16256
+15.228928 984.25 16256
+15.245184 984.25 16256
+15.261312 992.06 16128
+15.277440 992.06 16128
+15.293568 992.06 16128
+15.309696 992.06 16128
+15.325824 992.06 16128
+15.341952 992.06 16128
+15.358016 996.02 16064
+15.374080 996.02 16064
+15.390144 996.02 16064
+15.406208 996.02 16064
+15.422208 1000.00 16000
+15.438208 1000.00 16000
+15.454208 1000.00 16000
+15.470208 1000.00 16000
+15.486208 1000.00 16000
+15.502208 1000.00 16000
+15.518080 1008.06 15872
+15.533952 1008.06 15872
+15.549824 1008.06 15872
+15.565696 1008.06 15872
+15.581568 1008.06 15872
+15.597440 1008.06 15872
+15.613248 1012.15 15808
+15.629056 1012.15 15808
+15.644864 1012.15 15808
+15.660672 1012.15 15808
+15.676480 1012.15 15808
+15.692288 1012.15 15808
+15.708032 1016.26 15744
+15.723776 1016.26 15744
+15.739520 1016.26 15744
+15.755264 1016.26 15744
+15.770880 1024.59 15616
+15.786496 1024.59 15616
+15.802112 1024.59 15616
+15.817728 1024.59 15616
+15.833344 1024.59 15616
+15.848960 1024.59 15616
+15.864576 1024.59 15616
+15.880192 1024.59 15616
+15.895744 1028.81 15552
+15.911296 1028.81 15552
+15.926848 1028.81 15552
+15.942400 1028.81 15552
+15.957888 1033.06 15488
+15.973376 1033.06 15488
+15.988864 1033.06 15488
+16.004352 1033.06 15488
+16.019840 1033.06 15488
+16.035328 1033.06 15488
+16.050816 1033.06 15488
+16.066304 1033.06 15488
+16.081664 1041.67 15360
+16.097024 1041.67 15360
+16.112384 1041.67 15360
+16.127744 1041.67 15360
+16.143040 1046.03 15296
+16.158336 1046.03 15296
+16.173632 1046.03 15296
+16.188928 1046.03 15296
+16.204224 1046.03 15296
+16.219520 1046.03 15296
+16.234816 1046.03 15296
+16.250112 1046.03 15296
+16.265344 1050.42 15232
+16.280576 1050.42 15232
+16.295808 1050.42 15232
+16.311040 1050.42 15232
+16.326144 1059.32 15104
+16.341248 1059.32 15104
+16.356352 1059.32 15104
+16.371456 1059.32 15104
+16.386560 1059.32 15104
+16.401664 1059.32 15104
+16.416768 1059.32 15104
+16.431872 1059.32 15104
+16.446912 1063.83 15040
+16.461952 1063.83 15040
+16.476992 1063.83 15040
+16.492032 1063.83 15040
+16.507008 1068.38 14976
+16.521984 1068.38 14976
+16.536960 1068.38 14976
+16.551936 1068.38 14976
+16.566912 1068.38 14976
+16.581888 1068.38 14976
+16.596864 1068.38 14976
+16.611840 1068.38 14976
+16.626752 1072.96 14912
+16.641664 1072.96 14912
+16.656576 1072.96 14912
+16.671488 1072.96 14912
+16.686272 1082.25 14784
+16.701056 1082.25 14784
+16.715840 1082.25 14784
+16.730624 1082.25 14784
+16.745408 1082.25 14784
+16.760192 1082.25 14784
+16.774976 1082.25 14784
+16.789760 1082.25 14784
+16.804480 1086.96 14720
+16.819200 1086.96 14720
+16.833920 1086.96 14720
+16.848640 1086.96 14720
+16.863296 1091.70 14656
+16.877952 1091.70 14656
+16.892608 1091.70 14656
+16.907264 1091.70 14656
+16.921920 1091.70 14656
+16.936576 1091.70 14656
+16.951232 1091.70 14656
+16.965888 1091.70 14656
+16.980480 1096.49 14592
+16.995072 1096.49 14592
+17.009664 1096.49 14592
+17.024256 1096.49 14592
+17.038848 1096.49 14592
+17.053440 1096.49 14592
+17.068032 1096.49 14592
+17.082624 1096.49 14592
+17.097088 1106.19 14464
+17.111552 1106.19 14464
+17.126016 1106.19 14464
+17.140480 1106.19 14464
+17.154880 1111.11 14400
+17.169280 1111.11 14400
+17.183680 1111.11 14400
+17.198080 1111.11 14400
+17.212480 1111.11 14400
+17.226880 1111.11 14400
+17.241280 1111.11 14400
+17.255680 1111.11 14400
+17.270016 1116.07 14336
+17.284352 1116.07 14336
+17.298688 1116.07 14336
+17.313024 1116.07 14336
+17.327360 1116.07 14336
+17.341696 1116.07 14336
+17.356032 1116.07 14336
+17.370368 1116.07 14336
+17.384640 1121.08 14272
+17.398912 1121.08 14272
+17.413184 1121.08 14272
+17.427456 1121.08 14272
+17.441600 1131.22 14144
+17.455744 1131.22 14144
+17.469888 1131.22 14144
+17.484032 1131.22 14144
+17.498176 1131.22 14144
+17.512320 1131.22 14144
+17.526464 1131.22 14144
+17.540608 1131.22 14144
+17.554688 1136.36 14080
+17.568768 1136.36 14080
+17.582848 1136.36 14080
+17.596928 1136.36 14080
+17.611008 1136.36 14080
+17.625088 1136.36 14080
+17.639168 1136.36 14080
+17.653248 1136.36 14080
+17.667264 1141.55 14016
+17.681280 1141.55 14016
+17.695296 1141.55 14016
+17.709312 1141.55 14016
+17.723328 1141.55 14016
+17.737344 1141.55 14016
+17.751360 1141.55 14016
+17.765376 1141.55 14016
+17.779328 1146.79 13952
+17.793280 1146.79 13952
+17.807232 1146.79 13952
+17.821184 1146.79 13952
+17.835072 1152.07 13888
+17.848960 1152.07 13888
+17.862848 1152.07 13888
+17.876736 1152.07 13888
+17.890624 1152.07 13888
+17.904512 1152.07 13888
+17.918400 1152.07 13888
+17.932288 1152.07 13888
+17.946112 1157.41 13824
+17.959936 1157.41 13824
+17.973760 1157.41 13824
+17.987584 1157.41 13824
+18.001408 1157.41 13824
+18.015232 1157.41 13824
+18.029056 1157.41 13824
+18.042880 1157.41 13824
+18.056576 1168.22 13696
+18.070272 1168.22 13696
+18.083968 1168.22 13696
+18.097664 1168.22 13696
+18.111360 1168.22 13696
+18.125056 1168.22 13696
+18.138752 1168.22 13696
+18.152448 1168.22 13696
+18.166080 1173.71 13632
+18.179712 1173.71 13632
+18.193344 1173.71 13632
+18.206976 1173.71 13632
+18.220608 1173.71 13632
+18.234240 1173.71 13632
+18.247872 1173.71 13632
+18.261504 1173.71 13632
+18.275072 1179.25 13568
+18.288640 1179.25 13568
+18.302208 1179.25 13568
+18.315776 1179.25 13568
+18.329344 1179.25 13568
+18.342912 1179.25 13568
+18.356480 1179.25 13568
+18.370048 1179.25 13568
+18.383552 1184.83 13504
+18.397056 1184.83 13504
+18.410560 1184.83 13504
+18.424064 1184.83 13504
+18.437504 1190.48 13440
+18.450944 1190.48 13440
+18.464384 1190.48 13440
+18.477824 1190.48 13440
+18.491264 1190.48 13440
+18.504704 1190.48 13440
+18.518144 1190.48 13440
+18.531584 1190.48 13440
+18.544960 1196.17 13376
+18.558336 1196.17 13376
+18.571712 1196.17 13376
+18.585088 1196.17 13376
+18.598464 1196.17 13376
+18.611840 1196.17 13376
+18.625216 1196.17 13376
+18.638592 1196.17 13376
+18.651904 1201.92 13312
+18.665216 1201.92 13312
+18.678528 1201.92 13312
+18.691840 1201.92 13312
+18.705152 1201.92 13312
+18.718464 1201.92 13312
+18.731776 1201.92 13312
+18.745088 1201.92 13312
+18.758272 1213.59 13184
+18.771456 1213.59 13184
+18.784640 1213.59 13184
+18.797824 1213.59 13184
+18.811008 1213.59 13184
+18.824192 1213.59 13184
+18.837376 1213.59 13184
+18.850560 1213.59 13184
+18.863680 1219.51 13120
+18.876800 1219.51 13120
+18.889920 1219.51 13120
+18.903040 1219.51 13120
+18.916160 1219.51 13120
+18.929280 1219.51 13120
+18.942400 1219.51 13120
+18.955520 1219.51 13120
+18.968576 1225.49 13056
+18.981632 1225.49 13056
+18.994688 1225.49 13056
+19.007744 1225.49 13056
+19.020800 1225.49 13056
+19.033856 1225.49 13056
+19.046912 1225.49 13056
+19.059968 1225.49 13056
+19.072960 1231.53 12992
+19.085952 1231.53 12992
+19.098944 1231.53 12992
+19.111936 1231.53 12992
+19.124928 1231.53 12992
+19.137920 1231.53 12992
+19.150912 1231.53 12992
+19.163904 1231.53 12992
+19.176832 1237.62 12928
+19.189760 1237.62 12928
+19.202688 1237.62 12928
+19.215616 1237.62 12928
+19.228544 1237.62 12928
+19.241472 1237.62 12928
+19.254400 1237.62 12928
+19.267328 1237.62 12928
+19.280192 1243.78 12864
+19.293056 1243.78 12864
+19.305920 1243.78 12864
+19.318784 1243.78 12864
+19.331648 1243.78 12864
+19.344512 1243.78 12864
+19.357376 1243.78 12864
+19.370240 1243.78 12864
+19.383040 1250.00 12800
+19.395840 1250.00 12800
+19.408640 1250.00 12800
+19.421440 1250.00 12800
+19.434240 1250.00 12800
+19.447040 1250.00 12800
+19.459840 1250.00 12800
+19.472640 1250.00 12800
+19.485440 1250.00 12800
+19.498240 1250.00 12800
+19.511040 1250.00 12800
+19.523840 1250.00 12800
+19.536576 1256.28 12736
+19.549312 1256.28 12736
+19.562048 1256.28 12736
+19.574784 1256.28 12736
+19.587520 1256.28 12736
+19.600256 1256.28 12736
+19.612992 1256.28 12736
+19.625728 1256.28 12736
+19.638400 1262.63 12672
+19.651072 1262.63 12672
+19.663744 1262.63 12672
+19.676416 1262.63 12672
+19.689088 1262.63 12672
+19.701760 1262.63 12672
+19.714432 1262.63 12672
+19.727104 1262.63 12672
+19.739712 1269.04 12608
+19.752320 1269.04 12608
+19.764928 1269.04 12608
+19.777536 1269.04 12608
+19.790144 1269.04 12608
+19.802752 1269.04 12608
+19.815360 1269.04 12608
+19.827968 1269.04 12608
+19.840512 1275.51 12544
+19.853056 1275.51 12544
+19.865600 1275.51 12544
+19.878144 1275.51 12544
+19.890688 1275.51 12544
+19.903232 1275.51 12544
+19.915776 1275.51 12544
+19.928320 1275.51 12544
+19.940736 1288.66 12416
+19.953152 1288.66 12416
+19.965568 1288.66 12416
+19.977984 1288.66 12416
+19.990400 1288.66 12416
+20.002816 1288.66 12416
+20.015232 1288.66 12416
+20.027648 1288.66 12416
+20.040000 1295.34 12352
+20.052352 1295.34 12352
+20.064704 1295.34 12352
+20.077056 1295.34 12352
+20.089408 1295.34 12352
+20.101760 1295.34 12352
+20.114112 1295.34 12352
+20.126464 1295.34 12352
+20.138816 1295.34 12352
+20.151168 1295.34 12352
+20.163520 1295.34 12352
+20.175872 1295.34 12352
+20.188160 1302.08 12288
+20.200448 1302.08 12288
+20.212736 1302.08 12288
+20.225024 1302.08 12288
+20.237312 1302.08 12288
+20.249600 1302.08 12288
+20.261888 1302.08 12288
+20.274176 1302.08 12288
+20.286400 1308.90 12224
+20.298624 1308.90 12224
+20.310848 1308.90 12224
+20.323072 1308.90 12224
+20.335296 1308.90 12224
+20.347520 1308.90 12224
+20.359744 1308.90 12224
+20.371968 1308.90 12224
+20.384128 1315.79 12160
+20.396288 1315.79 12160
+20.408448 1315.79 12160
+20.420608 1315.79 12160
+20.432768 1315.79 12160
+20.444928 1315.79 12160
+20.457088 1315.79 12160
+20.469248 1315.79 12160
+20.481408 1315.79 12160
+20.493568 1315.79 12160
+20.505728 1315.79 12160
+20.517888 1315.79 12160
+20.529984 1322.75 12096
+20.542080 1322.75 12096
+20.554176 1322.75 12096
+20.566272 1322.75 12096
+20.578368 1322.75 12096
+20.590464 1322.75 12096
+20.602560 1322.75 12096
+20.614656 1322.75 12096
+20.626688 1329.79 12032
+20.638720 1329.79 12032
+20.650752 1329.79 12032
+20.662784 1329.79 12032
+20.674816 1329.79 12032
+20.686848 1329.79 12032
+20.698880 1329.79 12032
+20.710912 1329.79 12032
+20.722880 1336.90 11968
+20.734848 1336.90 11968
+20.746816 1336.90 11968
+20.758784 1336.90 11968
+20.770752 1336.90 11968
+20.782720 1336.90 11968
+20.794688 1336.90 11968
+20.806656 1336.90 11968
+20.818624 1336.90 11968
+20.830592 1336.90 11968
+20.842560 1336.90 11968
+20.854528 1336.90 11968
+20.866432 1344.09 11904
+20.878336 1344.09 11904
+20.890240 1344.09 11904
+20.902144 1344.09 11904
+20.914048 1344.09 11904
+20.925952 1344.09 11904
+20.937856 1344.09 11904
+20.949760 1344.09 11904
+20.961600 1351.35 11840
+20.973440 1351.35 11840
+20.985280 1351.35 11840
+20.997120 1351.35 11840
+21.008960 1351.35 11840
+21.020800 1351.35 11840
+21.032640 1351.35 11840
+21.044480 1351.35 11840
+21.056320 1351.35 11840
+21.068160 1351.35 11840
+21.080000 1351.35 11840
+21.091840 1351.35 11840
+21.103616 1358.70 11776
+21.115392 1358.70 11776
+21.127168 1358.70 11776
+21.138944 1358.70 11776
+21.150720 1358.70 11776
+21.162496 1358.70 11776
+21.174272 1358.70 11776
+21.186048 1358.70 11776
+21.197760 1366.12 11712
+21.209472 1366.12 11712
+21.221184 1366.12 11712
+21.232896 1366.12 11712
+21.244608 1366.12 11712
+21.256320 1366.12 11712
+21.268032 1366.12 11712
+21.279744 1366.12 11712
+21.291456 1366.12 11712
+21.303168 1366.12 11712
+21.314880 1366.12 11712
+21.326592 1366.12 11712
+21.338240 1373.63 11648
+21.349888 1373.63 11648
+21.361536 1373.63 11648
+21.373184 1373.63 11648
+21.384832 1373.63 11648
+21.396480 1373.63 11648
+21.408128 1373.63 11648
+21.419776 1373.63 11648
+21.431360 1381.22 11584
+21.442944 1381.22 11584
+21.454528 1381.22 11584
+21.466112 1381.22 11584
+21.477696 1381.22 11584
+21.489280 1381.22 11584
+21.500864 1381.22 11584
+21.512448 1381.22 11584
+21.524032 1381.22 11584
+21.535616 1381.22 11584
+21.547200 1381.22 11584
+21.558784 1381.22 11584
+21.570304 1388.89 11520
+21.581824 1388.89 11520
+21.593344 1388.89 11520
+21.604864 1388.89 11520
+21.616384 1388.89 11520
+21.627904 1388.89 11520
+21.639424 1388.89 11520
+21.650944 1388.89 11520
+21.662400 1396.65 11456
+21.673856 1396.65 11456
+21.685312 1396.65 11456
+21.696768 1396.65 11456
+21.708224 1396.65 11456
+21.719680 1396.65 11456
+21.731136 1396.65 11456
+21.742592 1396.65 11456
+21.754048 1396.65 11456
+21.765504 1396.65 11456
+21.776960 1396.65 11456
+21.788416 1396.65 11456
+21.799808 1404.49 11392
+21.811200 1404.49 11392
+21.822592 1404.49 11392
+21.833984 1404.49 11392
+21.845376 1404.49 11392
+21.856768 1404.49 11392
+21.868160 1404.49 11392
+21.879552 1404.49 11392
+21.890944 1404.49 11392
+21.902336 1404.49 11392
+21.913728 1404.49 11392
+21.925120 1404.49 11392
+21.936448 1412.43 11328
+21.947776 1412.43 11328
+21.959104 1412.43 11328
+21.970432 1412.43 11328
+21.981760 1412.43 11328
+21.993088 1412.43 11328
+22.004416 1412.43 11328
+22.015744 1412.43 11328
+22.027008 1420.45 11264
+22.038272 1420.45 11264
+22.049536 1420.45 11264
+22.060800 1420.45 11264
+22.072064 1420.45 11264
+22.083328 1420.45 11264
+22.094592 1420.45 11264
+22.105856 1420.45 11264
+22.117120 1420.45 11264
+22.128384 1420.45 11264
+22.139648 1420.45 11264
+22.150912 1420.45 11264
+22.162112 1428.57 11200
+22.173312 1428.57 11200
+22.184512 1428.57 11200
+22.195712 1428.57 11200
+22.206912 1428.57 11200
+22.218112 1428.57 11200
+22.229312 1428.57 11200
+22.240512 1428.57 11200
+22.251712 1428.57 11200
+22.262912 1428.57 11200
+22.274112 1428.57 11200
+22.285312 1428.57 11200
+22.296448 1436.78 11136
+22.307584 1436.78 11136
+22.318720 1436.78 11136
+22.329856 1436.78 11136
+22.340992 1436.78 11136
+22.352128 1436.78 11136
+22.363264 1436.78 11136
+22.374400 1436.78 11136
+22.385536 1436.78 11136
+22.396672 1436.78 11136
+22.407808 1436.78 11136
+22.418944 1436.78 11136
+22.430080 1436.78 11136
+22.441216 1436.78 11136
+22.452352 1436.78 11136
+22.463488 1436.78 11136
+22.474624 1436.78 11136
+22.485760 1436.78 11136
+22.496896 1436.78 11136
+22.508032 1436.78 11136
+22.519104 1445.09 11072
+22.530176 1445.09 11072
+22.541248 1445.09 11072
+22.552320 1445.09 11072
+22.563392 1445.09 11072
+22.574464 1445.09 11072
+22.585536 1445.09 11072
+22.596608 1445.09 11072
+22.607680 1445.09 11072
+22.618752 1445.09 11072
+22.629824 1445.09 11072
+22.640896 1445.09 11072
+22.651968 1445.09 11072
+22.663040 1445.09 11072
+22.674112 1445.09 11072
+22.685184 1445.09 11072
+22.696192 1453.49 11008
+22.707200 1453.49 11008
+22.718208 1453.49 11008
+22.729216 1453.49 11008
+22.740224 1453.49 11008
+22.751232 1453.49 11008
+22.762240 1453.49 11008
+22.773248 1453.49 11008
+22.784192 1461.99 10944
+22.795136 1461.99 10944
+22.806080 1461.99 10944
+22.817024 1461.99 10944
+22.827968 1461.99 10944
+22.838912 1461.99 10944
+22.849856 1461.99 10944
+22.860800 1461.99 10944
+22.871744 1461.99 10944
+22.882688 1461.99 10944
+22.893632 1461.99 10944
+22.904576 1461.99 10944
+22.915520 1461.99 10944
+22.926464 1461.99 10944
+22.937408 1461.99 10944
+22.948352 1461.99 10944
+22.959232 1470.59 10880
+22.970112 1470.59 10880
+22.980992 1470.59 10880
+22.991872 1470.59 10880
+23.002752 1470.59 10880
+23.013632 1470.59 10880
+23.024512 1470.59 10880
+23.035392 1470.59 10880
+23.046208 1479.29 10816
+23.057024 1479.29 10816
+23.067840 1479.29 10816
+23.078656 1479.29 10816
+23.089472 1479.29 10816
+23.100288 1479.29 10816
+23.111104 1479.29 10816
+23.121920 1479.29 10816
+23.132736 1479.29 10816
+23.143552 1479.29 10816
+23.154368 1479.29 10816
+23.165184 1479.29 10816
+23.176000 1479.29 10816
+23.186816 1479.29 10816
+23.197632 1479.29 10816
+23.208448 1479.29 10816
+23.219200 1488.10 10752
+23.229952 1488.10 10752
+23.240704 1488.10 10752
+23.251456 1488.10 10752
+23.262208 1488.10 10752
+23.272960 1488.10 10752
+23.283712 1488.10 10752
+23.294464 1488.10 10752
+23.305152 1497.01 10688
+23.315840 1497.01 10688
+23.326528 1497.01 10688
+23.337216 1497.01 10688
+23.347904 1497.01 10688
+23.358592 1497.01 10688
+23.369280 1497.01 10688
+23.379968 1497.01 10688
+23.390656 1497.01 10688
+23.401344 1497.01 10688
+23.412032 1497.01 10688
+23.422720 1497.01 10688
+23.433408 1497.01 10688
+23.444096 1497.01 10688
+23.454784 1497.01 10688
+23.465472 1497.01 10688
+23.476096 1506.02 10624
+23.486720 1506.02 10624
+23.497344 1506.02 10624
+23.507968 1506.02 10624
+23.518592 1506.02 10624
+23.529216 1506.02 10624
+23.539840 1506.02 10624
+23.550464 1506.02 10624
+23.561024 1515.15 10560
+23.571584 1515.15 10560
+23.582144 1515.15 10560
+23.592704 1515.15 10560
+23.603264 1515.15 10560
+23.613824 1515.15 10560
+23.624384 1515.15 10560
+23.634944 1515.15 10560
+23.645504 1515.15 10560
+23.656064 1515.15 10560
+23.666624 1515.15 10560
+23.677184 1515.15 10560
+23.687744 1515.15 10560
+23.698304 1515.15 10560
+23.708864 1515.15 10560
+23.719424 1515.15 10560
+23.729920 1524.39 10496
+23.740416 1524.39 10496
+23.750912 1524.39 10496
+23.761408 1524.39 10496
+23.771904 1524.39 10496
+23.782400 1524.39 10496
+23.792896 1524.39 10496
+23.803392 1524.39 10496
+23.813824 1533.74 10432
+23.824256 1533.74 10432
+23.834688 1533.74 10432
+23.845120 1533.74 10432
+23.855552 1533.74 10432
+23.865984 1533.74 10432
+23.876416 1533.74 10432
+23.886848 1533.74 10432
+23.897280 1533.74 10432
+23.907712 1533.74 10432
+23.918144 1533.74 10432
+23.928576 1533.74 10432
+23.939008 1533.74 10432
+23.949440 1533.74 10432
+23.959872 1533.74 10432
+23.970304 1533.74 10432
+23.980736 1533.74 10432
+23.991168 1533.74 10432
+24.001600 1533.74 10432
+24.012032 1533.74 10432
+24.022464 1533.74 10432
+24.032896 1533.74 10432
+24.043328 1533.74 10432
+24.053760 1533.74 10432
+24.064128 1543.21 10368
+24.074496 1543.21 10368
+24.084864 1543.21 10368
+24.095232 1543.21 10368
+24.105600 1543.21 10368
+24.115968 1543.21 10368
+24.126336 1543.21 10368
+24.136704 1543.21 10368
+24.147072 1543.21 10368
+24.157440 1543.21 10368
+24.167808 1543.21 10368
+24.178176 1543.21 10368
+24.188544 1543.21 10368
+24.198912 1543.21 10368
+24.209280 1543.21 10368
+24.219648 1543.21 10368
+24.229952 1552.80 10304
+24.240256 1552.80 10304
+24.250560 1552.80 10304
+24.260864 1552.80 10304
+24.271168 1552.80 10304
+24.281472 1552.80 10304
+24.291776 1552.80 10304
+24.302080 1552.80 10304
+24.312384 1552.80 10304
+24.322688 1552.80 10304
+24.332992 1552.80 10304
+24.343296 1552.80 10304
+24.353600 1552.80 10304
+24.363904 1552.80 10304
+24.374208 1552.80 10304
+24.384512 1552.80 10304
+24.394752 1562.50 10240
+24.404992 1562.50 10240
+24.415232 1562.50 10240
+24.425472 1562.50 10240
+24.435712 1562.50 10240
+24.445952 1562.50 10240
+24.456192 1562.50 10240
+24.466432 1562.50 10240
+24.476608 1572.33 10176
+24.486784 1572.33 10176
+24.496960 1572.33 10176
+24.507136 1572.33 10176
+24.517312 1572.33 10176
+24.527488 1572.33 10176
+24.537664 1572.33 10176
+24.547840 1572.33 10176
+24.558016 1572.33 10176
+24.568192 1572.33 10176
+24.578368 1572.33 10176
+24.588544 1572.33 10176
+24.598720 1572.33 10176
+24.608896 1572.33 10176
+24.619072 1572.33 10176
+24.629248 1572.33 10176
+24.639360 1582.28 10112
+24.649472 1582.28 10112
+24.659584 1582.28 10112
+24.669696 1582.28 10112
+24.679808 1582.28 10112
+24.689920 1582.28 10112
+24.700032 1582.28 10112
+24.710144 1582.28 10112
+24.720256 1582.28 10112
+24.730368 1582.28 10112
+24.740480 1582.28 10112
+24.750592 1582.28 10112
+24.760704 1582.28 10112
+24.770816 1582.28 10112
+24.780928 1582.28 10112
+24.791040 1582.28 10112
+24.801088 1592.36 10048
+24.811136 1592.36 10048
+24.821184 1592.36 10048
+24.831232 1592.36 10048
+24.841280 1592.36 10048
+24.851328 1592.36 10048
+24.861376 1592.36 10048
+24.871424 1592.36 10048
+24.881472 1592.36 10048
+24.891520 1592.36 10048
+24.901568 1592.36 10048
+24.911616 1592.36 10048
+24.921664 1592.36 10048
+24.931712 1592.36 10048
+24.941760 1592.36 10048
+24.951808 1592.36 10048
+24.961856 1592.36 10048
+24.971904 1592.36 10048
+24.981952 1592.36 10048
+24.992000 1592.36 10048
+25.002048 1592.36 10048
+25.012096 1592.36 10048
+25.022144 1592.36 10048
+25.032192 1592.36 10048
+25.042176 1602.56 9984
+25.052160 1602.56 9984
+25.062144 1602.56 9984
+25.072128 1602.56 9984
+25.082112 1602.56 9984
+25.092096 1602.56 9984
+25.102080 1602.56 9984
+25.112064 1602.56 9984
+25.122048 1602.56 9984
+25.132032 1602.56 9984
+25.142016 1602.56 9984
+25.152000 1602.56 9984
+25.161984 1602.56 9984
+25.171968 1602.56 9984
+25.181952 1602.56 9984
+25.191936 1602.56 9984
+25.201856 1612.90 9920
+25.211776 1612.90 9920
+25.221696 1612.90 9920
+25.231616 1612.90 9920
+25.241536 1612.90 9920
+25.251456 1612.90 9920
+25.261376 1612.90 9920
+25.271296 1612.90 9920
+25.281216 1612.90 9920
+25.291136 1612.90 9920
+25.301056 1612.90 9920
+25.310976 1612.90 9920
+25.320896 1612.90 9920
+25.330816 1612.90 9920
+25.340736 1612.90 9920
+25.350656 1612.90 9920
+25.360512 1623.38 9856
+25.370368 1623.38 9856
+25.380224 1623.38 9856
+25.390080 1623.38 9856
+25.399936 1623.38 9856
+25.409792 1623.38 9856
+25.419648 1623.38 9856
+25.429504 1623.38 9856
+25.439296 1633.99 9792
+25.449088 1633.99 9792
+25.458880 1633.99 9792
+25.468672 1633.99 9792
+25.478464 1633.99 9792
+25.488256 1633.99 9792
+25.498048 1633.99 9792
+25.507840 1633.99 9792
+25.517632 1633.99 9792
+25.527424 1633.99 9792
+25.537216 1633.99 9792
+25.547008 1633.99 9792
+25.556800 1633.99 9792
+25.566592 1633.99 9792
+25.576384 1633.99 9792
+25.586176 1633.99 9792
+25.595904 1644.74 9728
+25.605632 1644.74 9728
+25.615360 1644.74 9728
+25.625088 1644.74 9728
+25.634816 1644.74 9728
+25.644544 1644.74 9728
+25.654272 1644.74 9728
+25.664000 1644.74 9728
+25.673728 1644.74 9728
+25.683456 1644.74 9728
+25.693184 1644.74 9728
+25.702912 1644.74 9728
+25.712640 1644.74 9728
+25.722368 1644.74 9728
+25.732096 1644.74 9728
+25.741824 1644.74 9728
+25.751552 1644.74 9728
+25.761280 1644.74 9728
+25.771008 1644.74 9728
+25.780736 1644.74 9728
+25.790464 1644.74 9728
+25.800192 1644.74 9728
+25.809920 1644.74 9728
+25.819648 1644.74 9728
+25.829376 1644.74 9728
+25.839104 1644.74 9728
+25.848832 1644.74 9728
+25.858560 1644.74 9728
+25.868288 1644.74 9728
+25.878016 1644.74 9728
+25.887744 1644.74 9728
+25.897472 1644.74 9728
+25.907136 1655.63 9664
+25.916800 1655.63 9664
+25.926464 1655.63 9664
+25.936128 1655.63 9664
+25.945792 1655.63 9664
+25.955456 1655.63 9664
+25.965120 1655.63 9664
+25.974784 1655.63 9664
+25.984448 1655.63 9664
+25.994112 1655.63 9664
+26.003776 1655.63 9664
+26.013440 1655.63 9664
+26.023104 1655.63 9664
+26.032768 1655.63 9664
+26.042432 1655.63 9664
+26.052096 1655.63 9664
+26.061696 1666.67 9600
+26.071296 1666.67 9600
+26.080896 1666.67 9600
+26.090496 1666.67 9600
+26.100096 1666.67 9600
+26.109696 1666.67 9600
+26.119296 1666.67 9600
+26.128896 1666.67 9600
+26.138496 1666.67 9600
+26.148096 1666.67 9600
+26.157696 1666.67 9600
+26.167296 1666.67 9600
+26.176896 1666.67 9600
+26.186496 1666.67 9600
+26.196096 1666.67 9600
+26.205696 1666.67 9600
+26.215232 1677.85 9536
+26.224768 1677.85 9536
+26.234304 1677.85 9536
+26.243840 1677.85 9536
+26.253376 1677.85 9536
+26.262912 1677.85 9536
+26.272448 1677.85 9536
+26.281984 1677.85 9536
+26.291456 1689.19 9472
+26.300928 1689.19 9472
+26.310400 1689.19 9472
+26.319872 1689.19 9472
+26.329344 1689.19 9472
+26.338816 1689.19 9472
+26.348288 1689.19 9472
+26.357760 1689.19 9472
+26.367232 1689.19 9472
+26.376704 1689.19 9472
+26.386176 1689.19 9472
+26.395648 1689.19 9472
+26.405120 1689.19 9472
+26.414592 1689.19 9472
+26.424064 1689.19 9472
+26.433536 1689.19 9472
+26.442944 1700.68 9408
+26.452352 1700.68 9408
+26.461760 1700.68 9408
+26.471168 1700.68 9408
+26.480576 1700.68 9408
+26.489984 1700.68 9408
+26.499392 1700.68 9408
+26.508800 1700.68 9408
+26.518208 1700.68 9408
+26.527616 1700.68 9408
+26.537024 1700.68 9408
+26.546432 1700.68 9408
+26.555840 1700.68 9408
+26.565248 1700.68 9408
+26.574656 1700.68 9408
+26.584064 1700.68 9408
+26.593472 1700.68 9408
+26.602880 1700.68 9408
+26.612288 1700.68 9408
+26.621696 1700.68 9408
+26.631104 1700.68 9408
+26.640512 1700.68 9408
+26.649920 1700.68 9408
+26.659328 1700.68 9408
+26.668736 1700.68 9408
+26.678144 1700.68 9408
+26.687552 1700.68 9408
+26.696960 1700.68 9408
+26.706368 1700.68 9408
+26.715776 1700.68 9408
+26.725184 1700.68 9408
+26.734592 1700.68 9408
+26.743936 1712.33 9344
+26.753280 1712.33 9344
+26.762624 1712.33 9344
+26.771968 1712.33 9344
+26.781312 1712.33 9344
+26.790656 1712.33 9344
+26.800000 1712.33 9344
+26.809344 1712.33 9344
+26.818688 1712.33 9344
+26.828032 1712.33 9344
+26.837376 1712.33 9344
+26.846720 1712.33 9344
+26.856064 1712.33 9344
+26.865408 1712.33 9344
+26.874752 1712.33 9344
+26.884096 1712.33 9344
+26.893376 1724.14 9280
+26.902656 1724.14 9280
+26.911936 1724.14 9280
+26.921216 1724.14 9280
+26.930496 1724.14 9280
+26.939776 1724.14 9280
+26.949056 1724.14 9280
+26.958336 1724.14 9280
+26.967616 1724.14 9280
+26.976896 1724.14 9280
+26.986176 1724.14 9280
+26.995456 1724.14 9280
+27.004736 1724.14 9280
+27.014016 1724.14 9280
+27.023296 1724.14 9280
+27.032576 1724.14 9280
+27.041792 1736.11 9216
+27.051008 1736.11 9216
+27.060224 1736.11 9216
+27.069440 1736.11 9216
+27.078656 1736.11 9216
+27.087872 1736.11 9216
+27.097088 1736.11 9216
+27.106304 1736.11 9216
+27.115520 1736.11 9216
+27.124736 1736.11 9216
+27.133952 1736.11 9216
+27.143168 1736.11 9216
+27.152384 1736.11 9216
+27.161600 1736.11 9216
+27.170816 1736.11 9216
+27.180032 1736.11 9216
+27.189248 1736.11 9216
+27.198464 1736.11 9216
+27.207680 1736.11 9216
+27.216896 1736.11 9216
+27.226112 1736.11 9216
+27.235328 1736.11 9216
+27.244544 1736.11 9216
+27.253760 1736.11 9216
+27.262976 1736.11 9216
+27.272192 1736.11 9216
+27.281408 1736.11 9216
+27.290624 1736.11 9216
+27.299840 1736.11 9216
+27.309056 1736.11 9216
+27.318272 1736.11 9216
+27.327488 1736.11 9216
+27.336640 1748.25 9152
+27.345792 1748.25 9152
+27.354944 1748.25 9152
+27.364096 1748.25 9152
+27.373248 1748.25 9152
+27.382400 1748.25 9152
+27.391552 1748.25 9152
+27.400704 1748.25 9152
+27.409856 1748.25 9152
+27.419008 1748.25 9152
+27.428160 1748.25 9152
+27.437312 1748.25 9152
+27.446464 1748.25 9152
+27.455616 1748.25 9152
+27.464768 1748.25 9152
+27.473920 1748.25 9152
+27.483008 1760.56 9088
+27.492096 1760.56 9088
+27.501184 1760.56 9088
+27.510272 1760.56 9088
+27.519360 1760.56 9088
+27.528448 1760.56 9088
+27.537536 1760.56 9088
+27.546624 1760.56 9088
+27.555712 1760.56 9088
+27.564800 1760.56 9088
+27.573888 1760.56 9088
+27.582976 1760.56 9088
+27.592064 1760.56 9088
+27.601152 1760.56 9088
+27.610240 1760.56 9088
+27.619328 1760.56 9088
+27.628352 1773.05 9024
+27.637376 1773.05 9024
+27.646400 1773.05 9024
+27.655424 1773.05 9024
+27.664448 1773.05 9024
+27.673472 1773.05 9024
+27.682496 1773.05 9024
+27.691520 1773.05 9024
+27.700544 1773.05 9024
+27.709568 1773.05 9024
+27.718592 1773.05 9024
+27.727616 1773.05 9024
+27.736640 1773.05 9024
+27.745664 1773.05 9024
+27.754688 1773.05 9024
+27.763712 1773.05 9024
+27.772736 1773.05 9024
+27.781760 1773.05 9024
+27.790784 1773.05 9024
+27.799808 1773.05 9024
+27.808832 1773.05 9024
+27.817856 1773.05 9024
+27.826880 1773.05 9024
+27.835904 1773.05 9024
+27.844864 1785.71 8960
+27.853824 1785.71 8960
+27.862784 1785.71 8960
+27.871744 1785.71 8960
+27.880704 1785.71 8960
+27.889664 1785.71 8960
+27.898624 1785.71 8960
+27.907584 1785.71 8960
+27.916544 1785.71 8960
+27.925504 1785.71 8960
+27.934464 1785.71 8960
+27.943424 1785.71 8960
+27.952384 1785.71 8960
+27.961344 1785.71 8960
+27.970304 1785.71 8960
+27.979264 1785.71 8960
+27.988224 1785.71 8960
+27.997184 1785.71 8960
+28.006144 1785.71 8960
+28.015104 1785.71 8960
+28.024064 1785.71 8960
+28.033024 1785.71 8960
+28.041984 1785.71 8960
+28.050944 1785.71 8960
+28.059904 1785.71 8960
+28.068864 1785.71 8960
+28.077824 1785.71 8960
+28.086784 1785.71 8960
+28.095744 1785.71 8960
+28.104704 1785.71 8960
+28.113664 1785.71 8960
+28.122624 1785.71 8960
+28.131520 1798.56 8896
+28.140416 1798.56 8896
+28.149312 1798.56 8896
+28.158208 1798.56 8896
+28.167104 1798.56 8896
+28.176000 1798.56 8896
+28.184896 1798.56 8896
+28.193792 1798.56 8896
+28.202688 1798.56 8896
+28.211584 1798.56 8896
+28.220480 1798.56 8896
+28.229376 1798.56 8896
+28.238272 1798.56 8896
+28.247168 1798.56 8896
+28.256064 1798.56 8896
+28.264960 1798.56 8896
+28.273792 1811.59 8832
+28.282624 1811.59 8832
+28.291456 1811.59 8832
+28.300288 1811.59 8832
+28.309120 1811.59 8832
+28.317952 1811.59 8832
+28.326784 1811.59 8832
+28.335616 1811.59 8832
+28.344448 1811.59 8832
+28.353280 1811.59 8832
+28.362112 1811.59 8832
+28.370944 1811.59 8832
+28.379776 1811.59 8832
+28.388608 1811.59 8832
+28.397440 1811.59 8832
+28.406272 1811.59 8832
+28.415040 1824.82 8768
+28.423808 1824.82 8768
+28.432576 1824.82 8768
+28.441344 1824.82 8768
+28.450112 1824.82 8768
+28.458880 1824.82 8768
+28.467648 1824.82 8768
+28.476416 1824.82 8768
+28.485184 1824.82 8768
+28.493952 1824.82 8768
+28.502720 1824.82 8768
+28.511488 1824.82 8768
+28.520256 1824.82 8768
+28.529024 1824.82 8768
+28.537792 1824.82 8768
+28.546560 1824.82 8768
+28.555328 1824.82 8768
+28.564096 1824.82 8768
+28.572864 1824.82 8768
+28.581632 1824.82 8768
+28.590400 1824.82 8768
+28.599168 1824.82 8768
+28.607936 1824.82 8768
+28.616704 1824.82 8768
+28.625472 1824.82 8768
+28.634240 1824.82 8768
+28.643008 1824.82 8768
+28.651776 1824.82 8768
+28.660544 1824.82 8768
+28.669312 1824.82 8768
+28.678080 1824.82 8768
+28.686848 1824.82 8768
+28.695616 1824.82 8768
+28.704384 1824.82 8768
+28.713152 1824.82 8768
+28.721920 1824.82 8768
+28.730688 1824.82 8768
+28.739456 1824.82 8768
+28.748224 1824.82 8768
+28.756992 1824.82 8768
+28.765696 1838.24 8704
+28.774400 1838.24 8704
+28.783104 1838.24 8704
+28.791808 1838.24 8704
+28.800512 1838.24 8704
+28.809216 1838.24 8704
+28.817920 1838.24 8704
+28.826624 1838.24 8704
+28.835328 1838.24 8704
+28.844032 1838.24 8704
+28.852736 1838.24 8704
+28.861440 1838.24 8704
+28.870144 1838.24 8704
+28.878848 1838.24 8704
+28.887552 1838.24 8704
+28.896256 1838.24 8704
+28.904896 1851.85 8640
+28.913536 1851.85 8640
+28.922176 1851.85 8640
+28.930816 1851.85 8640
+28.939456 1851.85 8640
+28.948096 1851.85 8640
+28.956736 1851.85 8640
+28.965376 1851.85 8640
+28.974016 1851.85 8640
+28.982656 1851.85 8640
+28.991296 1851.85 8640
+28.999936 1851.85 8640
+29.008576 1851.85 8640
+29.017216 1851.85 8640
+29.025856 1851.85 8640
+29.034496 1851.85 8640
+29.043136 1851.85 8640
+29.051776 1851.85 8640
+29.060416 1851.85 8640
+29.069056 1851.85 8640
+29.077696 1851.85 8640
+29.086336 1851.85 8640
+29.094976 1851.85 8640
+29.103616 1851.85 8640
+29.112256 1851.85 8640
+29.120896 1851.85 8640
+29.129536 1851.85 8640
+29.138176 1851.85 8640
+29.146816 1851.85 8640
+29.155456 1851.85 8640
+29.164096 1851.85 8640
+29.172736 1851.85 8640
+29.181376 1851.85 8640
+29.190016 1851.85 8640
+29.198656 1851.85 8640
+29.207296 1851.85 8640
+29.215936 1851.85 8640
+29.224576 1851.85 8640
+29.233216 1851.85 8640
+29.241856 1851.85 8640
+29.250432 1865.67 8576
+29.259008 1865.67 8576
+29.267584 1865.67 8576
+29.276160 1865.67 8576
+29.284736 1865.67 8576
+29.293312 1865.67 8576
+29.301888 1865.67 8576
+29.310464 1865.67 8576
+29.319040 1865.67 8576
+29.327616 1865.67 8576
+29.336192 1865.67 8576
+29.344768 1865.67 8576
+29.353344 1865.67 8576
+29.361920 1865.67 8576
+29.370496 1865.67 8576
+29.379072 1865.67 8576
+29.387584 1879.70 8512
+29.396096 1879.70 8512
+29.404608 1879.70 8512
+29.413120 1879.70 8512
+29.421632 1879.70 8512
+29.430144 1879.70 8512
+29.438656 1879.70 8512
+29.447168 1879.70 8512
+29.455680 1879.70 8512
+29.464192 1879.70 8512
+29.472704 1879.70 8512
+29.481216 1879.70 8512
+29.489728 1879.70 8512
+29.498240 1879.70 8512
+29.506752 1879.70 8512
+29.515264 1879.70 8512
+29.523712 1893.94 8448
+29.532160 1893.94 8448
+29.540608 1893.94 8448
+29.549056 1893.94 8448
+29.557504 1893.94 8448
+29.565952 1893.94 8448
+29.574400 1893.94 8448
+29.582848 1893.94 8448
+29.591296 1893.94 8448
+29.599744 1893.94 8448
+29.608192 1893.94 8448
+29.616640 1893.94 8448
+29.625088 1893.94 8448
+29.633536 1893.94 8448
+29.641984 1893.94 8448
+29.650432 1893.94 8448
+29.658880 1893.94 8448
+29.667328 1893.94 8448
+29.675776 1893.94 8448
+29.684224 1893.94 8448
+29.692672 1893.94 8448
+29.701120 1893.94 8448
+29.709568 1893.94 8448
+29.718016 1893.94 8448
+29.726464 1893.94 8448
+29.734912 1893.94 8448
+29.743360 1893.94 8448
+29.751808 1893.94 8448
+29.760256 1893.94 8448
+29.768704 1893.94 8448
+29.777152 1893.94 8448
+29.785600 1893.94 8448
+29.794048 1893.94 8448
+29.802496 1893.94 8448
+29.810944 1893.94 8448
+29.819392 1893.94 8448
+29.827840 1893.94 8448
+29.836288 1893.94 8448
+29.844736 1893.94 8448
+29.853184 1893.94 8448
+29.861568 1908.40 8384
+29.869952 1908.40 8384
+29.878336 1908.40 8384
+29.886720 1908.40 8384
+29.895104 1908.40 8384
+29.903488 1908.40 8384
+29.911872 1908.40 8384
+29.920256 1908.40 8384
+29.928640 1908.40 8384
+29.937024 1908.40 8384
+29.945408 1908.40 8384
+29.953792 1908.40 8384
+29.962176 1908.40 8384
+29.970560 1908.40 8384
+29.978944 1908.40 8384
+29.987328 1908.40 8384
+29.995712 1908.40 8384
+30.004096 1908.40 8384
+30.012480 1908.40 8384
+30.020864 1908.40 8384
+30.029248 1908.40 8384
+30.037632 1908.40 8384
+30.046016 1908.40 8384
+30.054400 1908.40 8384
+30.062720 1923.08 8320
+30.071040 1923.08 8320
+30.079360 1923.08 8320
+30.087680 1923.08 8320
+30.096000 1923.08 8320
+30.104320 1923.08 8320
+30.112640 1923.08 8320
+30.120960 1923.08 8320
+30.129280 1923.08 8320
+30.137600 1923.08 8320
+30.145920 1923.08 8320
+30.154240 1923.08 8320
+30.162560 1923.08 8320
+30.170880 1923.08 8320
+30.179200 1923.08 8320
+30.187520 1923.08 8320
+30.195776 1937.98 8256
+30.204032 1937.98 8256
+30.212288 1937.98 8256
+30.220544 1937.98 8256
+30.228800 1937.98 8256
+30.237056 1937.98 8256
+30.245312 1937.98 8256
+30.253568 1937.98 8256
+30.261824 1937.98 8256
+30.270080 1937.98 8256
+30.278336 1937.98 8256
+30.286592 1937.98 8256
+30.294848 1937.98 8256
+30.303104 1937.98 8256
+30.311360 1937.98 8256
+30.319616 1937.98 8256
+30.327872 1937.98 8256
+30.336128 1937.98 8256
+30.344384 1937.98 8256
+30.352640 1937.98 8256
+30.360896 1937.98 8256
+30.369152 1937.98 8256
+30.377408 1937.98 8256
+30.385664 1937.98 8256
+30.393920 1937.98 8256
+30.402176 1937.98 8256
+30.410432 1937.98 8256
+30.418688 1937.98 8256
+30.426944 1937.98 8256
+30.435200 1937.98 8256
+30.443456 1937.98 8256
+30.451712 1937.98 8256
+30.459968 1937.98 8256
+30.468224 1937.98 8256
+30.476480 1937.98 8256
+30.484736 1937.98 8256
+30.492992 1937.98 8256
+30.501248 1937.98 8256
+30.509504 1937.98 8256
+30.517760 1937.98 8256
+30.525952 1953.12 8192
+30.534144 1953.12 8192
+30.542336 1953.12 8192
+30.550528 1953.12 8192
+30.558720 1953.12 8192
+30.566912 1953.12 8192
+30.575104 1953.12 8192
+30.583296 1953.12 8192
+30.591488 1953.12 8192
+30.599680 1953.12 8192
+30.607872 1953.12 8192
+30.616064 1953.12 8192
+30.624256 1953.12 8192
+30.632448 1953.12 8192
+30.640640 1953.12 8192
+30.648832 1953.12 8192
+30.657024 1953.12 8192
+30.665216 1953.12 8192
+30.673408 1953.12 8192
+30.681600 1953.12 8192
+30.689792 1953.12 8192
+30.697984 1953.12 8192
+30.706176 1953.12 8192
+30.714368 1953.12 8192
+30.722528 1960.78 8160
+30.730688 1960.78 8160
+30.738848 1960.78 8160
+30.747008 1960.78 8160
+30.755168 1960.78 8160
+30.763328 1960.78 8160
+30.771488 1960.78 8160
+30.779648 1960.78 8160
+30.787808 1960.78 8160
+30.795968 1960.78 8160
+30.804128 1960.78 8160
+30.812288 1960.78 8160
+30.820448 1960.78 8160
+30.828608 1960.78 8160
+30.836768 1960.78 8160
+30.844928 1960.78 8160
+30.853056 1968.50 8128
+30.861184 1968.50 8128
+30.869312 1968.50 8128
+30.877440 1968.50 8128
+30.885568 1968.50 8128
+30.893696 1968.50 8128
+30.901824 1968.50 8128
+30.909952 1968.50 8128
+30.918080 1968.50 8128
+30.926208 1968.50 8128
+30.934336 1968.50 8128
+30.942464 1968.50 8128
+30.950592 1968.50 8128
+30.958720 1968.50 8128
+30.966848 1968.50 8128
+30.974976 1968.50 8128
+30.983104 1968.50 8128
+30.991232 1968.50 8128
+30.999360 1968.50 8128
+31.007488 1968.50 8128
+31.015616 1968.50 8128
+31.023744 1968.50 8128
+31.031872 1968.50 8128
+31.040000 1968.50 8128
+31.048064 1984.13 8064
+31.056128 1984.13 8064
+31.064192 1984.13 8064
+31.072256 1984.13 8064
+31.080320 1984.13 8064
+31.088384 1984.13 8064
+31.096448 1984.13 8064
+31.104512 1984.13 8064
+31.112576 1984.13 8064
+31.120640 1984.13 8064
+31.128704 1984.13 8064
+31.136768 1984.13 8064
+31.144832 1984.13 8064
+31.152896 1984.13 8064
+31.160960 1984.13 8064
+31.169024 1984.13 8064
+31.177088 1984.13 8064
+31.185152 1984.13 8064
+31.193216 1984.13 8064
+31.201280 1984.13 8064
+31.209344 1984.13 8064
+31.217408 1984.13 8064
+31.225472 1984.13 8064
+31.233536 1984.13 8064
+31.241568 1992.03 8032
+31.249600 1992.03 8032
+31.257632 1992.03 8032
+31.265664 1992.03 8032
+31.273696 1992.03 8032
+31.281728 1992.03 8032
+31.289760 1992.03 8032
+31.297792 1992.03 8032
+31.305824 1992.03 8032
+31.313856 1992.03 8032
+31.321888 1992.03 8032
+31.329920 1992.03 8032
+31.337952 1992.03 8032
+31.345984 1992.03 8032
+31.354016 1992.03 8032
+31.362048 1992.03 8032
+31.370048 2000.00 8000
+31.386048 2000.00 8000
+31.402048 2000.00 8000
+31.418048 2000.00 8000
+31.434048 2000.00 8000
+31.450048 2000.00 8000
+31.466048 2000.00 8000
+31.482048 2000.00 8000
+31.498048 2000.00 8000
+31.514048 2000.00 8000
+31.530048 2000.00 8000
+31.546048 2000.00 8000
+31.561920 2016.13 7936
+31.577792 2016.13 7936
+31.593664 2016.13 7936
+31.609536 2016.13 7936
+31.625408 2016.13 7936
+31.641280 2016.13 7936
+31.657152 2016.13 7936
+31.673024 2016.13 7936
+31.688896 2016.13 7936
+31.704768 2016.13 7936
+31.720640 2016.13 7936
+31.736512 2016.13 7936
+31.752320 2024.29 7904
+31.768128 2024.29 7904
+31.783936 2024.29 7904
+31.799744 2024.29 7904
+31.815552 2024.29 7904
+31.831360 2024.29 7904
+31.847168 2024.29 7904
+31.862976 2024.29 7904
+31.878784 2024.29 7904
+31.894592 2024.29 7904
+31.910400 2024.29 7904
+31.926208 2024.29 7904
+31.941952 2032.52 7872
+31.957696 2032.52 7872
+31.973440 2032.52 7872
+31.989184 2032.52 7872
+32.004928 2032.52 7872
+32.020672 2032.52 7872
+32.036416 2032.52 7872
+32.052160 2032.52 7872
+32.067776 2049.18 7808
+32.083392 2049.18 7808
+32.099008 2049.18 7808
+32.114624 2049.18 7808
+32.130240 2049.18 7808
+32.145856 2049.18 7808
+32.161472 2049.18 7808
+32.177088 2049.18 7808
+32.192704 2049.18 7808
+32.208320 2049.18 7808
+32.223936 2049.18 7808
+32.239552 2049.18 7808
+32.255168 2049.18 7808
+32.270784 2049.18 7808
+32.286400 2049.18 7808
+32.302016 2049.18 7808
+32.317568 2057.61 7776
+32.333120 2057.61 7776
+32.348672 2057.61 7776
+32.364224 2057.61 7776
+32.379776 2057.61 7776
+32.395328 2057.61 7776
+32.410880 2057.61 7776
+32.426432 2057.61 7776
+32.441920 2066.12 7744
+32.457408 2066.12 7744
+32.472896 2066.12 7744
+32.488384 2066.12 7744
+32.503872 2066.12 7744
+32.519360 2066.12 7744
+32.534848 2066.12 7744
+32.550336 2066.12 7744
+32.565824 2066.12 7744
+32.581312 2066.12 7744
+32.596800 2066.12 7744
+32.612288 2066.12 7744
+32.627776 2066.12 7744
+32.643264 2066.12 7744
+32.658752 2066.12 7744
+32.674240 2066.12 7744
+32.689600 2083.33 7680
+32.704960 2083.33 7680
+32.720320 2083.33 7680
+32.735680 2083.33 7680
+32.751040 2083.33 7680
+32.766400 2083.33 7680
+32.781760 2083.33 7680
+32.797120 2083.33 7680
+32.812416 2092.05 7648
+32.827712 2092.05 7648
+32.843008 2092.05 7648
+32.858304 2092.05 7648
+32.873600 2092.05 7648
+32.888896 2092.05 7648
+32.904192 2092.05 7648
+32.919488 2092.05 7648
+32.934784 2092.05 7648
+32.950080 2092.05 7648
+32.965376 2092.05 7648
+32.980672 2092.05 7648
+32.995968 2092.05 7648
+33.011264 2092.05 7648
+33.026560 2092.05 7648
+33.041856 2092.05 7648
+33.057088 2100.84 7616
+33.072320 2100.84 7616
+33.087552 2100.84 7616
+33.102784 2100.84 7616
+33.118016 2100.84 7616
+33.133248 2100.84 7616
+33.148480 2100.84 7616
+33.163712 2100.84 7616
+33.178816 2118.64 7552
+33.193920 2118.64 7552
+33.209024 2118.64 7552
+33.224128 2118.64 7552
+33.239232 2118.64 7552
+33.254336 2118.64 7552
+33.269440 2118.64 7552
+33.284544 2118.64 7552
+33.299648 2118.64 7552
+33.314752 2118.64 7552
+33.329856 2118.64 7552
+33.344960 2118.64 7552
+33.360064 2118.64 7552
+33.375168 2118.64 7552
+33.390272 2118.64 7552
+33.405376 2118.64 7552
+33.420416 2127.66 7520
+33.435456 2127.66 7520
+33.450496 2127.66 7520
+33.465536 2127.66 7520
+33.480576 2127.66 7520
+33.495616 2127.66 7520
+33.510656 2127.66 7520
+33.525696 2127.66 7520
+33.540672 2136.75 7488
+33.555648 2136.75 7488
+33.570624 2136.75 7488
+33.585600 2136.75 7488
+33.600576 2136.75 7488
+33.615552 2136.75 7488
+33.630528 2136.75 7488
+33.645504 2136.75 7488
+33.660480 2136.75 7488
+33.675456 2136.75 7488
+33.690432 2136.75 7488
+33.705408 2136.75 7488
+33.720384 2136.75 7488
+33.735360 2136.75 7488
+33.750336 2136.75 7488
+33.765312 2136.75 7488
+33.780224 2145.92 7456
+33.795136 2145.92 7456
+33.810048 2145.92 7456
+33.824960 2145.92 7456
+33.839872 2145.92 7456
+33.854784 2145.92 7456
+33.869696 2145.92 7456
+33.884608 2145.92 7456
+33.899392 2164.50 7392
+33.914176 2164.50 7392
+33.928960 2164.50 7392
+33.943744 2164.50 7392
+33.958528 2164.50 7392
+33.973312 2164.50 7392
+33.988096 2164.50 7392
+34.002880 2164.50 7392
+34.017664 2164.50 7392
+34.032448 2164.50 7392
+34.047232 2164.50 7392
+34.062016 2164.50 7392
+34.076800 2164.50 7392
+34.091584 2164.50 7392
+34.106368 2164.50 7392
+34.121152 2164.50 7392
+34.135872 2173.91 7360
+34.150592 2173.91 7360
+34.165312 2173.91 7360
+34.180032 2173.91 7360
+34.194752 2173.91 7360
+34.209472 2173.91 7360
+34.224192 2173.91 7360
+34.238912 2173.91 7360
+34.253568 2183.41 7328
+34.268224 2183.41 7328
+34.282880 2183.41 7328
+34.297536 2183.41 7328
+34.312192 2183.41 7328
+34.326848 2183.41 7328
+34.341504 2183.41 7328
+34.356160 2183.41 7328
+34.370816 2183.41 7328
+34.385472 2183.41 7328
+34.400128 2183.41 7328
+34.414784 2183.41 7328
+34.429440 2183.41 7328
+34.444096 2183.41 7328
+34.458752 2183.41 7328
+34.473408 2183.41 7328
+34.488000 2192.98 7296
+34.502592 2192.98 7296
+34.517184 2192.98 7296
+34.531776 2192.98 7296
+34.546368 2192.98 7296
+34.560960 2192.98 7296
+34.575552 2192.98 7296
+34.590144 2192.98 7296
+34.604736 2192.98 7296
+34.619328 2192.98 7296
+34.633920 2192.98 7296
+34.648512 2192.98 7296
+34.663104 2192.98 7296
+34.677696 2192.98 7296
+34.692288 2192.98 7296
+34.706880 2192.98 7296
+34.721344 2212.39 7232
+34.735808 2212.39 7232
+34.750272 2212.39 7232
+34.764736 2212.39 7232
+34.779200 2212.39 7232
+34.793664 2212.39 7232
+34.808128 2212.39 7232
+34.822592 2212.39 7232
+34.836992 2222.22 7200
+34.851392 2222.22 7200
+34.865792 2222.22 7200
+34.880192 2222.22 7200
+34.894592 2222.22 7200
+34.908992 2222.22 7200
+34.923392 2222.22 7200
+34.937792 2222.22 7200
+34.952192 2222.22 7200
+34.966592 2222.22 7200
+34.980992 2222.22 7200
+34.995392 2222.22 7200
+35.009792 2222.22 7200
+35.024192 2222.22 7200
+35.038592 2222.22 7200
+35.052992 2222.22 7200
+35.067328 2232.14 7168
+35.081664 2232.14 7168
+35.096000 2232.14 7168
+35.110336 2232.14 7168
+35.124672 2232.14 7168
+35.139008 2232.14 7168
+35.153344 2232.14 7168
+35.167680 2232.14 7168
+35.182016 2232.14 7168
+35.196352 2232.14 7168
+35.210688 2232.14 7168
+35.225024 2232.14 7168
+35.239360 2232.14 7168
+35.253696 2232.14 7168
+35.268032 2232.14 7168
+35.282368 2232.14 7168
+35.296640 2242.15 7136
+35.310912 2242.15 7136
+35.325184 2242.15 7136
+35.339456 2242.15 7136
+35.353728 2242.15 7136
+35.368000 2242.15 7136
+35.382272 2242.15 7136
+35.396544 2242.15 7136
+35.410688 2262.44 7072
+35.424832 2262.44 7072
+35.438976 2262.44 7072
+35.453120 2262.44 7072
+35.467264 2262.44 7072
+35.481408 2262.44 7072
+35.495552 2262.44 7072
+35.509696 2262.44 7072
+35.523840 2262.44 7072
+35.537984 2262.44 7072
+35.552128 2262.44 7072
+35.566272 2262.44 7072
+35.580416 2262.44 7072
+35.594560 2262.44 7072
+35.608704 2262.44 7072
+35.622848 2262.44 7072
+35.636928 2272.73 7040
+35.651008 2272.73 7040
+35.665088 2272.73 7040
+35.679168 2272.73 7040
+35.693248 2272.73 7040
+35.707328 2272.73 7040
+35.721408 2272.73 7040
+35.735488 2272.73 7040
+35.749568 2272.73 7040
+35.763648 2272.73 7040
+35.777728 2272.73 7040
+35.791808 2272.73 7040
+35.805888 2272.73 7040
+35.819968 2272.73 7040
+35.834048 2272.73 7040
+35.848128 2272.73 7040
+35.862144 2283.11 7008
+35.876160 2283.11 7008
+35.890176 2283.11 7008
+35.904192 2283.11 7008
+35.918208 2283.11 7008
+35.932224 2283.11 7008
+35.946240 2283.11 7008
+35.960256 2283.11 7008
+35.974272 2283.11 7008
+35.988288 2283.11 7008
+36.002304 2283.11 7008
+36.016320 2283.11 7008
+36.030336 2283.11 7008
+36.044352 2283.11 7008
+36.058368 2283.11 7008
+36.072384 2283.11 7008
+36.086336 2293.58 6976
+36.100288 2293.58 6976
+36.114240 2293.58 6976
+36.128192 2293.58 6976
+36.142144 2293.58 6976
+36.156096 2293.58 6976
+36.170048 2293.58 6976
+36.184000 2293.58 6976
+36.197888 2304.15 6944
+36.211776 2304.15 6944
+36.225664 2304.15 6944
+36.239552 2304.15 6944
+36.253440 2304.15 6944
+36.267328 2304.15 6944
+36.281216 2304.15 6944
+36.295104 2304.15 6944
+36.308992 2304.15 6944
+36.322880 2304.15 6944
+36.336768 2304.15 6944
+36.350656 2304.15 6944
+36.364544 2304.15 6944
+36.378432 2304.15 6944
+36.392320 2304.15 6944
+36.406208 2304.15 6944
+36.420032 2314.81 6912
+36.433856 2314.81 6912
+36.447680 2314.81 6912
+36.461504 2314.81 6912
+36.475328 2314.81 6912
+36.489152 2314.81 6912
+36.502976 2314.81 6912
+36.516800 2314.81 6912
+36.530624 2314.81 6912
+36.544448 2314.81 6912
+36.558272 2314.81 6912
+36.572096 2314.81 6912
+36.585920 2314.81 6912
+36.599744 2314.81 6912
+36.613568 2314.81 6912
+36.627392 2314.81 6912
+36.641088 2336.45 6848
+36.654784 2336.45 6848
+36.668480 2336.45 6848
+36.682176 2336.45 6848
+36.695872 2336.45 6848
+36.709568 2336.45 6848
+36.723264 2336.45 6848
+36.736960 2336.45 6848
+36.750656 2336.45 6848
+36.764352 2336.45 6848
+36.778048 2336.45 6848
+36.791744 2336.45 6848
+36.805440 2336.45 6848
+36.819136 2336.45 6848
+36.832832 2336.45 6848
+36.846528 2336.45 6848
+36.860160 2347.42 6816
+36.873792 2347.42 6816
+36.887424 2347.42 6816
+36.901056 2347.42 6816
+36.914688 2347.42 6816
+36.928320 2347.42 6816
+36.941952 2347.42 6816
+36.955584 2347.42 6816
+36.969216 2347.42 6816
+36.982848 2347.42 6816
+36.996480 2347.42 6816
+37.010112 2347.42 6816
+37.023744 2347.42 6816
+37.037376 2347.42 6816
+37.051008 2347.42 6816
+37.064640 2347.42 6816
+37.078208 2358.49 6784
+37.091776 2358.49 6784
+37.105344 2358.49 6784
+37.118912 2358.49 6784
+37.132480 2358.49 6784
+37.146048 2358.49 6784
+37.159616 2358.49 6784
+37.173184 2358.49 6784
+37.186752 2358.49 6784
+37.200320 2358.49 6784
+37.213888 2358.49 6784
+37.227456 2358.49 6784
+37.241024 2358.49 6784
+37.254592 2358.49 6784
+37.268160 2358.49 6784
+37.281728 2358.49 6784
+37.295232 2369.67 6752
+37.308736 2369.67 6752
+37.322240 2369.67 6752
+37.335744 2369.67 6752
+37.349248 2369.67 6752
+37.362752 2369.67 6752
+37.376256 2369.67 6752
+37.389760 2369.67 6752
+37.403200 2380.95 6720
+37.416640 2380.95 6720
+37.430080 2380.95 6720
+37.443520 2380.95 6720
+37.456960 2380.95 6720
+37.470400 2380.95 6720
+37.483840 2380.95 6720
+37.497280 2380.95 6720
+37.510720 2380.95 6720
+37.524160 2380.95 6720
+37.537600 2380.95 6720
+37.551040 2380.95 6720
+37.564480 2380.95 6720
+37.577920 2380.95 6720
+37.591360 2380.95 6720
+37.604800 2380.95 6720
+37.618176 2392.34 6688
+37.631552 2392.34 6688
+37.644928 2392.34 6688
+37.658304 2392.34 6688
+37.671680 2392.34 6688
+37.685056 2392.34 6688
+37.698432 2392.34 6688
+37.711808 2392.34 6688
+37.725184 2392.34 6688
+37.738560 2392.34 6688
+37.751936 2392.34 6688
+37.765312 2392.34 6688
+37.778688 2392.34 6688
+37.792064 2392.34 6688
+37.805440 2392.34 6688
+37.818816 2392.34 6688
+37.832128 2403.85 6656
+37.845440 2403.85 6656
+37.858752 2403.85 6656
+37.872064 2403.85 6656
+37.885376 2403.85 6656
+37.898688 2403.85 6656
+37.912000 2403.85 6656
+37.925312 2403.85 6656
+37.938624 2403.85 6656
+37.951936 2403.85 6656
+37.965248 2403.85 6656
+37.978560 2403.85 6656
+37.991872 2403.85 6656
+38.005184 2403.85 6656
+38.018496 2403.85 6656
+38.031808 2403.85 6656
+38.044992 2427.18 6592
+38.058176 2427.18 6592
+38.071360 2427.18 6592
+38.084544 2427.18 6592
+38.097728 2427.18 6592
+38.110912 2427.18 6592
+38.124096 2427.18 6592
+38.137280 2427.18 6592
+38.150464 2427.18 6592
+38.163648 2427.18 6592
+38.176832 2427.18 6592
+38.190016 2427.18 6592
+38.203200 2427.18 6592
+38.216384 2427.18 6592
+38.229568 2427.18 6592
+38.242752 2427.18 6592
+38.255872 2439.02 6560
+38.268992 2439.02 6560
+38.282112 2439.02 6560
+38.295232 2439.02 6560
+38.308352 2439.02 6560
+38.321472 2439.02 6560
+38.334592 2439.02 6560
+38.347712 2439.02 6560
+38.360832 2439.02 6560
+38.373952 2439.02 6560
+38.387072 2439.02 6560
+38.400192 2439.02 6560
+38.413312 2439.02 6560
+38.426432 2439.02 6560
+38.439552 2439.02 6560
+38.452672 2439.02 6560
+38.465728 2450.98 6528
+38.478784 2450.98 6528
+38.491840 2450.98 6528
+38.504896 2450.98 6528
+38.517952 2450.98 6528
+38.531008 2450.98 6528
+38.544064 2450.98 6528
+38.557120 2450.98 6528
+38.570176 2450.98 6528
+38.583232 2450.98 6528
+38.596288 2450.98 6528
+38.609344 2450.98 6528
+38.622400 2450.98 6528
+38.635456 2450.98 6528
+38.648512 2450.98 6528
+38.661568 2450.98 6528
+38.674560 2463.05 6496
+38.687552 2463.05 6496
+38.700544 2463.05 6496
+38.713536 2463.05 6496
+38.726528 2463.05 6496
+38.739520 2463.05 6496
+38.752512 2463.05 6496
+38.765504 2463.05 6496
+38.778496 2463.05 6496
+38.791488 2463.05 6496
+38.804480 2463.05 6496
+38.817472 2463.05 6496
+38.830464 2463.05 6496
+38.843456 2463.05 6496
+38.856448 2463.05 6496
+38.869440 2463.05 6496
+38.882368 2475.25 6464
+38.895296 2475.25 6464
+38.908224 2475.25 6464
+38.921152 2475.25 6464
+38.934080 2475.25 6464
+38.947008 2475.25 6464
+38.959936 2475.25 6464
+38.972864 2475.25 6464
+38.985792 2475.25 6464
+38.998720 2475.25 6464
+39.011648 2475.25 6464
+39.024576 2475.25 6464
+39.037504 2475.25 6464
+39.050432 2475.25 6464
+39.063360 2475.25 6464
+39.076288 2475.25 6464
+39.089152 2487.56 6432
+39.102016 2487.56 6432
+39.114880 2487.56 6432
+39.127744 2487.56 6432
+39.140608 2487.56 6432
+39.153472 2487.56 6432
+39.166336 2487.56 6432
+39.179200 2487.56 6432
+39.192064 2487.56 6432
+39.204928 2487.56 6432
+39.217792 2487.56 6432
+39.230656 2487.56 6432
+39.243520 2487.56 6432
+39.256384 2487.56 6432
+39.269248 2487.56 6432
+39.282112 2487.56 6432
+39.294912 2500.00 6400
+39.307712 2500.00 6400
+39.320512 2500.00 6400
+39.333312 2500.00 6400
+39.346112 2500.00 6400
+39.358912 2500.00 6400
+39.371712 2500.00 6400
+39.384512 2500.00 6400
+39.397312 2500.00 6400
+39.410112 2500.00 6400
+39.422912 2500.00 6400
+39.435712 2500.00 6400
+39.448512 2500.00 6400
+39.461312 2500.00 6400
+39.474112 2500.00 6400
+39.486912 2500.00 6400
+39.499712 2500.00 6400
+39.512512 2500.00 6400
+39.525312 2500.00 6400
+39.538112 2500.00 6400
+39.550912 2500.00 6400
+39.563712 2500.00 6400
+39.576512 2500.00 6400
+39.589312 2500.00 6400
+39.602048 2512.56 6368
+39.614784 2512.56 6368
+39.627520 2512.56 6368
+39.640256 2512.56 6368
+39.652992 2512.56 6368
+39.665728 2512.56 6368
+39.678464 2512.56 6368
+39.691200 2512.56 6368
+39.703936 2512.56 6368
+39.716672 2512.56 6368
+39.729408 2512.56 6368
+39.742144 2512.56 6368
+39.754880 2512.56 6368
+39.767616 2512.56 6368
+39.780352 2512.56 6368
+39.793088 2512.56 6368
+39.805760 2525.25 6336
+39.818432 2525.25 6336
+39.831104 2525.25 6336
+39.843776 2525.25 6336
+39.856448 2525.25 6336
+39.869120 2525.25 6336
+39.881792 2525.25 6336
+39.894464 2525.25 6336
+39.907136 2525.25 6336
+39.919808 2525.25 6336
+39.932480 2525.25 6336
+39.945152 2525.25 6336
+39.957824 2525.25 6336
+39.970496 2525.25 6336
+39.983168 2525.25 6336
+39.995840 2525.25 6336
+40.008448 2538.07 6304
+40.021056 2538.07 6304
+40.033664 2538.07 6304
+40.046272 2538.07 6304
+40.058880 2538.07 6304
+40.071488 2538.07 6304
+40.084096 2538.07 6304
+40.096704 2538.07 6304
+40.109312 2538.07 6304
+40.121920 2538.07 6304
+40.134528 2538.07 6304
+40.147136 2538.07 6304
+40.159744 2538.07 6304
+40.172352 2538.07 6304
+40.184960 2538.07 6304
+40.197568 2538.07 6304
+40.210112 2551.02 6272
+40.222656 2551.02 6272
+40.235200 2551.02 6272
+40.247744 2551.02 6272
+40.260288 2551.02 6272
+40.272832 2551.02 6272
+40.285376 2551.02 6272
+40.297920 2551.02 6272
+40.310464 2551.02 6272
+40.323008 2551.02 6272
+40.335552 2551.02 6272
+40.348096 2551.02 6272
+40.360640 2551.02 6272
+40.373184 2551.02 6272
+40.385728 2551.02 6272
+40.398272 2551.02 6272
+40.410688 2577.32 6208
+40.423104 2577.32 6208
+40.435520 2577.32 6208
+40.447936 2577.32 6208
+40.460352 2577.32 6208
+40.472768 2577.32 6208
+40.485184 2577.32 6208
+40.497600 2577.32 6208
+40.510016 2577.32 6208
+40.522432 2577.32 6208
+40.534848 2577.32 6208
+40.547264 2577.32 6208
+40.559680 2577.32 6208
+40.572096 2577.32 6208
+40.584512 2577.32 6208
+40.596928 2577.32 6208
+40.609280 2590.67 6176
+40.621632 2590.67 6176
+40.633984 2590.67 6176
+40.646336 2590.67 6176
+40.658688 2590.67 6176
+40.671040 2590.67 6176
+40.683392 2590.67 6176
+40.695744 2590.67 6176
+40.708096 2590.67 6176
+40.720448 2590.67 6176
+40.732800 2590.67 6176
+40.745152 2590.67 6176
+40.757504 2590.67 6176
+40.769856 2590.67 6176
+40.782208 2590.67 6176
+40.794560 2590.67 6176
+40.806912 2590.67 6176
+40.819264 2590.67 6176
+40.831616 2590.67 6176
+40.843968 2590.67 6176
+40.856320 2590.67 6176
+40.868672 2590.67 6176
+40.881024 2590.67 6176
+40.893376 2590.67 6176
+40.905664 2604.17 6144
+40.917952 2604.17 6144
+40.930240 2604.17 6144
+40.942528 2604.17 6144
+40.954816 2604.17 6144
+40.967104 2604.17 6144
+40.979392 2604.17 6144
+40.991680 2604.17 6144
+41.003968 2604.17 6144
+41.016256 2604.17 6144
+41.028544 2604.17 6144
+41.040832 2604.17 6144
+41.053120 2604.17 6144
+41.065408 2604.17 6144
+41.077696 2604.17 6144
+41.089984 2604.17 6144
+41.102208 2617.80 6112
+41.114432 2617.80 6112
+41.126656 2617.80 6112
+41.138880 2617.80 6112
+41.151104 2617.80 6112
+41.163328 2617.80 6112
+41.175552 2617.80 6112
+41.187776 2617.80 6112
+41.200000 2617.80 6112
+41.212224 2617.80 6112
+41.224448 2617.80 6112
+41.236672 2617.80 6112
+41.248896 2617.80 6112
+41.261120 2617.80 6112
+41.273344 2617.80 6112
+41.285568 2617.80 6112
+41.297728 2631.58 6080
+41.309888 2631.58 6080
+41.322048 2631.58 6080
+41.334208 2631.58 6080
+41.346368 2631.58 6080
+41.358528 2631.58 6080
+41.370688 2631.58 6080
+41.382848 2631.58 6080
+41.395008 2631.58 6080
+41.407168 2631.58 6080
+41.419328 2631.58 6080
+41.431488 2631.58 6080
+41.443648 2631.58 6080
+41.455808 2631.58 6080
+41.467968 2631.58 6080
+41.480128 2631.58 6080
+41.492288 2631.58 6080
+41.504448 2631.58 6080
+41.516608 2631.58 6080
+41.528768 2631.58 6080
+41.540928 2631.58 6080
+41.553088 2631.58 6080
+41.565248 2631.58 6080
+41.577408 2631.58 6080
+41.589504 2645.50 6048
+41.601600 2645.50 6048
+41.613696 2645.50 6048
+41.625792 2645.50 6048
+41.637888 2645.50 6048
+41.649984 2645.50 6048
+41.662080 2645.50 6048
+41.674176 2645.50 6048
+41.686272 2645.50 6048
+41.698368 2645.50 6048
+41.710464 2645.50 6048
+41.722560 2645.50 6048
+41.734656 2645.50 6048
+41.746752 2645.50 6048
+41.758848 2645.50 6048
+41.770944 2645.50 6048
+41.782976 2659.57 6016
+41.795008 2659.57 6016
+41.807040 2659.57 6016
+41.819072 2659.57 6016
+41.831104 2659.57 6016
+41.843136 2659.57 6016
+41.855168 2659.57 6016
+41.867200 2659.57 6016
+41.879232 2659.57 6016
+41.891264 2659.57 6016
+41.903296 2659.57 6016
+41.915328 2659.57 6016
+41.927360 2659.57 6016
+41.939392 2659.57 6016
+41.951424 2659.57 6016
+41.963456 2659.57 6016
+41.975424 2673.80 5984
+41.987392 2673.80 5984
+41.999360 2673.80 5984
+42.011328 2673.80 5984
+42.023296 2673.80 5984
+42.035264 2673.80 5984
+42.047232 2673.80 5984
+42.059200 2673.80 5984
+42.071168 2673.80 5984
+42.083136 2673.80 5984
+42.095104 2673.80 5984
+42.107072 2673.80 5984
+42.119040 2673.80 5984
+42.131008 2673.80 5984
+42.142976 2673.80 5984
+42.154944 2673.80 5984
+42.166912 2673.80 5984
+42.178880 2673.80 5984
+42.190848 2673.80 5984
+42.202816 2673.80 5984
+42.214784 2673.80 5984
+42.226752 2673.80 5984
+42.238720 2673.80 5984
+42.250688 2673.80 5984
+42.262592 2688.17 5952
+42.274496 2688.17 5952
+42.286400 2688.17 5952
+42.298304 2688.17 5952
+42.310208 2688.17 5952
+42.322112 2688.17 5952
+42.334016 2688.17 5952
+42.345920 2688.17 5952
+42.357824 2688.17 5952
+42.369728 2688.17 5952
+42.381632 2688.17 5952
+42.393536 2688.17 5952
+42.405440 2688.17 5952
+42.417344 2688.17 5952
+42.429248 2688.17 5952
+42.441152 2688.17 5952
+42.452992 2702.70 5920
+42.464832 2702.70 5920
+42.476672 2702.70 5920
+42.488512 2702.70 5920
+42.500352 2702.70 5920
+42.512192 2702.70 5920
+42.524032 2702.70 5920
+42.535872 2702.70 5920
+42.547712 2702.70 5920
+42.559552 2702.70 5920
+42.571392 2702.70 5920
+42.583232 2702.70 5920
+42.595072 2702.70 5920
+42.606912 2702.70 5920
+42.618752 2702.70 5920
+42.630592 2702.70 5920
+42.642432 2702.70 5920
+42.654272 2702.70 5920
+42.666112 2702.70 5920
+42.677952 2702.70 5920
+42.689792 2702.70 5920
+42.701632 2702.70 5920
+42.713472 2702.70 5920
+42.725312 2702.70 5920
+42.737088 2717.39 5888
+42.748864 2717.39 5888
+42.760640 2717.39 5888
+42.772416 2717.39 5888
+42.784192 2717.39 5888
+42.795968 2717.39 5888
+42.807744 2717.39 5888
+42.819520 2717.39 5888
+42.831296 2717.39 5888
+42.843072 2717.39 5888
+42.854848 2717.39 5888
+42.866624 2717.39 5888
+42.878400 2717.39 5888
+42.890176 2717.39 5888
+42.901952 2717.39 5888
+42.913728 2717.39 5888
+42.925440 2732.24 5856
+42.937152 2732.24 5856
+42.948864 2732.24 5856
+42.960576 2732.24 5856
+42.972288 2732.24 5856
+42.984000 2732.24 5856
+42.995712 2732.24 5856
+43.007424 2732.24 5856
+43.019136 2732.24 5856
+43.030848 2732.24 5856
+43.042560 2732.24 5856
+43.054272 2732.24 5856
+43.065984 2732.24 5856
+43.077696 2732.24 5856
+43.089408 2732.24 5856
+43.101120 2732.24 5856
+43.112832 2732.24 5856
+43.124544 2732.24 5856
+43.136256 2732.24 5856
+43.147968 2732.24 5856
+43.159680 2732.24 5856
+43.171392 2732.24 5856
+43.183104 2732.24 5856
+43.194816 2732.24 5856
+43.206464 2747.25 5824
+43.218112 2747.25 5824
+43.229760 2747.25 5824
+43.241408 2747.25 5824
+43.253056 2747.25 5824
+43.264704 2747.25 5824
+43.276352 2747.25 5824
+43.288000 2747.25 5824
+43.299648 2747.25 5824
+43.311296 2747.25 5824
+43.322944 2747.25 5824
+43.334592 2747.25 5824
+43.346240 2747.25 5824
+43.357888 2747.25 5824
+43.369536 2747.25 5824
+43.381184 2747.25 5824
+43.392768 2762.43 5792
+43.404352 2762.43 5792
+43.415936 2762.43 5792
+43.427520 2762.43 5792
+43.439104 2762.43 5792
+43.450688 2762.43 5792
+43.462272 2762.43 5792
+43.473856 2762.43 5792
+43.485440 2762.43 5792
+43.497024 2762.43 5792
+43.508608 2762.43 5792
+43.520192 2762.43 5792
+43.531776 2762.43 5792
+43.543360 2762.43 5792
+43.554944 2762.43 5792
+43.566528 2762.43 5792
+43.578112 2762.43 5792
+43.589696 2762.43 5792
+43.601280 2762.43 5792
+43.612864 2762.43 5792
+43.624448 2762.43 5792
+43.636032 2762.43 5792
+43.647616 2762.43 5792
+43.659200 2762.43 5792
+43.670720 2777.78 5760
+43.682240 2777.78 5760
+43.693760 2777.78 5760
+43.705280 2777.78 5760
+43.716800 2777.78 5760
+43.728320 2777.78 5760
+43.739840 2777.78 5760
+43.751360 2777.78 5760
+43.762880 2777.78 5760
+43.774400 2777.78 5760
+43.785920 2777.78 5760
+43.797440 2777.78 5760
+43.808960 2777.78 5760
+43.820480 2777.78 5760
+43.832000 2777.78 5760
+43.843520 2777.78 5760
+43.854976 2793.30 5728
+43.866432 2793.30 5728
+43.877888 2793.30 5728
+43.889344 2793.30 5728
+43.900800 2793.30 5728
+43.912256 2793.30 5728
+43.923712 2793.30 5728
+43.935168 2793.30 5728
+43.946624 2793.30 5728
+43.958080 2793.30 5728
+43.969536 2793.30 5728
+43.980992 2793.30 5728
+43.992448 2793.30 5728
+44.003904 2793.30 5728
+44.015360 2793.30 5728
+44.026816 2793.30 5728
+44.038272 2793.30 5728
+44.049728 2793.30 5728
+44.061184 2793.30 5728
+44.072640 2793.30 5728
+44.084096 2793.30 5728
+44.095552 2793.30 5728
+44.107008 2793.30 5728
+44.118464 2793.30 5728
+44.129856 2808.99 5696
+44.141248 2808.99 5696
+44.152640 2808.99 5696
+44.164032 2808.99 5696
+44.175424 2808.99 5696
+44.186816 2808.99 5696
+44.198208 2808.99 5696
+44.209600 2808.99 5696
+44.220992 2808.99 5696
+44.232384 2808.99 5696
+44.243776 2808.99 5696
+44.255168 2808.99 5696
+44.266560 2808.99 5696
+44.277952 2808.99 5696
+44.289344 2808.99 5696
+44.300736 2808.99 5696
+44.312128 2808.99 5696
+44.323520 2808.99 5696
+44.334912 2808.99 5696
+44.346304 2808.99 5696
+44.357696 2808.99 5696
+44.369088 2808.99 5696
+44.380480 2808.99 5696
+44.391872 2808.99 5696
+44.403200 2824.86 5664
+44.414528 2824.86 5664
+44.425856 2824.86 5664
+44.437184 2824.86 5664
+44.448512 2824.86 5664
+44.459840 2824.86 5664
+44.471168 2824.86 5664
+44.482496 2824.86 5664
+44.493824 2824.86 5664
+44.505152 2824.86 5664
+44.516480 2824.86 5664
+44.527808 2824.86 5664
+44.539136 2824.86 5664
+44.550464 2824.86 5664
+44.561792 2824.86 5664
+44.573120 2824.86 5664
+44.584384 2840.91 5632
+44.595648 2840.91 5632
+44.606912 2840.91 5632
+44.618176 2840.91 5632
+44.629440 2840.91 5632
+44.640704 2840.91 5632
+44.651968 2840.91 5632
+44.663232 2840.91 5632
+44.674496 2840.91 5632
+44.685760 2840.91 5632
+44.697024 2840.91 5632
+44.708288 2840.91 5632
+44.719552 2840.91 5632
+44.730816 2840.91 5632
+44.742080 2840.91 5632
+44.753344 2840.91 5632
+44.764608 2840.91 5632
+44.775872 2840.91 5632
+44.787136 2840.91 5632
+44.798400 2840.91 5632
+44.809664 2840.91 5632
+44.820928 2840.91 5632
+44.832192 2840.91 5632
+44.843456 2840.91 5632
+44.854656 2857.14 5600
+44.865856 2857.14 5600
+44.877056 2857.14 5600
+44.888256 2857.14 5600
+44.899456 2857.14 5600
+44.910656 2857.14 5600
+44.921856 2857.14 5600
+44.933056 2857.14 5600
+44.944256 2857.14 5600
+44.955456 2857.14 5600
+44.966656 2857.14 5600
+44.977856 2857.14 5600
+44.989056 2857.14 5600
+45.000256 2857.14 5600
+45.011456 2857.14 5600
+45.022656 2857.14 5600
+45.033856 2857.14 5600
+45.045056 2857.14 5600
+45.056256 2857.14 5600
+45.067456 2857.14 5600
+45.078656 2857.14 5600
+45.089856 2857.14 5600
+45.101056 2857.14 5600
+45.112256 2857.14 5600
+45.123392 2873.56 5568
+45.134528 2873.56 5568
+45.145664 2873.56 5568
+45.156800 2873.56 5568
+45.167936 2873.56 5568
+45.179072 2873.56 5568
+45.190208 2873.56 5568
+45.201344 2873.56 5568
+45.212480 2873.56 5568
+45.223616 2873.56 5568
+45.234752 2873.56 5568
+45.245888 2873.56 5568
+45.257024 2873.56 5568
+45.268160 2873.56 5568
+45.279296 2873.56 5568
+45.290432 2873.56 5568
+45.301568 2873.56 5568
+45.312704 2873.56 5568
+45.323840 2873.56 5568
+45.334976 2873.56 5568
+45.346112 2873.56 5568
+45.357248 2873.56 5568
+45.368384 2873.56 5568
+45.379520 2873.56 5568
+45.390656 2873.56 5568
+45.401792 2873.56 5568
+45.412928 2873.56 5568
+45.424064 2873.56 5568
+45.435200 2873.56 5568
+45.446336 2873.56 5568
+45.457472 2873.56 5568
+45.468608 2873.56 5568
+45.479744 2873.56 5568
+45.490880 2873.56 5568
+45.502016 2873.56 5568
+45.513152 2873.56 5568
+45.524288 2873.56 5568
+45.535424 2873.56 5568
+45.546560 2873.56 5568
+45.557696 2873.56 5568
+45.568768 2890.17 5536
+45.579840 2890.17 5536
+45.590912 2890.17 5536
+45.601984 2890.17 5536
+45.613056 2890.17 5536
+45.624128 2890.17 5536
+45.635200 2890.17 5536
+45.646272 2890.17 5536
+45.657344 2890.17 5536
+45.668416 2890.17 5536
+45.679488 2890.17 5536
+45.690560 2890.17 5536
+45.701632 2890.17 5536
+45.712704 2890.17 5536
+45.723776 2890.17 5536
+45.734848 2890.17 5536
+45.745920 2890.17 5536
+45.756992 2890.17 5536
+45.768064 2890.17 5536
+45.779136 2890.17 5536
+45.790208 2890.17 5536
+45.801280 2890.17 5536
+45.812352 2890.17 5536
+45.823424 2890.17 5536
+45.834496 2890.17 5536
+45.845568 2890.17 5536
+45.856640 2890.17 5536
+45.867712 2890.17 5536
+45.878784 2890.17 5536
+45.889856 2890.17 5536
+45.900928 2890.17 5536
+45.912000 2890.17 5536
+45.923008 2906.98 5504
+45.934016 2906.98 5504
+45.945024 2906.98 5504
+45.956032 2906.98 5504
+45.967040 2906.98 5504
+45.978048 2906.98 5504
+45.989056 2906.98 5504
+46.000064 2906.98 5504
+46.011072 2906.98 5504
+46.022080 2906.98 5504
+46.033088 2906.98 5504
+46.044096 2906.98 5504
+46.055104 2906.98 5504
+46.066112 2906.98 5504
+46.077120 2906.98 5504
+46.088128 2906.98 5504
+46.099072 2923.98 5472
+46.110016 2923.98 5472
+46.120960 2923.98 5472
+46.131904 2923.98 5472
+46.142848 2923.98 5472
+46.153792 2923.98 5472
+46.164736 2923.98 5472
+46.175680 2923.98 5472
+46.186624 2923.98 5472
+46.197568 2923.98 5472
+46.208512 2923.98 5472
+46.219456 2923.98 5472
+46.230400 2923.98 5472
+46.241344 2923.98 5472
+46.252288 2923.98 5472
+46.263232 2923.98 5472
+46.274176 2923.98 5472
+46.285120 2923.98 5472
+46.296064 2923.98 5472
+46.307008 2923.98 5472
+46.317952 2923.98 5472
+46.328896 2923.98 5472
+46.339840 2923.98 5472
+46.350784 2923.98 5472
+46.361728 2923.98 5472
+46.372672 2923.98 5472
+46.383616 2923.98 5472
+46.394560 2923.98 5472
+46.405504 2923.98 5472
+46.416448 2923.98 5472
+46.427392 2923.98 5472
+46.438336 2923.98 5472
+46.449216 2941.18 5440
+46.460096 2941.18 5440
+46.470976 2941.18 5440
+46.481856 2941.18 5440
+46.492736 2941.18 5440
+46.503616 2941.18 5440
+46.514496 2941.18 5440
+46.525376 2941.18 5440
+46.536256 2941.18 5440
+46.547136 2941.18 5440
+46.558016 2941.18 5440
+46.568896 2941.18 5440
+46.579776 2941.18 5440
+46.590656 2941.18 5440
+46.601536 2941.18 5440
+46.612416 2941.18 5440
+46.623232 2958.58 5408
+46.634048 2958.58 5408
+46.644864 2958.58 5408
+46.655680 2958.58 5408
+46.666496 2958.58 5408
+46.677312 2958.58 5408
+46.688128 2958.58 5408
+46.698944 2958.58 5408
+46.709760 2958.58 5408
+46.720576 2958.58 5408
+46.731392 2958.58 5408
+46.742208 2958.58 5408
+46.753024 2958.58 5408
+46.763840 2958.58 5408
+46.774656 2958.58 5408
+46.785472 2958.58 5408
+46.796288 2958.58 5408
+46.807104 2958.58 5408
+46.817920 2958.58 5408
+46.828736 2958.58 5408
+46.839552 2958.58 5408
+46.850368 2958.58 5408
+46.861184 2958.58 5408
+46.872000 2958.58 5408
+46.882816 2958.58 5408
+46.893632 2958.58 5408
+46.904448 2958.58 5408
+46.915264 2958.58 5408
+46.926080 2958.58 5408
+46.936896 2958.58 5408
+46.947712 2958.58 5408
+46.958528 2958.58 5408
+46.969280 2976.19 5376
+46.980032 2976.19 5376
+46.990784 2976.19 5376
+47.001536 2976.19 5376
+47.012288 2976.19 5376
+47.023040 2976.19 5376
+47.033792 2976.19 5376
+47.044544 2976.19 5376
+47.055296 2976.19 5376
+47.066048 2976.19 5376
+47.076800 2976.19 5376
+47.087552 2976.19 5376
+47.098304 2976.19 5376
+47.109056 2976.19 5376
+47.119808 2976.19 5376
+47.130560 2976.19 5376
+47.141248 2994.01 5344
+47.151936 2994.01 5344
+47.162624 2994.01 5344
+47.173312 2994.01 5344
+47.184000 2994.01 5344
+47.194688 2994.01 5344
+47.205376 2994.01 5344
+47.216064 2994.01 5344
+47.226752 2994.01 5344
+47.237440 2994.01 5344
+47.248128 2994.01 5344
+47.258816 2994.01 5344
+47.269504 2994.01 5344
+47.280192 2994.01 5344
+47.290880 2994.01 5344
+47.301568 2994.01 5344
+47.312256 2994.01 5344
+47.322944 2994.01 5344
+47.333632 2994.01 5344
+47.344320 2994.01 5344
+47.355008 2994.01 5344
+47.365696 2994.01 5344
+47.376384 2994.01 5344
+47.387072 2994.01 5344
+47.397760 2994.01 5344
+47.408448 2994.01 5344
+47.419136 2994.01 5344
+47.429824 2994.01 5344
+47.440512 2994.01 5344
+47.451200 2994.01 5344
+47.461888 2994.01 5344
+47.472576 2994.01 5344
+47.483200 3012.05 5312
+47.499136 3012.05 5312
+47.515072 3012.05 5312
+47.531008 3012.05 5312
+47.546944 3012.05 5312
+47.562880 3012.05 5312
+47.578816 3012.05 5312
+47.594752 3012.05 5312
+47.610688 3012.05 5312
+47.626624 3012.05 5312
+47.642560 3012.05 5312
+47.658400 3030.30 5280
+47.674240 3030.30 5280
+47.690080 3030.30 5280
+47.705920 3030.30 5280
+47.721760 3030.30 5280
+47.737600 3030.30 5280
+47.753440 3030.30 5280
+47.769280 3030.30 5280
+47.785120 3030.30 5280
+47.800960 3030.30 5280
+47.816800 3030.30 5280
+47.832640 3030.30 5280
+47.848480 3030.30 5280
+47.864320 3030.30 5280
+47.880160 3030.30 5280
+47.896000 3030.30 5280
+47.911840 3030.30 5280
+47.927680 3030.30 5280
+47.943520 3030.30 5280
+47.959360 3030.30 5280
+47.975200 3030.30 5280
+47.990944 3048.78 5248
+48.006688 3048.78 5248
+48.022432 3048.78 5248
+48.038176 3048.78 5248
+48.053920 3048.78 5248
+48.069664 3048.78 5248
+48.085408 3048.78 5248
+48.101152 3048.78 5248
+48.116896 3048.78 5248
+48.132640 3048.78 5248
+48.148384 3048.78 5248
+48.164032 3067.48 5216
+48.179680 3067.48 5216
+48.195328 3067.48 5216
+48.210976 3067.48 5216
+48.226624 3067.48 5216
+48.242272 3067.48 5216
+48.257920 3067.48 5216
+48.273568 3067.48 5216
+48.289216 3067.48 5216
+48.304864 3067.48 5216
+48.320512 3067.48 5216
+48.336160 3067.48 5216
+48.351808 3067.48 5216
+48.367456 3067.48 5216
+48.383104 3067.48 5216
+48.398752 3067.48 5216
+48.414400 3067.48 5216
+48.430048 3067.48 5216
+48.445696 3067.48 5216
+48.461344 3067.48 5216
+48.476992 3067.48 5216
+48.492640 3067.48 5216
+48.508288 3067.48 5216
+48.523936 3067.48 5216
+48.539584 3067.48 5216
+48.555232 3067.48 5216
+48.570880 3067.48 5216
+48.586528 3067.48 5216
+48.602176 3067.48 5216
+48.617824 3067.48 5216
+48.633472 3067.48 5216
+48.649120 3067.48 5216
+48.664672 3086.42 5184
+48.680224 3086.42 5184
+48.695776 3086.42 5184
+48.711328 3086.42 5184
+48.726880 3086.42 5184
+48.742432 3086.42 5184
+48.757984 3086.42 5184
+48.773536 3086.42 5184
+48.789088 3086.42 5184
+48.804640 3086.42 5184
+48.820192 3086.42 5184
+48.835744 3086.42 5184
+48.851296 3086.42 5184
+48.866848 3086.42 5184
+48.882400 3086.42 5184
+48.897952 3086.42 5184
+48.913504 3086.42 5184
+48.929056 3086.42 5184
+48.944608 3086.42 5184
+48.960160 3086.42 5184
+48.975712 3086.42 5184
+48.991168 3105.59 5152
+49.006624 3105.59 5152
+49.022080 3105.59 5152
+49.037536 3105.59 5152
+49.052992 3105.59 5152
+49.068448 3105.59 5152
+49.083904 3105.59 5152
+49.099360 3105.59 5152
+49.114816 3105.59 5152
+49.130272 3105.59 5152
+49.145728 3105.59 5152
+49.161184 3105.59 5152
+49.176640 3105.59 5152
+49.192096 3105.59 5152
+49.207552 3105.59 5152
+49.223008 3105.59 5152
+49.238464 3105.59 5152
+49.253920 3105.59 5152
+49.269376 3105.59 5152
+49.284832 3105.59 5152
+49.300288 3105.59 5152
+49.315744 3105.59 5152
+49.331104 3125.00 5120
+49.346464 3125.00 5120
+49.361824 3125.00 5120
+49.377184 3125.00 5120
+49.392544 3125.00 5120
+49.407904 3125.00 5120
+49.423264 3125.00 5120
+49.438624 3125.00 5120
+49.453984 3125.00 5120
+49.469344 3125.00 5120
+49.484608 3144.65 5088
+49.499872 3144.65 5088
+49.515136 3144.65 5088
+49.530400 3144.65 5088
+49.545664 3144.65 5088
+49.560928 3144.65 5088
+49.576192 3144.65 5088
+49.591456 3144.65 5088
+49.606720 3144.65 5088
+49.621984 3144.65 5088
+49.637248 3144.65 5088
+49.652512 3144.65 5088
+49.667776 3144.65 5088
+49.683040 3144.65 5088
+49.698304 3144.65 5088
+49.713568 3144.65 5088
+49.728832 3144.65 5088
+49.744096 3144.65 5088
+49.759360 3144.65 5088
+49.774624 3144.65 5088
+49.789888 3144.65 5088
+49.805152 3144.65 5088
+49.820320 3164.56 5056
+49.835488 3164.56 5056
+49.850656 3164.56 5056
+49.865824 3164.56 5056
+49.880992 3164.56 5056
+49.896160 3164.56 5056
+49.911328 3164.56 5056
+49.926496 3164.56 5056
+49.941664 3164.56 5056
+49.956832 3164.56 5056
+49.972000 3164.56 5056
+49.987168 3164.56 5056
+50.002336 3164.56 5056
+50.017504 3164.56 5056
+50.032672 3164.56 5056
+50.047840 3164.56 5056
+50.063008 3164.56 5056
+50.078176 3164.56 5056
+50.093344 3164.56 5056
+50.108512 3164.56 5056
+50.123680 3164.56 5056
+50.138752 3184.71 5024
+50.153824 3184.71 5024
+50.168896 3184.71 5024
+50.183968 3184.71 5024
+50.199040 3184.71 5024
+50.214112 3184.71 5024
+50.229184 3184.71 5024
+50.244256 3184.71 5024
+50.259328 3184.71 5024
+50.274400 3184.71 5024
+50.289472 3184.71 5024
+50.304544 3184.71 5024
+50.319616 3184.71 5024
+50.334688 3184.71 5024
+50.349760 3184.71 5024
+50.364832 3184.71 5024
+50.379904 3184.71 5024
+50.394976 3184.71 5024
+50.410048 3184.71 5024
+50.425120 3184.71 5024
+50.440192 3184.71 5024
+50.455264 3184.71 5024
+50.470336 3184.71 5024
+50.485408 3184.71 5024
+50.500480 3184.71 5024
+50.515552 3184.71 5024
+50.530624 3184.71 5024
+50.545696 3184.71 5024
+50.560768 3184.71 5024
+50.575840 3184.71 5024
+50.590912 3184.71 5024
+50.605984 3184.71 5024
+50.620960 3205.13 4992
+50.635936 3205.13 4992
+50.650912 3205.13 4992
+50.665888 3205.13 4992
+50.680864 3205.13 4992
+50.695840 3205.13 4992
+50.710816 3205.13 4992
+50.725792 3205.13 4992
+50.740768 3205.13 4992
+50.755744 3205.13 4992
+50.770720 3205.13 4992
+50.785696 3205.13 4992
+50.800672 3205.13 4992
+50.815648 3205.13 4992
+50.830624 3205.13 4992
+50.845600 3205.13 4992
+50.860576 3205.13 4992
+50.875552 3205.13 4992
+50.890528 3205.13 4992
+50.905504 3205.13 4992
+50.920480 3205.13 4992
+50.935360 3225.81 4960
+50.950240 3225.81 4960
+50.965120 3225.81 4960
+50.980000 3225.81 4960
+50.994880 3225.81 4960
+51.009760 3225.81 4960
+51.024640 3225.81 4960
+51.039520 3225.81 4960
+51.054400 3225.81 4960
+51.069280 3225.81 4960
+51.084160 3225.81 4960
+51.099040 3225.81 4960
+51.113920 3225.81 4960
+51.128800 3225.81 4960
+51.143680 3225.81 4960
+51.158560 3225.81 4960
+51.173440 3225.81 4960
+51.188320 3225.81 4960
+51.203200 3225.81 4960
+51.218080 3225.81 4960
+51.232960 3225.81 4960
+51.247840 3225.81 4960
+51.262624 3246.75 4928
+51.277408 3246.75 4928
+51.292192 3246.75 4928
+51.306976 3246.75 4928
+51.321760 3246.75 4928
+51.336544 3246.75 4928
+51.351328 3246.75 4928
+51.366112 3246.75 4928
+51.380896 3246.75 4928
+51.395680 3246.75 4928
+51.410368 3267.97 4896
+51.425056 3267.97 4896
+51.439744 3267.97 4896
+51.454432 3267.97 4896
+51.469120 3267.97 4896
+51.483808 3267.97 4896
+51.498496 3267.97 4896
+51.513184 3267.97 4896
+51.527872 3267.97 4896
+51.542560 3267.97 4896
+51.557248 3267.97 4896
+51.571936 3267.97 4896
+51.586624 3267.97 4896
+51.601312 3267.97 4896
+51.616000 3267.97 4896
+51.630688 3267.97 4896
+51.645376 3267.97 4896
+51.660064 3267.97 4896
+51.674752 3267.97 4896
+51.689440 3267.97 4896
+51.704128 3267.97 4896
+51.718816 3267.97 4896
+51.733408 3289.47 4864
+51.748000 3289.47 4864
+51.762592 3289.47 4864
+51.777184 3289.47 4864
+51.791776 3289.47 4864
+51.806368 3289.47 4864
+51.820960 3289.47 4864
+51.835552 3289.47 4864
+51.850144 3289.47 4864
+51.864736 3289.47 4864
+51.879328 3289.47 4864
+51.893920 3289.47 4864
+51.908512 3289.47 4864
+51.923104 3289.47 4864
+51.937696 3289.47 4864
+51.952288 3289.47 4864
+51.966880 3289.47 4864
+51.981472 3289.47 4864
+51.996064 3289.47 4864
+52.010656 3289.47 4864
+52.025248 3289.47 4864
+52.039840 3289.47 4864
+52.054432 3289.47 4864
+52.069024 3289.47 4864
+52.083616 3289.47 4864
+52.098208 3289.47 4864
+52.112800 3289.47 4864
+52.127392 3289.47 4864
+52.141984 3289.47 4864
+52.156576 3289.47 4864
+52.171168 3289.47 4864
+52.185760 3289.47 4864
+52.200352 3289.47 4864
+52.214944 3289.47 4864
+52.229536 3289.47 4864
+52.244128 3289.47 4864
+52.258720 3289.47 4864
+52.273312 3289.47 4864
+52.287904 3289.47 4864
+52.302496 3289.47 4864
+52.317088 3289.47 4864
+52.331680 3289.47 4864
+52.346176 3311.26 4832
+52.360672 3311.26 4832
+52.375168 3311.26 4832
+52.389664 3311.26 4832
+52.404160 3311.26 4832
+52.418656 3311.26 4832
+52.433152 3311.26 4832
+52.447648 3311.26 4832
+52.462144 3311.26 4832
+52.476640 3311.26 4832
+52.491136 3311.26 4832
+52.505632 3311.26 4832
+52.520128 3311.26 4832
+52.534624 3311.26 4832
+52.549120 3311.26 4832
+52.563616 3311.26 4832
+52.578112 3311.26 4832
+52.592608 3311.26 4832
+52.607104 3311.26 4832
+52.621600 3311.26 4832
+52.636096 3311.26 4832
+52.650592 3311.26 4832
+52.664992 3333.33 4800
+52.679392 3333.33 4800
+52.693792 3333.33 4800
+52.708192 3333.33 4800
+52.722592 3333.33 4800
+52.736992 3333.33 4800
+52.751392 3333.33 4800
+52.765792 3333.33 4800
+52.780192 3333.33 4800
+52.794592 3333.33 4800
+52.808992 3333.33 4800
+52.823392 3333.33 4800
+52.837792 3333.33 4800
+52.852192 3333.33 4800
+52.866592 3333.33 4800
+52.880992 3333.33 4800
+52.895392 3333.33 4800
+52.909792 3333.33 4800
+52.924192 3333.33 4800
+52.938592 3333.33 4800
+52.952992 3333.33 4800
+52.967296 3355.70 4768
+52.981600 3355.70 4768
+52.995904 3355.70 4768
+53.010208 3355.70 4768
+53.024512 3355.70 4768
+53.038816 3355.70 4768
+53.053120 3355.70 4768
+53.067424 3355.70 4768
+53.081728 3355.70 4768
+53.096032 3355.70 4768
+53.110336 3355.70 4768
+53.124544 3378.38 4736
+53.138752 3378.38 4736
+53.152960 3378.38 4736
+53.167168 3378.38 4736
+53.181376 3378.38 4736
+53.195584 3378.38 4736
+53.209792 3378.38 4736
+53.224000 3378.38 4736
+53.238208 3378.38 4736
+53.252416 3378.38 4736
+53.266624 3378.38 4736
+53.280832 3378.38 4736
+53.295040 3378.38 4736
+53.309248 3378.38 4736
+53.323456 3378.38 4736
+53.337664 3378.38 4736
+53.351872 3378.38 4736
+53.366080 3378.38 4736
+53.380288 3378.38 4736
+53.394496 3378.38 4736
+53.408704 3378.38 4736
+53.422816 3401.36 4704
+53.436928 3401.36 4704
+53.451040 3401.36 4704
+53.465152 3401.36 4704
+53.479264 3401.36 4704
+53.493376 3401.36 4704
+53.507488 3401.36 4704
+53.521600 3401.36 4704
+53.535712 3401.36 4704
+53.549824 3401.36 4704
+53.563936 3401.36 4704
+53.578048 3401.36 4704
+53.592160 3401.36 4704
+53.606272 3401.36 4704
+53.620384 3401.36 4704
+53.634496 3401.36 4704
+53.648608 3401.36 4704
+53.662720 3401.36 4704
+53.676832 3401.36 4704
+53.690944 3401.36 4704
+53.705056 3401.36 4704
+53.719168 3401.36 4704
+53.733280 3401.36 4704
+53.747392 3401.36 4704
+53.761504 3401.36 4704
+53.775616 3401.36 4704
+53.789728 3401.36 4704
+53.803840 3401.36 4704
+53.817952 3401.36 4704
+53.832064 3401.36 4704
+53.846176 3401.36 4704
+53.860288 3401.36 4704
+53.874400 3401.36 4704
+53.888512 3401.36 4704
+53.902624 3401.36 4704
+53.916736 3401.36 4704
+53.930848 3401.36 4704
+53.944960 3401.36 4704
+53.959072 3401.36 4704
+53.973184 3401.36 4704
+53.987296 3401.36 4704
+54.001408 3401.36 4704
+54.015520 3401.36 4704
+54.029536 3424.66 4672
+54.043552 3424.66 4672
+54.057568 3424.66 4672
+54.071584 3424.66 4672
+54.085600 3424.66 4672
+54.099616 3424.66 4672
+54.113632 3424.66 4672
+54.127648 3424.66 4672
+54.141664 3424.66 4672
+54.155680 3424.66 4672
+54.169696 3424.66 4672
+54.183712 3424.66 4672
+54.197728 3424.66 4672
+54.211744 3424.66 4672
+54.225760 3424.66 4672
+54.239776 3424.66 4672
+54.253792 3424.66 4672
+54.267808 3424.66 4672
+54.281824 3424.66 4672
+54.295840 3424.66 4672
+54.309856 3424.66 4672
+54.323776 3448.28 4640
+54.337696 3448.28 4640
+54.351616 3448.28 4640
+54.365536 3448.28 4640
+54.379456 3448.28 4640
+54.393376 3448.28 4640
+54.407296 3448.28 4640
+54.421216 3448.28 4640
+54.435136 3448.28 4640
+54.449056 3448.28 4640
+54.462976 3448.28 4640
+54.476896 3448.28 4640
+54.490816 3448.28 4640
+54.504736 3448.28 4640
+54.518656 3448.28 4640
+54.532576 3448.28 4640
+54.546496 3448.28 4640
+54.560416 3448.28 4640
+54.574336 3448.28 4640
+54.588256 3448.28 4640
+54.602176 3448.28 4640
+54.616000 3472.22 4608
+54.629824 3472.22 4608
+54.643648 3472.22 4608
+54.657472 3472.22 4608
+54.671296 3472.22 4608
+54.685120 3472.22 4608
+54.698944 3472.22 4608
+54.712768 3472.22 4608
+54.726592 3472.22 4608
+54.740416 3472.22 4608
+54.754240 3472.22 4608
+54.768064 3472.22 4608
+54.781888 3472.22 4608
+54.795712 3472.22 4608
+54.809536 3472.22 4608
+54.823360 3472.22 4608
+54.837184 3472.22 4608
+54.851008 3472.22 4608
+54.864832 3472.22 4608
+54.878656 3472.22 4608
+54.892480 3472.22 4608
+54.906304 3472.22 4608
+54.920128 3472.22 4608
+54.933952 3472.22 4608
+54.947776 3472.22 4608
+54.961600 3472.22 4608
+54.975424 3472.22 4608
+54.989248 3472.22 4608
+55.003072 3472.22 4608
+55.016896 3472.22 4608
+55.030720 3472.22 4608
+55.044544 3472.22 4608
+55.058368 3472.22 4608
+55.072192 3472.22 4608
+55.086016 3472.22 4608
+55.099840 3472.22 4608
+55.113664 3472.22 4608
+55.127488 3472.22 4608
+55.141312 3472.22 4608
+55.155136 3472.22 4608
+55.168960 3472.22 4608
+55.182784 3472.22 4608
+55.196608 3472.22 4608
+55.210336 3496.50 4576
+55.224064 3496.50 4576
+55.237792 3496.50 4576
+55.251520 3496.50 4576
+55.265248 3496.50 4576
+55.278976 3496.50 4576
+55.292704 3496.50 4576
+55.306432 3496.50 4576
+55.320160 3496.50 4576
+55.333888 3496.50 4576
+55.347616 3496.50 4576
+55.361344 3496.50 4576
+55.375072 3496.50 4576
+55.388800 3496.50 4576
+55.402528 3496.50 4576
+55.416256 3496.50 4576
+55.429984 3496.50 4576
+55.443712 3496.50 4576
+55.457440 3496.50 4576
+55.471168 3496.50 4576
+55.484896 3496.50 4576
+55.498528 3521.13 4544
+55.512160 3521.13 4544
+55.525792 3521.13 4544
+55.539424 3521.13 4544
+55.553056 3521.13 4544
+55.566688 3521.13 4544
+55.580320 3521.13 4544
+55.593952 3521.13 4544
+55.607584 3521.13 4544
+55.621216 3521.13 4544
+55.634848 3521.13 4544
+55.648480 3521.13 4544
+55.662112 3521.13 4544
+55.675744 3521.13 4544
+55.689376 3521.13 4544
+55.703008 3521.13 4544
+55.716640 3521.13 4544
+55.730272 3521.13 4544
+55.743904 3521.13 4544
+55.757536 3521.13 4544
+55.771168 3521.13 4544
+55.784800 3521.13 4544
+55.798336 3546.10 4512
+55.811872 3546.10 4512
+55.825408 3546.10 4512
+55.838944 3546.10 4512
+55.852480 3546.10 4512
+55.866016 3546.10 4512
+55.879552 3546.10 4512
+55.893088 3546.10 4512
+55.906624 3546.10 4512
+55.920160 3546.10 4512
+55.933696 3546.10 4512
+55.947232 3546.10 4512
+55.960768 3546.10 4512
+55.974304 3546.10 4512
+55.987840 3546.10 4512
+56.001376 3546.10 4512
+56.014912 3546.10 4512
+56.028448 3546.10 4512
+56.041984 3546.10 4512
+56.055520 3546.10 4512
+56.069056 3546.10 4512
+56.082592 3546.10 4512
+56.096128 3546.10 4512
+56.109664 3546.10 4512
+56.123200 3546.10 4512
+56.136736 3546.10 4512
+56.150272 3546.10 4512
+56.163808 3546.10 4512
+56.177344 3546.10 4512
+56.190880 3546.10 4512
+56.204416 3546.10 4512
+56.217952 3546.10 4512
+56.231392 3571.43 4480
+56.244832 3571.43 4480
+56.258272 3571.43 4480
+56.271712 3571.43 4480
+56.285152 3571.43 4480
+56.298592 3571.43 4480
+56.312032 3571.43 4480
+56.325472 3571.43 4480
+56.338912 3571.43 4480
+56.352352 3571.43 4480
+56.365792 3571.43 4480
+56.379232 3571.43 4480
+56.392672 3571.43 4480
+56.406112 3571.43 4480
+56.419552 3571.43 4480
+56.432992 3571.43 4480
+56.446432 3571.43 4480
+56.459872 3571.43 4480
+56.473312 3571.43 4480
+56.486752 3571.43 4480
+56.500192 3571.43 4480
+56.513632 3571.43 4480
+56.527072 3571.43 4480
+56.540512 3571.43 4480
+56.553952 3571.43 4480
+56.567392 3571.43 4480
+56.580832 3571.43 4480
+56.594272 3571.43 4480
+56.607712 3571.43 4480
+56.621152 3571.43 4480
+56.634592 3571.43 4480
+56.648032 3571.43 4480
+56.661472 3571.43 4480
+56.674912 3571.43 4480
+56.688352 3571.43 4480
+56.701792 3571.43 4480
+56.715232 3571.43 4480
+56.728672 3571.43 4480
+56.742112 3571.43 4480
+56.755552 3571.43 4480
+56.768992 3571.43 4480
+56.782432 3571.43 4480
+56.795776 3597.12 4448
+56.809120 3597.12 4448
+56.822464 3597.12 4448
+56.835808 3597.12 4448
+56.849152 3597.12 4448
+56.862496 3597.12 4448
+56.875840 3597.12 4448
+56.889184 3597.12 4448
+56.902528 3597.12 4448
+56.915872 3597.12 4448
+56.929216 3597.12 4448
+56.942560 3597.12 4448
+56.955904 3597.12 4448
+56.969248 3597.12 4448
+56.982592 3597.12 4448
+56.995936 3597.12 4448
+57.009280 3597.12 4448
+57.022624 3597.12 4448
+57.035968 3597.12 4448
+57.049312 3597.12 4448
+57.062656 3597.12 4448
+57.076000 3597.12 4448
+57.089248 3623.19 4416
+57.102496 3623.19 4416
+57.115744 3623.19 4416
+57.128992 3623.19 4416
+57.142240 3623.19 4416
+57.155488 3623.19 4416
+57.168736 3623.19 4416
+57.181984 3623.19 4416
+57.195232 3623.19 4416
+57.208480 3623.19 4416
+57.221728 3623.19 4416
+57.234976 3623.19 4416
+57.248224 3623.19 4416
+57.261472 3623.19 4416
+57.274720 3623.19 4416
+57.287968 3623.19 4416
+57.301216 3623.19 4416
+57.314464 3623.19 4416
+57.327712 3623.19 4416
+57.340960 3623.19 4416
+57.354208 3623.19 4416
+57.367360 3649.64 4384
+57.380512 3649.64 4384
+57.393664 3649.64 4384
+57.406816 3649.64 4384
+57.419968 3649.64 4384
+57.433120 3649.64 4384
+57.446272 3649.64 4384
+57.459424 3649.64 4384
+57.472576 3649.64 4384
+57.485728 3649.64 4384
+57.498880 3649.64 4384
+57.512032 3649.64 4384
+57.525184 3649.64 4384
+57.538336 3649.64 4384
+57.551488 3649.64 4384
+57.564640 3649.64 4384
+57.577792 3649.64 4384
+57.590944 3649.64 4384
+57.604096 3649.64 4384
+57.617248 3649.64 4384
+57.630400 3649.64 4384
+57.643552 3649.64 4384
+57.656704 3649.64 4384
+57.669856 3649.64 4384
+57.683008 3649.64 4384
+57.696160 3649.64 4384
+57.709312 3649.64 4384
+57.722464 3649.64 4384
+57.735616 3649.64 4384
+57.748768 3649.64 4384
+57.761920 3649.64 4384
+57.775072 3649.64 4384
+57.788224 3649.64 4384
+57.801376 3649.64 4384
+57.814528 3649.64 4384
+57.827680 3649.64 4384
+57.840832 3649.64 4384
+57.853984 3649.64 4384
+57.867136 3649.64 4384
+57.880288 3649.64 4384
+57.893440 3649.64 4384
+57.906592 3649.64 4384
+57.919744 3649.64 4384
+57.932896 3649.64 4384
+57.946048 3649.64 4384
+57.959200 3649.64 4384
+57.972352 3649.64 4384
+57.985504 3649.64 4384
+57.998656 3649.64 4384
+58.011808 3649.64 4384
+58.024960 3649.64 4384
+58.038112 3649.64 4384
+58.051264 3649.64 4384
+58.064320 3676.47 4352
+58.077376 3676.47 4352
+58.090432 3676.47 4352
+58.103488 3676.47 4352
+58.116544 3676.47 4352
+58.129600 3676.47 4352
+58.142656 3676.47 4352
+58.155712 3676.47 4352
+58.168768 3676.47 4352
+58.181824 3676.47 4352
+58.194880 3676.47 4352
+58.207936 3676.47 4352
+58.220992 3676.47 4352
+58.234048 3676.47 4352
+58.247104 3676.47 4352
+58.260160 3676.47 4352
+58.273216 3676.47 4352
+58.286272 3676.47 4352
+58.299328 3676.47 4352
+58.312384 3676.47 4352
+58.325440 3676.47 4352
+58.338496 3676.47 4352
+58.351456 3703.70 4320
+58.364416 3703.70 4320
+58.377376 3703.70 4320
+58.390336 3703.70 4320
+58.403296 3703.70 4320
+58.416256 3703.70 4320
+58.429216 3703.70 4320
+58.442176 3703.70 4320
+58.455136 3703.70 4320
+58.468096 3703.70 4320
+58.481056 3703.70 4320
+58.494016 3703.70 4320
+58.506976 3703.70 4320
+58.519936 3703.70 4320
+58.532896 3703.70 4320
+58.545856 3703.70 4320
+58.558816 3703.70 4320
+58.571776 3703.70 4320
+58.584736 3703.70 4320
+58.597696 3703.70 4320
+58.610656 3703.70 4320
+58.623616 3703.70 4320
+58.636576 3703.70 4320
+58.649536 3703.70 4320
+58.662496 3703.70 4320
+58.675456 3703.70 4320
+58.688416 3703.70 4320
+58.701376 3703.70 4320
+58.714336 3703.70 4320
+58.727296 3703.70 4320
+58.740256 3703.70 4320
+58.753216 3703.70 4320
+58.766176 3703.70 4320
+58.779136 3703.70 4320
+58.792096 3703.70 4320
+58.805056 3703.70 4320
+58.818016 3703.70 4320
+58.830976 3703.70 4320
+58.843936 3703.70 4320
+58.856896 3703.70 4320
+58.869856 3703.70 4320
+58.882816 3703.70 4320
+58.895776 3703.70 4320
+58.908736 3703.70 4320
+58.921696 3703.70 4320
+58.934656 3703.70 4320
+58.947616 3703.70 4320
+58.960576 3703.70 4320
+58.973536 3703.70 4320
+58.986496 3703.70 4320
+58.999456 3703.70 4320
+59.012416 3703.70 4320
+59.025376 3703.70 4320
+59.038240 3731.34 4288
+59.051104 3731.34 4288
+59.063968 3731.34 4288
+59.076832 3731.34 4288
+59.089696 3731.34 4288
+59.102560 3731.34 4288
+59.115424 3731.34 4288
+59.128288 3731.34 4288
+59.141152 3731.34 4288
+59.154016 3731.34 4288
+59.166880 3731.34 4288
+59.179744 3731.34 4288
+59.192608 3731.34 4288
+59.205472 3731.34 4288
+59.218336 3731.34 4288
+59.231200 3731.34 4288
+59.244064 3731.34 4288
+59.256928 3731.34 4288
+59.269792 3731.34 4288
+59.282656 3731.34 4288
+59.295520 3731.34 4288
+59.308288 3759.40 4256
+59.321056 3759.40 4256
+59.333824 3759.40 4256
+59.346592 3759.40 4256
+59.359360 3759.40 4256
+59.372128 3759.40 4256
+59.384896 3759.40 4256
+59.397664 3759.40 4256
+59.410432 3759.40 4256
+59.423200 3759.40 4256
+59.435968 3759.40 4256
+59.448736 3759.40 4256
+59.461504 3759.40 4256
+59.474272 3759.40 4256
+59.487040 3759.40 4256
+59.499808 3759.40 4256
+59.512576 3759.40 4256
+59.525344 3759.40 4256
+59.538112 3759.40 4256
+59.550880 3759.40 4256
+59.563648 3759.40 4256
+59.576416 3759.40 4256
+59.589088 3787.88 4224
+59.601760 3787.88 4224
+59.614432 3787.88 4224
+59.627104 3787.88 4224
+59.639776 3787.88 4224
+59.652448 3787.88 4224
+59.665120 3787.88 4224
+59.677792 3787.88 4224
+59.690464 3787.88 4224
+59.703136 3787.88 4224
+59.715808 3787.88 4224
+59.728480 3787.88 4224
+59.741152 3787.88 4224
+59.753824 3787.88 4224
+59.766496 3787.88 4224
+59.779168 3787.88 4224
+59.791840 3787.88 4224
+59.804512 3787.88 4224
+59.817184 3787.88 4224
+59.829856 3787.88 4224
+59.842528 3787.88 4224
+59.855200 3787.88 4224
+59.867872 3787.88 4224
+59.880544 3787.88 4224
+59.893216 3787.88 4224
+59.905888 3787.88 4224
+59.918560 3787.88 4224
+59.931232 3787.88 4224
+59.943904 3787.88 4224
+59.956576 3787.88 4224
+59.969248 3787.88 4224
+59.981920 3787.88 4224
+59.994592 3787.88 4224
+60.007264 3787.88 4224
+60.019936 3787.88 4224
+60.032608 3787.88 4224
+60.045280 3787.88 4224
+60.057952 3787.88 4224
+60.070624 3787.88 4224
+60.083296 3787.88 4224
+60.095968 3787.88 4224
+60.108640 3787.88 4224
+60.121312 3787.88 4224
+60.133984 3787.88 4224
+60.146656 3787.88 4224
+60.159328 3787.88 4224
+60.172000 3787.88 4224
+60.184672 3787.88 4224
+60.197344 3787.88 4224
+60.210016 3787.88 4224
+60.222688 3787.88 4224
+60.235360 3787.88 4224
+60.248032 3787.88 4224
+60.260608 3816.79 4192
+60.273184 3816.79 4192
+60.285760 3816.79 4192
+60.298336 3816.79 4192
+60.310912 3816.79 4192
+60.323488 3816.79 4192
+60.336064 3816.79 4192
+60.348640 3816.79 4192
+60.361216 3816.79 4192
+60.373792 3816.79 4192
+60.386368 3816.79 4192
+60.398944 3816.79 4192
+60.411520 3816.79 4192
+60.424096 3816.79 4192
+60.436672 3816.79 4192
+60.449248 3816.79 4192
+60.461824 3816.79 4192
+60.474400 3816.79 4192
+60.486976 3816.79 4192
+60.499552 3816.79 4192
+60.512128 3816.79 4192
+60.524704 3816.79 4192
+60.537280 3816.79 4192
+60.549856 3816.79 4192
+60.562432 3816.79 4192
+60.575008 3816.79 4192
+60.587584 3816.79 4192
+60.600160 3816.79 4192
+60.612736 3816.79 4192
+60.625312 3816.79 4192
+60.637888 3816.79 4192
+60.650464 3816.79 4192
+60.662944 3846.15 4160
+60.675424 3846.15 4160
+60.687904 3846.15 4160
+60.700384 3846.15 4160
+60.712864 3846.15 4160
+60.725344 3846.15 4160
+60.737824 3846.15 4160
+60.750304 3846.15 4160
+60.762784 3846.15 4160
+60.775264 3846.15 4160
+60.787744 3846.15 4160
+60.800224 3846.15 4160
+60.812704 3846.15 4160
+60.825184 3846.15 4160
+60.837664 3846.15 4160
+60.850144 3846.15 4160
+60.862624 3846.15 4160
+60.875104 3846.15 4160
+60.887584 3846.15 4160
+60.900064 3846.15 4160
+60.912544 3846.15 4160
+60.924928 3875.97 4128
+60.937312 3875.97 4128
+60.949696 3875.97 4128
+60.962080 3875.97 4128
+60.974464 3875.97 4128
+60.986848 3875.97 4128
+60.999232 3875.97 4128
+61.011616 3875.97 4128
+61.024000 3875.97 4128
+61.036384 3875.97 4128
+61.048768 3875.97 4128
+61.061152 3875.97 4128
+61.073536 3875.97 4128
+61.085920 3875.97 4128
+61.098304 3875.97 4128
+61.110688 3875.97 4128
+61.123072 3875.97 4128
+61.135456 3875.97 4128
+61.147840 3875.97 4128
+61.160224 3875.97 4128
+61.172608 3875.97 4128
+61.184992 3875.97 4128
+61.197376 3875.97 4128
+61.209760 3875.97 4128
+61.222144 3875.97 4128
+61.234528 3875.97 4128
+61.246912 3875.97 4128
+61.259296 3875.97 4128
+61.271680 3875.97 4128
+61.284064 3875.97 4128
+61.296448 3875.97 4128
+61.308832 3875.97 4128
+61.321216 3875.97 4128
+61.333600 3875.97 4128
+61.345984 3875.97 4128
+61.358368 3875.97 4128
+61.370752 3875.97 4128
+61.383136 3875.97 4128
+61.395520 3875.97 4128
+61.407904 3875.97 4128
+61.420288 3875.97 4128
+61.432672 3875.97 4128
+61.445056 3875.97 4128
+61.457440 3875.97 4128
+61.469824 3875.97 4128
+61.482208 3875.97 4128
+61.494592 3875.97 4128
+61.506976 3875.97 4128
+61.519360 3875.97 4128
+61.531744 3875.97 4128
+61.544128 3875.97 4128
+61.556512 3875.97 4128
+61.568896 3875.97 4128
+61.581280 3875.97 4128
+61.593568 3906.25 4096
+61.605856 3906.25 4096
+61.618144 3906.25 4096
+61.630432 3906.25 4096
+61.642720 3906.25 4096
+61.655008 3906.25 4096
+61.667296 3906.25 4096
+61.679584 3906.25 4096
+61.691872 3906.25 4096
+61.704160 3906.25 4096
+61.716448 3906.25 4096
+61.728736 3906.25 4096
+61.741024 3906.25 4096
+61.753312 3906.25 4096
+61.765600 3906.25 4096
+61.777888 3906.25 4096
+61.790176 3906.25 4096
+61.802464 3906.25 4096
+61.814752 3906.25 4096
+61.827040 3906.25 4096
+61.839328 3906.25 4096
+61.851616 3906.25 4096
+61.863904 3906.25 4096
+61.876192 3906.25 4096
+61.888480 3906.25 4096
+61.900768 3906.25 4096
+61.913056 3906.25 4096
+61.925344 3906.25 4096
+61.937632 3906.25 4096
+61.949920 3906.25 4096
+61.962208 3906.25 4096
+61.974496 3906.25 4096
+61.986736 3921.57 4080
+61.998976 3921.57 4080
+62.011216 3921.57 4080
+62.023456 3921.57 4080
+62.035696 3921.57 4080
+62.047936 3921.57 4080
+62.060176 3921.57 4080
+62.072416 3921.57 4080
+62.084656 3921.57 4080
+62.096896 3921.57 4080
+62.109136 3921.57 4080
+62.121376 3921.57 4080
+62.133616 3921.57 4080
+62.145856 3921.57 4080
+62.158096 3921.57 4080
+62.170336 3921.57 4080
+62.182576 3921.57 4080
+62.194816 3921.57 4080
+62.207056 3921.57 4080
+62.219296 3921.57 4080
+62.231536 3921.57 4080
+62.243728 3937.01 4064
+62.255920 3937.01 4064
+62.268112 3937.01 4064
+62.280304 3937.01 4064
+62.292496 3937.01 4064
+62.304688 3937.01 4064
+62.316880 3937.01 4064
+62.329072 3937.01 4064
+62.341264 3937.01 4064
+62.353456 3937.01 4064
+62.365648 3937.01 4064
+62.377840 3937.01 4064
+62.390032 3937.01 4064
+62.402224 3937.01 4064
+62.414416 3937.01 4064
+62.426608 3937.01 4064
+62.438800 3937.01 4064
+62.450992 3937.01 4064
+62.463184 3937.01 4064
+62.475376 3937.01 4064
+62.487568 3937.01 4064
+62.499760 3937.01 4064
+62.511952 3937.01 4064
+62.524144 3937.01 4064
+62.536336 3937.01 4064
+62.548528 3937.01 4064
+62.560720 3937.01 4064
+62.572912 3937.01 4064
+62.585104 3937.01 4064
+62.597296 3937.01 4064
+62.609488 3937.01 4064
+62.621680 3937.01 4064
+62.633776 3968.25 4032
+62.645872 3968.25 4032
+62.657968 3968.25 4032
+62.670064 3968.25 4032
+62.682160 3968.25 4032
+62.694256 3968.25 4032
+62.706352 3968.25 4032
+62.718448 3968.25 4032
+62.730544 3968.25 4032
+62.742640 3968.25 4032
+62.754736 3968.25 4032
+62.766832 3968.25 4032
+62.778928 3968.25 4032
+62.791024 3968.25 4032
+62.803120 3968.25 4032
+62.815216 3968.25 4032
+62.827312 3968.25 4032
+62.839408 3968.25 4032
+62.851504 3968.25 4032
+62.863600 3968.25 4032
+62.875696 3968.25 4032
+62.887792 3968.25 4032
+62.899888 3968.25 4032
+62.911984 3968.25 4032
+62.924080 3968.25 4032
+62.936176 3968.25 4032
+62.948272 3968.25 4032
+62.960368 3968.25 4032
+62.972464 3968.25 4032
+62.984560 3968.25 4032
+62.996656 3968.25 4032
+63.008752 3968.25 4032
+63.020800 3984.06 4016
+63.032848 3984.06 4016
+63.044896 3984.06 4016
+63.056944 3984.06 4016
+63.068992 3984.06 4016
+63.081040 3984.06 4016
+63.093088 3984.06 4016
+63.105136 3984.06 4016
+63.117184 3984.06 4016
+63.129232 3984.06 4016
+63.141280 3984.06 4016
+63.153328 3984.06 4016
+63.165376 3984.06 4016
+63.177424 3984.06 4016
+63.189472 3984.06 4016
+63.201520 3984.06 4016
+63.213568 3984.06 4016
+63.225616 3984.06 4016
+63.237664 3984.06 4016
+63.249712 3984.06 4016
+63.261760 3984.06 4016
+63.273760 4000.00 4000
+63.433760 4000.00 4000
+63.593760 4000.00 4000
+63.753760 4000.00 4000
+63.913760 4000.00 4000
+64.073760 4000.00 4000
+64.233760 4000.00 4000
+64.393760 4000.00 4000
+64.553760 4000.00 4000
+64.713760 4000.00 4000
+64.873760 4000.00 4000
+65.033760 4000.00 4000
+65.193760 4000.00 4000
+65.353760 4000.00 4000
+65.513760 4000.00 4000
+65.673760 4000.00 4000
+65.833760 4000.00 4000
+65.993760 4000.00 4000
+66.153760 4000.00 4000
+66.313760 4000.00 4000
+66.473760 4000.00 4000
+66.633760 4000.00 4000
+66.793760 4000.00 4000
+66.953760 4000.00 4000
+67.113760 4000.00 4000
+67.273760 4000.00 4000
+67.433760 4000.00 4000
+67.593760 4000.00 4000
+67.753760 4000.00 4000
+67.913760 4000.00 4000
+68.073760 4000.00 4000
+68.233760 4000.00 4000
+68.393760 4000.00 4000
+68.553760 4000.00 4000
+68.713760 4000.00 4000
+68.873760 4000.00 4000
+69.033760 4000.00 4000
+69.193760 4000.00 4000
+69.353760 4000.00 4000
+69.513760 4000.00 4000
+69.673760 4000.00 4000
+69.833760 4000.00 4000
+69.993760 4000.00 4000
+70.153760 4000.00 4000
+70.313760 4000.00 4000
+70.473760 4000.00 4000
+70.633760 4000.00 4000
+70.793760 4000.00 4000
+70.953760 4000.00 4000
+71.113760 4000.00 4000
+71.273760 4000.00 4000
+71.433760 4000.00 4000
+71.593760 4000.00 4000
+71.753760 4000.00 4000
+71.913760 4000.00 4000
+72.073760 4000.00 4000
+72.233760 4000.00 4000
+72.393760 4000.00 4000
+72.553760 4000.00 4000
+72.713760 4000.00 4000
+72.873760 4000.00 4000
+73.033760 4000.00 4000
+73.193760 4000.00 4000
+73.353760 4000.00 4000
+73.513760 4000.00 4000
+73.673760 4000.00 4000
+73.833760 4000.00 4000
+73.993760 4000.00 4000
+74.153760 4000.00 4000
+74.313760 4000.00 4000
+74.473760 4000.00 4000
+74.633760 4000.00 4000
+74.793760 4000.00 4000
+74.953760 4000.00 4000
+75.113760 4000.00 4000
+75.273760 4000.00 4000
+75.433760 4000.00 4000
+75.593760 4000.00 4000
+75.753760 4000.00 4000
+75.913760 4000.00 4000
+76.073760 4000.00 4000
+76.233760 4000.00 4000
+76.393760 4000.00 4000
+76.553760 4000.00 4000
+76.713760 4000.00 4000
+76.873760 4000.00 4000
+77.033760 4000.00 4000
+77.193760 4000.00 4000
+77.353760 4000.00 4000
+77.513760 4000.00 4000
+77.673760 4000.00 4000
+77.833760 4000.00 4000
+77.993760 4000.00 4000
+78.153760 4000.00 4000
+78.313760 4000.00 4000
+78.473760 4000.00 4000
+78.633760 4000.00 4000
+78.793760 4000.00 4000
+78.953760 4000.00 4000
+79.113760 4000.00 4000
+79.273760 4000.00 4000
+79.433760 4000.00 4000
+79.593760 4000.00 4000
+79.753760 4000.00 4000
+79.913760 4000.00 4000
+80.073760 4000.00 4000
+80.233760 4000.00 4000
+80.393760 4000.00 4000
+80.553760 4000.00 4000
+80.713760 4000.00 4000
+80.873760 4000.00 4000
+81.033760 4000.00 4000
+81.193760 4000.00 4000
+81.353760 4000.00 4000
+81.513760 4000.00 4000
+81.673760 4000.00 4000
+81.833760 4000.00 4000
+81.993760 4000.00 4000
+82.153760 4000.00 4000
+82.313760 4000.00 4000
+82.473760 4000.00 4000
+82.633760 4000.00 4000
+82.793760 4000.00 4000
+82.953760 4000.00 4000
+83.113760 4000.00 4000
+83.273760 4000.00 4000
+83.433760 4000.00 4000
+83.593760 4000.00 4000
+83.753760 4000.00 4000
+83.913760 4000.00 4000
+84.073760 4000.00 4000
+84.233760 4000.00 4000
+84.393760 4000.00 4000
+84.553760 4000.00 4000
+84.713760 4000.00 4000
+84.873760 4000.00 4000
+85.033760 4000.00 4000
+85.193760 4000.00 4000
+85.353760 4000.00 4000
+85.513760 4000.00 4000
+85.673760 4000.00 4000
+85.833760 4000.00 4000
+85.993760 4000.00 4000
+86.153760 4000.00 4000
+86.313760 4000.00 4000
+86.473760 4000.00 4000
+86.633760 4000.00 4000
+86.793760 4000.00 4000
+86.953760 4000.00 4000
+87.113760 4000.00 4000
+87.273760 4000.00 4000
+87.433760 4000.00 4000
+87.593760 4000.00 4000
+87.753760 4000.00 4000
+87.913760 4000.00 4000
+88.073760 4000.00 4000
+88.233760 4000.00 4000
+88.393760 4000.00 4000
+88.553760 4000.00 4000
+88.713760 4000.00 4000
+88.873760 4000.00 4000
+89.033760 4000.00 4000
+89.193760 4000.00 4000
+89.353760 4000.00 4000
+89.513760 4000.00 4000
+89.673760 4000.00 4000
+89.833760 4000.00 4000
+89.993760 4000.00 4000
+90.153760 4000.00 4000
+90.313760 4000.00 4000
+90.473760 4000.00 4000
+90.633760 4000.00 4000
+90.793760 4000.00 4000
+90.953760 4000.00 4000
+91.113760 4000.00 4000
+91.273760 4000.00 4000
+91.433760 4000.00 4000
+91.593760 4000.00 4000
+91.753760 4000.00 4000
+91.913760 4000.00 4000
+92.073760 4000.00 4000
+92.233760 4000.00 4000
+92.393760 4000.00 4000
+92.553760 4000.00 4000
+92.713760 4000.00 4000
+92.873760 4000.00 4000
+93.033760 4000.00 4000
+93.193760 4000.00 4000
+93.353760 4000.00 4000
+93.513760 4000.00 4000
+93.673760 4000.00 4000
+93.833760 4000.00 4000
+93.993760 4000.00 4000
+94.153760 4000.00 4000
+94.313760 4000.00 4000
+94.473760 4000.00 4000
+94.633760 4000.00 4000
+94.793760 4000.00 4000
+94.953760 4000.00 4000
+95.113760 4000.00 4000
+95.273760 4000.00 4000
+95.433760 4000.00 4000
+95.593760 4000.00 4000
+95.753760 4000.00 4000
+95.913760 4000.00 4000
+96.073760 4000.00 4000
+96.233760 4000.00 4000
+96.393760 4000.00 4000
+96.553760 4000.00 4000
+96.713760 4000.00 4000
+96.873760 4000.00 4000
+97.033760 4000.00 4000
+97.193760 4000.00 4000
+97.353760 4000.00 4000
+97.513760 4000.00 4000
+97.673760 4000.00 4000
+97.833760 4000.00 4000
+97.993760 4000.00 4000
+98.153760 4000.00 4000
+98.313760 4000.00 4000
+98.473760 4000.00 4000
+98.633760 4000.00 4000
+98.793760 4000.00 4000
+98.953760 4000.00 4000
+99.113760 4000.00 4000
+99.273760 4000.00 4000
+99.433760 4000.00 4000
+99.593760 4000.00 4000
+99.753760 4000.00 4000
+99.913760 4000.00 4000
+100.073760 4000.00 4000
+100.233760 4000.00 4000
+100.393760 4000.00 4000
+100.553760 4000.00 4000
+100.713760 4000.00 4000
+100.873760 4000.00 4000
+101.033760 4000.00 4000
+101.193760 4000.00 4000
+101.353760 4000.00 4000
+101.513760 4000.00 4000
+101.673760 4000.00 4000
+101.833760 4000.00 4000
+101.993760 4000.00 4000
+102.153760 4000.00 4000
+102.313760 4000.00 4000
+102.473760 4000.00 4000
+102.633760 4000.00 4000
+102.793760 4000.00 4000
+102.953760 4000.00 4000
+103.113760 4000.00 4000
+103.273760 4000.00 4000
+103.433760 4000.00 4000
+103.593760 4000.00 4000
+103.753760 4000.00 4000
+103.913760 4000.00 4000
+104.073760 4000.00 4000
+104.233760 4000.00 4000
+104.393760 4000.00 4000
+104.553760 4000.00 4000
+104.713760 4000.00 4000
+104.873760 4000.00 4000
+105.033760 4000.00 4000
+105.193760 4000.00 4000
+105.353760 4000.00 4000
+105.513760 4000.00 4000
+105.673760 4000.00 4000
+105.833760 4000.00 4000
+105.993760 4000.00 4000
+106.153760 4000.00 4000
+106.313760 4000.00 4000
+106.473760 4000.00 4000
+106.633760 4000.00 4000
+106.793760 4000.00 4000
+106.953760 4000.00 4000
+107.113760 4000.00 4000
+107.273760 4000.00 4000
+107.433760 4000.00 4000
+107.593760 4000.00 4000
+107.753760 4000.00 4000
+107.913760 4000.00 4000
+108.073760 4000.00 4000
+108.233760 4000.00 4000
+108.393760 4000.00 4000
+108.553760 4000.00 4000
+108.713760 4000.00 4000
+108.873760 4000.00 4000
+109.033760 4000.00 4000
+109.193760 4000.00 4000
+109.353760 4000.00 4000
+109.513760 4000.00 4000
+109.673760 4000.00 4000
+109.833760 4000.00 4000
+109.993760 4000.00 4000
+110.153760 4000.00 4000
+110.313760 4000.00 4000
+110.473760 4000.00 4000
+110.633760 4000.00 4000
+110.793760 4000.00 4000
+110.953760 4000.00 4000
+111.113760 4000.00 4000
+111.273760 4000.00 4000
+111.433760 4000.00 4000
+111.593760 4000.00 4000
+111.753760 4000.00 4000
+111.913760 4000.00 4000
+112.073760 4000.00 4000
+112.233760 4000.00 4000
+112.393760 4000.00 4000
+112.553760 4000.00 4000
+112.713760 4000.00 4000
+112.873760 4000.00 4000
+113.033760 4000.00 4000
+113.193760 4000.00 4000
+113.353760 4000.00 4000
+113.513760 4000.00 4000
+113.673760 4000.00 4000
+113.833760 4000.00 4000
+113.993760 4000.00 4000
+114.153760 4000.00 4000
+114.313760 4000.00 4000
+114.473760 4000.00 4000
+114.633760 4000.00 4000
+114.793760 4000.00 4000
+114.953760 4000.00 4000
+115.113760 4000.00 4000
+115.273760 4000.00 4000
+115.433760 4000.00 4000
+115.593760 4000.00 4000
+115.753760 4000.00 4000
+115.913760 4000.00 4000
+116.073760 4000.00 4000
+116.233760 4000.00 4000
+116.393760 4000.00 4000
+116.553760 4000.00 4000
+116.713760 4000.00 4000
+116.873760 4000.00 4000
+117.033760 4000.00 4000
+117.193760 4000.00 4000
+117.353760 4000.00 4000
+117.513760 4000.00 4000
+117.673760 4000.00 4000
+117.833760 4000.00 4000
+117.993760 4000.00 4000
+118.153760 4000.00 4000
+118.313760 4000.00 4000
+118.473760 4000.00 4000
+118.633760 4000.00 4000
+118.793760 4000.00 4000
+118.953760 4000.00 4000
+119.113760 4000.00 4000
+119.273760 4000.00 4000
+119.433760 4000.00 4000
+119.593760 4000.00 4000
+119.753760 4000.00 4000
+119.913760 4000.00 4000
+120.073760 4000.00 4000
+120.233760 4000.00 4000
+120.393760 4000.00 4000
+120.553760 4000.00 4000
+120.713760 4000.00 4000
+120.873760 4000.00 4000
+121.033760 4000.00 4000
+121.193760 4000.00 4000
+121.353760 4000.00 4000
+121.513760 4000.00 4000
+121.673760 4000.00 4000
+121.833760 4000.00 4000
+121.993760 4000.00 4000
+122.153760 4000.00 4000
+122.313760 4000.00 4000
+122.473760 4000.00 4000
+122.633760 4000.00 4000
+122.793760 4000.00 4000
+122.953760 4000.00 4000
+123.113760 4000.00 4000
+123.273760 4000.00 4000
+123.433760 4000.00 4000
+123.593760 4000.00 4000
+123.753760 4000.00 4000
+123.913760 4000.00 4000
+124.073760 4000.00 4000
+124.233760 4000.00 4000
+124.393760 4000.00 4000
+124.553760 4000.00 4000
+124.713760 4000.00 4000
+124.873760 4000.00 4000
+125.033760 4000.00 4000
+125.193760 4000.00 4000
+125.353760 4000.00 4000
+125.513760 4000.00 4000
+125.673760 4000.00 4000
+125.833760 4000.00 4000
+125.993760 4000.00 4000
+126.153760 4000.00 4000
+126.313760 4000.00 4000
+126.473760 4000.00 4000
+126.633760 4000.00 4000
+126.793760 4000.00 4000
+126.953760 4000.00 4000
+127.113760 4000.00 4000
+127.273760 4000.00 4000
+127.433760 4000.00 4000
+127.593760 4000.00 4000
+127.753760 4000.00 4000
+127.913760 4000.00 4000
+128.073760 4000.00 4000
+128.233760 4000.00 4000
+128.393760 4000.00 4000
+128.553760 4000.00 4000
+128.713760 4000.00 4000
+128.873760 4000.00 4000
+129.033760 4000.00 4000
+129.193760 4000.00 4000
+129.353760 4000.00 4000
+129.513760 4000.00 4000
+129.673760 4000.00 4000
+129.833760 4000.00 4000
+129.993760 4000.00 4000
+130.153760 4000.00 4000
+130.313760 4000.00 4000
+130.473760 4000.00 4000
+130.633760 4000.00 4000
+130.793760 4000.00 4000
+130.953760 4000.00 4000
+131.113760 4000.00 4000
+131.273760 4000.00 4000
+131.433760 4000.00 4000
+131.593760 4000.00 4000
+131.753760 4000.00 4000
+131.913760 4000.00 4000
+132.073760 4000.00 4000
+132.233760 4000.00 4000
+132.393760 4000.00 4000
+132.553760 4000.00 4000
+132.713760 4000.00 4000
+132.873760 4000.00 4000
+133.033760 4000.00 4000
+133.193760 4000.00 4000
+133.353760 4000.00 4000
+133.513760 4000.00 4000
+133.673760 4000.00 4000
+133.833760 4000.00 4000
+133.993760 4000.00 4000
+134.153760 4000.00 4000
+134.313760 4000.00 4000
+134.473760 4000.00 4000
+134.633760 4000.00 4000
+134.793760 4000.00 4000
+134.953760 4000.00 4000
+135.113760 4000.00 4000
+135.273760 4000.00 4000
+135.433760 4000.00 4000
+135.593760 4000.00 4000
+135.753760 4000.00 4000
+135.913760 4000.00 4000
+136.073760 4000.00 4000
+136.233760 4000.00 4000
+136.393760 4000.00 4000
+136.553760 4000.00 4000
+136.713760 4000.00 4000
+136.873760 4000.00 4000
+137.033760 4000.00 4000
+137.193760 4000.00 4000
+137.353760 4000.00 4000
+137.513760 4000.00 4000
+137.673760 4000.00 4000
+137.833760 4000.00 4000
+137.993760 4000.00 4000
+138.153760 4000.00 4000
+138.313760 4000.00 4000
+138.473760 4000.00 4000
+138.633760 4000.00 4000
+138.793760 4000.00 4000
+138.953760 4000.00 4000
+139.113760 4000.00 4000
+139.273760 4000.00 4000
+139.433760 4000.00 4000
+139.593760 4000.00 4000
+139.753760 4000.00 4000
+139.913760 4000.00 4000
+140.073760 4000.00 4000
+140.233760 4000.00 4000
+140.393760 4000.00 4000
+140.553760 4000.00 4000
+140.713760 4000.00 4000
+140.873760 4000.00 4000
+141.033760 4000.00 4000
+141.193760 4000.00 4000
+141.353760 4000.00 4000
+141.513760 4000.00 4000
+141.673760 4000.00 4000
+141.833760 4000.00 4000
+141.993760 4000.00 4000
+142.153760 4000.00 4000
+142.313760 4000.00 4000
+142.473760 4000.00 4000
+142.633760 4000.00 4000
+142.793760 4000.00 4000
+142.953760 4000.00 4000
+143.113760 4000.00 4000
+143.273760 4000.00 4000
+143.433760 4000.00 4000
+143.593760 4000.00 4000
+143.753760 4000.00 4000
+143.913760 4000.00 4000
+144.073760 4000.00 4000
+144.233760 4000.00 4000
+144.393760 4000.00 4000
+144.553760 4000.00 4000
+144.713760 4000.00 4000
+144.873760 4000.00 4000
+145.033760 4000.00 4000
+145.193760 4000.00 4000
+145.353760 4000.00 4000
+145.513760 4000.00 4000
+145.673760 4000.00 4000
+145.833760 4000.00 4000
+145.993760 4000.00 4000
+146.153760 4000.00 4000
+146.313760 4000.00 4000
+146.473760 4000.00 4000
+146.633760 4000.00 4000
+146.793760 4000.00 4000
+146.953760 4000.00 4000
+147.113760 4000.00 4000
+147.273760 4000.00 4000
+147.433760 4000.00 4000
+147.593760 4000.00 4000
+147.753760 4000.00 4000
+147.913760 4000.00 4000
+148.073760 4000.00 4000
+148.233760 4000.00 4000
+148.393760 4000.00 4000
+148.553760 4000.00 4000
+148.713760 4000.00 4000
+148.873760 4000.00 4000
+149.033760 4000.00 4000
+149.193760 4000.00 4000
+149.353760 4000.00 4000
+149.513760 4000.00 4000
+149.673760 4000.00 4000
+149.833760 4000.00 4000
+149.993760 4000.00 4000
+150.153760 4000.00 4000
+150.313760 4000.00 4000
+150.473760 4000.00 4000
+150.633760 4000.00 4000
+150.793760 4000.00 4000
+150.953760 4000.00 4000
+151.113760 4000.00 4000
+151.273760 4000.00 4000
+151.433760 4000.00 4000
+151.593760 4000.00 4000
+151.753760 4000.00 4000
+151.913760 4000.00 4000
+152.073760 4000.00 4000
+152.233760 4000.00 4000
+152.393760 4000.00 4000
+152.553760 4000.00 4000
+152.713760 4000.00 4000
+152.873760 4000.00 4000
+153.033760 4000.00 4000
+153.193760 4000.00 4000
+153.353760 4000.00 4000
+153.513760 4000.00 4000
+153.673760 4000.00 4000
+153.833760 4000.00 4000
+153.993760 4000.00 4000
+154.153760 4000.00 4000
+154.313760 4000.00 4000
+154.473760 4000.00 4000
+154.633760 4000.00 4000
+154.793760 4000.00 4000
+154.953760 4000.00 4000
+155.113760 4000.00 4000
+155.273760 4000.00 4000
+155.433760 4000.00 4000
+155.593760 4000.00 4000
+155.753760 4000.00 4000
+155.913760 4000.00 4000
+156.073760 4000.00 4000
+156.233760 4000.00 4000
+156.393760 4000.00 4000
+156.553760 4000.00 4000
+156.713760 4000.00 4000
+156.873760 4000.00 4000
+157.033760 4000.00 4000
+157.193760 4000.00 4000
+157.353760 4000.00 4000
+157.513760 4000.00 4000
+157.673760 4000.00 4000
+157.833760 4000.00 4000
+157.993760 4000.00 4000
+158.153760 4000.00 4000
+158.313760 4000.00 4000
+158.473760 4000.00 4000
+158.633760 4000.00 4000
+158.793760 4000.00 4000
+158.953760 4000.00 4000
+159.113760 4000.00 4000
+159.273760 4000.00 4000
+159.433760 4000.00 4000
+159.593760 4000.00 4000
+159.753760 4000.00 4000
+159.913760 4000.00 4000
+160.073760 4000.00 4000
+160.233760 4000.00 4000
+160.393760 4000.00 4000
+160.553760 4000.00 4000
+160.713760 4000.00 4000
+160.873760 4000.00 4000
+161.033760 4000.00 4000
+161.193760 4000.00 4000
+161.353760 4000.00 4000
+161.513760 4000.00 4000
+161.673760 4000.00 4000
+161.833760 4000.00 4000
+161.993760 4000.00 4000
+162.153760 4000.00 4000
+162.313760 4000.00 4000
+162.473760 4000.00 4000
+162.633760 4000.00 4000
+162.793760 4000.00 4000
+162.953760 4000.00 4000
+163.113760 4000.00 4000
+163.273760 4000.00 4000
+163.433760 4000.00 4000
+163.593760 4000.00 4000
+163.753760 4000.00 4000
+163.913760 4000.00 4000
+164.073760 4000.00 4000
+164.233760 4000.00 4000
+164.393760 4000.00 4000
+164.553760 4000.00 4000
+164.713760 4000.00 4000
+164.873760 4000.00 4000
+165.033760 4000.00 4000
+165.193760 4000.00 4000
+165.353760 4000.00 4000
+165.513760 4000.00 4000
+165.673760 4000.00 4000
+165.833760 4000.00 4000
+165.993760 4000.00 4000
+166.153760 4000.00 4000
+166.313760 4000.00 4000
+166.473760 4000.00 4000
+166.633760 4000.00 4000
+166.793760 4000.00 4000
+166.953760 4000.00 4000
+167.113760 4000.00 4000
+167.273760 4000.00 4000
+167.433760 4000.00 4000
+167.593760 4000.00 4000
+167.753760 4000.00 4000
+167.913760 4000.00 4000
+168.073760 4000.00 4000
+168.233760 4000.00 4000
+168.393760 4000.00 4000
+168.553760 4000.00 4000
+168.713760 4000.00 4000
+168.873760 4000.00 4000
+169.033760 4000.00 4000
+169.193760 4000.00 4000
+169.353760 4000.00 4000
+169.513760 4000.00 4000
+169.673760 4000.00 4000
+169.833760 4000.00 4000
+169.993760 4000.00 4000
+170.153760 4000.00 4000
+170.313760 4000.00 4000
+170.473760 4000.00 4000
+170.633760 4000.00 4000
+170.793760 4000.00 4000
+170.953760 4000.00 4000
+171.113760 4000.00 4000
+171.273760 4000.00 4000
+171.433760 4000.00 4000
+171.593760 4000.00 4000
+171.753760 4000.00 4000
+171.913760 4000.00 4000
+172.073760 4000.00 4000
+172.233760 4000.00 4000
+172.393760 4000.00 4000
+172.553760 4000.00 4000
+172.713760 4000.00 4000
+172.873760 4000.00 4000
+173.033760 4000.00 4000
+173.193760 4000.00 4000
+173.353760 4000.00 4000
+173.513760 4000.00 4000
+173.673760 4000.00 4000
+173.833760 4000.00 4000
+173.993760 4000.00 4000
+174.153760 4000.00 4000
+174.313760 4000.00 4000
+174.473760 4000.00 4000
+174.633760 4000.00 4000
+174.793760 4000.00 4000
+174.953760 4000.00 4000
+175.113760 4000.00 4000
+175.273760 4000.00 4000
+175.433760 4000.00 4000
+175.529760 4000.00 4000
+175.545824 3984.06 4016
+175.557872 3984.06 4016
+175.569920 3984.06 4016
+175.581968 3984.06 4016
+175.594016 3984.06 4016
+175.606064 3984.06 4016
+175.618112 3984.06 4016
+175.630160 3984.06 4016
+175.642208 3984.06 4016
+175.654256 3984.06 4016
+175.666304 3984.06 4016
+175.678352 3984.06 4016
+175.690400 3984.06 4016
+175.702448 3984.06 4016
+175.714496 3984.06 4016
+175.726544 3984.06 4016
+175.738592 3984.06 4016
+175.750640 3984.06 4016
+175.762688 3984.06 4016
+175.774736 3984.06 4016
+175.786784 3984.06 4016
+175.798880 3968.25 4032
+175.810976 3968.25 4032
+175.823072 3968.25 4032
+175.835168 3968.25 4032
+175.847264 3968.25 4032
+175.859360 3968.25 4032
+175.871456 3968.25 4032
+175.883552 3968.25 4032
+175.895648 3968.25 4032
+175.907744 3968.25 4032
+175.919840 3968.25 4032
+175.931936 3968.25 4032
+175.944032 3968.25 4032
+175.956128 3968.25 4032
+175.968224 3968.25 4032
+175.980320 3968.25 4032
+175.992416 3968.25 4032
+176.004512 3968.25 4032
+176.016608 3968.25 4032
+176.028704 3968.25 4032
+176.040800 3968.25 4032
+176.052896 3968.25 4032
+176.064992 3968.25 4032
+176.077088 3968.25 4032
+176.089184 3968.25 4032
+176.101280 3968.25 4032
+176.113376 3968.25 4032
+176.125472 3968.25 4032
+176.137568 3968.25 4032
+176.149664 3968.25 4032
+176.161760 3968.25 4032
+176.173856 3968.25 4032
+176.186048 3937.01 4064
+176.198240 3937.01 4064
+176.210432 3937.01 4064
+176.222624 3937.01 4064
+176.234816 3937.01 4064
+176.247008 3937.01 4064
+176.259200 3937.01 4064
+176.271392 3937.01 4064
+176.283584 3937.01 4064
+176.295776 3937.01 4064
+176.307968 3937.01 4064
+176.320160 3937.01 4064
+176.332352 3937.01 4064
+176.344544 3937.01 4064
+176.356736 3937.01 4064
+176.368928 3937.01 4064
+176.381120 3937.01 4064
+176.393312 3937.01 4064
+176.405504 3937.01 4064
+176.417696 3937.01 4064
+176.429888 3937.01 4064
+176.442080 3937.01 4064
+176.454272 3937.01 4064
+176.466464 3937.01 4064
+176.478656 3937.01 4064
+176.490848 3937.01 4064
+176.503040 3937.01 4064
+176.515232 3937.01 4064
+176.527424 3937.01 4064
+176.539616 3937.01 4064
+176.551808 3937.01 4064
+176.564000 3937.01 4064
+176.576240 3921.57 4080
+176.588480 3921.57 4080
+176.600720 3921.57 4080
+176.612960 3921.57 4080
+176.625200 3921.57 4080
+176.637440 3921.57 4080
+176.649680 3921.57 4080
+176.661920 3921.57 4080
+176.674160 3921.57 4080
+176.686400 3921.57 4080
+176.698640 3921.57 4080
+176.710880 3921.57 4080
+176.723120 3921.57 4080
+176.735360 3921.57 4080
+176.747600 3921.57 4080
+176.759840 3921.57 4080
+176.772080 3921.57 4080
+176.784320 3921.57 4080
+176.796560 3921.57 4080
+176.808800 3921.57 4080
+176.821040 3921.57 4080
+176.833328 3906.25 4096
+176.845616 3906.25 4096
+176.857904 3906.25 4096
+176.870192 3906.25 4096
+176.882480 3906.25 4096
+176.894768 3906.25 4096
+176.907056 3906.25 4096
+176.919344 3906.25 4096
+176.931632 3906.25 4096
+176.943920 3906.25 4096
+176.956208 3906.25 4096
+176.968496 3906.25 4096
+176.980784 3906.25 4096
+176.993072 3906.25 4096
+177.005360 3906.25 4096
+177.017648 3906.25 4096
+177.029936 3906.25 4096
+177.042224 3906.25 4096
+177.054512 3906.25 4096
+177.066800 3906.25 4096
+177.079088 3906.25 4096
+177.091376 3906.25 4096
+177.103664 3906.25 4096
+177.115952 3906.25 4096
+177.128240 3906.25 4096
+177.140528 3906.25 4096
+177.152816 3906.25 4096
+177.165104 3906.25 4096
+177.177392 3906.25 4096
+177.189680 3906.25 4096
+177.201968 3906.25 4096
+177.214256 3906.25 4096
+177.226640 3875.97 4128
+177.239024 3875.97 4128
+177.251408 3875.97 4128
+177.263792 3875.97 4128
+177.276176 3875.97 4128
+177.288560 3875.97 4128
+177.300944 3875.97 4128
+177.313328 3875.97 4128
+177.325712 3875.97 4128
+177.338096 3875.97 4128
+177.350480 3875.97 4128
+177.362864 3875.97 4128
+177.375248 3875.97 4128
+177.387632 3875.97 4128
+177.400016 3875.97 4128
+177.412400 3875.97 4128
+177.424784 3875.97 4128
+177.437168 3875.97 4128
+177.449552 3875.97 4128
+177.461936 3875.97 4128
+177.474320 3875.97 4128
+177.486704 3875.97 4128
+177.499088 3875.97 4128
+177.511472 3875.97 4128
+177.523856 3875.97 4128
+177.536240 3875.97 4128
+177.548624 3875.97 4128
+177.561008 3875.97 4128
+177.573392 3875.97 4128
+177.585776 3875.97 4128
+177.598160 3875.97 4128
+177.610544 3875.97 4128
+177.622928 3875.97 4128
+177.635312 3875.97 4128
+177.647696 3875.97 4128
+177.660080 3875.97 4128
+177.672464 3875.97 4128
+177.684848 3875.97 4128
+177.697232 3875.97 4128
+177.709616 3875.97 4128
+177.722000 3875.97 4128
+177.734384 3875.97 4128
+177.746768 3875.97 4128
+177.759152 3875.97 4128
+177.771536 3875.97 4128
+177.783920 3875.97 4128
+177.796304 3875.97 4128
+177.808688 3875.97 4128
+177.821072 3875.97 4128
+177.833456 3875.97 4128
+177.845840 3875.97 4128
+177.858224 3875.97 4128
+177.870608 3875.97 4128
+177.883088 3846.15 4160
+177.895568 3846.15 4160
+177.908048 3846.15 4160
+177.920528 3846.15 4160
+177.933008 3846.15 4160
+177.945488 3846.15 4160
+177.957968 3846.15 4160
+177.970448 3846.15 4160
+177.982928 3846.15 4160
+177.995408 3846.15 4160
+178.007888 3846.15 4160
+178.020368 3846.15 4160
+178.032848 3846.15 4160
+178.045328 3846.15 4160
+178.057808 3846.15 4160
+178.070288 3846.15 4160
+178.082768 3846.15 4160
+178.095248 3846.15 4160
+178.107728 3846.15 4160
+178.120208 3846.15 4160
+178.132688 3846.15 4160
+178.145168 3846.15 4160
+178.157744 3816.79 4192
+178.170320 3816.79 4192
+178.182896 3816.79 4192
+178.195472 3816.79 4192
+178.208048 3816.79 4192
+178.220624 3816.79 4192
+178.233200 3816.79 4192
+178.245776 3816.79 4192
+178.258352 3816.79 4192
+178.270928 3816.79 4192
+178.283504 3816.79 4192
+178.296080 3816.79 4192
+178.308656 3816.79 4192
+178.321232 3816.79 4192
+178.333808 3816.79 4192
+178.346384 3816.79 4192
+178.358960 3816.79 4192
+178.371536 3816.79 4192
+178.384112 3816.79 4192
+178.396688 3816.79 4192
+178.409264 3816.79 4192
+178.421840 3816.79 4192
+178.434416 3816.79 4192
+178.446992 3816.79 4192
+178.459568 3816.79 4192
+178.472144 3816.79 4192
+178.484720 3816.79 4192
+178.497296 3816.79 4192
+178.509872 3816.79 4192
+178.522448 3816.79 4192
+178.535024 3816.79 4192
+178.547600 3816.79 4192
+178.560272 3787.88 4224
+178.572944 3787.88 4224
+178.585616 3787.88 4224
+178.598288 3787.88 4224
+178.610960 3787.88 4224
+178.623632 3787.88 4224
+178.636304 3787.88 4224
+178.648976 3787.88 4224
+178.661648 3787.88 4224
+178.674320 3787.88 4224
+178.686992 3787.88 4224
+178.699664 3787.88 4224
+178.712336 3787.88 4224
+178.725008 3787.88 4224
+178.737680 3787.88 4224
+178.750352 3787.88 4224
+178.763024 3787.88 4224
+178.775696 3787.88 4224
+178.788368 3787.88 4224
+178.801040 3787.88 4224
+178.813712 3787.88 4224
+178.826384 3787.88 4224
+178.839056 3787.88 4224
+178.851728 3787.88 4224
+178.864400 3787.88 4224
+178.877072 3787.88 4224
+178.889744 3787.88 4224
+178.902416 3787.88 4224
+178.915088 3787.88 4224
+178.927760 3787.88 4224
+178.940432 3787.88 4224
+178.953104 3787.88 4224
+178.965776 3787.88 4224
+178.978448 3787.88 4224
+178.991120 3787.88 4224
+179.003792 3787.88 4224
+179.016464 3787.88 4224
+179.029136 3787.88 4224
+179.041808 3787.88 4224
+179.054480 3787.88 4224
+179.067152 3787.88 4224
+179.079824 3787.88 4224
+179.092496 3787.88 4224
+179.105168 3787.88 4224
+179.117840 3787.88 4224
+179.130512 3787.88 4224
+179.143184 3787.88 4224
+179.155856 3787.88 4224
+179.168528 3787.88 4224
+179.181200 3787.88 4224
+179.193872 3787.88 4224
+179.206544 3787.88 4224
+179.219216 3787.88 4224
+179.231984 3759.40 4256
+179.244752 3759.40 4256
+179.257520 3759.40 4256
+179.270288 3759.40 4256
+179.283056 3759.40 4256
+179.295824 3759.40 4256
+179.308592 3759.40 4256
+179.321360 3759.40 4256
+179.334128 3759.40 4256
+179.346896 3759.40 4256
+179.359664 3759.40 4256
+179.372432 3759.40 4256
+179.385200 3759.40 4256
+179.397968 3759.40 4256
+179.410736 3759.40 4256
+179.423504 3759.40 4256
+179.436272 3759.40 4256
+179.449040 3759.40 4256
+179.461808 3759.40 4256
+179.474576 3759.40 4256
+179.487344 3759.40 4256
+179.500208 3731.34 4288
+179.513072 3731.34 4288
+179.525936 3731.34 4288
+179.538800 3731.34 4288
+179.551664 3731.34 4288
+179.564528 3731.34 4288
+179.577392 3731.34 4288
+179.590256 3731.34 4288
+179.603120 3731.34 4288
+179.615984 3731.34 4288
+179.628848 3731.34 4288
+179.641712 3731.34 4288
+179.654576 3731.34 4288
+179.667440 3731.34 4288
+179.680304 3731.34 4288
+179.693168 3731.34 4288
+179.706032 3731.34 4288
+179.718896 3731.34 4288
+179.731760 3731.34 4288
+179.744624 3731.34 4288
+179.757488 3731.34 4288
+179.770352 3731.34 4288
+179.783312 3703.70 4320
+179.796272 3703.70 4320
+179.809232 3703.70 4320
+179.822192 3703.70 4320
+179.835152 3703.70 4320
+179.848112 3703.70 4320
+179.861072 3703.70 4320
+179.874032 3703.70 4320
+179.886992 3703.70 4320
+179.899952 3703.70 4320
+179.912912 3703.70 4320
+179.925872 3703.70 4320
+179.938832 3703.70 4320
+179.951792 3703.70 4320
+179.964752 3703.70 4320
+179.977712 3703.70 4320
+179.990672 3703.70 4320
+180.003632 3703.70 4320
+180.016592 3703.70 4320
+180.029552 3703.70 4320
+180.042512 3703.70 4320
+180.055472 3703.70 4320
+180.068432 3703.70 4320
+180.081392 3703.70 4320
+180.094352 3703.70 4320
+180.107312 3703.70 4320
+180.120272 3703.70 4320
+180.133232 3703.70 4320
+180.146192 3703.70 4320
+180.159152 3703.70 4320
+180.172112 3703.70 4320
+180.185072 3703.70 4320
+180.198032 3703.70 4320
+180.210992 3703.70 4320
+180.223952 3703.70 4320
+180.236912 3703.70 4320
+180.249872 3703.70 4320
+180.262832 3703.70 4320
+180.275792 3703.70 4320
+180.288752 3703.70 4320
+180.301712 3703.70 4320
+180.314672 3703.70 4320
+180.327632 3703.70 4320
+180.340592 3703.70 4320
+180.353552 3703.70 4320
+180.366512 3703.70 4320
+180.379472 3703.70 4320
+180.392432 3703.70 4320
+180.405392 3703.70 4320
+180.418352 3703.70 4320
+180.431312 3703.70 4320
+180.444272 3703.70 4320
+180.457232 3703.70 4320
+180.470288 3676.47 4352
+180.483344 3676.47 4352
+180.496400 3676.47 4352
+180.509456 3676.47 4352
+180.522512 3676.47 4352
+180.535568 3676.47 4352
+180.548624 3676.47 4352
+180.561680 3676.47 4352
+180.574736 3676.47 4352
+180.587792 3676.47 4352
+180.600848 3676.47 4352
+180.613904 3676.47 4352
+180.626960 3676.47 4352
+180.640016 3676.47 4352
+180.653072 3676.47 4352
+180.666128 3676.47 4352
+180.679184 3676.47 4352
+180.692240 3676.47 4352
+180.705296 3676.47 4352
+180.718352 3676.47 4352
+180.731408 3676.47 4352
+180.744560 3649.64 4384
+180.757712 3649.64 4384
+180.770864 3649.64 4384
+180.784016 3649.64 4384
+180.797168 3649.64 4384
+180.810320 3649.64 4384
+180.823472 3649.64 4384
+180.836624 3649.64 4384
+180.849776 3649.64 4384
+180.862928 3649.64 4384
+180.876080 3649.64 4384
+180.889232 3649.64 4384
+180.902384 3649.64 4384
+180.915536 3649.64 4384
+180.928688 3649.64 4384
+180.941840 3649.64 4384
+180.954992 3649.64 4384
+180.968144 3649.64 4384
+180.981296 3649.64 4384
+180.994448 3649.64 4384
+181.007600 3649.64 4384
+181.020752 3649.64 4384
+181.033904 3649.64 4384
+181.047056 3649.64 4384
+181.060208 3649.64 4384
+181.073360 3649.64 4384
+181.086512 3649.64 4384
+181.099664 3649.64 4384
+181.112816 3649.64 4384
+181.125968 3649.64 4384
+181.139120 3649.64 4384
+181.152272 3649.64 4384
+181.165424 3649.64 4384
+181.178576 3649.64 4384
+181.191728 3649.64 4384
+181.204880 3649.64 4384
+181.218032 3649.64 4384
+181.231184 3649.64 4384
+181.244336 3649.64 4384
+181.257488 3649.64 4384
+181.270640 3649.64 4384
+181.283792 3649.64 4384
+181.296944 3649.64 4384
+181.310096 3649.64 4384
+181.323248 3649.64 4384
+181.336400 3649.64 4384
+181.349552 3649.64 4384
+181.362704 3649.64 4384
+181.375856 3649.64 4384
+181.389008 3649.64 4384
+181.402160 3649.64 4384
+181.415312 3649.64 4384
+181.428464 3649.64 4384
+181.441616 3649.64 4384
+181.454864 3623.19 4416
+181.468112 3623.19 4416
+181.481360 3623.19 4416
+181.494608 3623.19 4416
+181.507856 3623.19 4416
+181.521104 3623.19 4416
+181.534352 3623.19 4416
+181.547600 3623.19 4416
+181.560848 3623.19 4416
+181.574096 3623.19 4416
+181.587344 3623.19 4416
+181.600592 3623.19 4416
+181.613840 3623.19 4416
+181.627088 3623.19 4416
+181.640336 3623.19 4416
+181.653584 3623.19 4416
+181.666832 3623.19 4416
+181.680080 3623.19 4416
+181.693328 3623.19 4416
+181.706576 3623.19 4416
+181.719824 3623.19 4416
+181.733168 3597.12 4448
+181.746512 3597.12 4448
+181.759856 3597.12 4448
+181.773200 3597.12 4448
+181.786544 3597.12 4448
+181.799888 3597.12 4448
+181.813232 3597.12 4448
+181.826576 3597.12 4448
+181.839920 3597.12 4448
+181.853264 3597.12 4448
+181.866608 3597.12 4448
+181.879952 3597.12 4448
+181.893296 3597.12 4448
+181.906640 3597.12 4448
+181.919984 3597.12 4448
+181.933328 3597.12 4448
+181.946672 3597.12 4448
+181.960016 3597.12 4448
+181.973360 3597.12 4448
+181.986704 3597.12 4448
+182.000048 3597.12 4448
+182.013488 3571.43 4480
+182.026928 3571.43 4480
+182.040368 3571.43 4480
+182.053808 3571.43 4480
+182.067248 3571.43 4480
+182.080688 3571.43 4480
+182.094128 3571.43 4480
+182.107568 3571.43 4480
+182.121008 3571.43 4480
+182.134448 3571.43 4480
+182.147888 3571.43 4480
+182.161328 3571.43 4480
+182.174768 3571.43 4480
+182.188208 3571.43 4480
+182.201648 3571.43 4480
+182.215088 3571.43 4480
+182.228528 3571.43 4480
+182.241968 3571.43 4480
+182.255408 3571.43 4480
+182.268848 3571.43 4480
+182.282288 3571.43 4480
+182.295728 3571.43 4480
+182.309168 3571.43 4480
+182.322608 3571.43 4480
+182.336048 3571.43 4480
+182.349488 3571.43 4480
+182.362928 3571.43 4480
+182.376368 3571.43 4480
+182.389808 3571.43 4480
+182.403248 3571.43 4480
+182.416688 3571.43 4480
+182.430128 3571.43 4480
+182.443568 3571.43 4480
+182.457008 3571.43 4480
+182.470448 3571.43 4480
+182.483888 3571.43 4480
+182.497328 3571.43 4480
+182.510768 3571.43 4480
+182.524208 3571.43 4480
+182.537648 3571.43 4480
+182.551088 3571.43 4480
+182.564528 3571.43 4480
+182.577968 3571.43 4480
+182.591504 3546.10 4512
+182.605040 3546.10 4512
+182.618576 3546.10 4512
+182.632112 3546.10 4512
+182.645648 3546.10 4512
+182.659184 3546.10 4512
+182.672720 3546.10 4512
+182.686256 3546.10 4512
+182.699792 3546.10 4512
+182.713328 3546.10 4512
+182.726864 3546.10 4512
+182.740400 3546.10 4512
+182.753936 3546.10 4512
+182.767472 3546.10 4512
+182.781008 3546.10 4512
+182.794544 3546.10 4512
+182.808080 3546.10 4512
+182.821616 3546.10 4512
+182.835152 3546.10 4512
+182.848688 3546.10 4512
+182.862224 3546.10 4512
+182.875760 3546.10 4512
+182.889296 3546.10 4512
+182.902832 3546.10 4512
+182.916368 3546.10 4512
+182.929904 3546.10 4512
+182.943440 3546.10 4512
+182.956976 3546.10 4512
+182.970512 3546.10 4512
+182.984048 3546.10 4512
+182.997584 3546.10 4512
+183.011120 3546.10 4512
+183.024752 3521.13 4544
+183.038384 3521.13 4544
+183.052016 3521.13 4544
+183.065648 3521.13 4544
+183.079280 3521.13 4544
+183.092912 3521.13 4544
+183.106544 3521.13 4544
+183.120176 3521.13 4544
+183.133808 3521.13 4544
+183.147440 3521.13 4544
+183.161072 3521.13 4544
+183.174704 3521.13 4544
+183.188336 3521.13 4544
+183.201968 3521.13 4544
+183.215600 3521.13 4544
+183.229232 3521.13 4544
+183.242864 3521.13 4544
+183.256496 3521.13 4544
+183.270128 3521.13 4544
+183.283760 3521.13 4544
+183.297392 3521.13 4544
+183.311120 3496.50 4576
+183.324848 3496.50 4576
+183.338576 3496.50 4576
+183.352304 3496.50 4576
+183.366032 3496.50 4576
+183.379760 3496.50 4576
+183.393488 3496.50 4576
+183.407216 3496.50 4576
+183.420944 3496.50 4576
+183.434672 3496.50 4576
+183.448400 3496.50 4576
+183.462128 3496.50 4576
+183.475856 3496.50 4576
+183.489584 3496.50 4576
+183.503312 3496.50 4576
+183.517040 3496.50 4576
+183.530768 3496.50 4576
+183.544496 3496.50 4576
+183.558224 3496.50 4576
+183.571952 3496.50 4576
+183.585680 3496.50 4576
+183.599408 3496.50 4576
+183.613232 3472.22 4608
+183.627056 3472.22 4608
+183.640880 3472.22 4608
+183.654704 3472.22 4608
+183.668528 3472.22 4608
+183.682352 3472.22 4608
+183.696176 3472.22 4608
+183.710000 3472.22 4608
+183.723824 3472.22 4608
+183.737648 3472.22 4608
+183.751472 3472.22 4608
+183.765296 3472.22 4608
+183.779120 3472.22 4608
+183.792944 3472.22 4608
+183.806768 3472.22 4608
+183.820592 3472.22 4608
+183.834416 3472.22 4608
+183.848240 3472.22 4608
+183.862064 3472.22 4608
+183.875888 3472.22 4608
+183.889712 3472.22 4608
+183.903536 3472.22 4608
+183.917360 3472.22 4608
+183.931184 3472.22 4608
+183.945008 3472.22 4608
+183.958832 3472.22 4608
+183.972656 3472.22 4608
+183.986480 3472.22 4608
+184.000304 3472.22 4608
+184.014128 3472.22 4608
+184.027952 3472.22 4608
+184.041776 3472.22 4608
+184.055600 3472.22 4608
+184.069424 3472.22 4608
+184.083248 3472.22 4608
+184.097072 3472.22 4608
+184.110896 3472.22 4608
+184.124720 3472.22 4608
+184.138544 3472.22 4608
+184.152368 3472.22 4608
+184.166192 3472.22 4608
+184.180016 3472.22 4608
+184.193936 3448.28 4640
+184.207856 3448.28 4640
+184.221776 3448.28 4640
+184.235696 3448.28 4640
+184.249616 3448.28 4640
+184.263536 3448.28 4640
+184.277456 3448.28 4640
+184.291376 3448.28 4640
+184.305296 3448.28 4640
+184.319216 3448.28 4640
+184.333136 3448.28 4640
+184.347056 3448.28 4640
+184.360976 3448.28 4640
+184.374896 3448.28 4640
+184.388816 3448.28 4640
+184.402736 3448.28 4640
+184.416656 3448.28 4640
+184.430576 3448.28 4640
+184.444496 3448.28 4640
+184.458416 3448.28 4640
+184.472336 3448.28 4640
+184.486256 3448.28 4640
+184.500272 3424.66 4672
+184.514288 3424.66 4672
+184.528304 3424.66 4672
+184.542320 3424.66 4672
+184.556336 3424.66 4672
+184.570352 3424.66 4672
+184.584368 3424.66 4672
+184.598384 3424.66 4672
+184.612400 3424.66 4672
+184.626416 3424.66 4672
+184.640432 3424.66 4672
+184.654448 3424.66 4672
+184.668464 3424.66 4672
+184.682480 3424.66 4672
+184.696496 3424.66 4672
+184.710512 3424.66 4672
+184.724528 3424.66 4672
+184.738544 3424.66 4672
+184.752560 3424.66 4672
+184.766576 3424.66 4672
+184.780592 3424.66 4672
+184.794704 3401.36 4704
+184.808816 3401.36 4704
+184.822928 3401.36 4704
+184.837040 3401.36 4704
+184.851152 3401.36 4704
+184.865264 3401.36 4704
+184.879376 3401.36 4704
+184.893488 3401.36 4704
+184.907600 3401.36 4704
+184.921712 3401.36 4704
+184.935824 3401.36 4704
+184.949936 3401.36 4704
+184.964048 3401.36 4704
+184.978160 3401.36 4704
+184.992272 3401.36 4704
+185.006384 3401.36 4704
+185.020496 3401.36 4704
+185.034608 3401.36 4704
+185.048720 3401.36 4704
+185.062832 3401.36 4704
+185.076944 3401.36 4704
+185.091056 3401.36 4704
+185.105168 3401.36 4704
+185.119280 3401.36 4704
+185.133392 3401.36 4704
+185.147504 3401.36 4704
+185.161616 3401.36 4704
+185.175728 3401.36 4704
+185.189840 3401.36 4704
+185.203952 3401.36 4704
+185.218064 3401.36 4704
+185.232176 3401.36 4704
+185.246288 3401.36 4704
+185.260400 3401.36 4704
+185.274512 3401.36 4704
+185.288624 3401.36 4704
+185.302736 3401.36 4704
+185.316848 3401.36 4704
+185.330960 3401.36 4704
+185.345072 3401.36 4704
+185.359184 3401.36 4704
+185.373296 3401.36 4704
+185.387408 3401.36 4704
+185.401616 3378.38 4736
+185.415824 3378.38 4736
+185.430032 3378.38 4736
+185.444240 3378.38 4736
+185.458448 3378.38 4736
+185.472656 3378.38 4736
+185.486864 3378.38 4736
+185.501072 3378.38 4736
+185.515280 3378.38 4736
+185.529488 3378.38 4736
+185.543696 3378.38 4736
+185.557904 3378.38 4736
+185.572112 3378.38 4736
+185.586320 3378.38 4736
+185.600528 3378.38 4736
+185.614736 3378.38 4736
+185.628944 3378.38 4736
+185.643152 3378.38 4736
+185.657360 3378.38 4736
+185.671568 3378.38 4736
+185.685776 3378.38 4736
+185.700080 3355.70 4768
+185.714384 3355.70 4768
+185.728688 3355.70 4768
+185.742992 3355.70 4768
+185.757296 3355.70 4768
+185.771600 3355.70 4768
+185.785904 3355.70 4768
+185.800208 3355.70 4768
+185.814512 3355.70 4768
+185.828816 3355.70 4768
+185.843120 3355.70 4768
+185.857520 3333.33 4800
+185.871920 3333.33 4800
+185.886320 3333.33 4800
+185.900720 3333.33 4800
+185.915120 3333.33 4800
+185.929520 3333.33 4800
+185.943920 3333.33 4800
+185.958320 3333.33 4800
+185.972720 3333.33 4800
+185.987120 3333.33 4800
+186.001520 3333.33 4800
+186.015920 3333.33 4800
+186.030320 3333.33 4800
+186.044720 3333.33 4800
+186.059120 3333.33 4800
+186.073520 3333.33 4800
+186.087920 3333.33 4800
+186.102320 3333.33 4800
+186.116720 3333.33 4800
+186.131120 3333.33 4800
+186.145520 3333.33 4800
+186.160016 3311.26 4832
+186.174512 3311.26 4832
+186.189008 3311.26 4832
+186.203504 3311.26 4832
+186.218000 3311.26 4832
+186.232496 3311.26 4832
+186.246992 3311.26 4832
+186.261488 3311.26 4832
+186.275984 3311.26 4832
+186.290480 3311.26 4832
+186.304976 3311.26 4832
+186.319472 3311.26 4832
+186.333968 3311.26 4832
+186.348464 3311.26 4832
+186.362960 3311.26 4832
+186.377456 3311.26 4832
+186.391952 3311.26 4832
+186.406448 3311.26 4832
+186.420944 3311.26 4832
+186.435440 3311.26 4832
+186.449936 3311.26 4832
+186.464528 3289.47 4864
+186.479120 3289.47 4864
+186.493712 3289.47 4864
+186.508304 3289.47 4864
+186.522896 3289.47 4864
+186.537488 3289.47 4864
+186.552080 3289.47 4864
+186.566672 3289.47 4864
+186.581264 3289.47 4864
+186.595856 3289.47 4864
+186.610448 3289.47 4864
+186.625040 3289.47 4864
+186.639632 3289.47 4864
+186.654224 3289.47 4864
+186.668816 3289.47 4864
+186.683408 3289.47 4864
+186.698000 3289.47 4864
+186.712592 3289.47 4864
+186.727184 3289.47 4864
+186.741776 3289.47 4864
+186.756368 3289.47 4864
+186.770960 3289.47 4864
+186.785552 3289.47 4864
+186.800144 3289.47 4864
+186.814736 3289.47 4864
+186.829328 3289.47 4864
+186.843920 3289.47 4864
+186.858512 3289.47 4864
+186.873104 3289.47 4864
+186.887696 3289.47 4864
+186.902288 3289.47 4864
+186.916880 3289.47 4864
+186.931472 3289.47 4864
+186.946064 3289.47 4864
+186.960656 3289.47 4864
+186.975248 3289.47 4864
+186.989840 3289.47 4864
+187.004432 3289.47 4864
+187.019024 3289.47 4864
+187.033616 3289.47 4864
+187.048208 3289.47 4864
+187.062800 3289.47 4864
+187.077392 3289.47 4864
+187.092080 3267.97 4896
+187.106768 3267.97 4896
+187.121456 3267.97 4896
+187.136144 3267.97 4896
+187.150832 3267.97 4896
+187.165520 3267.97 4896
+187.180208 3267.97 4896
+187.194896 3267.97 4896
+187.209584 3267.97 4896
+187.224272 3267.97 4896
+187.238960 3267.97 4896
+187.253648 3267.97 4896
+187.268336 3267.97 4896
+187.283024 3267.97 4896
+187.297712 3267.97 4896
+187.312400 3267.97 4896
+187.327088 3267.97 4896
+187.341776 3267.97 4896
+187.356464 3267.97 4896
+187.371152 3267.97 4896
+187.385840 3267.97 4896
+187.400624 3246.75 4928
+187.415408 3246.75 4928
+187.430192 3246.75 4928
+187.444976 3246.75 4928
+187.459760 3246.75 4928
+187.474544 3246.75 4928
+187.489328 3246.75 4928
+187.504112 3246.75 4928
+187.518896 3246.75 4928
+187.533680 3246.75 4928
+187.548464 3246.75 4928
+187.563344 3225.81 4960
+187.578224 3225.81 4960
+187.593104 3225.81 4960
+187.607984 3225.81 4960
+187.622864 3225.81 4960
+187.637744 3225.81 4960
+187.652624 3225.81 4960
+187.667504 3225.81 4960
+187.682384 3225.81 4960
+187.697264 3225.81 4960
+187.712144 3225.81 4960
+187.727024 3225.81 4960
+187.741904 3225.81 4960
+187.756784 3225.81 4960
+187.771664 3225.81 4960
+187.786544 3225.81 4960
+187.801424 3225.81 4960
+187.816304 3225.81 4960
+187.831184 3225.81 4960
+187.846064 3225.81 4960
+187.860944 3225.81 4960
+187.875920 3205.13 4992
+187.890896 3205.13 4992
+187.905872 3205.13 4992
+187.920848 3205.13 4992
+187.935824 3205.13 4992
+187.950800 3205.13 4992
+187.965776 3205.13 4992
+187.980752 3205.13 4992
+187.995728 3205.13 4992
+188.010704 3205.13 4992
+188.025680 3205.13 4992
+188.040656 3205.13 4992
+188.055632 3205.13 4992
+188.070608 3205.13 4992
+188.085584 3205.13 4992
+188.100560 3205.13 4992
+188.115536 3205.13 4992
+188.130512 3205.13 4992
+188.145488 3205.13 4992
+188.160464 3205.13 4992
+188.175440 3205.13 4992
+188.190416 3205.13 4992
+188.205488 3184.71 5024
+188.220560 3184.71 5024
+188.235632 3184.71 5024
+188.250704 3184.71 5024
+188.265776 3184.71 5024
+188.280848 3184.71 5024
+188.295920 3184.71 5024
+188.310992 3184.71 5024
+188.326064 3184.71 5024
+188.341136 3184.71 5024
+188.356208 3184.71 5024
+188.371280 3184.71 5024
+188.386352 3184.71 5024
+188.401424 3184.71 5024
+188.416496 3184.71 5024
+188.431568 3184.71 5024
+188.446640 3184.71 5024
+188.461712 3184.71 5024
+188.476784 3184.71 5024
+188.491856 3184.71 5024
+188.506928 3184.71 5024
+188.522000 3184.71 5024
+188.537072 3184.71 5024
+188.552144 3184.71 5024
+188.567216 3184.71 5024
+188.582288 3184.71 5024
+188.597360 3184.71 5024
+188.612432 3184.71 5024
+188.627504 3184.71 5024
+188.642576 3184.71 5024
+188.657648 3184.71 5024
+188.672720 3184.71 5024
+188.687888 3164.56 5056
+188.703056 3164.56 5056
+188.718224 3164.56 5056
+188.733392 3164.56 5056
+188.748560 3164.56 5056
+188.763728 3164.56 5056
+188.778896 3164.56 5056
+188.794064 3164.56 5056
+188.809232 3164.56 5056
+188.824400 3164.56 5056
+188.839568 3164.56 5056
+188.854736 3164.56 5056
+188.869904 3164.56 5056
+188.885072 3164.56 5056
+188.900240 3164.56 5056
+188.915408 3164.56 5056
+188.930576 3164.56 5056
+188.945744 3164.56 5056
+188.960912 3164.56 5056
+188.976080 3164.56 5056
+188.991248 3164.56 5056
+189.006512 3144.65 5088
+189.021776 3144.65 5088
+189.037040 3144.65 5088
+189.052304 3144.65 5088
+189.067568 3144.65 5088
+189.082832 3144.65 5088
+189.098096 3144.65 5088
+189.113360 3144.65 5088
+189.128624 3144.65 5088
+189.143888 3144.65 5088
+189.159152 3144.65 5088
+189.174416 3144.65 5088
+189.189680 3144.65 5088
+189.204944 3144.65 5088
+189.220208 3144.65 5088
+189.235472 3144.65 5088
+189.250736 3144.65 5088
+189.266000 3144.65 5088
+189.281264 3144.65 5088
+189.296528 3144.65 5088
+189.311792 3144.65 5088
+189.327152 3125.00 5120
+189.342512 3125.00 5120
+189.357872 3125.00 5120
+189.373232 3125.00 5120
+189.388592 3125.00 5120
+189.403952 3125.00 5120
+189.419312 3125.00 5120
+189.434672 3125.00 5120
+189.450032 3125.00 5120
+189.465392 3125.00 5120
+189.480752 3125.00 5120
+189.496208 3105.59 5152
+189.511664 3105.59 5152
+189.527120 3105.59 5152
+189.542576 3105.59 5152
+189.558032 3105.59 5152
+189.573488 3105.59 5152
+189.588944 3105.59 5152
+189.604400 3105.59 5152
+189.619856 3105.59 5152
+189.635312 3105.59 5152
+189.650768 3105.59 5152
+189.666224 3105.59 5152
+189.681680 3105.59 5152
+189.697136 3105.59 5152
+189.712592 3105.59 5152
+189.728048 3105.59 5152
+189.743504 3105.59 5152
+189.758960 3105.59 5152
+189.774416 3105.59 5152
+189.789872 3105.59 5152
+189.805328 3105.59 5152
+189.820880 3086.42 5184
+189.836432 3086.42 5184
+189.851984 3086.42 5184
+189.867536 3086.42 5184
+189.883088 3086.42 5184
+189.898640 3086.42 5184
+189.914192 3086.42 5184
+189.929744 3086.42 5184
+189.945296 3086.42 5184
+189.960848 3086.42 5184
+189.976400 3086.42 5184
+189.991952 3086.42 5184
+190.007504 3086.42 5184
+190.023056 3086.42 5184
+190.038608 3086.42 5184
+190.054160 3086.42 5184
+190.069712 3086.42 5184
+190.085264 3086.42 5184
+190.100816 3086.42 5184
+190.116368 3086.42 5184
+190.131920 3086.42 5184
+190.147472 3086.42 5184
+190.163120 3067.48 5216
+190.178768 3067.48 5216
+190.194416 3067.48 5216
+190.210064 3067.48 5216
+190.225712 3067.48 5216
+190.241360 3067.48 5216
+190.257008 3067.48 5216
+190.272656 3067.48 5216
+190.288304 3067.48 5216
+190.303952 3067.48 5216
+190.319600 3067.48 5216
+190.335248 3067.48 5216
+190.350896 3067.48 5216
+190.366544 3067.48 5216
+190.382192 3067.48 5216
+190.397840 3067.48 5216
+190.413488 3067.48 5216
+190.429136 3067.48 5216
+190.444784 3067.48 5216
+190.460432 3067.48 5216
+190.476080 3067.48 5216
+190.491728 3067.48 5216
+190.507376 3067.48 5216
+190.523024 3067.48 5216
+190.538672 3067.48 5216
+190.554320 3067.48 5216
+190.569968 3067.48 5216
+190.585616 3067.48 5216
+190.601264 3067.48 5216
+190.616912 3067.48 5216
+190.632560 3067.48 5216
+190.648208 3067.48 5216
+190.663952 3048.78 5248
+190.679696 3048.78 5248
+190.695440 3048.78 5248
+190.711184 3048.78 5248
+190.726928 3048.78 5248
+190.742672 3048.78 5248
+190.758416 3048.78 5248
+190.774160 3048.78 5248
+190.789904 3048.78 5248
+190.805648 3048.78 5248
+190.821488 3030.30 5280
+190.837328 3030.30 5280
+190.853168 3030.30 5280
+190.869008 3030.30 5280
+190.884848 3030.30 5280
+190.900688 3030.30 5280
+190.916528 3030.30 5280
+190.932368 3030.30 5280
+190.948208 3030.30 5280
+190.964048 3030.30 5280
+190.979888 3030.30 5280
+190.995728 3030.30 5280
+191.011568 3030.30 5280
+191.027408 3030.30 5280
+191.043248 3030.30 5280
+191.059088 3030.30 5280
+191.074928 3030.30 5280
+191.090768 3030.30 5280
+191.106608 3030.30 5280
+191.122448 3030.30 5280
+191.138288 3030.30 5280
+191.154128 3030.30 5280
+191.170064 3012.05 5312
+191.186000 3012.05 5312
+191.201936 3012.05 5312
+191.217872 3012.05 5312
+191.233808 3012.05 5312
+191.249744 3012.05 5312
+191.265680 3012.05 5312
+191.281616 3012.05 5312
+191.297552 3012.05 5312
+191.313488 3012.05 5312
+191.329520 2994.01 5344
+191.340208 2994.01 5344
+191.350896 2994.01 5344
+191.361584 2994.01 5344
+191.372272 2994.01 5344
+191.382960 2994.01 5344
+191.393648 2994.01 5344
+191.404336 2994.01 5344
+191.415024 2994.01 5344
+191.425712 2994.01 5344
+191.436400 2994.01 5344
+191.447088 2994.01 5344
+191.457776 2994.01 5344
+191.468464 2994.01 5344
+191.479152 2994.01 5344
+191.489840 2994.01 5344
+191.500528 2994.01 5344
+191.511216 2994.01 5344
+191.521904 2994.01 5344
+191.532592 2994.01 5344
+191.543280 2994.01 5344
+191.553968 2994.01 5344
+191.564656 2994.01 5344
+191.575344 2994.01 5344
+191.586032 2994.01 5344
+191.596720 2994.01 5344
+191.607408 2994.01 5344
+191.618096 2994.01 5344
+191.628784 2994.01 5344
+191.639472 2994.01 5344
+191.650160 2994.01 5344
+191.660848 2994.01 5344
+191.671600 2976.19 5376
+191.682352 2976.19 5376
+191.693104 2976.19 5376
+191.703856 2976.19 5376
+191.714608 2976.19 5376
+191.725360 2976.19 5376
+191.736112 2976.19 5376
+191.746864 2976.19 5376
+191.757616 2976.19 5376
+191.768368 2976.19 5376
+191.779120 2976.19 5376
+191.789872 2976.19 5376
+191.800624 2976.19 5376
+191.811376 2976.19 5376
+191.822128 2976.19 5376
+191.832880 2976.19 5376
+191.843696 2958.58 5408
+191.854512 2958.58 5408
+191.865328 2958.58 5408
+191.876144 2958.58 5408
+191.886960 2958.58 5408
+191.897776 2958.58 5408
+191.908592 2958.58 5408
+191.919408 2958.58 5408
+191.930224 2958.58 5408
+191.941040 2958.58 5408
+191.951856 2958.58 5408
+191.962672 2958.58 5408
+191.973488 2958.58 5408
+191.984304 2958.58 5408
+191.995120 2958.58 5408
+192.005936 2958.58 5408
+192.016752 2958.58 5408
+192.027568 2958.58 5408
+192.038384 2958.58 5408
+192.049200 2958.58 5408
+192.060016 2958.58 5408
+192.070832 2958.58 5408
+192.081648 2958.58 5408
+192.092464 2958.58 5408
+192.103280 2958.58 5408
+192.114096 2958.58 5408
+192.124912 2958.58 5408
+192.135728 2958.58 5408
+192.146544 2958.58 5408
+192.157360 2958.58 5408
+192.168176 2958.58 5408
+192.178992 2958.58 5408
+192.189872 2941.18 5440
+192.200752 2941.18 5440
+192.211632 2941.18 5440
+192.222512 2941.18 5440
+192.233392 2941.18 5440
+192.244272 2941.18 5440
+192.255152 2941.18 5440
+192.266032 2941.18 5440
+192.276912 2941.18 5440
+192.287792 2941.18 5440
+192.298672 2941.18 5440
+192.309552 2941.18 5440
+192.320432 2941.18 5440
+192.331312 2941.18 5440
+192.342192 2941.18 5440
+192.353072 2941.18 5440
+192.364016 2923.98 5472
+192.374960 2923.98 5472
+192.385904 2923.98 5472
+192.396848 2923.98 5472
+192.407792 2923.98 5472
+192.418736 2923.98 5472
+192.429680 2923.98 5472
+192.440624 2923.98 5472
+192.451568 2923.98 5472
+192.462512 2923.98 5472
+192.473456 2923.98 5472
+192.484400 2923.98 5472
+192.495344 2923.98 5472
+192.506288 2923.98 5472
+192.517232 2923.98 5472
+192.528176 2923.98 5472
+192.539120 2923.98 5472
+192.550064 2923.98 5472
+192.561008 2923.98 5472
+192.571952 2923.98 5472
+192.582896 2923.98 5472
+192.593840 2923.98 5472
+192.604784 2923.98 5472
+192.615728 2923.98 5472
+192.626672 2923.98 5472
+192.637616 2923.98 5472
+192.648560 2923.98 5472
+192.659504 2923.98 5472
+192.670448 2923.98 5472
+192.681392 2923.98 5472
+192.692336 2923.98 5472
+192.703280 2923.98 5472
+192.714288 2906.98 5504
+192.725296 2906.98 5504
+192.736304 2906.98 5504
+192.747312 2906.98 5504
+192.758320 2906.98 5504
+192.769328 2906.98 5504
+192.780336 2906.98 5504
+192.791344 2906.98 5504
+192.802352 2906.98 5504
+192.813360 2906.98 5504
+192.824368 2906.98 5504
+192.835376 2906.98 5504
+192.846384 2906.98 5504
+192.857392 2906.98 5504
+192.868400 2906.98 5504
+192.879408 2906.98 5504
+192.890480 2890.17 5536
+192.901552 2890.17 5536
+192.912624 2890.17 5536
+192.923696 2890.17 5536
+192.934768 2890.17 5536
+192.945840 2890.17 5536
+192.956912 2890.17 5536
+192.967984 2890.17 5536
+192.979056 2890.17 5536
+192.990128 2890.17 5536
+193.001200 2890.17 5536
+193.012272 2890.17 5536
+193.023344 2890.17 5536
+193.034416 2890.17 5536
+193.045488 2890.17 5536
+193.056560 2890.17 5536
+193.067632 2890.17 5536
+193.078704 2890.17 5536
+193.089776 2890.17 5536
+193.100848 2890.17 5536
+193.111920 2890.17 5536
+193.122992 2890.17 5536
+193.134064 2890.17 5536
+193.145136 2890.17 5536
+193.156208 2890.17 5536
+193.167280 2890.17 5536
+193.178352 2890.17 5536
+193.189424 2890.17 5536
+193.200496 2890.17 5536
+193.211568 2890.17 5536
+193.222640 2890.17 5536
+193.233712 2890.17 5536
+193.244848 2873.56 5568
+193.255984 2873.56 5568
+193.267120 2873.56 5568
+193.278256 2873.56 5568
+193.289392 2873.56 5568
+193.300528 2873.56 5568
+193.311664 2873.56 5568
+193.322800 2873.56 5568
+193.333936 2873.56 5568
+193.345072 2873.56 5568
+193.356208 2873.56 5568
+193.367344 2873.56 5568
+193.378480 2873.56 5568
+193.389616 2873.56 5568
+193.400752 2873.56 5568
+193.411888 2873.56 5568
+193.423024 2873.56 5568
+193.434160 2873.56 5568
+193.445296 2873.56 5568
+193.456432 2873.56 5568
+193.467568 2873.56 5568
+193.478704 2873.56 5568
+193.489840 2873.56 5568
+193.500976 2873.56 5568
+193.512112 2873.56 5568
+193.523248 2873.56 5568
+193.534384 2873.56 5568
+193.545520 2873.56 5568
+193.556656 2873.56 5568
+193.567792 2873.56 5568
+193.578928 2873.56 5568
+193.590064 2873.56 5568
+193.601200 2873.56 5568
+193.612336 2873.56 5568
+193.623472 2873.56 5568
+193.634608 2873.56 5568
+193.645744 2873.56 5568
+193.656880 2873.56 5568
+193.668016 2873.56 5568
+193.679152 2873.56 5568
+193.690352 2857.14 5600
+193.701552 2857.14 5600
+193.712752 2857.14 5600
+193.723952 2857.14 5600
+193.735152 2857.14 5600
+193.746352 2857.14 5600
+193.757552 2857.14 5600
+193.768752 2857.14 5600
+193.779952 2857.14 5600
+193.791152 2857.14 5600
+193.802352 2857.14 5600
+193.813552 2857.14 5600
+193.824752 2857.14 5600
+193.835952 2857.14 5600
+193.847152 2857.14 5600
+193.858352 2857.14 5600
+193.869552 2857.14 5600
+193.880752 2857.14 5600
+193.891952 2857.14 5600
+193.903152 2857.14 5600
+193.914352 2857.14 5600
+193.925552 2857.14 5600
+193.936752 2857.14 5600
+193.947952 2857.14 5600
+193.959216 2840.91 5632
+193.970480 2840.91 5632
+193.981744 2840.91 5632
+193.993008 2840.91 5632
+194.004272 2840.91 5632
+194.015536 2840.91 5632
+194.026800 2840.91 5632
+194.038064 2840.91 5632
+194.049328 2840.91 5632
+194.060592 2840.91 5632
+194.071856 2840.91 5632
+194.083120 2840.91 5632
+194.094384 2840.91 5632
+194.105648 2840.91 5632
+194.116912 2840.91 5632
+194.128176 2840.91 5632
+194.139440 2840.91 5632
+194.150704 2840.91 5632
+194.161968 2840.91 5632
+194.173232 2840.91 5632
+194.184496 2840.91 5632
+194.195760 2840.91 5632
+194.207024 2840.91 5632
+194.218288 2840.91 5632
+194.229616 2824.86 5664
+194.240944 2824.86 5664
+194.252272 2824.86 5664
+194.263600 2824.86 5664
+194.274928 2824.86 5664
+194.286256 2824.86 5664
+194.297584 2824.86 5664
+194.308912 2824.86 5664
+194.320240 2824.86 5664
+194.331568 2824.86 5664
+194.342896 2824.86 5664
+194.354224 2824.86 5664
+194.365552 2824.86 5664
+194.376880 2824.86 5664
+194.388208 2824.86 5664
+194.399536 2824.86 5664
+194.410928 2808.99 5696
+194.422320 2808.99 5696
+194.433712 2808.99 5696
+194.445104 2808.99 5696
+194.456496 2808.99 5696
+194.467888 2808.99 5696
+194.479280 2808.99 5696
+194.490672 2808.99 5696
+194.502064 2808.99 5696
+194.513456 2808.99 5696
+194.524848 2808.99 5696
+194.536240 2808.99 5696
+194.547632 2808.99 5696
+194.559024 2808.99 5696
+194.570416 2808.99 5696
+194.581808 2808.99 5696
+194.593200 2808.99 5696
+194.604592 2808.99 5696
+194.615984 2808.99 5696
+194.627376 2808.99 5696
+194.638768 2808.99 5696
+194.650160 2808.99 5696
+194.661552 2808.99 5696
+194.672944 2808.99 5696
+194.684400 2793.30 5728
+194.695856 2793.30 5728
+194.707312 2793.30 5728
+194.718768 2793.30 5728
+194.730224 2793.30 5728
+194.741680 2793.30 5728
+194.753136 2793.30 5728
+194.764592 2793.30 5728
+194.776048 2793.30 5728
+194.787504 2793.30 5728
+194.798960 2793.30 5728
+194.810416 2793.30 5728
+194.821872 2793.30 5728
+194.833328 2793.30 5728
+194.844784 2793.30 5728
+194.856240 2793.30 5728
+194.867696 2793.30 5728
+194.879152 2793.30 5728
+194.890608 2793.30 5728
+194.902064 2793.30 5728
+194.913520 2793.30 5728
+194.924976 2793.30 5728
+194.936432 2793.30 5728
+194.947888 2793.30 5728
+194.959408 2777.78 5760
+194.970928 2777.78 5760
+194.982448 2777.78 5760
+194.993968 2777.78 5760
+195.005488 2777.78 5760
+195.017008 2777.78 5760
+195.028528 2777.78 5760
+195.040048 2777.78 5760
+195.051568 2777.78 5760
+195.063088 2777.78 5760
+195.074608 2777.78 5760
+195.086128 2777.78 5760
+195.097648 2777.78 5760
+195.109168 2777.78 5760
+195.120688 2777.78 5760
+195.132208 2777.78 5760
+195.143792 2762.43 5792
+195.155376 2762.43 5792
+195.166960 2762.43 5792
+195.178544 2762.43 5792
+195.190128 2762.43 5792
+195.201712 2762.43 5792
+195.213296 2762.43 5792
+195.224880 2762.43 5792
+195.236464 2762.43 5792
+195.248048 2762.43 5792
+195.259632 2762.43 5792
+195.271216 2762.43 5792
+195.282800 2762.43 5792
+195.294384 2762.43 5792
+195.305968 2762.43 5792
+195.317552 2762.43 5792
+195.329136 2762.43 5792
+195.340720 2762.43 5792
+195.352304 2762.43 5792
+195.363888 2762.43 5792
+195.375472 2762.43 5792
+195.387056 2762.43 5792
+195.398640 2762.43 5792
+195.410224 2762.43 5792
+195.421872 2747.25 5824
+195.433520 2747.25 5824
+195.445168 2747.25 5824
+195.456816 2747.25 5824
+195.468464 2747.25 5824
+195.480112 2747.25 5824
+195.491760 2747.25 5824
+195.503408 2747.25 5824
+195.515056 2747.25 5824
+195.526704 2747.25 5824
+195.538352 2747.25 5824
+195.550000 2747.25 5824
+195.561648 2747.25 5824
+195.573296 2747.25 5824
+195.584944 2747.25 5824
+195.596592 2747.25 5824
+195.608304 2732.24 5856
+195.620016 2732.24 5856
+195.631728 2732.24 5856
+195.643440 2732.24 5856
+195.655152 2732.24 5856
+195.666864 2732.24 5856
+195.678576 2732.24 5856
+195.690288 2732.24 5856
+195.702000 2732.24 5856
+195.713712 2732.24 5856
+195.725424 2732.24 5856
+195.737136 2732.24 5856
+195.748848 2732.24 5856
+195.760560 2732.24 5856
+195.772272 2732.24 5856
+195.783984 2732.24 5856
+195.795696 2732.24 5856
+195.807408 2732.24 5856
+195.819120 2732.24 5856
+195.830832 2732.24 5856
+195.842544 2732.24 5856
+195.854256 2732.24 5856
+195.865968 2732.24 5856
+195.877680 2732.24 5856
+195.889456 2717.39 5888
+195.901232 2717.39 5888
+195.913008 2717.39 5888
+195.924784 2717.39 5888
+195.936560 2717.39 5888
+195.948336 2717.39 5888
+195.960112 2717.39 5888
+195.971888 2717.39 5888
+195.983664 2717.39 5888
+195.995440 2717.39 5888
+196.007216 2717.39 5888
+196.018992 2717.39 5888
+196.030768 2717.39 5888
+196.042544 2717.39 5888
+196.054320 2717.39 5888
+196.066096 2717.39 5888
+196.077936 2702.70 5920
+196.089776 2702.70 5920
+196.101616 2702.70 5920
+196.113456 2702.70 5920
+196.125296 2702.70 5920
+196.137136 2702.70 5920
+196.148976 2702.70 5920
+196.160816 2702.70 5920
+196.172656 2702.70 5920
+196.184496 2702.70 5920
+196.196336 2702.70 5920
+196.208176 2702.70 5920
+196.220016 2702.70 5920
+196.231856 2702.70 5920
+196.243696 2702.70 5920
+196.255536 2702.70 5920
+196.267376 2702.70 5920
+196.279216 2702.70 5920
+196.291056 2702.70 5920
+196.302896 2702.70 5920
+196.314736 2702.70 5920
+196.326576 2702.70 5920
+196.338416 2702.70 5920
+196.350256 2702.70 5920
+196.362160 2688.17 5952
+196.374064 2688.17 5952
+196.385968 2688.17 5952
+196.397872 2688.17 5952
+196.409776 2688.17 5952
+196.421680 2688.17 5952
+196.433584 2688.17 5952
+196.445488 2688.17 5952
+196.457392 2688.17 5952
+196.469296 2688.17 5952
+196.481200 2688.17 5952
+196.493104 2688.17 5952
+196.505008 2688.17 5952
+196.516912 2688.17 5952
+196.528816 2688.17 5952
+196.540720 2688.17 5952
+196.552688 2673.80 5984
+196.564656 2673.80 5984
+196.576624 2673.80 5984
+196.588592 2673.80 5984
+196.600560 2673.80 5984
+196.612528 2673.80 5984
+196.624496 2673.80 5984
+196.636464 2673.80 5984
+196.648432 2673.80 5984
+196.660400 2673.80 5984
+196.672368 2673.80 5984
+196.684336 2673.80 5984
+196.696304 2673.80 5984
+196.708272 2673.80 5984
+196.720240 2673.80 5984
+196.732208 2673.80 5984
+196.744176 2673.80 5984
+196.756144 2673.80 5984
+196.768112 2673.80 5984
+196.780080 2673.80 5984
+196.792048 2673.80 5984
+196.804016 2673.80 5984
+196.815984 2673.80 5984
+196.827952 2673.80 5984
+196.839984 2659.57 6016
+196.852016 2659.57 6016
+196.864048 2659.57 6016
+196.876080 2659.57 6016
+196.888112 2659.57 6016
+196.900144 2659.57 6016
+196.912176 2659.57 6016
+196.924208 2659.57 6016
+196.936240 2659.57 6016
+196.948272 2659.57 6016
+196.960304 2659.57 6016
+196.972336 2659.57 6016
+196.984368 2659.57 6016
+196.996400 2659.57 6016
+197.008432 2659.57 6016
+197.020464 2659.57 6016
+197.032560 2645.50 6048
+197.044656 2645.50 6048
+197.056752 2645.50 6048
+197.068848 2645.50 6048
+197.080944 2645.50 6048
+197.093040 2645.50 6048
+197.105136 2645.50 6048
+197.117232 2645.50 6048
+197.129328 2645.50 6048
+197.141424 2645.50 6048
+197.153520 2645.50 6048
+197.165616 2645.50 6048
+197.177712 2645.50 6048
+197.189808 2645.50 6048
+197.201904 2645.50 6048
+197.214000 2645.50 6048
+197.226160 2631.58 6080
+197.238320 2631.58 6080
+197.250480 2631.58 6080
+197.262640 2631.58 6080
+197.274800 2631.58 6080
+197.286960 2631.58 6080
+197.299120 2631.58 6080
+197.311280 2631.58 6080
+197.323440 2631.58 6080
+197.335600 2631.58 6080
+197.347760 2631.58 6080
+197.359920 2631.58 6080
+197.372080 2631.58 6080
+197.384240 2631.58 6080
+197.396400 2631.58 6080
+197.408560 2631.58 6080
+197.420720 2631.58 6080
+197.432880 2631.58 6080
+197.445040 2631.58 6080
+197.457200 2631.58 6080
+197.469360 2631.58 6080
+197.481520 2631.58 6080
+197.493680 2631.58 6080
+197.505840 2631.58 6080
+197.518064 2617.80 6112
+197.530288 2617.80 6112
+197.542512 2617.80 6112
+197.554736 2617.80 6112
+197.566960 2617.80 6112
+197.579184 2617.80 6112
+197.591408 2617.80 6112
+197.603632 2617.80 6112
+197.615856 2617.80 6112
+197.628080 2617.80 6112
+197.640304 2617.80 6112
+197.652528 2617.80 6112
+197.664752 2617.80 6112
+197.676976 2617.80 6112
+197.689200 2617.80 6112
+197.701424 2617.80 6112
+197.713712 2604.17 6144
+197.726000 2604.17 6144
+197.738288 2604.17 6144
+197.750576 2604.17 6144
+197.762864 2604.17 6144
+197.775152 2604.17 6144
+197.787440 2604.17 6144
+197.799728 2604.17 6144
+197.812016 2604.17 6144
+197.824304 2604.17 6144
+197.836592 2604.17 6144
+197.848880 2604.17 6144
+197.861168 2604.17 6144
+197.873456 2604.17 6144
+197.885744 2604.17 6144
+197.898032 2604.17 6144
+197.910384 2590.67 6176
+197.922736 2590.67 6176
+197.935088 2590.67 6176
+197.947440 2590.67 6176
+197.959792 2590.67 6176
+197.972144 2590.67 6176
+197.984496 2590.67 6176
+197.996848 2590.67 6176
+198.009200 2590.67 6176
+198.021552 2590.67 6176
+198.033904 2590.67 6176
+198.046256 2590.67 6176
+198.058608 2590.67 6176
+198.070960 2590.67 6176
+198.083312 2590.67 6176
+198.095664 2590.67 6176
+198.108016 2590.67 6176
+198.120368 2590.67 6176
+198.132720 2590.67 6176
+198.145072 2590.67 6176
+198.157424 2590.67 6176
+198.169776 2590.67 6176
+198.182128 2590.67 6176
+198.194480 2590.67 6176
+198.206896 2577.32 6208
+198.219312 2577.32 6208
+198.231728 2577.32 6208
+198.244144 2577.32 6208
+198.256560 2577.32 6208
+198.268976 2577.32 6208
+198.281392 2577.32 6208
+198.293808 2577.32 6208
+198.306224 2577.32 6208
+198.318640 2577.32 6208
+198.331056 2577.32 6208
+198.343472 2577.32 6208
+198.355888 2577.32 6208
+198.368304 2577.32 6208
+198.380720 2577.32 6208
+198.393136 2577.32 6208
+198.405680 2551.02 6272
+198.418224 2551.02 6272
+198.430768 2551.02 6272
+198.443312 2551.02 6272
+198.455856 2551.02 6272
+198.468400 2551.02 6272
+198.480944 2551.02 6272
+198.493488 2551.02 6272
+198.506032 2551.02 6272
+198.518576 2551.02 6272
+198.531120 2551.02 6272
+198.543664 2551.02 6272
+198.556208 2551.02 6272
+198.568752 2551.02 6272
+198.581296 2551.02 6272
+198.593840 2551.02 6272
+198.606448 2538.07 6304
+198.619056 2538.07 6304
+198.631664 2538.07 6304
+198.644272 2538.07 6304
+198.656880 2538.07 6304
+198.669488 2538.07 6304
+198.682096 2538.07 6304
+198.694704 2538.07 6304
+198.707312 2538.07 6304
+198.719920 2538.07 6304
+198.732528 2538.07 6304
+198.745136 2538.07 6304
+198.757744 2538.07 6304
+198.770352 2538.07 6304
+198.782960 2538.07 6304
+198.795568 2538.07 6304
+198.808240 2525.25 6336
+198.820912 2525.25 6336
+198.833584 2525.25 6336
+198.846256 2525.25 6336
+198.858928 2525.25 6336
+198.871600 2525.25 6336
+198.884272 2525.25 6336
+198.896944 2525.25 6336
+198.909616 2525.25 6336
+198.922288 2525.25 6336
+198.934960 2525.25 6336
+198.947632 2525.25 6336
+198.960304 2525.25 6336
+198.972976 2525.25 6336
+198.985648 2525.25 6336
+198.998320 2525.25 6336
+199.011056 2512.56 6368
+199.023792 2512.56 6368
+199.036528 2512.56 6368
+199.049264 2512.56 6368
+199.062000 2512.56 6368
+199.074736 2512.56 6368
+199.087472 2512.56 6368
+199.100208 2512.56 6368
+199.112944 2512.56 6368
+199.125680 2512.56 6368
+199.138416 2512.56 6368
+199.151152 2512.56 6368
+199.163888 2512.56 6368
+199.176624 2512.56 6368
+199.189360 2512.56 6368
+199.202096 2512.56 6368
+199.214896 2500.00 6400
+199.227696 2500.00 6400
+199.240496 2500.00 6400
+199.253296 2500.00 6400
+199.266096 2500.00 6400
+199.278896 2500.00 6400
+199.291696 2500.00 6400
+199.304496 2500.00 6400
+199.317296 2500.00 6400
+199.330096 2500.00 6400
+199.342896 2500.00 6400
+199.355696 2500.00 6400
+199.368496 2500.00 6400
+199.381296 2500.00 6400
+199.394096 2500.00 6400
+199.406896 2500.00 6400
+199.419696 2500.00 6400
+199.432496 2500.00 6400
+199.445296 2500.00 6400
+199.458096 2500.00 6400
+199.470896 2500.00 6400
+199.483696 2500.00 6400
+199.496496 2500.00 6400
+199.509296 2500.00 6400
+199.522160 2487.56 6432
+199.535024 2487.56 6432
+199.547888 2487.56 6432
+199.560752 2487.56 6432
+199.573616 2487.56 6432
+199.586480 2487.56 6432
+199.599344 2487.56 6432
+199.612208 2487.56 6432
+199.625072 2487.56 6432
+199.637936 2487.56 6432
+199.650800 2487.56 6432
+199.663664 2487.56 6432
+199.676528 2487.56 6432
+199.689392 2487.56 6432
+199.702256 2487.56 6432
+199.715120 2487.56 6432
+199.728048 2475.25 6464
+199.740976 2475.25 6464
+199.753904 2475.25 6464
+199.766832 2475.25 6464
+199.779760 2475.25 6464
+199.792688 2475.25 6464
+199.805616 2475.25 6464
+199.818544 2475.25 6464
+199.831472 2475.25 6464
+199.844400 2475.25 6464
+199.857328 2475.25 6464
+199.870256 2475.25 6464
+199.883184 2475.25 6464
+199.896112 2475.25 6464
+199.909040 2475.25 6464
+199.921968 2475.25 6464
+199.934960 2463.05 6496
+199.947952 2463.05 6496
+199.960944 2463.05 6496
+199.973936 2463.05 6496
+199.986928 2463.05 6496
+199.999920 2463.05 6496
+200.012912 2463.05 6496
+200.025904 2463.05 6496
+200.038896 2463.05 6496
+200.051888 2463.05 6496
+200.064880 2463.05 6496
+200.077872 2463.05 6496
+200.090864 2463.05 6496
+200.103856 2463.05 6496
+200.116848 2463.05 6496
+200.129840 2463.05 6496
+200.142896 2450.98 6528
+200.155952 2450.98 6528
+200.169008 2450.98 6528
+200.182064 2450.98 6528
+200.195120 2450.98 6528
+200.208176 2450.98 6528
+200.221232 2450.98 6528
+200.234288 2450.98 6528
+200.247344 2450.98 6528
+200.260400 2450.98 6528
+200.273456 2450.98 6528
+200.286512 2450.98 6528
+200.299568 2450.98 6528
+200.312624 2450.98 6528
+200.325680 2450.98 6528
+200.338736 2450.98 6528
+200.351856 2439.02 6560
+200.364976 2439.02 6560
+200.378096 2439.02 6560
+200.391216 2439.02 6560
+200.404336 2439.02 6560
+200.417456 2439.02 6560
+200.430576 2439.02 6560
+200.443696 2439.02 6560
+200.456816 2439.02 6560
+200.469936 2439.02 6560
+200.483056 2439.02 6560
+200.496176 2439.02 6560
+200.509296 2439.02 6560
+200.522416 2439.02 6560
+200.535536 2439.02 6560
+200.548656 2439.02 6560
+200.561840 2427.18 6592
+200.575024 2427.18 6592
+200.588208 2427.18 6592
+200.601392 2427.18 6592
+200.614576 2427.18 6592
+200.627760 2427.18 6592
+200.640944 2427.18 6592
+200.654128 2427.18 6592
+200.667312 2427.18 6592
+200.680496 2427.18 6592
+200.693680 2427.18 6592
+200.706864 2427.18 6592
+200.720048 2427.18 6592
+200.733232 2427.18 6592
+200.746416 2427.18 6592
+200.759600 2427.18 6592
+200.772912 2403.85 6656
+200.786224 2403.85 6656
+200.799536 2403.85 6656
+200.812848 2403.85 6656
+200.826160 2403.85 6656
+200.839472 2403.85 6656
+200.852784 2403.85 6656
+200.866096 2403.85 6656
+200.879408 2403.85 6656
+200.892720 2403.85 6656
+200.906032 2403.85 6656
+200.919344 2403.85 6656
+200.932656 2403.85 6656
+200.945968 2403.85 6656
+200.959280 2403.85 6656
+200.972592 2403.85 6656
+200.985968 2392.34 6688
+200.999344 2392.34 6688
+201.012720 2392.34 6688
+201.026096 2392.34 6688
+201.039472 2392.34 6688
+201.052848 2392.34 6688
+201.066224 2392.34 6688
+201.079600 2392.34 6688
+201.092976 2392.34 6688
+201.106352 2392.34 6688
+201.119728 2392.34 6688
+201.133104 2392.34 6688
+201.146480 2392.34 6688
+201.159856 2392.34 6688
+201.173232 2392.34 6688
+201.186608 2392.34 6688
+201.200048 2380.95 6720
+201.213488 2380.95 6720
+201.226928 2380.95 6720
+201.240368 2380.95 6720
+201.253808 2380.95 6720
+201.267248 2380.95 6720
+201.280688 2380.95 6720
+201.294128 2380.95 6720
+201.307568 2380.95 6720
+201.321008 2380.95 6720
+201.334448 2380.95 6720
+201.347888 2380.95 6720
+201.361328 2380.95 6720
+201.374768 2380.95 6720
+201.388208 2380.95 6720
+201.401648 2380.95 6720
+201.415152 2369.67 6752
+201.428656 2369.67 6752
+201.442160 2369.67 6752
+201.455664 2369.67 6752
+201.469168 2369.67 6752
+201.482672 2369.67 6752
+201.496176 2369.67 6752
+201.509680 2369.67 6752
+201.523248 2358.49 6784
+201.536816 2358.49 6784
+201.550384 2358.49 6784
+201.563952 2358.49 6784
+201.577520 2358.49 6784
+201.591088 2358.49 6784
+201.604656 2358.49 6784
+201.618224 2358.49 6784
+201.631792 2358.49 6784
+201.645360 2358.49 6784
+201.658928 2358.49 6784
+201.672496 2358.49 6784
+201.686064 2358.49 6784
+201.699632 2358.49 6784
+201.713200 2358.49 6784
+201.726768 2358.49 6784
+201.740400 2347.42 6816
+201.754032 2347.42 6816
+201.767664 2347.42 6816
+201.781296 2347.42 6816
+201.794928 2347.42 6816
+201.808560 2347.42 6816
+201.822192 2347.42 6816
+201.835824 2347.42 6816
+201.849456 2347.42 6816
+201.863088 2347.42 6816
+201.876720 2347.42 6816
+201.890352 2347.42 6816
+201.903984 2347.42 6816
+201.917616 2347.42 6816
+201.931248 2347.42 6816
+201.944880 2347.42 6816
+201.958576 2336.45 6848
+201.972272 2336.45 6848
+201.985968 2336.45 6848
+201.999664 2336.45 6848
+202.013360 2336.45 6848
+202.027056 2336.45 6848
+202.040752 2336.45 6848
+202.054448 2336.45 6848
+202.068144 2336.45 6848
+202.081840 2336.45 6848
+202.095536 2336.45 6848
+202.109232 2336.45 6848
+202.122928 2336.45 6848
+202.136624 2336.45 6848
+202.150320 2336.45 6848
+202.164016 2336.45 6848
+202.177840 2314.81 6912
+202.191664 2314.81 6912
+202.205488 2314.81 6912
+202.219312 2314.81 6912
+202.233136 2314.81 6912
+202.246960 2314.81 6912
+202.260784 2314.81 6912
+202.274608 2314.81 6912
+202.288432 2314.81 6912
+202.302256 2314.81 6912
+202.316080 2314.81 6912
+202.329904 2314.81 6912
+202.343728 2314.81 6912
+202.357552 2314.81 6912
+202.371376 2314.81 6912
+202.385200 2314.81 6912
+202.399088 2304.15 6944
+202.412976 2304.15 6944
+202.426864 2304.15 6944
+202.440752 2304.15 6944
+202.454640 2304.15 6944
+202.468528 2304.15 6944
+202.482416 2304.15 6944
+202.496304 2304.15 6944
+202.510192 2304.15 6944
+202.524080 2304.15 6944
+202.537968 2304.15 6944
+202.551856 2304.15 6944
+202.565744 2304.15 6944
+202.579632 2304.15 6944
+202.593520 2304.15 6944
+202.607408 2304.15 6944
+202.621360 2293.58 6976
+202.635312 2293.58 6976
+202.649264 2293.58 6976
+202.663216 2293.58 6976
+202.677168 2293.58 6976
+202.691120 2293.58 6976
+202.705072 2293.58 6976
+202.719024 2293.58 6976
+202.733040 2283.11 7008
+202.747056 2283.11 7008
+202.761072 2283.11 7008
+202.775088 2283.11 7008
+202.789104 2283.11 7008
+202.803120 2283.11 7008
+202.817136 2283.11 7008
+202.831152 2283.11 7008
+202.845168 2283.11 7008
+202.859184 2283.11 7008
+202.873200 2283.11 7008
+202.887216 2283.11 7008
+202.901232 2283.11 7008
+202.915248 2283.11 7008
+202.929264 2283.11 7008
+202.943280 2283.11 7008
+202.957360 2272.73 7040
+202.971440 2272.73 7040
+202.985520 2272.73 7040
+202.999600 2272.73 7040
+203.013680 2272.73 7040
+203.027760 2272.73 7040
+203.041840 2272.73 7040
+203.055920 2272.73 7040
+203.070000 2272.73 7040
+203.084080 2272.73 7040
+203.098160 2272.73 7040
+203.112240 2272.73 7040
+203.126320 2272.73 7040
+203.140400 2272.73 7040
+203.154480 2272.73 7040
+203.168560 2272.73 7040
+203.182704 2262.44 7072
+203.196848 2262.44 7072
+203.210992 2262.44 7072
+203.225136 2262.44 7072
+203.239280 2262.44 7072
+203.253424 2262.44 7072
+203.267568 2262.44 7072
+203.281712 2262.44 7072
+203.295856 2262.44 7072
+203.310000 2262.44 7072
+203.324144 2262.44 7072
+203.338288 2262.44 7072
+203.352432 2262.44 7072
+203.366576 2262.44 7072
+203.380720 2262.44 7072
+203.394864 2262.44 7072
+203.409136 2242.15 7136
+203.423408 2242.15 7136
+203.437680 2242.15 7136
+203.451952 2242.15 7136
+203.466224 2242.15 7136
+203.480496 2242.15 7136
+203.494768 2242.15 7136
+203.509040 2242.15 7136
+203.523376 2232.14 7168
+203.537712 2232.14 7168
+203.552048 2232.14 7168
+203.566384 2232.14 7168
+203.580720 2232.14 7168
+203.595056 2232.14 7168
+203.609392 2232.14 7168
+203.623728 2232.14 7168
+203.638064 2232.14 7168
+203.652400 2232.14 7168
+203.666736 2232.14 7168
+203.681072 2232.14 7168
+203.695408 2232.14 7168
+203.709744 2232.14 7168
+203.724080 2232.14 7168
+203.738416 2232.14 7168
+203.752816 2222.22 7200
+203.767216 2222.22 7200
+203.781616 2222.22 7200
+203.796016 2222.22 7200
+203.810416 2222.22 7200
+203.824816 2222.22 7200
+203.839216 2222.22 7200
+203.853616 2222.22 7200
+203.868016 2222.22 7200
+203.882416 2222.22 7200
+203.896816 2222.22 7200
+203.911216 2222.22 7200
+203.925616 2222.22 7200
+203.940016 2222.22 7200
+203.954416 2222.22 7200
+203.968816 2222.22 7200
+203.983280 2212.39 7232
+203.997744 2212.39 7232
+204.012208 2212.39 7232
+204.026672 2212.39 7232
+204.041136 2212.39 7232
+204.055600 2212.39 7232
+204.070064 2212.39 7232
+204.084528 2212.39 7232
+204.099120 2192.98 7296
+204.113712 2192.98 7296
+204.128304 2192.98 7296
+204.142896 2192.98 7296
+204.157488 2192.98 7296
+204.172080 2192.98 7296
+204.186672 2192.98 7296
+204.201264 2192.98 7296
+204.215856 2192.98 7296
+204.230448 2192.98 7296
+204.245040 2192.98 7296
+204.259632 2192.98 7296
+204.274224 2192.98 7296
+204.288816 2192.98 7296
+204.303408 2192.98 7296
+204.318000 2192.98 7296
+204.332656 2183.41 7328
+204.347312 2183.41 7328
+204.361968 2183.41 7328
+204.376624 2183.41 7328
+204.391280 2183.41 7328
+204.405936 2183.41 7328
+204.420592 2183.41 7328
+204.435248 2183.41 7328
+204.449904 2183.41 7328
+204.464560 2183.41 7328
+204.479216 2183.41 7328
+204.493872 2183.41 7328
+204.508528 2183.41 7328
+204.523184 2183.41 7328
+204.537840 2183.41 7328
+204.552496 2183.41 7328
+204.567216 2173.91 7360
+204.581936 2173.91 7360
+204.596656 2173.91 7360
+204.611376 2173.91 7360
+204.626096 2173.91 7360
+204.640816 2173.91 7360
+204.655536 2173.91 7360
+204.670256 2173.91 7360
+204.685040 2164.50 7392
+204.699824 2164.50 7392
+204.714608 2164.50 7392
+204.729392 2164.50 7392
+204.744176 2164.50 7392
+204.758960 2164.50 7392
+204.773744 2164.50 7392
+204.788528 2164.50 7392
+204.803312 2164.50 7392
+204.818096 2164.50 7392
+204.832880 2164.50 7392
+204.847664 2164.50 7392
+204.862448 2164.50 7392
+204.877232 2164.50 7392
+204.892016 2164.50 7392
+204.906800 2164.50 7392
+204.921712 2145.92 7456
+204.936624 2145.92 7456
+204.951536 2145.92 7456
+204.966448 2145.92 7456
+204.981360 2145.92 7456
+204.996272 2145.92 7456
+205.011184 2145.92 7456
+205.026096 2145.92 7456
+205.041072 2136.75 7488
+205.056048 2136.75 7488
+205.071024 2136.75 7488
+205.086000 2136.75 7488
+205.100976 2136.75 7488
+205.115952 2136.75 7488
+205.130928 2136.75 7488
+205.145904 2136.75 7488
+205.160880 2136.75 7488
+205.175856 2136.75 7488
+205.190832 2136.75 7488
+205.205808 2136.75 7488
+205.220784 2136.75 7488
+205.235760 2136.75 7488
+205.250736 2136.75 7488
+205.265712 2136.75 7488
+205.280752 2127.66 7520
+205.295792 2127.66 7520
+205.310832 2127.66 7520
+205.325872 2127.66 7520
+205.340912 2127.66 7520
+205.355952 2127.66 7520
+205.370992 2127.66 7520
+205.386032 2127.66 7520
+205.401136 2118.64 7552
+205.416240 2118.64 7552
+205.431344 2118.64 7552
+205.446448 2118.64 7552
+205.461552 2118.64 7552
+205.476656 2118.64 7552
+205.491760 2118.64 7552
+205.506864 2118.64 7552
+205.521968 2118.64 7552
+205.537072 2118.64 7552
+205.552176 2118.64 7552
+205.567280 2118.64 7552
+205.582384 2118.64 7552
+205.597488 2118.64 7552
+205.612592 2118.64 7552
+205.627696 2118.64 7552
+205.642928 2100.84 7616
+205.658160 2100.84 7616
+205.673392 2100.84 7616
+205.688624 2100.84 7616
+205.703856 2100.84 7616
+205.719088 2100.84 7616
+205.734320 2100.84 7616
+205.749552 2100.84 7616
+205.764848 2092.05 7648
+205.780144 2092.05 7648
+205.795440 2092.05 7648
+205.810736 2092.05 7648
+205.826032 2092.05 7648
+205.841328 2092.05 7648
+205.856624 2092.05 7648
+205.871920 2092.05 7648
+205.887216 2092.05 7648
+205.902512 2092.05 7648
+205.917808 2092.05 7648
+205.933104 2092.05 7648
+205.948400 2092.05 7648
+205.963696 2092.05 7648
+205.978992 2092.05 7648
+205.994288 2092.05 7648
+206.009648 2083.33 7680
+206.025008 2083.33 7680
+206.040368 2083.33 7680
+206.055728 2083.33 7680
+206.071088 2083.33 7680
+206.086448 2083.33 7680
+206.101808 2083.33 7680
+206.117168 2083.33 7680
+206.132656 2066.12 7744
+206.148144 2066.12 7744
+206.163632 2066.12 7744
+206.179120 2066.12 7744
+206.194608 2066.12 7744
+206.210096 2066.12 7744
+206.225584 2066.12 7744
+206.241072 2066.12 7744
+206.256560 2066.12 7744
+206.272048 2066.12 7744
+206.287536 2066.12 7744
+206.303024 2066.12 7744
+206.318512 2066.12 7744
+206.334000 2066.12 7744
+206.349488 2066.12 7744
+206.364976 2066.12 7744
+206.380528 2057.61 7776
+206.396080 2057.61 7776
+206.411632 2057.61 7776
+206.427184 2057.61 7776
+206.442736 2057.61 7776
+206.458288 2057.61 7776
+206.473840 2057.61 7776
+206.489392 2057.61 7776
+206.505008 2049.18 7808
+206.520624 2049.18 7808
+206.536240 2049.18 7808
+206.551856 2049.18 7808
+206.567472 2049.18 7808
+206.583088 2049.18 7808
+206.598704 2049.18 7808
+206.614320 2049.18 7808
+206.629936 2049.18 7808
+206.645552 2049.18 7808
+206.661168 2049.18 7808
+206.676784 2049.18 7808
+206.692400 2049.18 7808
+206.708016 2049.18 7808
+206.723632 2049.18 7808
+206.739248 2049.18 7808
+206.754992 2032.52 7872
+206.770736 2032.52 7872
+206.786480 2032.52 7872
+206.802224 2032.52 7872
+206.817968 2032.52 7872
+206.833712 2032.52 7872
+206.849456 2032.52 7872
+206.865200 2032.52 7872
+206.881008 2024.29 7904
+206.896816 2024.29 7904
+206.912624 2024.29 7904
+206.928432 2024.29 7904
+206.944240 2024.29 7904
+206.960048 2024.29 7904
+206.975856 2024.29 7904
+206.991664 2024.29 7904
+207.007472 2024.29 7904
+207.023280 2024.29 7904
+207.039088 2024.29 7904
+207.054896 2024.29 7904
+207.070768 2016.13 7936
+207.086640 2016.13 7936
+207.102512 2016.13 7936
+207.118384 2016.13 7936
+207.134256 2016.13 7936
+207.150128 2016.13 7936
+207.166000 2016.13 7936
+207.181872 2016.13 7936
+207.197744 2016.13 7936
+207.213616 2016.13 7936
+207.229488 2016.13 7936
+207.245360 2016.13 7936
+207.261360 2000.00 8000
+207.277360 2000.00 8000
+207.293360 2000.00 8000
+207.309360 2000.00 8000
+207.325360 2000.00 8000
+207.341360 2000.00 8000
+207.357360 2000.00 8000
+207.373360 2000.00 8000
+207.389360 2000.00 8000
+207.405360 2000.00 8000
+207.421360 2000.00 8000
+207.437360 2000.00 8000
+207.453424 1992.03 8032
+207.461456 1992.03 8032
+207.469488 1992.03 8032
+207.477520 1992.03 8032
+207.485552 1992.03 8032
+207.493584 1992.03 8032
+207.501616 1992.03 8032
+207.509648 1992.03 8032
+207.517680 1992.03 8032
+207.525712 1992.03 8032
+207.533744 1992.03 8032
+207.541776 1992.03 8032
+207.549808 1992.03 8032
+207.557840 1992.03 8032
+207.565872 1992.03 8032
+207.573904 1992.03 8032
+207.581968 1984.13 8064
+207.590032 1984.13 8064
+207.598096 1984.13 8064
+207.606160 1984.13 8064
+207.614224 1984.13 8064
+207.622288 1984.13 8064
+207.630352 1984.13 8064
+207.638416 1984.13 8064
+207.646480 1984.13 8064
+207.654544 1984.13 8064
+207.662608 1984.13 8064
+207.670672 1984.13 8064
+207.678736 1984.13 8064
+207.686800 1984.13 8064
+207.694864 1984.13 8064
+207.702928 1984.13 8064
+207.710992 1984.13 8064
+207.719056 1984.13 8064
+207.727120 1984.13 8064
+207.735184 1984.13 8064
+207.743248 1984.13 8064
+207.751312 1984.13 8064
+207.759376 1984.13 8064
+207.767440 1984.13 8064
+207.775568 1968.50 8128
+207.783696 1968.50 8128
+207.791824 1968.50 8128
+207.799952 1968.50 8128
+207.808080 1968.50 8128
+207.816208 1968.50 8128
+207.824336 1968.50 8128
+207.832464 1968.50 8128
+207.840592 1968.50 8128
+207.848720 1968.50 8128
+207.856848 1968.50 8128
+207.864976 1968.50 8128
+207.873104 1968.50 8128
+207.881232 1968.50 8128
+207.889360 1968.50 8128
+207.897488 1968.50 8128
+207.905616 1968.50 8128
+207.913744 1968.50 8128
+207.921872 1968.50 8128
+207.930000 1968.50 8128
+207.938128 1968.50 8128
+207.946256 1968.50 8128
+207.954384 1968.50 8128
+207.962512 1968.50 8128
+207.970672 1960.78 8160
+207.978832 1960.78 8160
+207.986992 1960.78 8160
+207.995152 1960.78 8160
+208.003312 1960.78 8160
+208.011472 1960.78 8160
+208.019632 1960.78 8160
+208.027792 1960.78 8160
+208.035952 1960.78 8160
+208.044112 1960.78 8160
+208.052272 1960.78 8160
+208.060432 1960.78 8160
+208.068592 1960.78 8160
+208.076752 1960.78 8160
+208.084912 1960.78 8160
+208.093072 1960.78 8160
+208.101264 1953.12 8192
+208.109456 1953.12 8192
+208.117648 1953.12 8192
+208.125840 1953.12 8192
+208.134032 1953.12 8192
+208.142224 1953.12 8192
+208.150416 1953.12 8192
+208.158608 1953.12 8192
+208.166800 1953.12 8192
+208.174992 1953.12 8192
+208.183184 1953.12 8192
+208.191376 1953.12 8192
+208.199568 1953.12 8192
+208.207760 1953.12 8192
+208.215952 1953.12 8192
+208.224144 1953.12 8192
+208.232336 1953.12 8192
+208.240528 1953.12 8192
+208.248720 1953.12 8192
+208.256912 1953.12 8192
+208.265104 1953.12 8192
+208.273296 1953.12 8192
+208.281488 1953.12 8192
+208.289680 1953.12 8192
+208.297936 1937.98 8256
+208.306192 1937.98 8256
+208.314448 1937.98 8256
+208.322704 1937.98 8256
+208.330960 1937.98 8256
+208.339216 1937.98 8256
+208.347472 1937.98 8256
+208.355728 1937.98 8256
+208.363984 1937.98 8256
+208.372240 1937.98 8256
+208.380496 1937.98 8256
+208.388752 1937.98 8256
+208.397008 1937.98 8256
+208.405264 1937.98 8256
+208.413520 1937.98 8256
+208.421776 1937.98 8256
+208.430032 1937.98 8256
+208.438288 1937.98 8256
+208.446544 1937.98 8256
+208.454800 1937.98 8256
+208.463056 1937.98 8256
+208.471312 1937.98 8256
+208.479568 1937.98 8256
+208.487824 1937.98 8256
+208.496080 1937.98 8256
+208.504336 1937.98 8256
+208.512592 1937.98 8256
+208.520848 1937.98 8256
+208.529104 1937.98 8256
+208.537360 1937.98 8256
+208.545616 1937.98 8256
+208.553872 1937.98 8256
+208.562128 1937.98 8256
+208.570384 1937.98 8256
+208.578640 1937.98 8256
+208.586896 1937.98 8256
+208.595152 1937.98 8256
+208.603408 1937.98 8256
+208.611664 1937.98 8256
+208.619920 1937.98 8256
+208.628240 1923.08 8320
+208.636560 1923.08 8320
+208.644880 1923.08 8320
+208.653200 1923.08 8320
+208.661520 1923.08 8320
+208.669840 1923.08 8320
+208.678160 1923.08 8320
+208.686480 1923.08 8320
+208.694800 1923.08 8320
+208.703120 1923.08 8320
+208.711440 1923.08 8320
+208.719760 1923.08 8320
+208.728080 1923.08 8320
+208.736400 1923.08 8320
+208.744720 1923.08 8320
+208.753040 1923.08 8320
+208.761424 1908.40 8384
+208.769808 1908.40 8384
+208.778192 1908.40 8384
+208.786576 1908.40 8384
+208.794960 1908.40 8384
+208.803344 1908.40 8384
+208.811728 1908.40 8384
+208.820112 1908.40 8384
+208.828496 1908.40 8384
+208.836880 1908.40 8384
+208.845264 1908.40 8384
+208.853648 1908.40 8384
+208.862032 1908.40 8384
+208.870416 1908.40 8384
+208.878800 1908.40 8384
+208.887184 1908.40 8384
+208.895568 1908.40 8384
+208.903952 1908.40 8384
+208.912336 1908.40 8384
+208.920720 1908.40 8384
+208.929104 1908.40 8384
+208.937488 1908.40 8384
+208.945872 1908.40 8384
+208.954256 1908.40 8384
+208.962704 1893.94 8448
+208.971152 1893.94 8448
+208.979600 1893.94 8448
+208.988048 1893.94 8448
+208.996496 1893.94 8448
+209.004944 1893.94 8448
+209.013392 1893.94 8448
+209.021840 1893.94 8448
+209.030288 1893.94 8448
+209.038736 1893.94 8448
+209.047184 1893.94 8448
+209.055632 1893.94 8448
+209.064080 1893.94 8448
+209.072528 1893.94 8448
+209.080976 1893.94 8448
+209.089424 1893.94 8448
+209.097872 1893.94 8448
+209.106320 1893.94 8448
+209.114768 1893.94 8448
+209.123216 1893.94 8448
+209.131664 1893.94 8448
+209.140112 1893.94 8448
+209.148560 1893.94 8448
+209.157008 1893.94 8448
+209.165456 1893.94 8448
+209.173904 1893.94 8448
+209.182352 1893.94 8448
+209.190800 1893.94 8448
+209.199248 1893.94 8448
+209.207696 1893.94 8448
+209.216144 1893.94 8448
+209.224592 1893.94 8448
+209.233040 1893.94 8448
+209.241488 1893.94 8448
+209.249936 1893.94 8448
+209.258384 1893.94 8448
+209.266832 1893.94 8448
+209.275280 1893.94 8448
+209.283728 1893.94 8448
+209.292176 1893.94 8448
+209.300688 1879.70 8512
+209.309200 1879.70 8512
+209.317712 1879.70 8512
+209.326224 1879.70 8512
+209.334736 1879.70 8512
+209.343248 1879.70 8512
+209.351760 1879.70 8512
+209.360272 1879.70 8512
+209.368784 1879.70 8512
+209.377296 1879.70 8512
+209.385808 1879.70 8512
+209.394320 1879.70 8512
+209.402832 1879.70 8512
+209.411344 1879.70 8512
+209.419856 1879.70 8512
+209.428368 1879.70 8512
+209.436944 1865.67 8576
+209.445520 1865.67 8576
+209.454096 1865.67 8576
+209.462672 1865.67 8576
+209.471248 1865.67 8576
+209.479824 1865.67 8576
+209.488400 1865.67 8576
+209.496976 1865.67 8576
+209.505552 1865.67 8576
+209.514128 1865.67 8576
+209.522704 1865.67 8576
+209.531280 1865.67 8576
+209.539856 1865.67 8576
+209.548432 1865.67 8576
+209.557008 1865.67 8576
+209.565584 1865.67 8576
+209.574224 1851.85 8640
+209.582864 1851.85 8640
+209.591504 1851.85 8640
+209.600144 1851.85 8640
+209.608784 1851.85 8640
+209.617424 1851.85 8640
+209.626064 1851.85 8640
+209.634704 1851.85 8640
+209.643344 1851.85 8640
+209.651984 1851.85 8640
+209.660624 1851.85 8640
+209.669264 1851.85 8640
+209.677904 1851.85 8640
+209.686544 1851.85 8640
+209.695184 1851.85 8640
+209.703824 1851.85 8640
+209.712464 1851.85 8640
+209.721104 1851.85 8640
+209.729744 1851.85 8640
+209.738384 1851.85 8640
+209.747024 1851.85 8640
+209.755664 1851.85 8640
+209.764304 1851.85 8640
+209.772944 1851.85 8640
+209.781584 1851.85 8640
+209.790224 1851.85 8640
+209.798864 1851.85 8640
+209.807504 1851.85 8640
+209.816144 1851.85 8640
+209.824784 1851.85 8640
+209.833424 1851.85 8640
+209.842064 1851.85 8640
+209.850704 1851.85 8640
+209.859344 1851.85 8640
+209.867984 1851.85 8640
+209.876624 1851.85 8640
+209.885264 1851.85 8640
+209.893904 1851.85 8640
+209.902544 1851.85 8640
+209.911184 1851.85 8640
+209.919888 1838.24 8704
+209.928592 1838.24 8704
+209.937296 1838.24 8704
+209.946000 1838.24 8704
+209.954704 1838.24 8704
+209.963408 1838.24 8704
+209.972112 1838.24 8704
+209.980816 1838.24 8704
+209.989520 1838.24 8704
+209.998224 1838.24 8704
+210.006928 1838.24 8704
+210.015632 1838.24 8704
+210.024336 1838.24 8704
+210.033040 1838.24 8704
+210.041744 1838.24 8704
+210.050448 1838.24 8704
+210.059216 1824.82 8768
+210.067984 1824.82 8768
+210.076752 1824.82 8768
+210.085520 1824.82 8768
+210.094288 1824.82 8768
+210.103056 1824.82 8768
+210.111824 1824.82 8768
+210.120592 1824.82 8768
+210.129360 1824.82 8768
+210.138128 1824.82 8768
+210.146896 1824.82 8768
+210.155664 1824.82 8768
+210.164432 1824.82 8768
+210.173200 1824.82 8768
+210.181968 1824.82 8768
+210.190736 1824.82 8768
+210.199504 1824.82 8768
+210.208272 1824.82 8768
+210.217040 1824.82 8768
+210.225808 1824.82 8768
+210.234576 1824.82 8768
+210.243344 1824.82 8768
+210.252112 1824.82 8768
+210.260880 1824.82 8768
+210.269648 1824.82 8768
+210.278416 1824.82 8768
+210.287184 1824.82 8768
+210.295952 1824.82 8768
+210.304720 1824.82 8768
+210.313488 1824.82 8768
+210.322256 1824.82 8768
+210.331024 1824.82 8768
+210.339792 1824.82 8768
+210.348560 1824.82 8768
+210.357328 1824.82 8768
+210.366096 1824.82 8768
+210.374864 1824.82 8768
+210.383632 1824.82 8768
+210.392400 1824.82 8768
+210.401168 1824.82 8768
+210.410000 1811.59 8832
+210.418832 1811.59 8832
+210.427664 1811.59 8832
+210.436496 1811.59 8832
+210.445328 1811.59 8832
+210.454160 1811.59 8832
+210.462992 1811.59 8832
+210.471824 1811.59 8832
+210.480656 1811.59 8832
+210.489488 1811.59 8832
+210.498320 1811.59 8832
+210.507152 1811.59 8832
+210.515984 1811.59 8832
+210.524816 1811.59 8832
+210.533648 1811.59 8832
+210.542480 1811.59 8832
+210.551376 1798.56 8896
+210.560272 1798.56 8896
+210.569168 1798.56 8896
+210.578064 1798.56 8896
+210.586960 1798.56 8896
+210.595856 1798.56 8896
+210.604752 1798.56 8896
+210.613648 1798.56 8896
+210.622544 1798.56 8896
+210.631440 1798.56 8896
+210.640336 1798.56 8896
+210.649232 1798.56 8896
+210.658128 1798.56 8896
+210.667024 1798.56 8896
+210.675920 1798.56 8896
+210.684816 1798.56 8896
+210.693776 1785.71 8960
+210.702736 1785.71 8960
+210.711696 1785.71 8960
+210.720656 1785.71 8960
+210.729616 1785.71 8960
+210.738576 1785.71 8960
+210.747536 1785.71 8960
+210.756496 1785.71 8960
+210.765456 1785.71 8960
+210.774416 1785.71 8960
+210.783376 1785.71 8960
+210.792336 1785.71 8960
+210.801296 1785.71 8960
+210.810256 1785.71 8960
+210.819216 1785.71 8960
+210.828176 1785.71 8960
+210.837136 1785.71 8960
+210.846096 1785.71 8960
+210.855056 1785.71 8960
+210.864016 1785.71 8960
+210.872976 1785.71 8960
+210.881936 1785.71 8960
+210.890896 1785.71 8960
+210.899856 1785.71 8960
+210.908816 1785.71 8960
+210.917776 1785.71 8960
+210.926736 1785.71 8960
+210.935696 1785.71 8960
+210.944656 1785.71 8960
+210.953616 1785.71 8960
+210.962576 1785.71 8960
+210.971536 1785.71 8960
+210.980560 1773.05 9024
+210.989584 1773.05 9024
+210.998608 1773.05 9024
+211.007632 1773.05 9024
+211.016656 1773.05 9024
+211.025680 1773.05 9024
+211.034704 1773.05 9024
+211.043728 1773.05 9024
+211.052752 1773.05 9024
+211.061776 1773.05 9024
+211.070800 1773.05 9024
+211.079824 1773.05 9024
+211.088848 1773.05 9024
+211.097872 1773.05 9024
+211.106896 1773.05 9024
+211.115920 1773.05 9024
+211.124944 1773.05 9024
+211.133968 1773.05 9024
+211.142992 1773.05 9024
+211.152016 1773.05 9024
+211.161040 1773.05 9024
+211.170064 1773.05 9024
+211.179088 1773.05 9024
+211.188112 1773.05 9024
+211.197200 1760.56 9088
+211.206288 1760.56 9088
+211.215376 1760.56 9088
+211.224464 1760.56 9088
+211.233552 1760.56 9088
+211.242640 1760.56 9088
+211.251728 1760.56 9088
+211.260816 1760.56 9088
+211.269904 1760.56 9088
+211.278992 1760.56 9088
+211.288080 1760.56 9088
+211.297168 1760.56 9088
+211.306256 1760.56 9088
+211.315344 1760.56 9088
+211.324432 1760.56 9088
+211.333520 1760.56 9088
+211.342672 1748.25 9152
+211.351824 1748.25 9152
+211.360976 1748.25 9152
+211.370128 1748.25 9152
+211.379280 1748.25 9152
+211.388432 1748.25 9152
+211.397584 1748.25 9152
+211.406736 1748.25 9152
+211.415888 1748.25 9152
+211.425040 1748.25 9152
+211.434192 1748.25 9152
+211.443344 1748.25 9152
+211.452496 1748.25 9152
+211.461648 1748.25 9152
+211.470800 1748.25 9152
+211.479952 1748.25 9152
+211.489168 1736.11 9216
+211.498384 1736.11 9216
+211.507600 1736.11 9216
+211.516816 1736.11 9216
+211.526032 1736.11 9216
+211.535248 1736.11 9216
+211.544464 1736.11 9216
+211.553680 1736.11 9216
+211.562896 1736.11 9216
+211.572112 1736.11 9216
+211.581328 1736.11 9216
+211.590544 1736.11 9216
+211.599760 1736.11 9216
+211.608976 1736.11 9216
+211.618192 1736.11 9216
+211.627408 1736.11 9216
+211.636624 1736.11 9216
+211.645840 1736.11 9216
+211.655056 1736.11 9216
+211.664272 1736.11 9216
+211.673488 1736.11 9216
+211.682704 1736.11 9216
+211.691920 1736.11 9216
+211.701136 1736.11 9216
+211.710352 1736.11 9216
+211.719568 1736.11 9216
+211.728784 1736.11 9216
+211.738000 1736.11 9216
+211.747216 1736.11 9216
+211.756432 1736.11 9216
+211.765648 1736.11 9216
+211.774864 1736.11 9216
+211.784144 1724.14 9280
+211.793424 1724.14 9280
+211.802704 1724.14 9280
+211.811984 1724.14 9280
+211.821264 1724.14 9280
+211.830544 1724.14 9280
+211.839824 1724.14 9280
+211.849104 1724.14 9280
+211.858384 1724.14 9280
+211.867664 1724.14 9280
+211.876944 1724.14 9280
+211.886224 1724.14 9280
+211.895504 1724.14 9280
+211.904784 1724.14 9280
+211.914064 1724.14 9280
+211.923344 1724.14 9280
+211.932688 1712.33 9344
+211.942032 1712.33 9344
+211.951376 1712.33 9344
+211.960720 1712.33 9344
+211.970064 1712.33 9344
+211.979408 1712.33 9344
+211.988752 1712.33 9344
+211.998096 1712.33 9344
+212.007440 1712.33 9344
+212.016784 1712.33 9344
+212.026128 1712.33 9344
+212.035472 1712.33 9344
+212.044816 1712.33 9344
+212.054160 1712.33 9344
+212.063504 1712.33 9344
+212.072848 1712.33 9344
+212.082256 1700.68 9408
+212.091664 1700.68 9408
+212.101072 1700.68 9408
+212.110480 1700.68 9408
+212.119888 1700.68 9408
+212.129296 1700.68 9408
+212.138704 1700.68 9408
+212.148112 1700.68 9408
+212.157520 1700.68 9408
+212.166928 1700.68 9408
+212.176336 1700.68 9408
+212.185744 1700.68 9408
+212.195152 1700.68 9408
+212.204560 1700.68 9408
+212.213968 1700.68 9408
+212.223376 1700.68 9408
+212.232784 1700.68 9408
+212.242192 1700.68 9408
+212.251600 1700.68 9408
+212.261008 1700.68 9408
+212.270416 1700.68 9408
+212.279824 1700.68 9408
+212.289232 1700.68 9408
+212.298640 1700.68 9408
+212.308048 1700.68 9408
+212.317456 1700.68 9408
+212.326864 1700.68 9408
+212.336272 1700.68 9408
+212.345680 1700.68 9408
+212.355088 1700.68 9408
+212.364496 1700.68 9408
+212.373904 1700.68 9408
+212.383376 1689.19 9472
+212.392848 1689.19 9472
+212.402320 1689.19 9472
+212.411792 1689.19 9472
+212.421264 1689.19 9472
+212.430736 1689.19 9472
+212.440208 1689.19 9472
+212.449680 1689.19 9472
+212.459152 1689.19 9472
+212.468624 1689.19 9472
+212.478096 1689.19 9472
+212.487568 1689.19 9472
+212.497040 1689.19 9472
+212.506512 1689.19 9472
+212.515984 1689.19 9472
+212.525456 1689.19 9472
+212.534992 1677.85 9536
+212.544528 1677.85 9536
+212.554064 1677.85 9536
+212.563600 1677.85 9536
+212.573136 1677.85 9536
+212.582672 1677.85 9536
+212.592208 1677.85 9536
+212.601744 1677.85 9536
+212.611344 1666.67 9600
+212.620944 1666.67 9600
+212.630544 1666.67 9600
+212.640144 1666.67 9600
+212.649744 1666.67 9600
+212.659344 1666.67 9600
+212.668944 1666.67 9600
+212.678544 1666.67 9600
+212.688144 1666.67 9600
+212.697744 1666.67 9600
+212.707344 1666.67 9600
+212.716944 1666.67 9600
+212.726544 1666.67 9600
+212.736144 1666.67 9600
+212.745744 1666.67 9600
+212.755344 1666.67 9600
+212.765008 1655.63 9664
+212.774672 1655.63 9664
+212.784336 1655.63 9664
+212.794000 1655.63 9664
+212.803664 1655.63 9664
+212.813328 1655.63 9664
+212.822992 1655.63 9664
+212.832656 1655.63 9664
+212.842320 1655.63 9664
+212.851984 1655.63 9664
+212.861648 1655.63 9664
+212.871312 1655.63 9664
+212.880976 1655.63 9664
+212.890640 1655.63 9664
+212.900304 1655.63 9664
+212.909968 1655.63 9664
+212.919696 1644.74 9728
+212.929424 1644.74 9728
+212.939152 1644.74 9728
+212.948880 1644.74 9728
+212.958608 1644.74 9728
+212.968336 1644.74 9728
+212.978064 1644.74 9728
+212.987792 1644.74 9728
+212.997520 1644.74 9728
+213.007248 1644.74 9728
+213.016976 1644.74 9728
+213.026704 1644.74 9728
+213.036432 1644.74 9728
+213.046160 1644.74 9728
+213.055888 1644.74 9728
+213.065616 1644.74 9728
+213.075344 1644.74 9728
+213.085072 1644.74 9728
+213.094800 1644.74 9728
+213.104528 1644.74 9728
+213.114256 1644.74 9728
+213.123984 1644.74 9728
+213.133712 1644.74 9728
+213.143440 1644.74 9728
+213.153168 1644.74 9728
+213.162896 1644.74 9728
+213.172624 1644.74 9728
+213.182352 1644.74 9728
+213.192080 1644.74 9728
+213.201808 1644.74 9728
+213.211536 1644.74 9728
+213.221264 1644.74 9728
+213.231056 1633.99 9792
+213.240848 1633.99 9792
+213.250640 1633.99 9792
+213.260432 1633.99 9792
+213.270224 1633.99 9792
+213.280016 1633.99 9792
+213.289808 1633.99 9792
+213.299600 1633.99 9792
+213.309392 1633.99 9792
+213.319184 1633.99 9792
+213.328976 1633.99 9792
+213.338768 1633.99 9792
+213.348560 1633.99 9792
+213.358352 1633.99 9792
+213.368144 1633.99 9792
+213.377936 1633.99 9792
+213.387792 1623.38 9856
+213.397648 1623.38 9856
+213.407504 1623.38 9856
+213.417360 1623.38 9856
+213.427216 1623.38 9856
+213.437072 1623.38 9856
+213.446928 1623.38 9856
+213.456784 1623.38 9856
+213.466704 1612.90 9920
+213.476624 1612.90 9920
+213.486544 1612.90 9920
+213.496464 1612.90 9920
+213.506384 1612.90 9920
+213.516304 1612.90 9920
+213.526224 1612.90 9920
+213.536144 1612.90 9920
+213.546064 1612.90 9920
+213.555984 1612.90 9920
+213.565904 1612.90 9920
+213.575824 1612.90 9920
+213.585744 1612.90 9920
+213.595664 1612.90 9920
+213.605584 1612.90 9920
+213.615504 1612.90 9920
+213.625488 1602.56 9984
+213.635472 1602.56 9984
+213.645456 1602.56 9984
+213.655440 1602.56 9984
+213.665424 1602.56 9984
+213.675408 1602.56 9984
+213.685392 1602.56 9984
+213.695376 1602.56 9984
+213.705360 1602.56 9984
+213.715344 1602.56 9984
+213.725328 1602.56 9984
+213.735312 1602.56 9984
+213.745296 1602.56 9984
+213.755280 1602.56 9984
+213.765264 1602.56 9984
+213.775248 1602.56 9984
+213.785296 1592.36 10048
+213.795344 1592.36 10048
+213.805392 1592.36 10048
+213.815440 1592.36 10048
+213.825488 1592.36 10048
+213.835536 1592.36 10048
+213.845584 1592.36 10048
+213.855632 1592.36 10048
+213.865680 1592.36 10048
+213.875728 1592.36 10048
+213.885776 1592.36 10048
+213.895824 1592.36 10048
+213.905872 1592.36 10048
+213.915920 1592.36 10048
+213.925968 1592.36 10048
+213.936016 1592.36 10048
+213.946064 1592.36 10048
+213.956112 1592.36 10048
+213.966160 1592.36 10048
+213.976208 1592.36 10048
+213.986256 1592.36 10048
+213.996304 1592.36 10048
+214.006352 1592.36 10048
+214.016400 1592.36 10048
+214.026512 1582.28 10112
+214.036624 1582.28 10112
+214.046736 1582.28 10112
+214.056848 1582.28 10112
+214.066960 1582.28 10112
+214.077072 1582.28 10112
+214.087184 1582.28 10112
+214.097296 1582.28 10112
+214.107408 1582.28 10112
+214.117520 1582.28 10112
+214.127632 1582.28 10112
+214.137744 1582.28 10112
+214.147856 1582.28 10112
+214.157968 1582.28 10112
+214.168080 1582.28 10112
+214.178192 1582.28 10112
+214.188368 1572.33 10176
+214.198544 1572.33 10176
+214.208720 1572.33 10176
+214.218896 1572.33 10176
+214.229072 1572.33 10176
+214.239248 1572.33 10176
+214.249424 1572.33 10176
+214.259600 1572.33 10176
+214.269776 1572.33 10176
+214.279952 1572.33 10176
+214.290128 1572.33 10176
+214.300304 1572.33 10176
+214.310480 1572.33 10176
+214.320656 1572.33 10176
+214.330832 1572.33 10176
+214.341008 1572.33 10176
+214.351248 1562.50 10240
+214.361488 1562.50 10240
+214.371728 1562.50 10240
+214.381968 1562.50 10240
+214.392208 1562.50 10240
+214.402448 1562.50 10240
+214.412688 1562.50 10240
+214.422928 1562.50 10240
+214.433232 1552.80 10304
+214.443536 1552.80 10304
+214.453840 1552.80 10304
+214.464144 1552.80 10304
+214.474448 1552.80 10304
+214.484752 1552.80 10304
+214.495056 1552.80 10304
+214.505360 1552.80 10304
+214.515664 1552.80 10304
+214.525968 1552.80 10304
+214.536272 1552.80 10304
+214.546576 1552.80 10304
+214.556880 1552.80 10304
+214.567184 1552.80 10304
+214.577488 1552.80 10304
+214.587792 1552.80 10304
+214.598160 1543.21 10368
+214.608528 1543.21 10368
+214.618896 1543.21 10368
+214.629264 1543.21 10368
+214.639632 1543.21 10368
+214.650000 1543.21 10368
+214.660368 1543.21 10368
+214.670736 1543.21 10368
+214.681104 1543.21 10368
+214.691472 1543.21 10368
+214.701840 1543.21 10368
+214.712208 1543.21 10368
+214.722576 1543.21 10368
+214.732944 1543.21 10368
+214.743312 1543.21 10368
+214.753680 1543.21 10368
+214.764112 1533.74 10432
+214.774544 1533.74 10432
+214.784976 1533.74 10432
+214.795408 1533.74 10432
+214.805840 1533.74 10432
+214.816272 1533.74 10432
+214.826704 1533.74 10432
+214.837136 1533.74 10432
+214.847568 1533.74 10432
+214.858000 1533.74 10432
+214.868432 1533.74 10432
+214.878864 1533.74 10432
+214.889296 1533.74 10432
+214.899728 1533.74 10432
+214.910160 1533.74 10432
+214.920592 1533.74 10432
+214.931024 1533.74 10432
+214.941456 1533.74 10432
+214.951888 1533.74 10432
+214.962320 1533.74 10432
+214.972752 1533.74 10432
+214.983184 1533.74 10432
+214.993616 1533.74 10432
+215.004048 1533.74 10432
+215.014544 1524.39 10496
+215.025040 1524.39 10496
+215.035536 1524.39 10496
+215.046032 1524.39 10496
+215.056528 1524.39 10496
+215.067024 1524.39 10496
+215.077520 1524.39 10496
+215.088016 1524.39 10496
+215.098576 1515.15 10560
+215.109136 1515.15 10560
+215.119696 1515.15 10560
+215.130256 1515.15 10560
+215.140816 1515.15 10560
+215.151376 1515.15 10560
+215.161936 1515.15 10560
+215.172496 1515.15 10560
+215.183056 1515.15 10560
+215.193616 1515.15 10560
+215.204176 1515.15 10560
+215.214736 1515.15 10560
+215.225296 1515.15 10560
+215.235856 1515.15 10560
+215.246416 1515.15 10560
+215.256976 1515.15 10560
+215.267600 1506.02 10624
+215.278224 1506.02 10624
+215.288848 1506.02 10624
+215.299472 1506.02 10624
+215.310096 1506.02 10624
+215.320720 1506.02 10624
+215.331344 1506.02 10624
+215.341968 1506.02 10624
+215.352656 1497.01 10688
+215.363344 1497.01 10688
+215.374032 1497.01 10688
+215.384720 1497.01 10688
+215.395408 1497.01 10688
+215.406096 1497.01 10688
+215.416784 1497.01 10688
+215.427472 1497.01 10688
+215.438160 1497.01 10688
+215.448848 1497.01 10688
+215.459536 1497.01 10688
+215.470224 1497.01 10688
+215.480912 1497.01 10688
+215.491600 1497.01 10688
+215.502288 1497.01 10688
+215.512976 1497.01 10688
+215.523728 1488.10 10752
+215.534480 1488.10 10752
+215.545232 1488.10 10752
+215.555984 1488.10 10752
+215.566736 1488.10 10752
+215.577488 1488.10 10752
+215.588240 1488.10 10752
+215.598992 1488.10 10752
+215.609808 1479.29 10816
+215.620624 1479.29 10816
+215.631440 1479.29 10816
+215.642256 1479.29 10816
+215.653072 1479.29 10816
+215.663888 1479.29 10816
+215.674704 1479.29 10816
+215.685520 1479.29 10816
+215.696336 1479.29 10816
+215.707152 1479.29 10816
+215.717968 1479.29 10816
+215.728784 1479.29 10816
+215.739600 1479.29 10816
+215.750416 1479.29 10816
+215.761232 1479.29 10816
+215.772048 1479.29 10816
+215.782928 1470.59 10880
+215.793808 1470.59 10880
+215.804688 1470.59 10880
+215.815568 1470.59 10880
+215.826448 1470.59 10880
+215.837328 1470.59 10880
+215.848208 1470.59 10880
+215.859088 1470.59 10880
+215.870032 1461.99 10944
+215.880976 1461.99 10944
+215.891920 1461.99 10944
+215.902864 1461.99 10944
+215.913808 1461.99 10944
+215.924752 1461.99 10944
+215.935696 1461.99 10944
+215.946640 1461.99 10944
+215.957584 1461.99 10944
+215.968528 1461.99 10944
+215.979472 1461.99 10944
+215.990416 1461.99 10944
+216.001360 1461.99 10944
+216.012304 1461.99 10944
+216.023248 1461.99 10944
+216.034192 1461.99 10944
+216.045200 1453.49 11008
+216.056208 1453.49 11008
+216.067216 1453.49 11008
+216.078224 1453.49 11008
+216.089232 1453.49 11008
+216.100240 1453.49 11008
+216.111248 1453.49 11008
+216.122256 1453.49 11008
+216.133328 1445.09 11072
+216.144400 1445.09 11072
+216.155472 1445.09 11072
+216.166544 1445.09 11072
+216.177616 1445.09 11072
+216.188688 1445.09 11072
+216.199760 1445.09 11072
+216.210832 1445.09 11072
+216.221904 1445.09 11072
+216.232976 1445.09 11072
+216.244048 1445.09 11072
+216.255120 1445.09 11072
+216.266192 1445.09 11072
+216.277264 1445.09 11072
+216.288336 1445.09 11072
+216.299408 1445.09 11072
+216.310544 1436.78 11136
+216.321680 1436.78 11136
+216.332816 1436.78 11136
+216.343952 1436.78 11136
+216.355088 1436.78 11136
+216.366224 1436.78 11136
+216.377360 1436.78 11136
+216.388496 1436.78 11136
+216.399632 1436.78 11136
+216.410768 1436.78 11136
+216.421904 1436.78 11136
+216.433040 1436.78 11136
+216.444176 1436.78 11136
+216.455312 1436.78 11136
+216.466448 1436.78 11136
+216.477584 1436.78 11136
+216.488720 1436.78 11136
+216.499856 1436.78 11136
+216.510992 1436.78 11136
+216.522128 1436.78 11136
+216.533328 1428.57 11200
+216.544528 1428.57 11200
+216.555728 1428.57 11200
+216.566928 1428.57 11200
+216.578128 1428.57 11200
+216.589328 1428.57 11200
+216.600528 1428.57 11200
+216.611728 1428.57 11200
+216.622928 1428.57 11200
+216.634128 1428.57 11200
+216.645328 1428.57 11200
+216.656528 1428.57 11200
+216.667792 1420.45 11264
+216.679056 1420.45 11264
+216.690320 1420.45 11264
+216.701584 1420.45 11264
+216.712848 1420.45 11264
+216.724112 1420.45 11264
+216.735376 1420.45 11264
+216.746640 1420.45 11264
+216.757904 1420.45 11264
+216.769168 1420.45 11264
+216.780432 1420.45 11264
+216.791696 1420.45 11264
+216.803024 1412.43 11328
+216.814352 1412.43 11328
+216.825680 1412.43 11328
+216.837008 1412.43 11328
+216.848336 1412.43 11328
+216.859664 1412.43 11328
+216.870992 1412.43 11328
+216.882320 1412.43 11328
+216.893712 1404.49 11392
+216.905104 1404.49 11392
+216.916496 1404.49 11392
+216.927888 1404.49 11392
+216.939280 1404.49 11392
+216.950672 1404.49 11392
+216.962064 1404.49 11392
+216.973456 1404.49 11392
+216.984848 1404.49 11392
+216.996240 1404.49 11392
+217.007632 1404.49 11392
+217.019024 1404.49 11392
+217.030480 1396.65 11456
+217.041936 1396.65 11456
+217.053392 1396.65 11456
+217.064848 1396.65 11456
+217.076304 1396.65 11456
+217.087760 1396.65 11456
+217.099216 1396.65 11456
+217.110672 1396.65 11456
+217.122128 1396.65 11456
+217.133584 1396.65 11456
+217.145040 1396.65 11456
+217.156496 1396.65 11456
+217.168016 1388.89 11520
+217.179536 1388.89 11520
+217.191056 1388.89 11520
+217.202576 1388.89 11520
+217.214096 1388.89 11520
+217.225616 1388.89 11520
+217.237136 1388.89 11520
+217.248656 1388.89 11520
+217.260240 1381.22 11584
+217.271824 1381.22 11584
+217.283408 1381.22 11584
+217.294992 1381.22 11584
+217.306576 1381.22 11584
+217.318160 1381.22 11584
+217.329744 1381.22 11584
+217.341328 1381.22 11584
+217.352912 1381.22 11584
+217.364496 1381.22 11584
+217.376080 1381.22 11584
+217.387664 1381.22 11584
+217.399312 1373.63 11648
+217.410960 1373.63 11648
+217.422608 1373.63 11648
+217.434256 1373.63 11648
+217.445904 1373.63 11648
+217.457552 1373.63 11648
+217.469200 1373.63 11648
+217.480848 1373.63 11648
+217.492560 1366.12 11712
+217.504272 1366.12 11712
+217.515984 1366.12 11712
+217.527696 1366.12 11712
+217.539408 1366.12 11712
+217.551120 1366.12 11712
+217.562832 1366.12 11712
+217.574544 1366.12 11712
+217.586256 1366.12 11712
+217.597968 1366.12 11712
+217.609680 1366.12 11712
+217.621392 1366.12 11712
+217.633168 1358.70 11776
+217.644944 1358.70 11776
+217.656720 1358.70 11776
+217.668496 1358.70 11776
+217.680272 1358.70 11776
+217.692048 1358.70 11776
+217.703824 1358.70 11776
+217.715600 1358.70 11776
+217.727440 1351.35 11840
+217.739280 1351.35 11840
+217.751120 1351.35 11840
+217.762960 1351.35 11840
+217.774800 1351.35 11840
+217.786640 1351.35 11840
+217.798480 1351.35 11840
+217.810320 1351.35 11840
+217.822160 1351.35 11840
+217.834000 1351.35 11840
+217.845840 1351.35 11840
+217.857680 1351.35 11840
+217.869584 1344.09 11904
+217.881488 1344.09 11904
+217.893392 1344.09 11904
+217.905296 1344.09 11904
+217.917200 1344.09 11904
+217.929104 1344.09 11904
+217.941008 1344.09 11904
+217.952912 1344.09 11904
+217.964880 1336.90 11968
+217.976848 1336.90 11968
+217.988816 1336.90 11968
+218.000784 1336.90 11968
+218.012752 1336.90 11968
+218.024720 1336.90 11968
+218.036688 1336.90 11968
+218.048656 1336.90 11968
+218.060624 1336.90 11968
+218.072592 1336.90 11968
+218.084560 1336.90 11968
+218.096528 1336.90 11968
+218.108560 1329.79 12032
+218.120592 1329.79 12032
+218.132624 1329.79 12032
+218.144656 1329.79 12032
+218.156688 1329.79 12032
+218.168720 1329.79 12032
+218.180752 1329.79 12032
+218.192784 1329.79 12032
+218.204880 1322.75 12096
+218.216976 1322.75 12096
+218.229072 1322.75 12096
+218.241168 1322.75 12096
+218.253264 1322.75 12096
+218.265360 1322.75 12096
+218.277456 1322.75 12096
+218.289552 1322.75 12096
+218.301712 1315.79 12160
+218.313872 1315.79 12160
+218.326032 1315.79 12160
+218.338192 1315.79 12160
+218.350352 1315.79 12160
+218.362512 1315.79 12160
+218.374672 1315.79 12160
+218.386832 1315.79 12160
+218.398992 1315.79 12160
+218.411152 1315.79 12160
+218.423312 1315.79 12160
+218.435472 1315.79 12160
+218.447696 1308.90 12224
+218.459920 1308.90 12224
+218.472144 1308.90 12224
+218.484368 1308.90 12224
+218.496592 1308.90 12224
+218.508816 1308.90 12224
+218.521040 1308.90 12224
+218.533264 1308.90 12224
+218.545552 1302.08 12288
+218.557840 1302.08 12288
+218.570128 1302.08 12288
+218.582416 1302.08 12288
+218.594704 1302.08 12288
+218.606992 1302.08 12288
+218.619280 1302.08 12288
+218.631568 1302.08 12288
+218.643920 1295.34 12352
+218.656272 1295.34 12352
+218.668624 1295.34 12352
+218.680976 1295.34 12352
+218.693328 1295.34 12352
+218.705680 1295.34 12352
+218.718032 1295.34 12352
+218.730384 1295.34 12352
+218.742736 1295.34 12352
+218.755088 1295.34 12352
+218.767440 1295.34 12352
+218.779792 1295.34 12352
+218.792208 1288.66 12416
+218.804624 1288.66 12416
+218.817040 1288.66 12416
+218.829456 1288.66 12416
+218.841872 1288.66 12416
+218.854288 1288.66 12416
+218.866704 1288.66 12416
+218.879120 1288.66 12416
+218.891664 1275.51 12544
+218.904208 1275.51 12544
+218.916752 1275.51 12544
+218.929296 1275.51 12544
+218.941840 1275.51 12544
+218.954384 1275.51 12544
+218.966928 1275.51 12544
+218.979472 1275.51 12544
+218.992080 1269.04 12608
+219.004688 1269.04 12608
+219.017296 1269.04 12608
+219.029904 1269.04 12608
+219.042512 1269.04 12608
+219.055120 1269.04 12608
+219.067728 1269.04 12608
+219.080336 1269.04 12608
+219.093008 1262.63 12672
+219.105680 1262.63 12672
+219.118352 1262.63 12672
+219.131024 1262.63 12672
+219.143696 1262.63 12672
+219.156368 1262.63 12672
+219.169040 1262.63 12672
+219.181712 1262.63 12672
+219.194448 1256.28 12736
+219.207184 1256.28 12736
+219.219920 1256.28 12736
+219.232656 1256.28 12736
+219.245392 1256.28 12736
+219.258128 1256.28 12736
+219.270864 1256.28 12736
+219.283600 1256.28 12736
+219.296400 1250.00 12800
+219.309200 1250.00 12800
+219.322000 1250.00 12800
+219.334800 1250.00 12800
+219.347600 1250.00 12800
+219.360400 1250.00 12800
+219.373200 1250.00 12800
+219.386000 1250.00 12800
+219.398800 1250.00 12800
+219.411600 1250.00 12800
+219.424400 1250.00 12800
+219.437200 1250.00 12800
+219.450064 1243.78 12864
+219.462928 1243.78 12864
+219.475792 1243.78 12864
+219.488656 1243.78 12864
+219.501520 1243.78 12864
+219.514384 1243.78 12864
+219.527248 1243.78 12864
+219.540112 1243.78 12864
+219.553040 1237.62 12928
+219.565968 1237.62 12928
+219.578896 1237.62 12928
+219.591824 1237.62 12928
+219.604752 1237.62 12928
+219.617680 1237.62 12928
+219.630608 1237.62 12928
+219.643536 1237.62 12928
+219.656528 1231.53 12992
+219.669520 1231.53 12992
+219.682512 1231.53 12992
+219.695504 1231.53 12992
+219.708496 1231.53 12992
+219.721488 1231.53 12992
+219.734480 1231.53 12992
+219.747472 1231.53 12992
+219.760528 1225.49 13056
+219.773584 1225.49 13056
+219.786640 1225.49 13056
+219.799696 1225.49 13056
+219.812752 1225.49 13056
+219.825808 1225.49 13056
+219.838864 1225.49 13056
+219.851920 1225.49 13056
+219.865040 1219.51 13120
+219.878160 1219.51 13120
+219.891280 1219.51 13120
+219.904400 1219.51 13120
+219.917520 1219.51 13120
+219.930640 1219.51 13120
+219.943760 1219.51 13120
+219.956880 1219.51 13120
+219.970064 1213.59 13184
+219.983248 1213.59 13184
+219.996432 1213.59 13184
+220.009616 1213.59 13184
+220.022800 1213.59 13184
+220.035984 1213.59 13184
+220.049168 1213.59 13184
+220.062352 1213.59 13184
+220.075664 1201.92 13312
+220.088976 1201.92 13312
+220.102288 1201.92 13312
+220.115600 1201.92 13312
+220.128912 1201.92 13312
+220.142224 1201.92 13312
+220.155536 1201.92 13312
+220.168848 1201.92 13312
+220.182224 1196.17 13376
+220.195600 1196.17 13376
+220.208976 1196.17 13376
+220.222352 1196.17 13376
+220.235728 1196.17 13376
+220.249104 1196.17 13376
+220.262480 1196.17 13376
+220.275856 1196.17 13376
+220.289296 1190.48 13440
+220.302736 1190.48 13440
+220.316176 1190.48 13440
+220.329616 1190.48 13440
+220.343056 1190.48 13440
+220.356496 1190.48 13440
+220.369936 1190.48 13440
+220.383376 1190.48 13440
+220.396880 1184.83 13504
+220.410384 1184.83 13504
+220.423888 1184.83 13504
+220.437392 1184.83 13504
+220.450960 1179.25 13568
+220.464528 1179.25 13568
+220.478096 1179.25 13568
+220.491664 1179.25 13568
+220.505232 1179.25 13568
+220.518800 1179.25 13568
+220.532368 1179.25 13568
+220.545936 1179.25 13568
+220.559568 1173.71 13632
+220.573200 1173.71 13632
+220.586832 1173.71 13632
+220.600464 1173.71 13632
+220.614096 1173.71 13632
+220.627728 1173.71 13632
+220.641360 1173.71 13632
+220.654992 1173.71 13632
+220.668688 1168.22 13696
+220.682384 1168.22 13696
+220.696080 1168.22 13696
+220.709776 1168.22 13696
+220.723472 1168.22 13696
+220.737168 1168.22 13696
+220.750864 1168.22 13696
+220.764560 1168.22 13696
+220.778384 1157.41 13824
+220.792208 1157.41 13824
+220.806032 1157.41 13824
+220.819856 1157.41 13824
+220.833680 1157.41 13824
+220.847504 1157.41 13824
+220.861328 1157.41 13824
+220.875152 1157.41 13824
+220.889040 1152.07 13888
+220.902928 1152.07 13888
+220.916816 1152.07 13888
+220.930704 1152.07 13888
+220.944592 1152.07 13888
+220.958480 1152.07 13888
+220.972368 1152.07 13888
+220.986256 1152.07 13888
+221.000208 1146.79 13952
+221.014160 1146.79 13952
+221.028112 1146.79 13952
+221.042064 1146.79 13952
+221.056080 1141.55 14016
+221.070096 1141.55 14016
+221.084112 1141.55 14016
+221.098128 1141.55 14016
+221.112144 1141.55 14016
+221.126160 1141.55 14016
+221.140176 1141.55 14016
+221.154192 1141.55 14016
+221.168272 1136.36 14080
+221.182352 1136.36 14080
+221.196432 1136.36 14080
+221.210512 1136.36 14080
+221.224592 1136.36 14080
+221.238672 1136.36 14080
+221.252752 1136.36 14080
+221.266832 1136.36 14080
+221.280976 1131.22 14144
+221.295120 1131.22 14144
+221.309264 1131.22 14144
+221.323408 1131.22 14144
+221.337552 1131.22 14144
+221.351696 1131.22 14144
+221.365840 1131.22 14144
+221.379984 1131.22 14144
+221.394256 1121.08 14272
+221.408528 1121.08 14272
+221.422800 1121.08 14272
+221.437072 1121.08 14272
+221.451408 1116.07 14336
+221.465744 1116.07 14336
+221.480080 1116.07 14336
+221.494416 1116.07 14336
+221.508752 1116.07 14336
+221.523088 1116.07 14336
+221.537424 1116.07 14336
+221.551760 1116.07 14336
+221.566160 1111.11 14400
+221.580560 1111.11 14400
+221.594960 1111.11 14400
+221.609360 1111.11 14400
+221.623760 1111.11 14400
+221.638160 1111.11 14400
+221.652560 1111.11 14400
+221.666960 1111.11 14400
+221.681424 1106.19 14464
+221.695888 1106.19 14464
+221.710352 1106.19 14464
+221.724816 1106.19 14464
+221.739408 1096.49 14592
+221.754000 1096.49 14592
+221.768592 1096.49 14592
+221.783184 1096.49 14592
+221.797776 1096.49 14592
+221.812368 1096.49 14592
+221.826960 1096.49 14592
+221.841552 1096.49 14592
+221.856208 1091.70 14656
+221.870864 1091.70 14656
+221.885520 1091.70 14656
+221.900176 1091.70 14656
+221.914832 1091.70 14656
+221.929488 1091.70 14656
+221.944144 1091.70 14656
+221.958800 1091.70 14656
+221.973520 1086.96 14720
+221.988240 1086.96 14720
+222.002960 1086.96 14720
+222.017680 1086.96 14720
+222.032464 1082.25 14784
+222.047248 1082.25 14784
+222.062032 1082.25 14784
+222.076816 1082.25 14784
+222.091600 1082.25 14784
+222.106384 1082.25 14784
+222.121168 1082.25 14784
+222.135952 1082.25 14784
+222.150864 1072.96 14912
+222.165776 1072.96 14912
+222.180688 1072.96 14912
+222.195600 1072.96 14912
+222.210576 1068.38 14976
+222.225552 1068.38 14976
+222.240528 1068.38 14976
+222.255504 1068.38 14976
+222.270480 1068.38 14976
+222.285456 1068.38 14976
+222.300432 1068.38 14976
+222.315408 1068.38 14976
+222.330448 1063.83 15040
+222.345488 1063.83 15040
+222.360528 1063.83 15040
+222.375568 1063.83 15040
+222.390672 1059.32 15104
+222.405776 1059.32 15104
+222.420880 1059.32 15104
+222.435984 1059.32 15104
+222.451088 1059.32 15104
+222.466192 1059.32 15104
+222.481296 1059.32 15104
+222.496400 1059.32 15104
+222.511632 1050.42 15232
+222.526864 1050.42 15232
+222.542096 1050.42 15232
+222.557328 1050.42 15232
+222.572624 1046.03 15296
+222.587920 1046.03 15296
+222.603216 1046.03 15296
+222.618512 1046.03 15296
+222.633808 1046.03 15296
+222.649104 1046.03 15296
+222.664400 1046.03 15296
+222.679696 1046.03 15296
+222.695056 1041.67 15360
+222.710416 1041.67 15360
+222.725776 1041.67 15360
+222.741136 1041.67 15360
+222.756624 1033.06 15488
+222.772112 1033.06 15488
+222.787600 1033.06 15488
+222.803088 1033.06 15488
+222.818576 1033.06 15488
+222.834064 1033.06 15488
+222.849552 1033.06 15488
+222.865040 1033.06 15488
+222.880592 1028.81 15552
+222.896144 1028.81 15552
+222.911696 1028.81 15552
+222.927248 1028.81 15552
+222.942864 1024.59 15616
+222.958480 1024.59 15616
+222.974096 1024.59 15616
+222.989712 1024.59 15616
+223.005328 1024.59 15616
+223.020944 1024.59 15616
+223.036560 1024.59 15616
+223.052176 1024.59 15616
+223.067920 1016.26 15744
+223.083664 1016.26 15744
+223.099408 1016.26 15744
+223.115152 1016.26 15744
+223.130960 1012.15 15808
+223.146768 1012.15 15808
+223.162576 1012.15 15808
+223.178384 1012.15 15808
+223.194192 1012.15 15808
+223.210000 1012.15 15808
+223.225872 1008.06 15872
+223.241744 1008.06 15872
+223.257616 1008.06 15872
+223.273488 1008.06 15872
+223.289360 1008.06 15872
+223.305232 1008.06 15872
+223.321232 1000.00 16000
+223.337232 1000.00 16000
+223.353232 1000.00 16000
+223.369232 1000.00 16000
+223.385232 1000.00 16000
+223.401232 1000.00 16000
+223.417296 996.02 16064
+223.433360 996.02 16064
+223.449424 996.02 16064
+223.465488 996.02 16064
+223.481616 992.06 16128
+223.497744 992.06 16128
+223.513872 992.06 16128
+223.530000 992.06 16128
+223.546128 992.06 16128
+223.562256 992.06 16128
+223.578512 984.25 16256
+223.594768 984.25 16256
+223.611024 984.25 16256
+223.627280 984.25 16256
+223.643536 984.25 16256
+223.659792 984.25 16256
+223.676112 980.39 16320
+223.692432 980.39 16320
+223.708752 980.39 16320
+223.725072 980.39 16320
+223.741456 976.56 16384
+223.757840 976.56 16384
+223.774224 976.56 16384
+223.790608 976.56 16384
+223.806992 976.56 16384
+223.823376 976.56 16384
+223.839888 968.99 16512
+223.856400 968.99 16512
+223.872912 968.99 16512
+223.889424 968.99 16512
+223.905936 968.99 16512
+223.922448 968.99 16512
+223.938960 968.99 16512
+223.955472 968.99 16512
+223.971984 968.99 16512
+223.988496 968.99 16512
+224.005136 961.54 16640
+224.021776 961.54 16640
+224.038416 961.54 16640
+224.055056 961.54 16640
+224.071824 954.20 16768
+224.088592 954.20 16768
+224.105360 954.20 16768
+224.122128 954.20 16768
+224.138896 954.20 16768
+224.155664 954.20 16768
+224.172560 946.97 16896
+224.189456 946.97 16896
+224.206352 946.97 16896
+224.223248 946.97 16896
+224.240144 946.97 16896
+224.257040 946.97 16896
+224.273936 946.97 16896
+224.290832 946.97 16896
+224.307728 946.97 16896
+224.324624 946.97 16896
+224.341648 939.85 17024
+224.358672 939.85 17024
+224.375696 939.85 17024
+224.392720 939.85 17024
+224.409872 932.84 17152
+224.427024 932.84 17152
+224.444176 932.84 17152
+224.461328 932.84 17152
+224.478608 925.93 17280
+224.495888 925.93 17280
+224.513168 925.93 17280
+224.530448 925.93 17280
+224.547728 925.93 17280
+224.565008 925.93 17280
+224.582288 925.93 17280
+224.599568 925.93 17280
+224.616848 925.93 17280
+224.634128 925.93 17280
+224.651536 919.12 17408
+224.668944 919.12 17408
+224.686352 919.12 17408
+224.703760 919.12 17408
+224.721296 912.41 17536
+224.738832 912.41 17536
+224.756368 912.41 17536
+224.773904 912.41 17536
+224.791440 912.41 17536
+224.808976 912.41 17536
+224.826512 912.41 17536
+224.844048 912.41 17536
+224.861584 912.41 17536
+224.879120 912.41 17536
+224.896784 905.80 17664
+224.914448 905.80 17664
+224.932112 905.80 17664
+224.949776 905.80 17664
+224.967568 899.28 17792
+224.985360 899.28 17792
+225.003152 899.28 17792
+225.020944 899.28 17792
+225.038864 892.86 17920
+225.056784 892.86 17920
+225.074704 892.86 17920
+225.092624 892.86 17920
+225.110544 892.86 17920
+225.128464 892.86 17920
+225.146384 892.86 17920
+225.164304 892.86 17920
+225.182352 886.52 18048
+225.200400 886.52 18048
+225.218448 886.52 18048
+225.236496 886.52 18048
+225.254544 886.52 18048
+225.272592 886.52 18048
+225.290768 880.28 18176
+225.308944 880.28 18176
+225.327120 880.28 18176
+225.345296 880.28 18176
+225.363600 874.13 18304
+225.381904 874.13 18304
+225.400208 874.13 18304
+225.418512 874.13 18304
+225.436944 868.06 18432
+225.455376 868.06 18432
+225.473808 868.06 18432
+225.492240 868.06 18432
+225.510672 868.06 18432
+225.529104 868.06 18432
+225.547536 868.06 18432
+225.565968 868.06 18432
+225.584528 862.07 18560
+225.603088 862.07 18560
+225.621648 862.07 18560
+225.640208 862.07 18560
+225.658896 856.16 18688
+225.677584 856.16 18688
+225.696272 856.16 18688
+225.714960 856.16 18688
+225.733776 850.34 18816
+225.752592 850.34 18816
+225.771408 850.34 18816
+225.790224 850.34 18816
+225.809040 850.34 18816
+225.827856 850.34 18816
+225.846672 850.34 18816
+225.865488 850.34 18816
+225.884432 844.59 18944
+225.903376 844.59 18944
+225.922320 844.59 18944
+225.941264 844.59 18944
+225.960336 838.93 19072
+225.979408 838.93 19072
+225.998608 833.33 19200
+226.017808 833.33 19200
+226.037008 833.33 19200
+226.056208 833.33 19200
+226.075536 827.81 19328
+226.094864 827.81 19328
+226.114192 827.81 19328
+226.133520 827.81 19328
+226.152976 822.37 19456
+226.172432 822.37 19456
+226.191888 822.37 19456
+226.211344 822.37 19456
+226.230800 822.37 19456
+226.250256 822.37 19456
+226.269712 822.37 19456
+226.289168 822.37 19456
+226.308752 816.99 19584
+226.328336 816.99 19584
+226.347920 816.99 19584
+226.367504 816.99 19584
+226.387216 811.69 19712
+226.406928 811.69 19712
+226.426768 806.45 19840
+226.446608 806.45 19840
+226.466448 806.45 19840
+226.486288 806.45 19840
+226.506256 801.28 19968
+226.526224 801.28 19968
+226.546192 801.28 19968
+226.566160 801.28 19968
+226.586256 796.18 20096
+226.606352 796.18 20096
+226.626448 796.18 20096
+226.646544 796.18 20096
+226.666640 796.18 20096
+226.686736 796.18 20096
+226.706960 791.14 20224
+226.727184 791.14 20224
+226.747408 791.14 20224
+226.767632 791.14 20224
+226.787984 786.16 20352
+226.808336 786.16 20352
+226.828688 786.16 20352
+226.849040 786.16 20352
+226.869520 781.25 20480
+226.890000 781.25 20480
+226.910608 776.40 20608
+226.931216 776.40 20608
+226.951824 776.40 20608
+226.972432 776.40 20608
+226.993168 771.60 20736
+227.013904 771.60 20736
+227.034640 771.60 20736
+227.055376 771.60 20736
+227.076240 766.87 20864
+227.097104 766.87 20864
+227.117968 766.87 20864
+227.138832 766.87 20864
+227.159696 766.87 20864
+227.180560 766.87 20864
+227.201552 762.20 20992
+227.222544 762.20 20992
+227.243664 757.58 21120
+227.264784 757.58 21120
+227.285904 757.58 21120
+227.307024 757.58 21120
+227.328272 753.01 21248
+227.349520 753.01 21248
+227.370896 748.50 21376
+227.392272 748.50 21376
+227.413648 748.50 21376
+227.435024 748.50 21376
+227.456528 744.05 21504
+227.478032 744.05 21504
+227.499664 739.64 21632
+227.521296 739.64 21632
+227.542928 739.64 21632
+227.564560 739.64 21632
+227.586320 735.29 21760
+227.608080 735.29 21760
+227.629968 730.99 21888
+227.651856 730.99 21888
+227.673744 730.99 21888
+227.695632 730.99 21888
+227.717648 726.74 22016
+227.739664 726.74 22016
+227.761808 722.54 22144
+227.783952 722.54 22144
+227.806096 722.54 22144
+227.828240 722.54 22144
+227.850512 718.39 22272
+227.872784 718.39 22272
+227.895056 718.39 22272
+227.917328 718.39 22272
+227.939600 718.39 22272
+227.962000 714.29 22400
+227.984400 714.29 22400
+228.006800 714.29 22400
+228.029328 710.23 22528
+228.051856 710.23 22528
+228.074384 710.23 22528
+228.097040 706.21 22656
+228.119696 706.21 22656
+228.142480 702.25 22784
+228.165264 702.25 22784
+228.188048 702.25 22784
+228.210960 698.32 22912
+228.233872 698.32 22912
+228.256784 698.32 22912
+228.279824 694.44 23040
+228.302864 694.44 23040
+228.326032 690.61 23168
+228.349200 690.61 23168
+228.372368 690.61 23168
+228.395664 686.81 23296
+228.418960 686.81 23296
+228.442384 683.06 23424
+228.465808 683.06 23424
+228.489232 683.06 23424
+228.512784 679.35 23552
+228.536336 679.35 23552
+228.560016 675.68 23680
+228.583696 675.68 23680
+228.607376 675.68 23680
+228.631184 672.04 23808
+228.654992 672.04 23808
+228.678928 668.45 23936
+228.702864 668.45 23936
+228.726800 668.45 23936
+228.750864 664.89 24064
+228.774928 664.89 24064
+228.799120 661.38 24192
+228.823312 661.38 24192
+228.847632 657.89 24320
+228.871952 657.89 24320
+228.896272 657.89 24320
+228.920720 654.45 24448
+228.945168 654.45 24448
+228.969744 651.04 24576
+228.994320 651.04 24576
+229.019024 647.67 24704
+229.043728 647.67 24704
+229.068432 647.67 24704
+229.093264 644.33 24832
+229.118096 644.33 24832
+229.143184 637.76 25088
+229.168272 637.76 25088
+229.193488 634.52 25216
+229.218704 634.52 25216
+229.244048 631.31 25344
+229.269392 631.31 25344
+229.294864 628.14 25472
+229.320336 628.14 25472
+229.345936 625.00 25600
+229.371536 625.00 25600
+229.397136 625.00 25600
+229.422864 621.89 25728
+229.448592 621.89 25728
+229.474448 618.81 25856
+229.500304 618.81 25856
+229.526288 615.76 25984
+229.552272 615.76 25984
+229.578384 612.75 26112
+229.604496 612.75 26112
+229.630736 609.76 26240
+229.656976 609.76 26240
+229.683344 606.80 26368
+229.709712 606.80 26368
+229.736336 600.96 26624
+229.762960 600.96 26624
+229.789712 598.09 26752
+229.816464 598.09 26752
+229.843344 595.24 26880
+229.870224 595.24 26880
+229.897232 592.42 27008
+229.924368 589.62 27136
+229.951504 589.62 27136
+229.978768 586.85 27264
+230.006032 586.85 27264
+230.033424 584.11 27392
+230.060816 584.11 27392
+230.088464 578.70 27648
+230.116112 578.70 27648
+230.143888 576.04 27776
+230.171664 576.04 27776
+230.199568 573.39 27904
+230.227600 570.78 28032
+230.255632 570.78 28032
+230.283792 568.18 28160
+230.311952 568.18 28160
+230.340240 565.61 28288
+230.368528 565.61 28288
+230.397072 560.54 28544
+230.425744 558.04 28672
+230.454416 558.04 28672
+230.483216 555.56 28800
+230.512016 555.56 28800
+230.540944 553.10 28928
+230.570128 548.25 29184
+230.599312 548.25 29184
+230.628624 545.85 29312
+230.657936 545.85 29312
+230.687376 543.48 29440
+230.716944 541.13 29568
+230.746512 541.13 29568
+230.776336 536.48 29824
+230.806288 534.19 29952
+230.836240 534.19 29952
+230.866320 531.91 30080
+230.896528 529.66 30208
+230.926736 529.66 30208
+230.957200 525.21 30464
+230.987792 523.01 30592
+231.018384 523.01 30592
+231.049104 520.83 30720
+231.080080 516.53 30976
+231.111056 516.53 30976
+231.142160 514.40 31104
+231.173392 512.30 31232
+231.204624 512.30 31232
+231.236112 508.13 31488
+231.267728 506.07 31616
+231.299472 504.03 31744
+231.331216 504.03 31744
+231.363216 500.00 32000
+231.395344 498.01 32128
+231.427600 496.03 32256
+231.459856 496.03 32256
+231.492368 492.13 32512
+231.525008 490.20 32640
+231.557776 488.28 32768
+231.590544 488.28 32768
+231.623568 484.50 33024
+231.656592 484.50 33024
+231.689872 480.77 33280
+231.723408 477.10 33536
+231.756944 477.10 33536
+231.790736 473.48 33792
+231.824528 473.48 33792
+231.858576 469.92 34048
+231.892880 466.42 34304
+231.927440 462.96 34560
+231.962000 462.96 34560
+231.996560 462.96 34560
+232.031376 459.56 34816
+232.066448 456.20 35072
+232.101520 456.20 35072
+232.136848 452.90 35328
+232.172432 449.64 35584
+232.208272 446.43 35840
+232.244112 446.43 35840
+232.280208 443.26 36096
+232.316304 443.26 36096
+232.352656 440.14 36352
+232.389264 437.06 36608
+232.426128 434.03 36864
+232.462992 434.03 36864
+232.500112 431.03 37120
+232.537488 428.08 37376
+232.575120 425.17 37632
+232.612752 425.17 37632
+232.650640 422.30 37888
+232.689040 416.67 38400
+232.727696 413.91 38656
+232.766608 411.18 38912
+232.805520 411.18 38912
+232.844688 408.50 39168
+232.884112 405.84 39424
+232.923792 403.23 39680
+232.963728 400.64 39936
+233.003920 398.09 40192
+233.044368 395.57 40448
+233.085072 393.08 40704
+233.126032 390.62 40960
+233.167248 388.20 41216
+233.208720 385.80 41472
+233.250448 383.44 41728
+233.292432 381.10 41984
+233.334672 378.79 42240
+233.377424 374.25 42752
+233.420432 372.02 43008
+233.463696 369.82 43264
+233.507472 365.50 43776
+233.551504 363.37 44032
+233.595792 361.27 44288
+233.640336 359.20 44544
+233.685136 357.14 44800
+233.730448 353.11 45312
+233.776016 351.12 45568
+233.822096 347.22 46080
+233.868432 345.30 46336
+233.915280 341.53 46848
+233.962640 337.84 47360
+234.010256 336.02 47616
+234.058384 332.45 48128
+234.107024 328.95 48640
+234.155920 327.23 48896
+234.205328 323.83 49408
+234.255504 318.88 50176
+234.306192 315.66 50688
+234.357392 312.50 51200
+234.408848 310.95 51456
+234.460816 307.88 51968
+234.513296 304.88 52480
+234.566544 300.48 53248
+234.620304 297.62 53760
+234.674832 293.43 54528
+234.730128 289.35 55296
+234.785936 286.70 55808
+234.842256 284.09 56320
+234.899600 279.02 57344
+234.957456 276.55 57856
+235.016080 272.93 58624
+235.075728 268.24 59648
+235.136144 264.83 60416
+235.197328 261.51 61184
+235.259536 257.20 62208
+235.322768 253.04 63232
+235.387024 249.00 64256
+235.452304 245.10 65280
+235.518352 242.25 66048
+235.585936 236.74 67584
+235.655056 231.48 69120
+235.725200 228.10 70144
+235.796880 223.21 71680
+235.869584 220.07 72704
+235.943824 215.52 74240
+236.019600 211.15 75776
+236.097424 205.59 77824
+236.177296 200.32 79872
+236.259216 195.31 81920
+236.343184 190.55 83968
+236.429712 184.91 86528
+236.518800 179.60 89088
+236.610960 173.61 92160
+236.706192 168.01 95232
+236.805008 161.92 98816
+236.907920 155.47 102912
+237.015440 148.81 107520
+237.128080 142.05 112640
+237.247376 134.12 119296
+237.373840 126.52 126464
+237.509008 118.37 135168
+237.654416 110.04 145408
+237.814160 100.16 159744
+237.992336 89.80 178176
+238.198160 77.74 205824
+238.451088 63.26 252928
+238.807440 44.90 356352
+239.313296 31.63 505856
+EOF
+plot $data using 1:2 with linespoints
+pause -1
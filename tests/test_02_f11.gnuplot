@@ -0,0 +1,8813 @@
+$data <<EOF
+0.356352 44.90 356352
+0.609280 63.26 252928
+0.815104 77.74 205824
+0.993280 89.80 178176
+1.153024 100.16 159744
+1.298432 110.04 145408
+1.433600 118.37 135168
+1.560064 126.52 126464
+1.679360 134.12 119296
+1.792000 142.05 112640
+1.899520 148.81 107520
+2.002432 155.47 102912
+2.101248 161.92 98816
+2.196480 168.01 95232
+2.288640 173.61 92160
+2.377728 179.60 89088
+2.464256 184.91 86528
+2.548224 190.55 83968
+2.630144 195.31 81920
+2.710016 200.32 79872
+2.787840 205.59 77824
+2.863616 211.15 75776
+2.937856 215.52 74240
+3.010560 220.07 72704
+3.082240 223.21 71680
+3.152384 228.10 70144
+3.221504 231.48 69120
+3.289088 236.74 67584
+3.355136 242.25 66048
+3.420416 245.10 65280
+3.484672 249.00 64256
+3.547904 253.04 63232
+3.610112 257.20 62208
+3.671296 261.51 61184
+3.731712 264.83 60416
+3.791360 268.24 59648
+3.849984 272.93 58624
+3.907840 276.55 57856
+3.965184 279.02 57344
+4.021504 284.09 56320
+4.077312 286.70 55808
+4.132608 289.35 55296
+4.187136 293.43 54528
+4.240896 297.62 53760
+4.294144 300.48 53248
+4.346624 304.88 52480
+4.398592 307.88 51968
+4.450048 310.95 51456
+4.501248 312.50 51200
+4.551936 315.66 50688
+4.602112 318.88 50176
+4.651520 323.83 49408
+4.700416 327.23 48896
+4.749056 328.95 48640
+4.797184 332.45 48128
+4.844800 336.02 47616
+4.892160 337.84 47360
+4.939008 341.53 46848
+4.985344 345.30 46336
+5.031424 347.22 46080
+5.076992 351.12 45568
+5.122304 353.11 45312
+5.167104 357.14 44800
+5.211648 359.20 44544
+5.255936 361.27 44288
+5.299968 363.37 44032
+5.343744 365.50 43776
+5.387008 369.82 43264
+5.430016 372.02 43008
+5.472768 374.25 42752
+5.515008 378.79 42240
+5.556992 381.10 41984
+5.598720 383.44 41728
+5.640192 385.80 41472
+5.681408 388.20 41216
+5.722368 390.62 40960
+5.763072 393.08 40704
+5.803520 395.57 40448
+5.843712 398.09 40192
+5.883648 400.64 39936
+5.923328 403.23 39680
+5.962752 405.84 39424
+6.001920 408.50 39168
+6.040832 411.18 38912
+6.079744 411.18 38912
+6.118400 413.91 38656
+6.156800 416.67 38400
+6.194688 422.30 37888
+6.232320 425.17 37632
+6.269952 425.17 37632
+6.307328 428.08 37376
+6.344448 431.03 37120
+6.381312 434.03 36864
+6.418176 434.03 36864
+6.454784 437.06 36608
+6.491136 440.14 36352
+6.527232 443.26 36096
+6.563328 443.26 36096
+6.599168 446.43 35840
+6.635008 446.43 35840
+6.670592 449.64 35584
+6.705920 452.90 35328
+6.740992 456.20 35072
+6.776064 456.20 35072
+6.810880 459.56 34816
+6.845440 462.96 34560
+6.880000 462.96 34560
+6.914560 462.96 34560
+6.948864 466.42 34304
+6.982912 469.92 34048
+7.016704 473.48 33792
+7.050496 473.48 33792
+7.084032 477.10 33536
+7.117568 477.10 33536
+7.150848 480.77 33280
+7.183872 484.50 33024
+7.216896 484.50 33024
+7.249664 488.28 32768
+7.282432 488.28 32768
+7.315072 490.20 32640
+7.347584 492.13 32512
+7.379840 496.03 32256
+7.412096 496.03 32256
+7.444224 498.01 32128
+7.476224 500.00 32000
+7.507968 504.03 31744
+7.539712 504.03 31744
+7.571328 506.07 31616
+7.602816 508.13 31488
+7.634048 512.30 31232
+7.665280 512.30 31232
+7.696384 514.40 31104
+7.727360 516.53 30976
+7.758336 516.53 30976
+7.789056 520.83 30720
+7.819648 523.01 30592
+7.850240 523.01 30592
+7.880704 525.21 30464
+7.910912 529.66 30208
+7.941120 529.66 30208
+7.971200 531.91 30080
+8.001152 534.19 29952
+8.031104 534.19 29952
+8.060928 536.48 29824
+8.090496 541.13 29568
+8.120064 541.13 29568
+8.149504 543.48 29440
+8.178816 545.85 29312
+8.208128 545.85 29312
+8.237312 548.25 29184
+8.266496 548.25 29184
+8.295424 553.10 28928
+8.324224 555.56 28800
+8.353024 555.56 28800
+8.381696 558.04 28672
+8.410368 558.04 28672
+8.438912 560.54 28544
+8.467200 565.61 28288
+8.495488 565.61 28288
+8.523648 568.18 28160
+8.551808 568.18 28160
+8.579840 570.78 28032
+8.607872 570.78 28032
+8.635776 573.39 27904
+8.663552 576.04 27776
+8.691328 576.04 27776
+8.718976 578.70 27648
+8.746624 578.70 27648
+8.774016 584.11 27392
+8.801408 584.11 27392
+8.828672 586.85 27264
+8.855936 586.85 27264
+8.883072 589.62 27136
+8.910208 589.62 27136
+8.937216 592.42 27008
+8.964096 595.24 26880
+8.990976 595.24 26880
+9.017728 598.09 26752
+9.044480 598.09 26752
+9.071104 600.96 26624
+9.097728 600.96 26624
+9.124096 606.80 26368
+9.150464 606.80 26368
+9.176704 609.76 26240
+9.202944 609.76 26240
+9.229056 612.75 26112
+9.255168 612.75 26112
+9.281152 615.76 25984
+9.307136 615.76 25984
+9.332992 618.81 25856
+9.358848 618.81 25856
+9.384576 621.89 25728
+9.410304 621.89 25728
+9.435904 625.00 25600
+9.461504 625.00 25600
+9.487104 625.00 25600
+9.512576 628.14 25472
+9.538048 628.14 25472
+9.563392 631.31 25344
+9.588736 631.31 25344
+9.613952 634.52 25216
+9.639168 634.52 25216
+9.664256 637.76 25088
+9.689344 637.76 25088
+9.714176 644.33 24832
+9.739008 644.33 24832
+9.763712 647.67 24704
+9.788416 647.67 24704
+9.813120 647.67 24704
+9.837696 651.04 24576
+9.862272 651.04 24576
+9.886720 654.45 24448
+9.911168 654.45 24448
+9.935488 657.89 24320
+9.959808 657.89 24320
+9.984128 657.89 24320
+10.008320 661.38 24192
+10.032512 661.38 24192
+10.056576 664.89 24064
+10.080640 664.89 24064
+10.104576 668.45 23936
+10.128512 668.45 23936
+10.152448 668.45 23936
+10.176256 672.04 23808
+10.200064 672.04 23808
+10.223744 675.68 23680
+10.247424 675.68 23680
+10.271104 675.68 23680
+10.294656 679.35 23552
+10.318208 679.35 23552
+10.341632 683.06 23424
+10.365056 683.06 23424
+10.388480 683.06 23424
+10.411776 686.81 23296
+10.435072 686.81 23296
+10.458240 690.61 23168
+10.481408 690.61 23168
+10.504576 690.61 23168
+10.527616 694.44 23040
+10.550656 694.44 23040
+10.573568 698.32 22912
+10.596480 698.32 22912
+10.619392 698.32 22912
+10.642176 702.25 22784
+10.664960 702.25 22784
+10.687744 702.25 22784
+10.710400 706.21 22656
+10.733056 706.21 22656
+10.755584 710.23 22528
+10.778112 710.23 22528
+10.800640 710.23 22528
+10.823040 714.29 22400
+10.845440 714.29 22400
+10.867840 714.29 22400
+10.890112 718.39 22272
+10.912384 718.39 22272
+10.934656 718.39 22272
+10.956928 718.39 22272
+10.979200 718.39 22272
+11.001344 722.54 22144
+11.023488 722.54 22144
+11.045632 722.54 22144
+11.067776 722.54 22144
+11.089792 726.74 22016
+11.111808 726.74 22016
+11.133696 730.99 21888
+11.155584 730.99 21888
+11.177472 730.99 21888
+11.199360 730.99 21888
+11.221120 735.29 21760
+11.242880 735.29 21760
+11.264512 739.64 21632
+11.286144 739.64 21632
+11.307776 739.64 21632
+11.329408 739.64 21632
+11.350912 744.05 21504
+11.372416 744.05 21504
+11.393792 748.50 21376
+11.415168 748.50 21376
+11.436544 748.50 21376
+11.457920 748.50 21376
+11.479168 753.01 21248
+11.500416 753.01 21248
+11.521536 757.58 21120
+11.542656 757.58 21120
+11.563776 757.58 21120
+11.584896 757.58 21120
+11.605888 762.20 20992
+11.626880 762.20 20992
+11.647744 766.87 20864
+11.668608 766.87 20864
+11.689472 766.87 20864
+11.710336 766.87 20864
+11.731200 766.87 20864
+11.752064 766.87 20864
+11.772800 771.60 20736
+11.793536 771.60 20736
+11.814272 771.60 20736
+11.835008 771.60 20736
+11.855616 776.40 20608
+11.876224 776.40 20608
+11.896832 776.40 20608
+11.917440 776.40 20608
+11.937920 781.25 20480
+11.958400 781.25 20480
+11.978752 786.16 20352
+11.999104 786.16 20352
+12.019456 786.16 20352
+12.039808 786.16 20352
+12.060032 791.14 20224
+12.080256 791.14 20224
+12.100480 791.14 20224
+12.120704 791.14 20224
+12.140800 796.18 20096
+12.160896 796.18 20096
+12.180992 796.18 20096
+12.201088 796.18 20096
+12.221184 796.18 20096
+12.241280 796.18 20096
+12.261248 801.28 19968
+12.281216 801.28 19968
+12.301184 801.28 19968
+12.321152 801.28 19968
+12.340992 806.45 19840
+12.360832 806.45 19840
+12.380672 806.45 19840
+12.400512 806.45 19840
+12.420224 811.69 19712
+12.439936 811.69 19712
+12.459520 816.99 19584
+12.479104 816.99 19584
+12.498688 816.99 19584
+12.518272 816.99 19584
+12.537728 822.37 19456
+12.557184 822.37 19456
+12.576640 822.37 19456
+12.596096 822.37 19456
+12.615552 822.37 19456
+12.635008 822.37 19456
+12.654464 822.37 19456
+12.673920 822.37 19456
+12.693248 827.81 19328
+12.712576 827.81 19328
+12.731904 827.81 19328
+12.751232 827.81 19328
+12.770432 833.33 19200
+12.789632 833.33 19200
+12.808832 833.33 19200
+12.828032 833.33 19200
+12.847104 838.93 19072
+12.866176 838.93 19072
+12.885120 844.59 18944
+12.904064 844.59 18944
+12.923008 844.59 18944
+12.941952 844.59 18944
+12.960768 850.34 18816
+12.979584 850.34 18816
+12.998400 850.34 18816
+13.017216 850.34 18816
+13.036032 850.34 18816
+13.054848 850.34 18816
+13.073664 850.34 18816
+13.092480 850.34 18816
+13.111168 856.16 18688
+13.129856 856.16 18688
+13.148544 856.16 18688
+13.167232 856.16 18688
+13.185792 862.07 18560
+13.204352 862.07 18560
+13.222912 862.07 18560
+13.241472 862.07 18560
+13.259904 868.06 18432
+13.278336 868.06 18432
+13.296768 868.06 18432
+13.315200 868.06 18432
+13.333632 868.06 18432
+13.352064 868.06 18432
+13.370496 868.06 18432
+13.388928 868.06 18432
+13.407232 874.13 18304
+13.425536 874.13 18304
+13.443840 874.13 18304
+13.462144 874.13 18304
+13.480320 880.28 18176
+13.498496 880.28 18176
+13.516672 880.28 18176
+13.534848 880.28 18176
+13.552896 886.52 18048
+13.570944 886.52 18048
+13.588992 886.52 18048
+13.607040 886.52 18048
+13.625088 886.52 18048
+13.643136 886.52 18048
+13.661056 892.86 17920
+13.678976 892.86 17920
+13.696896 892.86 17920
+13.714816 892.86 17920
+13.732736 892.86 17920
+13.750656 892.86 17920
+13.768576 892.86 17920
+13.786496 892.86 17920
+13.804288 899.28 17792
+13.822080 899.28 17792
+13.839872 899.28 17792
+13.857664 899.28 17792
+13.875328 905.80 17664
+13.892992 905.80 17664
+13.910656 905.80 17664
+13.928320 905.80 17664
+13.945856 912.41 17536
+13.963392 912.41 17536
+13.980928 912.41 17536
+13.998464 912.41 17536
+14.016000 912.41 17536
+14.033536 912.41 17536
+14.051072 912.41 17536
+14.068608 912.41 17536
+14.086144 912.41 17536
+14.103680 912.41 17536
+14.121088 919.12 17408
+14.138496 919.12 17408
+14.155904 919.12 17408
+14.173312 919.12 17408
+14.190592 925.93 17280
+14.207872 925.93 17280
+14.225152 925.93 17280
+14.242432 925.93 17280
+14.259712 925.93 17280
+14.276992 925.93 17280
+14.294272 925.93 17280
+14.311552 925.93 17280
+14.328832 925.93 17280
+14.346112 925.93 17280
+14.363264 932.84 17152
+14.380416 932.84 17152
+14.397568 932.84 17152
+14.414720 932.84 17152
+14.431744 939.85 17024
+14.448768 939.85 17024
+14.465792 939.85 17024
+14.482816 939.85 17024
+14.499712 946.97 16896
+14.516608 946.97 16896
+14.533504 946.97 16896
+14.550400 946.97 16896
+14.567296 946.97 16896
+14.584192 946.97 16896
+14.601088 946.97 16896
+14.617984 946.97 16896
+14.634880 946.97 16896
+14.651776 946.97 16896
+14.668544 954.20 16768
+14.685312 954.20 16768
+14.702080 954.20 16768
+14.718848 954.20 16768
+14.735616 954.20 16768
+14.752384 954.20 16768
+14.769024 961.54 16640
+14.785664 961.54 16640
+14.802304 961.54 16640
+14.818944 961.54 16640
+14.835456 968.99 16512
+14.851968 968.99 16512
+14.868480 968.99 16512
+14.884992 968.99 16512
+14.901504 968.99 16512
+14.918016 968.99 16512
+14.934528 968.99 16512
+14.951040 968.99 16512
+14.967552 968.99 16512
+14.984064 968.99 16512
+15.000448 976.56 16384
+15.016832 976.56 16384
+15.033216 976.56 16384
+15.049600 976.56 16384
+15.065984 976.56 16384
+15.082368 976.56 16384
+15.098688 980.39 16320
+15.115008 980.39 16320
+15.131328 980.39 16320
+15.147648 980.39 16320
+15.163904 984.25 16256
+15.180160 984.25 16256
+15.196416 984.25 16256
+15.212672 984.25 16256
+15.228928 984.25 16256
+15.245184 984.25 16256
+15.261312 992.06 16128
+15.277440 992.06 16128
+15.293568 992.06 16128
+15.309696 992.06 16128
+15.325824 992.06 16128
+15.341952 992.06 16128
+15.358016 996.02 16064
+15.374080 996.02 16064
+15.390144 996.02 16064
+15.406208 996.02 16064
+15.422208 1000.00 16000
+15.438208 1000.00 16000
+15.454208 1000.00 16000
+15.470208 1000.00 16000
+15.486208 1000.00 16000
+15.502208 1000.00 16000
+15.518080 1008.06 15872
+15.533952 1008.06 15872
+15.549824 1008.06 15872
+15.565696 1008.06 15872
+15.581568 1008.06 15872
+15.597440 1008.06 15872
+15.613248 1012.15 15808
+15.629056 1012.15 15808
+15.644864 1012.15 15808
+15.660672 1012.15 15808
+15.676480 1012.15 15808
+15.692288 1012.15 15808
+15.708032 1016.26 15744
+15.723776 1016.26 15744
+15.739520 1016.26 15744
+15.755264 1016.26 15744
+15.770880 1024.59 15616
+15.786496 1024.59 15616
+15.802112 1024.59 15616
+15.817728 1024.59 15616
+15.833344 1024.59 15616
+15.848960 1024.59 15616
+15.864576 1024.59 15616
+15.880192 1024.59 15616
+15.895744 1028.81 15552
+15.911296 1028.81 15552
+15.926848 1028.81 15552
+15.942400 1028.81 15552
+15.957888 1033.06 15488
+15.973376 1033.06 15488
+15.988864 1033.06 15488
+16.004352 1033.06 15488
+16.019840 1033.06 15488
+16.035328 1033.06 15488
+16.050816 1033.06 15488
+16.066304 1033.06 15488
+16.081664 1041.67 15360
+16.097024 1041.67 15360
+16.112384 1041.67 15360
+16.127744 1041.67 15360
+16.143040 1046.03 15296
+16.158336 1046.03 15296
+16.173632 1046.03 15296
+16.188928 1046.03 15296
+16.204224 1046.03 15296
+16.219520 1046.03 15296
+16.234816 1046.03 15296
+16.250112 1046.03 15296
+16.265344 1050.42 15232
+16.280576 1050.42 15232
+16.295808 1050.42 15232
+16.311040 1050.42 15232
+16.326144 1059.32 15104
+16.341248 1059.32 15104
+16.356352 1059.32 15104
+16.371456 1059.32 15104
+16.386560 1059.32 15104
+16.401664 1059.32 15104
+16.416768 1059.32 15104
+16.431872 1059.32 15104
+16.446912 1063.83 15040
+16.461952 1063.83 15040
+16.476992 1063.83 15040
+16.492032 1063.83 15040
+16.507008 1068.38 14976
+16.521984 1068.38 14976
+16.536960 1068.38 14976
+16.551936 1068.38 14976
+16.566912 1068.38 14976
+16.581888 1068.38 14976
+16.596864 1068.38 14976
+16.611840 1068.38 14976
+16.626752 1072.96 14912
+16.641664 1072.96 14912
+16.656576 1072.96 14912
+16.671488 1072.96 14912
+16.686272 1082.25 14784
+16.701056 1082.25 14784
+16.715840 1082.25 14784
+16.730624 1082.25 14784
+16.745408 1082.25 14784
+16.760192 1082.25 14784
+16.774976 1082.25 14784
+16.789760 1082.25 14784
+16.804480 1086.96 14720
+16.819200 1086.96 14720
+16.833920 1086.96 14720
+16.848640 1086.96 14720
+16.863296 1091.70 14656
+16.877952 1091.70 14656
+16.892608 1091.70 14656
+16.907264 1091.70 14656
+16.921920 1091.70 14656
+16.936576 1091.70 14656
+16.951232 1091.70 14656
+16.965888 1091.70 14656
+16.980480 1096.49 14592
+16.995072 1096.49 14592
+17.009664 1096.49 14592
+17.024256 1096.49 14592
+17.038848 1096.49 14592
+17.053440 1096.49 14592
+17.068032 1096.49 14592
+17.082624 1096.49 14592
+17.097088 1106.19 14464
+17.111552 1106.19 14464
+17.126016 1106.19 14464
+17.140480 1106.19 14464
+17.154880 1111.11 14400
+17.169280 1111.11 14400
+17.183680 1111.11 14400
+17.198080 1111.11 14400
+17.212480 1111.11 14400
+17.226880 1111.11 14400
+17.241280 1111.11 14400
+17.255680 1111.11 14400
+17.270016 1116.07 14336
+17.284352 1116.07 14336
+17.298688 1116.07 14336
+17.313024 1116.07 14336
+17.327360 1116.07 14336
+17.341696 1116.07 14336
+17.356032 1116.07 14336
+17.370368 1116.07 14336
+17.384640 1121.08 14272
+17.398912 1121.08 14272
+17.413184 1121.08 14272
+17.427456 1121.08 14272
+17.441600 1131.22 14144
+17.455744 1131.22 14144
+17.469888 1131.22 14144
+17.484032 1131.22 14144
+17.498176 1131.22 14144
+17.512320 1131.22 14144
+17.526464 1131.22 14144
+17.540608 1131.22 14144
+17.554688 1136.36 14080
+17.568768 1136.36 14080
+17.582848 1136.36 14080
+17.596928 1136.36 14080
+17.611008 1136.36 14080
+17.625088 1136.36 14080
+17.639168 1136.36 14080
+17.653248 1136.36 14080
+17.667264 1141.55 14016
+17.681280 1141.55 14016
+17.695296 1141.55 14016
+17.709312 1141.55 14016
+17.723328 1141.55 14016
+17.737344 1141.55 14016
+17.751360 1141.55 14016
+17.765376 1141.55 14016
+17.779328 1146.79 13952
+17.793280 1146.79 13952
+17.807232 1146.79 13952
+17.821184 1146.79 13952
+17.835072 1152.07 13888
+17.848960 1152.07 13888
+17.862848 1152.07 13888
+17.876736 1152.07 13888
+17.890624 1152.07 13888
+17.904512 1152.07 13888
+17.918400 1152.07 13888
+17.932288 1152.07 13888
+17.946112 1157.41 13824
+17.959936 1157.41 13824
+17.973760 1157.41 13824
+17.987584 1157.41 13824
+18.001408 1157.41 13824
+18.015232 1157.41 13824
+18.029056 1157.41 13824
+18.042880 1157.41 13824
+18.056576 1168.22 13696
+18.070272 1168.22 13696
+18.083968 1168.22 13696
+18.097664 1168.22 13696
+18.111360 1168.22 13696
+18.125056 1168.22 13696
+18.138752 1168.22 13696
+18.152448 1168.22 13696
+18.166080 1173.71 13632
+18.179712 1173.71 13632
+18.193344 1173.71 13632
+18.206976 1173.71 13632
+18.220608 1173.71 13632
+18.234240 1173.71 13632
+18.247872 1173.71 13632
+18.261504 1173.71 13632
+18.275072 1179.25 13568
+18.288640 1179.25 13568
+18.302208 1179.25 13568
+18.315776 1179.25 13568
+18.329344 1179.25 13568
+18.342912 1179.25 13568
+18.356480 1179.25 13568
+18.370048 1179.25 13568
+18.383552 1184.83 13504
+18.397056 1184.83 13504
+18.410560 1184.83 13504
+18.424064 1184.83 13504
+18.437504 1190.48 13440
+18.450944 1190.48 13440
+18.464384 1190.48 13440
+18.477824 1190.48 13440
+18.491264 1190.48 13440
+18.504704 1190.48 13440
+18.518144 1190.48 13440
+18.531584 1190.48 13440
+18.544960 1196.17 13376
+18.558336 1196.17 13376
+18.571712 1196.17 13376
+18.585088 1196.17 13376
+18.598464 1196.17 13376
+18.611840 1196.17 13376
+18.625216 1196.17 13376
+18.638592 1196.17 13376
+18.651904 1201.92 13312
+18.665216 1201.92 13312
+18.678528 1201.92 13312
+18.691840 1201.92 13312
+18.705152 1201.92 13312
+18.718464 1201.92 13312
+18.731776 1201.92 13312
+18.745088 1201.92 13312
+18.758272 1213.59 13184
+18.771456 1213.59 13184
+18.784640 1213.59 13184
+18.797824 1213.59 13184
+18.811008 1213.59 13184
+18.824192 1213.59 13184
+18.837376 1213.59 13184
+18.850560 1213.59 13184
+18.863680 1219.51 13120
+18.876800 1219.51 13120
+18.889920 1219.51 13120
+18.903040 1219.51 13120
+18.916160 1219.51 13120
+18.929280 1219.51 13120
+18.942400 1219.51 13120
+18.955520 1219.51 13120
+18.968576 1225.49 13056
+18.981632 1225.49 13056
+18.994688 1225.49 13056
+19.007744 1225.49 13056
+19.020800 1225.49 13056
+19.033856 1225.49 13056
+19.046912 1225.49 13056
+19.059968 1225.49 13056
+19.072960 1231.53 12992
+19.085952 1231.53 12992
+19.098944 1231.53 12992
+19.111936 1231.53 12992
+19.124928 1231.53 12992
+19.137920 1231.53 12992
+19.150912 1231.53 12992
+19.163904 1231.53 12992
+19.176832 1237.62 12928
+19.189760 1237.62 12928
+19.202688 1237.62 12928
+19.215616 1237.62 12928
+19.228544 1237.62 12928
+19.241472 1237.62 12928
+19.254400 1237.62 12928
+19.267328 1237.62 12928
+19.280192 1243.78 12864
+19.293056 1243.78 12864
+19.305920 1243.78 12864
+19.318784 1243.78 12864
+19.331648 1243.78 12864
+19.344512 1243.78 12864
+19.357376 1243.78 12864
+19.370240 1243.78 12864
+19.383040 1250.00 12800
+19.395840 1250.00 12800
+19.408640 1250.00 12800
+19.421440 1250.00 12800
+19.434240 1250.00 12800
+19.447040 1250.00 12800
+19.459840 1250.00 12800
+19.472640 1250.00 12800
+19.485440 1250.00 12800
+19.498240 1250.00 12800
+19.511040 1250.00 12800
+19.523840 1250.00 12800
+19.536576 1256.28 12736
+19.549312 1256.28 12736
+19.562048 1256.28 12736
+19.574784 1256.28 12736
+19.587520 1256.28 12736
+19.600256 1256.28 12736
+19.612992 1256.28 12736
+19.625728 1256.28 12736
+19.638400 1262.63 12672
+19.651072 1262.63 12672
+19.663744 1262.63 12672
+19.676416 1262.63 12672
+19.689088 1262.63 12672
+19.701760 1262.63 12672
+19.714432 1262.63 12672
+19.727104 1262.63 12672
+19.739712 1269.04 12608
+19.752320 1269.04 12608
+19.764928 1269.04 12608
+19.777536 1269.04 12608
+19.790144 1269.04 12608
+19.802752 1269.04 12608
+19.815360 1269.04 12608
+19.827968 1269.04 12608
+19.840512 1275.51 12544
+19.853056 1275.51 12544
+19.865600 1275.51 12544
+19.878144 1275.51 12544
+19.890688 1275.51 12544
+19.903232 1275.51 12544
+19.915776 1275.51 12544
+19.928320 1275.51 12544
+19.940736 1288.66 12416
+19.953152 1288.66 12416
+19.965568 1288.66 12416
+19.977984 1288.66 12416
+19.990400 1288.66 12416
+20.002816 1288.66 12416
+20.015232 1288.66 12416
+20.027648 1288.66 12416
+20.040000 1295.34 12352
+20.052352 1295.34 12352
+20.064704 1295.34 12352
+20.077056 1295.34 12352
+20.089408 1295.34 12352
+20.101760 1295.34 12352
+20.114112 1295.34 12352
+20.126464 1295.34 12352
+20.138816 1295.34 12352
+20.151168 1295.34 12352
+20.163520 1295.34 12352
+20.175872 1295.34 12352
+20.188160 1302.08 12288
+20.200448 1302.08 12288
+20.212736 1302.08 12288
+20.225024 1302.08 12288
+20.237312 1302.08 12288
+20.249600 1302.08 12288
+20.261888 1302.08 12288
+20.274176 1302.08 12288
+20.286400 1308.90 12224
+20.298624 1308.90 12224
+20.310848 1308.90 12224
+20.323072 1308.90 12224
+20.335296 1308.90 12224
+20.347520 1308.90 12224
+20.359744 1308.90 12224
+20.371968 1308.90 12224
+20.384128 1315.79 12160
+20.396288 1315.79 12160
+20.408448 1315.79 12160
+20.420608 1315.79 12160
+20.432768 1315.79 12160
+20.444928 1315.79 12160
+20.457088 1315.79 12160
+20.469248 1315.79 12160
+20.481408 1315.79 12160
+20.493568 1315.79 12160
+20.505728 1315.79 12160
+20.517888 1315.79 12160
+20.529984 1322.75 12096
+20.542080 1322.75 12096
+20.554176 1322.75 12096
+20.566272 1322.75 12096
+20.578368 1322.75 12096
+20.590464 1322.75 12096
+20.602560 1322.75 12096
+20.614656 1322.75 12096
+20.626688 1329.79 12032
+20.638720 1329.79 12032
+20.650752 1329.79 12032
+20.662784 1329.79 12032
+20.674816 1329.79 12032
+20.686848 1329.79 12032
+20.698880 1329.79 12032
+20.710912 1329.79 12032
+20.722880 1336.90 11968
+20.734848 1336.90 11968
+20.746816 1336.90 11968
+20.758784 1336.90 11968
+20.770752 1336.90 11968
+20.782720 1336.90 11968
+20.794688 1336.90 11968
+20.806656 1336.90 11968
+20.818624 1336.90 11968
+20.830592 1336.90 11968
+20.842560 1336.90 11968
+20.854528 1336.90 11968
+20.866432 1344.09 11904
+20.878336 1344.09 11904
+20.890240 1344.09 11904
+20.902144 1344.09 11904
+20.914048 1344.09 11904
+20.925952 1344.09 11904
+20.937856 1344.09 11904
+20.949760 1344.09 11904
+20.961600 1351.35 11840
+20.973440 1351.35 11840
+20.985280 1351.35 11840
+20.997120 1351.35 11840
+21.008960 1351.35 11840
+21.020800 1351.35 11840
+21.032640 1351.35 11840
+21.044480 1351.35 11840
+21.056320 1351.35 11840
+21.068160 1351.35 11840
+21.080000 1351.35 11840
+21.091840 1351.35 11840
+21.103616 1358.70 11776
+21.115392 1358.70 11776
+21.127168 1358.70 11776
+21.138944 1358.70 11776
+21.150720 1358.70 11776
+21.162496 1358.70 11776
+21.174272 1358.70 11776
+21.186048 1358.70 11776
+21.197760 1366.12 11712
+21.209472 1366.12 11712
+21.221184 1366.12 11712
+21.232896 1366.12 11712
+21.244608 1366.12 11712
+21.256320 1366.12 11712
+21.268032 1366.12 11712
+21.279744 1366.12 11712
+21.291456 1366.12 11712
+21.303168 1366.12 11712
+21.314880 1366.12 11712
+21.326592 1366.12 11712
+21.338240 1373.63 11648
+21.349888 1373.63 11648
+21.361536 1373.63 11648
+21.373184 1373.63 11648
+21.384832 1373.63 11648
+21.396480 1373.63 11648
+21.408128 1373.63 11648
+21.419776 1373.63 11648
+21.431360 1381.22 11584
+21.442944 1381.22 11584
+21.454528 1381.22 11584
+21.466112 1381.22 11584
+21.477696 1381.22 11584
+21.489280 1381.22 11584
+21.500864 1381.22 11584
+21.512448 1381.22 11584
+21.524032 1381.22 11584
+21.535616 1381.22 11584
+21.547200 1381.22 11584
+21.558784 1381.22 11584
+21.570304 1388.89 11520
+21.581824 1388.89 11520
+21.593344 1388.89 11520
+21.604864 1388.89 11520
+21.616384 1388.89 11520
+21.627904 1388.89 11520
+21.639424 1388.89 11520
+21.650944 1388.89 11520
+21.662400 1396.65 11456
+21.673856 1396.65 11456
+21.685312 1396.65 11456
+21.696768 1396.65 11456
+21.708224 1396.65 11456
+21.719680 1396.65 11456
+21.731136 1396.65 11456
+21.742592 1396.65 11456
+21.754048 1396.65 11456
+21.765504 1396.65 11456
+21.776960 1396.65 11456
+21.788416 1396.65 11456
+21.799808 1404.49 11392
+21.811200 1404.49 11392
+21.822592 1404.49 11392
+21.833984 1404.49 11392
+21.845376 1404.49 11392
+21.856768 1404.49 11392
+21.868160 1404.49 11392
+21.879552 1404.49 11392
+21.890944 1404.49 11392
+21.902336 1404.49 11392
+21.913728 1404.49 11392
+21.925120 1404.49 11392
+21.936448 1412.43 11328
+21.947776 1412.43 11328
+21.959104 1412.43 11328
+21.970432 1412.43 11328
+21.981760 1412.43 11328
+21.993088 1412.43 11328
+22.004416 1412.43 11328
+22.015744 1412.43 11328
+22.027008 1420.45 11264
+22.038272 1420.45 11264
+22.049536 1420.45 11264
+22.060800 1420.45 11264
+22.072064 1420.45 11264
+22.083328 1420.45 11264
+22.094592 1420.45 11264
+22.105856 1420.45 11264
+22.117120 1420.45 11264
+22.128384 1420.45 11264
+22.139648 1420.45 11264
+22.150912 1420.45 11264
+22.162112 1428.57 11200
+22.173312 1428.57 11200
+22.184512 1428.57 11200
+22.195712 1428.57 11200
+22.206912 1428.57 11200
+22.218112 1428.57 11200
+22.229312 1428.57 11200
+22.240512 1428.57 11200
+22.251712 1428.57 11200
+22.262912 1428.57 11200
+22.274112 1428.57 11200
+22.285312 1428.57 11200
+22.296448 1436.78 11136
+22.307584 1436.78 11136
+22.318720 1436.78 11136
+22.329856 1436.78 11136
+22.340992 1436.78 11136
+22.352128 1436.78 11136
+22.363264 1436.78 11136
+22.374400 1436.78 11136
+22.385536 1436.78 11136
+22.396672 1436.78 11136
+22.407808 1436.78 11136
+22.418944 1436.78 11136
+22.430080 1436.78 11136
+22.441216 1436.78 11136
+22.452352 1436.78 11136
+22.463488 1436.78 11136
+22.474624 1436.78 11136
+22.485760 1436.78 11136
+22.496896 1436.78 11136
+22.508032 1436.78 11136
+22.519104 1445.09 11072
+22.530176 1445.09 11072
+22.541248 1445.09 11072
+22.552320 1445.09 11072
+22.563392 1445.09 11072
+22.574464 1445.09 11072
+22.585536 1445.09 11072
+22.596608 1445.09 11072
+22.607680 1445.09 11072
+22.618752 1445.09 11072
+22.629824 1445.09 11072
+22.640896 1445.09 11072
+22.651968 1445.09 11072
+22.663040 1445.09 11072
+22.674112 1445.09 11072
+22.685184 1445.09 11072
+22.696192 1453.49 11008
+22.707200 1453.49 11008
+22.718208 1453.49 11008
+22.729216 1453.49 11008
+22.740224 1453.49 11008
+22.751232 1453.49 11008
+22.762240 1453.49 11008
+22.773248 1453.49 11008
+22.784192 1461.99 10944
+22.795136 1461.99 10944
+22.806080 1461.99 10944
+22.817024 1461.99 10944
+22.827968 1461.99 10944
+22.838912 1461.99 10944
+22.849856 1461.99 10944
+22.860800 1461.99 10944
+22.871744 1461.99 10944
+22.882688 1461.99 10944
+22.893632 1461.99 10944
+22.904576 1461.99 10944
+22.915520 1461.99 10944
+22.926464 1461.99 10944
+22.937408 1461.99 10944
+22.948352 1461.99 10944
+22.959232 1470.59 10880
+22.970112 1470.59 10880
+22.980992 1470.59 10880
+22.991872 1470.59 10880
+23.002752 1470.59 10880
+23.013632 1470.59 10880
+23.024512 1470.59 10880
+23.035392 1470.59 10880
+23.046208 1479.29 10816
+23.057024 1479.29 10816
+23.067840 1479.29 10816
+23.078656 1479.29 10816
+23.089472 1479.29 10816
+23.100288 1479.29 10816
+23.111104 1479.29 10816
+23.121920 1479.29 10816
+23.132736 1479.29 10816
+23.143552 1479.29 10816
+23.154368 1479.29 10816
+23.165184 1479.29 10816
+23.176000 1479.29 10816
+23.186816 1479.29 10816
+23.197632 1479.29 10816
+23.208448 1479.29 10816
+23.219200 1488.10 10752
+23.229952 1488.10 10752
+23.240704 1488.10 10752
+23.251456 1488.10 10752
+23.262208 1488.10 10752
+23.272960 1488.10 10752
+23.283712 1488.10 10752
+23.294464 1488.10 10752
+23.305152 1497.01 10688
+23.315840 1497.01 10688
+23.326528 1497.01 10688
+23.337216 1497.01 10688
+23.347904 1497.01 10688
+23.358592 1497.01 10688
+23.369280 1497.01 10688
+23.379968 1497.01 10688
+23.390656 1497.01 10688
+23.401344 1497.01 10688
+23.412032 1497.01 10688
+23.422720 1497.01 10688
+23.433408 1497.01 10688
+23.444096 1497.01 10688
+23.454784 1497.01 10688
+23.465472 1497.01 10688
+23.476096 1506.02 10624
+23.486720 1506.02 10624
+23.497344 1506.02 10624
+23.507968 1506.02 10624
+23.518592 1506.02 10624
+23.529216 1506.02 10624
+23.539840 1506.02 10624
+23.550464 1506.02 10624
+23.561024 1515.15 10560
+23.571584 1515.15 10560
+23.582144 1515.15 10560
+23.592704 1515.15 10560
+23.603264 1515.15 10560
+23.613824 1515.15 10560
+23.624384 1515.15 10560
+23.634944 1515.15 10560
+23.645504 1515.15 10560
+23.656064 1515.15 10560
+23.666624 1515.15 10560
+23.677184 1515.15 10560
+23.687744 1515.15 10560
+23.698304 1515.15 10560
+23.708864 1515.15 10560
+23.719424 1515.15 10560
+23.729920 1524.39 10496
+23.740416 1524.39 10496
+23.750912 1524.39 10496
+23.761408 1524.39 10496
+23.771904 1524.39 10496
+23.782400 1524.39 10496
+23.792896 1524.39 10496
+23.803392 1524.39 10496
+23.813824 1533.74 10432
+23.824256 1533.74 10432
+23.834688 1533.74 10432
+23.845120 1533.74 10432
+23.855552 1533.74 10432
+23.865984 1533.74 10432
+23.876416 1533.74 10432
+23.886848 1533.74 10432
+23.897280 1533.74 10432
+23.907712 1533.74 10432
+23.918144 1533.74 10432
+23.928576 1533.74 10432
+23.939008 1533.74 10432
+23.949440 1533.74 10432
+23.959872 1533.74 10432
+23.970304 1533.74 10432
+23.980736 1533.74 10432
+23.991168 1533.74 10432
+24.001600 1533.74 10432
+24.012032 1533.74 10432
+24.022464 1533.74 10432
+24.032896 1533.74 10432
+24.043328 1533.74 10432
+24.053760 1533.74 10432
+24.064128 1543.21 10368
+24.074496 1543.21 10368
+24.084864 1543.21 10368
+24.095232 1543.21 10368
+24.105600 1543.21 10368
+24.115968 1543.21 10368
+24.126336 1543.21 10368
+24.136704 1543.21 10368
+24.147072 1543.21 10368
+24.157440 1543.21 10368
+24.167808 1543.21 10368
+24.178176 1543.21 10368
+24.188544 1543.21 10368
+24.198912 1543.21 10368
+24.209280 1543.21 10368
+24.219648 1543.21 10368
+24.229952 1552.80 10304
+24.240256 1552.80 10304
+24.250560 1552.80 10304
+24.260864 1552.80 10304
+24.271168 1552.80 10304
+24.281472 1552.80 10304
+24.291776 1552.80 10304
+24.302080 1552.80 10304
+24.312384 1552.80 10304
+24.322688 1552.80 10304
+24.332992 1552.80 10304
+24.343296 1552.80 10304
+24.353600 1552.80 10304
+24.363904 1552.80 10304
+24.374208 1552.80 10304
+24.384512 1552.80 10304
+24.394752 1562.50 10240
+24.404992 1562.50 10240
+24.415232 1562.50 10240
+24.425472 1562.50 10240
+24.435712 1562.50 10240
+24.445952 1562.50 10240
+24.456192 1562.50 10240
+24.466432 1562.50 10240
+24.476608 1572.33 10176
+24.486784 1572.33 10176
+24.496960 1572.33 10176
+24.507136 1572.33 10176
+24.517312 1572.33 10176
+24.527488 1572.33 10176
+24.537664 1572.33 10176
+24.547840 1572.33 10176
+24.558016 1572.33 10176
+24.568192 1572.33 10176
+24.578368 1572.33 10176
+24.588544 1572.33 10176
+24.598720 1572.33 10176
+24.608896 1572.33 10176
+24.619072 1572.33 10176
+24.629248 1572.33 10176
+24.639360 1582.28 10112
+24.649472 1582.28 10112
+24.659584 1582.28 10112
+24.669696 1582.28 10112
+24.679808 1582.28 10112
+24.689920 1582.28 10112
+24.700032 1582.28 10112
+24.710144 1582.28 10112
+24.720256 1582.28 10112
+24.730368 1582.28 10112
+24.740480 1582.28 10112
+24.750592 1582.28 10112
+24.760704 1582.28 10112
+24.770816 1582.28 10112
+24.780928 1582.28 10112
+24.791040 1582.28 10112
+24.801088 1592.36 10048
+24.811136 1592.36 10048
+24.821184 1592.36 10048
+24.831232 1592.36 10048
+24.841280 1592.36 10048
+24.851328 1592.36 10048
+24.861376 1592.36 10048
+24.871424 1592.36 10048
+24.881472 1592.36 10048
+24.891520 1592.36 10048
+24.901568 1592.36 10048
+24.911616 1592.36 10048
+24.921664 1592.36 10048
+24.931712 1592.36 10048
+24.941760 1592.36 10048
+24.951808 1592.36 10048
+24.961856 1592.36 10048
+24.971904 1592.36 10048
+24.981952 1592.36 10048
+24.992000 1592.36 10048
+25.002048 1592.36 10048
+25.012096 1592.36 10048
+25.022144 1592.36 10048
+25.032192 1592.36 10048
+25.042176 1602.56 9984
+25.052160 1602.56 9984
+25.062144 1602.56 9984
+25.072128 1602.56 9984
+25.082112 1602.56 9984
+25.092096 1602.56 9984
+25.102080 1602.56 9984
+25.112064 1602.56 9984
+25.122048 1602.56 9984
+25.132032 1602.56 9984
+25.142016 1602.56 9984
+25.152000 1602.56 9984
+25.161984 1602.56 9984
+25.171968 1602.56 9984
+25.181952 1602.56 9984
+25.191936 1602.56 9984
+25.201856 1612.90 9920
+25.211776 1612.90 9920
+25.221696 1612.90 9920
+25.231616 1612.90 9920
+25.241536 1612.90 9920
+25.251456 1612.90 9920
+25.261376 1612.90 9920
+25.271296 1612.90 9920
+25.281216 1612.90 9920
+25.291136 1612.90 9920
+25.301056 1612.90 9920
+25.310976 1612.90 9920
+25.320896 1612.90 9920
+25.330816 1612.90 9920
+25.340736 1612.90 9920
+25.350656 1612.90 9920
+25.360512 1623.38 9856
+25.370368 1623.38 9856
+25.380224 1623.38 9856
+25.390080 1623.38 9856
+25.399936 1623.38 9856
+25.409792 1623.38 9856
+25.419648 1623.38 9856
+25.429504 1623.38 9856
+25.439296 1633.99 9792
+25.449088 1633.99 9792
+25.458880 1633.99 9792
+25.468672 1633.99 9792
+25.478464 1633.99 9792
+25.488256 1633.99 9792
+25.498048 1633.99 9792
+25.507840 1633.99 9792
+25.517632 1633.99 9792
+25.527424 1633.99 9792
+25.537216 1633.99 9792
+25.547008 1633.99 9792
+25.556800 1633.99 9792
+25.566592 1633.99 9792
+25.576384 1633.99 9792
+25.586176 1633.99 9792
+25.595904 1644.74 9728
+25.605632 1644.74 9728
+25.615360 1644.74 9728
+25.625088 1644.74 9728
+25.634816 1644.74 9728
+25.644544 1644.74 9728
+25.654272 1644.74 9728
+25.664000 1644.74 9728
+25.673728 1644.74 9728
+25.683456 1644.74 9728
+25.693184 1644.74 9728
+25.702912 1644.74 9728
+25.712640 1644.74 9728
+25.722368 1644.74 9728
+25.732096 1644.74 9728
+25.741824 1644.74 9728
+25.751552 1644.74 9728
+25.761280 1644.74 9728
+25.771008 1644.74 9728
+25.780736 1644.74 9728
+25.790464 1644.74 9728
+25.800192 1644.74 9728
+25.809920 1644.74 9728
+25.819648 1644.74 9728
+25.829376 1644.74 9728
+25.839104 1644.74 9728
+25.848832 1644.74 9728
+25.858560 1644.74 9728
+25.868288 1644.74 9728
+25.878016 1644.74 9728
+25.887744 1644.74 9728
+25.897472 1644.74 9728
+25.907136 1655.63 9664
+25.916800 1655.63 9664
+25.926464 1655.63 9664
+25.936128 1655.63 9664
+25.945792 1655.63 9664
+25.955456 1655.63 9664
+25.965120 1655.63 9664
+25.974784 1655.63 9664
+25.984448 1655.63 9664
+25.994112 1655.63 9664
+26.003776 1655.63 9664
+26.013440 1655.63 9664
+26.023104 1655.63 9664
+26.032768 1655.63 9664
+26.042432 1655.63 9664
+26.052096 1655.63 9664
+26.061696 1666.67 9600
+26.071296 1666.67 9600
+26.080896 1666.67 9600
+26.090496 1666.67 9600
+26.100096 1666.67 9600
+26.109696 1666.67 9600
+26.119296 1666.67 9600
+26.128896 1666.67 9600
+26.138496 1666.67 9600
+26.148096 1666.67 9600
+26.157696 1666.67 9600
+26.167296 1666.67 9600
+26.176896 1666.67 9600
+26.186496 1666.67 9600
+26.196096 1666.67 9600
+26.205696 1666.67 9600
+26.215232 1677.85 9536
+26.224768 1677.85 9536
+26.234304 1677.85 9536
+26.243840 1677.85 9536
+26.253376 1677.85 9536
+26.262912 1677.85 9536
+26.272448 1677.85 9536
+26.281984 1677.85 9536
+26.291456 1689.19 9472
+26.300928 1689.19 9472
+26.310400 1689.19 9472
+26.319872 1689.19 9472
+26.329344 1689.19 9472
+26.338816 1689.19 9472
+26.348288 1689.19 9472
+26.357760 1689.19 9472
+26.367232 1689.19 9472
+26.376704 1689.19 9472
+26.386176 1689.19 9472
+26.395648 1689.19 9472
+26.405120 1689.19 9472
+26.414592 1689.19 9472
+26.424064 1689.19 9472
+26.433536 1689.19 9472
+26.442944 1700.68 9408
+26.452352 1700.68 9408
+26.461760 1700.68 9408
+26.471168 1700.68 9408
+26.480576 1700.68 9408
+26.489984 1700.68 9408
+26.499392 1700.68 9408
+26.508800 1700.68 9408
+26.518208 1700.68 9408
+26.527616 1700.68 9408
+26.537024 1700.68 9408
+26.546432 1700.68 9408
+26.555840 1700.68 9408
+26.565248 1700.68 9408
+26.574656 1700.68 9408
+26.584064 1700.68 9408
+26.593472 1700.68 9408
+26.602880 1700.68 9408
+26.612288 1700.68 9408
+26.621696 1700.68 9408
+26.631104 1700.68 9408
+26.640512 1700.68 9408
+26.649920 1700.68 9408
+26.659328 1700.68 9408
+26.668736 1700.68 9408
+26.678144 1700.68 9408
+26.687552 1700.68 9408
+26.696960 1700.68 9408
+26.706368 1700.68 9408
+26.715776 1700.68 9408
+26.725184 1700.68 9408
+26.734592 1700.68 9408
+26.743936 1712.33 9344
+26.753280 1712.33 9344
+26.762624 1712.33 9344
+26.771968 1712.33 9344
+26.781312 1712.33 9344
+26.790656 1712.33 9344
+26.800000 1712.33 9344
+26.809344 1712.33 9344
+26.818688 1712.33 9344
+26.828032 1712.33 9344
+26.837376 1712.33 9344
+26.846720 1712.33 9344
+26.856064 1712.33 9344
+26.865408 1712.33 9344
+26.874752 1712.33 9344
+26.884096 1712.33 9344
+26.893376 1724.14 9280
+26.902656 1724.14 9280
+26.911936 1724.14 9280
+26.921216 1724.14 9280
+26.930496 1724.14 9280
+26.939776 1724.14 9280
+26.949056 1724.14 9280
+26.958336 1724.14 9280
+26.967616 1724.14 9280
+26.976896 1724.14 9280
+26.986176 1724.14 9280
+26.995456 1724.14 9280
+27.004736 1724.14 9280
+27.014016 1724.14 9280
+27.023296 1724.14 9280
+27.032576 1724.14 9280
+27.041792 1736.11 9216
+27.051008 1736.11 9216
+27.060224 1736.11 9216
+27.069440 1736.11 9216
+27.078656 1736.11 9216
+27.087872 1736.11 9216
+27.097088 1736.11 9216
+27.106304 1736.11 9216
+27.115520 1736.11 9216
+27.124736 1736.11 9216
+27.133952 1736.11 9216
+27.143168 1736.11 9216
+27.152384 1736.11 9216
+27.161600 1736.11 9216
+27.170816 1736.11 9216
+27.180032 1736.11 9216
+27.189248 1736.11 9216
+27.198464 1736.11 9216
+27.207680 1736.11 9216
+27.216896 1736.11 9216
+27.226112 1736.11 9216
+27.235328 1736.11 9216
+27.244544 1736.11 9216
+27.253760 1736.11 9216
+27.262976 1736.11 9216
+27.272192 1736.11 9216
+27.281408 1736.11 9216
+27.290624 1736.11 9216
+27.299840 1736.11 9216
+27.309056 1736.11 9216
+27.318272 1736.11 9216
+27.327488 1736.11 9216
+27.336640 1748.25 9152
+27.345792 1748.25 9152
+27.354944 1748.25 9152
+27.364096 1748.25 9152
+27.373248 1748.25 9152
+27.382400 1748.25 9152
+27.391552 1748.25 9152
+27.400704 1748.25 9152
+27.409856 1748.25 9152
+27.419008 1748.25 9152
+27.428160 1748.25 9152
+27.437312 1748.25 9152
+27.446464 1748.25 9152
+27.455616 1748.25 9152
+27.464768 1748.25 9152
+27.473920 1748.25 9152
+27.483008 1760.56 9088
+27.492096 1760.56 9088
+27.501184 1760.56 9088
+27.510272 1760.56 9088
+27.519360 1760.56 9088
+27.528448 1760.56 9088
+27.537536 1760.56 9088
+27.546624 1760.56 9088
+27.555712 1760.56 9088
+27.564800 1760.56 9088
+27.573888 1760.56 9088
+27.582976 1760.56 9088
+27.592064 1760.56 9088
+27.601152 1760.56 9088
+27.610240 1760.56 9088
+27.619328 1760.56 9088
+27.628352 1773.05 9024
+27.637376 1773.05 9024
+27.646400 1773.05 9024
+27.655424 1773.05 9024
+27.664448 1773.05 9024
+27.673472 1773.05 9024
+27.682496 1773.05 9024
+27.691520 1773.05 9024
+27.700544 1773.05 9024
+27.709568 1773.05 9024
+27.718592 1773.05 9024
+27.727616 1773.05 9024
+27.736640 1773.05 9024
+27.745664 1773.05 9024
+27.754688 1773.05 9024
+27.763712 1773.05 9024
+27.772736 1773.05 9024
+27.781760 1773.05 9024
+27.790784 1773.05 9024
+27.799808 1773.05 9024
+27.808832 1773.05 9024
+27.817856 1773.05 9024
+27.826880 1773.05 9024
+27.835904 1773.05 9024
+27.844864 1785.71 8960
+27.853824 1785.71 8960
+27.862784 1785.71 8960
+27.871744 1785.71 8960
+27.880704 1785.71 8960
+27.889664 1785.71 8960
+27.898624 1785.71 8960
+27.907584 1785.71 8960
+27.916544 1785.71 8960
+27.925504 1785.71 8960
+27.934464 1785.71 8960
+27.943424 1785.71 8960
+27.952384 1785.71 8960
+27.961344 1785.71 8960
+27.970304 1785.71 8960
+27.979264 1785.71 8960
+27.988224 1785.71 8960
+27.997184 1785.71 8960
+28.006144 1785.71 8960
+28.015104 1785.71 8960
+28.024064 1785.71 8960
+28.033024 1785.71 8960
+28.041984 1785.71 8960
+28.050944 1785.71 8960
+28.059904 1785.71 8960
+28.068864 1785.71 8960
+28.077824 1785.71 8960
+28.086784 1785.71 8960
+28.095744 1785.71 8960
+28.104704 1785.71 8960
+28.113664 1785.71 8960
+28.122624 1785.71 8960
+28.131520 1798.56 8896
+28.140416 1798.56 8896
+28.149312 1798.56 8896
+28.158208 1798.56 8896
+28.167104 1798.56 8896
+28.176000 1798.56 8896
+28.184896 1798.56 8896
+28.193792 1798.56 8896
+28.202688 1798.56 8896
+28.211584 1798.56 8896
+28.220480 1798.56 8896
+28.229376 1798.56 8896
+28.238272 1798.56 8896
+28.247168 1798.56 8896
+28.256064 1798.56 8896
+28.264960 1798.56 8896
+28.273792 1811.59 8832
+28.282624 1811.59 8832
+28.291456 1811.59 8832
+28.300288 1811.59 8832
+28.309120 1811.59 8832
+28.317952 1811.59 8832
+28.326784 1811.59 8832
+28.335616 1811.59 8832
+28.344448 1811.59 8832
+28.353280 1811.59 8832
+28.362112 1811.59 8832
+28.370944 1811.59 8832
+28.379776 1811.59 8832
+28.388608 1811.59 8832
+28.397440 1811.59 8832
+28.406272 1811.59 8832
+28.415040 1824.82 8768
+28.423808 1824.82 8768
+28.432576 1824.82 8768
+28.441344 1824.82 8768
+28.450112 1824.82 8768
+28.458880 1824.82 8768
+28.467648 1824.82 8768
+28.476416 1824.82 8768
+28.485184 1824.82 8768
+28.493952 1824.82 8768
+28.502720 1824.82 8768
+28.511488 1824.82 8768
+28.520256 1824.82 8768
+28.529024 1824.82 8768
+28.537792 1824.82 8768
+28.546560 1824.82 8768
+28.555328 1824.82 8768
+28.564096 1824.82 8768
+28.572864 1824.82 8768
+28.581632 1824.82 8768
+28.590400 1824.82 8768
+28.599168 1824.82 8768
+28.607936 1824.82 8768
+28.616704 1824.82 8768
+28.625472 1824.82 8768
+28.634240 1824.82 8768
+28.643008 1824.82 8768
+28.651776 1824.82 8768
+28.660544 1824.82 8768
+28.669312 1824.82 8768
+28.678080 1824.82 8768
+28.686848 1824.82 8768
+28.695616 1824.82 8768
+28.704384 1824.82 8768
+28.713152 1824.82 8768
+28.721920 1824.82 8768
+28.730688 1824.82 8768
+28.739456 1824.82 8768
+28.748224 1824.82 8768
+28.756992 1824.82 8768
+28.765696 1838.24 8704
+28.774400 1838.24 8704
+28.783104 1838.24 8704
+28.791808 1838.24 8704
+28.800512 1838.24 8704
+28.809216 1838.24 8704
+28.817920 1838.24 8704
+28.826624 1838.24 8704
+28.835328 1838.24 8704
+28.844032 1838.24 8704
+28.852736 1838.24 8704
+28.861440 1838.24 8704
+28.870144 1838.24 8704
+28.878848 1838.24 8704
+28.887552 1838.24 8704
+28.896256 1838.24 8704
+28.904896 1851.85 8640
+28.913536 1851.85 8640
+28.922176 1851.85 8640
+28.930816 1851.85 8640
+28.939456 1851.85 8640
+28.948096 1851.85 8640
+28.956736 1851.85 8640
+28.965376 1851.85 8640
+28.974016 1851.85 8640
+28.982656 1851.85 8640
+28.991296 1851.85 8640
+28.999936 1851.85 8640
+29.008576 1851.85 8640
+29.017216 1851.85 8640
+29.025856 1851.85 8640
+29.034496 1851.85 8640
+29.043136 1851.85 8640
+29.051776 1851.85 8640
+29.060416 1851.85 8640
+29.069056 1851.85 8640
+29.077696 1851.85 8640
+29.086336 1851.85 8640
+29.094976 1851.85 8640
+29.103616 1851.85 8640
+29.112256 1851.85 8640
+29.120896 1851.85 8640
+29.129536 1851.85 8640
+29.138176 1851.85 8640
+29.146816 1851.85 8640
+29.155456 1851.85 8640
+29.164096 1851.85 8640
+29.172736 1851.85 8640
+29.181376 1851.85 8640
+29.190016 1851.85 8640
+29.198656 1851.85 8640
+29.207296 1851.85 8640
+29.215936 1851.85 8640
+29.224576 1851.85 8640
+29.233216 1851.85 8640
+29.241856 1851.85 8640
+29.250432 1865.67 8576
+29.259008 1865.67 8576
+29.267584 1865.67 8576
+29.276160 1865.67 8576
+29.284736 1865.67 8576
+29.293312 1865.67 8576
+29.301888 1865.67 8576
+29.310464 1865.67 8576
+29.319040 1865.67 8576
+29.327616 1865.67 8576
+29.336192 1865.67 8576
+29.344768 1865.67 8576
+29.353344 1865.67 8576
+29.361920 1865.67 8576
+29.370496 1865.67 8576
+29.379072 1865.67 8576
+29.387584 1879.70 8512
+29.396096 1879.70 8512
+29.404608 1879.70 8512
+29.413120 1879.70 8512
+29.421632 1879.70 8512
+29.430144 1879.70 8512
+29.438656 1879.70 8512
+29.447168 1879.70 8512
+29.455680 1879.70 8512
+29.464192 1879.70 8512
+29.472704 1879.70 8512
+29.481216 1879.70 8512
+29.489728 1879.70 8512
+29.498240 1879.70 8512
+29.506752 1879.70 8512
+29.515264 1879.70 8512
+29.523712 1893.94 8448
+29.532160 1893.94 8448
+29.540608 1893.94 8448
+29.549056 1893.94 8448
+29.557504 1893.94 8448
+29.565952 1893.94 8448
+29.574400 1893.94 8448
+29.582848 1893.94 8448
+29.591296 1893.94 8448
+29.599744 1893.94 8448
+29.608192 1893.94 8448
+29.616640 1893.94 8448
+29.625088 1893.94 8448
+29.633536 1893.94 8448
+29.641984 1893.94 8448
+29.650432 1893.94 8448
+29.658880 1893.94 8448
+29.667328 1893.94 8448
+29.675776 1893.94 8448
+29.684224 1893.94 8448
+29.692672 1893.94 8448
+29.701120 1893.94 8448
+29.709568 1893.94 8448
+29.718016 1893.94 8448
+29.726464 1893.94 8448
+29.734912 1893.94 8448
+29.743360 1893.94 8448
+29.751808 1893.94 8448
+29.760256 1893.94 8448
+29.768704 1893.94 8448
+29.777152 1893.94 8448
+29.785600 1893.94 8448
+29.794048 1893.94 8448
+29.802496 1893.94 8448
+29.810944 1893.94 8448
+29.819392 1893.94 8448
+29.827840 1893.94 8448
+29.836288 1893.94 8448
+29.844736 1893.94 8448
+29.853184 1893.94 8448
+29.861568 1908.40 8384
+29.869952 1908.40 8384
+29.878336 1908.40 8384
+29.886720 1908.40 8384
+29.895104 1908.40 8384
+29.903488 1908.40 8384
+29.911872 1908.40 8384
+29.920256 1908.40 8384
+29.928640 1908.40 8384
+29.937024 1908.40 8384
+29.945408 1908.40 8384
+29.953792 1908.40 8384
+29.962176 1908.40 8384
+29.970560 1908.40 8384
+29.978944 1908.40 8384
+29.987328 1908.40 8384
+29.995712 1908.40 8384
+30.004096 1908.40 8384
+30.012480 1908.40 8384
+30.020864 1908.40 8384
+30.029248 1908.40 8384
+30.037632 1908.40 8384
+30.046016 1908.40 8384
+30.054400 1908.40 8384
+30.062720 1923.08 8320
+30.071040 1923.08 8320
+30.079360 1923.08 8320
+30.087680 1923.08 8320
+30.096000 1923.08 8320
+30.104320 1923.08 8320
+30.112640 1923.08 8320
+30.120960 1923.08 8320
+30.129280 1923.08 8320
+30.137600 1923.08 8320
+30.145920 1923.08 8320
+30.154240 1923.08 8320
+30.162560 1923.08 8320
+30.170880 1923.08 8320
+30.179200 1923.08 8320
+30.187520 1923.08 8320
+30.195776 1937.98 8256
+30.204032 1937.98 8256
+30.212288 1937.98 8256
+30.220544 1937.98 8256
+30.228800 1937.98 8256
+30.237056 1937.98 8256
+30.245312 1937.98 8256
+30.253568 1937.98 8256
+30.261824 1937.98 8256
+30.270080 1937.98 8256
+30.278336 1937.98 8256
+30.286592 1937.98 8256
+30.294848 1937.98 8256
+30.303104 1937.98 8256
+30.311360 1937.98 8256
+30.319616 1937.98 8256
+30.327872 1937.98 8256
+30.336128 1937.98 8256
+30.344384 1937.98 8256
+30.352640 1937.98 8256
+30.360896 1937.98 8256
+30.369152 1937.98 8256
+30.377408 1937.98 8256
+30.385664 1937.98 8256
+30.393920 1937.98 8256
+30.402176 1937.98 8256
+30.410432 1937.98 8256
+30.418688 1937.98 8256
+30.426944 1937.98 8256
+30.435200 1937.98 8256
+30.443456 1937.98 8256
+30.451712 1937.98 8256
+30.459968 1937.98 8256
+30.468224 1937.98 8256
+30.476480 1937.98 8256
+30.484736 1937.98 8256
+30.492992 1937.98 8256
+30.501248 1937.98 8256
+30.509504 1937.98 8256
+30.517760 1937.98 8256
+30.525952 1953.12 8192
+30.534144 1953.12 8192
+30.542336 1953.12 8192
+30.550528 1953.12 8192
+30.558720 1953.12 8192
+30.566912 1953.12 8192
+30.575104 1953.12 8192
+30.583296 1953.12 8192
+30.591488 1953.12 8192
+30.599680 1953.12 8192
+30.607872 1953.12 8192
+30.616064 1953.12 8192
+30.624256 1953.12 8192
+30.632448 1953.12 8192
+30.640640 1953.12 8192
+30.648832 1953.12 8192
+30.657024 1953.12 8192
+30.665216 1953.12 8192
+30.673408 1953.12 8192
+30.681600 1953.12 8192
+30.689792 1953.12 8192
+30.697984 1953.12 8192
+30.706176 1953.12 8192
+30.714368 1953.12 8192
+30.722528 1960.78 8160
+30.730688 1960.78 8160
+30.738848 1960.78 8160
+30.747008 1960.78 8160
+30.755168 1960.78 8160
+30.763328 1960.78 8160
+30.771488 1960.78 8160
+30.779648 1960.78 8160
+30.787808 1960.78 8160
+30.795968 1960.78 8160
+30.804128 1960.78 8160
+30.812288 1960.78 8160
+30.820448 1960.78 8160
+30.828608 1960.78 8160
+30.836768 1960.78 8160
+30.844928 1960.78 8160
+30.853056 1968.50 8128
+30.861184 1968.50 8128
+30.869312 1968.50 8128
+30.877440 1968.50 8128
+30.885568 1968.50 8128
+30.893696 1968.50 8128
+30.901824 1968.50 8128
+30.909952 1968.50 8128
+30.918080 1968.50 8128
+30.926208 1968.50 8128
+30.934336 1968.50 8128
+30.942464 1968.50 8128
+30.950592 1968.50 8128
+30.958720 1968.50 8128
+30.966848 1968.50 8128
+30.974976 1968.50 8128
+30.983104 1968.50 8128
+30.991232 1968.50 8128
+30.999360 1968.50 8128
+31.007488 1968.50 8128
+31.015616 1968.50 8128
+31.023744 1968.50 8128
+31.031872 1968.50 8128
+31.040000 1968.50 8128
+31.048064 1984.13 8064
+31.056128 1984.13 8064
+31.064192 1984.13 8064
+31.072256 1984.13 8064
+31.080320 1984.13 8064
+31.088384 1984.13 8064
+31.096448 1984.13 8064
+31.104512 1984.13 8064
+31.112576 1984.13 8064
+31.120640 1984.13 8064
+31.128704 1984.13 8064
+31.136768 1984.13 8064
+31.144832 1984.13 8064
+31.152896 1984.13 8064
+31.160960 1984.13 8064
+31.169024 1984.13 8064
+31.177088 1984.13 8064
+31.185152 1984.13 8064
+31.193216 1984.13 8064
+31.201280 1984.13 8064
+31.209344 1984.13 8064
+31.217408 1984.13 8064
+31.225472 1984.13 8064
+31.233536 1984.13 8064
+31.241568 1992.03 8032
+31.249600 1992.03 8032
+31.257632 1992.03 8032
+31.265664 1992.03 8032
+31.273696 1992.03 8032
+31.281728 1992.03 8032
+31.289760 1992.03 8032
+31.297792 1992.03 8032
+31.305824 1992.03 8032
+31.313856 1992.03 8032
+31.321888 1992.03 8032
+31.329920 1992.03 8032
+31.337952 1992.03 8032
+31.345984 1992.03 8032
+31.354016 1992.03 8032
+31.362048 1992.03 8032
+31.370048 2000.00 8000
+31.386048 2000.00 8000
+31.402048 2000.00 8000
+31.418048 2000.00 8000
+31.434048 2000.00 8000
+31.450048 2000.00 8000
+31.466048 2000.00 8000
+31.482048 2000.00 8000
+31.498048 2000.00 8000
+31.514048 2000.00 8000
+31.530048 2000.00 8000
+31.546048 2000.00 8000
+31.561920 2016.13 7936
+31.577792 2016.13 7936
+31.593664 2016.13 7936
+31.609536 2016.13 7936
+31.625408 2016.13 7936
+31.641280 2016.13 7936
+31.657152 2016.13 7936
+31.673024 2016.13 7936
+31.688896 2016.13 7936
+31.704768 2016.13 7936
+31.720640 2016.13 7936
+31.736512 2016.13 7936
+31.752320 2024.29 7904
+31.768128 2024.29 7904
+31.783936 2024.29 7904
+31.799744 2024.29 7904
+31.815552 2024.29 7904
+31.831360 2024.29 7904
+31.847168 2024.29 7904
+31.862976 2024.29 7904
+31.878784 2024.29 7904
+31.894592 2024.29 7904
+31.910400 2024.29 7904
+31.926208 2024.29 7904
+31.941952 2032.52 7872
+31.957696 2032.52 7872
+31.973440 2032.52 7872
+31.989184 2032.52 7872
+32.004928 2032.52 7872
+32.020672 2032.52 7872
+32.036416 2032.52 7872
+32.052160 2032.52 7872
+32.067776 2049.18 7808
+32.083392 2049.18 7808
+32.099008 2049.18 7808
+32.114624 2049.18 7808
+32.130240 2049.18 7808
+32.145856 2049.18 7808
+32.161472 2049.18 7808
+32.177088 2049.18 7808
+32.192704 2049.18 7808
+32.208320 2049.18 7808
+32.223936 2049.18 7808
+32.239552 2049.18 7808
+32.255168 2049.18 7808
+32.270784 2049.18 7808
+32.286400 2049.18 7808
+32.302016 2049.18 7808
+32.317568 2057.61 7776
+32.333120 2057.61 7776
+32.348672 2057.61 7776
+32.364224 2057.61 7776
+32.379776 2057.61 7776
+32.395328 2057.61 7776
+32.410880 2057.61 7776
+32.426432 2057.61 7776
+32.441920 2066.12 7744
+32.457408 2066.12 7744
+32.472896 2066.12 7744
+32.488384 2066.12 7744
+32.503872 2066.12 7744
+32.519360 2066.12 7744
+32.534848 2066.12 7744
+32.550336 2066.12 7744
+32.565824 2066.12 7744
+32.581312 2066.12 7744
+32.596800 2066.12 7744
+32.612288 2066.12 7744
+32.627776 2066.12 7744
+32.643264 2066.12 7744
+32.658752 2066.12 7744
+32.674240 2066.12 7744
+32.689600 2083.33 7680
+32.704960 2083.33 7680
+32.720320 2083.33 7680
+32.735680 2083.33 7680
+32.751040 2083.33 7680
+32.766400 2083.33 7680
+32.781760 2083.33 7680
+32.797120 2083.33 7680
+32.812416 2092.05 7648
+32.827712 2092.05 7648
+32.843008 2092.05 7648
+32.858304 2092.05 7648
+32.873600 2092.05 7648
+32.888896 2092.05 7648
+32.904192 2092.05 7648
+32.919488 2092.05 7648
+32.934784 2092.05 7648
+32.950080 2092.05 7648
+32.965376 2092.05 7648
+32.980672 2092.05 7648
+32.995968 2092.05 7648
+33.011264 2092.05 7648
+33.026560 2092.05 7648
+33.041856 2092.05 7648
+33.057088 2100.84 7616
+33.072320 2100.84 7616
+33.087552 2100.84 7616
+33.102784 2100.84 7616
+33.118016 2100.84 7616
+33.133248 2100.84 7616
+33.148480 2100.84 7616
+33.163712 2100.84 7616
+33.178816 2118.64 7552
+33.193920 2118.64 7552
+33.209024 2118.64 7552
+33.224128 2118.64 7552
+33.239232 2118.64 7552
+33.254336 2118.64 7552
+33.269440 2118.64 7552
+33.284544 2118.64 7552
+33.299648 2118.64 7552
+33.314752 2118.64 7552
+33.329856 2118.64 7552
+33.344960 2118.64 7552
+33.360064 2118.64 7552
+33.375168 2118.64 7552
+33.390272 2118.64 7552
+33.405376 2118.64 7552
+33.420416 2127.66 7520
+33.435456 2127.66 7520
+33.450496 2127.66 7520
+33.465536 2127.66 7520
+33.480576 2127.66 7520
+33.495616 2127.66 7520
+33.510656 2127.66 7520
+33.525696 2127.66 7520
+33.540672 2136.75 7488
+33.555648 2136.75 7488
+33.570624 2136.75 7488
+33.585600 2136.75 7488
+33.600576 2136.75 7488
+33.615552 2136.75 7488
+33.630528 2136.75 7488
+33.645504 2136.75 7488
+33.660480 2136.75 7488
+33.675456 2136.75 7488
+33.690432 2136.75 7488
+33.705408 2136.75 7488
+33.720384 2136.75 7488
+33.735360 2136.75 7488
+33.750336 2136.75 7488
+33.765312 2136.75 7488
+33.780224 2145.92 7456
+33.795136 2145.92 7456
+33.810048 2145.92 7456
+33.824960 2145.92 7456
+33.839872 2145.92 7456
+33.854784 2145.92 7456
+33.869696 2145.92 7456
+33.884608 2145.92 7456
+33.899392 2164.50 7392
+33.914176 2164.50 7392
+33.928960 2164.50 7392
+33.943744 2164.50 7392
+33.958528 2164.50 7392
+33.973312 2164.50 7392
+33.988096 2164.50 7392
+34.002880 2164.50 7392
+34.017664 2164.50 7392
+34.032448 2164.50 7392
+34.047232 2164.50 7392
+34.062016 2164.50 7392
+34.076800 2164.50 7392
+34.091584 2164.50 7392
+34.106368 2164.50 7392
+34.121152 2164.50 7392
+34.135872 2173.91 7360
+34.150592 2173.91 7360
+34.165312 2173.91 7360
+34.180032 2173.91 7360
+34.194752 2173.91 7360
+34.209472 2173.91 7360
+34.224192 2173.91 7360
+34.238912 2173.91 7360
+34.253568 2183.41 7328
+34.268224 2183.41 7328
+34.282880 2183.41 7328
+34.297536 2183.41 7328
+34.312192 2183.41 7328
+34.326848 2183.41 7328
+34.341504 2183.41 7328
+34.356160 2183.41 7328
+34.370816 2183.41 7328
+34.385472 2183.41 7328
+34.400128 2183.41 7328
+34.414784 2183.41 7328
+34.429440 2183.41 7328
+34.444096 2183.41 7328
+34.458752 2183.41 7328
+34.473408 2183.41 7328
+34.488000 2192.98 7296
+34.502592 2192.98 7296
+34.517184 2192.98 7296
+34.531776 2192.98 7296
+34.546368 2192.98 7296
+34.560960 2192.98 7296
+34.575552 2192.98 7296
+34.590144 2192.98 7296
+34.604736 2192.98 7296
+34.619328 2192.98 7296
+34.633920 2192.98 7296
+34.648512 2192.98 7296
+34.663104 2192.98 7296
+34.677696 2192.98 7296
+34.692288 2192.98 7296
+34.706880 2192.98 7296
+34.721344 2212.39 7232
+34.735808 2212.39 7232
+34.750272 2212.39 7232
+34.764736 2212.39 7232
+34.779200 2212.39 7232
+34.793664 2212.39 7232
+34.808128 2212.39 7232
+34.822592 2212.39 7232
+34.836992 2222.22 7200
+34.851392 2222.22 7200
+34.865792 2222.22 7200
+34.880192 2222.22 7200
+34.894592 2222.22 7200
+34.908992 2222.22 7200
+34.923392 2222.22 7200
+34.937792 2222.22 7200
+34.952192 2222.22 7200
+34.966592 2222.22 7200
+34.980992 2222.22 7200
+34.995392 2222.22 7200
+35.009792 2222.22 7200
+35.024192 2222.22 7200
+35.038592 2222.22 7200
+35.052992 2222.22 7200
+35.067328 2232.14 7168
+35.081664 2232.14 7168
+35.096000 2232.14 7168
+35.110336 2232.14 7168
+35.124672 2232.14 7168
+35.139008 2232.14 7168
+35.153344 2232.14 7168
+35.167680 2232.14 7168
+35.182016 2232.14 7168
+35.196352 2232.14 7168
+35.210688 2232.14 7168
+35.225024 2232.14 7168
+35.239360 2232.14 7168
+35.253696 2232.14 7168
+35.268032 2232.14 7168
+35.282368 2232.14 7168
+35.296640 2242.15 7136
+35.310912 2242.15 7136
+35.325184 2242.15 7136
+35.339456 2242.15 7136
+35.353728 2242.15 7136
+35.368000 2242.15 7136
+35.382272 2242.15 7136
+35.396544 2242.15 7136
+35.410688 2262.44 7072
+35.424832 2262.44 7072
+35.438976 2262.44 7072
+35.453120 2262.44 7072
+35.467264 2262.44 7072
+35.481408 2262.44 7072
+35.495552 2262.44 7072
+35.509696 2262.44 7072
+35.523840 2262.44 7072
+35.537984 2262.44 7072
+35.552128 2262.44 7072
+35.566272 2262.44 7072
+35.580416 2262.44 7072
+35.594560 2262.44 7072
+35.608704 2262.44 7072
+35.622848 2262.44 7072
+35.636928 2272.73 7040
+35.651008 2272.73 7040
+35.665088 2272.73 7040
+35.679168 2272.73 7040
+35.693248 2272.73 7040
+35.707328 2272.73 7040
+35.721408 2272.73 7040
+35.735488 2272.73 7040
+35.749568 2272.73 7040
+35.763648 2272.73 7040
+35.777728 2272.73 7040
+35.791808 2272.73 7040
+35.805888 2272.73 7040
+35.819968 2272.73 7040
+35.834048 2272.73 7040
+35.848128 2272.73 7040
+35.862144 2283.11 7008
+35.876160 2283.11 7008
+35.890176 2283.11 7008
+35.904192 2283.11 7008
+35.918208 2283.11 7008
+35.932224 2283.11 7008
+35.946240 2283.11 7008
+35.960256 2283.11 7008
+35.974272 2283.11 7008
+35.988288 2283.11 7008
+36.002304 2283.11 7008
+36.016320 2283.11 7008
+36.030336 2283.11 7008
+36.044352 2283.11 7008
+36.058368 2283.11 7008
+36.072384 2283.11 7008
+36.086336 2293.58 6976
+36.100288 2293.58 6976
+36.114240 2293.58 6976
+36.128192 2293.58 6976
+36.142144 2293.58 6976
+36.156096 2293.58 6976
+36.170048 2293.58 6976
+36.184000 2293.58 6976
+36.197888 2304.15 6944
+36.211776 2304.15 6944
+36.225664 2304.15 6944
+36.239552 2304.15 6944
+36.253440 2304.15 6944
+36.267328 2304.15 6944
+36.281216 2304.15 6944
+36.295104 2304.15 6944
+36.308992 2304.15 6944
+36.322880 2304.15 6944
+36.336768 2304.15 6944
+36.350656 2304.15 6944
+36.364544 2304.15 6944
+36.378432 2304.15 6944
+36.392320 2304.15 6944
+36.406208 2304.15 6944
+36.420032 2314.81 6912
+36.433856 2314.81 6912
+36.447680 2314.81 6912
+36.461504 2314.81 6912
+36.475328 2314.81 6912
+36.489152 2314.81 6912
+36.502976 2314.81 6912
+36.516800 2314.81 6912
+36.530624 2314.81 6912
+36.544448 2314.81 6912
+36.558272 2314.81 6912
+36.572096 2314.81 6912
+36.585920 2314.81 6912
+36.599744 2314.81 6912
+36.613568 2314.81 6912
+36.627392 2314.81 6912
+36.641088 2336.45 6848
+36.654784 2336.45 6848
+36.668480 2336.45 6848
+36.682176 2336.45 6848
+36.695872 2336.45 6848
+36.709568 2336.45 6848
+36.723264 2336.45 6848
+36.736960 2336.45 6848
+36.750656 2336.45 6848
+36.764352 2336.45 6848
+36.778048 2336.45 6848
+36.791744 2336.45 6848
+36.805440 2336.45 6848
+36.819136 2336.45 6848
+36.832832 2336.45 6848
+36.846528 2336.45 6848
+36.860160 2347.42 6816
+36.873792 2347.42 6816
+36.887424 2347.42 6816
+36.901056 2347.42 6816
+36.914688 2347.42 6816
+36.928320 2347.42 6816
+36.941952 2347.42 6816
+36.955584 2347.42 6816
+36.969216 2347.42 6816
+36.982848 2347.42 6816
+36.996480 2347.42 6816
+37.010112 2347.42 6816
+37.023744 2347.42 6816
+37.037376 2347.42 6816
+37.051008 2347.42 6816
+37.064640 2347.42 6816
+37.078208 2358.49 6784
+37.091776 2358.49 6784
+37.105344 2358.49 6784
+37.118912 2358.49 6784
+37.132480 2358.49 6784
+37.146048 2358.49 6784
+37.159616 2358.49 6784
+37.173184 2358.49 6784
+37.186752 2358.49 6784
+37.200320 2358.49 6784
+37.213888 2358.49 6784
+37.227456 2358.49 6784
+37.241024 2358.49 6784
+37.254592 2358.49 6784
+37.268160 2358.49 6784
+37.281728 2358.49 6784
+37.295232 2369.67 6752
+37.308736 2369.67 6752
+37.322240 2369.67 6752
+37.335744 2369.67 6752
+37.349248 2369.67 6752
+37.362752 2369.67 6752
+37.376256 2369.67 6752
+37.389760 2369.67 6752
+37.403200 2380.95 6720
+37.416640 2380.95 6720
+37.430080 2380.95 6720
+37.443520 2380.95 6720
+37.456960 2380.95 6720
+37.470400 2380.95 6720
+37.483840 2380.95 6720
+37.497280 2380.95 6720
+37.510720 2380.95 6720
+37.524160 2380.95 6720
+37.537600 2380.95 6720
+37.551040 2380.95 6720
+37.564480 2380.95 6720
+37.577920 2380.95 6720
+37.591360 2380.95 6720
+37.604800 2380.95 6720
+37.618176 2392.34 6688
+37.631552 2392.34 6688
+37.644928 2392.34 6688
+37.658304 2392.34 6688
+37.671680 2392.34 6688
+37.685056 2392.34 6688
+37.698432 2392.34 6688
+37.711808 2392.34 6688
+37.725184 2392.34 6688
+37.738560 2392.34 6688
+37.751936 2392.34 6688
+37.765312 2392.34 6688
+37.778688 2392.34 6688
+37.792064 2392.34 6688
+37.805440 2392.34 6688
+37.818816 2392.34 6688
+37.832128 2403.85 6656
+37.845440 2403.85 6656
+37.858752 2403.85 6656
+37.872064 2403.85 6656
+37.885376 2403.85 6656
+37.898688 2403.85 6656
+37.912000 2403.85 6656
+37.925312 2403.85 6656
+37.938624 2403.85 6656
+37.951936 2403.85 6656
+37.965248 2403.85 6656
+37.978560 2403.85 6656
+37.991872 2403.85 6656
+38.005184 2403.85 6656
+38.018496 2403.85 6656
+38.031808 2403.85 6656
+38.044992 2427.18 6592
+38.058176 2427.18 6592
+38.071360 2427.18 6592
+38.084544 2427.18 6592
+38.097728 2427.18 6592
+38.110912 2427.18 6592
+38.124096 2427.18 6592
+38.137280 2427.18 6592
+38.150464 2427.18 6592
+38.163648 2427.18 6592
+38.176832 2427.18 6592
+38.190016 2427.18 6592
+38.203200 2427.18 6592
+38.216384 2427.18 6592
+38.229568 2427.18 6592
+38.242752 2427.18 6592
+38.255872 2439.02 6560
+38.268992 2439.02 6560
+38.282112 2439.02 6560
+38.295232 2439.02 6560
+38.308352 2439.02 6560
+38.321472 2439.02 6560
+38.334592 2439.02 6560
+38.347712 2439.02 6560
+38.360832 2439.02 6560
+38.373952 2439.02 6560
+38.387072 2439.02 6560
+38.400192 2439.02 6560
+38.413312 2439.02 6560
+38.426432 2439.02 6560
+38.439552 2439.02 6560
+38.452672 2439.02 6560
+38.465728 2450.98 6528
+38.478784 2450.98 6528
+38.491840 2450.98 6528
+38.504896 2450.98 6528
+38.517952 2450.98 6528
+38.531008 2450.98 6528
+38.544064 2450.98 6528
+38.557120 2450.98 6528
+38.570176 2450.98 6528
+38.583232 2450.98 6528
+38.596288 2450.98 6528
+38.609344 2450.98 6528
+38.622400 2450.98 6528
+38.635456 2450.98 6528
+38.648512 2450.98 6528
+38.661568 2450.98 6528
+38.674560 2463.05 6496
+38.687552 2463.05 6496
+38.700544 2463.05 6496
+38.713536 2463.05 6496
+38.726528 2463.05 6496
+38.739520 2463.05 6496
+38.752512 2463.05 6496
+38.765504 2463.05 6496
+38.778496 2463.05 6496
+38.791488 2463.05 6496
+38.804480 2463.05 6496
+38.817472 2463.05 6496
+38.830464 2463.05 6496
+38.843456 2463.05 6496
+38.856448 2463.05 6496
+38.869440 2463.05 6496
+38.882368 2475.25 6464
+38.895296 2475.25 6464
+38.908224 2475.25 6464
+38.921152 2475.25 6464
+38.934080 2475.25 6464
+38.947008 2475.25 6464
+38.959936 2475.25 6464
+38.972864 2475.25 6464
+38.985792 2475.25 6464
+38.998720 2475.25 6464
+39.011648 2475.25 6464
+39.024576 2475.25 6464
+39.037504 2475.25 6464
+39.050432 2475.25 6464
+39.063360 2475.25 6464
+39.076288 2475.25 6464
+39.089152 2487.56 6432
+39.102016 2487.56 6432
+39.114880 2487.56 6432
+39.127744 2487.56 6432
+39.140608 2487.56 6432
+39.153472 2487.56 6432
+39.166336 2487.56 6432
+39.179200 2487.56 6432
+39.192064 2487.56 6432
+39.204928 2487.56 6432
+39.217792 2487.56 6432
+39.230656 2487.56 6432
+39.243520 2487.56 6432
+39.256384 2487.56 6432
+39.269248 2487.56 6432
+39.282112 2487.56 6432
+39.294912 2500.00 6400
+39.307712 2500.00 6400
+39.320512 2500.00 6400
+39.333312 2500.00 6400
+39.346112 2500.00 6400
+39.358912 2500.00 6400
+39.371712 2500.00 6400
+39.384512 2500.00 6400
+39.397312 2500.00 6400
+39.410112 2500.00 6400
+39.422912 2500.00 6400
+39.435712 2500.00 6400
+39.448512 2500.00 6400
+39.461312 2500.00 6400
+39.474112 2500.00 6400
+39.486912 2500.00 6400
+39.499712 2500.00 6400
+39.512512 2500.00 6400
+39.525312 2500.00 6400
+39.538112 2500.00 6400
+39.550912 2500.00 6400
+39.563712 2500.00 6400
+39.576512 2500.00 6400
+39.589312 2500.00 6400
+39.602048 2512.56 6368
+39.614784 2512.56 6368
+39.627520 2512.56 6368
+39.640256 2512.56 6368
+39.652992 2512.56 6368
+39.665728 2512.56 6368
+39.678464 2512.56 6368
+39.691200 2512.56 6368
+39.703936 2512.56 6368
+39.716672 2512.56 6368
+39.729408 2512.56 6368
+39.742144 2512.56 6368
+39.754880 2512.56 6368
+39.767616 2512.56 6368
+39.780352 2512.56 6368
+39.793088 2512.56 6368
+39.805760 2525.25 6336
+39.818432 2525.25 6336
+39.831104 2525.25 6336
+39.843776 2525.25 6336
+39.856448 2525.25 6336
+39.869120 2525.25 6336
+39.881792 2525.25 6336
+39.894464 2525.25 6336
+39.907136 2525.25 6336
+39.919808 2525.25 6336
+39.932480 2525.25 6336
+39.945152 2525.25 6336
+39.957824 2525.25 6336
+39.970496 2525.25 6336
+39.983168 2525.25 6336
+39.995840 2525.25 6336
+40.008448 2538.07 6304
+40.021056 2538.07 6304
+40.033664 2538.07 6304
+40.046272 2538.07 6304
+40.058880 2538.07 6304
+40.071488 2538.07 6304
+40.084096 2538.07 6304
+40.096704 2538.07 6304
+40.109312 2538.07 6304
+40.121920 2538.07 6304
+40.134528 2538.07 6304
+40.147136 2538.07 6304
+40.159744 2538.07 6304
+40.172352 2538.07 6304
+40.184960 2538.07 6304
+40.197568 2538.07 6304
+40.210112 2551.02 6272
+40.222656 2551.02 6272
+40.235200 2551.02 6272
+40.247744 2551.02 6272
+40.260288 2551.02 6272
+40.272832 2551.02 6272
+40.285376 2551.02 6272
+40.297920 2551.02 6272
+40.310464 2551.02 6272
+40.323008 2551.02 6272
+40.335552 2551.02 6272
+40.348096 2551.02 6272
+40.360640 2551.02 6272
+40.373184 2551.02 6272
+40.385728 2551.02 6272
+40.398272 2551.02 6272
+40.410688 2577.32 6208
+40.423104 2577.32 6208
+40.435520 2577.32 6208
+40.447936 2577.32 6208
+40.460352 2577.32 6208
+40.472768 2577.32 6208
+40.485184 2577.32 6208
+40.497600 2577.32 6208
+40.510016 2577.32 6208
+40.522432 2577.32 6208
+40.534848 2577.32 6208
+40.547264 2577.32 6208
+40.559680 2577.32 6208
+40.572096 2577.32 6208
+40.584512 2577.32 6208
+40.596928 2577.32 6208
+40.609280 2590.67 6176
+40.621632 2590.67 6176
+40.633984 2590.67 6176
+40.646336 2590.67 6176
+40.658688 2590.67 6176
+40.671040 2590.67 6176
+40.683392 2590.67 6176
+40.695744 2590.67 6176
+40.708096 2590.67 6176
+40.720448 2590.67 6176
+40.732800 2590.67 6176
+40.745152 2590.67 6176
+40.757504 2590.67 6176
+40.769856 2590.67 6176
+40.782208 2590.67 6176
+40.794560 2590.67 6176
+40.806912 2590.67 6176
+40.819264 2590.67 6176
+40.831616 2590.67 6176
+40.843968 2590.67 6176
+40.856320 2590.67 6176
+40.868672 2590.67 6176
+40.881024 2590.67 6176
+40.893376 2590.67 6176
+40.905664 2604.17 6144
+40.917952 2604.17 6144
+40.930240 2604.17 6144
+40.942528 2604.17 6144
+40.954816 2604.17 6144
+40.967104 2604.17 6144
+40.979392 2604.17 6144
+40.991680 2604.17 6144
+41.003968 2604.17 6144
+41.016256 2604.17 6144
+41.028544 2604.17 6144
+41.040832 2604.17 6144
+41.053120 2604.17 6144
+41.065408 2604.17 6144
+41.077696 2604.17 6144
+41.089984 2604.17 6144
+41.102208 2617.80 6112
+41.114432 2617.80 6112
+41.126656 2617.80 6112
+41.138880 2617.80 6112
+41.151104 2617.80 6112
+41.163328 2617.80 6112
+41.175552 2617.80 6112
+41.187776 2617.80 6112
+41.200000 2617.80 6112
+41.212224 2617.80 6112
+41.224448 2617.80 6112
+41.236672 2617.80 6112
+41.248896 2617.80 6112
+41.261120 2617.80 6112
+41.273344 2617.80 6112
+41.285568 2617.80 6112
+41.297728 2631.58 6080
+41.309888 2631.58 6080
+41.322048 2631.58 6080
+41.334208 2631.58 6080
+41.346368 2631.58 6080
+41.358528 2631.58 6080
+41.370688 2631.58 6080
+41.382848 2631.58 6080
+41.395008 2631.58 6080
+41.407168 2631.58 6080
+41.419328 2631.58 6080
+41.431488 2631.58 6080
+41.443648 2631.58 6080
+41.455808 2631.58 6080
+41.467968 2631.58 6080
+41.480128 2631.58 6080
+41.492288 2631.58 6080
+41.504448 2631.58 6080
+41.516608 2631.58 6080
+41.528768 2631.58 6080
+41.540928 2631.58 6080
+41.553088 2631.58 6080
+41.565248 2631.58 6080
+41.577408 2631.58 6080
+41.589504 2645.50 6048
+41.601600 2645.50 6048
+41.613696 2645.50 6048
+41.625792 2645.50 6048
+41.637888 2645.50 6048
+41.649984 2645.50 6048
+41.662080 2645.50 6048
+41.674176 2645.50 6048
+41.686272 2645.50 6048
+41.698368 2645.50 6048
+41.710464 2645.50 6048
+41.722560 2645.50 6048
+41.734656 2645.50 6048
+41.746752 2645.50 6048
+41.758848 2645.50 6048
+41.770944 2645.50 6048
+41.782976 2659.57 6016
+41.795008 2659.57 6016
+41.807040 2659.57 6016
+41.819072 2659.57 6016
+41.831104 2659.57 6016
+41.843136 2659.57 6016
+41.855168 2659.57 6016
+41.867200 2659.57 6016
+41.879232 2659.57 6016
+41.891264 2659.57 6016
+41.903296 2659.57 6016
+41.915328 2659.57 6016
+41.927360 2659.57 6016
+41.939392 2659.57 6016
+41.951424 2659.57 6016
+41.963456 2659.57 6016
+41.975424 2673.80 5984
+41.987392 2673.80 5984
+41.999360 2673.80 5984
+42.011328 2673.80 5984
+42.023296 2673.80 5984
+42.035264 2673.80 5984
+42.047232 2673.80 5984
+42.059200 2673.80 5984
+42.071168 2673.80 5984
+42.083136 2673.80 5984
+42.095104 2673.80 5984
+42.107072 2673.80 5984
+42.119040 2673.80 5984
+42.131008 2673.80 5984
+42.142976 2673.80 5984
+42.154944 2673.80 5984
+42.166912 2673.80 5984
+42.178880 2673.80 5984
+42.190848 2673.80 5984
+42.202816 2673.80 5984
+42.214784 2673.80 5984
+42.226752 2673.80 5984
+42.238720 2673.80 5984
+42.250688 2673.80 5984
+42.262592 2688.17 5952
+42.274496 2688.17 5952
+42.286400 2688.17 5952
+42.298304 2688.17 5952
+42.310208 2688.17 5952
+42.322112 2688.17 5952
+42.334016 2688.17 5952
+42.345920 2688.17 5952
+42.357824 2688.17 5952
+42.369728 2688.17 5952
+42.381632 2688.17 5952
+42.393536 2688.17 5952
+42.405440 2688.17 5952
+42.417344 2688.17 5952
+42.429248 2688.17 5952
+42.441152 2688.17 5952
+42.452992 2702.70 5920
+42.464832 2702.70 5920
+42.476672 2702.70 5920
+42.488512 2702.70 5920
+42.500352 2702.70 5920
+42.512192 2702.70 5920
+42.524032 2702.70 5920
+42.535872 2702.70 5920
+42.547712 2702.70 5920
+42.559552 2702.70 5920
+42.571392 2702.70 5920
+42.583232 2702.70 5920
+42.595072 2702.70 5920
+42.606912 2702.70 5920
+42.618752 2702.70 5920
+42.630592 2702.70 5920
+42.642432 2702.70 5920
+42.654272 2702.70 5920
+42.666112 2702.70 5920
+42.677952 2702.70 5920
+42.689792 2702.70 5920
+42.701632 2702.70 5920
+42.713472 2702.70 5920
+42.725312 2702.70 5920
+42.737088 2717.39 5888
+42.748864 2717.39 5888
+42.760640 2717.39 5888
+42.772416 2717.39 5888
+42.784192 2717.39 5888
+42.795968 2717.39 5888
+42.807744 2717.39 5888
+42.819520 2717.39 5888
+42.831296 2717.39 5888
+42.843072 2717.39 5888
+42.854848 2717.39 5888
+42.866624 2717.39 5888
+42.878400 2717.39 5888
+42.890176 2717.39 5888
+42.901952 2717.39 5888
+42.913728 2717.39 5888
+42.925440 2732.24 5856
+42.937152 2732.24 5856
+42.948864 2732.24 5856
+42.960576 2732.24 5856
+42.972288 2732.24 5856
+42.984000 2732.24 5856
+42.995712 2732.24 5856
+43.007424 2732.24 5856
+43.019136 2732.24 5856
+43.030848 2732.24 5856
+43.042560 2732.24 5856
+43.054272 2732.24 5856
+43.065984 2732.24 5856
+43.077696 2732.24 5856
+43.089408 2732.24 5856
+43.101120 2732.24 5856
+43.112832 2732.24 5856
+43.124544 2732.24 5856
+43.136256 2732.24 5856
+43.147968 2732.24 5856
+43.159680 2732.24 5856
+43.171392 2732.24 5856
+43.183104 2732.24 5856
+43.194816 2732.24 5856
+43.206464 2747.25 5824
+43.218112 2747.25 5824
+43.229760 2747.25 5824
+43.241408 2747.25 5824
+43.253056 2747.25 5824
+43.264704 2747.25 5824
+43.276352 2747.25 5824
+43.288000 2747.25 5824
+43.299648 2747.25 5824
+43.311296 2747.25 5824
+43.322944 2747.25 5824
+43.334592 2747.25 5824
+43.346240 2747.25 5824
+43.357888 2747.25 5824
+43.369536 2747.25 5824
+43.381184 2747.25 5824
+43.392768 2762.43 5792
+43.404352 2762.43 5792
+43.415936 2762.43 5792
+43.427520 2762.43 5792
+43.439104 2762.43 5792
+43.450688 2762.43 5792
+43.462272 2762.43 5792
+43.473856 2762.43 5792
+43.485440 2762.43 5792
+43.497024 2762.43 5792
+43.508608 2762.43 5792
+43.520192 2762.43 5792
+43.531776 2762.43 5792
+43.543360 2762.43 5792
+43.554944 2762.43 5792
+43.566528 2762.43 5792
+43.578112 2762.43 5792
+43.589696 2762.43 5792
+43.601280 2762.43 5792
+43.612864 2762.43 5792
+43.624448 2762.43 5792
+43.636032 2762.43 5792
+43.647616 2762.43 5792
+43.659200 2762.43 5792
+43.670720 2777.78 5760
+43.682240 2777.78 5760
+43.693760 2777.78 5760
+43.705280 2777.78 5760
+43.716800 2777.78 5760
+43.728320 2777.78 5760
+43.739840 2777.78 5760
+43.751360 2777.78 5760
+43.762880 2777.78 5760
+43.774400 2777.78 5760
+43.785920 2777.78 5760
+43.797440 2777.78 5760
+43.808960 2777.78 5760
+43.820480 2777.78 5760
+43.832000 2777.78 5760
+43.843520 2777.78 5760
+43.854976 2793.30 5728
+43.866432 2793.30 5728
+43.877888 2793.30 5728
+43.889344 2793.30 5728
+43.900800 2793.30 5728
+43.912256 2793.30 5728
+43.923712 2793.30 5728
+43.935168 2793.30 5728
+43.946624 2793.30 5728
+43.958080 2793.30 5728
+43.969536 2793.30 5728
+43.980992 2793.30 5728
+43.992448 2793.30 5728
+44.003904 2793.30 5728
+44.015360 2793.30 5728
+44.026816 2793.30 5728
+44.038272 2793.30 5728
+44.049728 2793.30 5728
+44.061184 2793.30 5728
+44.072640 2793.30 5728
+44.084096 2793.30 5728
+44.095552 2793.30 5728
+44.107008 2793.30 5728
+44.118464 2793.30 5728
+44.129856 2808.99 5696
+44.141248 2808.99 5696
+44.152640 2808.99 5696
+44.164032 2808.99 5696
+44.175424 2808.99 5696
+44.186816 2808.99 5696
+44.198208 2808.99 5696
+44.209600 2808.99 5696
+44.220992 2808.99 5696
+44.232384 2808.99 5696
+44.243776 2808.99 5696
+44.255168 2808.99 5696
+44.266560 2808.99 5696
+44.277952 2808.99 5696
+44.289344 2808.99 5696
+44.300736 2808.99 5696
+44.312128 2808.99 5696
+44.323520 2808.99 5696
+44.334912 2808.99 5696
+44.346304 2808.99 5696
+44.357696 2808.99 5696
+44.369088 2808.99 5696
+44.380480 2808.99 5696
+44.391872 2808.99 5696
+44.403200 2824.86 5664
+44.414528 2824.86 5664
+44.425856 2824.86 5664
+44.437184 2824.86 5664
+44.448512 2824.86 5664
+44.459840 2824.86 5664
+44.471168 2824.86 5664
+44.482496 2824.86 5664
+44.493824 2824.86 5664
+44.505152 2824.86 5664
+44.516480 2824.86 5664
+44.527808 2824.86 5664
+44.539136 2824.86 5664
+44.550464 2824.86 5664
+44.561792 2824.86 5664
+44.573120 2824.86 5664
+44.584384 2840.91 5632
+44.595648 2840.91 5632
+44.606912 2840.91 5632
+44.618176 2840.91 5632
+44.629440 2840.91 5632
+44.640704 2840.91 5632
+44.651968 2840.91 5632
+44.663232 2840.91 5632
+44.674496 2840.91 5632
+44.685760 2840.91 5632
+44.697024 2840.91 5632
+44.708288 2840.91 5632
+44.719552 2840.91 5632
+44.730816 2840.91 5632
+44.742080 2840.91 5632
+44.753344 2840.91 5632
+44.764608 2840.91 5632
+44.775872 2840.91 5632
+44.787136 2840.91 5632
+44.798400 2840.91 5632
+44.809664 2840.91 5632
+44.820928 2840.91 5632
+44.832192 2840.91 5632
+44.843456 2840.91 5632
+44.854656 2857.14 5600
+44.865856 2857.14 5600
+44.877056 2857.14 5600
+44.888256 2857.14 5600
+44.899456 2857.14 5600
+44.910656 2857.14 5600
+44.921856 2857.14 5600
+44.933056 2857.14 5600
+44.944256 2857.14 5600
+44.955456 2857.14 5600
+44.966656 2857.14 5600
+44.977856 2857.14 5600
+44.989056 2857.14 5600
+45.000256 2857.14 5600
+45.011456 2857.14 5600
+45.022656 2857.14 5600
+45.033856 2857.14 5600
+45.045056 2857.14 5600
+45.056256 2857.14 5600
+45.067456 2857.14 5600
+45.078656 2857.14 5600
+45.089856 2857.14 5600
+45.101056 2857.14 5600
+45.112256 2857.14 5600
+45.123392 2873.56 5568
+45.134528 2873.56 5568
+45.145664 2873.56 5568
+45.156800 2873.56 5568
+45.167936 2873.56 5568
+45.179072 2873.56 5568
+45.190208 2873.56 5568
+45.201344 2873.56 5568
+45.212480 2873.56 5568
+45.223616 2873.56 5568
+45.234752 2873.56 5568
+45.245888 2873.56 5568
+45.257024 2873.56 5568
+45.268160 2873.56 5568
+45.279296 2873.56 5568
+45.290432 2873.56 5568
+45.301568 2873.56 5568
+45.312704 2873.56 5568
+45.323840 2873.56 5568
+45.334976 2873.56 5568
+45.346112 2873.56 5568
+45.357248 2873.56 5568
+45.368384 2873.56 5568
+45.379520 2873.56 5568
+45.390656 2873.56 5568
+45.401792 2873.56 5568
+45.412928 2873.56 5568
+45.424064 2873.56 5568
+45.435200 2873.56 5568
+45.446336 2873.56 5568
+45.457472 2873.56 5568
+45.468608 2873.56 5568
+45.479744 2873.56 5568
+45.490880 2873.56 5568
+45.502016 2873.56 5568
+45.513152 2873.56 5568
+45.524288 2873.56 5568
+45.535424 2873.56 5568
+45.546560 2873.56 5568
+45.557696 2873.56 5568
+45.568768 2890.17 5536
+45.579840 2890.17 5536
+45.590912 2890.17 5536
+45.601984 2890.17 5536
+45.613056 2890.17 5536
+45.624128 2890.17 5536
+45.635200 2890.17 5536
+45.646272 2890.17 5536
+45.657344 2890.17 5536
+45.668416 2890.17 5536
+45.679488 2890.17 5536
+45.690560 2890.17 5536
+45.701632 2890.17 5536
+45.712704 2890.17 5536
+45.723776 2890.17 5536
+45.734848 2890.17 5536
+45.745920 2890.17 5536
+45.756992 2890.17 5536
+45.768064 2890.17 5536
+45.779136 2890.17 5536
+45.790208 2890.17 5536
+45.801280 2890.17 5536
+45.812352 2890.17 5536
+45.823424 2890.17 5536
+45.834496 2890.17 5536
+45.845568 2890.17 5536
+45.856640 2890.17 5536
+45.867712 2890.17 5536
+45.878784 2890.17 5536
+45.889856 2890.17 5536
+45.900928 2890.17 5536
+45.912000 2890.17 5536
+45.923008 2906.98 5504
+45.934016 2906.98 5504
+45.945024 2906.98 5504
+45.956032 2906.98 5504
+45.967040 2906.98 5504
+45.978048 2906.98 5504
+45.989056 2906.98 5504
+46.000064 2906.98 5504
+46.011072 2906.98 5504
+46.022080 2906.98 5504
+46.033088 2906.98 5504
+46.044096 2906.98 5504
+46.055104 2906.98 5504
+46.066112 2906.98 5504
+46.077120 2906.98 5504
+46.088128 2906.98 5504
+46.099072 2923.98 5472
+46.110016 2923.98 5472
+46.120960 2923.98 5472
+46.131904 2923.98 5472
+46.142848 2923.98 5472
+46.153792 2923.98 5472
+46.164736 2923.98 5472
+46.175680 2923.98 5472
+46.186624 2923.98 5472
+46.197568 2923.98 5472
+46.208512 2923.98 5472
+46.219456 2923.98 5472
+46.230400 2923.98 5472
+46.241344 2923.98 5472
+46.252288 2923.98 5472
+46.263232 2923.98 5472
+46.274176 2923.98 5472
+46.285120 2923.98 5472
+46.296064 2923.98 5472
+46.307008 2923.98 5472
+46.317952 2923.98 5472
+46.328896 2923.98 5472
+46.339840 2923.98 5472
+46.350784 2923.98 5472
+46.361728 2923.98 5472
+46.372672 2923.98 5472
+46.383616 2923.98 5472
+46.394560 2923.98 5472
+46.405504 2923.98 5472
+46.416448 2923.98 5472
+46.427392 2923.98 5472
+46.438336 2923.98 5472
+46.449216 2941.18 5440
+46.460096 2941.18 5440
+46.470976 2941.18 5440
+46.481856 2941.18 5440
+46.492736 2941.18 5440
+46.503616 2941.18 5440
+46.514496 2941.18 5440
+46.525376 2941.18 5440
+46.536256 2941.18 5440
+46.547136 2941.18 5440
+46.558016 2941.18 5440
+46.568896 2941.18 5440
+46.579776 2941.18 5440
+46.590656 2941.18 5440
+46.601536 2941.18 5440
+46.612416 2941.18 5440
+46.623232 2958.58 5408
+46.634048 2958.58 5408
+46.644864 2958.58 5408
+46.655680 2958.58 5408
+46.666496 2958.58 5408
+46.677312 2958.58 5408
+46.688128 2958.58 5408
+46.698944 2958.58 5408
+46.709760 2958.58 5408
+46.720576 2958.58 5408
+46.731392 2958.58 5408
+46.742208 2958.58 5408
+46.753024 2958.58 5408
+46.763840 2958.58 5408
+46.774656 2958.58 5408
+46.785472 2958.58 5408
+46.796288 2958.58 5408
+46.807104 2958.58 5408
+46.817920 2958.58 5408
+46.828736 2958.58 5408
+46.839552 2958.58 5408
+46.850368 2958.58 5408
+46.861184 2958.58 5408
+46.872000 2958.58 5408
+46.882816 2958.58 5408
+46.893632 2958.58 5408
+46.904448 2958.58 5408
+46.915264 2958.58 5408
+46.926080 2958.58 5408
+46.936896 2958.58 5408
+46.947712 2958.58 5408
+46.958528 2958.58 5408
+46.969280 2976.19 5376
+46.980032 2976.19 5376
+46.990784 2976.19 5376
+47.001536 2976.19 5376
+47.012288 2976.19 5376
+47.023040 2976.19 5376
+47.033792 2976.19 5376
+47.044544 2976.19 5376
+47.055296 2976.19 5376
+47.066048 2976.19 5376
+47.076800 2976.19 5376
+47.087552 2976.19 5376
+47.098304 2976.19 5376
+47.109056 2976.19 5376
+47.119808 2976.19 5376
+47.130560 2976.19 5376
+47.141248 2994.01 5344
+47.151936 2994.01 5344
+47.162624 2994.01 5344
+47.173312 2994.01 5344
+47.184000 2994.01 5344
+47.194688 2994.01 5344
+47.205376 2994.01 5344
+47.216064 2994.01 5344
+47.226752 2994.01 5344
+47.237440 2994.01 5344
+47.248128 2994.01 5344
+47.258816 2994.01 5344
+47.269504 2994.01 5344
+47.280192 2994.01 5344
+47.290880 2994.01 5344
+47.301568 2994.01 5344
+47.312256 2994.01 5344
+47.322944 2994.01 5344
+47.333632 2994.01 5344
+47.344320 2994.01 5344
+47.355008 2994.01 5344
+47.365696 2994.01 5344
+47.376384 2994.01 5344
+47.387072 2994.01 5344
+47.397760 2994.01 5344
+47.408448 2994.01 5344
+47.419136 2994.01 5344
+47.429824 2994.01 5344
+47.440512 2994.01 5344
+47.451200 2994.01 5344
+47.461888 2994.01 5344
+47.472576 2994.01 5344
+47.483200 3012.05 5312
+47.499136 3012.05 5312
+47.515072 3012.05 5312
+47.531008 3012.05 5312
+47.546944 3012.05 5312
+47.562880 3012.05 5312
+47.578816 3012.05 5312
+47.594752 3012.05 5312
+47.610688 3012.05 5312
+47.626624 3012.05 5312
+47.642560 3012.05 5312
+47.658400 3030.30 5280
+47.674240 3030.30 5280
+47.690080 3030.30 5280
+47.705920 3030.30 5280
+47.721760 3030.30 5280
+47.737600 3030.30 5280
+47.753440 3030.30 5280
+47.769280 3030.30 5280
+47.785120 3030.30 5280
+47.800960 3030.30 5280
+47.816800 3030.30 5280
+47.832640 3030.30 5280
+47.848480 3030.30 5280
+47.864320 3030.30 5280
+47.880160 3030.30 5280
+47.896000 3030.30 5280
+47.911840 3030.30 5280
+47.927680 3030.30 5280
+47.943520 3030.30 5280
+47.959360 3030.30 5280
+47.975200 3030.30 5280
+47.990944 3048.78 5248
+48.006688 3048.78 5248
+48.022432 3048.78 5248
+48.038176 3048.78 5248
+48.053920 3048.78 5248
+48.069664 3048.78 5248
+48.085408 3048.78 5248
+48.101152 3048.78 5248
+48.116896 3048.78 5248
+48.132640 3048.78 5248
+48.148384 3048.78 5248
+48.164032 3067.48 5216
+48.179680 3067.48 5216
+48.195328 3067.48 5216
+48.210976 3067.48 5216
+48.226624 3067.48 5216
+48.242272 3067.48 5216
+48.257920 3067.48 5216
+48.273568 3067.48 5216
+48.289216 3067.48 5216
+48.304864 3067.48 5216
+48.320512 3067.48 5216
+48.336160 3067.48 5216
+48.351808 3067.48 5216
+48.367456 3067.48 5216
+48.383104 3067.48 5216
+48.398752 3067.48 5216
+48.414400 3067.48 5216
+48.430048 3067.48 5216
+48.445696 3067.48 5216
+48.461344 3067.48 5216
+48.476992 3067.48 5216
+48.492640 3067.48 5216
+48.508288 3067.48 5216
+48.523936 3067.48 5216
+48.539584 3067.48 5216
+48.555232 3067.48 5216
+48.570880 3067.48 5216
+48.586528 3067.48 5216
+48.602176 3067.48 5216
+48.617824 3067.48 5216
+48.633472 3067.48 5216
+48.649120 3067.48 5216
+48.664672 3086.42 5184
+48.680224 3086.42 5184
+48.695776 3086.42 5184
+48.711328 3086.42 5184
+48.726880 3086.42 5184
+48.742432 3086.42 5184
+48.757984 3086.42 5184
+48.773536 3086.42 5184
+48.789088 3086.42 5184
+48.804640 3086.42 5184
+48.820192 3086.42 5184
+48.835744 3086.42 5184
+48.851296 3086.42 5184
+48.866848 3086.42 5184
+48.882400 3086.42 5184
+48.897952 3086.42 5184
+48.913504 3086.42 5184
+48.929056 3086.42 5184
+48.944608 3086.42 5184
+48.960160 3086.42 5184
+48.975712 3086.42 5184
+48.991168 3105.59 5152
+49.006624 3105.59 5152
+49.022080 3105.59 5152
+49.037536 3105.59 5152
+49.052992 3105.59 5152
+49.068448 3105.59 5152
+49.083904 3105.59 5152
+49.099360 3105.59 5152
+49.114816 3105.59 5152
+49.130272 3105.59 5152
+49.145728 3105.59 5152
+49.161184 3105.59 5152
+49.176640 3105.59 5152
+49.192096 3105.59 5152
+49.207552 3105.59 5152
+49.223008 3105.59 5152
+49.238464 3105.59 5152
+49.253920 3105.59 5152
+49.269376 3105.59 5152
+49.284832 3105.59 5152
+49.300288 3105.59 5152
+49.315744 3105.59 5152
+49.331104 3125.00 5120
+49.346464 3125.00 5120
+49.361824 3125.00 5120
+49.377184 3125.00 5120
+49.392544 3125.00 5120
+49.407904 3125.00 5120
+49.423264 3125.00 5120
+49.438624 3125.00 5120
+49.453984 3125.00 5120
+49.469344 3125.00 5120
+49.484608 3144.65 5088
+49.499872 3144.65 5088
+49.515136 3144.65 5088
+49.530400 3144.65 5088
+49.545664 3144.65 5088
+49.560928 3144.65 5088
+49.576192 3144.65 5088
+49.591456 3144.65 5088
+49.606720 3144.65 5088
+49.621984 3144.65 5088
+49.637248 3144.65 5088
+49.652512 3144.65 5088
+49.667776 3144.65 5088
+49.683040 3144.65 5088
+49.698304 3144.65 5088
+49.713568 3144.65 5088
+49.728832 3144.65 5088
+49.744096 3144.65 5088
+49.759360 3144.65 5088
+49.774624 3144.65 5088
+49.789888 3144.65 5088
+49.805152 3144.65 5088
+49.820320 3164.56 5056
+49.835488 3164.56 5056
+49.850656 3164.56 5056
+49.865824 3164.56 5056
+49.880992 3164.56 5056
+49.896160 3164.56 5056
+49.911328 3164.56 5056
+49.926496 3164.56 5056
+49.941664 3164.56 5056
+49.956832 3164.56 5056
+49.972000 3164.56 5056
+49.987168 3164.56 5056
+50.002336 3164.56 5056
+50.017504 3164.56 5056
+50.032672 3164.56 5056
+50.047840 3164.56 5056
+50.063008 3164.56 5056
+50.078176 3164.56 5056
+50.093344 3164.56 5056
+50.108512 3164.56 5056
+50.123680 3164.56 5056
+50.138752 3184.71 5024
+50.153824 3184.71 5024
+50.168896 3184.71 5024
+50.183968 3184.71 5024
+50.199040 3184.71 5024
+50.214112 3184.71 5024
+50.229184 3184.71 5024
+50.244256 3184.71 5024
+50.259328 3184.71 5024
+50.274400 3184.71 5024
+50.289472 3184.71 5024
+50.304544 3184.71 5024
+50.319616 3184.71 5024
+50.334688 3184.71 5024
+50.349760 3184.71 5024
+50.364832 3184.71 5024
+50.379904 3184.71 5024
+50.394976 3184.71 5024
+50.410048 3184.71 5024
+50.425120 3184.71 5024
+50.440192 3184.71 5024
+50.455264 3184.71 5024
+50.470336 3184.71 5024
+50.485408 3184.71 5024
+50.500480 3184.71 5024
+50.515552 3184.71 5024
+50.530624 3184.71 5024
+50.545696 3184.71 5024
+50.560768 3184.71 5024
+50.575840 3184.71 5024
+50.590912 3184.71 5024
+50.605984 3184.71 5024
+50.620960 3205.13 4992
+50.635936 3205.13 4992
+50.650912 3205.13 4992
+50.665888 3205.13 4992
+50.680864 3205.13 4992
+50.695840 3205.13 4992
+50.710816 3205.13 4992
+50.725792 3205.13 4992
+50.740768 3205.13 4992
+50.755744 3205.13 4992
+50.770720 3205.13 4992
+50.785696 3205.13 4992
+50.800672 3205.13 4992
+50.815648 3205.13 4992
+50.830624 3205.13 4992
+50.845600 3205.13 4992
+50.860576 3205.13 4992
+50.875552 3205.13 4992
+50.890528 3205.13 4992
+50.905504 3205.13 4992
+50.920480 3205.13 4992
+50.935360 3225.81 4960
+50.950240 3225.81 4960
+50.965120 3225.81 4960
+50.980000 3225.81 4960
+50.994880 3225.81 4960
+51.009760 3225.81 4960
+51.024640 3225.81 4960
+51.039520 3225.81 4960
+51.054400 3225.81 4960
+51.069280 3225.81 4960
+51.084160 3225.81 4960
+51.099040 3225.81 4960
+51.113920 3225.81 4960
+51.128800 3225.81 4960
+51.143680 3225.81 4960
+51.158560 3225.81 4960
+51.173440 3225.81 4960
+51.188320 3225.81 4960
+51.203200 3225.81 4960
+51.218080 3225.81 4960
+51.232960 3225.81 4960
+51.247840 3225.81 4960
+51.262624 3246.75 4928
+51.277408 3246.75 4928
+51.292192 3246.75 4928
+51.306976 3246.75 4928
+51.321760 3246.75 4928
+51.336544 3246.75 4928
+51.351328 3246.75 4928
+51.366112 3246.75 4928
+51.380896 3246.75 4928
+51.395680 3246.75 4928
+51.410368 3267.97 4896
+51.425056 3267.97 4896
+51.439744 3267.97 4896
+51.454432 3267.97 4896
+51.469120 3267.97 4896
+51.483808 3267.97 4896
+51.498496 3267.97 4896
+51.513184 3267.97 4896
+51.527872 3267.97 4896
+51.542560 3267.97 4896
+51.557248 3267.97 4896
+51.571936 3267.97 4896
+51.586624 3267.97 4896
+51.601312 3267.97 4896
+51.616000 3267.97 4896
+51.630688 3267.97 4896
+51.645376 3267.97 4896
+51.660064 3267.97 4896
+51.674752 3267.97 4896
+51.689440 3267.97 4896
+51.704128 3267.97 4896
+51.718816 3267.97 4896
+51.733408 3289.47 4864
+51.748000 3289.47 4864
+51.762592 3289.47 4864
+51.777184 3289.47 4864
+51.791776 3289.47 4864
+51.806368 3289.47 4864
+51.820960 3289.47 4864
+51.835552 3289.47 4864
+51.850144 3289.47 4864
+51.864736 3289.47 4864
+51.879328 3289.47 4864
+51.893920 3289.47 4864
+51.908512 3289.47 4864
+51.923104 3289.47 4864
+51.937696 3289.47 4864
+51.952288 3289.47 4864
+51.966880 3289.47 4864
+51.981472 3289.47 4864
+51.996064 3289.47 4864
+52.010656 3289.47 4864
+52.025248 3289.47 4864
+52.039840 3289.47 4864
+52.054432 3289.47 4864
+52.069024 3289.47 4864
+52.083616 3289.47 4864
+52.098208 3289.47 4864
+52.112800 3289.47 4864
+52.127392 3289.47 4864
+52.141984 3289.47 4864
+52.156576 3289.47 4864
+52.171168 3289.47 4864
+52.185760 3289.47 4864
+52.200352 3289.47 4864
+52.214944 3289.47 4864
+52.229536 3289.47 4864
+52.244128 3289.47 4864
+52.258720 3289.47 4864
+52.273312 3289.47 4864
+52.287904 3289.47 4864
+52.302496 3289.47 4864
+52.317088 3289.47 4864
+52.331680 3289.47 4864
+52.346176 3311.26 4832
+52.360672 3311.26 4832
+52.375168 3311.26 4832
+52.389664 3311.26 4832
+52.404160 3311.26 4832
+52.418656 3311.26 4832
+52.433152 3311.26 4832
+52.447648 3311.26 4832
+52.462144 3311.26 4832
+52.476640 3311.26 4832
+52.491136 3311.26 4832
+52.505632 3311.26 4832
+52.520128 3311.26 4832
+52.534624 3311.26 4832
+52.549120 3311.26 4832
+52.563616 3311.26 4832
+52.578112 3311.26 4832
+52.592608 3311.26 4832
+52.607104 3311.26 4832
+52.621600 3311.26 4832
+52.636096 3311.26 4832
+52.650592 3311.26 4832
+52.664992 3333.33 4800
+52.679392 3333.33 4800
+52.693792 3333.33 4800
+52.708192 3333.33 4800
+52.722592 3333.33 4800
+52.736992 3333.33 4800
+52.751392 3333.33 4800
+52.765792 3333.33 4800
+52.780192 3333.33 4800
+52.794592 3333.33 4800
+52.808992 3333.33 4800
+52.823392 3333.33 4800
+52.837792 3333.33 4800
+52.852192 3333.33 4800
+52.866592 3333.33 4800
+52.880992 3333.33 4800
+52.895392 3333.33 4800
+52.909792 3333.33 4800
+52.924192 3333.33 4800
+52.938592 3333.33 4800
+52.952992 3333.33 4800
+52.967296 3355.70 4768
+52.981600 3355.70 4768
+52.995904 3355.70 4768
+53.010208 3355.70 4768
+53.024512 3355.70 4768
+53.038816 3355.70 4768
+53.053120 3355.70 4768
+53.067424 3355.70 4768
+53.081728 3355.70 4768
+53.096032 3355.70 4768
+53.110336 3355.70 4768
+53.124544 3378.38 4736
+53.138752 3378.38 4736
+53.152960 3378.38 4736
+53.167168 3378.38 4736
+53.181376 3378.38 4736
+53.195584 3378.38 4736
+53.209792 3378.38 4736
+53.224000 3378.38 4736
+53.238208 3378.38 4736
+53.252416 3378.38 4736
+53.266624 3378.38 4736
+53.280832 3378.38 4736
+53.295040 3378.38 4736
+53.309248 3378.38 4736
+53.323456 3378.38 4736
+53.337664 3378.38 4736
+53.351872 3378.38 4736
+53.366080 3378.38 4736
+53.380288 3378.38 4736
+53.394496 3378.38 4736
+53.408704 3378.38 4736
+53.422816 3401.36 4704
+53.436928 3401.36 4704
+53.451040 3401.36 4704
+53.465152 3401.36 4704
+53.479264 3401.36 4704
+53.493376 3401.36 4704
+53.507488 3401.36 4704
+53.521600 3401.36 4704
+53.535712 3401.36 4704
+53.549824 3401.36 4704
+53.563936 3401.36 4704
+53.578048 3401.36 4704
+53.592160 3401.36 4704
+53.606272 3401.36 4704
+53.620384 3401.36 4704
+53.634496 3401.36 4704
+53.648608 3401.36 4704
+53.662720 3401.36 4704
+53.676832 3401.36 4704
+53.690944 3401.36 4704
+53.705056 3401.36 4704
+53.719168 3401.36 4704
+53.733280 3401.36 4704
+53.747392 3401.36 4704
+53.761504 3401.36 4704
+53.775616 3401.36 4704
+53.789728 3401.36 4704
+53.803840 3401.36 4704
+53.817952 3401.36 4704
+53.832064 3401.36 4704
+53.846176 3401.36 4704
+53.860288 3401.36 4704
+53.874400 3401.36 4704
+53.888512 3401.36 4704
+53.902624 3401.36 4704
+53.916736 3401.36 4704
+53.930848 3401.36 4704
+53.944960 3401.36 4704
+53.959072 3401.36 4704
+53.973184 3401.36 4704
+53.987296 3401.36 4704
+54.001408 3401.36 4704
+54.015520 3401.36 4704
+54.029536 3424.66 4672
+54.043552 3424.66 4672
+54.057568 3424.66 4672
+54.071584 3424.66 4672
+54.085600 3424.66 4672
+54.099616 3424.66 4672
+54.113632 3424.66 4672
+54.127648 3424.66 4672
+54.141664 3424.66 4672
+54.155680 3424.66 4672
+54.169696 3424.66 4672
+54.183712 3424.66 4672
+54.197728 3424.66 4672
+54.211744 3424.66 4672
+54.225760 3424.66 4672
+54.239776 3424.66 4672
+54.253792 3424.66 4672
+54.267808 3424.66 4672
+54.281824 3424.66 4672
+54.295840 3424.66 4672
+54.309856 3424.66 4672
+54.323776 3448.28 4640
+54.337696 3448.28 4640
+54.351616 3448.28 4640
+54.365536 3448.28 4640
+54.379456 3448.28 4640
+54.393376 3448.28 4640
+54.407296 3448.28 4640
+54.421216 3448.28 4640
+54.435136 3448.28 4640
+54.449056 3448.28 4640
+54.462976 3448.28 4640
+54.476896 3448.28 4640
+54.490816 3448.28 4640
+54.504736 3448.28 4640
+54.518656 3448.28 4640
+54.532576 3448.28 4640
+54.546496 3448.28 4640
+54.560416 3448.28 4640
+54.574336 3448.28 4640
+54.588256 3448.28 4640
+54.602176 3448.28 4640
+54.616000 3472.22 4608
+54.629824 3472.22 4608
+54.643648 3472.22 4608
+54.657472 3472.22 4608
+54.671296 3472.22 4608
+54.685120 3472.22 4608
+54.698944 3472.22 4608
+54.712768 3472.22 4608
+54.726592 3472.22 4608
+54.740416 3472.22 4608
+54.754240 3472.22 4608
+54.768064 3472.22 4608
+54.781888 3472.22 4608
+54.795712 3472.22 4608
+54.809536 3472.22 4608
+54.823360 3472.22 4608
+54.837184 3472.22 4608
+54.851008 3472.22 4608
+54.864832 3472.22 4608
+54.878656 3472.22 4608
+54.892480 3472.22 4608
+54.906304 3472.22 4608
+54.920128 3472.22 4608
+54.933952 3472.22 4608
+54.947776 3472.22 4608
+54.961600 3472.22 4608
+54.975424 3472.22 4608
+54.989248 3472.22 4608
+55.003072 3472.22 4608
+55.016896 3472.22 4608
+55.030720 3472.22 4608
+55.044544 3472.22 4608
+55.058368 3472.22 4608
+55.072192 3472.22 4608
+55.086016 3472.22 4608
+55.099840 3472.22 4608
+55.113664 3472.22 4608
+55.127488 3472.22 4608
+55.141312 3472.22 4608
+55.155136 3472.22 4608
+55.168960 3472.22 4608
+55.182784 3472.22 4608
+55.196608 3472.22 4608
+55.210336 3496.50 4576
+55.224064 3496.50 4576
+55.237792 3496.50 4576
+55.251520 3496.50 4576
+55.265248 3496.50 4576
+55.278976 3496.50 4576
+55.292704 3496.50 4576
+55.306432 3496.50 4576
+55.320160 3496.50 4576
+55.333888 3496.50 4576
+55.347616 3496.50 4576
+55.361344 3496.50 4576
+55.375072 3496.50 4576
+55.388800 3496.50 4576
+55.402528 3496.50 4576
+55.416256 3496.50 4576
+55.429984 3496.50 4576
+55.443712 3496.50 4576
+55.457440 3496.50 4576
+55.471168 3496.50 4576
+55.484896 3496.50 4576
+55.498528 3521.13 4544
+55.512160 3521.13 4544
+55.525792 3521.13 4544
+55.539424 3521.13 4544
+55.553056 3521.13 4544
+55.566688 3521.13 4544
+55.580320 3521.13 4544
+55.593952 3521.13 4544
+55.607584 3521.13 4544
+55.621216 3521.13 4544
+55.634848 3521.13 4544
+55.648480 3521.13 4544
+55.662112 3521.13 4544
+55.675744 3521.13 4544
+55.689376 3521.13 4544
+55.703008 3521.13 4544
+55.716640 3521.13 4544
+55.730272 3521.13 4544
+55.743904 3521.13 4544
+55.757536 3521.13 4544
+55.771168 3521.13 4544
+55.784800 3521.13 4544
+55.798336 3546.10 4512
+55.811872 3546.10 4512
+55.825408 3546.10 4512
+55.838944 3546.10 4512
+55.852480 3546.10 4512
+55.866016 3546.10 4512
+55.879552 3546.10 4512
+55.893088 3546.10 4512
+55.906624 3546.10 4512
+55.920160 3546.10 4512
+55.933696 3546.10 4512
+55.947232 3546.10 4512
+55.960768 3546.10 4512
+55.974304 3546.10 4512
+55.987840 3546.10 4512
+56.001376 3546.10 4512
+56.014912 3546.10 4512
+56.028448 3546.10 4512
+56.041984 3546.10 4512
+56.055520 3546.10 4512
+56.069056 3546.10 4512
+56.082592 3546.10 4512
+56.096128 3546.10 4512
+56.109664 3546.10 4512
+56.123200 3546.10 4512
+56.136736 3546.10 4512
+56.150272 3546.10 4512
+56.163808 3546.10 4512
+56.177344 3546.10 4512
+56.190880 3546.10 4512
+56.204416 3546.10 4512
+56.217952 3546.10 4512
+56.231392 3571.43 4480
+56.244832 3571.43 4480
+56.258272 3571.43 4480
+56.271712 3571.43 4480
+56.285152 3571.43 4480
+56.298592 3571.43 4480
+56.312032 3571.43 4480
+56.325472 3571.43 4480
+56.338912 3571.43 4480
+56.352352 3571.43 4480
+56.365792 3571.43 4480
+56.379232 3571.43 4480
+56.392672 3571.43 4480
+56.406112 3571.43 4480
+56.419552 3571.43 4480
+56.432992 3571.43 4480
+56.446432 3571.43 4480
+56.459872 3571.43 4480
+56.473312 3571.43 4480
+56.486752 3571.43 4480
+56.500192 3571.43 4480
+56.513632 3571.43 4480
+56.527072 3571.43 4480
+56.540512 3571.43 4480
+56.553952 3571.43 4480
+56.567392 3571.43 4480
+56.580832 3571.43 4480
+56.594272 3571.43 4480
+56.607712 3571.43 4480
+56.621152 3571.43 4480
+56.634592 3571.43 4480
+56.648032 3571.43 4480
+56.661472 3571.43 4480
+56.674912 3571.43 4480
+56.688352 3571.43 4480
+56.701792 3571.43 4480
+56.715232 3571.43 4480
+56.728672 3571.43 4480
+56.742112 3571.43 4480
+56.755552 3571.43 4480
+56.768992 3571.43 4480
+56.782432 3571.43 4480
+56.795776 3597.12 4448
+56.809120 3597.12 4448
+56.822464 3597.12 4448
+56.835808 3597.12 4448
+56.849152 3597.12 4448
+56.862496 3597.12 4448
+56.875840 3597.12 4448
+56.889184 3597.12 4448
+56.902528 3597.12 4448
+56.915872 3597.12 4448
+56.929216 3597.12 4448
+56.942560 3597.12 4448
+56.955904 3597.12 4448
+56.969248 3597.12 4448
+56.982592 3597.12 4448
+56.995936 3597.12 4448
+57.009280 3597.12 4448
+57.022624 3597.12 4448
+57.035968 3597.12 4448
+57.049312 3597.12 4448
+57.062656 3597.12 4448
+57.076000 3597.12 4448
+57.089248 3623.19 4416
+57.102496 3623.19 4416
+57.115744 3623.19 4416
+57.128992 3623.19 4416
+57.142240 3623.19 4416
+57.155488 3623.19 4416
+57.168736 3623.19 4416
+57.181984 3623.19 4416
+57.195232 3623.19 4416
+57.208480 3623.19 4416
+57.221728 3623.19 4416
+57.234976 3623.19 4416
+57.248224 3623.19 4416
+57.261472 3623.19 4416
+57.274720 3623.19 4416
+57.287968 3623.19 4416
+57.301216 3623.19 4416
+57.314464 3623.19 4416
+57.327712 3623.19 4416
+57.340960 3623.19 4416
+57.354208 3623.19 4416
+57.367360 3649.64 4384
+57.380512 3649.64 4384
+57.393664 3649.64 4384
+57.406816 3649.64 4384
+57.419968 3649.64 4384
+57.433120 3649.64 4384
+57.446272 3649.64 4384
+57.459424 3649.64 4384
+57.472576 3649.64 4384
+57.485728 3649.64 4384
+57.498880 3649.64 4384
+57.512032 3649.64 4384
+57.525184 3649.64 4384
+57.538336 3649.64 4384
+57.551488 3649.64 4384
+57.564640 3649.64 4384
+57.577792 3649.64 4384
+57.590944 3649.64 4384
+57.604096 3649.64 4384
+57.617248 3649.64 4384
+57.630400 3649.64 4384
+57.643552 3649.64 4384
+57.656704 3649.64 4384
+57.669856 3649.64 4384
+57.683008 3649.64 4384
+57.696160 3649.64 4384
+57.709312 3649.64 4384
+57.722464 3649.64 4384
+57.735616 3649.64 4384
+57.748768 3649.64 4384
+57.761920 3649.64 4384
+57.775072 3649.64 4384
+57.788224 3649.64 4384
+57.801376 3649.64 4384
+57.814528 3649.64 4384
+57.827680 3649.64 4384
+57.840832 3649.64 4384
+57.853984 3649.64 4384
+57.867136 3649.64 4384
+57.880288 3649.64 4384
+57.893440 3649.64 4384
+57.906592 3649.64 4384
+57.919744 3649.64 4384
+57.932896 3649.64 4384
+57.946048 3649.64 4384
+57.959200 3649.64 4384
+57.972352 3649.64 4384
+57.985504 3649.64 4384
+57.998656 3649.64 4384
+58.011808 3649.64 4384
+58.024960 3649.64 4384
+58.038112 3649.64 4384
+58.051264 3649.64 4384
+58.064320 3676.47 4352
+58.077376 3676.47 4352
+58.090432 3676.47 4352
+58.103488 3676.47 4352
+58.116544 3676.47 4352
+58.129600 3676.47 4352
+58.142656 3676.47 4352
+58.155712 3676.47 4352
+58.168768 3676.47 4352
+58.181824 3676.47 4352
+58.194880 3676.47 4352
+58.207936 3676.47 4352
+58.220992 3676.47 4352
+58.234048 3676.47 4352
+58.247104 3676.47 4352
+58.260160 3676.47 4352
+58.273216 3676.47 4352
+58.286272 3676.47 4352
+58.299328 3676.47 4352
+58.312384 3676.47 4352
+58.325440 3676.47 4352
+58.338496 3676.47 4352
+58.351456 3703.70 4320
+58.364416 3703.70 4320
+58.377376 3703.70 4320
+58.390336 3703.70 4320
+58.403296 3703.70 4320
+58.416256 3703.70 4320
+58.429216 3703.70 4320
+58.442176 3703.70 4320
+58.455136 3703.70 4320
+58.468096 3703.70 4320
+58.481056 3703.70 4320
+58.494016 3703.70 4320
+58.506976 3703.70 4320
+58.519936 3703.70 4320
+58.532896 3703.70 4320
+58.545856 3703.70 4320
+58.558816 3703.70 4320
+58.571776 3703.70 4320
+58.584736 3703.70 4320
+58.597696 3703.70 4320
+58.610656 3703.70 4320
+58.623616 3703.70 4320
+58.636576 3703.70 4320
+58.649536 3703.70 4320
+58.662496 3703.70 4320
+58.675456 3703.70 4320
+58.688416 3703.70 4320
+58.701376 3703.70 4320
+58.714336 3703.70 4320
+58.727296 3703.70 4320
+58.740256 3703.70 4320
+58.753216 3703.70 4320
+58.766176 3703.70 4320
+58.779136 3703.70 4320
+58.792096 3703.70 4320
+58.805056 3703.70 4320
+58.818016 3703.70 4320
+58.830976 3703.70 4320
+58.843936 3703.70 4320
+58.856896 3703.70 4320
+58.869856 3703.70 4320
+58.882816 3703.70 4320
+58.895776 3703.70 4320
+58.908736 3703.70 4320
+58.921696 3703.70 4320
+58.934656 3703.70 4320
+58.947616 3703.70 4320
+58.960576 3703.70 4320
+58.973536 3703.70 4320
+58.986496 3703.70 4320
+58.999456 3703.70 4320
+59.012416 3703.70 4320
+59.025376 3703.70 4320
+59.038240 3731.34 4288
+59.051104 3731.34 4288
+59.063968 3731.34 4288
+59.076832 3731.34 4288
+59.089696 3731.34 4288
+59.102560 3731.34 4288
+59.115424 3731.34 4288
+59.128288 3731.34 4288
+59.141152 3731.34 4288
+59.154016 3731.34 4288
+59.166880 3731.34 4288
+59.179744 3731.34 4288
+59.192608 3731.34 4288
+59.205472 3731.34 4288
+59.218336 3731.34 4288
+59.231200 3731.34 4288
+59.244064 3731.34 4288
+59.256928 3731.34 4288
+59.269792 3731.34 4288
+59.282656 3731.34 4288
+59.295520 3731.34 4288
+59.308288 3759.40 4256
+59.321056 3759.40 4256
+59.333824 3759.40 4256
+59.346592 3759.40 4256
+59.359360 3759.40 4256
+59.372128 3759.40 4256
+59.384896 3759.40 4256
+59.397664 3759.40 4256
+59.410432 3759.40 4256
+59.423200 3759.40 4256
+59.435968 3759.40 4256
+59.448736 3759.40 4256
+59.461504 3759.40 4256
+59.474272 3759.40 4256
+59.487040 3759.40 4256
+59.499808 3759.40 4256
+59.512576 3759.40 4256
+59.525344 3759.40 4256
+59.538112 3759.40 4256
+59.550880 3759.40 4256
+59.563648 3759.40 4256
+59.576416 3759.40 4256
+59.589088 3787.88 4224
+59.601760 3787.88 4224
+59.614432 3787.88 4224
+59.627104 3787.88 4224
+59.639776 3787.88 4224
+59.652448 3787.88 4224
+59.665120 3787.88 4224
+59.677792 3787.88 4224
+59.690464 3787.88 4224
+59.703136 3787.88 4224
+59.715808 3787.88 4224
+59.728480 3787.88 4224
+59.741152 3787.88 4224
+59.753824 3787.88 4224
+59.766496 3787.88 4224
+59.779168 3787.88 4224
+59.791840 3787.88 4224
+59.804512 3787.88 4224
+59.817184 3787.88 4224
+59.829856 3787.88 4224
+59.842528 3787.88 4224
+59.855200 3787.88 4224
+59.867872 3787.88 4224
+59.880544 3787.88 4224
+59.893216 3787.88 4224
+59.905888 3787.88 4224
+59.918560 3787.88 4224
+59.931232 3787.88 4224
+59.943904 3787.88 4224
+59.956576 3787.88 4224
+59.969248 3787.88 4224
+59.981920 3787.88 4224
+59.994592 3787.88 4224
+60.007264 3787.88 4224
+60.019936 3787.88 4224
+60.032608 3787.88 4224
+60.045280 3787.88 4224
+60.057952 3787.88 4224
+60.070624 3787.88 4224
+60.083296 3787.88 4224
+60.095968 3787.88 4224
+60.108640 3787.88 4224
+60.121312 3787.88 4224
+60.133984 3787.88 4224
+60.146656 3787.88 4224
+60.159328 3787.88 4224
+60.172000 3787.88 4224
+60.184672 3787.88 4224
+60.197344 3787.88 4224
+60.210016 3787.88 4224
+60.222688 3787.88 4224
+60.235360 3787.88 4224
+60.248032 3787.88 4224
+60.260608 3816.79 4192
+60.273184 3816.79 4192
+60.285760 3816.79 4192
+60.298336 3816.79 4192
+60.310912 3816.79 4192
+60.323488 3816.79 4192
+60.336064 3816.79 4192
+60.348640 3816.79 4192
+60.361216 3816.79 4192
+60.373792 3816.79 4192
+60.386368 3816.79 4192
+60.398944 3816.79 4192
+60.411520 3816.79 4192
+60.424096 3816.79 4192
+60.436672 3816.79 4192
+60.449248 3816.79 4192
+60.461824 3816.79 4192
+60.474400 3816.79 4192
+60.486976 3816.79 4192
+60.499552 3816.79 4192
+60.512128 3816.79 4192
+60.524704 3816.79 4192
+60.537280 3816.79 4192
+60.549856 3816.79 4192
+60.562432 3816.79 4192
+60.575008 3816.79 4192
+60.587584 3816.79 4192
+60.600160 3816.79 4192
+60.612736 3816.79 4192
+60.625312 3816.79 4192
+60.637888 3816.79 4192
+60.650464 3816.79 4192
+60.662944 3846.15 4160
+60.675424 3846.15 4160
+60.687904 3846.15 4160
+60.700384 3846.15 4160
+60.712864 3846.15 4160
+60.725344 3846.15 4160
+60.737824 3846.15 4160
+60.750304 3846.15 4160
+60.762784 3846.15 4160
+60.775264 3846.15 4160
+60.787744 3846.15 4160
+60.800224 3846.15 4160
+60.812704 3846.15 4160
+60.825184 3846.15 4160
+60.837664 3846.15 4160
+60.850144 3846.15 4160
+60.862624 3846.15 4160
+60.875104 3846.15 4160
+60.887584 3846.15 4160
+60.900064 3846.15 4160
+60.912544 3846.15 4160
+60.924928 3875.97 4128
+60.937312 3875.97 4128
+60.949696 3875.97 4128
+60.962080 3875.97 4128
+60.974464 3875.97 4128
+60.986848 3875.97 4128
+60.999232 3875.97 4128
+61.011616 3875.97 4128
+61.024000 3875.97 4128
+61.036384 3875.97 4128
+61.048768 3875.97 4128
+61.061152 3875.97 4128
+61.073536 3875.97 4128
+61.085920 3875.97 4128
+61.098304 3875.97 4128
+61.110688 3875.97 4128
+61.123072 3875.97 4128
+61.135456 3875.97 4128
+61.147840 3875.97 4128
+61.160224 3875.97 4128
+61.172608 3875.97 4128
+61.184992 3875.97 4128
+61.197376 3875.97 4128
+61.209760 3875.97 4128
+61.222144 3875.97 4128
+61.234528 3875.97 4128
+61.246912 3875.97 4128
+61.259296 3875.97 4128
+61.271680 3875.97 4128
+61.284064 3875.97 4128
+61.296448 3875.97 4128
+61.308832 3875.97 4128
+61.321216 3875.97 4128
+61.333600 3875.97 4128
+61.345984 3875.97 4128
+61.358368 3875.97 4128
+61.370752 3875.97 4128
+61.383136 3875.97 4128
+61.395520 3875.97 4128
+61.407904 3875.97 4128
+61.420288 3875.97 4128
+61.432672 3875.97 4128
+61.445056 3875.97 4128
+61.457440 3875.97 4128
+61.469824 3875.97 4128
+61.482208 3875.97 4128
+61.494592 3875.97 4128
+61.506976 3875.97 4128
+61.519360 3875.97 4128
+61.531744 3875.97 4128
+61.544128 3875.97 4128
+61.556512 3875.97 4128
+61.568896 3875.97 4128
+61.581280 3875.97 4128
+61.593568 3906.25 4096
+61.605856 3906.25 4096
+61.618144 3906.25 4096
+61.630432 3906.25 4096
+61.642720 3906.25 4096
+61.655008 3906.25 4096
+61.667296 3906.25 4096
+61.679584 3906.25 4096
+61.691872 3906.25 4096
+61.704160 3906.25 4096
+61.716448 3906.25 4096
+61.728736 3906.25 4096
+61.741024 3906.25 4096
+61.753312 3906.25 4096
+61.765600 3906.25 4096
+61.777888 3906.25 4096
+61.790176 3906.25 4096
+61.802464 3906.25 4096
+61.814752 3906.25 4096
+61.827040 3906.25 4096
+61.839328 3906.25 4096
+61.851616 3906.25 4096
+61.863904 3906.25 4096
+61.876192 3906.25 4096
+61.888480 3906.25 4096
+61.900768 3906.25 4096
+61.913056 3906.25 4096
+61.925344 3906.25 4096
+61.937632 3906.25 4096
+61.949920 3906.25 4096
+61.962208 3906.25 4096
+61.974496 3906.25 4096
+61.986736 3921.57 4080
+61.998976 3921.57 4080
+62.011216 3921.57 4080
+62.023456 3921.57 4080
+62.035696 3921.57 4080
+62.047936 3921.57 4080
+62.060176 3921.57 4080
+62.072416 3921.57 4080
+62.084656 3921.57 4080
+62.096896 3921.57 4080
+62.109136 3921.57 4080
+62.121376 3921.57 4080
+62.133616 3921.57 4080
+62.145856 3921.57 4080
+62.158096 3921.57 4080
+62.170336 3921.57 4080
+62.182576 3921.57 4080
+62.194816 3921.57 4080
+62.207056 3921.57 4080
+62.219296 3921.57 4080
+62.231536 3921.57 4080
+62.243728 3937.01 4064
+62.255920 3937.01 4064
+62.268112 3937.01 4064
+62.280304 3937.01 4064
+62.292496 3937.01 4064
+62.304688 3937.01 4064
+62.316880 3937.01 4064
+62.329072 3937.01 4064
+62.341264 3937.01 4064
+62.353456 3937.01 4064
+62.365648 3937.01 4064
+62.377840 3937.01 4064
+62.390032 3937.01 4064
+62.402224 3937.01 4064
+62.414416 3937.01 4064
+62.426608 3937.01 4064
+62.438800 3937.01 4064
+62.450992 3937.01 4064
+62.463184 3937.01 4064
+62.475376 3937.01 4064
+62.487568 3937.01 4064
+62.499760 3937.01 4064
+62.511952 3937.01 4064
+62.524144 3937.01 4064
+62.536336 3937.01 4064
+62.548528 3937.01 4064
+62.560720 3937.01 4064
+62.572912 3937.01 4064
+62.585104 3937.01 4064
+62.597296 3937.01 4064
+62.609488 3937.01 4064
+62.621680 3937.01 4064
+62.633776 3968.25 4032
+62.645872 3968.25 4032
+62.657968 3968.25 4032
+62.670064 3968.25 4032
+62.682160 3968.25 4032
+62.694256 3968.25 4032
+62.706352 3968.25 4032
+62.718448 3968.25 4032
+62.730544 3968.25 4032
+62.742640 3968.25 4032
+62.754736 3968.25 4032
+62.766832 3968.25 4032
+62.778928 3968.25 4032
+62.791024 3968.25 4032
+62.803120 3968.25 4032
+62.815216 3968.25 4032
+62.827312 3968.25 4032
+62.839408 3968.25 4032
+62.851504 3968.25 4032
+62.863600 3968.25 4032
+62.875696 3968.25 4032
+62.887792 3968.25 4032
+62.899888 3968.25 4032
+62.911984 3968.25 4032
+62.924080 3968.25 4032
+62.936176 3968.25 4032
+62.948272 3968.25 4032
+62.960368 3968.25 4032
+62.972464 3968.25 4032
+62.984560 3968.25 4032
+62.996656 3968.25 4032
+63.008752 3968.25 4032
+63.020800 3984.06 4016
+63.032848 3984.06 4016
+63.044896 3984.06 4016
+63.056944 3984.06 4016
+63.068992 3984.06 4016
+63.081040 3984.06 4016
+63.093088 3984.06 4016
+63.105136 3984.06 4016
+63.117184 3984.06 4016
+63.129232 3984.06 4016
+63.141280 3984.06 4016
+63.153328 3984.06 4016
+63.165376 3984.06 4016
+63.177424 3984.06 4016
+63.189472 3984.06 4016
+63.201520 3984.06 4016
+63.213568 3984.06 4016
+63.225616 3984.06 4016
+63.237664 3984.06 4016
+63.249712 3984.06 4016
+63.261760 3984.06 4016
+63.273760 4000.00 4000
+63.433760 4000.00 4000
+63.537760 4000.00 4000
+63.553824 3984.06 4016
+63.565872 3984.06 4016
+63.577920 3984.06 4016
+63.589968 3984.06 4016
+63.602016 3984.06 4016
+63.614064 3984.06 4016
+63.626112 3984.06 4016
+63.638160 3984.06 4016
+63.650208 3984.06 4016
+63.662256 3984.06 4016
+63.674304 3984.06 4016
+63.686352 3984.06 4016
+63.698400 3984.06 4016
+63.710448 3984.06 4016
+63.722496 3984.06 4016
+63.734544 3984.06 4016
+63.746592 3984.06 4016
+63.758640 3984.06 4016
+63.770688 3984.06 4016
+63.782736 3984.06 4016
+63.794784 3984.06 4016
+63.806880 3968.25 4032
+63.818976 3968.25 4032
+63.831072 3968.25 4032
+63.843168 3968.25 4032
+63.855264 3968.25 4032
+63.867360 3968.25 4032
+63.879456 3968.25 4032
+63.891552 3968.25 4032
+63.903648 3968.25 4032
+63.915744 3968.25 4032
+63.927840 3968.25 4032
+63.939936 3968.25 4032
+63.952032 3968.25 4032
+63.964128 3968.25 4032
+63.976224 3968.25 4032
+63.988320 3968.25 4032
+64.000416 3968.25 4032
+64.012512 3968.25 4032
+64.024608 3968.25 4032
+64.036704 3968.25 4032
+64.048800 3968.25 4032
+64.060896 3968.25 4032
+64.072992 3968.25 4032
+64.085088 3968.25 4032
+64.097184 3968.25 4032
+64.109280 3968.25 4032
+64.121376 3968.25 4032
+64.133472 3968.25 4032
+64.145568 3968.25 4032
+64.157664 3968.25 4032
+64.169760 3968.25 4032
+64.181856 3968.25 4032
+64.194048 3937.01 4064
+64.206240 3937.01 4064
+64.218432 3937.01 4064
+64.230624 3937.01 4064
+64.242816 3937.01 4064
+64.255008 3937.01 4064
+64.267200 3937.01 4064
+64.279392 3937.01 4064
+64.291584 3937.01 4064
+64.303776 3937.01 4064
+64.315968 3937.01 4064
+64.328160 3937.01 4064
+64.340352 3937.01 4064
+64.352544 3937.01 4064
+64.364736 3937.01 4064
+64.376928 3937.01 4064
+64.389120 3937.01 4064
+64.401312 3937.01 4064
+64.413504 3937.01 4064
+64.425696 3937.01 4064
+64.437888 3937.01 4064
+64.450080 3937.01 4064
+64.462272 3937.01 4064
+64.474464 3937.01 4064
+64.486656 3937.01 4064
+64.498848 3937.01 4064
+64.511040 3937.01 4064
+64.523232 3937.01 4064
+64.535424 3937.01 4064
+64.547616 3937.01 4064
+64.559808 3937.01 4064
+64.572000 3937.01 4064
+64.584240 3921.57 4080
+64.596480 3921.57 4080
+64.608720 3921.57 4080
+64.620960 3921.57 4080
+64.633200 3921.57 4080
+64.645440 3921.57 4080
+64.657680 3921.57 4080
+64.669920 3921.57 4080
+64.682160 3921.57 4080
+64.694400 3921.57 4080
+64.706640 3921.57 4080
+64.718880 3921.57 4080
+64.731120 3921.57 4080
+64.743360 3921.57 4080
+64.755600 3921.57 4080
+64.767840 3921.57 4080
+64.780080 3921.57 4080
+64.792320 3921.57 4080
+64.804560 3921.57 4080
+64.816800 3921.57 4080
+64.829040 3921.57 4080
+64.841328 3906.25 4096
+64.853616 3906.25 4096
+64.865904 3906.25 4096
+64.878192 3906.25 4096
+64.890480 3906.25 4096
+64.902768 3906.25 4096
+64.915056 3906.25 4096
+64.927344 3906.25 4096
+64.939632 3906.25 4096
+64.951920 3906.25 4096
+64.964208 3906.25 4096
+64.976496 3906.25 4096
+64.988784 3906.25 4096
+65.001072 3906.25 4096
+65.013360 3906.25 4096
+65.025648 3906.25 4096
+65.037936 3906.25 4096
+65.050224 3906.25 4096
+65.062512 3906.25 4096
+65.074800 3906.25 4096
+65.087088 3906.25 4096
+65.099376 3906.25 4096
+65.111664 3906.25 4096
+65.123952 3906.25 4096
+65.136240 3906.25 4096
+65.148528 3906.25 4096
+65.160816 3906.25 4096
+65.173104 3906.25 4096
+65.185392 3906.25 4096
+65.197680 3906.25 4096
+65.209968 3906.25 4096
+65.222256 3906.25 4096
+65.234640 3875.97 4128
+65.247024 3875.97 4128
+65.259408 3875.97 4128
+65.271792 3875.97 4128
+65.284176 3875.97 4128
+65.296560 3875.97 4128
+65.308944 3875.97 4128
+65.321328 3875.97 4128
+65.333712 3875.97 4128
+65.346096 3875.97 4128
+65.358480 3875.97 4128
+65.370864 3875.97 4128
+65.383248 3875.97 4128
+65.395632 3875.97 4128
+65.408016 3875.97 4128
+65.420400 3875.97 4128
+65.432784 3875.97 4128
+65.445168 3875.97 4128
+65.457552 3875.97 4128
+65.469936 3875.97 4128
+65.482320 3875.97 4128
+65.494704 3875.97 4128
+65.507088 3875.97 4128
+65.519472 3875.97 4128
+65.531856 3875.97 4128
+65.544240 3875.97 4128
+65.556624 3875.97 4128
+65.569008 3875.97 4128
+65.581392 3875.97 4128
+65.593776 3875.97 4128
+65.606160 3875.97 4128
+65.618544 3875.97 4128
+65.630928 3875.97 4128
+65.643312 3875.97 4128
+65.655696 3875.97 4128
+65.668080 3875.97 4128
+65.680464 3875.97 4128
+65.692848 3875.97 4128
+65.705232 3875.97 4128
+65.717616 3875.97 4128
+65.730000 3875.97 4128
+65.742384 3875.97 4128
+65.754768 3875.97 4128
+65.767152 3875.97 4128
+65.779536 3875.97 4128
+65.791920 3875.97 4128
+65.804304 3875.97 4128
+65.816688 3875.97 4128
+65.829072 3875.97 4128
+65.841456 3875.97 4128
+65.853840 3875.97 4128
+65.866224 3875.97 4128
+65.878608 3875.97 4128
+65.891088 3846.15 4160
+65.903568 3846.15 4160
+65.916048 3846.15 4160
+65.928528 3846.15 4160
+65.941008 3846.15 4160
+65.953488 3846.15 4160
+65.965968 3846.15 4160
+65.978448 3846.15 4160
+65.990928 3846.15 4160
+66.003408 3846.15 4160
+66.015888 3846.15 4160
+66.028368 3846.15 4160
+66.040848 3846.15 4160
+66.053328 3846.15 4160
+66.065808 3846.15 4160
+66.078288 3846.15 4160
+66.090768 3846.15 4160
+66.103248 3846.15 4160
+66.115728 3846.15 4160
+66.128208 3846.15 4160
+66.140688 3846.15 4160
+66.153168 3846.15 4160
+66.165744 3816.79 4192
+66.178320 3816.79 4192
+66.190896 3816.79 4192
+66.203472 3816.79 4192
+66.216048 3816.79 4192
+66.228624 3816.79 4192
+66.241200 3816.79 4192
+66.253776 3816.79 4192
+66.266352 3816.79 4192
+66.278928 3816.79 4192
+66.291504 3816.79 4192
+66.304080 3816.79 4192
+66.316656 3816.79 4192
+66.329232 3816.79 4192
+66.341808 3816.79 4192
+66.354384 3816.79 4192
+66.366960 3816.79 4192
+66.379536 3816.79 4192
+66.392112 3816.79 4192
+66.404688 3816.79 4192
+66.417264 3816.79 4192
+66.429840 3816.79 4192
+66.442416 3816.79 4192
+66.454992 3816.79 4192
+66.467568 3816.79 4192
+66.480144 3816.79 4192
+66.492720 3816.79 4192
+66.505296 3816.79 4192
+66.517872 3816.79 4192
+66.530448 3816.79 4192
+66.543024 3816.79 4192
+66.555600 3816.79 4192
+66.568272 3787.88 4224
+66.580944 3787.88 4224
+66.593616 3787.88 4224
+66.606288 3787.88 4224
+66.618960 3787.88 4224
+66.631632 3787.88 4224
+66.644304 3787.88 4224
+66.656976 3787.88 4224
+66.669648 3787.88 4224
+66.682320 3787.88 4224
+66.694992 3787.88 4224
+66.707664 3787.88 4224
+66.720336 3787.88 4224
+66.733008 3787.88 4224
+66.745680 3787.88 4224
+66.758352 3787.88 4224
+66.771024 3787.88 4224
+66.783696 3787.88 4224
+66.796368 3787.88 4224
+66.809040 3787.88 4224
+66.821712 3787.88 4224
+66.834384 3787.88 4224
+66.847056 3787.88 4224
+66.859728 3787.88 4224
+66.872400 3787.88 4224
+66.885072 3787.88 4224
+66.897744 3787.88 4224
+66.910416 3787.88 4224
+66.923088 3787.88 4224
+66.935760 3787.88 4224
+66.948432 3787.88 4224
+66.961104 3787.88 4224
+66.973776 3787.88 4224
+66.986448 3787.88 4224
+66.999120 3787.88 4224
+67.011792 3787.88 4224
+67.024464 3787.88 4224
+67.037136 3787.88 4224
+67.049808 3787.88 4224
+67.062480 3787.88 4224
+67.075152 3787.88 4224
+67.087824 3787.88 4224
+67.100496 3787.88 4224
+67.113168 3787.88 4224
+67.125840 3787.88 4224
+67.138512 3787.88 4224
+67.151184 3787.88 4224
+67.163856 3787.88 4224
+67.176528 3787.88 4224
+67.189200 3787.88 4224
+67.201872 3787.88 4224
+67.214544 3787.88 4224
+67.227216 3787.88 4224
+67.239984 3759.40 4256
+67.252752 3759.40 4256
+67.265520 3759.40 4256
+67.278288 3759.40 4256
+67.291056 3759.40 4256
+67.303824 3759.40 4256
+67.316592 3759.40 4256
+67.329360 3759.40 4256
+67.342128 3759.40 4256
+67.354896 3759.40 4256
+67.367664 3759.40 4256
+67.380432 3759.40 4256
+67.393200 3759.40 4256
+67.405968 3759.40 4256
+67.418736 3759.40 4256
+67.431504 3759.40 4256
+67.444272 3759.40 4256
+67.457040 3759.40 4256
+67.469808 3759.40 4256
+67.482576 3759.40 4256
+67.495344 3759.40 4256
+67.508208 3731.34 4288
+67.521072 3731.34 4288
+67.533936 3731.34 4288
+67.546800 3731.34 4288
+67.559664 3731.34 4288
+67.572528 3731.34 4288
+67.585392 3731.34 4288
+67.598256 3731.34 4288
+67.611120 3731.34 4288
+67.623984 3731.34 4288
+67.636848 3731.34 4288
+67.649712 3731.34 4288
+67.662576 3731.34 4288
+67.675440 3731.34 4288
+67.688304 3731.34 4288
+67.701168 3731.34 4288
+67.714032 3731.34 4288
+67.726896 3731.34 4288
+67.739760 3731.34 4288
+67.752624 3731.34 4288
+67.765488 3731.34 4288
+67.778352 3731.34 4288
+67.791312 3703.70 4320
+67.804272 3703.70 4320
+67.817232 3703.70 4320
+67.830192 3703.70 4320
+67.843152 3703.70 4320
+67.856112 3703.70 4320
+67.869072 3703.70 4320
+67.882032 3703.70 4320
+67.894992 3703.70 4320
+67.907952 3703.70 4320
+67.920912 3703.70 4320
+67.933872 3703.70 4320
+67.946832 3703.70 4320
+67.959792 3703.70 4320
+67.972752 3703.70 4320
+67.985712 3703.70 4320
+67.998672 3703.70 4320
+68.011632 3703.70 4320
+68.024592 3703.70 4320
+68.037552 3703.70 4320
+68.050512 3703.70 4320
+68.063472 3703.70 4320
+68.076432 3703.70 4320
+68.089392 3703.70 4320
+68.102352 3703.70 4320
+68.115312 3703.70 4320
+68.128272 3703.70 4320
+68.141232 3703.70 4320
+68.154192 3703.70 4320
+68.167152 3703.70 4320
+68.180112 3703.70 4320
+68.193072 3703.70 4320
+68.206032 3703.70 4320
+68.218992 3703.70 4320
+68.231952 3703.70 4320
+68.244912 3703.70 4320
+68.257872 3703.70 4320
+68.270832 3703.70 4320
+68.283792 3703.70 4320
+68.296752 3703.70 4320
+68.309712 3703.70 4320
+68.322672 3703.70 4320
+68.335632 3703.70 4320
+68.348592 3703.70 4320
+68.361552 3703.70 4320
+68.374512 3703.70 4320
+68.387472 3703.70 4320
+68.400432 3703.70 4320
+68.413392 3703.70 4320
+68.426352 3703.70 4320
+68.439312 3703.70 4320
+68.452272 3703.70 4320
+68.465232 3703.70 4320
+68.478288 3676.47 4352
+68.491344 3676.47 4352
+68.504400 3676.47 4352
+68.517456 3676.47 4352
+68.530512 3676.47 4352
+68.543568 3676.47 4352
+68.556624 3676.47 4352
+68.569680 3676.47 4352
+68.582736 3676.47 4352
+68.595792 3676.47 4352
+68.608848 3676.47 4352
+68.621904 3676.47 4352
+68.634960 3676.47 4352
+68.648016 3676.47 4352
+68.661072 3676.47 4352
+68.674128 3676.47 4352
+68.687184 3676.47 4352
+68.700240 3676.47 4352
+68.713296 3676.47 4352
+68.726352 3676.47 4352
+68.739408 3676.47 4352
+68.752560 3649.64 4384
+68.765712 3649.64 4384
+68.778864 3649.64 4384
+68.792016 3649.64 4384
+68.805168 3649.64 4384
+68.818320 3649.64 4384
+68.831472 3649.64 4384
+68.844624 3649.64 4384
+68.857776 3649.64 4384
+68.870928 3649.64 4384
+68.884080 3649.64 4384
+68.897232 3649.64 4384
+68.910384 3649.64 4384
+68.923536 3649.64 4384
+68.936688 3649.64 4384
+68.949840 3649.64 4384
+68.962992 3649.64 4384
+68.976144 3649.64 4384
+68.989296 3649.64 4384
+69.002448 3649.64 4384
+69.015600 3649.64 4384
+69.028752 3649.64 4384
+69.041904 3649.64 4384
+69.055056 3649.64 4384
+69.068208 3649.64 4384
+69.081360 3649.64 4384
+69.094512 3649.64 4384
+69.107664 3649.64 4384
+69.120816 3649.64 4384
+69.133968 3649.64 4384
+69.147120 3649.64 4384
+69.160272 3649.64 4384
+69.173424 3649.64 4384
+69.186576 3649.64 4384
+69.199728 3649.64 4384
+69.212880 3649.64 4384
+69.226032 3649.64 4384
+69.239184 3649.64 4384
+69.252336 3649.64 4384
+69.265488 3649.64 4384
+69.278640 3649.64 4384
+69.291792 3649.64 4384
+69.304944 3649.64 4384
+69.318096 3649.64 4384
+69.331248 3649.64 4384
+69.344400 3649.64 4384
+69.357552 3649.64 4384
+69.370704 3649.64 4384
+69.383856 3649.64 4384
+69.397008 3649.64 4384
+69.410160 3649.64 4384
+69.423312 3649.64 4384
+69.436464 3649.64 4384
+69.449616 3649.64 4384
+69.462864 3623.19 4416
+69.476112 3623.19 4416
+69.489360 3623.19 4416
+69.502608 3623.19 4416
+69.515856 3623.19 4416
+69.529104 3623.19 4416
+69.542352 3623.19 4416
+69.555600 3623.19 4416
+69.568848 3623.19 4416
+69.582096 3623.19 4416
+69.595344 3623.19 4416
+69.608592 3623.19 4416
+69.621840 3623.19 4416
+69.635088 3623.19 4416
+69.648336 3623.19 4416
+69.661584 3623.19 4416
+69.674832 3623.19 4416
+69.688080 3623.19 4416
+69.701328 3623.19 4416
+69.714576 3623.19 4416
+69.727824 3623.19 4416
+69.741168 3597.12 4448
+69.754512 3597.12 4448
+69.767856 3597.12 4448
+69.781200 3597.12 4448
+69.794544 3597.12 4448
+69.807888 3597.12 4448
+69.821232 3597.12 4448
+69.834576 3597.12 4448
+69.847920 3597.12 4448
+69.861264 3597.12 4448
+69.874608 3597.12 4448
+69.887952 3597.12 4448
+69.901296 3597.12 4448
+69.914640 3597.12 4448
+69.927984 3597.12 4448
+69.941328 3597.12 4448
+69.954672 3597.12 4448
+69.968016 3597.12 4448
+69.981360 3597.12 4448
+69.994704 3597.12 4448
+70.008048 3597.12 4448
+70.021488 3571.43 4480
+70.034928 3571.43 4480
+70.048368 3571.43 4480
+70.061808 3571.43 4480
+70.075248 3571.43 4480
+70.088688 3571.43 4480
+70.102128 3571.43 4480
+70.115568 3571.43 4480
+70.129008 3571.43 4480
+70.142448 3571.43 4480
+70.155888 3571.43 4480
+70.169328 3571.43 4480
+70.182768 3571.43 4480
+70.196208 3571.43 4480
+70.209648 3571.43 4480
+70.223088 3571.43 4480
+70.236528 3571.43 4480
+70.249968 3571.43 4480
+70.263408 3571.43 4480
+70.276848 3571.43 4480
+70.290288 3571.43 4480
+70.303728 3571.43 4480
+70.317168 3571.43 4480
+70.330608 3571.43 4480
+70.344048 3571.43 4480
+70.357488 3571.43 4480
+70.370928 3571.43 4480
+70.384368 3571.43 4480
+70.397808 3571.43 4480
+70.411248 3571.43 4480
+70.424688 3571.43 4480
+70.438128 3571.43 4480
+70.451568 3571.43 4480
+70.465008 3571.43 4480
+70.478448 3571.43 4480
+70.491888 3571.43 4480
+70.505328 3571.43 4480
+70.518768 3571.43 4480
+70.532208 3571.43 4480
+70.545648 3571.43 4480
+70.559088 3571.43 4480
+70.572528 3571.43 4480
+70.585968 3571.43 4480
+70.599504 3546.10 4512
+70.613040 3546.10 4512
+70.626576 3546.10 4512
+70.640112 3546.10 4512
+70.653648 3546.10 4512
+70.667184 3546.10 4512
+70.680720 3546.10 4512
+70.694256 3546.10 4512
+70.707792 3546.10 4512
+70.721328 3546.10 4512
+70.734864 3546.10 4512
+70.748400 3546.10 4512
+70.761936 3546.10 4512
+70.775472 3546.10 4512
+70.789008 3546.10 4512
+70.802544 3546.10 4512
+70.816080 3546.10 4512
+70.829616 3546.10 4512
+70.843152 3546.10 4512
+70.856688 3546.10 4512
+70.870224 3546.10 4512
+70.883760 3546.10 4512
+70.897296 3546.10 4512
+70.910832 3546.10 4512
+70.924368 3546.10 4512
+70.937904 3546.10 4512
+70.951440 3546.10 4512
+70.964976 3546.10 4512
+70.978512 3546.10 4512
+70.992048 3546.10 4512
+71.005584 3546.10 4512
+71.019120 3546.10 4512
+71.032752 3521.13 4544
+71.046384 3521.13 4544
+71.060016 3521.13 4544
+71.073648 3521.13 4544
+71.087280 3521.13 4544
+71.100912 3521.13 4544
+71.114544 3521.13 4544
+71.128176 3521.13 4544
+71.141808 3521.13 4544
+71.155440 3521.13 4544
+71.169072 3521.13 4544
+71.182704 3521.13 4544
+71.196336 3521.13 4544
+71.209968 3521.13 4544
+71.223600 3521.13 4544
+71.237232 3521.13 4544
+71.250864 3521.13 4544
+71.264496 3521.13 4544
+71.278128 3521.13 4544
+71.291760 3521.13 4544
+71.305392 3521.13 4544
+71.319120 3496.50 4576
+71.332848 3496.50 4576
+71.346576 3496.50 4576
+71.360304 3496.50 4576
+71.374032 3496.50 4576
+71.387760 3496.50 4576
+71.401488 3496.50 4576
+71.415216 3496.50 4576
+71.428944 3496.50 4576
+71.442672 3496.50 4576
+71.456400 3496.50 4576
+71.470128 3496.50 4576
+71.483856 3496.50 4576
+71.497584 3496.50 4576
+71.511312 3496.50 4576
+71.525040 3496.50 4576
+71.538768 3496.50 4576
+71.552496 3496.50 4576
+71.566224 3496.50 4576
+71.579952 3496.50 4576
+71.593680 3496.50 4576
+71.607408 3496.50 4576
+71.621232 3472.22 4608
+71.635056 3472.22 4608
+71.648880 3472.22 4608
+71.662704 3472.22 4608
+71.676528 3472.22 4608
+71.690352 3472.22 4608
+71.704176 3472.22 4608
+71.718000 3472.22 4608
+71.731824 3472.22 4608
+71.745648 3472.22 4608
+71.759472 3472.22 4608
+71.773296 3472.22 4608
+71.787120 3472.22 4608
+71.800944 3472.22 4608
+71.814768 3472.22 4608
+71.828592 3472.22 4608
+71.842416 3472.22 4608
+71.856240 3472.22 4608
+71.870064 3472.22 4608
+71.883888 3472.22 4608
+71.897712 3472.22 4608
+71.911536 3472.22 4608
+71.925360 3472.22 4608
+71.939184 3472.22 4608
+71.953008 3472.22 4608
+71.966832 3472.22 4608
+71.980656 3472.22 4608
+71.994480 3472.22 4608
+72.008304 3472.22 4608
+72.022128 3472.22 4608
+72.035952 3472.22 4608
+72.049776 3472.22 4608
+72.063600 3472.22 4608
+72.077424 3472.22 4608
+72.091248 3472.22 4608
+72.105072 3472.22 4608
+72.118896 3472.22 4608
+72.132720 3472.22 4608
+72.146544 3472.22 4608
+72.160368 3472.22 4608
+72.174192 3472.22 4608
+72.188016 3472.22 4608
+72.201936 3448.28 4640
+72.215856 3448.28 4640
+72.229776 3448.28 4640
+72.243696 3448.28 4640
+72.257616 3448.28 4640
+72.271536 3448.28 4640
+72.285456 3448.28 4640
+72.299376 3448.28 4640
+72.313296 3448.28 4640
+72.327216 3448.28 4640
+72.341136 3448.28 4640
+72.355056 3448.28 4640
+72.368976 3448.28 4640
+72.382896 3448.28 4640
+72.396816 3448.28 4640
+72.410736 3448.28 4640
+72.424656 3448.28 4640
+72.438576 3448.28 4640
+72.452496 3448.28 4640
+72.466416 3448.28 4640
+72.480336 3448.28 4640
+72.494256 3448.28 4640
+72.508272 3424.66 4672
+72.522288 3424.66 4672
+72.536304 3424.66 4672
+72.550320 3424.66 4672
+72.564336 3424.66 4672
+72.578352 3424.66 4672
+72.592368 3424.66 4672
+72.606384 3424.66 4672
+72.620400 3424.66 4672
+72.634416 3424.66 4672
+72.648432 3424.66 4672
+72.662448 3424.66 4672
+72.676464 3424.66 4672
+72.690480 3424.66 4672
+72.704496 3424.66 4672
+72.718512 3424.66 4672
+72.732528 3424.66 4672
+72.746544 3424.66 4672
+72.760560 3424.66 4672
+72.774576 3424.66 4672
+72.788592 3424.66 4672
+72.802704 3401.36 4704
+72.816816 3401.36 4704
+72.830928 3401.36 4704
+72.845040 3401.36 4704
+72.859152 3401.36 4704
+72.873264 3401.36 4704
+72.887376 3401.36 4704
+72.901488 3401.36 4704
+72.915600 3401.36 4704
+72.929712 3401.36 4704
+72.943824 3401.36 4704
+72.957936 3401.36 4704
+72.972048 3401.36 4704
+72.986160 3401.36 4704
+73.000272 3401.36 4704
+73.014384 3401.36 4704
+73.028496 3401.36 4704
+73.042608 3401.36 4704
+73.056720 3401.36 4704
+73.070832 3401.36 4704
+73.084944 3401.36 4704
+73.099056 3401.36 4704
+73.113168 3401.36 4704
+73.127280 3401.36 4704
+73.141392 3401.36 4704
+73.155504 3401.36 4704
+73.169616 3401.36 4704
+73.183728 3401.36 4704
+73.197840 3401.36 4704
+73.211952 3401.36 4704
+73.226064 3401.36 4704
+73.240176 3401.36 4704
+73.254288 3401.36 4704
+73.268400 3401.36 4704
+73.282512 3401.36 4704
+73.296624 3401.36 4704
+73.310736 3401.36 4704
+73.324848 3401.36 4704
+73.338960 3401.36 4704
+73.353072 3401.36 4704
+73.367184 3401.36 4704
+73.381296 3401.36 4704
+73.395408 3401.36 4704
+73.409616 3378.38 4736
+73.423824 3378.38 4736
+73.438032 3378.38 4736
+73.452240 3378.38 4736
+73.466448 3378.38 4736
+73.480656 3378.38 4736
+73.494864 3378.38 4736
+73.509072 3378.38 4736
+73.523280 3378.38 4736
+73.537488 3378.38 4736
+73.551696 3378.38 4736
+73.565904 3378.38 4736
+73.580112 3378.38 4736
+73.594320 3378.38 4736
+73.608528 3378.38 4736
+73.622736 3378.38 4736
+73.636944 3378.38 4736
+73.651152 3378.38 4736
+73.665360 3378.38 4736
+73.679568 3378.38 4736
+73.693776 3378.38 4736
+73.708080 3355.70 4768
+73.722384 3355.70 4768
+73.736688 3355.70 4768
+73.750992 3355.70 4768
+73.765296 3355.70 4768
+73.779600 3355.70 4768
+73.793904 3355.70 4768
+73.808208 3355.70 4768
+73.822512 3355.70 4768
+73.836816 3355.70 4768
+73.851120 3355.70 4768
+73.865520 3333.33 4800
+73.879920 3333.33 4800
+73.894320 3333.33 4800
+73.908720 3333.33 4800
+73.923120 3333.33 4800
+73.937520 3333.33 4800
+73.951920 3333.33 4800
+73.966320 3333.33 4800
+73.980720 3333.33 4800
+73.995120 3333.33 4800
+74.009520 3333.33 4800
+74.023920 3333.33 4800
+74.038320 3333.33 4800
+74.052720 3333.33 4800
+74.067120 3333.33 4800
+74.081520 3333.33 4800
+74.095920 3333.33 4800
+74.110320 3333.33 4800
+74.124720 3333.33 4800
+74.139120 3333.33 4800
+74.153520 3333.33 4800
+74.168016 3311.26 4832
+74.182512 3311.26 4832
+74.197008 3311.26 4832
+74.211504 3311.26 4832
+74.226000 3311.26 4832
+74.240496 3311.26 4832
+74.254992 3311.26 4832
+74.269488 3311.26 4832
+74.283984 3311.26 4832
+74.298480 3311.26 4832
+74.312976 3311.26 4832
+74.327472 3311.26 4832
+74.341968 3311.26 4832
+74.356464 3311.26 4832
+74.370960 3311.26 4832
+74.385456 3311.26 4832
+74.399952 3311.26 4832
+74.414448 3311.26 4832
+74.428944 3311.26 4832
+74.443440 3311.26 4832
+74.457936 3311.26 4832
+74.472528 3289.47 4864
+74.487120 3289.47 4864
+74.501712 3289.47 4864
+74.516304 3289.47 4864
+74.530896 3289.47 4864
+74.545488 3289.47 4864
+74.560080 3289.47 4864
+74.574672 3289.47 4864
+74.589264 3289.47 4864
+74.603856 3289.47 4864
+74.618448 3289.47 4864
+74.633040 3289.47 4864
+74.647632 3289.47 4864
+74.662224 3289.47 4864
+74.676816 3289.47 4864
+74.691408 3289.47 4864
+74.706000 3289.47 4864
+74.720592 3289.47 4864
+74.735184 3289.47 4864
+74.749776 3289.47 4864
+74.764368 3289.47 4864
+74.778960 3289.47 4864
+74.793552 3289.47 4864
+74.808144 3289.47 4864
+74.822736 3289.47 4864
+74.837328 3289.47 4864
+74.851920 3289.47 4864
+74.866512 3289.47 4864
+74.881104 3289.47 4864
+74.895696 3289.47 4864
+74.910288 3289.47 4864
+74.924880 3289.47 4864
+74.939472 3289.47 4864
+74.954064 3289.47 4864
+74.968656 3289.47 4864
+74.983248 3289.47 4864
+74.997840 3289.47 4864
+75.012432 3289.47 4864
+75.027024 3289.47 4864
+75.041616 3289.47 4864
+75.056208 3289.47 4864
+75.070800 3289.47 4864
+75.085392 3289.47 4864
+75.100080 3267.97 4896
+75.114768 3267.97 4896
+75.129456 3267.97 4896
+75.144144 3267.97 4896
+75.158832 3267.97 4896
+75.173520 3267.97 4896
+75.188208 3267.97 4896
+75.202896 3267.97 4896
+75.217584 3267.97 4896
+75.232272 3267.97 4896
+75.246960 3267.97 4896
+75.261648 3267.97 4896
+75.276336 3267.97 4896
+75.291024 3267.97 4896
+75.305712 3267.97 4896
+75.320400 3267.97 4896
+75.335088 3267.97 4896
+75.349776 3267.97 4896
+75.364464 3267.97 4896
+75.379152 3267.97 4896
+75.393840 3267.97 4896
+75.408624 3246.75 4928
+75.423408 3246.75 4928
+75.438192 3246.75 4928
+75.452976 3246.75 4928
+75.467760 3246.75 4928
+75.482544 3246.75 4928
+75.497328 3246.75 4928
+75.512112 3246.75 4928
+75.526896 3246.75 4928
+75.541680 3246.75 4928
+75.556464 3246.75 4928
+75.571344 3225.81 4960
+75.586224 3225.81 4960
+75.601104 3225.81 4960
+75.615984 3225.81 4960
+75.630864 3225.81 4960
+75.645744 3225.81 4960
+75.660624 3225.81 4960
+75.675504 3225.81 4960
+75.690384 3225.81 4960
+75.705264 3225.81 4960
+75.720144 3225.81 4960
+75.735024 3225.81 4960
+75.749904 3225.81 4960
+75.764784 3225.81 4960
+75.779664 3225.81 4960
+75.794544 3225.81 4960
+75.809424 3225.81 4960
+75.824304 3225.81 4960
+75.839184 3225.81 4960
+75.854064 3225.81 4960
+75.868944 3225.81 4960
+75.883920 3205.13 4992
+75.898896 3205.13 4992
+75.913872 3205.13 4992
+75.928848 3205.13 4992
+75.943824 3205.13 4992
+75.958800 3205.13 4992
+75.973776 3205.13 4992
+75.988752 3205.13 4992
+76.003728 3205.13 4992
+76.018704 3205.13 4992
+76.033680 3205.13 4992
+76.048656 3205.13 4992
+76.063632 3205.13 4992
+76.078608 3205.13 4992
+76.093584 3205.13 4992
+76.108560 3205.13 4992
+76.123536 3205.13 4992
+76.138512 3205.13 4992
+76.153488 3205.13 4992
+76.168464 3205.13 4992
+76.183440 3205.13 4992
+76.198416 3205.13 4992
+76.213488 3184.71 5024
+76.228560 3184.71 5024
+76.243632 3184.71 5024
+76.258704 3184.71 5024
+76.273776 3184.71 5024
+76.288848 3184.71 5024
+76.303920 3184.71 5024
+76.318992 3184.71 5024
+76.334064 3184.71 5024
+76.349136 3184.71 5024
+76.364208 3184.71 5024
+76.379280 3184.71 5024
+76.394352 3184.71 5024
+76.409424 3184.71 5024
+76.424496 3184.71 5024
+76.439568 3184.71 5024
+76.454640 3184.71 5024
+76.469712 3184.71 5024
+76.484784 3184.71 5024
+76.499856 3184.71 5024
+76.514928 3184.71 5024
+76.530000 3184.71 5024
+76.545072 3184.71 5024
+76.560144 3184.71 5024
+76.575216 3184.71 5024
+76.590288 3184.71 5024
+76.605360 3184.71 5024
+76.620432 3184.71 5024
+76.635504 3184.71 5024
+76.650576 3184.71 5024
+76.665648 3184.71 5024
+76.680720 3184.71 5024
+76.695888 3164.56 5056
+76.711056 3164.56 5056
+76.726224 3164.56 5056
+76.741392 3164.56 5056
+76.756560 3164.56 5056
+76.771728 3164.56 5056
+76.786896 3164.56 5056
+76.802064 3164.56 5056
+76.817232 3164.56 5056
+76.832400 3164.56 5056
+76.847568 3164.56 5056
+76.862736 3164.56 5056
+76.877904 3164.56 5056
+76.893072 3164.56 5056
+76.908240 3164.56 5056
+76.923408 3164.56 5056
+76.938576 3164.56 5056
+76.953744 3164.56 5056
+76.968912 3164.56 5056
+76.984080 3164.56 5056
+76.999248 3164.56 5056
+77.014512 3144.65 5088
+77.029776 3144.65 5088
+77.045040 3144.65 5088
+77.060304 3144.65 5088
+77.075568 3144.65 5088
+77.090832 3144.65 5088
+77.106096 3144.65 5088
+77.121360 3144.65 5088
+77.136624 3144.65 5088
+77.151888 3144.65 5088
+77.167152 3144.65 5088
+77.182416 3144.65 5088
+77.197680 3144.65 5088
+77.212944 3144.65 5088
+77.228208 3144.65 5088
+77.243472 3144.65 5088
+77.258736 3144.65 5088
+77.274000 3144.65 5088
+77.289264 3144.65 5088
+77.304528 3144.65 5088
+77.319792 3144.65 5088
+77.335152 3125.00 5120
+77.350512 3125.00 5120
+77.365872 3125.00 5120
+77.381232 3125.00 5120
+77.396592 3125.00 5120
+77.411952 3125.00 5120
+77.427312 3125.00 5120
+77.442672 3125.00 5120
+77.458032 3125.00 5120
+77.473392 3125.00 5120
+77.488752 3125.00 5120
+77.504208 3105.59 5152
+77.519664 3105.59 5152
+77.535120 3105.59 5152
+77.550576 3105.59 5152
+77.566032 3105.59 5152
+77.581488 3105.59 5152
+77.596944 3105.59 5152
+77.612400 3105.59 5152
+77.627856 3105.59 5152
+77.643312 3105.59 5152
+77.658768 3105.59 5152
+77.674224 3105.59 5152
+77.689680 3105.59 5152
+77.705136 3105.59 5152
+77.720592 3105.59 5152
+77.736048 3105.59 5152
+77.751504 3105.59 5152
+77.766960 3105.59 5152
+77.782416 3105.59 5152
+77.797872 3105.59 5152
+77.813328 3105.59 5152
+77.828880 3086.42 5184
+77.844432 3086.42 5184
+77.859984 3086.42 5184
+77.875536 3086.42 5184
+77.891088 3086.42 5184
+77.906640 3086.42 5184
+77.922192 3086.42 5184
+77.937744 3086.42 5184
+77.953296 3086.42 5184
+77.968848 3086.42 5184
+77.984400 3086.42 5184
+77.999952 3086.42 5184
+78.015504 3086.42 5184
+78.031056 3086.42 5184
+78.046608 3086.42 5184
+78.062160 3086.42 5184
+78.077712 3086.42 5184
+78.093264 3086.42 5184
+78.108816 3086.42 5184
+78.124368 3086.42 5184
+78.139920 3086.42 5184
+78.155472 3086.42 5184
+78.171120 3067.48 5216
+78.186768 3067.48 5216
+78.202416 3067.48 5216
+78.218064 3067.48 5216
+78.233712 3067.48 5216
+78.249360 3067.48 5216
+78.265008 3067.48 5216
+78.280656 3067.48 5216
+78.296304 3067.48 5216
+78.311952 3067.48 5216
+78.327600 3067.48 5216
+78.343248 3067.48 5216
+78.358896 3067.48 5216
+78.374544 3067.48 5216
+78.390192 3067.48 5216
+78.405840 3067.48 5216
+78.421488 3067.48 5216
+78.437136 3067.48 5216
+78.452784 3067.48 5216
+78.468432 3067.48 5216
+78.484080 3067.48 5216
+78.499728 3067.48 5216
+78.515376 3067.48 5216
+78.531024 3067.48 5216
+78.546672 3067.48 5216
+78.562320 3067.48 5216
+78.577968 3067.48 5216
+78.593616 3067.48 5216
+78.609264 3067.48 5216
+78.624912 3067.48 5216
+78.640560 3067.48 5216
+78.656208 3067.48 5216
+78.671952 3048.78 5248
+78.687696 3048.78 5248
+78.703440 3048.78 5248
+78.719184 3048.78 5248
+78.734928 3048.78 5248
+78.750672 3048.78 5248
+78.766416 3048.78 5248
+78.782160 3048.78 5248
+78.797904 3048.78 5248
+78.813648 3048.78 5248
+78.829488 3030.30 5280
+78.845328 3030.30 5280
+78.861168 3030.30 5280
+78.877008 3030.30 5280
+78.892848 3030.30 5280
+78.908688 3030.30 5280
+78.924528 3030.30 5280
+78.940368 3030.30 5280
+78.956208 3030.30 5280
+78.972048 3030.30 5280
+78.987888 3030.30 5280
+79.003728 3030.30 5280
+79.019568 3030.30 5280
+79.035408 3030.30 5280
+79.051248 3030.30 5280
+79.067088 3030.30 5280
+79.082928 3030.30 5280
+79.098768 3030.30 5280
+79.114608 3030.30 5280
+79.130448 3030.30 5280
+79.146288 3030.30 5280
+79.162128 3030.30 5280
+79.178064 3012.05 5312
+79.194000 3012.05 5312
+79.209936 3012.05 5312
+79.225872 3012.05 5312
+79.241808 3012.05 5312
+79.257744 3012.05 5312
+79.273680 3012.05 5312
+79.289616 3012.05 5312
+79.305552 3012.05 5312
+79.321488 3012.05 5312
+79.337520 2994.01 5344
+79.348208 2994.01 5344
+79.358896 2994.01 5344
+79.369584 2994.01 5344
+79.380272 2994.01 5344
+79.390960 2994.01 5344
+79.401648 2994.01 5344
+79.412336 2994.01 5344
+79.423024 2994.01 5344
+79.433712 2994.01 5344
+79.444400 2994.01 5344
+79.455088 2994.01 5344
+79.465776 2994.01 5344
+79.476464 2994.01 5344
+79.487152 2994.01 5344
+79.497840 2994.01 5344
+79.508528 2994.01 5344
+79.519216 2994.01 5344
+79.529904 2994.01 5344
+79.540592 2994.01 5344
+79.551280 2994.01 5344
+79.561968 2994.01 5344
+79.572656 2994.01 5344
+79.583344 2994.01 5344
+79.594032 2994.01 5344
+79.604720 2994.01 5344
+79.615408 2994.01 5344
+79.626096 2994.01 5344
+79.636784 2994.01 5344
+79.647472 2994.01 5344
+79.658160 2994.01 5344
+79.668848 2994.01 5344
+79.679600 2976.19 5376
+79.690352 2976.19 5376
+79.701104 2976.19 5376
+79.711856 2976.19 5376
+79.722608 2976.19 5376
+79.733360 2976.19 5376
+79.744112 2976.19 5376
+79.754864 2976.19 5376
+79.765616 2976.19 5376
+79.776368 2976.19 5376
+79.787120 2976.19 5376
+79.797872 2976.19 5376
+79.808624 2976.19 5376
+79.819376 2976.19 5376
+79.830128 2976.19 5376
+79.840880 2976.19 5376
+79.851696 2958.58 5408
+79.862512 2958.58 5408
+79.873328 2958.58 5408
+79.884144 2958.58 5408
+79.894960 2958.58 5408
+79.905776 2958.58 5408
+79.916592 2958.58 5408
+79.927408 2958.58 5408
+79.938224 2958.58 5408
+79.949040 2958.58 5408
+79.959856 2958.58 5408
+79.970672 2958.58 5408
+79.981488 2958.58 5408
+79.992304 2958.58 5408
+80.003120 2958.58 5408
+80.013936 2958.58 5408
+80.024752 2958.58 5408
+80.035568 2958.58 5408
+80.046384 2958.58 5408
+80.057200 2958.58 5408
+80.068016 2958.58 5408
+80.078832 2958.58 5408
+80.089648 2958.58 5408
+80.100464 2958.58 5408
+80.111280 2958.58 5408
+80.122096 2958.58 5408
+80.132912 2958.58 5408
+80.143728 2958.58 5408
+80.154544 2958.58 5408
+80.165360 2958.58 5408
+80.176176 2958.58 5408
+80.186992 2958.58 5408
+80.197872 2941.18 5440
+80.208752 2941.18 5440
+80.219632 2941.18 5440
+80.230512 2941.18 5440
+80.241392 2941.18 5440
+80.252272 2941.18 5440
+80.263152 2941.18 5440
+80.274032 2941.18 5440
+80.284912 2941.18 5440
+80.295792 2941.18 5440
+80.306672 2941.18 5440
+80.317552 2941.18 5440
+80.328432 2941.18 5440
+80.339312 2941.18 5440
+80.350192 2941.18 5440
+80.361072 2941.18 5440
+80.372016 2923.98 5472
+80.382960 2923.98 5472
+80.393904 2923.98 5472
+80.404848 2923.98 5472
+80.415792 2923.98 5472
+80.426736 2923.98 5472
+80.437680 2923.98 5472
+80.448624 2923.98 5472
+80.459568 2923.98 5472
+80.470512 2923.98 5472
+80.481456 2923.98 5472
+80.492400 2923.98 5472
+80.503344 2923.98 5472
+80.514288 2923.98 5472
+80.525232 2923.98 5472
+80.536176 2923.98 5472
+80.547120 2923.98 5472
+80.558064 2923.98 5472
+80.569008 2923.98 5472
+80.579952 2923.98 5472
+80.590896 2923.98 5472
+80.601840 2923.98 5472
+80.612784 2923.98 5472
+80.623728 2923.98 5472
+80.634672 2923.98 5472
+80.645616 2923.98 5472
+80.656560 2923.98 5472
+80.667504 2923.98 5472
+80.678448 2923.98 5472
+80.689392 2923.98 5472
+80.700336 2923.98 5472
+80.711280 2923.98 5472
+80.722288 2906.98 5504
+80.733296 2906.98 5504
+80.744304 2906.98 5504
+80.755312 2906.98 5504
+80.766320 2906.98 5504
+80.777328 2906.98 5504
+80.788336 2906.98 5504
+80.799344 2906.98 5504
+80.810352 2906.98 5504
+80.821360 2906.98 5504
+80.832368 2906.98 5504
+80.843376 2906.98 5504
+80.854384 2906.98 5504
+80.865392 2906.98 5504
+80.876400 2906.98 5504
+80.887408 2906.98 5504
+80.898480 2890.17 5536
+80.909552 2890.17 5536
+80.920624 2890.17 5536
+80.931696 2890.17 5536
+80.942768 2890.17 5536
+80.953840 2890.17 5536
+80.964912 2890.17 5536
+80.975984 2890.17 5536
+80.987056 2890.17 5536
+80.998128 2890.17 5536
+81.009200 2890.17 5536
+81.020272 2890.17 5536
+81.031344 2890.17 5536
+81.042416 2890.17 5536
+81.053488 2890.17 5536
+81.064560 2890.17 5536
+81.075632 2890.17 5536
+81.086704 2890.17 5536
+81.097776 2890.17 5536
+81.108848 2890.17 5536
+81.119920 2890.17 5536
+81.130992 2890.17 5536
+81.142064 2890.17 5536
+81.153136 2890.17 5536
+81.164208 2890.17 5536
+81.175280 2890.17 5536
+81.186352 2890.17 5536
+81.197424 2890.17 5536
+81.208496 2890.17 5536
+81.219568 2890.17 5536
+81.230640 2890.17 5536
+81.241712 2890.17 5536
+81.252848 2873.56 5568
+81.263984 2873.56 5568
+81.275120 2873.56 5568
+81.286256 2873.56 5568
+81.297392 2873.56 5568
+81.308528 2873.56 5568
+81.319664 2873.56 5568
+81.330800 2873.56 5568
+81.341936 2873.56 5568
+81.353072 2873.56 5568
+81.364208 2873.56 5568
+81.375344 2873.56 5568
+81.386480 2873.56 5568
+81.397616 2873.56 5568
+81.408752 2873.56 5568
+81.419888 2873.56 5568
+81.431024 2873.56 5568
+81.442160 2873.56 5568
+81.453296 2873.56 5568
+81.464432 2873.56 5568
+81.475568 2873.56 5568
+81.486704 2873.56 5568
+81.497840 2873.56 5568
+81.508976 2873.56 5568
+81.520112 2873.56 5568
+81.531248 2873.56 5568
+81.542384 2873.56 5568
+81.553520 2873.56 5568
+81.564656 2873.56 5568
+81.575792 2873.56 5568
+81.586928 2873.56 5568
+81.598064 2873.56 5568
+81.609200 2873.56 5568
+81.620336 2873.56 5568
+81.631472 2873.56 5568
+81.642608 2873.56 5568
+81.653744 2873.56 5568
+81.664880 2873.56 5568
+81.676016 2873.56 5568
+81.687152 2873.56 5568
+81.698352 2857.14 5600
+81.709552 2857.14 5600
+81.720752 2857.14 5600
+81.731952 2857.14 5600
+81.743152 2857.14 5600
+81.754352 2857.14 5600
+81.765552 2857.14 5600
+81.776752 2857.14 5600
+81.787952 2857.14 5600
+81.799152 2857.14 5600
+81.810352 2857.14 5600
+81.821552 2857.14 5600
+81.832752 2857.14 5600
+81.843952 2857.14 5600
+81.855152 2857.14 5600
+81.866352 2857.14 5600
+81.877552 2857.14 5600
+81.888752 2857.14 5600
+81.899952 2857.14 5600
+81.911152 2857.14 5600
+81.922352 2857.14 5600
+81.933552 2857.14 5600
+81.944752 2857.14 5600
+81.955952 2857.14 5600
+81.967216 2840.91 5632
+81.978480 2840.91 5632
+81.989744 2840.91 5632
+82.001008 2840.91 5632
+82.012272 2840.91 5632
+82.023536 2840.91 5632
+82.034800 2840.91 5632
+82.046064 2840.91 5632
+82.057328 2840.91 5632
+82.068592 2840.91 5632
+82.079856 2840.91 5632
+82.091120 2840.91 5632
+82.102384 2840.91 5632
+82.113648 2840.91 5632
+82.124912 2840.91 5632
+82.136176 2840.91 5632
+82.147440 2840.91 5632
+82.158704 2840.91 5632
+82.169968 2840.91 5632
+82.181232 2840.91 5632
+82.192496 2840.91 5632
+82.203760 2840.91 5632
+82.215024 2840.91 5632
+82.226288 2840.91 5632
+82.237616 2824.86 5664
+82.248944 2824.86 5664
+82.260272 2824.86 5664
+82.271600 2824.86 5664
+82.282928 2824.86 5664
+82.294256 2824.86 5664
+82.305584 2824.86 5664
+82.316912 2824.86 5664
+82.328240 2824.86 5664
+82.339568 2824.86 5664
+82.350896 2824.86 5664
+82.362224 2824.86 5664
+82.373552 2824.86 5664
+82.384880 2824.86 5664
+82.396208 2824.86 5664
+82.407536 2824.86 5664
+82.418928 2808.99 5696
+82.430320 2808.99 5696
+82.441712 2808.99 5696
+82.453104 2808.99 5696
+82.464496 2808.99 5696
+82.475888 2808.99 5696
+82.487280 2808.99 5696
+82.498672 2808.99 5696
+82.510064 2808.99 5696
+82.521456 2808.99 5696
+82.532848 2808.99 5696
+82.544240 2808.99 5696
+82.555632 2808.99 5696
+82.567024 2808.99 5696
+82.578416 2808.99 5696
+82.589808 2808.99 5696
+82.601200 2808.99 5696
+82.612592 2808.99 5696
+82.623984 2808.99 5696
+82.635376 2808.99 5696
+82.646768 2808.99 5696
+82.658160 2808.99 5696
+82.669552 2808.99 5696
+82.680944 2808.99 5696
+82.692400 2793.30 5728
+82.703856 2793.30 5728
+82.715312 2793.30 5728
+82.726768 2793.30 5728
+82.738224 2793.30 5728
+82.749680 2793.30 5728
+82.761136 2793.30 5728
+82.772592 2793.30 5728
+82.784048 2793.30 5728
+82.795504 2793.30 5728
+82.806960 2793.30 5728
+82.818416 2793.30 5728
+82.829872 2793.30 5728
+82.841328 2793.30 5728
+82.852784 2793.30 5728
+82.864240 2793.30 5728
+82.875696 2793.30 5728
+82.887152 2793.30 5728
+82.898608 2793.30 5728
+82.910064 2793.30 5728
+82.921520 2793.30 5728
+82.932976 2793.30 5728
+82.944432 2793.30 5728
+82.955888 2793.30 5728
+82.967408 2777.78 5760
+82.978928 2777.78 5760
+82.990448 2777.78 5760
+83.001968 2777.78 5760
+83.013488 2777.78 5760
+83.025008 2777.78 5760
+83.036528 2777.78 5760
+83.048048 2777.78 5760
+83.059568 2777.78 5760
+83.071088 2777.78 5760
+83.082608 2777.78 5760
+83.094128 2777.78 5760
+83.105648 2777.78 5760
+83.117168 2777.78 5760
+83.128688 2777.78 5760
+83.140208 2777.78 5760
+83.151792 2762.43 5792
+83.163376 2762.43 5792
+83.174960 2762.43 5792
+83.186544 2762.43 5792
+83.198128 2762.43 5792
+83.209712 2762.43 5792
+83.221296 2762.43 5792
+83.232880 2762.43 5792
+83.244464 2762.43 5792
+83.256048 2762.43 5792
+83.267632 2762.43 5792
+83.279216 2762.43 5792
+83.290800 2762.43 5792
+83.302384 2762.43 5792
+83.313968 2762.43 5792
+83.325552 2762.43 5792
+83.337136 2762.43 5792
+83.348720 2762.43 5792
+83.360304 2762.43 5792
+83.371888 2762.43 5792
+83.383472 2762.43 5792
+83.395056 2762.43 5792
+83.406640 2762.43 5792
+83.418224 2762.43 5792
+83.429872 2747.25 5824
+83.441520 2747.25 5824
+83.453168 2747.25 5824
+83.464816 2747.25 5824
+83.476464 2747.25 5824
+83.488112 2747.25 5824
+83.499760 2747.25 5824
+83.511408 2747.25 5824
+83.523056 2747.25 5824
+83.534704 2747.25 5824
+83.546352 2747.25 5824
+83.558000 2747.25 5824
+83.569648 2747.25 5824
+83.581296 2747.25 5824
+83.592944 2747.25 5824
+83.604592 2747.25 5824
+83.616304 2732.24 5856
+83.628016 2732.24 5856
+83.639728 2732.24 5856
+83.651440 2732.24 5856
+83.663152 2732.24 5856
+83.674864 2732.24 5856
+83.686576 2732.24 5856
+83.698288 2732.24 5856
+83.710000 2732.24 5856
+83.721712 2732.24 5856
+83.733424 2732.24 5856
+83.745136 2732.24 5856
+83.756848 2732.24 5856
+83.768560 2732.24 5856
+83.780272 2732.24 5856
+83.791984 2732.24 5856
+83.803696 2732.24 5856
+83.815408 2732.24 5856
+83.827120 2732.24 5856
+83.838832 2732.24 5856
+83.850544 2732.24 5856
+83.862256 2732.24 5856
+83.873968 2732.24 5856
+83.885680 2732.24 5856
+83.897456 2717.39 5888
+83.909232 2717.39 5888
+83.921008 2717.39 5888
+83.932784 2717.39 5888
+83.944560 2717.39 5888
+83.956336 2717.39 5888
+83.968112 2717.39 5888
+83.979888 2717.39 5888
+83.991664 2717.39 5888
+84.003440 2717.39 5888
+84.015216 2717.39 5888
+84.026992 2717.39 5888
+84.038768 2717.39 5888
+84.050544 2717.39 5888
+84.062320 2717.39 5888
+84.074096 2717.39 5888
+84.085936 2702.70 5920
+84.097776 2702.70 5920
+84.109616 2702.70 5920
+84.121456 2702.70 5920
+84.133296 2702.70 5920
+84.145136 2702.70 5920
+84.156976 2702.70 5920
+84.168816 2702.70 5920
+84.180656 2702.70 5920
+84.192496 2702.70 5920
+84.204336 2702.70 5920
+84.216176 2702.70 5920
+84.228016 2702.70 5920
+84.239856 2702.70 5920
+84.251696 2702.70 5920
+84.263536 2702.70 5920
+84.275376 2702.70 5920
+84.287216 2702.70 5920
+84.299056 2702.70 5920
+84.310896 2702.70 5920
+84.322736 2702.70 5920
+84.334576 2702.70 5920
+84.346416 2702.70 5920
+84.358256 2702.70 5920
+84.370160 2688.17 5952
+84.382064 2688.17 5952
+84.393968 2688.17 5952
+84.405872 2688.17 5952
+84.417776 2688.17 5952
+84.429680 2688.17 5952
+84.441584 2688.17 5952
+84.453488 2688.17 5952
+84.465392 2688.17 5952
+84.477296 2688.17 5952
+84.489200 2688.17 5952
+84.501104 2688.17 5952
+84.513008 2688.17 5952
+84.524912 2688.17 5952
+84.536816 2688.17 5952
+84.548720 2688.17 5952
+84.560688 2673.80 5984
+84.572656 2673.80 5984
+84.584624 2673.80 5984
+84.596592 2673.80 5984
+84.608560 2673.80 5984
+84.620528 2673.80 5984
+84.632496 2673.80 5984
+84.644464 2673.80 5984
+84.656432 2673.80 5984
+84.668400 2673.80 5984
+84.680368 2673.80 5984
+84.692336 2673.80 5984
+84.704304 2673.80 5984
+84.716272 2673.80 5984
+84.728240 2673.80 5984
+84.740208 2673.80 5984
+84.752176 2673.80 5984
+84.764144 2673.80 5984
+84.776112 2673.80 5984
+84.788080 2673.80 5984
+84.800048 2673.80 5984
+84.812016 2673.80 5984
+84.823984 2673.80 5984
+84.835952 2673.80 5984
+84.847984 2659.57 6016
+84.860016 2659.57 6016
+84.872048 2659.57 6016
+84.884080 2659.57 6016
+84.896112 2659.57 6016
+84.908144 2659.57 6016
+84.920176 2659.57 6016
+84.932208 2659.57 6016
+84.944240 2659.57 6016
+84.956272 2659.57 6016
+84.968304 2659.57 6016
+84.980336 2659.57 6016
+84.992368 2659.57 6016
+85.004400 2659.57 6016
+85.016432 2659.57 6016
+85.028464 2659.57 6016
+85.040560 2645.50 6048
+85.052656 2645.50 6048
+85.064752 2645.50 6048
+85.076848 2645.50 6048
+85.088944 2645.50 6048
+85.101040 2645.50 6048
+85.113136 2645.50 6048
+85.125232 2645.50 6048
+85.137328 2645.50 6048
+85.149424 2645.50 6048
+85.161520 2645.50 6048
+85.173616 2645.50 6048
+85.185712 2645.50 6048
+85.197808 2645.50 6048
+85.209904 2645.50 6048
+85.222000 2645.50 6048
+85.234160 2631.58 6080
+85.246320 2631.58 6080
+85.258480 2631.58 6080
+85.270640 2631.58 6080
+85.282800 2631.58 6080
+85.294960 2631.58 6080
+85.307120 2631.58 6080
+85.319280 2631.58 6080
+85.331440 2631.58 6080
+85.343600 2631.58 6080
+85.355760 2631.58 6080
+85.367920 2631.58 6080
+85.380080 2631.58 6080
+85.392240 2631.58 6080
+85.404400 2631.58 6080
+85.416560 2631.58 6080
+85.428720 2631.58 6080
+85.440880 2631.58 6080
+85.453040 2631.58 6080
+85.465200 2631.58 6080
+85.477360 2631.58 6080
+85.489520 2631.58 6080
+85.501680 2631.58 6080
+85.513840 2631.58 6080
+85.526064 2617.80 6112
+85.538288 2617.80 6112
+85.550512 2617.80 6112
+85.562736 2617.80 6112
+85.574960 2617.80 6112
+85.587184 2617.80 6112
+85.599408 2617.80 6112
+85.611632 2617.80 6112
+85.623856 2617.80 6112
+85.636080 2617.80 6112
+85.648304 2617.80 6112
+85.660528 2617.80 6112
+85.672752 2617.80 6112
+85.684976 2617.80 6112
+85.697200 2617.80 6112
+85.709424 2617.80 6112
+85.721712 2604.17 6144
+85.734000 2604.17 6144
+85.746288 2604.17 6144
+85.758576 2604.17 6144
+85.770864 2604.17 6144
+85.783152 2604.17 6144
+85.795440 2604.17 6144
+85.807728 2604.17 6144
+85.820016 2604.17 6144
+85.832304 2604.17 6144
+85.844592 2604.17 6144
+85.856880 2604.17 6144
+85.869168 2604.17 6144
+85.881456 2604.17 6144
+85.893744 2604.17 6144
+85.906032 2604.17 6144
+85.918384 2590.67 6176
+85.930736 2590.67 6176
+85.943088 2590.67 6176
+85.955440 2590.67 6176
+85.967792 2590.67 6176
+85.980144 2590.67 6176
+85.992496 2590.67 6176
+86.004848 2590.67 6176
+86.017200 2590.67 6176
+86.029552 2590.67 6176
+86.041904 2590.67 6176
+86.054256 2590.67 6176
+86.066608 2590.67 6176
+86.078960 2590.67 6176
+86.091312 2590.67 6176
+86.103664 2590.67 6176
+86.116016 2590.67 6176
+86.128368 2590.67 6176
+86.140720 2590.67 6176
+86.153072 2590.67 6176
+86.165424 2590.67 6176
+86.177776 2590.67 6176
+86.190128 2590.67 6176
+86.202480 2590.67 6176
+86.214896 2577.32 6208
+86.227312 2577.32 6208
+86.239728 2577.32 6208
+86.252144 2577.32 6208
+86.264560 2577.32 6208
+86.276976 2577.32 6208
+86.289392 2577.32 6208
+86.301808 2577.32 6208
+86.314224 2577.32 6208
+86.326640 2577.32 6208
+86.339056 2577.32 6208
+86.351472 2577.32 6208
+86.363888 2577.32 6208
+86.376304 2577.32 6208
+86.388720 2577.32 6208
+86.401136 2577.32 6208
+86.413680 2551.02 6272
+86.426224 2551.02 6272
+86.438768 2551.02 6272
+86.451312 2551.02 6272
+86.463856 2551.02 6272
+86.476400 2551.02 6272
+86.488944 2551.02 6272
+86.501488 2551.02 6272
+86.514032 2551.02 6272
+86.526576 2551.02 6272
+86.539120 2551.02 6272
+86.551664 2551.02 6272
+86.564208 2551.02 6272
+86.576752 2551.02 6272
+86.589296 2551.02 6272
+86.601840 2551.02 6272
+86.614448 2538.07 6304
+86.627056 2538.07 6304
+86.639664 2538.07 6304
+86.652272 2538.07 6304
+86.664880 2538.07 6304
+86.677488 2538.07 6304
+86.690096 2538.07 6304
+86.702704 2538.07 6304
+86.715312 2538.07 6304
+86.727920 2538.07 6304
+86.740528 2538.07 6304
+86.753136 2538.07 6304
+86.765744 2538.07 6304
+86.778352 2538.07 6304
+86.790960 2538.07 6304
+86.803568 2538.07 6304
+86.816240 2525.25 6336
+86.828912 2525.25 6336
+86.841584 2525.25 6336
+86.854256 2525.25 6336
+86.866928 2525.25 6336
+86.879600 2525.25 6336
+86.892272 2525.25 6336
+86.904944 2525.25 6336
+86.917616 2525.25 6336
+86.930288 2525.25 6336
+86.942960 2525.25 6336
+86.955632 2525.25 6336
+86.968304 2525.25 6336
+86.980976 2525.25 6336
+86.993648 2525.25 6336
+87.006320 2525.25 6336
+87.019056 2512.56 6368
+87.031792 2512.56 6368
+87.044528 2512.56 6368
+87.057264 2512.56 6368
+87.070000 2512.56 6368
+87.082736 2512.56 6368
+87.095472 2512.56 6368
+87.108208 2512.56 6368
+87.120944 2512.56 6368
+87.133680 2512.56 6368
+87.146416 2512.56 6368
+87.159152 2512.56 6368
+87.171888 2512.56 6368
+87.184624 2512.56 6368
+87.197360 2512.56 6368
+87.210096 2512.56 6368
+87.222896 2500.00 6400
+87.235696 2500.00 6400
+87.248496 2500.00 6400
+87.261296 2500.00 6400
+87.274096 2500.00 6400
+87.286896 2500.00 6400
+87.299696 2500.00 6400
+87.312496 2500.00 6400
+87.325296 2500.00 6400
+87.338096 2500.00 6400
+87.350896 2500.00 6400
+87.363696 2500.00 6400
+87.376496 2500.00 6400
+87.389296 2500.00 6400
+87.402096 2500.00 6400
+87.414896 2500.00 6400
+87.427696 2500.00 6400
+87.440496 2500.00 6400
+87.453296 2500.00 6400
+87.466096 2500.00 6400
+87.478896 2500.00 6400
+87.491696 2500.00 6400
+87.504496 2500.00 6400
+87.517296 2500.00 6400
+87.530160 2487.56 6432
+87.543024 2487.56 6432
+87.555888 2487.56 6432
+87.568752 2487.56 6432
+87.581616 2487.56 6432
+87.594480 2487.56 6432
+87.607344 2487.56 6432
+87.620208 2487.56 6432
+87.633072 2487.56 6432
+87.645936 2487.56 6432
+87.658800 2487.56 6432
+87.671664 2487.56 6432
+87.684528 2487.56 6432
+87.697392 2487.56 6432
+87.710256 2487.56 6432
+87.723120 2487.56 6432
+87.736048 2475.25 6464
+87.748976 2475.25 6464
+87.761904 2475.25 6464
+87.774832 2475.25 6464
+87.787760 2475.25 6464
+87.800688 2475.25 6464
+87.813616 2475.25 6464
+87.826544 2475.25 6464
+87.839472 2475.25 6464
+87.852400 2475.25 6464
+87.865328 2475.25 6464
+87.878256 2475.25 6464
+87.891184 2475.25 6464
+87.904112 2475.25 6464
+87.917040 2475.25 6464
+87.929968 2475.25 6464
+87.942960 2463.05 6496
+87.955952 2463.05 6496
+87.968944 2463.05 6496
+87.981936 2463.05 6496
+87.994928 2463.05 6496
+88.007920 2463.05 6496
+88.020912 2463.05 6496
+88.033904 2463.05 6496
+88.046896 2463.05 6496
+88.059888 2463.05 6496
+88.072880 2463.05 6496
+88.085872 2463.05 6496
+88.098864 2463.05 6496
+88.111856 2463.05 6496
+88.124848 2463.05 6496
+88.137840 2463.05 6496
+88.150896 2450.98 6528
+88.163952 2450.98 6528
+88.177008 2450.98 6528
+88.190064 2450.98 6528
+88.203120 2450.98 6528
+88.216176 2450.98 6528
+88.229232 2450.98 6528
+88.242288 2450.98 6528
+88.255344 2450.98 6528
+88.268400 2450.98 6528
+88.281456 2450.98 6528
+88.294512 2450.98 6528
+88.307568 2450.98 6528
+88.320624 2450.98 6528
+88.333680 2450.98 6528
+88.346736 2450.98 6528
+88.359856 2439.02 6560
+88.372976 2439.02 6560
+88.386096 2439.02 6560
+88.399216 2439.02 6560
+88.412336 2439.02 6560
+88.425456 2439.02 6560
+88.438576 2439.02 6560
+88.451696 2439.02 6560
+88.464816 2439.02 6560
+88.477936 2439.02 6560
+88.491056 2439.02 6560
+88.504176 2439.02 6560
+88.517296 2439.02 6560
+88.530416 2439.02 6560
+88.543536 2439.02 6560
+88.556656 2439.02 6560
+88.569840 2427.18 6592
+88.583024 2427.18 6592
+88.596208 2427.18 6592
+88.609392 2427.18 6592
+88.622576 2427.18 6592
+88.635760 2427.18 6592
+88.648944 2427.18 6592
+88.662128 2427.18 6592
+88.675312 2427.18 6592
+88.688496 2427.18 6592
+88.701680 2427.18 6592
+88.714864 2427.18 6592
+88.728048 2427.18 6592
+88.741232 2427.18 6592
+88.754416 2427.18 6592
+88.767600 2427.18 6592
+88.780912 2403.85 6656
+88.794224 2403.85 6656
+88.807536 2403.85 6656
+88.820848 2403.85 6656
+88.834160 2403.85 6656
+88.847472 2403.85 6656
+88.860784 2403.85 6656
+88.874096 2403.85 6656
+88.887408 2403.85 6656
+88.900720 2403.85 6656
+88.914032 2403.85 6656
+88.927344 2403.85 6656
+88.940656 2403.85 6656
+88.953968 2403.85 6656
+88.967280 2403.85 6656
+88.980592 2403.85 6656
+88.993968 2392.34 6688
+89.007344 2392.34 6688
+89.020720 2392.34 6688
+89.034096 2392.34 6688
+89.047472 2392.34 6688
+89.060848 2392.34 6688
+89.074224 2392.34 6688
+89.087600 2392.34 6688
+89.100976 2392.34 6688
+89.114352 2392.34 6688
+89.127728 2392.34 6688
+89.141104 2392.34 6688
+89.154480 2392.34 6688
+89.167856 2392.34 6688
+89.181232 2392.34 6688
+89.194608 2392.34 6688
+89.208048 2380.95 6720
+89.221488 2380.95 6720
+89.234928 2380.95 6720
+89.248368 2380.95 6720
+89.261808 2380.95 6720
+89.275248 2380.95 6720
+89.288688 2380.95 6720
+89.302128 2380.95 6720
+89.315568 2380.95 6720
+89.329008 2380.95 6720
+89.342448 2380.95 6720
+89.355888 2380.95 6720
+89.369328 2380.95 6720
+89.382768 2380.95 6720
+89.396208 2380.95 6720
+89.409648 2380.95 6720
+89.423152 2369.67 6752
+89.436656 2369.67 6752
+89.450160 2369.67 6752
+89.463664 2369.67 6752
+89.477168 2369.67 6752
+89.490672 2369.67 6752
+89.504176 2369.67 6752
+89.517680 2369.67 6752
+89.531248 2358.49 6784
+89.544816 2358.49 6784
+89.558384 2358.49 6784
+89.571952 2358.49 6784
+89.585520 2358.49 6784
+89.599088 2358.49 6784
+89.612656 2358.49 6784
+89.626224 2358.49 6784
+89.639792 2358.49 6784
+89.653360 2358.49 6784
+89.666928 2358.49 6784
+89.680496 2358.49 6784
+89.694064 2358.49 6784
+89.707632 2358.49 6784
+89.721200 2358.49 6784
+89.734768 2358.49 6784
+89.748400 2347.42 6816
+89.762032 2347.42 6816
+89.775664 2347.42 6816
+89.789296 2347.42 6816
+89.802928 2347.42 6816
+89.816560 2347.42 6816
+89.830192 2347.42 6816
+89.843824 2347.42 6816
+89.857456 2347.42 6816
+89.871088 2347.42 6816
+89.884720 2347.42 6816
+89.898352 2347.42 6816
+89.911984 2347.42 6816
+89.925616 2347.42 6816
+89.939248 2347.42 6816
+89.952880 2347.42 6816
+89.966576 2336.45 6848
+89.980272 2336.45 6848
+89.993968 2336.45 6848
+90.007664 2336.45 6848
+90.021360 2336.45 6848
+90.035056 2336.45 6848
+90.048752 2336.45 6848
+90.062448 2336.45 6848
+90.076144 2336.45 6848
+90.089840 2336.45 6848
+90.103536 2336.45 6848
+90.117232 2336.45 6848
+90.130928 2336.45 6848
+90.144624 2336.45 6848
+90.158320 2336.45 6848
+90.172016 2336.45 6848
+90.185840 2314.81 6912
+90.199664 2314.81 6912
+90.213488 2314.81 6912
+90.227312 2314.81 6912
+90.241136 2314.81 6912
+90.254960 2314.81 6912
+90.268784 2314.81 6912
+90.282608 2314.81 6912
+90.296432 2314.81 6912
+90.310256 2314.81 6912
+90.324080 2314.81 6912
+90.337904 2314.81 6912
+90.351728 2314.81 6912
+90.365552 2314.81 6912
+90.379376 2314.81 6912
+90.393200 2314.81 6912
+90.407088 2304.15 6944
+90.420976 2304.15 6944
+90.434864 2304.15 6944
+90.448752 2304.15 6944
+90.462640 2304.15 6944
+90.476528 2304.15 6944
+90.490416 2304.15 6944
+90.504304 2304.15 6944
+90.518192 2304.15 6944
+90.532080 2304.15 6944
+90.545968 2304.15 6944
+90.559856 2304.15 6944
+90.573744 2304.15 6944
+90.587632 2304.15 6944
+90.601520 2304.15 6944
+90.615408 2304.15 6944
+90.629360 2293.58 6976
+90.643312 2293.58 6976
+90.657264 2293.58 6976
+90.671216 2293.58 6976
+90.685168 2293.58 6976
+90.699120 2293.58 6976
+90.713072 2293.58 6976
+90.727024 2293.58 6976
+90.741040 2283.11 7008
+90.755056 2283.11 7008
+90.769072 2283.11 7008
+90.783088 2283.11 7008
+90.797104 2283.11 7008
+90.811120 2283.11 7008
+90.825136 2283.11 7008
+90.839152 2283.11 7008
+90.853168 2283.11 7008
+90.867184 2283.11 7008
+90.881200 2283.11 7008
+90.895216 2283.11 7008
+90.909232 2283.11 7008
+90.923248 2283.11 7008
+90.937264 2283.11 7008
+90.951280 2283.11 7008
+90.965360 2272.73 7040
+90.979440 2272.73 7040
+90.993520 2272.73 7040
+91.007600 2272.73 7040
+91.021680 2272.73 7040
+91.035760 2272.73 7040
+91.049840 2272.73 7040
+91.063920 2272.73 7040
+91.078000 2272.73 7040
+91.092080 2272.73 7040
+91.106160 2272.73 7040
+91.120240 2272.73 7040
+91.134320 2272.73 7040
+91.148400 2272.73 7040
+91.162480 2272.73 7040
+91.176560 2272.73 7040
+91.190704 2262.44 7072
+91.204848 2262.44 7072
+91.218992 2262.44 7072
+91.233136 2262.44 7072
+91.247280 2262.44 7072
+91.261424 2262.44 7072
+91.275568 2262.44 7072
+91.289712 2262.44 7072
+91.303856 2262.44 7072
+91.318000 2262.44 7072
+91.332144 2262.44 7072
+91.346288 2262.44 7072
+91.360432 2262.44 7072
+91.374576 2262.44 7072
+91.388720 2262.44 7072
+91.402864 2262.44 7072
+91.417136 2242.15 7136
+91.431408 2242.15 7136
+91.445680 2242.15 7136
+91.459952 2242.15 7136
+91.474224 2242.15 7136
+91.488496 2242.15 7136
+91.502768 2242.15 7136
+91.517040 2242.15 7136
+91.531376 2232.14 7168
+91.545712 2232.14 7168
+91.560048 2232.14 7168
+91.574384 2232.14 7168
+91.588720 2232.14 7168
+91.603056 2232.14 7168
+91.617392 2232.14 7168
+91.631728 2232.14 7168
+91.646064 2232.14 7168
+91.660400 2232.14 7168
+91.674736 2232.14 7168
+91.689072 2232.14 7168
+91.703408 2232.14 7168
+91.717744 2232.14 7168
+91.732080 2232.14 7168
+91.746416 2232.14 7168
+91.760816 2222.22 7200
+91.775216 2222.22 7200
+91.789616 2222.22 7200
+91.804016 2222.22 7200
+91.818416 2222.22 7200
+91.832816 2222.22 7200
+91.847216 2222.22 7200
+91.861616 2222.22 7200
+91.876016 2222.22 7200
+91.890416 2222.22 7200
+91.904816 2222.22 7200
+91.919216 2222.22 7200
+91.933616 2222.22 7200
+91.948016 2222.22 7200
+91.962416 2222.22 7200
+91.976816 2222.22 7200
+91.991280 2212.39 7232
+92.005744 2212.39 7232
+92.020208 2212.39 7232
+92.034672 2212.39 7232
+92.049136 2212.39 7232
+92.063600 2212.39 7232
+92.078064 2212.39 7232
+92.092528 2212.39 7232
+92.107120 2192.98 7296
+92.121712 2192.98 7296
+92.136304 2192.98 7296
+92.150896 2192.98 7296
+92.165488 2192.98 7296
+92.180080 2192.98 7296
+92.194672 2192.98 7296
+92.209264 2192.98 7296
+92.223856 2192.98 7296
+92.238448 2192.98 7296
+92.253040 2192.98 7296
+92.267632 2192.98 7296
+92.282224 2192.98 7296
+92.296816 2192.98 7296
+92.311408 2192.98 7296
+92.326000 2192.98 7296
+92.340656 2183.41 7328
+92.355312 2183.41 7328
+92.369968 2183.41 7328
+92.384624 2183.41 7328
+92.399280 2183.41 7328
+92.413936 2183.41 7328
+92.428592 2183.41 7328
+92.443248 2183.41 7328
+92.457904 2183.41 7328
+92.472560 2183.41 7328
+92.487216 2183.41 7328
+92.501872 2183.41 7328
+92.516528 2183.41 7328
+92.531184 2183.41 7328
+92.545840 2183.41 7328
+92.560496 2183.41 7328
+92.575216 2173.91 7360
+92.589936 2173.91 7360
+92.604656 2173.91 7360
+92.619376 2173.91 7360
+92.634096 2173.91 7360
+92.648816 2173.91 7360
+92.663536 2173.91 7360
+92.678256 2173.91 7360
+92.693040 2164.50 7392
+92.707824 2164.50 7392
+92.722608 2164.50 7392
+92.737392 2164.50 7392
+92.752176 2164.50 7392
+92.766960 2164.50 7392
+92.781744 2164.50 7392
+92.796528 2164.50 7392
+92.811312 2164.50 7392
+92.826096 2164.50 7392
+92.840880 2164.50 7392
+92.855664 2164.50 7392
+92.870448 2164.50 7392
+92.885232 2164.50 7392
+92.900016 2164.50 7392
+92.914800 2164.50 7392
+92.929712 2145.92 7456
+92.944624 2145.92 7456
+92.959536 2145.92 7456
+92.974448 2145.92 7456
+92.989360 2145.92 7456
+93.004272 2145.92 7456
+93.019184 2145.92 7456
+93.034096 2145.92 7456
+93.049072 2136.75 7488
+93.064048 2136.75 7488
+93.079024 2136.75 7488
+93.094000 2136.75 7488
+93.108976 2136.75 7488
+93.123952 2136.75 7488
+93.138928 2136.75 7488
+93.153904 2136.75 7488
+93.168880 2136.75 7488
+93.183856 2136.75 7488
+93.198832 2136.75 7488
+93.213808 2136.75 7488
+93.228784 2136.75 7488
+93.243760 2136.75 7488
+93.258736 2136.75 7488
+93.273712 2136.75 7488
+93.288752 2127.66 7520
+93.303792 2127.66 7520
+93.318832 2127.66 7520
+93.333872 2127.66 7520
+93.348912 2127.66 7520
+93.363952 2127.66 7520
+93.378992 2127.66 7520
+93.394032 2127.66 7520
+93.409136 2118.64 7552
+93.424240 2118.64 7552
+93.439344 2118.64 7552
+93.454448 2118.64 7552
+93.469552 2118.64 7552
+93.484656 2118.64 7552
+93.499760 2118.64 7552
+93.514864 2118.64 7552
+93.529968 2118.64 7552
+93.545072 2118.64 7552
+93.560176 2118.64 7552
+93.575280 2118.64 7552
+93.590384 2118.64 7552
+93.605488 2118.64 7552
+93.620592 2118.64 7552
+93.635696 2118.64 7552
+93.650928 2100.84 7616
+93.666160 2100.84 7616
+93.681392 2100.84 7616
+93.696624 2100.84 7616
+93.711856 2100.84 7616
+93.727088 2100.84 7616
+93.742320 2100.84 7616
+93.757552 2100.84 7616
+93.772848 2092.05 7648
+93.788144 2092.05 7648
+93.803440 2092.05 7648
+93.818736 2092.05 7648
+93.834032 2092.05 7648
+93.849328 2092.05 7648
+93.864624 2092.05 7648
+93.879920 2092.05 7648
+93.895216 2092.05 7648
+93.910512 2092.05 7648
+93.925808 2092.05 7648
+93.941104 2092.05 7648
+93.956400 2092.05 7648
+93.971696 2092.05 7648
+93.986992 2092.05 7648
+94.002288 2092.05 7648
+94.017648 2083.33 7680
+94.033008 2083.33 7680
+94.048368 2083.33 7680
+94.063728 2083.33 7680
+94.079088 2083.33 7680
+94.094448 2083.33 7680
+94.109808 2083.33 7680
+94.125168 2083.33 7680
+94.140656 2066.12 7744
+94.156144 2066.12 7744
+94.171632 2066.12 7744
+94.187120 2066.12 7744
+94.202608 2066.12 7744
+94.218096 2066.12 7744
+94.233584 2066.12 7744
+94.249072 2066.12 7744
+94.264560 2066.12 7744
+94.280048 2066.12 7744
+94.295536 2066.12 7744
+94.311024 2066.12 7744
+94.326512 2066.12 7744
+94.342000 2066.12 7744
+94.357488 2066.12 7744
+94.372976 2066.12 7744
+94.388528 2057.61 7776
+94.404080 2057.61 7776
+94.419632 2057.61 7776
+94.435184 2057.61 7776
+94.450736 2057.61 7776
+94.466288 2057.61 7776
+94.481840 2057.61 7776
+94.497392 2057.61 7776
+94.513008 2049.18 7808
+94.528624 2049.18 7808
+94.544240 2049.18 7808
+94.559856 2049.18 7808
+94.575472 2049.18 7808
+94.591088 2049.18 7808
+94.606704 2049.18 7808
+94.622320 2049.18 7808
+94.637936 2049.18 7808
+94.653552 2049.18 7808
+94.669168 2049.18 7808
+94.684784 2049.18 7808
+94.700400 2049.18 7808
+94.716016 2049.18 7808
+94.731632 2049.18 7808
+94.747248 2049.18 7808
+94.762992 2032.52 7872
+94.778736 2032.52 7872
+94.794480 2032.52 7872
+94.810224 2032.52 7872
+94.825968 2032.52 7872
+94.841712 2032.52 7872
+94.857456 2032.52 7872
+94.873200 2032.52 7872
+94.889008 2024.29 7904
+94.904816 2024.29 7904
+94.920624 2024.29 7904
+94.936432 2024.29 7904
+94.952240 2024.29 7904
+94.968048 2024.29 7904
+94.983856 2024.29 7904
+94.999664 2024.29 7904
+95.015472 2024.29 7904
+95.031280 2024.29 7904
+95.047088 2024.29 7904
+95.062896 2024.29 7904
+95.078768 2016.13 7936
+95.094640 2016.13 7936
+95.110512 2016.13 7936
+95.126384 2016.13 7936
+95.142256 2016.13 7936
+95.158128 2016.13 7936
+95.174000 2016.13 7936
+95.189872 2016.13 7936
+95.205744 2016.13 7936
+95.221616 2016.13 7936
+95.237488 2016.13 7936
+95.253360 2016.13 7936
+95.269360 2000.00 8000
+95.285360 2000.00 8000
+95.301360 2000.00 8000
+95.317360 2000.00 8000
+95.333360 2000.00 8000
+95.349360 2000.00 8000
+95.365360 2000.00 8000
+95.381360 2000.00 8000
+95.397360 2000.00 8000
+95.413360 2000.00 8000
+95.429360 2000.00 8000
+95.445360 2000.00 8000
+95.461424 1992.03 8032
+95.469456 1992.03 8032
+95.477488 1992.03 8032
+95.485520 1992.03 8032
+95.493552 1992.03 8032
+95.501584 1992.03 8032
+95.509616 1992.03 8032
+95.517648 1992.03 8032
+95.525680 1992.03 8032
+95.533712 1992.03 8032
+95.541744 1992.03 8032
+95.549776 1992.03 8032
+95.557808 1992.03 8032
+95.565840 1992.03 8032
+95.573872 1992.03 8032
+95.581904 1992.03 8032
+95.589968 1984.13 8064
+95.598032 1984.13 8064
+95.606096 1984.13 8064
+95.614160 1984.13 8064
+95.622224 1984.13 8064
+95.630288 1984.13 8064
+95.638352 1984.13 8064
+95.646416 1984.13 8064
+95.654480 1984.13 8064
+95.662544 1984.13 8064
+95.670608 1984.13 8064
+95.678672 1984.13 8064
+95.686736 1984.13 8064
+95.694800 1984.13 8064
+95.702864 1984.13 8064
+95.710928 1984.13 8064
+95.718992 1984.13 8064
+95.727056 1984.13 8064
+95.735120 1984.13 8064
+95.743184 1984.13 8064
+95.751248 1984.13 8064
+95.759312 1984.13 8064
+95.767376 1984.13 8064
+95.775440 1984.13 8064
+95.783568 1968.50 8128
+95.791696 1968.50 8128
+95.799824 1968.50 8128
+95.807952 1968.50 8128
+95.816080 1968.50 8128
+95.824208 1968.50 8128
+95.832336 1968.50 8128
+95.840464 1968.50 8128
+95.848592 1968.50 8128
+95.856720 1968.50 8128
+95.864848 1968.50 8128
+95.872976 1968.50 8128
+95.881104 1968.50 8128
+95.889232 1968.50 8128
+95.897360 1968.50 8128
+95.905488 1968.50 8128
+95.913616 1968.50 8128
+95.921744 1968.50 8128
+95.929872 1968.50 8128
+95.938000 1968.50 8128
+95.946128 1968.50 8128
+95.954256 1968.50 8128
+95.962384 1968.50 8128
+95.970512 1968.50 8128
+95.978672 1960.78 8160
+95.986832 1960.78 8160
+95.994992 1960.78 8160
+96.003152 1960.78 8160
+96.011312 1960.78 8160
+96.019472 1960.78 8160
+96.027632 1960.78 8160
+96.035792 1960.78 8160
+96.043952 1960.78 8160
+96.052112 1960.78 8160
+96.060272 1960.78 8160
+96.068432 1960.78 8160
+96.076592 1960.78 8160
+96.084752 1960.78 8160
+96.092912 1960.78 8160
+96.101072 1960.78 8160
+96.109264 1953.12 8192
+96.117456 1953.12 8192
+96.125648 1953.12 8192
+96.133840 1953.12 8192
+96.142032 1953.12 8192
+96.150224 1953.12 8192
+96.158416 1953.12 8192
+96.166608 1953.12 8192
+96.174800 1953.12 8192
+96.182992 1953.12 8192
+96.191184 1953.12 8192
+96.199376 1953.12 8192
+96.207568 1953.12 8192
+96.215760 1953.12 8192
+96.223952 1953.12 8192
+96.232144 1953.12 8192
+96.240336 1953.12 8192
+96.248528 1953.12 8192
+96.256720 1953.12 8192
+96.264912 1953.12 8192
+96.273104 1953.12 8192
+96.281296 1953.12 8192
+96.289488 1953.12 8192
+96.297680 1953.12 8192
+96.305936 1937.98 8256
+96.314192 1937.98 8256
+96.322448 1937.98 8256
+96.330704 1937.98 8256
+96.338960 1937.98 8256
+96.347216 1937.98 8256
+96.355472 1937.98 8256
+96.363728 1937.98 8256
+96.371984 1937.98 8256
+96.380240 1937.98 8256
+96.388496 1937.98 8256
+96.396752 1937.98 8256
+96.405008 1937.98 8256
+96.413264 1937.98 8256
+96.421520 1937.98 8256
+96.429776 1937.98 8256
+96.438032 1937.98 8256
+96.446288 1937.98 8256
+96.454544 1937.98 8256
+96.462800 1937.98 8256
+96.471056 1937.98 8256
+96.479312 1937.98 8256
+96.487568 1937.98 8256
+96.495824 1937.98 8256
+96.504080 1937.98 8256
+96.512336 1937.98 8256
+96.520592 1937.98 8256
+96.528848 1937.98 8256
+96.537104 1937.98 8256
+96.545360 1937.98 8256
+96.553616 1937.98 8256
+96.561872 1937.98 8256
+96.570128 1937.98 8256
+96.578384 1937.98 8256
+96.586640 1937.98 8256
+96.594896 1937.98 8256
+96.603152 1937.98 8256
+96.611408 1937.98 8256
+96.619664 1937.98 8256
+96.627920 1937.98 8256
+96.636240 1923.08 8320
+96.644560 1923.08 8320
+96.652880 1923.08 8320
+96.661200 1923.08 8320
+96.669520 1923.08 8320
+96.677840 1923.08 8320
+96.686160 1923.08 8320
+96.694480 1923.08 8320
+96.702800 1923.08 8320
+96.711120 1923.08 8320
+96.719440 1923.08 8320
+96.727760 1923.08 8320
+96.736080 1923.08 8320
+96.744400 1923.08 8320
+96.752720 1923.08 8320
+96.761040 1923.08 8320
+96.769424 1908.40 8384
+96.777808 1908.40 8384
+96.786192 1908.40 8384
+96.794576 1908.40 8384
+96.802960 1908.40 8384
+96.811344 1908.40 8384
+96.819728 1908.40 8384
+96.828112 1908.40 8384
+96.836496 1908.40 8384
+96.844880 1908.40 8384
+96.853264 1908.40 8384
+96.861648 1908.40 8384
+96.870032 1908.40 8384
+96.878416 1908.40 8384
+96.886800 1908.40 8384
+96.895184 1908.40 8384
+96.903568 1908.40 8384
+96.911952 1908.40 8384
+96.920336 1908.40 8384
+96.928720 1908.40 8384
+96.937104 1908.40 8384
+96.945488 1908.40 8384
+96.953872 1908.40 8384
+96.962256 1908.40 8384
+96.970704 1893.94 8448
+96.979152 1893.94 8448
+96.987600 1893.94 8448
+96.996048 1893.94 8448
+97.004496 1893.94 8448
+97.012944 1893.94 8448
+97.021392 1893.94 8448
+97.029840 1893.94 8448
+97.038288 1893.94 8448
+97.046736 1893.94 8448
+97.055184 1893.94 8448
+97.063632 1893.94 8448
+97.072080 1893.94 8448
+97.080528 1893.94 8448
+97.088976 1893.94 8448
+97.097424 1893.94 8448
+97.105872 1893.94 8448
+97.114320 1893.94 8448
+97.122768 1893.94 8448
+97.131216 1893.94 8448
+97.139664 1893.94 8448
+97.148112 1893.94 8448
+97.156560 1893.94 8448
+97.165008 1893.94 8448
+97.173456 1893.94 8448
+97.181904 1893.94 8448
+97.190352 1893.94 8448
+97.198800 1893.94 8448
+97.207248 1893.94 8448
+97.215696 1893.94 8448
+97.224144 1893.94 8448
+97.232592 1893.94 8448
+97.241040 1893.94 8448
+97.249488 1893.94 8448
+97.257936 1893.94 8448
+97.266384 1893.94 8448
+97.274832 1893.94 8448
+97.283280 1893.94 8448
+97.291728 1893.94 8448
+97.300176 1893.94 8448
+97.308688 1879.70 8512
+97.317200 1879.70 8512
+97.325712 1879.70 8512
+97.334224 1879.70 8512
+97.342736 1879.70 8512
+97.351248 1879.70 8512
+97.359760 1879.70 8512
+97.368272 1879.70 8512
+97.376784 1879.70 8512
+97.385296 1879.70 8512
+97.393808 1879.70 8512
+97.402320 1879.70 8512
+97.410832 1879.70 8512
+97.419344 1879.70 8512
+97.427856 1879.70 8512
+97.436368 1879.70 8512
+97.444944 1865.67 8576
+97.453520 1865.67 8576
+97.462096 1865.67 8576
+97.470672 1865.67 8576
+97.479248 1865.67 8576
+97.487824 1865.67 8576
+97.496400 1865.67 8576
+97.504976 1865.67 8576
+97.513552 1865.67 8576
+97.522128 1865.67 8576
+97.530704 1865.67 8576
+97.539280 1865.67 8576
+97.547856 1865.67 8576
+97.556432 1865.67 8576
+97.565008 1865.67 8576
+97.573584 1865.67 8576
+97.582224 1851.85 8640
+97.590864 1851.85 8640
+97.599504 1851.85 8640
+97.608144 1851.85 8640
+97.616784 1851.85 8640
+97.625424 1851.85 8640
+97.634064 1851.85 8640
+97.642704 1851.85 8640
+97.651344 1851.85 8640
+97.659984 1851.85 8640
+97.668624 1851.85 8640
+97.677264 1851.85 8640
+97.685904 1851.85 8640
+97.694544 1851.85 8640
+97.703184 1851.85 8640
+97.711824 1851.85 8640
+97.720464 1851.85 8640
+97.729104 1851.85 8640
+97.737744 1851.85 8640
+97.746384 1851.85 8640
+97.755024 1851.85 8640
+97.763664 1851.85 8640
+97.772304 1851.85 8640
+97.780944 1851.85 8640
+97.789584 1851.85 8640
+97.798224 1851.85 8640
+97.806864 1851.85 8640
+97.815504 1851.85 8640
+97.824144 1851.85 8640
+97.832784 1851.85 8640
+97.841424 1851.85 8640
+97.850064 1851.85 8640
+97.858704 1851.85 8640
+97.867344 1851.85 8640
+97.875984 1851.85 8640
+97.884624 1851.85 8640
+97.893264 1851.85 8640
+97.901904 1851.85 8640
+97.910544 1851.85 8640
+97.919184 1851.85 8640
+97.927888 1838.24 8704
+97.936592 1838.24 8704
+97.945296 1838.24 8704
+97.954000 1838.24 8704
+97.962704 1838.24 8704
+97.971408 1838.24 8704
+97.980112 1838.24 8704
+97.988816 1838.24 8704
+97.997520 1838.24 8704
+98.006224 1838.24 8704
+98.014928 1838.24 8704
+98.023632 1838.24 8704
+98.032336 1838.24 8704
+98.041040 1838.24 8704
+98.049744 1838.24 8704
+98.058448 1838.24 8704
+98.067216 1824.82 8768
+98.075984 1824.82 8768
+98.084752 1824.82 8768
+98.093520 1824.82 8768
+98.102288 1824.82 8768
+98.111056 1824.82 8768
+98.119824 1824.82 8768
+98.128592 1824.82 8768
+98.137360 1824.82 8768
+98.146128 1824.82 8768
+98.154896 1824.82 8768
+98.163664 1824.82 8768
+98.172432 1824.82 8768
+98.181200 1824.82 8768
+98.189968 1824.82 8768
+98.198736 1824.82 8768
+98.207504 1824.82 8768
+98.216272 1824.82 8768
+98.225040 1824.82 8768
+98.233808 1824.82 8768
+98.242576 1824.82 8768
+98.251344 1824.82 8768
+98.260112 1824.82 8768
+98.268880 1824.82 8768
+98.277648 1824.82 8768
+98.286416 1824.82 8768
+98.295184 1824.82 8768
+98.303952 1824.82 8768
+98.312720 1824.82 8768
+98.321488 1824.82 8768
+98.330256 1824.82 8768
+98.339024 1824.82 8768
+98.347792 1824.82 8768
+98.356560 1824.82 8768
+98.365328 1824.82 8768
+98.374096 1824.82 8768
+98.382864 1824.82 8768
+98.391632 1824.82 8768
+98.400400 1824.82 8768
+98.409168 1824.82 8768
+98.418000 1811.59 8832
+98.426832 1811.59 8832
+98.435664 1811.59 8832
+98.444496 1811.59 8832
+98.453328 1811.59 8832
+98.462160 1811.59 8832
+98.470992 1811.59 8832
+98.479824 1811.59 8832
+98.488656 1811.59 8832
+98.497488 1811.59 8832
+98.506320 1811.59 8832
+98.515152 1811.59 8832
+98.523984 1811.59 8832
+98.532816 1811.59 8832
+98.541648 1811.59 8832
+98.550480 1811.59 8832
+98.559376 1798.56 8896
+98.568272 1798.56 8896
+98.577168 1798.56 8896
+98.586064 1798.56 8896
+98.594960 1798.56 8896
+98.603856 1798.56 8896
+98.612752 1798.56 8896
+98.621648 1798.56 8896
+98.630544 1798.56 8896
+98.639440 1798.56 8896
+98.648336 1798.56 8896
+98.657232 1798.56 8896
+98.666128 1798.56 8896
+98.675024 1798.56 8896
+98.683920 1798.56 8896
+98.692816 1798.56 8896
+98.701776 1785.71 8960
+98.710736 1785.71 8960
+98.719696 1785.71 8960
+98.728656 1785.71 8960
+98.737616 1785.71 8960
+98.746576 1785.71 8960
+98.755536 1785.71 8960
+98.764496 1785.71 8960
+98.773456 1785.71 8960
+98.782416 1785.71 8960
+98.791376 1785.71 8960
+98.800336 1785.71 8960
+98.809296 1785.71 8960
+98.818256 1785.71 8960
+98.827216 1785.71 8960
+98.836176 1785.71 8960
+98.845136 1785.71 8960
+98.854096 1785.71 8960
+98.863056 1785.71 8960
+98.872016 1785.71 8960
+98.880976 1785.71 8960
+98.889936 1785.71 8960
+98.898896 1785.71 8960
+98.907856 1785.71 8960
+98.916816 1785.71 8960
+98.925776 1785.71 8960
+98.934736 1785.71 8960
+98.943696 1785.71 8960
+98.952656 1785.71 8960
+98.961616 1785.71 8960
+98.970576 1785.71 8960
+98.979536 1785.71 8960
+98.988560 1773.05 9024
+98.997584 1773.05 9024
+99.006608 1773.05 9024
+99.015632 1773.05 9024
+99.024656 1773.05 9024
+99.033680 1773.05 9024
+99.042704 1773.05 9024
+99.051728 1773.05 9024
+99.060752 1773.05 9024
+99.069776 1773.05 9024
+99.078800 1773.05 9024
+99.087824 1773.05 9024
+99.096848 1773.05 9024
+99.105872 1773.05 9024
+99.114896 1773.05 9024
+99.123920 1773.05 9024
+99.132944 1773.05 9024
+99.141968 1773.05 9024
+99.150992 1773.05 9024
+99.160016 1773.05 9024
+99.169040 1773.05 9024
+99.178064 1773.05 9024
+99.187088 1773.05 9024
+99.196112 1773.05 9024
+99.205200 1760.56 9088
+99.214288 1760.56 9088
+99.223376 1760.56 9088
+99.232464 1760.56 9088
+99.241552 1760.56 9088
+99.250640 1760.56 9088
+99.259728 1760.56 9088
+99.268816 1760.56 9088
+99.277904 1760.56 9088
+99.286992 1760.56 9088
+99.296080 1760.56 9088
+99.305168 1760.56 9088
+99.314256 1760.56 9088
+99.323344 1760.56 9088
+99.332432 1760.56 9088
+99.341520 1760.56 9088
+99.350672 1748.25 9152
+99.359824 1748.25 9152
+99.368976 1748.25 9152
+99.378128 1748.25 9152
+99.387280 1748.25 9152
+99.396432 1748.25 9152
+99.405584 1748.25 9152
+99.414736 1748.25 9152
+99.423888 1748.25 9152
+99.433040 1748.25 9152
+99.442192 1748.25 9152
+99.451344 1748.25 9152
+99.460496 1748.25 9152
+99.469648 1748.25 9152
+99.478800 1748.25 9152
+99.487952 1748.25 9152
+99.497168 1736.11 9216
+99.506384 1736.11 9216
+99.515600 1736.11 9216
+99.524816 1736.11 9216
+99.534032 1736.11 9216
+99.543248 1736.11 9216
+99.552464 1736.11 9216
+99.561680 1736.11 9216
+99.570896 1736.11 9216
+99.580112 1736.11 9216
+99.589328 1736.11 9216
+99.598544 1736.11 9216
+99.607760 1736.11 9216
+99.616976 1736.11 9216
+99.626192 1736.11 9216
+99.635408 1736.11 9216
+99.644624 1736.11 9216
+99.653840 1736.11 9216
+99.663056 1736.11 9216
+99.672272 1736.11 9216
+99.681488 1736.11 9216
+99.690704 1736.11 9216
+99.699920 1736.11 9216
+99.709136 1736.11 9216
+99.718352 1736.11 9216
+99.727568 1736.11 9216
+99.736784 1736.11 9216
+99.746000 1736.11 9216
+99.755216 1736.11 9216
+99.764432 1736.11 9216
+99.773648 1736.11 9216
+99.782864 1736.11 9216
+99.792144 1724.14 9280
+99.801424 1724.14 9280
+99.810704 1724.14 9280
+99.819984 1724.14 9280
+99.829264 1724.14 9280
+99.838544 1724.14 9280
+99.847824 1724.14 9280
+99.857104 1724.14 9280
+99.866384 1724.14 9280
+99.875664 1724.14 9280
+99.884944 1724.14 9280
+99.894224 1724.14 9280
+99.903504 1724.14 9280
+99.912784 1724.14 9280
+99.922064 1724.14 9280
+99.931344 1724.14 9280
+99.940688 1712.33 9344
+99.950032 1712.33 9344
+99.959376 1712.33 9344
+99.968720 1712.33 9344
+99.978064 1712.33 9344
+99.987408 1712.33 9344
+99.996752 1712.33 9344
+100.006096 1712.33 9344
+100.015440 1712.33 9344
+100.024784 1712.33 9344
+100.034128 1712.33 9344
+100.043472 1712.33 9344
+100.052816 1712.33 9344
+100.062160 1712.33 9344
+100.071504 1712.33 9344
+100.080848 1712.33 9344
+100.090256 1700.68 9408
+100.099664 1700.68 9408
+100.109072 1700.68 9408
+100.118480 1700.68 9408
+100.127888 1700.68 9408
+100.137296 1700.68 9408
+100.146704 1700.68 9408
+100.156112 1700.68 9408
+100.165520 1700.68 9408
+100.174928 1700.68 9408
+100.184336 1700.68 9408
+100.193744 1700.68 9408
+100.203152 1700.68 9408
+100.212560 1700.68 9408
+100.221968 1700.68 9408
+100.231376 1700.68 9408
+100.240784 1700.68 9408
+100.250192 1700.68 9408
+100.259600 1700.68 9408
+100.269008 1700.68 9408
+100.278416 1700.68 9408
+100.287824 1700.68 9408
+100.297232 1700.68 9408
+100.306640 1700.68 9408
+100.316048 1700.68 9408
+100.325456 1700.68 9408
+100.334864 1700.68 9408
+100.344272 1700.68 9408
+100.353680 1700.68 9408
+100.363088 1700.68 9408
+100.372496 1700.68 9408
+100.381904 1700.68 9408
+100.391376 1689.19 9472
+100.400848 1689.19 9472
+100.410320 1689.19 9472
+100.419792 1689.19 9472
+100.429264 1689.19 9472
+100.438736 1689.19 9472
+100.448208 1689.19 9472
+100.457680 1689.19 9472
+100.467152 1689.19 9472
+100.476624 1689.19 9472
+100.486096 1689.19 9472
+100.495568 1689.19 9472
+100.505040 1689.19 9472
+100.514512 1689.19 9472
+100.523984 1689.19 9472
+100.533456 1689.19 9472
+100.542992 1677.85 9536
+100.552528 1677.85 9536
+100.562064 1677.85 9536
+100.571600 1677.85 9536
+100.581136 1677.85 9536
+100.590672 1677.85 9536
+100.600208 1677.85 9536
+100.609744 1677.85 9536
+100.619344 1666.67 9600
+100.628944 1666.67 9600
+100.638544 1666.67 9600
+100.648144 1666.67 9600
+100.657744 1666.67 9600
+100.667344 1666.67 9600
+100.676944 1666.67 9600
+100.686544 1666.67 9600
+100.696144 1666.67 9600
+100.705744 1666.67 9600
+100.715344 1666.67 9600
+100.724944 1666.67 9600
+100.734544 1666.67 9600
+100.744144 1666.67 9600
+100.753744 1666.67 9600
+100.763344 1666.67 9600
+100.773008 1655.63 9664
+100.782672 1655.63 9664
+100.792336 1655.63 9664
+100.802000 1655.63 9664
+100.811664 1655.63 9664
+100.821328 1655.63 9664
+100.830992 1655.63 9664
+100.840656 1655.63 9664
+100.850320 1655.63 9664
+100.859984 1655.63 9664
+100.869648 1655.63 9664
+100.879312 1655.63 9664
+100.888976 1655.63 9664
+100.898640 1655.63 9664
+100.908304 1655.63 9664
+100.917968 1655.63 9664
+100.927696 1644.74 9728
+100.937424 1644.74 9728
+100.947152 1644.74 9728
+100.956880 1644.74 9728
+100.966608 1644.74 9728
+100.976336 1644.74 9728
+100.986064 1644.74 9728
+100.995792 1644.74 9728
+101.005520 1644.74 9728
+101.015248 1644.74 9728
+101.024976 1644.74 9728
+101.034704 1644.74 9728
+101.044432 1644.74 9728
+101.054160 1644.74 9728
+101.063888 1644.74 9728
+101.073616 1644.74 9728
+101.083344 1644.74 9728
+101.093072 1644.74 9728
+101.102800 1644.74 9728
+101.112528 1644.74 9728
+101.122256 1644.74 9728
+101.131984 1644.74 9728
+101.141712 1644.74 9728
+101.151440 1644.74 9728
+101.161168 1644.74 9728
+101.170896 1644.74 9728
+101.180624 1644.74 9728
+101.190352 1644.74 9728
+101.200080 1644.74 9728
+101.209808 1644.74 9728
+101.219536 1644.74 9728
+101.229264 1644.74 9728
+101.239056 1633.99 9792
+101.248848 1633.99 9792
+101.258640 1633.99 9792
+101.268432 1633.99 9792
+101.278224 1633.99 9792
+101.288016 1633.99 9792
+101.297808 1633.99 9792
+101.307600 1633.99 9792
+101.317392 1633.99 9792
+101.327184 1633.99 9792
+101.336976 1633.99 9792
+101.346768 1633.99 9792
+101.356560 1633.99 9792
+101.366352 1633.99 9792
+101.376144 1633.99 9792
+101.385936 1633.99 9792
+101.395792 1623.38 9856
+101.405648 1623.38 9856
+101.415504 1623.38 9856
+101.425360 1623.38 9856
+101.435216 1623.38 9856
+101.445072 1623.38 9856
+101.454928 1623.38 9856
+101.464784 1623.38 9856
+101.474704 1612.90 9920
+101.484624 1612.90 9920
+101.494544 1612.90 9920
+101.504464 1612.90 9920
+101.514384 1612.90 9920
+101.524304 1612.90 9920
+101.534224 1612.90 9920
+101.544144 1612.90 9920
+101.554064 1612.90 9920
+101.563984 1612.90 9920
+101.573904 1612.90 9920
+101.583824 1612.90 9920
+101.593744 1612.90 9920
+101.603664 1612.90 9920
+101.613584 1612.90 9920
+101.623504 1612.90 9920
+101.633488 1602.56 9984
+101.643472 1602.56 9984
+101.653456 1602.56 9984
+101.663440 1602.56 9984
+101.673424 1602.56 9984
+101.683408 1602.56 9984
+101.693392 1602.56 9984
+101.703376 1602.56 9984
+101.713360 1602.56 9984
+101.723344 1602.56 9984
+101.733328 1602.56 9984
+101.743312 1602.56 9984
+101.753296 1602.56 9984
+101.763280 1602.56 9984
+101.773264 1602.56 9984
+101.783248 1602.56 9984
+101.793296 1592.36 10048
+101.803344 1592.36 10048
+101.813392 1592.36 10048
+101.823440 1592.36 10048
+101.833488 1592.36 10048
+101.843536 1592.36 10048
+101.853584 1592.36 10048
+101.863632 1592.36 10048
+101.873680 1592.36 10048
+101.883728 1592.36 10048
+101.893776 1592.36 10048
+101.903824 1592.36 10048
+101.913872 1592.36 10048
+101.923920 1592.36 10048
+101.933968 1592.36 10048
+101.944016 1592.36 10048
+101.954064 1592.36 10048
+101.964112 1592.36 10048
+101.974160 1592.36 10048
+101.984208 1592.36 10048
+101.994256 1592.36 10048
+102.004304 1592.36 10048
+102.014352 1592.36 10048
+102.024400 1592.36 10048
+102.034512 1582.28 10112
+102.044624 1582.28 10112
+102.054736 1582.28 10112
+102.064848 1582.28 10112
+102.074960 1582.28 10112
+102.085072 1582.28 10112
+102.095184 1582.28 10112
+102.105296 1582.28 10112
+102.115408 1582.28 10112
+102.125520 1582.28 10112
+102.135632 1582.28 10112
+102.145744 1582.28 10112
+102.155856 1582.28 10112
+102.165968 1582.28 10112
+102.176080 1582.28 10112
+102.186192 1582.28 10112
+102.196368 1572.33 10176
+102.206544 1572.33 10176
+102.216720 1572.33 10176
+102.226896 1572.33 10176
+102.237072 1572.33 10176
+102.247248 1572.33 10176
+102.257424 1572.33 10176
+102.267600 1572.33 10176
+102.277776 1572.33 10176
+102.287952 1572.33 10176
+102.298128 1572.33 10176
+102.308304 1572.33 10176
+102.318480 1572.33 10176
+102.328656 1572.33 10176
+102.338832 1572.33 10176
+102.349008 1572.33 10176
+102.359248 1562.50 10240
+102.369488 1562.50 10240
+102.379728 1562.50 10240
+102.389968 1562.50 10240
+102.400208 1562.50 10240
+102.410448 1562.50 10240
+102.420688 1562.50 10240
+102.430928 1562.50 10240
+102.441232 1552.80 10304
+102.451536 1552.80 10304
+102.461840 1552.80 10304
+102.472144 1552.80 10304
+102.482448 1552.80 10304
+102.492752 1552.80 10304
+102.503056 1552.80 10304
+102.513360 1552.80 10304
+102.523664 1552.80 10304
+102.533968 1552.80 10304
+102.544272 1552.80 10304
+102.554576 1552.80 10304
+102.564880 1552.80 10304
+102.575184 1552.80 10304
+102.585488 1552.80 10304
+102.595792 1552.80 10304
+102.606160 1543.21 10368
+102.616528 1543.21 10368
+102.626896 1543.21 10368
+102.637264 1543.21 10368
+102.647632 1543.21 10368
+102.658000 1543.21 10368
+102.668368 1543.21 10368
+102.678736 1543.21 10368
+102.689104 1543.21 10368
+102.699472 1543.21 10368
+102.709840 1543.21 10368
+102.720208 1543.21 10368
+102.730576 1543.21 10368
+102.740944 1543.21 10368
+102.751312 1543.21 10368
+102.761680 1543.21 10368
+102.772112 1533.74 10432
+102.782544 1533.74 10432
+102.792976 1533.74 10432
+102.803408 1533.74 10432
+102.813840 1533.74 10432
+102.824272 1533.74 10432
+102.834704 1533.74 10432
+102.845136 1533.74 10432
+102.855568 1533.74 10432
+102.866000 1533.74 10432
+102.876432 1533.74 10432
+102.886864 1533.74 10432
+102.897296 1533.74 10432
+102.907728 1533.74 10432
+102.918160 1533.74 10432
+102.928592 1533.74 10432
+102.939024 1533.74 10432
+102.949456 1533.74 10432
+102.959888 1533.74 10432
+102.970320 1533.74 10432
+102.980752 1533.74 10432
+102.991184 1533.74 10432
+103.001616 1533.74 10432
+103.012048 1533.74 10432
+103.022544 1524.39 10496
+103.033040 1524.39 10496
+103.043536 1524.39 10496
+103.054032 1524.39 10496
+103.064528 1524.39 10496
+103.075024 1524.39 10496
+103.085520 1524.39 10496
+103.096016 1524.39 10496
+103.106576 1515.15 10560
+103.117136 1515.15 10560
+103.127696 1515.15 10560
+103.138256 1515.15 10560
+103.148816 1515.15 10560
+103.159376 1515.15 10560
+103.169936 1515.15 10560
+103.180496 1515.15 10560
+103.191056 1515.15 10560
+103.201616 1515.15 10560
+103.212176 1515.15 10560
+103.222736 1515.15 10560
+103.233296 1515.15 10560
+103.243856 1515.15 10560
+103.254416 1515.15 10560
+103.264976 1515.15 10560
+103.275600 1506.02 10624
+103.286224 1506.02 10624
+103.296848 1506.02 10624
+103.307472 1506.02 10624
+103.318096 1506.02 10624
+103.328720 1506.02 10624
+103.339344 1506.02 10624
+103.349968 1506.02 10624
+103.360656 1497.01 10688
+103.371344 1497.01 10688
+103.382032 1497.01 10688
+103.392720 1497.01 10688
+103.403408 1497.01 10688
+103.414096 1497.01 10688
+103.424784 1497.01 10688
+103.435472 1497.01 10688
+103.446160 1497.01 10688
+103.456848 1497.01 10688
+103.467536 1497.01 10688
+103.478224 1497.01 10688
+103.488912 1497.01 10688
+103.499600 1497.01 10688
+103.510288 1497.01 10688
+103.520976 1497.01 10688
+103.531728 1488.10 10752
+103.542480 1488.10 10752
+103.553232 1488.10 10752
+103.563984 1488.10 10752
+103.574736 1488.10 10752
+103.585488 1488.10 10752
+103.596240 1488.10 10752
+103.606992 1488.10 10752
+103.617808 1479.29 10816
+103.628624 1479.29 10816
+103.639440 1479.29 10816
+103.650256 1479.29 10816
+103.661072 1479.29 10816
+103.671888 1479.29 10816
+103.682704 1479.29 10816
+103.693520 1479.29 10816
+103.704336 1479.29 10816
+103.715152 1479.29 10816
+103.725968 1479.29 10816
+103.736784 1479.29 10816
+103.747600 1479.29 10816
+103.758416 1479.29 10816
+103.769232 1479.29 10816
+103.780048 1479.29 10816
+103.790928 1470.59 10880
+103.801808 1470.59 10880
+103.812688 1470.59 10880
+103.823568 1470.59 10880
+103.834448 1470.59 10880
+103.845328 1470.59 10880
+103.856208 1470.59 10880
+103.867088 1470.59 10880
+103.878032 1461.99 10944
+103.888976 1461.99 10944
+103.899920 1461.99 10944
+103.910864 1461.99 10944
+103.921808 1461.99 10944
+103.932752 1461.99 10944
+103.943696 1461.99 10944
+103.954640 1461.99 10944
+103.965584 1461.99 10944
+103.976528 1461.99 10944
+103.987472 1461.99 10944
+103.998416 1461.99 10944
+104.009360 1461.99 10944
+104.020304 1461.99 10944
+104.031248 1461.99 10944
+104.042192 1461.99 10944
+104.053200 1453.49 11008
+104.064208 1453.49 11008
+104.075216 1453.49 11008
+104.086224 1453.49 11008
+104.097232 1453.49 11008
+104.108240 1453.49 11008
+104.119248 1453.49 11008
+104.130256 1453.49 11008
+104.141328 1445.09 11072
+104.152400 1445.09 11072
+104.163472 1445.09 11072
+104.174544 1445.09 11072
+104.185616 1445.09 11072
+104.196688 1445.09 11072
+104.207760 1445.09 11072
+104.218832 1445.09 11072
+104.229904 1445.09 11072
+104.240976 1445.09 11072
+104.252048 1445.09 11072
+104.263120 1445.09 11072
+104.274192 1445.09 11072
+104.285264 1445.09 11072
+104.296336 1445.09 11072
+104.307408 1445.09 11072
+104.318544 1436.78 11136
+104.329680 1436.78 11136
+104.340816 1436.78 11136
+104.351952 1436.78 11136
+104.363088 1436.78 11136
+104.374224 1436.78 11136
+104.385360 1436.78 11136
+104.396496 1436.78 11136
+104.407632 1436.78 11136
+104.418768 1436.78 11136
+104.429904 1436.78 11136
+104.441040 1436.78 11136
+104.452176 1436.78 11136
+104.463312 1436.78 11136
+104.474448 1436.78 11136
+104.485584 1436.78 11136
+104.496720 1436.78 11136
+104.507856 1436.78 11136
+104.518992 1436.78 11136
+104.530128 1436.78 11136
+104.541328 1428.57 11200
+104.552528 1428.57 11200
+104.563728 1428.57 11200
+104.574928 1428.57 11200
+104.586128 1428.57 11200
+104.597328 1428.57 11200
+104.608528 1428.57 11200
+104.619728 1428.57 11200
+104.630928 1428.57 11200
+104.642128 1428.57 11200
+104.653328 1428.57 11200
+104.664528 1428.57 11200
+104.675792 1420.45 11264
+104.687056 1420.45 11264
+104.698320 1420.45 11264
+104.709584 1420.45 11264
+104.720848 1420.45 11264
+104.732112 1420.45 11264
+104.743376 1420.45 11264
+104.754640 1420.45 11264
+104.765904 1420.45 11264
+104.777168 1420.45 11264
+104.788432 1420.45 11264
+104.799696 1420.45 11264
+104.811024 1412.43 11328
+104.822352 1412.43 11328
+104.833680 1412.43 11328
+104.845008 1412.43 11328
+104.856336 1412.43 11328
+104.867664 1412.43 11328
+104.878992 1412.43 11328
+104.890320 1412.43 11328
+104.901712 1404.49 11392
+104.913104 1404.49 11392
+104.924496 1404.49 11392
+104.935888 1404.49 11392
+104.947280 1404.49 11392
+104.958672 1404.49 11392
+104.970064 1404.49 11392
+104.981456 1404.49 11392
+104.992848 1404.49 11392
+105.004240 1404.49 11392
+105.015632 1404.49 11392
+105.027024 1404.49 11392
+105.038480 1396.65 11456
+105.049936 1396.65 11456
+105.061392 1396.65 11456
+105.072848 1396.65 11456
+105.084304 1396.65 11456
+105.095760 1396.65 11456
+105.107216 1396.65 11456
+105.118672 1396.65 11456
+105.130128 1396.65 11456
+105.141584 1396.65 11456
+105.153040 1396.65 11456
+105.164496 1396.65 11456
+105.176016 1388.89 11520
+105.187536 1388.89 11520
+105.199056 1388.89 11520
+105.210576 1388.89 11520
+105.222096 1388.89 11520
+105.233616 1388.89 11520
+105.245136 1388.89 11520
+105.256656 1388.89 11520
+105.268240 1381.22 11584
+105.279824 1381.22 11584
+105.291408 1381.22 11584
+105.302992 1381.22 11584
+105.314576 1381.22 11584
+105.326160 1381.22 11584
+105.337744 1381.22 11584
+105.349328 1381.22 11584
+105.360912 1381.22 11584
+105.372496 1381.22 11584
+105.384080 1381.22 11584
+105.395664 1381.22 11584
+105.407312 1373.63 11648
+105.418960 1373.63 11648
+105.430608 1373.63 11648
+105.442256 1373.63 11648
+105.453904 1373.63 11648
+105.465552 1373.63 11648
+105.477200 1373.63 11648
+105.488848 1373.63 11648
+105.500560 1366.12 11712
+105.512272 1366.12 11712
+105.523984 1366.12 11712
+105.535696 1366.12 11712
+105.547408 1366.12 11712
+105.559120 1366.12 11712
+105.570832 1366.12 11712
+105.582544 1366.12 11712
+105.594256 1366.12 11712
+105.605968 1366.12 11712
+105.617680 1366.12 11712
+105.629392 1366.12 11712
+105.641168 1358.70 11776
+105.652944 1358.70 11776
+105.664720 1358.70 11776
+105.676496 1358.70 11776
+105.688272 1358.70 11776
+105.700048 1358.70 11776
+105.711824 1358.70 11776
+105.723600 1358.70 11776
+105.735440 1351.35 11840
+105.747280 1351.35 11840
+105.759120 1351.35 11840
+105.770960 1351.35 11840
+105.782800 1351.35 11840
+105.794640 1351.35 11840
+105.806480 1351.35 11840
+105.818320 1351.35 11840
+105.830160 1351.35 11840
+105.842000 1351.35 11840
+105.853840 1351.35 11840
+105.865680 1351.35 11840
+105.877584 1344.09 11904
+105.889488 1344.09 11904
+105.901392 1344.09 11904
+105.913296 1344.09 11904
+105.925200 1344.09 11904
+105.937104 1344.09 11904
+105.949008 1344.09 11904
+105.960912 1344.09 11904
+105.972880 1336.90 11968
+105.984848 1336.90 11968
+105.996816 1336.90 11968
+106.008784 1336.90 11968
+106.020752 1336.90 11968
+106.032720 1336.90 11968
+106.044688 1336.90 11968
+106.056656 1336.90 11968
+106.068624 1336.90 11968
+106.080592 1336.90 11968
+106.092560 1336.90 11968
+106.104528 1336.90 11968
+106.116560 1329.79 12032
+106.128592 1329.79 12032
+106.140624 1329.79 12032
+106.152656 1329.79 12032
+106.164688 1329.79 12032
+106.176720 1329.79 12032
+106.188752 1329.79 12032
+106.200784 1329.79 12032
+106.212880 1322.75 12096
+106.224976 1322.75 12096
+106.237072 1322.75 12096
+106.249168 1322.75 12096
+106.261264 1322.75 12096
+106.273360 1322.75 12096
+106.285456 1322.75 12096
+106.297552 1322.75 12096
+106.309712 1315.79 12160
+106.321872 1315.79 12160
+106.334032 1315.79 12160
+106.346192 1315.79 12160
+106.358352 1315.79 12160
+106.370512 1315.79 12160
+106.382672 1315.79 12160
+106.394832 1315.79 12160
+106.406992 1315.79 12160
+106.419152 1315.79 12160
+106.431312 1315.79 12160
+106.443472 1315.79 12160
+106.455696 1308.90 12224
+106.467920 1308.90 12224
+106.480144 1308.90 12224
+106.492368 1308.90 12224
+106.504592 1308.90 12224
+106.516816 1308.90 12224
+106.529040 1308.90 12224
+106.541264 1308.90 12224
+106.553552 1302.08 12288
+106.565840 1302.08 12288
+106.578128 1302.08 12288
+106.590416 1302.08 12288
+106.602704 1302.08 12288
+106.614992 1302.08 12288
+106.627280 1302.08 12288
+106.639568 1302.08 12288
+106.651920 1295.34 12352
+106.664272 1295.34 12352
+106.676624 1295.34 12352
+106.688976 1295.34 12352
+106.701328 1295.34 12352
+106.713680 1295.34 12352
+106.726032 1295.34 12352
+106.738384 1295.34 12352
+106.750736 1295.34 12352
+106.763088 1295.34 12352
+106.775440 1295.34 12352
+106.787792 1295.34 12352
+106.800208 1288.66 12416
+106.812624 1288.66 12416
+106.825040 1288.66 12416
+106.837456 1288.66 12416
+106.849872 1288.66 12416
+106.862288 1288.66 12416
+106.874704 1288.66 12416
+106.887120 1288.66 12416
+106.899664 1275.51 12544
+106.912208 1275.51 12544
+106.924752 1275.51 12544
+106.937296 1275.51 12544
+106.949840 1275.51 12544
+106.962384 1275.51 12544
+106.974928 1275.51 12544
+106.987472 1275.51 12544
+107.000080 1269.04 12608
+107.012688 1269.04 12608
+107.025296 1269.04 12608
+107.037904 1269.04 12608
+107.050512 1269.04 12608
+107.063120 1269.04 12608
+107.075728 1269.04 12608
+107.088336 1269.04 12608
+107.101008 1262.63 12672
+107.113680 1262.63 12672
+107.126352 1262.63 12672
+107.139024 1262.63 12672
+107.151696 1262.63 12672
+107.164368 1262.63 12672
+107.177040 1262.63 12672
+107.189712 1262.63 12672
+107.202448 1256.28 12736
+107.215184 1256.28 12736
+107.227920 1256.28 12736
+107.240656 1256.28 12736
+107.253392 1256.28 12736
+107.266128 1256.28 12736
+107.278864 1256.28 12736
+107.291600 1256.28 12736
+107.304400 1250.00 12800
+107.317200 1250.00 12800
+107.330000 1250.00 12800
+107.342800 1250.00 12800
+107.355600 1250.00 12800
+107.368400 1250.00 12800
+107.381200 1250.00 12800
+107.394000 1250.00 12800
+107.406800 1250.00 12800
+107.419600 1250.00 12800
+107.432400 1250.00 12800
+107.445200 1250.00 12800
+107.458064 1243.78 12864
+107.470928 1243.78 12864
+107.483792 1243.78 12864
+107.496656 1243.78 12864
+107.509520 1243.78 12864
+107.522384 1243.78 12864
+107.535248 1243.78 12864
+107.548112 1243.78 12864
+107.561040 1237.62 12928
+107.573968 1237.62 12928
+107.586896 1237.62 12928
+107.599824 1237.62 12928
+107.612752 1237.62 12928
+107.625680 1237.62 12928
+107.638608 1237.62 12928
+107.651536 1237.62 12928
+107.664528 1231.53 12992
+107.677520 1231.53 12992
+107.690512 1231.53 12992
+107.703504 1231.53 12992
+107.716496 1231.53 12992
+107.729488 1231.53 12992
+107.742480 1231.53 12992
+107.755472 1231.53 12992
+107.768528 1225.49 13056
+107.781584 1225.49 13056
+107.794640 1225.49 13056
+107.807696 1225.49 13056
+107.820752 1225.49 13056
+107.833808 1225.49 13056
+107.846864 1225.49 13056
+107.859920 1225.49 13056
+107.873040 1219.51 13120
+107.886160 1219.51 13120
+107.899280 1219.51 13120
+107.912400 1219.51 13120
+107.925520 1219.51 13120
+107.938640 1219.51 13120
+107.951760 1219.51 13120
+107.964880 1219.51 13120
+107.978064 1213.59 13184
+107.991248 1213.59 13184
+108.004432 1213.59 13184
+108.017616 1213.59 13184
+108.030800 1213.59 13184
+108.043984 1213.59 13184
+108.057168 1213.59 13184
+108.070352 1213.59 13184
+108.083664 1201.92 13312
+108.096976 1201.92 13312
+108.110288 1201.92 13312
+108.123600 1201.92 13312
+108.136912 1201.92 13312
+108.150224 1201.92 13312
+108.163536 1201.92 13312
+108.176848 1201.92 13312
+108.190224 1196.17 13376
+108.203600 1196.17 13376
+108.216976 1196.17 13376
+108.230352 1196.17 13376
+108.243728 1196.17 13376
+108.257104 1196.17 13376
+108.270480 1196.17 13376
+108.283856 1196.17 13376
+108.297296 1190.48 13440
+108.310736 1190.48 13440
+108.324176 1190.48 13440
+108.337616 1190.48 13440
+108.351056 1190.48 13440
+108.364496 1190.48 13440
+108.377936 1190.48 13440
+108.391376 1190.48 13440
+108.404880 1184.83 13504
+108.418384 1184.83 13504
+108.431888 1184.83 13504
+108.445392 1184.83 13504
+108.458960 1179.25 13568
+108.472528 1179.25 13568
+108.486096 1179.25 13568
+108.499664 1179.25 13568
+108.513232 1179.25 13568
+108.526800 1179.25 13568
+108.540368 1179.25 13568
+108.553936 1179.25 13568
+108.567568 1173.71 13632
+108.581200 1173.71 13632
+108.594832 1173.71 13632
+108.608464 1173.71 13632
+108.622096 1173.71 13632
+108.635728 1173.71 13632
+108.649360 1173.71 13632
+108.662992 1173.71 13632
+108.676688 1168.22 13696
+108.690384 1168.22 13696
+108.704080 1168.22 13696
+108.717776 1168.22 13696
+108.731472 1168.22 13696
+108.745168 1168.22 13696
+108.758864 1168.22 13696
+108.772560 1168.22 13696
+108.786384 1157.41 13824
+108.800208 1157.41 13824
+108.814032 1157.41 13824
+108.827856 1157.41 13824
+108.841680 1157.41 13824
+108.855504 1157.41 13824
+108.869328 1157.41 13824
+108.883152 1157.41 13824
+108.897040 1152.07 13888
+108.910928 1152.07 13888
+108.924816 1152.07 13888
+108.938704 1152.07 13888
+108.952592 1152.07 13888
+108.966480 1152.07 13888
+108.980368 1152.07 13888
+108.994256 1152.07 13888
+109.008208 1146.79 13952
+109.022160 1146.79 13952
+109.036112 1146.79 13952
+109.050064 1146.79 13952
+109.064080 1141.55 14016
+109.078096 1141.55 14016
+109.092112 1141.55 14016
+109.106128 1141.55 14016
+109.120144 1141.55 14016
+109.134160 1141.55 14016
+109.148176 1141.55 14016
+109.162192 1141.55 14016
+109.176272 1136.36 14080
+109.190352 1136.36 14080
+109.204432 1136.36 14080
+109.218512 1136.36 14080
+109.232592 1136.36 14080
+109.246672 1136.36 14080
+109.260752 1136.36 14080
+109.274832 1136.36 14080
+109.288976 1131.22 14144
+109.303120 1131.22 14144
+109.317264 1131.22 14144
+109.331408 1131.22 14144
+109.345552 1131.22 14144
+109.359696 1131.22 14144
+109.373840 1131.22 14144
+109.387984 1131.22 14144
+109.402256 1121.08 14272
+109.416528 1121.08 14272
+109.430800 1121.08 14272
+109.445072 1121.08 14272
+109.459408 1116.07 14336
+109.473744 1116.07 14336
+109.488080 1116.07 14336
+109.502416 1116.07 14336
+109.516752 1116.07 14336
+109.531088 1116.07 14336
+109.545424 1116.07 14336
+109.559760 1116.07 14336
+109.574160 1111.11 14400
+109.588560 1111.11 14400
+109.602960 1111.11 14400
+109.617360 1111.11 14400
+109.631760 1111.11 14400
+109.646160 1111.11 14400
+109.660560 1111.11 14400
+109.674960 1111.11 14400
+109.689424 1106.19 14464
+109.703888 1106.19 14464
+109.718352 1106.19 14464
+109.732816 1106.19 14464
+109.747408 1096.49 14592
+109.762000 1096.49 14592
+109.776592 1096.49 14592
+109.791184 1096.49 14592
+109.805776 1096.49 14592
+109.820368 1096.49 14592
+109.834960 1096.49 14592
+109.849552 1096.49 14592
+109.864208 1091.70 14656
+109.878864 1091.70 14656
+109.893520 1091.70 14656
+109.908176 1091.70 14656
+109.922832 1091.70 14656
+109.937488 1091.70 14656
+109.952144 1091.70 14656
+109.966800 1091.70 14656
+109.981520 1086.96 14720
+109.996240 1086.96 14720
+110.010960 1086.96 14720
+110.025680 1086.96 14720
+110.040464 1082.25 14784
+110.055248 1082.25 14784
+110.070032 1082.25 14784
+110.084816 1082.25 14784
+110.099600 1082.25 14784
+110.114384 1082.25 14784
+110.129168 1082.25 14784
+110.143952 1082.25 14784
+110.158864 1072.96 14912
+110.173776 1072.96 14912
+110.188688 1072.96 14912
+110.203600 1072.96 14912
+110.218576 1068.38 14976
+110.233552 1068.38 14976
+110.248528 1068.38 14976
+110.263504 1068.38 14976
+110.278480 1068.38 14976
+110.293456 1068.38 14976
+110.308432 1068.38 14976
+110.323408 1068.38 14976
+110.338448 1063.83 15040
+110.353488 1063.83 15040
+110.368528 1063.83 15040
+110.383568 1063.83 15040
+110.398672 1059.32 15104
+110.413776 1059.32 15104
+110.428880 1059.32 15104
+110.443984 1059.32 15104
+110.459088 1059.32 15104
+110.474192 1059.32 15104
+110.489296 1059.32 15104
+110.504400 1059.32 15104
+110.519632 1050.42 15232
+110.534864 1050.42 15232
+110.550096 1050.42 15232
+110.565328 1050.42 15232
+110.580624 1046.03 15296
+110.595920 1046.03 15296
+110.611216 1046.03 15296
+110.626512 1046.03 15296
+110.641808 1046.03 15296
+110.657104 1046.03 15296
+110.672400 1046.03 15296
+110.687696 1046.03 15296
+110.703056 1041.67 15360
+110.718416 1041.67 15360
+110.733776 1041.67 15360
+110.749136 1041.67 15360
+110.764624 1033.06 15488
+110.780112 1033.06 15488
+110.795600 1033.06 15488
+110.811088 1033.06 15488
+110.826576 1033.06 15488
+110.842064 1033.06 15488
+110.857552 1033.06 15488
+110.873040 1033.06 15488
+110.888592 1028.81 15552
+110.904144 1028.81 15552
+110.919696 1028.81 15552
+110.935248 1028.81 15552
+110.950864 1024.59 15616
+110.966480 1024.59 15616
+110.982096 1024.59 15616
+110.997712 1024.59 15616
+111.013328 1024.59 15616
+111.028944 1024.59 15616
+111.044560 1024.59 15616
+111.060176 1024.59 15616
+111.075920 1016.26 15744
+111.091664 1016.26 15744
+111.107408 1016.26 15744
+111.123152 1016.26 15744
+111.138960 1012.15 15808
+111.154768 1012.15 15808
+111.170576 1012.15 15808
+111.186384 1012.15 15808
+111.202192 1012.15 15808
+111.218000 1012.15 15808
+111.233872 1008.06 15872
+111.249744 1008.06 15872
+111.265616 1008.06 15872
+111.281488 1008.06 15872
+111.297360 1008.06 15872
+111.313232 1008.06 15872
+111.329232 1000.00 16000
+111.345232 1000.00 16000
+111.361232 1000.00 16000
+111.377232 1000.00 16000
+111.393232 1000.00 16000
+111.409232 1000.00 16000
+111.425296 996.02 16064
+111.441360 996.02 16064
+111.457424 996.02 16064
+111.473488 996.02 16064
+111.489616 992.06 16128
+111.505744 992.06 16128
+111.521872 992.06 16128
+111.538000 992.06 16128
+111.554128 992.06 16128
+111.570256 992.06 16128
+111.586512 984.25 16256
+111.602768 984.25 16256
+111.619024 984.25 16256
+111.635280 984.25 16256
+111.651536 984.25 16256
+111.667792 984.25 16256
+111.684112 980.39 16320
+111.700432 980.39 16320
+111.716752 980.39 16320
+111.733072 980.39 16320
+111.749456 976.56 16384
+111.765840 976.56 16384
+111.782224 976.56 16384
+111.798608 976.56 16384
+111.814992 976.56 16384
+111.831376 976.56 16384
+111.847888 968.99 16512
+111.864400 968.99 16512
+111.880912 968.99 16512
+111.897424 968.99 16512
+111.913936 968.99 16512
+111.930448 968.99 16512
+111.946960 968.99 16512
+111.963472 968.99 16512
+111.979984 968.99 16512
+111.996496 968.99 16512
+112.013136 961.54 16640
+112.029776 961.54 16640
+112.046416 961.54 16640
+112.063056 961.54 16640
+112.079824 954.20 16768
+112.096592 954.20 16768
+112.113360 954.20 16768
+112.130128 954.20 16768
+112.146896 954.20 16768
+112.163664 954.20 16768
+112.180560 946.97 16896
+112.197456 946.97 16896
+112.214352 946.97 16896
+112.231248 946.97 16896
+112.248144 946.97 16896
+112.265040 946.97 16896
+112.281936 946.97 16896
+112.298832 946.97 16896
+112.315728 946.97 16896
+112.332624 946.97 16896
+112.349648 939.85 17024
+112.366672 939.85 17024
+112.383696 939.85 17024
+112.400720 939.85 17024
+112.417872 932.84 17152
+112.435024 932.84 17152
+112.452176 932.84 17152
+112.469328 932.84 17152
+112.486608 925.93 17280
+112.503888 925.93 17280
+112.521168 925.93 17280
+112.538448 925.93 17280
+112.555728 925.93 17280
+112.573008 925.93 17280
+112.590288 925.93 17280
+112.607568 925.93 17280
+112.624848 925.93 17280
+112.642128 925.93 17280
+112.659536 919.12 17408
+112.676944 919.12 17408
+112.694352 919.12 17408
+112.711760 919.12 17408
+112.729296 912.41 17536
+112.746832 912.41 17536
+112.764368 912.41 17536
+112.781904 912.41 17536
+112.799440 912.41 17536
+112.816976 912.41 17536
+112.834512 912.41 17536
+112.852048 912.41 17536
+112.869584 912.41 17536
+112.887120 912.41 17536
+112.904784 905.80 17664
+112.922448 905.80 17664
+112.940112 905.80 17664
+112.957776 905.80 17664
+112.975568 899.28 17792
+112.993360 899.28 17792
+113.011152 899.28 17792
+113.028944 899.28 17792
+113.046864 892.86 17920
+113.064784 892.86 17920
+113.082704 892.86 17920
+113.100624 892.86 17920
+113.118544 892.86 17920
+113.136464 892.86 17920
+113.154384 892.86 17920
+113.172304 892.86 17920
+113.190352 886.52 18048
+113.208400 886.52 18048
+113.226448 886.52 18048
+113.244496 886.52 18048
+113.262544 886.52 18048
+113.280592 886.52 18048
+113.298768 880.28 18176
+113.316944 880.28 18176
+113.335120 880.28 18176
+113.353296 880.28 18176
+113.371600 874.13 18304
+113.389904 874.13 18304
+113.408208 874.13 18304
+113.426512 874.13 18304
+113.444944 868.06 18432
+113.463376 868.06 18432
+113.481808 868.06 18432
+113.500240 868.06 18432
+113.518672 868.06 18432
+113.537104 868.06 18432
+113.555536 868.06 18432
+113.573968 868.06 18432
+113.592528 862.07 18560
+113.611088 862.07 18560
+113.629648 862.07 18560
+113.648208 862.07 18560
+113.666896 856.16 18688
+113.685584 856.16 18688
+113.704272 856.16 18688
+113.722960 856.16 18688
+113.741776 850.34 18816
+113.760592 850.34 18816
+113.779408 850.34 18816
+113.798224 850.34 18816
+113.817040 850.34 18816
+113.835856 850.34 18816
+113.854672 850.34 18816
+113.873488 850.34 18816
+113.892432 844.59 18944
+113.911376 844.59 18944
+113.930320 844.59 18944
+113.949264 844.59 18944
+113.968336 838.93 19072
+113.987408 838.93 19072
+114.006608 833.33 19200
+114.025808 833.33 19200
+114.045008 833.33 19200
+114.064208 833.33 19200
+114.083536 827.81 19328
+114.102864 827.81 19328
+114.122192 827.81 19328
+114.141520 827.81 19328
+114.160976 822.37 19456
+114.180432 822.37 19456
+114.199888 822.37 19456
+114.219344 822.37 19456
+114.238800 822.37 19456
+114.258256 822.37 19456
+114.277712 822.37 19456
+114.297168 822.37 19456
+114.316752 816.99 19584
+114.336336 816.99 19584
+114.355920 816.99 19584
+114.375504 816.99 19584
+114.395216 811.69 19712
+114.414928 811.69 19712
+114.434768 806.45 19840
+114.454608 806.45 19840
+114.474448 806.45 19840
+114.494288 806.45 19840
+114.514256 801.28 19968
+114.534224 801.28 19968
+114.554192 801.28 19968
+114.574160 801.28 19968
+114.594256 796.18 20096
+114.614352 796.18 20096
+114.634448 796.18 20096
+114.654544 796.18 20096
+114.674640 796.18 20096
+114.694736 796.18 20096
+114.714960 791.14 20224
+114.735184 791.14 20224
+114.755408 791.14 20224
+114.775632 791.14 20224
+114.795984 786.16 20352
+114.816336 786.16 20352
+114.836688 786.16 20352
+114.857040 786.16 20352
+114.877520 781.25 20480
+114.898000 781.25 20480
+114.918608 776.40 20608
+114.939216 776.40 20608
+114.959824 776.40 20608
+114.980432 776.40 20608
+115.001168 771.60 20736
+115.021904 771.60 20736
+115.042640 771.60 20736
+115.063376 771.60 20736
+115.084240 766.87 20864
+115.105104 766.87 20864
+115.125968 766.87 20864
+115.146832 766.87 20864
+115.167696 766.87 20864
+115.188560 766.87 20864
+115.209552 762.20 20992
+115.230544 762.20 20992
+115.251664 757.58 21120
+115.272784 757.58 21120
+115.293904 757.58 21120
+115.315024 757.58 21120
+115.336272 753.01 21248
+115.357520 753.01 21248
+115.378896 748.50 21376
+115.400272 748.50 21376
+115.421648 748.50 21376
+115.443024 748.50 21376
+115.464528 744.05 21504
+115.486032 744.05 21504
+115.507664 739.64 21632
+115.529296 739.64 21632
+115.550928 739.64 21632
+115.572560 739.64 21632
+115.594320 735.29 21760
+115.616080 735.29 21760
+115.637968 730.99 21888
+115.659856 730.99 21888
+115.681744 730.99 21888
+115.703632 730.99 21888
+115.725648 726.74 22016
+115.747664 726.74 22016
+115.769808 722.54 22144
+115.791952 722.54 22144
+115.814096 722.54 22144
+115.836240 722.54 22144
+115.858512 718.39 22272
+115.880784 718.39 22272
+115.903056 718.39 22272
+115.925328 718.39 22272
+115.947600 718.39 22272
+115.970000 714.29 22400
+115.992400 714.29 22400
+116.014800 714.29 22400
+116.037328 710.23 22528
+116.059856 710.23 22528
+116.082384 710.23 22528
+116.105040 706.21 22656
+116.127696 706.21 22656
+116.150480 702.25 22784
+116.173264 702.25 22784
+116.196048 702.25 22784
+116.218960 698.32 22912
+116.241872 698.32 22912
+116.264784 698.32 22912
+116.287824 694.44 23040
+116.310864 694.44 23040
+116.334032 690.61 23168
+116.357200 690.61 23168
+116.380368 690.61 23168
+116.403664 686.81 23296
+116.426960 686.81 23296
+116.450384 683.06 23424
+116.473808 683.06 23424
+116.497232 683.06 23424
+116.520784 679.35 23552
+116.544336 679.35 23552
+116.568016 675.68 23680
+116.591696 675.68 23680
+116.615376 675.68 23680
+116.639184 672.04 23808
+116.662992 672.04 23808
+116.686928 668.45 23936
+116.710864 668.45 23936
+116.734800 668.45 23936
+116.758864 664.89 24064
+116.782928 664.89 24064
+116.807120 661.38 24192
+116.831312 661.38 24192
+116.855632 657.89 24320
+116.879952 657.89 24320
+116.904272 657.89 24320
+116.928720 654.45 24448
+116.953168 654.45 24448
+116.977744 651.04 24576
+117.002320 651.04 24576
+117.027024 647.67 24704
+117.051728 647.67 24704
+117.076432 647.67 24704
+117.101264 644.33 24832
+117.126096 644.33 24832
+117.151184 637.76 25088
+117.176272 637.76 25088
+117.201488 634.52 25216
+117.226704 634.52 25216
+117.252048 631.31 25344
+117.277392 631.31 25344
+117.302864 628.14 25472
+117.328336 628.14 25472
+117.353936 625.00 25600
+117.379536 625.00 25600
+117.405136 625.00 25600
+117.430864 621.89 25728
+117.456592 621.89 25728
+117.482448 618.81 25856
+117.508304 618.81 25856
+117.534288 615.76 25984
+117.560272 615.76 25984
+117.586384 612.75 26112
+117.612496 612.75 26112
+117.638736 609.76 26240
+117.664976 609.76 26240
+117.691344 606.80 26368
+117.717712 606.80 26368
+117.744336 600.96 26624
+117.770960 600.96 26624
+117.797712 598.09 26752
+117.824464 598.09 26752
+117.851344 595.24 26880
+117.878224 595.24 26880
+117.905232 592.42 27008
+117.932368 589.62 27136
+117.959504 589.62 27136
+117.986768 586.85 27264
+118.014032 586.85 27264
+118.041424 584.11 27392
+118.068816 584.11 27392
+118.096464 578.70 27648
+118.124112 578.70 27648
+118.151888 576.04 27776
+118.179664 576.04 27776
+118.207568 573.39 27904
+118.235600 570.78 28032
+118.263632 570.78 28032
+118.291792 568.18 28160
+118.319952 568.18 28160
+118.348240 565.61 28288
+118.376528 565.61 28288
+118.405072 560.54 28544
+118.433744 558.04 28672
+118.462416 558.04 28672
+118.491216 555.56 28800
+118.520016 555.56 28800
+118.548944 553.10 28928
+118.578128 548.25 29184
+118.607312 548.25 29184
+118.636624 545.85 29312
+118.665936 545.85 29312
+118.695376 543.48 29440
+118.724944 541.13 29568
+118.754512 541.13 29568
+118.784336 536.48 29824
+118.814288 534.19 29952
+118.844240 534.19 29952
+118.874320 531.91 30080
+118.904528 529.66 30208
+118.934736 529.66 30208
+118.965200 525.21 30464
+118.995792 523.01 30592
+119.026384 523.01 30592
+119.057104 520.83 30720
+119.088080 516.53 30976
+119.119056 516.53 30976
+119.150160 514.40 31104
+119.181392 512.30 31232
+119.212624 512.30 31232
+119.244112 508.13 31488
+119.275728 506.07 31616
+119.307472 504.03 31744
+119.339216 504.03 31744
+119.371216 500.00 32000
+119.403344 498.01 32128
+119.435600 496.03 32256
+119.467856 496.03 32256
+119.500368 492.13 32512
+119.533008 490.20 32640
+119.565776 488.28 32768
+119.598544 488.28 32768
+119.631568 484.50 33024
+119.664592 484.50 33024
+119.697872 480.77 33280
+119.731408 477.10 33536
+119.764944 477.10 33536
+119.798736 473.48 33792
+119.832528 473.48 33792
+119.866576 469.92 34048
+119.900880 466.42 34304
+119.935440 462.96 34560
+119.970000 462.96 34560
+120.004560 462.96 34560
+120.039376 459.56 34816
+120.074448 456.20 35072
+120.109520 456.20 35072
+120.144848 452.90 35328
+120.180432 449.64 35584
+120.216272 446.43 35840
+120.252112 446.43 35840
+120.288208 443.26 36096
+120.324304 443.26 36096
+120.360656 440.14 36352
+120.397264 437.06 36608
+120.434128 434.03 36864
+120.470992 434.03 36864
+120.508112 431.03 37120
+120.545488 428.08 37376
+120.583120 425.17 37632
+120.620752 425.17 37632
+120.658640 422.30 37888
+120.697040 416.67 38400
+120.735696 413.91 38656
+120.774608 411.18 38912
+120.813520 411.18 38912
+120.852688 408.50 39168
+120.892112 405.84 39424
+120.931792 403.23 39680
+120.971728 400.64 39936
+121.011920 398.09 40192
+121.052368 395.57 40448
+121.093072 393.08 40704
+121.134032 390.62 40960
+121.175248 388.20 41216
+121.216720 385.80 41472
+121.258448 383.44 41728
+121.300432 381.10 41984
+121.342672 378.79 42240
+121.385424 374.25 42752
+121.428432 372.02 43008
+121.471696 369.82 43264
+121.515472 365.50 43776
+121.559504 363.37 44032
+121.603792 361.27 44288
+121.648336 359.20 44544
+121.693136 357.14 44800
+121.738448 353.11 45312
+121.784016 351.12 45568
+121.830096 347.22 46080
+121.876432 345.30 46336
+121.923280 341.53 46848
+121.970640 337.84 47360
+122.018256 336.02 47616
+122.066384 332.45 48128
+122.115024 328.95 48640
+122.163920 327.23 48896
+122.213328 323.83 49408
+122.263504 318.88 50176
+122.314192 315.66 50688
+122.365392 312.50 51200
+122.416848 310.95 51456
+122.468816 307.88 51968
+122.521296 304.88 52480
+122.574544 300.48 53248
+122.628304 297.62 53760
+122.682832 293.43 54528
+122.738128 289.35 55296
+122.793936 286.70 55808
+122.850256 284.09 56320
+122.907600 279.02 57344
+122.965456 276.55 57856
+123.024080 272.93 58624
+123.083728 268.24 59648
+123.144144 264.83 60416
+123.205328 261.51 61184
+123.267536 257.20 62208
+123.330768 253.04 63232
+123.395024 249.00 64256
+123.460304 245.10 65280
+123.526352 242.25 66048
+123.593936 236.74 67584
+123.663056 231.48 69120
+123.733200 228.10 70144
+123.804880 223.21 71680
+123.877584 220.07 72704
+123.951824 215.52 74240
+124.027600 211.15 75776
+124.105424 205.59 77824
+124.185296 200.32 79872
+124.267216 195.31 81920
+124.351184 190.55 83968
+124.437712 184.91 86528
+124.526800 179.60 89088
+124.618960 173.61 92160
+124.714192 168.01 95232
+124.813008 161.92 98816
+124.915920 155.47 102912
+125.023440 148.81 107520
+125.136080 142.05 112640
+125.255376 134.12 119296
+125.381840 126.52 126464
+125.517008 118.37 135168
+125.662416 110.04 145408
+125.822160 100.16 159744
+126.000336 89.80 178176
+126.206160 77.74 205824
+126.459088 63.26 252928
+126.815440 44.90 356352
+127.321296 31.63 505856
+EOF
+plot $data using 1:2 with linespoints
+pause -1
@@ -0,0 +1,1004 @@
+$data <<EOF
+0.356352 44.90 356352
+0.609280 63.26 252928
+0.815104 77.74 205824
+0.993280 89.80 178176
+1.153024 100.16 159744
+1.298432 110.04 145408
+1.433600 118.37 135168
+1.560064 126.52 126464
+1.679360 134.12 119296
+1.792000 142.05 112640
+1.899520 148.81 107520
+2.002432 155.47 102912
+2.101248 161.92 98816
+2.196480 168.01 95232
+2.288640 173.61 92160
+2.377728 179.60 89088
+2.464256 184.91 86528
+2.548224 190.55 83968
+2.630144 195.31 81920
+2.710016 200.32 79872
+2.787840 205.59 77824
+2.863616 211.15 75776
+2.937856 215.52 74240
+3.010560 220.07 72704
+3.082240 223.21 71680
+3.152384 228.10 70144
+3.221504 231.48 69120
+3.289088 236.74 67584
+3.355136 242.25 66048
+3.420416 245.10 65280
+3.484672 249.00 64256
+3.547904 253.04 63232
+3.610112 257.20 62208
+3.671296 261.51 61184
+3.731712 264.83 60416
+3.791360 268.24 59648
+3.849984 272.93 58624
+3.907840 276.55 57856
+3.965184 279.02 57344
+4.021504 284.09 56320
+4.077312 286.70 55808
+4.132608 289.35 55296
+4.187136 293.43 54528
+4.240896 297.62 53760
+4.294144 300.48 53248
+4.346624 304.88 52480
+4.398592 307.88 51968
+4.450048 310.95 51456
+4.501248 312.50 51200
+4.551936 315.66 50688
+4.602112 318.88 50176
+4.651520 323.83 49408
+4.700416 327.23 48896
+4.749056 328.95 48640
+4.797184 332.45 48128
+4.844800 336.02 47616
+4.892160 337.84 47360
+4.939008 341.53 46848
+4.985344 345.30 46336
+5.031424 347.22 46080
+5.076992 351.12 45568
+5.122304 353.11 45312
+5.167104 357.14 44800
+5.211648 359.20 44544
+5.255936 361.27 44288
+5.299968 363.37 44032
+5.343744 365.50 43776
+5.387008 369.82 43264
+5.430016 372.02 43008
+5.472768 374.25 42752
+5.515008 378.79 42240
+5.556992 381.10 41984
+5.598720 383.44 41728
+5.640192 385.80 41472
+5.681408 388.20 41216
+5.722368 390.62 40960
+5.763072 393.08 40704
+5.803520 395.57 40448
+5.843712 398.09 40192
+5.883648 400.64 39936
+5.923328 403.23 39680
+5.962752 405.84 39424
+6.001920 408.50 39168
+6.040832 411.18 38912
+6.079744 411.18 38912
+6.118400 413.91 38656
+6.156800 416.67 38400
+6.194688 422.30 37888
+6.232320 425.17 37632
+6.269952 425.17 37632
+6.307328 428.08 37376
+6.344448 431.03 37120
+6.381312 434.03 36864
+6.418176 434.03 36864
+6.454784 437.06 36608
+6.491136 440.14 36352
+6.527232 443.26 36096
+6.563328 443.26 36096
+6.599168 446.43 35840
+6.635008 446.43 35840
+6.670592 449.64 35584
+6.705920 452.90 35328
+6.740992 456.20 35072
+6.776064 456.20 35072
+6.810880 459.56 34816
+6.845440 462.96 34560
+6.880000 462.96 34560
+6.914560 462.96 34560
+6.948864 466.42 34304
+6.982912 469.92 34048
+7.016704 473.48 33792
+7.050496 473.48 33792
+7.084032 477.10 33536
+7.117568 477.10 33536
+7.150848 480.77 33280
+7.183872 484.50 33024
+7.216896 484.50 33024
+7.249664 488.28 32768
+7.282432 488.28 32768
+7.315072 490.20 32640
+7.347584 492.13 32512
+7.379840 496.03 32256
+7.412096 496.03 32256
+7.444224 498.01 32128
+7.476224 500.00 32000
+7.507968 504.03 31744
+7.539712 504.03 31744
+7.571328 506.07 31616
+7.602816 508.13 31488
+7.634048 512.30 31232
+7.665280 512.30 31232
+7.696384 514.40 31104
+7.727360 516.53 30976
+7.758336 516.53 30976
+7.789056 520.83 30720
+7.819648 523.01 30592
+7.850240 523.01 30592
+7.880704 525.21 30464
+7.910912 529.66 30208
+7.941120 529.66 30208
+7.971200 531.91 30080
+8.001152 534.19 29952
+8.031104 534.19 29952
+8.060928 536.48 29824
+8.090496 541.13 29568
+8.120064 541.13 29568
+8.149504 543.48 29440
+8.178816 545.85 29312
+8.208128 545.85 29312
+8.237312 548.25 29184
+8.266496 548.25 29184
+8.295424 553.10 28928
+8.324224 555.56 28800
+8.353024 555.56 28800
+8.381696 558.04 28672
+8.410368 558.04 28672
+8.438912 560.54 28544
+8.467200 565.61 28288
+8.495488 565.61 28288
+8.523648 568.18 28160
+8.551808 568.18 28160
+8.579840 570.78 28032
+8.607872 570.78 28032
+8.635776 573.39 27904
+8.663552 576.04 27776
+8.691328 576.04 27776
+8.718976 578.70 27648
+8.746624 578.70 27648
+8.774016 584.11 27392
+8.801408 584.11 27392
+8.828672 586.85 27264
+8.855936 586.85 27264
+8.883072 589.62 27136
+8.910208 589.62 27136
+8.937216 592.42 27008
+8.964096 595.24 26880
+8.990976 595.24 26880
+9.017728 598.09 26752
+9.044480 598.09 26752
+9.071104 600.96 26624
+9.097728 600.96 26624
+9.124096 606.80 26368
+9.150464 606.80 26368
+9.176704 609.76 26240
+9.202944 609.76 26240
+9.229056 612.75 26112
+9.255168 612.75 26112
+9.281152 615.76 25984
+9.307136 615.76 25984
+9.332992 618.81 25856
+9.358848 618.81 25856
+9.384576 621.89 25728
+9.410304 621.89 25728
+9.435904 625.00 25600
+9.461504 625.00 25600
+9.487104 625.00 25600
+9.512576 628.14 25472
+9.538048 628.14 25472
+9.563392 631.31 25344
+9.588736 631.31 25344
+9.613952 634.52 25216
+9.639168 634.52 25216
+9.664256 637.76 25088
+9.689344 637.76 25088
+9.714176 644.33 24832
+9.739008 644.33 24832
+9.763712 647.67 24704
+9.788416 647.67 24704
+9.813120 647.67 24704
+9.837696 651.04 24576
+9.862272 651.04 24576
+9.886720 654.45 24448
+9.911168 654.45 24448
+9.935488 657.89 24320
+9.959808 657.89 24320
+9.984128 657.89 24320
+10.008320 661.38 24192
+10.032512 661.38 24192
+10.056576 664.89 24064
+10.080640 664.89 24064
+10.104576 668.45 23936
+10.128512 668.45 23936
+10.152448 668.45 23936
+10.176256 672.04 23808
+10.200064 672.04 23808
+10.223744 675.68 23680
+10.247424 675.68 23680
+10.271104 675.68 23680
+10.294656 679.35 23552
+10.318208 679.35 23552
+10.341632 683.06 23424
+10.365056 683.06 23424
+10.388480 683.06 23424
+10.411776 686.81 23296
+10.435072 686.81 23296
+10.458240 690.61 23168
+10.481408 690.61 23168
+10.504576 690.61 23168
+10.527616 694.44 23040
+10.550656 694.44 23040
+10.573568 698.32 22912
+10.596480 698.32 22912
+10.619392 698.32 22912
+10.642176 702.25 22784
+10.664960 702.25 22784
+10.687744 702.25 22784
+10.710400 706.21 22656
+10.733056 706.21 22656
+10.755584 710.23 22528
+10.778112 710.23 22528
+10.800640 710.23 22528
+10.823040 714.29 22400
+10.845440 714.29 22400
+10.867840 714.29 22400
+10.890112 718.39 22272
+10.912384 718.39 22272
+10.934656 718.39 22272
+10.956928 718.39 22272
+10.979200 718.39 22272
+11.001344 722.54 22144
+11.023488 722.54 22144
+11.045632 722.54 22144
+11.067776 722.54 22144
+11.089792 726.74 22016
+11.111808 726.74 22016
+11.133696 730.99 21888
+11.155584 730.99 21888
+11.177472 730.99 21888
+11.199360 730.99 21888
+11.221120 735.29 21760
+11.242880 735.29 21760
+11.264512 739.64 21632
+11.286144 739.64 21632
+11.307776 739.64 21632
+11.329408 739.64 21632
+11.350912 744.05 21504
+11.372416 744.05 21504
+11.393792 748.50 21376
+11.415168 748.50 21376
+11.436544 748.50 21376
+11.457920 748.50 21376
+11.479168 753.01 21248
+11.500416 753.01 21248
+11.521536 757.58 21120
+11.542656 757.58 21120
+11.563776 757.58 21120
+11.584896 757.58 21120
+11.605888 762.20 20992
+11.626880 762.20 20992
+11.647744 766.87 20864
+11.668608 766.87 20864
+11.689472 766.87 20864
+11.710336 766.87 20864
+11.731200 766.87 20864
+11.752064 766.87 20864
+11.772800 771.60 20736
+11.793536 771.60 20736
+11.814272 771.60 20736
+11.835008 771.60 20736
+11.855616 776.40 20608
+11.876224 776.40 20608
+11.896832 776.40 20608
+11.917440 776.40 20608
+11.937920 781.25 20480
+11.958400 781.25 20480
+11.978752 786.16 20352
+11.999104 786.16 20352
+12.019456 786.16 20352
+12.039808 786.16 20352
+12.060032 791.14 20224
+12.080256 791.14 20224
+12.100480 791.14 20224
+12.120704 791.14 20224
+12.140800 796.18 20096
+12.160896 796.18 20096
+12.180992 796.18 20096
+12.201088 796.18 20096
+12.221184 796.18 20096
+12.241280 796.18 20096
+12.261248 801.28 19968
+12.281216 801.28 19968
+12.301184 801.28 19968
+12.321152 801.28 19968
+12.340992 806.45 19840
+12.360832 806.45 19840
+12.380672 806.45 19840
+12.400512 806.45 19840
+12.420224 811.69 19712
+12.439936 811.69 19712
+12.459520 816.99 19584
+12.479104 816.99 19584
+12.498688 816.99 19584
+12.518272 816.99 19584
+12.537728 822.37 19456
+12.557184 822.37 19456
+12.576640 822.37 19456
+12.596096 822.37 19456
+12.615552 822.37 19456
+12.635008 822.37 19456
+12.654464 822.37 19456
+12.673920 822.37 19456
+12.693248 827.81 19328
+12.712576 827.81 19328
+12.731904 827.81 19328
+12.751232 827.81 19328
+12.770432 833.33 19200
+12.789632 833.33 19200
+12.808832 833.33 19200
+12.828032 833.33 19200
+12.847104 838.93 19072
+12.866176 838.93 19072
+12.885120 844.59 18944
+12.904064 844.59 18944
+12.923008 844.59 18944
+12.941952 844.59 18944
+12.960768 850.34 18816
+12.979584 850.34 18816
+12.998400 850.34 18816
+13.017216 850.34 18816
+13.036032 850.34 18816
+13.054848 850.34 18816
+13.073664 850.34 18816
+13.092480 850.34 18816
+13.111168 856.16 18688
+13.129856 856.16 18688
+13.148544 856.16 18688
+13.167232 856.16 18688
+13.185792 862.07 18560
+13.204352 862.07 18560
+13.222912 862.07 18560
+13.241472 862.07 18560
+13.259904 868.06 18432
+13.278336 868.06 18432
+13.296768 868.06 18432
+13.315200 868.06 18432
+13.333632 868.06 18432
+13.352064 868.06 18432
+13.370496 868.06 18432
+13.388928 868.06 18432
+13.407232 874.13 18304
+13.425536 874.13 18304
+13.443840 874.13 18304
+13.462144 874.13 18304
+13.480320 880.28 18176
+13.498496 880.28 18176
+13.516672 880.28 18176
+13.534848 880.28 18176
+13.552896 886.52 18048
+13.570944 886.52 18048
+13.588992 886.52 18048
+13.607040 886.52 18048
+13.625088 886.52 18048
+13.643136 886.52 18048
+13.661056 892.86 17920
+13.678976 892.86 17920
+13.696896 892.86 17920
+13.714816 892.86 17920
+13.732736 892.86 17920
+13.750656 892.86 17920
+13.768576 892.86 17920
+13.786496 892.86 17920
+13.804288 899.28 17792
+13.822080 899.28 17792
+13.839872 899.28 17792
+13.857664 899.28 17792
+13.875328 905.80 17664
+13.892992 905.80 17664
+13.910656 905.80 17664
+13.928320 905.80 17664
+13.945856 912.41 17536
+13.963392 912.41 17536
+13.980928 912.41 17536
+13.998464 912.41 17536
+14.016000 912.41 17536
+14.033536 912.41 17536
+14.051072 912.41 17536
+14.068608 912.41 17536
+14.086144 912.41 17536
+14.103680 912.41 17536
+14.121088 919.12 17408
+14.138496 919.12 17408
+14.155904 919.12 17408
+14.173312 919.12 17408
+14.190592 925.93 17280
+14.207872 925.93 17280
+14.225152 925.93 17280
+14.242432 925.93 17280
+14.259712 925.93 17280
+14.276992 925.93 17280
+14.294272 925.93 17280
+14.311552 925.93 17280
+14.328832 925.93 17280
+14.346112 925.93 17280
+14.363264 932.84 17152
+14.380416 932.84 17152
+14.397568 932.84 17152
+14.414720 932.84 17152
+14.431744 939.85 17024
+14.448768 939.85 17024
+14.465792 939.85 17024
+14.482816 939.85 17024
+14.499712 946.97 16896
+14.516608 946.97 16896
+14.533504 946.97 16896
+14.550400 946.97 16896
+14.567296 946.97 16896
+14.584192 946.97 16896
+14.601088 946.97 16896
+14.617984 946.97 16896
+14.634880 946.97 16896
+14.651776 946.97 16896
+14.668544 954.20 16768
+14.685312 954.20 16768
+14.702080 954.20 16768
+14.718848 954.20 16768
+14.735616 954.20 16768
+14.752384 954.20 16768
+14.769024 961.54 16640
+14.785664 961.54 16640
+14.802304 961.54 16640
+14.818944 961.54 16640
+14.835456 968.99 16512
+14.851968 968.99 16512
+14.868480 968.99 16512
+14.884992 968.99 16512
+14.901504 968.99 16512
+14.918016 968.99 16512
+14.934528 968.99 16512
+14.951040 968.99 16512
+14.967552 968.99 16512
+14.984064 968.99 16512
+15.000448 976.56 16384
+15.016832 976.56 16384
+15.033216 976.56 16384
+15.049600 976.56 16384
+15.065984 976.56 16384
+15.082368 976.56 16384
+15.098688 980.39 16320
+15.115008 980.39 16320
+15.131328 980.39 16320
+15.147648 980.39 16320
+15.163904 984.25 16256
+15.180160 984.25 16256
+15.196416 984.25 16256
+15.212672 984.25 16256
+15.228928 984.25 16256
+15.245184 984.25 16256
+15.261312 992.06 16128
+15.277440 992.06 16128
+15.293568 992.06 16128
+15.309696 992.06 16128
+15.325824 992.06 16128
+15.341952 992.06 16128
+15.358016 996.02 16064
+15.374080 996.02 16064
+15.390144 996.02 16064
+15.406208 996.02 16064
+15.422208 1000.00 16000
+15.438208 1000.00 16000
+15.454208 1000.00 16000
+15.470208 1000.00 16000
+15.486208 1000.00 16000
+15.502272 996.02 16064
+15.518336 996.02 16064
+15.534400 996.02 16064
+15.550464 996.02 16064
+15.566592 992.06 16128
+15.582720 992.06 16128
+15.598848 992.06 16128
+15.614976 992.06 16128
+15.631104 992.06 16128
+15.647232 992.06 16128
+15.663488 984.25 16256
+15.679744 984.25 16256
+15.696000 984.25 16256
+15.712256 984.25 16256
+15.728512 984.25 16256
+15.744768 984.25 16256
+15.761088 980.39 16320
+15.777408 980.39 16320
+15.793728 980.39 16320
+15.810048 980.39 16320
+15.826432 976.56 16384
+15.842816 976.56 16384
+15.859200 976.56 16384
+15.875584 976.56 16384
+15.891968 976.56 16384
+15.908352 976.56 16384
+15.924864 968.99 16512
+15.941376 968.99 16512
+15.957888 968.99 16512
+15.974400 968.99 16512
+15.990912 968.99 16512
+16.007424 968.99 16512
+16.023936 968.99 16512
+16.040448 968.99 16512
+16.056960 968.99 16512
+16.073472 968.99 16512
+16.090112 961.54 16640
+16.106752 961.54 16640
+16.123392 961.54 16640
+16.140032 961.54 16640
+16.156800 954.20 16768
+16.173568 954.20 16768
+16.190336 954.20 16768
+16.207104 954.20 16768
+16.223872 954.20 16768
+16.240640 954.20 16768
+16.257536 946.97 16896
+16.274432 946.97 16896
+16.291328 946.97 16896
+16.308224 946.97 16896
+16.325120 946.97 16896
+16.342016 946.97 16896
+16.358912 946.97 16896
+16.375808 946.97 16896
+16.392704 946.97 16896
+16.409600 946.97 16896
+16.426624 939.85 17024
+16.443648 939.85 17024
+16.460672 939.85 17024
+16.477696 939.85 17024
+16.494848 932.84 17152
+16.512000 932.84 17152
+16.529152 932.84 17152
+16.546304 932.84 17152
+16.563584 925.93 17280
+16.580864 925.93 17280
+16.598144 925.93 17280
+16.615424 925.93 17280
+16.632704 925.93 17280
+16.649984 925.93 17280
+16.667264 925.93 17280
+16.684544 925.93 17280
+16.701824 925.93 17280
+16.719104 925.93 17280
+16.736512 919.12 17408
+16.753920 919.12 17408
+16.771328 919.12 17408
+16.788736 919.12 17408
+16.806272 912.41 17536
+16.823808 912.41 17536
+16.841344 912.41 17536
+16.858880 912.41 17536
+16.876416 912.41 17536
+16.893952 912.41 17536
+16.911488 912.41 17536
+16.929024 912.41 17536
+16.946560 912.41 17536
+16.964096 912.41 17536
+16.981760 905.80 17664
+16.999424 905.80 17664
+17.017088 905.80 17664
+17.034752 905.80 17664
+17.052544 899.28 17792
+17.070336 899.28 17792
+17.088128 899.28 17792
+17.105920 899.28 17792
+17.123840 892.86 17920
+17.141760 892.86 17920
+17.159680 892.86 17920
+17.177600 892.86 17920
+17.195520 892.86 17920
+17.213440 892.86 17920
+17.231360 892.86 17920
+17.249280 892.86 17920
+17.267328 886.52 18048
+17.285376 886.52 18048
+17.303424 886.52 18048
+17.321472 886.52 18048
+17.339520 886.52 18048
+17.357568 886.52 18048
+17.375744 880.28 18176
+17.393920 880.28 18176
+17.412096 880.28 18176
+17.430272 880.28 18176
+17.448576 874.13 18304
+17.466880 874.13 18304
+17.485184 874.13 18304
+17.503488 874.13 18304
+17.521920 868.06 18432
+17.540352 868.06 18432
+17.558784 868.06 18432
+17.577216 868.06 18432
+17.595648 868.06 18432
+17.614080 868.06 18432
+17.632512 868.06 18432
+17.650944 868.06 18432
+17.669504 862.07 18560
+17.688064 862.07 18560
+17.706624 862.07 18560
+17.725184 862.07 18560
+17.743872 856.16 18688
+17.762560 856.16 18688
+17.781248 856.16 18688
+17.799936 856.16 18688
+17.818752 850.34 18816
+17.837568 850.34 18816
+17.856384 850.34 18816
+17.875200 850.34 18816
+17.894016 850.34 18816
+17.912832 850.34 18816
+17.931648 850.34 18816
+17.950464 850.34 18816
+17.969408 844.59 18944
+17.988352 844.59 18944
+18.007296 844.59 18944
+18.026240 844.59 18944
+18.045312 838.93 19072
+18.064384 838.93 19072
+18.083584 833.33 19200
+18.102784 833.33 19200
+18.121984 833.33 19200
+18.141184 833.33 19200
+18.160512 827.81 19328
+18.179840 827.81 19328
+18.199168 827.81 19328
+18.218496 827.81 19328
+18.237952 822.37 19456
+18.257408 822.37 19456
+18.276864 822.37 19456
+18.296320 822.37 19456
+18.315776 822.37 19456
+18.335232 822.37 19456
+18.354688 822.37 19456
+18.374144 822.37 19456
+18.393728 816.99 19584
+18.413312 816.99 19584
+18.432896 816.99 19584
+18.452480 816.99 19584
+18.472192 811.69 19712
+18.491904 811.69 19712
+18.511744 806.45 19840
+18.531584 806.45 19840
+18.551424 806.45 19840
+18.571264 806.45 19840
+18.591232 801.28 19968
+18.611200 801.28 19968
+18.631168 801.28 19968
+18.651136 801.28 19968
+18.671232 796.18 20096
+18.691328 796.18 20096
+18.711424 796.18 20096
+18.731520 796.18 20096
+18.751616 796.18 20096
+18.771712 796.18 20096
+18.791936 791.14 20224
+18.812160 791.14 20224
+18.832384 791.14 20224
+18.852608 791.14 20224
+18.872960 786.16 20352
+18.893312 786.16 20352
+18.913664 786.16 20352
+18.934016 786.16 20352
+18.954496 781.25 20480
+18.974976 781.25 20480
+18.995584 776.40 20608
+19.016192 776.40 20608
+19.036800 776.40 20608
+19.057408 776.40 20608
+19.078144 771.60 20736
+19.098880 771.60 20736
+19.119616 771.60 20736
+19.140352 771.60 20736
+19.161216 766.87 20864
+19.182080 766.87 20864
+19.202944 766.87 20864
+19.223808 766.87 20864
+19.244672 766.87 20864
+19.265536 766.87 20864
+19.286528 762.20 20992
+19.307520 762.20 20992
+19.328640 757.58 21120
+19.349760 757.58 21120
+19.370880 757.58 21120
+19.392000 757.58 21120
+19.413248 753.01 21248
+19.434496 753.01 21248
+19.455872 748.50 21376
+19.477248 748.50 21376
+19.498624 748.50 21376
+19.520000 748.50 21376
+19.541504 744.05 21504
+19.563008 744.05 21504
+19.584640 739.64 21632
+19.606272 739.64 21632
+19.627904 739.64 21632
+19.649536 739.64 21632
+19.671296 735.29 21760
+19.693056 735.29 21760
+19.714944 730.99 21888
+19.736832 730.99 21888
+19.758720 730.99 21888
+19.780608 730.99 21888
+19.802624 726.74 22016
+19.824640 726.74 22016
+19.846784 722.54 22144
+19.868928 722.54 22144
+19.891072 722.54 22144
+19.913216 722.54 22144
+19.935488 718.39 22272
+19.957760 718.39 22272
+19.980032 718.39 22272
+20.002304 718.39 22272
+20.024576 718.39 22272
+20.046976 714.29 22400
+20.069376 714.29 22400
+20.091776 714.29 22400
+20.114304 710.23 22528
+20.136832 710.23 22528
+20.159360 710.23 22528
+20.182016 706.21 22656
+20.204672 706.21 22656
+20.227456 702.25 22784
+20.250240 702.25 22784
+20.273024 702.25 22784
+20.295936 698.32 22912
+20.318848 698.32 22912
+20.341760 698.32 22912
+20.364800 694.44 23040
+20.387840 694.44 23040
+20.411008 690.61 23168
+20.434176 690.61 23168
+20.457344 690.61 23168
+20.480640 686.81 23296
+20.503936 686.81 23296
+20.527360 683.06 23424
+20.550784 683.06 23424
+20.574208 683.06 23424
+20.597760 679.35 23552
+20.621312 679.35 23552
+20.644992 675.68 23680
+20.668672 675.68 23680
+20.692352 675.68 23680
+20.716160 672.04 23808
+20.739968 672.04 23808
+20.763904 668.45 23936
+20.787840 668.45 23936
+20.811776 668.45 23936
+20.835840 664.89 24064
+20.859904 664.89 24064
+20.884096 661.38 24192
+20.908288 661.38 24192
+20.932608 657.89 24320
+20.956928 657.89 24320
+20.981248 657.89 24320
+21.005696 654.45 24448
+21.030144 654.45 24448
+21.054720 651.04 24576
+21.079296 651.04 24576
+21.104000 647.67 24704
+21.128704 647.67 24704
+21.153408 647.67 24704
+21.178240 644.33 24832
+21.203072 644.33 24832
+21.228160 637.76 25088
+21.253248 637.76 25088
+21.278464 634.52 25216
+21.303680 634.52 25216
+21.329024 631.31 25344
+21.354368 631.31 25344
+21.379840 628.14 25472
+21.405312 628.14 25472
+21.430912 625.00 25600
+21.456512 625.00 25600
+21.482112 625.00 25600
+21.507840 621.89 25728
+21.533568 621.89 25728
+21.559424 618.81 25856
+21.585280 618.81 25856
+21.611264 615.76 25984
+21.637248 615.76 25984
+21.663360 612.75 26112
+21.689472 612.75 26112
+21.715712 609.76 26240
+21.741952 609.76 26240
+21.768320 606.80 26368
+21.794688 606.80 26368
+21.821312 600.96 26624
+21.847936 600.96 26624
+21.874688 598.09 26752
+21.901440 598.09 26752
+21.928320 595.24 26880
+21.955200 595.24 26880
+21.982208 592.42 27008
+22.009344 589.62 27136
+22.036480 589.62 27136
+22.063744 586.85 27264
+22.091008 586.85 27264
+22.118400 584.11 27392
+22.145792 584.11 27392
+22.173440 578.70 27648
+22.201088 578.70 27648
+22.228864 576.04 27776
+22.256640 576.04 27776
+22.284544 573.39 27904
+22.312576 570.78 28032
+22.340608 570.78 28032
+22.368768 568.18 28160
+22.396928 568.18 28160
+22.425216 565.61 28288
+22.453504 565.61 28288
+22.482048 560.54 28544
+22.510720 558.04 28672
+22.539392 558.04 28672
+22.568192 555.56 28800
+22.596992 555.56 28800
+22.625920 553.10 28928
+22.655104 548.25 29184
+22.684288 548.25 29184
+22.713600 545.85 29312
+22.742912 545.85 29312
+22.772352 543.48 29440
+22.801920 541.13 29568
+22.831488 541.13 29568
+22.861312 536.48 29824
+22.891264 534.19 29952
+22.921216 534.19 29952
+22.951296 531.91 30080
+22.981504 529.66 30208
+23.011712 529.66 30208
+23.042176 525.21 30464
+23.072768 523.01 30592
+23.103360 523.01 30592
+23.134080 520.83 30720
+23.165056 516.53 30976
+23.196032 516.53 30976
+23.227136 514.40 31104
+23.258368 512.30 31232
+23.289600 512.30 31232
+23.321088 508.13 31488
+23.352704 506.07 31616
+23.384448 504.03 31744
+23.416192 504.03 31744
+23.448192 500.00 32000
+23.480320 498.01 32128
+23.512576 496.03 32256
+23.544832 496.03 32256
+23.577344 492.13 32512
+23.609984 490.20 32640
+23.642752 488.28 32768
+23.675520 488.28 32768
+23.708544 484.50 33024
+23.741568 484.50 33024
+23.774848 480.77 33280
+23.808384 477.10 33536
+23.841920 477.10 33536
+23.875712 473.48 33792
+23.909504 473.48 33792
+23.943552 469.92 34048
+23.977856 466.42 34304
+24.012416 462.96 34560
+24.046976 462.96 34560
+24.081536 462.96 34560
+24.116352 459.56 34816
+24.151424 456.20 35072
+24.186496 456.20 35072
+24.221824 452.90 35328
+24.257408 449.64 35584
+24.293248 446.43 35840
+24.329088 446.43 35840
+24.365184 443.26 36096
+24.401280 443.26 36096
+24.437632 440.14 36352
+24.474240 437.06 36608
+24.511104 434.03 36864
+24.547968 434.03 36864
+24.585088 431.03 37120
+24.622464 428.08 37376
+24.660096 425.17 37632
+24.697728 425.17 37632
+24.735616 422.30 37888
+24.774016 416.67 38400
+24.812672 413.91 38656
+24.851584 411.18 38912
+24.890496 411.18 38912
+24.929664 408.50 39168
+24.969088 405.84 39424
+25.008768 403.23 39680
+25.048704 400.64 39936
+25.088896 398.09 40192
+25.129344 395.57 40448
+25.170048 393.08 40704
+25.211008 390.62 40960
+25.252224 388.20 41216
+25.293696 385.80 41472
+25.335424 383.44 41728
+25.377408 381.10 41984
+25.419648 378.79 42240
+25.462400 374.25 42752
+25.505408 372.02 43008
+25.548672 369.82 43264
+25.592448 365.50 43776
+25.636480 363.37 44032
+25.680768 361.27 44288
+25.725312 359.20 44544
+25.770112 357.14 44800
+25.815424 353.11 45312
+25.860992 351.12 45568
+25.907072 347.22 46080
+25.953408 345.30 46336
+26.000256 341.53 46848
+26.047616 337.84 47360
+26.095232 336.02 47616
+26.143360 332.45 48128
+26.192000 328.95 48640
+26.240896 327.23 48896
+26.290304 323.83 49408
+26.340480 318.88 50176
+26.391168 315.66 50688
+26.442368 312.50 51200
+26.493824 310.95 51456
+26.545792 307.88 51968
+26.598272 304.88 52480
+26.651520 300.48 53248
+26.705280 297.62 53760
+26.759808 293.43 54528
+26.815104 289.35 55296
+26.870912 286.70 55808
+26.927232 284.09 56320
+26.984576 279.02 57344
+27.042432 276.55 57856
+27.101056 272.93 58624
+27.160704 268.24 59648
+27.221120 264.83 60416
+27.282304 261.51 61184
+27.344512 257.20 62208
+27.407744 253.04 63232
+27.472000 249.00 64256
+27.537280 245.10 65280
+27.603328 242.25 66048
+27.670912 236.74 67584
+27.740032 231.48 69120
+27.810176 228.10 70144
+27.881856 223.21 71680
+27.954560 220.07 72704
+28.028800 215.52 74240
+28.104576 211.15 75776
+28.182400 205.59 77824
+28.262272 200.32 79872
+28.344192 195.31 81920
+28.428160 190.55 83968
+28.514688 184.91 86528
+28.603776 179.60 89088
+28.695936 173.61 92160
+28.791168 168.01 95232
+28.889984 161.92 98816
+28.992896 155.47 102912
+29.100416 148.81 107520
+29.213056 142.05 112640
+29.332352 134.12 119296
+29.458816 126.52 126464
+29.593984 118.37 135168
+29.739392 110.04 145408
+29.899136 100.16 159744
+30.077312 89.80 178176
+30.283136 77.74 205824
+30.536064 63.26 252928
+30.892416 44.90 356352
+31.398272 31.63 505856
+EOF
+plot $data using 1:2 with linespoints
+pause -1
@@ -0,0 +1,504 @@
+$data <<EOF
+5.046272 3.17 5046272
+8.617984 4.48 3571712
+11.534336 5.49 2916352
+14.057472 6.34 2523136
+16.318464 7.08 2260992
+18.382848 7.75 2064384
+20.299776 8.35 1916928
+22.085632 8.96 1785856
+23.764992 9.53 1679360
+25.370624 9.96 1605632
+26.894336 10.50 1523712
+28.352512 10.97 1458176
+29.761536 11.36 1409024
+31.113216 11.84 1351680
+32.415744 12.28 1302528
+33.677312 12.68 1261568
+34.906112 13.02 1228800
+36.093952 13.47 1187840
+37.249024 13.85 1155072
+38.379520 14.15 1130496
+39.485440 14.47 1105920
+40.566784 14.80 1081344
+41.623552 15.14 1056768
+42.655744 15.50 1032192
+43.667456 15.81 1011712
+44.662784 16.08 995328
+45.637632 16.41 974848
+46.596096 16.69 958464
+47.534080 17.06 937984
+48.455680 17.36 921600
+49.360896 17.68 905216
+50.253824 17.92 892928
+51.130368 18.25 876544
+51.998720 18.43 868352
+52.854784 18.69 856064
+53.694464 19.05 839680
+54.525952 19.24 831488
+55.345152 19.53 819200
+56.156160 19.73 811008
+56.958976 19.93 802816
+57.745408 20.35 786432
+58.523648 20.56 778240
+59.293696 20.78 770048
+60.055552 21.00 761856
+60.809216 21.23 753664
+61.554688 21.46 745472
+62.291968 21.70 737280
+63.021056 21.95 729088
+63.741952 22.19 720896
+64.454656 22.45 712704
+65.163264 22.58 708608
+65.867776 22.71 704512
+66.564096 22.98 696320
+67.252224 23.25 688128
+67.932160 23.53 679936
+68.608000 23.67 675840
+69.275648 23.96 667648
+69.939200 24.11 663552
+70.598656 24.26 659456
+71.249920 24.57 651264
+71.897088 24.72 647168
+72.540160 24.88 643072
+73.179136 25.04 638976
+73.809920 25.37 630784
+74.436608 25.53 626688
+75.059200 25.70 622592
+75.677696 25.87 618496
+76.292096 26.04 614400
+76.898304 26.39 606208
+77.500416 26.57 602112
+78.102528 26.57 602112
+78.696448 26.94 593920
+79.286272 27.13 589824
+79.876096 27.13 589824
+80.461824 27.32 585728
+81.039360 27.70 577536
+81.612800 27.90 573440
+82.186240 27.90 573440
+82.755584 28.10 569344
+83.320832 28.31 565248
+83.881984 28.51 561152
+84.439040 28.72 557056
+84.992000 28.94 552960
+85.544960 28.94 552960
+86.093824 29.15 548864
+86.638592 29.37 544768
+87.179264 29.59 540672
+87.719936 29.59 540672
+88.256512 29.82 536576
+88.788992 30.05 532480
+89.317376 30.28 528384
+89.845760 30.28 528384
+90.370048 30.52 524288
+90.892288 30.64 522240
+91.412480 30.76 520192
+91.928576 31.00 516096
+92.442624 31.13 514048
+92.954624 31.25 512000
+93.462528 31.50 507904
+93.968384 31.63 505856
+94.472192 31.76 503808
+94.971904 32.02 499712
+95.469568 32.15 497664
+95.967232 32.15 497664
+96.462848 32.28 495616
+96.954368 32.55 491520
+97.443840 32.69 489472
+97.931264 32.83 487424
+98.414592 33.10 483328
+98.895872 33.24 481280
+99.377152 33.24 481280
+99.856384 33.39 479232
+100.333568 33.53 477184
+100.806656 33.82 473088
+101.277696 33.97 471040
+101.746688 34.12 468992
+102.215680 34.12 468992
+102.682624 34.27 466944
+103.145472 34.57 462848
+103.606272 34.72 460800
+104.067072 34.72 460800
+104.525824 34.88 458752
+104.982528 35.03 456704
+105.435136 35.35 452608
+105.887744 35.35 452608
+106.338304 35.51 450560
+106.786816 35.67 448512
+107.233280 35.84 446464
+107.679744 35.84 446464
+108.124160 36.00 444416
+108.566528 36.17 442368
+109.004800 36.51 438272
+109.443072 36.51 438272
+109.879296 36.68 436224
+110.313472 36.85 434176
+110.747648 36.85 434176
+111.179776 37.03 432128
+111.609856 37.20 430080
+112.039936 37.20 430080
+112.467968 37.38 428032
+112.893952 37.56 425984
+113.319936 37.56 425984
+113.741824 37.92 421888
+114.161664 38.11 419840
+114.581504 38.11 419840
+114.999296 38.30 417792
+115.417088 38.30 417792
+115.832832 38.49 415744
+116.246528 38.68 413696
+116.660224 38.68 413696
+117.071872 38.87 411648
+117.481472 39.06 409600
+117.891072 39.06 409600
+118.298624 39.26 407552
+118.706176 39.26 407552
+119.111680 39.46 405504
+119.515136 39.66 403456
+119.918592 39.66 403456
+120.320000 39.86 401408
+120.721408 39.86 401408
+121.118720 40.27 397312
+121.516032 40.27 397312
+121.911296 40.48 395264
+122.304512 40.69 393216
+122.697728 40.69 393216
+123.088896 40.90 391168
+123.480064 40.90 391168
+123.869184 41.12 389120
+124.258304 41.12 389120
+124.645376 41.34 387072
+125.032448 41.34 387072
+125.417472 41.56 385024
+125.802496 41.56 385024
+126.185472 41.78 382976
+126.566400 42.00 380928
+126.947328 42.00 380928
+127.326208 42.23 378880
+127.705088 42.23 378880
+128.081920 42.46 376832
+128.458752 42.46 376832
+128.833536 42.69 374784
+129.208320 42.69 374784
+129.581056 42.93 372736
+129.953792 42.93 372736
+130.324480 43.16 370688
+130.695168 43.16 370688
+131.063808 43.40 368640
+131.432448 43.40 368640
+131.799040 43.65 366592
+132.165632 43.65 366592
+132.530176 43.89 364544
+132.894720 43.89 364544
+133.257216 44.14 362496
+133.619712 44.14 362496
+133.980160 44.39 360448
+134.340608 44.39 360448
+134.701056 44.39 360448
+135.059456 44.64 358400
+135.417856 44.64 358400
+135.774208 44.90 356352
+136.130560 44.90 356352
+136.486912 44.90 356352
+136.843264 44.90 356352
+137.197568 45.16 354304
+137.551872 45.16 354304
+137.904128 45.42 352256
+138.256384 45.42 352256
+138.608640 45.42 352256
+138.958848 45.69 350208
+139.309056 45.69 350208
+139.657216 45.96 348160
+140.005376 45.96 348160
+140.351488 46.23 346112
+140.697600 46.23 346112
+141.041664 46.50 344064
+141.385728 46.50 344064
+141.729792 46.50 344064
+142.071808 46.78 342016
+142.413824 46.78 342016
+142.753792 47.06 339968
+143.093760 47.06 339968
+143.433728 47.06 339968
+143.771648 47.35 337920
+144.109568 47.35 337920
+144.445440 47.64 335872
+144.781312 47.64 335872
+145.115136 47.93 333824
+145.448960 47.93 333824
+145.782784 47.93 333824
+146.116608 47.93 333824
+146.450432 47.93 333824
+146.782208 48.23 331776
+147.113984 48.23 331776
+147.445760 48.23 331776
+147.775488 48.52 329728
+148.105216 48.52 329728
+148.434944 48.52 329728
+148.762624 48.83 327680
+149.090304 48.83 327680
+149.415936 49.14 325632
+149.741568 49.14 325632
+150.067200 49.14 325632
+150.390784 49.45 323584
+150.714368 49.45 323584
+151.035904 49.76 321536
+151.357440 49.76 321536
+151.678976 49.76 321536
+152.000512 49.76 321536
+152.322048 49.76 321536
+152.643584 49.76 321536
+152.965120 49.76 321536
+153.286656 49.76 321536
+153.608192 49.76 321536
+153.929728 49.76 321536
+154.251264 49.76 321536
+154.574848 49.45 323584
+154.898432 49.45 323584
+155.224064 49.14 325632
+155.549696 49.14 325632
+155.875328 49.14 325632
+156.203008 48.83 327680
+156.530688 48.83 327680
+156.860416 48.52 329728
+157.190144 48.52 329728
+157.519872 48.52 329728
+157.851648 48.23 331776
+158.183424 48.23 331776
+158.515200 48.23 331776
+158.849024 47.93 333824
+159.182848 47.93 333824
+159.516672 47.93 333824
+159.850496 47.93 333824
+160.184320 47.93 333824
+160.520192 47.64 335872
+160.856064 47.64 335872
+161.193984 47.35 337920
+161.531904 47.35 337920
+161.871872 47.06 339968
+162.211840 47.06 339968
+162.551808 47.06 339968
+162.893824 46.78 342016
+163.235840 46.78 342016
+163.579904 46.50 344064
+163.923968 46.50 344064
+164.268032 46.50 344064
+164.614144 46.23 346112
+164.960256 46.23 346112
+165.308416 45.96 348160
+165.656576 45.96 348160
+166.006784 45.69 350208
+166.356992 45.69 350208
+166.709248 45.42 352256
+167.061504 45.42 352256
+167.413760 45.42 352256
+167.768064 45.16 354304
+168.122368 45.16 354304
+168.478720 44.90 356352
+168.835072 44.90 356352
+169.191424 44.90 356352
+169.547776 44.90 356352
+169.906176 44.64 358400
+170.264576 44.64 358400
+170.625024 44.39 360448
+170.985472 44.39 360448
+171.345920 44.39 360448
+171.708416 44.14 362496
+172.070912 44.14 362496
+172.435456 43.89 364544
+172.800000 43.89 364544
+173.166592 43.65 366592
+173.533184 43.65 366592
+173.901824 43.40 368640
+174.270464 43.40 368640
+174.641152 43.16 370688
+175.011840 43.16 370688
+175.384576 42.93 372736
+175.757312 42.93 372736
+176.132096 42.69 374784
+176.506880 42.69 374784
+176.883712 42.46 376832
+177.260544 42.46 376832
+177.639424 42.23 378880
+178.018304 42.23 378880
+178.399232 42.00 380928
+178.780160 42.00 380928
+179.163136 41.78 382976
+179.548160 41.56 385024
+179.933184 41.56 385024
+180.320256 41.34 387072
+180.707328 41.34 387072
+181.096448 41.12 389120
+181.485568 41.12 389120
+181.876736 40.90 391168
+182.267904 40.90 391168
+182.661120 40.69 393216
+183.054336 40.69 393216
+183.449600 40.48 395264
+183.846912 40.27 397312
+184.244224 40.27 397312
+184.645632 39.86 401408
+185.047040 39.86 401408
+185.450496 39.66 403456
+185.853952 39.66 403456
+186.259456 39.46 405504
+186.667008 39.26 407552
+187.074560 39.26 407552
+187.484160 39.06 409600
+187.893760 39.06 409600
+188.305408 38.87 411648
+188.719104 38.68 413696
+189.132800 38.68 413696
+189.548544 38.49 415744
+189.966336 38.30 417792
+190.384128 38.30 417792
+190.803968 38.11 419840
+191.223808 38.11 419840
+191.645696 37.92 421888
+192.071680 37.56 425984
+192.497664 37.56 425984
+192.925696 37.38 428032
+193.355776 37.20 430080
+193.785856 37.20 430080
+194.217984 37.03 432128
+194.652160 36.85 434176
+195.086336 36.85 434176
+195.522560 36.68 436224
+195.960832 36.51 438272
+196.399104 36.51 438272
+196.841472 36.17 442368
+197.285888 36.00 444416
+197.732352 35.84 446464
+198.178816 35.84 446464
+198.627328 35.67 448512
+199.077888 35.51 450560
+199.530496 35.35 452608
+199.983104 35.35 452608
+200.439808 35.03 456704
+200.898560 34.88 458752
+201.359360 34.72 460800
+201.820160 34.72 460800
+202.283008 34.57 462848
+202.749952 34.27 466944
+203.218944 34.12 468992
+203.687936 34.12 468992
+204.158976 33.97 471040
+204.632064 33.82 473088
+205.109248 33.53 477184
+205.588480 33.39 479232
+206.069760 33.24 481280
+206.551040 33.24 481280
+207.034368 33.10 483328
+207.521792 32.83 487424
+208.011264 32.69 489472
+208.502784 32.55 491520
+208.998400 32.28 495616
+209.496064 32.15 497664
+209.993728 32.15 497664
+210.493440 32.02 499712
+210.997248 31.76 503808
+211.503104 31.63 505856
+212.011008 31.50 507904
+212.523008 31.25 512000
+213.037056 31.13 514048
+213.553152 31.00 516096
+214.073344 30.76 520192
+214.595584 30.64 522240
+215.119872 30.52 524288
+215.648256 30.28 528384
+216.176640 30.28 528384
+216.709120 30.05 532480
+217.245696 29.82 536576
+217.786368 29.59 540672
+218.327040 29.59 540672
+218.871808 29.37 544768
+219.420672 29.15 548864
+219.973632 28.94 552960
+220.526592 28.94 552960
+221.083648 28.72 557056
+221.644800 28.51 561152
+222.210048 28.31 565248
+222.779392 28.10 569344
+223.352832 27.90 573440
+223.926272 27.90 573440
+224.503808 27.70 577536
+225.089536 27.32 585728
+225.679360 27.13 589824
+226.269184 27.13 589824
+226.863104 26.94 593920
+227.465216 26.57 602112
+228.067328 26.57 602112
+228.673536 26.39 606208
+229.287936 26.04 614400
+229.906432 25.87 618496
+230.529024 25.70 622592
+231.155712 25.53 626688
+231.786496 25.37 630784
+232.425472 25.04 638976
+233.068544 24.88 643072
+233.715712 24.72 647168
+234.366976 24.57 651264
+235.026432 24.26 659456
+235.689984 24.11 663552
+236.357632 23.96 667648
+237.033472 23.67 675840
+237.713408 23.53 679936
+238.401536 23.25 688128
+239.097856 22.98 696320
+239.802368 22.71 704512
+240.510976 22.58 708608
+241.223680 22.45 712704
+241.944576 22.19 720896
+242.673664 21.95 729088
+243.410944 21.70 737280
+244.156416 21.46 745472
+244.910080 21.23 753664
+245.671936 21.00 761856
+246.441984 20.78 770048
+247.220224 20.56 778240
+248.006656 20.35 786432
+248.809472 19.93 802816
+249.620480 19.73 811008
+250.439680 19.53 819200
+251.271168 19.24 831488
+252.110848 19.05 839680
+252.966912 18.69 856064
+253.835264 18.43 868352
+254.711808 18.25 876544
+255.604736 17.92 892928
+256.509952 17.68 905216
+257.431552 17.36 921600
+258.369536 17.06 937984
+259.328000 16.69 958464
+260.302848 16.41 974848
+261.298176 16.08 995328
+262.309888 15.81 1011712
+263.342080 15.50 1032192
+264.398848 15.14 1056768
+265.480192 14.80 1081344
+266.586112 14.47 1105920
+267.716608 14.15 1130496
+268.871680 13.85 1155072
+270.059520 13.47 1187840
+271.288320 13.02 1228800
+272.549888 12.68 1261568
+273.852416 12.28 1302528
+275.204096 11.84 1351680
+276.613120 11.36 1409024
+278.071296 10.97 1458176
+279.595008 10.50 1523712
+281.200640 9.96 1605632
+282.880000 9.53 1679360
+284.665856 8.96 1785856
+286.582784 8.35 1916928
+288.647168 7.75 2064384
+290.908160 7.08 2260992
+293.431296 6.34 2523136
+296.347648 5.49 2916352
+299.919360 4.48 3571712
+304.965632 3.17 5046272
+312.109056 2.24 7143424
+EOF
+plot $data using 1:2 with linespoints
+pause -1
@@ -0,0 +1,2004 @@
+$data <<EOF
+5.046272 3.17 5046272
+8.617984 4.48 3571712
+11.534336 5.49 2916352
+14.057472 6.34 2523136
+16.318464 7.08 2260992
+18.382848 7.75 2064384
+20.299776 8.35 1916928
+22.085632 8.96 1785856
+23.764992 9.53 1679360
+25.370624 9.96 1605632
+26.894336 10.50 1523712
+28.352512 10.97 1458176
+29.761536 11.36 1409024
+31.113216 11.84 1351680
+32.415744 12.28 1302528
+33.677312 12.68 1261568
+34.906112 13.02 1228800
+36.093952 13.47 1187840
+37.249024 13.85 1155072
+38.379520 14.15 1130496
+39.485440 14.47 1105920
+40.566784 14.80 1081344
+41.623552 15.14 1056768
+42.655744 15.50 1032192
+43.667456 15.81 1011712
+44.662784 16.08 995328
+45.637632 16.41 974848
+46.596096 16.69 958464
+47.534080 17.06 937984
+48.455680 17.36 921600
+49.360896 17.68 905216
+50.253824 17.92 892928
+51.130368 18.25 876544
+51.998720 18.43 868352
+52.854784 18.69 856064
+53.694464 19.05 839680
+54.525952 19.24 831488
+55.345152 19.53 819200
+56.156160 19.73 811008
+56.958976 19.93 802816
+57.745408 20.35 786432
+58.523648 20.56 778240
+59.293696 20.78 770048
+60.055552 21.00 761856
+60.809216 21.23 753664
+61.554688 21.46 745472
+62.291968 21.70 737280
+63.021056 21.95 729088
+63.741952 22.19 720896
+64.454656 22.45 712704
+65.163264 22.58 708608
+65.867776 22.71 704512
+66.564096 22.98 696320
+67.252224 23.25 688128
+67.932160 23.53 679936
+68.608000 23.67 675840
+69.275648 23.96 667648
+69.939200 24.11 663552
+70.598656 24.26 659456
+71.249920 24.57 651264
+71.897088 24.72 647168
+72.540160 24.88 643072
+73.179136 25.04 638976
+73.809920 25.37 630784
+74.436608 25.53 626688
+75.059200 25.70 622592
+75.677696 25.87 618496
+76.292096 26.04 614400
+76.898304 26.39 606208
+77.500416 26.57 602112
+78.102528 26.57 602112
+78.696448 26.94 593920
+79.286272 27.13 589824
+79.876096 27.13 589824
+80.461824 27.32 585728
+81.039360 27.70 577536
+81.612800 27.90 573440
+82.186240 27.90 573440
+82.755584 28.10 569344
+83.320832 28.31 565248
+83.881984 28.51 561152
+84.439040 28.72 557056
+84.992000 28.94 552960
+85.544960 28.94 552960
+86.093824 29.15 548864
+86.638592 29.37 544768
+87.179264 29.59 540672
+87.719936 29.59 540672
+88.256512 29.82 536576
+88.788992 30.05 532480
+89.317376 30.28 528384
+89.845760 30.28 528384
+90.370048 30.52 524288
+90.892288 30.64 522240
+91.412480 30.76 520192
+91.928576 31.00 516096
+92.442624 31.13 514048
+92.954624 31.25 512000
+93.462528 31.50 507904
+93.968384 31.63 505856
+94.472192 31.76 503808
+94.971904 32.02 499712
+95.469568 32.15 497664
+95.967232 32.15 497664
+96.462848 32.28 495616
+96.954368 32.55 491520
+97.443840 32.69 489472
+97.931264 32.83 487424
+98.414592 33.10 483328
+98.895872 33.24 481280
+99.377152 33.24 481280
+99.856384 33.39 479232
+100.333568 33.53 477184
+100.806656 33.82 473088
+101.277696 33.97 471040
+101.746688 34.12 468992
+102.215680 34.12 468992
+102.682624 34.27 466944
+103.145472 34.57 462848
+103.606272 34.72 460800
+104.067072 34.72 460800
+104.525824 34.88 458752
+104.982528 35.03 456704
+105.435136 35.35 452608
+105.887744 35.35 452608
+106.338304 35.51 450560
+106.786816 35.67 448512
+107.233280 35.84 446464
+107.679744 35.84 446464
+108.124160 36.00 444416
+108.566528 36.17 442368
+109.004800 36.51 438272
+109.443072 36.51 438272
+109.879296 36.68 436224
+110.313472 36.85 434176
+110.747648 36.85 434176
+111.179776 37.03 432128
+111.609856 37.20 430080
+112.039936 37.20 430080
+112.467968 37.38 428032
+112.893952 37.56 425984
+113.319936 37.56 425984
+113.741824 37.92 421888
+114.161664 38.11 419840
+114.581504 38.11 419840
+114.999296 38.30 417792
+115.417088 38.30 417792
+115.832832 38.49 415744
+116.246528 38.68 413696
+116.660224 38.68 413696
+117.071872 38.87 411648
+117.481472 39.06 409600
+117.891072 39.06 409600
+118.298624 39.26 407552
+118.706176 39.26 407552
+119.111680 39.46 405504
+119.515136 39.66 403456
+119.918592 39.66 403456
+120.320000 39.86 401408
+120.721408 39.86 401408
+121.118720 40.27 397312
+121.516032 40.27 397312
+121.911296 40.48 395264
+122.304512 40.69 393216
+122.697728 40.69 393216
+123.088896 40.90 391168
+123.480064 40.90 391168
+123.869184 41.12 389120
+124.258304 41.12 389120
+124.645376 41.34 387072
+125.032448 41.34 387072
+125.417472 41.56 385024
+125.802496 41.56 385024
+126.185472 41.78 382976
+126.566400 42.00 380928
+126.947328 42.00 380928
+127.326208 42.23 378880
+127.705088 42.23 378880
+128.081920 42.46 376832
+128.458752 42.46 376832
+128.833536 42.69 374784
+129.208320 42.69 374784
+129.581056 42.93 372736
+129.953792 42.93 372736
+130.324480 43.16 370688
+130.695168 43.16 370688
+131.063808 43.40 368640
+131.432448 43.40 368640
+131.799040 43.65 366592
+132.165632 43.65 366592
+132.530176 43.89 364544
+132.894720 43.89 364544
+133.257216 44.14 362496
+133.619712 44.14 362496
+133.980160 44.39 360448
+134.340608 44.39 360448
+134.701056 44.39 360448
+135.059456 44.64 358400
+135.417856 44.64 358400
+135.774208 44.90 356352
+136.130560 44.90 356352
+136.486912 44.90 356352
+136.843264 44.90 356352
+137.197568 45.16 354304
+137.551872 45.16 354304
+137.904128 45.42 352256
+138.256384 45.42 352256
+138.608640 45.42 352256
+138.958848 45.69 350208
+139.309056 45.69 350208
+139.657216 45.96 348160
+140.005376 45.96 348160
+140.351488 46.23 346112
+140.697600 46.23 346112
+141.041664 46.50 344064
+141.385728 46.50 344064
+141.729792 46.50 344064
+142.071808 46.78 342016
+142.413824 46.78 342016
+142.753792 47.06 339968
+143.093760 47.06 339968
+143.433728 47.06 339968
+143.771648 47.35 337920
+144.109568 47.35 337920
+144.445440 47.64 335872
+144.781312 47.64 335872
+145.115136 47.93 333824
+145.448960 47.93 333824
+145.782784 47.93 333824
+146.116608 47.93 333824
+146.450432 47.93 333824
+146.782208 48.23 331776
+147.113984 48.23 331776
+147.445760 48.23 331776
+147.775488 48.52 329728
+148.105216 48.52 329728
+148.434944 48.52 329728
+148.762624 48.83 327680
+149.090304 48.83 327680
+149.415936 49.14 325632
+149.741568 49.14 325632
+150.067200 49.14 325632
+150.390784 49.45 323584
+150.714368 49.45 323584
+151.035904 49.76 321536
+151.357440 49.76 321536
+151.678976 49.76 321536
+152.000512 49.76 321536
+152.322048 49.76 321536
+152.643584 49.76 321536
+152.963072 50.08 319488
+153.282560 50.08 319488
+153.600000 50.40 317440
+153.917440 50.40 317440
+154.234880 50.40 317440
+154.550272 50.73 315392
+154.865664 50.73 315392
+155.181056 50.73 315392
+155.496448 50.73 315392
+155.809792 51.06 313344
+156.123136 51.06 313344
+156.434432 51.40 311296
+156.745728 51.40 311296
+157.057024 51.40 311296
+157.368320 51.40 311296
+157.679616 51.40 311296
+157.990912 51.40 311296
+158.300160 51.74 309248
+158.609408 51.74 309248
+158.916608 52.08 307200
+159.223808 52.08 307200
+159.531008 52.08 307200
+159.838208 52.08 307200
+160.143360 52.43 305152
+160.448512 52.43 305152
+160.751616 52.79 303104
+161.054720 52.79 303104
+161.357824 52.79 303104
+161.660928 52.79 303104
+161.961984 53.15 301056
+162.263040 53.15 301056
+162.564096 53.15 301056
+162.865152 53.15 301056
+163.166208 53.15 301056
+163.467264 53.15 301056
+163.766272 53.51 299008
+164.065280 53.51 299008
+164.362240 53.88 296960
+164.659200 53.88 296960
+164.956160 53.88 296960
+165.253120 53.88 296960
+165.548032 54.25 294912
+165.842944 54.25 294912
+166.137856 54.25 294912
+166.432768 54.25 294912
+166.727680 54.25 294912
+167.022592 54.25 294912
+167.315456 54.63 292864
+167.608320 54.63 292864
+167.901184 54.63 292864
+168.194048 54.63 292864
+168.484864 55.02 290816
+168.775680 55.02 290816
+169.064448 55.41 288768
+169.353216 55.41 288768
+169.641984 55.41 288768
+169.930752 55.41 288768
+170.217472 55.80 286720
+170.504192 55.80 286720
+170.790912 55.80 286720
+171.077632 55.80 286720
+171.364352 55.80 286720
+171.651072 55.80 286720
+171.935744 56.21 284672
+172.220416 56.21 284672
+172.505088 56.21 284672
+172.789760 56.21 284672
+173.072384 56.61 282624
+173.355008 56.61 282624
+173.637632 56.61 282624
+173.920256 56.61 282624
+174.200832 57.03 280576
+174.481408 57.03 280576
+174.761984 57.03 280576
+175.042560 57.03 280576
+175.323136 57.03 280576
+175.603712 57.03 280576
+175.882240 57.44 278528
+176.160768 57.44 278528
+176.439296 57.44 278528
+176.717824 57.44 278528
+176.994304 57.87 276480
+177.270784 57.87 276480
+177.547264 57.87 276480
+177.823744 57.87 276480
+178.100224 57.87 276480
+178.376704 57.87 276480
+178.653184 57.87 276480
+178.929664 57.87 276480
+179.204096 58.30 274432
+179.478528 58.30 274432
+179.752960 58.30 274432
+180.027392 58.30 274432
+180.299776 58.74 272384
+180.572160 58.74 272384
+180.844544 58.74 272384
+181.116928 58.74 272384
+181.387264 59.19 270336
+181.657600 59.19 270336
+181.927936 59.19 270336
+182.198272 59.19 270336
+182.468608 59.19 270336
+182.738944 59.19 270336
+183.007232 59.64 268288
+183.275520 59.64 268288
+183.543808 59.64 268288
+183.812096 59.64 268288
+184.078336 60.10 266240
+184.344576 60.10 266240
+184.610816 60.10 266240
+184.877056 60.10 266240
+185.141248 60.56 264192
+185.405440 60.56 264192
+185.669632 60.56 264192
+185.933824 60.56 264192
+186.198016 60.56 264192
+186.462208 60.56 264192
+186.726400 60.56 264192
+186.990592 60.56 264192
+187.252736 61.04 262144
+187.514880 61.04 262144
+187.777024 61.04 262144
+188.039168 61.04 262144
+188.300288 61.27 261120
+188.561408 61.27 261120
+188.822528 61.27 261120
+189.083648 61.27 261120
+189.343744 61.52 260096
+189.603840 61.52 260096
+189.863936 61.52 260096
+190.124032 61.52 260096
+190.382080 62.00 258048
+190.640128 62.00 258048
+190.898176 62.00 258048
+191.156224 62.00 258048
+191.413248 62.25 257024
+191.670272 62.25 257024
+191.927296 62.25 257024
+192.184320 62.25 257024
+192.440320 62.50 256000
+192.696320 62.50 256000
+192.952320 62.50 256000
+193.208320 62.50 256000
+193.464320 62.50 256000
+193.720320 62.50 256000
+193.974272 63.00 253952
+194.228224 63.00 253952
+194.482176 63.00 253952
+194.736128 63.00 253952
+194.989056 63.26 252928
+195.241984 63.26 252928
+195.494912 63.26 252928
+195.747840 63.26 252928
+195.999744 63.52 251904
+196.251648 63.52 251904
+196.503552 63.52 251904
+196.755456 63.52 251904
+197.005312 64.04 249856
+197.255168 64.04 249856
+197.505024 64.04 249856
+197.754880 64.04 249856
+198.003712 64.30 248832
+198.252544 64.30 248832
+198.501376 64.30 248832
+198.750208 64.30 248832
+198.999040 64.30 248832
+199.247872 64.30 248832
+199.495680 64.57 247808
+199.743488 64.57 247808
+199.991296 64.57 247808
+200.239104 64.57 247808
+200.484864 65.10 245760
+200.730624 65.10 245760
+200.976384 65.10 245760
+201.222144 65.10 245760
+201.466880 65.38 244736
+201.711616 65.38 244736
+201.956352 65.38 244736
+202.201088 65.38 244736
+202.444800 65.65 243712
+202.688512 65.65 243712
+202.932224 65.65 243712
+203.175936 65.65 243712
+203.419648 65.65 243712
+203.663360 65.65 243712
+203.905024 66.21 241664
+204.146688 66.21 241664
+204.388352 66.21 241664
+204.630016 66.21 241664
+204.870656 66.49 240640
+205.111296 66.49 240640
+205.351936 66.49 240640
+205.592576 66.49 240640
+205.833216 66.49 240640
+206.073856 66.49 240640
+206.313472 66.77 239616
+206.553088 66.77 239616
+206.792704 66.77 239616
+207.032320 66.77 239616
+207.270912 67.06 238592
+207.509504 67.06 238592
+207.748096 67.06 238592
+207.986688 67.06 238592
+208.223232 67.64 236544
+208.459776 67.64 236544
+208.696320 67.64 236544
+208.932864 67.64 236544
+209.169408 67.64 236544
+209.405952 67.64 236544
+209.641472 67.93 235520
+209.876992 67.93 235520
+210.112512 67.93 235520
+210.348032 67.93 235520
+210.582528 68.23 234496
+210.817024 68.23 234496
+211.051520 68.23 234496
+211.286016 68.23 234496
+211.520512 68.23 234496
+211.755008 68.23 234496
+211.988480 68.53 233472
+212.221952 68.53 233472
+212.455424 68.53 233472
+212.688896 68.53 233472
+212.922368 68.53 233472
+213.155840 68.53 233472
+213.387264 69.14 231424
+213.618688 69.14 231424
+213.850112 69.14 231424
+214.081536 69.14 231424
+214.311936 69.44 230400
+214.542336 69.44 230400
+214.772736 69.44 230400
+215.003136 69.44 230400
+215.233536 69.44 230400
+215.463936 69.44 230400
+215.693312 69.75 229376
+215.922688 69.75 229376
+216.152064 69.75 229376
+216.381440 69.75 229376
+216.609792 70.07 228352
+216.838144 70.07 228352
+217.066496 70.07 228352
+217.294848 70.07 228352
+217.523200 70.07 228352
+217.751552 70.07 228352
+217.977856 70.70 226304
+218.204160 70.70 226304
+218.430464 70.70 226304
+218.656768 70.70 226304
+218.883072 70.70 226304
+219.109376 70.70 226304
+219.334656 71.02 225280
+219.559936 71.02 225280
+219.785216 71.02 225280
+220.010496 71.02 225280
+220.234752 71.35 224256
+220.459008 71.35 224256
+220.683264 71.35 224256
+220.907520 71.35 224256
+221.131776 71.35 224256
+221.356032 71.35 224256
+221.579264 71.67 223232
+221.802496 71.67 223232
+222.025728 71.67 223232
+222.248960 71.67 223232
+222.472192 71.67 223232
+222.695424 71.67 223232
+222.918656 71.67 223232
+223.141888 71.67 223232
+223.364096 72.00 222208
+223.586304 72.00 222208
+223.808512 72.00 222208
+224.030720 72.00 222208
+224.251904 72.34 221184
+224.473088 72.34 221184
+224.694272 72.34 221184
+224.915456 72.34 221184
+225.134592 73.01 219136
+225.353728 73.01 219136
+225.572864 73.01 219136
+225.792000 73.01 219136
+226.011136 73.01 219136
+226.230272 73.01 219136
+226.449408 73.01 219136
+226.668544 73.01 219136
+226.886656 73.36 218112
+227.104768 73.36 218112
+227.322880 73.36 218112
+227.540992 73.36 218112
+227.758080 73.70 217088
+227.975168 73.70 217088
+228.192256 73.70 217088
+228.409344 73.70 217088
+228.626432 73.70 217088
+228.843520 73.70 217088
+229.060608 73.70 217088
+229.277696 73.70 217088
+229.493760 74.05 216064
+229.709824 74.05 216064
+229.925888 74.05 216064
+230.141952 74.05 216064
+230.356992 74.40 215040
+230.572032 74.40 215040
+230.787072 74.40 215040
+231.002112 74.40 215040
+231.217152 74.40 215040
+231.432192 74.40 215040
+231.647232 74.40 215040
+231.862272 74.40 215040
+232.076288 74.76 214016
+232.290304 74.76 214016
+232.504320 74.76 214016
+232.718336 74.76 214016
+232.931328 75.12 212992
+233.144320 75.12 212992
+233.357312 75.12 212992
+233.570304 75.12 212992
+233.783296 75.12 212992
+233.996288 75.12 212992
+234.209280 75.12 212992
+234.422272 75.12 212992
+234.633216 75.85 210944
+234.844160 75.85 210944
+235.055104 75.85 210944
+235.266048 75.85 210944
+235.475968 76.22 209920
+235.685888 76.22 209920
+235.895808 76.22 209920
+236.105728 76.22 209920
+236.315648 76.22 209920
+236.525568 76.22 209920
+236.735488 76.22 209920
+236.945408 76.22 209920
+237.154304 76.59 208896
+237.363200 76.59 208896
+237.572096 76.59 208896
+237.780992 76.59 208896
+237.989888 76.59 208896
+238.198784 76.59 208896
+238.407680 76.59 208896
+238.616576 76.59 208896
+238.824448 76.97 207872
+239.032320 76.97 207872
+239.240192 76.97 207872
+239.448064 76.97 207872
+239.654912 77.35 206848
+239.861760 77.35 206848
+240.068608 77.35 206848
+240.275456 77.35 206848
+240.482304 77.35 206848
+240.689152 77.35 206848
+240.896000 77.35 206848
+241.102848 77.35 206848
+241.308672 77.74 205824
+241.514496 77.74 205824
+241.720320 77.74 205824
+241.926144 77.74 205824
+242.130944 78.12 204800
+242.335744 78.12 204800
+242.540544 78.12 204800
+242.745344 78.12 204800
+242.950144 78.12 204800
+243.154944 78.12 204800
+243.359744 78.12 204800
+243.564544 78.12 204800
+243.768320 78.52 203776
+243.972096 78.52 203776
+244.175872 78.52 203776
+244.379648 78.52 203776
+244.583424 78.52 203776
+244.787200 78.52 203776
+244.990976 78.52 203776
+245.194752 78.52 203776
+245.397504 78.91 202752
+245.600256 78.91 202752
+245.803008 78.91 202752
+246.005760 78.91 202752
+246.207488 79.31 201728
+246.409216 79.31 201728
+246.610944 79.31 201728
+246.812672 79.31 201728
+247.014400 79.31 201728
+247.216128 79.31 201728
+247.417856 79.31 201728
+247.619584 79.31 201728
+247.820288 79.72 200704
+248.020992 79.72 200704
+248.221696 79.72 200704
+248.422400 79.72 200704
+248.623104 79.72 200704
+248.823808 79.72 200704
+249.024512 79.72 200704
+249.225216 79.72 200704
+249.423872 80.54 198656
+249.622528 80.54 198656
+249.821184 80.54 198656
+250.019840 80.54 198656
+250.218496 80.54 198656
+250.417152 80.54 198656
+250.615808 80.54 198656
+250.814464 80.54 198656
+251.012096 80.96 197632
+251.209728 80.96 197632
+251.407360 80.96 197632
+251.604992 80.96 197632
+251.801600 81.38 196608
+251.998208 81.38 196608
+252.194816 81.38 196608
+252.391424 81.38 196608
+252.588032 81.38 196608
+252.784640 81.38 196608
+252.981248 81.38 196608
+253.177856 81.38 196608
+253.373440 81.81 195584
+253.569024 81.81 195584
+253.764608 81.81 195584
+253.960192 81.81 195584
+254.155776 81.81 195584
+254.351360 81.81 195584
+254.546944 81.81 195584
+254.742528 81.81 195584
+254.937088 82.24 194560
+255.131648 82.24 194560
+255.326208 82.24 194560
+255.520768 82.24 194560
+255.715328 82.24 194560
+255.909888 82.24 194560
+256.104448 82.24 194560
+256.299008 82.24 194560
+256.492544 82.67 193536
+256.686080 82.67 193536
+256.879616 82.67 193536
+257.073152 82.67 193536
+257.266688 82.67 193536
+257.460224 82.67 193536
+257.653760 82.67 193536
+257.847296 82.67 193536
+258.039808 83.11 192512
+258.232320 83.11 192512
+258.424832 83.11 192512
+258.617344 83.11 192512
+258.809856 83.11 192512
+259.002368 83.11 192512
+259.194880 83.11 192512
+259.387392 83.11 192512
+259.578880 83.56 191488
+259.770368 83.56 191488
+259.961856 83.56 191488
+260.153344 83.56 191488
+260.343808 84.01 190464
+260.534272 84.01 190464
+260.724736 84.01 190464
+260.915200 84.01 190464
+261.105664 84.01 190464
+261.296128 84.01 190464
+261.486592 84.01 190464
+261.677056 84.01 190464
+261.866496 84.46 189440
+262.055936 84.46 189440
+262.245376 84.46 189440
+262.434816 84.46 189440
+262.624256 84.46 189440
+262.813696 84.46 189440
+263.003136 84.46 189440
+263.192576 84.46 189440
+263.380992 84.92 188416
+263.569408 84.92 188416
+263.757824 84.92 188416
+263.946240 84.92 188416
+264.134656 84.92 188416
+264.323072 84.92 188416
+264.511488 84.92 188416
+264.699904 84.92 188416
+264.887296 85.38 187392
+265.074688 85.38 187392
+265.262080 85.38 187392
+265.449472 85.38 187392
+265.636864 85.38 187392
+265.824256 85.38 187392
+266.011648 85.38 187392
+266.199040 85.38 187392
+266.385408 85.85 186368
+266.571776 85.85 186368
+266.758144 85.85 186368
+266.944512 85.85 186368
+267.130880 85.85 186368
+267.317248 85.85 186368
+267.503616 85.85 186368
+267.689984 85.85 186368
+267.875328 86.33 185344
+268.060672 86.33 185344
+268.246016 86.33 185344
+268.431360 86.33 185344
+268.616704 86.33 185344
+268.802048 86.33 185344
+268.987392 86.33 185344
+269.172736 86.33 185344
+269.357056 86.81 184320
+269.541376 86.81 184320
+269.725696 86.81 184320
+269.910016 86.81 184320
+270.094336 86.81 184320
+270.278656 86.81 184320
+270.462976 86.81 184320
+270.647296 86.81 184320
+270.830592 87.29 183296
+271.013888 87.29 183296
+271.197184 87.29 183296
+271.380480 87.29 183296
+271.563776 87.29 183296
+271.747072 87.29 183296
+271.930368 87.29 183296
+272.113664 87.29 183296
+272.295936 87.78 182272
+272.478208 87.78 182272
+272.660480 87.78 182272
+272.842752 87.78 182272
+273.025024 87.78 182272
+273.207296 87.78 182272
+273.389568 87.78 182272
+273.571840 87.78 182272
+273.753088 88.28 181248
+273.934336 88.28 181248
+274.115584 88.28 181248
+274.296832 88.28 181248
+274.478080 88.28 181248
+274.659328 88.28 181248
+274.840576 88.28 181248
+275.021824 88.28 181248
+275.202048 88.78 180224
+275.382272 88.78 180224
+275.562496 88.78 180224
+275.742720 88.78 180224
+275.922944 88.78 180224
+276.103168 88.78 180224
+276.283392 88.78 180224
+276.463616 88.78 180224
+276.643840 88.78 180224
+276.824064 88.78 180224
+277.004288 88.78 180224
+277.184512 88.78 180224
+277.363712 89.29 179200
+277.542912 89.29 179200
+277.722112 89.29 179200
+277.901312 89.29 179200
+278.080512 89.29 179200
+278.259712 89.29 179200
+278.438912 89.29 179200
+278.618112 89.29 179200
+278.796288 89.80 178176
+278.974464 89.80 178176
+279.152640 89.80 178176
+279.330816 89.80 178176
+279.508992 89.80 178176
+279.687168 89.80 178176
+279.865344 89.80 178176
+280.043520 89.80 178176
+280.221696 89.80 178176
+280.399872 89.80 178176
+280.578048 89.80 178176
+280.756224 89.80 178176
+280.934400 89.80 178176
+281.112576 89.80 178176
+281.290752 89.80 178176
+281.468928 89.80 178176
+281.646080 90.32 177152
+281.823232 90.32 177152
+282.000384 90.32 177152
+282.177536 90.32 177152
+282.354688 90.32 177152
+282.531840 90.32 177152
+282.708992 90.32 177152
+282.886144 90.32 177152
+283.062272 90.84 176128
+283.238400 90.84 176128
+283.414528 90.84 176128
+283.590656 90.84 176128
+283.766784 90.84 176128
+283.942912 90.84 176128
+284.119040 90.84 176128
+284.295168 90.84 176128
+284.471296 90.84 176128
+284.647424 90.84 176128
+284.823552 90.84 176128
+284.999680 90.84 176128
+285.174784 91.37 175104
+285.349888 91.37 175104
+285.524992 91.37 175104
+285.700096 91.37 175104
+285.875200 91.37 175104
+286.050304 91.37 175104
+286.225408 91.37 175104
+286.400512 91.37 175104
+286.574592 91.91 174080
+286.748672 91.91 174080
+286.922752 91.91 174080
+287.096832 91.91 174080
+287.270912 91.91 174080
+287.444992 91.91 174080
+287.619072 91.91 174080
+287.793152 91.91 174080
+287.966208 92.46 173056
+288.139264 92.46 173056
+288.312320 92.46 173056
+288.485376 92.46 173056
+288.658432 92.46 173056
+288.831488 92.46 173056
+289.004544 92.46 173056
+289.177600 92.46 173056
+289.349632 93.01 172032
+289.521664 93.01 172032
+289.693696 93.01 172032
+289.865728 93.01 172032
+290.037760 93.01 172032
+290.209792 93.01 172032
+290.381824 93.01 172032
+290.553856 93.01 172032
+290.725888 93.01 172032
+290.897920 93.01 172032
+291.069952 93.01 172032
+291.241984 93.01 172032
+291.412992 93.56 171008
+291.584000 93.56 171008
+291.755008 93.56 171008
+291.926016 93.56 171008
+292.097024 93.56 171008
+292.268032 93.56 171008
+292.439040 93.56 171008
+292.610048 93.56 171008
+292.780032 94.13 169984
+292.950016 94.13 169984
+293.120000 94.13 169984
+293.289984 94.13 169984
+293.459968 94.13 169984
+293.629952 94.13 169984
+293.799936 94.13 169984
+293.969920 94.13 169984
+294.139904 94.13 169984
+294.309888 94.13 169984
+294.479872 94.13 169984
+294.649856 94.13 169984
+294.818816 94.70 168960
+294.987776 94.70 168960
+295.156736 94.70 168960
+295.325696 94.70 168960
+295.494656 94.70 168960
+295.663616 94.70 168960
+295.832576 94.70 168960
+296.001536 94.70 168960
+296.169472 95.27 167936
+296.337408 95.27 167936
+296.505344 95.27 167936
+296.673280 95.27 167936
+296.841216 95.27 167936
+297.009152 95.27 167936
+297.177088 95.27 167936
+297.345024 95.27 167936
+297.511936 95.86 166912
+297.678848 95.86 166912
+297.845760 95.86 166912
+298.012672 95.86 166912
+298.179584 95.86 166912
+298.346496 95.86 166912
+298.513408 95.86 166912
+298.680320 95.86 166912
+298.847232 95.86 166912
+299.014144 95.86 166912
+299.181056 95.86 166912
+299.347968 95.86 166912
+299.514880 95.86 166912
+299.681792 95.86 166912
+299.848704 95.86 166912
+300.015616 95.86 166912
+300.182528 95.86 166912
+300.349440 95.86 166912
+300.516352 95.86 166912
+300.683264 95.86 166912
+300.849152 96.45 165888
+301.015040 96.45 165888
+301.180928 96.45 165888
+301.346816 96.45 165888
+301.512704 96.45 165888
+301.678592 96.45 165888
+301.844480 96.45 165888
+302.010368 96.45 165888
+302.176256 96.45 165888
+302.342144 96.45 165888
+302.508032 96.45 165888
+302.673920 96.45 165888
+302.838784 97.05 164864
+303.003648 97.05 164864
+303.168512 97.05 164864
+303.333376 97.05 164864
+303.498240 97.05 164864
+303.663104 97.05 164864
+303.827968 97.05 164864
+303.992832 97.05 164864
+304.157696 97.05 164864
+304.322560 97.05 164864
+304.487424 97.05 164864
+304.652288 97.05 164864
+304.816128 97.66 163840
+304.979968 97.66 163840
+305.143808 97.66 163840
+305.307648 97.66 163840
+305.471488 97.66 163840
+305.635328 97.66 163840
+305.799168 97.66 163840
+305.963008 97.66 163840
+306.125824 98.27 162816
+306.288640 98.27 162816
+306.451456 98.27 162816
+306.614272 98.27 162816
+306.777088 98.27 162816
+306.939904 98.27 162816
+307.102720 98.27 162816
+307.265536 98.27 162816
+307.428352 98.27 162816
+307.591168 98.27 162816
+307.753984 98.27 162816
+307.916800 98.27 162816
+308.078592 98.89 161792
+308.240384 98.89 161792
+308.402176 98.89 161792
+308.563968 98.89 161792
+308.725760 98.89 161792
+308.887552 98.89 161792
+309.049344 98.89 161792
+309.211136 98.89 161792
+309.371904 99.52 160768
+309.532672 99.52 160768
+309.693440 99.52 160768
+309.854208 99.52 160768
+310.014976 99.52 160768
+310.175744 99.52 160768
+310.336512 99.52 160768
+310.497280 99.52 160768
+310.658048 99.52 160768
+310.818816 99.52 160768
+310.979584 99.52 160768
+311.140352 99.52 160768
+311.301120 99.52 160768
+311.461888 99.52 160768
+311.622656 99.52 160768
+311.783424 99.52 160768
+311.944192 99.52 160768
+312.104960 99.52 160768
+312.265728 99.52 160768
+312.426496 99.52 160768
+312.587264 99.52 160768
+312.748032 99.52 160768
+312.908800 99.52 160768
+313.069568 99.52 160768
+313.230336 99.52 160768
+313.391104 99.52 160768
+313.551872 99.52 160768
+313.712640 99.52 160768
+313.873408 99.52 160768
+314.034176 99.52 160768
+314.194944 99.52 160768
+314.355712 99.52 160768
+314.516480 99.52 160768
+314.677248 99.52 160768
+314.838016 99.52 160768
+314.998784 99.52 160768
+315.159552 99.52 160768
+315.320320 99.52 160768
+315.481088 99.52 160768
+315.641856 99.52 160768
+315.802624 99.52 160768
+315.964416 98.89 161792
+316.126208 98.89 161792
+316.288000 98.89 161792
+316.449792 98.89 161792
+316.611584 98.89 161792
+316.773376 98.89 161792
+316.935168 98.89 161792
+317.096960 98.89 161792
+317.259776 98.27 162816
+317.422592 98.27 162816
+317.585408 98.27 162816
+317.748224 98.27 162816
+317.911040 98.27 162816
+318.073856 98.27 162816
+318.236672 98.27 162816
+318.399488 98.27 162816
+318.562304 98.27 162816
+318.725120 98.27 162816
+318.887936 98.27 162816
+319.050752 98.27 162816
+319.214592 97.66 163840
+319.378432 97.66 163840
+319.542272 97.66 163840
+319.706112 97.66 163840
+319.869952 97.66 163840
+320.033792 97.66 163840
+320.197632 97.66 163840
+320.361472 97.66 163840
+320.526336 97.05 164864
+320.691200 97.05 164864
+320.856064 97.05 164864
+321.020928 97.05 164864
+321.185792 97.05 164864
+321.350656 97.05 164864
+321.515520 97.05 164864
+321.680384 97.05 164864
+321.845248 97.05 164864
+322.010112 97.05 164864
+322.174976 97.05 164864
+322.339840 97.05 164864
+322.505728 96.45 165888
+322.671616 96.45 165888
+322.837504 96.45 165888
+323.003392 96.45 165888
+323.169280 96.45 165888
+323.335168 96.45 165888
+323.501056 96.45 165888
+323.666944 96.45 165888
+323.832832 96.45 165888
+323.998720 96.45 165888
+324.164608 96.45 165888
+324.330496 96.45 165888
+324.497408 95.86 166912
+324.664320 95.86 166912
+324.831232 95.86 166912
+324.998144 95.86 166912
+325.165056 95.86 166912
+325.331968 95.86 166912
+325.498880 95.86 166912
+325.665792 95.86 166912
+325.832704 95.86 166912
+325.999616 95.86 166912
+326.166528 95.86 166912
+326.333440 95.86 166912
+326.500352 95.86 166912
+326.667264 95.86 166912
+326.834176 95.86 166912
+327.001088 95.86 166912
+327.168000 95.86 166912
+327.334912 95.86 166912
+327.501824 95.86 166912
+327.668736 95.86 166912
+327.836672 95.27 167936
+328.004608 95.27 167936
+328.172544 95.27 167936
+328.340480 95.27 167936
+328.508416 95.27 167936
+328.676352 95.27 167936
+328.844288 95.27 167936
+329.012224 95.27 167936
+329.181184 94.70 168960
+329.350144 94.70 168960
+329.519104 94.70 168960
+329.688064 94.70 168960
+329.857024 94.70 168960
+330.025984 94.70 168960
+330.194944 94.70 168960
+330.363904 94.70 168960
+330.533888 94.13 169984
+330.703872 94.13 169984
+330.873856 94.13 169984
+331.043840 94.13 169984
+331.213824 94.13 169984
+331.383808 94.13 169984
+331.553792 94.13 169984
+331.723776 94.13 169984
+331.893760 94.13 169984
+332.063744 94.13 169984
+332.233728 94.13 169984
+332.403712 94.13 169984
+332.574720 93.56 171008
+332.745728 93.56 171008
+332.916736 93.56 171008
+333.087744 93.56 171008
+333.258752 93.56 171008
+333.429760 93.56 171008
+333.600768 93.56 171008
+333.771776 93.56 171008
+333.943808 93.01 172032
+334.115840 93.01 172032
+334.287872 93.01 172032
+334.459904 93.01 172032
+334.631936 93.01 172032
+334.803968 93.01 172032
+334.976000 93.01 172032
+335.148032 93.01 172032
+335.320064 93.01 172032
+335.492096 93.01 172032
+335.664128 93.01 172032
+335.836160 93.01 172032
+336.009216 92.46 173056
+336.182272 92.46 173056
+336.355328 92.46 173056
+336.528384 92.46 173056
+336.701440 92.46 173056
+336.874496 92.46 173056
+337.047552 92.46 173056
+337.220608 92.46 173056
+337.394688 91.91 174080
+337.568768 91.91 174080
+337.742848 91.91 174080
+337.916928 91.91 174080
+338.091008 91.91 174080
+338.265088 91.91 174080
+338.439168 91.91 174080
+338.613248 91.91 174080
+338.788352 91.37 175104
+338.963456 91.37 175104
+339.138560 91.37 175104
+339.313664 91.37 175104
+339.488768 91.37 175104
+339.663872 91.37 175104
+339.838976 91.37 175104
+340.014080 91.37 175104
+340.190208 90.84 176128
+340.366336 90.84 176128
+340.542464 90.84 176128
+340.718592 90.84 176128
+340.894720 90.84 176128
+341.070848 90.84 176128
+341.246976 90.84 176128
+341.423104 90.84 176128
+341.599232 90.84 176128
+341.775360 90.84 176128
+341.951488 90.84 176128
+342.127616 90.84 176128
+342.304768 90.32 177152
+342.481920 90.32 177152
+342.659072 90.32 177152
+342.836224 90.32 177152
+343.013376 90.32 177152
+343.190528 90.32 177152
+343.367680 90.32 177152
+343.544832 90.32 177152
+343.723008 89.80 178176
+343.901184 89.80 178176
+344.079360 89.80 178176
+344.257536 89.80 178176
+344.435712 89.80 178176
+344.613888 89.80 178176
+344.792064 89.80 178176
+344.970240 89.80 178176
+345.148416 89.80 178176
+345.326592 89.80 178176
+345.504768 89.80 178176
+345.682944 89.80 178176
+345.861120 89.80 178176
+346.039296 89.80 178176
+346.217472 89.80 178176
+346.395648 89.80 178176
+346.574848 89.29 179200
+346.754048 89.29 179200
+346.933248 89.29 179200
+347.112448 89.29 179200
+347.291648 89.29 179200
+347.470848 89.29 179200
+347.650048 89.29 179200
+347.829248 89.29 179200
+348.009472 88.78 180224
+348.189696 88.78 180224
+348.369920 88.78 180224
+348.550144 88.78 180224
+348.730368 88.78 180224
+348.910592 88.78 180224
+349.090816 88.78 180224
+349.271040 88.78 180224
+349.451264 88.78 180224
+349.631488 88.78 180224
+349.811712 88.78 180224
+349.991936 88.78 180224
+350.173184 88.28 181248
+350.354432 88.28 181248
+350.535680 88.28 181248
+350.716928 88.28 181248
+350.898176 88.28 181248
+351.079424 88.28 181248
+351.260672 88.28 181248
+351.441920 88.28 181248
+351.624192 87.78 182272
+351.806464 87.78 182272
+351.988736 87.78 182272
+352.171008 87.78 182272
+352.353280 87.78 182272
+352.535552 87.78 182272
+352.717824 87.78 182272
+352.900096 87.78 182272
+353.083392 87.29 183296
+353.266688 87.29 183296
+353.449984 87.29 183296
+353.633280 87.29 183296
+353.816576 87.29 183296
+353.999872 87.29 183296
+354.183168 87.29 183296
+354.366464 87.29 183296
+354.550784 86.81 184320
+354.735104 86.81 184320
+354.919424 86.81 184320
+355.103744 86.81 184320
+355.288064 86.81 184320
+355.472384 86.81 184320
+355.656704 86.81 184320
+355.841024 86.81 184320
+356.026368 86.33 185344
+356.211712 86.33 185344
+356.397056 86.33 185344
+356.582400 86.33 185344
+356.767744 86.33 185344
+356.953088 86.33 185344
+357.138432 86.33 185344
+357.323776 86.33 185344
+357.510144 85.85 186368
+357.696512 85.85 186368
+357.882880 85.85 186368
+358.069248 85.85 186368
+358.255616 85.85 186368
+358.441984 85.85 186368
+358.628352 85.85 186368
+358.814720 85.85 186368
+359.002112 85.38 187392
+359.189504 85.38 187392
+359.376896 85.38 187392
+359.564288 85.38 187392
+359.751680 85.38 187392
+359.939072 85.38 187392
+360.126464 85.38 187392
+360.313856 85.38 187392
+360.502272 84.92 188416
+360.690688 84.92 188416
+360.879104 84.92 188416
+361.067520 84.92 188416
+361.255936 84.92 188416
+361.444352 84.92 188416
+361.632768 84.92 188416
+361.821184 84.92 188416
+362.010624 84.46 189440
+362.200064 84.46 189440
+362.389504 84.46 189440
+362.578944 84.46 189440
+362.768384 84.46 189440
+362.957824 84.46 189440
+363.147264 84.46 189440
+363.336704 84.46 189440
+363.527168 84.01 190464
+363.717632 84.01 190464
+363.908096 84.01 190464
+364.098560 84.01 190464
+364.289024 84.01 190464
+364.479488 84.01 190464
+364.669952 84.01 190464
+364.860416 84.01 190464
+365.051904 83.56 191488
+365.243392 83.56 191488
+365.434880 83.56 191488
+365.626368 83.56 191488
+365.818880 83.11 192512
+366.011392 83.11 192512
+366.203904 83.11 192512
+366.396416 83.11 192512
+366.588928 83.11 192512
+366.781440 83.11 192512
+366.973952 83.11 192512
+367.166464 83.11 192512
+367.360000 82.67 193536
+367.553536 82.67 193536
+367.747072 82.67 193536
+367.940608 82.67 193536
+368.134144 82.67 193536
+368.327680 82.67 193536
+368.521216 82.67 193536
+368.714752 82.67 193536
+368.909312 82.24 194560
+369.103872 82.24 194560
+369.298432 82.24 194560
+369.492992 82.24 194560
+369.687552 82.24 194560
+369.882112 82.24 194560
+370.076672 82.24 194560
+370.271232 82.24 194560
+370.466816 81.81 195584
+370.662400 81.81 195584
+370.857984 81.81 195584
+371.053568 81.81 195584
+371.249152 81.81 195584
+371.444736 81.81 195584
+371.640320 81.81 195584
+371.835904 81.81 195584
+372.032512 81.38 196608
+372.229120 81.38 196608
+372.425728 81.38 196608
+372.622336 81.38 196608
+372.818944 81.38 196608
+373.015552 81.38 196608
+373.212160 81.38 196608
+373.408768 81.38 196608
+373.606400 80.96 197632
+373.804032 80.96 197632
+374.001664 80.96 197632
+374.199296 80.96 197632
+374.397952 80.54 198656
+374.596608 80.54 198656
+374.795264 80.54 198656
+374.993920 80.54 198656
+375.192576 80.54 198656
+375.391232 80.54 198656
+375.589888 80.54 198656
+375.788544 80.54 198656
+375.989248 79.72 200704
+376.189952 79.72 200704
+376.390656 79.72 200704
+376.591360 79.72 200704
+376.792064 79.72 200704
+376.992768 79.72 200704
+377.193472 79.72 200704
+377.394176 79.72 200704
+377.595904 79.31 201728
+377.797632 79.31 201728
+377.999360 79.31 201728
+378.201088 79.31 201728
+378.402816 79.31 201728
+378.604544 79.31 201728
+378.806272 79.31 201728
+379.008000 79.31 201728
+379.210752 78.91 202752
+379.413504 78.91 202752
+379.616256 78.91 202752
+379.819008 78.91 202752
+380.022784 78.52 203776
+380.226560 78.52 203776
+380.430336 78.52 203776
+380.634112 78.52 203776
+380.837888 78.52 203776
+381.041664 78.52 203776
+381.245440 78.52 203776
+381.449216 78.52 203776
+381.654016 78.12 204800
+381.858816 78.12 204800
+382.063616 78.12 204800
+382.268416 78.12 204800
+382.473216 78.12 204800
+382.678016 78.12 204800
+382.882816 78.12 204800
+383.087616 78.12 204800
+383.293440 77.74 205824
+383.499264 77.74 205824
+383.705088 77.74 205824
+383.910912 77.74 205824
+384.117760 77.35 206848
+384.324608 77.35 206848
+384.531456 77.35 206848
+384.738304 77.35 206848
+384.945152 77.35 206848
+385.152000 77.35 206848
+385.358848 77.35 206848
+385.565696 77.35 206848
+385.773568 76.97 207872
+385.981440 76.97 207872
+386.189312 76.97 207872
+386.397184 76.97 207872
+386.606080 76.59 208896
+386.814976 76.59 208896
+387.023872 76.59 208896
+387.232768 76.59 208896
+387.441664 76.59 208896
+387.650560 76.59 208896
+387.859456 76.59 208896
+388.068352 76.59 208896
+388.278272 76.22 209920
+388.488192 76.22 209920
+388.698112 76.22 209920
+388.908032 76.22 209920
+389.117952 76.22 209920
+389.327872 76.22 209920
+389.537792 76.22 209920
+389.747712 76.22 209920
+389.958656 75.85 210944
+390.169600 75.85 210944
+390.380544 75.85 210944
+390.591488 75.85 210944
+390.804480 75.12 212992
+391.017472 75.12 212992
+391.230464 75.12 212992
+391.443456 75.12 212992
+391.656448 75.12 212992
+391.869440 75.12 212992
+392.082432 75.12 212992
+392.295424 75.12 212992
+392.509440 74.76 214016
+392.723456 74.76 214016
+392.937472 74.76 214016
+393.151488 74.76 214016
+393.366528 74.40 215040
+393.581568 74.40 215040
+393.796608 74.40 215040
+394.011648 74.40 215040
+394.226688 74.40 215040
+394.441728 74.40 215040
+394.656768 74.40 215040
+394.871808 74.40 215040
+395.087872 74.05 216064
+395.303936 74.05 216064
+395.520000 74.05 216064
+395.736064 74.05 216064
+395.953152 73.70 217088
+396.170240 73.70 217088
+396.387328 73.70 217088
+396.604416 73.70 217088
+396.821504 73.70 217088
+397.038592 73.70 217088
+397.255680 73.70 217088
+397.472768 73.70 217088
+397.690880 73.36 218112
+397.908992 73.36 218112
+398.127104 73.36 218112
+398.345216 73.36 218112
+398.564352 73.01 219136
+398.783488 73.01 219136
+399.002624 73.01 219136
+399.221760 73.01 219136
+399.440896 73.01 219136
+399.660032 73.01 219136
+399.879168 73.01 219136
+400.098304 73.01 219136
+400.319488 72.34 221184
+400.540672 72.34 221184
+400.761856 72.34 221184
+400.983040 72.34 221184
+401.205248 72.00 222208
+401.427456 72.00 222208
+401.649664 72.00 222208
+401.871872 72.00 222208
+402.095104 71.67 223232
+402.318336 71.67 223232
+402.541568 71.67 223232
+402.764800 71.67 223232
+402.988032 71.67 223232
+403.211264 71.67 223232
+403.434496 71.67 223232
+403.657728 71.67 223232
+403.881984 71.35 224256
+404.106240 71.35 224256
+404.330496 71.35 224256
+404.554752 71.35 224256
+404.779008 71.35 224256
+405.003264 71.35 224256
+405.228544 71.02 225280
+405.453824 71.02 225280
+405.679104 71.02 225280
+405.904384 71.02 225280
+406.130688 70.70 226304
+406.356992 70.70 226304
+406.583296 70.70 226304
+406.809600 70.70 226304
+407.035904 70.70 226304
+407.262208 70.70 226304
+407.490560 70.07 228352
+407.718912 70.07 228352
+407.947264 70.07 228352
+408.175616 70.07 228352
+408.403968 70.07 228352
+408.632320 70.07 228352
+408.861696 69.75 229376
+409.091072 69.75 229376
+409.320448 69.75 229376
+409.549824 69.75 229376
+409.780224 69.44 230400
+410.010624 69.44 230400
+410.241024 69.44 230400
+410.471424 69.44 230400
+410.701824 69.44 230400
+410.932224 69.44 230400
+411.163648 69.14 231424
+411.395072 69.14 231424
+411.626496 69.14 231424
+411.857920 69.14 231424
+412.091392 68.53 233472
+412.324864 68.53 233472
+412.558336 68.53 233472
+412.791808 68.53 233472
+413.025280 68.53 233472
+413.258752 68.53 233472
+413.493248 68.23 234496
+413.727744 68.23 234496
+413.962240 68.23 234496
+414.196736 68.23 234496
+414.431232 68.23 234496
+414.665728 68.23 234496
+414.901248 67.93 235520
+415.136768 67.93 235520
+415.372288 67.93 235520
+415.607808 67.93 235520
+415.844352 67.64 236544
+416.080896 67.64 236544
+416.317440 67.64 236544
+416.553984 67.64 236544
+416.790528 67.64 236544
+417.027072 67.64 236544
+417.265664 67.06 238592
+417.504256 67.06 238592
+417.742848 67.06 238592
+417.981440 67.06 238592
+418.221056 66.77 239616
+418.460672 66.77 239616
+418.700288 66.77 239616
+418.939904 66.77 239616
+419.180544 66.49 240640
+419.421184 66.49 240640
+419.661824 66.49 240640
+419.902464 66.49 240640
+420.143104 66.49 240640
+420.383744 66.49 240640
+420.625408 66.21 241664
+420.867072 66.21 241664
+421.108736 66.21 241664
+421.350400 66.21 241664
+421.594112 65.65 243712
+421.837824 65.65 243712
+422.081536 65.65 243712
+422.325248 65.65 243712
+422.568960 65.65 243712
+422.812672 65.65 243712
+423.057408 65.38 244736
+423.302144 65.38 244736
+423.546880 65.38 244736
+423.791616 65.38 244736
+424.037376 65.10 245760
+424.283136 65.10 245760
+424.528896 65.10 245760
+424.774656 65.10 245760
+425.022464 64.57 247808
+425.270272 64.57 247808
+425.518080 64.57 247808
+425.765888 64.57 247808
+426.014720 64.30 248832
+426.263552 64.30 248832
+426.512384 64.30 248832
+426.761216 64.30 248832
+427.010048 64.30 248832
+427.258880 64.30 248832
+427.508736 64.04 249856
+427.758592 64.04 249856
+428.008448 64.04 249856
+428.258304 64.04 249856
+428.510208 63.52 251904
+428.762112 63.52 251904
+429.014016 63.52 251904
+429.265920 63.52 251904
+429.518848 63.26 252928
+429.771776 63.26 252928
+430.024704 63.26 252928
+430.277632 63.26 252928
+430.531584 63.00 253952
+430.785536 63.00 253952
+431.039488 63.00 253952
+431.293440 63.00 253952
+431.549440 62.50 256000
+431.805440 62.50 256000
+432.061440 62.50 256000
+432.317440 62.50 256000
+432.573440 62.50 256000
+432.829440 62.50 256000
+433.086464 62.25 257024
+433.343488 62.25 257024
+433.600512 62.25 257024
+433.857536 62.25 257024
+434.115584 62.00 258048
+434.373632 62.00 258048
+434.631680 62.00 258048
+434.889728 62.00 258048
+435.149824 61.52 260096
+435.409920 61.52 260096
+435.670016 61.52 260096
+435.930112 61.52 260096
+436.191232 61.27 261120
+436.452352 61.27 261120
+436.713472 61.27 261120
+436.974592 61.27 261120
+437.236736 61.04 262144
+437.498880 61.04 262144
+437.761024 61.04 262144
+438.023168 61.04 262144
+438.287360 60.56 264192
+438.551552 60.56 264192
+438.815744 60.56 264192
+439.079936 60.56 264192
+439.344128 60.56 264192
+439.608320 60.56 264192
+439.872512 60.56 264192
+440.136704 60.56 264192
+440.402944 60.10 266240
+440.669184 60.10 266240
+440.935424 60.10 266240
+441.201664 60.10 266240
+441.469952 59.64 268288
+441.738240 59.64 268288
+442.006528 59.64 268288
+442.274816 59.64 268288
+442.545152 59.19 270336
+442.815488 59.19 270336
+443.085824 59.19 270336
+443.356160 59.19 270336
+443.626496 59.19 270336
+443.896832 59.19 270336
+444.169216 58.74 272384
+444.441600 58.74 272384
+444.713984 58.74 272384
+444.986368 58.74 272384
+445.260800 58.30 274432
+445.535232 58.30 274432
+445.809664 58.30 274432
+446.084096 58.30 274432
+446.360576 57.87 276480
+446.637056 57.87 276480
+446.913536 57.87 276480
+447.190016 57.87 276480
+447.466496 57.87 276480
+447.742976 57.87 276480
+448.019456 57.87 276480
+448.295936 57.87 276480
+448.574464 57.44 278528
+448.852992 57.44 278528
+449.131520 57.44 278528
+449.410048 57.44 278528
+449.690624 57.03 280576
+449.971200 57.03 280576
+450.251776 57.03 280576
+450.532352 57.03 280576
+450.812928 57.03 280576
+451.093504 57.03 280576
+451.376128 56.61 282624
+451.658752 56.61 282624
+451.941376 56.61 282624
+452.224000 56.61 282624
+452.508672 56.21 284672
+452.793344 56.21 284672
+453.078016 56.21 284672
+453.362688 56.21 284672
+453.649408 55.80 286720
+453.936128 55.80 286720
+454.222848 55.80 286720
+454.509568 55.80 286720
+454.796288 55.80 286720
+455.083008 55.80 286720
+455.371776 55.41 288768
+455.660544 55.41 288768
+455.949312 55.41 288768
+456.238080 55.41 288768
+456.528896 55.02 290816
+456.819712 55.02 290816
+457.112576 54.63 292864
+457.405440 54.63 292864
+457.698304 54.63 292864
+457.991168 54.63 292864
+458.286080 54.25 294912
+458.580992 54.25 294912
+458.875904 54.25 294912
+459.170816 54.25 294912
+459.465728 54.25 294912
+459.760640 54.25 294912
+460.057600 53.88 296960
+460.354560 53.88 296960
+460.651520 53.88 296960
+460.948480 53.88 296960
+461.247488 53.51 299008
+461.546496 53.51 299008
+461.847552 53.15 301056
+462.148608 53.15 301056
+462.449664 53.15 301056
+462.750720 53.15 301056
+463.051776 53.15 301056
+463.352832 53.15 301056
+463.655936 52.79 303104
+463.959040 52.79 303104
+464.262144 52.79 303104
+464.565248 52.79 303104
+464.870400 52.43 305152
+465.175552 52.43 305152
+465.482752 52.08 307200
+465.789952 52.08 307200
+466.097152 52.08 307200
+466.404352 52.08 307200
+466.713600 51.74 309248
+467.022848 51.74 309248
+467.334144 51.40 311296
+467.645440 51.40 311296
+467.956736 51.40 311296
+468.268032 51.40 311296
+468.579328 51.40 311296
+468.890624 51.40 311296
+469.203968 51.06 313344
+469.517312 51.06 313344
+469.832704 50.73 315392
+470.148096 50.73 315392
+470.463488 50.73 315392
+470.778880 50.73 315392
+471.096320 50.40 317440
+471.413760 50.40 317440
+471.731200 50.40 317440
+472.050688 50.08 319488
+472.370176 50.08 319488
+472.691712 49.76 321536
+473.013248 49.76 321536
+473.334784 49.76 321536
+473.656320 49.76 321536
+473.977856 49.76 321536
+474.299392 49.76 321536
+474.622976 49.45 323584
+474.946560 49.45 323584
+475.272192 49.14 325632
+475.597824 49.14 325632
+475.923456 49.14 325632
+476.251136 48.83 327680
+476.578816 48.83 327680
+476.908544 48.52 329728
+477.238272 48.52 329728
+477.568000 48.52 329728
+477.899776 48.23 331776
+478.231552 48.23 331776
+478.563328 48.23 331776
+478.897152 47.93 333824
+479.230976 47.93 333824
+479.564800 47.93 333824
+479.898624 47.93 333824
+480.232448 47.93 333824
+480.568320 47.64 335872
+480.904192 47.64 335872
+481.242112 47.35 337920
+481.580032 47.35 337920
+481.920000 47.06 339968
+482.259968 47.06 339968
+482.599936 47.06 339968
+482.941952 46.78 342016
+483.283968 46.78 342016
+483.628032 46.50 344064
+483.972096 46.50 344064
+484.316160 46.50 344064
+484.662272 46.23 346112
+485.008384 46.23 346112
+485.356544 45.96 348160
+485.704704 45.96 348160
+486.054912 45.69 350208
+486.405120 45.69 350208
+486.757376 45.42 352256
+487.109632 45.42 352256
+487.461888 45.42 352256
+487.816192 45.16 354304
+488.170496 45.16 354304
+488.526848 44.90 356352
+488.883200 44.90 356352
+489.239552 44.90 356352
+489.595904 44.90 356352
+489.954304 44.64 358400
+490.312704 44.64 358400
+490.673152 44.39 360448
+491.033600 44.39 360448
+491.394048 44.39 360448
+491.756544 44.14 362496
+492.119040 44.14 362496
+492.483584 43.89 364544
+492.848128 43.89 364544
+493.214720 43.65 366592
+493.581312 43.65 366592
+493.949952 43.40 368640
+494.318592 43.40 368640
+494.689280 43.16 370688
+495.059968 43.16 370688
+495.432704 42.93 372736
+495.805440 42.93 372736
+496.180224 42.69 374784
+496.555008 42.69 374784
+496.931840 42.46 376832
+497.308672 42.46 376832
+497.687552 42.23 378880
+498.066432 42.23 378880
+498.447360 42.00 380928
+498.828288 42.00 380928
+499.211264 41.78 382976
+499.596288 41.56 385024
+499.981312 41.56 385024
+500.368384 41.34 387072
+500.755456 41.34 387072
+501.144576 41.12 389120
+501.533696 41.12 389120
+501.924864 40.90 391168
+502.316032 40.90 391168
+502.709248 40.69 393216
+503.102464 40.69 393216
+503.497728 40.48 395264
+503.895040 40.27 397312
+504.292352 40.27 397312
+504.693760 39.86 401408
+505.095168 39.86 401408
+505.498624 39.66 403456
+505.902080 39.66 403456
+506.307584 39.46 405504
+506.715136 39.26 407552
+507.122688 39.26 407552
+507.532288 39.06 409600
+507.941888 39.06 409600
+508.353536 38.87 411648
+508.767232 38.68 413696
+509.180928 38.68 413696
+509.596672 38.49 415744
+510.014464 38.30 417792
+510.432256 38.30 417792
+510.852096 38.11 419840
+511.271936 38.11 419840
+511.693824 37.92 421888
+512.119808 37.56 425984
+512.545792 37.56 425984
+512.973824 37.38 428032
+513.403904 37.20 430080
+513.833984 37.20 430080
+514.266112 37.03 432128
+514.700288 36.85 434176
+515.134464 36.85 434176
+515.570688 36.68 436224
+516.008960 36.51 438272
+516.447232 36.51 438272
+516.889600 36.17 442368
+517.334016 36.00 444416
+517.780480 35.84 446464
+518.226944 35.84 446464
+518.675456 35.67 448512
+519.126016 35.51 450560
+519.578624 35.35 452608
+520.031232 35.35 452608
+520.487936 35.03 456704
+520.946688 34.88 458752
+521.407488 34.72 460800
+521.868288 34.72 460800
+522.331136 34.57 462848
+522.798080 34.27 466944
+523.267072 34.12 468992
+523.736064 34.12 468992
+524.207104 33.97 471040
+524.680192 33.82 473088
+525.157376 33.53 477184
+525.636608 33.39 479232
+526.117888 33.24 481280
+526.599168 33.24 481280
+527.082496 33.10 483328
+527.569920 32.83 487424
+528.059392 32.69 489472
+528.550912 32.55 491520
+529.046528 32.28 495616
+529.544192 32.15 497664
+530.041856 32.15 497664
+530.541568 32.02 499712
+531.045376 31.76 503808
+531.551232 31.63 505856
+532.059136 31.50 507904
+532.571136 31.25 512000
+533.085184 31.13 514048
+533.601280 31.00 516096
+534.121472 30.76 520192
+534.643712 30.64 522240
+535.168000 30.52 524288
+535.696384 30.28 528384
+536.224768 30.28 528384
+536.757248 30.05 532480
+537.293824 29.82 536576
+537.834496 29.59 540672
+538.375168 29.59 540672
+538.919936 29.37 544768
+539.468800 29.15 548864
+540.021760 28.94 552960
+540.574720 28.94 552960
+541.131776 28.72 557056
+541.692928 28.51 561152
+542.258176 28.31 565248
+542.827520 28.10 569344
+543.400960 27.90 573440
+543.974400 27.90 573440
+544.551936 27.70 577536
+545.137664 27.32 585728
+545.727488 27.13 589824
+546.317312 27.13 589824
+546.911232 26.94 593920
+547.513344 26.57 602112
+548.115456 26.57 602112
+548.721664 26.39 606208
+549.336064 26.04 614400
+549.954560 25.87 618496
+550.577152 25.70 622592
+551.203840 25.53 626688
+551.834624 25.37 630784
+552.473600 25.04 638976
+553.116672 24.88 643072
+553.763840 24.72 647168
+554.415104 24.57 651264
+555.074560 24.26 659456
+555.738112 24.11 663552
+556.405760 23.96 667648
+557.081600 23.67 675840
+557.761536 23.53 679936
+558.449664 23.25 688128
+559.145984 22.98 696320
+559.850496 22.71 704512
+560.559104 22.58 708608
+561.271808 22.45 712704
+561.992704 22.19 720896
+562.721792 21.95 729088
+563.459072 21.70 737280
+564.204544 21.46 745472
+564.958208 21.23 753664
+565.720064 21.00 761856
+566.490112 20.78 770048
+567.268352 20.56 778240
+568.054784 20.35 786432
+568.857600 19.93 802816
+569.668608 19.73 811008
+570.487808 19.53 819200
+571.319296 19.24 831488
+572.158976 19.05 839680
+573.015040 18.69 856064
+573.883392 18.43 868352
+574.759936 18.25 876544
+575.652864 17.92 892928
+576.558080 17.68 905216
+577.479680 17.36 921600
+578.417664 17.06 937984
+579.376128 16.69 958464
+580.350976 16.41 974848
+581.346304 16.08 995328
+582.358016 15.81 1011712
+583.390208 15.50 1032192
+584.446976 15.14 1056768
+585.528320 14.80 1081344
+586.634240 14.47 1105920
+587.764736 14.15 1130496
+588.919808 13.85 1155072
+590.107648 13.47 1187840
+591.336448 13.02 1228800
+592.598016 12.68 1261568
+593.900544 12.28 1302528
+595.252224 11.84 1351680
+596.661248 11.36 1409024
+598.119424 10.97 1458176
+599.643136 10.50 1523712
+601.248768 9.96 1605632
+602.928128 9.53 1679360
+604.713984 8.96 1785856
+606.630912 8.35 1916928
+608.695296 7.75 2064384
+610.956288 7.08 2260992
+613.479424 6.34 2523136
+616.395776 5.49 2916352
+619.967488 4.48 3571712
+625.013760 3.17 5046272
+632.157184 2.24 7143424
+EOF
+plot $data using 1:2 with linespoints
+pause -1
@@ -0,0 +1,12544 @@
+$data <<EOF
+5.046272 3.17 5046272
+8.617984 4.48 3571712
+11.534336 5.49 2916352
+14.057472 6.34 2523136
+16.318464 7.08 2260992
+18.382848 7.75 2064384
+20.299776 8.35 1916928
+22.085632 8.96 1785856
+23.764992 9.53 1679360
+25.370624 9.96 1605632
+26.894336 10.50 1523712
+28.352512 10.97 1458176
+29.761536 11.36 1409024
+31.113216 11.84 1351680
+32.415744 12.28 1302528
+33.677312 12.68 1261568
+34.906112 13.02 1228800
+36.093952 13.47 1187840
+37.249024 13.85 1155072
+38.379520 14.15 1130496
+39.485440 14.47 1105920
+40.566784 14.80 1081344
+41.623552 15.14 1056768
+42.655744 15.50 1032192
+43.667456 15.81 1011712
+44.662784 16.08 995328
+45.637632 16.41 974848
+46.596096 16.69 958464
+47.534080 17.06 937984
+48.455680 17.36 921600
+49.360896 17.68 905216
+50.253824 17.92 892928
+51.130368 18.25 876544
+51.998720 18.43 868352
+52.854784 18.69 856064
+53.694464 19.05 839680
+54.525952 19.24 831488
+55.345152 19.53 819200
+56.156160 19.73 811008
+56.958976 19.93 802816
+57.745408 20.35 786432
+58.523648 20.56 778240
+59.293696 20.78 770048
+60.055552 21.00 761856
+60.809216 21.23 753664
+61.554688 21.46 745472
+62.291968 21.70 737280
+63.021056 21.95 729088
+63.741952 22.19 720896
+64.454656 22.45 712704
+65.163264 22.58 708608
+65.867776 22.71 704512
+66.564096 22.98 696320
+67.252224 23.25 688128
+67.932160 23.53 679936
+68.608000 23.67 675840
+69.275648 23.96 667648
+69.939200 24.11 663552
+70.598656 24.26 659456
+71.249920 24.57 651264
+71.897088 24.72 647168
+72.540160 24.88 643072
+73.179136 25.04 638976
+73.809920 25.37 630784
+74.436608 25.53 626688
+75.059200 25.70 622592
+75.677696 25.87 618496
+76.292096 26.04 614400
+76.898304 26.39 606208
+77.500416 26.57 602112
+78.102528 26.57 602112
+78.696448 26.94 593920
+79.286272 27.13 589824
+79.876096 27.13 589824
+80.461824 27.32 585728
+81.039360 27.70 577536
+81.612800 27.90 573440
+82.186240 27.90 573440
+82.755584 28.10 569344
+83.320832 28.31 565248
+83.881984 28.51 561152
+84.439040 28.72 557056
+84.992000 28.94 552960
+85.544960 28.94 552960
+86.093824 29.15 548864
+86.638592 29.37 544768
+87.179264 29.59 540672
+87.719936 29.59 540672
+88.256512 29.82 536576
+88.788992 30.05 532480
+89.317376 30.28 528384
+89.845760 30.28 528384
+90.370048 30.52 524288
+90.892288 30.64 522240
+91.412480 30.76 520192
+91.928576 31.00 516096
+92.442624 31.13 514048
+92.954624 31.25 512000
+93.462528 31.50 507904
+93.968384 31.63 505856
+94.472192 31.76 503808
+94.971904 32.02 499712
+95.469568 32.15 497664
+95.967232 32.15 497664
+96.462848 32.28 495616
+96.954368 32.55 491520
+97.443840 32.69 489472
+97.931264 32.83 487424
+98.414592 33.10 483328
+98.895872 33.24 481280
+99.377152 33.24 481280
+99.856384 33.39 479232
+100.333568 33.53 477184
+100.806656 33.82 473088
+101.277696 33.97 471040
+101.746688 34.12 468992
+102.215680 34.12 468992
+102.682624 34.27 466944
+103.145472 34.57 462848
+103.606272 34.72 460800
+104.067072 34.72 460800
+104.525824 34.88 458752
+104.982528 35.03 456704
+105.435136 35.35 452608
+105.887744 35.35 452608
+106.338304 35.51 450560
+106.786816 35.67 448512
+107.233280 35.84 446464
+107.679744 35.84 446464
+108.124160 36.00 444416
+108.566528 36.17 442368
+109.004800 36.51 438272
+109.443072 36.51 438272
+109.879296 36.68 436224
+110.313472 36.85 434176
+110.747648 36.85 434176
+111.179776 37.03 432128
+111.609856 37.20 430080
+112.039936 37.20 430080
+112.467968 37.38 428032
+112.893952 37.56 425984
+113.319936 37.56 425984
+113.741824 37.92 421888
+114.161664 38.11 419840
+114.581504 38.11 419840
+114.999296 38.30 417792
+115.417088 38.30 417792
+115.832832 38.49 415744
+116.246528 38.68 413696
+116.660224 38.68 413696
+117.071872 38.87 411648
+117.481472 39.06 409600
+117.891072 39.06 409600
+118.298624 39.26 407552
+118.706176 39.26 407552
+119.111680 39.46 405504
+119.515136 39.66 403456
+119.918592 39.66 403456
+120.320000 39.86 401408
+120.721408 39.86 401408
+121.118720 40.27 397312
+121.516032 40.27 397312
+121.911296 40.48 395264
+122.304512 40.69 393216
+122.697728 40.69 393216
+123.088896 40.90 391168
+123.480064 40.90 391168
+123.869184 41.12 389120
+124.258304 41.12 389120
+124.645376 41.34 387072
+125.032448 41.34 387072
+125.417472 41.56 385024
+125.802496 41.56 385024
+126.185472 41.78 382976
+126.566400 42.00 380928
+126.947328 42.00 380928
+127.326208 42.23 378880
+127.705088 42.23 378880
+128.081920 42.46 376832
+128.458752 42.46 376832
+128.833536 42.69 374784
+129.208320 42.69 374784
+129.581056 42.93 372736
+129.953792 42.93 372736
+130.324480 43.16 370688
+130.695168 43.16 370688
+131.063808 43.40 368640
+131.432448 43.40 368640
+131.799040 43.65 366592
+132.165632 43.65 366592
+132.530176 43.89 364544
+132.894720 43.89 364544
+133.257216 44.14 362496
+133.619712 44.14 362496
+133.980160 44.39 360448
+134.340608 44.39 360448
+134.701056 44.39 360448
+135.059456 44.64 358400
+135.417856 44.64 358400
+135.774208 44.90 356352
+136.130560 44.90 356352
+136.486912 44.90 356352
+136.843264 44.90 356352
+137.197568 45.16 354304
+137.551872 45.16 354304
+137.904128 45.42 352256
+138.256384 45.42 352256
+138.608640 45.42 352256
+138.958848 45.69 350208
+139.309056 45.69 350208
+139.657216 45.96 348160
+140.005376 45.96 348160
+140.351488 46.23 346112
+140.697600 46.23 346112
+141.041664 46.50 344064
+141.385728 46.50 344064
+141.729792 46.50 344064
+142.071808 46.78 342016
+142.413824 46.78 342016
+142.753792 47.06 339968
+143.093760 47.06 339968
+143.433728 47.06 339968
+143.771648 47.35 337920
+144.109568 47.35 337920
+144.445440 47.64 335872
+144.781312 47.64 335872
+145.115136 47.93 333824
+145.448960 47.93 333824
+145.782784 47.93 333824
+146.116608 47.93 333824
+146.450432 47.93 333824
+146.782208 48.23 331776
+147.113984 48.23 331776
+147.445760 48.23 331776
+147.775488 48.52 329728
+148.105216 48.52 329728
+148.434944 48.52 329728
+148.762624 48.83 327680
+149.090304 48.83 327680
+149.415936 49.14 325632
+149.741568 49.14 325632
+150.067200 49.14 325632
+150.390784 49.45 323584
+150.714368 49.45 323584
+151.035904 49.76 321536
+151.357440 49.76 321536
+151.678976 49.76 321536
+152.000512 49.76 321536
+152.322048 49.76 321536
+152.643584 49.76 321536
+152.963072 50.08 319488
+153.282560 50.08 319488
+153.600000 50.40 317440
+153.917440 50.40 317440
+154.234880 50.40 317440
+154.550272 50.73 315392
+154.865664 50.73 315392
+155.181056 50.73 315392
+155.496448 50.73 315392
+155.809792 51.06 313344
+156.123136 51.06 313344
+156.434432 51.40 311296
+156.745728 51.40 311296
+157.057024 51.40 311296
+157.368320 51.40 311296
+157.679616 51.40 311296
+157.990912 51.40 311296
+158.300160 51.74 309248
+158.609408 51.74 309248
+158.916608 52.08 307200
+159.223808 52.08 307200
+159.531008 52.08 307200
+159.838208 52.08 307200
+160.143360 52.43 305152
+160.448512 52.43 305152
+160.751616 52.79 303104
+161.054720 52.79 303104
+161.357824 52.79 303104
+161.660928 52.79 303104
+161.961984 53.15 301056
+162.263040 53.15 301056
+162.564096 53.15 301056
+162.865152 53.15 301056
+163.166208 53.15 301056
+163.467264 53.15 301056
+163.766272 53.51 299008
+164.065280 53.51 299008
+164.362240 53.88 296960
+164.659200 53.88 296960
+164.956160 53.88 296960
+165.253120 53.88 296960
+165.548032 54.25 294912
+165.842944 54.25 294912
+166.137856 54.25 294912
+166.432768 54.25 294912
+166.727680 54.25 294912
+167.022592 54.25 294912
+167.315456 54.63 292864
+167.608320 54.63 292864
+167.901184 54.63 292864
+168.194048 54.63 292864
+168.484864 55.02 290816
+168.775680 55.02 290816
+169.064448 55.41 288768
+169.353216 55.41 288768
+169.641984 55.41 288768
+169.930752 55.41 288768
+170.217472 55.80 286720
+170.504192 55.80 286720
+170.790912 55.80 286720
+171.077632 55.80 286720
+171.364352 55.80 286720
+171.651072 55.80 286720
+171.935744 56.21 284672
+172.220416 56.21 284672
+172.505088 56.21 284672
+172.789760 56.21 284672
+173.072384 56.61 282624
+173.355008 56.61 282624
+173.637632 56.61 282624
+173.920256 56.61 282624
+174.200832 57.03 280576
+174.481408 57.03 280576
+174.761984 57.03 280576
+175.042560 57.03 280576
+175.323136 57.03 280576
+175.603712 57.03 280576
+175.882240 57.44 278528
+176.160768 57.44 278528
+176.439296 57.44 278528
+176.717824 57.44 278528
+176.994304 57.87 276480
+177.270784 57.87 276480
+177.547264 57.87 276480
+177.823744 57.87 276480
+178.100224 57.87 276480
+178.376704 57.87 276480
+178.653184 57.87 276480
+178.929664 57.87 276480
+179.204096 58.30 274432
+179.478528 58.30 274432
+179.752960 58.30 274432
+180.027392 58.30 274432
+180.299776 58.74 272384
+180.572160 58.74 272384
+180.844544 58.74 272384
+181.116928 58.74 272384
+181.387264 59.19 270336
+181.657600 59.19 270336
+181.927936 59.19 270336
+182.198272 59.19 270336
+182.468608 59.19 270336
+182.738944 59.19 270336
+183.007232 59.64 268288
+183.275520 59.64 268288
+183.543808 59.64 268288
+183.812096 59.64 268288
+184.078336 60.10 266240
+184.344576 60.10 266240
+184.610816 60.10 266240
+184.877056 60.10 266240
+185.141248 60.56 264192
+185.405440 60.56 264192
+185.669632 60.56 264192
+185.933824 60.56 264192
+186.198016 60.56 264192
+186.462208 60.56 264192
+186.726400 60.56 264192
+186.990592 60.56 264192
+187.252736 61.04 262144
+187.514880 61.04 262144
+187.777024 61.04 262144
+188.039168 61.04 262144
+188.300288 61.27 261120
+188.561408 61.27 261120
+188.822528 61.27 261120
+189.083648 61.27 261120
+189.343744 61.52 260096
+189.603840 61.52 260096
+189.863936 61.52 260096
+190.124032 61.52 260096
+190.382080 62.00 258048
+190.640128 62.00 258048
+190.898176 62.00 258048
+191.156224 62.00 258048
+191.413248 62.25 257024
+191.670272 62.25 257024
+191.927296 62.25 257024
+192.184320 62.25 257024
+192.440320 62.50 256000
+192.696320 62.50 256000
+192.952320 62.50 256000
+193.208320 62.50 256000
+193.464320 62.50 256000
+193.720320 62.50 256000
+193.974272 63.00 253952
+194.228224 63.00 253952
+194.482176 63.00 253952
+194.736128 63.00 253952
+194.989056 63.26 252928
+195.241984 63.26 252928
+195.494912 63.26 252928
+195.747840 63.26 252928
+195.999744 63.52 251904
+196.251648 63.52 251904
+196.503552 63.52 251904
+196.755456 63.52 251904
+197.005312 64.04 249856
+197.255168 64.04 249856
+197.505024 64.04 249856
+197.754880 64.04 249856
+198.003712 64.30 248832
+198.252544 64.30 248832
+198.501376 64.30 248832
+198.750208 64.30 248832
+198.999040 64.30 248832
+199.247872 64.30 248832
+199.495680 64.57 247808
+199.743488 64.57 247808
+199.991296 64.57 247808
+200.239104 64.57 247808
+200.484864 65.10 245760
+200.730624 65.10 245760
+200.976384 65.10 245760
+201.222144 65.10 245760
+201.466880 65.38 244736
+201.711616 65.38 244736
+201.956352 65.38 244736
+202.201088 65.38 244736
+202.444800 65.65 243712
+202.688512 65.65 243712
+202.932224 65.65 243712
+203.175936 65.65 243712
+203.419648 65.65 243712
+203.663360 65.65 243712
+203.905024 66.21 241664
+204.146688 66.21 241664
+204.388352 66.21 241664
+204.630016 66.21 241664
+204.870656 66.49 240640
+205.111296 66.49 240640
+205.351936 66.49 240640
+205.592576 66.49 240640
+205.833216 66.49 240640
+206.073856 66.49 240640
+206.313472 66.77 239616
+206.553088 66.77 239616
+206.792704 66.77 239616
+207.032320 66.77 239616
+207.270912 67.06 238592
+207.509504 67.06 238592
+207.748096 67.06 238592
+207.986688 67.06 238592
+208.223232 67.64 236544
+208.459776 67.64 236544
+208.696320 67.64 236544
+208.932864 67.64 236544
+209.169408 67.64 236544
+209.405952 67.64 236544
+209.641472 67.93 235520
+209.876992 67.93 235520
+210.112512 67.93 235520
+210.348032 67.93 235520
+210.582528 68.23 234496
+210.817024 68.23 234496
+211.051520 68.23 234496
+211.286016 68.23 234496
+211.520512 68.23 234496
+211.755008 68.23 234496
+211.988480 68.53 233472
+212.221952 68.53 233472
+212.455424 68.53 233472
+212.688896 68.53 233472
+212.922368 68.53 233472
+213.155840 68.53 233472
+213.387264 69.14 231424
+213.618688 69.14 231424
+213.850112 69.14 231424
+214.081536 69.14 231424
+214.311936 69.44 230400
+214.542336 69.44 230400
+214.772736 69.44 230400
+215.003136 69.44 230400
+215.233536 69.44 230400
+215.463936 69.44 230400
+215.693312 69.75 229376
+215.922688 69.75 229376
+216.152064 69.75 229376
+216.381440 69.75 229376
+216.609792 70.07 228352
+216.838144 70.07 228352
+217.066496 70.07 228352
+217.294848 70.07 228352
+217.523200 70.07 228352
+217.751552 70.07 228352
+217.977856 70.70 226304
+218.204160 70.70 226304
+218.430464 70.70 226304
+218.656768 70.70 226304
+218.883072 70.70 226304
+219.109376 70.70 226304
+219.334656 71.02 225280
+219.559936 71.02 225280
+219.785216 71.02 225280
+220.010496 71.02 225280
+220.234752 71.35 224256
+220.459008 71.35 224256
+220.683264 71.35 224256
+220.907520 71.35 224256
+221.131776 71.35 224256
+221.356032 71.35 224256
+221.579264 71.67 223232
+221.802496 71.67 223232
+222.025728 71.67 223232
+222.248960 71.67 223232
+222.472192 71.67 223232
+222.695424 71.67 223232
+222.918656 71.67 223232
+223.141888 71.67 223232
+223.364096 72.00 222208
+223.586304 72.00 222208
+223.808512 72.00 222208
+224.030720 72.00 222208
+224.251904 72.34 221184
+224.473088 72.34 221184
+224.694272 72.34 221184
+224.915456 72.34 221184
+225.134592 73.01 219136
+225.353728 73.01 219136
+225.572864 73.01 219136
+225.792000 73.01 219136
+226.011136 73.01 219136
+226.230272 73.01 219136
+226.449408 73.01 219136
+226.668544 73.01 219136
+226.886656 73.36 218112
+227.104768 73.36 218112
+227.322880 73.36 218112
+227.540992 73.36 218112
+227.758080 73.70 217088
+227.975168 73.70 217088
+228.192256 73.70 217088
+228.409344 73.70 217088
+228.626432 73.70 217088
+228.843520 73.70 217088
+229.060608 73.70 217088
+229.277696 73.70 217088
+229.493760 74.05 216064
+229.709824 74.05 216064
+229.925888 74.05 216064
+230.141952 74.05 216064
+230.356992 74.40 215040
+230.572032 74.40 215040
+230.787072 74.40 215040
+231.002112 74.40 215040
+231.217152 74.40 215040
+231.432192 74.40 215040
+231.647232 74.40 215040
+231.862272 74.40 215040
+232.076288 74.76 214016
+232.290304 74.76 214016
+232.504320 74.76 214016
+232.718336 74.76 214016
+232.931328 75.12 212992
+233.144320 75.12 212992
+233.357312 75.12 212992
+233.570304 75.12 212992
+233.783296 75.12 212992
+233.996288 75.12 212992
+234.209280 75.12 212992
+234.422272 75.12 212992
+234.633216 75.85 210944
+234.844160 75.85 210944
+235.055104 75.85 210944
+235.266048 75.85 210944
+235.475968 76.22 209920
+235.685888 76.22 209920
+235.895808 76.22 209920
+236.105728 76.22 209920
+236.315648 76.22 209920
+236.525568 76.22 209920
+236.735488 76.22 209920
+236.945408 76.22 209920
+237.154304 76.59 208896
+237.363200 76.59 208896
+237.572096 76.59 208896
+237.780992 76.59 208896
+237.989888 76.59 208896
+238.198784 76.59 208896
+238.407680 76.59 208896
+238.616576 76.59 208896
+238.824448 76.97 207872
+239.032320 76.97 207872
+239.240192 76.97 207872
+239.448064 76.97 207872
+239.654912 77.35 206848
+239.861760 77.35 206848
+240.068608 77.35 206848
+240.275456 77.35 206848
+240.482304 77.35 206848
+240.689152 77.35 206848
+240.896000 77.35 206848
+241.102848 77.35 206848
+241.308672 77.74 205824
+241.514496 77.74 205824
+241.720320 77.74 205824
+241.926144 77.74 205824
+242.130944 78.12 204800
+242.335744 78.12 204800
+242.540544 78.12 204800
+242.745344 78.12 204800
+242.950144 78.12 204800
+243.154944 78.12 204800
+243.359744 78.12 204800
+243.564544 78.12 204800
+243.768320 78.52 203776
+243.972096 78.52 203776
+244.175872 78.52 203776
+244.379648 78.52 203776
+244.583424 78.52 203776
+244.787200 78.52 203776
+244.990976 78.52 203776
+245.194752 78.52 203776
+245.397504 78.91 202752
+245.600256 78.91 202752
+245.803008 78.91 202752
+246.005760 78.91 202752
+246.207488 79.31 201728
+246.409216 79.31 201728
+246.610944 79.31 201728
+246.812672 79.31 201728
+247.014400 79.31 201728
+247.216128 79.31 201728
+247.417856 79.31 201728
+247.619584 79.31 201728
+247.820288 79.72 200704
+248.020992 79.72 200704
+248.221696 79.72 200704
+248.422400 79.72 200704
+248.623104 79.72 200704
+248.823808 79.72 200704
+249.024512 79.72 200704
+249.225216 79.72 200704
+249.423872 80.54 198656
+249.622528 80.54 198656
+249.821184 80.54 198656
+250.019840 80.54 198656
+250.218496 80.54 198656
+250.417152 80.54 198656
+250.615808 80.54 198656
+250.814464 80.54 198656
+251.012096 80.96 197632
+251.209728 80.96 197632
+251.407360 80.96 197632
+251.604992 80.96 197632
+251.801600 81.38 196608
+251.998208 81.38 196608
+252.194816 81.38 196608
+252.391424 81.38 196608
+252.588032 81.38 196608
+252.784640 81.38 196608
+252.981248 81.38 196608
+253.177856 81.38 196608
+253.373440 81.81 195584
+253.569024 81.81 195584
+253.764608 81.81 195584
+253.960192 81.81 195584
+254.155776 81.81 195584
+254.351360 81.81 195584
+254.546944 81.81 195584
+254.742528 81.81 195584
+254.937088 82.24 194560
+255.131648 82.24 194560
+255.326208 82.24 194560
+255.520768 82.24 194560
+255.715328 82.24 194560
+255.909888 82.24 194560
+256.104448 82.24 194560
+256.299008 82.24 194560
+256.492544 82.67 193536
+256.686080 82.67 193536
+256.879616 82.67 193536
+257.073152 82.67 193536
+257.266688 82.67 193536
+257.460224 82.67 193536
+257.653760 82.67 193536
+257.847296 82.67 193536
+258.039808 83.11 192512
+258.232320 83.11 192512
+258.424832 83.11 192512
+258.617344 83.11 192512
+258.809856 83.11 192512
+259.002368 83.11 192512
+259.194880 83.11 192512
+259.387392 83.11 192512
+259.578880 83.56 191488
+259.770368 83.56 191488
+259.961856 83.56 191488
+260.153344 83.56 191488
+260.343808 84.01 190464
+260.534272 84.01 190464
+260.724736 84.01 190464
+260.915200 84.01 190464
+261.105664 84.01 190464
+261.296128 84.01 190464
+261.486592 84.01 190464
+261.677056 84.01 190464
+261.866496 84.46 189440
+262.055936 84.46 189440
+262.245376 84.46 189440
+262.434816 84.46 189440
+262.624256 84.46 189440
+262.813696 84.46 189440
+263.003136 84.46 189440
+263.192576 84.46 189440
+263.380992 84.92 188416
+263.569408 84.92 188416
+263.757824 84.92 188416
+263.946240 84.92 188416
+264.134656 84.92 188416
+264.323072 84.92 188416
+264.511488 84.92 188416
+264.699904 84.92 188416
+264.887296 85.38 187392
+265.074688 85.38 187392
+265.262080 85.38 187392
+265.449472 85.38 187392
+265.636864 85.38 187392
+265.824256 85.38 187392
+266.011648 85.38 187392
+266.199040 85.38 187392
+266.385408 85.85 186368
+266.571776 85.85 186368
+266.758144 85.85 186368
+266.944512 85.85 186368
+267.130880 85.85 186368
+267.317248 85.85 186368
+267.503616 85.85 186368
+267.689984 85.85 186368
+267.875328 86.33 185344
+268.060672 86.33 185344
+268.246016 86.33 185344
+268.431360 86.33 185344
+268.616704 86.33 185344
+268.802048 86.33 185344
+268.987392 86.33 185344
+269.172736 86.33 185344
+269.357056 86.81 184320
+269.541376 86.81 184320
+269.725696 86.81 184320
+269.910016 86.81 184320
+270.094336 86.81 184320
+270.278656 86.81 184320
+270.462976 86.81 184320
+270.647296 86.81 184320
+270.830592 87.29 183296
+271.013888 87.29 183296
+271.197184 87.29 183296
+271.380480 87.29 183296
+271.563776 87.29 183296
+271.747072 87.29 183296
+271.930368 87.29 183296
+272.113664 87.29 183296
+272.295936 87.78 182272
+272.478208 87.78 182272
+272.660480 87.78 182272
+272.842752 87.78 182272
+273.025024 87.78 182272
+273.207296 87.78 182272
+273.389568 87.78 182272
+273.571840 87.78 182272
+273.753088 88.28 181248
+273.934336 88.28 181248
+274.115584 88.28 181248
+274.296832 88.28 181248
+274.478080 88.28 181248
+274.659328 88.28 181248
+274.840576 88.28 181248
+275.021824 88.28 181248
+275.202048 88.78 180224
+275.382272 88.78 180224
+275.562496 88.78 180224
+275.742720 88.78 180224
+275.922944 88.78 180224
+276.103168 88.78 180224
+276.283392 88.78 180224
+276.463616 88.78 180224
+276.643840 88.78 180224
+276.824064 88.78 180224
+277.004288 88.78 180224
+277.184512 88.78 180224
+277.363712 89.29 179200
+277.542912 89.29 179200
+277.722112 89.29 179200
+277.901312 89.29 179200
+278.080512 89.29 179200
+278.259712 89.29 179200
+278.438912 89.29 179200
+278.618112 89.29 179200
+278.796288 89.80 178176
+278.974464 89.80 178176
+279.152640 89.80 178176
+279.330816 89.80 178176
+279.508992 89.80 178176
+279.687168 89.80 178176
+279.865344 89.80 178176
+280.043520 89.80 178176
+280.221696 89.80 178176
+280.399872 89.80 178176
+280.578048 89.80 178176
+280.756224 89.80 178176
+280.934400 89.80 178176
+281.112576 89.80 178176
+281.290752 89.80 178176
+281.468928 89.80 178176
+281.646080 90.32 177152
+281.823232 90.32 177152
+282.000384 90.32 177152
+282.177536 90.32 177152
+282.354688 90.32 177152
+282.531840 90.32 177152
+282.708992 90.32 177152
+282.886144 90.32 177152
+283.062272 90.84 176128
+283.238400 90.84 176128
+283.414528 90.84 176128
+283.590656 90.84 176128
+283.766784 90.84 176128
+283.942912 90.84 176128
+284.119040 90.84 176128
+284.295168 90.84 176128
+284.471296 90.84 176128
+284.647424 90.84 176128
+284.823552 90.84 176128
+284.999680 90.84 176128
+285.174784 91.37 175104
+285.349888 91.37 175104
+285.524992 91.37 175104
+285.700096 91.37 175104
+285.875200 91.37 175104
+286.050304 91.37 175104
+286.225408 91.37 175104
+286.400512 91.37 175104
+286.574592 91.91 174080
+286.748672 91.91 174080
+286.922752 91.91 174080
+287.096832 91.91 174080
+287.270912 91.91 174080
+287.444992 91.91 174080
+287.619072 91.91 174080
+287.793152 91.91 174080
+287.966208 92.46 173056
+288.139264 92.46 173056
+288.312320 92.46 173056
+288.485376 92.46 173056
+288.658432 92.46 173056
+288.831488 92.46 173056
+289.004544 92.46 173056
+289.177600 92.46 173056
+289.349632 93.01 172032
+289.521664 93.01 172032
+289.693696 93.01 172032
+289.865728 93.01 172032
+290.037760 93.01 172032
+290.209792 93.01 172032
+290.381824 93.01 172032
+290.553856 93.01 172032
+290.725888 93.01 172032
+290.897920 93.01 172032
+291.069952 93.01 172032
+291.241984 93.01 172032
+291.412992 93.56 171008
+291.584000 93.56 171008
+291.755008 93.56 171008
+291.926016 93.56 171008
+292.097024 93.56 171008
+292.268032 93.56 171008
+292.439040 93.56 171008
+292.610048 93.56 171008
+292.780032 94.13 169984
+292.950016 94.13 169984
+293.120000 94.13 169984
+293.289984 94.13 169984
+293.459968 94.13 169984
+293.629952 94.13 169984
+293.799936 94.13 169984
+293.969920 94.13 169984
+294.139904 94.13 169984
+294.309888 94.13 169984
+294.479872 94.13 169984
+294.649856 94.13 169984
+294.818816 94.70 168960
+294.987776 94.70 168960
+295.156736 94.70 168960
+295.325696 94.70 168960
+295.494656 94.70 168960
+295.663616 94.70 168960
+295.832576 94.70 168960
+296.001536 94.70 168960
+296.169472 95.27 167936
+296.337408 95.27 167936
+296.505344 95.27 167936
+296.673280 95.27 167936
+296.841216 95.27 167936
+297.009152 95.27 167936
+297.177088 95.27 167936
+297.345024 95.27 167936
+297.511936 95.86 166912
+297.678848 95.86 166912
+297.845760 95.86 166912
+298.012672 95.86 166912
+298.179584 95.86 166912
+298.346496 95.86 166912
+298.513408 95.86 166912
+298.680320 95.86 166912
+298.847232 95.86 166912
+299.014144 95.86 166912
+299.181056 95.86 166912
+299.347968 95.86 166912
+299.514880 95.86 166912
+299.681792 95.86 166912
+299.848704 95.86 166912
+300.015616 95.86 166912
+300.182528 95.86 166912
+300.349440 95.86 166912
+300.516352 95.86 166912
+300.683264 95.86 166912
+300.849152 96.45 165888
+301.015040 96.45 165888
+301.180928 96.45 165888
+301.346816 96.45 165888
+301.512704 96.45 165888
+301.678592 96.45 165888
+301.844480 96.45 165888
+302.010368 96.45 165888
+302.176256 96.45 165888
+302.342144 96.45 165888
+302.508032 96.45 165888
+302.673920 96.45 165888
+302.838784 97.05 164864
+303.003648 97.05 164864
+303.168512 97.05 164864
+303.333376 97.05 164864
+303.498240 97.05 164864
+303.663104 97.05 164864
+303.827968 97.05 164864
+303.992832 97.05 164864
+304.157696 97.05 164864
+304.322560 97.05 164864
+304.487424 97.05 164864
+304.652288 97.05 164864
+304.816128 97.66 163840
+304.979968 97.66 163840
+305.143808 97.66 163840
+305.307648 97.66 163840
+305.471488 97.66 163840
+305.635328 97.66 163840
+305.799168 97.66 163840
+305.963008 97.66 163840
+306.125824 98.27 162816
+306.288640 98.27 162816
+306.451456 98.27 162816
+306.614272 98.27 162816
+306.777088 98.27 162816
+306.939904 98.27 162816
+307.102720 98.27 162816
+307.265536 98.27 162816
+307.428352 98.27 162816
+307.591168 98.27 162816
+307.753984 98.27 162816
+307.916800 98.27 162816
+308.078592 98.89 161792
+308.240384 98.89 161792
+308.402176 98.89 161792
+308.563968 98.89 161792
+308.725760 98.89 161792
+308.887552 98.89 161792
+309.049344 98.89 161792
+309.211136 98.89 161792
+309.371904 99.52 160768
+309.532672 99.52 160768
+309.693440 99.52 160768
+309.854208 99.52 160768
+310.014976 99.52 160768
+310.175744 99.52 160768
+310.336512 99.52 160768
+310.497280 99.52 160768
+310.658048 99.52 160768
+310.818816 99.52 160768
+310.979584 99.52 160768
+311.140352 99.52 160768
+311.301120 99.52 160768
+311.461888 99.52 160768
+311.622656 99.52 160768
+311.783424 99.52 160768
+311.944192 99.52 160768
+312.104960 99.52 160768
+312.265728 99.52 160768
+312.426496 99.52 160768
+312.587264 99.52 160768
+312.748032 99.52 160768
+312.908800 99.52 160768
+313.069568 99.52 160768
+313.229312 100.16 159744
+313.389056 100.16 159744
+313.548800 100.16 159744
+313.708544 100.16 159744
+313.868288 100.16 159744
+314.028032 100.16 159744
+314.187776 100.16 159744
+314.347520 100.16 159744
+314.506240 100.81 158720
+314.664960 100.81 158720
+314.823680 100.81 158720
+314.982400 100.81 158720
+315.141120 100.81 158720
+315.299840 100.81 158720
+315.458560 100.81 158720
+315.617280 100.81 158720
+315.776000 100.81 158720
+315.934720 100.81 158720
+316.093440 100.81 158720
+316.252160 100.81 158720
+316.409856 101.46 157696
+316.567552 101.46 157696
+316.725248 101.46 157696
+316.882944 101.46 157696
+317.040640 101.46 157696
+317.198336 101.46 157696
+317.356032 101.46 157696
+317.513728 101.46 157696
+317.671424 101.46 157696
+317.829120 101.46 157696
+317.986816 101.46 157696
+318.144512 101.46 157696
+318.302208 101.46 157696
+318.459904 101.46 157696
+318.617600 101.46 157696
+318.775296 101.46 157696
+318.931968 102.12 156672
+319.088640 102.12 156672
+319.245312 102.12 156672
+319.401984 102.12 156672
+319.558656 102.12 156672
+319.715328 102.12 156672
+319.872000 102.12 156672
+320.028672 102.12 156672
+320.184320 102.80 155648
+320.339968 102.80 155648
+320.495616 102.80 155648
+320.651264 102.80 155648
+320.806912 102.80 155648
+320.962560 102.80 155648
+321.118208 102.80 155648
+321.273856 102.80 155648
+321.429504 102.80 155648
+321.585152 102.80 155648
+321.740800 102.80 155648
+321.896448 102.80 155648
+322.052096 102.80 155648
+322.207744 102.80 155648
+322.363392 102.80 155648
+322.519040 102.80 155648
+322.674688 102.80 155648
+322.830336 102.80 155648
+322.985984 102.80 155648
+323.141632 102.80 155648
+323.297280 102.80 155648
+323.452928 102.80 155648
+323.608576 102.80 155648
+323.764224 102.80 155648
+323.918848 103.48 154624
+324.073472 103.48 154624
+324.228096 103.48 154624
+324.382720 103.48 154624
+324.537344 103.48 154624
+324.691968 103.48 154624
+324.846592 103.48 154624
+325.001216 103.48 154624
+325.154816 104.17 153600
+325.308416 104.17 153600
+325.462016 104.17 153600
+325.615616 104.17 153600
+325.769216 104.17 153600
+325.922816 104.17 153600
+326.076416 104.17 153600
+326.230016 104.17 153600
+326.383616 104.17 153600
+326.537216 104.17 153600
+326.690816 104.17 153600
+326.844416 104.17 153600
+326.998016 104.17 153600
+327.151616 104.17 153600
+327.305216 104.17 153600
+327.458816 104.17 153600
+327.611392 104.87 152576
+327.763968 104.87 152576
+327.916544 104.87 152576
+328.069120 104.87 152576
+328.221696 104.87 152576
+328.374272 104.87 152576
+328.526848 104.87 152576
+328.679424 104.87 152576
+328.830976 105.57 151552
+328.982528 105.57 151552
+329.134080 105.57 151552
+329.285632 105.57 151552
+329.437184 105.57 151552
+329.588736 105.57 151552
+329.740288 105.57 151552
+329.891840 105.57 151552
+330.043392 105.57 151552
+330.194944 105.57 151552
+330.346496 105.57 151552
+330.498048 105.57 151552
+330.649600 105.57 151552
+330.801152 105.57 151552
+330.952704 105.57 151552
+331.104256 105.57 151552
+331.254784 106.29 150528
+331.405312 106.29 150528
+331.555840 106.29 150528
+331.706368 106.29 150528
+331.856896 106.29 150528
+332.007424 106.29 150528
+332.157952 106.29 150528
+332.308480 106.29 150528
+332.459008 106.29 150528
+332.609536 106.29 150528
+332.760064 106.29 150528
+332.910592 106.29 150528
+333.061120 106.29 150528
+333.211648 106.29 150528
+333.362176 106.29 150528
+333.512704 106.29 150528
+333.663232 106.29 150528
+333.813760 106.29 150528
+333.964288 106.29 150528
+334.114816 106.29 150528
+334.265344 106.29 150528
+334.415872 106.29 150528
+334.566400 106.29 150528
+334.716928 106.29 150528
+334.866432 107.02 149504
+335.015936 107.02 149504
+335.165440 107.02 149504
+335.314944 107.02 149504
+335.464448 107.02 149504
+335.613952 107.02 149504
+335.763456 107.02 149504
+335.912960 107.02 149504
+336.061440 107.76 148480
+336.209920 107.76 148480
+336.358400 107.76 148480
+336.506880 107.76 148480
+336.655360 107.76 148480
+336.803840 107.76 148480
+336.952320 107.76 148480
+337.100800 107.76 148480
+337.249280 107.76 148480
+337.397760 107.76 148480
+337.546240 107.76 148480
+337.694720 107.76 148480
+337.843200 107.76 148480
+337.991680 107.76 148480
+338.140160 107.76 148480
+338.288640 107.76 148480
+338.436096 108.51 147456
+338.583552 108.51 147456
+338.731008 108.51 147456
+338.878464 108.51 147456
+339.025920 108.51 147456
+339.173376 108.51 147456
+339.320832 108.51 147456
+339.468288 108.51 147456
+339.615744 108.51 147456
+339.763200 108.51 147456
+339.910656 108.51 147456
+340.058112 108.51 147456
+340.205568 108.51 147456
+340.353024 108.51 147456
+340.500480 108.51 147456
+340.647936 108.51 147456
+340.795392 108.51 147456
+340.942848 108.51 147456
+341.090304 108.51 147456
+341.237760 108.51 147456
+341.385216 108.51 147456
+341.532672 108.51 147456
+341.680128 108.51 147456
+341.827584 108.51 147456
+341.974016 109.27 146432
+342.120448 109.27 146432
+342.266880 109.27 146432
+342.413312 109.27 146432
+342.559744 109.27 146432
+342.706176 109.27 146432
+342.852608 109.27 146432
+342.999040 109.27 146432
+343.145472 109.27 146432
+343.291904 109.27 146432
+343.438336 109.27 146432
+343.584768 109.27 146432
+343.731200 109.27 146432
+343.877632 109.27 146432
+344.024064 109.27 146432
+344.170496 109.27 146432
+344.315904 110.04 145408
+344.461312 110.04 145408
+344.606720 110.04 145408
+344.752128 110.04 145408
+344.897536 110.04 145408
+345.042944 110.04 145408
+345.188352 110.04 145408
+345.333760 110.04 145408
+345.478144 110.82 144384
+345.622528 110.82 144384
+345.766912 110.82 144384
+345.911296 110.82 144384
+346.055680 110.82 144384
+346.200064 110.82 144384
+346.344448 110.82 144384
+346.488832 110.82 144384
+346.633216 110.82 144384
+346.777600 110.82 144384
+346.921984 110.82 144384
+347.066368 110.82 144384
+347.210752 110.82 144384
+347.355136 110.82 144384
+347.499520 110.82 144384
+347.643904 110.82 144384
+347.787264 111.61 143360
+347.930624 111.61 143360
+348.073984 111.61 143360
+348.217344 111.61 143360
+348.360704 111.61 143360
+348.504064 111.61 143360
+348.647424 111.61 143360
+348.790784 111.61 143360
+348.934144 111.61 143360
+349.077504 111.61 143360
+349.220864 111.61 143360
+349.364224 111.61 143360
+349.507584 111.61 143360
+349.650944 111.61 143360
+349.794304 111.61 143360
+349.937664 111.61 143360
+350.081024 111.61 143360
+350.224384 111.61 143360
+350.367744 111.61 143360
+350.511104 111.61 143360
+350.654464 111.61 143360
+350.797824 111.61 143360
+350.941184 111.61 143360
+351.084544 111.61 143360
+351.226880 112.41 142336
+351.369216 112.41 142336
+351.511552 112.41 142336
+351.653888 112.41 142336
+351.796224 112.41 142336
+351.938560 112.41 142336
+352.080896 112.41 142336
+352.223232 112.41 142336
+352.365568 112.41 142336
+352.507904 112.41 142336
+352.650240 112.41 142336
+352.792576 112.41 142336
+352.934912 112.41 142336
+353.077248 112.41 142336
+353.219584 112.41 142336
+353.361920 112.41 142336
+353.503232 113.22 141312
+353.644544 113.22 141312
+353.785856 113.22 141312
+353.927168 113.22 141312
+354.068480 113.22 141312
+354.209792 113.22 141312
+354.351104 113.22 141312
+354.492416 113.22 141312
+354.633728 113.22 141312
+354.775040 113.22 141312
+354.916352 113.22 141312
+355.057664 113.22 141312
+355.198976 113.22 141312
+355.340288 113.22 141312
+355.481600 113.22 141312
+355.622912 113.22 141312
+355.763200 114.05 140288
+355.903488 114.05 140288
+356.043776 114.05 140288
+356.184064 114.05 140288
+356.324352 114.05 140288
+356.464640 114.05 140288
+356.604928 114.05 140288
+356.745216 114.05 140288
+356.885504 114.05 140288
+357.025792 114.05 140288
+357.166080 114.05 140288
+357.306368 114.05 140288
+357.446656 114.05 140288
+357.586944 114.05 140288
+357.727232 114.05 140288
+357.867520 114.05 140288
+358.007808 114.05 140288
+358.148096 114.05 140288
+358.288384 114.05 140288
+358.428672 114.05 140288
+358.568960 114.05 140288
+358.709248 114.05 140288
+358.849536 114.05 140288
+358.989824 114.05 140288
+359.129088 114.89 139264
+359.268352 114.89 139264
+359.407616 114.89 139264
+359.546880 114.89 139264
+359.686144 114.89 139264
+359.825408 114.89 139264
+359.964672 114.89 139264
+360.103936 114.89 139264
+360.243200 114.89 139264
+360.382464 114.89 139264
+360.521728 114.89 139264
+360.660992 114.89 139264
+360.800256 114.89 139264
+360.939520 114.89 139264
+361.078784 114.89 139264
+361.218048 114.89 139264
+361.356288 115.74 138240
+361.494528 115.74 138240
+361.632768 115.74 138240
+361.771008 115.74 138240
+361.909248 115.74 138240
+362.047488 115.74 138240
+362.185728 115.74 138240
+362.323968 115.74 138240
+362.462208 115.74 138240
+362.600448 115.74 138240
+362.738688 115.74 138240
+362.876928 115.74 138240
+363.015168 115.74 138240
+363.153408 115.74 138240
+363.291648 115.74 138240
+363.429888 115.74 138240
+363.568128 115.74 138240
+363.706368 115.74 138240
+363.844608 115.74 138240
+363.982848 115.74 138240
+364.121088 115.74 138240
+364.259328 115.74 138240
+364.397568 115.74 138240
+364.535808 115.74 138240
+364.674048 115.74 138240
+364.812288 115.74 138240
+364.950528 115.74 138240
+365.088768 115.74 138240
+365.227008 115.74 138240
+365.365248 115.74 138240
+365.503488 115.74 138240
+365.641728 115.74 138240
+365.778944 116.60 137216
+365.916160 116.60 137216
+366.053376 116.60 137216
+366.190592 116.60 137216
+366.327808 116.60 137216
+366.465024 116.60 137216
+366.602240 116.60 137216
+366.739456 116.60 137216
+366.876672 116.60 137216
+367.013888 116.60 137216
+367.151104 116.60 137216
+367.288320 116.60 137216
+367.425536 116.60 137216
+367.562752 116.60 137216
+367.699968 116.60 137216
+367.837184 116.60 137216
+367.973376 117.48 136192
+368.109568 117.48 136192
+368.245760 117.48 136192
+368.381952 117.48 136192
+368.518144 117.48 136192
+368.654336 117.48 136192
+368.790528 117.48 136192
+368.926720 117.48 136192
+369.062912 117.48 136192
+369.199104 117.48 136192
+369.335296 117.48 136192
+369.471488 117.48 136192
+369.607680 117.48 136192
+369.743872 117.48 136192
+369.880064 117.48 136192
+370.016256 117.48 136192
+370.151424 118.37 135168
+370.286592 118.37 135168
+370.421760 118.37 135168
+370.556928 118.37 135168
+370.692096 118.37 135168
+370.827264 118.37 135168
+370.962432 118.37 135168
+371.097600 118.37 135168
+371.232768 118.37 135168
+371.367936 118.37 135168
+371.503104 118.37 135168
+371.638272 118.37 135168
+371.773440 118.37 135168
+371.908608 118.37 135168
+372.043776 118.37 135168
+372.178944 118.37 135168
+372.314112 118.37 135168
+372.449280 118.37 135168
+372.584448 118.37 135168
+372.719616 118.37 135168
+372.854784 118.37 135168
+372.989952 118.37 135168
+373.125120 118.37 135168
+373.260288 118.37 135168
+373.394432 119.27 134144
+373.528576 119.27 134144
+373.662720 119.27 134144
+373.796864 119.27 134144
+373.931008 119.27 134144
+374.065152 119.27 134144
+374.199296 119.27 134144
+374.333440 119.27 134144
+374.467584 119.27 134144
+374.601728 119.27 134144
+374.735872 119.27 134144
+374.870016 119.27 134144
+375.004160 119.27 134144
+375.138304 119.27 134144
+375.272448 119.27 134144
+375.406592 119.27 134144
+375.539712 120.19 133120
+375.672832 120.19 133120
+375.805952 120.19 133120
+375.939072 120.19 133120
+376.072192 120.19 133120
+376.205312 120.19 133120
+376.338432 120.19 133120
+376.471552 120.19 133120
+376.604672 120.19 133120
+376.737792 120.19 133120
+376.870912 120.19 133120
+377.004032 120.19 133120
+377.137152 120.19 133120
+377.270272 120.19 133120
+377.403392 120.19 133120
+377.536512 120.19 133120
+377.668608 121.12 132096
+377.800704 121.12 132096
+377.932800 121.12 132096
+378.064896 121.12 132096
+378.196992 121.12 132096
+378.329088 121.12 132096
+378.461184 121.12 132096
+378.593280 121.12 132096
+378.725376 121.12 132096
+378.857472 121.12 132096
+378.989568 121.12 132096
+379.121664 121.12 132096
+379.253760 121.12 132096
+379.385856 121.12 132096
+379.517952 121.12 132096
+379.650048 121.12 132096
+379.782144 121.12 132096
+379.914240 121.12 132096
+380.046336 121.12 132096
+380.178432 121.12 132096
+380.310528 121.12 132096
+380.442624 121.12 132096
+380.574720 121.12 132096
+380.706816 121.12 132096
+380.838912 121.12 132096
+380.971008 121.12 132096
+381.103104 121.12 132096
+381.235200 121.12 132096
+381.367296 121.12 132096
+381.499392 121.12 132096
+381.631488 121.12 132096
+381.763584 121.12 132096
+381.894656 122.07 131072
+382.025728 122.07 131072
+382.156800 122.07 131072
+382.287872 122.07 131072
+382.418944 122.07 131072
+382.550016 122.07 131072
+382.681088 122.07 131072
+382.812160 122.07 131072
+382.943232 122.07 131072
+383.074304 122.07 131072
+383.205376 122.07 131072
+383.336448 122.07 131072
+383.467520 122.07 131072
+383.598592 122.07 131072
+383.729664 122.07 131072
+383.860736 122.07 131072
+383.991296 122.55 130560
+384.121856 122.55 130560
+384.252416 122.55 130560
+384.382976 122.55 130560
+384.513536 122.55 130560
+384.644096 122.55 130560
+384.774656 122.55 130560
+384.905216 122.55 130560
+385.035776 122.55 130560
+385.166336 122.55 130560
+385.296896 122.55 130560
+385.427456 122.55 130560
+385.558016 122.55 130560
+385.688576 122.55 130560
+385.819136 122.55 130560
+385.949696 122.55 130560
+386.079744 123.03 130048
+386.209792 123.03 130048
+386.339840 123.03 130048
+386.469888 123.03 130048
+386.599936 123.03 130048
+386.729984 123.03 130048
+386.860032 123.03 130048
+386.990080 123.03 130048
+387.120128 123.03 130048
+387.250176 123.03 130048
+387.380224 123.03 130048
+387.510272 123.03 130048
+387.640320 123.03 130048
+387.770368 123.03 130048
+387.900416 123.03 130048
+388.030464 123.03 130048
+388.159488 124.01 129024
+388.288512 124.01 129024
+388.417536 124.01 129024
+388.546560 124.01 129024
+388.675584 124.01 129024
+388.804608 124.01 129024
+388.933632 124.01 129024
+389.062656 124.01 129024
+389.191680 124.01 129024
+389.320704 124.01 129024
+389.449728 124.01 129024
+389.578752 124.01 129024
+389.707776 124.01 129024
+389.836800 124.01 129024
+389.965824 124.01 129024
+390.094848 124.01 129024
+390.223360 124.50 128512
+390.351872 124.50 128512
+390.480384 124.50 128512
+390.608896 124.50 128512
+390.737408 124.50 128512
+390.865920 124.50 128512
+390.994432 124.50 128512
+391.122944 124.50 128512
+391.251456 124.50 128512
+391.379968 124.50 128512
+391.508480 124.50 128512
+391.636992 124.50 128512
+391.765504 124.50 128512
+391.894016 124.50 128512
+392.022528 124.50 128512
+392.151040 124.50 128512
+392.279040 125.00 128000
+392.407040 125.00 128000
+392.535040 125.00 128000
+392.663040 125.00 128000
+392.791040 125.00 128000
+392.919040 125.00 128000
+393.047040 125.00 128000
+393.175040 125.00 128000
+393.303040 125.00 128000
+393.431040 125.00 128000
+393.559040 125.00 128000
+393.687040 125.00 128000
+393.815040 125.00 128000
+393.943040 125.00 128000
+394.071040 125.00 128000
+394.199040 125.00 128000
+394.327040 125.00 128000
+394.455040 125.00 128000
+394.583040 125.00 128000
+394.711040 125.00 128000
+394.839040 125.00 128000
+394.967040 125.00 128000
+395.095040 125.00 128000
+395.223040 125.00 128000
+395.350016 126.01 126976
+395.476992 126.01 126976
+395.603968 126.01 126976
+395.730944 126.01 126976
+395.857920 126.01 126976
+395.984896 126.01 126976
+396.111872 126.01 126976
+396.238848 126.01 126976
+396.365824 126.01 126976
+396.492800 126.01 126976
+396.619776 126.01 126976
+396.746752 126.01 126976
+396.873728 126.01 126976
+397.000704 126.01 126976
+397.127680 126.01 126976
+397.254656 126.01 126976
+397.381120 126.52 126464
+397.507584 126.52 126464
+397.634048 126.52 126464
+397.760512 126.52 126464
+397.886976 126.52 126464
+398.013440 126.52 126464
+398.139904 126.52 126464
+398.266368 126.52 126464
+398.392832 126.52 126464
+398.519296 126.52 126464
+398.645760 126.52 126464
+398.772224 126.52 126464
+398.898688 126.52 126464
+399.025152 126.52 126464
+399.151616 126.52 126464
+399.278080 126.52 126464
+399.404032 127.03 125952
+399.529984 127.03 125952
+399.655936 127.03 125952
+399.781888 127.03 125952
+399.907840 127.03 125952
+400.033792 127.03 125952
+400.159744 127.03 125952
+400.285696 127.03 125952
+400.411648 127.03 125952
+400.537600 127.03 125952
+400.663552 127.03 125952
+400.789504 127.03 125952
+400.915456 127.03 125952
+401.041408 127.03 125952
+401.167360 127.03 125952
+401.293312 127.03 125952
+401.418240 128.07 124928
+401.543168 128.07 124928
+401.668096 128.07 124928
+401.793024 128.07 124928
+401.917952 128.07 124928
+402.042880 128.07 124928
+402.167808 128.07 124928
+402.292736 128.07 124928
+402.417664 128.07 124928
+402.542592 128.07 124928
+402.667520 128.07 124928
+402.792448 128.07 124928
+402.917376 128.07 124928
+403.042304 128.07 124928
+403.167232 128.07 124928
+403.292160 128.07 124928
+403.416576 128.60 124416
+403.540992 128.60 124416
+403.665408 128.60 124416
+403.789824 128.60 124416
+403.914240 128.60 124416
+404.038656 128.60 124416
+404.163072 128.60 124416
+404.287488 128.60 124416
+404.411904 128.60 124416
+404.536320 128.60 124416
+404.660736 128.60 124416
+404.785152 128.60 124416
+404.909568 128.60 124416
+405.033984 128.60 124416
+405.158400 128.60 124416
+405.282816 128.60 124416
+405.407232 128.60 124416
+405.531648 128.60 124416
+405.656064 128.60 124416
+405.780480 128.60 124416
+405.904896 128.60 124416
+406.029312 128.60 124416
+406.153728 128.60 124416
+406.278144 128.60 124416
+406.402048 129.13 123904
+406.525952 129.13 123904
+406.649856 129.13 123904
+406.773760 129.13 123904
+406.897664 129.13 123904
+407.021568 129.13 123904
+407.145472 129.13 123904
+407.269376 129.13 123904
+407.393280 129.13 123904
+407.517184 129.13 123904
+407.641088 129.13 123904
+407.764992 129.13 123904
+407.888896 129.13 123904
+408.012800 129.13 123904
+408.136704 129.13 123904
+408.260608 129.13 123904
+408.383488 130.21 122880
+408.506368 130.21 122880
+408.629248 130.21 122880
+408.752128 130.21 122880
+408.875008 130.21 122880
+408.997888 130.21 122880
+409.120768 130.21 122880
+409.243648 130.21 122880
+409.366528 130.21 122880
+409.489408 130.21 122880
+409.612288 130.21 122880
+409.735168 130.21 122880
+409.858048 130.21 122880
+409.980928 130.21 122880
+410.103808 130.21 122880
+410.226688 130.21 122880
+410.349056 130.75 122368
+410.471424 130.75 122368
+410.593792 130.75 122368
+410.716160 130.75 122368
+410.838528 130.75 122368
+410.960896 130.75 122368
+411.083264 130.75 122368
+411.205632 130.75 122368
+411.328000 130.75 122368
+411.450368 130.75 122368
+411.572736 130.75 122368
+411.695104 130.75 122368
+411.817472 130.75 122368
+411.939840 130.75 122368
+412.062208 130.75 122368
+412.184576 130.75 122368
+412.306432 131.30 121856
+412.428288 131.30 121856
+412.550144 131.30 121856
+412.672000 131.30 121856
+412.793856 131.30 121856
+412.915712 131.30 121856
+413.037568 131.30 121856
+413.159424 131.30 121856
+413.281280 131.30 121856
+413.403136 131.30 121856
+413.524992 131.30 121856
+413.646848 131.30 121856
+413.768704 131.30 121856
+413.890560 131.30 121856
+414.012416 131.30 121856
+414.134272 131.30 121856
+414.256128 131.30 121856
+414.377984 131.30 121856
+414.499840 131.30 121856
+414.621696 131.30 121856
+414.743552 131.30 121856
+414.865408 131.30 121856
+414.987264 131.30 121856
+415.109120 131.30 121856
+415.229952 132.42 120832
+415.350784 132.42 120832
+415.471616 132.42 120832
+415.592448 132.42 120832
+415.713280 132.42 120832
+415.834112 132.42 120832
+415.954944 132.42 120832
+416.075776 132.42 120832
+416.196608 132.42 120832
+416.317440 132.42 120832
+416.438272 132.42 120832
+416.559104 132.42 120832
+416.679936 132.42 120832
+416.800768 132.42 120832
+416.921600 132.42 120832
+417.042432 132.42 120832
+417.162752 132.98 120320
+417.283072 132.98 120320
+417.403392 132.98 120320
+417.523712 132.98 120320
+417.644032 132.98 120320
+417.764352 132.98 120320
+417.884672 132.98 120320
+418.004992 132.98 120320
+418.125312 132.98 120320
+418.245632 132.98 120320
+418.365952 132.98 120320
+418.486272 132.98 120320
+418.606592 132.98 120320
+418.726912 132.98 120320
+418.847232 132.98 120320
+418.967552 132.98 120320
+419.087872 132.98 120320
+419.208192 132.98 120320
+419.328512 132.98 120320
+419.448832 132.98 120320
+419.569152 132.98 120320
+419.689472 132.98 120320
+419.809792 132.98 120320
+419.930112 132.98 120320
+420.049920 133.55 119808
+420.169728 133.55 119808
+420.289536 133.55 119808
+420.409344 133.55 119808
+420.529152 133.55 119808
+420.648960 133.55 119808
+420.768768 133.55 119808
+420.888576 133.55 119808
+421.008384 133.55 119808
+421.128192 133.55 119808
+421.248000 133.55 119808
+421.367808 133.55 119808
+421.487616 133.55 119808
+421.607424 133.55 119808
+421.727232 133.55 119808
+421.847040 133.55 119808
+421.966336 134.12 119296
+422.085632 134.12 119296
+422.204928 134.12 119296
+422.324224 134.12 119296
+422.443520 134.12 119296
+422.562816 134.12 119296
+422.682112 134.12 119296
+422.801408 134.12 119296
+422.920704 134.12 119296
+423.040000 134.12 119296
+423.159296 134.12 119296
+423.278592 134.12 119296
+423.397888 134.12 119296
+423.517184 134.12 119296
+423.636480 134.12 119296
+423.755776 134.12 119296
+423.874048 135.28 118272
+423.992320 135.28 118272
+424.110592 135.28 118272
+424.228864 135.28 118272
+424.347136 135.28 118272
+424.465408 135.28 118272
+424.583680 135.28 118272
+424.701952 135.28 118272
+424.820224 135.28 118272
+424.938496 135.28 118272
+425.056768 135.28 118272
+425.175040 135.28 118272
+425.293312 135.28 118272
+425.411584 135.28 118272
+425.529856 135.28 118272
+425.648128 135.28 118272
+425.766400 135.28 118272
+425.884672 135.28 118272
+426.002944 135.28 118272
+426.121216 135.28 118272
+426.239488 135.28 118272
+426.357760 135.28 118272
+426.476032 135.28 118272
+426.594304 135.28 118272
+426.712064 135.87 117760
+426.829824 135.87 117760
+426.947584 135.87 117760
+427.065344 135.87 117760
+427.183104 135.87 117760
+427.300864 135.87 117760
+427.418624 135.87 117760
+427.536384 135.87 117760
+427.654144 135.87 117760
+427.771904 135.87 117760
+427.889664 135.87 117760
+428.007424 135.87 117760
+428.125184 135.87 117760
+428.242944 135.87 117760
+428.360704 135.87 117760
+428.478464 135.87 117760
+428.595712 136.46 117248
+428.712960 136.46 117248
+428.830208 136.46 117248
+428.947456 136.46 117248
+429.064704 136.46 117248
+429.181952 136.46 117248
+429.299200 136.46 117248
+429.416448 136.46 117248
+429.533696 136.46 117248
+429.650944 136.46 117248
+429.768192 136.46 117248
+429.885440 136.46 117248
+430.002688 136.46 117248
+430.119936 136.46 117248
+430.237184 136.46 117248
+430.354432 136.46 117248
+430.471680 136.46 117248
+430.588928 136.46 117248
+430.706176 136.46 117248
+430.823424 136.46 117248
+430.940672 136.46 117248
+431.057920 136.46 117248
+431.175168 136.46 117248
+431.292416 136.46 117248
+431.409152 137.06 116736
+431.525888 137.06 116736
+431.642624 137.06 116736
+431.759360 137.06 116736
+431.876096 137.06 116736
+431.992832 137.06 116736
+432.109568 137.06 116736
+432.226304 137.06 116736
+432.343040 137.06 116736
+432.459776 137.06 116736
+432.576512 137.06 116736
+432.693248 137.06 116736
+432.809984 137.06 116736
+432.926720 137.06 116736
+433.043456 137.06 116736
+433.160192 137.06 116736
+433.276928 137.06 116736
+433.393664 137.06 116736
+433.510400 137.06 116736
+433.627136 137.06 116736
+433.743872 137.06 116736
+433.860608 137.06 116736
+433.977344 137.06 116736
+434.094080 137.06 116736
+434.209792 138.27 115712
+434.325504 138.27 115712
+434.441216 138.27 115712
+434.556928 138.27 115712
+434.672640 138.27 115712
+434.788352 138.27 115712
+434.904064 138.27 115712
+435.019776 138.27 115712
+435.135488 138.27 115712
+435.251200 138.27 115712
+435.366912 138.27 115712
+435.482624 138.27 115712
+435.598336 138.27 115712
+435.714048 138.27 115712
+435.829760 138.27 115712
+435.945472 138.27 115712
+436.060672 138.89 115200
+436.175872 138.89 115200
+436.291072 138.89 115200
+436.406272 138.89 115200
+436.521472 138.89 115200
+436.636672 138.89 115200
+436.751872 138.89 115200
+436.867072 138.89 115200
+436.982272 138.89 115200
+437.097472 138.89 115200
+437.212672 138.89 115200
+437.327872 138.89 115200
+437.443072 138.89 115200
+437.558272 138.89 115200
+437.673472 138.89 115200
+437.788672 138.89 115200
+437.903872 138.89 115200
+438.019072 138.89 115200
+438.134272 138.89 115200
+438.249472 138.89 115200
+438.364672 138.89 115200
+438.479872 138.89 115200
+438.595072 138.89 115200
+438.710272 138.89 115200
+438.824960 139.51 114688
+438.939648 139.51 114688
+439.054336 139.51 114688
+439.169024 139.51 114688
+439.283712 139.51 114688
+439.398400 139.51 114688
+439.513088 139.51 114688
+439.627776 139.51 114688
+439.742464 139.51 114688
+439.857152 139.51 114688
+439.971840 139.51 114688
+440.086528 139.51 114688
+440.201216 139.51 114688
+440.315904 139.51 114688
+440.430592 139.51 114688
+440.545280 139.51 114688
+440.659456 140.13 114176
+440.773632 140.13 114176
+440.887808 140.13 114176
+441.001984 140.13 114176
+441.116160 140.13 114176
+441.230336 140.13 114176
+441.344512 140.13 114176
+441.458688 140.13 114176
+441.572864 140.13 114176
+441.687040 140.13 114176
+441.801216 140.13 114176
+441.915392 140.13 114176
+442.029568 140.13 114176
+442.143744 140.13 114176
+442.257920 140.13 114176
+442.372096 140.13 114176
+442.486272 140.13 114176
+442.600448 140.13 114176
+442.714624 140.13 114176
+442.828800 140.13 114176
+442.942976 140.13 114176
+443.057152 140.13 114176
+443.171328 140.13 114176
+443.285504 140.13 114176
+443.398656 141.40 113152
+443.511808 141.40 113152
+443.624960 141.40 113152
+443.738112 141.40 113152
+443.851264 141.40 113152
+443.964416 141.40 113152
+444.077568 141.40 113152
+444.190720 141.40 113152
+444.303872 141.40 113152
+444.417024 141.40 113152
+444.530176 141.40 113152
+444.643328 141.40 113152
+444.756480 141.40 113152
+444.869632 141.40 113152
+444.982784 141.40 113152
+445.095936 141.40 113152
+445.209088 141.40 113152
+445.322240 141.40 113152
+445.435392 141.40 113152
+445.548544 141.40 113152
+445.661696 141.40 113152
+445.774848 141.40 113152
+445.888000 141.40 113152
+446.001152 141.40 113152
+446.113792 142.05 112640
+446.226432 142.05 112640
+446.339072 142.05 112640
+446.451712 142.05 112640
+446.564352 142.05 112640
+446.676992 142.05 112640
+446.789632 142.05 112640
+446.902272 142.05 112640
+447.014912 142.05 112640
+447.127552 142.05 112640
+447.240192 142.05 112640
+447.352832 142.05 112640
+447.465472 142.05 112640
+447.578112 142.05 112640
+447.690752 142.05 112640
+447.803392 142.05 112640
+447.915520 142.69 112128
+448.027648 142.69 112128
+448.139776 142.69 112128
+448.251904 142.69 112128
+448.364032 142.69 112128
+448.476160 142.69 112128
+448.588288 142.69 112128
+448.700416 142.69 112128
+448.812544 142.69 112128
+448.924672 142.69 112128
+449.036800 142.69 112128
+449.148928 142.69 112128
+449.261056 142.69 112128
+449.373184 142.69 112128
+449.485312 142.69 112128
+449.597440 142.69 112128
+449.709568 142.69 112128
+449.821696 142.69 112128
+449.933824 142.69 112128
+450.045952 142.69 112128
+450.158080 142.69 112128
+450.270208 142.69 112128
+450.382336 142.69 112128
+450.494464 142.69 112128
+450.606080 143.35 111616
+450.717696 143.35 111616
+450.829312 143.35 111616
+450.940928 143.35 111616
+451.052544 143.35 111616
+451.164160 143.35 111616
+451.275776 143.35 111616
+451.387392 143.35 111616
+451.499008 143.35 111616
+451.610624 143.35 111616
+451.722240 143.35 111616
+451.833856 143.35 111616
+451.945472 143.35 111616
+452.057088 143.35 111616
+452.168704 143.35 111616
+452.280320 143.35 111616
+452.391936 143.35 111616
+452.503552 143.35 111616
+452.615168 143.35 111616
+452.726784 143.35 111616
+452.838400 143.35 111616
+452.950016 143.35 111616
+453.061632 143.35 111616
+453.173248 143.35 111616
+453.284864 143.35 111616
+453.396480 143.35 111616
+453.508096 143.35 111616
+453.619712 143.35 111616
+453.731328 143.35 111616
+453.842944 143.35 111616
+453.954560 143.35 111616
+454.066176 143.35 111616
+454.177280 144.01 111104
+454.288384 144.01 111104
+454.399488 144.01 111104
+454.510592 144.01 111104
+454.621696 144.01 111104
+454.732800 144.01 111104
+454.843904 144.01 111104
+454.955008 144.01 111104
+455.066112 144.01 111104
+455.177216 144.01 111104
+455.288320 144.01 111104
+455.399424 144.01 111104
+455.510528 144.01 111104
+455.621632 144.01 111104
+455.732736 144.01 111104
+455.843840 144.01 111104
+455.954432 144.68 110592
+456.065024 144.68 110592
+456.175616 144.68 110592
+456.286208 144.68 110592
+456.396800 144.68 110592
+456.507392 144.68 110592
+456.617984 144.68 110592
+456.728576 144.68 110592
+456.839168 144.68 110592
+456.949760 144.68 110592
+457.060352 144.68 110592
+457.170944 144.68 110592
+457.281536 144.68 110592
+457.392128 144.68 110592
+457.502720 144.68 110592
+457.613312 144.68 110592
+457.722880 146.03 109568
+457.832448 146.03 109568
+457.942016 146.03 109568
+458.051584 146.03 109568
+458.161152 146.03 109568
+458.270720 146.03 109568
+458.380288 146.03 109568
+458.489856 146.03 109568
+458.599424 146.03 109568
+458.708992 146.03 109568
+458.818560 146.03 109568
+458.928128 146.03 109568
+459.037696 146.03 109568
+459.147264 146.03 109568
+459.256832 146.03 109568
+459.366400 146.03 109568
+459.475968 146.03 109568
+459.585536 146.03 109568
+459.695104 146.03 109568
+459.804672 146.03 109568
+459.914240 146.03 109568
+460.023808 146.03 109568
+460.133376 146.03 109568
+460.242944 146.03 109568
+460.352512 146.03 109568
+460.462080 146.03 109568
+460.571648 146.03 109568
+460.681216 146.03 109568
+460.790784 146.03 109568
+460.900352 146.03 109568
+461.009920 146.03 109568
+461.119488 146.03 109568
+461.228544 146.71 109056
+461.337600 146.71 109056
+461.446656 146.71 109056
+461.555712 146.71 109056
+461.664768 146.71 109056
+461.773824 146.71 109056
+461.882880 146.71 109056
+461.991936 146.71 109056
+462.100992 146.71 109056
+462.210048 146.71 109056
+462.319104 146.71 109056
+462.428160 146.71 109056
+462.537216 146.71 109056
+462.646272 146.71 109056
+462.755328 146.71 109056
+462.864384 146.71 109056
+462.972928 147.41 108544
+463.081472 147.41 108544
+463.190016 147.41 108544
+463.298560 147.41 108544
+463.407104 147.41 108544
+463.515648 147.41 108544
+463.624192 147.41 108544
+463.732736 147.41 108544
+463.841280 147.41 108544
+463.949824 147.41 108544
+464.058368 147.41 108544
+464.166912 147.41 108544
+464.275456 147.41 108544
+464.384000 147.41 108544
+464.492544 147.41 108544
+464.601088 147.41 108544
+464.709632 147.41 108544
+464.818176 147.41 108544
+464.926720 147.41 108544
+465.035264 147.41 108544
+465.143808 147.41 108544
+465.252352 147.41 108544
+465.360896 147.41 108544
+465.469440 147.41 108544
+465.577984 147.41 108544
+465.686528 147.41 108544
+465.795072 147.41 108544
+465.903616 147.41 108544
+466.012160 147.41 108544
+466.120704 147.41 108544
+466.229248 147.41 108544
+466.337792 147.41 108544
+466.445824 148.10 108032
+466.553856 148.10 108032
+466.661888 148.10 108032
+466.769920 148.10 108032
+466.877952 148.10 108032
+466.985984 148.10 108032
+467.094016 148.10 108032
+467.202048 148.10 108032
+467.310080 148.10 108032
+467.418112 148.10 108032
+467.526144 148.10 108032
+467.634176 148.10 108032
+467.742208 148.10 108032
+467.850240 148.10 108032
+467.958272 148.10 108032
+468.066304 148.10 108032
+468.173824 148.81 107520
+468.281344 148.81 107520
+468.388864 148.81 107520
+468.496384 148.81 107520
+468.603904 148.81 107520
+468.711424 148.81 107520
+468.818944 148.81 107520
+468.926464 148.81 107520
+469.033984 148.81 107520
+469.141504 148.81 107520
+469.249024 148.81 107520
+469.356544 148.81 107520
+469.464064 148.81 107520
+469.571584 148.81 107520
+469.679104 148.81 107520
+469.786624 148.81 107520
+469.894144 148.81 107520
+470.001664 148.81 107520
+470.109184 148.81 107520
+470.216704 148.81 107520
+470.324224 148.81 107520
+470.431744 148.81 107520
+470.539264 148.81 107520
+470.646784 148.81 107520
+470.754304 148.81 107520
+470.861824 148.81 107520
+470.969344 148.81 107520
+471.076864 148.81 107520
+471.184384 148.81 107520
+471.291904 148.81 107520
+471.399424 148.81 107520
+471.506944 148.81 107520
+471.613952 149.52 107008
+471.720960 149.52 107008
+471.827968 149.52 107008
+471.934976 149.52 107008
+472.041984 149.52 107008
+472.148992 149.52 107008
+472.256000 149.52 107008
+472.363008 149.52 107008
+472.470016 149.52 107008
+472.577024 149.52 107008
+472.684032 149.52 107008
+472.791040 149.52 107008
+472.898048 149.52 107008
+473.005056 149.52 107008
+473.112064 149.52 107008
+473.219072 149.52 107008
+473.325568 150.24 106496
+473.432064 150.24 106496
+473.538560 150.24 106496
+473.645056 150.24 106496
+473.751552 150.24 106496
+473.858048 150.24 106496
+473.964544 150.24 106496
+474.071040 150.24 106496
+474.177536 150.24 106496
+474.284032 150.24 106496
+474.390528 150.24 106496
+474.497024 150.24 106496
+474.603520 150.24 106496
+474.710016 150.24 106496
+474.816512 150.24 106496
+474.923008 150.24 106496
+475.029504 150.24 106496
+475.136000 150.24 106496
+475.242496 150.24 106496
+475.348992 150.24 106496
+475.455488 150.24 106496
+475.561984 150.24 106496
+475.668480 150.24 106496
+475.774976 150.24 106496
+475.881472 150.24 106496
+475.987968 150.24 106496
+476.094464 150.24 106496
+476.200960 150.24 106496
+476.307456 150.24 106496
+476.413952 150.24 106496
+476.520448 150.24 106496
+476.626944 150.24 106496
+476.732416 151.70 105472
+476.837888 151.70 105472
+476.943360 151.70 105472
+477.048832 151.70 105472
+477.154304 151.70 105472
+477.259776 151.70 105472
+477.365248 151.70 105472
+477.470720 151.70 105472
+477.576192 151.70 105472
+477.681664 151.70 105472
+477.787136 151.70 105472
+477.892608 151.70 105472
+477.998080 151.70 105472
+478.103552 151.70 105472
+478.209024 151.70 105472
+478.314496 151.70 105472
+478.419456 152.44 104960
+478.524416 152.44 104960
+478.629376 152.44 104960
+478.734336 152.44 104960
+478.839296 152.44 104960
+478.944256 152.44 104960
+479.049216 152.44 104960
+479.154176 152.44 104960
+479.259136 152.44 104960
+479.364096 152.44 104960
+479.469056 152.44 104960
+479.574016 152.44 104960
+479.678976 152.44 104960
+479.783936 152.44 104960
+479.888896 152.44 104960
+479.993856 152.44 104960
+480.098816 152.44 104960
+480.203776 152.44 104960
+480.308736 152.44 104960
+480.413696 152.44 104960
+480.518656 152.44 104960
+480.623616 152.44 104960
+480.728576 152.44 104960
+480.833536 152.44 104960
+480.938496 152.44 104960
+481.043456 152.44 104960
+481.148416 152.44 104960
+481.253376 152.44 104960
+481.358336 152.44 104960
+481.463296 152.44 104960
+481.568256 152.44 104960
+481.673216 152.44 104960
+481.777664 153.19 104448
+481.882112 153.19 104448
+481.986560 153.19 104448
+482.091008 153.19 104448
+482.195456 153.19 104448
+482.299904 153.19 104448
+482.404352 153.19 104448
+482.508800 153.19 104448
+482.613248 153.19 104448
+482.717696 153.19 104448
+482.822144 153.19 104448
+482.926592 153.19 104448
+483.031040 153.19 104448
+483.135488 153.19 104448
+483.239936 153.19 104448
+483.344384 153.19 104448
+483.448832 153.19 104448
+483.553280 153.19 104448
+483.657728 153.19 104448
+483.762176 153.19 104448
+483.866624 153.19 104448
+483.971072 153.19 104448
+484.075520 153.19 104448
+484.179968 153.19 104448
+484.284416 153.19 104448
+484.388864 153.19 104448
+484.493312 153.19 104448
+484.597760 153.19 104448
+484.702208 153.19 104448
+484.806656 153.19 104448
+484.911104 153.19 104448
+485.015552 153.19 104448
+485.119488 153.94 103936
+485.223424 153.94 103936
+485.327360 153.94 103936
+485.431296 153.94 103936
+485.535232 153.94 103936
+485.639168 153.94 103936
+485.743104 153.94 103936
+485.847040 153.94 103936
+485.950976 153.94 103936
+486.054912 153.94 103936
+486.158848 153.94 103936
+486.262784 153.94 103936
+486.366720 153.94 103936
+486.470656 153.94 103936
+486.574592 153.94 103936
+486.678528 153.94 103936
+486.781952 154.70 103424
+486.885376 154.70 103424
+486.988800 154.70 103424
+487.092224 154.70 103424
+487.195648 154.70 103424
+487.299072 154.70 103424
+487.402496 154.70 103424
+487.505920 154.70 103424
+487.609344 154.70 103424
+487.712768 154.70 103424
+487.816192 154.70 103424
+487.919616 154.70 103424
+488.023040 154.70 103424
+488.126464 154.70 103424
+488.229888 154.70 103424
+488.333312 154.70 103424
+488.436736 154.70 103424
+488.540160 154.70 103424
+488.643584 154.70 103424
+488.747008 154.70 103424
+488.850432 154.70 103424
+488.953856 154.70 103424
+489.057280 154.70 103424
+489.160704 154.70 103424
+489.264128 154.70 103424
+489.367552 154.70 103424
+489.470976 154.70 103424
+489.574400 154.70 103424
+489.677824 154.70 103424
+489.781248 154.70 103424
+489.884672 154.70 103424
+489.988096 154.70 103424
+490.091008 155.47 102912
+490.193920 155.47 102912
+490.296832 155.47 102912
+490.399744 155.47 102912
+490.502656 155.47 102912
+490.605568 155.47 102912
+490.708480 155.47 102912
+490.811392 155.47 102912
+490.914304 155.47 102912
+491.017216 155.47 102912
+491.120128 155.47 102912
+491.223040 155.47 102912
+491.325952 155.47 102912
+491.428864 155.47 102912
+491.531776 155.47 102912
+491.634688 155.47 102912
+491.737088 156.25 102400
+491.839488 156.25 102400
+491.941888 156.25 102400
+492.044288 156.25 102400
+492.146688 156.25 102400
+492.249088 156.25 102400
+492.351488 156.25 102400
+492.453888 156.25 102400
+492.556288 156.25 102400
+492.658688 156.25 102400
+492.761088 156.25 102400
+492.863488 156.25 102400
+492.965888 156.25 102400
+493.068288 156.25 102400
+493.170688 156.25 102400
+493.273088 156.25 102400
+493.375488 156.25 102400
+493.477888 156.25 102400
+493.580288 156.25 102400
+493.682688 156.25 102400
+493.785088 156.25 102400
+493.887488 156.25 102400
+493.989888 156.25 102400
+494.092288 156.25 102400
+494.194688 156.25 102400
+494.297088 156.25 102400
+494.399488 156.25 102400
+494.501888 156.25 102400
+494.604288 156.25 102400
+494.706688 156.25 102400
+494.809088 156.25 102400
+494.911488 156.25 102400
+495.013376 157.04 101888
+495.115264 157.04 101888
+495.217152 157.04 101888
+495.319040 157.04 101888
+495.420928 157.04 101888
+495.522816 157.04 101888
+495.624704 157.04 101888
+495.726592 157.04 101888
+495.828480 157.04 101888
+495.930368 157.04 101888
+496.032256 157.04 101888
+496.134144 157.04 101888
+496.236032 157.04 101888
+496.337920 157.04 101888
+496.439808 157.04 101888
+496.541696 157.04 101888
+496.643584 157.04 101888
+496.745472 157.04 101888
+496.847360 157.04 101888
+496.949248 157.04 101888
+497.051136 157.04 101888
+497.153024 157.04 101888
+497.254912 157.04 101888
+497.356800 157.04 101888
+497.458688 157.04 101888
+497.560576 157.04 101888
+497.662464 157.04 101888
+497.764352 157.04 101888
+497.866240 157.04 101888
+497.968128 157.04 101888
+498.070016 157.04 101888
+498.171904 157.04 101888
+498.273280 157.83 101376
+498.374656 157.83 101376
+498.476032 157.83 101376
+498.577408 157.83 101376
+498.678784 157.83 101376
+498.780160 157.83 101376
+498.881536 157.83 101376
+498.982912 157.83 101376
+499.084288 157.83 101376
+499.185664 157.83 101376
+499.287040 157.83 101376
+499.388416 157.83 101376
+499.489792 157.83 101376
+499.591168 157.83 101376
+499.692544 157.83 101376
+499.793920 157.83 101376
+499.894784 158.63 100864
+499.995648 158.63 100864
+500.096512 158.63 100864
+500.197376 158.63 100864
+500.298240 158.63 100864
+500.399104 158.63 100864
+500.499968 158.63 100864
+500.600832 158.63 100864
+500.701696 158.63 100864
+500.802560 158.63 100864
+500.903424 158.63 100864
+501.004288 158.63 100864
+501.105152 158.63 100864
+501.206016 158.63 100864
+501.306880 158.63 100864
+501.407744 158.63 100864
+501.508608 158.63 100864
+501.609472 158.63 100864
+501.710336 158.63 100864
+501.811200 158.63 100864
+501.912064 158.63 100864
+502.012928 158.63 100864
+502.113792 158.63 100864
+502.214656 158.63 100864
+502.315520 158.63 100864
+502.416384 158.63 100864
+502.517248 158.63 100864
+502.618112 158.63 100864
+502.718976 158.63 100864
+502.819840 158.63 100864
+502.920704 158.63 100864
+503.021568 158.63 100864
+503.121920 159.44 100352
+503.222272 159.44 100352
+503.322624 159.44 100352
+503.422976 159.44 100352
+503.523328 159.44 100352
+503.623680 159.44 100352
+503.724032 159.44 100352
+503.824384 159.44 100352
+503.924736 159.44 100352
+504.025088 159.44 100352
+504.125440 159.44 100352
+504.225792 159.44 100352
+504.326144 159.44 100352
+504.426496 159.44 100352
+504.526848 159.44 100352
+504.627200 159.44 100352
+504.727552 159.44 100352
+504.827904 159.44 100352
+504.928256 159.44 100352
+505.028608 159.44 100352
+505.128960 159.44 100352
+505.229312 159.44 100352
+505.329664 159.44 100352
+505.430016 159.44 100352
+505.530368 159.44 100352
+505.630720 159.44 100352
+505.731072 159.44 100352
+505.831424 159.44 100352
+505.931776 159.44 100352
+506.032128 159.44 100352
+506.132480 159.44 100352
+506.232832 159.44 100352
+506.332160 161.08 99328
+506.431488 161.08 99328
+506.530816 161.08 99328
+506.630144 161.08 99328
+506.729472 161.08 99328
+506.828800 161.08 99328
+506.928128 161.08 99328
+507.027456 161.08 99328
+507.126784 161.08 99328
+507.226112 161.08 99328
+507.325440 161.08 99328
+507.424768 161.08 99328
+507.524096 161.08 99328
+507.623424 161.08 99328
+507.722752 161.08 99328
+507.822080 161.08 99328
+507.921408 161.08 99328
+508.020736 161.08 99328
+508.120064 161.08 99328
+508.219392 161.08 99328
+508.318720 161.08 99328
+508.418048 161.08 99328
+508.517376 161.08 99328
+508.616704 161.08 99328
+508.716032 161.08 99328
+508.815360 161.08 99328
+508.914688 161.08 99328
+509.014016 161.08 99328
+509.113344 161.08 99328
+509.212672 161.08 99328
+509.312000 161.08 99328
+509.411328 161.08 99328
+509.510144 161.92 98816
+509.608960 161.92 98816
+509.707776 161.92 98816
+509.806592 161.92 98816
+509.905408 161.92 98816
+510.004224 161.92 98816
+510.103040 161.92 98816
+510.201856 161.92 98816
+510.300672 161.92 98816
+510.399488 161.92 98816
+510.498304 161.92 98816
+510.597120 161.92 98816
+510.695936 161.92 98816
+510.794752 161.92 98816
+510.893568 161.92 98816
+510.992384 161.92 98816
+511.090688 162.76 98304
+511.188992 162.76 98304
+511.287296 162.76 98304
+511.385600 162.76 98304
+511.483904 162.76 98304
+511.582208 162.76 98304
+511.680512 162.76 98304
+511.778816 162.76 98304
+511.877120 162.76 98304
+511.975424 162.76 98304
+512.073728 162.76 98304
+512.172032 162.76 98304
+512.270336 162.76 98304
+512.368640 162.76 98304
+512.466944 162.76 98304
+512.565248 162.76 98304
+512.663552 162.76 98304
+512.761856 162.76 98304
+512.860160 162.76 98304
+512.958464 162.76 98304
+513.056768 162.76 98304
+513.155072 162.76 98304
+513.253376 162.76 98304
+513.351680 162.76 98304
+513.449984 162.76 98304
+513.548288 162.76 98304
+513.646592 162.76 98304
+513.744896 162.76 98304
+513.843200 162.76 98304
+513.941504 162.76 98304
+514.039808 162.76 98304
+514.138112 162.76 98304
+514.235904 163.61 97792
+514.333696 163.61 97792
+514.431488 163.61 97792
+514.529280 163.61 97792
+514.627072 163.61 97792
+514.724864 163.61 97792
+514.822656 163.61 97792
+514.920448 163.61 97792
+515.018240 163.61 97792
+515.116032 163.61 97792
+515.213824 163.61 97792
+515.311616 163.61 97792
+515.409408 163.61 97792
+515.507200 163.61 97792
+515.604992 163.61 97792
+515.702784 163.61 97792
+515.800576 163.61 97792
+515.898368 163.61 97792
+515.996160 163.61 97792
+516.093952 163.61 97792
+516.191744 163.61 97792
+516.289536 163.61 97792
+516.387328 163.61 97792
+516.485120 163.61 97792
+516.582912 163.61 97792
+516.680704 163.61 97792
+516.778496 163.61 97792
+516.876288 163.61 97792
+516.974080 163.61 97792
+517.071872 163.61 97792
+517.169664 163.61 97792
+517.267456 163.61 97792
+517.364736 164.47 97280
+517.462016 164.47 97280
+517.559296 164.47 97280
+517.656576 164.47 97280
+517.753856 164.47 97280
+517.851136 164.47 97280
+517.948416 164.47 97280
+518.045696 164.47 97280
+518.142976 164.47 97280
+518.240256 164.47 97280
+518.337536 164.47 97280
+518.434816 164.47 97280
+518.532096 164.47 97280
+518.629376 164.47 97280
+518.726656 164.47 97280
+518.823936 164.47 97280
+518.921216 164.47 97280
+519.018496 164.47 97280
+519.115776 164.47 97280
+519.213056 164.47 97280
+519.310336 164.47 97280
+519.407616 164.47 97280
+519.504896 164.47 97280
+519.602176 164.47 97280
+519.699456 164.47 97280
+519.796736 164.47 97280
+519.894016 164.47 97280
+519.991296 164.47 97280
+520.088576 164.47 97280
+520.185856 164.47 97280
+520.283136 164.47 97280
+520.380416 164.47 97280
+520.477184 165.34 96768
+520.573952 165.34 96768
+520.670720 165.34 96768
+520.767488 165.34 96768
+520.864256 165.34 96768
+520.961024 165.34 96768
+521.057792 165.34 96768
+521.154560 165.34 96768
+521.251328 165.34 96768
+521.348096 165.34 96768
+521.444864 165.34 96768
+521.541632 165.34 96768
+521.638400 165.34 96768
+521.735168 165.34 96768
+521.831936 165.34 96768
+521.928704 165.34 96768
+522.025472 165.34 96768
+522.122240 165.34 96768
+522.219008 165.34 96768
+522.315776 165.34 96768
+522.412544 165.34 96768
+522.509312 165.34 96768
+522.606080 165.34 96768
+522.702848 165.34 96768
+522.799616 165.34 96768
+522.896384 165.34 96768
+522.993152 165.34 96768
+523.089920 165.34 96768
+523.186688 165.34 96768
+523.283456 165.34 96768
+523.380224 165.34 96768
+523.476992 165.34 96768
+523.573248 166.22 96256
+523.669504 166.22 96256
+523.765760 166.22 96256
+523.862016 166.22 96256
+523.958272 166.22 96256
+524.054528 166.22 96256
+524.150784 166.22 96256
+524.247040 166.22 96256
+524.343296 166.22 96256
+524.439552 166.22 96256
+524.535808 166.22 96256
+524.632064 166.22 96256
+524.728320 166.22 96256
+524.824576 166.22 96256
+524.920832 166.22 96256
+525.017088 166.22 96256
+525.113344 166.22 96256
+525.209600 166.22 96256
+525.305856 166.22 96256
+525.402112 166.22 96256
+525.498368 166.22 96256
+525.594624 166.22 96256
+525.690880 166.22 96256
+525.787136 166.22 96256
+525.883392 166.22 96256
+525.979648 166.22 96256
+526.075904 166.22 96256
+526.172160 166.22 96256
+526.268416 166.22 96256
+526.364672 166.22 96256
+526.460928 166.22 96256
+526.557184 166.22 96256
+526.652928 167.11 95744
+526.748672 167.11 95744
+526.844416 167.11 95744
+526.940160 167.11 95744
+527.035904 167.11 95744
+527.131648 167.11 95744
+527.227392 167.11 95744
+527.323136 167.11 95744
+527.418880 167.11 95744
+527.514624 167.11 95744
+527.610368 167.11 95744
+527.706112 167.11 95744
+527.801856 167.11 95744
+527.897600 167.11 95744
+527.993344 167.11 95744
+528.089088 167.11 95744
+528.184320 168.01 95232
+528.279552 168.01 95232
+528.374784 168.01 95232
+528.470016 168.01 95232
+528.565248 168.01 95232
+528.660480 168.01 95232
+528.755712 168.01 95232
+528.850944 168.01 95232
+528.946176 168.01 95232
+529.041408 168.01 95232
+529.136640 168.01 95232
+529.231872 168.01 95232
+529.327104 168.01 95232
+529.422336 168.01 95232
+529.517568 168.01 95232
+529.612800 168.01 95232
+529.708032 168.01 95232
+529.803264 168.01 95232
+529.898496 168.01 95232
+529.993728 168.01 95232
+530.088960 168.01 95232
+530.184192 168.01 95232
+530.279424 168.01 95232
+530.374656 168.01 95232
+530.469888 168.01 95232
+530.565120 168.01 95232
+530.660352 168.01 95232
+530.755584 168.01 95232
+530.850816 168.01 95232
+530.946048 168.01 95232
+531.041280 168.01 95232
+531.136512 168.01 95232
+531.231232 168.92 94720
+531.325952 168.92 94720
+531.420672 168.92 94720
+531.515392 168.92 94720
+531.610112 168.92 94720
+531.704832 168.92 94720
+531.799552 168.92 94720
+531.894272 168.92 94720
+531.988992 168.92 94720
+532.083712 168.92 94720
+532.178432 168.92 94720
+532.273152 168.92 94720
+532.367872 168.92 94720
+532.462592 168.92 94720
+532.557312 168.92 94720
+532.652032 168.92 94720
+532.746752 168.92 94720
+532.841472 168.92 94720
+532.936192 168.92 94720
+533.030912 168.92 94720
+533.125632 168.92 94720
+533.220352 168.92 94720
+533.315072 168.92 94720
+533.409792 168.92 94720
+533.504512 168.92 94720
+533.599232 168.92 94720
+533.693952 168.92 94720
+533.788672 168.92 94720
+533.883392 168.92 94720
+533.978112 168.92 94720
+534.072832 168.92 94720
+534.167552 168.92 94720
+534.261760 169.84 94208
+534.355968 169.84 94208
+534.450176 169.84 94208
+534.544384 169.84 94208
+534.638592 169.84 94208
+534.732800 169.84 94208
+534.827008 169.84 94208
+534.921216 169.84 94208
+535.015424 169.84 94208
+535.109632 169.84 94208
+535.203840 169.84 94208
+535.298048 169.84 94208
+535.392256 169.84 94208
+535.486464 169.84 94208
+535.580672 169.84 94208
+535.674880 169.84 94208
+535.769088 169.84 94208
+535.863296 169.84 94208
+535.957504 169.84 94208
+536.051712 169.84 94208
+536.145920 169.84 94208
+536.240128 169.84 94208
+536.334336 169.84 94208
+536.428544 169.84 94208
+536.522752 169.84 94208
+536.616960 169.84 94208
+536.711168 169.84 94208
+536.805376 169.84 94208
+536.899584 169.84 94208
+536.993792 169.84 94208
+537.088000 169.84 94208
+537.182208 169.84 94208
+537.275904 170.77 93696
+537.369600 170.77 93696
+537.463296 170.77 93696
+537.556992 170.77 93696
+537.650688 170.77 93696
+537.744384 170.77 93696
+537.838080 170.77 93696
+537.931776 170.77 93696
+538.025472 170.77 93696
+538.119168 170.77 93696
+538.212864 170.77 93696
+538.306560 170.77 93696
+538.400256 170.77 93696
+538.493952 170.77 93696
+538.587648 170.77 93696
+538.681344 170.77 93696
+538.775040 170.77 93696
+538.868736 170.77 93696
+538.962432 170.77 93696
+539.056128 170.77 93696
+539.149824 170.77 93696
+539.243520 170.77 93696
+539.337216 170.77 93696
+539.430912 170.77 93696
+539.524608 170.77 93696
+539.618304 170.77 93696
+539.712000 170.77 93696
+539.805696 170.77 93696
+539.899392 170.77 93696
+539.993088 170.77 93696
+540.086784 170.77 93696
+540.180480 170.77 93696
+540.273664 171.70 93184
+540.366848 171.70 93184
+540.460032 171.70 93184
+540.553216 171.70 93184
+540.646400 171.70 93184
+540.739584 171.70 93184
+540.832768 171.70 93184
+540.925952 171.70 93184
+541.019136 171.70 93184
+541.112320 171.70 93184
+541.205504 171.70 93184
+541.298688 171.70 93184
+541.391872 171.70 93184
+541.485056 171.70 93184
+541.578240 171.70 93184
+541.671424 171.70 93184
+541.764608 171.70 93184
+541.857792 171.70 93184
+541.950976 171.70 93184
+542.044160 171.70 93184
+542.137344 171.70 93184
+542.230528 171.70 93184
+542.323712 171.70 93184
+542.416896 171.70 93184
+542.510080 171.70 93184
+542.603264 171.70 93184
+542.696448 171.70 93184
+542.789632 171.70 93184
+542.882816 171.70 93184
+542.976000 171.70 93184
+543.069184 171.70 93184
+543.162368 171.70 93184
+543.255040 172.65 92672
+543.347712 172.65 92672
+543.440384 172.65 92672
+543.533056 172.65 92672
+543.625728 172.65 92672
+543.718400 172.65 92672
+543.811072 172.65 92672
+543.903744 172.65 92672
+543.996416 172.65 92672
+544.089088 172.65 92672
+544.181760 172.65 92672
+544.274432 172.65 92672
+544.367104 172.65 92672
+544.459776 172.65 92672
+544.552448 172.65 92672
+544.645120 172.65 92672
+544.737792 172.65 92672
+544.830464 172.65 92672
+544.923136 172.65 92672
+545.015808 172.65 92672
+545.108480 172.65 92672
+545.201152 172.65 92672
+545.293824 172.65 92672
+545.386496 172.65 92672
+545.479168 172.65 92672
+545.571840 172.65 92672
+545.664512 172.65 92672
+545.757184 172.65 92672
+545.849856 172.65 92672
+545.942528 172.65 92672
+546.035200 172.65 92672
+546.127872 172.65 92672
+546.220032 173.61 92160
+546.312192 173.61 92160
+546.404352 173.61 92160
+546.496512 173.61 92160
+546.588672 173.61 92160
+546.680832 173.61 92160
+546.772992 173.61 92160
+546.865152 173.61 92160
+546.957312 173.61 92160
+547.049472 173.61 92160
+547.141632 173.61 92160
+547.233792 173.61 92160
+547.325952 173.61 92160
+547.418112 173.61 92160
+547.510272 173.61 92160
+547.602432 173.61 92160
+547.694592 173.61 92160
+547.786752 173.61 92160
+547.878912 173.61 92160
+547.971072 173.61 92160
+548.063232 173.61 92160
+548.155392 173.61 92160
+548.247552 173.61 92160
+548.339712 173.61 92160
+548.431872 173.61 92160
+548.524032 173.61 92160
+548.616192 173.61 92160
+548.708352 173.61 92160
+548.800512 173.61 92160
+548.892672 173.61 92160
+548.984832 173.61 92160
+549.076992 173.61 92160
+549.168640 174.58 91648
+549.260288 174.58 91648
+549.351936 174.58 91648
+549.443584 174.58 91648
+549.535232 174.58 91648
+549.626880 174.58 91648
+549.718528 174.58 91648
+549.810176 174.58 91648
+549.901824 174.58 91648
+549.993472 174.58 91648
+550.085120 174.58 91648
+550.176768 174.58 91648
+550.268416 174.58 91648
+550.360064 174.58 91648
+550.451712 174.58 91648
+550.543360 174.58 91648
+550.635008 174.58 91648
+550.726656 174.58 91648
+550.818304 174.58 91648
+550.909952 174.58 91648
+551.001600 174.58 91648
+551.093248 174.58 91648
+551.184896 174.58 91648
+551.276544 174.58 91648
+551.368192 174.58 91648
+551.459840 174.58 91648
+551.551488 174.58 91648
+551.643136 174.58 91648
+551.734784 174.58 91648
+551.826432 174.58 91648
+551.918080 174.58 91648
+552.009728 174.58 91648
+552.100864 175.56 91136
+552.192000 175.56 91136
+552.283136 175.56 91136
+552.374272 175.56 91136
+552.465408 175.56 91136
+552.556544 175.56 91136
+552.647680 175.56 91136
+552.738816 175.56 91136
+552.829952 175.56 91136
+552.921088 175.56 91136
+553.012224 175.56 91136
+553.103360 175.56 91136
+553.194496 175.56 91136
+553.285632 175.56 91136
+553.376768 175.56 91136
+553.467904 175.56 91136
+553.559040 175.56 91136
+553.650176 175.56 91136
+553.741312 175.56 91136
+553.832448 175.56 91136
+553.923584 175.56 91136
+554.014720 175.56 91136
+554.105856 175.56 91136
+554.196992 175.56 91136
+554.288128 175.56 91136
+554.379264 175.56 91136
+554.470400 175.56 91136
+554.561536 175.56 91136
+554.652672 175.56 91136
+554.743808 175.56 91136
+554.834944 175.56 91136
+554.926080 175.56 91136
+555.016704 176.55 90624
+555.107328 176.55 90624
+555.197952 176.55 90624
+555.288576 176.55 90624
+555.379200 176.55 90624
+555.469824 176.55 90624
+555.560448 176.55 90624
+555.651072 176.55 90624
+555.741696 176.55 90624
+555.832320 176.55 90624
+555.922944 176.55 90624
+556.013568 176.55 90624
+556.104192 176.55 90624
+556.194816 176.55 90624
+556.285440 176.55 90624
+556.376064 176.55 90624
+556.466688 176.55 90624
+556.557312 176.55 90624
+556.647936 176.55 90624
+556.738560 176.55 90624
+556.829184 176.55 90624
+556.919808 176.55 90624
+557.010432 176.55 90624
+557.101056 176.55 90624
+557.191680 176.55 90624
+557.282304 176.55 90624
+557.372928 176.55 90624
+557.463552 176.55 90624
+557.554176 176.55 90624
+557.644800 176.55 90624
+557.735424 176.55 90624
+557.826048 176.55 90624
+557.916160 177.56 90112
+558.006272 177.56 90112
+558.096384 177.56 90112
+558.186496 177.56 90112
+558.276608 177.56 90112
+558.366720 177.56 90112
+558.456832 177.56 90112
+558.546944 177.56 90112
+558.637056 177.56 90112
+558.727168 177.56 90112
+558.817280 177.56 90112
+558.907392 177.56 90112
+558.997504 177.56 90112
+559.087616 177.56 90112
+559.177728 177.56 90112
+559.267840 177.56 90112
+559.357952 177.56 90112
+559.448064 177.56 90112
+559.538176 177.56 90112
+559.628288 177.56 90112
+559.718400 177.56 90112
+559.808512 177.56 90112
+559.898624 177.56 90112
+559.988736 177.56 90112
+560.078848 177.56 90112
+560.168960 177.56 90112
+560.259072 177.56 90112
+560.349184 177.56 90112
+560.439296 177.56 90112
+560.529408 177.56 90112
+560.619520 177.56 90112
+560.709632 177.56 90112
+560.799744 177.56 90112
+560.889856 177.56 90112
+560.979968 177.56 90112
+561.070080 177.56 90112
+561.160192 177.56 90112
+561.250304 177.56 90112
+561.340416 177.56 90112
+561.430528 177.56 90112
+561.520640 177.56 90112
+561.610752 177.56 90112
+561.700864 177.56 90112
+561.790976 177.56 90112
+561.881088 177.56 90112
+561.971200 177.56 90112
+562.061312 177.56 90112
+562.151424 177.56 90112
+562.241024 178.57 89600
+562.330624 178.57 89600
+562.420224 178.57 89600
+562.509824 178.57 89600
+562.599424 178.57 89600
+562.689024 178.57 89600
+562.778624 178.57 89600
+562.868224 178.57 89600
+562.957824 178.57 89600
+563.047424 178.57 89600
+563.137024 178.57 89600
+563.226624 178.57 89600
+563.316224 178.57 89600
+563.405824 178.57 89600
+563.495424 178.57 89600
+563.585024 178.57 89600
+563.674624 178.57 89600
+563.764224 178.57 89600
+563.853824 178.57 89600
+563.943424 178.57 89600
+564.033024 178.57 89600
+564.122624 178.57 89600
+564.212224 178.57 89600
+564.301824 178.57 89600
+564.391424 178.57 89600
+564.481024 178.57 89600
+564.570624 178.57 89600
+564.660224 178.57 89600
+564.749824 178.57 89600
+564.839424 178.57 89600
+564.929024 178.57 89600
+565.018624 178.57 89600
+565.107712 179.60 89088
+565.196800 179.60 89088
+565.285888 179.60 89088
+565.374976 179.60 89088
+565.464064 179.60 89088
+565.553152 179.60 89088
+565.642240 179.60 89088
+565.731328 179.60 89088
+565.820416 179.60 89088
+565.909504 179.60 89088
+565.998592 179.60 89088
+566.087680 179.60 89088
+566.176768 179.60 89088
+566.265856 179.60 89088
+566.354944 179.60 89088
+566.444032 179.60 89088
+566.533120 179.60 89088
+566.622208 179.60 89088
+566.711296 179.60 89088
+566.800384 179.60 89088
+566.889472 179.60 89088
+566.978560 179.60 89088
+567.067648 179.60 89088
+567.156736 179.60 89088
+567.245824 179.60 89088
+567.334912 179.60 89088
+567.424000 179.60 89088
+567.513088 179.60 89088
+567.602176 179.60 89088
+567.691264 179.60 89088
+567.780352 179.60 89088
+567.869440 179.60 89088
+567.958528 179.60 89088
+568.047616 179.60 89088
+568.136704 179.60 89088
+568.225792 179.60 89088
+568.314880 179.60 89088
+568.403968 179.60 89088
+568.493056 179.60 89088
+568.582144 179.60 89088
+568.671232 179.60 89088
+568.760320 179.60 89088
+568.849408 179.60 89088
+568.938496 179.60 89088
+569.027584 179.60 89088
+569.116672 179.60 89088
+569.205760 179.60 89088
+569.294848 179.60 89088
+569.383936 179.60 89088
+569.473024 179.60 89088
+569.562112 179.60 89088
+569.651200 179.60 89088
+569.740288 179.60 89088
+569.829376 179.60 89088
+569.918464 179.60 89088
+570.007552 179.60 89088
+570.096640 179.60 89088
+570.185728 179.60 89088
+570.274816 179.60 89088
+570.363904 179.60 89088
+570.452992 179.60 89088
+570.542080 179.60 89088
+570.631168 179.60 89088
+570.720256 179.60 89088
+570.808832 180.64 88576
+570.897408 180.64 88576
+570.985984 180.64 88576
+571.074560 180.64 88576
+571.163136 180.64 88576
+571.251712 180.64 88576
+571.340288 180.64 88576
+571.428864 180.64 88576
+571.517440 180.64 88576
+571.606016 180.64 88576
+571.694592 180.64 88576
+571.783168 180.64 88576
+571.871744 180.64 88576
+571.960320 180.64 88576
+572.048896 180.64 88576
+572.137472 180.64 88576
+572.226048 180.64 88576
+572.314624 180.64 88576
+572.403200 180.64 88576
+572.491776 180.64 88576
+572.580352 180.64 88576
+572.668928 180.64 88576
+572.757504 180.64 88576
+572.846080 180.64 88576
+572.934656 180.64 88576
+573.023232 180.64 88576
+573.111808 180.64 88576
+573.200384 180.64 88576
+573.288960 180.64 88576
+573.377536 180.64 88576
+573.466112 180.64 88576
+573.554688 180.64 88576
+573.642752 181.69 88064
+573.730816 181.69 88064
+573.818880 181.69 88064
+573.906944 181.69 88064
+573.995008 181.69 88064
+574.083072 181.69 88064
+574.171136 181.69 88064
+574.259200 181.69 88064
+574.347264 181.69 88064
+574.435328 181.69 88064
+574.523392 181.69 88064
+574.611456 181.69 88064
+574.699520 181.69 88064
+574.787584 181.69 88064
+574.875648 181.69 88064
+574.963712 181.69 88064
+575.051776 181.69 88064
+575.139840 181.69 88064
+575.227904 181.69 88064
+575.315968 181.69 88064
+575.404032 181.69 88064
+575.492096 181.69 88064
+575.580160 181.69 88064
+575.668224 181.69 88064
+575.756288 181.69 88064
+575.844352 181.69 88064
+575.932416 181.69 88064
+576.020480 181.69 88064
+576.108544 181.69 88064
+576.196608 181.69 88064
+576.284672 181.69 88064
+576.372736 181.69 88064
+576.460800 181.69 88064
+576.548864 181.69 88064
+576.636928 181.69 88064
+576.724992 181.69 88064
+576.813056 181.69 88064
+576.901120 181.69 88064
+576.989184 181.69 88064
+577.077248 181.69 88064
+577.165312 181.69 88064
+577.253376 181.69 88064
+577.341440 181.69 88064
+577.429504 181.69 88064
+577.517568 181.69 88064
+577.605632 181.69 88064
+577.693696 181.69 88064
+577.781760 181.69 88064
+577.869312 182.75 87552
+577.956864 182.75 87552
+578.044416 182.75 87552
+578.131968 182.75 87552
+578.219520 182.75 87552
+578.307072 182.75 87552
+578.394624 182.75 87552
+578.482176 182.75 87552
+578.569728 182.75 87552
+578.657280 182.75 87552
+578.744832 182.75 87552
+578.832384 182.75 87552
+578.919936 182.75 87552
+579.007488 182.75 87552
+579.095040 182.75 87552
+579.182592 182.75 87552
+579.270144 182.75 87552
+579.357696 182.75 87552
+579.445248 182.75 87552
+579.532800 182.75 87552
+579.620352 182.75 87552
+579.707904 182.75 87552
+579.795456 182.75 87552
+579.883008 182.75 87552
+579.970560 182.75 87552
+580.058112 182.75 87552
+580.145664 182.75 87552
+580.233216 182.75 87552
+580.320768 182.75 87552
+580.408320 182.75 87552
+580.495872 182.75 87552
+580.583424 182.75 87552
+580.670464 183.82 87040
+580.757504 183.82 87040
+580.844544 183.82 87040
+580.931584 183.82 87040
+581.018624 183.82 87040
+581.105664 183.82 87040
+581.192704 183.82 87040
+581.279744 183.82 87040
+581.366784 183.82 87040
+581.453824 183.82 87040
+581.540864 183.82 87040
+581.627904 183.82 87040
+581.714944 183.82 87040
+581.801984 183.82 87040
+581.889024 183.82 87040
+581.976064 183.82 87040
+582.063104 183.82 87040
+582.150144 183.82 87040
+582.237184 183.82 87040
+582.324224 183.82 87040
+582.411264 183.82 87040
+582.498304 183.82 87040
+582.585344 183.82 87040
+582.672384 183.82 87040
+582.759424 183.82 87040
+582.846464 183.82 87040
+582.933504 183.82 87040
+583.020544 183.82 87040
+583.107584 183.82 87040
+583.194624 183.82 87040
+583.281664 183.82 87040
+583.368704 183.82 87040
+583.455232 184.91 86528
+583.541760 184.91 86528
+583.628288 184.91 86528
+583.714816 184.91 86528
+583.801344 184.91 86528
+583.887872 184.91 86528
+583.974400 184.91 86528
+584.060928 184.91 86528
+584.147456 184.91 86528
+584.233984 184.91 86528
+584.320512 184.91 86528
+584.407040 184.91 86528
+584.493568 184.91 86528
+584.580096 184.91 86528
+584.666624 184.91 86528
+584.753152 184.91 86528
+584.839680 184.91 86528
+584.926208 184.91 86528
+585.012736 184.91 86528
+585.099264 184.91 86528
+585.185792 184.91 86528
+585.272320 184.91 86528
+585.358848 184.91 86528
+585.445376 184.91 86528
+585.531904 184.91 86528
+585.618432 184.91 86528
+585.704960 184.91 86528
+585.791488 184.91 86528
+585.878016 184.91 86528
+585.964544 184.91 86528
+586.051072 184.91 86528
+586.137600 184.91 86528
+586.223616 186.01 86016
+586.309632 186.01 86016
+586.395648 186.01 86016
+586.481664 186.01 86016
+586.567680 186.01 86016
+586.653696 186.01 86016
+586.739712 186.01 86016
+586.825728 186.01 86016
+586.911744 186.01 86016
+586.997760 186.01 86016
+587.083776 186.01 86016
+587.169792 186.01 86016
+587.255808 186.01 86016
+587.341824 186.01 86016
+587.427840 186.01 86016
+587.513856 186.01 86016
+587.599872 186.01 86016
+587.685888 186.01 86016
+587.771904 186.01 86016
+587.857920 186.01 86016
+587.943936 186.01 86016
+588.029952 186.01 86016
+588.115968 186.01 86016
+588.201984 186.01 86016
+588.288000 186.01 86016
+588.374016 186.01 86016
+588.460032 186.01 86016
+588.546048 186.01 86016
+588.632064 186.01 86016
+588.718080 186.01 86016
+588.804096 186.01 86016
+588.890112 186.01 86016
+588.976128 186.01 86016
+589.062144 186.01 86016
+589.148160 186.01 86016
+589.234176 186.01 86016
+589.320192 186.01 86016
+589.406208 186.01 86016
+589.492224 186.01 86016
+589.578240 186.01 86016
+589.664256 186.01 86016
+589.750272 186.01 86016
+589.836288 186.01 86016
+589.922304 186.01 86016
+590.008320 186.01 86016
+590.094336 186.01 86016
+590.180352 186.01 86016
+590.266368 186.01 86016
+590.351872 187.13 85504
+590.437376 187.13 85504
+590.522880 187.13 85504
+590.608384 187.13 85504
+590.693888 187.13 85504
+590.779392 187.13 85504
+590.864896 187.13 85504
+590.950400 187.13 85504
+591.035904 187.13 85504
+591.121408 187.13 85504
+591.206912 187.13 85504
+591.292416 187.13 85504
+591.377920 187.13 85504
+591.463424 187.13 85504
+591.548928 187.13 85504
+591.634432 187.13 85504
+591.719936 187.13 85504
+591.805440 187.13 85504
+591.890944 187.13 85504
+591.976448 187.13 85504
+592.061952 187.13 85504
+592.147456 187.13 85504
+592.232960 187.13 85504
+592.318464 187.13 85504
+592.403968 187.13 85504
+592.489472 187.13 85504
+592.574976 187.13 85504
+592.660480 187.13 85504
+592.745984 187.13 85504
+592.831488 187.13 85504
+592.916992 187.13 85504
+593.002496 187.13 85504
+593.087488 188.25 84992
+593.172480 188.25 84992
+593.257472 188.25 84992
+593.342464 188.25 84992
+593.427456 188.25 84992
+593.512448 188.25 84992
+593.597440 188.25 84992
+593.682432 188.25 84992
+593.767424 188.25 84992
+593.852416 188.25 84992
+593.937408 188.25 84992
+594.022400 188.25 84992
+594.107392 188.25 84992
+594.192384 188.25 84992
+594.277376 188.25 84992
+594.362368 188.25 84992
+594.447360 188.25 84992
+594.532352 188.25 84992
+594.617344 188.25 84992
+594.702336 188.25 84992
+594.787328 188.25 84992
+594.872320 188.25 84992
+594.957312 188.25 84992
+595.042304 188.25 84992
+595.127296 188.25 84992
+595.212288 188.25 84992
+595.297280 188.25 84992
+595.382272 188.25 84992
+595.467264 188.25 84992
+595.552256 188.25 84992
+595.637248 188.25 84992
+595.722240 188.25 84992
+595.807232 188.25 84992
+595.892224 188.25 84992
+595.977216 188.25 84992
+596.062208 188.25 84992
+596.147200 188.25 84992
+596.232192 188.25 84992
+596.317184 188.25 84992
+596.402176 188.25 84992
+596.487168 188.25 84992
+596.572160 188.25 84992
+596.657152 188.25 84992
+596.742144 188.25 84992
+596.827136 188.25 84992
+596.912128 188.25 84992
+596.997120 188.25 84992
+597.082112 188.25 84992
+597.166592 189.39 84480
+597.251072 189.39 84480
+597.335552 189.39 84480
+597.420032 189.39 84480
+597.504512 189.39 84480
+597.588992 189.39 84480
+597.673472 189.39 84480
+597.757952 189.39 84480
+597.842432 189.39 84480
+597.926912 189.39 84480
+598.011392 189.39 84480
+598.095872 189.39 84480
+598.180352 189.39 84480
+598.264832 189.39 84480
+598.349312 189.39 84480
+598.433792 189.39 84480
+598.518272 189.39 84480
+598.602752 189.39 84480
+598.687232 189.39 84480
+598.771712 189.39 84480
+598.856192 189.39 84480
+598.940672 189.39 84480
+599.025152 189.39 84480
+599.109632 189.39 84480
+599.194112 189.39 84480
+599.278592 189.39 84480
+599.363072 189.39 84480
+599.447552 189.39 84480
+599.532032 189.39 84480
+599.616512 189.39 84480
+599.700992 189.39 84480
+599.785472 189.39 84480
+599.869440 190.55 83968
+599.953408 190.55 83968
+600.037376 190.55 83968
+600.121344 190.55 83968
+600.205312 190.55 83968
+600.289280 190.55 83968
+600.373248 190.55 83968
+600.457216 190.55 83968
+600.541184 190.55 83968
+600.625152 190.55 83968
+600.709120 190.55 83968
+600.793088 190.55 83968
+600.877056 190.55 83968
+600.961024 190.55 83968
+601.044992 190.55 83968
+601.128960 190.55 83968
+601.212928 190.55 83968
+601.296896 190.55 83968
+601.380864 190.55 83968
+601.464832 190.55 83968
+601.548800 190.55 83968
+601.632768 190.55 83968
+601.716736 190.55 83968
+601.800704 190.55 83968
+601.884672 190.55 83968
+601.968640 190.55 83968
+602.052608 190.55 83968
+602.136576 190.55 83968
+602.220544 190.55 83968
+602.304512 190.55 83968
+602.388480 190.55 83968
+602.472448 190.55 83968
+602.555904 191.72 83456
+602.639360 191.72 83456
+602.722816 191.72 83456
+602.806272 191.72 83456
+602.889728 191.72 83456
+602.973184 191.72 83456
+603.056640 191.72 83456
+603.140096 191.72 83456
+603.223552 191.72 83456
+603.307008 191.72 83456
+603.390464 191.72 83456
+603.473920 191.72 83456
+603.557376 191.72 83456
+603.640832 191.72 83456
+603.724288 191.72 83456
+603.807744 191.72 83456
+603.891200 191.72 83456
+603.974656 191.72 83456
+604.058112 191.72 83456
+604.141568 191.72 83456
+604.225024 191.72 83456
+604.308480 191.72 83456
+604.391936 191.72 83456
+604.475392 191.72 83456
+604.558848 191.72 83456
+604.642304 191.72 83456
+604.725760 191.72 83456
+604.809216 191.72 83456
+604.892672 191.72 83456
+604.976128 191.72 83456
+605.059584 191.72 83456
+605.143040 191.72 83456
+605.226496 191.72 83456
+605.309952 191.72 83456
+605.393408 191.72 83456
+605.476864 191.72 83456
+605.560320 191.72 83456
+605.643776 191.72 83456
+605.727232 191.72 83456
+605.810688 191.72 83456
+605.894144 191.72 83456
+605.977600 191.72 83456
+606.061056 191.72 83456
+606.144512 191.72 83456
+606.227968 191.72 83456
+606.311424 191.72 83456
+606.394880 191.72 83456
+606.478336 191.72 83456
+606.561792 191.72 83456
+606.645248 191.72 83456
+606.728704 191.72 83456
+606.812160 191.72 83456
+606.895616 191.72 83456
+606.979072 191.72 83456
+607.062528 191.72 83456
+607.145984 191.72 83456
+607.229440 191.72 83456
+607.312896 191.72 83456
+607.396352 191.72 83456
+607.479808 191.72 83456
+607.563264 191.72 83456
+607.646720 191.72 83456
+607.730176 191.72 83456
+607.813632 191.72 83456
+607.897088 191.72 83456
+607.980544 191.72 83456
+608.064000 191.72 83456
+608.147456 191.72 83456
+608.230912 191.72 83456
+608.314368 191.72 83456
+608.397824 191.72 83456
+608.481280 191.72 83456
+608.564736 191.72 83456
+608.648192 191.72 83456
+608.731648 191.72 83456
+608.815104 191.72 83456
+608.898560 191.72 83456
+608.982016 191.72 83456
+609.065472 191.72 83456
+609.148928 191.72 83456
+609.231872 192.90 82944
+609.314816 192.90 82944
+609.397760 192.90 82944
+609.480704 192.90 82944
+609.563648 192.90 82944
+609.646592 192.90 82944
+609.729536 192.90 82944
+609.812480 192.90 82944
+609.895424 192.90 82944
+609.978368 192.90 82944
+610.061312 192.90 82944
+610.144256 192.90 82944
+610.227200 192.90 82944
+610.310144 192.90 82944
+610.393088 192.90 82944
+610.476032 192.90 82944
+610.558976 192.90 82944
+610.641920 192.90 82944
+610.724864 192.90 82944
+610.807808 192.90 82944
+610.890752 192.90 82944
+610.973696 192.90 82944
+611.056640 192.90 82944
+611.139584 192.90 82944
+611.222528 192.90 82944
+611.305472 192.90 82944
+611.388416 192.90 82944
+611.471360 192.90 82944
+611.554304 192.90 82944
+611.637248 192.90 82944
+611.720192 192.90 82944
+611.803136 192.90 82944
+611.886080 192.90 82944
+611.969024 192.90 82944
+612.051968 192.90 82944
+612.134912 192.90 82944
+612.217856 192.90 82944
+612.300800 192.90 82944
+612.383744 192.90 82944
+612.466688 192.90 82944
+612.549632 192.90 82944
+612.632576 192.90 82944
+612.715520 192.90 82944
+612.798464 192.90 82944
+612.881408 192.90 82944
+612.964352 192.90 82944
+613.047296 192.90 82944
+613.130240 192.90 82944
+613.212672 194.10 82432
+613.295104 194.10 82432
+613.377536 194.10 82432
+613.459968 194.10 82432
+613.542400 194.10 82432
+613.624832 194.10 82432
+613.707264 194.10 82432
+613.789696 194.10 82432
+613.872128 194.10 82432
+613.954560 194.10 82432
+614.036992 194.10 82432
+614.119424 194.10 82432
+614.201856 194.10 82432
+614.284288 194.10 82432
+614.366720 194.10 82432
+614.449152 194.10 82432
+614.531584 194.10 82432
+614.614016 194.10 82432
+614.696448 194.10 82432
+614.778880 194.10 82432
+614.861312 194.10 82432
+614.943744 194.10 82432
+615.026176 194.10 82432
+615.108608 194.10 82432
+615.191040 194.10 82432
+615.273472 194.10 82432
+615.355904 194.10 82432
+615.438336 194.10 82432
+615.520768 194.10 82432
+615.603200 194.10 82432
+615.685632 194.10 82432
+615.768064 194.10 82432
+615.850496 194.10 82432
+615.932928 194.10 82432
+616.015360 194.10 82432
+616.097792 194.10 82432
+616.180224 194.10 82432
+616.262656 194.10 82432
+616.345088 194.10 82432
+616.427520 194.10 82432
+616.509952 194.10 82432
+616.592384 194.10 82432
+616.674816 194.10 82432
+616.757248 194.10 82432
+616.839680 194.10 82432
+616.922112 194.10 82432
+617.004544 194.10 82432
+617.086976 194.10 82432
+617.168896 195.31 81920
+617.250816 195.31 81920
+617.332736 195.31 81920
+617.414656 195.31 81920
+617.496576 195.31 81920
+617.578496 195.31 81920
+617.660416 195.31 81920
+617.742336 195.31 81920
+617.824256 195.31 81920
+617.906176 195.31 81920
+617.988096 195.31 81920
+618.070016 195.31 81920
+618.151936 195.31 81920
+618.233856 195.31 81920
+618.315776 195.31 81920
+618.397696 195.31 81920
+618.479616 195.31 81920
+618.561536 195.31 81920
+618.643456 195.31 81920
+618.725376 195.31 81920
+618.807296 195.31 81920
+618.889216 195.31 81920
+618.971136 195.31 81920
+619.053056 195.31 81920
+619.134976 195.31 81920
+619.216896 195.31 81920
+619.298816 195.31 81920
+619.380736 195.31 81920
+619.462656 195.31 81920
+619.544576 195.31 81920
+619.626496 195.31 81920
+619.708416 195.31 81920
+619.789824 196.54 81408
+619.871232 196.54 81408
+619.952640 196.54 81408
+620.034048 196.54 81408
+620.115456 196.54 81408
+620.196864 196.54 81408
+620.278272 196.54 81408
+620.359680 196.54 81408
+620.441088 196.54 81408
+620.522496 196.54 81408
+620.603904 196.54 81408
+620.685312 196.54 81408
+620.766720 196.54 81408
+620.848128 196.54 81408
+620.929536 196.54 81408
+621.010944 196.54 81408
+621.092352 196.54 81408
+621.173760 196.54 81408
+621.255168 196.54 81408
+621.336576 196.54 81408
+621.417984 196.54 81408
+621.499392 196.54 81408
+621.580800 196.54 81408
+621.662208 196.54 81408
+621.743616 196.54 81408
+621.825024 196.54 81408
+621.906432 196.54 81408
+621.987840 196.54 81408
+622.069248 196.54 81408
+622.150656 196.54 81408
+622.232064 196.54 81408
+622.313472 196.54 81408
+622.394880 196.54 81408
+622.476288 196.54 81408
+622.557696 196.54 81408
+622.639104 196.54 81408
+622.720512 196.54 81408
+622.801920 196.54 81408
+622.883328 196.54 81408
+622.964736 196.54 81408
+623.046144 196.54 81408
+623.127552 196.54 81408
+623.208960 196.54 81408
+623.290368 196.54 81408
+623.371776 196.54 81408
+623.453184 196.54 81408
+623.534592 196.54 81408
+623.616000 196.54 81408
+623.696896 197.78 80896
+623.777792 197.78 80896
+623.858688 197.78 80896
+623.939584 197.78 80896
+624.020480 197.78 80896
+624.101376 197.78 80896
+624.182272 197.78 80896
+624.263168 197.78 80896
+624.344064 197.78 80896
+624.424960 197.78 80896
+624.505856 197.78 80896
+624.586752 197.78 80896
+624.667648 197.78 80896
+624.748544 197.78 80896
+624.829440 197.78 80896
+624.910336 197.78 80896
+624.991232 197.78 80896
+625.072128 197.78 80896
+625.153024 197.78 80896
+625.233920 197.78 80896
+625.314816 197.78 80896
+625.395712 197.78 80896
+625.476608 197.78 80896
+625.557504 197.78 80896
+625.638400 197.78 80896
+625.719296 197.78 80896
+625.800192 197.78 80896
+625.881088 197.78 80896
+625.961984 197.78 80896
+626.042880 197.78 80896
+626.123776 197.78 80896
+626.204672 197.78 80896
+626.285056 199.04 80384
+626.365440 199.04 80384
+626.445824 199.04 80384
+626.526208 199.04 80384
+626.606592 199.04 80384
+626.686976 199.04 80384
+626.767360 199.04 80384
+626.847744 199.04 80384
+626.928128 199.04 80384
+627.008512 199.04 80384
+627.088896 199.04 80384
+627.169280 199.04 80384
+627.249664 199.04 80384
+627.330048 199.04 80384
+627.410432 199.04 80384
+627.490816 199.04 80384
+627.571200 199.04 80384
+627.651584 199.04 80384
+627.731968 199.04 80384
+627.812352 199.04 80384
+627.892736 199.04 80384
+627.973120 199.04 80384
+628.053504 199.04 80384
+628.133888 199.04 80384
+628.214272 199.04 80384
+628.294656 199.04 80384
+628.375040 199.04 80384
+628.455424 199.04 80384
+628.535808 199.04 80384
+628.616192 199.04 80384
+628.696576 199.04 80384
+628.776960 199.04 80384
+628.857344 199.04 80384
+628.937728 199.04 80384
+629.018112 199.04 80384
+629.098496 199.04 80384
+629.178880 199.04 80384
+629.259264 199.04 80384
+629.339648 199.04 80384
+629.420032 199.04 80384
+629.500416 199.04 80384
+629.580800 199.04 80384
+629.661184 199.04 80384
+629.741568 199.04 80384
+629.821952 199.04 80384
+629.902336 199.04 80384
+629.982720 199.04 80384
+630.063104 199.04 80384
+630.143488 199.04 80384
+630.223872 199.04 80384
+630.304256 199.04 80384
+630.384640 199.04 80384
+630.465024 199.04 80384
+630.545408 199.04 80384
+630.625792 199.04 80384
+630.706176 199.04 80384
+630.786560 199.04 80384
+630.866944 199.04 80384
+630.947328 199.04 80384
+631.027712 199.04 80384
+631.108096 199.04 80384
+631.188480 199.04 80384
+631.268864 199.04 80384
+631.349248 199.04 80384
+631.429632 199.04 80384
+631.510016 199.04 80384
+631.590400 199.04 80384
+631.670784 199.04 80384
+631.751168 199.04 80384
+631.831552 199.04 80384
+631.911936 199.04 80384
+631.992320 199.04 80384
+632.072704 199.04 80384
+632.153088 199.04 80384
+632.233472 199.04 80384
+632.313856 199.04 80384
+632.394240 199.04 80384
+632.474624 199.04 80384
+632.555008 199.04 80384
+632.635392 199.04 80384
+632.715776 199.04 80384
+632.796160 199.04 80384
+632.876544 199.04 80384
+632.956928 199.04 80384
+633.037312 199.04 80384
+633.117696 199.04 80384
+633.198080 199.04 80384
+633.278464 199.04 80384
+633.358848 199.04 80384
+633.439232 199.04 80384
+633.519616 199.04 80384
+633.600000 199.04 80384
+633.680384 199.04 80384
+633.760768 199.04 80384
+633.841152 199.04 80384
+633.921536 199.04 80384
+634.001408 200.32 79872
+634.081280 200.32 79872
+634.161152 200.32 79872
+634.241024 200.32 79872
+634.320896 200.32 79872
+634.400768 200.32 79872
+634.480640 200.32 79872
+634.560512 200.32 79872
+634.640384 200.32 79872
+634.720256 200.32 79872
+634.800128 200.32 79872
+634.880000 200.32 79872
+634.959872 200.32 79872
+635.039744 200.32 79872
+635.119616 200.32 79872
+635.199488 200.32 79872
+635.279360 200.32 79872
+635.359232 200.32 79872
+635.439104 200.32 79872
+635.518976 200.32 79872
+635.598848 200.32 79872
+635.678720 200.32 79872
+635.758592 200.32 79872
+635.838464 200.32 79872
+635.918336 200.32 79872
+635.998208 200.32 79872
+636.078080 200.32 79872
+636.157952 200.32 79872
+636.237824 200.32 79872
+636.317696 200.32 79872
+636.397568 200.32 79872
+636.477440 200.32 79872
+636.556800 201.61 79360
+636.636160 201.61 79360
+636.715520 201.61 79360
+636.794880 201.61 79360
+636.874240 201.61 79360
+636.953600 201.61 79360
+637.032960 201.61 79360
+637.112320 201.61 79360
+637.191680 201.61 79360
+637.271040 201.61 79360
+637.350400 201.61 79360
+637.429760 201.61 79360
+637.509120 201.61 79360
+637.588480 201.61 79360
+637.667840 201.61 79360
+637.747200 201.61 79360
+637.826560 201.61 79360
+637.905920 201.61 79360
+637.985280 201.61 79360
+638.064640 201.61 79360
+638.144000 201.61 79360
+638.223360 201.61 79360
+638.302720 201.61 79360
+638.382080 201.61 79360
+638.461440 201.61 79360
+638.540800 201.61 79360
+638.620160 201.61 79360
+638.699520 201.61 79360
+638.778880 201.61 79360
+638.858240 201.61 79360
+638.937600 201.61 79360
+639.016960 201.61 79360
+639.096320 201.61 79360
+639.175680 201.61 79360
+639.255040 201.61 79360
+639.334400 201.61 79360
+639.413760 201.61 79360
+639.493120 201.61 79360
+639.572480 201.61 79360
+639.651840 201.61 79360
+639.731200 201.61 79360
+639.810560 201.61 79360
+639.889920 201.61 79360
+639.969280 201.61 79360
+640.048640 201.61 79360
+640.128000 201.61 79360
+640.207360 201.61 79360
+640.286720 201.61 79360
+640.365568 202.92 78848
+640.444416 202.92 78848
+640.523264 202.92 78848
+640.602112 202.92 78848
+640.680960 202.92 78848
+640.759808 202.92 78848
+640.838656 202.92 78848
+640.917504 202.92 78848
+640.996352 202.92 78848
+641.075200 202.92 78848
+641.154048 202.92 78848
+641.232896 202.92 78848
+641.311744 202.92 78848
+641.390592 202.92 78848
+641.469440 202.92 78848
+641.548288 202.92 78848
+641.627136 202.92 78848
+641.705984 202.92 78848
+641.784832 202.92 78848
+641.863680 202.92 78848
+641.942528 202.92 78848
+642.021376 202.92 78848
+642.100224 202.92 78848
+642.179072 202.92 78848
+642.257920 202.92 78848
+642.336768 202.92 78848
+642.415616 202.92 78848
+642.494464 202.92 78848
+642.573312 202.92 78848
+642.652160 202.92 78848
+642.731008 202.92 78848
+642.809856 202.92 78848
+642.888704 202.92 78848
+642.967552 202.92 78848
+643.046400 202.92 78848
+643.125248 202.92 78848
+643.204096 202.92 78848
+643.282944 202.92 78848
+643.361792 202.92 78848
+643.440640 202.92 78848
+643.519488 202.92 78848
+643.598336 202.92 78848
+643.677184 202.92 78848
+643.756032 202.92 78848
+643.834880 202.92 78848
+643.913728 202.92 78848
+643.992576 202.92 78848
+644.071424 202.92 78848
+644.150272 202.92 78848
+644.229120 202.92 78848
+644.307968 202.92 78848
+644.386816 202.92 78848
+644.465664 202.92 78848
+644.544512 202.92 78848
+644.623360 202.92 78848
+644.702208 202.92 78848
+644.781056 202.92 78848
+644.859904 202.92 78848
+644.938752 202.92 78848
+645.017600 202.92 78848
+645.096448 202.92 78848
+645.175296 202.92 78848
+645.254144 202.92 78848
+645.332992 202.92 78848
+645.411328 204.25 78336
+645.489664 204.25 78336
+645.568000 204.25 78336
+645.646336 204.25 78336
+645.724672 204.25 78336
+645.803008 204.25 78336
+645.881344 204.25 78336
+645.959680 204.25 78336
+646.038016 204.25 78336
+646.116352 204.25 78336
+646.194688 204.25 78336
+646.273024 204.25 78336
+646.351360 204.25 78336
+646.429696 204.25 78336
+646.508032 204.25 78336
+646.586368 204.25 78336
+646.664704 204.25 78336
+646.743040 204.25 78336
+646.821376 204.25 78336
+646.899712 204.25 78336
+646.978048 204.25 78336
+647.056384 204.25 78336
+647.134720 204.25 78336
+647.213056 204.25 78336
+647.291392 204.25 78336
+647.369728 204.25 78336
+647.448064 204.25 78336
+647.526400 204.25 78336
+647.604736 204.25 78336
+647.683072 204.25 78336
+647.761408 204.25 78336
+647.839744 204.25 78336
+647.917568 205.59 77824
+647.995392 205.59 77824
+648.073216 205.59 77824
+648.151040 205.59 77824
+648.228864 205.59 77824
+648.306688 205.59 77824
+648.384512 205.59 77824
+648.462336 205.59 77824
+648.540160 205.59 77824
+648.617984 205.59 77824
+648.695808 205.59 77824
+648.773632 205.59 77824
+648.851456 205.59 77824
+648.929280 205.59 77824
+649.007104 205.59 77824
+649.084928 205.59 77824
+649.162752 205.59 77824
+649.240576 205.59 77824
+649.318400 205.59 77824
+649.396224 205.59 77824
+649.474048 205.59 77824
+649.551872 205.59 77824
+649.629696 205.59 77824
+649.707520 205.59 77824
+649.785344 205.59 77824
+649.863168 205.59 77824
+649.940992 205.59 77824
+650.018816 205.59 77824
+650.096640 205.59 77824
+650.174464 205.59 77824
+650.252288 205.59 77824
+650.330112 205.59 77824
+650.407936 205.59 77824
+650.485760 205.59 77824
+650.563584 205.59 77824
+650.641408 205.59 77824
+650.719232 205.59 77824
+650.797056 205.59 77824
+650.874880 205.59 77824
+650.952704 205.59 77824
+651.030528 205.59 77824
+651.108352 205.59 77824
+651.186176 205.59 77824
+651.264000 205.59 77824
+651.341824 205.59 77824
+651.419648 205.59 77824
+651.497472 205.59 77824
+651.575296 205.59 77824
+651.653120 205.59 77824
+651.730944 205.59 77824
+651.808768 205.59 77824
+651.886592 205.59 77824
+651.964416 205.59 77824
+652.042240 205.59 77824
+652.120064 205.59 77824
+652.197888 205.59 77824
+652.275712 205.59 77824
+652.353536 205.59 77824
+652.431360 205.59 77824
+652.509184 205.59 77824
+652.587008 205.59 77824
+652.664832 205.59 77824
+652.742656 205.59 77824
+652.820480 205.59 77824
+652.898304 205.59 77824
+652.976128 205.59 77824
+653.053952 205.59 77824
+653.131776 205.59 77824
+653.209600 205.59 77824
+653.287424 205.59 77824
+653.365248 205.59 77824
+653.443072 205.59 77824
+653.520896 205.59 77824
+653.598720 205.59 77824
+653.676544 205.59 77824
+653.754368 205.59 77824
+653.832192 205.59 77824
+653.910016 205.59 77824
+653.987840 205.59 77824
+654.065664 205.59 77824
+654.143488 205.59 77824
+654.221312 205.59 77824
+654.299136 205.59 77824
+654.376960 205.59 77824
+654.454784 205.59 77824
+654.532608 205.59 77824
+654.610432 205.59 77824
+654.688256 205.59 77824
+654.766080 205.59 77824
+654.843904 205.59 77824
+654.921728 205.59 77824
+654.999552 205.59 77824
+655.077376 205.59 77824
+655.155200 205.59 77824
+655.233024 205.59 77824
+655.310848 205.59 77824
+655.388160 206.95 77312
+655.465472 206.95 77312
+655.542784 206.95 77312
+655.620096 206.95 77312
+655.697408 206.95 77312
+655.774720 206.95 77312
+655.852032 206.95 77312
+655.929344 206.95 77312
+656.006656 206.95 77312
+656.083968 206.95 77312
+656.161280 206.95 77312
+656.238592 206.95 77312
+656.315904 206.95 77312
+656.393216 206.95 77312
+656.470528 206.95 77312
+656.547840 206.95 77312
+656.625152 206.95 77312
+656.702464 206.95 77312
+656.779776 206.95 77312
+656.857088 206.95 77312
+656.934400 206.95 77312
+657.011712 206.95 77312
+657.089024 206.95 77312
+657.166336 206.95 77312
+657.243648 206.95 77312
+657.320960 206.95 77312
+657.398272 206.95 77312
+657.475584 206.95 77312
+657.552896 206.95 77312
+657.630208 206.95 77312
+657.707520 206.95 77312
+657.784832 206.95 77312
+657.861632 208.33 76800
+657.938432 208.33 76800
+658.015232 208.33 76800
+658.092032 208.33 76800
+658.168832 208.33 76800
+658.245632 208.33 76800
+658.322432 208.33 76800
+658.399232 208.33 76800
+658.476032 208.33 76800
+658.552832 208.33 76800
+658.629632 208.33 76800
+658.706432 208.33 76800
+658.783232 208.33 76800
+658.860032 208.33 76800
+658.936832 208.33 76800
+659.013632 208.33 76800
+659.090432 208.33 76800
+659.167232 208.33 76800
+659.244032 208.33 76800
+659.320832 208.33 76800
+659.397632 208.33 76800
+659.474432 208.33 76800
+659.551232 208.33 76800
+659.628032 208.33 76800
+659.704832 208.33 76800
+659.781632 208.33 76800
+659.858432 208.33 76800
+659.935232 208.33 76800
+660.012032 208.33 76800
+660.088832 208.33 76800
+660.165632 208.33 76800
+660.242432 208.33 76800
+660.319232 208.33 76800
+660.396032 208.33 76800
+660.472832 208.33 76800
+660.549632 208.33 76800
+660.626432 208.33 76800
+660.703232 208.33 76800
+660.780032 208.33 76800
+660.856832 208.33 76800
+660.933632 208.33 76800
+661.010432 208.33 76800
+661.087232 208.33 76800
+661.164032 208.33 76800
+661.240832 208.33 76800
+661.317632 208.33 76800
+661.394432 208.33 76800
+661.471232 208.33 76800
+661.548032 208.33 76800
+661.624832 208.33 76800
+661.701632 208.33 76800
+661.778432 208.33 76800
+661.855232 208.33 76800
+661.932032 208.33 76800
+662.008832 208.33 76800
+662.085632 208.33 76800
+662.162432 208.33 76800
+662.239232 208.33 76800
+662.316032 208.33 76800
+662.392832 208.33 76800
+662.469632 208.33 76800
+662.546432 208.33 76800
+662.623232 208.33 76800
+662.700032 208.33 76800
+662.776320 209.73 76288
+662.852608 209.73 76288
+662.928896 209.73 76288
+663.005184 209.73 76288
+663.081472 209.73 76288
+663.157760 209.73 76288
+663.234048 209.73 76288
+663.310336 209.73 76288
+663.386624 209.73 76288
+663.462912 209.73 76288
+663.539200 209.73 76288
+663.615488 209.73 76288
+663.691776 209.73 76288
+663.768064 209.73 76288
+663.844352 209.73 76288
+663.920640 209.73 76288
+663.996928 209.73 76288
+664.073216 209.73 76288
+664.149504 209.73 76288
+664.225792 209.73 76288
+664.302080 209.73 76288
+664.378368 209.73 76288
+664.454656 209.73 76288
+664.530944 209.73 76288
+664.607232 209.73 76288
+664.683520 209.73 76288
+664.759808 209.73 76288
+664.836096 209.73 76288
+664.912384 209.73 76288
+664.988672 209.73 76288
+665.064960 209.73 76288
+665.141248 209.73 76288
+665.217024 211.15 75776
+665.292800 211.15 75776
+665.368576 211.15 75776
+665.444352 211.15 75776
+665.520128 211.15 75776
+665.595904 211.15 75776
+665.671680 211.15 75776
+665.747456 211.15 75776
+665.823232 211.15 75776
+665.899008 211.15 75776
+665.974784 211.15 75776
+666.050560 211.15 75776
+666.126336 211.15 75776
+666.202112 211.15 75776
+666.277888 211.15 75776
+666.353664 211.15 75776
+666.429440 211.15 75776
+666.505216 211.15 75776
+666.580992 211.15 75776
+666.656768 211.15 75776
+666.732544 211.15 75776
+666.808320 211.15 75776
+666.884096 211.15 75776
+666.959872 211.15 75776
+667.035648 211.15 75776
+667.111424 211.15 75776
+667.187200 211.15 75776
+667.262976 211.15 75776
+667.338752 211.15 75776
+667.414528 211.15 75776
+667.490304 211.15 75776
+667.566080 211.15 75776
+667.641856 211.15 75776
+667.717632 211.15 75776
+667.793408 211.15 75776
+667.869184 211.15 75776
+667.944960 211.15 75776
+668.020736 211.15 75776
+668.096512 211.15 75776
+668.172288 211.15 75776
+668.248064 211.15 75776
+668.323840 211.15 75776
+668.399616 211.15 75776
+668.475392 211.15 75776
+668.551168 211.15 75776
+668.626944 211.15 75776
+668.702720 211.15 75776
+668.778496 211.15 75776
+668.854272 211.15 75776
+668.930048 211.15 75776
+669.005824 211.15 75776
+669.081600 211.15 75776
+669.157376 211.15 75776
+669.233152 211.15 75776
+669.308928 211.15 75776
+669.384704 211.15 75776
+669.460480 211.15 75776
+669.536256 211.15 75776
+669.612032 211.15 75776
+669.687808 211.15 75776
+669.763584 211.15 75776
+669.839360 211.15 75776
+669.915136 211.15 75776
+669.990912 211.15 75776
+670.066176 212.59 75264
+670.141440 212.59 75264
+670.216704 212.59 75264
+670.291968 212.59 75264
+670.367232 212.59 75264
+670.442496 212.59 75264
+670.517760 212.59 75264
+670.593024 212.59 75264
+670.668288 212.59 75264
+670.743552 212.59 75264
+670.818816 212.59 75264
+670.894080 212.59 75264
+670.969344 212.59 75264
+671.044608 212.59 75264
+671.119872 212.59 75264
+671.195136 212.59 75264
+671.270400 212.59 75264
+671.345664 212.59 75264
+671.420928 212.59 75264
+671.496192 212.59 75264
+671.571456 212.59 75264
+671.646720 212.59 75264
+671.721984 212.59 75264
+671.797248 212.59 75264
+671.872512 212.59 75264
+671.947776 212.59 75264
+672.023040 212.59 75264
+672.098304 212.59 75264
+672.173568 212.59 75264
+672.248832 212.59 75264
+672.324096 212.59 75264
+672.399360 212.59 75264
+672.474624 212.59 75264
+672.549888 212.59 75264
+672.625152 212.59 75264
+672.700416 212.59 75264
+672.775680 212.59 75264
+672.850944 212.59 75264
+672.926208 212.59 75264
+673.001472 212.59 75264
+673.076736 212.59 75264
+673.152000 212.59 75264
+673.227264 212.59 75264
+673.302528 212.59 75264
+673.377792 212.59 75264
+673.453056 212.59 75264
+673.528320 212.59 75264
+673.603584 212.59 75264
+673.678848 212.59 75264
+673.754112 212.59 75264
+673.829376 212.59 75264
+673.904640 212.59 75264
+673.979904 212.59 75264
+674.055168 212.59 75264
+674.130432 212.59 75264
+674.205696 212.59 75264
+674.280960 212.59 75264
+674.356224 212.59 75264
+674.431488 212.59 75264
+674.506752 212.59 75264
+674.582016 212.59 75264
+674.657280 212.59 75264
+674.732544 212.59 75264
+674.807808 212.59 75264
+674.883072 212.59 75264
+674.958336 212.59 75264
+675.033600 212.59 75264
+675.108864 212.59 75264
+675.184128 212.59 75264
+675.259392 212.59 75264
+675.334656 212.59 75264
+675.409920 212.59 75264
+675.485184 212.59 75264
+675.560448 212.59 75264
+675.635712 212.59 75264
+675.710976 212.59 75264
+675.786240 212.59 75264
+675.861504 212.59 75264
+675.936768 212.59 75264
+676.012032 212.59 75264
+676.087296 212.59 75264
+676.162560 212.59 75264
+676.237824 212.59 75264
+676.313088 212.59 75264
+676.388352 212.59 75264
+676.463616 212.59 75264
+676.538880 212.59 75264
+676.614144 212.59 75264
+676.689408 212.59 75264
+676.764672 212.59 75264
+676.839936 212.59 75264
+676.915200 212.59 75264
+676.990464 212.59 75264
+677.065728 212.59 75264
+677.140992 212.59 75264
+677.216256 212.59 75264
+677.291008 214.04 74752
+677.365760 214.04 74752
+677.440512 214.04 74752
+677.515264 214.04 74752
+677.590016 214.04 74752
+677.664768 214.04 74752
+677.739520 214.04 74752
+677.814272 214.04 74752
+677.889024 214.04 74752
+677.963776 214.04 74752
+678.038528 214.04 74752
+678.113280 214.04 74752
+678.188032 214.04 74752
+678.262784 214.04 74752
+678.337536 214.04 74752
+678.412288 214.04 74752
+678.487040 214.04 74752
+678.561792 214.04 74752
+678.636544 214.04 74752
+678.711296 214.04 74752
+678.786048 214.04 74752
+678.860800 214.04 74752
+678.935552 214.04 74752
+679.010304 214.04 74752
+679.085056 214.04 74752
+679.159808 214.04 74752
+679.234560 214.04 74752
+679.309312 214.04 74752
+679.384064 214.04 74752
+679.458816 214.04 74752
+679.533568 214.04 74752
+679.608320 214.04 74752
+679.682560 215.52 74240
+679.756800 215.52 74240
+679.831040 215.52 74240
+679.905280 215.52 74240
+679.979520 215.52 74240
+680.053760 215.52 74240
+680.128000 215.52 74240
+680.202240 215.52 74240
+680.276480 215.52 74240
+680.350720 215.52 74240
+680.424960 215.52 74240
+680.499200 215.52 74240
+680.573440 215.52 74240
+680.647680 215.52 74240
+680.721920 215.52 74240
+680.796160 215.52 74240
+680.870400 215.52 74240
+680.944640 215.52 74240
+681.018880 215.52 74240
+681.093120 215.52 74240
+681.167360 215.52 74240
+681.241600 215.52 74240
+681.315840 215.52 74240
+681.390080 215.52 74240
+681.464320 215.52 74240
+681.538560 215.52 74240
+681.612800 215.52 74240
+681.687040 215.52 74240
+681.761280 215.52 74240
+681.835520 215.52 74240
+681.909760 215.52 74240
+681.984000 215.52 74240
+682.058240 215.52 74240
+682.132480 215.52 74240
+682.206720 215.52 74240
+682.280960 215.52 74240
+682.355200 215.52 74240
+682.429440 215.52 74240
+682.503680 215.52 74240
+682.577920 215.52 74240
+682.652160 215.52 74240
+682.726400 215.52 74240
+682.800640 215.52 74240
+682.874880 215.52 74240
+682.949120 215.52 74240
+683.023360 215.52 74240
+683.097600 215.52 74240
+683.171840 215.52 74240
+683.246080 215.52 74240
+683.320320 215.52 74240
+683.394560 215.52 74240
+683.468800 215.52 74240
+683.543040 215.52 74240
+683.617280 215.52 74240
+683.691520 215.52 74240
+683.765760 215.52 74240
+683.840000 215.52 74240
+683.914240 215.52 74240
+683.988480 215.52 74240
+684.062720 215.52 74240
+684.136960 215.52 74240
+684.211200 215.52 74240
+684.285440 215.52 74240
+684.359680 215.52 74240
+684.433408 217.01 73728
+684.507136 217.01 73728
+684.580864 217.01 73728
+684.654592 217.01 73728
+684.728320 217.01 73728
+684.802048 217.01 73728
+684.875776 217.01 73728
+684.949504 217.01 73728
+685.023232 217.01 73728
+685.096960 217.01 73728
+685.170688 217.01 73728
+685.244416 217.01 73728
+685.318144 217.01 73728
+685.391872 217.01 73728
+685.465600 217.01 73728
+685.539328 217.01 73728
+685.613056 217.01 73728
+685.686784 217.01 73728
+685.760512 217.01 73728
+685.834240 217.01 73728
+685.907968 217.01 73728
+685.981696 217.01 73728
+686.055424 217.01 73728
+686.129152 217.01 73728
+686.202880 217.01 73728
+686.276608 217.01 73728
+686.350336 217.01 73728
+686.424064 217.01 73728
+686.497792 217.01 73728
+686.571520 217.01 73728
+686.645248 217.01 73728
+686.718976 217.01 73728
+686.792704 217.01 73728
+686.866432 217.01 73728
+686.940160 217.01 73728
+687.013888 217.01 73728
+687.087616 217.01 73728
+687.161344 217.01 73728
+687.235072 217.01 73728
+687.308800 217.01 73728
+687.382528 217.01 73728
+687.456256 217.01 73728
+687.529984 217.01 73728
+687.603712 217.01 73728
+687.677440 217.01 73728
+687.751168 217.01 73728
+687.824896 217.01 73728
+687.898624 217.01 73728
+687.972352 217.01 73728
+688.046080 217.01 73728
+688.119808 217.01 73728
+688.193536 217.01 73728
+688.267264 217.01 73728
+688.340992 217.01 73728
+688.414720 217.01 73728
+688.488448 217.01 73728
+688.562176 217.01 73728
+688.635904 217.01 73728
+688.709632 217.01 73728
+688.783360 217.01 73728
+688.857088 217.01 73728
+688.930816 217.01 73728
+689.004544 217.01 73728
+689.078272 217.01 73728
+689.152000 217.01 73728
+689.225728 217.01 73728
+689.299456 217.01 73728
+689.373184 217.01 73728
+689.446912 217.01 73728
+689.520640 217.01 73728
+689.594368 217.01 73728
+689.668096 217.01 73728
+689.741824 217.01 73728
+689.815552 217.01 73728
+689.889280 217.01 73728
+689.963008 217.01 73728
+690.036736 217.01 73728
+690.110464 217.01 73728
+690.184192 217.01 73728
+690.257920 217.01 73728
+690.331648 217.01 73728
+690.405376 217.01 73728
+690.479104 217.01 73728
+690.552832 217.01 73728
+690.626560 217.01 73728
+690.700288 217.01 73728
+690.774016 217.01 73728
+690.847744 217.01 73728
+690.921472 217.01 73728
+690.995200 217.01 73728
+691.068928 217.01 73728
+691.142656 217.01 73728
+691.216384 217.01 73728
+691.290112 217.01 73728
+691.363840 217.01 73728
+691.437568 217.01 73728
+691.510784 218.53 73216
+691.584000 218.53 73216
+691.657216 218.53 73216
+691.730432 218.53 73216
+691.803648 218.53 73216
+691.876864 218.53 73216
+691.950080 218.53 73216
+692.023296 218.53 73216
+692.096512 218.53 73216
+692.169728 218.53 73216
+692.242944 218.53 73216
+692.316160 218.53 73216
+692.389376 218.53 73216
+692.462592 218.53 73216
+692.535808 218.53 73216
+692.609024 218.53 73216
+692.682240 218.53 73216
+692.755456 218.53 73216
+692.828672 218.53 73216
+692.901888 218.53 73216
+692.975104 218.53 73216
+693.048320 218.53 73216
+693.121536 218.53 73216
+693.194752 218.53 73216
+693.267968 218.53 73216
+693.341184 218.53 73216
+693.414400 218.53 73216
+693.487616 218.53 73216
+693.560832 218.53 73216
+693.634048 218.53 73216
+693.707264 218.53 73216
+693.780480 218.53 73216
+693.853696 218.53 73216
+693.926912 218.53 73216
+694.000128 218.53 73216
+694.073344 218.53 73216
+694.146560 218.53 73216
+694.219776 218.53 73216
+694.292992 218.53 73216
+694.366208 218.53 73216
+694.439424 218.53 73216
+694.512640 218.53 73216
+694.585856 218.53 73216
+694.659072 218.53 73216
+694.732288 218.53 73216
+694.805504 218.53 73216
+694.878720 218.53 73216
+694.951936 218.53 73216
+695.025152 218.53 73216
+695.098368 218.53 73216
+695.171584 218.53 73216
+695.244800 218.53 73216
+695.318016 218.53 73216
+695.391232 218.53 73216
+695.464448 218.53 73216
+695.537664 218.53 73216
+695.610880 218.53 73216
+695.684096 218.53 73216
+695.757312 218.53 73216
+695.830528 218.53 73216
+695.903744 218.53 73216
+695.976960 218.53 73216
+696.050176 218.53 73216
+696.123392 218.53 73216
+696.196096 220.07 72704
+696.268800 220.07 72704
+696.341504 220.07 72704
+696.414208 220.07 72704
+696.486912 220.07 72704
+696.559616 220.07 72704
+696.632320 220.07 72704
+696.705024 220.07 72704
+696.777728 220.07 72704
+696.850432 220.07 72704
+696.923136 220.07 72704
+696.995840 220.07 72704
+697.068544 220.07 72704
+697.141248 220.07 72704
+697.213952 220.07 72704
+697.286656 220.07 72704
+697.359360 220.07 72704
+697.432064 220.07 72704
+697.504768 220.07 72704
+697.577472 220.07 72704
+697.650176 220.07 72704
+697.722880 220.07 72704
+697.795584 220.07 72704
+697.868288 220.07 72704
+697.940992 220.07 72704
+698.013696 220.07 72704
+698.086400 220.07 72704
+698.159104 220.07 72704
+698.231808 220.07 72704
+698.304512 220.07 72704
+698.377216 220.07 72704
+698.449920 220.07 72704
+698.522112 221.63 72192
+698.594304 221.63 72192
+698.666496 221.63 72192
+698.738688 221.63 72192
+698.810880 221.63 72192
+698.883072 221.63 72192
+698.955264 221.63 72192
+699.027456 221.63 72192
+699.099648 221.63 72192
+699.171840 221.63 72192
+699.244032 221.63 72192
+699.316224 221.63 72192
+699.388416 221.63 72192
+699.460608 221.63 72192
+699.532800 221.63 72192
+699.604992 221.63 72192
+699.677184 221.63 72192
+699.749376 221.63 72192
+699.821568 221.63 72192
+699.893760 221.63 72192
+699.965952 221.63 72192
+700.038144 221.63 72192
+700.110336 221.63 72192
+700.182528 221.63 72192
+700.254720 221.63 72192
+700.326912 221.63 72192
+700.399104 221.63 72192
+700.471296 221.63 72192
+700.543488 221.63 72192
+700.615680 221.63 72192
+700.687872 221.63 72192
+700.760064 221.63 72192
+700.832256 221.63 72192
+700.904448 221.63 72192
+700.976640 221.63 72192
+701.048832 221.63 72192
+701.121024 221.63 72192
+701.193216 221.63 72192
+701.265408 221.63 72192
+701.337600 221.63 72192
+701.409792 221.63 72192
+701.481984 221.63 72192
+701.554176 221.63 72192
+701.626368 221.63 72192
+701.698560 221.63 72192
+701.770752 221.63 72192
+701.842944 221.63 72192
+701.915136 221.63 72192
+701.987328 221.63 72192
+702.059520 221.63 72192
+702.131712 221.63 72192
+702.203904 221.63 72192
+702.276096 221.63 72192
+702.348288 221.63 72192
+702.420480 221.63 72192
+702.492672 221.63 72192
+702.564864 221.63 72192
+702.637056 221.63 72192
+702.709248 221.63 72192
+702.781440 221.63 72192
+702.853632 221.63 72192
+702.925824 221.63 72192
+702.998016 221.63 72192
+703.070208 221.63 72192
+703.141888 223.21 71680
+703.213568 223.21 71680
+703.285248 223.21 71680
+703.356928 223.21 71680
+703.428608 223.21 71680
+703.500288 223.21 71680
+703.571968 223.21 71680
+703.643648 223.21 71680
+703.715328 223.21 71680
+703.787008 223.21 71680
+703.858688 223.21 71680
+703.930368 223.21 71680
+704.002048 223.21 71680
+704.073728 223.21 71680
+704.145408 223.21 71680
+704.217088 223.21 71680
+704.288768 223.21 71680
+704.360448 223.21 71680
+704.432128 223.21 71680
+704.503808 223.21 71680
+704.575488 223.21 71680
+704.647168 223.21 71680
+704.718848 223.21 71680
+704.790528 223.21 71680
+704.862208 223.21 71680
+704.933888 223.21 71680
+705.005568 223.21 71680
+705.077248 223.21 71680
+705.148928 223.21 71680
+705.220608 223.21 71680
+705.292288 223.21 71680
+705.363968 223.21 71680
+705.435648 223.21 71680
+705.507328 223.21 71680
+705.579008 223.21 71680
+705.650688 223.21 71680
+705.722368 223.21 71680
+705.794048 223.21 71680
+705.865728 223.21 71680
+705.937408 223.21 71680
+706.009088 223.21 71680
+706.080768 223.21 71680
+706.152448 223.21 71680
+706.224128 223.21 71680
+706.295808 223.21 71680
+706.367488 223.21 71680
+706.439168 223.21 71680
+706.510848 223.21 71680
+706.582528 223.21 71680
+706.654208 223.21 71680
+706.725888 223.21 71680
+706.797568 223.21 71680
+706.869248 223.21 71680
+706.940928 223.21 71680
+707.012608 223.21 71680
+707.084288 223.21 71680
+707.155968 223.21 71680
+707.227648 223.21 71680
+707.299328 223.21 71680
+707.371008 223.21 71680
+707.442688 223.21 71680
+707.514368 223.21 71680
+707.586048 223.21 71680
+707.657728 223.21 71680
+707.729408 223.21 71680
+707.801088 223.21 71680
+707.872768 223.21 71680
+707.944448 223.21 71680
+708.016128 223.21 71680
+708.087808 223.21 71680
+708.159488 223.21 71680
+708.231168 223.21 71680
+708.302848 223.21 71680
+708.374528 223.21 71680
+708.446208 223.21 71680
+708.517888 223.21 71680
+708.589568 223.21 71680
+708.661248 223.21 71680
+708.732928 223.21 71680
+708.804608 223.21 71680
+708.876288 223.21 71680
+708.947968 223.21 71680
+709.019648 223.21 71680
+709.091328 223.21 71680
+709.163008 223.21 71680
+709.234688 223.21 71680
+709.306368 223.21 71680
+709.378048 223.21 71680
+709.449728 223.21 71680
+709.521408 223.21 71680
+709.593088 223.21 71680
+709.664768 223.21 71680
+709.736448 223.21 71680
+709.808128 223.21 71680
+709.879808 223.21 71680
+709.951488 223.21 71680
+710.022656 224.82 71168
+710.093824 224.82 71168
+710.164992 224.82 71168
+710.236160 224.82 71168
+710.307328 224.82 71168
+710.378496 224.82 71168
+710.449664 224.82 71168
+710.520832 224.82 71168
+710.592000 224.82 71168
+710.663168 224.82 71168
+710.734336 224.82 71168
+710.805504 224.82 71168
+710.876672 224.82 71168
+710.947840 224.82 71168
+711.019008 224.82 71168
+711.090176 224.82 71168
+711.161344 224.82 71168
+711.232512 224.82 71168
+711.303680 224.82 71168
+711.374848 224.82 71168
+711.446016 224.82 71168
+711.517184 224.82 71168
+711.588352 224.82 71168
+711.659520 224.82 71168
+711.730688 224.82 71168
+711.801856 224.82 71168
+711.873024 224.82 71168
+711.944192 224.82 71168
+712.015360 224.82 71168
+712.086528 224.82 71168
+712.157696 224.82 71168
+712.228864 224.82 71168
+712.300032 224.82 71168
+712.371200 224.82 71168
+712.442368 224.82 71168
+712.513536 224.82 71168
+712.584704 224.82 71168
+712.655872 224.82 71168
+712.727040 224.82 71168
+712.798208 224.82 71168
+712.869376 224.82 71168
+712.940544 224.82 71168
+713.011712 224.82 71168
+713.082880 224.82 71168
+713.154048 224.82 71168
+713.225216 224.82 71168
+713.296384 224.82 71168
+713.367552 224.82 71168
+713.438720 224.82 71168
+713.509888 224.82 71168
+713.581056 224.82 71168
+713.652224 224.82 71168
+713.723392 224.82 71168
+713.794560 224.82 71168
+713.865728 224.82 71168
+713.936896 224.82 71168
+714.008064 224.82 71168
+714.079232 224.82 71168
+714.150400 224.82 71168
+714.221568 224.82 71168
+714.292736 224.82 71168
+714.363904 224.82 71168
+714.435072 224.82 71168
+714.506240 224.82 71168
+714.576896 226.45 70656
+714.647552 226.45 70656
+714.718208 226.45 70656
+714.788864 226.45 70656
+714.859520 226.45 70656
+714.930176 226.45 70656
+715.000832 226.45 70656
+715.071488 226.45 70656
+715.142144 226.45 70656
+715.212800 226.45 70656
+715.283456 226.45 70656
+715.354112 226.45 70656
+715.424768 226.45 70656
+715.495424 226.45 70656
+715.566080 226.45 70656
+715.636736 226.45 70656
+715.707392 226.45 70656
+715.778048 226.45 70656
+715.848704 226.45 70656
+715.919360 226.45 70656
+715.990016 226.45 70656
+716.060672 226.45 70656
+716.131328 226.45 70656
+716.201984 226.45 70656
+716.272640 226.45 70656
+716.343296 226.45 70656
+716.413952 226.45 70656
+716.484608 226.45 70656
+716.555264 226.45 70656
+716.625920 226.45 70656
+716.696576 226.45 70656
+716.767232 226.45 70656
+716.837888 226.45 70656
+716.908544 226.45 70656
+716.979200 226.45 70656
+717.049856 226.45 70656
+717.120512 226.45 70656
+717.191168 226.45 70656
+717.261824 226.45 70656
+717.332480 226.45 70656
+717.403136 226.45 70656
+717.473792 226.45 70656
+717.544448 226.45 70656
+717.615104 226.45 70656
+717.685760 226.45 70656
+717.756416 226.45 70656
+717.827072 226.45 70656
+717.897728 226.45 70656
+717.968384 226.45 70656
+718.039040 226.45 70656
+718.109696 226.45 70656
+718.180352 226.45 70656
+718.251008 226.45 70656
+718.321664 226.45 70656
+718.392320 226.45 70656
+718.462976 226.45 70656
+718.533632 226.45 70656
+718.604288 226.45 70656
+718.674944 226.45 70656
+718.745600 226.45 70656
+718.816256 226.45 70656
+718.886912 226.45 70656
+718.957568 226.45 70656
+719.028224 226.45 70656
+719.098368 228.10 70144
+719.168512 228.10 70144
+719.238656 228.10 70144
+719.308800 228.10 70144
+719.378944 228.10 70144
+719.449088 228.10 70144
+719.519232 228.10 70144
+719.589376 228.10 70144
+719.659520 228.10 70144
+719.729664 228.10 70144
+719.799808 228.10 70144
+719.869952 228.10 70144
+719.940096 228.10 70144
+720.010240 228.10 70144
+720.080384 228.10 70144
+720.150528 228.10 70144
+720.220672 228.10 70144
+720.290816 228.10 70144
+720.360960 228.10 70144
+720.431104 228.10 70144
+720.501248 228.10 70144
+720.571392 228.10 70144
+720.641536 228.10 70144
+720.711680 228.10 70144
+720.781824 228.10 70144
+720.851968 228.10 70144
+720.922112 228.10 70144
+720.992256 228.10 70144
+721.062400 228.10 70144
+721.132544 228.10 70144
+721.202688 228.10 70144
+721.272832 228.10 70144
+721.342976 228.10 70144
+721.413120 228.10 70144
+721.483264 228.10 70144
+721.553408 228.10 70144
+721.623552 228.10 70144
+721.693696 228.10 70144
+721.763840 228.10 70144
+721.833984 228.10 70144
+721.904128 228.10 70144
+721.974272 228.10 70144
+722.044416 228.10 70144
+722.114560 228.10 70144
+722.184704 228.10 70144
+722.254848 228.10 70144
+722.324992 228.10 70144
+722.395136 228.10 70144
+722.465280 228.10 70144
+722.535424 228.10 70144
+722.605568 228.10 70144
+722.675712 228.10 70144
+722.745856 228.10 70144
+722.816000 228.10 70144
+722.886144 228.10 70144
+722.956288 228.10 70144
+723.026432 228.10 70144
+723.096576 228.10 70144
+723.166720 228.10 70144
+723.236864 228.10 70144
+723.307008 228.10 70144
+723.377152 228.10 70144
+723.447296 228.10 70144
+723.517440 228.10 70144
+723.587584 228.10 70144
+723.657728 228.10 70144
+723.727872 228.10 70144
+723.798016 228.10 70144
+723.868160 228.10 70144
+723.938304 228.10 70144
+724.008448 228.10 70144
+724.078592 228.10 70144
+724.148736 228.10 70144
+724.218880 228.10 70144
+724.289024 228.10 70144
+724.359168 228.10 70144
+724.429312 228.10 70144
+724.499456 228.10 70144
+724.569600 228.10 70144
+724.639744 228.10 70144
+724.709888 228.10 70144
+724.780032 228.10 70144
+724.850176 228.10 70144
+724.920320 228.10 70144
+724.990464 228.10 70144
+725.060608 228.10 70144
+725.130752 228.10 70144
+725.200896 228.10 70144
+725.271040 228.10 70144
+725.341184 228.10 70144
+725.411328 228.10 70144
+725.481472 228.10 70144
+725.551616 228.10 70144
+725.621760 228.10 70144
+725.691904 228.10 70144
+725.762048 228.10 70144
+725.831680 229.78 69632
+725.901312 229.78 69632
+725.970944 229.78 69632
+726.040576 229.78 69632
+726.110208 229.78 69632
+726.179840 229.78 69632
+726.249472 229.78 69632
+726.319104 229.78 69632
+726.388736 229.78 69632
+726.458368 229.78 69632
+726.528000 229.78 69632
+726.597632 229.78 69632
+726.667264 229.78 69632
+726.736896 229.78 69632
+726.806528 229.78 69632
+726.876160 229.78 69632
+726.945792 229.78 69632
+727.015424 229.78 69632
+727.085056 229.78 69632
+727.154688 229.78 69632
+727.224320 229.78 69632
+727.293952 229.78 69632
+727.363584 229.78 69632
+727.433216 229.78 69632
+727.502848 229.78 69632
+727.572480 229.78 69632
+727.642112 229.78 69632
+727.711744 229.78 69632
+727.781376 229.78 69632
+727.851008 229.78 69632
+727.920640 229.78 69632
+727.990272 229.78 69632
+728.059904 229.78 69632
+728.129536 229.78 69632
+728.199168 229.78 69632
+728.268800 229.78 69632
+728.338432 229.78 69632
+728.408064 229.78 69632
+728.477696 229.78 69632
+728.547328 229.78 69632
+728.616960 229.78 69632
+728.686592 229.78 69632
+728.756224 229.78 69632
+728.825856 229.78 69632
+728.895488 229.78 69632
+728.965120 229.78 69632
+729.034752 229.78 69632
+729.104384 229.78 69632
+729.174016 229.78 69632
+729.243648 229.78 69632
+729.313280 229.78 69632
+729.382912 229.78 69632
+729.452544 229.78 69632
+729.522176 229.78 69632
+729.591808 229.78 69632
+729.661440 229.78 69632
+729.731072 229.78 69632
+729.800704 229.78 69632
+729.870336 229.78 69632
+729.939968 229.78 69632
+730.009600 229.78 69632
+730.079232 229.78 69632
+730.148864 229.78 69632
+730.218496 229.78 69632
+730.287616 231.48 69120
+730.356736 231.48 69120
+730.425856 231.48 69120
+730.494976 231.48 69120
+730.564096 231.48 69120
+730.633216 231.48 69120
+730.702336 231.48 69120
+730.771456 231.48 69120
+730.840576 231.48 69120
+730.909696 231.48 69120
+730.978816 231.48 69120
+731.047936 231.48 69120
+731.117056 231.48 69120
+731.186176 231.48 69120
+731.255296 231.48 69120
+731.324416 231.48 69120
+731.393536 231.48 69120
+731.462656 231.48 69120
+731.531776 231.48 69120
+731.600896 231.48 69120
+731.670016 231.48 69120
+731.739136 231.48 69120
+731.808256 231.48 69120
+731.877376 231.48 69120
+731.946496 231.48 69120
+732.015616 231.48 69120
+732.084736 231.48 69120
+732.153856 231.48 69120
+732.222976 231.48 69120
+732.292096 231.48 69120
+732.361216 231.48 69120
+732.430336 231.48 69120
+732.499456 231.48 69120
+732.568576 231.48 69120
+732.637696 231.48 69120
+732.706816 231.48 69120
+732.775936 231.48 69120
+732.845056 231.48 69120
+732.914176 231.48 69120
+732.983296 231.48 69120
+733.052416 231.48 69120
+733.121536 231.48 69120
+733.190656 231.48 69120
+733.259776 231.48 69120
+733.328896 231.48 69120
+733.398016 231.48 69120
+733.467136 231.48 69120
+733.536256 231.48 69120
+733.605376 231.48 69120
+733.674496 231.48 69120
+733.743616 231.48 69120
+733.812736 231.48 69120
+733.881856 231.48 69120
+733.950976 231.48 69120
+734.020096 231.48 69120
+734.089216 231.48 69120
+734.158336 231.48 69120
+734.227456 231.48 69120
+734.296576 231.48 69120
+734.365696 231.48 69120
+734.434816 231.48 69120
+734.503936 231.48 69120
+734.573056 231.48 69120
+734.642176 231.48 69120
+734.711296 231.48 69120
+734.780416 231.48 69120
+734.849536 231.48 69120
+734.918656 231.48 69120
+734.987776 231.48 69120
+735.056896 231.48 69120
+735.126016 231.48 69120
+735.195136 231.48 69120
+735.264256 231.48 69120
+735.333376 231.48 69120
+735.402496 231.48 69120
+735.471616 231.48 69120
+735.540736 231.48 69120
+735.609856 231.48 69120
+735.678976 231.48 69120
+735.748096 231.48 69120
+735.817216 231.48 69120
+735.886336 231.48 69120
+735.955456 231.48 69120
+736.024576 231.48 69120
+736.093696 231.48 69120
+736.162816 231.48 69120
+736.231936 231.48 69120
+736.301056 231.48 69120
+736.370176 231.48 69120
+736.439296 231.48 69120
+736.508416 231.48 69120
+736.577536 231.48 69120
+736.646656 231.48 69120
+736.715776 231.48 69120
+736.784896 231.48 69120
+736.854016 231.48 69120
+736.923136 231.48 69120
+736.992256 231.48 69120
+737.061376 231.48 69120
+737.130496 231.48 69120
+737.199616 231.48 69120
+737.268736 231.48 69120
+737.337856 231.48 69120
+737.406976 231.48 69120
+737.476096 231.48 69120
+737.545216 231.48 69120
+737.614336 231.48 69120
+737.683456 231.48 69120
+737.752576 231.48 69120
+737.821696 231.48 69120
+737.890816 231.48 69120
+737.959936 231.48 69120
+738.029056 231.48 69120
+738.098176 231.48 69120
+738.167296 231.48 69120
+738.236416 231.48 69120
+738.305536 231.48 69120
+738.374656 231.48 69120
+738.443776 231.48 69120
+738.512896 231.48 69120
+738.582016 231.48 69120
+738.651136 231.48 69120
+738.720256 231.48 69120
+738.789376 231.48 69120
+738.858496 231.48 69120
+738.927616 231.48 69120
+738.996736 231.48 69120
+739.065856 231.48 69120
+739.134464 233.21 68608
+739.203072 233.21 68608
+739.271680 233.21 68608
+739.340288 233.21 68608
+739.408896 233.21 68608
+739.477504 233.21 68608
+739.546112 233.21 68608
+739.614720 233.21 68608
+739.683328 233.21 68608
+739.751936 233.21 68608
+739.820544 233.21 68608
+739.889152 233.21 68608
+739.957760 233.21 68608
+740.026368 233.21 68608
+740.094976 233.21 68608
+740.163584 233.21 68608
+740.232192 233.21 68608
+740.300800 233.21 68608
+740.369408 233.21 68608
+740.438016 233.21 68608
+740.506624 233.21 68608
+740.575232 233.21 68608
+740.643840 233.21 68608
+740.712448 233.21 68608
+740.781056 233.21 68608
+740.849664 233.21 68608
+740.918272 233.21 68608
+740.986880 233.21 68608
+741.055488 233.21 68608
+741.124096 233.21 68608
+741.192704 233.21 68608
+741.261312 233.21 68608
+741.329920 233.21 68608
+741.398528 233.21 68608
+741.467136 233.21 68608
+741.535744 233.21 68608
+741.604352 233.21 68608
+741.672960 233.21 68608
+741.741568 233.21 68608
+741.810176 233.21 68608
+741.878784 233.21 68608
+741.947392 233.21 68608
+742.016000 233.21 68608
+742.084608 233.21 68608
+742.153216 233.21 68608
+742.221824 233.21 68608
+742.290432 233.21 68608
+742.359040 233.21 68608
+742.427648 233.21 68608
+742.496256 233.21 68608
+742.564864 233.21 68608
+742.633472 233.21 68608
+742.702080 233.21 68608
+742.770688 233.21 68608
+742.839296 233.21 68608
+742.907904 233.21 68608
+742.976512 233.21 68608
+743.045120 233.21 68608
+743.113728 233.21 68608
+743.182336 233.21 68608
+743.250944 233.21 68608
+743.319552 233.21 68608
+743.388160 233.21 68608
+743.456768 233.21 68608
+743.524864 234.96 68096
+743.592960 234.96 68096
+743.661056 234.96 68096
+743.729152 234.96 68096
+743.797248 234.96 68096
+743.865344 234.96 68096
+743.933440 234.96 68096
+744.001536 234.96 68096
+744.069632 234.96 68096
+744.137728 234.96 68096
+744.205824 234.96 68096
+744.273920 234.96 68096
+744.342016 234.96 68096
+744.410112 234.96 68096
+744.478208 234.96 68096
+744.546304 234.96 68096
+744.614400 234.96 68096
+744.682496 234.96 68096
+744.750592 234.96 68096
+744.818688 234.96 68096
+744.886784 234.96 68096
+744.954880 234.96 68096
+745.022976 234.96 68096
+745.091072 234.96 68096
+745.159168 234.96 68096
+745.227264 234.96 68096
+745.295360 234.96 68096
+745.363456 234.96 68096
+745.431552 234.96 68096
+745.499648 234.96 68096
+745.567744 234.96 68096
+745.635840 234.96 68096
+745.703936 234.96 68096
+745.772032 234.96 68096
+745.840128 234.96 68096
+745.908224 234.96 68096
+745.976320 234.96 68096
+746.044416 234.96 68096
+746.112512 234.96 68096
+746.180608 234.96 68096
+746.248704 234.96 68096
+746.316800 234.96 68096
+746.384896 234.96 68096
+746.452992 234.96 68096
+746.521088 234.96 68096
+746.589184 234.96 68096
+746.657280 234.96 68096
+746.725376 234.96 68096
+746.793472 234.96 68096
+746.861568 234.96 68096
+746.929664 234.96 68096
+746.997760 234.96 68096
+747.065856 234.96 68096
+747.133952 234.96 68096
+747.202048 234.96 68096
+747.270144 234.96 68096
+747.338240 234.96 68096
+747.406336 234.96 68096
+747.474432 234.96 68096
+747.542528 234.96 68096
+747.610624 234.96 68096
+747.678720 234.96 68096
+747.746816 234.96 68096
+747.814912 234.96 68096
+747.882496 236.74 67584
+747.950080 236.74 67584
+748.017664 236.74 67584
+748.085248 236.74 67584
+748.152832 236.74 67584
+748.220416 236.74 67584
+748.288000 236.74 67584
+748.355584 236.74 67584
+748.423168 236.74 67584
+748.490752 236.74 67584
+748.558336 236.74 67584
+748.625920 236.74 67584
+748.693504 236.74 67584
+748.761088 236.74 67584
+748.828672 236.74 67584
+748.896256 236.74 67584
+748.963840 236.74 67584
+749.031424 236.74 67584
+749.099008 236.74 67584
+749.166592 236.74 67584
+749.234176 236.74 67584
+749.301760 236.74 67584
+749.369344 236.74 67584
+749.436928 236.74 67584
+749.504512 236.74 67584
+749.572096 236.74 67584
+749.639680 236.74 67584
+749.707264 236.74 67584
+749.774848 236.74 67584
+749.842432 236.74 67584
+749.910016 236.74 67584
+749.977600 236.74 67584
+750.045184 236.74 67584
+750.112768 236.74 67584
+750.180352 236.74 67584
+750.247936 236.74 67584
+750.315520 236.74 67584
+750.383104 236.74 67584
+750.450688 236.74 67584
+750.518272 236.74 67584
+750.585856 236.74 67584
+750.653440 236.74 67584
+750.721024 236.74 67584
+750.788608 236.74 67584
+750.856192 236.74 67584
+750.923776 236.74 67584
+750.991360 236.74 67584
+751.058944 236.74 67584
+751.126528 236.74 67584
+751.194112 236.74 67584
+751.261696 236.74 67584
+751.329280 236.74 67584
+751.396864 236.74 67584
+751.464448 236.74 67584
+751.532032 236.74 67584
+751.599616 236.74 67584
+751.667200 236.74 67584
+751.734784 236.74 67584
+751.802368 236.74 67584
+751.869952 236.74 67584
+751.937536 236.74 67584
+752.005120 236.74 67584
+752.072704 236.74 67584
+752.140288 236.74 67584
+752.207872 236.74 67584
+752.275456 236.74 67584
+752.343040 236.74 67584
+752.410624 236.74 67584
+752.478208 236.74 67584
+752.545792 236.74 67584
+752.613376 236.74 67584
+752.680960 236.74 67584
+752.748544 236.74 67584
+752.816128 236.74 67584
+752.883712 236.74 67584
+752.951296 236.74 67584
+753.018880 236.74 67584
+753.086464 236.74 67584
+753.154048 236.74 67584
+753.221632 236.74 67584
+753.289216 236.74 67584
+753.356800 236.74 67584
+753.424384 236.74 67584
+753.491968 236.74 67584
+753.559552 236.74 67584
+753.627136 236.74 67584
+753.694720 236.74 67584
+753.762304 236.74 67584
+753.829888 236.74 67584
+753.897472 236.74 67584
+753.965056 236.74 67584
+754.032640 236.74 67584
+754.100224 236.74 67584
+754.167808 236.74 67584
+754.235392 236.74 67584
+754.302976 236.74 67584
+754.370048 238.55 67072
+754.437120 238.55 67072
+754.504192 238.55 67072
+754.571264 238.55 67072
+754.638336 238.55 67072
+754.705408 238.55 67072
+754.772480 238.55 67072
+754.839552 238.55 67072
+754.906624 238.55 67072
+754.973696 238.55 67072
+755.040768 238.55 67072
+755.107840 238.55 67072
+755.174912 238.55 67072
+755.241984 238.55 67072
+755.309056 238.55 67072
+755.376128 238.55 67072
+755.443200 238.55 67072
+755.510272 238.55 67072
+755.577344 238.55 67072
+755.644416 238.55 67072
+755.711488 238.55 67072
+755.778560 238.55 67072
+755.845632 238.55 67072
+755.912704 238.55 67072
+755.979776 238.55 67072
+756.046848 238.55 67072
+756.113920 238.55 67072
+756.180992 238.55 67072
+756.248064 238.55 67072
+756.315136 238.55 67072
+756.382208 238.55 67072
+756.449280 238.55 67072
+756.516352 238.55 67072
+756.583424 238.55 67072
+756.650496 238.55 67072
+756.717568 238.55 67072
+756.784640 238.55 67072
+756.851712 238.55 67072
+756.918784 238.55 67072
+756.985856 238.55 67072
+757.052928 238.55 67072
+757.120000 238.55 67072
+757.187072 238.55 67072
+757.254144 238.55 67072
+757.321216 238.55 67072
+757.388288 238.55 67072
+757.455360 238.55 67072
+757.522432 238.55 67072
+757.589504 238.55 67072
+757.656576 238.55 67072
+757.723648 238.55 67072
+757.790720 238.55 67072
+757.857792 238.55 67072
+757.924864 238.55 67072
+757.991936 238.55 67072
+758.059008 238.55 67072
+758.126080 238.55 67072
+758.193152 238.55 67072
+758.260224 238.55 67072
+758.327296 238.55 67072
+758.394368 238.55 67072
+758.461440 238.55 67072
+758.528512 238.55 67072
+758.595584 238.55 67072
+758.662144 240.38 66560
+758.728704 240.38 66560
+758.795264 240.38 66560
+758.861824 240.38 66560
+758.928384 240.38 66560
+758.994944 240.38 66560
+759.061504 240.38 66560
+759.128064 240.38 66560
+759.194624 240.38 66560
+759.261184 240.38 66560
+759.327744 240.38 66560
+759.394304 240.38 66560
+759.460864 240.38 66560
+759.527424 240.38 66560
+759.593984 240.38 66560
+759.660544 240.38 66560
+759.727104 240.38 66560
+759.793664 240.38 66560
+759.860224 240.38 66560
+759.926784 240.38 66560
+759.993344 240.38 66560
+760.059904 240.38 66560
+760.126464 240.38 66560
+760.193024 240.38 66560
+760.259584 240.38 66560
+760.326144 240.38 66560
+760.392704 240.38 66560
+760.459264 240.38 66560
+760.525824 240.38 66560
+760.592384 240.38 66560
+760.658944 240.38 66560
+760.725504 240.38 66560
+760.792064 240.38 66560
+760.858624 240.38 66560
+760.925184 240.38 66560
+760.991744 240.38 66560
+761.058304 240.38 66560
+761.124864 240.38 66560
+761.191424 240.38 66560
+761.257984 240.38 66560
+761.324544 240.38 66560
+761.391104 240.38 66560
+761.457664 240.38 66560
+761.524224 240.38 66560
+761.590784 240.38 66560
+761.657344 240.38 66560
+761.723904 240.38 66560
+761.790464 240.38 66560
+761.857024 240.38 66560
+761.923584 240.38 66560
+761.990144 240.38 66560
+762.056704 240.38 66560
+762.123264 240.38 66560
+762.189824 240.38 66560
+762.256384 240.38 66560
+762.322944 240.38 66560
+762.389504 240.38 66560
+762.456064 240.38 66560
+762.522624 240.38 66560
+762.589184 240.38 66560
+762.655744 240.38 66560
+762.722304 240.38 66560
+762.788864 240.38 66560
+762.855424 240.38 66560
+762.921472 242.25 66048
+762.987520 242.25 66048
+763.053568 242.25 66048
+763.119616 242.25 66048
+763.185664 242.25 66048
+763.251712 242.25 66048
+763.317760 242.25 66048
+763.383808 242.25 66048
+763.449856 242.25 66048
+763.515904 242.25 66048
+763.581952 242.25 66048
+763.648000 242.25 66048
+763.714048 242.25 66048
+763.780096 242.25 66048
+763.846144 242.25 66048
+763.912192 242.25 66048
+763.978240 242.25 66048
+764.044288 242.25 66048
+764.110336 242.25 66048
+764.176384 242.25 66048
+764.242432 242.25 66048
+764.308480 242.25 66048
+764.374528 242.25 66048
+764.440576 242.25 66048
+764.506624 242.25 66048
+764.572672 242.25 66048
+764.638720 242.25 66048
+764.704768 242.25 66048
+764.770816 242.25 66048
+764.836864 242.25 66048
+764.902912 242.25 66048
+764.968960 242.25 66048
+765.035008 242.25 66048
+765.101056 242.25 66048
+765.167104 242.25 66048
+765.233152 242.25 66048
+765.299200 242.25 66048
+765.365248 242.25 66048
+765.431296 242.25 66048
+765.497344 242.25 66048
+765.563392 242.25 66048
+765.629440 242.25 66048
+765.695488 242.25 66048
+765.761536 242.25 66048
+765.827584 242.25 66048
+765.893632 242.25 66048
+765.959680 242.25 66048
+766.025728 242.25 66048
+766.091776 242.25 66048
+766.157824 242.25 66048
+766.223872 242.25 66048
+766.289920 242.25 66048
+766.355968 242.25 66048
+766.422016 242.25 66048
+766.488064 242.25 66048
+766.554112 242.25 66048
+766.620160 242.25 66048
+766.686208 242.25 66048
+766.752256 242.25 66048
+766.818304 242.25 66048
+766.884352 242.25 66048
+766.950400 242.25 66048
+767.016448 242.25 66048
+767.082496 242.25 66048
+767.148544 242.25 66048
+767.214592 242.25 66048
+767.280640 242.25 66048
+767.346688 242.25 66048
+767.412736 242.25 66048
+767.478784 242.25 66048
+767.544832 242.25 66048
+767.610880 242.25 66048
+767.676928 242.25 66048
+767.742976 242.25 66048
+767.809024 242.25 66048
+767.875072 242.25 66048
+767.941120 242.25 66048
+768.007168 242.25 66048
+768.073216 242.25 66048
+768.139264 242.25 66048
+768.205312 242.25 66048
+768.271360 242.25 66048
+768.337408 242.25 66048
+768.403456 242.25 66048
+768.469504 242.25 66048
+768.535552 242.25 66048
+768.601600 242.25 66048
+768.667648 242.25 66048
+768.733696 242.25 66048
+768.799744 242.25 66048
+768.865792 242.25 66048
+768.931840 242.25 66048
+768.997888 242.25 66048
+769.063936 242.25 66048
+769.129984 242.25 66048
+769.196032 242.25 66048
+769.262080 242.25 66048
+769.328128 242.25 66048
+769.394176 242.25 66048
+769.460224 242.25 66048
+769.526272 242.25 66048
+769.592320 242.25 66048
+769.658368 242.25 66048
+769.724416 242.25 66048
+769.790464 242.25 66048
+769.856512 242.25 66048
+769.922560 242.25 66048
+769.988608 242.25 66048
+770.054656 242.25 66048
+770.120704 242.25 66048
+770.186752 242.25 66048
+770.252800 242.25 66048
+770.318848 242.25 66048
+770.384896 242.25 66048
+770.450944 242.25 66048
+770.516992 242.25 66048
+770.583040 242.25 66048
+770.649088 242.25 66048
+770.715136 242.25 66048
+770.781184 242.25 66048
+770.847232 242.25 66048
+770.913280 242.25 66048
+770.979328 242.25 66048
+771.045376 242.25 66048
+771.111424 242.25 66048
+771.177472 242.25 66048
+771.243520 242.25 66048
+771.309568 242.25 66048
+771.375104 244.14 65536
+771.440640 244.14 65536
+771.506176 244.14 65536
+771.571712 244.14 65536
+771.637248 244.14 65536
+771.702784 244.14 65536
+771.768320 244.14 65536
+771.833856 244.14 65536
+771.899392 244.14 65536
+771.964928 244.14 65536
+772.030464 244.14 65536
+772.096000 244.14 65536
+772.161536 244.14 65536
+772.227072 244.14 65536
+772.292608 244.14 65536
+772.358144 244.14 65536
+772.423680 244.14 65536
+772.489216 244.14 65536
+772.554752 244.14 65536
+772.620288 244.14 65536
+772.685824 244.14 65536
+772.751360 244.14 65536
+772.816896 244.14 65536
+772.882432 244.14 65536
+772.947968 244.14 65536
+773.013504 244.14 65536
+773.079040 244.14 65536
+773.144576 244.14 65536
+773.210112 244.14 65536
+773.275648 244.14 65536
+773.341184 244.14 65536
+773.406720 244.14 65536
+773.472256 244.14 65536
+773.537792 244.14 65536
+773.603328 244.14 65536
+773.668864 244.14 65536
+773.734400 244.14 65536
+773.799936 244.14 65536
+773.865472 244.14 65536
+773.931008 244.14 65536
+773.996544 244.14 65536
+774.062080 244.14 65536
+774.127616 244.14 65536
+774.193152 244.14 65536
+774.258688 244.14 65536
+774.324224 244.14 65536
+774.389760 244.14 65536
+774.455296 244.14 65536
+774.520832 244.14 65536
+774.586368 244.14 65536
+774.651904 244.14 65536
+774.717440 244.14 65536
+774.782976 244.14 65536
+774.848512 244.14 65536
+774.914048 244.14 65536
+774.979584 244.14 65536
+775.045120 244.14 65536
+775.110656 244.14 65536
+775.176192 244.14 65536
+775.241728 244.14 65536
+775.307264 244.14 65536
+775.372800 244.14 65536
+775.438336 244.14 65536
+775.503872 244.14 65536
+775.569152 245.10 65280
+775.634432 245.10 65280
+775.699712 245.10 65280
+775.764992 245.10 65280
+775.830272 245.10 65280
+775.895552 245.10 65280
+775.960832 245.10 65280
+776.026112 245.10 65280
+776.091392 245.10 65280
+776.156672 245.10 65280
+776.221952 245.10 65280
+776.287232 245.10 65280
+776.352512 245.10 65280
+776.417792 245.10 65280
+776.483072 245.10 65280
+776.548352 245.10 65280
+776.613632 245.10 65280
+776.678912 245.10 65280
+776.744192 245.10 65280
+776.809472 245.10 65280
+776.874752 245.10 65280
+776.940032 245.10 65280
+777.005312 245.10 65280
+777.070592 245.10 65280
+777.135872 245.10 65280
+777.201152 245.10 65280
+777.266432 245.10 65280
+777.331712 245.10 65280
+777.396992 245.10 65280
+777.462272 245.10 65280
+777.527552 245.10 65280
+777.592832 245.10 65280
+777.658112 245.10 65280
+777.723392 245.10 65280
+777.788672 245.10 65280
+777.853952 245.10 65280
+777.919232 245.10 65280
+777.984512 245.10 65280
+778.049792 245.10 65280
+778.115072 245.10 65280
+778.180352 245.10 65280
+778.245632 245.10 65280
+778.310912 245.10 65280
+778.376192 245.10 65280
+778.441472 245.10 65280
+778.506752 245.10 65280
+778.572032 245.10 65280
+778.637312 245.10 65280
+778.702592 245.10 65280
+778.767872 245.10 65280
+778.833152 245.10 65280
+778.898432 245.10 65280
+778.963712 245.10 65280
+779.028992 245.10 65280
+779.094272 245.10 65280
+779.159552 245.10 65280
+779.224832 245.10 65280
+779.290112 245.10 65280
+779.355392 245.10 65280
+779.420672 245.10 65280
+779.485952 245.10 65280
+779.551232 245.10 65280
+779.616512 245.10 65280
+779.681792 245.10 65280
+779.746816 246.06 65024
+779.811840 246.06 65024
+779.876864 246.06 65024
+779.941888 246.06 65024
+780.006912 246.06 65024
+780.071936 246.06 65024
+780.136960 246.06 65024
+780.201984 246.06 65024
+780.267008 246.06 65024
+780.332032 246.06 65024
+780.397056 246.06 65024
+780.462080 246.06 65024
+780.527104 246.06 65024
+780.592128 246.06 65024
+780.657152 246.06 65024
+780.722176 246.06 65024
+780.787200 246.06 65024
+780.852224 246.06 65024
+780.917248 246.06 65024
+780.982272 246.06 65024
+781.047296 246.06 65024
+781.112320 246.06 65024
+781.177344 246.06 65024
+781.242368 246.06 65024
+781.307392 246.06 65024
+781.372416 246.06 65024
+781.437440 246.06 65024
+781.502464 246.06 65024
+781.567488 246.06 65024
+781.632512 246.06 65024
+781.697536 246.06 65024
+781.762560 246.06 65024
+781.827584 246.06 65024
+781.892608 246.06 65024
+781.957632 246.06 65024
+782.022656 246.06 65024
+782.087680 246.06 65024
+782.152704 246.06 65024
+782.217728 246.06 65024
+782.282752 246.06 65024
+782.347776 246.06 65024
+782.412800 246.06 65024
+782.477824 246.06 65024
+782.542848 246.06 65024
+782.607872 246.06 65024
+782.672896 246.06 65024
+782.737920 246.06 65024
+782.802944 246.06 65024
+782.867968 246.06 65024
+782.932992 246.06 65024
+782.998016 246.06 65024
+783.063040 246.06 65024
+783.128064 246.06 65024
+783.193088 246.06 65024
+783.258112 246.06 65024
+783.323136 246.06 65024
+783.388160 246.06 65024
+783.453184 246.06 65024
+783.518208 246.06 65024
+783.583232 246.06 65024
+783.648256 246.06 65024
+783.713280 246.06 65024
+783.778304 246.06 65024
+783.843328 246.06 65024
+783.907840 248.02 64512
+783.972352 248.02 64512
+784.036864 248.02 64512
+784.101376 248.02 64512
+784.165888 248.02 64512
+784.230400 248.02 64512
+784.294912 248.02 64512
+784.359424 248.02 64512
+784.423936 248.02 64512
+784.488448 248.02 64512
+784.552960 248.02 64512
+784.617472 248.02 64512
+784.681984 248.02 64512
+784.746496 248.02 64512
+784.811008 248.02 64512
+784.875520 248.02 64512
+784.940032 248.02 64512
+785.004544 248.02 64512
+785.069056 248.02 64512
+785.133568 248.02 64512
+785.198080 248.02 64512
+785.262592 248.02 64512
+785.327104 248.02 64512
+785.391616 248.02 64512
+785.456128 248.02 64512
+785.520640 248.02 64512
+785.585152 248.02 64512
+785.649664 248.02 64512
+785.714176 248.02 64512
+785.778688 248.02 64512
+785.843200 248.02 64512
+785.907712 248.02 64512
+785.972224 248.02 64512
+786.036736 248.02 64512
+786.101248 248.02 64512
+786.165760 248.02 64512
+786.230272 248.02 64512
+786.294784 248.02 64512
+786.359296 248.02 64512
+786.423808 248.02 64512
+786.488320 248.02 64512
+786.552832 248.02 64512
+786.617344 248.02 64512
+786.681856 248.02 64512
+786.746368 248.02 64512
+786.810880 248.02 64512
+786.875392 248.02 64512
+786.939904 248.02 64512
+787.004416 248.02 64512
+787.068928 248.02 64512
+787.133440 248.02 64512
+787.197952 248.02 64512
+787.262464 248.02 64512
+787.326976 248.02 64512
+787.391488 248.02 64512
+787.456000 248.02 64512
+787.520512 248.02 64512
+787.585024 248.02 64512
+787.649536 248.02 64512
+787.714048 248.02 64512
+787.778560 248.02 64512
+787.843072 248.02 64512
+787.907584 248.02 64512
+787.972096 248.02 64512
+788.036352 249.00 64256
+788.100608 249.00 64256
+788.164864 249.00 64256
+788.229120 249.00 64256
+788.293376 249.00 64256
+788.357632 249.00 64256
+788.421888 249.00 64256
+788.486144 249.00 64256
+788.550400 249.00 64256
+788.614656 249.00 64256
+788.678912 249.00 64256
+788.743168 249.00 64256
+788.807424 249.00 64256
+788.871680 249.00 64256
+788.935936 249.00 64256
+789.000192 249.00 64256
+789.064448 249.00 64256
+789.128704 249.00 64256
+789.192960 249.00 64256
+789.257216 249.00 64256
+789.321472 249.00 64256
+789.385728 249.00 64256
+789.449984 249.00 64256
+789.514240 249.00 64256
+789.578496 249.00 64256
+789.642752 249.00 64256
+789.707008 249.00 64256
+789.771264 249.00 64256
+789.835520 249.00 64256
+789.899776 249.00 64256
+789.964032 249.00 64256
+790.028288 249.00 64256
+790.092544 249.00 64256
+790.156800 249.00 64256
+790.221056 249.00 64256
+790.285312 249.00 64256
+790.349568 249.00 64256
+790.413824 249.00 64256
+790.478080 249.00 64256
+790.542336 249.00 64256
+790.606592 249.00 64256
+790.670848 249.00 64256
+790.735104 249.00 64256
+790.799360 249.00 64256
+790.863616 249.00 64256
+790.927872 249.00 64256
+790.992128 249.00 64256
+791.056384 249.00 64256
+791.120640 249.00 64256
+791.184896 249.00 64256
+791.249152 249.00 64256
+791.313408 249.00 64256
+791.377664 249.00 64256
+791.441920 249.00 64256
+791.506176 249.00 64256
+791.570432 249.00 64256
+791.634688 249.00 64256
+791.698944 249.00 64256
+791.763200 249.00 64256
+791.827456 249.00 64256
+791.891712 249.00 64256
+791.955968 249.00 64256
+792.020224 249.00 64256
+792.084480 249.00 64256
+792.148480 250.00 64000
+792.276480 250.00 64000
+792.404480 250.00 64000
+792.532480 250.00 64000
+792.660480 250.00 64000
+792.788480 250.00 64000
+792.916480 250.00 64000
+793.044480 250.00 64000
+793.172480 250.00 64000
+793.300480 250.00 64000
+793.428480 250.00 64000
+793.556480 250.00 64000
+793.684480 250.00 64000
+793.812480 250.00 64000
+793.940480 250.00 64000
+794.068480 250.00 64000
+794.196480 250.00 64000
+794.324480 250.00 64000
+794.452480 250.00 64000
+794.580480 250.00 64000
+794.708480 250.00 64000
+794.836480 250.00 64000
+794.964480 250.00 64000
+795.092480 250.00 64000
+795.220480 250.00 64000
+795.348480 250.00 64000
+795.476480 250.00 64000
+795.604480 250.00 64000
+795.732480 250.00 64000
+795.860480 250.00 64000
+795.988480 250.00 64000
+796.116480 250.00 64000
+796.244480 250.00 64000
+796.372480 250.00 64000
+796.500480 250.00 64000
+796.628480 250.00 64000
+796.756480 250.00 64000
+796.884480 250.00 64000
+797.012480 250.00 64000
+797.140480 250.00 64000
+797.268480 250.00 64000
+797.396480 250.00 64000
+797.524480 250.00 64000
+797.652480 250.00 64000
+797.780480 250.00 64000
+797.908480 250.00 64000
+798.036480 250.00 64000
+798.164480 250.00 64000
+798.292480 250.00 64000
+798.420480 250.00 64000
+798.548480 250.00 64000
+798.676480 250.00 64000
+798.804480 250.00 64000
+798.932480 250.00 64000
+799.060480 250.00 64000
+799.188480 250.00 64000
+799.316480 250.00 64000
+799.444480 250.00 64000
+799.572480 250.00 64000
+799.700480 250.00 64000
+799.828480 250.00 64000
+799.892736 249.00 64256
+799.956992 249.00 64256
+800.021248 249.00 64256
+800.085504 249.00 64256
+800.149760 249.00 64256
+800.214016 249.00 64256
+800.278272 249.00 64256
+800.342528 249.00 64256
+800.406784 249.00 64256
+800.471040 249.00 64256
+800.535296 249.00 64256
+800.599552 249.00 64256
+800.663808 249.00 64256
+800.728064 249.00 64256
+800.792320 249.00 64256
+800.856576 249.00 64256
+800.920832 249.00 64256
+800.985088 249.00 64256
+801.049344 249.00 64256
+801.113600 249.00 64256
+801.177856 249.00 64256
+801.242112 249.00 64256
+801.306368 249.00 64256
+801.370624 249.00 64256
+801.434880 249.00 64256
+801.499136 249.00 64256
+801.563392 249.00 64256
+801.627648 249.00 64256
+801.691904 249.00 64256
+801.756160 249.00 64256
+801.820416 249.00 64256
+801.884672 249.00 64256
+801.948928 249.00 64256
+802.013184 249.00 64256
+802.077440 249.00 64256
+802.141696 249.00 64256
+802.205952 249.00 64256
+802.270208 249.00 64256
+802.334464 249.00 64256
+802.398720 249.00 64256
+802.462976 249.00 64256
+802.527232 249.00 64256
+802.591488 249.00 64256
+802.655744 249.00 64256
+802.720000 249.00 64256
+802.784256 249.00 64256
+802.848512 249.00 64256
+802.912768 249.00 64256
+802.977024 249.00 64256
+803.041280 249.00 64256
+803.105536 249.00 64256
+803.169792 249.00 64256
+803.234048 249.00 64256
+803.298304 249.00 64256
+803.362560 249.00 64256
+803.426816 249.00 64256
+803.491072 249.00 64256
+803.555328 249.00 64256
+803.619584 249.00 64256
+803.683840 249.00 64256
+803.748096 249.00 64256
+803.812352 249.00 64256
+803.876608 249.00 64256
+803.940864 249.00 64256
+804.005376 248.02 64512
+804.069888 248.02 64512
+804.134400 248.02 64512
+804.198912 248.02 64512
+804.263424 248.02 64512
+804.327936 248.02 64512
+804.392448 248.02 64512
+804.456960 248.02 64512
+804.521472 248.02 64512
+804.585984 248.02 64512
+804.650496 248.02 64512
+804.715008 248.02 64512
+804.779520 248.02 64512
+804.844032 248.02 64512
+804.908544 248.02 64512
+804.973056 248.02 64512
+805.037568 248.02 64512
+805.102080 248.02 64512
+805.166592 248.02 64512
+805.231104 248.02 64512
+805.295616 248.02 64512
+805.360128 248.02 64512
+805.424640 248.02 64512
+805.489152 248.02 64512
+805.553664 248.02 64512
+805.618176 248.02 64512
+805.682688 248.02 64512
+805.747200 248.02 64512
+805.811712 248.02 64512
+805.876224 248.02 64512
+805.940736 248.02 64512
+806.005248 248.02 64512
+806.069760 248.02 64512
+806.134272 248.02 64512
+806.198784 248.02 64512
+806.263296 248.02 64512
+806.327808 248.02 64512
+806.392320 248.02 64512
+806.456832 248.02 64512
+806.521344 248.02 64512
+806.585856 248.02 64512
+806.650368 248.02 64512
+806.714880 248.02 64512
+806.779392 248.02 64512
+806.843904 248.02 64512
+806.908416 248.02 64512
+806.972928 248.02 64512
+807.037440 248.02 64512
+807.101952 248.02 64512
+807.166464 248.02 64512
+807.230976 248.02 64512
+807.295488 248.02 64512
+807.360000 248.02 64512
+807.424512 248.02 64512
+807.489024 248.02 64512
+807.553536 248.02 64512
+807.618048 248.02 64512
+807.682560 248.02 64512
+807.747072 248.02 64512
+807.811584 248.02 64512
+807.876096 248.02 64512
+807.940608 248.02 64512
+808.005120 248.02 64512
+808.069632 248.02 64512
+808.134656 246.06 65024
+808.199680 246.06 65024
+808.264704 246.06 65024
+808.329728 246.06 65024
+808.394752 246.06 65024
+808.459776 246.06 65024
+808.524800 246.06 65024
+808.589824 246.06 65024
+808.654848 246.06 65024
+808.719872 246.06 65024
+808.784896 246.06 65024
+808.849920 246.06 65024
+808.914944 246.06 65024
+808.979968 246.06 65024
+809.044992 246.06 65024
+809.110016 246.06 65024
+809.175040 246.06 65024
+809.240064 246.06 65024
+809.305088 246.06 65024
+809.370112 246.06 65024
+809.435136 246.06 65024
+809.500160 246.06 65024
+809.565184 246.06 65024
+809.630208 246.06 65024
+809.695232 246.06 65024
+809.760256 246.06 65024
+809.825280 246.06 65024
+809.890304 246.06 65024
+809.955328 246.06 65024
+810.020352 246.06 65024
+810.085376 246.06 65024
+810.150400 246.06 65024
+810.215424 246.06 65024
+810.280448 246.06 65024
+810.345472 246.06 65024
+810.410496 246.06 65024
+810.475520 246.06 65024
+810.540544 246.06 65024
+810.605568 246.06 65024
+810.670592 246.06 65024
+810.735616 246.06 65024
+810.800640 246.06 65024
+810.865664 246.06 65024
+810.930688 246.06 65024
+810.995712 246.06 65024
+811.060736 246.06 65024
+811.125760 246.06 65024
+811.190784 246.06 65024
+811.255808 246.06 65024
+811.320832 246.06 65024
+811.385856 246.06 65024
+811.450880 246.06 65024
+811.515904 246.06 65024
+811.580928 246.06 65024
+811.645952 246.06 65024
+811.710976 246.06 65024
+811.776000 246.06 65024
+811.841024 246.06 65024
+811.906048 246.06 65024
+811.971072 246.06 65024
+812.036096 246.06 65024
+812.101120 246.06 65024
+812.166144 246.06 65024
+812.231168 246.06 65024
+812.296448 245.10 65280
+812.361728 245.10 65280
+812.427008 245.10 65280
+812.492288 245.10 65280
+812.557568 245.10 65280
+812.622848 245.10 65280
+812.688128 245.10 65280
+812.753408 245.10 65280
+812.818688 245.10 65280
+812.883968 245.10 65280
+812.949248 245.10 65280
+813.014528 245.10 65280
+813.079808 245.10 65280
+813.145088 245.10 65280
+813.210368 245.10 65280
+813.275648 245.10 65280
+813.340928 245.10 65280
+813.406208 245.10 65280
+813.471488 245.10 65280
+813.536768 245.10 65280
+813.602048 245.10 65280
+813.667328 245.10 65280
+813.732608 245.10 65280
+813.797888 245.10 65280
+813.863168 245.10 65280
+813.928448 245.10 65280
+813.993728 245.10 65280
+814.059008 245.10 65280
+814.124288 245.10 65280
+814.189568 245.10 65280
+814.254848 245.10 65280
+814.320128 245.10 65280
+814.385408 245.10 65280
+814.450688 245.10 65280
+814.515968 245.10 65280
+814.581248 245.10 65280
+814.646528 245.10 65280
+814.711808 245.10 65280
+814.777088 245.10 65280
+814.842368 245.10 65280
+814.907648 245.10 65280
+814.972928 245.10 65280
+815.038208 245.10 65280
+815.103488 245.10 65280
+815.168768 245.10 65280
+815.234048 245.10 65280
+815.299328 245.10 65280
+815.364608 245.10 65280
+815.429888 245.10 65280
+815.495168 245.10 65280
+815.560448 245.10 65280
+815.625728 245.10 65280
+815.691008 245.10 65280
+815.756288 245.10 65280
+815.821568 245.10 65280
+815.886848 245.10 65280
+815.952128 245.10 65280
+816.017408 245.10 65280
+816.082688 245.10 65280
+816.147968 245.10 65280
+816.213248 245.10 65280
+816.278528 245.10 65280
+816.343808 245.10 65280
+816.409088 245.10 65280
+816.474624 244.14 65536
+816.540160 244.14 65536
+816.605696 244.14 65536
+816.671232 244.14 65536
+816.736768 244.14 65536
+816.802304 244.14 65536
+816.867840 244.14 65536
+816.933376 244.14 65536
+816.998912 244.14 65536
+817.064448 244.14 65536
+817.129984 244.14 65536
+817.195520 244.14 65536
+817.261056 244.14 65536
+817.326592 244.14 65536
+817.392128 244.14 65536
+817.457664 244.14 65536
+817.523200 244.14 65536
+817.588736 244.14 65536
+817.654272 244.14 65536
+817.719808 244.14 65536
+817.785344 244.14 65536
+817.850880 244.14 65536
+817.916416 244.14 65536
+817.981952 244.14 65536
+818.047488 244.14 65536
+818.113024 244.14 65536
+818.178560 244.14 65536
+818.244096 244.14 65536
+818.309632 244.14 65536
+818.375168 244.14 65536
+818.440704 244.14 65536
+818.506240 244.14 65536
+818.571776 244.14 65536
+818.637312 244.14 65536
+818.702848 244.14 65536
+818.768384 244.14 65536
+818.833920 244.14 65536
+818.899456 244.14 65536
+818.964992 244.14 65536
+819.030528 244.14 65536
+819.096064 244.14 65536
+819.161600 244.14 65536
+819.227136 244.14 65536
+819.292672 244.14 65536
+819.358208 244.14 65536
+819.423744 244.14 65536
+819.489280 244.14 65536
+819.554816 244.14 65536
+819.620352 244.14 65536
+819.685888 244.14 65536
+819.751424 244.14 65536
+819.816960 244.14 65536
+819.882496 244.14 65536
+819.948032 244.14 65536
+820.013568 244.14 65536
+820.079104 244.14 65536
+820.144640 244.14 65536
+820.210176 244.14 65536
+820.275712 244.14 65536
+820.341248 244.14 65536
+820.406784 244.14 65536
+820.472320 244.14 65536
+820.537856 244.14 65536
+820.603392 244.14 65536
+820.669440 242.25 66048
+820.735488 242.25 66048
+820.801536 242.25 66048
+820.867584 242.25 66048
+820.933632 242.25 66048
+820.999680 242.25 66048
+821.065728 242.25 66048
+821.131776 242.25 66048
+821.197824 242.25 66048
+821.263872 242.25 66048
+821.329920 242.25 66048
+821.395968 242.25 66048
+821.462016 242.25 66048
+821.528064 242.25 66048
+821.594112 242.25 66048
+821.660160 242.25 66048
+821.726208 242.25 66048
+821.792256 242.25 66048
+821.858304 242.25 66048
+821.924352 242.25 66048
+821.990400 242.25 66048
+822.056448 242.25 66048
+822.122496 242.25 66048
+822.188544 242.25 66048
+822.254592 242.25 66048
+822.320640 242.25 66048
+822.386688 242.25 66048
+822.452736 242.25 66048
+822.518784 242.25 66048
+822.584832 242.25 66048
+822.650880 242.25 66048
+822.716928 242.25 66048
+822.782976 242.25 66048
+822.849024 242.25 66048
+822.915072 242.25 66048
+822.981120 242.25 66048
+823.047168 242.25 66048
+823.113216 242.25 66048
+823.179264 242.25 66048
+823.245312 242.25 66048
+823.311360 242.25 66048
+823.377408 242.25 66048
+823.443456 242.25 66048
+823.509504 242.25 66048
+823.575552 242.25 66048
+823.641600 242.25 66048
+823.707648 242.25 66048
+823.773696 242.25 66048
+823.839744 242.25 66048
+823.905792 242.25 66048
+823.971840 242.25 66048
+824.037888 242.25 66048
+824.103936 242.25 66048
+824.169984 242.25 66048
+824.236032 242.25 66048
+824.302080 242.25 66048
+824.368128 242.25 66048
+824.434176 242.25 66048
+824.500224 242.25 66048
+824.566272 242.25 66048
+824.632320 242.25 66048
+824.698368 242.25 66048
+824.764416 242.25 66048
+824.830464 242.25 66048
+824.896512 242.25 66048
+824.962560 242.25 66048
+825.028608 242.25 66048
+825.094656 242.25 66048
+825.160704 242.25 66048
+825.226752 242.25 66048
+825.292800 242.25 66048
+825.358848 242.25 66048
+825.424896 242.25 66048
+825.490944 242.25 66048
+825.556992 242.25 66048
+825.623040 242.25 66048
+825.689088 242.25 66048
+825.755136 242.25 66048
+825.821184 242.25 66048
+825.887232 242.25 66048
+825.953280 242.25 66048
+826.019328 242.25 66048
+826.085376 242.25 66048
+826.151424 242.25 66048
+826.217472 242.25 66048
+826.283520 242.25 66048
+826.349568 242.25 66048
+826.415616 242.25 66048
+826.481664 242.25 66048
+826.547712 242.25 66048
+826.613760 242.25 66048
+826.679808 242.25 66048
+826.745856 242.25 66048
+826.811904 242.25 66048
+826.877952 242.25 66048
+826.944000 242.25 66048
+827.010048 242.25 66048
+827.076096 242.25 66048
+827.142144 242.25 66048
+827.208192 242.25 66048
+827.274240 242.25 66048
+827.340288 242.25 66048
+827.406336 242.25 66048
+827.472384 242.25 66048
+827.538432 242.25 66048
+827.604480 242.25 66048
+827.670528 242.25 66048
+827.736576 242.25 66048
+827.802624 242.25 66048
+827.868672 242.25 66048
+827.934720 242.25 66048
+828.000768 242.25 66048
+828.066816 242.25 66048
+828.132864 242.25 66048
+828.198912 242.25 66048
+828.264960 242.25 66048
+828.331008 242.25 66048
+828.397056 242.25 66048
+828.463104 242.25 66048
+828.529152 242.25 66048
+828.595200 242.25 66048
+828.661248 242.25 66048
+828.727296 242.25 66048
+828.793344 242.25 66048
+828.859392 242.25 66048
+828.925440 242.25 66048
+828.991488 242.25 66048
+829.057536 242.25 66048
+829.124096 240.38 66560
+829.190656 240.38 66560
+829.257216 240.38 66560
+829.323776 240.38 66560
+829.390336 240.38 66560
+829.456896 240.38 66560
+829.523456 240.38 66560
+829.590016 240.38 66560
+829.656576 240.38 66560
+829.723136 240.38 66560
+829.789696 240.38 66560
+829.856256 240.38 66560
+829.922816 240.38 66560
+829.989376 240.38 66560
+830.055936 240.38 66560
+830.122496 240.38 66560
+830.189056 240.38 66560
+830.255616 240.38 66560
+830.322176 240.38 66560
+830.388736 240.38 66560
+830.455296 240.38 66560
+830.521856 240.38 66560
+830.588416 240.38 66560
+830.654976 240.38 66560
+830.721536 240.38 66560
+830.788096 240.38 66560
+830.854656 240.38 66560
+830.921216 240.38 66560
+830.987776 240.38 66560
+831.054336 240.38 66560
+831.120896 240.38 66560
+831.187456 240.38 66560
+831.254016 240.38 66560
+831.320576 240.38 66560
+831.387136 240.38 66560
+831.453696 240.38 66560
+831.520256 240.38 66560
+831.586816 240.38 66560
+831.653376 240.38 66560
+831.719936 240.38 66560
+831.786496 240.38 66560
+831.853056 240.38 66560
+831.919616 240.38 66560
+831.986176 240.38 66560
+832.052736 240.38 66560
+832.119296 240.38 66560
+832.185856 240.38 66560
+832.252416 240.38 66560
+832.318976 240.38 66560
+832.385536 240.38 66560
+832.452096 240.38 66560
+832.518656 240.38 66560
+832.585216 240.38 66560
+832.651776 240.38 66560
+832.718336 240.38 66560
+832.784896 240.38 66560
+832.851456 240.38 66560
+832.918016 240.38 66560
+832.984576 240.38 66560
+833.051136 240.38 66560
+833.117696 240.38 66560
+833.184256 240.38 66560
+833.250816 240.38 66560
+833.317376 240.38 66560
+833.384448 238.55 67072
+833.451520 238.55 67072
+833.518592 238.55 67072
+833.585664 238.55 67072
+833.652736 238.55 67072
+833.719808 238.55 67072
+833.786880 238.55 67072
+833.853952 238.55 67072
+833.921024 238.55 67072
+833.988096 238.55 67072
+834.055168 238.55 67072
+834.122240 238.55 67072
+834.189312 238.55 67072
+834.256384 238.55 67072
+834.323456 238.55 67072
+834.390528 238.55 67072
+834.457600 238.55 67072
+834.524672 238.55 67072
+834.591744 238.55 67072
+834.658816 238.55 67072
+834.725888 238.55 67072
+834.792960 238.55 67072
+834.860032 238.55 67072
+834.927104 238.55 67072
+834.994176 238.55 67072
+835.061248 238.55 67072
+835.128320 238.55 67072
+835.195392 238.55 67072
+835.262464 238.55 67072
+835.329536 238.55 67072
+835.396608 238.55 67072
+835.463680 238.55 67072
+835.530752 238.55 67072
+835.597824 238.55 67072
+835.664896 238.55 67072
+835.731968 238.55 67072
+835.799040 238.55 67072
+835.866112 238.55 67072
+835.933184 238.55 67072
+836.000256 238.55 67072
+836.067328 238.55 67072
+836.134400 238.55 67072
+836.201472 238.55 67072
+836.268544 238.55 67072
+836.335616 238.55 67072
+836.402688 238.55 67072
+836.469760 238.55 67072
+836.536832 238.55 67072
+836.603904 238.55 67072
+836.670976 238.55 67072
+836.738048 238.55 67072
+836.805120 238.55 67072
+836.872192 238.55 67072
+836.939264 238.55 67072
+837.006336 238.55 67072
+837.073408 238.55 67072
+837.140480 238.55 67072
+837.207552 238.55 67072
+837.274624 238.55 67072
+837.341696 238.55 67072
+837.408768 238.55 67072
+837.475840 238.55 67072
+837.542912 238.55 67072
+837.609984 238.55 67072
+837.677568 236.74 67584
+837.745152 236.74 67584
+837.812736 236.74 67584
+837.880320 236.74 67584
+837.947904 236.74 67584
+838.015488 236.74 67584
+838.083072 236.74 67584
+838.150656 236.74 67584
+838.218240 236.74 67584
+838.285824 236.74 67584
+838.353408 236.74 67584
+838.420992 236.74 67584
+838.488576 236.74 67584
+838.556160 236.74 67584
+838.623744 236.74 67584
+838.691328 236.74 67584
+838.758912 236.74 67584
+838.826496 236.74 67584
+838.894080 236.74 67584
+838.961664 236.74 67584
+839.029248 236.74 67584
+839.096832 236.74 67584
+839.164416 236.74 67584
+839.232000 236.74 67584
+839.299584 236.74 67584
+839.367168 236.74 67584
+839.434752 236.74 67584
+839.502336 236.74 67584
+839.569920 236.74 67584
+839.637504 236.74 67584
+839.705088 236.74 67584
+839.772672 236.74 67584
+839.840256 236.74 67584
+839.907840 236.74 67584
+839.975424 236.74 67584
+840.043008 236.74 67584
+840.110592 236.74 67584
+840.178176 236.74 67584
+840.245760 236.74 67584
+840.313344 236.74 67584
+840.380928 236.74 67584
+840.448512 236.74 67584
+840.516096 236.74 67584
+840.583680 236.74 67584
+840.651264 236.74 67584
+840.718848 236.74 67584
+840.786432 236.74 67584
+840.854016 236.74 67584
+840.921600 236.74 67584
+840.989184 236.74 67584
+841.056768 236.74 67584
+841.124352 236.74 67584
+841.191936 236.74 67584
+841.259520 236.74 67584
+841.327104 236.74 67584
+841.394688 236.74 67584
+841.462272 236.74 67584
+841.529856 236.74 67584
+841.597440 236.74 67584
+841.665024 236.74 67584
+841.732608 236.74 67584
+841.800192 236.74 67584
+841.867776 236.74 67584
+841.935360 236.74 67584
+842.002944 236.74 67584
+842.070528 236.74 67584
+842.138112 236.74 67584
+842.205696 236.74 67584
+842.273280 236.74 67584
+842.340864 236.74 67584
+842.408448 236.74 67584
+842.476032 236.74 67584
+842.543616 236.74 67584
+842.611200 236.74 67584
+842.678784 236.74 67584
+842.746368 236.74 67584
+842.813952 236.74 67584
+842.881536 236.74 67584
+842.949120 236.74 67584
+843.016704 236.74 67584
+843.084288 236.74 67584
+843.151872 236.74 67584
+843.219456 236.74 67584
+843.287040 236.74 67584
+843.354624 236.74 67584
+843.422208 236.74 67584
+843.489792 236.74 67584
+843.557376 236.74 67584
+843.624960 236.74 67584
+843.692544 236.74 67584
+843.760128 236.74 67584
+843.827712 236.74 67584
+843.895296 236.74 67584
+843.962880 236.74 67584
+844.030464 236.74 67584
+844.098048 236.74 67584
+844.166144 234.96 68096
+844.234240 234.96 68096
+844.302336 234.96 68096
+844.370432 234.96 68096
+844.438528 234.96 68096
+844.506624 234.96 68096
+844.574720 234.96 68096
+844.642816 234.96 68096
+844.710912 234.96 68096
+844.779008 234.96 68096
+844.847104 234.96 68096
+844.915200 234.96 68096
+844.983296 234.96 68096
+845.051392 234.96 68096
+845.119488 234.96 68096
+845.187584 234.96 68096
+845.255680 234.96 68096
+845.323776 234.96 68096
+845.391872 234.96 68096
+845.459968 234.96 68096
+845.528064 234.96 68096
+845.596160 234.96 68096
+845.664256 234.96 68096
+845.732352 234.96 68096
+845.800448 234.96 68096
+845.868544 234.96 68096
+845.936640 234.96 68096
+846.004736 234.96 68096
+846.072832 234.96 68096
+846.140928 234.96 68096
+846.209024 234.96 68096
+846.277120 234.96 68096
+846.345216 234.96 68096
+846.413312 234.96 68096
+846.481408 234.96 68096
+846.549504 234.96 68096
+846.617600 234.96 68096
+846.685696 234.96 68096
+846.753792 234.96 68096
+846.821888 234.96 68096
+846.889984 234.96 68096
+846.958080 234.96 68096
+847.026176 234.96 68096
+847.094272 234.96 68096
+847.162368 234.96 68096
+847.230464 234.96 68096
+847.298560 234.96 68096
+847.366656 234.96 68096
+847.434752 234.96 68096
+847.502848 234.96 68096
+847.570944 234.96 68096
+847.639040 234.96 68096
+847.707136 234.96 68096
+847.775232 234.96 68096
+847.843328 234.96 68096
+847.911424 234.96 68096
+847.979520 234.96 68096
+848.047616 234.96 68096
+848.115712 234.96 68096
+848.183808 234.96 68096
+848.251904 234.96 68096
+848.320000 234.96 68096
+848.388096 234.96 68096
+848.456192 234.96 68096
+848.524800 233.21 68608
+848.593408 233.21 68608
+848.662016 233.21 68608
+848.730624 233.21 68608
+848.799232 233.21 68608
+848.867840 233.21 68608
+848.936448 233.21 68608
+849.005056 233.21 68608
+849.073664 233.21 68608
+849.142272 233.21 68608
+849.210880 233.21 68608
+849.279488 233.21 68608
+849.348096 233.21 68608
+849.416704 233.21 68608
+849.485312 233.21 68608
+849.553920 233.21 68608
+849.622528 233.21 68608
+849.691136 233.21 68608
+849.759744 233.21 68608
+849.828352 233.21 68608
+849.896960 233.21 68608
+849.965568 233.21 68608
+850.034176 233.21 68608
+850.102784 233.21 68608
+850.171392 233.21 68608
+850.240000 233.21 68608
+850.308608 233.21 68608
+850.377216 233.21 68608
+850.445824 233.21 68608
+850.514432 233.21 68608
+850.583040 233.21 68608
+850.651648 233.21 68608
+850.720256 233.21 68608
+850.788864 233.21 68608
+850.857472 233.21 68608
+850.926080 233.21 68608
+850.994688 233.21 68608
+851.063296 233.21 68608
+851.131904 233.21 68608
+851.200512 233.21 68608
+851.269120 233.21 68608
+851.337728 233.21 68608
+851.406336 233.21 68608
+851.474944 233.21 68608
+851.543552 233.21 68608
+851.612160 233.21 68608
+851.680768 233.21 68608
+851.749376 233.21 68608
+851.817984 233.21 68608
+851.886592 233.21 68608
+851.955200 233.21 68608
+852.023808 233.21 68608
+852.092416 233.21 68608
+852.161024 233.21 68608
+852.229632 233.21 68608
+852.298240 233.21 68608
+852.366848 233.21 68608
+852.435456 233.21 68608
+852.504064 233.21 68608
+852.572672 233.21 68608
+852.641280 233.21 68608
+852.709888 233.21 68608
+852.778496 233.21 68608
+852.847104 233.21 68608
+852.916224 231.48 69120
+852.985344 231.48 69120
+853.054464 231.48 69120
+853.123584 231.48 69120
+853.192704 231.48 69120
+853.261824 231.48 69120
+853.330944 231.48 69120
+853.400064 231.48 69120
+853.469184 231.48 69120
+853.538304 231.48 69120
+853.607424 231.48 69120
+853.676544 231.48 69120
+853.745664 231.48 69120
+853.814784 231.48 69120
+853.883904 231.48 69120
+853.953024 231.48 69120
+854.022144 231.48 69120
+854.091264 231.48 69120
+854.160384 231.48 69120
+854.229504 231.48 69120
+854.298624 231.48 69120
+854.367744 231.48 69120
+854.436864 231.48 69120
+854.505984 231.48 69120
+854.575104 231.48 69120
+854.644224 231.48 69120
+854.713344 231.48 69120
+854.782464 231.48 69120
+854.851584 231.48 69120
+854.920704 231.48 69120
+854.989824 231.48 69120
+855.058944 231.48 69120
+855.128064 231.48 69120
+855.197184 231.48 69120
+855.266304 231.48 69120
+855.335424 231.48 69120
+855.404544 231.48 69120
+855.473664 231.48 69120
+855.542784 231.48 69120
+855.611904 231.48 69120
+855.681024 231.48 69120
+855.750144 231.48 69120
+855.819264 231.48 69120
+855.888384 231.48 69120
+855.957504 231.48 69120
+856.026624 231.48 69120
+856.095744 231.48 69120
+856.164864 231.48 69120
+856.233984 231.48 69120
+856.303104 231.48 69120
+856.372224 231.48 69120
+856.441344 231.48 69120
+856.510464 231.48 69120
+856.579584 231.48 69120
+856.648704 231.48 69120
+856.717824 231.48 69120
+856.786944 231.48 69120
+856.856064 231.48 69120
+856.925184 231.48 69120
+856.994304 231.48 69120
+857.063424 231.48 69120
+857.132544 231.48 69120
+857.201664 231.48 69120
+857.270784 231.48 69120
+857.339904 231.48 69120
+857.409024 231.48 69120
+857.478144 231.48 69120
+857.547264 231.48 69120
+857.616384 231.48 69120
+857.685504 231.48 69120
+857.754624 231.48 69120
+857.823744 231.48 69120
+857.892864 231.48 69120
+857.961984 231.48 69120
+858.031104 231.48 69120
+858.100224 231.48 69120
+858.169344 231.48 69120
+858.238464 231.48 69120
+858.307584 231.48 69120
+858.376704 231.48 69120
+858.445824 231.48 69120
+858.514944 231.48 69120
+858.584064 231.48 69120
+858.653184 231.48 69120
+858.722304 231.48 69120
+858.791424 231.48 69120
+858.860544 231.48 69120
+858.929664 231.48 69120
+858.998784 231.48 69120
+859.067904 231.48 69120
+859.137024 231.48 69120
+859.206144 231.48 69120
+859.275264 231.48 69120
+859.344384 231.48 69120
+859.413504 231.48 69120
+859.482624 231.48 69120
+859.551744 231.48 69120
+859.620864 231.48 69120
+859.689984 231.48 69120
+859.759104 231.48 69120
+859.828224 231.48 69120
+859.897344 231.48 69120
+859.966464 231.48 69120
+860.035584 231.48 69120
+860.104704 231.48 69120
+860.173824 231.48 69120
+860.242944 231.48 69120
+860.312064 231.48 69120
+860.381184 231.48 69120
+860.450304 231.48 69120
+860.519424 231.48 69120
+860.588544 231.48 69120
+860.657664 231.48 69120
+860.726784 231.48 69120
+860.795904 231.48 69120
+860.865024 231.48 69120
+860.934144 231.48 69120
+861.003264 231.48 69120
+861.072384 231.48 69120
+861.141504 231.48 69120
+861.210624 231.48 69120
+861.279744 231.48 69120
+861.348864 231.48 69120
+861.417984 231.48 69120
+861.487104 231.48 69120
+861.556224 231.48 69120
+861.625344 231.48 69120
+861.694464 231.48 69120
+861.764096 229.78 69632
+861.833728 229.78 69632
+861.903360 229.78 69632
+861.972992 229.78 69632
+862.042624 229.78 69632
+862.112256 229.78 69632
+862.181888 229.78 69632
+862.251520 229.78 69632
+862.321152 229.78 69632
+862.390784 229.78 69632
+862.460416 229.78 69632
+862.530048 229.78 69632
+862.599680 229.78 69632
+862.669312 229.78 69632
+862.738944 229.78 69632
+862.808576 229.78 69632
+862.878208 229.78 69632
+862.947840 229.78 69632
+863.017472 229.78 69632
+863.087104 229.78 69632
+863.156736 229.78 69632
+863.226368 229.78 69632
+863.296000 229.78 69632
+863.365632 229.78 69632
+863.435264 229.78 69632
+863.504896 229.78 69632
+863.574528 229.78 69632
+863.644160 229.78 69632
+863.713792 229.78 69632
+863.783424 229.78 69632
+863.853056 229.78 69632
+863.922688 229.78 69632
+863.992320 229.78 69632
+864.061952 229.78 69632
+864.131584 229.78 69632
+864.201216 229.78 69632
+864.270848 229.78 69632
+864.340480 229.78 69632
+864.410112 229.78 69632
+864.479744 229.78 69632
+864.549376 229.78 69632
+864.619008 229.78 69632
+864.688640 229.78 69632
+864.758272 229.78 69632
+864.827904 229.78 69632
+864.897536 229.78 69632
+864.967168 229.78 69632
+865.036800 229.78 69632
+865.106432 229.78 69632
+865.176064 229.78 69632
+865.245696 229.78 69632
+865.315328 229.78 69632
+865.384960 229.78 69632
+865.454592 229.78 69632
+865.524224 229.78 69632
+865.593856 229.78 69632
+865.663488 229.78 69632
+865.733120 229.78 69632
+865.802752 229.78 69632
+865.872384 229.78 69632
+865.942016 229.78 69632
+866.011648 229.78 69632
+866.081280 229.78 69632
+866.150912 229.78 69632
+866.221056 228.10 70144
+866.291200 228.10 70144
+866.361344 228.10 70144
+866.431488 228.10 70144
+866.501632 228.10 70144
+866.571776 228.10 70144
+866.641920 228.10 70144
+866.712064 228.10 70144
+866.782208 228.10 70144
+866.852352 228.10 70144
+866.922496 228.10 70144
+866.992640 228.10 70144
+867.062784 228.10 70144
+867.132928 228.10 70144
+867.203072 228.10 70144
+867.273216 228.10 70144
+867.343360 228.10 70144
+867.413504 228.10 70144
+867.483648 228.10 70144
+867.553792 228.10 70144
+867.623936 228.10 70144
+867.694080 228.10 70144
+867.764224 228.10 70144
+867.834368 228.10 70144
+867.904512 228.10 70144
+867.974656 228.10 70144
+868.044800 228.10 70144
+868.114944 228.10 70144
+868.185088 228.10 70144
+868.255232 228.10 70144
+868.325376 228.10 70144
+868.395520 228.10 70144
+868.465664 228.10 70144
+868.535808 228.10 70144
+868.605952 228.10 70144
+868.676096 228.10 70144
+868.746240 228.10 70144
+868.816384 228.10 70144
+868.886528 228.10 70144
+868.956672 228.10 70144
+869.026816 228.10 70144
+869.096960 228.10 70144
+869.167104 228.10 70144
+869.237248 228.10 70144
+869.307392 228.10 70144
+869.377536 228.10 70144
+869.447680 228.10 70144
+869.517824 228.10 70144
+869.587968 228.10 70144
+869.658112 228.10 70144
+869.728256 228.10 70144
+869.798400 228.10 70144
+869.868544 228.10 70144
+869.938688 228.10 70144
+870.008832 228.10 70144
+870.078976 228.10 70144
+870.149120 228.10 70144
+870.219264 228.10 70144
+870.289408 228.10 70144
+870.359552 228.10 70144
+870.429696 228.10 70144
+870.499840 228.10 70144
+870.569984 228.10 70144
+870.640128 228.10 70144
+870.710272 228.10 70144
+870.780416 228.10 70144
+870.850560 228.10 70144
+870.920704 228.10 70144
+870.990848 228.10 70144
+871.060992 228.10 70144
+871.131136 228.10 70144
+871.201280 228.10 70144
+871.271424 228.10 70144
+871.341568 228.10 70144
+871.411712 228.10 70144
+871.481856 228.10 70144
+871.552000 228.10 70144
+871.622144 228.10 70144
+871.692288 228.10 70144
+871.762432 228.10 70144
+871.832576 228.10 70144
+871.902720 228.10 70144
+871.972864 228.10 70144
+872.043008 228.10 70144
+872.113152 228.10 70144
+872.183296 228.10 70144
+872.253440 228.10 70144
+872.323584 228.10 70144
+872.393728 228.10 70144
+872.463872 228.10 70144
+872.534016 228.10 70144
+872.604160 228.10 70144
+872.674304 228.10 70144
+872.744448 228.10 70144
+872.814592 228.10 70144
+872.884736 228.10 70144
+872.955392 226.45 70656
+873.026048 226.45 70656
+873.096704 226.45 70656
+873.167360 226.45 70656
+873.238016 226.45 70656
+873.308672 226.45 70656
+873.379328 226.45 70656
+873.449984 226.45 70656
+873.520640 226.45 70656
+873.591296 226.45 70656
+873.661952 226.45 70656
+873.732608 226.45 70656
+873.803264 226.45 70656
+873.873920 226.45 70656
+873.944576 226.45 70656
+874.015232 226.45 70656
+874.085888 226.45 70656
+874.156544 226.45 70656
+874.227200 226.45 70656
+874.297856 226.45 70656
+874.368512 226.45 70656
+874.439168 226.45 70656
+874.509824 226.45 70656
+874.580480 226.45 70656
+874.651136 226.45 70656
+874.721792 226.45 70656
+874.792448 226.45 70656
+874.863104 226.45 70656
+874.933760 226.45 70656
+875.004416 226.45 70656
+875.075072 226.45 70656
+875.145728 226.45 70656
+875.216384 226.45 70656
+875.287040 226.45 70656
+875.357696 226.45 70656
+875.428352 226.45 70656
+875.499008 226.45 70656
+875.569664 226.45 70656
+875.640320 226.45 70656
+875.710976 226.45 70656
+875.781632 226.45 70656
+875.852288 226.45 70656
+875.922944 226.45 70656
+875.993600 226.45 70656
+876.064256 226.45 70656
+876.134912 226.45 70656
+876.205568 226.45 70656
+876.276224 226.45 70656
+876.346880 226.45 70656
+876.417536 226.45 70656
+876.488192 226.45 70656
+876.558848 226.45 70656
+876.629504 226.45 70656
+876.700160 226.45 70656
+876.770816 226.45 70656
+876.841472 226.45 70656
+876.912128 226.45 70656
+876.982784 226.45 70656
+877.053440 226.45 70656
+877.124096 226.45 70656
+877.194752 226.45 70656
+877.265408 226.45 70656
+877.336064 226.45 70656
+877.406720 226.45 70656
+877.477888 224.82 71168
+877.549056 224.82 71168
+877.620224 224.82 71168
+877.691392 224.82 71168
+877.762560 224.82 71168
+877.833728 224.82 71168
+877.904896 224.82 71168
+877.976064 224.82 71168
+878.047232 224.82 71168
+878.118400 224.82 71168
+878.189568 224.82 71168
+878.260736 224.82 71168
+878.331904 224.82 71168
+878.403072 224.82 71168
+878.474240 224.82 71168
+878.545408 224.82 71168
+878.616576 224.82 71168
+878.687744 224.82 71168
+878.758912 224.82 71168
+878.830080 224.82 71168
+878.901248 224.82 71168
+878.972416 224.82 71168
+879.043584 224.82 71168
+879.114752 224.82 71168
+879.185920 224.82 71168
+879.257088 224.82 71168
+879.328256 224.82 71168
+879.399424 224.82 71168
+879.470592 224.82 71168
+879.541760 224.82 71168
+879.612928 224.82 71168
+879.684096 224.82 71168
+879.755264 224.82 71168
+879.826432 224.82 71168
+879.897600 224.82 71168
+879.968768 224.82 71168
+880.039936 224.82 71168
+880.111104 224.82 71168
+880.182272 224.82 71168
+880.253440 224.82 71168
+880.324608 224.82 71168
+880.395776 224.82 71168
+880.466944 224.82 71168
+880.538112 224.82 71168
+880.609280 224.82 71168
+880.680448 224.82 71168
+880.751616 224.82 71168
+880.822784 224.82 71168
+880.893952 224.82 71168
+880.965120 224.82 71168
+881.036288 224.82 71168
+881.107456 224.82 71168
+881.178624 224.82 71168
+881.249792 224.82 71168
+881.320960 224.82 71168
+881.392128 224.82 71168
+881.463296 224.82 71168
+881.534464 224.82 71168
+881.605632 224.82 71168
+881.676800 224.82 71168
+881.747968 224.82 71168
+881.819136 224.82 71168
+881.890304 224.82 71168
+881.961472 224.82 71168
+882.033152 223.21 71680
+882.104832 223.21 71680
+882.176512 223.21 71680
+882.248192 223.21 71680
+882.319872 223.21 71680
+882.391552 223.21 71680
+882.463232 223.21 71680
+882.534912 223.21 71680
+882.606592 223.21 71680
+882.678272 223.21 71680
+882.749952 223.21 71680
+882.821632 223.21 71680
+882.893312 223.21 71680
+882.964992 223.21 71680
+883.036672 223.21 71680
+883.108352 223.21 71680
+883.180032 223.21 71680
+883.251712 223.21 71680
+883.323392 223.21 71680
+883.395072 223.21 71680
+883.466752 223.21 71680
+883.538432 223.21 71680
+883.610112 223.21 71680
+883.681792 223.21 71680
+883.753472 223.21 71680
+883.825152 223.21 71680
+883.896832 223.21 71680
+883.968512 223.21 71680
+884.040192 223.21 71680
+884.111872 223.21 71680
+884.183552 223.21 71680
+884.255232 223.21 71680
+884.326912 223.21 71680
+884.398592 223.21 71680
+884.470272 223.21 71680
+884.541952 223.21 71680
+884.613632 223.21 71680
+884.685312 223.21 71680
+884.756992 223.21 71680
+884.828672 223.21 71680
+884.900352 223.21 71680
+884.972032 223.21 71680
+885.043712 223.21 71680
+885.115392 223.21 71680
+885.187072 223.21 71680
+885.258752 223.21 71680
+885.330432 223.21 71680
+885.402112 223.21 71680
+885.473792 223.21 71680
+885.545472 223.21 71680
+885.617152 223.21 71680
+885.688832 223.21 71680
+885.760512 223.21 71680
+885.832192 223.21 71680
+885.903872 223.21 71680
+885.975552 223.21 71680
+886.047232 223.21 71680
+886.118912 223.21 71680
+886.190592 223.21 71680
+886.262272 223.21 71680
+886.333952 223.21 71680
+886.405632 223.21 71680
+886.477312 223.21 71680
+886.548992 223.21 71680
+886.620672 223.21 71680
+886.692352 223.21 71680
+886.764032 223.21 71680
+886.835712 223.21 71680
+886.907392 223.21 71680
+886.979072 223.21 71680
+887.050752 223.21 71680
+887.122432 223.21 71680
+887.194112 223.21 71680
+887.265792 223.21 71680
+887.337472 223.21 71680
+887.409152 223.21 71680
+887.480832 223.21 71680
+887.552512 223.21 71680
+887.624192 223.21 71680
+887.695872 223.21 71680
+887.767552 223.21 71680
+887.839232 223.21 71680
+887.910912 223.21 71680
+887.982592 223.21 71680
+888.054272 223.21 71680
+888.125952 223.21 71680
+888.197632 223.21 71680
+888.269312 223.21 71680
+888.340992 223.21 71680
+888.412672 223.21 71680
+888.484352 223.21 71680
+888.556032 223.21 71680
+888.627712 223.21 71680
+888.699392 223.21 71680
+888.771072 223.21 71680
+888.842752 223.21 71680
+888.914944 221.63 72192
+888.987136 221.63 72192
+889.059328 221.63 72192
+889.131520 221.63 72192
+889.203712 221.63 72192
+889.275904 221.63 72192
+889.348096 221.63 72192
+889.420288 221.63 72192
+889.492480 221.63 72192
+889.564672 221.63 72192
+889.636864 221.63 72192
+889.709056 221.63 72192
+889.781248 221.63 72192
+889.853440 221.63 72192
+889.925632 221.63 72192
+889.997824 221.63 72192
+890.070016 221.63 72192
+890.142208 221.63 72192
+890.214400 221.63 72192
+890.286592 221.63 72192
+890.358784 221.63 72192
+890.430976 221.63 72192
+890.503168 221.63 72192
+890.575360 221.63 72192
+890.647552 221.63 72192
+890.719744 221.63 72192
+890.791936 221.63 72192
+890.864128 221.63 72192
+890.936320 221.63 72192
+891.008512 221.63 72192
+891.080704 221.63 72192
+891.152896 221.63 72192
+891.225088 221.63 72192
+891.297280 221.63 72192
+891.369472 221.63 72192
+891.441664 221.63 72192
+891.513856 221.63 72192
+891.586048 221.63 72192
+891.658240 221.63 72192
+891.730432 221.63 72192
+891.802624 221.63 72192
+891.874816 221.63 72192
+891.947008 221.63 72192
+892.019200 221.63 72192
+892.091392 221.63 72192
+892.163584 221.63 72192
+892.235776 221.63 72192
+892.307968 221.63 72192
+892.380160 221.63 72192
+892.452352 221.63 72192
+892.524544 221.63 72192
+892.596736 221.63 72192
+892.668928 221.63 72192
+892.741120 221.63 72192
+892.813312 221.63 72192
+892.885504 221.63 72192
+892.957696 221.63 72192
+893.029888 221.63 72192
+893.102080 221.63 72192
+893.174272 221.63 72192
+893.246464 221.63 72192
+893.318656 221.63 72192
+893.390848 221.63 72192
+893.463040 221.63 72192
+893.535744 220.07 72704
+893.608448 220.07 72704
+893.681152 220.07 72704
+893.753856 220.07 72704
+893.826560 220.07 72704
+893.899264 220.07 72704
+893.971968 220.07 72704
+894.044672 220.07 72704
+894.117376 220.07 72704
+894.190080 220.07 72704
+894.262784 220.07 72704
+894.335488 220.07 72704
+894.408192 220.07 72704
+894.480896 220.07 72704
+894.553600 220.07 72704
+894.626304 220.07 72704
+894.699008 220.07 72704
+894.771712 220.07 72704
+894.844416 220.07 72704
+894.917120 220.07 72704
+894.989824 220.07 72704
+895.062528 220.07 72704
+895.135232 220.07 72704
+895.207936 220.07 72704
+895.280640 220.07 72704
+895.353344 220.07 72704
+895.426048 220.07 72704
+895.498752 220.07 72704
+895.571456 220.07 72704
+895.644160 220.07 72704
+895.716864 220.07 72704
+895.789568 220.07 72704
+895.862784 218.53 73216
+895.936000 218.53 73216
+896.009216 218.53 73216
+896.082432 218.53 73216
+896.155648 218.53 73216
+896.228864 218.53 73216
+896.302080 218.53 73216
+896.375296 218.53 73216
+896.448512 218.53 73216
+896.521728 218.53 73216
+896.594944 218.53 73216
+896.668160 218.53 73216
+896.741376 218.53 73216
+896.814592 218.53 73216
+896.887808 218.53 73216
+896.961024 218.53 73216
+897.034240 218.53 73216
+897.107456 218.53 73216
+897.180672 218.53 73216
+897.253888 218.53 73216
+897.327104 218.53 73216
+897.400320 218.53 73216
+897.473536 218.53 73216
+897.546752 218.53 73216
+897.619968 218.53 73216
+897.693184 218.53 73216
+897.766400 218.53 73216
+897.839616 218.53 73216
+897.912832 218.53 73216
+897.986048 218.53 73216
+898.059264 218.53 73216
+898.132480 218.53 73216
+898.205696 218.53 73216
+898.278912 218.53 73216
+898.352128 218.53 73216
+898.425344 218.53 73216
+898.498560 218.53 73216
+898.571776 218.53 73216
+898.644992 218.53 73216
+898.718208 218.53 73216
+898.791424 218.53 73216
+898.864640 218.53 73216
+898.937856 218.53 73216
+899.011072 218.53 73216
+899.084288 218.53 73216
+899.157504 218.53 73216
+899.230720 218.53 73216
+899.303936 218.53 73216
+899.377152 218.53 73216
+899.450368 218.53 73216
+899.523584 218.53 73216
+899.596800 218.53 73216
+899.670016 218.53 73216
+899.743232 218.53 73216
+899.816448 218.53 73216
+899.889664 218.53 73216
+899.962880 218.53 73216
+900.036096 218.53 73216
+900.109312 218.53 73216
+900.182528 218.53 73216
+900.255744 218.53 73216
+900.328960 218.53 73216
+900.402176 218.53 73216
+900.475392 218.53 73216
+900.549120 217.01 73728
+900.622848 217.01 73728
+900.696576 217.01 73728
+900.770304 217.01 73728
+900.844032 217.01 73728
+900.917760 217.01 73728
+900.991488 217.01 73728
+901.065216 217.01 73728
+901.138944 217.01 73728
+901.212672 217.01 73728
+901.286400 217.01 73728
+901.360128 217.01 73728
+901.433856 217.01 73728
+901.507584 217.01 73728
+901.581312 217.01 73728
+901.655040 217.01 73728
+901.728768 217.01 73728
+901.802496 217.01 73728
+901.876224 217.01 73728
+901.949952 217.01 73728
+902.023680 217.01 73728
+902.097408 217.01 73728
+902.171136 217.01 73728
+902.244864 217.01 73728
+902.318592 217.01 73728
+902.392320 217.01 73728
+902.466048 217.01 73728
+902.539776 217.01 73728
+902.613504 217.01 73728
+902.687232 217.01 73728
+902.760960 217.01 73728
+902.834688 217.01 73728
+902.908416 217.01 73728
+902.982144 217.01 73728
+903.055872 217.01 73728
+903.129600 217.01 73728
+903.203328 217.01 73728
+903.277056 217.01 73728
+903.350784 217.01 73728
+903.424512 217.01 73728
+903.498240 217.01 73728
+903.571968 217.01 73728
+903.645696 217.01 73728
+903.719424 217.01 73728
+903.793152 217.01 73728
+903.866880 217.01 73728
+903.940608 217.01 73728
+904.014336 217.01 73728
+904.088064 217.01 73728
+904.161792 217.01 73728
+904.235520 217.01 73728
+904.309248 217.01 73728
+904.382976 217.01 73728
+904.456704 217.01 73728
+904.530432 217.01 73728
+904.604160 217.01 73728
+904.677888 217.01 73728
+904.751616 217.01 73728
+904.825344 217.01 73728
+904.899072 217.01 73728
+904.972800 217.01 73728
+905.046528 217.01 73728
+905.120256 217.01 73728
+905.193984 217.01 73728
+905.267712 217.01 73728
+905.341440 217.01 73728
+905.415168 217.01 73728
+905.488896 217.01 73728
+905.562624 217.01 73728
+905.636352 217.01 73728
+905.710080 217.01 73728
+905.783808 217.01 73728
+905.857536 217.01 73728
+905.931264 217.01 73728
+906.004992 217.01 73728
+906.078720 217.01 73728
+906.152448 217.01 73728
+906.226176 217.01 73728
+906.299904 217.01 73728
+906.373632 217.01 73728
+906.447360 217.01 73728
+906.521088 217.01 73728
+906.594816 217.01 73728
+906.668544 217.01 73728
+906.742272 217.01 73728
+906.816000 217.01 73728
+906.889728 217.01 73728
+906.963456 217.01 73728
+907.037184 217.01 73728
+907.110912 217.01 73728
+907.184640 217.01 73728
+907.258368 217.01 73728
+907.332096 217.01 73728
+907.405824 217.01 73728
+907.479552 217.01 73728
+907.553280 217.01 73728
+907.627520 215.52 74240
+907.701760 215.52 74240
+907.776000 215.52 74240
+907.850240 215.52 74240
+907.924480 215.52 74240
+907.998720 215.52 74240
+908.072960 215.52 74240
+908.147200 215.52 74240
+908.221440 215.52 74240
+908.295680 215.52 74240
+908.369920 215.52 74240
+908.444160 215.52 74240
+908.518400 215.52 74240
+908.592640 215.52 74240
+908.666880 215.52 74240
+908.741120 215.52 74240
+908.815360 215.52 74240
+908.889600 215.52 74240
+908.963840 215.52 74240
+909.038080 215.52 74240
+909.112320 215.52 74240
+909.186560 215.52 74240
+909.260800 215.52 74240
+909.335040 215.52 74240
+909.409280 215.52 74240
+909.483520 215.52 74240
+909.557760 215.52 74240
+909.632000 215.52 74240
+909.706240 215.52 74240
+909.780480 215.52 74240
+909.854720 215.52 74240
+909.928960 215.52 74240
+910.003200 215.52 74240
+910.077440 215.52 74240
+910.151680 215.52 74240
+910.225920 215.52 74240
+910.300160 215.52 74240
+910.374400 215.52 74240
+910.448640 215.52 74240
+910.522880 215.52 74240
+910.597120 215.52 74240
+910.671360 215.52 74240
+910.745600 215.52 74240
+910.819840 215.52 74240
+910.894080 215.52 74240
+910.968320 215.52 74240
+911.042560 215.52 74240
+911.116800 215.52 74240
+911.191040 215.52 74240
+911.265280 215.52 74240
+911.339520 215.52 74240
+911.413760 215.52 74240
+911.488000 215.52 74240
+911.562240 215.52 74240
+911.636480 215.52 74240
+911.710720 215.52 74240
+911.784960 215.52 74240
+911.859200 215.52 74240
+911.933440 215.52 74240
+912.007680 215.52 74240
+912.081920 215.52 74240
+912.156160 215.52 74240
+912.230400 215.52 74240
+912.304640 215.52 74240
+912.379392 214.04 74752
+912.454144 214.04 74752
+912.528896 214.04 74752
+912.603648 214.04 74752
+912.678400 214.04 74752
+912.753152 214.04 74752
+912.827904 214.04 74752
+912.902656 214.04 74752
+912.977408 214.04 74752
+913.052160 214.04 74752
+913.126912 214.04 74752
+913.201664 214.04 74752
+913.276416 214.04 74752
+913.351168 214.04 74752
+913.425920 214.04 74752
+913.500672 214.04 74752
+913.575424 214.04 74752
+913.650176 214.04 74752
+913.724928 214.04 74752
+913.799680 214.04 74752
+913.874432 214.04 74752
+913.949184 214.04 74752
+914.023936 214.04 74752
+914.098688 214.04 74752
+914.173440 214.04 74752
+914.248192 214.04 74752
+914.322944 214.04 74752
+914.397696 214.04 74752
+914.472448 214.04 74752
+914.547200 214.04 74752
+914.621952 214.04 74752
+914.696704 214.04 74752
+914.771968 212.59 75264
+914.847232 212.59 75264
+914.922496 212.59 75264
+914.997760 212.59 75264
+915.073024 212.59 75264
+915.148288 212.59 75264
+915.223552 212.59 75264
+915.298816 212.59 75264
+915.374080 212.59 75264
+915.449344 212.59 75264
+915.524608 212.59 75264
+915.599872 212.59 75264
+915.675136 212.59 75264
+915.750400 212.59 75264
+915.825664 212.59 75264
+915.900928 212.59 75264
+915.976192 212.59 75264
+916.051456 212.59 75264
+916.126720 212.59 75264
+916.201984 212.59 75264
+916.277248 212.59 75264
+916.352512 212.59 75264
+916.427776 212.59 75264
+916.503040 212.59 75264
+916.578304 212.59 75264
+916.653568 212.59 75264
+916.728832 212.59 75264
+916.804096 212.59 75264
+916.879360 212.59 75264
+916.954624 212.59 75264
+917.029888 212.59 75264
+917.105152 212.59 75264
+917.180416 212.59 75264
+917.255680 212.59 75264
+917.330944 212.59 75264
+917.406208 212.59 75264
+917.481472 212.59 75264
+917.556736 212.59 75264
+917.632000 212.59 75264
+917.707264 212.59 75264
+917.782528 212.59 75264
+917.857792 212.59 75264
+917.933056 212.59 75264
+918.008320 212.59 75264
+918.083584 212.59 75264
+918.158848 212.59 75264
+918.234112 212.59 75264
+918.309376 212.59 75264
+918.384640 212.59 75264
+918.459904 212.59 75264
+918.535168 212.59 75264
+918.610432 212.59 75264
+918.685696 212.59 75264
+918.760960 212.59 75264
+918.836224 212.59 75264
+918.911488 212.59 75264
+918.986752 212.59 75264
+919.062016 212.59 75264
+919.137280 212.59 75264
+919.212544 212.59 75264
+919.287808 212.59 75264
+919.363072 212.59 75264
+919.438336 212.59 75264
+919.513600 212.59 75264
+919.588864 212.59 75264
+919.664128 212.59 75264
+919.739392 212.59 75264
+919.814656 212.59 75264
+919.889920 212.59 75264
+919.965184 212.59 75264
+920.040448 212.59 75264
+920.115712 212.59 75264
+920.190976 212.59 75264
+920.266240 212.59 75264
+920.341504 212.59 75264
+920.416768 212.59 75264
+920.492032 212.59 75264
+920.567296 212.59 75264
+920.642560 212.59 75264
+920.717824 212.59 75264
+920.793088 212.59 75264
+920.868352 212.59 75264
+920.943616 212.59 75264
+921.018880 212.59 75264
+921.094144 212.59 75264
+921.169408 212.59 75264
+921.244672 212.59 75264
+921.319936 212.59 75264
+921.395200 212.59 75264
+921.470464 212.59 75264
+921.545728 212.59 75264
+921.620992 212.59 75264
+921.696256 212.59 75264
+921.771520 212.59 75264
+921.846784 212.59 75264
+921.922048 212.59 75264
+921.997824 211.15 75776
+922.073600 211.15 75776
+922.149376 211.15 75776
+922.225152 211.15 75776
+922.300928 211.15 75776
+922.376704 211.15 75776
+922.452480 211.15 75776
+922.528256 211.15 75776
+922.604032 211.15 75776
+922.679808 211.15 75776
+922.755584 211.15 75776
+922.831360 211.15 75776
+922.907136 211.15 75776
+922.982912 211.15 75776
+923.058688 211.15 75776
+923.134464 211.15 75776
+923.210240 211.15 75776
+923.286016 211.15 75776
+923.361792 211.15 75776
+923.437568 211.15 75776
+923.513344 211.15 75776
+923.589120 211.15 75776
+923.664896 211.15 75776
+923.740672 211.15 75776
+923.816448 211.15 75776
+923.892224 211.15 75776
+923.968000 211.15 75776
+924.043776 211.15 75776
+924.119552 211.15 75776
+924.195328 211.15 75776
+924.271104 211.15 75776
+924.346880 211.15 75776
+924.422656 211.15 75776
+924.498432 211.15 75776
+924.574208 211.15 75776
+924.649984 211.15 75776
+924.725760 211.15 75776
+924.801536 211.15 75776
+924.877312 211.15 75776
+924.953088 211.15 75776
+925.028864 211.15 75776
+925.104640 211.15 75776
+925.180416 211.15 75776
+925.256192 211.15 75776
+925.331968 211.15 75776
+925.407744 211.15 75776
+925.483520 211.15 75776
+925.559296 211.15 75776
+925.635072 211.15 75776
+925.710848 211.15 75776
+925.786624 211.15 75776
+925.862400 211.15 75776
+925.938176 211.15 75776
+926.013952 211.15 75776
+926.089728 211.15 75776
+926.165504 211.15 75776
+926.241280 211.15 75776
+926.317056 211.15 75776
+926.392832 211.15 75776
+926.468608 211.15 75776
+926.544384 211.15 75776
+926.620160 211.15 75776
+926.695936 211.15 75776
+926.771712 211.15 75776
+926.848000 209.73 76288
+926.924288 209.73 76288
+927.000576 209.73 76288
+927.076864 209.73 76288
+927.153152 209.73 76288
+927.229440 209.73 76288
+927.305728 209.73 76288
+927.382016 209.73 76288
+927.458304 209.73 76288
+927.534592 209.73 76288
+927.610880 209.73 76288
+927.687168 209.73 76288
+927.763456 209.73 76288
+927.839744 209.73 76288
+927.916032 209.73 76288
+927.992320 209.73 76288
+928.068608 209.73 76288
+928.144896 209.73 76288
+928.221184 209.73 76288
+928.297472 209.73 76288
+928.373760 209.73 76288
+928.450048 209.73 76288
+928.526336 209.73 76288
+928.602624 209.73 76288
+928.678912 209.73 76288
+928.755200 209.73 76288
+928.831488 209.73 76288
+928.907776 209.73 76288
+928.984064 209.73 76288
+929.060352 209.73 76288
+929.136640 209.73 76288
+929.212928 209.73 76288
+929.289728 208.33 76800
+929.366528 208.33 76800
+929.443328 208.33 76800
+929.520128 208.33 76800
+929.596928 208.33 76800
+929.673728 208.33 76800
+929.750528 208.33 76800
+929.827328 208.33 76800
+929.904128 208.33 76800
+929.980928 208.33 76800
+930.057728 208.33 76800
+930.134528 208.33 76800
+930.211328 208.33 76800
+930.288128 208.33 76800
+930.364928 208.33 76800
+930.441728 208.33 76800
+930.518528 208.33 76800
+930.595328 208.33 76800
+930.672128 208.33 76800
+930.748928 208.33 76800
+930.825728 208.33 76800
+930.902528 208.33 76800
+930.979328 208.33 76800
+931.056128 208.33 76800
+931.132928 208.33 76800
+931.209728 208.33 76800
+931.286528 208.33 76800
+931.363328 208.33 76800
+931.440128 208.33 76800
+931.516928 208.33 76800
+931.593728 208.33 76800
+931.670528 208.33 76800
+931.747328 208.33 76800
+931.824128 208.33 76800
+931.900928 208.33 76800
+931.977728 208.33 76800
+932.054528 208.33 76800
+932.131328 208.33 76800
+932.208128 208.33 76800
+932.284928 208.33 76800
+932.361728 208.33 76800
+932.438528 208.33 76800
+932.515328 208.33 76800
+932.592128 208.33 76800
+932.668928 208.33 76800
+932.745728 208.33 76800
+932.822528 208.33 76800
+932.899328 208.33 76800
+932.976128 208.33 76800
+933.052928 208.33 76800
+933.129728 208.33 76800
+933.206528 208.33 76800
+933.283328 208.33 76800
+933.360128 208.33 76800
+933.436928 208.33 76800
+933.513728 208.33 76800
+933.590528 208.33 76800
+933.667328 208.33 76800
+933.744128 208.33 76800
+933.820928 208.33 76800
+933.897728 208.33 76800
+933.974528 208.33 76800
+934.051328 208.33 76800
+934.128128 208.33 76800
+934.205440 206.95 77312
+934.282752 206.95 77312
+934.360064 206.95 77312
+934.437376 206.95 77312
+934.514688 206.95 77312
+934.592000 206.95 77312
+934.669312 206.95 77312
+934.746624 206.95 77312
+934.823936 206.95 77312
+934.901248 206.95 77312
+934.978560 206.95 77312
+935.055872 206.95 77312
+935.133184 206.95 77312
+935.210496 206.95 77312
+935.287808 206.95 77312
+935.365120 206.95 77312
+935.442432 206.95 77312
+935.519744 206.95 77312
+935.597056 206.95 77312
+935.674368 206.95 77312
+935.751680 206.95 77312
+935.828992 206.95 77312
+935.906304 206.95 77312
+935.983616 206.95 77312
+936.060928 206.95 77312
+936.138240 206.95 77312
+936.215552 206.95 77312
+936.292864 206.95 77312
+936.370176 206.95 77312
+936.447488 206.95 77312
+936.524800 206.95 77312
+936.602112 206.95 77312
+936.679936 205.59 77824
+936.757760 205.59 77824
+936.835584 205.59 77824
+936.913408 205.59 77824
+936.991232 205.59 77824
+937.069056 205.59 77824
+937.146880 205.59 77824
+937.224704 205.59 77824
+937.302528 205.59 77824
+937.380352 205.59 77824
+937.458176 205.59 77824
+937.536000 205.59 77824
+937.613824 205.59 77824
+937.691648 205.59 77824
+937.769472 205.59 77824
+937.847296 205.59 77824
+937.925120 205.59 77824
+938.002944 205.59 77824
+938.080768 205.59 77824
+938.158592 205.59 77824
+938.236416 205.59 77824
+938.314240 205.59 77824
+938.392064 205.59 77824
+938.469888 205.59 77824
+938.547712 205.59 77824
+938.625536 205.59 77824
+938.703360 205.59 77824
+938.781184 205.59 77824
+938.859008 205.59 77824
+938.936832 205.59 77824
+939.014656 205.59 77824
+939.092480 205.59 77824
+939.170304 205.59 77824
+939.248128 205.59 77824
+939.325952 205.59 77824
+939.403776 205.59 77824
+939.481600 205.59 77824
+939.559424 205.59 77824
+939.637248 205.59 77824
+939.715072 205.59 77824
+939.792896 205.59 77824
+939.870720 205.59 77824
+939.948544 205.59 77824
+940.026368 205.59 77824
+940.104192 205.59 77824
+940.182016 205.59 77824
+940.259840 205.59 77824
+940.337664 205.59 77824
+940.415488 205.59 77824
+940.493312 205.59 77824
+940.571136 205.59 77824
+940.648960 205.59 77824
+940.726784 205.59 77824
+940.804608 205.59 77824
+940.882432 205.59 77824
+940.960256 205.59 77824
+941.038080 205.59 77824
+941.115904 205.59 77824
+941.193728 205.59 77824
+941.271552 205.59 77824
+941.349376 205.59 77824
+941.427200 205.59 77824
+941.505024 205.59 77824
+941.582848 205.59 77824
+941.660672 205.59 77824
+941.738496 205.59 77824
+941.816320 205.59 77824
+941.894144 205.59 77824
+941.971968 205.59 77824
+942.049792 205.59 77824
+942.127616 205.59 77824
+942.205440 205.59 77824
+942.283264 205.59 77824
+942.361088 205.59 77824
+942.438912 205.59 77824
+942.516736 205.59 77824
+942.594560 205.59 77824
+942.672384 205.59 77824
+942.750208 205.59 77824
+942.828032 205.59 77824
+942.905856 205.59 77824
+942.983680 205.59 77824
+943.061504 205.59 77824
+943.139328 205.59 77824
+943.217152 205.59 77824
+943.294976 205.59 77824
+943.372800 205.59 77824
+943.450624 205.59 77824
+943.528448 205.59 77824
+943.606272 205.59 77824
+943.684096 205.59 77824
+943.761920 205.59 77824
+943.839744 205.59 77824
+943.917568 205.59 77824
+943.995392 205.59 77824
+944.073216 205.59 77824
+944.151552 204.25 78336
+944.229888 204.25 78336
+944.308224 204.25 78336
+944.386560 204.25 78336
+944.464896 204.25 78336
+944.543232 204.25 78336
+944.621568 204.25 78336
+944.699904 204.25 78336
+944.778240 204.25 78336
+944.856576 204.25 78336
+944.934912 204.25 78336
+945.013248 204.25 78336
+945.091584 204.25 78336
+945.169920 204.25 78336
+945.248256 204.25 78336
+945.326592 204.25 78336
+945.404928 204.25 78336
+945.483264 204.25 78336
+945.561600 204.25 78336
+945.639936 204.25 78336
+945.718272 204.25 78336
+945.796608 204.25 78336
+945.874944 204.25 78336
+945.953280 204.25 78336
+946.031616 204.25 78336
+946.109952 204.25 78336
+946.188288 204.25 78336
+946.266624 204.25 78336
+946.344960 204.25 78336
+946.423296 204.25 78336
+946.501632 204.25 78336
+946.579968 204.25 78336
+946.658816 202.92 78848
+946.737664 202.92 78848
+946.816512 202.92 78848
+946.895360 202.92 78848
+946.974208 202.92 78848
+947.053056 202.92 78848
+947.131904 202.92 78848
+947.210752 202.92 78848
+947.289600 202.92 78848
+947.368448 202.92 78848
+947.447296 202.92 78848
+947.526144 202.92 78848
+947.604992 202.92 78848
+947.683840 202.92 78848
+947.762688 202.92 78848
+947.841536 202.92 78848
+947.920384 202.92 78848
+947.999232 202.92 78848
+948.078080 202.92 78848
+948.156928 202.92 78848
+948.235776 202.92 78848
+948.314624 202.92 78848
+948.393472 202.92 78848
+948.472320 202.92 78848
+948.551168 202.92 78848
+948.630016 202.92 78848
+948.708864 202.92 78848
+948.787712 202.92 78848
+948.866560 202.92 78848
+948.945408 202.92 78848
+949.024256 202.92 78848
+949.103104 202.92 78848
+949.181952 202.92 78848
+949.260800 202.92 78848
+949.339648 202.92 78848
+949.418496 202.92 78848
+949.497344 202.92 78848
+949.576192 202.92 78848
+949.655040 202.92 78848
+949.733888 202.92 78848
+949.812736 202.92 78848
+949.891584 202.92 78848
+949.970432 202.92 78848
+950.049280 202.92 78848
+950.128128 202.92 78848
+950.206976 202.92 78848
+950.285824 202.92 78848
+950.364672 202.92 78848
+950.443520 202.92 78848
+950.522368 202.92 78848
+950.601216 202.92 78848
+950.680064 202.92 78848
+950.758912 202.92 78848
+950.837760 202.92 78848
+950.916608 202.92 78848
+950.995456 202.92 78848
+951.074304 202.92 78848
+951.153152 202.92 78848
+951.232000 202.92 78848
+951.310848 202.92 78848
+951.389696 202.92 78848
+951.468544 202.92 78848
+951.547392 202.92 78848
+951.626240 202.92 78848
+951.705600 201.61 79360
+951.784960 201.61 79360
+951.864320 201.61 79360
+951.943680 201.61 79360
+952.023040 201.61 79360
+952.102400 201.61 79360
+952.181760 201.61 79360
+952.261120 201.61 79360
+952.340480 201.61 79360
+952.419840 201.61 79360
+952.499200 201.61 79360
+952.578560 201.61 79360
+952.657920 201.61 79360
+952.737280 201.61 79360
+952.816640 201.61 79360
+952.896000 201.61 79360
+952.975360 201.61 79360
+953.054720 201.61 79360
+953.134080 201.61 79360
+953.213440 201.61 79360
+953.292800 201.61 79360
+953.372160 201.61 79360
+953.451520 201.61 79360
+953.530880 201.61 79360
+953.610240 201.61 79360
+953.689600 201.61 79360
+953.768960 201.61 79360
+953.848320 201.61 79360
+953.927680 201.61 79360
+954.007040 201.61 79360
+954.086400 201.61 79360
+954.165760 201.61 79360
+954.245120 201.61 79360
+954.324480 201.61 79360
+954.403840 201.61 79360
+954.483200 201.61 79360
+954.562560 201.61 79360
+954.641920 201.61 79360
+954.721280 201.61 79360
+954.800640 201.61 79360
+954.880000 201.61 79360
+954.959360 201.61 79360
+955.038720 201.61 79360
+955.118080 201.61 79360
+955.197440 201.61 79360
+955.276800 201.61 79360
+955.356160 201.61 79360
+955.435520 201.61 79360
+955.515392 200.32 79872
+955.595264 200.32 79872
+955.675136 200.32 79872
+955.755008 200.32 79872
+955.834880 200.32 79872
+955.914752 200.32 79872
+955.994624 200.32 79872
+956.074496 200.32 79872
+956.154368 200.32 79872
+956.234240 200.32 79872
+956.314112 200.32 79872
+956.393984 200.32 79872
+956.473856 200.32 79872
+956.553728 200.32 79872
+956.633600 200.32 79872
+956.713472 200.32 79872
+956.793344 200.32 79872
+956.873216 200.32 79872
+956.953088 200.32 79872
+957.032960 200.32 79872
+957.112832 200.32 79872
+957.192704 200.32 79872
+957.272576 200.32 79872
+957.352448 200.32 79872
+957.432320 200.32 79872
+957.512192 200.32 79872
+957.592064 200.32 79872
+957.671936 200.32 79872
+957.751808 200.32 79872
+957.831680 200.32 79872
+957.911552 200.32 79872
+957.991424 200.32 79872
+958.071808 199.04 80384
+958.152192 199.04 80384
+958.232576 199.04 80384
+958.312960 199.04 80384
+958.393344 199.04 80384
+958.473728 199.04 80384
+958.554112 199.04 80384
+958.634496 199.04 80384
+958.714880 199.04 80384
+958.795264 199.04 80384
+958.875648 199.04 80384
+958.956032 199.04 80384
+959.036416 199.04 80384
+959.116800 199.04 80384
+959.197184 199.04 80384
+959.277568 199.04 80384
+959.357952 199.04 80384
+959.438336 199.04 80384
+959.518720 199.04 80384
+959.599104 199.04 80384
+959.679488 199.04 80384
+959.759872 199.04 80384
+959.840256 199.04 80384
+959.920640 199.04 80384
+960.001024 199.04 80384
+960.081408 199.04 80384
+960.161792 199.04 80384
+960.242176 199.04 80384
+960.322560 199.04 80384
+960.402944 199.04 80384
+960.483328 199.04 80384
+960.563712 199.04 80384
+960.644096 199.04 80384
+960.724480 199.04 80384
+960.804864 199.04 80384
+960.885248 199.04 80384
+960.965632 199.04 80384
+961.046016 199.04 80384
+961.126400 199.04 80384
+961.206784 199.04 80384
+961.287168 199.04 80384
+961.367552 199.04 80384
+961.447936 199.04 80384
+961.528320 199.04 80384
+961.608704 199.04 80384
+961.689088 199.04 80384
+961.769472 199.04 80384
+961.849856 199.04 80384
+961.930240 199.04 80384
+962.010624 199.04 80384
+962.091008 199.04 80384
+962.171392 199.04 80384
+962.251776 199.04 80384
+962.332160 199.04 80384
+962.412544 199.04 80384
+962.492928 199.04 80384
+962.573312 199.04 80384
+962.653696 199.04 80384
+962.734080 199.04 80384
+962.814464 199.04 80384
+962.894848 199.04 80384
+962.975232 199.04 80384
+963.055616 199.04 80384
+963.136000 199.04 80384
+963.216384 199.04 80384
+963.296768 199.04 80384
+963.377152 199.04 80384
+963.457536 199.04 80384
+963.537920 199.04 80384
+963.618304 199.04 80384
+963.698688 199.04 80384
+963.779072 199.04 80384
+963.859456 199.04 80384
+963.939840 199.04 80384
+964.020224 199.04 80384
+964.100608 199.04 80384
+964.180992 199.04 80384
+964.261376 199.04 80384
+964.341760 199.04 80384
+964.422144 199.04 80384
+964.502528 199.04 80384
+964.582912 199.04 80384
+964.663296 199.04 80384
+964.743680 199.04 80384
+964.824064 199.04 80384
+964.904448 199.04 80384
+964.984832 199.04 80384
+965.065216 199.04 80384
+965.145600 199.04 80384
+965.225984 199.04 80384
+965.306368 199.04 80384
+965.386752 199.04 80384
+965.467136 199.04 80384
+965.547520 199.04 80384
+965.627904 199.04 80384
+965.708288 199.04 80384
+965.789184 197.78 80896
+965.870080 197.78 80896
+965.950976 197.78 80896
+966.031872 197.78 80896
+966.112768 197.78 80896
+966.193664 197.78 80896
+966.274560 197.78 80896
+966.355456 197.78 80896
+966.436352 197.78 80896
+966.517248 197.78 80896
+966.598144 197.78 80896
+966.679040 197.78 80896
+966.759936 197.78 80896
+966.840832 197.78 80896
+966.921728 197.78 80896
+967.002624 197.78 80896
+967.083520 197.78 80896
+967.164416 197.78 80896
+967.245312 197.78 80896
+967.326208 197.78 80896
+967.407104 197.78 80896
+967.488000 197.78 80896
+967.568896 197.78 80896
+967.649792 197.78 80896
+967.730688 197.78 80896
+967.811584 197.78 80896
+967.892480 197.78 80896
+967.973376 197.78 80896
+968.054272 197.78 80896
+968.135168 197.78 80896
+968.216064 197.78 80896
+968.296960 197.78 80896
+968.378368 196.54 81408
+968.459776 196.54 81408
+968.541184 196.54 81408
+968.622592 196.54 81408
+968.704000 196.54 81408
+968.785408 196.54 81408
+968.866816 196.54 81408
+968.948224 196.54 81408
+969.029632 196.54 81408
+969.111040 196.54 81408
+969.192448 196.54 81408
+969.273856 196.54 81408
+969.355264 196.54 81408
+969.436672 196.54 81408
+969.518080 196.54 81408
+969.599488 196.54 81408
+969.680896 196.54 81408
+969.762304 196.54 81408
+969.843712 196.54 81408
+969.925120 196.54 81408
+970.006528 196.54 81408
+970.087936 196.54 81408
+970.169344 196.54 81408
+970.250752 196.54 81408
+970.332160 196.54 81408
+970.413568 196.54 81408
+970.494976 196.54 81408
+970.576384 196.54 81408
+970.657792 196.54 81408
+970.739200 196.54 81408
+970.820608 196.54 81408
+970.902016 196.54 81408
+970.983424 196.54 81408
+971.064832 196.54 81408
+971.146240 196.54 81408
+971.227648 196.54 81408
+971.309056 196.54 81408
+971.390464 196.54 81408
+971.471872 196.54 81408
+971.553280 196.54 81408
+971.634688 196.54 81408
+971.716096 196.54 81408
+971.797504 196.54 81408
+971.878912 196.54 81408
+971.960320 196.54 81408
+972.041728 196.54 81408
+972.123136 196.54 81408
+972.204544 196.54 81408
+972.286464 195.31 81920
+972.368384 195.31 81920
+972.450304 195.31 81920
+972.532224 195.31 81920
+972.614144 195.31 81920
+972.696064 195.31 81920
+972.777984 195.31 81920
+972.859904 195.31 81920
+972.941824 195.31 81920
+973.023744 195.31 81920
+973.105664 195.31 81920
+973.187584 195.31 81920
+973.269504 195.31 81920
+973.351424 195.31 81920
+973.433344 195.31 81920
+973.515264 195.31 81920
+973.597184 195.31 81920
+973.679104 195.31 81920
+973.761024 195.31 81920
+973.842944 195.31 81920
+973.924864 195.31 81920
+974.006784 195.31 81920
+974.088704 195.31 81920
+974.170624 195.31 81920
+974.252544 195.31 81920
+974.334464 195.31 81920
+974.416384 195.31 81920
+974.498304 195.31 81920
+974.580224 195.31 81920
+974.662144 195.31 81920
+974.744064 195.31 81920
+974.825984 195.31 81920
+974.908416 194.10 82432
+974.990848 194.10 82432
+975.073280 194.10 82432
+975.155712 194.10 82432
+975.238144 194.10 82432
+975.320576 194.10 82432
+975.403008 194.10 82432
+975.485440 194.10 82432
+975.567872 194.10 82432
+975.650304 194.10 82432
+975.732736 194.10 82432
+975.815168 194.10 82432
+975.897600 194.10 82432
+975.980032 194.10 82432
+976.062464 194.10 82432
+976.144896 194.10 82432
+976.227328 194.10 82432
+976.309760 194.10 82432
+976.392192 194.10 82432
+976.474624 194.10 82432
+976.557056 194.10 82432
+976.639488 194.10 82432
+976.721920 194.10 82432
+976.804352 194.10 82432
+976.886784 194.10 82432
+976.969216 194.10 82432
+977.051648 194.10 82432
+977.134080 194.10 82432
+977.216512 194.10 82432
+977.298944 194.10 82432
+977.381376 194.10 82432
+977.463808 194.10 82432
+977.546240 194.10 82432
+977.628672 194.10 82432
+977.711104 194.10 82432
+977.793536 194.10 82432
+977.875968 194.10 82432
+977.958400 194.10 82432
+978.040832 194.10 82432
+978.123264 194.10 82432
+978.205696 194.10 82432
+978.288128 194.10 82432
+978.370560 194.10 82432
+978.452992 194.10 82432
+978.535424 194.10 82432
+978.617856 194.10 82432
+978.700288 194.10 82432
+978.782720 194.10 82432
+978.865664 192.90 82944
+978.948608 192.90 82944
+979.031552 192.90 82944
+979.114496 192.90 82944
+979.197440 192.90 82944
+979.280384 192.90 82944
+979.363328 192.90 82944
+979.446272 192.90 82944
+979.529216 192.90 82944
+979.612160 192.90 82944
+979.695104 192.90 82944
+979.778048 192.90 82944
+979.860992 192.90 82944
+979.943936 192.90 82944
+980.026880 192.90 82944
+980.109824 192.90 82944
+980.192768 192.90 82944
+980.275712 192.90 82944
+980.358656 192.90 82944
+980.441600 192.90 82944
+980.524544 192.90 82944
+980.607488 192.90 82944
+980.690432 192.90 82944
+980.773376 192.90 82944
+980.856320 192.90 82944
+980.939264 192.90 82944
+981.022208 192.90 82944
+981.105152 192.90 82944
+981.188096 192.90 82944
+981.271040 192.90 82944
+981.353984 192.90 82944
+981.436928 192.90 82944
+981.519872 192.90 82944
+981.602816 192.90 82944
+981.685760 192.90 82944
+981.768704 192.90 82944
+981.851648 192.90 82944
+981.934592 192.90 82944
+982.017536 192.90 82944
+982.100480 192.90 82944
+982.183424 192.90 82944
+982.266368 192.90 82944
+982.349312 192.90 82944
+982.432256 192.90 82944
+982.515200 192.90 82944
+982.598144 192.90 82944
+982.681088 192.90 82944
+982.764032 192.90 82944
+982.847488 191.72 83456
+982.930944 191.72 83456
+983.014400 191.72 83456
+983.097856 191.72 83456
+983.181312 191.72 83456
+983.264768 191.72 83456
+983.348224 191.72 83456
+983.431680 191.72 83456
+983.515136 191.72 83456
+983.598592 191.72 83456
+983.682048 191.72 83456
+983.765504 191.72 83456
+983.848960 191.72 83456
+983.932416 191.72 83456
+984.015872 191.72 83456
+984.099328 191.72 83456
+984.182784 191.72 83456
+984.266240 191.72 83456
+984.349696 191.72 83456
+984.433152 191.72 83456
+984.516608 191.72 83456
+984.600064 191.72 83456
+984.683520 191.72 83456
+984.766976 191.72 83456
+984.850432 191.72 83456
+984.933888 191.72 83456
+985.017344 191.72 83456
+985.100800 191.72 83456
+985.184256 191.72 83456
+985.267712 191.72 83456
+985.351168 191.72 83456
+985.434624 191.72 83456
+985.518080 191.72 83456
+985.601536 191.72 83456
+985.684992 191.72 83456
+985.768448 191.72 83456
+985.851904 191.72 83456
+985.935360 191.72 83456
+986.018816 191.72 83456
+986.102272 191.72 83456
+986.185728 191.72 83456
+986.269184 191.72 83456
+986.352640 191.72 83456
+986.436096 191.72 83456
+986.519552 191.72 83456
+986.603008 191.72 83456
+986.686464 191.72 83456
+986.769920 191.72 83456
+986.853376 191.72 83456
+986.936832 191.72 83456
+987.020288 191.72 83456
+987.103744 191.72 83456
+987.187200 191.72 83456
+987.270656 191.72 83456
+987.354112 191.72 83456
+987.437568 191.72 83456
+987.521024 191.72 83456
+987.604480 191.72 83456
+987.687936 191.72 83456
+987.771392 191.72 83456
+987.854848 191.72 83456
+987.938304 191.72 83456
+988.021760 191.72 83456
+988.105216 191.72 83456
+988.188672 191.72 83456
+988.272128 191.72 83456
+988.355584 191.72 83456
+988.439040 191.72 83456
+988.522496 191.72 83456
+988.605952 191.72 83456
+988.689408 191.72 83456
+988.772864 191.72 83456
+988.856320 191.72 83456
+988.939776 191.72 83456
+989.023232 191.72 83456
+989.106688 191.72 83456
+989.190144 191.72 83456
+989.273600 191.72 83456
+989.357056 191.72 83456
+989.440512 191.72 83456
+989.524480 190.55 83968
+989.608448 190.55 83968
+989.692416 190.55 83968
+989.776384 190.55 83968
+989.860352 190.55 83968
+989.944320 190.55 83968
+990.028288 190.55 83968
+990.112256 190.55 83968
+990.196224 190.55 83968
+990.280192 190.55 83968
+990.364160 190.55 83968
+990.448128 190.55 83968
+990.532096 190.55 83968
+990.616064 190.55 83968
+990.700032 190.55 83968
+990.784000 190.55 83968
+990.867968 190.55 83968
+990.951936 190.55 83968
+991.035904 190.55 83968
+991.119872 190.55 83968
+991.203840 190.55 83968
+991.287808 190.55 83968
+991.371776 190.55 83968
+991.455744 190.55 83968
+991.539712 190.55 83968
+991.623680 190.55 83968
+991.707648 190.55 83968
+991.791616 190.55 83968
+991.875584 190.55 83968
+991.959552 190.55 83968
+992.043520 190.55 83968
+992.127488 190.55 83968
+992.211968 189.39 84480
+992.296448 189.39 84480
+992.380928 189.39 84480
+992.465408 189.39 84480
+992.549888 189.39 84480
+992.634368 189.39 84480
+992.718848 189.39 84480
+992.803328 189.39 84480
+992.887808 189.39 84480
+992.972288 189.39 84480
+993.056768 189.39 84480
+993.141248 189.39 84480
+993.225728 189.39 84480
+993.310208 189.39 84480
+993.394688 189.39 84480
+993.479168 189.39 84480
+993.563648 189.39 84480
+993.648128 189.39 84480
+993.732608 189.39 84480
+993.817088 189.39 84480
+993.901568 189.39 84480
+993.986048 189.39 84480
+994.070528 189.39 84480
+994.155008 189.39 84480
+994.239488 189.39 84480
+994.323968 189.39 84480
+994.408448 189.39 84480
+994.492928 189.39 84480
+994.577408 189.39 84480
+994.661888 189.39 84480
+994.746368 189.39 84480
+994.830848 189.39 84480
+994.915840 188.25 84992
+995.000832 188.25 84992
+995.085824 188.25 84992
+995.170816 188.25 84992
+995.255808 188.25 84992
+995.340800 188.25 84992
+995.425792 188.25 84992
+995.510784 188.25 84992
+995.595776 188.25 84992
+995.680768 188.25 84992
+995.765760 188.25 84992
+995.850752 188.25 84992
+995.935744 188.25 84992
+996.020736 188.25 84992
+996.105728 188.25 84992
+996.190720 188.25 84992
+996.275712 188.25 84992
+996.360704 188.25 84992
+996.445696 188.25 84992
+996.530688 188.25 84992
+996.615680 188.25 84992
+996.700672 188.25 84992
+996.785664 188.25 84992
+996.870656 188.25 84992
+996.955648 188.25 84992
+997.040640 188.25 84992
+997.125632 188.25 84992
+997.210624 188.25 84992
+997.295616 188.25 84992
+997.380608 188.25 84992
+997.465600 188.25 84992
+997.550592 188.25 84992
+997.635584 188.25 84992
+997.720576 188.25 84992
+997.805568 188.25 84992
+997.890560 188.25 84992
+997.975552 188.25 84992
+998.060544 188.25 84992
+998.145536 188.25 84992
+998.230528 188.25 84992
+998.315520 188.25 84992
+998.400512 188.25 84992
+998.485504 188.25 84992
+998.570496 188.25 84992
+998.655488 188.25 84992
+998.740480 188.25 84992
+998.825472 188.25 84992
+998.910464 188.25 84992
+998.995968 187.13 85504
+999.081472 187.13 85504
+999.166976 187.13 85504
+999.252480 187.13 85504
+999.337984 187.13 85504
+999.423488 187.13 85504
+999.508992 187.13 85504
+999.594496 187.13 85504
+999.680000 187.13 85504
+999.765504 187.13 85504
+999.851008 187.13 85504
+999.936512 187.13 85504
+1000.022016 187.13 85504
+1000.107520 187.13 85504
+1000.193024 187.13 85504
+1000.278528 187.13 85504
+1000.364032 187.13 85504
+1000.449536 187.13 85504
+1000.535040 187.13 85504
+1000.620544 187.13 85504
+1000.706048 187.13 85504
+1000.791552 187.13 85504
+1000.877056 187.13 85504
+1000.962560 187.13 85504
+1001.048064 187.13 85504
+1001.133568 187.13 85504
+1001.219072 187.13 85504
+1001.304576 187.13 85504
+1001.390080 187.13 85504
+1001.475584 187.13 85504
+1001.561088 187.13 85504
+1001.646592 187.13 85504
+1001.732608 186.01 86016
+1001.818624 186.01 86016
+1001.904640 186.01 86016
+1001.990656 186.01 86016
+1002.076672 186.01 86016
+1002.162688 186.01 86016
+1002.248704 186.01 86016
+1002.334720 186.01 86016
+1002.420736 186.01 86016
+1002.506752 186.01 86016
+1002.592768 186.01 86016
+1002.678784 186.01 86016
+1002.764800 186.01 86016
+1002.850816 186.01 86016
+1002.936832 186.01 86016
+1003.022848 186.01 86016
+1003.108864 186.01 86016
+1003.194880 186.01 86016
+1003.280896 186.01 86016
+1003.366912 186.01 86016
+1003.452928 186.01 86016
+1003.538944 186.01 86016
+1003.624960 186.01 86016
+1003.710976 186.01 86016
+1003.796992 186.01 86016
+1003.883008 186.01 86016
+1003.969024 186.01 86016
+1004.055040 186.01 86016
+1004.141056 186.01 86016
+1004.227072 186.01 86016
+1004.313088 186.01 86016
+1004.399104 186.01 86016
+1004.485120 186.01 86016
+1004.571136 186.01 86016
+1004.657152 186.01 86016
+1004.743168 186.01 86016
+1004.829184 186.01 86016
+1004.915200 186.01 86016
+1005.001216 186.01 86016
+1005.087232 186.01 86016
+1005.173248 186.01 86016
+1005.259264 186.01 86016
+1005.345280 186.01 86016
+1005.431296 186.01 86016
+1005.517312 186.01 86016
+1005.603328 186.01 86016
+1005.689344 186.01 86016
+1005.775360 186.01 86016
+1005.861888 184.91 86528
+1005.948416 184.91 86528
+1006.034944 184.91 86528
+1006.121472 184.91 86528
+1006.208000 184.91 86528
+1006.294528 184.91 86528
+1006.381056 184.91 86528
+1006.467584 184.91 86528
+1006.554112 184.91 86528
+1006.640640 184.91 86528
+1006.727168 184.91 86528
+1006.813696 184.91 86528
+1006.900224 184.91 86528
+1006.986752 184.91 86528
+1007.073280 184.91 86528
+1007.159808 184.91 86528
+1007.246336 184.91 86528
+1007.332864 184.91 86528
+1007.419392 184.91 86528
+1007.505920 184.91 86528
+1007.592448 184.91 86528
+1007.678976 184.91 86528
+1007.765504 184.91 86528
+1007.852032 184.91 86528
+1007.938560 184.91 86528
+1008.025088 184.91 86528
+1008.111616 184.91 86528
+1008.198144 184.91 86528
+1008.284672 184.91 86528
+1008.371200 184.91 86528
+1008.457728 184.91 86528
+1008.544256 184.91 86528
+1008.631296 183.82 87040
+1008.718336 183.82 87040
+1008.805376 183.82 87040
+1008.892416 183.82 87040
+1008.979456 183.82 87040
+1009.066496 183.82 87040
+1009.153536 183.82 87040
+1009.240576 183.82 87040
+1009.327616 183.82 87040
+1009.414656 183.82 87040
+1009.501696 183.82 87040
+1009.588736 183.82 87040
+1009.675776 183.82 87040
+1009.762816 183.82 87040
+1009.849856 183.82 87040
+1009.936896 183.82 87040
+1010.023936 183.82 87040
+1010.110976 183.82 87040
+1010.198016 183.82 87040
+1010.285056 183.82 87040
+1010.372096 183.82 87040
+1010.459136 183.82 87040
+1010.546176 183.82 87040
+1010.633216 183.82 87040
+1010.720256 183.82 87040
+1010.807296 183.82 87040
+1010.894336 183.82 87040
+1010.981376 183.82 87040
+1011.068416 183.82 87040
+1011.155456 183.82 87040
+1011.242496 183.82 87040
+1011.329536 183.82 87040
+1011.417088 182.75 87552
+1011.504640 182.75 87552
+1011.592192 182.75 87552
+1011.679744 182.75 87552
+1011.767296 182.75 87552
+1011.854848 182.75 87552
+1011.942400 182.75 87552
+1012.029952 182.75 87552
+1012.117504 182.75 87552
+1012.205056 182.75 87552
+1012.292608 182.75 87552
+1012.380160 182.75 87552
+1012.467712 182.75 87552
+1012.555264 182.75 87552
+1012.642816 182.75 87552
+1012.730368 182.75 87552
+1012.817920 182.75 87552
+1012.905472 182.75 87552
+1012.993024 182.75 87552
+1013.080576 182.75 87552
+1013.168128 182.75 87552
+1013.255680 182.75 87552
+1013.343232 182.75 87552
+1013.430784 182.75 87552
+1013.518336 182.75 87552
+1013.605888 182.75 87552
+1013.693440 182.75 87552
+1013.780992 182.75 87552
+1013.868544 182.75 87552
+1013.956096 182.75 87552
+1014.043648 182.75 87552
+1014.131200 182.75 87552
+1014.219264 181.69 88064
+1014.307328 181.69 88064
+1014.395392 181.69 88064
+1014.483456 181.69 88064
+1014.571520 181.69 88064
+1014.659584 181.69 88064
+1014.747648 181.69 88064
+1014.835712 181.69 88064
+1014.923776 181.69 88064
+1015.011840 181.69 88064
+1015.099904 181.69 88064
+1015.187968 181.69 88064
+1015.276032 181.69 88064
+1015.364096 181.69 88064
+1015.452160 181.69 88064
+1015.540224 181.69 88064
+1015.628288 181.69 88064
+1015.716352 181.69 88064
+1015.804416 181.69 88064
+1015.892480 181.69 88064
+1015.980544 181.69 88064
+1016.068608 181.69 88064
+1016.156672 181.69 88064
+1016.244736 181.69 88064
+1016.332800 181.69 88064
+1016.420864 181.69 88064
+1016.508928 181.69 88064
+1016.596992 181.69 88064
+1016.685056 181.69 88064
+1016.773120 181.69 88064
+1016.861184 181.69 88064
+1016.949248 181.69 88064
+1017.037312 181.69 88064
+1017.125376 181.69 88064
+1017.213440 181.69 88064
+1017.301504 181.69 88064
+1017.389568 181.69 88064
+1017.477632 181.69 88064
+1017.565696 181.69 88064
+1017.653760 181.69 88064
+1017.741824 181.69 88064
+1017.829888 181.69 88064
+1017.917952 181.69 88064
+1018.006016 181.69 88064
+1018.094080 181.69 88064
+1018.182144 181.69 88064
+1018.270208 181.69 88064
+1018.358272 181.69 88064
+1018.446848 180.64 88576
+1018.535424 180.64 88576
+1018.624000 180.64 88576
+1018.712576 180.64 88576
+1018.801152 180.64 88576
+1018.889728 180.64 88576
+1018.978304 180.64 88576
+1019.066880 180.64 88576
+1019.155456 180.64 88576
+1019.244032 180.64 88576
+1019.332608 180.64 88576
+1019.421184 180.64 88576
+1019.509760 180.64 88576
+1019.598336 180.64 88576
+1019.686912 180.64 88576
+1019.775488 180.64 88576
+1019.864064 180.64 88576
+1019.952640 180.64 88576
+1020.041216 180.64 88576
+1020.129792 180.64 88576
+1020.218368 180.64 88576
+1020.306944 180.64 88576
+1020.395520 180.64 88576
+1020.484096 180.64 88576
+1020.572672 180.64 88576
+1020.661248 180.64 88576
+1020.749824 180.64 88576
+1020.838400 180.64 88576
+1020.926976 180.64 88576
+1021.015552 180.64 88576
+1021.104128 180.64 88576
+1021.192704 180.64 88576
+1021.281792 179.60 89088
+1021.370880 179.60 89088
+1021.459968 179.60 89088
+1021.549056 179.60 89088
+1021.638144 179.60 89088
+1021.727232 179.60 89088
+1021.816320 179.60 89088
+1021.905408 179.60 89088
+1021.994496 179.60 89088
+1022.083584 179.60 89088
+1022.172672 179.60 89088
+1022.261760 179.60 89088
+1022.350848 179.60 89088
+1022.439936 179.60 89088
+1022.529024 179.60 89088
+1022.618112 179.60 89088
+1022.707200 179.60 89088
+1022.796288 179.60 89088
+1022.885376 179.60 89088
+1022.974464 179.60 89088
+1023.063552 179.60 89088
+1023.152640 179.60 89088
+1023.241728 179.60 89088
+1023.330816 179.60 89088
+1023.419904 179.60 89088
+1023.508992 179.60 89088
+1023.598080 179.60 89088
+1023.687168 179.60 89088
+1023.776256 179.60 89088
+1023.865344 179.60 89088
+1023.954432 179.60 89088
+1024.043520 179.60 89088
+1024.132608 179.60 89088
+1024.221696 179.60 89088
+1024.310784 179.60 89088
+1024.399872 179.60 89088
+1024.488960 179.60 89088
+1024.578048 179.60 89088
+1024.667136 179.60 89088
+1024.756224 179.60 89088
+1024.845312 179.60 89088
+1024.934400 179.60 89088
+1025.023488 179.60 89088
+1025.112576 179.60 89088
+1025.201664 179.60 89088
+1025.290752 179.60 89088
+1025.379840 179.60 89088
+1025.468928 179.60 89088
+1025.558016 179.60 89088
+1025.647104 179.60 89088
+1025.736192 179.60 89088
+1025.825280 179.60 89088
+1025.914368 179.60 89088
+1026.003456 179.60 89088
+1026.092544 179.60 89088
+1026.181632 179.60 89088
+1026.270720 179.60 89088
+1026.359808 179.60 89088
+1026.448896 179.60 89088
+1026.537984 179.60 89088
+1026.627072 179.60 89088
+1026.716160 179.60 89088
+1026.805248 179.60 89088
+1026.894336 179.60 89088
+1026.983936 178.57 89600
+1027.073536 178.57 89600
+1027.163136 178.57 89600
+1027.252736 178.57 89600
+1027.342336 178.57 89600
+1027.431936 178.57 89600
+1027.521536 178.57 89600
+1027.611136 178.57 89600
+1027.700736 178.57 89600
+1027.790336 178.57 89600
+1027.879936 178.57 89600
+1027.969536 178.57 89600
+1028.059136 178.57 89600
+1028.148736 178.57 89600
+1028.238336 178.57 89600
+1028.327936 178.57 89600
+1028.417536 178.57 89600
+1028.507136 178.57 89600
+1028.596736 178.57 89600
+1028.686336 178.57 89600
+1028.775936 178.57 89600
+1028.865536 178.57 89600
+1028.955136 178.57 89600
+1029.044736 178.57 89600
+1029.134336 178.57 89600
+1029.223936 178.57 89600
+1029.313536 178.57 89600
+1029.403136 178.57 89600
+1029.492736 178.57 89600
+1029.582336 178.57 89600
+1029.671936 178.57 89600
+1029.761536 178.57 89600
+1029.851648 177.56 90112
+1029.941760 177.56 90112
+1030.031872 177.56 90112
+1030.121984 177.56 90112
+1030.212096 177.56 90112
+1030.302208 177.56 90112
+1030.392320 177.56 90112
+1030.482432 177.56 90112
+1030.572544 177.56 90112
+1030.662656 177.56 90112
+1030.752768 177.56 90112
+1030.842880 177.56 90112
+1030.932992 177.56 90112
+1031.023104 177.56 90112
+1031.113216 177.56 90112
+1031.203328 177.56 90112
+1031.293440 177.56 90112
+1031.383552 177.56 90112
+1031.473664 177.56 90112
+1031.563776 177.56 90112
+1031.653888 177.56 90112
+1031.744000 177.56 90112
+1031.834112 177.56 90112
+1031.924224 177.56 90112
+1032.014336 177.56 90112
+1032.104448 177.56 90112
+1032.194560 177.56 90112
+1032.284672 177.56 90112
+1032.374784 177.56 90112
+1032.464896 177.56 90112
+1032.555008 177.56 90112
+1032.645120 177.56 90112
+1032.735232 177.56 90112
+1032.825344 177.56 90112
+1032.915456 177.56 90112
+1033.005568 177.56 90112
+1033.095680 177.56 90112
+1033.185792 177.56 90112
+1033.275904 177.56 90112
+1033.366016 177.56 90112
+1033.456128 177.56 90112
+1033.546240 177.56 90112
+1033.636352 177.56 90112
+1033.726464 177.56 90112
+1033.816576 177.56 90112
+1033.906688 177.56 90112
+1033.996800 177.56 90112
+1034.086912 177.56 90112
+1034.177536 176.55 90624
+1034.268160 176.55 90624
+1034.358784 176.55 90624
+1034.449408 176.55 90624
+1034.540032 176.55 90624
+1034.630656 176.55 90624
+1034.721280 176.55 90624
+1034.811904 176.55 90624
+1034.902528 176.55 90624
+1034.993152 176.55 90624
+1035.083776 176.55 90624
+1035.174400 176.55 90624
+1035.265024 176.55 90624
+1035.355648 176.55 90624
+1035.446272 176.55 90624
+1035.536896 176.55 90624
+1035.627520 176.55 90624
+1035.718144 176.55 90624
+1035.808768 176.55 90624
+1035.899392 176.55 90624
+1035.990016 176.55 90624
+1036.080640 176.55 90624
+1036.171264 176.55 90624
+1036.261888 176.55 90624
+1036.352512 176.55 90624
+1036.443136 176.55 90624
+1036.533760 176.55 90624
+1036.624384 176.55 90624
+1036.715008 176.55 90624
+1036.805632 176.55 90624
+1036.896256 176.55 90624
+1036.986880 176.55 90624
+1037.078016 175.56 91136
+1037.169152 175.56 91136
+1037.260288 175.56 91136
+1037.351424 175.56 91136
+1037.442560 175.56 91136
+1037.533696 175.56 91136
+1037.624832 175.56 91136
+1037.715968 175.56 91136
+1037.807104 175.56 91136
+1037.898240 175.56 91136
+1037.989376 175.56 91136
+1038.080512 175.56 91136
+1038.171648 175.56 91136
+1038.262784 175.56 91136
+1038.353920 175.56 91136
+1038.445056 175.56 91136
+1038.536192 175.56 91136
+1038.627328 175.56 91136
+1038.718464 175.56 91136
+1038.809600 175.56 91136
+1038.900736 175.56 91136
+1038.991872 175.56 91136
+1039.083008 175.56 91136
+1039.174144 175.56 91136
+1039.265280 175.56 91136
+1039.356416 175.56 91136
+1039.447552 175.56 91136
+1039.538688 175.56 91136
+1039.629824 175.56 91136
+1039.720960 175.56 91136
+1039.812096 175.56 91136
+1039.903232 175.56 91136
+1039.994880 174.58 91648
+1040.086528 174.58 91648
+1040.178176 174.58 91648
+1040.269824 174.58 91648
+1040.361472 174.58 91648
+1040.453120 174.58 91648
+1040.544768 174.58 91648
+1040.636416 174.58 91648
+1040.728064 174.58 91648
+1040.819712 174.58 91648
+1040.911360 174.58 91648
+1041.003008 174.58 91648
+1041.094656 174.58 91648
+1041.186304 174.58 91648
+1041.277952 174.58 91648
+1041.369600 174.58 91648
+1041.461248 174.58 91648
+1041.552896 174.58 91648
+1041.644544 174.58 91648
+1041.736192 174.58 91648
+1041.827840 174.58 91648
+1041.919488 174.58 91648
+1042.011136 174.58 91648
+1042.102784 174.58 91648
+1042.194432 174.58 91648
+1042.286080 174.58 91648
+1042.377728 174.58 91648
+1042.469376 174.58 91648
+1042.561024 174.58 91648
+1042.652672 174.58 91648
+1042.744320 174.58 91648
+1042.835968 174.58 91648
+1042.928128 173.61 92160
+1043.020288 173.61 92160
+1043.112448 173.61 92160
+1043.204608 173.61 92160
+1043.296768 173.61 92160
+1043.388928 173.61 92160
+1043.481088 173.61 92160
+1043.573248 173.61 92160
+1043.665408 173.61 92160
+1043.757568 173.61 92160
+1043.849728 173.61 92160
+1043.941888 173.61 92160
+1044.034048 173.61 92160
+1044.126208 173.61 92160
+1044.218368 173.61 92160
+1044.310528 173.61 92160
+1044.402688 173.61 92160
+1044.494848 173.61 92160
+1044.587008 173.61 92160
+1044.679168 173.61 92160
+1044.771328 173.61 92160
+1044.863488 173.61 92160
+1044.955648 173.61 92160
+1045.047808 173.61 92160
+1045.139968 173.61 92160
+1045.232128 173.61 92160
+1045.324288 173.61 92160
+1045.416448 173.61 92160
+1045.508608 173.61 92160
+1045.600768 173.61 92160
+1045.692928 173.61 92160
+1045.785088 173.61 92160
+1045.877760 172.65 92672
+1045.970432 172.65 92672
+1046.063104 172.65 92672
+1046.155776 172.65 92672
+1046.248448 172.65 92672
+1046.341120 172.65 92672
+1046.433792 172.65 92672
+1046.526464 172.65 92672
+1046.619136 172.65 92672
+1046.711808 172.65 92672
+1046.804480 172.65 92672
+1046.897152 172.65 92672
+1046.989824 172.65 92672
+1047.082496 172.65 92672
+1047.175168 172.65 92672
+1047.267840 172.65 92672
+1047.360512 172.65 92672
+1047.453184 172.65 92672
+1047.545856 172.65 92672
+1047.638528 172.65 92672
+1047.731200 172.65 92672
+1047.823872 172.65 92672
+1047.916544 172.65 92672
+1048.009216 172.65 92672
+1048.101888 172.65 92672
+1048.194560 172.65 92672
+1048.287232 172.65 92672
+1048.379904 172.65 92672
+1048.472576 172.65 92672
+1048.565248 172.65 92672
+1048.657920 172.65 92672
+1048.750592 172.65 92672
+1048.843776 171.70 93184
+1048.936960 171.70 93184
+1049.030144 171.70 93184
+1049.123328 171.70 93184
+1049.216512 171.70 93184
+1049.309696 171.70 93184
+1049.402880 171.70 93184
+1049.496064 171.70 93184
+1049.589248 171.70 93184
+1049.682432 171.70 93184
+1049.775616 171.70 93184
+1049.868800 171.70 93184
+1049.961984 171.70 93184
+1050.055168 171.70 93184
+1050.148352 171.70 93184
+1050.241536 171.70 93184
+1050.334720 171.70 93184
+1050.427904 171.70 93184
+1050.521088 171.70 93184
+1050.614272 171.70 93184
+1050.707456 171.70 93184
+1050.800640 171.70 93184
+1050.893824 171.70 93184
+1050.987008 171.70 93184
+1051.080192 171.70 93184
+1051.173376 171.70 93184
+1051.266560 171.70 93184
+1051.359744 171.70 93184
+1051.452928 171.70 93184
+1051.546112 171.70 93184
+1051.639296 171.70 93184
+1051.732480 171.70 93184
+1051.826176 170.77 93696
+1051.919872 170.77 93696
+1052.013568 170.77 93696
+1052.107264 170.77 93696
+1052.200960 170.77 93696
+1052.294656 170.77 93696
+1052.388352 170.77 93696
+1052.482048 170.77 93696
+1052.575744 170.77 93696
+1052.669440 170.77 93696
+1052.763136 170.77 93696
+1052.856832 170.77 93696
+1052.950528 170.77 93696
+1053.044224 170.77 93696
+1053.137920 170.77 93696
+1053.231616 170.77 93696
+1053.325312 170.77 93696
+1053.419008 170.77 93696
+1053.512704 170.77 93696
+1053.606400 170.77 93696
+1053.700096 170.77 93696
+1053.793792 170.77 93696
+1053.887488 170.77 93696
+1053.981184 170.77 93696
+1054.074880 170.77 93696
+1054.168576 170.77 93696
+1054.262272 170.77 93696
+1054.355968 170.77 93696
+1054.449664 170.77 93696
+1054.543360 170.77 93696
+1054.637056 170.77 93696
+1054.730752 170.77 93696
+1054.824960 169.84 94208
+1054.919168 169.84 94208
+1055.013376 169.84 94208
+1055.107584 169.84 94208
+1055.201792 169.84 94208
+1055.296000 169.84 94208
+1055.390208 169.84 94208
+1055.484416 169.84 94208
+1055.578624 169.84 94208
+1055.672832 169.84 94208
+1055.767040 169.84 94208
+1055.861248 169.84 94208
+1055.955456 169.84 94208
+1056.049664 169.84 94208
+1056.143872 169.84 94208
+1056.238080 169.84 94208
+1056.332288 169.84 94208
+1056.426496 169.84 94208
+1056.520704 169.84 94208
+1056.614912 169.84 94208
+1056.709120 169.84 94208
+1056.803328 169.84 94208
+1056.897536 169.84 94208
+1056.991744 169.84 94208
+1057.085952 169.84 94208
+1057.180160 169.84 94208
+1057.274368 169.84 94208
+1057.368576 169.84 94208
+1057.462784 169.84 94208
+1057.556992 169.84 94208
+1057.651200 169.84 94208
+1057.745408 169.84 94208
+1057.840128 168.92 94720
+1057.934848 168.92 94720
+1058.029568 168.92 94720
+1058.124288 168.92 94720
+1058.219008 168.92 94720
+1058.313728 168.92 94720
+1058.408448 168.92 94720
+1058.503168 168.92 94720
+1058.597888 168.92 94720
+1058.692608 168.92 94720
+1058.787328 168.92 94720
+1058.882048 168.92 94720
+1058.976768 168.92 94720
+1059.071488 168.92 94720
+1059.166208 168.92 94720
+1059.260928 168.92 94720
+1059.355648 168.92 94720
+1059.450368 168.92 94720
+1059.545088 168.92 94720
+1059.639808 168.92 94720
+1059.734528 168.92 94720
+1059.829248 168.92 94720
+1059.923968 168.92 94720
+1060.018688 168.92 94720
+1060.113408 168.92 94720
+1060.208128 168.92 94720
+1060.302848 168.92 94720
+1060.397568 168.92 94720
+1060.492288 168.92 94720
+1060.587008 168.92 94720
+1060.681728 168.92 94720
+1060.776448 168.92 94720
+1060.871680 168.01 95232
+1060.966912 168.01 95232
+1061.062144 168.01 95232
+1061.157376 168.01 95232
+1061.252608 168.01 95232
+1061.347840 168.01 95232
+1061.443072 168.01 95232
+1061.538304 168.01 95232
+1061.633536 168.01 95232
+1061.728768 168.01 95232
+1061.824000 168.01 95232
+1061.919232 168.01 95232
+1062.014464 168.01 95232
+1062.109696 168.01 95232
+1062.204928 168.01 95232
+1062.300160 168.01 95232
+1062.395392 168.01 95232
+1062.490624 168.01 95232
+1062.585856 168.01 95232
+1062.681088 168.01 95232
+1062.776320 168.01 95232
+1062.871552 168.01 95232
+1062.966784 168.01 95232
+1063.062016 168.01 95232
+1063.157248 168.01 95232
+1063.252480 168.01 95232
+1063.347712 168.01 95232
+1063.442944 168.01 95232
+1063.538176 168.01 95232
+1063.633408 168.01 95232
+1063.728640 168.01 95232
+1063.823872 168.01 95232
+1063.919616 167.11 95744
+1064.015360 167.11 95744
+1064.111104 167.11 95744
+1064.206848 167.11 95744
+1064.302592 167.11 95744
+1064.398336 167.11 95744
+1064.494080 167.11 95744
+1064.589824 167.11 95744
+1064.685568 167.11 95744
+1064.781312 167.11 95744
+1064.877056 167.11 95744
+1064.972800 167.11 95744
+1065.068544 167.11 95744
+1065.164288 167.11 95744
+1065.260032 167.11 95744
+1065.355776 167.11 95744
+1065.452032 166.22 96256
+1065.548288 166.22 96256
+1065.644544 166.22 96256
+1065.740800 166.22 96256
+1065.837056 166.22 96256
+1065.933312 166.22 96256
+1066.029568 166.22 96256
+1066.125824 166.22 96256
+1066.222080 166.22 96256
+1066.318336 166.22 96256
+1066.414592 166.22 96256
+1066.510848 166.22 96256
+1066.607104 166.22 96256
+1066.703360 166.22 96256
+1066.799616 166.22 96256
+1066.895872 166.22 96256
+1066.992128 166.22 96256
+1067.088384 166.22 96256
+1067.184640 166.22 96256
+1067.280896 166.22 96256
+1067.377152 166.22 96256
+1067.473408 166.22 96256
+1067.569664 166.22 96256
+1067.665920 166.22 96256
+1067.762176 166.22 96256
+1067.858432 166.22 96256
+1067.954688 166.22 96256
+1068.050944 166.22 96256
+1068.147200 166.22 96256
+1068.243456 166.22 96256
+1068.339712 166.22 96256
+1068.435968 166.22 96256
+1068.532736 165.34 96768
+1068.629504 165.34 96768
+1068.726272 165.34 96768
+1068.823040 165.34 96768
+1068.919808 165.34 96768
+1069.016576 165.34 96768
+1069.113344 165.34 96768
+1069.210112 165.34 96768
+1069.306880 165.34 96768
+1069.403648 165.34 96768
+1069.500416 165.34 96768
+1069.597184 165.34 96768
+1069.693952 165.34 96768
+1069.790720 165.34 96768
+1069.887488 165.34 96768
+1069.984256 165.34 96768
+1070.081024 165.34 96768
+1070.177792 165.34 96768
+1070.274560 165.34 96768
+1070.371328 165.34 96768
+1070.468096 165.34 96768
+1070.564864 165.34 96768
+1070.661632 165.34 96768
+1070.758400 165.34 96768
+1070.855168 165.34 96768
+1070.951936 165.34 96768
+1071.048704 165.34 96768
+1071.145472 165.34 96768
+1071.242240 165.34 96768
+1071.339008 165.34 96768
+1071.435776 165.34 96768
+1071.532544 165.34 96768
+1071.629824 164.47 97280
+1071.727104 164.47 97280
+1071.824384 164.47 97280
+1071.921664 164.47 97280
+1072.018944 164.47 97280
+1072.116224 164.47 97280
+1072.213504 164.47 97280
+1072.310784 164.47 97280
+1072.408064 164.47 97280
+1072.505344 164.47 97280
+1072.602624 164.47 97280
+1072.699904 164.47 97280
+1072.797184 164.47 97280
+1072.894464 164.47 97280
+1072.991744 164.47 97280
+1073.089024 164.47 97280
+1073.186304 164.47 97280
+1073.283584 164.47 97280
+1073.380864 164.47 97280
+1073.478144 164.47 97280
+1073.575424 164.47 97280
+1073.672704 164.47 97280
+1073.769984 164.47 97280
+1073.867264 164.47 97280
+1073.964544 164.47 97280
+1074.061824 164.47 97280
+1074.159104 164.47 97280
+1074.256384 164.47 97280
+1074.353664 164.47 97280
+1074.450944 164.47 97280
+1074.548224 164.47 97280
+1074.645504 164.47 97280
+1074.743296 163.61 97792
+1074.841088 163.61 97792
+1074.938880 163.61 97792
+1075.036672 163.61 97792
+1075.134464 163.61 97792
+1075.232256 163.61 97792
+1075.330048 163.61 97792
+1075.427840 163.61 97792
+1075.525632 163.61 97792
+1075.623424 163.61 97792
+1075.721216 163.61 97792
+1075.819008 163.61 97792
+1075.916800 163.61 97792
+1076.014592 163.61 97792
+1076.112384 163.61 97792
+1076.210176 163.61 97792
+1076.307968 163.61 97792
+1076.405760 163.61 97792
+1076.503552 163.61 97792
+1076.601344 163.61 97792
+1076.699136 163.61 97792
+1076.796928 163.61 97792
+1076.894720 163.61 97792
+1076.992512 163.61 97792
+1077.090304 163.61 97792
+1077.188096 163.61 97792
+1077.285888 163.61 97792
+1077.383680 163.61 97792
+1077.481472 163.61 97792
+1077.579264 163.61 97792
+1077.677056 163.61 97792
+1077.774848 163.61 97792
+1077.873152 162.76 98304
+1077.971456 162.76 98304
+1078.069760 162.76 98304
+1078.168064 162.76 98304
+1078.266368 162.76 98304
+1078.364672 162.76 98304
+1078.462976 162.76 98304
+1078.561280 162.76 98304
+1078.659584 162.76 98304
+1078.757888 162.76 98304
+1078.856192 162.76 98304
+1078.954496 162.76 98304
+1079.052800 162.76 98304
+1079.151104 162.76 98304
+1079.249408 162.76 98304
+1079.347712 162.76 98304
+1079.446016 162.76 98304
+1079.544320 162.76 98304
+1079.642624 162.76 98304
+1079.740928 162.76 98304
+1079.839232 162.76 98304
+1079.937536 162.76 98304
+1080.035840 162.76 98304
+1080.134144 162.76 98304
+1080.232448 162.76 98304
+1080.330752 162.76 98304
+1080.429056 162.76 98304
+1080.527360 162.76 98304
+1080.625664 162.76 98304
+1080.723968 162.76 98304
+1080.822272 162.76 98304
+1080.920576 162.76 98304
+1081.019392 161.92 98816
+1081.118208 161.92 98816
+1081.217024 161.92 98816
+1081.315840 161.92 98816
+1081.414656 161.92 98816
+1081.513472 161.92 98816
+1081.612288 161.92 98816
+1081.711104 161.92 98816
+1081.809920 161.92 98816
+1081.908736 161.92 98816
+1082.007552 161.92 98816
+1082.106368 161.92 98816
+1082.205184 161.92 98816
+1082.304000 161.92 98816
+1082.402816 161.92 98816
+1082.501632 161.92 98816
+1082.600960 161.08 99328
+1082.700288 161.08 99328
+1082.799616 161.08 99328
+1082.898944 161.08 99328
+1082.998272 161.08 99328
+1083.097600 161.08 99328
+1083.196928 161.08 99328
+1083.296256 161.08 99328
+1083.395584 161.08 99328
+1083.494912 161.08 99328
+1083.594240 161.08 99328
+1083.693568 161.08 99328
+1083.792896 161.08 99328
+1083.892224 161.08 99328
+1083.991552 161.08 99328
+1084.090880 161.08 99328
+1084.190208 161.08 99328
+1084.289536 161.08 99328
+1084.388864 161.08 99328
+1084.488192 161.08 99328
+1084.587520 161.08 99328
+1084.686848 161.08 99328
+1084.786176 161.08 99328
+1084.885504 161.08 99328
+1084.984832 161.08 99328
+1085.084160 161.08 99328
+1085.183488 161.08 99328
+1085.282816 161.08 99328
+1085.382144 161.08 99328
+1085.481472 161.08 99328
+1085.580800 161.08 99328
+1085.680128 161.08 99328
+1085.780480 159.44 100352
+1085.880832 159.44 100352
+1085.981184 159.44 100352
+1086.081536 159.44 100352
+1086.181888 159.44 100352
+1086.282240 159.44 100352
+1086.382592 159.44 100352
+1086.482944 159.44 100352
+1086.583296 159.44 100352
+1086.683648 159.44 100352
+1086.784000 159.44 100352
+1086.884352 159.44 100352
+1086.984704 159.44 100352
+1087.085056 159.44 100352
+1087.185408 159.44 100352
+1087.285760 159.44 100352
+1087.386112 159.44 100352
+1087.486464 159.44 100352
+1087.586816 159.44 100352
+1087.687168 159.44 100352
+1087.787520 159.44 100352
+1087.887872 159.44 100352
+1087.988224 159.44 100352
+1088.088576 159.44 100352
+1088.188928 159.44 100352
+1088.289280 159.44 100352
+1088.389632 159.44 100352
+1088.489984 159.44 100352
+1088.590336 159.44 100352
+1088.690688 159.44 100352
+1088.791040 159.44 100352
+1088.891392 159.44 100352
+1088.992256 158.63 100864
+1089.093120 158.63 100864
+1089.193984 158.63 100864
+1089.294848 158.63 100864
+1089.395712 158.63 100864
+1089.496576 158.63 100864
+1089.597440 158.63 100864
+1089.698304 158.63 100864
+1089.799168 158.63 100864
+1089.900032 158.63 100864
+1090.000896 158.63 100864
+1090.101760 158.63 100864
+1090.202624 158.63 100864
+1090.303488 158.63 100864
+1090.404352 158.63 100864
+1090.505216 158.63 100864
+1090.606080 158.63 100864
+1090.706944 158.63 100864
+1090.807808 158.63 100864
+1090.908672 158.63 100864
+1091.009536 158.63 100864
+1091.110400 158.63 100864
+1091.211264 158.63 100864
+1091.312128 158.63 100864
+1091.412992 158.63 100864
+1091.513856 158.63 100864
+1091.614720 158.63 100864
+1091.715584 158.63 100864
+1091.816448 158.63 100864
+1091.917312 158.63 100864
+1092.018176 158.63 100864
+1092.119040 158.63 100864
+1092.220416 157.83 101376
+1092.321792 157.83 101376
+1092.423168 157.83 101376
+1092.524544 157.83 101376
+1092.625920 157.83 101376
+1092.727296 157.83 101376
+1092.828672 157.83 101376
+1092.930048 157.83 101376
+1093.031424 157.83 101376
+1093.132800 157.83 101376
+1093.234176 157.83 101376
+1093.335552 157.83 101376
+1093.436928 157.83 101376
+1093.538304 157.83 101376
+1093.639680 157.83 101376
+1093.741056 157.83 101376
+1093.842944 157.04 101888
+1093.944832 157.04 101888
+1094.046720 157.04 101888
+1094.148608 157.04 101888
+1094.250496 157.04 101888
+1094.352384 157.04 101888
+1094.454272 157.04 101888
+1094.556160 157.04 101888
+1094.658048 157.04 101888
+1094.759936 157.04 101888
+1094.861824 157.04 101888
+1094.963712 157.04 101888
+1095.065600 157.04 101888
+1095.167488 157.04 101888
+1095.269376 157.04 101888
+1095.371264 157.04 101888
+1095.473152 157.04 101888
+1095.575040 157.04 101888
+1095.676928 157.04 101888
+1095.778816 157.04 101888
+1095.880704 157.04 101888
+1095.982592 157.04 101888
+1096.084480 157.04 101888
+1096.186368 157.04 101888
+1096.288256 157.04 101888
+1096.390144 157.04 101888
+1096.492032 157.04 101888
+1096.593920 157.04 101888
+1096.695808 157.04 101888
+1096.797696 157.04 101888
+1096.899584 157.04 101888
+1097.001472 157.04 101888
+1097.103872 156.25 102400
+1097.206272 156.25 102400
+1097.308672 156.25 102400
+1097.411072 156.25 102400
+1097.513472 156.25 102400
+1097.615872 156.25 102400
+1097.718272 156.25 102400
+1097.820672 156.25 102400
+1097.923072 156.25 102400
+1098.025472 156.25 102400
+1098.127872 156.25 102400
+1098.230272 156.25 102400
+1098.332672 156.25 102400
+1098.435072 156.25 102400
+1098.537472 156.25 102400
+1098.639872 156.25 102400
+1098.742272 156.25 102400
+1098.844672 156.25 102400
+1098.947072 156.25 102400
+1099.049472 156.25 102400
+1099.151872 156.25 102400
+1099.254272 156.25 102400
+1099.356672 156.25 102400
+1099.459072 156.25 102400
+1099.561472 156.25 102400
+1099.663872 156.25 102400
+1099.766272 156.25 102400
+1099.868672 156.25 102400
+1099.971072 156.25 102400
+1100.073472 156.25 102400
+1100.175872 156.25 102400
+1100.278272 156.25 102400
+1100.381184 155.47 102912
+1100.484096 155.47 102912
+1100.587008 155.47 102912
+1100.689920 155.47 102912
+1100.792832 155.47 102912
+1100.895744 155.47 102912
+1100.998656 155.47 102912
+1101.101568 155.47 102912
+1101.204480 155.47 102912
+1101.307392 155.47 102912
+1101.410304 155.47 102912
+1101.513216 155.47 102912
+1101.616128 155.47 102912
+1101.719040 155.47 102912
+1101.821952 155.47 102912
+1101.924864 155.47 102912
+1102.028288 154.70 103424
+1102.131712 154.70 103424
+1102.235136 154.70 103424
+1102.338560 154.70 103424
+1102.441984 154.70 103424
+1102.545408 154.70 103424
+1102.648832 154.70 103424
+1102.752256 154.70 103424
+1102.855680 154.70 103424
+1102.959104 154.70 103424
+1103.062528 154.70 103424
+1103.165952 154.70 103424
+1103.269376 154.70 103424
+1103.372800 154.70 103424
+1103.476224 154.70 103424
+1103.579648 154.70 103424
+1103.683072 154.70 103424
+1103.786496 154.70 103424
+1103.889920 154.70 103424
+1103.993344 154.70 103424
+1104.096768 154.70 103424
+1104.200192 154.70 103424
+1104.303616 154.70 103424
+1104.407040 154.70 103424
+1104.510464 154.70 103424
+1104.613888 154.70 103424
+1104.717312 154.70 103424
+1104.820736 154.70 103424
+1104.924160 154.70 103424
+1105.027584 154.70 103424
+1105.131008 154.70 103424
+1105.234432 154.70 103424
+1105.338368 153.94 103936
+1105.442304 153.94 103936
+1105.546240 153.94 103936
+1105.650176 153.94 103936
+1105.754112 153.94 103936
+1105.858048 153.94 103936
+1105.961984 153.94 103936
+1106.065920 153.94 103936
+1106.169856 153.94 103936
+1106.273792 153.94 103936
+1106.377728 153.94 103936
+1106.481664 153.94 103936
+1106.585600 153.94 103936
+1106.689536 153.94 103936
+1106.793472 153.94 103936
+1106.897408 153.94 103936
+1107.001856 153.19 104448
+1107.106304 153.19 104448
+1107.210752 153.19 104448
+1107.315200 153.19 104448
+1107.419648 153.19 104448
+1107.524096 153.19 104448
+1107.628544 153.19 104448
+1107.732992 153.19 104448
+1107.837440 153.19 104448
+1107.941888 153.19 104448
+1108.046336 153.19 104448
+1108.150784 153.19 104448
+1108.255232 153.19 104448
+1108.359680 153.19 104448
+1108.464128 153.19 104448
+1108.568576 153.19 104448
+1108.673024 153.19 104448
+1108.777472 153.19 104448
+1108.881920 153.19 104448
+1108.986368 153.19 104448
+1109.090816 153.19 104448
+1109.195264 153.19 104448
+1109.299712 153.19 104448
+1109.404160 153.19 104448
+1109.508608 153.19 104448
+1109.613056 153.19 104448
+1109.717504 153.19 104448
+1109.821952 153.19 104448
+1109.926400 153.19 104448
+1110.030848 153.19 104448
+1110.135296 153.19 104448
+1110.239744 153.19 104448
+1110.344704 152.44 104960
+1110.449664 152.44 104960
+1110.554624 152.44 104960
+1110.659584 152.44 104960
+1110.764544 152.44 104960
+1110.869504 152.44 104960
+1110.974464 152.44 104960
+1111.079424 152.44 104960
+1111.184384 152.44 104960
+1111.289344 152.44 104960
+1111.394304 152.44 104960
+1111.499264 152.44 104960
+1111.604224 152.44 104960
+1111.709184 152.44 104960
+1111.814144 152.44 104960
+1111.919104 152.44 104960
+1112.024064 152.44 104960
+1112.129024 152.44 104960
+1112.233984 152.44 104960
+1112.338944 152.44 104960
+1112.443904 152.44 104960
+1112.548864 152.44 104960
+1112.653824 152.44 104960
+1112.758784 152.44 104960
+1112.863744 152.44 104960
+1112.968704 152.44 104960
+1113.073664 152.44 104960
+1113.178624 152.44 104960
+1113.283584 152.44 104960
+1113.388544 152.44 104960
+1113.493504 152.44 104960
+1113.598464 152.44 104960
+1113.703936 151.70 105472
+1113.809408 151.70 105472
+1113.914880 151.70 105472
+1114.020352 151.70 105472
+1114.125824 151.70 105472
+1114.231296 151.70 105472
+1114.336768 151.70 105472
+1114.442240 151.70 105472
+1114.547712 151.70 105472
+1114.653184 151.70 105472
+1114.758656 151.70 105472
+1114.864128 151.70 105472
+1114.969600 151.70 105472
+1115.075072 151.70 105472
+1115.180544 151.70 105472
+1115.286016 151.70 105472
+1115.392512 150.24 106496
+1115.499008 150.24 106496
+1115.605504 150.24 106496
+1115.712000 150.24 106496
+1115.818496 150.24 106496
+1115.924992 150.24 106496
+1116.031488 150.24 106496
+1116.137984 150.24 106496
+1116.244480 150.24 106496
+1116.350976 150.24 106496
+1116.457472 150.24 106496
+1116.563968 150.24 106496
+1116.670464 150.24 106496
+1116.776960 150.24 106496
+1116.883456 150.24 106496
+1116.989952 150.24 106496
+1117.096448 150.24 106496
+1117.202944 150.24 106496
+1117.309440 150.24 106496
+1117.415936 150.24 106496
+1117.522432 150.24 106496
+1117.628928 150.24 106496
+1117.735424 150.24 106496
+1117.841920 150.24 106496
+1117.948416 150.24 106496
+1118.054912 150.24 106496
+1118.161408 150.24 106496
+1118.267904 150.24 106496
+1118.374400 150.24 106496
+1118.480896 150.24 106496
+1118.587392 150.24 106496
+1118.693888 150.24 106496
+1118.800896 149.52 107008
+1118.907904 149.52 107008
+1119.014912 149.52 107008
+1119.121920 149.52 107008
+1119.228928 149.52 107008
+1119.335936 149.52 107008
+1119.442944 149.52 107008
+1119.549952 149.52 107008
+1119.656960 149.52 107008
+1119.763968 149.52 107008
+1119.870976 149.52 107008
+1119.977984 149.52 107008
+1120.084992 149.52 107008
+1120.192000 149.52 107008
+1120.299008 149.52 107008
+1120.406016 149.52 107008
+1120.513536 148.81 107520
+1120.621056 148.81 107520
+1120.728576 148.81 107520
+1120.836096 148.81 107520
+1120.943616 148.81 107520
+1121.051136 148.81 107520
+1121.158656 148.81 107520
+1121.266176 148.81 107520
+1121.373696 148.81 107520
+1121.481216 148.81 107520
+1121.588736 148.81 107520
+1121.696256 148.81 107520
+1121.803776 148.81 107520
+1121.911296 148.81 107520
+1122.018816 148.81 107520
+1122.126336 148.81 107520
+1122.233856 148.81 107520
+1122.341376 148.81 107520
+1122.448896 148.81 107520
+1122.556416 148.81 107520
+1122.663936 148.81 107520
+1122.771456 148.81 107520
+1122.878976 148.81 107520
+1122.986496 148.81 107520
+1123.094016 148.81 107520
+1123.201536 148.81 107520
+1123.309056 148.81 107520
+1123.416576 148.81 107520
+1123.524096 148.81 107520
+1123.631616 148.81 107520
+1123.739136 148.81 107520
+1123.846656 148.81 107520
+1123.954688 148.10 108032
+1124.062720 148.10 108032
+1124.170752 148.10 108032
+1124.278784 148.10 108032
+1124.386816 148.10 108032
+1124.494848 148.10 108032
+1124.602880 148.10 108032
+1124.710912 148.10 108032
+1124.818944 148.10 108032
+1124.926976 148.10 108032
+1125.035008 148.10 108032
+1125.143040 148.10 108032
+1125.251072 148.10 108032
+1125.359104 148.10 108032
+1125.467136 148.10 108032
+1125.575168 148.10 108032
+1125.683712 147.41 108544
+1125.792256 147.41 108544
+1125.900800 147.41 108544
+1126.009344 147.41 108544
+1126.117888 147.41 108544
+1126.226432 147.41 108544
+1126.334976 147.41 108544
+1126.443520 147.41 108544
+1126.552064 147.41 108544
+1126.660608 147.41 108544
+1126.769152 147.41 108544
+1126.877696 147.41 108544
+1126.986240 147.41 108544
+1127.094784 147.41 108544
+1127.203328 147.41 108544
+1127.311872 147.41 108544
+1127.420416 147.41 108544
+1127.528960 147.41 108544
+1127.637504 147.41 108544
+1127.746048 147.41 108544
+1127.854592 147.41 108544
+1127.963136 147.41 108544
+1128.071680 147.41 108544
+1128.180224 147.41 108544
+1128.288768 147.41 108544
+1128.397312 147.41 108544
+1128.505856 147.41 108544
+1128.614400 147.41 108544
+1128.722944 147.41 108544
+1128.831488 147.41 108544
+1128.940032 147.41 108544
+1129.048576 147.41 108544
+1129.157632 146.71 109056
+1129.266688 146.71 109056
+1129.375744 146.71 109056
+1129.484800 146.71 109056
+1129.593856 146.71 109056
+1129.702912 146.71 109056
+1129.811968 146.71 109056
+1129.921024 146.71 109056
+1130.030080 146.71 109056
+1130.139136 146.71 109056
+1130.248192 146.71 109056
+1130.357248 146.71 109056
+1130.466304 146.71 109056
+1130.575360 146.71 109056
+1130.684416 146.71 109056
+1130.793472 146.71 109056
+1130.903040 146.03 109568
+1131.012608 146.03 109568
+1131.122176 146.03 109568
+1131.231744 146.03 109568
+1131.341312 146.03 109568
+1131.450880 146.03 109568
+1131.560448 146.03 109568
+1131.670016 146.03 109568
+1131.779584 146.03 109568
+1131.889152 146.03 109568
+1131.998720 146.03 109568
+1132.108288 146.03 109568
+1132.217856 146.03 109568
+1132.327424 146.03 109568
+1132.436992 146.03 109568
+1132.546560 146.03 109568
+1132.656128 146.03 109568
+1132.765696 146.03 109568
+1132.875264 146.03 109568
+1132.984832 146.03 109568
+1133.094400 146.03 109568
+1133.203968 146.03 109568
+1133.313536 146.03 109568
+1133.423104 146.03 109568
+1133.532672 146.03 109568
+1133.642240 146.03 109568
+1133.751808 146.03 109568
+1133.861376 146.03 109568
+1133.970944 146.03 109568
+1134.080512 146.03 109568
+1134.190080 146.03 109568
+1134.299648 146.03 109568
+1134.410240 144.68 110592
+1134.520832 144.68 110592
+1134.631424 144.68 110592
+1134.742016 144.68 110592
+1134.852608 144.68 110592
+1134.963200 144.68 110592
+1135.073792 144.68 110592
+1135.184384 144.68 110592
+1135.294976 144.68 110592
+1135.405568 144.68 110592
+1135.516160 144.68 110592
+1135.626752 144.68 110592
+1135.737344 144.68 110592
+1135.847936 144.68 110592
+1135.958528 144.68 110592
+1136.069120 144.68 110592
+1136.180224 144.01 111104
+1136.291328 144.01 111104
+1136.402432 144.01 111104
+1136.513536 144.01 111104
+1136.624640 144.01 111104
+1136.735744 144.01 111104
+1136.846848 144.01 111104
+1136.957952 144.01 111104
+1137.069056 144.01 111104
+1137.180160 144.01 111104
+1137.291264 144.01 111104
+1137.402368 144.01 111104
+1137.513472 144.01 111104
+1137.624576 144.01 111104
+1137.735680 144.01 111104
+1137.846784 144.01 111104
+1137.958400 143.35 111616
+1138.070016 143.35 111616
+1138.181632 143.35 111616
+1138.293248 143.35 111616
+1138.404864 143.35 111616
+1138.516480 143.35 111616
+1138.628096 143.35 111616
+1138.739712 143.35 111616
+1138.851328 143.35 111616
+1138.962944 143.35 111616
+1139.074560 143.35 111616
+1139.186176 143.35 111616
+1139.297792 143.35 111616
+1139.409408 143.35 111616
+1139.521024 143.35 111616
+1139.632640 143.35 111616
+1139.744256 143.35 111616
+1139.855872 143.35 111616
+1139.967488 143.35 111616
+1140.079104 143.35 111616
+1140.190720 143.35 111616
+1140.302336 143.35 111616
+1140.413952 143.35 111616
+1140.525568 143.35 111616
+1140.637184 143.35 111616
+1140.748800 143.35 111616
+1140.860416 143.35 111616
+1140.972032 143.35 111616
+1141.083648 143.35 111616
+1141.195264 143.35 111616
+1141.306880 143.35 111616
+1141.418496 143.35 111616
+1141.530624 142.69 112128
+1141.642752 142.69 112128
+1141.754880 142.69 112128
+1141.867008 142.69 112128
+1141.979136 142.69 112128
+1142.091264 142.69 112128
+1142.203392 142.69 112128
+1142.315520 142.69 112128
+1142.427648 142.69 112128
+1142.539776 142.69 112128
+1142.651904 142.69 112128
+1142.764032 142.69 112128
+1142.876160 142.69 112128
+1142.988288 142.69 112128
+1143.100416 142.69 112128
+1143.212544 142.69 112128
+1143.324672 142.69 112128
+1143.436800 142.69 112128
+1143.548928 142.69 112128
+1143.661056 142.69 112128
+1143.773184 142.69 112128
+1143.885312 142.69 112128
+1143.997440 142.69 112128
+1144.109568 142.69 112128
+1144.222208 142.05 112640
+1144.334848 142.05 112640
+1144.447488 142.05 112640
+1144.560128 142.05 112640
+1144.672768 142.05 112640
+1144.785408 142.05 112640
+1144.898048 142.05 112640
+1145.010688 142.05 112640
+1145.123328 142.05 112640
+1145.235968 142.05 112640
+1145.348608 142.05 112640
+1145.461248 142.05 112640
+1145.573888 142.05 112640
+1145.686528 142.05 112640
+1145.799168 142.05 112640
+1145.911808 142.05 112640
+1146.024960 141.40 113152
+1146.138112 141.40 113152
+1146.251264 141.40 113152
+1146.364416 141.40 113152
+1146.477568 141.40 113152
+1146.590720 141.40 113152
+1146.703872 141.40 113152
+1146.817024 141.40 113152
+1146.930176 141.40 113152
+1147.043328 141.40 113152
+1147.156480 141.40 113152
+1147.269632 141.40 113152
+1147.382784 141.40 113152
+1147.495936 141.40 113152
+1147.609088 141.40 113152
+1147.722240 141.40 113152
+1147.835392 141.40 113152
+1147.948544 141.40 113152
+1148.061696 141.40 113152
+1148.174848 141.40 113152
+1148.288000 141.40 113152
+1148.401152 141.40 113152
+1148.514304 141.40 113152
+1148.627456 141.40 113152
+1148.741632 140.13 114176
+1148.855808 140.13 114176
+1148.969984 140.13 114176
+1149.084160 140.13 114176
+1149.198336 140.13 114176
+1149.312512 140.13 114176
+1149.426688 140.13 114176
+1149.540864 140.13 114176
+1149.655040 140.13 114176
+1149.769216 140.13 114176
+1149.883392 140.13 114176
+1149.997568 140.13 114176
+1150.111744 140.13 114176
+1150.225920 140.13 114176
+1150.340096 140.13 114176
+1150.454272 140.13 114176
+1150.568448 140.13 114176
+1150.682624 140.13 114176
+1150.796800 140.13 114176
+1150.910976 140.13 114176
+1151.025152 140.13 114176
+1151.139328 140.13 114176
+1151.253504 140.13 114176
+1151.367680 140.13 114176
+1151.482368 139.51 114688
+1151.597056 139.51 114688
+1151.711744 139.51 114688
+1151.826432 139.51 114688
+1151.941120 139.51 114688
+1152.055808 139.51 114688
+1152.170496 139.51 114688
+1152.285184 139.51 114688
+1152.399872 139.51 114688
+1152.514560 139.51 114688
+1152.629248 139.51 114688
+1152.743936 139.51 114688
+1152.858624 139.51 114688
+1152.973312 139.51 114688
+1153.088000 139.51 114688
+1153.202688 139.51 114688
+1153.317888 138.89 115200
+1153.433088 138.89 115200
+1153.548288 138.89 115200
+1153.663488 138.89 115200
+1153.778688 138.89 115200
+1153.893888 138.89 115200
+1154.009088 138.89 115200
+1154.124288 138.89 115200
+1154.239488 138.89 115200
+1154.354688 138.89 115200
+1154.469888 138.89 115200
+1154.585088 138.89 115200
+1154.700288 138.89 115200
+1154.815488 138.89 115200
+1154.930688 138.89 115200
+1155.045888 138.89 115200
+1155.161088 138.89 115200
+1155.276288 138.89 115200
+1155.391488 138.89 115200
+1155.506688 138.89 115200
+1155.621888 138.89 115200
+1155.737088 138.89 115200
+1155.852288 138.89 115200
+1155.967488 138.89 115200
+1156.083200 138.27 115712
+1156.198912 138.27 115712
+1156.314624 138.27 115712
+1156.430336 138.27 115712
+1156.546048 138.27 115712
+1156.661760 138.27 115712
+1156.777472 138.27 115712
+1156.893184 138.27 115712
+1157.008896 138.27 115712
+1157.124608 138.27 115712
+1157.240320 138.27 115712
+1157.356032 138.27 115712
+1157.471744 138.27 115712
+1157.587456 138.27 115712
+1157.703168 138.27 115712
+1157.818880 138.27 115712
+1157.935616 137.06 116736
+1158.052352 137.06 116736
+1158.169088 137.06 116736
+1158.285824 137.06 116736
+1158.402560 137.06 116736
+1158.519296 137.06 116736
+1158.636032 137.06 116736
+1158.752768 137.06 116736
+1158.869504 137.06 116736
+1158.986240 137.06 116736
+1159.102976 137.06 116736
+1159.219712 137.06 116736
+1159.336448 137.06 116736
+1159.453184 137.06 116736
+1159.569920 137.06 116736
+1159.686656 137.06 116736
+1159.803392 137.06 116736
+1159.920128 137.06 116736
+1160.036864 137.06 116736
+1160.153600 137.06 116736
+1160.270336 137.06 116736
+1160.387072 137.06 116736
+1160.503808 137.06 116736
+1160.620544 137.06 116736
+1160.737792 136.46 117248
+1160.855040 136.46 117248
+1160.972288 136.46 117248
+1161.089536 136.46 117248
+1161.206784 136.46 117248
+1161.324032 136.46 117248
+1161.441280 136.46 117248
+1161.558528 136.46 117248
+1161.675776 136.46 117248
+1161.793024 136.46 117248
+1161.910272 136.46 117248
+1162.027520 136.46 117248
+1162.144768 136.46 117248
+1162.262016 136.46 117248
+1162.379264 136.46 117248
+1162.496512 136.46 117248
+1162.613760 136.46 117248
+1162.731008 136.46 117248
+1162.848256 136.46 117248
+1162.965504 136.46 117248
+1163.082752 136.46 117248
+1163.200000 136.46 117248
+1163.317248 136.46 117248
+1163.434496 136.46 117248
+1163.552256 135.87 117760
+1163.670016 135.87 117760
+1163.787776 135.87 117760
+1163.905536 135.87 117760
+1164.023296 135.87 117760
+1164.141056 135.87 117760
+1164.258816 135.87 117760
+1164.376576 135.87 117760
+1164.494336 135.87 117760
+1164.612096 135.87 117760
+1164.729856 135.87 117760
+1164.847616 135.87 117760
+1164.965376 135.87 117760
+1165.083136 135.87 117760
+1165.200896 135.87 117760
+1165.318656 135.87 117760
+1165.436928 135.28 118272
+1165.555200 135.28 118272
+1165.673472 135.28 118272
+1165.791744 135.28 118272
+1165.910016 135.28 118272
+1166.028288 135.28 118272
+1166.146560 135.28 118272
+1166.264832 135.28 118272
+1166.383104 135.28 118272
+1166.501376 135.28 118272
+1166.619648 135.28 118272
+1166.737920 135.28 118272
+1166.856192 135.28 118272
+1166.974464 135.28 118272
+1167.092736 135.28 118272
+1167.211008 135.28 118272
+1167.329280 135.28 118272
+1167.447552 135.28 118272
+1167.565824 135.28 118272
+1167.684096 135.28 118272
+1167.802368 135.28 118272
+1167.920640 135.28 118272
+1168.038912 135.28 118272
+1168.157184 135.28 118272
+1168.276480 134.12 119296
+1168.395776 134.12 119296
+1168.515072 134.12 119296
+1168.634368 134.12 119296
+1168.753664 134.12 119296
+1168.872960 134.12 119296
+1168.992256 134.12 119296
+1169.111552 134.12 119296
+1169.230848 134.12 119296
+1169.350144 134.12 119296
+1169.469440 134.12 119296
+1169.588736 134.12 119296
+1169.708032 134.12 119296
+1169.827328 134.12 119296
+1169.946624 134.12 119296
+1170.065920 134.12 119296
+1170.185728 133.55 119808
+1170.305536 133.55 119808
+1170.425344 133.55 119808
+1170.545152 133.55 119808
+1170.664960 133.55 119808
+1170.784768 133.55 119808
+1170.904576 133.55 119808
+1171.024384 133.55 119808
+1171.144192 133.55 119808
+1171.264000 133.55 119808
+1171.383808 133.55 119808
+1171.503616 133.55 119808
+1171.623424 133.55 119808
+1171.743232 133.55 119808
+1171.863040 133.55 119808
+1171.982848 133.55 119808
+1172.103168 132.98 120320
+1172.223488 132.98 120320
+1172.343808 132.98 120320
+1172.464128 132.98 120320
+1172.584448 132.98 120320
+1172.704768 132.98 120320
+1172.825088 132.98 120320
+1172.945408 132.98 120320
+1173.065728 132.98 120320
+1173.186048 132.98 120320
+1173.306368 132.98 120320
+1173.426688 132.98 120320
+1173.547008 132.98 120320
+1173.667328 132.98 120320
+1173.787648 132.98 120320
+1173.907968 132.98 120320
+1174.028288 132.98 120320
+1174.148608 132.98 120320
+1174.268928 132.98 120320
+1174.389248 132.98 120320
+1174.509568 132.98 120320
+1174.629888 132.98 120320
+1174.750208 132.98 120320
+1174.870528 132.98 120320
+1174.991360 132.42 120832
+1175.112192 132.42 120832
+1175.233024 132.42 120832
+1175.353856 132.42 120832
+1175.474688 132.42 120832
+1175.595520 132.42 120832
+1175.716352 132.42 120832
+1175.837184 132.42 120832
+1175.958016 132.42 120832
+1176.078848 132.42 120832
+1176.199680 132.42 120832
+1176.320512 132.42 120832
+1176.441344 132.42 120832
+1176.562176 132.42 120832
+1176.683008 132.42 120832
+1176.803840 132.42 120832
+1176.925696 131.30 121856
+1177.047552 131.30 121856
+1177.169408 131.30 121856
+1177.291264 131.30 121856
+1177.413120 131.30 121856
+1177.534976 131.30 121856
+1177.656832 131.30 121856
+1177.778688 131.30 121856
+1177.900544 131.30 121856
+1178.022400 131.30 121856
+1178.144256 131.30 121856
+1178.266112 131.30 121856
+1178.387968 131.30 121856
+1178.509824 131.30 121856
+1178.631680 131.30 121856
+1178.753536 131.30 121856
+1178.875392 131.30 121856
+1178.997248 131.30 121856
+1179.119104 131.30 121856
+1179.240960 131.30 121856
+1179.362816 131.30 121856
+1179.484672 131.30 121856
+1179.606528 131.30 121856
+1179.728384 131.30 121856
+1179.850752 130.75 122368
+1179.973120 130.75 122368
+1180.095488 130.75 122368
+1180.217856 130.75 122368
+1180.340224 130.75 122368
+1180.462592 130.75 122368
+1180.584960 130.75 122368
+1180.707328 130.75 122368
+1180.829696 130.75 122368
+1180.952064 130.75 122368
+1181.074432 130.75 122368
+1181.196800 130.75 122368
+1181.319168 130.75 122368
+1181.441536 130.75 122368
+1181.563904 130.75 122368
+1181.686272 130.75 122368
+1181.809152 130.21 122880
+1181.932032 130.21 122880
+1182.054912 130.21 122880
+1182.177792 130.21 122880
+1182.300672 130.21 122880
+1182.423552 130.21 122880
+1182.546432 130.21 122880
+1182.669312 130.21 122880
+1182.792192 130.21 122880
+1182.915072 130.21 122880
+1183.037952 130.21 122880
+1183.160832 130.21 122880
+1183.283712 130.21 122880
+1183.406592 130.21 122880
+1183.529472 130.21 122880
+1183.652352 130.21 122880
+1183.776256 129.13 123904
+1183.900160 129.13 123904
+1184.024064 129.13 123904
+1184.147968 129.13 123904
+1184.271872 129.13 123904
+1184.395776 129.13 123904
+1184.519680 129.13 123904
+1184.643584 129.13 123904
+1184.767488 129.13 123904
+1184.891392 129.13 123904
+1185.015296 129.13 123904
+1185.139200 129.13 123904
+1185.263104 129.13 123904
+1185.387008 129.13 123904
+1185.510912 129.13 123904
+1185.634816 129.13 123904
+1185.759232 128.60 124416
+1185.883648 128.60 124416
+1186.008064 128.60 124416
+1186.132480 128.60 124416
+1186.256896 128.60 124416
+1186.381312 128.60 124416
+1186.505728 128.60 124416
+1186.630144 128.60 124416
+1186.754560 128.60 124416
+1186.878976 128.60 124416
+1187.003392 128.60 124416
+1187.127808 128.60 124416
+1187.252224 128.60 124416
+1187.376640 128.60 124416
+1187.501056 128.60 124416
+1187.625472 128.60 124416
+1187.749888 128.60 124416
+1187.874304 128.60 124416
+1187.998720 128.60 124416
+1188.123136 128.60 124416
+1188.247552 128.60 124416
+1188.371968 128.60 124416
+1188.496384 128.60 124416
+1188.620800 128.60 124416
+1188.745728 128.07 124928
+1188.870656 128.07 124928
+1188.995584 128.07 124928
+1189.120512 128.07 124928
+1189.245440 128.07 124928
+1189.370368 128.07 124928
+1189.495296 128.07 124928
+1189.620224 128.07 124928
+1189.745152 128.07 124928
+1189.870080 128.07 124928
+1189.995008 128.07 124928
+1190.119936 128.07 124928
+1190.244864 128.07 124928
+1190.369792 128.07 124928
+1190.494720 128.07 124928
+1190.619648 128.07 124928
+1190.745600 127.03 125952
+1190.871552 127.03 125952
+1190.997504 127.03 125952
+1191.123456 127.03 125952
+1191.249408 127.03 125952
+1191.375360 127.03 125952
+1191.501312 127.03 125952
+1191.627264 127.03 125952
+1191.753216 127.03 125952
+1191.879168 127.03 125952
+1192.005120 127.03 125952
+1192.131072 127.03 125952
+1192.257024 127.03 125952
+1192.382976 127.03 125952
+1192.508928 127.03 125952
+1192.634880 127.03 125952
+1192.761344 126.52 126464
+1192.887808 126.52 126464
+1193.014272 126.52 126464
+1193.140736 126.52 126464
+1193.267200 126.52 126464
+1193.393664 126.52 126464
+1193.520128 126.52 126464
+1193.646592 126.52 126464
+1193.773056 126.52 126464
+1193.899520 126.52 126464
+1194.025984 126.52 126464
+1194.152448 126.52 126464
+1194.278912 126.52 126464
+1194.405376 126.52 126464
+1194.531840 126.52 126464
+1194.658304 126.52 126464
+1194.785280 126.01 126976
+1194.912256 126.01 126976
+1195.039232 126.01 126976
+1195.166208 126.01 126976
+1195.293184 126.01 126976
+1195.420160 126.01 126976
+1195.547136 126.01 126976
+1195.674112 126.01 126976
+1195.801088 126.01 126976
+1195.928064 126.01 126976
+1196.055040 126.01 126976
+1196.182016 126.01 126976
+1196.308992 126.01 126976
+1196.435968 126.01 126976
+1196.562944 126.01 126976
+1196.689920 126.01 126976
+1196.817920 125.00 128000
+1196.945920 125.00 128000
+1197.073920 125.00 128000
+1197.201920 125.00 128000
+1197.329920 125.00 128000
+1197.457920 125.00 128000
+1197.585920 125.00 128000
+1197.713920 125.00 128000
+1197.841920 125.00 128000
+1197.969920 125.00 128000
+1198.097920 125.00 128000
+1198.225920 125.00 128000
+1198.353920 125.00 128000
+1198.481920 125.00 128000
+1198.609920 125.00 128000
+1198.737920 125.00 128000
+1198.865920 125.00 128000
+1198.993920 125.00 128000
+1199.121920 125.00 128000
+1199.249920 125.00 128000
+1199.377920 125.00 128000
+1199.505920 125.00 128000
+1199.633920 125.00 128000
+1199.761920 125.00 128000
+1199.890432 124.50 128512
+1200.018944 124.50 128512
+1200.147456 124.50 128512
+1200.275968 124.50 128512
+1200.404480 124.50 128512
+1200.532992 124.50 128512
+1200.661504 124.50 128512
+1200.790016 124.50 128512
+1200.918528 124.50 128512
+1201.047040 124.50 128512
+1201.175552 124.50 128512
+1201.304064 124.50 128512
+1201.432576 124.50 128512
+1201.561088 124.50 128512
+1201.689600 124.50 128512
+1201.818112 124.50 128512
+1201.947136 124.01 129024
+1202.076160 124.01 129024
+1202.205184 124.01 129024
+1202.334208 124.01 129024
+1202.463232 124.01 129024
+1202.592256 124.01 129024
+1202.721280 124.01 129024
+1202.850304 124.01 129024
+1202.979328 124.01 129024
+1203.108352 124.01 129024
+1203.237376 124.01 129024
+1203.366400 124.01 129024
+1203.495424 124.01 129024
+1203.624448 124.01 129024
+1203.753472 124.01 129024
+1203.882496 124.01 129024
+1204.012544 123.03 130048
+1204.142592 123.03 130048
+1204.272640 123.03 130048
+1204.402688 123.03 130048
+1204.532736 123.03 130048
+1204.662784 123.03 130048
+1204.792832 123.03 130048
+1204.922880 123.03 130048
+1205.052928 123.03 130048
+1205.182976 123.03 130048
+1205.313024 123.03 130048
+1205.443072 123.03 130048
+1205.573120 123.03 130048
+1205.703168 123.03 130048
+1205.833216 123.03 130048
+1205.963264 123.03 130048
+1206.093824 122.55 130560
+1206.224384 122.55 130560
+1206.354944 122.55 130560
+1206.485504 122.55 130560
+1206.616064 122.55 130560
+1206.746624 122.55 130560
+1206.877184 122.55 130560
+1207.007744 122.55 130560
+1207.138304 122.55 130560
+1207.268864 122.55 130560
+1207.399424 122.55 130560
+1207.529984 122.55 130560
+1207.660544 122.55 130560
+1207.791104 122.55 130560
+1207.921664 122.55 130560
+1208.052224 122.55 130560
+1208.183296 122.07 131072
+1208.314368 122.07 131072
+1208.445440 122.07 131072
+1208.576512 122.07 131072
+1208.707584 122.07 131072
+1208.838656 122.07 131072
+1208.969728 122.07 131072
+1209.100800 122.07 131072
+1209.231872 122.07 131072
+1209.362944 122.07 131072
+1209.494016 122.07 131072
+1209.625088 122.07 131072
+1209.756160 122.07 131072
+1209.887232 122.07 131072
+1210.018304 122.07 131072
+1210.149376 122.07 131072
+1210.281472 121.12 132096
+1210.413568 121.12 132096
+1210.545664 121.12 132096
+1210.677760 121.12 132096
+1210.809856 121.12 132096
+1210.941952 121.12 132096
+1211.074048 121.12 132096
+1211.206144 121.12 132096
+1211.338240 121.12 132096
+1211.470336 121.12 132096
+1211.602432 121.12 132096
+1211.734528 121.12 132096
+1211.866624 121.12 132096
+1211.998720 121.12 132096
+1212.130816 121.12 132096
+1212.262912 121.12 132096
+1212.395008 121.12 132096
+1212.527104 121.12 132096
+1212.659200 121.12 132096
+1212.791296 121.12 132096
+1212.923392 121.12 132096
+1213.055488 121.12 132096
+1213.187584 121.12 132096
+1213.319680 121.12 132096
+1213.451776 121.12 132096
+1213.583872 121.12 132096
+1213.715968 121.12 132096
+1213.848064 121.12 132096
+1213.980160 121.12 132096
+1214.112256 121.12 132096
+1214.244352 121.12 132096
+1214.376448 121.12 132096
+1214.509568 120.19 133120
+1214.642688 120.19 133120
+1214.775808 120.19 133120
+1214.908928 120.19 133120
+1215.042048 120.19 133120
+1215.175168 120.19 133120
+1215.308288 120.19 133120
+1215.441408 120.19 133120
+1215.574528 120.19 133120
+1215.707648 120.19 133120
+1215.840768 120.19 133120
+1215.973888 120.19 133120
+1216.107008 120.19 133120
+1216.240128 120.19 133120
+1216.373248 120.19 133120
+1216.506368 120.19 133120
+1216.640512 119.27 134144
+1216.774656 119.27 134144
+1216.908800 119.27 134144
+1217.042944 119.27 134144
+1217.177088 119.27 134144
+1217.311232 119.27 134144
+1217.445376 119.27 134144
+1217.579520 119.27 134144
+1217.713664 119.27 134144
+1217.847808 119.27 134144
+1217.981952 119.27 134144
+1218.116096 119.27 134144
+1218.250240 119.27 134144
+1218.384384 119.27 134144
+1218.518528 119.27 134144
+1218.652672 119.27 134144
+1218.787840 118.37 135168
+1218.923008 118.37 135168
+1219.058176 118.37 135168
+1219.193344 118.37 135168
+1219.328512 118.37 135168
+1219.463680 118.37 135168
+1219.598848 118.37 135168
+1219.734016 118.37 135168
+1219.869184 118.37 135168
+1220.004352 118.37 135168
+1220.139520 118.37 135168
+1220.274688 118.37 135168
+1220.409856 118.37 135168
+1220.545024 118.37 135168
+1220.680192 118.37 135168
+1220.815360 118.37 135168
+1220.950528 118.37 135168
+1221.085696 118.37 135168
+1221.220864 118.37 135168
+1221.356032 118.37 135168
+1221.491200 118.37 135168
+1221.626368 118.37 135168
+1221.761536 118.37 135168
+1221.896704 118.37 135168
+1222.032896 117.48 136192
+1222.169088 117.48 136192
+1222.305280 117.48 136192
+1222.441472 117.48 136192
+1222.577664 117.48 136192
+1222.713856 117.48 136192
+1222.850048 117.48 136192
+1222.986240 117.48 136192
+1223.122432 117.48 136192
+1223.258624 117.48 136192
+1223.394816 117.48 136192
+1223.531008 117.48 136192
+1223.667200 117.48 136192
+1223.803392 117.48 136192
+1223.939584 117.48 136192
+1224.075776 117.48 136192
+1224.212992 116.60 137216
+1224.350208 116.60 137216
+1224.487424 116.60 137216
+1224.624640 116.60 137216
+1224.761856 116.60 137216
+1224.899072 116.60 137216
+1225.036288 116.60 137216
+1225.173504 116.60 137216
+1225.310720 116.60 137216
+1225.447936 116.60 137216
+1225.585152 116.60 137216
+1225.722368 116.60 137216
+1225.859584 116.60 137216
+1225.996800 116.60 137216
+1226.134016 116.60 137216
+1226.271232 116.60 137216
+1226.409472 115.74 138240
+1226.547712 115.74 138240
+1226.685952 115.74 138240
+1226.824192 115.74 138240
+1226.962432 115.74 138240
+1227.100672 115.74 138240
+1227.238912 115.74 138240
+1227.377152 115.74 138240
+1227.515392 115.74 138240
+1227.653632 115.74 138240
+1227.791872 115.74 138240
+1227.930112 115.74 138240
+1228.068352 115.74 138240
+1228.206592 115.74 138240
+1228.344832 115.74 138240
+1228.483072 115.74 138240
+1228.621312 115.74 138240
+1228.759552 115.74 138240
+1228.897792 115.74 138240
+1229.036032 115.74 138240
+1229.174272 115.74 138240
+1229.312512 115.74 138240
+1229.450752 115.74 138240
+1229.588992 115.74 138240
+1229.727232 115.74 138240
+1229.865472 115.74 138240
+1230.003712 115.74 138240
+1230.141952 115.74 138240
+1230.280192 115.74 138240
+1230.418432 115.74 138240
+1230.556672 115.74 138240
+1230.694912 115.74 138240
+1230.834176 114.89 139264
+1230.973440 114.89 139264
+1231.112704 114.89 139264
+1231.251968 114.89 139264
+1231.391232 114.89 139264
+1231.530496 114.89 139264
+1231.669760 114.89 139264
+1231.809024 114.89 139264
+1231.948288 114.89 139264
+1232.087552 114.89 139264
+1232.226816 114.89 139264
+1232.366080 114.89 139264
+1232.505344 114.89 139264
+1232.644608 114.89 139264
+1232.783872 114.89 139264
+1232.923136 114.89 139264
+1233.063424 114.05 140288
+1233.203712 114.05 140288
+1233.344000 114.05 140288
+1233.484288 114.05 140288
+1233.624576 114.05 140288
+1233.764864 114.05 140288
+1233.905152 114.05 140288
+1234.045440 114.05 140288
+1234.185728 114.05 140288
+1234.326016 114.05 140288
+1234.466304 114.05 140288
+1234.606592 114.05 140288
+1234.746880 114.05 140288
+1234.887168 114.05 140288
+1235.027456 114.05 140288
+1235.167744 114.05 140288
+1235.308032 114.05 140288
+1235.448320 114.05 140288
+1235.588608 114.05 140288
+1235.728896 114.05 140288
+1235.869184 114.05 140288
+1236.009472 114.05 140288
+1236.149760 114.05 140288
+1236.290048 114.05 140288
+1236.431360 113.22 141312
+1236.572672 113.22 141312
+1236.713984 113.22 141312
+1236.855296 113.22 141312
+1236.996608 113.22 141312
+1237.137920 113.22 141312
+1237.279232 113.22 141312
+1237.420544 113.22 141312
+1237.561856 113.22 141312
+1237.703168 113.22 141312
+1237.844480 113.22 141312
+1237.985792 113.22 141312
+1238.127104 113.22 141312
+1238.268416 113.22 141312
+1238.409728 113.22 141312
+1238.551040 113.22 141312
+1238.693376 112.41 142336
+1238.835712 112.41 142336
+1238.978048 112.41 142336
+1239.120384 112.41 142336
+1239.262720 112.41 142336
+1239.405056 112.41 142336
+1239.547392 112.41 142336
+1239.689728 112.41 142336
+1239.832064 112.41 142336
+1239.974400 112.41 142336
+1240.116736 112.41 142336
+1240.259072 112.41 142336
+1240.401408 112.41 142336
+1240.543744 112.41 142336
+1240.686080 112.41 142336
+1240.828416 112.41 142336
+1240.971776 111.61 143360
+1241.115136 111.61 143360
+1241.258496 111.61 143360
+1241.401856 111.61 143360
+1241.545216 111.61 143360
+1241.688576 111.61 143360
+1241.831936 111.61 143360
+1241.975296 111.61 143360
+1242.118656 111.61 143360
+1242.262016 111.61 143360
+1242.405376 111.61 143360
+1242.548736 111.61 143360
+1242.692096 111.61 143360
+1242.835456 111.61 143360
+1242.978816 111.61 143360
+1243.122176 111.61 143360
+1243.265536 111.61 143360
+1243.408896 111.61 143360
+1243.552256 111.61 143360
+1243.695616 111.61 143360
+1243.838976 111.61 143360
+1243.982336 111.61 143360
+1244.125696 111.61 143360
+1244.269056 111.61 143360
+1244.413440 110.82 144384
+1244.557824 110.82 144384
+1244.702208 110.82 144384
+1244.846592 110.82 144384
+1244.990976 110.82 144384
+1245.135360 110.82 144384
+1245.279744 110.82 144384
+1245.424128 110.82 144384
+1245.568512 110.82 144384
+1245.712896 110.82 144384
+1245.857280 110.82 144384
+1246.001664 110.82 144384
+1246.146048 110.82 144384
+1246.290432 110.82 144384
+1246.434816 110.82 144384
+1246.579200 110.82 144384
+1246.724608 110.04 145408
+1246.870016 110.04 145408
+1247.015424 110.04 145408
+1247.160832 110.04 145408
+1247.306240 110.04 145408
+1247.451648 110.04 145408
+1247.597056 110.04 145408
+1247.742464 110.04 145408
+1247.888896 109.27 146432
+1248.035328 109.27 146432
+1248.181760 109.27 146432
+1248.328192 109.27 146432
+1248.474624 109.27 146432
+1248.621056 109.27 146432
+1248.767488 109.27 146432
+1248.913920 109.27 146432
+1249.060352 109.27 146432
+1249.206784 109.27 146432
+1249.353216 109.27 146432
+1249.499648 109.27 146432
+1249.646080 109.27 146432
+1249.792512 109.27 146432
+1249.938944 109.27 146432
+1250.085376 109.27 146432
+1250.232832 108.51 147456
+1250.380288 108.51 147456
+1250.527744 108.51 147456
+1250.675200 108.51 147456
+1250.822656 108.51 147456
+1250.970112 108.51 147456
+1251.117568 108.51 147456
+1251.265024 108.51 147456
+1251.412480 108.51 147456
+1251.559936 108.51 147456
+1251.707392 108.51 147456
+1251.854848 108.51 147456
+1252.002304 108.51 147456
+1252.149760 108.51 147456
+1252.297216 108.51 147456
+1252.444672 108.51 147456
+1252.592128 108.51 147456
+1252.739584 108.51 147456
+1252.887040 108.51 147456
+1253.034496 108.51 147456
+1253.181952 108.51 147456
+1253.329408 108.51 147456
+1253.476864 108.51 147456
+1253.624320 108.51 147456
+1253.772800 107.76 148480
+1253.921280 107.76 148480
+1254.069760 107.76 148480
+1254.218240 107.76 148480
+1254.366720 107.76 148480
+1254.515200 107.76 148480
+1254.663680 107.76 148480
+1254.812160 107.76 148480
+1254.960640 107.76 148480
+1255.109120 107.76 148480
+1255.257600 107.76 148480
+1255.406080 107.76 148480
+1255.554560 107.76 148480
+1255.703040 107.76 148480
+1255.851520 107.76 148480
+1256.000000 107.76 148480
+1256.149504 107.02 149504
+1256.299008 107.02 149504
+1256.448512 107.02 149504
+1256.598016 107.02 149504
+1256.747520 107.02 149504
+1256.897024 107.02 149504
+1257.046528 107.02 149504
+1257.196032 107.02 149504
+1257.346560 106.29 150528
+1257.497088 106.29 150528
+1257.647616 106.29 150528
+1257.798144 106.29 150528
+1257.948672 106.29 150528
+1258.099200 106.29 150528
+1258.249728 106.29 150528
+1258.400256 106.29 150528
+1258.550784 106.29 150528
+1258.701312 106.29 150528
+1258.851840 106.29 150528
+1259.002368 106.29 150528
+1259.152896 106.29 150528
+1259.303424 106.29 150528
+1259.453952 106.29 150528
+1259.604480 106.29 150528
+1259.755008 106.29 150528
+1259.905536 106.29 150528
+1260.056064 106.29 150528
+1260.206592 106.29 150528
+1260.357120 106.29 150528
+1260.507648 106.29 150528
+1260.658176 106.29 150528
+1260.808704 106.29 150528
+1260.960256 105.57 151552
+1261.111808 105.57 151552
+1261.263360 105.57 151552
+1261.414912 105.57 151552
+1261.566464 105.57 151552
+1261.718016 105.57 151552
+1261.869568 105.57 151552
+1262.021120 105.57 151552
+1262.172672 105.57 151552
+1262.324224 105.57 151552
+1262.475776 105.57 151552
+1262.627328 105.57 151552
+1262.778880 105.57 151552
+1262.930432 105.57 151552
+1263.081984 105.57 151552
+1263.233536 105.57 151552
+1263.386112 104.87 152576
+1263.538688 104.87 152576
+1263.691264 104.87 152576
+1263.843840 104.87 152576
+1263.996416 104.87 152576
+1264.148992 104.87 152576
+1264.301568 104.87 152576
+1264.454144 104.87 152576
+1264.607744 104.17 153600
+1264.761344 104.17 153600
+1264.914944 104.17 153600
+1265.068544 104.17 153600
+1265.222144 104.17 153600
+1265.375744 104.17 153600
+1265.529344 104.17 153600
+1265.682944 104.17 153600
+1265.836544 104.17 153600
+1265.990144 104.17 153600
+1266.143744 104.17 153600
+1266.297344 104.17 153600
+1266.450944 104.17 153600
+1266.604544 104.17 153600
+1266.758144 104.17 153600
+1266.911744 104.17 153600
+1267.066368 103.48 154624
+1267.220992 103.48 154624
+1267.375616 103.48 154624
+1267.530240 103.48 154624
+1267.684864 103.48 154624
+1267.839488 103.48 154624
+1267.994112 103.48 154624
+1268.148736 103.48 154624
+1268.304384 102.80 155648
+1268.460032 102.80 155648
+1268.615680 102.80 155648
+1268.771328 102.80 155648
+1268.926976 102.80 155648
+1269.082624 102.80 155648
+1269.238272 102.80 155648
+1269.393920 102.80 155648
+1269.549568 102.80 155648
+1269.705216 102.80 155648
+1269.860864 102.80 155648
+1270.016512 102.80 155648
+1270.172160 102.80 155648
+1270.327808 102.80 155648
+1270.483456 102.80 155648
+1270.639104 102.80 155648
+1270.794752 102.80 155648
+1270.950400 102.80 155648
+1271.106048 102.80 155648
+1271.261696 102.80 155648
+1271.417344 102.80 155648
+1271.572992 102.80 155648
+1271.728640 102.80 155648
+1271.884288 102.80 155648
+1272.040960 102.12 156672
+1272.197632 102.12 156672
+1272.354304 102.12 156672
+1272.510976 102.12 156672
+1272.667648 102.12 156672
+1272.824320 102.12 156672
+1272.980992 102.12 156672
+1273.137664 102.12 156672
+1273.295360 101.46 157696
+1273.453056 101.46 157696
+1273.610752 101.46 157696
+1273.768448 101.46 157696
+1273.926144 101.46 157696
+1274.083840 101.46 157696
+1274.241536 101.46 157696
+1274.399232 101.46 157696
+1274.556928 101.46 157696
+1274.714624 101.46 157696
+1274.872320 101.46 157696
+1275.030016 101.46 157696
+1275.187712 101.46 157696
+1275.345408 101.46 157696
+1275.503104 101.46 157696
+1275.660800 101.46 157696
+1275.819520 100.81 158720
+1275.978240 100.81 158720
+1276.136960 100.81 158720
+1276.295680 100.81 158720
+1276.454400 100.81 158720
+1276.613120 100.81 158720
+1276.771840 100.81 158720
+1276.930560 100.81 158720
+1277.089280 100.81 158720
+1277.248000 100.81 158720
+1277.406720 100.81 158720
+1277.565440 100.81 158720
+1277.725184 100.16 159744
+1277.884928 100.16 159744
+1278.044672 100.16 159744
+1278.204416 100.16 159744
+1278.364160 100.16 159744
+1278.523904 100.16 159744
+1278.683648 100.16 159744
+1278.843392 100.16 159744
+1279.004160 99.52 160768
+1279.164928 99.52 160768
+1279.325696 99.52 160768
+1279.486464 99.52 160768
+1279.647232 99.52 160768
+1279.808000 99.52 160768
+1279.968768 99.52 160768
+1280.129536 99.52 160768
+1280.290304 99.52 160768
+1280.451072 99.52 160768
+1280.611840 99.52 160768
+1280.772608 99.52 160768
+1280.933376 99.52 160768
+1281.094144 99.52 160768
+1281.254912 99.52 160768
+1281.415680 99.52 160768
+1281.576448 99.52 160768
+1281.737216 99.52 160768
+1281.897984 99.52 160768
+1282.058752 99.52 160768
+1282.219520 99.52 160768
+1282.380288 99.52 160768
+1282.541056 99.52 160768
+1282.701824 99.52 160768
+1282.863616 98.89 161792
+1283.025408 98.89 161792
+1283.187200 98.89 161792
+1283.348992 98.89 161792
+1283.510784 98.89 161792
+1283.672576 98.89 161792
+1283.834368 98.89 161792
+1283.996160 98.89 161792
+1284.158976 98.27 162816
+1284.321792 98.27 162816
+1284.484608 98.27 162816
+1284.647424 98.27 162816
+1284.810240 98.27 162816
+1284.973056 98.27 162816
+1285.135872 98.27 162816
+1285.298688 98.27 162816
+1285.461504 98.27 162816
+1285.624320 98.27 162816
+1285.787136 98.27 162816
+1285.949952 98.27 162816
+1286.113792 97.66 163840
+1286.277632 97.66 163840
+1286.441472 97.66 163840
+1286.605312 97.66 163840
+1286.769152 97.66 163840
+1286.932992 97.66 163840
+1287.096832 97.66 163840
+1287.260672 97.66 163840
+1287.425536 97.05 164864
+1287.590400 97.05 164864
+1287.755264 97.05 164864
+1287.920128 97.05 164864
+1288.084992 97.05 164864
+1288.249856 97.05 164864
+1288.414720 97.05 164864
+1288.579584 97.05 164864
+1288.744448 97.05 164864
+1288.909312 97.05 164864
+1289.074176 97.05 164864
+1289.239040 97.05 164864
+1289.404928 96.45 165888
+1289.570816 96.45 165888
+1289.736704 96.45 165888
+1289.902592 96.45 165888
+1290.068480 96.45 165888
+1290.234368 96.45 165888
+1290.400256 96.45 165888
+1290.566144 96.45 165888
+1290.732032 96.45 165888
+1290.897920 96.45 165888
+1291.063808 96.45 165888
+1291.229696 96.45 165888
+1291.396608 95.86 166912
+1291.563520 95.86 166912
+1291.730432 95.86 166912
+1291.897344 95.86 166912
+1292.064256 95.86 166912
+1292.231168 95.86 166912
+1292.398080 95.86 166912
+1292.564992 95.86 166912
+1292.731904 95.86 166912
+1292.898816 95.86 166912
+1293.065728 95.86 166912
+1293.232640 95.86 166912
+1293.399552 95.86 166912
+1293.566464 95.86 166912
+1293.733376 95.86 166912
+1293.900288 95.86 166912
+1294.067200 95.86 166912
+1294.234112 95.86 166912
+1294.401024 95.86 166912
+1294.567936 95.86 166912
+1294.735872 95.27 167936
+1294.903808 95.27 167936
+1295.071744 95.27 167936
+1295.239680 95.27 167936
+1295.407616 95.27 167936
+1295.575552 95.27 167936
+1295.743488 95.27 167936
+1295.911424 95.27 167936
+1296.080384 94.70 168960
+1296.249344 94.70 168960
+1296.418304 94.70 168960
+1296.587264 94.70 168960
+1296.756224 94.70 168960
+1296.925184 94.70 168960
+1297.094144 94.70 168960
+1297.263104 94.70 168960
+1297.433088 94.13 169984
+1297.603072 94.13 169984
+1297.773056 94.13 169984
+1297.943040 94.13 169984
+1298.113024 94.13 169984
+1298.283008 94.13 169984
+1298.452992 94.13 169984
+1298.622976 94.13 169984
+1298.792960 94.13 169984
+1298.962944 94.13 169984
+1299.132928 94.13 169984
+1299.302912 94.13 169984
+1299.473920 93.56 171008
+1299.644928 93.56 171008
+1299.815936 93.56 171008
+1299.986944 93.56 171008
+1300.157952 93.56 171008
+1300.328960 93.56 171008
+1300.499968 93.56 171008
+1300.670976 93.56 171008
+1300.843008 93.01 172032
+1301.015040 93.01 172032
+1301.187072 93.01 172032
+1301.359104 93.01 172032
+1301.531136 93.01 172032
+1301.703168 93.01 172032
+1301.875200 93.01 172032
+1302.047232 93.01 172032
+1302.219264 93.01 172032
+1302.391296 93.01 172032
+1302.563328 93.01 172032
+1302.735360 93.01 172032
+1302.908416 92.46 173056
+1303.081472 92.46 173056
+1303.254528 92.46 173056
+1303.427584 92.46 173056
+1303.600640 92.46 173056
+1303.773696 92.46 173056
+1303.946752 92.46 173056
+1304.119808 92.46 173056
+1304.293888 91.91 174080
+1304.467968 91.91 174080
+1304.642048 91.91 174080
+1304.816128 91.91 174080
+1304.990208 91.91 174080
+1305.164288 91.91 174080
+1305.338368 91.91 174080
+1305.512448 91.91 174080
+1305.687552 91.37 175104
+1305.862656 91.37 175104
+1306.037760 91.37 175104
+1306.212864 91.37 175104
+1306.387968 91.37 175104
+1306.563072 91.37 175104
+1306.738176 91.37 175104
+1306.913280 91.37 175104
+1307.089408 90.84 176128
+1307.265536 90.84 176128
+1307.441664 90.84 176128
+1307.617792 90.84 176128
+1307.793920 90.84 176128
+1307.970048 90.84 176128
+1308.146176 90.84 176128
+1308.322304 90.84 176128
+1308.498432 90.84 176128
+1308.674560 90.84 176128
+1308.850688 90.84 176128
+1309.026816 90.84 176128
+1309.203968 90.32 177152
+1309.381120 90.32 177152
+1309.558272 90.32 177152
+1309.735424 90.32 177152
+1309.912576 90.32 177152
+1310.089728 90.32 177152
+1310.266880 90.32 177152
+1310.444032 90.32 177152
+1310.622208 89.80 178176
+1310.800384 89.80 178176
+1310.978560 89.80 178176
+1311.156736 89.80 178176
+1311.334912 89.80 178176
+1311.513088 89.80 178176
+1311.691264 89.80 178176
+1311.869440 89.80 178176
+1312.047616 89.80 178176
+1312.225792 89.80 178176
+1312.403968 89.80 178176
+1312.582144 89.80 178176
+1312.760320 89.80 178176
+1312.938496 89.80 178176
+1313.116672 89.80 178176
+1313.294848 89.80 178176
+1313.474048 89.29 179200
+1313.653248 89.29 179200
+1313.832448 89.29 179200
+1314.011648 89.29 179200
+1314.190848 89.29 179200
+1314.370048 89.29 179200
+1314.549248 89.29 179200
+1314.728448 89.29 179200
+1314.908672 88.78 180224
+1315.088896 88.78 180224
+1315.269120 88.78 180224
+1315.449344 88.78 180224
+1315.629568 88.78 180224
+1315.809792 88.78 180224
+1315.990016 88.78 180224
+1316.170240 88.78 180224
+1316.350464 88.78 180224
+1316.530688 88.78 180224
+1316.710912 88.78 180224
+1316.891136 88.78 180224
+1317.072384 88.28 181248
+1317.253632 88.28 181248
+1317.434880 88.28 181248
+1317.616128 88.28 181248
+1317.797376 88.28 181248
+1317.978624 88.28 181248
+1318.159872 88.28 181248
+1318.341120 88.28 181248
+1318.523392 87.78 182272
+1318.705664 87.78 182272
+1318.887936 87.78 182272
+1319.070208 87.78 182272
+1319.252480 87.78 182272
+1319.434752 87.78 182272
+1319.617024 87.78 182272
+1319.799296 87.78 182272
+1319.982592 87.29 183296
+1320.165888 87.29 183296
+1320.349184 87.29 183296
+1320.532480 87.29 183296
+1320.715776 87.29 183296
+1320.899072 87.29 183296
+1321.082368 87.29 183296
+1321.265664 87.29 183296
+1321.449984 86.81 184320
+1321.634304 86.81 184320
+1321.818624 86.81 184320
+1322.002944 86.81 184320
+1322.187264 86.81 184320
+1322.371584 86.81 184320
+1322.555904 86.81 184320
+1322.740224 86.81 184320
+1322.925568 86.33 185344
+1323.110912 86.33 185344
+1323.296256 86.33 185344
+1323.481600 86.33 185344
+1323.666944 86.33 185344
+1323.852288 86.33 185344
+1324.037632 86.33 185344
+1324.222976 86.33 185344
+1324.409344 85.85 186368
+1324.595712 85.85 186368
+1324.782080 85.85 186368
+1324.968448 85.85 186368
+1325.154816 85.85 186368
+1325.341184 85.85 186368
+1325.527552 85.85 186368
+1325.713920 85.85 186368
+1325.901312 85.38 187392
+1326.088704 85.38 187392
+1326.276096 85.38 187392
+1326.463488 85.38 187392
+1326.650880 85.38 187392
+1326.838272 85.38 187392
+1327.025664 85.38 187392
+1327.213056 85.38 187392
+1327.401472 84.92 188416
+1327.589888 84.92 188416
+1327.778304 84.92 188416
+1327.966720 84.92 188416
+1328.155136 84.92 188416
+1328.343552 84.92 188416
+1328.531968 84.92 188416
+1328.720384 84.92 188416
+1328.909824 84.46 189440
+1329.099264 84.46 189440
+1329.288704 84.46 189440
+1329.478144 84.46 189440
+1329.667584 84.46 189440
+1329.857024 84.46 189440
+1330.046464 84.46 189440
+1330.235904 84.46 189440
+1330.426368 84.01 190464
+1330.616832 84.01 190464
+1330.807296 84.01 190464
+1330.997760 84.01 190464
+1331.188224 84.01 190464
+1331.378688 84.01 190464
+1331.569152 84.01 190464
+1331.759616 84.01 190464
+1331.951104 83.56 191488
+1332.142592 83.56 191488
+1332.334080 83.56 191488
+1332.525568 83.56 191488
+1332.718080 83.11 192512
+1332.910592 83.11 192512
+1333.103104 83.11 192512
+1333.295616 83.11 192512
+1333.488128 83.11 192512
+1333.680640 83.11 192512
+1333.873152 83.11 192512
+1334.065664 83.11 192512
+1334.259200 82.67 193536
+1334.452736 82.67 193536
+1334.646272 82.67 193536
+1334.839808 82.67 193536
+1335.033344 82.67 193536
+1335.226880 82.67 193536
+1335.420416 82.67 193536
+1335.613952 82.67 193536
+1335.808512 82.24 194560
+1336.003072 82.24 194560
+1336.197632 82.24 194560
+1336.392192 82.24 194560
+1336.586752 82.24 194560
+1336.781312 82.24 194560
+1336.975872 82.24 194560
+1337.170432 82.24 194560
+1337.366016 81.81 195584
+1337.561600 81.81 195584
+1337.757184 81.81 195584
+1337.952768 81.81 195584
+1338.148352 81.81 195584
+1338.343936 81.81 195584
+1338.539520 81.81 195584
+1338.735104 81.81 195584
+1338.931712 81.38 196608
+1339.128320 81.38 196608
+1339.324928 81.38 196608
+1339.521536 81.38 196608
+1339.718144 81.38 196608
+1339.914752 81.38 196608
+1340.111360 81.38 196608
+1340.307968 81.38 196608
+1340.505600 80.96 197632
+1340.703232 80.96 197632
+1340.900864 80.96 197632
+1341.098496 80.96 197632
+1341.297152 80.54 198656
+1341.495808 80.54 198656
+1341.694464 80.54 198656
+1341.893120 80.54 198656
+1342.091776 80.54 198656
+1342.290432 80.54 198656
+1342.489088 80.54 198656
+1342.687744 80.54 198656
+1342.888448 79.72 200704
+1343.089152 79.72 200704
+1343.289856 79.72 200704
+1343.490560 79.72 200704
+1343.691264 79.72 200704
+1343.891968 79.72 200704
+1344.092672 79.72 200704
+1344.293376 79.72 200704
+1344.495104 79.31 201728
+1344.696832 79.31 201728
+1344.898560 79.31 201728
+1345.100288 79.31 201728
+1345.302016 79.31 201728
+1345.503744 79.31 201728
+1345.705472 79.31 201728
+1345.907200 79.31 201728
+1346.109952 78.91 202752
+1346.312704 78.91 202752
+1346.515456 78.91 202752
+1346.718208 78.91 202752
+1346.921984 78.52 203776
+1347.125760 78.52 203776
+1347.329536 78.52 203776
+1347.533312 78.52 203776
+1347.737088 78.52 203776
+1347.940864 78.52 203776
+1348.144640 78.52 203776
+1348.348416 78.52 203776
+1348.553216 78.12 204800
+1348.758016 78.12 204800
+1348.962816 78.12 204800
+1349.167616 78.12 204800
+1349.372416 78.12 204800
+1349.577216 78.12 204800
+1349.782016 78.12 204800
+1349.986816 78.12 204800
+1350.192640 77.74 205824
+1350.398464 77.74 205824
+1350.604288 77.74 205824
+1350.810112 77.74 205824
+1351.016960 77.35 206848
+1351.223808 77.35 206848
+1351.430656 77.35 206848
+1351.637504 77.35 206848
+1351.844352 77.35 206848
+1352.051200 77.35 206848
+1352.258048 77.35 206848
+1352.464896 77.35 206848
+1352.672768 76.97 207872
+1352.880640 76.97 207872
+1353.088512 76.97 207872
+1353.296384 76.97 207872
+1353.505280 76.59 208896
+1353.714176 76.59 208896
+1353.923072 76.59 208896
+1354.131968 76.59 208896
+1354.340864 76.59 208896
+1354.549760 76.59 208896
+1354.758656 76.59 208896
+1354.967552 76.59 208896
+1355.177472 76.22 209920
+1355.387392 76.22 209920
+1355.597312 76.22 209920
+1355.807232 76.22 209920
+1356.017152 76.22 209920
+1356.227072 76.22 209920
+1356.436992 76.22 209920
+1356.646912 76.22 209920
+1356.857856 75.85 210944
+1357.068800 75.85 210944
+1357.279744 75.85 210944
+1357.490688 75.85 210944
+1357.703680 75.12 212992
+1357.916672 75.12 212992
+1358.129664 75.12 212992
+1358.342656 75.12 212992
+1358.555648 75.12 212992
+1358.768640 75.12 212992
+1358.981632 75.12 212992
+1359.194624 75.12 212992
+1359.408640 74.76 214016
+1359.622656 74.76 214016
+1359.836672 74.76 214016
+1360.050688 74.76 214016
+1360.265728 74.40 215040
+1360.480768 74.40 215040
+1360.695808 74.40 215040
+1360.910848 74.40 215040
+1361.125888 74.40 215040
+1361.340928 74.40 215040
+1361.555968 74.40 215040
+1361.771008 74.40 215040
+1361.987072 74.05 216064
+1362.203136 74.05 216064
+1362.419200 74.05 216064
+1362.635264 74.05 216064
+1362.852352 73.70 217088
+1363.069440 73.70 217088
+1363.286528 73.70 217088
+1363.503616 73.70 217088
+1363.720704 73.70 217088
+1363.937792 73.70 217088
+1364.154880 73.70 217088
+1364.371968 73.70 217088
+1364.590080 73.36 218112
+1364.808192 73.36 218112
+1365.026304 73.36 218112
+1365.244416 73.36 218112
+1365.463552 73.01 219136
+1365.682688 73.01 219136
+1365.901824 73.01 219136
+1366.120960 73.01 219136
+1366.340096 73.01 219136
+1366.559232 73.01 219136
+1366.778368 73.01 219136
+1366.997504 73.01 219136
+1367.218688 72.34 221184
+1367.439872 72.34 221184
+1367.661056 72.34 221184
+1367.882240 72.34 221184
+1368.104448 72.00 222208
+1368.326656 72.00 222208
+1368.548864 72.00 222208
+1368.771072 72.00 222208
+1368.994304 71.67 223232
+1369.217536 71.67 223232
+1369.440768 71.67 223232
+1369.664000 71.67 223232
+1369.887232 71.67 223232
+1370.110464 71.67 223232
+1370.333696 71.67 223232
+1370.556928 71.67 223232
+1370.781184 71.35 224256
+1371.005440 71.35 224256
+1371.229696 71.35 224256
+1371.453952 71.35 224256
+1371.678208 71.35 224256
+1371.902464 71.35 224256
+1372.127744 71.02 225280
+1372.353024 71.02 225280
+1372.578304 71.02 225280
+1372.803584 71.02 225280
+1373.029888 70.70 226304
+1373.256192 70.70 226304
+1373.482496 70.70 226304
+1373.708800 70.70 226304
+1373.935104 70.70 226304
+1374.161408 70.70 226304
+1374.389760 70.07 228352
+1374.618112 70.07 228352
+1374.846464 70.07 228352
+1375.074816 70.07 228352
+1375.303168 70.07 228352
+1375.531520 70.07 228352
+1375.760896 69.75 229376
+1375.990272 69.75 229376
+1376.219648 69.75 229376
+1376.449024 69.75 229376
+1376.679424 69.44 230400
+1376.909824 69.44 230400
+1377.140224 69.44 230400
+1377.370624 69.44 230400
+1377.601024 69.44 230400
+1377.831424 69.44 230400
+1378.062848 69.14 231424
+1378.294272 69.14 231424
+1378.525696 69.14 231424
+1378.757120 69.14 231424
+1378.990592 68.53 233472
+1379.224064 68.53 233472
+1379.457536 68.53 233472
+1379.691008 68.53 233472
+1379.924480 68.53 233472
+1380.157952 68.53 233472
+1380.392448 68.23 234496
+1380.626944 68.23 234496
+1380.861440 68.23 234496
+1381.095936 68.23 234496
+1381.330432 68.23 234496
+1381.564928 68.23 234496
+1381.800448 67.93 235520
+1382.035968 67.93 235520
+1382.271488 67.93 235520
+1382.507008 67.93 235520
+1382.743552 67.64 236544
+1382.980096 67.64 236544
+1383.216640 67.64 236544
+1383.453184 67.64 236544
+1383.689728 67.64 236544
+1383.926272 67.64 236544
+1384.164864 67.06 238592
+1384.403456 67.06 238592
+1384.642048 67.06 238592
+1384.880640 67.06 238592
+1385.120256 66.77 239616
+1385.359872 66.77 239616
+1385.599488 66.77 239616
+1385.839104 66.77 239616
+1386.079744 66.49 240640
+1386.320384 66.49 240640
+1386.561024 66.49 240640
+1386.801664 66.49 240640
+1387.042304 66.49 240640
+1387.282944 66.49 240640
+1387.524608 66.21 241664
+1387.766272 66.21 241664
+1388.007936 66.21 241664
+1388.249600 66.21 241664
+1388.493312 65.65 243712
+1388.737024 65.65 243712
+1388.980736 65.65 243712
+1389.224448 65.65 243712
+1389.468160 65.65 243712
+1389.711872 65.65 243712
+1389.956608 65.38 244736
+1390.201344 65.38 244736
+1390.446080 65.38 244736
+1390.690816 65.38 244736
+1390.936576 65.10 245760
+1391.182336 65.10 245760
+1391.428096 65.10 245760
+1391.673856 65.10 245760
+1391.921664 64.57 247808
+1392.169472 64.57 247808
+1392.417280 64.57 247808
+1392.665088 64.57 247808
+1392.913920 64.30 248832
+1393.162752 64.30 248832
+1393.411584 64.30 248832
+1393.660416 64.30 248832
+1393.909248 64.30 248832
+1394.158080 64.30 248832
+1394.407936 64.04 249856
+1394.657792 64.04 249856
+1394.907648 64.04 249856
+1395.157504 64.04 249856
+1395.409408 63.52 251904
+1395.661312 63.52 251904
+1395.913216 63.52 251904
+1396.165120 63.52 251904
+1396.418048 63.26 252928
+1396.670976 63.26 252928
+1396.923904 63.26 252928
+1397.176832 63.26 252928
+1397.430784 63.00 253952
+1397.684736 63.00 253952
+1397.938688 63.00 253952
+1398.192640 63.00 253952
+1398.448640 62.50 256000
+1398.704640 62.50 256000
+1398.960640 62.50 256000
+1399.216640 62.50 256000
+1399.472640 62.50 256000
+1399.728640 62.50 256000
+1399.985664 62.25 257024
+1400.242688 62.25 257024
+1400.499712 62.25 257024
+1400.756736 62.25 257024
+1401.014784 62.00 258048
+1401.272832 62.00 258048
+1401.530880 62.00 258048
+1401.788928 62.00 258048
+1402.049024 61.52 260096
+1402.309120 61.52 260096
+1402.569216 61.52 260096
+1402.829312 61.52 260096
+1403.090432 61.27 261120
+1403.351552 61.27 261120
+1403.612672 61.27 261120
+1403.873792 61.27 261120
+1404.135936 61.04 262144
+1404.398080 61.04 262144
+1404.660224 61.04 262144
+1404.922368 61.04 262144
+1405.186560 60.56 264192
+1405.450752 60.56 264192
+1405.714944 60.56 264192
+1405.979136 60.56 264192
+1406.243328 60.56 264192
+1406.507520 60.56 264192
+1406.771712 60.56 264192
+1407.035904 60.56 264192
+1407.302144 60.10 266240
+1407.568384 60.10 266240
+1407.834624 60.10 266240
+1408.100864 60.10 266240
+1408.369152 59.64 268288
+1408.637440 59.64 268288
+1408.905728 59.64 268288
+1409.174016 59.64 268288
+1409.444352 59.19 270336
+1409.714688 59.19 270336
+1409.985024 59.19 270336
+1410.255360 59.19 270336
+1410.525696 59.19 270336
+1410.796032 59.19 270336
+1411.068416 58.74 272384
+1411.340800 58.74 272384
+1411.613184 58.74 272384
+1411.885568 58.74 272384
+1412.160000 58.30 274432
+1412.434432 58.30 274432
+1412.708864 58.30 274432
+1412.983296 58.30 274432
+1413.259776 57.87 276480
+1413.536256 57.87 276480
+1413.812736 57.87 276480
+1414.089216 57.87 276480
+1414.365696 57.87 276480
+1414.642176 57.87 276480
+1414.918656 57.87 276480
+1415.195136 57.87 276480
+1415.473664 57.44 278528
+1415.752192 57.44 278528
+1416.030720 57.44 278528
+1416.309248 57.44 278528
+1416.589824 57.03 280576
+1416.870400 57.03 280576
+1417.150976 57.03 280576
+1417.431552 57.03 280576
+1417.712128 57.03 280576
+1417.992704 57.03 280576
+1418.275328 56.61 282624
+1418.557952 56.61 282624
+1418.840576 56.61 282624
+1419.123200 56.61 282624
+1419.407872 56.21 284672
+1419.692544 56.21 284672
+1419.977216 56.21 284672
+1420.261888 56.21 284672
+1420.548608 55.80 286720
+1420.835328 55.80 286720
+1421.122048 55.80 286720
+1421.408768 55.80 286720
+1421.695488 55.80 286720
+1421.982208 55.80 286720
+1422.270976 55.41 288768
+1422.559744 55.41 288768
+1422.848512 55.41 288768
+1423.137280 55.41 288768
+1423.428096 55.02 290816
+1423.718912 55.02 290816
+1424.011776 54.63 292864
+1424.304640 54.63 292864
+1424.597504 54.63 292864
+1424.890368 54.63 292864
+1425.185280 54.25 294912
+1425.480192 54.25 294912
+1425.775104 54.25 294912
+1426.070016 54.25 294912
+1426.364928 54.25 294912
+1426.659840 54.25 294912
+1426.956800 53.88 296960
+1427.253760 53.88 296960
+1427.550720 53.88 296960
+1427.847680 53.88 296960
+1428.146688 53.51 299008
+1428.445696 53.51 299008
+1428.746752 53.15 301056
+1429.047808 53.15 301056
+1429.348864 53.15 301056
+1429.649920 53.15 301056
+1429.950976 53.15 301056
+1430.252032 53.15 301056
+1430.555136 52.79 303104
+1430.858240 52.79 303104
+1431.161344 52.79 303104
+1431.464448 52.79 303104
+1431.769600 52.43 305152
+1432.074752 52.43 305152
+1432.381952 52.08 307200
+1432.689152 52.08 307200
+1432.996352 52.08 307200
+1433.303552 52.08 307200
+1433.612800 51.74 309248
+1433.922048 51.74 309248
+1434.233344 51.40 311296
+1434.544640 51.40 311296
+1434.855936 51.40 311296
+1435.167232 51.40 311296
+1435.478528 51.40 311296
+1435.789824 51.40 311296
+1436.103168 51.06 313344
+1436.416512 51.06 313344
+1436.731904 50.73 315392
+1437.047296 50.73 315392
+1437.362688 50.73 315392
+1437.678080 50.73 315392
+1437.995520 50.40 317440
+1438.312960 50.40 317440
+1438.630400 50.40 317440
+1438.949888 50.08 319488
+1439.269376 50.08 319488
+1439.590912 49.76 321536
+1439.912448 49.76 321536
+1440.233984 49.76 321536
+1440.555520 49.76 321536
+1440.877056 49.76 321536
+1441.198592 49.76 321536
+1441.522176 49.45 323584
+1441.845760 49.45 323584
+1442.171392 49.14 325632
+1442.497024 49.14 325632
+1442.822656 49.14 325632
+1443.150336 48.83 327680
+1443.478016 48.83 327680
+1443.807744 48.52 329728
+1444.137472 48.52 329728
+1444.467200 48.52 329728
+1444.798976 48.23 331776
+1445.130752 48.23 331776
+1445.462528 48.23 331776
+1445.796352 47.93 333824
+1446.130176 47.93 333824
+1446.464000 47.93 333824
+1446.797824 47.93 333824
+1447.131648 47.93 333824
+1447.467520 47.64 335872
+1447.803392 47.64 335872
+1448.141312 47.35 337920
+1448.479232 47.35 337920
+1448.819200 47.06 339968
+1449.159168 47.06 339968
+1449.499136 47.06 339968
+1449.841152 46.78 342016
+1450.183168 46.78 342016
+1450.527232 46.50 344064
+1450.871296 46.50 344064
+1451.215360 46.50 344064
+1451.561472 46.23 346112
+1451.907584 46.23 346112
+1452.255744 45.96 348160
+1452.603904 45.96 348160
+1452.954112 45.69 350208
+1453.304320 45.69 350208
+1453.656576 45.42 352256
+1454.008832 45.42 352256
+1454.361088 45.42 352256
+1454.715392 45.16 354304
+1455.069696 45.16 354304
+1455.426048 44.90 356352
+1455.782400 44.90 356352
+1456.138752 44.90 356352
+1456.495104 44.90 356352
+1456.853504 44.64 358400
+1457.211904 44.64 358400
+1457.572352 44.39 360448
+1457.932800 44.39 360448
+1458.293248 44.39 360448
+1458.655744 44.14 362496
+1459.018240 44.14 362496
+1459.382784 43.89 364544
+1459.747328 43.89 364544
+1460.113920 43.65 366592
+1460.480512 43.65 366592
+1460.849152 43.40 368640
+1461.217792 43.40 368640
+1461.588480 43.16 370688
+1461.959168 43.16 370688
+1462.331904 42.93 372736
+1462.704640 42.93 372736
+1463.079424 42.69 374784
+1463.454208 42.69 374784
+1463.831040 42.46 376832
+1464.207872 42.46 376832
+1464.586752 42.23 378880
+1464.965632 42.23 378880
+1465.346560 42.00 380928
+1465.727488 42.00 380928
+1466.110464 41.78 382976
+1466.495488 41.56 385024
+1466.880512 41.56 385024
+1467.267584 41.34 387072
+1467.654656 41.34 387072
+1468.043776 41.12 389120
+1468.432896 41.12 389120
+1468.824064 40.90 391168
+1469.215232 40.90 391168
+1469.608448 40.69 393216
+1470.001664 40.69 393216
+1470.396928 40.48 395264
+1470.794240 40.27 397312
+1471.191552 40.27 397312
+1471.592960 39.86 401408
+1471.994368 39.86 401408
+1472.397824 39.66 403456
+1472.801280 39.66 403456
+1473.206784 39.46 405504
+1473.614336 39.26 407552
+1474.021888 39.26 407552
+1474.431488 39.06 409600
+1474.841088 39.06 409600
+1475.252736 38.87 411648
+1475.666432 38.68 413696
+1476.080128 38.68 413696
+1476.495872 38.49 415744
+1476.913664 38.30 417792
+1477.331456 38.30 417792
+1477.751296 38.11 419840
+1478.171136 38.11 419840
+1478.593024 37.92 421888
+1479.019008 37.56 425984
+1479.444992 37.56 425984
+1479.873024 37.38 428032
+1480.303104 37.20 430080
+1480.733184 37.20 430080
+1481.165312 37.03 432128
+1481.599488 36.85 434176
+1482.033664 36.85 434176
+1482.469888 36.68 436224
+1482.908160 36.51 438272
+1483.346432 36.51 438272
+1483.788800 36.17 442368
+1484.233216 36.00 444416
+1484.679680 35.84 446464
+1485.126144 35.84 446464
+1485.574656 35.67 448512
+1486.025216 35.51 450560
+1486.477824 35.35 452608
+1486.930432 35.35 452608
+1487.387136 35.03 456704
+1487.845888 34.88 458752
+1488.306688 34.72 460800
+1488.767488 34.72 460800
+1489.230336 34.57 462848
+1489.697280 34.27 466944
+1490.166272 34.12 468992
+1490.635264 34.12 468992
+1491.106304 33.97 471040
+1491.579392 33.82 473088
+1492.056576 33.53 477184
+1492.535808 33.39 479232
+1493.017088 33.24 481280
+1493.498368 33.24 481280
+1493.981696 33.10 483328
+1494.469120 32.83 487424
+1494.958592 32.69 489472
+1495.450112 32.55 491520
+1495.945728 32.28 495616
+1496.443392 32.15 497664
+1496.941056 32.15 497664
+1497.440768 32.02 499712
+1497.944576 31.76 503808
+1498.450432 31.63 505856
+1498.958336 31.50 507904
+1499.470336 31.25 512000
+1499.984384 31.13 514048
+1500.500480 31.00 516096
+1501.020672 30.76 520192
+1501.542912 30.64 522240
+1502.067200 30.52 524288
+1502.595584 30.28 528384
+1503.123968 30.28 528384
+1503.656448 30.05 532480
+1504.193024 29.82 536576
+1504.733696 29.59 540672
+1505.274368 29.59 540672
+1505.819136 29.37 544768
+1506.368000 29.15 548864
+1506.920960 28.94 552960
+1507.473920 28.94 552960
+1508.030976 28.72 557056
+1508.592128 28.51 561152
+1509.157376 28.31 565248
+1509.726720 28.10 569344
+1510.300160 27.90 573440
+1510.873600 27.90 573440
+1511.451136 27.70 577536
+1512.036864 27.32 585728
+1512.626688 27.13 589824
+1513.216512 27.13 589824
+1513.810432 26.94 593920
+1514.412544 26.57 602112
+1515.014656 26.57 602112
+1515.620864 26.39 606208
+1516.235264 26.04 614400
+1516.853760 25.87 618496
+1517.476352 25.70 622592
+1518.103040 25.53 626688
+1518.733824 25.37 630784
+1519.372800 25.04 638976
+1520.015872 24.88 643072
+1520.663040 24.72 647168
+1521.314304 24.57 651264
+1521.973760 24.26 659456
+1522.637312 24.11 663552
+1523.304960 23.96 667648
+1523.980800 23.67 675840
+1524.660736 23.53 679936
+1525.348864 23.25 688128
+1526.045184 22.98 696320
+1526.749696 22.71 704512
+1527.458304 22.58 708608
+1528.171008 22.45 712704
+1528.891904 22.19 720896
+1529.620992 21.95 729088
+1530.358272 21.70 737280
+1531.103744 21.46 745472
+1531.857408 21.23 753664
+1532.619264 21.00 761856
+1533.389312 20.78 770048
+1534.167552 20.56 778240
+1534.953984 20.35 786432
+1535.756800 19.93 802816
+1536.567808 19.73 811008
+1537.387008 19.53 819200
+1538.218496 19.24 831488
+1539.058176 19.05 839680
+1539.914240 18.69 856064
+1540.782592 18.43 868352
+1541.659136 18.25 876544
+1542.552064 17.92 892928
+1543.457280 17.68 905216
+1544.378880 17.36 921600
+1545.316864 17.06 937984
+1546.275328 16.69 958464
+1547.250176 16.41 974848
+1548.245504 16.08 995328
+1549.257216 15.81 1011712
+1550.289408 15.50 1032192
+1551.346176 15.14 1056768
+1552.427520 14.80 1081344
+1553.533440 14.47 1105920
+1554.663936 14.15 1130496
+1555.819008 13.85 1155072
+1557.006848 13.47 1187840
+1558.235648 13.02 1228800
+1559.497216 12.68 1261568
+1560.799744 12.28 1302528
+1562.151424 11.84 1351680
+1563.560448 11.36 1409024
+1565.018624 10.97 1458176
+1566.542336 10.50 1523712
+1568.147968 9.96 1605632
+1569.827328 9.53 1679360
+1571.613184 8.96 1785856
+1573.530112 8.35 1916928
+1575.594496 7.75 2064384
+1577.855488 7.08 2260992
+1580.378624 6.34 2523136
+1583.294976 5.49 2916352
+1586.866688 4.48 3571712
+1591.912960 3.17 5046272
+1599.056384 2.24 7143424
+EOF
+plot $data using 1:2 with linespoints
+pause -1
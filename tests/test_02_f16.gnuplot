@@ -0,0 +1,14494 @@
+$data <<EOF
+5.046272 3.17 5046272
+8.617984 4.48 3571712
+11.534336 5.49 2916352
+14.057472 6.34 2523136
+16.318464 7.08 2260992
+18.382848 7.75 2064384
+20.299776 8.35 1916928
+22.085632 8.96 1785856
+23.764992 9.53 1679360
+25.370624 9.96 1605632
+26.894336 10.50 1523712
+28.352512 10.97 1458176
+29.761536 11.36 1409024
+31.113216 11.84 1351680
+32.415744 12.28 1302528
+33.677312 12.68 1261568
+34.906112 13.02 1228800
+36.093952 13.47 1187840
+37.249024 13.85 1155072
+38.379520 14.15 1130496
+39.485440 14.47 1105920
+40.566784 14.80 1081344
+41.623552 15.14 1056768
+42.655744 15.50 1032192
+43.667456 15.81 1011712
+44.662784 16.08 995328
+45.637632 16.41 974848
+46.596096 16.69 958464
+47.534080 17.06 937984
+48.455680 17.36 921600
+49.360896 17.68 905216
+50.253824 17.92 892928
+51.130368 18.25 876544
+51.998720 18.43 868352
+52.854784 18.69 856064
+53.694464 19.05 839680
+54.525952 19.24 831488
+55.345152 19.53 819200
+56.156160 19.73 811008
+56.958976 19.93 802816
+57.745408 20.35 786432
+58.523648 20.56 778240
+59.293696 20.78 770048
+60.055552 21.00 761856
+60.809216 21.23 753664
+61.554688 21.46 745472
+62.291968 21.70 737280
+63.021056 21.95 729088
+63.741952 22.19 720896
+64.454656 22.45 712704
+65.163264 22.58 708608
+65.867776 22.71 704512
+66.564096 22.98 696320
+67.252224 23.25 688128
+67.932160 23.53 679936
+68.608000 23.67 675840
+69.275648 23.96 667648
+69.939200 24.11 663552
+70.598656 24.26 659456
+71.249920 24.57 651264
+71.897088 24.72 647168
+72.540160 24.88 643072
+73.179136 25.04 638976
+73.809920 25.37 630784
+74.436608 25.53 626688
+75.059200 25.70 622592
+75.677696 25.87 618496
+76.292096 26.04 614400
+76.898304 26.39 606208
+77.500416 26.57 602112
+78.102528 26.57 602112
+78.696448 26.94 593920
+79.286272 27.13 589824
+79.876096 27.13 589824
+80.461824 27.32 585728
+81.039360 27.70 577536
+81.612800 27.90 573440
+82.186240 27.90 573440
+82.755584 28.10 569344
+83.320832 28.31 565248
+83.881984 28.51 561152
+84.439040 28.72 557056
+84.992000 28.94 552960
+85.544960 28.94 552960
+86.093824 29.15 548864
+86.638592 29.37 544768
+87.179264 29.59 540672
+87.719936 29.59 540672
+88.256512 29.82 536576
+88.788992 30.05 532480
+89.317376 30.28 528384
+89.845760 30.28 528384
+90.370048 30.52 524288
+90.892288 30.64 522240
+91.412480 30.76 520192
+91.928576 31.00 516096
+92.442624 31.13 514048
+92.954624 31.25 512000
+93.462528 31.50 507904
+93.968384 31.63 505856
+94.472192 31.76 503808
+94.971904 32.02 499712
+95.469568 32.15 497664
+95.967232 32.15 497664
+96.462848 32.28 495616
+96.954368 32.55 491520
+97.443840 32.69 489472
+97.931264 32.83 487424
+98.414592 33.10 483328
+98.895872 33.24 481280
+99.377152 33.24 481280
+99.856384 33.39 479232
+100.333568 33.53 477184
+100.806656 33.82 473088
+101.277696 33.97 471040
+101.746688 34.12 468992
+102.215680 34.12 468992
+102.682624 34.27 466944
+103.145472 34.57 462848
+103.606272 34.72 460800
+104.067072 34.72 460800
+104.525824 34.88 458752
+104.982528 35.03 456704
+105.435136 35.35 452608
+105.887744 35.35 452608
+106.338304 35.51 450560
+106.786816 35.67 448512
+107.233280 35.84 446464
+107.679744 35.84 446464
+108.124160 36.00 444416
+108.566528 36.17 442368
+109.004800 36.51 438272
+109.443072 36.51 438272
+109.879296 36.68 436224
+110.313472 36.85 434176
+110.747648 36.85 434176
+111.179776 37.03 432128
+111.609856 37.20 430080
+112.039936 37.20 430080
+112.467968 37.38 428032
+112.893952 37.56 425984
+113.319936 37.56 425984
+113.741824 37.92 421888
+114.161664 38.11 419840
+114.581504 38.11 419840
+114.999296 38.30 417792
+115.417088 38.30 417792
+115.832832 38.49 415744
+116.246528 38.68 413696
+116.660224 38.68 413696
+117.071872 38.87 411648
+117.481472 39.06 409600
+117.891072 39.06 409600
+118.298624 39.26 407552
+118.706176 39.26 407552
+119.111680 39.46 405504
+119.515136 39.66 403456
+119.918592 39.66 403456
+120.320000 39.86 401408
+120.721408 39.86 401408
+121.118720 40.27 397312
+121.516032 40.27 397312
+121.911296 40.48 395264
+122.304512 40.69 393216
+122.697728 40.69 393216
+123.088896 40.90 391168
+123.480064 40.90 391168
+123.869184 41.12 389120
+124.258304 41.12 389120
+124.645376 41.34 387072
+125.032448 41.34 387072
+125.417472 41.56 385024
+125.802496 41.56 385024
+126.185472 41.78 382976
+126.566400 42.00 380928
+126.947328 42.00 380928
+127.326208 42.23 378880
+127.705088 42.23 378880
+128.081920 42.46 376832
+128.458752 42.46 376832
+128.833536 42.69 374784
+129.208320 42.69 374784
+129.581056 42.93 372736
+129.953792 42.93 372736
+130.324480 43.16 370688
+130.695168 43.16 370688
+131.063808 43.40 368640
+131.432448 43.40 368640
+131.799040 43.65 366592
+132.165632 43.65 366592
+132.530176 43.89 364544
+132.894720 43.89 364544
+133.257216 44.14 362496
+133.619712 44.14 362496
+133.980160 44.39 360448
+134.340608 44.39 360448
+134.701056 44.39 360448
+135.059456 44.64 358400
+135.417856 44.64 358400
+135.774208 44.90 356352
+136.130560 44.90 356352
+136.486912 44.90 356352
+136.843264 44.90 356352
+137.197568 45.16 354304
+137.551872 45.16 354304
+137.904128 45.42 352256
+138.256384 45.42 352256
+138.608640 45.42 352256
+138.958848 45.69 350208
+139.309056 45.69 350208
+139.657216 45.96 348160
+140.005376 45.96 348160
+140.351488 46.23 346112
+140.697600 46.23 346112
+141.041664 46.50 344064
+141.385728 46.50 344064
+141.729792 46.50 344064
+142.071808 46.78 342016
+142.413824 46.78 342016
+142.753792 47.06 339968
+143.093760 47.06 339968
+143.433728 47.06 339968
+143.771648 47.35 337920
+144.109568 47.35 337920
+144.445440 47.64 335872
+144.781312 47.64 335872
+145.115136 47.93 333824
+145.448960 47.93 333824
+145.782784 47.93 333824
+146.116608 47.93 333824
+146.450432 47.93 333824
+146.782208 48.23 331776
+147.113984 48.23 331776
+147.445760 48.23 331776
+147.775488 48.52 329728
+148.105216 48.52 329728
+148.434944 48.52 329728
+148.762624 48.83 327680
+149.090304 48.83 327680
+149.415936 49.14 325632
+149.741568 49.14 325632
+150.067200 49.14 325632
+150.390784 49.45 323584
+150.714368 49.45 323584
+151.035904 49.76 321536
+151.357440 49.76 321536
+151.678976 49.76 321536
+152.000512 49.76 321536
+152.322048 49.76 321536
+152.643584 49.76 321536
+152.963072 50.08 319488
+153.282560 50.08 319488
+153.600000 50.40 317440
+153.917440 50.40 317440
+154.234880 50.40 317440
+154.550272 50.73 315392
+154.865664 50.73 315392
+155.181056 50.73 315392
+155.496448 50.73 315392
+155.809792 51.06 313344
+156.123136 51.06 313344
+156.434432 51.40 311296
+156.745728 51.40 311296
+157.057024 51.40 311296
+157.368320 51.40 311296
+157.679616 51.40 311296
+157.990912 51.40 311296
+158.300160 51.74 309248
+158.609408 51.74 309248
+158.916608 52.08 307200
+159.223808 52.08 307200
+159.531008 52.08 307200
+159.838208 52.08 307200
+160.143360 52.43 305152
+160.448512 52.43 305152
+160.751616 52.79 303104
+161.054720 52.79 303104
+161.357824 52.79 303104
+161.660928 52.79 303104
+161.961984 53.15 301056
+162.263040 53.15 301056
+162.564096 53.15 301056
+162.865152 53.15 301056
+163.166208 53.15 301056
+163.467264 53.15 301056
+163.766272 53.51 299008
+164.065280 53.51 299008
+164.362240 53.88 296960
+164.659200 53.88 296960
+164.956160 53.88 296960
+165.253120 53.88 296960
+165.548032 54.25 294912
+165.842944 54.25 294912
+166.137856 54.25 294912
+166.432768 54.25 294912
+166.727680 54.25 294912
+167.022592 54.25 294912
+167.315456 54.63 292864
+167.608320 54.63 292864
+167.901184 54.63 292864
+168.194048 54.63 292864
+168.484864 55.02 290816
+168.775680 55.02 290816
+169.064448 55.41 288768
+169.353216 55.41 288768
+169.641984 55.41 288768
+169.930752 55.41 288768
+170.217472 55.80 286720
+170.504192 55.80 286720
+170.790912 55.80 286720
+171.077632 55.80 286720
+171.364352 55.80 286720
+171.651072 55.80 286720
+171.935744 56.21 284672
+172.220416 56.21 284672
+172.505088 56.21 284672
+172.789760 56.21 284672
+173.072384 56.61 282624
+173.355008 56.61 282624
+173.637632 56.61 282624
+173.920256 56.61 282624
+174.200832 57.03 280576
+174.481408 57.03 280576
+174.761984 57.03 280576
+175.042560 57.03 280576
+175.323136 57.03 280576
+175.603712 57.03 280576
+175.882240 57.44 278528
+176.160768 57.44 278528
+176.439296 57.44 278528
+176.717824 57.44 278528
+176.994304 57.87 276480
+177.270784 57.87 276480
+177.547264 57.87 276480
+177.823744 57.87 276480
+178.100224 57.87 276480
+178.376704 57.87 276480
+178.653184 57.87 276480
+178.929664 57.87 276480
+179.204096 58.30 274432
+179.478528 58.30 274432
+179.752960 58.30 274432
+180.027392 58.30 274432
+180.299776 58.74 272384
+180.572160 58.74 272384
+180.844544 58.74 272384
+181.116928 58.74 272384
+181.387264 59.19 270336
+181.657600 59.19 270336
+181.927936 59.19 270336
+182.198272 59.19 270336
+182.468608 59.19 270336
+182.738944 59.19 270336
+183.007232 59.64 268288
+183.275520 59.64 268288
+183.543808 59.64 268288
+183.812096 59.64 268288
+184.078336 60.10 266240
+184.344576 60.10 266240
+184.610816 60.10 266240
+184.877056 60.10 266240
+185.141248 60.56 264192
+185.405440 60.56 264192
+185.669632 60.56 264192
+185.933824 60.56 264192
+186.198016 60.56 264192
+186.462208 60.56 264192
+186.726400 60.56 264192
+186.990592 60.56 264192
+187.252736 61.04 262144
+187.514880 61.04 262144
+187.777024 61.04 262144
+188.039168 61.04 262144
+188.300288 61.27 261120
+188.561408 61.27 261120
+188.822528 61.27 261120
+189.083648 61.27 261120
+189.343744 61.52 260096
+189.603840 61.52 260096
+189.863936 61.52 260096
+190.124032 61.52 260096
+190.382080 62.00 258048
+190.640128 62.00 258048
+190.898176 62.00 258048
+191.156224 62.00 258048
+191.413248 62.25 257024
+191.670272 62.25 257024
+191.927296 62.25 257024
+192.184320 62.25 257024
+192.440320 62.50 256000
+192.696320 62.50 256000
+192.952320 62.50 256000
+193.208320 62.50 256000
+193.464320 62.50 256000
+193.720320 62.50 256000
+193.974272 63.00 253952
+194.228224 63.00 253952
+194.482176 63.00 253952
+194.736128 63.00 253952
+194.989056 63.26 252928
+195.241984 63.26 252928
+195.494912 63.26 252928
+195.747840 63.26 252928
+195.999744 63.52 251904
+196.251648 63.52 251904
+196.503552 63.52 251904
+196.755456 63.52 251904
+197.005312 64.04 249856
+197.255168 64.04 249856
+197.505024 64.04 249856
+197.754880 64.04 249856
+198.003712 64.30 248832
+198.252544 64.30 248832
+198.501376 64.30 248832
+198.750208 64.30 248832
+198.999040 64.30 248832
+199.247872 64.30 248832
+199.495680 64.57 247808
+199.743488 64.57 247808
+199.991296 64.57 247808
+200.239104 64.57 247808
+200.484864 65.10 245760
+200.730624 65.10 245760
+200.976384 65.10 245760
+201.222144 65.10 245760
+201.466880 65.38 244736
+201.711616 65.38 244736
+201.956352 65.38 244736
+202.201088 65.38 244736
+202.444800 65.65 243712
+202.688512 65.65 243712
+202.932224 65.65 243712
+203.175936 65.65 243712
+203.419648 65.65 243712
+203.663360 65.65 243712
+203.905024 66.21 241664
+204.146688 66.21 241664
+204.388352 66.21 241664
+204.630016 66.21 241664
+204.870656 66.49 240640
+205.111296 66.49 240640
+205.351936 66.49 240640
+205.592576 66.49 240640
+205.833216 66.49 240640
+206.073856 66.49 240640
+206.313472 66.77 239616
+206.553088 66.77 239616
+206.792704 66.77 239616
+207.032320 66.77 239616
+207.270912 67.06 238592
+207.509504 67.06 238592
+207.748096 67.06 238592
+207.986688 67.06 238592
+208.223232 67.64 236544
+208.459776 67.64 236544
+208.696320 67.64 236544
+208.932864 67.64 236544
+209.169408 67.64 236544
+209.405952 67.64 236544
+209.641472 67.93 235520
+209.876992 67.93 235520
+210.112512 67.93 235520
+210.348032 67.93 235520
+210.582528 68.23 234496
+210.817024 68.23 234496
+211.051520 68.23 234496
+211.286016 68.23 234496
+211.520512 68.23 234496
+211.755008 68.23 234496
+211.988480 68.53 233472
+212.221952 68.53 233472
+212.455424 68.53 233472
+212.688896 68.53 233472
+212.922368 68.53 233472
+213.155840 68.53 233472
+213.387264 69.14 231424
+213.618688 69.14 231424
+213.850112 69.14 231424
+214.081536 69.14 231424
+214.311936 69.44 230400
+214.542336 69.44 230400
+214.772736 69.44 230400
+215.003136 69.44 230400
+215.233536 69.44 230400
+215.463936 69.44 230400
+215.693312 69.75 229376
+215.922688 69.75 229376
+216.152064 69.75 229376
+216.381440 69.75 229376
+216.609792 70.07 228352
+216.838144 70.07 228352
+217.066496 70.07 228352
+217.294848 70.07 228352
+217.523200 70.07 228352
+217.751552 70.07 228352
+217.977856 70.70 226304
+218.204160 70.70 226304
+218.430464 70.70 226304
+218.656768 70.70 226304
+218.883072 70.70 226304
+219.109376 70.70 226304
+219.334656 71.02 225280
+219.559936 71.02 225280
+219.785216 71.02 225280
+220.010496 71.02 225280
+220.234752 71.35 224256
+220.459008 71.35 224256
+220.683264 71.35 224256
+220.907520 71.35 224256
+221.131776 71.35 224256
+221.356032 71.35 224256
+221.579264 71.67 223232
+221.802496 71.67 223232
+222.025728 71.67 223232
+222.248960 71.67 223232
+222.472192 71.67 223232
+222.695424 71.67 223232
+222.918656 71.67 223232
+223.141888 71.67 223232
+223.364096 72.00 222208
+223.586304 72.00 222208
+223.808512 72.00 222208
+224.030720 72.00 222208
+224.251904 72.34 221184
+224.473088 72.34 221184
+224.694272 72.34 221184
+224.915456 72.34 221184
+225.134592 73.01 219136
+225.353728 73.01 219136
+225.572864 73.01 219136
+225.792000 73.01 219136
+226.011136 73.01 219136
+226.230272 73.01 219136
+226.449408 73.01 219136
+226.668544 73.01 219136
+226.886656 73.36 218112
+227.104768 73.36 218112
+227.322880 73.36 218112
+227.540992 73.36 218112
+227.758080 73.70 217088
+227.975168 73.70 217088
+228.192256 73.70 217088
+228.409344 73.70 217088
+228.626432 73.70 217088
+228.843520 73.70 217088
+229.060608 73.70 217088
+229.277696 73.70 217088
+229.493760 74.05 216064
+229.709824 74.05 216064
+229.925888 74.05 216064
+230.141952 74.05 216064
+230.356992 74.40 215040
+230.572032 74.40 215040
+230.787072 74.40 215040
+231.002112 74.40 215040
+231.217152 74.40 215040
+231.432192 74.40 215040
+231.647232 74.40 215040
+231.862272 74.40 215040
+232.076288 74.76 214016
+232.290304 74.76 214016
+232.504320 74.76 214016
+232.718336 74.76 214016
+232.931328 75.12 212992
+233.144320 75.12 212992
+233.357312 75.12 212992
+233.570304 75.12 212992
+233.783296 75.12 212992
+233.996288 75.12 212992
+234.209280 75.12 212992
+234.422272 75.12 212992
+234.633216 75.85 210944
+234.844160 75.85 210944
+235.055104 75.85 210944
+235.266048 75.85 210944
+235.475968 76.22 209920
+235.685888 76.22 209920
+235.895808 76.22 209920
+236.105728 76.22 209920
+236.315648 76.22 209920
+236.525568 76.22 209920
+236.735488 76.22 209920
+236.945408 76.22 209920
+237.154304 76.59 208896
+237.363200 76.59 208896
+237.572096 76.59 208896
+237.780992 76.59 208896
+237.989888 76.59 208896
+238.198784 76.59 208896
+238.407680 76.59 208896
+238.616576 76.59 208896
+238.824448 76.97 207872
+239.032320 76.97 207872
+239.240192 76.97 207872
+239.448064 76.97 207872
+239.654912 77.35 206848
+239.861760 77.35 206848
+240.068608 77.35 206848
+240.275456 77.35 206848
+240.482304 77.35 206848
+240.689152 77.35 206848
+240.896000 77.35 206848
+241.102848 77.35 206848
+241.308672 77.74 205824
+241.514496 77.74 205824
+241.720320 77.74 205824
+241.926144 77.74 205824
+242.130944 78.12 204800
+242.335744 78.12 204800
+242.540544 78.12 204800
+242.745344 78.12 204800
+242.950144 78.12 204800
+243.154944 78.12 204800
+243.359744 78.12 204800
+243.564544 78.12 204800
+243.768320 78.52 203776
+243.972096 78.52 203776
+244.175872 78.52 203776
+244.379648 78.52 203776
+244.583424 78.52 203776
+244.787200 78.52 203776
+244.990976 78.52 203776
+245.194752 78.52 203776
+245.397504 78.91 202752
+245.600256 78.91 202752
+245.803008 78.91 202752
+246.005760 78.91 202752
+246.207488 79.31 201728
+246.409216 79.31 201728
+246.610944 79.31 201728
+246.812672 79.31 201728
+247.014400 79.31 201728
+247.216128 79.31 201728
+247.417856 79.31 201728
+247.619584 79.31 201728
+247.820288 79.72 200704
+248.020992 79.72 200704
+248.221696 79.72 200704
+248.422400 79.72 200704
+248.623104 79.72 200704
+248.823808 79.72 200704
+249.024512 79.72 200704
+249.225216 79.72 200704
+249.423872 80.54 198656
+249.622528 80.54 198656
+249.821184 80.54 198656
+250.019840 80.54 198656
+250.218496 80.54 198656
+250.417152 80.54 198656
+250.615808 80.54 198656
+250.814464 80.54 198656
+251.012096 80.96 197632
+251.209728 80.96 197632
+251.407360 80.96 197632
+251.604992 80.96 197632
+251.801600 81.38 196608
+251.998208 81.38 196608
+252.194816 81.38 196608
+252.391424 81.38 196608
+252.588032 81.38 196608
+252.784640 81.38 196608
+252.981248 81.38 196608
+253.177856 81.38 196608
+253.373440 81.81 195584
+253.569024 81.81 195584
+253.764608 81.81 195584
+253.960192 81.81 195584
+254.155776 81.81 195584
+254.351360 81.81 195584
+254.546944 81.81 195584
+254.742528 81.81 195584
+254.937088 82.24 194560
+255.131648 82.24 194560
+255.326208 82.24 194560
+255.520768 82.24 194560
+255.715328 82.24 194560
+255.909888 82.24 194560
+256.104448 82.24 194560
+256.299008 82.24 194560
+256.492544 82.67 193536
+256.686080 82.67 193536
+256.879616 82.67 193536
+257.073152 82.67 193536
+257.266688 82.67 193536
+257.460224 82.67 193536
+257.653760 82.67 193536
+257.847296 82.67 193536
+258.039808 83.11 192512
+258.232320 83.11 192512
+258.424832 83.11 192512
+258.617344 83.11 192512
+258.809856 83.11 192512
+259.002368 83.11 192512
+259.194880 83.11 192512
+259.387392 83.11 192512
+259.578880 83.56 191488
+259.770368 83.56 191488
+259.961856 83.56 191488
+260.153344 83.56 191488
+260.343808 84.01 190464
+260.534272 84.01 190464
+260.724736 84.01 190464
+260.915200 84.01 190464
+261.105664 84.01 190464
+261.296128 84.01 190464
+261.486592 84.01 190464
+261.677056 84.01 190464
+261.866496 84.46 189440
+262.055936 84.46 189440
+262.245376 84.46 189440
+262.434816 84.46 189440
+262.624256 84.46 189440
+262.813696 84.46 189440
+263.003136 84.46 189440
+263.192576 84.46 189440
+263.380992 84.92 188416
+263.569408 84.92 188416
+263.757824 84.92 188416
+263.946240 84.92 188416
+264.134656 84.92 188416
+264.323072 84.92 188416
+264.511488 84.92 188416
+264.699904 84.92 188416
+264.887296 85.38 187392
+265.074688 85.38 187392
+265.262080 85.38 187392
+265.449472 85.38 187392
+265.636864 85.38 187392
+265.824256 85.38 187392
+266.011648 85.38 187392
+266.199040 85.38 187392
+266.385408 85.85 186368
+266.571776 85.85 186368
+266.758144 85.85 186368
+266.944512 85.85 186368
+267.130880 85.85 186368
+267.317248 85.85 186368
+267.503616 85.85 186368
+267.689984 85.85 186368
+267.875328 86.33 185344
+268.060672 86.33 185344
+268.246016 86.33 185344
+268.431360 86.33 185344
+268.616704 86.33 185344
+268.802048 86.33 185344
+268.987392 86.33 185344
+269.172736 86.33 185344
+269.357056 86.81 184320
+269.541376 86.81 184320
+269.725696 86.81 184320
+269.910016 86.81 184320
+270.094336 86.81 184320
+270.278656 86.81 184320
+270.462976 86.81 184320
+270.647296 86.81 184320
+270.830592 87.29 183296
+271.013888 87.29 183296
+271.197184 87.29 183296
+271.380480 87.29 183296
+271.563776 87.29 183296
+271.747072 87.29 183296
+271.930368 87.29 183296
+272.113664 87.29 183296
+272.295936 87.78 182272
+272.478208 87.78 182272
+272.660480 87.78 182272
+272.842752 87.78 182272
+273.025024 87.78 182272
+273.207296 87.78 182272
+273.389568 87.78 182272
+273.571840 87.78 182272
+273.753088 88.28 181248
+273.934336 88.28 181248
+274.115584 88.28 181248
+274.296832 88.28 181248
+274.478080 88.28 181248
+274.659328 88.28 181248
+274.840576 88.28 181248
+275.021824 88.28 181248
+275.202048 88.78 180224
+275.382272 88.78 180224
+275.562496 88.78 180224
+275.742720 88.78 180224
+275.922944 88.78 180224
+276.103168 88.78 180224
+276.283392 88.78 180224
+276.463616 88.78 180224
+276.643840 88.78 180224
+276.824064 88.78 180224
+277.004288 88.78 180224
+277.184512 88.78 180224
+277.363712 89.29 179200
+277.542912 89.29 179200
+277.722112 89.29 179200
+277.901312 89.29 179200
+278.080512 89.29 179200
+278.259712 89.29 179200
+278.438912 89.29 179200
+278.618112 89.29 179200
+278.796288 89.80 178176
+278.974464 89.80 178176
+279.152640 89.80 178176
+279.330816 89.80 178176
+279.508992 89.80 178176
+279.687168 89.80 178176
+279.865344 89.80 178176
+280.043520 89.80 178176
+280.221696 89.80 178176
+280.399872 89.80 178176
+280.578048 89.80 178176
+280.756224 89.80 178176
+280.934400 89.80 178176
+281.112576 89.80 178176
+281.290752 89.80 178176
+281.468928 89.80 178176
+281.646080 90.32 177152
+281.823232 90.32 177152
+282.000384 90.32 177152
+282.177536 90.32 177152
+282.354688 90.32 177152
+282.531840 90.32 177152
+282.708992 90.32 177152
+282.886144 90.32 177152
+283.062272 90.84 176128
+283.238400 90.84 176128
+283.414528 90.84 176128
+283.590656 90.84 176128
+283.766784 90.84 176128
+283.942912 90.84 176128
+284.119040 90.84 176128
+284.295168 90.84 176128
+284.471296 90.84 176128
+284.647424 90.84 176128
+284.823552 90.84 176128
+284.999680 90.84 176128
+285.174784 91.37 175104
+285.349888 91.37 175104
+285.524992 91.37 175104
+285.700096 91.37 175104
+285.875200 91.37 175104
+286.050304 91.37 175104
+286.225408 91.37 175104
+286.400512 91.37 175104
+286.574592 91.91 174080
+286.748672 91.91 174080
+286.922752 91.91 174080
+287.096832 91.91 174080
+287.270912 91.91 174080
+287.444992 91.91 174080
+287.619072 91.91 174080
+287.793152 91.91 174080
+287.966208 92.46 173056
+288.139264 92.46 173056
+288.312320 92.46 173056
+288.485376 92.46 173056
+288.658432 92.46 173056
+288.831488 92.46 173056
+289.004544 92.46 173056
+289.177600 92.46 173056
+289.349632 93.01 172032
+289.521664 93.01 172032
+289.693696 93.01 172032
+289.865728 93.01 172032
+290.037760 93.01 172032
+290.209792 93.01 172032
+290.381824 93.01 172032
+290.553856 93.01 172032
+290.725888 93.01 172032
+290.897920 93.01 172032
+291.069952 93.01 172032
+291.241984 93.01 172032
+291.412992 93.56 171008
+291.584000 93.56 171008
+291.755008 93.56 171008
+291.926016 93.56 171008
+292.097024 93.56 171008
+292.268032 93.56 171008
+292.439040 93.56 171008
+292.610048 93.56 171008
+292.780032 94.13 169984
+292.950016 94.13 169984
+293.120000 94.13 169984
+293.289984 94.13 169984
+293.459968 94.13 169984
+293.629952 94.13 169984
+293.799936 94.13 169984
+293.969920 94.13 169984
+294.139904 94.13 169984
+294.309888 94.13 169984
+294.479872 94.13 169984
+294.649856 94.13 169984
+294.818816 94.70 168960
+294.987776 94.70 168960
+295.156736 94.70 168960
+295.325696 94.70 168960
+295.494656 94.70 168960
+295.663616 94.70 168960
+295.832576 94.70 168960
+296.001536 94.70 168960
+296.169472 95.27 167936
+296.337408 95.27 167936
+296.505344 95.27 167936
+296.673280 95.27 167936
+296.841216 95.27 167936
+297.009152 95.27 167936
+297.177088 95.27 167936
+297.345024 95.27 167936
+297.511936 95.86 166912
+297.678848 95.86 166912
+297.845760 95.86 166912
+298.012672 95.86 166912
+298.179584 95.86 166912
+298.346496 95.86 166912
+298.513408 95.86 166912
+298.680320 95.86 166912
+298.847232 95.86 166912
+299.014144 95.86 166912
+299.181056 95.86 166912
+299.347968 95.86 166912
+299.514880 95.86 166912
+299.681792 95.86 166912
+299.848704 95.86 166912
+300.015616 95.86 166912
+300.182528 95.86 166912
+300.349440 95.86 166912
+300.516352 95.86 166912
+300.683264 95.86 166912
+300.849152 96.45 165888
+301.015040 96.45 165888
+301.180928 96.45 165888
+301.346816 96.45 165888
+301.512704 96.45 165888
+301.678592 96.45 165888
+301.844480 96.45 165888
+302.010368 96.45 165888
+302.176256 96.45 165888
+302.342144 96.45 165888
+302.508032 96.45 165888
+302.673920 96.45 165888
+302.838784 97.05 164864
+303.003648 97.05 164864
+303.168512 97.05 164864
+303.333376 97.05 164864
+303.498240 97.05 164864
+303.663104 97.05 164864
+303.827968 97.05 164864
+303.992832 97.05 164864
+304.157696 97.05 164864
+304.322560 97.05 164864
+304.487424 97.05 164864
+304.652288 97.05 164864
+304.816128 97.66 163840
+304.979968 97.66 163840
+305.143808 97.66 163840
+305.307648 97.66 163840
+305.471488 97.66 163840
+305.635328 97.66 163840
+305.799168 97.66 163840
+305.963008 97.66 163840
+306.125824 98.27 162816
+306.288640 98.27 162816
+306.451456 98.27 162816
+306.614272 98.27 162816
+306.777088 98.27 162816
+306.939904 98.27 162816
+307.102720 98.27 162816
+307.265536 98.27 162816
+307.428352 98.27 162816
+307.591168 98.27 162816
+307.753984 98.27 162816
+307.916800 98.27 162816
+308.078592 98.89 161792
+308.240384 98.89 161792
+308.402176 98.89 161792
+308.563968 98.89 161792
+308.725760 98.89 161792
+308.887552 98.89 161792
+309.049344 98.89 161792
+309.211136 98.89 161792
+309.371904 99.52 160768
+309.532672 99.52 160768
+309.693440 99.52 160768
+309.854208 99.52 160768
+310.014976 99.52 160768
+310.175744 99.52 160768
+310.336512 99.52 160768
+310.497280 99.52 160768
+310.658048 99.52 160768
+310.818816 99.52 160768
+310.979584 99.52 160768
+311.140352 99.52 160768
+311.301120 99.52 160768
+311.461888 99.52 160768
+311.622656 99.52 160768
+311.783424 99.52 160768
+311.944192 99.52 160768
+312.104960 99.52 160768
+312.265728 99.52 160768
+312.426496 99.52 160768
+312.587264 99.52 160768
+312.748032 99.52 160768
+312.908800 99.52 160768
+313.069568 99.52 160768
+313.229312 100.16 159744
+313.389056 100.16 159744
+313.548800 100.16 159744
+313.708544 100.16 159744
+313.868288 100.16 159744
+314.028032 100.16 159744
+314.187776 100.16 159744
+314.347520 100.16 159744
+314.506240 100.81 158720
+314.664960 100.81 158720
+314.823680 100.81 158720
+314.982400 100.81 158720
+315.141120 100.81 158720
+315.299840 100.81 158720
+315.458560 100.81 158720
+315.617280 100.81 158720
+315.776000 100.81 158720
+315.934720 100.81 158720
+316.093440 100.81 158720
+316.252160 100.81 158720
+316.409856 101.46 157696
+316.567552 101.46 157696
+316.725248 101.46 157696
+316.882944 101.46 157696
+317.040640 101.46 157696
+317.198336 101.46 157696
+317.356032 101.46 157696
+317.513728 101.46 157696
+317.671424 101.46 157696
+317.829120 101.46 157696
+317.986816 101.46 157696
+318.144512 101.46 157696
+318.302208 101.46 157696
+318.459904 101.46 157696
+318.617600 101.46 157696
+318.775296 101.46 157696
+318.931968 102.12 156672
+319.088640 102.12 156672
+319.245312 102.12 156672
+319.401984 102.12 156672
+319.558656 102.12 156672
+319.715328 102.12 156672
+319.872000 102.12 156672
+320.028672 102.12 156672
+320.184320 102.80 155648
+320.339968 102.80 155648
+320.495616 102.80 155648
+320.651264 102.80 155648
+320.806912 102.80 155648
+320.962560 102.80 155648
+321.118208 102.80 155648
+321.273856 102.80 155648
+321.429504 102.80 155648
+321.585152 102.80 155648
+321.740800 102.80 155648
+321.896448 102.80 155648
+322.052096 102.80 155648
+322.207744 102.80 155648
+322.363392 102.80 155648
+322.519040 102.80 155648
+322.674688 102.80 155648
+322.830336 102.80 155648
+322.985984 102.80 155648
+323.141632 102.80 155648
+323.297280 102.80 155648
+323.452928 102.80 155648
+323.608576 102.80 155648
+323.764224 102.80 155648
+323.918848 103.48 154624
+324.073472 103.48 154624
+324.228096 103.48 154624
+324.382720 103.48 154624
+324.537344 103.48 154624
+324.691968 103.48 154624
+324.846592 103.48 154624
+325.001216 103.48 154624
+325.154816 104.17 153600
+325.308416 104.17 153600
+325.462016 104.17 153600
+325.615616 104.17 153600
+325.769216 104.17 153600
+325.922816 104.17 153600
+326.076416 104.17 153600
+326.230016 104.17 153600
+326.383616 104.17 153600
+326.537216 104.17 153600
+326.690816 104.17 153600
+326.844416 104.17 153600
+326.998016 104.17 153600
+327.151616 104.17 153600
+327.305216 104.17 153600
+327.458816 104.17 153600
+327.611392 104.87 152576
+327.763968 104.87 152576
+327.916544 104.87 152576
+328.069120 104.87 152576
+328.221696 104.87 152576
+328.374272 104.87 152576
+328.526848 104.87 152576
+328.679424 104.87 152576
+328.830976 105.57 151552
+328.982528 105.57 151552
+329.134080 105.57 151552
+329.285632 105.57 151552
+329.437184 105.57 151552
+329.588736 105.57 151552
+329.740288 105.57 151552
+329.891840 105.57 151552
+330.043392 105.57 151552
+330.194944 105.57 151552
+330.346496 105.57 151552
+330.498048 105.57 151552
+330.649600 105.57 151552
+330.801152 105.57 151552
+330.952704 105.57 151552
+331.104256 105.57 151552
+331.254784 106.29 150528
+331.405312 106.29 150528
+331.555840 106.29 150528
+331.706368 106.29 150528
+331.856896 106.29 150528
+332.007424 106.29 150528
+332.157952 106.29 150528
+332.308480 106.29 150528
+332.459008 106.29 150528
+332.609536 106.29 150528
+332.760064 106.29 150528
+332.910592 106.29 150528
+333.061120 106.29 150528
+333.211648 106.29 150528
+333.362176 106.29 150528
+333.512704 106.29 150528
+333.663232 106.29 150528
+333.813760 106.29 150528
+333.964288 106.29 150528
+334.114816 106.29 150528
+334.265344 106.29 150528
+334.415872 106.29 150528
+334.566400 106.29 150528
+334.716928 106.29 150528
+334.866432 107.02 149504
+335.015936 107.02 149504
+335.165440 107.02 149504
+335.314944 107.02 149504
+335.464448 107.02 149504
+335.613952 107.02 149504
+335.763456 107.02 149504
+335.912960 107.02 149504
+336.061440 107.76 148480
+336.209920 107.76 148480
+336.358400 107.76 148480
+336.506880 107.76 148480
+336.655360 107.76 148480
+336.803840 107.76 148480
+336.952320 107.76 148480
+337.100800 107.76 148480
+337.249280 107.76 148480
+337.397760 107.76 148480
+337.546240 107.76 148480
+337.694720 107.76 148480
+337.843200 107.76 148480
+337.991680 107.76 148480
+338.140160 107.76 148480
+338.288640 107.76 148480
+338.436096 108.51 147456
+338.583552 108.51 147456
+338.731008 108.51 147456
+338.878464 108.51 147456
+339.025920 108.51 147456
+339.173376 108.51 147456
+339.320832 108.51 147456
+339.468288 108.51 147456
+339.615744 108.51 147456
+339.763200 108.51 147456
+339.910656 108.51 147456
+340.058112 108.51 147456
+340.205568 108.51 147456
+340.353024 108.51 147456
+340.500480 108.51 147456
+340.647936 108.51 147456
+340.795392 108.51 147456
+340.942848 108.51 147456
+341.090304 108.51 147456
+341.237760 108.51 147456
+341.385216 108.51 147456
+341.532672 108.51 147456
+341.680128 108.51 147456
+341.827584 108.51 147456
+341.974016 109.27 146432
+342.120448 109.27 146432
+342.266880 109.27 146432
+342.413312 109.27 146432
+342.559744 109.27 146432
+342.706176 109.27 146432
+342.852608 109.27 146432
+342.999040 109.27 146432
+343.145472 109.27 146432
+343.291904 109.27 146432
+343.438336 109.27 146432
+343.584768 109.27 146432
+343.731200 109.27 146432
+343.877632 109.27 146432
+344.024064 109.27 146432
+344.170496 109.27 146432
+344.315904 110.04 145408
+344.461312 110.04 145408
+344.606720 110.04 145408
+344.752128 110.04 145408
+344.897536 110.04 145408
+345.042944 110.04 145408
+345.188352 110.04 145408
+345.333760 110.04 145408
+345.478144 110.82 144384
+345.622528 110.82 144384
+345.766912 110.82 144384
+345.911296 110.82 144384
+346.055680 110.82 144384
+346.200064 110.82 144384
+346.344448 110.82 144384
+346.488832 110.82 144384
+346.633216 110.82 144384
+346.777600 110.82 144384
+346.921984 110.82 144384
+347.066368 110.82 144384
+347.210752 110.82 144384
+347.355136 110.82 144384
+347.499520 110.82 144384
+347.643904 110.82 144384
+347.787264 111.61 143360
+347.930624 111.61 143360
+348.073984 111.61 143360
+348.217344 111.61 143360
+348.360704 111.61 143360
+348.504064 111.61 143360
+348.647424 111.61 143360
+348.790784 111.61 143360
+348.934144 111.61 143360
+349.077504 111.61 143360
+349.220864 111.61 143360
+349.364224 111.61 143360
+349.507584 111.61 143360
+349.650944 111.61 143360
+349.794304 111.61 143360
+349.937664 111.61 143360
+350.081024 111.61 143360
+350.224384 111.61 143360
+350.367744 111.61 143360
+350.511104 111.61 143360
+350.654464 111.61 143360
+350.797824 111.61 143360
+350.941184 111.61 143360
+351.084544 111.61 143360
+351.226880 112.41 142336
+351.369216 112.41 142336
+351.511552 112.41 142336
+351.653888 112.41 142336
+351.796224 112.41 142336
+351.938560 112.41 142336
+352.080896 112.41 142336
+352.223232 112.41 142336
+352.365568 112.41 142336
+352.507904 112.41 142336
+352.650240 112.41 142336
+352.792576 112.41 142336
+352.934912 112.41 142336
+353.077248 112.41 142336
+353.219584 112.41 142336
+353.361920 112.41 142336
+353.503232 113.22 141312
+353.644544 113.22 141312
+353.785856 113.22 141312
+353.927168 113.22 141312
+354.068480 113.22 141312
+354.209792 113.22 141312
+354.351104 113.22 141312
+354.492416 113.22 141312
+354.633728 113.22 141312
+354.775040 113.22 141312
+354.916352 113.22 141312
+355.057664 113.22 141312
+355.198976 113.22 141312
+355.340288 113.22 141312
+355.481600 113.22 141312
+355.622912 113.22 141312
+355.763200 114.05 140288
+355.903488 114.05 140288
+356.043776 114.05 140288
+356.184064 114.05 140288
+356.324352 114.05 140288
+356.464640 114.05 140288
+356.604928 114.05 140288
+356.745216 114.05 140288
+356.885504 114.05 140288
+357.025792 114.05 140288
+357.166080 114.05 140288
+357.306368 114.05 140288
+357.446656 114.05 140288
+357.586944 114.05 140288
+357.727232 114.05 140288
+357.867520 114.05 140288
+358.007808 114.05 140288
+358.148096 114.05 140288
+358.288384 114.05 140288
+358.428672 114.05 140288
+358.568960 114.05 140288
+358.709248 114.05 140288
+358.849536 114.05 140288
+358.989824 114.05 140288
+359.129088 114.89 139264
+359.268352 114.89 139264
+359.407616 114.89 139264
+359.546880 114.89 139264
+359.686144 114.89 139264
+359.825408 114.89 139264
+359.964672 114.89 139264
+360.103936 114.89 139264
+360.243200 114.89 139264
+360.382464 114.89 139264
+360.521728 114.89 139264
+360.660992 114.89 139264
+360.800256 114.89 139264
+360.939520 114.89 139264
+361.078784 114.89 139264
+361.218048 114.89 139264
+361.356288 115.74 138240
+361.494528 115.74 138240
+361.632768 115.74 138240
+361.771008 115.74 138240
+361.909248 115.74 138240
+362.047488 115.74 138240
+362.185728 115.74 138240
+362.323968 115.74 138240
+362.462208 115.74 138240
+362.600448 115.74 138240
+362.738688 115.74 138240
+362.876928 115.74 138240
+363.015168 115.74 138240
+363.153408 115.74 138240
+363.291648 115.74 138240
+363.429888 115.74 138240
+363.568128 115.74 138240
+363.706368 115.74 138240
+363.844608 115.74 138240
+363.982848 115.74 138240
+364.121088 115.74 138240
+364.259328 115.74 138240
+364.397568 115.74 138240
+364.535808 115.74 138240
+364.674048 115.74 138240
+364.812288 115.74 138240
+364.950528 115.74 138240
+365.088768 115.74 138240
+365.227008 115.74 138240
+365.365248 115.74 138240
+365.503488 115.74 138240
+365.641728 115.74 138240
+365.778944 116.60 137216
+365.916160 116.60 137216
+366.053376 116.60 137216
+366.190592 116.60 137216
+366.327808 116.60 137216
+366.465024 116.60 137216
+366.602240 116.60 137216
+366.739456 116.60 137216
+366.876672 116.60 137216
+367.013888 116.60 137216
+367.151104 116.60 137216
+367.288320 116.60 137216
+367.425536 116.60 137216
+367.562752 116.60 137216
+367.699968 116.60 137216
+367.837184 116.60 137216
+367.973376 117.48 136192
+368.109568 117.48 136192
+368.245760 117.48 136192
+368.381952 117.48 136192
+368.518144 117.48 136192
+368.654336 117.48 136192
+368.790528 117.48 136192
+368.926720 117.48 136192
+369.062912 117.48 136192
+369.199104 117.48 136192
+369.335296 117.48 136192
+369.471488 117.48 136192
+369.607680 117.48 136192
+369.743872 117.48 136192
+369.880064 117.48 136192
+370.016256 117.48 136192
+370.151424 118.37 135168
+370.286592 118.37 135168
+370.421760 118.37 135168
+370.556928 118.37 135168
+370.692096 118.37 135168
+370.827264 118.37 135168
+370.962432 118.37 135168
+371.097600 118.37 135168
+371.232768 118.37 135168
+371.367936 118.37 135168
+371.503104 118.37 135168
+371.638272 118.37 135168
+371.773440 118.37 135168
+371.908608 118.37 135168
+372.043776 118.37 135168
+372.178944 118.37 135168
+372.314112 118.37 135168
+372.449280 118.37 135168
+372.584448 118.37 135168
+372.719616 118.37 135168
+372.854784 118.37 135168
+372.989952 118.37 135168
+373.125120 118.37 135168
+373.260288 118.37 135168
+373.394432 119.27 134144
+373.528576 119.27 134144
+373.662720 119.27 134144
+373.796864 119.27 134144
+373.931008 119.27 134144
+374.065152 119.27 134144
+374.199296 119.27 134144
+374.333440 119.27 134144
+374.467584 119.27 134144
+374.601728 119.27 134144
+374.735872 119.27 134144
+374.870016 119.27 134144
+375.004160 119.27 134144
+375.138304 119.27 134144
+375.272448 119.27 134144
+375.406592 119.27 134144
+375.539712 120.19 133120
+375.672832 120.19 133120
+375.805952 120.19 133120
+375.939072 120.19 133120
+376.072192 120.19 133120
+376.205312 120.19 133120
+376.338432 120.19 133120
+376.471552 120.19 133120
+376.604672 120.19 133120
+376.737792 120.19 133120
+376.870912 120.19 133120
+377.004032 120.19 133120
+377.137152 120.19 133120
+377.270272 120.19 133120
+377.403392 120.19 133120
+377.536512 120.19 133120
+377.668608 121.12 132096
+377.800704 121.12 132096
+377.932800 121.12 132096
+378.064896 121.12 132096
+378.196992 121.12 132096
+378.329088 121.12 132096
+378.461184 121.12 132096
+378.593280 121.12 132096
+378.725376 121.12 132096
+378.857472 121.12 132096
+378.989568 121.12 132096
+379.121664 121.12 132096
+379.253760 121.12 132096
+379.385856 121.12 132096
+379.517952 121.12 132096
+379.650048 121.12 132096
+379.782144 121.12 132096
+379.914240 121.12 132096
+380.046336 121.12 132096
+380.178432 121.12 132096
+380.310528 121.12 132096
+380.442624 121.12 132096
+380.574720 121.12 132096
+380.706816 121.12 132096
+380.838912 121.12 132096
+380.971008 121.12 132096
+381.103104 121.12 132096
+381.235200 121.12 132096
+381.367296 121.12 132096
+381.499392 121.12 132096
+381.631488 121.12 132096
+381.763584 121.12 132096
+381.894656 122.07 131072
+382.025728 122.07 131072
+382.156800 122.07 131072
+382.287872 122.07 131072
+382.418944 122.07 131072
+382.550016 122.07 131072
+382.681088 122.07 131072
+382.812160 122.07 131072
+382.943232 122.07 131072
+383.074304 122.07 131072
+383.205376 122.07 131072
+383.336448 122.07 131072
+383.467520 122.07 131072
+383.598592 122.07 131072
+383.729664 122.07 131072
+383.860736 122.07 131072
+383.991296 122.55 130560
+384.121856 122.55 130560
+384.252416 122.55 130560
+384.382976 122.55 130560
+384.513536 122.55 130560
+384.644096 122.55 130560
+384.774656 122.55 130560
+384.905216 122.55 130560
+385.035776 122.55 130560
+385.166336 122.55 130560
+385.296896 122.55 130560
+385.427456 122.55 130560
+385.558016 122.55 130560
+385.688576 122.55 130560
+385.819136 122.55 130560
+385.949696 122.55 130560
+386.079744 123.03 130048
+386.209792 123.03 130048
+386.339840 123.03 130048
+386.469888 123.03 130048
+386.599936 123.03 130048
+386.729984 123.03 130048
+386.860032 123.03 130048
+386.990080 123.03 130048
+387.120128 123.03 130048
+387.250176 123.03 130048
+387.380224 123.03 130048
+387.510272 123.03 130048
+387.640320 123.03 130048
+387.770368 123.03 130048
+387.900416 123.03 130048
+388.030464 123.03 130048
+388.159488 124.01 129024
+388.288512 124.01 129024
+388.417536 124.01 129024
+388.546560 124.01 129024
+388.675584 124.01 129024
+388.804608 124.01 129024
+388.933632 124.01 129024
+389.062656 124.01 129024
+389.191680 124.01 129024
+389.320704 124.01 129024
+389.449728 124.01 129024
+389.578752 124.01 129024
+389.707776 124.01 129024
+389.836800 124.01 129024
+389.965824 124.01 129024
+390.094848 124.01 129024
+390.223360 124.50 128512
+390.351872 124.50 128512
+390.480384 124.50 128512
+390.608896 124.50 128512
+390.737408 124.50 128512
+390.865920 124.50 128512
+390.994432 124.50 128512
+391.122944 124.50 128512
+391.251456 124.50 128512
+391.379968 124.50 128512
+391.508480 124.50 128512
+391.636992 124.50 128512
+391.765504 124.50 128512
+391.894016 124.50 128512
+392.022528 124.50 128512
+392.151040 124.50 128512
+392.279040 125.00 128000
+392.407040 125.00 128000
+392.535040 125.00 128000
+392.663040 125.00 128000
+392.791040 125.00 128000
+392.919040 125.00 128000
+393.047040 125.00 128000
+393.175040 125.00 128000
+393.303040 125.00 128000
+393.431040 125.00 128000
+393.559040 125.00 128000
+393.687040 125.00 128000
+393.815040 125.00 128000
+393.943040 125.00 128000
+394.071040 125.00 128000
+394.199040 125.00 128000
+394.327040 125.00 128000
+394.455040 125.00 128000
+394.583040 125.00 128000
+394.711040 125.00 128000
+394.839040 125.00 128000
+394.967040 125.00 128000
+395.095040 125.00 128000
+395.223040 125.00 128000
+395.350016 126.01 126976
+395.476992 126.01 126976
+395.603968 126.01 126976
+395.730944 126.01 126976
+395.857920 126.01 126976
+395.984896 126.01 126976
+396.111872 126.01 126976
+396.238848 126.01 126976
+396.365824 126.01 126976
+396.492800 126.01 126976
+396.619776 126.01 126976
+396.746752 126.01 126976
+396.873728 126.01 126976
+397.000704 126.01 126976
+397.127680 126.01 126976
+397.254656 126.01 126976
+397.381120 126.52 126464
+397.507584 126.52 126464
+397.634048 126.52 126464
+397.760512 126.52 126464
+397.886976 126.52 126464
+398.013440 126.52 126464
+398.139904 126.52 126464
+398.266368 126.52 126464
+398.392832 126.52 126464
+398.519296 126.52 126464
+398.645760 126.52 126464
+398.772224 126.52 126464
+398.898688 126.52 126464
+399.025152 126.52 126464
+399.151616 126.52 126464
+399.278080 126.52 126464
+399.404032 127.03 125952
+399.529984 127.03 125952
+399.655936 127.03 125952
+399.781888 127.03 125952
+399.907840 127.03 125952
+400.033792 127.03 125952
+400.159744 127.03 125952
+400.285696 127.03 125952
+400.411648 127.03 125952
+400.537600 127.03 125952
+400.663552 127.03 125952
+400.789504 127.03 125952
+400.915456 127.03 125952
+401.041408 127.03 125952
+401.167360 127.03 125952
+401.293312 127.03 125952
+401.418240 128.07 124928
+401.543168 128.07 124928
+401.668096 128.07 124928
+401.793024 128.07 124928
+401.917952 128.07 124928
+402.042880 128.07 124928
+402.167808 128.07 124928
+402.292736 128.07 124928
+402.417664 128.07 124928
+402.542592 128.07 124928
+402.667520 128.07 124928
+402.792448 128.07 124928
+402.917376 128.07 124928
+403.042304 128.07 124928
+403.167232 128.07 124928
+403.292160 128.07 124928
+403.416576 128.60 124416
+403.540992 128.60 124416
+403.665408 128.60 124416
+403.789824 128.60 124416
+403.914240 128.60 124416
+404.038656 128.60 124416
+404.163072 128.60 124416
+404.287488 128.60 124416
+404.411904 128.60 124416
+404.536320 128.60 124416
+404.660736 128.60 124416
+404.785152 128.60 124416
+404.909568 128.60 124416
+405.033984 128.60 124416
+405.158400 128.60 124416
+405.282816 128.60 124416
+405.407232 128.60 124416
+405.531648 128.60 124416
+405.656064 128.60 124416
+405.780480 128.60 124416
+405.904896 128.60 124416
+406.029312 128.60 124416
+406.153728 128.60 124416
+406.278144 128.60 124416
+406.402048 129.13 123904
+406.525952 129.13 123904
+406.649856 129.13 123904
+406.773760 129.13 123904
+406.897664 129.13 123904
+407.021568 129.13 123904
+407.145472 129.13 123904
+407.269376 129.13 123904
+407.393280 129.13 123904
+407.517184 129.13 123904
+407.641088 129.13 123904
+407.764992 129.13 123904
+407.888896 129.13 123904
+408.012800 129.13 123904
+408.136704 129.13 123904
+408.260608 129.13 123904
+408.383488 130.21 122880
+408.506368 130.21 122880
+408.629248 130.21 122880
+408.752128 130.21 122880
+408.875008 130.21 122880
+408.997888 130.21 122880
+409.120768 130.21 122880
+409.243648 130.21 122880
+409.366528 130.21 122880
+409.489408 130.21 122880
+409.612288 130.21 122880
+409.735168 130.21 122880
+409.858048 130.21 122880
+409.980928 130.21 122880
+410.103808 130.21 122880
+410.226688 130.21 122880
+410.349056 130.75 122368
+410.471424 130.75 122368
+410.593792 130.75 122368
+410.716160 130.75 122368
+410.838528 130.75 122368
+410.960896 130.75 122368
+411.083264 130.75 122368
+411.205632 130.75 122368
+411.328000 130.75 122368
+411.450368 130.75 122368
+411.572736 130.75 122368
+411.695104 130.75 122368
+411.817472 130.75 122368
+411.939840 130.75 122368
+412.062208 130.75 122368
+412.184576 130.75 122368
+412.306432 131.30 121856
+412.428288 131.30 121856
+412.550144 131.30 121856
+412.672000 131.30 121856
+412.793856 131.30 121856
+412.915712 131.30 121856
+413.037568 131.30 121856
+413.159424 131.30 121856
+413.281280 131.30 121856
+413.403136 131.30 121856
+413.524992 131.30 121856
+413.646848 131.30 121856
+413.768704 131.30 121856
+413.890560 131.30 121856
+414.012416 131.30 121856
+414.134272 131.30 121856
+414.256128 131.30 121856
+414.377984 131.30 121856
+414.499840 131.30 121856
+414.621696 131.30 121856
+414.743552 131.30 121856
+414.865408 131.30 121856
+414.987264 131.30 121856
+415.109120 131.30 121856
+415.229952 132.42 120832
+415.350784 132.42 120832
+415.471616 132.42 120832
+415.592448 132.42 120832
+415.713280 132.42 120832
+415.834112 132.42 120832
+415.954944 132.42 120832
+416.075776 132.42 120832
+416.196608 132.42 120832
+416.317440 132.42 120832
+416.438272 132.42 120832
+416.559104 132.42 120832
+416.679936 132.42 120832
+416.800768 132.42 120832
+416.921600 132.42 120832
+417.042432 132.42 120832
+417.162752 132.98 120320
+417.283072 132.98 120320
+417.403392 132.98 120320
+417.523712 132.98 120320
+417.644032 132.98 120320
+417.764352 132.98 120320
+417.884672 132.98 120320
+418.004992 132.98 120320
+418.125312 132.98 120320
+418.245632 132.98 120320
+418.365952 132.98 120320
+418.486272 132.98 120320
+418.606592 132.98 120320
+418.726912 132.98 120320
+418.847232 132.98 120320
+418.967552 132.98 120320
+419.087872 132.98 120320
+419.208192 132.98 120320
+419.328512 132.98 120320
+419.448832 132.98 120320
+419.569152 132.98 120320
+419.689472 132.98 120320
+419.809792 132.98 120320
+419.930112 132.98 120320
+420.049920 133.55 119808
+420.169728 133.55 119808
+420.289536 133.55 119808
+420.409344 133.55 119808
+420.529152 133.55 119808
+420.648960 133.55 119808
+420.768768 133.55 119808
+420.888576 133.55 119808
+421.008384 133.55 119808
+421.128192 133.55 119808
+421.248000 133.55 119808
+421.367808 133.55 119808
+421.487616 133.55 119808
+421.607424 133.55 119808
+421.727232 133.55 119808
+421.847040 133.55 119808
+421.966336 134.12 119296
+422.085632 134.12 119296
+422.204928 134.12 119296
+422.324224 134.12 119296
+422.443520 134.12 119296
+422.562816 134.12 119296
+422.682112 134.12 119296
+422.801408 134.12 119296
+422.920704 134.12 119296
+423.040000 134.12 119296
+423.159296 134.12 119296
+423.278592 134.12 119296
+423.397888 134.12 119296
+423.517184 134.12 119296
+423.636480 134.12 119296
+423.755776 134.12 119296
+423.874048 135.28 118272
+423.992320 135.28 118272
+424.110592 135.28 118272
+424.228864 135.28 118272
+424.347136 135.28 118272
+424.465408 135.28 118272
+424.583680 135.28 118272
+424.701952 135.28 118272
+424.820224 135.28 118272
+424.938496 135.28 118272
+425.056768 135.28 118272
+425.175040 135.28 118272
+425.293312 135.28 118272
+425.411584 135.28 118272
+425.529856 135.28 118272
+425.648128 135.28 118272
+425.766400 135.28 118272
+425.884672 135.28 118272
+426.002944 135.28 118272
+426.121216 135.28 118272
+426.239488 135.28 118272
+426.357760 135.28 118272
+426.476032 135.28 118272
+426.594304 135.28 118272
+426.712064 135.87 117760
+426.829824 135.87 117760
+426.947584 135.87 117760
+427.065344 135.87 117760
+427.183104 135.87 117760
+427.300864 135.87 117760
+427.418624 135.87 117760
+427.536384 135.87 117760
+427.654144 135.87 117760
+427.771904 135.87 117760
+427.889664 135.87 117760
+428.007424 135.87 117760
+428.125184 135.87 117760
+428.242944 135.87 117760
+428.360704 135.87 117760
+428.478464 135.87 117760
+428.595712 136.46 117248
+428.712960 136.46 117248
+428.830208 136.46 117248
+428.947456 136.46 117248
+429.064704 136.46 117248
+429.181952 136.46 117248
+429.299200 136.46 117248
+429.416448 136.46 117248
+429.533696 136.46 117248
+429.650944 136.46 117248
+429.768192 136.46 117248
+429.885440 136.46 117248
+430.002688 136.46 117248
+430.119936 136.46 117248
+430.237184 136.46 117248
+430.354432 136.46 117248
+430.471680 136.46 117248
+430.588928 136.46 117248
+430.706176 136.46 117248
+430.823424 136.46 117248
+430.940672 136.46 117248
+431.057920 136.46 117248
+431.175168 136.46 117248
+431.292416 136.46 117248
+431.409152 137.06 116736
+431.525888 137.06 116736
+431.642624 137.06 116736
+431.759360 137.06 116736
+431.876096 137.06 116736
+431.992832 137.06 116736
+432.109568 137.06 116736
+432.226304 137.06 116736
+432.343040 137.06 116736
+432.459776 137.06 116736
+432.576512 137.06 116736
+432.693248 137.06 116736
+432.809984 137.06 116736
+432.926720 137.06 116736
+433.043456 137.06 116736
+433.160192 137.06 116736
+433.276928 137.06 116736
+433.393664 137.06 116736
+433.510400 137.06 116736
+433.627136 137.06 116736
+433.743872 137.06 116736
+433.860608 137.06 116736
+433.977344 137.06 116736
+434.094080 137.06 116736
+434.209792 138.27 115712
+434.325504 138.27 115712
+434.441216 138.27 115712
+434.556928 138.27 115712
+434.672640 138.27 115712
+434.788352 138.27 115712
+434.904064 138.27 115712
+435.019776 138.27 115712
+435.135488 138.27 115712
+435.251200 138.27 115712
+435.366912 138.27 115712
+435.482624 138.27 115712
+435.598336 138.27 115712
+435.714048 138.27 115712
+435.829760 138.27 115712
+435.945472 138.27 115712
+436.060672 138.89 115200
+436.175872 138.89 115200
+436.291072 138.89 115200
+436.406272 138.89 115200
+436.521472 138.89 115200
+436.636672 138.89 115200
+436.751872 138.89 115200
+436.867072 138.89 115200
+436.982272 138.89 115200
+437.097472 138.89 115200
+437.212672 138.89 115200
+437.327872 138.89 115200
+437.443072 138.89 115200
+437.558272 138.89 115200
+437.673472 138.89 115200
+437.788672 138.89 115200
+437.903872 138.89 115200
+438.019072 138.89 115200
+438.134272 138.89 115200
+438.249472 138.89 115200
+438.364672 138.89 115200
+438.479872 138.89 115200
+438.595072 138.89 115200
+438.710272 138.89 115200
+438.824960 139.51 114688
+438.939648 139.51 114688
+439.054336 139.51 114688
+439.169024 139.51 114688
+439.283712 139.51 114688
+439.398400 139.51 114688
+439.513088 139.51 114688
+439.627776 139.51 114688
+439.742464 139.51 114688
+439.857152 139.51 114688
+439.971840 139.51 114688
+440.086528 139.51 114688
+440.201216 139.51 114688
+440.315904 139.51 114688
+440.430592 139.51 114688
+440.545280 139.51 114688
+440.659456 140.13 114176
+440.773632 140.13 114176
+440.887808 140.13 114176
+441.001984 140.13 114176
+441.116160 140.13 114176
+441.230336 140.13 114176
+441.344512 140.13 114176
+441.458688 140.13 114176
+441.572864 140.13 114176
+441.687040 140.13 114176
+441.801216 140.13 114176
+441.915392 140.13 114176
+442.029568 140.13 114176
+442.143744 140.13 114176
+442.257920 140.13 114176
+442.372096 140.13 114176
+442.486272 140.13 114176
+442.600448 140.13 114176
+442.714624 140.13 114176
+442.828800 140.13 114176
+442.942976 140.13 114176
+443.057152 140.13 114176
+443.171328 140.13 114176
+443.285504 140.13 114176
+443.398656 141.40 113152
+443.511808 141.40 113152
+443.624960 141.40 113152
+443.738112 141.40 113152
+443.851264 141.40 113152
+443.964416 141.40 113152
+444.077568 141.40 113152
+444.190720 141.40 113152
+444.303872 141.40 113152
+444.417024 141.40 113152
+444.530176 141.40 113152
+444.643328 141.40 113152
+444.756480 141.40 113152
+444.869632 141.40 113152
+444.982784 141.40 113152
+445.095936 141.40 113152
+445.209088 141.40 113152
+445.322240 141.40 113152
+445.435392 141.40 113152
+445.548544 141.40 113152
+445.661696 141.40 113152
+445.774848 141.40 113152
+445.888000 141.40 113152
+446.001152 141.40 113152
+446.113792 142.05 112640
+446.226432 142.05 112640
+446.339072 142.05 112640
+446.451712 142.05 112640
+446.564352 142.05 112640
+446.676992 142.05 112640
+446.789632 142.05 112640
+446.902272 142.05 112640
+447.014912 142.05 112640
+447.127552 142.05 112640
+447.240192 142.05 112640
+447.352832 142.05 112640
+447.465472 142.05 112640
+447.578112 142.05 112640
+447.690752 142.05 112640
+447.803392 142.05 112640
+447.915520 142.69 112128
+448.027648 142.69 112128
+448.139776 142.69 112128
+448.251904 142.69 112128
+448.364032 142.69 112128
+448.476160 142.69 112128
+448.588288 142.69 112128
+448.700416 142.69 112128
+448.812544 142.69 112128
+448.924672 142.69 112128
+449.036800 142.69 112128
+449.148928 142.69 112128
+449.261056 142.69 112128
+449.373184 142.69 112128
+449.485312 142.69 112128
+449.597440 142.69 112128
+449.709568 142.69 112128
+449.821696 142.69 112128
+449.933824 142.69 112128
+450.045952 142.69 112128
+450.158080 142.69 112128
+450.270208 142.69 112128
+450.382336 142.69 112128
+450.494464 142.69 112128
+450.606080 143.35 111616
+450.717696 143.35 111616
+450.829312 143.35 111616
+450.940928 143.35 111616
+451.052544 143.35 111616
+451.164160 143.35 111616
+451.275776 143.35 111616
+451.387392 143.35 111616
+451.499008 143.35 111616
+451.610624 143.35 111616
+451.722240 143.35 111616
+451.833856 143.35 111616
+451.945472 143.35 111616
+452.057088 143.35 111616
+452.168704 143.35 111616
+452.280320 143.35 111616
+452.391936 143.35 111616
+452.503552 143.35 111616
+452.615168 143.35 111616
+452.726784 143.35 111616
+452.838400 143.35 111616
+452.950016 143.35 111616
+453.061632 143.35 111616
+453.173248 143.35 111616
+453.284864 143.35 111616
+453.396480 143.35 111616
+453.508096 143.35 111616
+453.619712 143.35 111616
+453.731328 143.35 111616
+453.842944 143.35 111616
+453.954560 143.35 111616
+454.066176 143.35 111616
+454.177280 144.01 111104
+454.288384 144.01 111104
+454.399488 144.01 111104
+454.510592 144.01 111104
+454.621696 144.01 111104
+454.732800 144.01 111104
+454.843904 144.01 111104
+454.955008 144.01 111104
+455.066112 144.01 111104
+455.177216 144.01 111104
+455.288320 144.01 111104
+455.399424 144.01 111104
+455.510528 144.01 111104
+455.621632 144.01 111104
+455.732736 144.01 111104
+455.843840 144.01 111104
+455.954432 144.68 110592
+456.065024 144.68 110592
+456.175616 144.68 110592
+456.286208 144.68 110592
+456.396800 144.68 110592
+456.507392 144.68 110592
+456.617984 144.68 110592
+456.728576 144.68 110592
+456.839168 144.68 110592
+456.949760 144.68 110592
+457.060352 144.68 110592
+457.170944 144.68 110592
+457.281536 144.68 110592
+457.392128 144.68 110592
+457.502720 144.68 110592
+457.613312 144.68 110592
+457.722880 146.03 109568
+457.832448 146.03 109568
+457.942016 146.03 109568
+458.051584 146.03 109568
+458.161152 146.03 109568
+458.270720 146.03 109568
+458.380288 146.03 109568
+458.489856 146.03 109568
+458.599424 146.03 109568
+458.708992 146.03 109568
+458.818560 146.03 109568
+458.928128 146.03 109568
+459.037696 146.03 109568
+459.147264 146.03 109568
+459.256832 146.03 109568
+459.366400 146.03 109568
+459.475968 146.03 109568
+459.585536 146.03 109568
+459.695104 146.03 109568
+459.804672 146.03 109568
+459.914240 146.03 109568
+460.023808 146.03 109568
+460.133376 146.03 109568
+460.242944 146.03 109568
+460.352512 146.03 109568
+460.462080 146.03 109568
+460.571648 146.03 109568
+460.681216 146.03 109568
+460.790784 146.03 109568
+460.900352 146.03 109568
+461.009920 146.03 109568
+461.119488 146.03 109568
+461.228544 146.71 109056
+461.337600 146.71 109056
+461.446656 146.71 109056
+461.555712 146.71 109056
+461.664768 146.71 109056
+461.773824 146.71 109056
+461.882880 146.71 109056
+461.991936 146.71 109056
+462.100992 146.71 109056
+462.210048 146.71 109056
+462.319104 146.71 109056
+462.428160 146.71 109056
+462.537216 146.71 109056
+462.646272 146.71 109056
+462.755328 146.71 109056
+462.864384 146.71 109056
+462.972928 147.41 108544
+463.081472 147.41 108544
+463.190016 147.41 108544
+463.298560 147.41 108544
+463.407104 147.41 108544
+463.515648 147.41 108544
+463.624192 147.41 108544
+463.732736 147.41 108544
+463.841280 147.41 108544
+463.949824 147.41 108544
+464.058368 147.41 108544
+464.166912 147.41 108544
+464.275456 147.41 108544
+464.384000 147.41 108544
+464.492544 147.41 108544
+464.601088 147.41 108544
+464.709632 147.41 108544
+464.818176 147.41 108544
+464.926720 147.41 108544
+465.035264 147.41 108544
+465.143808 147.41 108544
+465.252352 147.41 108544
+465.360896 147.41 108544
+465.469440 147.41 108544
+465.577984 147.41 108544
+465.686528 147.41 108544
+465.795072 147.41 108544
+465.903616 147.41 108544
+466.012160 147.41 108544
+466.120704 147.41 108544
+466.229248 147.41 108544
+466.337792 147.41 108544
+466.445824 148.10 108032
+466.553856 148.10 108032
+466.661888 148.10 108032
+466.769920 148.10 108032
+466.877952 148.10 108032
+466.985984 148.10 108032
+467.094016 148.10 108032
+467.202048 148.10 108032
+467.310080 148.10 108032
+467.418112 148.10 108032
+467.526144 148.10 108032
+467.634176 148.10 108032
+467.742208 148.10 108032
+467.850240 148.10 108032
+467.958272 148.10 108032
+468.066304 148.10 108032
+468.173824 148.81 107520
+468.281344 148.81 107520
+468.388864 148.81 107520
+468.496384 148.81 107520
+468.603904 148.81 107520
+468.711424 148.81 107520
+468.818944 148.81 107520
+468.926464 148.81 107520
+469.033984 148.81 107520
+469.141504 148.81 107520
+469.249024 148.81 107520
+469.356544 148.81 107520
+469.464064 148.81 107520
+469.571584 148.81 107520
+469.679104 148.81 107520
+469.786624 148.81 107520
+469.894144 148.81 107520
+470.001664 148.81 107520
+470.109184 148.81 107520
+470.216704 148.81 107520
+470.324224 148.81 107520
+470.431744 148.81 107520
+470.539264 148.81 107520
+470.646784 148.81 107520
+470.754304 148.81 107520
+470.861824 148.81 107520
+470.969344 148.81 107520
+471.076864 148.81 107520
+471.184384 148.81 107520
+471.291904 148.81 107520
+471.399424 148.81 107520
+471.506944 148.81 107520
+471.613952 149.52 107008
+471.720960 149.52 107008
+471.827968 149.52 107008
+471.934976 149.52 107008
+472.041984 149.52 107008
+472.148992 149.52 107008
+472.256000 149.52 107008
+472.363008 149.52 107008
+472.470016 149.52 107008
+472.577024 149.52 107008
+472.684032 149.52 107008
+472.791040 149.52 107008
+472.898048 149.52 107008
+473.005056 149.52 107008
+473.112064 149.52 107008
+473.219072 149.52 107008
+473.325568 150.24 106496
+473.432064 150.24 106496
+473.538560 150.24 106496
+473.645056 150.24 106496
+473.751552 150.24 106496
+473.858048 150.24 106496
+473.964544 150.24 106496
+474.071040 150.24 106496
+474.177536 150.24 106496
+474.284032 150.24 106496
+474.390528 150.24 106496
+474.497024 150.24 106496
+474.603520 150.24 106496
+474.710016 150.24 106496
+474.816512 150.24 106496
+474.923008 150.24 106496
+475.029504 150.24 106496
+475.136000 150.24 106496
+475.242496 150.24 106496
+475.348992 150.24 106496
+475.455488 150.24 106496
+475.561984 150.24 106496
+475.668480 150.24 106496
+475.774976 150.24 106496
+475.881472 150.24 106496
+475.987968 150.24 106496
+476.094464 150.24 106496
+476.200960 150.24 106496
+476.307456 150.24 106496
+476.413952 150.24 106496
+476.520448 150.24 106496
+476.626944 150.24 106496
+476.732416 151.70 105472
+476.837888 151.70 105472
+476.943360 151.70 105472
+477.048832 151.70 105472
+477.154304 151.70 105472
+477.259776 151.70 105472
+477.365248 151.70 105472
+477.470720 151.70 105472
+477.576192 151.70 105472
+477.681664 151.70 105472
+477.787136 151.70 105472
+477.892608 151.70 105472
+477.998080 151.70 105472
+478.103552 151.70 105472
+478.209024 151.70 105472
+478.314496 151.70 105472
+478.419456 152.44 104960
+478.524416 152.44 104960
+478.629376 152.44 104960
+478.734336 152.44 104960
+478.839296 152.44 104960
+478.944256 152.44 104960
+479.049216 152.44 104960
+479.154176 152.44 104960
+479.259136 152.44 104960
+479.364096 152.44 104960
+479.469056 152.44 104960
+479.574016 152.44 104960
+479.678976 152.44 104960
+479.783936 152.44 104960
+479.888896 152.44 104960
+479.993856 152.44 104960
+480.098816 152.44 104960
+480.203776 152.44 104960
+480.308736 152.44 104960
+480.413696 152.44 104960
+480.518656 152.44 104960
+480.623616 152.44 104960
+480.728576 152.44 104960
+480.833536 152.44 104960
+480.938496 152.44 104960
+481.043456 152.44 104960
+481.148416 152.44 104960
+481.253376 152.44 104960
+481.358336 152.44 104960
+481.463296 152.44 104960
+481.568256 152.44 104960
+481.673216 152.44 104960
+481.777664 153.19 104448
+481.882112 153.19 104448
+481.986560 153.19 104448
+482.091008 153.19 104448
+482.195456 153.19 104448
+482.299904 153.19 104448
+482.404352 153.19 104448
+482.508800 153.19 104448
+482.613248 153.19 104448
+482.717696 153.19 104448
+482.822144 153.19 104448
+482.926592 153.19 104448
+483.031040 153.19 104448
+483.135488 153.19 104448
+483.239936 153.19 104448
+483.344384 153.19 104448
+483.448832 153.19 104448
+483.553280 153.19 104448
+483.657728 153.19 104448
+483.762176 153.19 104448
+483.866624 153.19 104448
+483.971072 153.19 104448
+484.075520 153.19 104448
+484.179968 153.19 104448
+484.284416 153.19 104448
+484.388864 153.19 104448
+484.493312 153.19 104448
+484.597760 153.19 104448
+484.702208 153.19 104448
+484.806656 153.19 104448
+484.911104 153.19 104448
+485.015552 153.19 104448
+485.119488 153.94 103936
+485.223424 153.94 103936
+485.327360 153.94 103936
+485.431296 153.94 103936
+485.535232 153.94 103936
+485.639168 153.94 103936
+485.743104 153.94 103936
+485.847040 153.94 103936
+485.950976 153.94 103936
+486.054912 153.94 103936
+486.158848 153.94 103936
+486.262784 153.94 103936
+486.366720 153.94 103936
+486.470656 153.94 103936
+486.574592 153.94 103936
+486.678528 153.94 103936
+486.781952 154.70 103424
+486.885376 154.70 103424
+486.988800 154.70 103424
+487.092224 154.70 103424
+487.195648 154.70 103424
+487.299072 154.70 103424
+487.402496 154.70 103424
+487.505920 154.70 103424
+487.609344 154.70 103424
+487.712768 154.70 103424
+487.816192 154.70 103424
+487.919616 154.70 103424
+488.023040 154.70 103424
+488.126464 154.70 103424
+488.229888 154.70 103424
+488.333312 154.70 103424
+488.436736 154.70 103424
+488.540160 154.70 103424
+488.643584 154.70 103424
+488.747008 154.70 103424
+488.850432 154.70 103424
+488.953856 154.70 103424
+489.057280 154.70 103424
+489.160704 154.70 103424
+489.264128 154.70 103424
+489.367552 154.70 103424
+489.470976 154.70 103424
+489.574400 154.70 103424
+489.677824 154.70 103424
+489.781248 154.70 103424
+489.884672 154.70 103424
+489.988096 154.70 103424
+490.091008 155.47 102912
+490.193920 155.47 102912
+490.296832 155.47 102912
+490.399744 155.47 102912
+490.502656 155.47 102912
+490.605568 155.47 102912
+490.708480 155.47 102912
+490.811392 155.47 102912
+490.914304 155.47 102912
+491.017216 155.47 102912
+491.120128 155.47 102912
+491.223040 155.47 102912
+491.325952 155.47 102912
+491.428864 155.47 102912
+491.531776 155.47 102912
+491.634688 155.47 102912
+491.737088 156.25 102400
+491.839488 156.25 102400
+491.941888 156.25 102400
+492.044288 156.25 102400
+492.146688 156.25 102400
+492.249088 156.25 102400
+492.351488 156.25 102400
+492.453888 156.25 102400
+492.556288 156.25 102400
+492.658688 156.25 102400
+492.761088 156.25 102400
+492.863488 156.25 102400
+492.965888 156.25 102400
+493.068288 156.25 102400
+493.170688 156.25 102400
+493.273088 156.25 102400
+493.375488 156.25 102400
+493.477888 156.25 102400
+493.580288 156.25 102400
+493.682688 156.25 102400
+493.785088 156.25 102400
+493.887488 156.25 102400
+493.989888 156.25 102400
+494.092288 156.25 102400
+494.194688 156.25 102400
+494.297088 156.25 102400
+494.399488 156.25 102400
+494.501888 156.25 102400
+494.604288 156.25 102400
+494.706688 156.25 102400
+494.809088 156.25 102400
+494.911488 156.25 102400
+495.013376 157.04 101888
+495.115264 157.04 101888
+495.217152 157.04 101888
+495.319040 157.04 101888
+495.420928 157.04 101888
+495.522816 157.04 101888
+495.624704 157.04 101888
+495.726592 157.04 101888
+495.828480 157.04 101888
+495.930368 157.04 101888
+496.032256 157.04 101888
+496.134144 157.04 101888
+496.236032 157.04 101888
+496.337920 157.04 101888
+496.439808 157.04 101888
+496.541696 157.04 101888
+496.643584 157.04 101888
+496.745472 157.04 101888
+496.847360 157.04 101888
+496.949248 157.04 101888
+497.051136 157.04 101888
+497.153024 157.04 101888
+497.254912 157.04 101888
+497.356800 157.04 101888
+497.458688 157.04 101888
+497.560576 157.04 101888
+497.662464 157.04 101888
+497.764352 157.04 101888
+497.866240 157.04 101888
+497.968128 157.04 101888
+498.070016 157.04 101888
+498.171904 157.04 101888
+498.273280 157.83 101376
+498.374656 157.83 101376
+498.476032 157.83 101376
+498.577408 157.83 101376
+498.678784 157.83 101376
+498.780160 157.83 101376
+498.881536 157.83 101376
+498.982912 157.83 101376
+499.084288 157.83 101376
+499.185664 157.83 101376
+499.287040 157.83 101376
+499.388416 157.83 101376
+499.489792 157.83 101376
+499.591168 157.83 101376
+499.692544 157.83 101376
+499.793920 157.83 101376
+499.894784 158.63 100864
+499.995648 158.63 100864
+500.096512 158.63 100864
+500.197376 158.63 100864
+500.298240 158.63 100864
+500.399104 158.63 100864
+500.499968 158.63 100864
+500.600832 158.63 100864
+500.701696 158.63 100864
+500.802560 158.63 100864
+500.903424 158.63 100864
+501.004288 158.63 100864
+501.105152 158.63 100864
+501.206016 158.63 100864
+501.306880 158.63 100864
+501.407744 158.63 100864
+501.508608 158.63 100864
+501.609472 158.63 100864
+501.710336 158.63 100864
+501.811200 158.63 100864
+501.912064 158.63 100864
+502.012928 158.63 100864
+502.113792 158.63 100864
+502.214656 158.63 100864
+502.315520 158.63 100864
+502.416384 158.63 100864
+502.517248 158.63 100864
+502.618112 158.63 100864
+502.718976 158.63 100864
+502.819840 158.63 100864
+502.920704 158.63 100864
+503.021568 158.63 100864
+503.121920 159.44 100352
+503.222272 159.44 100352
+503.322624 159.44 100352
+503.422976 159.44 100352
+503.523328 159.44 100352
+503.623680 159.44 100352
+503.724032 159.44 100352
+503.824384 159.44 100352
+503.924736 159.44 100352
+504.025088 159.44 100352
+504.125440 159.44 100352
+504.225792 159.44 100352
+504.326144 159.44 100352
+504.426496 159.44 100352
+504.526848 159.44 100352
+504.627200 159.44 100352
+504.727552 159.44 100352
+504.827904 159.44 100352
+504.928256 159.44 100352
+505.028608 159.44 100352
+505.128960 159.44 100352
+505.229312 159.44 100352
+505.329664 159.44 100352
+505.430016 159.44 100352
+505.530368 159.44 100352
+505.630720 159.44 100352
+505.731072 159.44 100352
+505.831424 159.44 100352
+505.931776 159.44 100352
+506.032128 159.44 100352
+506.132480 159.44 100352
+506.232832 159.44 100352
+506.332160 161.08 99328
+506.431488 161.08 99328
+506.530816 161.08 99328
+506.630144 161.08 99328
+506.729472 161.08 99328
+506.828800 161.08 99328
+506.928128 161.08 99328
+507.027456 161.08 99328
+507.126784 161.08 99328
+507.226112 161.08 99328
+507.325440 161.08 99328
+507.424768 161.08 99328
+507.524096 161.08 99328
+507.623424 161.08 99328
+507.722752 161.08 99328
+507.822080 161.08 99328
+507.921408 161.08 99328
+508.020736 161.08 99328
+508.120064 161.08 99328
+508.219392 161.08 99328
+508.318720 161.08 99328
+508.418048 161.08 99328
+508.517376 161.08 99328
+508.616704 161.08 99328
+508.716032 161.08 99328
+508.815360 161.08 99328
+508.914688 161.08 99328
+509.014016 161.08 99328
+509.113344 161.08 99328
+509.212672 161.08 99328
+509.312000 161.08 99328
+509.411328 161.08 99328
+509.510144 161.92 98816
+509.608960 161.92 98816
+509.707776 161.92 98816
+509.806592 161.92 98816
+509.905408 161.92 98816
+510.004224 161.92 98816
+510.103040 161.92 98816
+510.201856 161.92 98816
+510.300672 161.92 98816
+510.399488 161.92 98816
+510.498304 161.92 98816
+510.597120 161.92 98816
+510.695936 161.92 98816
+510.794752 161.92 98816
+510.893568 161.92 98816
+510.992384 161.92 98816
+511.090688 162.76 98304
+511.188992 162.76 98304
+511.287296 162.76 98304
+511.385600 162.76 98304
+511.483904 162.76 98304
+511.582208 162.76 98304
+511.680512 162.76 98304
+511.778816 162.76 98304
+511.877120 162.76 98304
+511.975424 162.76 98304
+512.073728 162.76 98304
+512.172032 162.76 98304
+512.270336 162.76 98304
+512.368640 162.76 98304
+512.466944 162.76 98304
+512.565248 162.76 98304
+512.663552 162.76 98304
+512.761856 162.76 98304
+512.860160 162.76 98304
+512.958464 162.76 98304
+513.056768 162.76 98304
+513.155072 162.76 98304
+513.253376 162.76 98304
+513.351680 162.76 98304
+513.449984 162.76 98304
+513.548288 162.76 98304
+513.646592 162.76 98304
+513.744896 162.76 98304
+513.843200 162.76 98304
+513.941504 162.76 98304
+514.039808 162.76 98304
+514.138112 162.76 98304
+514.235904 163.61 97792
+514.333696 163.61 97792
+514.431488 163.61 97792
+514.529280 163.61 97792
+514.627072 163.61 97792
+514.724864 163.61 97792
+514.822656 163.61 97792
+514.920448 163.61 97792
+515.018240 163.61 97792
+515.116032 163.61 97792
+515.213824 163.61 97792
+515.311616 163.61 97792
+515.409408 163.61 97792
+515.507200 163.61 97792
+515.604992 163.61 97792
+515.702784 163.61 97792
+515.800576 163.61 97792
+515.898368 163.61 97792
+515.996160 163.61 97792
+516.093952 163.61 97792
+516.191744 163.61 97792
+516.289536 163.61 97792
+516.387328 163.61 97792
+516.485120 163.61 97792
+516.582912 163.61 97792
+516.680704 163.61 97792
+516.778496 163.61 97792
+516.876288 163.61 97792
+516.974080 163.61 97792
+517.071872 163.61 97792
+517.169664 163.61 97792
+517.267456 163.61 97792
+517.364736 164.47 97280
+517.462016 164.47 97280
+517.559296 164.47 97280
+517.656576 164.47 97280
+517.753856 164.47 97280
+517.851136 164.47 97280
+517.948416 164.47 97280
+518.045696 164.47 97280
+518.142976 164.47 97280
+518.240256 164.47 97280
+518.337536 164.47 97280
+518.434816 164.47 97280
+518.532096 164.47 97280
+518.629376 164.47 97280
+518.726656 164.47 97280
+518.823936 164.47 97280
+518.921216 164.47 97280
+519.018496 164.47 97280
+519.115776 164.47 97280
+519.213056 164.47 97280
+519.310336 164.47 97280
+519.407616 164.47 97280
+519.504896 164.47 97280
+519.602176 164.47 97280
+519.699456 164.47 97280
+519.796736 164.47 97280
+519.894016 164.47 97280
+519.991296 164.47 97280
+520.088576 164.47 97280
+520.185856 164.47 97280
+520.283136 164.47 97280
+520.380416 164.47 97280
+520.477184 165.34 96768
+520.573952 165.34 96768
+520.670720 165.34 96768
+520.767488 165.34 96768
+520.864256 165.34 96768
+520.961024 165.34 96768
+521.057792 165.34 96768
+521.154560 165.34 96768
+521.251328 165.34 96768
+521.348096 165.34 96768
+521.444864 165.34 96768
+521.541632 165.34 96768
+521.638400 165.34 96768
+521.735168 165.34 96768
+521.831936 165.34 96768
+521.928704 165.34 96768
+522.025472 165.34 96768
+522.122240 165.34 96768
+522.219008 165.34 96768
+522.315776 165.34 96768
+522.412544 165.34 96768
+522.509312 165.34 96768
+522.606080 165.34 96768
+522.702848 165.34 96768
+522.799616 165.34 96768
+522.896384 165.34 96768
+522.993152 165.34 96768
+523.089920 165.34 96768
+523.186688 165.34 96768
+523.283456 165.34 96768
+523.380224 165.34 96768
+523.476992 165.34 96768
+523.573248 166.22 96256
+523.669504 166.22 96256
+523.765760 166.22 96256
+523.862016 166.22 96256
+523.958272 166.22 96256
+524.054528 166.22 96256
+524.150784 166.22 96256
+524.247040 166.22 96256
+524.343296 166.22 96256
+524.439552 166.22 96256
+524.535808 166.22 96256
+524.632064 166.22 96256
+524.728320 166.22 96256
+524.824576 166.22 96256
+524.920832 166.22 96256
+525.017088 166.22 96256
+525.113344 166.22 96256
+525.209600 166.22 96256
+525.305856 166.22 96256
+525.402112 166.22 96256
+525.498368 166.22 96256
+525.594624 166.22 96256
+525.690880 166.22 96256
+525.787136 166.22 96256
+525.883392 166.22 96256
+525.979648 166.22 96256
+526.075904 166.22 96256
+526.172160 166.22 96256
+526.268416 166.22 96256
+526.364672 166.22 96256
+526.460928 166.22 96256
+526.557184 166.22 96256
+526.652928 167.11 95744
+526.748672 167.11 95744
+526.844416 167.11 95744
+526.940160 167.11 95744
+527.035904 167.11 95744
+527.131648 167.11 95744
+527.227392 167.11 95744
+527.323136 167.11 95744
+527.418880 167.11 95744
+527.514624 167.11 95744
+527.610368 167.11 95744
+527.706112 167.11 95744
+527.801856 167.11 95744
+527.897600 167.11 95744
+527.993344 167.11 95744
+528.089088 167.11 95744
+528.184320 168.01 95232
+528.279552 168.01 95232
+528.374784 168.01 95232
+528.470016 168.01 95232
+528.565248 168.01 95232
+528.660480 168.01 95232
+528.755712 168.01 95232
+528.850944 168.01 95232
+528.946176 168.01 95232
+529.041408 168.01 95232
+529.136640 168.01 95232
+529.231872 168.01 95232
+529.327104 168.01 95232
+529.422336 168.01 95232
+529.517568 168.01 95232
+529.612800 168.01 95232
+529.708032 168.01 95232
+529.803264 168.01 95232
+529.898496 168.01 95232
+529.993728 168.01 95232
+530.088960 168.01 95232
+530.184192 168.01 95232
+530.279424 168.01 95232
+530.374656 168.01 95232
+530.469888 168.01 95232
+530.565120 168.01 95232
+530.660352 168.01 95232
+530.755584 168.01 95232
+530.850816 168.01 95232
+530.946048 168.01 95232
+531.041280 168.01 95232
+531.136512 168.01 95232
+531.231232 168.92 94720
+531.325952 168.92 94720
+531.420672 168.92 94720
+531.515392 168.92 94720
+531.610112 168.92 94720
+531.704832 168.92 94720
+531.799552 168.92 94720
+531.894272 168.92 94720
+531.988992 168.92 94720
+532.083712 168.92 94720
+532.178432 168.92 94720
+532.273152 168.92 94720
+532.367872 168.92 94720
+532.462592 168.92 94720
+532.557312 168.92 94720
+532.652032 168.92 94720
+532.746752 168.92 94720
+532.841472 168.92 94720
+532.936192 168.92 94720
+533.030912 168.92 94720
+533.125632 168.92 94720
+533.220352 168.92 94720
+533.315072 168.92 94720
+533.409792 168.92 94720
+533.504512 168.92 94720
+533.599232 168.92 94720
+533.693952 168.92 94720
+533.788672 168.92 94720
+533.883392 168.92 94720
+533.978112 168.92 94720
+534.072832 168.92 94720
+534.167552 168.92 94720
+534.261760 169.84 94208
+534.355968 169.84 94208
+534.450176 169.84 94208
+534.544384 169.84 94208
+534.638592 169.84 94208
+534.732800 169.84 94208
+534.827008 169.84 94208
+534.921216 169.84 94208
+535.015424 169.84 94208
+535.109632 169.84 94208
+535.203840 169.84 94208
+535.298048 169.84 94208
+535.392256 169.84 94208
+535.486464 169.84 94208
+535.580672 169.84 94208
+535.674880 169.84 94208
+535.769088 169.84 94208
+535.863296 169.84 94208
+535.957504 169.84 94208
+536.051712 169.84 94208
+536.145920 169.84 94208
+536.240128 169.84 94208
+536.334336 169.84 94208
+536.428544 169.84 94208
+536.522752 169.84 94208
+536.616960 169.84 94208
+536.711168 169.84 94208
+536.805376 169.84 94208
+536.899584 169.84 94208
+536.993792 169.84 94208
+537.088000 169.84 94208
+537.182208 169.84 94208
+537.275904 170.77 93696
+537.369600 170.77 93696
+537.463296 170.77 93696
+537.556992 170.77 93696
+537.650688 170.77 93696
+537.744384 170.77 93696
+537.838080 170.77 93696
+537.931776 170.77 93696
+538.025472 170.77 93696
+538.119168 170.77 93696
+538.212864 170.77 93696
+538.306560 170.77 93696
+538.400256 170.77 93696
+538.493952 170.77 93696
+538.587648 170.77 93696
+538.681344 170.77 93696
+538.775040 170.77 93696
+538.868736 170.77 93696
+538.962432 170.77 93696
+539.056128 170.77 93696
+539.149824 170.77 93696
+539.243520 170.77 93696
+539.337216 170.77 93696
+539.430912 170.77 93696
+539.524608 170.77 93696
+539.618304 170.77 93696
+539.712000 170.77 93696
+539.805696 170.77 93696
+539.899392 170.77 93696
+539.993088 170.77 93696
+540.086784 170.77 93696
+540.180480 170.77 93696
+540.273664 171.70 93184
+540.366848 171.70 93184
+540.460032 171.70 93184
+540.553216 171.70 93184
+540.646400 171.70 93184
+540.739584 171.70 93184
+540.832768 171.70 93184
+540.925952 171.70 93184
+541.019136 171.70 93184
+541.112320 171.70 93184
+541.205504 171.70 93184
+541.298688 171.70 93184
+541.391872 171.70 93184
+541.485056 171.70 93184
+541.578240 171.70 93184
+541.671424 171.70 93184
+541.764608 171.70 93184
+541.857792 171.70 93184
+541.950976 171.70 93184
+542.044160 171.70 93184
+542.137344 171.70 93184
+542.230528 171.70 93184
+542.323712 171.70 93184
+542.416896 171.70 93184
+542.510080 171.70 93184
+542.603264 171.70 93184
+542.696448 171.70 93184
+542.789632 171.70 93184
+542.882816 171.70 93184
+542.976000 171.70 93184
+543.069184 171.70 93184
+543.162368 171.70 93184
+543.255040 172.65 92672
+543.347712 172.65 92672
+543.440384 172.65 92672
+543.533056 172.65 92672
+543.625728 172.65 92672
+543.718400 172.65 92672
+543.811072 172.65 92672
+543.903744 172.65 92672
+543.996416 172.65 92672
+544.089088 172.65 92672
+544.181760 172.65 92672
+544.274432 172.65 92672
+544.367104 172.65 92672
+544.459776 172.65 92672
+544.552448 172.65 92672
+544.645120 172.65 92672
+544.737792 172.65 92672
+544.830464 172.65 92672
+544.923136 172.65 92672
+545.015808 172.65 92672
+545.108480 172.65 92672
+545.201152 172.65 92672
+545.293824 172.65 92672
+545.386496 172.65 92672
+545.479168 172.65 92672
+545.571840 172.65 92672
+545.664512 172.65 92672
+545.757184 172.65 92672
+545.849856 172.65 92672
+545.942528 172.65 92672
+546.035200 172.65 92672
+546.127872 172.65 92672
+546.220032 173.61 92160
+546.312192 173.61 92160
+546.404352 173.61 92160
+546.496512 173.61 92160
+546.588672 173.61 92160
+546.680832 173.61 92160
+546.772992 173.61 92160
+546.865152 173.61 92160
+546.957312 173.61 92160
+547.049472 173.61 92160
+547.141632 173.61 92160
+547.233792 173.61 92160
+547.325952 173.61 92160
+547.418112 173.61 92160
+547.510272 173.61 92160
+547.602432 173.61 92160
+547.694592 173.61 92160
+547.786752 173.61 92160
+547.878912 173.61 92160
+547.971072 173.61 92160
+548.063232 173.61 92160
+548.155392 173.61 92160
+548.247552 173.61 92160
+548.339712 173.61 92160
+548.431872 173.61 92160
+548.524032 173.61 92160
+548.616192 173.61 92160
+548.708352 173.61 92160
+548.800512 173.61 92160
+548.892672 173.61 92160
+548.984832 173.61 92160
+549.076992 173.61 92160
+549.168640 174.58 91648
+549.260288 174.58 91648
+549.351936 174.58 91648
+549.443584 174.58 91648
+549.535232 174.58 91648
+549.626880 174.58 91648
+549.718528 174.58 91648
+549.810176 174.58 91648
+549.901824 174.58 91648
+549.993472 174.58 91648
+550.085120 174.58 91648
+550.176768 174.58 91648
+550.268416 174.58 91648
+550.360064 174.58 91648
+550.451712 174.58 91648
+550.543360 174.58 91648
+550.635008 174.58 91648
+550.726656 174.58 91648
+550.818304 174.58 91648
+550.909952 174.58 91648
+551.001600 174.58 91648
+551.093248 174.58 91648
+551.184896 174.58 91648
+551.276544 174.58 91648
+551.368192 174.58 91648
+551.459840 174.58 91648
+551.551488 174.58 91648
+551.643136 174.58 91648
+551.734784 174.58 91648
+551.826432 174.58 91648
+551.918080 174.58 91648
+552.009728 174.58 91648
+552.100864 175.56 91136
+552.192000 175.56 91136
+552.283136 175.56 91136
+552.374272 175.56 91136
+552.465408 175.56 91136
+552.556544 175.56 91136
+552.647680 175.56 91136
+552.738816 175.56 91136
+552.829952 175.56 91136
+552.921088 175.56 91136
+553.012224 175.56 91136
+553.103360 175.56 91136
+553.194496 175.56 91136
+553.285632 175.56 91136
+553.376768 175.56 91136
+553.467904 175.56 91136
+553.559040 175.56 91136
+553.650176 175.56 91136
+553.741312 175.56 91136
+553.832448 175.56 91136
+553.923584 175.56 91136
+554.014720 175.56 91136
+554.105856 175.56 91136
+554.196992 175.56 91136
+554.288128 175.56 91136
+554.379264 175.56 91136
+554.470400 175.56 91136
+554.561536 175.56 91136
+554.652672 175.56 91136
+554.743808 175.56 91136
+554.834944 175.56 91136
+554.926080 175.56 91136
+555.016704 176.55 90624
+555.107328 176.55 90624
+555.197952 176.55 90624
+555.288576 176.55 90624
+555.379200 176.55 90624
+555.469824 176.55 90624
+555.560448 176.55 90624
+555.651072 176.55 90624
+555.741696 176.55 90624
+555.832320 176.55 90624
+555.922944 176.55 90624
+556.013568 176.55 90624
+556.104192 176.55 90624
+556.194816 176.55 90624
+556.285440 176.55 90624
+556.376064 176.55 90624
+556.466688 176.55 90624
+556.557312 176.55 90624
+556.647936 176.55 90624
+556.738560 176.55 90624
+556.829184 176.55 90624
+556.919808 176.55 90624
+557.010432 176.55 90624
+557.101056 176.55 90624
+557.191680 176.55 90624
+557.282304 176.55 90624
+557.372928 176.55 90624
+557.463552 176.55 90624
+557.554176 176.55 90624
+557.644800 176.55 90624
+557.735424 176.55 90624
+557.826048 176.55 90624
+557.916160 177.56 90112
+558.006272 177.56 90112
+558.096384 177.56 90112
+558.186496 177.56 90112
+558.276608 177.56 90112
+558.366720 177.56 90112
+558.456832 177.56 90112
+558.546944 177.56 90112
+558.637056 177.56 90112
+558.727168 177.56 90112
+558.817280 177.56 90112
+558.907392 177.56 90112
+558.997504 177.56 90112
+559.087616 177.56 90112
+559.177728 177.56 90112
+559.267840 177.56 90112
+559.357952 177.56 90112
+559.448064 177.56 90112
+559.538176 177.56 90112
+559.628288 177.56 90112
+559.718400 177.56 90112
+559.808512 177.56 90112
+559.898624 177.56 90112
+559.988736 177.56 90112
+560.078848 177.56 90112
+560.168960 177.56 90112
+560.259072 177.56 90112
+560.349184 177.56 90112
+560.439296 177.56 90112
+560.529408 177.56 90112
+560.619520 177.56 90112
+560.709632 177.56 90112
+560.799744 177.56 90112
+560.889856 177.56 90112
+560.979968 177.56 90112
+561.070080 177.56 90112
+561.160192 177.56 90112
+561.250304 177.56 90112
+561.340416 177.56 90112
+561.430528 177.56 90112
+561.520640 177.56 90112
+561.610752 177.56 90112
+561.700864 177.56 90112
+561.790976 177.56 90112
+561.881088 177.56 90112
+561.971200 177.56 90112
+562.061312 177.56 90112
+562.151424 177.56 90112
+562.241024 178.57 89600
+562.330624 178.57 89600
+562.420224 178.57 89600
+562.509824 178.57 89600
+562.599424 178.57 89600
+562.689024 178.57 89600
+562.778624 178.57 89600
+562.868224 178.57 89600
+562.957824 178.57 89600
+563.047424 178.57 89600
+563.137024 178.57 89600
+563.226624 178.57 89600
+563.316224 178.57 89600
+563.405824 178.57 89600
+563.495424 178.57 89600
+563.585024 178.57 89600
+563.674624 178.57 89600
+563.764224 178.57 89600
+563.853824 178.57 89600
+563.943424 178.57 89600
+564.033024 178.57 89600
+564.122624 178.57 89600
+564.212224 178.57 89600
+564.301824 178.57 89600
+564.391424 178.57 89600
+564.481024 178.57 89600
+564.570624 178.57 89600
+564.660224 178.57 89600
+564.749824 178.57 89600
+564.839424 178.57 89600
+564.929024 178.57 89600
+565.018624 178.57 89600
+565.107712 179.60 89088
+565.196800 179.60 89088
+565.285888 179.60 89088
+565.374976 179.60 89088
+565.464064 179.60 89088
+565.553152 179.60 89088
+565.642240 179.60 89088
+565.731328 179.60 89088
+565.820416 179.60 89088
+565.909504 179.60 89088
+565.998592 179.60 89088
+566.087680 179.60 89088
+566.176768 179.60 89088
+566.265856 179.60 89088
+566.354944 179.60 89088
+566.444032 179.60 89088
+566.533120 179.60 89088
+566.622208 179.60 89088
+566.711296 179.60 89088
+566.800384 179.60 89088
+566.889472 179.60 89088
+566.978560 179.60 89088
+567.067648 179.60 89088
+567.156736 179.60 89088
+567.245824 179.60 89088
+567.334912 179.60 89088
+567.424000 179.60 89088
+567.513088 179.60 89088
+567.602176 179.60 89088
+567.691264 179.60 89088
+567.780352 179.60 89088
+567.869440 179.60 89088
+567.958528 179.60 89088
+568.047616 179.60 89088
+568.136704 179.60 89088
+568.225792 179.60 89088
+568.314880 179.60 89088
+568.403968 179.60 89088
+568.493056 179.60 89088
+568.582144 179.60 89088
+568.671232 179.60 89088
+568.760320 179.60 89088
+568.849408 179.60 89088
+568.938496 179.60 89088
+569.027584 179.60 89088
+569.116672 179.60 89088
+569.205760 179.60 89088
+569.294848 179.60 89088
+569.383936 179.60 89088
+569.473024 179.60 89088
+569.562112 179.60 89088
+569.651200 179.60 89088
+569.740288 179.60 89088
+569.829376 179.60 89088
+569.918464 179.60 89088
+570.007552 179.60 89088
+570.096640 179.60 89088
+570.185728 179.60 89088
+570.274816 179.60 89088
+570.363904 179.60 89088
+570.452992 179.60 89088
+570.542080 179.60 89088
+570.631168 179.60 89088
+570.720256 179.60 89088
+570.808832 180.64 88576
+570.897408 180.64 88576
+570.985984 180.64 88576
+571.074560 180.64 88576
+571.163136 180.64 88576
+571.251712 180.64 88576
+571.340288 180.64 88576
+571.428864 180.64 88576
+571.517440 180.64 88576
+571.606016 180.64 88576
+571.694592 180.64 88576
+571.783168 180.64 88576
+571.871744 180.64 88576
+571.960320 180.64 88576
+572.048896 180.64 88576
+572.137472 180.64 88576
+572.226048 180.64 88576
+572.314624 180.64 88576
+572.403200 180.64 88576
+572.491776 180.64 88576
+572.580352 180.64 88576
+572.668928 180.64 88576
+572.757504 180.64 88576
+572.846080 180.64 88576
+572.934656 180.64 88576
+573.023232 180.64 88576
+573.111808 180.64 88576
+573.200384 180.64 88576
+573.288960 180.64 88576
+573.377536 180.64 88576
+573.466112 180.64 88576
+573.554688 180.64 88576
+573.642752 181.69 88064
+573.730816 181.69 88064
+573.818880 181.69 88064
+573.906944 181.69 88064
+573.995008 181.69 88064
+574.083072 181.69 88064
+574.171136 181.69 88064
+574.259200 181.69 88064
+574.347264 181.69 88064
+574.435328 181.69 88064
+574.523392 181.69 88064
+574.611456 181.69 88064
+574.699520 181.69 88064
+574.787584 181.69 88064
+574.875648 181.69 88064
+574.963712 181.69 88064
+575.051776 181.69 88064
+575.139840 181.69 88064
+575.227904 181.69 88064
+575.315968 181.69 88064
+575.404032 181.69 88064
+575.492096 181.69 88064
+575.580160 181.69 88064
+575.668224 181.69 88064
+575.756288 181.69 88064
+575.844352 181.69 88064
+575.932416 181.69 88064
+576.020480 181.69 88064
+576.108544 181.69 88064
+576.196608 181.69 88064
+576.284672 181.69 88064
+576.372736 181.69 88064
+576.460800 181.69 88064
+576.548864 181.69 88064
+576.636928 181.69 88064
+576.724992 181.69 88064
+576.813056 181.69 88064
+576.901120 181.69 88064
+576.989184 181.69 88064
+577.077248 181.69 88064
+577.165312 181.69 88064
+577.253376 181.69 88064
+577.341440 181.69 88064
+577.429504 181.69 88064
+577.517568 181.69 88064
+577.605632 181.69 88064
+577.693696 181.69 88064
+577.781760 181.69 88064
+577.869312 182.75 87552
+577.956864 182.75 87552
+578.044416 182.75 87552
+578.131968 182.75 87552
+578.219520 182.75 87552
+578.307072 182.75 87552
+578.394624 182.75 87552
+578.482176 182.75 87552
+578.569728 182.75 87552
+578.657280 182.75 87552
+578.744832 182.75 87552
+578.832384 182.75 87552
+578.919936 182.75 87552
+579.007488 182.75 87552
+579.095040 182.75 87552
+579.182592 182.75 87552
+579.270144 182.75 87552
+579.357696 182.75 87552
+579.445248 182.75 87552
+579.532800 182.75 87552
+579.620352 182.75 87552
+579.707904 182.75 87552
+579.795456 182.75 87552
+579.883008 182.75 87552
+579.970560 182.75 87552
+580.058112 182.75 87552
+580.145664 182.75 87552
+580.233216 182.75 87552
+580.320768 182.75 87552
+580.408320 182.75 87552
+580.495872 182.75 87552
+580.583424 182.75 87552
+580.670464 183.82 87040
+580.757504 183.82 87040
+580.844544 183.82 87040
+580.931584 183.82 87040
+581.018624 183.82 87040
+581.105664 183.82 87040
+581.192704 183.82 87040
+581.279744 183.82 87040
+581.366784 183.82 87040
+581.453824 183.82 87040
+581.540864 183.82 87040
+581.627904 183.82 87040
+581.714944 183.82 87040
+581.801984 183.82 87040
+581.889024 183.82 87040
+581.976064 183.82 87040
+582.063104 183.82 87040
+582.150144 183.82 87040
+582.237184 183.82 87040
+582.324224 183.82 87040
+582.411264 183.82 87040
+582.498304 183.82 87040
+582.585344 183.82 87040
+582.672384 183.82 87040
+582.759424 183.82 87040
+582.846464 183.82 87040
+582.933504 183.82 87040
+583.020544 183.82 87040
+583.107584 183.82 87040
+583.194624 183.82 87040
+583.281664 183.82 87040
+583.368704 183.82 87040
+583.455232 184.91 86528
+583.541760 184.91 86528
+583.628288 184.91 86528
+583.714816 184.91 86528
+583.801344 184.91 86528
+583.887872 184.91 86528
+583.974400 184.91 86528
+584.060928 184.91 86528
+584.147456 184.91 86528
+584.233984 184.91 86528
+584.320512 184.91 86528
+584.407040 184.91 86528
+584.493568 184.91 86528
+584.580096 184.91 86528
+584.666624 184.91 86528
+584.753152 184.91 86528
+584.839680 184.91 86528
+584.926208 184.91 86528
+585.012736 184.91 86528
+585.099264 184.91 86528
+585.185792 184.91 86528
+585.272320 184.91 86528
+585.358848 184.91 86528
+585.445376 184.91 86528
+585.531904 184.91 86528
+585.618432 184.91 86528
+585.704960 184.91 86528
+585.791488 184.91 86528
+585.878016 184.91 86528
+585.964544 184.91 86528
+586.051072 184.91 86528
+586.137600 184.91 86528
+586.223616 186.01 86016
+586.309632 186.01 86016
+586.395648 186.01 86016
+586.481664 186.01 86016
+586.567680 186.01 86016
+586.653696 186.01 86016
+586.739712 186.01 86016
+586.825728 186.01 86016
+586.911744 186.01 86016
+586.997760 186.01 86016
+587.083776 186.01 86016
+587.169792 186.01 86016
+587.255808 186.01 86016
+587.341824 186.01 86016
+587.427840 186.01 86016
+587.513856 186.01 86016
+587.599872 186.01 86016
+587.685888 186.01 86016
+587.771904 186.01 86016
+587.857920 186.01 86016
+587.943936 186.01 86016
+588.029952 186.01 86016
+588.115968 186.01 86016
+588.201984 186.01 86016
+588.288000 186.01 86016
+588.374016 186.01 86016
+588.460032 186.01 86016
+588.546048 186.01 86016
+588.632064 186.01 86016
+588.718080 186.01 86016
+588.804096 186.01 86016
+588.890112 186.01 86016
+588.976128 186.01 86016
+589.062144 186.01 86016
+589.148160 186.01 86016
+589.234176 186.01 86016
+589.320192 186.01 86016
+589.406208 186.01 86016
+589.492224 186.01 86016
+589.578240 186.01 86016
+589.664256 186.01 86016
+589.750272 186.01 86016
+589.836288 186.01 86016
+589.922304 186.01 86016
+590.008320 186.01 86016
+590.094336 186.01 86016
+590.180352 186.01 86016
+590.266368 186.01 86016
+590.351872 187.13 85504
+590.437376 187.13 85504
+590.522880 187.13 85504
+590.608384 187.13 85504
+590.693888 187.13 85504
+590.779392 187.13 85504
+590.864896 187.13 85504
+590.950400 187.13 85504
+591.035904 187.13 85504
+591.121408 187.13 85504
+591.206912 187.13 85504
+591.292416 187.13 85504
+591.377920 187.13 85504
+591.463424 187.13 85504
+591.548928 187.13 85504
+591.634432 187.13 85504
+591.719936 187.13 85504
+591.805440 187.13 85504
+591.890944 187.13 85504
+591.976448 187.13 85504
+592.061952 187.13 85504
+592.147456 187.13 85504
+592.232960 187.13 85504
+592.318464 187.13 85504
+592.403968 187.13 85504
+592.489472 187.13 85504
+592.574976 187.13 85504
+592.660480 187.13 85504
+592.745984 187.13 85504
+592.831488 187.13 85504
+592.916992 187.13 85504
+593.002496 187.13 85504
+593.087488 188.25 84992
+593.172480 188.25 84992
+593.257472 188.25 84992
+593.342464 188.25 84992
+593.427456 188.25 84992
+593.512448 188.25 84992
+593.597440 188.25 84992
+593.682432 188.25 84992
+593.767424 188.25 84992
+593.852416 188.25 84992
+593.937408 188.25 84992
+594.022400 188.25 84992
+594.107392 188.25 84992
+594.192384 188.25 84992
+594.277376 188.25 84992
+594.362368 188.25 84992
+594.447360 188.25 84992
+594.532352 188.25 84992
+594.617344 188.25 84992
+594.702336 188.25 84992
+594.787328 188.25 84992
+594.872320 188.25 84992
+594.957312 188.25 84992
+595.042304 188.25 84992
+595.127296 188.25 84992
+595.212288 188.25 84992
+595.297280 188.25 84992
+595.382272 188.25 84992
+595.467264 188.25 84992
+595.552256 188.25 84992
+595.637248 188.25 84992
+595.722240 188.25 84992
+595.807232 188.25 84992
+595.892224 188.25 84992
+595.977216 188.25 84992
+596.062208 188.25 84992
+596.147200 188.25 84992
+596.232192 188.25 84992
+596.317184 188.25 84992
+596.402176 188.25 84992
+596.487168 188.25 84992
+596.572160 188.25 84992
+596.657152 188.25 84992
+596.742144 188.25 84992
+596.827136 188.25 84992
+596.912128 188.25 84992
+596.997120 188.25 84992
+597.082112 188.25 84992
+597.166592 189.39 84480
+597.251072 189.39 84480
+597.335552 189.39 84480
+597.420032 189.39 84480
+597.504512 189.39 84480
+597.588992 189.39 84480
+597.673472 189.39 84480
+597.757952 189.39 84480
+597.842432 189.39 84480
+597.926912 189.39 84480
+598.011392 189.39 84480
+598.095872 189.39 84480
+598.180352 189.39 84480
+598.264832 189.39 84480
+598.349312 189.39 84480
+598.433792 189.39 84480
+598.518272 189.39 84480
+598.602752 189.39 84480
+598.687232 189.39 84480
+598.771712 189.39 84480
+598.856192 189.39 84480
+598.940672 189.39 84480
+599.025152 189.39 84480
+599.109632 189.39 84480
+599.194112 189.39 84480
+599.278592 189.39 84480
+599.363072 189.39 84480
+599.447552 189.39 84480
+599.532032 189.39 84480
+599.616512 189.39 84480
+599.700992 189.39 84480
+599.785472 189.39 84480
+599.869440 190.55 83968
+599.953408 190.55 83968
+600.037376 190.55 83968
+600.121344 190.55 83968
+600.205312 190.55 83968
+600.289280 190.55 83968
+600.373248 190.55 83968
+600.457216 190.55 83968
+600.541184 190.55 83968
+600.625152 190.55 83968
+600.709120 190.55 83968
+600.793088 190.55 83968
+600.877056 190.55 83968
+600.961024 190.55 83968
+601.044992 190.55 83968
+601.128960 190.55 83968
+601.212928 190.55 83968
+601.296896 190.55 83968
+601.380864 190.55 83968
+601.464832 190.55 83968
+601.548800 190.55 83968
+601.632768 190.55 83968
+601.716736 190.55 83968
+601.800704 190.55 83968
+601.884672 190.55 83968
+601.968640 190.55 83968
+602.052608 190.55 83968
+602.136576 190.55 83968
+602.220544 190.55 83968
+602.304512 190.55 83968
+602.388480 190.55 83968
+602.472448 190.55 83968
+602.555904 191.72 83456
+602.639360 191.72 83456
+602.722816 191.72 83456
+602.806272 191.72 83456
+602.889728 191.72 83456
+602.973184 191.72 83456
+603.056640 191.72 83456
+603.140096 191.72 83456
+603.223552 191.72 83456
+603.307008 191.72 83456
+603.390464 191.72 83456
+603.473920 191.72 83456
+603.557376 191.72 83456
+603.640832 191.72 83456
+603.724288 191.72 83456
+603.807744 191.72 83456
+603.891200 191.72 83456
+603.974656 191.72 83456
+604.058112 191.72 83456
+604.141568 191.72 83456
+604.225024 191.72 83456
+604.308480 191.72 83456
+604.391936 191.72 83456
+604.475392 191.72 83456
+604.558848 191.72 83456
+604.642304 191.72 83456
+604.725760 191.72 83456
+604.809216 191.72 83456
+604.892672 191.72 83456
+604.976128 191.72 83456
+605.059584 191.72 83456
+605.143040 191.72 83456
+605.226496 191.72 83456
+605.309952 191.72 83456
+605.393408 191.72 83456
+605.476864 191.72 83456
+605.560320 191.72 83456
+605.643776 191.72 83456
+605.727232 191.72 83456
+605.810688 191.72 83456
+605.894144 191.72 83456
+605.977600 191.72 83456
+606.061056 191.72 83456
+606.144512 191.72 83456
+606.227968 191.72 83456
+606.311424 191.72 83456
+606.394880 191.72 83456
+606.478336 191.72 83456
+606.561792 191.72 83456
+606.645248 191.72 83456
+606.728704 191.72 83456
+606.812160 191.72 83456
+606.895616 191.72 83456
+606.979072 191.72 83456
+607.062528 191.72 83456
+607.145984 191.72 83456
+607.229440 191.72 83456
+607.312896 191.72 83456
+607.396352 191.72 83456
+607.479808 191.72 83456
+607.563264 191.72 83456
+607.646720 191.72 83456
+607.730176 191.72 83456
+607.813632 191.72 83456
+607.897088 191.72 83456
+607.980544 191.72 83456
+608.064000 191.72 83456
+608.147456 191.72 83456
+608.230912 191.72 83456
+608.314368 191.72 83456
+608.397824 191.72 83456
+608.481280 191.72 83456
+608.564736 191.72 83456
+608.648192 191.72 83456
+608.731648 191.72 83456
+608.815104 191.72 83456
+608.898560 191.72 83456
+608.982016 191.72 83456
+609.065472 191.72 83456
+609.148928 191.72 83456
+609.231872 192.90 82944
+609.314816 192.90 82944
+609.397760 192.90 82944
+609.480704 192.90 82944
+609.563648 192.90 82944
+609.646592 192.90 82944
+609.729536 192.90 82944
+609.812480 192.90 82944
+609.895424 192.90 82944
+609.978368 192.90 82944
+610.061312 192.90 82944
+610.144256 192.90 82944
+610.227200 192.90 82944
+610.310144 192.90 82944
+610.393088 192.90 82944
+610.476032 192.90 82944
+610.558976 192.90 82944
+610.641920 192.90 82944
+610.724864 192.90 82944
+610.807808 192.90 82944
+610.890752 192.90 82944
+610.973696 192.90 82944
+611.056640 192.90 82944
+611.139584 192.90 82944
+611.222528 192.90 82944
+611.305472 192.90 82944
+611.388416 192.90 82944
+611.471360 192.90 82944
+611.554304 192.90 82944
+611.637248 192.90 82944
+611.720192 192.90 82944
+611.803136 192.90 82944
+611.886080 192.90 82944
+611.969024 192.90 82944
+612.051968 192.90 82944
+612.134912 192.90 82944
+612.217856 192.90 82944
+612.300800 192.90 82944
+612.383744 192.90 82944
+612.466688 192.90 82944
+612.549632 192.90 82944
+612.632576 192.90 82944
+612.715520 192.90 82944
+612.798464 192.90 82944
+612.881408 192.90 82944
+612.964352 192.90 82944
+613.047296 192.90 82944
+613.130240 192.90 82944
+613.212672 194.10 82432
+613.295104 194.10 82432
+613.377536 194.10 82432
+613.459968 194.10 82432
+613.542400 194.10 82432
+613.624832 194.10 82432
+613.707264 194.10 82432
+613.789696 194.10 82432
+613.872128 194.10 82432
+613.954560 194.10 82432
+614.036992 194.10 82432
+614.119424 194.10 82432
+614.201856 194.10 82432
+614.284288 194.10 82432
+614.366720 194.10 82432
+614.449152 194.10 82432
+614.531584 194.10 82432
+614.614016 194.10 82432
+614.696448 194.10 82432
+614.778880 194.10 82432
+614.861312 194.10 82432
+614.943744 194.10 82432
+615.026176 194.10 82432
+615.108608 194.10 82432
+615.191040 194.10 82432
+615.273472 194.10 82432
+615.355904 194.10 82432
+615.438336 194.10 82432
+615.520768 194.10 82432
+615.603200 194.10 82432
+615.685632 194.10 82432
+615.768064 194.10 82432
+615.850496 194.10 82432
+615.932928 194.10 82432
+616.015360 194.10 82432
+616.097792 194.10 82432
+616.180224 194.10 82432
+616.262656 194.10 82432
+616.345088 194.10 82432
+616.427520 194.10 82432
+616.509952 194.10 82432
+616.592384 194.10 82432
+616.674816 194.10 82432
+616.757248 194.10 82432
+616.839680 194.10 82432
+616.922112 194.10 82432
+617.004544 194.10 82432
+617.086976 194.10 82432
+617.168896 195.31 81920
+617.250816 195.31 81920
+617.332736 195.31 81920
+617.414656 195.31 81920
+617.496576 195.31 81920
+617.578496 195.31 81920
+617.660416 195.31 81920
+617.742336 195.31 81920
+617.824256 195.31 81920
+617.906176 195.31 81920
+617.988096 195.31 81920
+618.070016 195.31 81920
+618.151936 195.31 81920
+618.233856 195.31 81920
+618.315776 195.31 81920
+618.397696 195.31 81920
+618.479616 195.31 81920
+618.561536 195.31 81920
+618.643456 195.31 81920
+618.725376 195.31 81920
+618.807296 195.31 81920
+618.889216 195.31 81920
+618.971136 195.31 81920
+619.053056 195.31 81920
+619.134976 195.31 81920
+619.216896 195.31 81920
+619.298816 195.31 81920
+619.380736 195.31 81920
+619.462656 195.31 81920
+619.544576 195.31 81920
+619.626496 195.31 81920
+619.708416 195.31 81920
+619.789824 196.54 81408
+619.871232 196.54 81408
+619.952640 196.54 81408
+620.034048 196.54 81408
+620.115456 196.54 81408
+620.196864 196.54 81408
+620.278272 196.54 81408
+620.359680 196.54 81408
+620.441088 196.54 81408
+620.522496 196.54 81408
+620.603904 196.54 81408
+620.685312 196.54 81408
+620.766720 196.54 81408
+620.848128 196.54 81408
+620.929536 196.54 81408
+621.010944 196.54 81408
+621.092352 196.54 81408
+621.173760 196.54 81408
+621.255168 196.54 81408
+621.336576 196.54 81408
+621.417984 196.54 81408
+621.499392 196.54 81408
+621.580800 196.54 81408
+621.662208 196.54 81408
+621.743616 196.54 81408
+621.825024 196.54 81408
+621.906432 196.54 81408
+621.987840 196.54 81408
+622.069248 196.54 81408
+622.150656 196.54 81408
+622.232064 196.54 81408
+622.313472 196.54 81408
+622.394880 196.54 81408
+622.476288 196.54 81408
+622.557696 196.54 81408
+622.639104 196.54 81408
+622.720512 196.54 81408
+622.801920 196.54 81408
+622.883328 196.54 81408
+622.964736 196.54 81408
+623.046144 196.54 81408
+623.127552 196.54 81408
+623.208960 196.54 81408
+623.290368 196.54 81408
+623.371776 196.54 81408
+623.453184 196.54 81408
+623.534592 196.54 81408
+623.616000 196.54 81408
+623.696896 197.78 80896
+623.777792 197.78 80896
+623.858688 197.78 80896
+623.939584 197.78 80896
+624.020480 197.78 80896
+624.101376 197.78 80896
+624.182272 197.78 80896
+624.263168 197.78 80896
+624.344064 197.78 80896
+624.424960 197.78 80896
+624.505856 197.78 80896
+624.586752 197.78 80896
+624.667648 197.78 80896
+624.748544 197.78 80896
+624.829440 197.78 80896
+624.910336 197.78 80896
+624.991232 197.78 80896
+625.072128 197.78 80896
+625.153024 197.78 80896
+625.233920 197.78 80896
+625.314816 197.78 80896
+625.395712 197.78 80896
+625.476608 197.78 80896
+625.557504 197.78 80896
+625.638400 197.78 80896
+625.719296 197.78 80896
+625.800192 197.78 80896
+625.881088 197.78 80896
+625.961984 197.78 80896
+626.042880 197.78 80896
+626.123776 197.78 80896
+626.204672 197.78 80896
+626.285056 199.04 80384
+626.365440 199.04 80384
+626.445824 199.04 80384
+626.526208 199.04 80384
+626.606592 199.04 80384
+626.686976 199.04 80384
+626.767360 199.04 80384
+626.847744 199.04 80384
+626.928128 199.04 80384
+627.008512 199.04 80384
+627.088896 199.04 80384
+627.169280 199.04 80384
+627.249664 199.04 80384
+627.330048 199.04 80384
+627.410432 199.04 80384
+627.490816 199.04 80384
+627.571200 199.04 80384
+627.651584 199.04 80384
+627.731968 199.04 80384
+627.812352 199.04 80384
+627.892736 199.04 80384
+627.973120 199.04 80384
+628.053504 199.04 80384
+628.133888 199.04 80384
+628.214272 199.04 80384
+628.294656 199.04 80384
+628.375040 199.04 80384
+628.455424 199.04 80384
+628.535808 199.04 80384
+628.616192 199.04 80384
+628.696576 199.04 80384
+628.776960 199.04 80384
+628.857344 199.04 80384
+628.937728 199.04 80384
+629.018112 199.04 80384
+629.098496 199.04 80384
+629.178880 199.04 80384
+629.259264 199.04 80384
+629.339648 199.04 80384
+629.420032 199.04 80384
+629.500416 199.04 80384
+629.580800 199.04 80384
+629.661184 199.04 80384
+629.741568 199.04 80384
+629.821952 199.04 80384
+629.902336 199.04 80384
+629.982720 199.04 80384
+630.063104 199.04 80384
+630.143488 199.04 80384
+630.223872 199.04 80384
+630.304256 199.04 80384
+630.384640 199.04 80384
+630.465024 199.04 80384
+630.545408 199.04 80384
+630.625792 199.04 80384
+630.706176 199.04 80384
+630.786560 199.04 80384
+630.866944 199.04 80384
+630.947328 199.04 80384
+631.027712 199.04 80384
+631.108096 199.04 80384
+631.188480 199.04 80384
+631.268864 199.04 80384
+631.349248 199.04 80384
+631.429632 199.04 80384
+631.510016 199.04 80384
+631.590400 199.04 80384
+631.670784 199.04 80384
+631.751168 199.04 80384
+631.831552 199.04 80384
+631.911936 199.04 80384
+631.992320 199.04 80384
+632.072704 199.04 80384
+632.153088 199.04 80384
+632.233472 199.04 80384
+632.313856 199.04 80384
+632.394240 199.04 80384
+632.474624 199.04 80384
+632.555008 199.04 80384
+632.635392 199.04 80384
+632.715776 199.04 80384
+632.796160 199.04 80384
+632.876544 199.04 80384
+632.956928 199.04 80384
+633.037312 199.04 80384
+633.117696 199.04 80384
+633.198080 199.04 80384
+633.278464 199.04 80384
+633.358848 199.04 80384
+633.439232 199.04 80384
+633.519616 199.04 80384
+633.600000 199.04 80384
+633.680384 199.04 80384
+633.760768 199.04 80384
+633.841152 199.04 80384
+633.921536 199.04 80384
+634.001408 200.32 79872
+634.081280 200.32 79872
+634.161152 200.32 79872
+634.241024 200.32 79872
+634.320896 200.32 79872
+634.400768 200.32 79872
+634.480640 200.32 79872
+634.560512 200.32 79872
+634.640384 200.32 79872
+634.720256 200.32 79872
+634.800128 200.32 79872
+634.880000 200.32 79872
+634.959872 200.32 79872
+635.039744 200.32 79872
+635.119616 200.32 79872
+635.199488 200.32 79872
+635.279360 200.32 79872
+635.359232 200.32 79872
+635.439104 200.32 79872
+635.518976 200.32 79872
+635.598848 200.32 79872
+635.678720 200.32 79872
+635.758592 200.32 79872
+635.838464 200.32 79872
+635.918336 200.32 79872
+635.998208 200.32 79872
+636.078080 200.32 79872
+636.157952 200.32 79872
+636.237824 200.32 79872
+636.317696 200.32 79872
+636.397568 200.32 79872
+636.477440 200.32 79872
+636.556800 201.61 79360
+636.636160 201.61 79360
+636.715520 201.61 79360
+636.794880 201.61 79360
+636.874240 201.61 79360
+636.953600 201.61 79360
+637.032960 201.61 79360
+637.112320 201.61 79360
+637.191680 201.61 79360
+637.271040 201.61 79360
+637.350400 201.61 79360
+637.429760 201.61 79360
+637.509120 201.61 79360
+637.588480 201.61 79360
+637.667840 201.61 79360
+637.747200 201.61 79360
+637.826560 201.61 79360
+637.905920 201.61 79360
+637.985280 201.61 79360
+638.064640 201.61 79360
+638.144000 201.61 79360
+638.223360 201.61 79360
+638.302720 201.61 79360
+638.382080 201.61 79360
+638.461440 201.61 79360
+638.540800 201.61 79360
+638.620160 201.61 79360
+638.699520 201.61 79360
+638.778880 201.61 79360
+638.858240 201.61 79360
+638.937600 201.61 79360
+639.016960 201.61 79360
+639.096320 201.61 79360
+639.175680 201.61 79360
+639.255040 201.61 79360
+639.334400 201.61 79360
+639.413760 201.61 79360
+639.493120 201.61 79360
+639.572480 201.61 79360
+639.651840 201.61 79360
+639.731200 201.61 79360
+639.810560 201.61 79360
+639.889920 201.61 79360
+639.969280 201.61 79360
+640.048640 201.61 79360
+640.128000 201.61 79360
+640.207360 201.61 79360
+640.286720 201.61 79360
+640.365568 202.92 78848
+640.444416 202.92 78848
+640.523264 202.92 78848
+640.602112 202.92 78848
+640.680960 202.92 78848
+640.759808 202.92 78848
+640.838656 202.92 78848
+640.917504 202.92 78848
+640.996352 202.92 78848
+641.075200 202.92 78848
+641.154048 202.92 78848
+641.232896 202.92 78848
+641.311744 202.92 78848
+641.390592 202.92 78848
+641.469440 202.92 78848
+641.548288 202.92 78848
+641.627136 202.92 78848
+641.705984 202.92 78848
+641.784832 202.92 78848
+641.863680 202.92 78848
+641.942528 202.92 78848
+642.021376 202.92 78848
+642.100224 202.92 78848
+642.179072 202.92 78848
+642.257920 202.92 78848
+642.336768 202.92 78848
+642.415616 202.92 78848
+642.494464 202.92 78848
+642.573312 202.92 78848
+642.652160 202.92 78848
+642.731008 202.92 78848
+642.809856 202.92 78848
+642.888704 202.92 78848
+642.967552 202.92 78848
+643.046400 202.92 78848
+643.125248 202.92 78848
+643.204096 202.92 78848
+643.282944 202.92 78848
+643.361792 202.92 78848
+643.440640 202.92 78848
+643.519488 202.92 78848
+643.598336 202.92 78848
+643.677184 202.92 78848
+643.756032 202.92 78848
+643.834880 202.92 78848
+643.913728 202.92 78848
+643.992576 202.92 78848
+644.071424 202.92 78848
+644.150272 202.92 78848
+644.229120 202.92 78848
+644.307968 202.92 78848
+644.386816 202.92 78848
+644.465664 202.92 78848
+644.544512 202.92 78848
+644.623360 202.92 78848
+644.702208 202.92 78848
+644.781056 202.92 78848
+644.859904 202.92 78848
+644.938752 202.92 78848
+645.017600 202.92 78848
+645.096448 202.92 78848
+645.175296 202.92 78848
+645.254144 202.92 78848
+645.332992 202.92 78848
+645.411328 204.25 78336
+645.489664 204.25 78336
+645.568000 204.25 78336
+645.646336 204.25 78336
+645.724672 204.25 78336
+645.803008 204.25 78336
+645.881344 204.25 78336
+645.959680 204.25 78336
+646.038016 204.25 78336
+646.116352 204.25 78336
+646.194688 204.25 78336
+646.273024 204.25 78336
+646.351360 204.25 78336
+646.429696 204.25 78336
+646.508032 204.25 78336
+646.586368 204.25 78336
+646.664704 204.25 78336
+646.743040 204.25 78336
+646.821376 204.25 78336
+646.899712 204.25 78336
+646.978048 204.25 78336
+647.056384 204.25 78336
+647.134720 204.25 78336
+647.213056 204.25 78336
+647.291392 204.25 78336
+647.369728 204.25 78336
+647.448064 204.25 78336
+647.526400 204.25 78336
+647.604736 204.25 78336
+647.683072 204.25 78336
+647.761408 204.25 78336
+647.839744 204.25 78336
+647.917568 205.59 77824
+647.995392 205.59 77824
+648.073216 205.59 77824
+648.151040 205.59 77824
+648.228864 205.59 77824
+648.306688 205.59 77824
+648.384512 205.59 77824
+648.462336 205.59 77824
+648.540160 205.59 77824
+648.617984 205.59 77824
+648.695808 205.59 77824
+648.773632 205.59 77824
+648.851456 205.59 77824
+648.929280 205.59 77824
+649.007104 205.59 77824
+649.084928 205.59 77824
+649.162752 205.59 77824
+649.240576 205.59 77824
+649.318400 205.59 77824
+649.396224 205.59 77824
+649.474048 205.59 77824
+649.551872 205.59 77824
+649.629696 205.59 77824
+649.707520 205.59 77824
+649.785344 205.59 77824
+649.863168 205.59 77824
+649.940992 205.59 77824
+650.018816 205.59 77824
+650.096640 205.59 77824
+650.174464 205.59 77824
+650.252288 205.59 77824
+650.330112 205.59 77824
+650.407936 205.59 77824
+650.485760 205.59 77824
+650.563584 205.59 77824
+650.641408 205.59 77824
+650.719232 205.59 77824
+650.797056 205.59 77824
+650.874880 205.59 77824
+650.952704 205.59 77824
+651.030528 205.59 77824
+651.108352 205.59 77824
+651.186176 205.59 77824
+651.264000 205.59 77824
+651.341824 205.59 77824
+651.419648 205.59 77824
+651.497472 205.59 77824
+651.575296 205.59 77824
+651.653120 205.59 77824
+651.730944 205.59 77824
+651.808768 205.59 77824
+651.886592 205.59 77824
+651.964416 205.59 77824
+652.042240 205.59 77824
+652.120064 205.59 77824
+652.197888 205.59 77824
+652.275712 205.59 77824
+652.353536 205.59 77824
+652.431360 205.59 77824
+652.509184 205.59 77824
+652.587008 205.59 77824
+652.664832 205.59 77824
+652.742656 205.59 77824
+652.820480 205.59 77824
+652.898304 205.59 77824
+652.976128 205.59 77824
+653.053952 205.59 77824
+653.131776 205.59 77824
+653.209600 205.59 77824
+653.287424 205.59 77824
+653.365248 205.59 77824
+653.443072 205.59 77824
+653.520896 205.59 77824
+653.598720 205.59 77824
+653.676544 205.59 77824
+653.754368 205.59 77824
+653.832192 205.59 77824
+653.910016 205.59 77824
+653.987840 205.59 77824
+654.065664 205.59 77824
+654.143488 205.59 77824
+654.221312 205.59 77824
+654.299136 205.59 77824
+654.376960 205.59 77824
+654.454784 205.59 77824
+654.532608 205.59 77824
+654.610432 205.59 77824
+654.688256 205.59 77824
+654.766080 205.59 77824
+654.843904 205.59 77824
+654.921728 205.59 77824
+654.999552 205.59 77824
+655.077376 205.59 77824
+655.155200 205.59 77824
+655.233024 205.59 77824
+655.310848 205.59 77824
+655.388160 206.95 77312
+655.465472 206.95 77312
+655.542784 206.95 77312
+655.620096 206.95 77312
+655.697408 206.95 77312
+655.774720 206.95 77312
+655.852032 206.95 77312
+655.929344 206.95 77312
+656.006656 206.95 77312
+656.083968 206.95 77312
+656.161280 206.95 77312
+656.238592 206.95 77312
+656.315904 206.95 77312
+656.393216 206.95 77312
+656.470528 206.95 77312
+656.547840 206.95 77312
+656.625152 206.95 77312
+656.702464 206.95 77312
+656.779776 206.95 77312
+656.857088 206.95 77312
+656.934400 206.95 77312
+657.011712 206.95 77312
+657.089024 206.95 77312
+657.166336 206.95 77312
+657.243648 206.95 77312
+657.320960 206.95 77312
+657.398272 206.95 77312
+657.475584 206.95 77312
+657.552896 206.95 77312
+657.630208 206.95 77312
+657.707520 206.95 77312
+657.784832 206.95 77312
+657.861632 208.33 76800
+657.938432 208.33 76800
+658.015232 208.33 76800
+658.092032 208.33 76800
+658.168832 208.33 76800
+658.245632 208.33 76800
+658.322432 208.33 76800
+658.399232 208.33 76800
+658.476032 208.33 76800
+658.552832 208.33 76800
+658.629632 208.33 76800
+658.706432 208.33 76800
+658.783232 208.33 76800
+658.860032 208.33 76800
+658.936832 208.33 76800
+659.013632 208.33 76800
+659.090432 208.33 76800
+659.167232 208.33 76800
+659.244032 208.33 76800
+659.320832 208.33 76800
+659.397632 208.33 76800
+659.474432 208.33 76800
+659.551232 208.33 76800
+659.628032 208.33 76800
+659.704832 208.33 76800
+659.781632 208.33 76800
+659.858432 208.33 76800
+659.935232 208.33 76800
+660.012032 208.33 76800
+660.088832 208.33 76800
+660.165632 208.33 76800
+660.242432 208.33 76800
+660.319232 208.33 76800
+660.396032 208.33 76800
+660.472832 208.33 76800
+660.549632 208.33 76800
+660.626432 208.33 76800
+660.703232 208.33 76800
+660.780032 208.33 76800
+660.856832 208.33 76800
+660.933632 208.33 76800
+661.010432 208.33 76800
+661.087232 208.33 76800
+661.164032 208.33 76800
+661.240832 208.33 76800
+661.317632 208.33 76800
+661.394432 208.33 76800
+661.471232 208.33 76800
+661.548032 208.33 76800
+661.624832 208.33 76800
+661.701632 208.33 76800
+661.778432 208.33 76800
+661.855232 208.33 76800
+661.932032 208.33 76800
+662.008832 208.33 76800
+662.085632 208.33 76800
+662.162432 208.33 76800
+662.239232 208.33 76800
+662.316032 208.33 76800
+662.392832 208.33 76800
+662.469632 208.33 76800
+662.546432 208.33 76800
+662.623232 208.33 76800
+662.700032 208.33 76800
+662.776320 209.73 76288
+662.852608 209.73 76288
+662.928896 209.73 76288
+663.005184 209.73 76288
+663.081472 209.73 76288
+663.157760 209.73 76288
+663.234048 209.73 76288
+663.310336 209.73 76288
+663.386624 209.73 76288
+663.462912 209.73 76288
+663.539200 209.73 76288
+663.615488 209.73 76288
+663.691776 209.73 76288
+663.768064 209.73 76288
+663.844352 209.73 76288
+663.920640 209.73 76288
+663.996928 209.73 76288
+664.073216 209.73 76288
+664.149504 209.73 76288
+664.225792 209.73 76288
+664.302080 209.73 76288
+664.378368 209.73 76288
+664.454656 209.73 76288
+664.530944 209.73 76288
+664.607232 209.73 76288
+664.683520 209.73 76288
+664.759808 209.73 76288
+664.836096 209.73 76288
+664.912384 209.73 76288
+664.988672 209.73 76288
+665.064960 209.73 76288
+665.141248 209.73 76288
+665.217024 211.15 75776
+665.292800 211.15 75776
+665.368576 211.15 75776
+665.444352 211.15 75776
+665.520128 211.15 75776
+665.595904 211.15 75776
+665.671680 211.15 75776
+665.747456 211.15 75776
+665.823232 211.15 75776
+665.899008 211.15 75776
+665.974784 211.15 75776
+666.050560 211.15 75776
+666.126336 211.15 75776
+666.202112 211.15 75776
+666.277888 211.15 75776
+666.353664 211.15 75776
+666.429440 211.15 75776
+666.505216 211.15 75776
+666.580992 211.15 75776
+666.656768 211.15 75776
+666.732544 211.15 75776
+666.808320 211.15 75776
+666.884096 211.15 75776
+666.959872 211.15 75776
+667.035648 211.15 75776
+667.111424 211.15 75776
+667.187200 211.15 75776
+667.262976 211.15 75776
+667.338752 211.15 75776
+667.414528 211.15 75776
+667.490304 211.15 75776
+667.566080 211.15 75776
+667.641856 211.15 75776
+667.717632 211.15 75776
+667.793408 211.15 75776
+667.869184 211.15 75776
+667.944960 211.15 75776
+668.020736 211.15 75776
+668.096512 211.15 75776
+668.172288 211.15 75776
+668.248064 211.15 75776
+668.323840 211.15 75776
+668.399616 211.15 75776
+668.475392 211.15 75776
+668.551168 211.15 75776
+668.626944 211.15 75776
+668.702720 211.15 75776
+668.778496 211.15 75776
+668.854272 211.15 75776
+668.930048 211.15 75776
+669.005824 211.15 75776
+669.081600 211.15 75776
+669.157376 211.15 75776
+669.233152 211.15 75776
+669.308928 211.15 75776
+669.384704 211.15 75776
+669.460480 211.15 75776
+669.536256 211.15 75776
+669.612032 211.15 75776
+669.687808 211.15 75776
+669.763584 211.15 75776
+669.839360 211.15 75776
+669.915136 211.15 75776
+669.990912 211.15 75776
+670.066176 212.59 75264
+670.141440 212.59 75264
+670.216704 212.59 75264
+670.291968 212.59 75264
+670.367232 212.59 75264
+670.442496 212.59 75264
+670.517760 212.59 75264
+670.593024 212.59 75264
+670.668288 212.59 75264
+670.743552 212.59 75264
+670.818816 212.59 75264
+670.894080 212.59 75264
+670.969344 212.59 75264
+671.044608 212.59 75264
+671.119872 212.59 75264
+671.195136 212.59 75264
+671.270400 212.59 75264
+671.345664 212.59 75264
+671.420928 212.59 75264
+671.496192 212.59 75264
+671.571456 212.59 75264
+671.646720 212.59 75264
+671.721984 212.59 75264
+671.797248 212.59 75264
+671.872512 212.59 75264
+671.947776 212.59 75264
+672.023040 212.59 75264
+672.098304 212.59 75264
+672.173568 212.59 75264
+672.248832 212.59 75264
+672.324096 212.59 75264
+672.399360 212.59 75264
+672.474624 212.59 75264
+672.549888 212.59 75264
+672.625152 212.59 75264
+672.700416 212.59 75264
+672.775680 212.59 75264
+672.850944 212.59 75264
+672.926208 212.59 75264
+673.001472 212.59 75264
+673.076736 212.59 75264
+673.152000 212.59 75264
+673.227264 212.59 75264
+673.302528 212.59 75264
+673.377792 212.59 75264
+673.453056 212.59 75264
+673.528320 212.59 75264
+673.603584 212.59 75264
+673.678848 212.59 75264
+673.754112 212.59 75264
+673.829376 212.59 75264
+673.904640 212.59 75264
+673.979904 212.59 75264
+674.055168 212.59 75264
+674.130432 212.59 75264
+674.205696 212.59 75264
+674.280960 212.59 75264
+674.356224 212.59 75264
+674.431488 212.59 75264
+674.506752 212.59 75264
+674.582016 212.59 75264
+674.657280 212.59 75264
+674.732544 212.59 75264
+674.807808 212.59 75264
+674.883072 212.59 75264
+674.958336 212.59 75264
+675.033600 212.59 75264
+675.108864 212.59 75264
+675.184128 212.59 75264
+675.259392 212.59 75264
+675.334656 212.59 75264
+675.409920 212.59 75264
+675.485184 212.59 75264
+675.560448 212.59 75264
+675.635712 212.59 75264
+675.710976 212.59 75264
+675.786240 212.59 75264
+675.861504 212.59 75264
+675.936768 212.59 75264
+676.012032 212.59 75264
+676.087296 212.59 75264
+676.162560 212.59 75264
+676.237824 212.59 75264
+676.313088 212.59 75264
+676.388352 212.59 75264
+676.463616 212.59 75264
+676.538880 212.59 75264
+676.614144 212.59 75264
+676.689408 212.59 75264
+676.764672 212.59 75264
+676.839936 212.59 75264
+676.915200 212.59 75264
+676.990464 212.59 75264
+677.065728 212.59 75264
+677.140992 212.59 75264
+677.216256 212.59 75264
+677.291008 214.04 74752
+677.365760 214.04 74752
+677.440512 214.04 74752
+677.515264 214.04 74752
+677.590016 214.04 74752
+677.664768 214.04 74752
+677.739520 214.04 74752
+677.814272 214.04 74752
+677.889024 214.04 74752
+677.963776 214.04 74752
+678.038528 214.04 74752
+678.113280 214.04 74752
+678.188032 214.04 74752
+678.262784 214.04 74752
+678.337536 214.04 74752
+678.412288 214.04 74752
+678.487040 214.04 74752
+678.561792 214.04 74752
+678.636544 214.04 74752
+678.711296 214.04 74752
+678.786048 214.04 74752
+678.860800 214.04 74752
+678.935552 214.04 74752
+679.010304 214.04 74752
+679.085056 214.04 74752
+679.159808 214.04 74752
+679.234560 214.04 74752
+679.309312 214.04 74752
+679.384064 214.04 74752
+679.458816 214.04 74752
+679.533568 214.04 74752
+679.608320 214.04 74752
+679.682560 215.52 74240
+679.756800 215.52 74240
+679.831040 215.52 74240
+679.905280 215.52 74240
+679.979520 215.52 74240
+680.053760 215.52 74240
+680.128000 215.52 74240
+680.202240 215.52 74240
+680.276480 215.52 74240
+680.350720 215.52 74240
+680.424960 215.52 74240
+680.499200 215.52 74240
+680.573440 215.52 74240
+680.647680 215.52 74240
+680.721920 215.52 74240
+680.796160 215.52 74240
+680.870400 215.52 74240
+680.944640 215.52 74240
+681.018880 215.52 74240
+681.093120 215.52 74240
+681.167360 215.52 74240
+681.241600 215.52 74240
+681.315840 215.52 74240
+681.390080 215.52 74240
+681.464320 215.52 74240
+681.538560 215.52 74240
+681.612800 215.52 74240
+681.687040 215.52 74240
+681.761280 215.52 74240
+681.835520 215.52 74240
+681.909760 215.52 74240
+681.984000 215.52 74240
+682.058240 215.52 74240
+682.132480 215.52 74240
+682.206720 215.52 74240
+682.280960 215.52 74240
+682.355200 215.52 74240
+682.429440 215.52 74240
+682.503680 215.52 74240
+682.577920 215.52 74240
+682.652160 215.52 74240
+682.726400 215.52 74240
+682.800640 215.52 74240
+682.874880 215.52 74240
+682.949120 215.52 74240
+683.023360 215.52 74240
+683.097600 215.52 74240
+683.171840 215.52 74240
+683.246080 215.52 74240
+683.320320 215.52 74240
+683.394560 215.52 74240
+683.468800 215.52 74240
+683.543040 215.52 74240
+683.617280 215.52 74240
+683.691520 215.52 74240
+683.765760 215.52 74240
+683.840000 215.52 74240
+683.914240 215.52 74240
+683.988480 215.52 74240
+684.062720 215.52 74240
+684.136960 215.52 74240
+684.211200 215.52 74240
+684.285440 215.52 74240
+684.359680 215.52 74240
+684.433408 217.01 73728
+684.507136 217.01 73728
+684.580864 217.01 73728
+684.654592 217.01 73728
+684.728320 217.01 73728
+684.802048 217.01 73728
+684.875776 217.01 73728
+684.949504 217.01 73728
+685.023232 217.01 73728
+685.096960 217.01 73728
+685.170688 217.01 73728
+685.244416 217.01 73728
+685.318144 217.01 73728
+685.391872 217.01 73728
+685.465600 217.01 73728
+685.539328 217.01 73728
+685.613056 217.01 73728
+685.686784 217.01 73728
+685.760512 217.01 73728
+685.834240 217.01 73728
+685.907968 217.01 73728
+685.981696 217.01 73728
+686.055424 217.01 73728
+686.129152 217.01 73728
+686.202880 217.01 73728
+686.276608 217.01 73728
+686.350336 217.01 73728
+686.424064 217.01 73728
+686.497792 217.01 73728
+686.571520 217.01 73728
+686.645248 217.01 73728
+686.718976 217.01 73728
+686.792704 217.01 73728
+686.866432 217.01 73728
+686.940160 217.01 73728
+687.013888 217.01 73728
+687.087616 217.01 73728
+687.161344 217.01 73728
+687.235072 217.01 73728
+687.308800 217.01 73728
+687.382528 217.01 73728
+687.456256 217.01 73728
+687.529984 217.01 73728
+687.603712 217.01 73728
+687.677440 217.01 73728
+687.751168 217.01 73728
+687.824896 217.01 73728
+687.898624 217.01 73728
+687.972352 217.01 73728
+688.046080 217.01 73728
+688.119808 217.01 73728
+688.193536 217.01 73728
+688.267264 217.01 73728
+688.340992 217.01 73728
+688.414720 217.01 73728
+688.488448 217.01 73728
+688.562176 217.01 73728
+688.635904 217.01 73728
+688.709632 217.01 73728
+688.783360 217.01 73728
+688.857088 217.01 73728
+688.930816 217.01 73728
+689.004544 217.01 73728
+689.078272 217.01 73728
+689.152000 217.01 73728
+689.225728 217.01 73728
+689.299456 217.01 73728
+689.373184 217.01 73728
+689.446912 217.01 73728
+689.520640 217.01 73728
+689.594368 217.01 73728
+689.668096 217.01 73728
+689.741824 217.01 73728
+689.815552 217.01 73728
+689.889280 217.01 73728
+689.963008 217.01 73728
+690.036736 217.01 73728
+690.110464 217.01 73728
+690.184192 217.01 73728
+690.257920 217.01 73728
+690.331648 217.01 73728
+690.405376 217.01 73728
+690.479104 217.01 73728
+690.552832 217.01 73728
+690.626560 217.01 73728
+690.700288 217.01 73728
+690.774016 217.01 73728
+690.847744 217.01 73728
+690.921472 217.01 73728
+690.995200 217.01 73728
+691.068928 217.01 73728
+691.142656 217.01 73728
+691.216384 217.01 73728
+691.290112 217.01 73728
+691.363840 217.01 73728
+691.437568 217.01 73728
+691.510784 218.53 73216
+691.584000 218.53 73216
+691.657216 218.53 73216
+691.730432 218.53 73216
+691.803648 218.53 73216
+691.876864 218.53 73216
+691.950080 218.53 73216
+692.023296 218.53 73216
+692.096512 218.53 73216
+692.169728 218.53 73216
+692.242944 218.53 73216
+692.316160 218.53 73216
+692.389376 218.53 73216
+692.462592 218.53 73216
+692.535808 218.53 73216
+692.609024 218.53 73216
+692.682240 218.53 73216
+692.755456 218.53 73216
+692.828672 218.53 73216
+692.901888 218.53 73216
+692.975104 218.53 73216
+693.048320 218.53 73216
+693.121536 218.53 73216
+693.194752 218.53 73216
+693.267968 218.53 73216
+693.341184 218.53 73216
+693.414400 218.53 73216
+693.487616 218.53 73216
+693.560832 218.53 73216
+693.634048 218.53 73216
+693.707264 218.53 73216
+693.780480 218.53 73216
+693.853696 218.53 73216
+693.926912 218.53 73216
+694.000128 218.53 73216
+694.073344 218.53 73216
+694.146560 218.53 73216
+694.219776 218.53 73216
+694.292992 218.53 73216
+694.366208 218.53 73216
+694.439424 218.53 73216
+694.512640 218.53 73216
+694.585856 218.53 73216
+694.659072 218.53 73216
+694.732288 218.53 73216
+694.805504 218.53 73216
+694.878720 218.53 73216
+694.951936 218.53 73216
+695.025152 218.53 73216
+695.098368 218.53 73216
+695.171584 218.53 73216
+695.244800 218.53 73216
+695.318016 218.53 73216
+695.391232 218.53 73216
+695.464448 218.53 73216
+695.537664 218.53 73216
+695.610880 218.53 73216
+695.684096 218.53 73216
+695.757312 218.53 73216
+695.830528 218.53 73216
+695.903744 218.53 73216
+695.976960 218.53 73216
+696.050176 218.53 73216
+696.123392 218.53 73216
+696.196096 220.07 72704
+696.268800 220.07 72704
+696.341504 220.07 72704
+696.414208 220.07 72704
+696.486912 220.07 72704
+696.559616 220.07 72704
+696.632320 220.07 72704
+696.705024 220.07 72704
+696.777728 220.07 72704
+696.850432 220.07 72704
+696.923136 220.07 72704
+696.995840 220.07 72704
+697.068544 220.07 72704
+697.141248 220.07 72704
+697.213952 220.07 72704
+697.286656 220.07 72704
+697.359360 220.07 72704
+697.432064 220.07 72704
+697.504768 220.07 72704
+697.577472 220.07 72704
+697.650176 220.07 72704
+697.722880 220.07 72704
+697.795584 220.07 72704
+697.868288 220.07 72704
+697.940992 220.07 72704
+698.013696 220.07 72704
+698.086400 220.07 72704
+698.159104 220.07 72704
+698.231808 220.07 72704
+698.304512 220.07 72704
+698.377216 220.07 72704
+698.449920 220.07 72704
+698.522112 221.63 72192
+698.594304 221.63 72192
+698.666496 221.63 72192
+698.738688 221.63 72192
+698.810880 221.63 72192
+698.883072 221.63 72192
+698.955264 221.63 72192
+699.027456 221.63 72192
+699.099648 221.63 72192
+699.171840 221.63 72192
+699.244032 221.63 72192
+699.316224 221.63 72192
+699.388416 221.63 72192
+699.460608 221.63 72192
+699.532800 221.63 72192
+699.604992 221.63 72192
+699.677184 221.63 72192
+699.749376 221.63 72192
+699.821568 221.63 72192
+699.893760 221.63 72192
+699.965952 221.63 72192
+700.038144 221.63 72192
+700.110336 221.63 72192
+700.182528 221.63 72192
+700.254720 221.63 72192
+700.326912 221.63 72192
+700.399104 221.63 72192
+700.471296 221.63 72192
+700.543488 221.63 72192
+700.615680 221.63 72192
+700.687872 221.63 72192
+700.760064 221.63 72192
+700.832256 221.63 72192
+700.904448 221.63 72192
+700.976640 221.63 72192
+701.048832 221.63 72192
+701.121024 221.63 72192
+701.193216 221.63 72192
+701.265408 221.63 72192
+701.337600 221.63 72192
+701.409792 221.63 72192
+701.481984 221.63 72192
+701.554176 221.63 72192
+701.626368 221.63 72192
+701.698560 221.63 72192
+701.770752 221.63 72192
+701.842944 221.63 72192
+701.915136 221.63 72192
+701.987328 221.63 72192
+702.059520 221.63 72192
+702.131712 221.63 72192
+702.203904 221.63 72192
+702.276096 221.63 72192
+702.348288 221.63 72192
+702.420480 221.63 72192
+702.492672 221.63 72192
+702.564864 221.63 72192
+702.637056 221.63 72192
+702.709248 221.63 72192
+702.781440 221.63 72192
+702.853632 221.63 72192
+702.925824 221.63 72192
+702.998016 221.63 72192
+703.070208 221.63 72192
+703.141888 223.21 71680
+703.213568 223.21 71680
+703.285248 223.21 71680
+703.356928 223.21 71680
+703.428608 223.21 71680
+703.500288 223.21 71680
+703.571968 223.21 71680
+703.643648 223.21 71680
+703.715328 223.21 71680
+703.787008 223.21 71680
+703.858688 223.21 71680
+703.930368 223.21 71680
+704.002048 223.21 71680
+704.073728 223.21 71680
+704.145408 223.21 71680
+704.217088 223.21 71680
+704.288768 223.21 71680
+704.360448 223.21 71680
+704.432128 223.21 71680
+704.503808 223.21 71680
+704.575488 223.21 71680
+704.647168 223.21 71680
+704.718848 223.21 71680
+704.790528 223.21 71680
+704.862208 223.21 71680
+704.933888 223.21 71680
+705.005568 223.21 71680
+705.077248 223.21 71680
+705.148928 223.21 71680
+705.220608 223.21 71680
+705.292288 223.21 71680
+705.363968 223.21 71680
+705.435648 223.21 71680
+705.507328 223.21 71680
+705.579008 223.21 71680
+705.650688 223.21 71680
+705.722368 223.21 71680
+705.794048 223.21 71680
+705.865728 223.21 71680
+705.937408 223.21 71680
+706.009088 223.21 71680
+706.080768 223.21 71680
+706.152448 223.21 71680
+706.224128 223.21 71680
+706.295808 223.21 71680
+706.367488 223.21 71680
+706.439168 223.21 71680
+706.510848 223.21 71680
+706.582528 223.21 71680
+706.654208 223.21 71680
+706.725888 223.21 71680
+706.797568 223.21 71680
+706.869248 223.21 71680
+706.940928 223.21 71680
+707.012608 223.21 71680
+707.084288 223.21 71680
+707.155968 223.21 71680
+707.227648 223.21 71680
+707.299328 223.21 71680
+707.371008 223.21 71680
+707.442688 223.21 71680
+707.514368 223.21 71680
+707.586048 223.21 71680
+707.657728 223.21 71680
+707.729408 223.21 71680
+707.801088 223.21 71680
+707.872768 223.21 71680
+707.944448 223.21 71680
+708.016128 223.21 71680
+708.087808 223.21 71680
+708.159488 223.21 71680
+708.231168 223.21 71680
+708.302848 223.21 71680
+708.374528 223.21 71680
+708.446208 223.21 71680
+708.517888 223.21 71680
+708.589568 223.21 71680
+708.661248 223.21 71680
+708.732928 223.21 71680
+708.804608 223.21 71680
+708.876288 223.21 71680
+708.947968 223.21 71680
+709.019648 223.21 71680
+709.091328 223.21 71680
+709.163008 223.21 71680
+709.234688 223.21 71680
+709.306368 223.21 71680
+709.378048 223.21 71680
+709.449728 223.21 71680
+709.521408 223.21 71680
+709.593088 223.21 71680
+709.664768 223.21 71680
+709.736448 223.21 71680
+709.808128 223.21 71680
+709.879808 223.21 71680
+709.951488 223.21 71680
+710.022656 224.82 71168
+710.093824 224.82 71168
+710.164992 224.82 71168
+710.236160 224.82 71168
+710.307328 224.82 71168
+710.378496 224.82 71168
+710.449664 224.82 71168
+710.520832 224.82 71168
+710.592000 224.82 71168
+710.663168 224.82 71168
+710.734336 224.82 71168
+710.805504 224.82 71168
+710.876672 224.82 71168
+710.947840 224.82 71168
+711.019008 224.82 71168
+711.090176 224.82 71168
+711.161344 224.82 71168
+711.232512 224.82 71168
+711.303680 224.82 71168
+711.374848 224.82 71168
+711.446016 224.82 71168
+711.517184 224.82 71168
+711.588352 224.82 71168
+711.659520 224.82 71168
+711.730688 224.82 71168
+711.801856 224.82 71168
+711.873024 224.82 71168
+711.944192 224.82 71168
+712.015360 224.82 71168
+712.086528 224.82 71168
+712.157696 224.82 71168
+712.228864 224.82 71168
+712.300032 224.82 71168
+712.371200 224.82 71168
+712.442368 224.82 71168
+712.513536 224.82 71168
+712.584704 224.82 71168
+712.655872 224.82 71168
+712.727040 224.82 71168
+712.798208 224.82 71168
+712.869376 224.82 71168
+712.940544 224.82 71168
+713.011712 224.82 71168
+713.082880 224.82 71168
+713.154048 224.82 71168
+713.225216 224.82 71168
+713.296384 224.82 71168
+713.367552 224.82 71168
+713.438720 224.82 71168
+713.509888 224.82 71168
+713.581056 224.82 71168
+713.652224 224.82 71168
+713.723392 224.82 71168
+713.794560 224.82 71168
+713.865728 224.82 71168
+713.936896 224.82 71168
+714.008064 224.82 71168
+714.079232 224.82 71168
+714.150400 224.82 71168
+714.221568 224.82 71168
+714.292736 224.82 71168
+714.363904 224.82 71168
+714.435072 224.82 71168
+714.506240 224.82 71168
+714.576896 226.45 70656
+714.647552 226.45 70656
+714.718208 226.45 70656
+714.788864 226.45 70656
+714.859520 226.45 70656
+714.930176 226.45 70656
+715.000832 226.45 70656
+715.071488 226.45 70656
+715.142144 226.45 70656
+715.212800 226.45 70656
+715.283456 226.45 70656
+715.354112 226.45 70656
+715.424768 226.45 70656
+715.495424 226.45 70656
+715.566080 226.45 70656
+715.636736 226.45 70656
+715.707392 226.45 70656
+715.778048 226.45 70656
+715.848704 226.45 70656
+715.919360 226.45 70656
+715.990016 226.45 70656
+716.060672 226.45 70656
+716.131328 226.45 70656
+716.201984 226.45 70656
+716.272640 226.45 70656
+716.343296 226.45 70656
+716.413952 226.45 70656
+716.484608 226.45 70656
+716.555264 226.45 70656
+716.625920 226.45 70656
+716.696576 226.45 70656
+716.767232 226.45 70656
+716.837888 226.45 70656
+716.908544 226.45 70656
+716.979200 226.45 70656
+717.049856 226.45 70656
+717.120512 226.45 70656
+717.191168 226.45 70656
+717.261824 226.45 70656
+717.332480 226.45 70656
+717.403136 226.45 70656
+717.473792 226.45 70656
+717.544448 226.45 70656
+717.615104 226.45 70656
+717.685760 226.45 70656
+717.756416 226.45 70656
+717.827072 226.45 70656
+717.897728 226.45 70656
+717.968384 226.45 70656
+718.039040 226.45 70656
+718.109696 226.45 70656
+718.180352 226.45 70656
+718.251008 226.45 70656
+718.321664 226.45 70656
+718.392320 226.45 70656
+718.462976 226.45 70656
+718.533632 226.45 70656
+718.604288 226.45 70656
+718.674944 226.45 70656
+718.745600 226.45 70656
+718.816256 226.45 70656
+718.886912 226.45 70656
+718.957568 226.45 70656
+719.028224 226.45 70656
+719.098368 228.10 70144
+719.168512 228.10 70144
+719.238656 228.10 70144
+719.308800 228.10 70144
+719.378944 228.10 70144
+719.449088 228.10 70144
+719.519232 228.10 70144
+719.589376 228.10 70144
+719.659520 228.10 70144
+719.729664 228.10 70144
+719.799808 228.10 70144
+719.869952 228.10 70144
+719.940096 228.10 70144
+720.010240 228.10 70144
+720.080384 228.10 70144
+720.150528 228.10 70144
+720.220672 228.10 70144
+720.290816 228.10 70144
+720.360960 228.10 70144
+720.431104 228.10 70144
+720.501248 228.10 70144
+720.571392 228.10 70144
+720.641536 228.10 70144
+720.711680 228.10 70144
+720.781824 228.10 70144
+720.851968 228.10 70144
+720.922112 228.10 70144
+720.992256 228.10 70144
+721.062400 228.10 70144
+721.132544 228.10 70144
+721.202688 228.10 70144
+721.272832 228.10 70144
+721.342976 228.10 70144
+721.413120 228.10 70144
+721.483264 228.10 70144
+721.553408 228.10 70144
+721.623552 228.10 70144
+721.693696 228.10 70144
+721.763840 228.10 70144
+721.833984 228.10 70144
+721.904128 228.10 70144
+721.974272 228.10 70144
+722.044416 228.10 70144
+722.114560 228.10 70144
+722.184704 228.10 70144
+722.254848 228.10 70144
+722.324992 228.10 70144
+722.395136 228.10 70144
+722.465280 228.10 70144
+722.535424 228.10 70144
+722.605568 228.10 70144
+722.675712 228.10 70144
+722.745856 228.10 70144
+722.816000 228.10 70144
+722.886144 228.10 70144
+722.956288 228.10 70144
+723.026432 228.10 70144
+723.096576 228.10 70144
+723.166720 228.10 70144
+723.236864 228.10 70144
+723.307008 228.10 70144
+723.377152 228.10 70144
+723.447296 228.10 70144
+723.517440 228.10 70144
+723.587584 228.10 70144
+723.657728 228.10 70144
+723.727872 228.10 70144
+723.798016 228.10 70144
+723.868160 228.10 70144
+723.938304 228.10 70144
+724.008448 228.10 70144
+724.078592 228.10 70144
+724.148736 228.10 70144
+724.218880 228.10 70144
+724.289024 228.10 70144
+724.359168 228.10 70144
+724.429312 228.10 70144
+724.499456 228.10 70144
+724.569600 228.10 70144
+724.639744 228.10 70144
+724.709888 228.10 70144
+724.780032 228.10 70144
+724.850176 228.10 70144
+724.920320 228.10 70144
+724.990464 228.10 70144
+725.060608 228.10 70144
+725.130752 228.10 70144
+725.200896 228.10 70144
+725.271040 228.10 70144
+725.341184 228.10 70144
+725.411328 228.10 70144
+725.481472 228.10 70144
+725.551616 228.10 70144
+725.621760 228.10 70144
+725.691904 228.10 70144
+725.762048 228.10 70144
+725.831680 229.78 69632
+725.901312 229.78 69632
+725.970944 229.78 69632
+726.040576 229.78 69632
+726.110208 229.78 69632
+726.179840 229.78 69632
+726.249472 229.78 69632
+726.319104 229.78 69632
+726.388736 229.78 69632
+726.458368 229.78 69632
+726.528000 229.78 69632
+726.597632 229.78 69632
+726.667264 229.78 69632
+726.736896 229.78 69632
+726.806528 229.78 69632
+726.876160 229.78 69632
+726.945792 229.78 69632
+727.015424 229.78 69632
+727.085056 229.78 69632
+727.154688 229.78 69632
+727.224320 229.78 69632
+727.293952 229.78 69632
+727.363584 229.78 69632
+727.433216 229.78 69632
+727.502848 229.78 69632
+727.572480 229.78 69632
+727.642112 229.78 69632
+727.711744 229.78 69632
+727.781376 229.78 69632
+727.851008 229.78 69632
+727.920640 229.78 69632
+727.990272 229.78 69632
+728.059904 229.78 69632
+728.129536 229.78 69632
+728.199168 229.78 69632
+728.268800 229.78 69632
+728.338432 229.78 69632
+728.408064 229.78 69632
+728.477696 229.78 69632
+728.547328 229.78 69632
+728.616960 229.78 69632
+728.686592 229.78 69632
+728.756224 229.78 69632
+728.825856 229.78 69632
+728.895488 229.78 69632
+728.965120 229.78 69632
+729.034752 229.78 69632
+729.104384 229.78 69632
+729.174016 229.78 69632
+729.243648 229.78 69632
+729.313280 229.78 69632
+729.382912 229.78 69632
+729.452544 229.78 69632
+729.522176 229.78 69632
+729.591808 229.78 69632
+729.661440 229.78 69632
+729.731072 229.78 69632
+729.800704 229.78 69632
+729.870336 229.78 69632
+729.939968 229.78 69632
+730.009600 229.78 69632
+730.079232 229.78 69632
+730.148864 229.78 69632
+730.218496 229.78 69632
+730.287616 231.48 69120
+730.356736 231.48 69120
+730.425856 231.48 69120
+730.494976 231.48 69120
+730.564096 231.48 69120
+730.633216 231.48 69120
+730.702336 231.48 69120
+730.771456 231.48 69120
+730.840576 231.48 69120
+730.909696 231.48 69120
+730.978816 231.48 69120
+731.047936 231.48 69120
+731.117056 231.48 69120
+731.186176 231.48 69120
+731.255296 231.48 69120
+731.324416 231.48 69120
+731.393536 231.48 69120
+731.462656 231.48 69120
+731.531776 231.48 69120
+731.600896 231.48 69120
+731.670016 231.48 69120
+731.739136 231.48 69120
+731.808256 231.48 69120
+731.877376 231.48 69120
+731.946496 231.48 69120
+732.015616 231.48 69120
+732.084736 231.48 69120
+732.153856 231.48 69120
+732.222976 231.48 69120
+732.292096 231.48 69120
+732.361216 231.48 69120
+732.430336 231.48 69120
+732.499456 231.48 69120
+732.568576 231.48 69120
+732.637696 231.48 69120
+732.706816 231.48 69120
+732.775936 231.48 69120
+732.845056 231.48 69120
+732.914176 231.48 69120
+732.983296 231.48 69120
+733.052416 231.48 69120
+733.121536 231.48 69120
+733.190656 231.48 69120
+733.259776 231.48 69120
+733.328896 231.48 69120
+733.398016 231.48 69120
+733.467136 231.48 69120
+733.536256 231.48 69120
+733.605376 231.48 69120
+733.674496 231.48 69120
+733.743616 231.48 69120
+733.812736 231.48 69120
+733.881856 231.48 69120
+733.950976 231.48 69120
+734.020096 231.48 69120
+734.089216 231.48 69120
+734.158336 231.48 69120
+734.227456 231.48 69120
+734.296576 231.48 69120
+734.365696 231.48 69120
+734.434816 231.48 69120
+734.503936 231.48 69120
+734.573056 231.48 69120
+734.642176 231.48 69120
+734.711296 231.48 69120
+734.780416 231.48 69120
+734.849536 231.48 69120
+734.918656 231.48 69120
+734.987776 231.48 69120
+735.056896 231.48 69120
+735.126016 231.48 69120
+735.195136 231.48 69120
+735.264256 231.48 69120
+735.333376 231.48 69120
+735.402496 231.48 69120
+735.471616 231.48 69120
+735.540736 231.48 69120
+735.609856 231.48 69120
+735.678976 231.48 69120
+735.748096 231.48 69120
+735.817216 231.48 69120
+735.886336 231.48 69120
+735.955456 231.48 69120
+736.024576 231.48 69120
+736.093696 231.48 69120
+736.162816 231.48 69120
+736.231936 231.48 69120
+736.301056 231.48 69120
+736.370176 231.48 69120
+736.439296 231.48 69120
+736.508416 231.48 69120
+736.577536 231.48 69120
+736.646656 231.48 69120
+736.715776 231.48 69120
+736.784896 231.48 69120
+736.854016 231.48 69120
+736.923136 231.48 69120
+736.992256 231.48 69120
+737.061376 231.48 69120
+737.130496 231.48 69120
+737.199616 231.48 69120
+737.268736 231.48 69120
+737.337856 231.48 69120
+737.406976 231.48 69120
+737.476096 231.48 69120
+737.545216 231.48 69120
+737.614336 231.48 69120
+737.683456 231.48 69120
+737.752576 231.48 69120
+737.821696 231.48 69120
+737.890816 231.48 69120
+737.959936 231.48 69120
+738.029056 231.48 69120
+738.098176 231.48 69120
+738.167296 231.48 69120
+738.236416 231.48 69120
+738.305536 231.48 69120
+738.374656 231.48 69120
+738.443776 231.48 69120
+738.512896 231.48 69120
+738.582016 231.48 69120
+738.651136 231.48 69120
+738.720256 231.48 69120
+738.789376 231.48 69120
+738.858496 231.48 69120
+738.927616 231.48 69120
+738.996736 231.48 69120
+739.065856 231.48 69120
+739.134464 233.21 68608
+739.203072 233.21 68608
+739.271680 233.21 68608
+739.340288 233.21 68608
+739.408896 233.21 68608
+739.477504 233.21 68608
+739.546112 233.21 68608
+739.614720 233.21 68608
+739.683328 233.21 68608
+739.751936 233.21 68608
+739.820544 233.21 68608
+739.889152 233.21 68608
+739.957760 233.21 68608
+740.026368 233.21 68608
+740.094976 233.21 68608
+740.163584 233.21 68608
+740.232192 233.21 68608
+740.300800 233.21 68608
+740.369408 233.21 68608
+740.438016 233.21 68608
+740.506624 233.21 68608
+740.575232 233.21 68608
+740.643840 233.21 68608
+740.712448 233.21 68608
+740.781056 233.21 68608
+740.849664 233.21 68608
+740.918272 233.21 68608
+740.986880 233.21 68608
+741.055488 233.21 68608
+741.124096 233.21 68608
+741.192704 233.21 68608
+741.261312 233.21 68608
+741.329920 233.21 68608
+741.398528 233.21 68608
+741.467136 233.21 68608
+741.535744 233.21 68608
+741.604352 233.21 68608
+741.672960 233.21 68608
+741.741568 233.21 68608
+741.810176 233.21 68608
+741.878784 233.21 68608
+741.947392 233.21 68608
+742.016000 233.21 68608
+742.084608 233.21 68608
+742.153216 233.21 68608
+742.221824 233.21 68608
+742.290432 233.21 68608
+742.359040 233.21 68608
+742.427648 233.21 68608
+742.496256 233.21 68608
+742.564864 233.21 68608
+742.633472 233.21 68608
+742.702080 233.21 68608
+742.770688 233.21 68608
+742.839296 233.21 68608
+742.907904 233.21 68608
+742.976512 233.21 68608
+743.045120 233.21 68608
+743.113728 233.21 68608
+743.182336 233.21 68608
+743.250944 233.21 68608
+743.319552 233.21 68608
+743.388160 233.21 68608
+743.456768 233.21 68608
+743.524864 234.96 68096
+743.592960 234.96 68096
+743.661056 234.96 68096
+743.729152 234.96 68096
+743.797248 234.96 68096
+743.865344 234.96 68096
+743.933440 234.96 68096
+744.001536 234.96 68096
+744.069632 234.96 68096
+744.137728 234.96 68096
+744.205824 234.96 68096
+744.273920 234.96 68096
+744.342016 234.96 68096
+744.410112 234.96 68096
+744.478208 234.96 68096
+744.546304 234.96 68096
+744.614400 234.96 68096
+744.682496 234.96 68096
+744.750592 234.96 68096
+744.818688 234.96 68096
+744.886784 234.96 68096
+744.954880 234.96 68096
+745.022976 234.96 68096
+745.091072 234.96 68096
+745.159168 234.96 68096
+745.227264 234.96 68096
+745.295360 234.96 68096
+745.363456 234.96 68096
+745.431552 234.96 68096
+745.499648 234.96 68096
+745.567744 234.96 68096
+745.635840 234.96 68096
+745.703936 234.96 68096
+745.772032 234.96 68096
+745.840128 234.96 68096
+745.908224 234.96 68096
+745.976320 234.96 68096
+746.044416 234.96 68096
+746.112512 234.96 68096
+746.180608 234.96 68096
+746.248704 234.96 68096
+746.316800 234.96 68096
+746.384896 234.96 68096
+746.452992 234.96 68096
+746.521088 234.96 68096
+746.589184 234.96 68096
+746.657280 234.96 68096
+746.725376 234.96 68096
+746.793472 234.96 68096
+746.861568 234.96 68096
+746.929664 234.96 68096
+746.997760 234.96 68096
+747.065856 234.96 68096
+747.133952 234.96 68096
+747.202048 234.96 68096
+747.270144 234.96 68096
+747.338240 234.96 68096
+747.406336 234.96 68096
+747.474432 234.96 68096
+747.542528 234.96 68096
+747.610624 234.96 68096
+747.678720 234.96 68096
+747.746816 234.96 68096
+747.814912 234.96 68096
+747.882496 236.74 67584
+747.950080 236.74 67584
+748.017664 236.74 67584
+748.085248 236.74 67584
+748.152832 236.74 67584
+748.220416 236.74 67584
+748.288000 236.74 67584
+748.355584 236.74 67584
+748.423168 236.74 67584
+748.490752 236.74 67584
+748.558336 236.74 67584
+748.625920 236.74 67584
+748.693504 236.74 67584
+748.761088 236.74 67584
+748.828672 236.74 67584
+748.896256 236.74 67584
+748.963840 236.74 67584
+749.031424 236.74 67584
+749.099008 236.74 67584
+749.166592 236.74 67584
+749.234176 236.74 67584
+749.301760 236.74 67584
+749.369344 236.74 67584
+749.436928 236.74 67584
+749.504512 236.74 67584
+749.572096 236.74 67584
+749.639680 236.74 67584
+749.707264 236.74 67584
+749.774848 236.74 67584
+749.842432 236.74 67584
+749.910016 236.74 67584
+749.977600 236.74 67584
+750.045184 236.74 67584
+750.112768 236.74 67584
+750.180352 236.74 67584
+750.247936 236.74 67584
+750.315520 236.74 67584
+750.383104 236.74 67584
+750.450688 236.74 67584
+750.518272 236.74 67584
+750.585856 236.74 67584
+750.653440 236.74 67584
+750.721024 236.74 67584
+750.788608 236.74 67584
+750.856192 236.74 67584
+750.923776 236.74 67584
+750.991360 236.74 67584
+751.058944 236.74 67584
+751.126528 236.74 67584
+751.194112 236.74 67584
+751.261696 236.74 67584
+751.329280 236.74 67584
+751.396864 236.74 67584
+751.464448 236.74 67584
+751.532032 236.74 67584
+751.599616 236.74 67584
+751.667200 236.74 67584
+751.734784 236.74 67584
+751.802368 236.74 67584
+751.869952 236.74 67584
+751.937536 236.74 67584
+752.005120 236.74 67584
+752.072704 236.74 67584
+752.140288 236.74 67584
+752.207872 236.74 67584
+752.275456 236.74 67584
+752.343040 236.74 67584
+752.410624 236.74 67584
+752.478208 236.74 67584
+752.545792 236.74 67584
+752.613376 236.74 67584
+752.680960 236.74 67584
+752.748544 236.74 67584
+752.816128 236.74 67584
+752.883712 236.74 67584
+752.951296 236.74 67584
+753.018880 236.74 67584
+753.086464 236.74 67584
+753.154048 236.74 67584
+753.221632 236.74 67584
+753.289216 236.74 67584
+753.356800 236.74 67584
+753.424384 236.74 67584
+753.491968 236.74 67584
+753.559552 236.74 67584
+753.627136 236.74 67584
+753.694720 236.74 67584
+753.762304 236.74 67584
+753.829888 236.74 67584
+753.897472 236.74 67584
+753.965056 236.74 67584
+754.032640 236.74 67584
+754.100224 236.74 67584
+754.167808 236.74 67584
+754.235392 236.74 67584
+754.302976 236.74 67584
+754.370048 238.55 67072
+754.437120 238.55 67072
+754.504192 238.55 67072
+754.571264 238.55 67072
+754.638336 238.55 67072
+754.705408 238.55 67072
+754.772480 238.55 67072
+754.839552 238.55 67072
+754.906624 238.55 67072
+754.973696 238.55 67072
+755.040768 238.55 67072
+755.107840 238.55 67072
+755.174912 238.55 67072
+755.241984 238.55 67072
+755.309056 238.55 67072
+755.376128 238.55 67072
+755.443200 238.55 67072
+755.510272 238.55 67072
+755.577344 238.55 67072
+755.644416 238.55 67072
+755.711488 238.55 67072
+755.778560 238.55 67072
+755.845632 238.55 67072
+755.912704 238.55 67072
+755.979776 238.55 67072
+756.046848 238.55 67072
+756.113920 238.55 67072
+756.180992 238.55 67072
+756.248064 238.55 67072
+756.315136 238.55 67072
+756.382208 238.55 67072
+756.449280 238.55 67072
+756.516352 238.55 67072
+756.583424 238.55 67072
+756.650496 238.55 67072
+756.717568 238.55 67072
+756.784640 238.55 67072
+756.851712 238.55 67072
+756.918784 238.55 67072
+756.985856 238.55 67072
+757.052928 238.55 67072
+757.120000 238.55 67072
+757.187072 238.55 67072
+757.254144 238.55 67072
+757.321216 238.55 67072
+757.388288 238.55 67072
+757.455360 238.55 67072
+757.522432 238.55 67072
+757.589504 238.55 67072
+757.656576 238.55 67072
+757.723648 238.55 67072
+757.790720 238.55 67072
+757.857792 238.55 67072
+757.924864 238.55 67072
+757.991936 238.55 67072
+758.059008 238.55 67072
+758.126080 238.55 67072
+758.193152 238.55 67072
+758.260224 238.55 67072
+758.327296 238.55 67072
+758.394368 238.55 67072
+758.461440 238.55 67072
+758.528512 238.55 67072
+758.595584 238.55 67072
+758.662144 240.38 66560
+758.728704 240.38 66560
+758.795264 240.38 66560
+758.861824 240.38 66560
+758.928384 240.38 66560
+758.994944 240.38 66560
+759.061504 240.38 66560
+759.128064 240.38 66560
+759.194624 240.38 66560
+759.261184 240.38 66560
+759.327744 240.38 66560
+759.394304 240.38 66560
+759.460864 240.38 66560
+759.527424 240.38 66560
+759.593984 240.38 66560
+759.660544 240.38 66560
+759.727104 240.38 66560
+759.793664 240.38 66560
+759.860224 240.38 66560
+759.926784 240.38 66560
+759.993344 240.38 66560
+760.059904 240.38 66560
+760.126464 240.38 66560
+760.193024 240.38 66560
+760.259584 240.38 66560
+760.326144 240.38 66560
+760.392704 240.38 66560
+760.459264 240.38 66560
+760.525824 240.38 66560
+760.592384 240.38 66560
+760.658944 240.38 66560
+760.725504 240.38 66560
+760.792064 240.38 66560
+760.858624 240.38 66560
+760.925184 240.38 66560
+760.991744 240.38 66560
+761.058304 240.38 66560
+761.124864 240.38 66560
+761.191424 240.38 66560
+761.257984 240.38 66560
+761.324544 240.38 66560
+761.391104 240.38 66560
+761.457664 240.38 66560
+761.524224 240.38 66560
+761.590784 240.38 66560
+761.657344 240.38 66560
+761.723904 240.38 66560
+761.790464 240.38 66560
+761.857024 240.38 66560
+761.923584 240.38 66560
+761.990144 240.38 66560
+762.056704 240.38 66560
+762.123264 240.38 66560
+762.189824 240.38 66560
+762.256384 240.38 66560
+762.322944 240.38 66560
+762.389504 240.38 66560
+762.456064 240.38 66560
+762.522624 240.38 66560
+762.589184 240.38 66560
+762.655744 240.38 66560
+762.722304 240.38 66560
+762.788864 240.38 66560
+762.855424 240.38 66560
+762.921472 242.25 66048
+762.987520 242.25 66048
+763.053568 242.25 66048
+763.119616 242.25 66048
+763.185664 242.25 66048
+763.251712 242.25 66048
+763.317760 242.25 66048
+763.383808 242.25 66048
+763.449856 242.25 66048
+763.515904 242.25 66048
+763.581952 242.25 66048
+763.648000 242.25 66048
+763.714048 242.25 66048
+763.780096 242.25 66048
+763.846144 242.25 66048
+763.912192 242.25 66048
+763.978240 242.25 66048
+764.044288 242.25 66048
+764.110336 242.25 66048
+764.176384 242.25 66048
+764.242432 242.25 66048
+764.308480 242.25 66048
+764.374528 242.25 66048
+764.440576 242.25 66048
+764.506624 242.25 66048
+764.572672 242.25 66048
+764.638720 242.25 66048
+764.704768 242.25 66048
+764.770816 242.25 66048
+764.836864 242.25 66048
+764.902912 242.25 66048
+764.968960 242.25 66048
+765.035008 242.25 66048
+765.101056 242.25 66048
+765.167104 242.25 66048
+765.233152 242.25 66048
+765.299200 242.25 66048
+765.365248 242.25 66048
+765.431296 242.25 66048
+765.497344 242.25 66048
+765.563392 242.25 66048
+765.629440 242.25 66048
+765.695488 242.25 66048
+765.761536 242.25 66048
+765.827584 242.25 66048
+765.893632 242.25 66048
+765.959680 242.25 66048
+766.025728 242.25 66048
+766.091776 242.25 66048
+766.157824 242.25 66048
+766.223872 242.25 66048
+766.289920 242.25 66048
+766.355968 242.25 66048
+766.422016 242.25 66048
+766.488064 242.25 66048
+766.554112 242.25 66048
+766.620160 242.25 66048
+766.686208 242.25 66048
+766.752256 242.25 66048
+766.818304 242.25 66048
+766.884352 242.25 66048
+766.950400 242.25 66048
+767.016448 242.25 66048
+767.082496 242.25 66048
+767.148544 242.25 66048
+767.214592 242.25 66048
+767.280640 242.25 66048
+767.346688 242.25 66048
+767.412736 242.25 66048
+767.478784 242.25 66048
+767.544832 242.25 66048
+767.610880 242.25 66048
+767.676928 242.25 66048
+767.742976 242.25 66048
+767.809024 242.25 66048
+767.875072 242.25 66048
+767.941120 242.25 66048
+768.007168 242.25 66048
+768.073216 242.25 66048
+768.139264 242.25 66048
+768.205312 242.25 66048
+768.271360 242.25 66048
+768.337408 242.25 66048
+768.403456 242.25 66048
+768.469504 242.25 66048
+768.535552 242.25 66048
+768.601600 242.25 66048
+768.667648 242.25 66048
+768.733696 242.25 66048
+768.799744 242.25 66048
+768.865792 242.25 66048
+768.931840 242.25 66048
+768.997888 242.25 66048
+769.063936 242.25 66048
+769.129984 242.25 66048
+769.196032 242.25 66048
+769.262080 242.25 66048
+769.328128 242.25 66048
+769.394176 242.25 66048
+769.460224 242.25 66048
+769.526272 242.25 66048
+769.592320 242.25 66048
+769.658368 242.25 66048
+769.724416 242.25 66048
+769.790464 242.25 66048
+769.856512 242.25 66048
+769.922560 242.25 66048
+769.988608 242.25 66048
+770.054656 242.25 66048
+770.120704 242.25 66048
+770.186752 242.25 66048
+770.252800 242.25 66048
+770.318848 242.25 66048
+770.384896 242.25 66048
+770.450944 242.25 66048
+770.516992 242.25 66048
+770.583040 242.25 66048
+770.649088 242.25 66048
+770.715136 242.25 66048
+770.781184 242.25 66048
+770.847232 242.25 66048
+770.913280 242.25 66048
+770.979328 242.25 66048
+771.045376 242.25 66048
+771.111424 242.25 66048
+771.177472 242.25 66048
+771.243520 242.25 66048
+771.309568 242.25 66048
+771.375104 244.14 65536
+771.440640 244.14 65536
+771.506176 244.14 65536
+771.571712 244.14 65536
+771.637248 244.14 65536
+771.702784 244.14 65536
+771.768320 244.14 65536
+771.833856 244.14 65536
+771.899392 244.14 65536
+771.964928 244.14 65536
+772.030464 244.14 65536
+772.096000 244.14 65536
+772.161536 244.14 65536
+772.227072 244.14 65536
+772.292608 244.14 65536
+772.358144 244.14 65536
+772.423680 244.14 65536
+772.489216 244.14 65536
+772.554752 244.14 65536
+772.620288 244.14 65536
+772.685824 244.14 65536
+772.751360 244.14 65536
+772.816896 244.14 65536
+772.882432 244.14 65536
+772.947968 244.14 65536
+773.013504 244.14 65536
+773.079040 244.14 65536
+773.144576 244.14 65536
+773.210112 244.14 65536
+773.275648 244.14 65536
+773.341184 244.14 65536
+773.406720 244.14 65536
+773.472256 244.14 65536
+773.537792 244.14 65536
+773.603328 244.14 65536
+773.668864 244.14 65536
+773.734400 244.14 65536
+773.799936 244.14 65536
+773.865472 244.14 65536
+773.931008 244.14 65536
+773.996544 244.14 65536
+774.062080 244.14 65536
+774.127616 244.14 65536
+774.193152 244.14 65536
+774.258688 244.14 65536
+774.324224 244.14 65536
+774.389760 244.14 65536
+774.455296 244.14 65536
+774.520832 244.14 65536
+774.586368 244.14 65536
+774.651904 244.14 65536
+774.717440 244.14 65536
+774.782976 244.14 65536
+774.848512 244.14 65536
+774.914048 244.14 65536
+774.979584 244.14 65536
+775.045120 244.14 65536
+775.110656 244.14 65536
+775.176192 244.14 65536
+775.241728 244.14 65536
+775.307264 244.14 65536
+775.372800 244.14 65536
+775.438336 244.14 65536
+775.503872 244.14 65536
+775.569152 245.10 65280
+775.634432 245.10 65280
+775.699712 245.10 65280
+775.764992 245.10 65280
+775.830272 245.10 65280
+775.895552 245.10 65280
+775.960832 245.10 65280
+776.026112 245.10 65280
+776.091392 245.10 65280
+776.156672 245.10 65280
+776.221952 245.10 65280
+776.287232 245.10 65280
+776.352512 245.10 65280
+776.417792 245.10 65280
+776.483072 245.10 65280
+776.548352 245.10 65280
+776.613632 245.10 65280
+776.678912 245.10 65280
+776.744192 245.10 65280
+776.809472 245.10 65280
+776.874752 245.10 65280
+776.940032 245.10 65280
+777.005312 245.10 65280
+777.070592 245.10 65280
+777.135872 245.10 65280
+777.201152 245.10 65280
+777.266432 245.10 65280
+777.331712 245.10 65280
+777.396992 245.10 65280
+777.462272 245.10 65280
+777.527552 245.10 65280
+777.592832 245.10 65280
+777.658112 245.10 65280
+777.723392 245.10 65280
+777.788672 245.10 65280
+777.853952 245.10 65280
+777.919232 245.10 65280
+777.984512 245.10 65280
+778.049792 245.10 65280
+778.115072 245.10 65280
+778.180352 245.10 65280
+778.245632 245.10 65280
+778.310912 245.10 65280
+778.376192 245.10 65280
+778.441472 245.10 65280
+778.506752 245.10 65280
+778.572032 245.10 65280
+778.637312 245.10 65280
+778.702592 245.10 65280
+778.767872 245.10 65280
+778.833152 245.10 65280
+778.898432 245.10 65280
+778.963712 245.10 65280
+779.028992 245.10 65280
+779.094272 245.10 65280
+779.159552 245.10 65280
+779.224832 245.10 65280
+779.290112 245.10 65280
+779.355392 245.10 65280
+779.420672 245.10 65280
+779.485952 245.10 65280
+779.551232 245.10 65280
+779.616512 245.10 65280
+779.681792 245.10 65280
+779.746816 246.06 65024
+779.811840 246.06 65024
+779.876864 246.06 65024
+779.941888 246.06 65024
+780.006912 246.06 65024
+780.071936 246.06 65024
+780.136960 246.06 65024
+780.201984 246.06 65024
+780.267008 246.06 65024
+780.332032 246.06 65024
+780.397056 246.06 65024
+780.462080 246.06 65024
+780.527104 246.06 65024
+780.592128 246.06 65024
+780.657152 246.06 65024
+780.722176 246.06 65024
+780.787200 246.06 65024
+780.852224 246.06 65024
+780.917248 246.06 65024
+780.982272 246.06 65024
+781.047296 246.06 65024
+781.112320 246.06 65024
+781.177344 246.06 65024
+781.242368 246.06 65024
+781.307392 246.06 65024
+781.372416 246.06 65024
+781.437440 246.06 65024
+781.502464 246.06 65024
+781.567488 246.06 65024
+781.632512 246.06 65024
+781.697536 246.06 65024
+781.762560 246.06 65024
+781.827584 246.06 65024
+781.892608 246.06 65024
+781.957632 246.06 65024
+782.022656 246.06 65024
+782.087680 246.06 65024
+782.152704 246.06 65024
+782.217728 246.06 65024
+782.282752 246.06 65024
+782.347776 246.06 65024
+782.412800 246.06 65024
+782.477824 246.06 65024
+782.542848 246.06 65024
+782.607872 246.06 65024
+782.672896 246.06 65024
+782.737920 246.06 65024
+782.802944 246.06 65024
+782.867968 246.06 65024
+782.932992 246.06 65024
+782.998016 246.06 65024
+783.063040 246.06 65024
+783.128064 246.06 65024
+783.193088 246.06 65024
+783.258112 246.06 65024
+783.323136 246.06 65024
+783.388160 246.06 65024
+783.453184 246.06 65024
+783.518208 246.06 65024
+783.583232 246.06 65024
+783.648256 246.06 65024
+783.713280 246.06 65024
+783.778304 246.06 65024
+783.843328 246.06 65024
+783.907840 248.02 64512
+783.972352 248.02 64512
+784.036864 248.02 64512
+784.101376 248.02 64512
+784.165888 248.02 64512
+784.230400 248.02 64512
+784.294912 248.02 64512
+784.359424 248.02 64512
+784.423936 248.02 64512
+784.488448 248.02 64512
+784.552960 248.02 64512
+784.617472 248.02 64512
+784.681984 248.02 64512
+784.746496 248.02 64512
+784.811008 248.02 64512
+784.875520 248.02 64512
+784.940032 248.02 64512
+785.004544 248.02 64512
+785.069056 248.02 64512
+785.133568 248.02 64512
+785.198080 248.02 64512
+785.262592 248.02 64512
+785.327104 248.02 64512
+785.391616 248.02 64512
+785.456128 248.02 64512
+785.520640 248.02 64512
+785.585152 248.02 64512
+785.649664 248.02 64512
+785.714176 248.02 64512
+785.778688 248.02 64512
+785.843200 248.02 64512
+785.907712 248.02 64512
+785.972224 248.02 64512
+786.036736 248.02 64512
+786.101248 248.02 64512
+786.165760 248.02 64512
+786.230272 248.02 64512
+786.294784 248.02 64512
+786.359296 248.02 64512
+786.423808 248.02 64512
+786.488320 248.02 64512
+786.552832 248.02 64512
+786.617344 248.02 64512
+786.681856 248.02 64512
+786.746368 248.02 64512
+786.810880 248.02 64512
+786.875392 248.02 64512
+786.939904 248.02 64512
+787.004416 248.02 64512
+787.068928 248.02 64512
+787.133440 248.02 64512
+787.197952 248.02 64512
+787.262464 248.02 64512
+787.326976 248.02 64512
+787.391488 248.02 64512
+787.456000 248.02 64512
+787.520512 248.02 64512
+787.585024 248.02 64512
+787.649536 248.02 64512
+787.714048 248.02 64512
+787.778560 248.02 64512
+787.843072 248.02 64512
+787.907584 248.02 64512
+787.972096 248.02 64512
+788.036352 249.00 64256
+788.100608 249.00 64256
+788.164864 249.00 64256
+788.229120 249.00 64256
+788.293376 249.00 64256
+788.357632 249.00 64256
+788.421888 249.00 64256
+788.486144 249.00 64256
+788.550400 249.00 64256
+788.614656 249.00 64256
+788.678912 249.00 64256
+788.743168 249.00 64256
+788.807424 249.00 64256
+788.871680 249.00 64256
+788.935936 249.00 64256
+789.000192 249.00 64256
+789.064448 249.00 64256
+789.128704 249.00 64256
+789.192960 249.00 64256
+789.257216 249.00 64256
+789.321472 249.00 64256
+789.385728 249.00 64256
+789.449984 249.00 64256
+789.514240 249.00 64256
+789.578496 249.00 64256
+789.642752 249.00 64256
+789.707008 249.00 64256
+789.771264 249.00 64256
+789.835520 249.00 64256
+789.899776 249.00 64256
+789.964032 249.00 64256
+790.028288 249.00 64256
+790.092544 249.00 64256
+790.156800 249.00 64256
+790.221056 249.00 64256
+790.285312 249.00 64256
+790.349568 249.00 64256
+790.413824 249.00 64256
+790.478080 249.00 64256
+790.542336 249.00 64256
+790.606592 249.00 64256
+790.670848 249.00 64256
+790.735104 249.00 64256
+790.799360 249.00 64256
+790.863616 249.00 64256
+790.927872 249.00 64256
+790.992128 249.00 64256
+791.056384 249.00 64256
+791.120640 249.00 64256
+791.184896 249.00 64256
+791.249152 249.00 64256
+791.313408 249.00 64256
+791.377664 249.00 64256
+791.441920 249.00 64256
+791.506176 249.00 64256
+791.570432 249.00 64256
+791.634688 249.00 64256
+791.698944 249.00 64256
+791.763200 249.00 64256
+791.827456 249.00 64256
+791.891712 249.00 64256
+791.955968 249.00 64256
+792.020224 249.00 64256
+792.084480 249.00 64256
+792.148480 250.00 64000
+792.276480 250.00 64000
+792.404480 250.00 64000
+792.532480 250.00 64000
+792.660480 250.00 64000
+792.788480 250.00 64000
+792.916480 250.00 64000
+793.044480 250.00 64000
+793.172480 250.00 64000
+793.300480 250.00 64000
+793.428480 250.00 64000
+793.556480 250.00 64000
+793.684480 250.00 64000
+793.812480 250.00 64000
+793.940480 250.00 64000
+794.068480 250.00 64000
+794.196480 250.00 64000
+794.324480 250.00 64000
+794.452480 250.00 64000
+794.580480 250.00 64000
+794.708480 250.00 64000
+794.836480 250.00 64000
+794.964480 250.00 64000
+795.092480 250.00 64000
+795.220480 250.00 64000
+795.348480 250.00 64000
+795.476480 250.00 64000
+795.604480 250.00 64000
+795.732480 250.00 64000
+795.860480 250.00 64000
+795.988480 250.00 64000
+796.116480 250.00 64000
+796.244480 250.00 64000
+796.372480 250.00 64000
+796.500480 250.00 64000
+796.628480 250.00 64000
+796.756480 250.00 64000
+796.884480 250.00 64000
+797.012480 250.00 64000
+797.140480 250.00 64000
+797.268480 250.00 64000
+797.396480 250.00 64000
+797.524480 250.00 64000
+797.652480 250.00 64000
+797.780480 250.00 64000
+797.908480 250.00 64000
+798.036480 250.00 64000
+798.164480 250.00 64000
+798.292480 250.00 64000
+798.420480 250.00 64000
+798.548480 250.00 64000
+798.676480 250.00 64000
+798.804480 250.00 64000
+798.932480 250.00 64000
+799.060480 250.00 64000
+799.188480 250.00 64000
+799.316480 250.00 64000
+799.444480 250.00 64000
+799.572480 250.00 64000
+799.700480 250.00 64000
+799.828480 250.00 64000
+799.956480 250.00 64000
+800.084480 250.00 64000
+800.212480 250.00 64000
+800.340480 250.00 64000
+800.468480 250.00 64000
+800.596480 250.00 64000
+800.724480 250.00 64000
+800.852480 250.00 64000
+800.980480 250.00 64000
+801.108480 250.00 64000
+801.236480 250.00 64000
+801.364480 250.00 64000
+801.492480 250.00 64000
+801.620480 250.00 64000
+801.748480 250.00 64000
+801.876480 250.00 64000
+802.004480 250.00 64000
+802.132480 250.00 64000
+802.260480 250.00 64000
+802.388480 250.00 64000
+802.516480 250.00 64000
+802.644480 250.00 64000
+802.772480 250.00 64000
+802.900480 250.00 64000
+803.028480 250.00 64000
+803.156480 250.00 64000
+803.284480 250.00 64000
+803.412480 250.00 64000
+803.540480 250.00 64000
+803.668480 250.00 64000
+803.796480 250.00 64000
+803.924480 250.00 64000
+804.052480 250.00 64000
+804.180480 250.00 64000
+804.308480 250.00 64000
+804.436480 250.00 64000
+804.564480 250.00 64000
+804.692480 250.00 64000
+804.820480 250.00 64000
+804.948480 250.00 64000
+805.076480 250.00 64000
+805.204480 250.00 64000
+805.332480 250.00 64000
+805.460480 250.00 64000
+805.588480 250.00 64000
+805.716480 250.00 64000
+805.844480 250.00 64000
+805.972480 250.00 64000
+806.100480 250.00 64000
+806.228480 250.00 64000
+806.356480 250.00 64000
+806.484480 250.00 64000
+806.612480 250.00 64000
+806.740480 250.00 64000
+806.868480 250.00 64000
+806.996480 250.00 64000
+807.124480 250.00 64000
+807.252480 250.00 64000
+807.380480 250.00 64000
+807.508480 250.00 64000
+807.636480 250.00 64000
+807.764480 250.00 64000
+807.892480 250.00 64000
+808.020480 250.00 64000
+808.148480 250.00 64000
+808.276480 250.00 64000
+808.404480 250.00 64000
+808.532480 250.00 64000
+808.660480 250.00 64000
+808.788480 250.00 64000
+808.916480 250.00 64000
+809.044480 250.00 64000
+809.172480 250.00 64000
+809.300480 250.00 64000
+809.428480 250.00 64000
+809.556480 250.00 64000
+809.684480 250.00 64000
+809.812480 250.00 64000
+809.940480 250.00 64000
+810.068480 250.00 64000
+810.196480 250.00 64000
+810.324480 250.00 64000
+810.452480 250.00 64000
+810.580480 250.00 64000
+810.708480 250.00 64000
+810.836480 250.00 64000
+810.964480 250.00 64000
+811.092480 250.00 64000
+811.220480 250.00 64000
+811.348480 250.00 64000
+811.476480 250.00 64000
+811.604480 250.00 64000
+811.732480 250.00 64000
+811.860480 250.00 64000
+811.988480 250.00 64000
+812.116480 250.00 64000
+812.244480 250.00 64000
+812.372480 250.00 64000
+812.500480 250.00 64000
+812.628480 250.00 64000
+812.756480 250.00 64000
+812.884480 250.00 64000
+813.012480 250.00 64000
+813.140480 250.00 64000
+813.268480 250.00 64000
+813.396480 250.00 64000
+813.524480 250.00 64000
+813.652480 250.00 64000
+813.780480 250.00 64000
+813.908480 250.00 64000
+814.036480 250.00 64000
+814.164480 250.00 64000
+814.292480 250.00 64000
+814.420480 250.00 64000
+814.548480 250.00 64000
+814.676480 250.00 64000
+814.804480 250.00 64000
+814.932480 250.00 64000
+815.060480 250.00 64000
+815.188480 250.00 64000
+815.316480 250.00 64000
+815.444480 250.00 64000
+815.572480 250.00 64000
+815.700480 250.00 64000
+815.828480 250.00 64000
+815.956480 250.00 64000
+816.084480 250.00 64000
+816.212480 250.00 64000
+816.340480 250.00 64000
+816.468480 250.00 64000
+816.596480 250.00 64000
+816.724480 250.00 64000
+816.852480 250.00 64000
+816.980480 250.00 64000
+817.108480 250.00 64000
+817.236480 250.00 64000
+817.364480 250.00 64000
+817.492480 250.00 64000
+817.620480 250.00 64000
+817.748480 250.00 64000
+817.876480 250.00 64000
+818.004480 250.00 64000
+818.132480 250.00 64000
+818.260480 250.00 64000
+818.388480 250.00 64000
+818.516480 250.00 64000
+818.644480 250.00 64000
+818.772480 250.00 64000
+818.900480 250.00 64000
+819.028480 250.00 64000
+819.156480 250.00 64000
+819.284480 250.00 64000
+819.412480 250.00 64000
+819.540480 250.00 64000
+819.668480 250.00 64000
+819.796480 250.00 64000
+819.924480 250.00 64000
+820.052480 250.00 64000
+820.180480 250.00 64000
+820.308480 250.00 64000
+820.436480 250.00 64000
+820.564480 250.00 64000
+820.692480 250.00 64000
+820.820480 250.00 64000
+820.948480 250.00 64000
+821.076480 250.00 64000
+821.204480 250.00 64000
+821.332480 250.00 64000
+821.460480 250.00 64000
+821.588480 250.00 64000
+821.716480 250.00 64000
+821.844480 250.00 64000
+821.972480 250.00 64000
+822.100480 250.00 64000
+822.228480 250.00 64000
+822.356480 250.00 64000
+822.484480 250.00 64000
+822.612480 250.00 64000
+822.740480 250.00 64000
+822.868480 250.00 64000
+822.996480 250.00 64000
+823.124480 250.00 64000
+823.252480 250.00 64000
+823.380480 250.00 64000
+823.508480 250.00 64000
+823.636480 250.00 64000
+823.764480 250.00 64000
+823.892480 250.00 64000
+824.020480 250.00 64000
+824.148480 250.00 64000
+824.276480 250.00 64000
+824.404480 250.00 64000
+824.532480 250.00 64000
+824.660480 250.00 64000
+824.788480 250.00 64000
+824.916480 250.00 64000
+825.044480 250.00 64000
+825.172480 250.00 64000
+825.300480 250.00 64000
+825.428480 250.00 64000
+825.556480 250.00 64000
+825.684480 250.00 64000
+825.812480 250.00 64000
+825.940480 250.00 64000
+826.068480 250.00 64000
+826.196480 250.00 64000
+826.324480 250.00 64000
+826.452480 250.00 64000
+826.580480 250.00 64000
+826.708480 250.00 64000
+826.836480 250.00 64000
+826.964480 250.00 64000
+827.092480 250.00 64000
+827.220480 250.00 64000
+827.348480 250.00 64000
+827.476480 250.00 64000
+827.604480 250.00 64000
+827.732480 250.00 64000
+827.860480 250.00 64000
+827.988480 250.00 64000
+828.116480 250.00 64000
+828.244480 250.00 64000
+828.372480 250.00 64000
+828.500480 250.00 64000
+828.628480 250.00 64000
+828.756480 250.00 64000
+828.884480 250.00 64000
+829.012480 250.00 64000
+829.140480 250.00 64000
+829.268480 250.00 64000
+829.396480 250.00 64000
+829.524480 250.00 64000
+829.652480 250.00 64000
+829.780480 250.00 64000
+829.908480 250.00 64000
+830.036480 250.00 64000
+830.164480 250.00 64000
+830.292480 250.00 64000
+830.420480 250.00 64000
+830.548480 250.00 64000
+830.676480 250.00 64000
+830.804480 250.00 64000
+830.932480 250.00 64000
+831.060480 250.00 64000
+831.188480 250.00 64000
+831.316480 250.00 64000
+831.444480 250.00 64000
+831.572480 250.00 64000
+831.700480 250.00 64000
+831.828480 250.00 64000
+831.956480 250.00 64000
+832.084480 250.00 64000
+832.212480 250.00 64000
+832.340480 250.00 64000
+832.468480 250.00 64000
+832.596480 250.00 64000
+832.724480 250.00 64000
+832.852480 250.00 64000
+832.980480 250.00 64000
+833.108480 250.00 64000
+833.236480 250.00 64000
+833.364480 250.00 64000
+833.492480 250.00 64000
+833.620480 250.00 64000
+833.748480 250.00 64000
+833.876480 250.00 64000
+834.004480 250.00 64000
+834.132480 250.00 64000
+834.260480 250.00 64000
+834.388480 250.00 64000
+834.516480 250.00 64000
+834.644480 250.00 64000
+834.772480 250.00 64000
+834.900480 250.00 64000
+835.028480 250.00 64000
+835.156480 250.00 64000
+835.284480 250.00 64000
+835.412480 250.00 64000
+835.540480 250.00 64000
+835.668480 250.00 64000
+835.796480 250.00 64000
+835.924480 250.00 64000
+836.052480 250.00 64000
+836.180480 250.00 64000
+836.308480 250.00 64000
+836.436480 250.00 64000
+836.564480 250.00 64000
+836.692480 250.00 64000
+836.820480 250.00 64000
+836.948480 250.00 64000
+837.076480 250.00 64000
+837.204480 250.00 64000
+837.332480 250.00 64000
+837.460480 250.00 64000
+837.588480 250.00 64000
+837.716480 250.00 64000
+837.844480 250.00 64000
+837.972480 250.00 64000
+838.100480 250.00 64000
+838.228480 250.00 64000
+838.356480 250.00 64000
+838.484480 250.00 64000
+838.612480 250.00 64000
+838.740480 250.00 64000
+838.868480 250.00 64000
+838.996480 250.00 64000
+839.124480 250.00 64000
+839.252480 250.00 64000
+839.380480 250.00 64000
+839.508480 250.00 64000
+839.636480 250.00 64000
+839.764480 250.00 64000
+839.892480 250.00 64000
+840.020480 250.00 64000
+840.148480 250.00 64000
+840.276480 250.00 64000
+840.404480 250.00 64000
+840.532480 250.00 64000
+840.660480 250.00 64000
+840.788480 250.00 64000
+840.916480 250.00 64000
+841.044480 250.00 64000
+841.172480 250.00 64000
+841.300480 250.00 64000
+841.428480 250.00 64000
+841.556480 250.00 64000
+841.684480 250.00 64000
+841.812480 250.00 64000
+841.940480 250.00 64000
+842.068480 250.00 64000
+842.196480 250.00 64000
+842.324480 250.00 64000
+842.452480 250.00 64000
+842.580480 250.00 64000
+842.708480 250.00 64000
+842.836480 250.00 64000
+842.964480 250.00 64000
+843.092480 250.00 64000
+843.220480 250.00 64000
+843.348480 250.00 64000
+843.476480 250.00 64000
+843.604480 250.00 64000
+843.732480 250.00 64000
+843.860480 250.00 64000
+843.988480 250.00 64000
+844.116480 250.00 64000
+844.244480 250.00 64000
+844.372480 250.00 64000
+844.500480 250.00 64000
+844.628480 250.00 64000
+844.756480 250.00 64000
+844.884480 250.00 64000
+845.012480 250.00 64000
+845.140480 250.00 64000
+845.268480 250.00 64000
+845.396480 250.00 64000
+845.524480 250.00 64000
+845.652480 250.00 64000
+845.780480 250.00 64000
+845.908480 250.00 64000
+846.036480 250.00 64000
+846.164480 250.00 64000
+846.292480 250.00 64000
+846.420480 250.00 64000
+846.548480 250.00 64000
+846.676480 250.00 64000
+846.804480 250.00 64000
+846.932480 250.00 64000
+847.060480 250.00 64000
+847.188480 250.00 64000
+847.316480 250.00 64000
+847.444480 250.00 64000
+847.572480 250.00 64000
+847.700480 250.00 64000
+847.828480 250.00 64000
+847.956480 250.00 64000
+848.084480 250.00 64000
+848.212480 250.00 64000
+848.340480 250.00 64000
+848.468480 250.00 64000
+848.596480 250.00 64000
+848.724480 250.00 64000
+848.852480 250.00 64000
+848.980480 250.00 64000
+849.108480 250.00 64000
+849.236480 250.00 64000
+849.364480 250.00 64000
+849.492480 250.00 64000
+849.620480 250.00 64000
+849.748480 250.00 64000
+849.876480 250.00 64000
+850.004480 250.00 64000
+850.132480 250.00 64000
+850.260480 250.00 64000
+850.388480 250.00 64000
+850.516480 250.00 64000
+850.644480 250.00 64000
+850.772480 250.00 64000
+850.900480 250.00 64000
+851.028480 250.00 64000
+851.156480 250.00 64000
+851.284480 250.00 64000
+851.412480 250.00 64000
+851.540480 250.00 64000
+851.668480 250.00 64000
+851.796480 250.00 64000
+851.924480 250.00 64000
+852.052480 250.00 64000
+852.180480 250.00 64000
+852.308480 250.00 64000
+852.436480 250.00 64000
+852.564480 250.00 64000
+852.692480 250.00 64000
+852.820480 250.00 64000
+852.948480 250.00 64000
+853.076480 250.00 64000
+853.204480 250.00 64000
+853.332480 250.00 64000
+853.460480 250.00 64000
+853.588480 250.00 64000
+853.716480 250.00 64000
+853.844480 250.00 64000
+853.972480 250.00 64000
+854.100480 250.00 64000
+854.228480 250.00 64000
+854.356480 250.00 64000
+854.484480 250.00 64000
+854.612480 250.00 64000
+854.740480 250.00 64000
+854.868480 250.00 64000
+854.996480 250.00 64000
+855.124480 250.00 64000
+855.252480 250.00 64000
+855.380480 250.00 64000
+855.508480 250.00 64000
+855.636480 250.00 64000
+855.764480 250.00 64000
+855.892480 250.00 64000
+856.020480 250.00 64000
+856.148480 250.00 64000
+856.276480 250.00 64000
+856.404480 250.00 64000
+856.532480 250.00 64000
+856.660480 250.00 64000
+856.788480 250.00 64000
+856.916480 250.00 64000
+857.044480 250.00 64000
+857.172480 250.00 64000
+857.300480 250.00 64000
+857.428480 250.00 64000
+857.556480 250.00 64000
+857.684480 250.00 64000
+857.812480 250.00 64000
+857.940480 250.00 64000
+858.068480 250.00 64000
+858.196480 250.00 64000
+858.324480 250.00 64000
+858.452480 250.00 64000
+858.580480 250.00 64000
+858.708480 250.00 64000
+858.836480 250.00 64000
+858.964480 250.00 64000
+859.092480 250.00 64000
+859.220480 250.00 64000
+859.348480 250.00 64000
+859.476480 250.00 64000
+859.604480 250.00 64000
+859.732480 250.00 64000
+859.860480 250.00 64000
+859.988480 250.00 64000
+860.116480 250.00 64000
+860.244480 250.00 64000
+860.372480 250.00 64000
+860.500480 250.00 64000
+860.628480 250.00 64000
+860.756480 250.00 64000
+860.884480 250.00 64000
+861.012480 250.00 64000
+861.140480 250.00 64000
+861.268480 250.00 64000
+861.396480 250.00 64000
+861.524480 250.00 64000
+861.652480 250.00 64000
+861.780480 250.00 64000
+861.908480 250.00 64000
+862.036480 250.00 64000
+862.164480 250.00 64000
+862.292480 250.00 64000
+862.420480 250.00 64000
+862.548480 250.00 64000
+862.676480 250.00 64000
+862.804480 250.00 64000
+862.932480 250.00 64000
+863.060480 250.00 64000
+863.188480 250.00 64000
+863.316480 250.00 64000
+863.444480 250.00 64000
+863.572480 250.00 64000
+863.700480 250.00 64000
+863.828480 250.00 64000
+863.956480 250.00 64000
+864.084480 250.00 64000
+864.212480 250.00 64000
+864.340480 250.00 64000
+864.468480 250.00 64000
+864.596480 250.00 64000
+864.724480 250.00 64000
+864.852480 250.00 64000
+864.980480 250.00 64000
+865.108480 250.00 64000
+865.236480 250.00 64000
+865.364480 250.00 64000
+865.492480 250.00 64000
+865.620480 250.00 64000
+865.748480 250.00 64000
+865.876480 250.00 64000
+866.004480 250.00 64000
+866.132480 250.00 64000
+866.260480 250.00 64000
+866.388480 250.00 64000
+866.516480 250.00 64000
+866.644480 250.00 64000
+866.772480 250.00 64000
+866.900480 250.00 64000
+867.028480 250.00 64000
+867.156480 250.00 64000
+867.284480 250.00 64000
+867.412480 250.00 64000
+867.540480 250.00 64000
+867.668480 250.00 64000
+867.796480 250.00 64000
+867.924480 250.00 64000
+868.052480 250.00 64000
+868.180480 250.00 64000
+868.308480 250.00 64000
+868.436480 250.00 64000
+868.564480 250.00 64000
+868.692480 250.00 64000
+868.820480 250.00 64000
+868.948480 250.00 64000
+869.076480 250.00 64000
+869.204480 250.00 64000
+869.332480 250.00 64000
+869.460480 250.00 64000
+869.588480 250.00 64000
+869.716480 250.00 64000
+869.844480 250.00 64000
+869.972480 250.00 64000
+870.100480 250.00 64000
+870.228480 250.00 64000
+870.356480 250.00 64000
+870.484480 250.00 64000
+870.612480 250.00 64000
+870.740480 250.00 64000
+870.868480 250.00 64000
+870.996480 250.00 64000
+871.124480 250.00 64000
+871.252480 250.00 64000
+871.380480 250.00 64000
+871.508480 250.00 64000
+871.636480 250.00 64000
+871.764480 250.00 64000
+871.892480 250.00 64000
+872.020480 250.00 64000
+872.148480 250.00 64000
+872.276480 250.00 64000
+872.404480 250.00 64000
+872.532480 250.00 64000
+872.660480 250.00 64000
+872.788480 250.00 64000
+872.916480 250.00 64000
+873.044480 250.00 64000
+873.172480 250.00 64000
+873.300480 250.00 64000
+873.428480 250.00 64000
+873.556480 250.00 64000
+873.684480 250.00 64000
+873.812480 250.00 64000
+873.940480 250.00 64000
+874.068480 250.00 64000
+874.196480 250.00 64000
+874.324480 250.00 64000
+874.452480 250.00 64000
+874.580480 250.00 64000
+874.708480 250.00 64000
+874.836480 250.00 64000
+874.964480 250.00 64000
+875.092480 250.00 64000
+875.220480 250.00 64000
+875.348480 250.00 64000
+875.476480 250.00 64000
+875.604480 250.00 64000
+875.732480 250.00 64000
+875.860480 250.00 64000
+875.988480 250.00 64000
+876.116480 250.00 64000
+876.244480 250.00 64000
+876.372480 250.00 64000
+876.500480 250.00 64000
+876.628480 250.00 64000
+876.756480 250.00 64000
+876.884480 250.00 64000
+877.012480 250.00 64000
+877.140480 250.00 64000
+877.268480 250.00 64000
+877.396480 250.00 64000
+877.524480 250.00 64000
+877.652480 250.00 64000
+877.780480 250.00 64000
+877.908480 250.00 64000
+878.036480 250.00 64000
+878.164480 250.00 64000
+878.292480 250.00 64000
+878.420480 250.00 64000
+878.548480 250.00 64000
+878.676480 250.00 64000
+878.804480 250.00 64000
+878.932480 250.00 64000
+879.060480 250.00 64000
+879.188480 250.00 64000
+879.316480 250.00 64000
+879.444480 250.00 64000
+879.572480 250.00 64000
+879.700480 250.00 64000
+879.828480 250.00 64000
+879.956480 250.00 64000
+880.084480 250.00 64000
+880.212480 250.00 64000
+880.340480 250.00 64000
+880.468480 250.00 64000
+880.596480 250.00 64000
+880.724480 250.00 64000
+880.852480 250.00 64000
+880.980480 250.00 64000
+881.108480 250.00 64000
+881.236480 250.00 64000
+881.364480 250.00 64000
+881.492480 250.00 64000
+881.620480 250.00 64000
+881.748480 250.00 64000
+881.876480 250.00 64000
+882.004480 250.00 64000
+882.132480 250.00 64000
+882.260480 250.00 64000
+882.388480 250.00 64000
+882.516480 250.00 64000
+882.644480 250.00 64000
+882.772480 250.00 64000
+882.900480 250.00 64000
+883.028480 250.00 64000
+883.156480 250.00 64000
+883.284480 250.00 64000
+883.412480 250.00 64000
+883.540480 250.00 64000
+883.668480 250.00 64000
+883.796480 250.00 64000
+883.924480 250.00 64000
+884.052480 250.00 64000
+884.180480 250.00 64000
+884.308480 250.00 64000
+884.436480 250.00 64000
+884.564480 250.00 64000
+884.692480 250.00 64000
+884.820480 250.00 64000
+884.948480 250.00 64000
+885.076480 250.00 64000
+885.204480 250.00 64000
+885.332480 250.00 64000
+885.460480 250.00 64000
+885.588480 250.00 64000
+885.716480 250.00 64000
+885.844480 250.00 64000
+885.972480 250.00 64000
+886.100480 250.00 64000
+886.228480 250.00 64000
+886.356480 250.00 64000
+886.484480 250.00 64000
+886.612480 250.00 64000
+886.740480 250.00 64000
+886.868480 250.00 64000
+886.996480 250.00 64000
+887.124480 250.00 64000
+887.252480 250.00 64000
+887.380480 250.00 64000
+887.508480 250.00 64000
+887.636480 250.00 64000
+887.764480 250.00 64000
+887.892480 250.00 64000
+888.020480 250.00 64000
+888.148480 250.00 64000
+888.276480 250.00 64000
+888.404480 250.00 64000
+888.532480 250.00 64000
+888.660480 250.00 64000
+888.788480 250.00 64000
+888.916480 250.00 64000
+889.044480 250.00 64000
+889.172480 250.00 64000
+889.300480 250.00 64000
+889.428480 250.00 64000
+889.556480 250.00 64000
+889.684480 250.00 64000
+889.812480 250.00 64000
+889.940480 250.00 64000
+890.068480 250.00 64000
+890.196480 250.00 64000
+890.324480 250.00 64000
+890.452480 250.00 64000
+890.580480 250.00 64000
+890.708480 250.00 64000
+890.836480 250.00 64000
+890.964480 250.00 64000
+891.092480 250.00 64000
+891.220480 250.00 64000
+891.348480 250.00 64000
+891.476480 250.00 64000
+891.604480 250.00 64000
+891.732480 250.00 64000
+891.860480 250.00 64000
+891.988480 250.00 64000
+892.116480 250.00 64000
+892.244480 250.00 64000
+892.372480 250.00 64000
+892.500480 250.00 64000
+892.628480 250.00 64000
+892.756480 250.00 64000
+892.884480 250.00 64000
+893.012480 250.00 64000
+893.140480 250.00 64000
+893.268480 250.00 64000
+893.396480 250.00 64000
+893.524480 250.00 64000
+893.652480 250.00 64000
+893.780480 250.00 64000
+893.908480 250.00 64000
+894.036480 250.00 64000
+894.164480 250.00 64000
+894.292480 250.00 64000
+894.420480 250.00 64000
+894.548480 250.00 64000
+894.676480 250.00 64000
+894.804480 250.00 64000
+894.932480 250.00 64000
+895.060480 250.00 64000
+895.188480 250.00 64000
+895.316480 250.00 64000
+895.444480 250.00 64000
+895.572480 250.00 64000
+895.700480 250.00 64000
+895.828480 250.00 64000
+895.956480 250.00 64000
+896.084480 250.00 64000
+896.212480 250.00 64000
+896.340480 250.00 64000
+896.468480 250.00 64000
+896.596480 250.00 64000
+896.724480 250.00 64000
+896.852480 250.00 64000
+896.980480 250.00 64000
+897.108480 250.00 64000
+897.236480 250.00 64000
+897.364480 250.00 64000
+897.492480 250.00 64000
+897.620480 250.00 64000
+897.748480 250.00 64000
+897.876480 250.00 64000
+898.004480 250.00 64000
+898.132480 250.00 64000
+898.260480 250.00 64000
+898.388480 250.00 64000
+898.516480 250.00 64000
+898.644480 250.00 64000
+898.772480 250.00 64000
+898.900480 250.00 64000
+899.028480 250.00 64000
+899.156480 250.00 64000
+899.284480 250.00 64000
+899.412480 250.00 64000
+899.540480 250.00 64000
+899.668480 250.00 64000
+899.796480 250.00 64000
+899.924480 250.00 64000
+900.052480 250.00 64000
+900.180480 250.00 64000
+900.308480 250.00 64000
+900.436480 250.00 64000
+900.564480 250.00 64000
+900.692480 250.00 64000
+900.820480 250.00 64000
+900.948480 250.00 64000
+901.076480 250.00 64000
+901.204480 250.00 64000
+901.332480 250.00 64000
+901.460480 250.00 64000
+901.588480 250.00 64000
+901.716480 250.00 64000
+901.844480 250.00 64000
+901.972480 250.00 64000
+902.100480 250.00 64000
+902.228480 250.00 64000
+902.356480 250.00 64000
+902.484480 250.00 64000
+902.612480 250.00 64000
+902.740480 250.00 64000
+902.868480 250.00 64000
+902.996480 250.00 64000
+903.124480 250.00 64000
+903.252480 250.00 64000
+903.380480 250.00 64000
+903.508480 250.00 64000
+903.636480 250.00 64000
+903.764480 250.00 64000
+903.892480 250.00 64000
+904.020480 250.00 64000
+904.148480 250.00 64000
+904.276480 250.00 64000
+904.404480 250.00 64000
+904.532480 250.00 64000
+904.660480 250.00 64000
+904.788480 250.00 64000
+904.916480 250.00 64000
+905.044480 250.00 64000
+905.172480 250.00 64000
+905.300480 250.00 64000
+905.428480 250.00 64000
+905.556480 250.00 64000
+905.684480 250.00 64000
+905.812480 250.00 64000
+905.940480 250.00 64000
+906.068480 250.00 64000
+906.196480 250.00 64000
+906.324480 250.00 64000
+906.452480 250.00 64000
+906.580480 250.00 64000
+906.708480 250.00 64000
+906.836480 250.00 64000
+906.964480 250.00 64000
+907.092480 250.00 64000
+907.220480 250.00 64000
+907.348480 250.00 64000
+907.476480 250.00 64000
+907.604480 250.00 64000
+907.732480 250.00 64000
+907.860480 250.00 64000
+907.988480 250.00 64000
+908.116480 250.00 64000
+908.244480 250.00 64000
+908.372480 250.00 64000
+908.500480 250.00 64000
+908.628480 250.00 64000
+908.756480 250.00 64000
+908.884480 250.00 64000
+909.012480 250.00 64000
+909.140480 250.00 64000
+909.268480 250.00 64000
+909.396480 250.00 64000
+909.524480 250.00 64000
+909.652480 250.00 64000
+909.780480 250.00 64000
+909.908480 250.00 64000
+910.036480 250.00 64000
+910.164480 250.00 64000
+910.292480 250.00 64000
+910.420480 250.00 64000
+910.548480 250.00 64000
+910.676480 250.00 64000
+910.804480 250.00 64000
+910.932480 250.00 64000
+911.060480 250.00 64000
+911.188480 250.00 64000
+911.316480 250.00 64000
+911.444480 250.00 64000
+911.572480 250.00 64000
+911.700480 250.00 64000
+911.828480 250.00 64000
+911.956480 250.00 64000
+912.084480 250.00 64000
+912.212480 250.00 64000
+912.340480 250.00 64000
+912.468480 250.00 64000
+912.596480 250.00 64000
+912.724480 250.00 64000
+912.852480 250.00 64000
+912.980480 250.00 64000
+913.108480 250.00 64000
+913.236480 250.00 64000
+913.364480 250.00 64000
+913.492480 250.00 64000
+913.620480 250.00 64000
+913.748480 250.00 64000
+913.876480 250.00 64000
+914.004480 250.00 64000
+914.132480 250.00 64000
+914.260480 250.00 64000
+914.388480 250.00 64000
+914.516480 250.00 64000
+914.644480 250.00 64000
+914.772480 250.00 64000
+914.900480 250.00 64000
+915.028480 250.00 64000
+915.156480 250.00 64000
+915.284480 250.00 64000
+915.412480 250.00 64000
+915.540480 250.00 64000
+915.668480 250.00 64000
+915.796480 250.00 64000
+915.924480 250.00 64000
+916.052480 250.00 64000
+916.180480 250.00 64000
+916.308480 250.00 64000
+916.436480 250.00 64000
+916.564480 250.00 64000
+916.692480 250.00 64000
+916.820480 250.00 64000
+916.948480 250.00 64000
+917.076480 250.00 64000
+917.204480 250.00 64000
+917.332480 250.00 64000
+917.460480 250.00 64000
+917.588480 250.00 64000
+917.716480 250.00 64000
+917.844480 250.00 64000
+917.972480 250.00 64000
+918.100480 250.00 64000
+918.228480 250.00 64000
+918.356480 250.00 64000
+918.484480 250.00 64000
+918.612480 250.00 64000
+918.740480 250.00 64000
+918.868480 250.00 64000
+918.996480 250.00 64000
+919.124480 250.00 64000
+919.252480 250.00 64000
+919.380480 250.00 64000
+919.508480 250.00 64000
+919.636480 250.00 64000
+919.764480 250.00 64000
+919.892480 250.00 64000
+920.020480 250.00 64000
+920.148480 250.00 64000
+920.276480 250.00 64000
+920.404480 250.00 64000
+920.532480 250.00 64000
+920.660480 250.00 64000
+920.788480 250.00 64000
+920.916480 250.00 64000
+921.044480 250.00 64000
+921.172480 250.00 64000
+921.300480 250.00 64000
+921.428480 250.00 64000
+921.556480 250.00 64000
+921.684480 250.00 64000
+921.812480 250.00 64000
+921.940480 250.00 64000
+922.068480 250.00 64000
+922.196480 250.00 64000
+922.324480 250.00 64000
+922.452480 250.00 64000
+922.580480 250.00 64000
+922.708480 250.00 64000
+922.836480 250.00 64000
+922.964480 250.00 64000
+923.092480 250.00 64000
+923.220480 250.00 64000
+923.348480 250.00 64000
+923.476480 250.00 64000
+923.604480 250.00 64000
+923.732480 250.00 64000
+923.860480 250.00 64000
+923.988480 250.00 64000
+924.116480 250.00 64000
+924.244480 250.00 64000
+924.372480 250.00 64000
+924.500480 250.00 64000
+924.628480 250.00 64000
+924.756480 250.00 64000
+924.884480 250.00 64000
+925.012480 250.00 64000
+925.140480 250.00 64000
+925.268480 250.00 64000
+925.396480 250.00 64000
+925.524480 250.00 64000
+925.652480 250.00 64000
+925.780480 250.00 64000
+925.908480 250.00 64000
+926.036480 250.00 64000
+926.164480 250.00 64000
+926.292480 250.00 64000
+926.420480 250.00 64000
+926.548480 250.00 64000
+926.676480 250.00 64000
+926.804480 250.00 64000
+926.932480 250.00 64000
+927.060480 250.00 64000
+927.188480 250.00 64000
+927.316480 250.00 64000
+927.444480 250.00 64000
+927.572480 250.00 64000
+927.700480 250.00 64000
+927.828480 250.00 64000
+927.956480 250.00 64000
+928.084480 250.00 64000
+928.212480 250.00 64000
+928.340480 250.00 64000
+928.468480 250.00 64000
+928.596480 250.00 64000
+928.724480 250.00 64000
+928.852480 250.00 64000
+928.980480 250.00 64000
+929.108480 250.00 64000
+929.236480 250.00 64000
+929.364480 250.00 64000
+929.492480 250.00 64000
+929.620480 250.00 64000
+929.748480 250.00 64000
+929.876480 250.00 64000
+930.004480 250.00 64000
+930.132480 250.00 64000
+930.260480 250.00 64000
+930.388480 250.00 64000
+930.516480 250.00 64000
+930.644480 250.00 64000
+930.772480 250.00 64000
+930.900480 250.00 64000
+931.028480 250.00 64000
+931.156480 250.00 64000
+931.284480 250.00 64000
+931.412480 250.00 64000
+931.540480 250.00 64000
+931.668480 250.00 64000
+931.796480 250.00 64000
+931.924480 250.00 64000
+932.052480 250.00 64000
+932.180480 250.00 64000
+932.308480 250.00 64000
+932.436480 250.00 64000
+932.564480 250.00 64000
+932.692480 250.00 64000
+932.820480 250.00 64000
+932.948480 250.00 64000
+933.076480 250.00 64000
+933.204480 250.00 64000
+933.332480 250.00 64000
+933.460480 250.00 64000
+933.588480 250.00 64000
+933.716480 250.00 64000
+933.844480 250.00 64000
+933.972480 250.00 64000
+934.100480 250.00 64000
+934.228480 250.00 64000
+934.356480 250.00 64000
+934.484480 250.00 64000
+934.612480 250.00 64000
+934.740480 250.00 64000
+934.868480 250.00 64000
+934.996480 250.00 64000
+935.124480 250.00 64000
+935.252480 250.00 64000
+935.380480 250.00 64000
+935.508480 250.00 64000
+935.636480 250.00 64000
+935.764480 250.00 64000
+935.892480 250.00 64000
+936.020480 250.00 64000
+936.148480 250.00 64000
+936.276480 250.00 64000
+936.404480 250.00 64000
+936.532480 250.00 64000
+936.660480 250.00 64000
+936.788480 250.00 64000
+936.916480 250.00 64000
+937.044480 250.00 64000
+937.172480 250.00 64000
+937.300480 250.00 64000
+937.428480 250.00 64000
+937.556480 250.00 64000
+937.684480 250.00 64000
+937.812480 250.00 64000
+937.940480 250.00 64000
+938.068480 250.00 64000
+938.196480 250.00 64000
+938.324480 250.00 64000
+938.452480 250.00 64000
+938.580480 250.00 64000
+938.708480 250.00 64000
+938.836480 250.00 64000
+938.964480 250.00 64000
+939.092480 250.00 64000
+939.220480 250.00 64000
+939.348480 250.00 64000
+939.476480 250.00 64000
+939.604480 250.00 64000
+939.732480 250.00 64000
+939.860480 250.00 64000
+939.988480 250.00 64000
+940.116480 250.00 64000
+940.244480 250.00 64000
+940.372480 250.00 64000
+940.500480 250.00 64000
+940.628480 250.00 64000
+940.756480 250.00 64000
+940.884480 250.00 64000
+941.012480 250.00 64000
+941.140480 250.00 64000
+941.268480 250.00 64000
+941.396480 250.00 64000
+941.524480 250.00 64000
+941.652480 250.00 64000
+941.780480 250.00 64000
+941.908480 250.00 64000
+942.036480 250.00 64000
+942.164480 250.00 64000
+942.292480 250.00 64000
+942.420480 250.00 64000
+942.548480 250.00 64000
+942.676480 250.00 64000
+942.804480 250.00 64000
+942.932480 250.00 64000
+943.060480 250.00 64000
+943.188480 250.00 64000
+943.316480 250.00 64000
+943.444480 250.00 64000
+943.572480 250.00 64000
+943.700480 250.00 64000
+943.828480 250.00 64000
+943.956480 250.00 64000
+944.084480 250.00 64000
+944.212480 250.00 64000
+944.340480 250.00 64000
+944.468480 250.00 64000
+944.596480 250.00 64000
+944.724480 250.00 64000
+944.852480 250.00 64000
+944.980480 250.00 64000
+945.108480 250.00 64000
+945.236480 250.00 64000
+945.364480 250.00 64000
+945.492480 250.00 64000
+945.620480 250.00 64000
+945.748480 250.00 64000
+945.876480 250.00 64000
+946.004480 250.00 64000
+946.132480 250.00 64000
+946.260480 250.00 64000
+946.388480 250.00 64000
+946.516480 250.00 64000
+946.644480 250.00 64000
+946.772480 250.00 64000
+946.900480 250.00 64000
+947.028480 250.00 64000
+947.156480 250.00 64000
+947.284480 250.00 64000
+947.412480 250.00 64000
+947.540480 250.00 64000
+947.668480 250.00 64000
+947.796480 250.00 64000
+947.924480 250.00 64000
+948.052480 250.00 64000
+948.180480 250.00 64000
+948.308480 250.00 64000
+948.436480 250.00 64000
+948.564480 250.00 64000
+948.692480 250.00 64000
+948.820480 250.00 64000
+948.948480 250.00 64000
+949.076480 250.00 64000
+949.204480 250.00 64000
+949.332480 250.00 64000
+949.460480 250.00 64000
+949.588480 250.00 64000
+949.716480 250.00 64000
+949.844480 250.00 64000
+949.972480 250.00 64000
+950.100480 250.00 64000
+950.228480 250.00 64000
+950.356480 250.00 64000
+950.484480 250.00 64000
+950.612480 250.00 64000
+950.740480 250.00 64000
+950.868480 250.00 64000
+950.996480 250.00 64000
+951.124480 250.00 64000
+951.252480 250.00 64000
+951.380480 250.00 64000
+951.508480 250.00 64000
+951.636480 250.00 64000
+951.764480 250.00 64000
+951.892480 250.00 64000
+952.020480 250.00 64000
+952.148480 250.00 64000
+952.276480 250.00 64000
+952.404480 250.00 64000
+952.532480 250.00 64000
+952.660480 250.00 64000
+952.788480 250.00 64000
+952.916480 250.00 64000
+953.044480 250.00 64000
+953.172480 250.00 64000
+953.300480 250.00 64000
+953.428480 250.00 64000
+953.556480 250.00 64000
+953.684480 250.00 64000
+953.812480 250.00 64000
+953.940480 250.00 64000
+954.068480 250.00 64000
+954.196480 250.00 64000
+954.324480 250.00 64000
+954.452480 250.00 64000
+954.580480 250.00 64000
+954.708480 250.00 64000
+954.836480 250.00 64000
+954.964480 250.00 64000
+955.092480 250.00 64000
+955.220480 250.00 64000
+955.348480 250.00 64000
+955.476480 250.00 64000
+955.604480 250.00 64000
+955.732480 250.00 64000
+955.860480 250.00 64000
+955.988480 250.00 64000
+956.116480 250.00 64000
+956.244480 250.00 64000
+956.372480 250.00 64000
+956.500480 250.00 64000
+956.628480 250.00 64000
+956.756480 250.00 64000
+956.884480 250.00 64000
+957.012480 250.00 64000
+957.140480 250.00 64000
+957.268480 250.00 64000
+957.396480 250.00 64000
+957.524480 250.00 64000
+957.652480 250.00 64000
+957.780480 250.00 64000
+957.908480 250.00 64000
+958.036480 250.00 64000
+958.164480 250.00 64000
+958.292480 250.00 64000
+958.420480 250.00 64000
+958.548480 250.00 64000
+958.676480 250.00 64000
+958.804480 250.00 64000
+958.932480 250.00 64000
+959.060480 250.00 64000
+959.188480 250.00 64000
+959.316480 250.00 64000
+959.444480 250.00 64000
+959.572480 250.00 64000
+959.700480 250.00 64000
+959.828480 250.00 64000
+959.956480 250.00 64000
+960.084480 250.00 64000
+960.212480 250.00 64000
+960.340480 250.00 64000
+960.468480 250.00 64000
+960.596480 250.00 64000
+960.724480 250.00 64000
+960.852480 250.00 64000
+960.980480 250.00 64000
+961.108480 250.00 64000
+961.236480 250.00 64000
+961.364480 250.00 64000
+961.492480 250.00 64000
+961.620480 250.00 64000
+961.748480 250.00 64000
+961.876480 250.00 64000
+962.004480 250.00 64000
+962.132480 250.00 64000
+962.260480 250.00 64000
+962.388480 250.00 64000
+962.516480 250.00 64000
+962.644480 250.00 64000
+962.772480 250.00 64000
+962.900480 250.00 64000
+963.028480 250.00 64000
+963.156480 250.00 64000
+963.284480 250.00 64000
+963.412480 250.00 64000
+963.540480 250.00 64000
+963.668480 250.00 64000
+963.796480 250.00 64000
+963.924480 250.00 64000
+964.052480 250.00 64000
+964.180480 250.00 64000
+964.308480 250.00 64000
+964.436480 250.00 64000
+964.564480 250.00 64000
+964.692480 250.00 64000
+964.820480 250.00 64000
+964.948480 250.00 64000
+965.076480 250.00 64000
+965.204480 250.00 64000
+965.332480 250.00 64000
+965.460480 250.00 64000
+965.588480 250.00 64000
+965.716480 250.00 64000
+965.844480 250.00 64000
+965.972480 250.00 64000
+966.100480 250.00 64000
+966.228480 250.00 64000
+966.356480 250.00 64000
+966.484480 250.00 64000
+966.612480 250.00 64000
+966.740480 250.00 64000
+966.868480 250.00 64000
+966.996480 250.00 64000
+967.124480 250.00 64000
+967.252480 250.00 64000
+967.380480 250.00 64000
+967.508480 250.00 64000
+967.636480 250.00 64000
+967.764480 250.00 64000
+967.892480 250.00 64000
+968.020480 250.00 64000
+968.148480 250.00 64000
+968.276480 250.00 64000
+968.404480 250.00 64000
+968.532480 250.00 64000
+968.660480 250.00 64000
+968.788480 250.00 64000
+968.916480 250.00 64000
+969.044480 250.00 64000
+969.172480 250.00 64000
+969.300480 250.00 64000
+969.428480 250.00 64000
+969.556480 250.00 64000
+969.684480 250.00 64000
+969.812480 250.00 64000
+969.940480 250.00 64000
+970.068480 250.00 64000
+970.196480 250.00 64000
+970.324480 250.00 64000
+970.452480 250.00 64000
+970.580480 250.00 64000
+970.708480 250.00 64000
+970.836480 250.00 64000
+970.964480 250.00 64000
+971.092480 250.00 64000
+971.220480 250.00 64000
+971.348480 250.00 64000
+971.476480 250.00 64000
+971.604480 250.00 64000
+971.732480 250.00 64000
+971.860480 250.00 64000
+971.988480 250.00 64000
+972.116480 250.00 64000
+972.244480 250.00 64000
+972.372480 250.00 64000
+972.500480 250.00 64000
+972.628480 250.00 64000
+972.756480 250.00 64000
+972.884480 250.00 64000
+973.012480 250.00 64000
+973.140480 250.00 64000
+973.268480 250.00 64000
+973.396480 250.00 64000
+973.524480 250.00 64000
+973.652480 250.00 64000
+973.780480 250.00 64000
+973.908480 250.00 64000
+974.036480 250.00 64000
+974.164480 250.00 64000
+974.292480 250.00 64000
+974.420480 250.00 64000
+974.548480 250.00 64000
+974.676480 250.00 64000
+974.804480 250.00 64000
+974.932480 250.00 64000
+975.060480 250.00 64000
+975.188480 250.00 64000
+975.316480 250.00 64000
+975.444480 250.00 64000
+975.572480 250.00 64000
+975.700480 250.00 64000
+975.828480 250.00 64000
+975.956480 250.00 64000
+976.084480 250.00 64000
+976.212480 250.00 64000
+976.340480 250.00 64000
+976.468480 250.00 64000
+976.596480 250.00 64000
+976.724480 250.00 64000
+976.852480 250.00 64000
+976.980480 250.00 64000
+977.108480 250.00 64000
+977.236480 250.00 64000
+977.364480 250.00 64000
+977.492480 250.00 64000
+977.620480 250.00 64000
+977.748480 250.00 64000
+977.876480 250.00 64000
+978.004480 250.00 64000
+978.132480 250.00 64000
+978.260480 250.00 64000
+978.388480 250.00 64000
+978.516480 250.00 64000
+978.644480 250.00 64000
+978.772480 250.00 64000
+978.900480 250.00 64000
+979.028480 250.00 64000
+979.156480 250.00 64000
+979.284480 250.00 64000
+979.412480 250.00 64000
+979.540480 250.00 64000
+979.668480 250.00 64000
+979.796480 250.00 64000
+979.924480 250.00 64000
+980.052480 250.00 64000
+980.180480 250.00 64000
+980.308480 250.00 64000
+980.436480 250.00 64000
+980.564480 250.00 64000
+980.692480 250.00 64000
+980.820480 250.00 64000
+980.948480 250.00 64000
+981.076480 250.00 64000
+981.204480 250.00 64000
+981.332480 250.00 64000
+981.460480 250.00 64000
+981.588480 250.00 64000
+981.716480 250.00 64000
+981.844480 250.00 64000
+981.972480 250.00 64000
+982.100480 250.00 64000
+982.228480 250.00 64000
+982.356480 250.00 64000
+982.484480 250.00 64000
+982.612480 250.00 64000
+982.740480 250.00 64000
+982.868480 250.00 64000
+982.996480 250.00 64000
+983.124480 250.00 64000
+983.252480 250.00 64000
+983.380480 250.00 64000
+983.508480 250.00 64000
+983.636480 250.00 64000
+983.764480 250.00 64000
+983.892480 250.00 64000
+984.020480 250.00 64000
+984.148480 250.00 64000
+984.276480 250.00 64000
+984.404480 250.00 64000
+984.532480 250.00 64000
+984.660480 250.00 64000
+984.788480 250.00 64000
+984.916480 250.00 64000
+985.044480 250.00 64000
+985.172480 250.00 64000
+985.300480 250.00 64000
+985.428480 250.00 64000
+985.556480 250.00 64000
+985.684480 250.00 64000
+985.812480 250.00 64000
+985.940480 250.00 64000
+986.068480 250.00 64000
+986.196480 250.00 64000
+986.324480 250.00 64000
+986.452480 250.00 64000
+986.580480 250.00 64000
+986.708480 250.00 64000
+986.836480 250.00 64000
+986.964480 250.00 64000
+987.092480 250.00 64000
+987.220480 250.00 64000
+987.348480 250.00 64000
+987.476480 250.00 64000
+987.604480 250.00 64000
+987.732480 250.00 64000
+987.860480 250.00 64000
+987.988480 250.00 64000
+988.116480 250.00 64000
+988.244480 250.00 64000
+988.372480 250.00 64000
+988.500480 250.00 64000
+988.628480 250.00 64000
+988.756480 250.00 64000
+988.884480 250.00 64000
+989.012480 250.00 64000
+989.140480 250.00 64000
+989.268480 250.00 64000
+989.396480 250.00 64000
+989.524480 250.00 64000
+989.652480 250.00 64000
+989.780480 250.00 64000
+989.908480 250.00 64000
+990.036480 250.00 64000
+990.164480 250.00 64000
+990.292480 250.00 64000
+990.420480 250.00 64000
+990.548480 250.00 64000
+990.676480 250.00 64000
+990.804480 250.00 64000
+990.932480 250.00 64000
+991.060480 250.00 64000
+991.188480 250.00 64000
+991.316480 250.00 64000
+991.444480 250.00 64000
+991.572480 250.00 64000
+991.700480 250.00 64000
+991.828480 250.00 64000
+991.956480 250.00 64000
+992.084480 250.00 64000
+992.212480 250.00 64000
+992.340480 250.00 64000
+992.468480 250.00 64000
+992.596480 250.00 64000
+992.724480 250.00 64000
+992.852480 250.00 64000
+992.980480 250.00 64000
+993.108480 250.00 64000
+993.236480 250.00 64000
+993.364480 250.00 64000
+993.492480 250.00 64000
+993.620480 250.00 64000
+993.748480 250.00 64000
+993.876480 250.00 64000
+994.004480 250.00 64000
+994.132480 250.00 64000
+994.260480 250.00 64000
+994.388480 250.00 64000
+994.516480 250.00 64000
+994.644480 250.00 64000
+994.772480 250.00 64000
+994.900480 250.00 64000
+995.028480 250.00 64000
+995.156480 250.00 64000
+995.284480 250.00 64000
+995.412480 250.00 64000
+995.540480 250.00 64000
+995.668480 250.00 64000
+995.796480 250.00 64000
+995.924480 250.00 64000
+996.052480 250.00 64000
+996.180480 250.00 64000
+996.308480 250.00 64000
+996.436480 250.00 64000
+996.564480 250.00 64000
+996.692480 250.00 64000
+996.820480 250.00 64000
+996.948480 250.00 64000
+997.076480 250.00 64000
+997.204480 250.00 64000
+997.332480 250.00 64000
+997.460480 250.00 64000
+997.588480 250.00 64000
+997.716480 250.00 64000
+997.844480 250.00 64000
+997.972480 250.00 64000
+998.100480 250.00 64000
+998.228480 250.00 64000
+998.356480 250.00 64000
+998.484480 250.00 64000
+998.612480 250.00 64000
+998.740480 250.00 64000
+998.868480 250.00 64000
+998.996480 250.00 64000
+999.124480 250.00 64000
+999.252480 250.00 64000
+999.380480 250.00 64000
+999.508480 250.00 64000
+999.636480 250.00 64000
+999.764480 250.00 64000
+999.892480 250.00 64000
+1000.020480 250.00 64000
+1000.148480 250.00 64000
+1000.276480 250.00 64000
+1000.404480 250.00 64000
+1000.532480 250.00 64000
+1000.660480 250.00 64000
+1000.788480 250.00 64000
+1000.916480 250.00 64000
+1001.044480 250.00 64000
+1001.172480 250.00 64000
+1001.300480 250.00 64000
+1001.428480 250.00 64000
+1001.556480 250.00 64000
+1001.684480 250.00 64000
+1001.812480 250.00 64000
+1001.940480 250.00 64000
+1002.068480 250.00 64000
+1002.196480 250.00 64000
+1002.324480 250.00 64000
+1002.452480 250.00 64000
+1002.580480 250.00 64000
+1002.708480 250.00 64000
+1002.836480 250.00 64000
+1002.964480 250.00 64000
+1003.092480 250.00 64000
+1003.220480 250.00 64000
+1003.348480 250.00 64000
+1003.476480 250.00 64000
+1003.604480 250.00 64000
+1003.732480 250.00 64000
+1003.860480 250.00 64000
+1003.988480 250.00 64000
+1004.116480 250.00 64000
+1004.244480 250.00 64000
+1004.372480 250.00 64000
+1004.500480 250.00 64000
+1004.628480 250.00 64000
+1004.756480 250.00 64000
+1004.884480 250.00 64000
+1005.012480 250.00 64000
+1005.140480 250.00 64000
+1005.268480 250.00 64000
+1005.396480 250.00 64000
+1005.524480 250.00 64000
+1005.652480 250.00 64000
+1005.780480 250.00 64000
+1005.908480 250.00 64000
+1006.036480 250.00 64000
+1006.164480 250.00 64000
+1006.292480 250.00 64000
+1006.420480 250.00 64000
+1006.548480 250.00 64000
+1006.676480 250.00 64000
+1006.804480 250.00 64000
+1006.932480 250.00 64000
+1007.060480 250.00 64000
+1007.188480 250.00 64000
+1007.316480 250.00 64000
+1007.444480 250.00 64000
+1007.572480 250.00 64000
+1007.700480 250.00 64000
+1007.828480 250.00 64000
+1007.956480 250.00 64000
+1008.084480 250.00 64000
+1008.212480 250.00 64000
+1008.340480 250.00 64000
+1008.468480 250.00 64000
+1008.596480 250.00 64000
+1008.724480 250.00 64000
+1008.852480 250.00 64000
+1008.980480 250.00 64000
+1009.108480 250.00 64000
+1009.236480 250.00 64000
+1009.364480 250.00 64000
+1009.492480 250.00 64000
+1009.620480 250.00 64000
+1009.748480 250.00 64000
+1009.876480 250.00 64000
+1010.004480 250.00 64000
+1010.132480 250.00 64000
+1010.260480 250.00 64000
+1010.388480 250.00 64000
+1010.516480 250.00 64000
+1010.644480 250.00 64000
+1010.772480 250.00 64000
+1010.900480 250.00 64000
+1011.028480 250.00 64000
+1011.156480 250.00 64000
+1011.284480 250.00 64000
+1011.412480 250.00 64000
+1011.540480 250.00 64000
+1011.668480 250.00 64000
+1011.796480 250.00 64000
+1011.924480 250.00 64000
+1012.052480 250.00 64000
+1012.180480 250.00 64000
+1012.308480 250.00 64000
+1012.436480 250.00 64000
+1012.564480 250.00 64000
+1012.692480 250.00 64000
+1012.820480 250.00 64000
+1012.948480 250.00 64000
+1013.076480 250.00 64000
+1013.204480 250.00 64000
+1013.332480 250.00 64000
+1013.460480 250.00 64000
+1013.588480 250.00 64000
+1013.716480 250.00 64000
+1013.844480 250.00 64000
+1013.972480 250.00 64000
+1014.100480 250.00 64000
+1014.228480 250.00 64000
+1014.356480 250.00 64000
+1014.484480 250.00 64000
+1014.612480 250.00 64000
+1014.740480 250.00 64000
+1014.868480 250.00 64000
+1014.996480 250.00 64000
+1015.124480 250.00 64000
+1015.252480 250.00 64000
+1015.380480 250.00 64000
+1015.508480 250.00 64000
+1015.636480 250.00 64000
+1015.764480 250.00 64000
+1015.892480 250.00 64000
+1016.020480 250.00 64000
+1016.148480 250.00 64000
+1016.276480 250.00 64000
+1016.404480 250.00 64000
+1016.532480 250.00 64000
+1016.660480 250.00 64000
+1016.788480 250.00 64000
+1016.916480 250.00 64000
+1017.044480 250.00 64000
+1017.172480 250.00 64000
+1017.300480 250.00 64000
+1017.428480 250.00 64000
+1017.556480 250.00 64000
+1017.684480 250.00 64000
+1017.812480 250.00 64000
+1017.940480 250.00 64000
+1018.068480 250.00 64000
+1018.196480 250.00 64000
+1018.324480 250.00 64000
+1018.452480 250.00 64000
+1018.580480 250.00 64000
+1018.708480 250.00 64000
+1018.836480 250.00 64000
+1018.964480 250.00 64000
+1019.092480 250.00 64000
+1019.220480 250.00 64000
+1019.348480 250.00 64000
+1019.476480 250.00 64000
+1019.604480 250.00 64000
+1019.732480 250.00 64000
+1019.860480 250.00 64000
+1019.988480 250.00 64000
+1020.116480 250.00 64000
+1020.244480 250.00 64000
+1020.372480 250.00 64000
+1020.500480 250.00 64000
+1020.628480 250.00 64000
+1020.756480 250.00 64000
+1020.884480 250.00 64000
+1021.012480 250.00 64000
+1021.140480 250.00 64000
+1021.268480 250.00 64000
+1021.396480 250.00 64000
+1021.524480 250.00 64000
+1021.652480 250.00 64000
+1021.780480 250.00 64000
+1021.908480 250.00 64000
+1022.036480 250.00 64000
+1022.164480 250.00 64000
+1022.292480 250.00 64000
+1022.420480 250.00 64000
+1022.548480 250.00 64000
+1022.676480 250.00 64000
+1022.804480 250.00 64000
+1022.932480 250.00 64000
+1023.060480 250.00 64000
+1023.188480 250.00 64000
+1023.316480 250.00 64000
+1023.444480 250.00 64000
+1023.572480 250.00 64000
+1023.700480 250.00 64000
+1023.828480 250.00 64000
+1023.956480 250.00 64000
+1024.084480 250.00 64000
+1024.212480 250.00 64000
+1024.340480 250.00 64000
+1024.468480 250.00 64000
+1024.596480 250.00 64000
+1024.724480 250.00 64000
+1024.852480 250.00 64000
+1024.980480 250.00 64000
+1025.108480 250.00 64000
+1025.236480 250.00 64000
+1025.364480 250.00 64000
+1025.492480 250.00 64000
+1025.620480 250.00 64000
+1025.748480 250.00 64000
+1025.876480 250.00 64000
+1026.004480 250.00 64000
+1026.132480 250.00 64000
+1026.260480 250.00 64000
+1026.388480 250.00 64000
+1026.516480 250.00 64000
+1026.644480 250.00 64000
+1026.772480 250.00 64000
+1026.900480 250.00 64000
+1027.028480 250.00 64000
+1027.156480 250.00 64000
+1027.284480 250.00 64000
+1027.412480 250.00 64000
+1027.540480 250.00 64000
+1027.668480 250.00 64000
+1027.796480 250.00 64000
+1027.924480 250.00 64000
+1028.052480 250.00 64000
+1028.180480 250.00 64000
+1028.308480 250.00 64000
+1028.436480 250.00 64000
+1028.564480 250.00 64000
+1028.692480 250.00 64000
+1028.820480 250.00 64000
+1028.948480 250.00 64000
+1029.076480 250.00 64000
+1029.204480 250.00 64000
+1029.332480 250.00 64000
+1029.460480 250.00 64000
+1029.588480 250.00 64000
+1029.716480 250.00 64000
+1029.844480 250.00 64000
+1029.972480 250.00 64000
+1030.100480 250.00 64000
+1030.228480 250.00 64000
+1030.356480 250.00 64000
+1030.484480 250.00 64000
+1030.612480 250.00 64000
+1030.740480 250.00 64000
+1030.868480 250.00 64000
+1030.996480 250.00 64000
+1031.124480 250.00 64000
+1031.252480 250.00 64000
+1031.380480 250.00 64000
+1031.508480 250.00 64000
+1031.636480 250.00 64000
+1031.764480 250.00 64000
+1031.892480 250.00 64000
+1032.020480 250.00 64000
+1032.148480 250.00 64000
+1032.276480 250.00 64000
+1032.404480 250.00 64000
+1032.532480 250.00 64000
+1032.660480 250.00 64000
+1032.788480 250.00 64000
+1032.916480 250.00 64000
+1033.044480 250.00 64000
+1033.172480 250.00 64000
+1033.300480 250.00 64000
+1033.428480 250.00 64000
+1033.556480 250.00 64000
+1033.684480 250.00 64000
+1033.812480 250.00 64000
+1033.940480 250.00 64000
+1034.068480 250.00 64000
+1034.196480 250.00 64000
+1034.324480 250.00 64000
+1034.452480 250.00 64000
+1034.580480 250.00 64000
+1034.708480 250.00 64000
+1034.836480 250.00 64000
+1034.964480 250.00 64000
+1035.092480 250.00 64000
+1035.220480 250.00 64000
+1035.348480 250.00 64000
+1035.476480 250.00 64000
+1035.604480 250.00 64000
+1035.732480 250.00 64000
+1035.860480 250.00 64000
+1035.988480 250.00 64000
+1036.116480 250.00 64000
+1036.244480 250.00 64000
+1036.372480 250.00 64000
+1036.500480 250.00 64000
+1036.628480 250.00 64000
+1036.756480 250.00 64000
+1036.884480 250.00 64000
+1037.012480 250.00 64000
+1037.140480 250.00 64000
+1037.268480 250.00 64000
+1037.396480 250.00 64000
+1037.524480 250.00 64000
+1037.652480 250.00 64000
+1037.780480 250.00 64000
+1037.908480 250.00 64000
+1038.036480 250.00 64000
+1038.164480 250.00 64000
+1038.292480 250.00 64000
+1038.420480 250.00 64000
+1038.548480 250.00 64000
+1038.676480 250.00 64000
+1038.804480 250.00 64000
+1038.932480 250.00 64000
+1039.060480 250.00 64000
+1039.188480 250.00 64000
+1039.316480 250.00 64000
+1039.444480 250.00 64000
+1039.572480 250.00 64000
+1039.700480 250.00 64000
+1039.828480 250.00 64000
+1039.956480 250.00 64000
+1040.084480 250.00 64000
+1040.212480 250.00 64000
+1040.340480 250.00 64000
+1040.468480 250.00 64000
+1040.596480 250.00 64000
+1040.724480 250.00 64000
+1040.852480 250.00 64000
+1040.980480 250.00 64000
+1041.108480 250.00 64000
+1041.236480 250.00 64000
+1041.364480 250.00 64000
+1041.492480 250.00 64000
+1041.620480 250.00 64000
+1041.748480 250.00 64000
+1041.876480 250.00 64000
+1042.004480 250.00 64000
+1042.132480 250.00 64000
+1042.260480 250.00 64000
+1042.388480 250.00 64000
+1042.516480 250.00 64000
+1042.644480 250.00 64000
+1042.772480 250.00 64000
+1042.900480 250.00 64000
+1043.028480 250.00 64000
+1043.156480 250.00 64000
+1043.284480 250.00 64000
+1043.412480 250.00 64000
+1043.540480 250.00 64000
+1043.668480 250.00 64000
+1043.796480 250.00 64000
+1043.924480 250.00 64000
+1044.052480 250.00 64000
+1044.180480 250.00 64000
+1044.308480 250.00 64000
+1044.436480 250.00 64000
+1044.564480 250.00 64000
+1044.692480 250.00 64000
+1044.820480 250.00 64000
+1044.948480 250.00 64000
+1045.076480 250.00 64000
+1045.204480 250.00 64000
+1045.332480 250.00 64000
+1045.460480 250.00 64000
+1045.588480 250.00 64000
+1045.716480 250.00 64000
+1045.844480 250.00 64000
+1045.972480 250.00 64000
+1046.100480 250.00 64000
+1046.228480 250.00 64000
+1046.356480 250.00 64000
+1046.484480 250.00 64000
+1046.612480 250.00 64000
+1046.740480 250.00 64000
+1046.868480 250.00 64000
+1046.996480 250.00 64000
+1047.124480 250.00 64000
+1047.252480 250.00 64000
+1047.380480 250.00 64000
+1047.508480 250.00 64000
+1047.636480 250.00 64000
+1047.764480 250.00 64000
+1047.892480 250.00 64000
+1048.020480 250.00 64000
+1048.148480 250.00 64000
+1048.276480 250.00 64000
+1048.404480 250.00 64000
+1048.532480 250.00 64000
+1048.660480 250.00 64000
+1048.788480 250.00 64000
+1048.916480 250.00 64000
+1049.044480 250.00 64000
+1049.172480 250.00 64000
+1049.300480 250.00 64000
+1049.428480 250.00 64000
+1049.492736 249.00 64256
+1049.556992 249.00 64256
+1049.621248 249.00 64256
+1049.685504 249.00 64256
+1049.749760 249.00 64256
+1049.814016 249.00 64256
+1049.878272 249.00 64256
+1049.942528 249.00 64256
+1050.006784 249.00 64256
+1050.071040 249.00 64256
+1050.135296 249.00 64256
+1050.199552 249.00 64256
+1050.263808 249.00 64256
+1050.328064 249.00 64256
+1050.392320 249.00 64256
+1050.456576 249.00 64256
+1050.520832 249.00 64256
+1050.585088 249.00 64256
+1050.649344 249.00 64256
+1050.713600 249.00 64256
+1050.777856 249.00 64256
+1050.842112 249.00 64256
+1050.906368 249.00 64256
+1050.970624 249.00 64256
+1051.034880 249.00 64256
+1051.099136 249.00 64256
+1051.163392 249.00 64256
+1051.227648 249.00 64256
+1051.291904 249.00 64256
+1051.356160 249.00 64256
+1051.420416 249.00 64256
+1051.484672 249.00 64256
+1051.548928 249.00 64256
+1051.613184 249.00 64256
+1051.677440 249.00 64256
+1051.741696 249.00 64256
+1051.805952 249.00 64256
+1051.870208 249.00 64256
+1051.934464 249.00 64256
+1051.998720 249.00 64256
+1052.062976 249.00 64256
+1052.127232 249.00 64256
+1052.191488 249.00 64256
+1052.255744 249.00 64256
+1052.320000 249.00 64256
+1052.384256 249.00 64256
+1052.448512 249.00 64256
+1052.512768 249.00 64256
+1052.577024 249.00 64256
+1052.641280 249.00 64256
+1052.705536 249.00 64256
+1052.769792 249.00 64256
+1052.834048 249.00 64256
+1052.898304 249.00 64256
+1052.962560 249.00 64256
+1053.026816 249.00 64256
+1053.091072 249.00 64256
+1053.155328 249.00 64256
+1053.219584 249.00 64256
+1053.283840 249.00 64256
+1053.348096 249.00 64256
+1053.412352 249.00 64256
+1053.476608 249.00 64256
+1053.540864 249.00 64256
+1053.605376 248.02 64512
+1053.669888 248.02 64512
+1053.734400 248.02 64512
+1053.798912 248.02 64512
+1053.863424 248.02 64512
+1053.927936 248.02 64512
+1053.992448 248.02 64512
+1054.056960 248.02 64512
+1054.121472 248.02 64512
+1054.185984 248.02 64512
+1054.250496 248.02 64512
+1054.315008 248.02 64512
+1054.379520 248.02 64512
+1054.444032 248.02 64512
+1054.508544 248.02 64512
+1054.573056 248.02 64512
+1054.637568 248.02 64512
+1054.702080 248.02 64512
+1054.766592 248.02 64512
+1054.831104 248.02 64512
+1054.895616 248.02 64512
+1054.960128 248.02 64512
+1055.024640 248.02 64512
+1055.089152 248.02 64512
+1055.153664 248.02 64512
+1055.218176 248.02 64512
+1055.282688 248.02 64512
+1055.347200 248.02 64512
+1055.411712 248.02 64512
+1055.476224 248.02 64512
+1055.540736 248.02 64512
+1055.605248 248.02 64512
+1055.669760 248.02 64512
+1055.734272 248.02 64512
+1055.798784 248.02 64512
+1055.863296 248.02 64512
+1055.927808 248.02 64512
+1055.992320 248.02 64512
+1056.056832 248.02 64512
+1056.121344 248.02 64512
+1056.185856 248.02 64512
+1056.250368 248.02 64512
+1056.314880 248.02 64512
+1056.379392 248.02 64512
+1056.443904 248.02 64512
+1056.508416 248.02 64512
+1056.572928 248.02 64512
+1056.637440 248.02 64512
+1056.701952 248.02 64512
+1056.766464 248.02 64512
+1056.830976 248.02 64512
+1056.895488 248.02 64512
+1056.960000 248.02 64512
+1057.024512 248.02 64512
+1057.089024 248.02 64512
+1057.153536 248.02 64512
+1057.218048 248.02 64512
+1057.282560 248.02 64512
+1057.347072 248.02 64512
+1057.411584 248.02 64512
+1057.476096 248.02 64512
+1057.540608 248.02 64512
+1057.605120 248.02 64512
+1057.669632 248.02 64512
+1057.734656 246.06 65024
+1057.799680 246.06 65024
+1057.864704 246.06 65024
+1057.929728 246.06 65024
+1057.994752 246.06 65024
+1058.059776 246.06 65024
+1058.124800 246.06 65024
+1058.189824 246.06 65024
+1058.254848 246.06 65024
+1058.319872 246.06 65024
+1058.384896 246.06 65024
+1058.449920 246.06 65024
+1058.514944 246.06 65024
+1058.579968 246.06 65024
+1058.644992 246.06 65024
+1058.710016 246.06 65024
+1058.775040 246.06 65024
+1058.840064 246.06 65024
+1058.905088 246.06 65024
+1058.970112 246.06 65024
+1059.035136 246.06 65024
+1059.100160 246.06 65024
+1059.165184 246.06 65024
+1059.230208 246.06 65024
+1059.295232 246.06 65024
+1059.360256 246.06 65024
+1059.425280 246.06 65024
+1059.490304 246.06 65024
+1059.555328 246.06 65024
+1059.620352 246.06 65024
+1059.685376 246.06 65024
+1059.750400 246.06 65024
+1059.815424 246.06 65024
+1059.880448 246.06 65024
+1059.945472 246.06 65024
+1060.010496 246.06 65024
+1060.075520 246.06 65024
+1060.140544 246.06 65024
+1060.205568 246.06 65024
+1060.270592 246.06 65024
+1060.335616 246.06 65024
+1060.400640 246.06 65024
+1060.465664 246.06 65024
+1060.530688 246.06 65024
+1060.595712 246.06 65024
+1060.660736 246.06 65024
+1060.725760 246.06 65024
+1060.790784 246.06 65024
+1060.855808 246.06 65024
+1060.920832 246.06 65024
+1060.985856 246.06 65024
+1061.050880 246.06 65024
+1061.115904 246.06 65024
+1061.180928 246.06 65024
+1061.245952 246.06 65024
+1061.310976 246.06 65024
+1061.376000 246.06 65024
+1061.441024 246.06 65024
+1061.506048 246.06 65024
+1061.571072 246.06 65024
+1061.636096 246.06 65024
+1061.701120 246.06 65024
+1061.766144 246.06 65024
+1061.831168 246.06 65024
+1061.896448 245.10 65280
+1061.961728 245.10 65280
+1062.027008 245.10 65280
+1062.092288 245.10 65280
+1062.157568 245.10 65280
+1062.222848 245.10 65280
+1062.288128 245.10 65280
+1062.353408 245.10 65280
+1062.418688 245.10 65280
+1062.483968 245.10 65280
+1062.549248 245.10 65280
+1062.614528 245.10 65280
+1062.679808 245.10 65280
+1062.745088 245.10 65280
+1062.810368 245.10 65280
+1062.875648 245.10 65280
+1062.940928 245.10 65280
+1063.006208 245.10 65280
+1063.071488 245.10 65280
+1063.136768 245.10 65280
+1063.202048 245.10 65280
+1063.267328 245.10 65280
+1063.332608 245.10 65280
+1063.397888 245.10 65280
+1063.463168 245.10 65280
+1063.528448 245.10 65280
+1063.593728 245.10 65280
+1063.659008 245.10 65280
+1063.724288 245.10 65280
+1063.789568 245.10 65280
+1063.854848 245.10 65280
+1063.920128 245.10 65280
+1063.985408 245.10 65280
+1064.050688 245.10 65280
+1064.115968 245.10 65280
+1064.181248 245.10 65280
+1064.246528 245.10 65280
+1064.311808 245.10 65280
+1064.377088 245.10 65280
+1064.442368 245.10 65280
+1064.507648 245.10 65280
+1064.572928 245.10 65280
+1064.638208 245.10 65280
+1064.703488 245.10 65280
+1064.768768 245.10 65280
+1064.834048 245.10 65280
+1064.899328 245.10 65280
+1064.964608 245.10 65280
+1065.029888 245.10 65280
+1065.095168 245.10 65280
+1065.160448 245.10 65280
+1065.225728 245.10 65280
+1065.291008 245.10 65280
+1065.356288 245.10 65280
+1065.421568 245.10 65280
+1065.486848 245.10 65280
+1065.552128 245.10 65280
+1065.617408 245.10 65280
+1065.682688 245.10 65280
+1065.747968 245.10 65280
+1065.813248 245.10 65280
+1065.878528 245.10 65280
+1065.943808 245.10 65280
+1066.009088 245.10 65280
+1066.074624 244.14 65536
+1066.140160 244.14 65536
+1066.205696 244.14 65536
+1066.271232 244.14 65536
+1066.336768 244.14 65536
+1066.402304 244.14 65536
+1066.467840 244.14 65536
+1066.533376 244.14 65536
+1066.598912 244.14 65536
+1066.664448 244.14 65536
+1066.729984 244.14 65536
+1066.795520 244.14 65536
+1066.861056 244.14 65536
+1066.926592 244.14 65536
+1066.992128 244.14 65536
+1067.057664 244.14 65536
+1067.123200 244.14 65536
+1067.188736 244.14 65536
+1067.254272 244.14 65536
+1067.319808 244.14 65536
+1067.385344 244.14 65536
+1067.450880 244.14 65536
+1067.516416 244.14 65536
+1067.581952 244.14 65536
+1067.647488 244.14 65536
+1067.713024 244.14 65536
+1067.778560 244.14 65536
+1067.844096 244.14 65536
+1067.909632 244.14 65536
+1067.975168 244.14 65536
+1068.040704 244.14 65536
+1068.106240 244.14 65536
+1068.171776 244.14 65536
+1068.237312 244.14 65536
+1068.302848 244.14 65536
+1068.368384 244.14 65536
+1068.433920 244.14 65536
+1068.499456 244.14 65536
+1068.564992 244.14 65536
+1068.630528 244.14 65536
+1068.696064 244.14 65536
+1068.761600 244.14 65536
+1068.827136 244.14 65536
+1068.892672 244.14 65536
+1068.958208 244.14 65536
+1069.023744 244.14 65536
+1069.089280 244.14 65536
+1069.154816 244.14 65536
+1069.220352 244.14 65536
+1069.285888 244.14 65536
+1069.351424 244.14 65536
+1069.416960 244.14 65536
+1069.482496 244.14 65536
+1069.548032 244.14 65536
+1069.613568 244.14 65536
+1069.679104 244.14 65536
+1069.744640 244.14 65536
+1069.810176 244.14 65536
+1069.875712 244.14 65536
+1069.941248 244.14 65536
+1070.006784 244.14 65536
+1070.072320 244.14 65536
+1070.137856 244.14 65536
+1070.203392 244.14 65536
+1070.269440 242.25 66048
+1070.335488 242.25 66048
+1070.401536 242.25 66048
+1070.467584 242.25 66048
+1070.533632 242.25 66048
+1070.599680 242.25 66048
+1070.665728 242.25 66048
+1070.731776 242.25 66048
+1070.797824 242.25 66048
+1070.863872 242.25 66048
+1070.929920 242.25 66048
+1070.995968 242.25 66048
+1071.062016 242.25 66048
+1071.128064 242.25 66048
+1071.194112 242.25 66048
+1071.260160 242.25 66048
+1071.326208 242.25 66048
+1071.392256 242.25 66048
+1071.458304 242.25 66048
+1071.524352 242.25 66048
+1071.590400 242.25 66048
+1071.656448 242.25 66048
+1071.722496 242.25 66048
+1071.788544 242.25 66048
+1071.854592 242.25 66048
+1071.920640 242.25 66048
+1071.986688 242.25 66048
+1072.052736 242.25 66048
+1072.118784 242.25 66048
+1072.184832 242.25 66048
+1072.250880 242.25 66048
+1072.316928 242.25 66048
+1072.382976 242.25 66048
+1072.449024 242.25 66048
+1072.515072 242.25 66048
+1072.581120 242.25 66048
+1072.647168 242.25 66048
+1072.713216 242.25 66048
+1072.779264 242.25 66048
+1072.845312 242.25 66048
+1072.911360 242.25 66048
+1072.977408 242.25 66048
+1073.043456 242.25 66048
+1073.109504 242.25 66048
+1073.175552 242.25 66048
+1073.241600 242.25 66048
+1073.307648 242.25 66048
+1073.373696 242.25 66048
+1073.439744 242.25 66048
+1073.505792 242.25 66048
+1073.571840 242.25 66048
+1073.637888 242.25 66048
+1073.703936 242.25 66048
+1073.769984 242.25 66048
+1073.836032 242.25 66048
+1073.902080 242.25 66048
+1073.968128 242.25 66048
+1074.034176 242.25 66048
+1074.100224 242.25 66048
+1074.166272 242.25 66048
+1074.232320 242.25 66048
+1074.298368 242.25 66048
+1074.364416 242.25 66048
+1074.430464 242.25 66048
+1074.496512 242.25 66048
+1074.562560 242.25 66048
+1074.628608 242.25 66048
+1074.694656 242.25 66048
+1074.760704 242.25 66048
+1074.826752 242.25 66048
+1074.892800 242.25 66048
+1074.958848 242.25 66048
+1075.024896 242.25 66048
+1075.090944 242.25 66048
+1075.156992 242.25 66048
+1075.223040 242.25 66048
+1075.289088 242.25 66048
+1075.355136 242.25 66048
+1075.421184 242.25 66048
+1075.487232 242.25 66048
+1075.553280 242.25 66048
+1075.619328 242.25 66048
+1075.685376 242.25 66048
+1075.751424 242.25 66048
+1075.817472 242.25 66048
+1075.883520 242.25 66048
+1075.949568 242.25 66048
+1076.015616 242.25 66048
+1076.081664 242.25 66048
+1076.147712 242.25 66048
+1076.213760 242.25 66048
+1076.279808 242.25 66048
+1076.345856 242.25 66048
+1076.411904 242.25 66048
+1076.477952 242.25 66048
+1076.544000 242.25 66048
+1076.610048 242.25 66048
+1076.676096 242.25 66048
+1076.742144 242.25 66048
+1076.808192 242.25 66048
+1076.874240 242.25 66048
+1076.940288 242.25 66048
+1077.006336 242.25 66048
+1077.072384 242.25 66048
+1077.138432 242.25 66048
+1077.204480 242.25 66048
+1077.270528 242.25 66048
+1077.336576 242.25 66048
+1077.402624 242.25 66048
+1077.468672 242.25 66048
+1077.534720 242.25 66048
+1077.600768 242.25 66048
+1077.666816 242.25 66048
+1077.732864 242.25 66048
+1077.798912 242.25 66048
+1077.864960 242.25 66048
+1077.931008 242.25 66048
+1077.997056 242.25 66048
+1078.063104 242.25 66048
+1078.129152 242.25 66048
+1078.195200 242.25 66048
+1078.261248 242.25 66048
+1078.327296 242.25 66048
+1078.393344 242.25 66048
+1078.459392 242.25 66048
+1078.525440 242.25 66048
+1078.591488 242.25 66048
+1078.657536 242.25 66048
+1078.724096 240.38 66560
+1078.790656 240.38 66560
+1078.857216 240.38 66560
+1078.923776 240.38 66560
+1078.990336 240.38 66560
+1079.056896 240.38 66560
+1079.123456 240.38 66560
+1079.190016 240.38 66560
+1079.256576 240.38 66560
+1079.323136 240.38 66560
+1079.389696 240.38 66560
+1079.456256 240.38 66560
+1079.522816 240.38 66560
+1079.589376 240.38 66560
+1079.655936 240.38 66560
+1079.722496 240.38 66560
+1079.789056 240.38 66560
+1079.855616 240.38 66560
+1079.922176 240.38 66560
+1079.988736 240.38 66560
+1080.055296 240.38 66560
+1080.121856 240.38 66560
+1080.188416 240.38 66560
+1080.254976 240.38 66560
+1080.321536 240.38 66560
+1080.388096 240.38 66560
+1080.454656 240.38 66560
+1080.521216 240.38 66560
+1080.587776 240.38 66560
+1080.654336 240.38 66560
+1080.720896 240.38 66560
+1080.787456 240.38 66560
+1080.854016 240.38 66560
+1080.920576 240.38 66560
+1080.987136 240.38 66560
+1081.053696 240.38 66560
+1081.120256 240.38 66560
+1081.186816 240.38 66560
+1081.253376 240.38 66560
+1081.319936 240.38 66560
+1081.386496 240.38 66560
+1081.453056 240.38 66560
+1081.519616 240.38 66560
+1081.586176 240.38 66560
+1081.652736 240.38 66560
+1081.719296 240.38 66560
+1081.785856 240.38 66560
+1081.852416 240.38 66560
+1081.918976 240.38 66560
+1081.985536 240.38 66560
+1082.052096 240.38 66560
+1082.118656 240.38 66560
+1082.185216 240.38 66560
+1082.251776 240.38 66560
+1082.318336 240.38 66560
+1082.384896 240.38 66560
+1082.451456 240.38 66560
+1082.518016 240.38 66560
+1082.584576 240.38 66560
+1082.651136 240.38 66560
+1082.717696 240.38 66560
+1082.784256 240.38 66560
+1082.850816 240.38 66560
+1082.917376 240.38 66560
+1082.984448 238.55 67072
+1083.051520 238.55 67072
+1083.118592 238.55 67072
+1083.185664 238.55 67072
+1083.252736 238.55 67072
+1083.319808 238.55 67072
+1083.386880 238.55 67072
+1083.453952 238.55 67072
+1083.521024 238.55 67072
+1083.588096 238.55 67072
+1083.655168 238.55 67072
+1083.722240 238.55 67072
+1083.789312 238.55 67072
+1083.856384 238.55 67072
+1083.923456 238.55 67072
+1083.990528 238.55 67072
+1084.057600 238.55 67072
+1084.124672 238.55 67072
+1084.191744 238.55 67072
+1084.258816 238.55 67072
+1084.325888 238.55 67072
+1084.392960 238.55 67072
+1084.460032 238.55 67072
+1084.527104 238.55 67072
+1084.594176 238.55 67072
+1084.661248 238.55 67072
+1084.728320 238.55 67072
+1084.795392 238.55 67072
+1084.862464 238.55 67072
+1084.929536 238.55 67072
+1084.996608 238.55 67072
+1085.063680 238.55 67072
+1085.130752 238.55 67072
+1085.197824 238.55 67072
+1085.264896 238.55 67072
+1085.331968 238.55 67072
+1085.399040 238.55 67072
+1085.466112 238.55 67072
+1085.533184 238.55 67072
+1085.600256 238.55 67072
+1085.667328 238.55 67072
+1085.734400 238.55 67072
+1085.801472 238.55 67072
+1085.868544 238.55 67072
+1085.935616 238.55 67072
+1086.002688 238.55 67072
+1086.069760 238.55 67072
+1086.136832 238.55 67072
+1086.203904 238.55 67072
+1086.270976 238.55 67072
+1086.338048 238.55 67072
+1086.405120 238.55 67072
+1086.472192 238.55 67072
+1086.539264 238.55 67072
+1086.606336 238.55 67072
+1086.673408 238.55 67072
+1086.740480 238.55 67072
+1086.807552 238.55 67072
+1086.874624 238.55 67072
+1086.941696 238.55 67072
+1087.008768 238.55 67072
+1087.075840 238.55 67072
+1087.142912 238.55 67072
+1087.209984 238.55 67072
+1087.277568 236.74 67584
+1087.345152 236.74 67584
+1087.412736 236.74 67584
+1087.480320 236.74 67584
+1087.547904 236.74 67584
+1087.615488 236.74 67584
+1087.683072 236.74 67584
+1087.750656 236.74 67584
+1087.818240 236.74 67584
+1087.885824 236.74 67584
+1087.953408 236.74 67584
+1088.020992 236.74 67584
+1088.088576 236.74 67584
+1088.156160 236.74 67584
+1088.223744 236.74 67584
+1088.291328 236.74 67584
+1088.358912 236.74 67584
+1088.426496 236.74 67584
+1088.494080 236.74 67584
+1088.561664 236.74 67584
+1088.629248 236.74 67584
+1088.696832 236.74 67584
+1088.764416 236.74 67584
+1088.832000 236.74 67584
+1088.899584 236.74 67584
+1088.967168 236.74 67584
+1089.034752 236.74 67584
+1089.102336 236.74 67584
+1089.169920 236.74 67584
+1089.237504 236.74 67584
+1089.305088 236.74 67584
+1089.372672 236.74 67584
+1089.440256 236.74 67584
+1089.507840 236.74 67584
+1089.575424 236.74 67584
+1089.643008 236.74 67584
+1089.710592 236.74 67584
+1089.778176 236.74 67584
+1089.845760 236.74 67584
+1089.913344 236.74 67584
+1089.980928 236.74 67584
+1090.048512 236.74 67584
+1090.116096 236.74 67584
+1090.183680 236.74 67584
+1090.251264 236.74 67584
+1090.318848 236.74 67584
+1090.386432 236.74 67584
+1090.454016 236.74 67584
+1090.521600 236.74 67584
+1090.589184 236.74 67584
+1090.656768 236.74 67584
+1090.724352 236.74 67584
+1090.791936 236.74 67584
+1090.859520 236.74 67584
+1090.927104 236.74 67584
+1090.994688 236.74 67584
+1091.062272 236.74 67584
+1091.129856 236.74 67584
+1091.197440 236.74 67584
+1091.265024 236.74 67584
+1091.332608 236.74 67584
+1091.400192 236.74 67584
+1091.467776 236.74 67584
+1091.535360 236.74 67584
+1091.602944 236.74 67584
+1091.670528 236.74 67584
+1091.738112 236.74 67584
+1091.805696 236.74 67584
+1091.873280 236.74 67584
+1091.940864 236.74 67584
+1092.008448 236.74 67584
+1092.076032 236.74 67584
+1092.143616 236.74 67584
+1092.211200 236.74 67584
+1092.278784 236.74 67584
+1092.346368 236.74 67584
+1092.413952 236.74 67584
+1092.481536 236.74 67584
+1092.549120 236.74 67584
+1092.616704 236.74 67584
+1092.684288 236.74 67584
+1092.751872 236.74 67584
+1092.819456 236.74 67584
+1092.887040 236.74 67584
+1092.954624 236.74 67584
+1093.022208 236.74 67584
+1093.089792 236.74 67584
+1093.157376 236.74 67584
+1093.224960 236.74 67584
+1093.292544 236.74 67584
+1093.360128 236.74 67584
+1093.427712 236.74 67584
+1093.495296 236.74 67584
+1093.562880 236.74 67584
+1093.630464 236.74 67584
+1093.698048 236.74 67584
+1093.766144 234.96 68096
+1093.834240 234.96 68096
+1093.902336 234.96 68096
+1093.970432 234.96 68096
+1094.038528 234.96 68096
+1094.106624 234.96 68096
+1094.174720 234.96 68096
+1094.242816 234.96 68096
+1094.310912 234.96 68096
+1094.379008 234.96 68096
+1094.447104 234.96 68096
+1094.515200 234.96 68096
+1094.583296 234.96 68096
+1094.651392 234.96 68096
+1094.719488 234.96 68096
+1094.787584 234.96 68096
+1094.855680 234.96 68096
+1094.923776 234.96 68096
+1094.991872 234.96 68096
+1095.059968 234.96 68096
+1095.128064 234.96 68096
+1095.196160 234.96 68096
+1095.264256 234.96 68096
+1095.332352 234.96 68096
+1095.400448 234.96 68096
+1095.468544 234.96 68096
+1095.536640 234.96 68096
+1095.604736 234.96 68096
+1095.672832 234.96 68096
+1095.740928 234.96 68096
+1095.809024 234.96 68096
+1095.877120 234.96 68096
+1095.945216 234.96 68096
+1096.013312 234.96 68096
+1096.081408 234.96 68096
+1096.149504 234.96 68096
+1096.217600 234.96 68096
+1096.285696 234.96 68096
+1096.353792 234.96 68096
+1096.421888 234.96 68096
+1096.489984 234.96 68096
+1096.558080 234.96 68096
+1096.626176 234.96 68096
+1096.694272 234.96 68096
+1096.762368 234.96 68096
+1096.830464 234.96 68096
+1096.898560 234.96 68096
+1096.966656 234.96 68096
+1097.034752 234.96 68096
+1097.102848 234.96 68096
+1097.170944 234.96 68096
+1097.239040 234.96 68096
+1097.307136 234.96 68096
+1097.375232 234.96 68096
+1097.443328 234.96 68096
+1097.511424 234.96 68096
+1097.579520 234.96 68096
+1097.647616 234.96 68096
+1097.715712 234.96 68096
+1097.783808 234.96 68096
+1097.851904 234.96 68096
+1097.920000 234.96 68096
+1097.988096 234.96 68096
+1098.056192 234.96 68096
+1098.124800 233.21 68608
+1098.193408 233.21 68608
+1098.262016 233.21 68608
+1098.330624 233.21 68608
+1098.399232 233.21 68608
+1098.467840 233.21 68608
+1098.536448 233.21 68608
+1098.605056 233.21 68608
+1098.673664 233.21 68608
+1098.742272 233.21 68608
+1098.810880 233.21 68608
+1098.879488 233.21 68608
+1098.948096 233.21 68608
+1099.016704 233.21 68608
+1099.085312 233.21 68608
+1099.153920 233.21 68608
+1099.222528 233.21 68608
+1099.291136 233.21 68608
+1099.359744 233.21 68608
+1099.428352 233.21 68608
+1099.496960 233.21 68608
+1099.565568 233.21 68608
+1099.634176 233.21 68608
+1099.702784 233.21 68608
+1099.771392 233.21 68608
+1099.840000 233.21 68608
+1099.908608 233.21 68608
+1099.977216 233.21 68608
+1100.045824 233.21 68608
+1100.114432 233.21 68608
+1100.183040 233.21 68608
+1100.251648 233.21 68608
+1100.320256 233.21 68608
+1100.388864 233.21 68608
+1100.457472 233.21 68608
+1100.526080 233.21 68608
+1100.594688 233.21 68608
+1100.663296 233.21 68608
+1100.731904 233.21 68608
+1100.800512 233.21 68608
+1100.869120 233.21 68608
+1100.937728 233.21 68608
+1101.006336 233.21 68608
+1101.074944 233.21 68608
+1101.143552 233.21 68608
+1101.212160 233.21 68608
+1101.280768 233.21 68608
+1101.349376 233.21 68608
+1101.417984 233.21 68608
+1101.486592 233.21 68608
+1101.555200 233.21 68608
+1101.623808 233.21 68608
+1101.692416 233.21 68608
+1101.761024 233.21 68608
+1101.829632 233.21 68608
+1101.898240 233.21 68608
+1101.966848 233.21 68608
+1102.035456 233.21 68608
+1102.104064 233.21 68608
+1102.172672 233.21 68608
+1102.241280 233.21 68608
+1102.309888 233.21 68608
+1102.378496 233.21 68608
+1102.447104 233.21 68608
+1102.516224 231.48 69120
+1102.585344 231.48 69120
+1102.654464 231.48 69120
+1102.723584 231.48 69120
+1102.792704 231.48 69120
+1102.861824 231.48 69120
+1102.930944 231.48 69120
+1103.000064 231.48 69120
+1103.069184 231.48 69120
+1103.138304 231.48 69120
+1103.207424 231.48 69120
+1103.276544 231.48 69120
+1103.345664 231.48 69120
+1103.414784 231.48 69120
+1103.483904 231.48 69120
+1103.553024 231.48 69120
+1103.622144 231.48 69120
+1103.691264 231.48 69120
+1103.760384 231.48 69120
+1103.829504 231.48 69120
+1103.898624 231.48 69120
+1103.967744 231.48 69120
+1104.036864 231.48 69120
+1104.105984 231.48 69120
+1104.175104 231.48 69120
+1104.244224 231.48 69120
+1104.313344 231.48 69120
+1104.382464 231.48 69120
+1104.451584 231.48 69120
+1104.520704 231.48 69120
+1104.589824 231.48 69120
+1104.658944 231.48 69120
+1104.728064 231.48 69120
+1104.797184 231.48 69120
+1104.866304 231.48 69120
+1104.935424 231.48 69120
+1105.004544 231.48 69120
+1105.073664 231.48 69120
+1105.142784 231.48 69120
+1105.211904 231.48 69120
+1105.281024 231.48 69120
+1105.350144 231.48 69120
+1105.419264 231.48 69120
+1105.488384 231.48 69120
+1105.557504 231.48 69120
+1105.626624 231.48 69120
+1105.695744 231.48 69120
+1105.764864 231.48 69120
+1105.833984 231.48 69120
+1105.903104 231.48 69120
+1105.972224 231.48 69120
+1106.041344 231.48 69120
+1106.110464 231.48 69120
+1106.179584 231.48 69120
+1106.248704 231.48 69120
+1106.317824 231.48 69120
+1106.386944 231.48 69120
+1106.456064 231.48 69120
+1106.525184 231.48 69120
+1106.594304 231.48 69120
+1106.663424 231.48 69120
+1106.732544 231.48 69120
+1106.801664 231.48 69120
+1106.870784 231.48 69120
+1106.939904 231.48 69120
+1107.009024 231.48 69120
+1107.078144 231.48 69120
+1107.147264 231.48 69120
+1107.216384 231.48 69120
+1107.285504 231.48 69120
+1107.354624 231.48 69120
+1107.423744 231.48 69120
+1107.492864 231.48 69120
+1107.561984 231.48 69120
+1107.631104 231.48 69120
+1107.700224 231.48 69120
+1107.769344 231.48 69120
+1107.838464 231.48 69120
+1107.907584 231.48 69120
+1107.976704 231.48 69120
+1108.045824 231.48 69120
+1108.114944 231.48 69120
+1108.184064 231.48 69120
+1108.253184 231.48 69120
+1108.322304 231.48 69120
+1108.391424 231.48 69120
+1108.460544 231.48 69120
+1108.529664 231.48 69120
+1108.598784 231.48 69120
+1108.667904 231.48 69120
+1108.737024 231.48 69120
+1108.806144 231.48 69120
+1108.875264 231.48 69120
+1108.944384 231.48 69120
+1109.013504 231.48 69120
+1109.082624 231.48 69120
+1109.151744 231.48 69120
+1109.220864 231.48 69120
+1109.289984 231.48 69120
+1109.359104 231.48 69120
+1109.428224 231.48 69120
+1109.497344 231.48 69120
+1109.566464 231.48 69120
+1109.635584 231.48 69120
+1109.704704 231.48 69120
+1109.773824 231.48 69120
+1109.842944 231.48 69120
+1109.912064 231.48 69120
+1109.981184 231.48 69120
+1110.050304 231.48 69120
+1110.119424 231.48 69120
+1110.188544 231.48 69120
+1110.257664 231.48 69120
+1110.326784 231.48 69120
+1110.395904 231.48 69120
+1110.465024 231.48 69120
+1110.534144 231.48 69120
+1110.603264 231.48 69120
+1110.672384 231.48 69120
+1110.741504 231.48 69120
+1110.810624 231.48 69120
+1110.879744 231.48 69120
+1110.948864 231.48 69120
+1111.017984 231.48 69120
+1111.087104 231.48 69120
+1111.156224 231.48 69120
+1111.225344 231.48 69120
+1111.294464 231.48 69120
+1111.364096 229.78 69632
+1111.433728 229.78 69632
+1111.503360 229.78 69632
+1111.572992 229.78 69632
+1111.642624 229.78 69632
+1111.712256 229.78 69632
+1111.781888 229.78 69632
+1111.851520 229.78 69632
+1111.921152 229.78 69632
+1111.990784 229.78 69632
+1112.060416 229.78 69632
+1112.130048 229.78 69632
+1112.199680 229.78 69632
+1112.269312 229.78 69632
+1112.338944 229.78 69632
+1112.408576 229.78 69632
+1112.478208 229.78 69632
+1112.547840 229.78 69632
+1112.617472 229.78 69632
+1112.687104 229.78 69632
+1112.756736 229.78 69632
+1112.826368 229.78 69632
+1112.896000 229.78 69632
+1112.965632 229.78 69632
+1113.035264 229.78 69632
+1113.104896 229.78 69632
+1113.174528 229.78 69632
+1113.244160 229.78 69632
+1113.313792 229.78 69632
+1113.383424 229.78 69632
+1113.453056 229.78 69632
+1113.522688 229.78 69632
+1113.592320 229.78 69632
+1113.661952 229.78 69632
+1113.731584 229.78 69632
+1113.801216 229.78 69632
+1113.870848 229.78 69632
+1113.940480 229.78 69632
+1114.010112 229.78 69632
+1114.079744 229.78 69632
+1114.149376 229.78 69632
+1114.219008 229.78 69632
+1114.288640 229.78 69632
+1114.358272 229.78 69632
+1114.427904 229.78 69632
+1114.497536 229.78 69632
+1114.567168 229.78 69632
+1114.636800 229.78 69632
+1114.706432 229.78 69632
+1114.776064 229.78 69632
+1114.845696 229.78 69632
+1114.915328 229.78 69632
+1114.984960 229.78 69632
+1115.054592 229.78 69632
+1115.124224 229.78 69632
+1115.193856 229.78 69632
+1115.263488 229.78 69632
+1115.333120 229.78 69632
+1115.402752 229.78 69632
+1115.472384 229.78 69632
+1115.542016 229.78 69632
+1115.611648 229.78 69632
+1115.681280 229.78 69632
+1115.750912 229.78 69632
+1115.821056 228.10 70144
+1115.891200 228.10 70144
+1115.961344 228.10 70144
+1116.031488 228.10 70144
+1116.101632 228.10 70144
+1116.171776 228.10 70144
+1116.241920 228.10 70144
+1116.312064 228.10 70144
+1116.382208 228.10 70144
+1116.452352 228.10 70144
+1116.522496 228.10 70144
+1116.592640 228.10 70144
+1116.662784 228.10 70144
+1116.732928 228.10 70144
+1116.803072 228.10 70144
+1116.873216 228.10 70144
+1116.943360 228.10 70144
+1117.013504 228.10 70144
+1117.083648 228.10 70144
+1117.153792 228.10 70144
+1117.223936 228.10 70144
+1117.294080 228.10 70144
+1117.364224 228.10 70144
+1117.434368 228.10 70144
+1117.504512 228.10 70144
+1117.574656 228.10 70144
+1117.644800 228.10 70144
+1117.714944 228.10 70144
+1117.785088 228.10 70144
+1117.855232 228.10 70144
+1117.925376 228.10 70144
+1117.995520 228.10 70144
+1118.065664 228.10 70144
+1118.135808 228.10 70144
+1118.205952 228.10 70144
+1118.276096 228.10 70144
+1118.346240 228.10 70144
+1118.416384 228.10 70144
+1118.486528 228.10 70144
+1118.556672 228.10 70144
+1118.626816 228.10 70144
+1118.696960 228.10 70144
+1118.767104 228.10 70144
+1118.837248 228.10 70144
+1118.907392 228.10 70144
+1118.977536 228.10 70144
+1119.047680 228.10 70144
+1119.117824 228.10 70144
+1119.187968 228.10 70144
+1119.258112 228.10 70144
+1119.328256 228.10 70144
+1119.398400 228.10 70144
+1119.468544 228.10 70144
+1119.538688 228.10 70144
+1119.608832 228.10 70144
+1119.678976 228.10 70144
+1119.749120 228.10 70144
+1119.819264 228.10 70144
+1119.889408 228.10 70144
+1119.959552 228.10 70144
+1120.029696 228.10 70144
+1120.099840 228.10 70144
+1120.169984 228.10 70144
+1120.240128 228.10 70144
+1120.310272 228.10 70144
+1120.380416 228.10 70144
+1120.450560 228.10 70144
+1120.520704 228.10 70144
+1120.590848 228.10 70144
+1120.660992 228.10 70144
+1120.731136 228.10 70144
+1120.801280 228.10 70144
+1120.871424 228.10 70144
+1120.941568 228.10 70144
+1121.011712 228.10 70144
+1121.081856 228.10 70144
+1121.152000 228.10 70144
+1121.222144 228.10 70144
+1121.292288 228.10 70144
+1121.362432 228.10 70144
+1121.432576 228.10 70144
+1121.502720 228.10 70144
+1121.572864 228.10 70144
+1121.643008 228.10 70144
+1121.713152 228.10 70144
+1121.783296 228.10 70144
+1121.853440 228.10 70144
+1121.923584 228.10 70144
+1121.993728 228.10 70144
+1122.063872 228.10 70144
+1122.134016 228.10 70144
+1122.204160 228.10 70144
+1122.274304 228.10 70144
+1122.344448 228.10 70144
+1122.414592 228.10 70144
+1122.484736 228.10 70144
+1122.555392 226.45 70656
+1122.626048 226.45 70656
+1122.696704 226.45 70656
+1122.767360 226.45 70656
+1122.838016 226.45 70656
+1122.908672 226.45 70656
+1122.979328 226.45 70656
+1123.049984 226.45 70656
+1123.120640 226.45 70656
+1123.191296 226.45 70656
+1123.261952 226.45 70656
+1123.332608 226.45 70656
+1123.403264 226.45 70656
+1123.473920 226.45 70656
+1123.544576 226.45 70656
+1123.615232 226.45 70656
+1123.685888 226.45 70656
+1123.756544 226.45 70656
+1123.827200 226.45 70656
+1123.897856 226.45 70656
+1123.968512 226.45 70656
+1124.039168 226.45 70656
+1124.109824 226.45 70656
+1124.180480 226.45 70656
+1124.251136 226.45 70656
+1124.321792 226.45 70656
+1124.392448 226.45 70656
+1124.463104 226.45 70656
+1124.533760 226.45 70656
+1124.604416 226.45 70656
+1124.675072 226.45 70656
+1124.745728 226.45 70656
+1124.816384 226.45 70656
+1124.887040 226.45 70656
+1124.957696 226.45 70656
+1125.028352 226.45 70656
+1125.099008 226.45 70656
+1125.169664 226.45 70656
+1125.240320 226.45 70656
+1125.310976 226.45 70656
+1125.381632 226.45 70656
+1125.452288 226.45 70656
+1125.522944 226.45 70656
+1125.593600 226.45 70656
+1125.664256 226.45 70656
+1125.734912 226.45 70656
+1125.805568 226.45 70656
+1125.876224 226.45 70656
+1125.946880 226.45 70656
+1126.017536 226.45 70656
+1126.088192 226.45 70656
+1126.158848 226.45 70656
+1126.229504 226.45 70656
+1126.300160 226.45 70656
+1126.370816 226.45 70656
+1126.441472 226.45 70656
+1126.512128 226.45 70656
+1126.582784 226.45 70656
+1126.653440 226.45 70656
+1126.724096 226.45 70656
+1126.794752 226.45 70656
+1126.865408 226.45 70656
+1126.936064 226.45 70656
+1127.006720 226.45 70656
+1127.077888 224.82 71168
+1127.149056 224.82 71168
+1127.220224 224.82 71168
+1127.291392 224.82 71168
+1127.362560 224.82 71168
+1127.433728 224.82 71168
+1127.504896 224.82 71168
+1127.576064 224.82 71168
+1127.647232 224.82 71168
+1127.718400 224.82 71168
+1127.789568 224.82 71168
+1127.860736 224.82 71168
+1127.931904 224.82 71168
+1128.003072 224.82 71168
+1128.074240 224.82 71168
+1128.145408 224.82 71168
+1128.216576 224.82 71168
+1128.287744 224.82 71168
+1128.358912 224.82 71168
+1128.430080 224.82 71168
+1128.501248 224.82 71168
+1128.572416 224.82 71168
+1128.643584 224.82 71168
+1128.714752 224.82 71168
+1128.785920 224.82 71168
+1128.857088 224.82 71168
+1128.928256 224.82 71168
+1128.999424 224.82 71168
+1129.070592 224.82 71168
+1129.141760 224.82 71168
+1129.212928 224.82 71168
+1129.284096 224.82 71168
+1129.355264 224.82 71168
+1129.426432 224.82 71168
+1129.497600 224.82 71168
+1129.568768 224.82 71168
+1129.639936 224.82 71168
+1129.711104 224.82 71168
+1129.782272 224.82 71168
+1129.853440 224.82 71168
+1129.924608 224.82 71168
+1129.995776 224.82 71168
+1130.066944 224.82 71168
+1130.138112 224.82 71168
+1130.209280 224.82 71168
+1130.280448 224.82 71168
+1130.351616 224.82 71168
+1130.422784 224.82 71168
+1130.493952 224.82 71168
+1130.565120 224.82 71168
+1130.636288 224.82 71168
+1130.707456 224.82 71168
+1130.778624 224.82 71168
+1130.849792 224.82 71168
+1130.920960 224.82 71168
+1130.992128 224.82 71168
+1131.063296 224.82 71168
+1131.134464 224.82 71168
+1131.205632 224.82 71168
+1131.276800 224.82 71168
+1131.347968 224.82 71168
+1131.419136 224.82 71168
+1131.490304 224.82 71168
+1131.561472 224.82 71168
+1131.633152 223.21 71680
+1131.704832 223.21 71680
+1131.776512 223.21 71680
+1131.848192 223.21 71680
+1131.919872 223.21 71680
+1131.991552 223.21 71680
+1132.063232 223.21 71680
+1132.134912 223.21 71680
+1132.206592 223.21 71680
+1132.278272 223.21 71680
+1132.349952 223.21 71680
+1132.421632 223.21 71680
+1132.493312 223.21 71680
+1132.564992 223.21 71680
+1132.636672 223.21 71680
+1132.708352 223.21 71680
+1132.780032 223.21 71680
+1132.851712 223.21 71680
+1132.923392 223.21 71680
+1132.995072 223.21 71680
+1133.066752 223.21 71680
+1133.138432 223.21 71680
+1133.210112 223.21 71680
+1133.281792 223.21 71680
+1133.353472 223.21 71680
+1133.425152 223.21 71680
+1133.496832 223.21 71680
+1133.568512 223.21 71680
+1133.640192 223.21 71680
+1133.711872 223.21 71680
+1133.783552 223.21 71680
+1133.855232 223.21 71680
+1133.926912 223.21 71680
+1133.998592 223.21 71680
+1134.070272 223.21 71680
+1134.141952 223.21 71680
+1134.213632 223.21 71680
+1134.285312 223.21 71680
+1134.356992 223.21 71680
+1134.428672 223.21 71680
+1134.500352 223.21 71680
+1134.572032 223.21 71680
+1134.643712 223.21 71680
+1134.715392 223.21 71680
+1134.787072 223.21 71680
+1134.858752 223.21 71680
+1134.930432 223.21 71680
+1135.002112 223.21 71680
+1135.073792 223.21 71680
+1135.145472 223.21 71680
+1135.217152 223.21 71680
+1135.288832 223.21 71680
+1135.360512 223.21 71680
+1135.432192 223.21 71680
+1135.503872 223.21 71680
+1135.575552 223.21 71680
+1135.647232 223.21 71680
+1135.718912 223.21 71680
+1135.790592 223.21 71680
+1135.862272 223.21 71680
+1135.933952 223.21 71680
+1136.005632 223.21 71680
+1136.077312 223.21 71680
+1136.148992 223.21 71680
+1136.220672 223.21 71680
+1136.292352 223.21 71680
+1136.364032 223.21 71680
+1136.435712 223.21 71680
+1136.507392 223.21 71680
+1136.579072 223.21 71680
+1136.650752 223.21 71680
+1136.722432 223.21 71680
+1136.794112 223.21 71680
+1136.865792 223.21 71680
+1136.937472 223.21 71680
+1137.009152 223.21 71680
+1137.080832 223.21 71680
+1137.152512 223.21 71680
+1137.224192 223.21 71680
+1137.295872 223.21 71680
+1137.367552 223.21 71680
+1137.439232 223.21 71680
+1137.510912 223.21 71680
+1137.582592 223.21 71680
+1137.654272 223.21 71680
+1137.725952 223.21 71680
+1137.797632 223.21 71680
+1137.869312 223.21 71680
+1137.940992 223.21 71680
+1138.012672 223.21 71680
+1138.084352 223.21 71680
+1138.156032 223.21 71680
+1138.227712 223.21 71680
+1138.299392 223.21 71680
+1138.371072 223.21 71680
+1138.442752 223.21 71680
+1138.514944 221.63 72192
+1138.587136 221.63 72192
+1138.659328 221.63 72192
+1138.731520 221.63 72192
+1138.803712 221.63 72192
+1138.875904 221.63 72192
+1138.948096 221.63 72192
+1139.020288 221.63 72192
+1139.092480 221.63 72192
+1139.164672 221.63 72192
+1139.236864 221.63 72192
+1139.309056 221.63 72192
+1139.381248 221.63 72192
+1139.453440 221.63 72192
+1139.525632 221.63 72192
+1139.597824 221.63 72192
+1139.670016 221.63 72192
+1139.742208 221.63 72192
+1139.814400 221.63 72192
+1139.886592 221.63 72192
+1139.958784 221.63 72192
+1140.030976 221.63 72192
+1140.103168 221.63 72192
+1140.175360 221.63 72192
+1140.247552 221.63 72192
+1140.319744 221.63 72192
+1140.391936 221.63 72192
+1140.464128 221.63 72192
+1140.536320 221.63 72192
+1140.608512 221.63 72192
+1140.680704 221.63 72192
+1140.752896 221.63 72192
+1140.825088 221.63 72192
+1140.897280 221.63 72192
+1140.969472 221.63 72192
+1141.041664 221.63 72192
+1141.113856 221.63 72192
+1141.186048 221.63 72192
+1141.258240 221.63 72192
+1141.330432 221.63 72192
+1141.402624 221.63 72192
+1141.474816 221.63 72192
+1141.547008 221.63 72192
+1141.619200 221.63 72192
+1141.691392 221.63 72192
+1141.763584 221.63 72192
+1141.835776 221.63 72192
+1141.907968 221.63 72192
+1141.980160 221.63 72192
+1142.052352 221.63 72192
+1142.124544 221.63 72192
+1142.196736 221.63 72192
+1142.268928 221.63 72192
+1142.341120 221.63 72192
+1142.413312 221.63 72192
+1142.485504 221.63 72192
+1142.557696 221.63 72192
+1142.629888 221.63 72192
+1142.702080 221.63 72192
+1142.774272 221.63 72192
+1142.846464 221.63 72192
+1142.918656 221.63 72192
+1142.990848 221.63 72192
+1143.063040 221.63 72192
+1143.135744 220.07 72704
+1143.208448 220.07 72704
+1143.281152 220.07 72704
+1143.353856 220.07 72704
+1143.426560 220.07 72704
+1143.499264 220.07 72704
+1143.571968 220.07 72704
+1143.644672 220.07 72704
+1143.717376 220.07 72704
+1143.790080 220.07 72704
+1143.862784 220.07 72704
+1143.935488 220.07 72704
+1144.008192 220.07 72704
+1144.080896 220.07 72704
+1144.153600 220.07 72704
+1144.226304 220.07 72704
+1144.299008 220.07 72704
+1144.371712 220.07 72704
+1144.444416 220.07 72704
+1144.517120 220.07 72704
+1144.589824 220.07 72704
+1144.662528 220.07 72704
+1144.735232 220.07 72704
+1144.807936 220.07 72704
+1144.880640 220.07 72704
+1144.953344 220.07 72704
+1145.026048 220.07 72704
+1145.098752 220.07 72704
+1145.171456 220.07 72704
+1145.244160 220.07 72704
+1145.316864 220.07 72704
+1145.389568 220.07 72704
+1145.462784 218.53 73216
+1145.536000 218.53 73216
+1145.609216 218.53 73216
+1145.682432 218.53 73216
+1145.755648 218.53 73216
+1145.828864 218.53 73216
+1145.902080 218.53 73216
+1145.975296 218.53 73216
+1146.048512 218.53 73216
+1146.121728 218.53 73216
+1146.194944 218.53 73216
+1146.268160 218.53 73216
+1146.341376 218.53 73216
+1146.414592 218.53 73216
+1146.487808 218.53 73216
+1146.561024 218.53 73216
+1146.634240 218.53 73216
+1146.707456 218.53 73216
+1146.780672 218.53 73216
+1146.853888 218.53 73216
+1146.927104 218.53 73216
+1147.000320 218.53 73216
+1147.073536 218.53 73216
+1147.146752 218.53 73216
+1147.219968 218.53 73216
+1147.293184 218.53 73216
+1147.366400 218.53 73216
+1147.439616 218.53 73216
+1147.512832 218.53 73216
+1147.586048 218.53 73216
+1147.659264 218.53 73216
+1147.732480 218.53 73216
+1147.805696 218.53 73216
+1147.878912 218.53 73216
+1147.952128 218.53 73216
+1148.025344 218.53 73216
+1148.098560 218.53 73216
+1148.171776 218.53 73216
+1148.244992 218.53 73216
+1148.318208 218.53 73216
+1148.391424 218.53 73216
+1148.464640 218.53 73216
+1148.537856 218.53 73216
+1148.611072 218.53 73216
+1148.684288 218.53 73216
+1148.757504 218.53 73216
+1148.830720 218.53 73216
+1148.903936 218.53 73216
+1148.977152 218.53 73216
+1149.050368 218.53 73216
+1149.123584 218.53 73216
+1149.196800 218.53 73216
+1149.270016 218.53 73216
+1149.343232 218.53 73216
+1149.416448 218.53 73216
+1149.489664 218.53 73216
+1149.562880 218.53 73216
+1149.636096 218.53 73216
+1149.709312 218.53 73216
+1149.782528 218.53 73216
+1149.855744 218.53 73216
+1149.928960 218.53 73216
+1150.002176 218.53 73216
+1150.075392 218.53 73216
+1150.149120 217.01 73728
+1150.222848 217.01 73728
+1150.296576 217.01 73728
+1150.370304 217.01 73728
+1150.444032 217.01 73728
+1150.517760 217.01 73728
+1150.591488 217.01 73728
+1150.665216 217.01 73728
+1150.738944 217.01 73728
+1150.812672 217.01 73728
+1150.886400 217.01 73728
+1150.960128 217.01 73728
+1151.033856 217.01 73728
+1151.107584 217.01 73728
+1151.181312 217.01 73728
+1151.255040 217.01 73728
+1151.328768 217.01 73728
+1151.402496 217.01 73728
+1151.476224 217.01 73728
+1151.549952 217.01 73728
+1151.623680 217.01 73728
+1151.697408 217.01 73728
+1151.771136 217.01 73728
+1151.844864 217.01 73728
+1151.918592 217.01 73728
+1151.992320 217.01 73728
+1152.066048 217.01 73728
+1152.139776 217.01 73728
+1152.213504 217.01 73728
+1152.287232 217.01 73728
+1152.360960 217.01 73728
+1152.434688 217.01 73728
+1152.508416 217.01 73728
+1152.582144 217.01 73728
+1152.655872 217.01 73728
+1152.729600 217.01 73728
+1152.803328 217.01 73728
+1152.877056 217.01 73728
+1152.950784 217.01 73728
+1153.024512 217.01 73728
+1153.098240 217.01 73728
+1153.171968 217.01 73728
+1153.245696 217.01 73728
+1153.319424 217.01 73728
+1153.393152 217.01 73728
+1153.466880 217.01 73728
+1153.540608 217.01 73728
+1153.614336 217.01 73728
+1153.688064 217.01 73728
+1153.761792 217.01 73728
+1153.835520 217.01 73728
+1153.909248 217.01 73728
+1153.982976 217.01 73728
+1154.056704 217.01 73728
+1154.130432 217.01 73728
+1154.204160 217.01 73728
+1154.277888 217.01 73728
+1154.351616 217.01 73728
+1154.425344 217.01 73728
+1154.499072 217.01 73728
+1154.572800 217.01 73728
+1154.646528 217.01 73728
+1154.720256 217.01 73728
+1154.793984 217.01 73728
+1154.867712 217.01 73728
+1154.941440 217.01 73728
+1155.015168 217.01 73728
+1155.088896 217.01 73728
+1155.162624 217.01 73728
+1155.236352 217.01 73728
+1155.310080 217.01 73728
+1155.383808 217.01 73728
+1155.457536 217.01 73728
+1155.531264 217.01 73728
+1155.604992 217.01 73728
+1155.678720 217.01 73728
+1155.752448 217.01 73728
+1155.826176 217.01 73728
+1155.899904 217.01 73728
+1155.973632 217.01 73728
+1156.047360 217.01 73728
+1156.121088 217.01 73728
+1156.194816 217.01 73728
+1156.268544 217.01 73728
+1156.342272 217.01 73728
+1156.416000 217.01 73728
+1156.489728 217.01 73728
+1156.563456 217.01 73728
+1156.637184 217.01 73728
+1156.710912 217.01 73728
+1156.784640 217.01 73728
+1156.858368 217.01 73728
+1156.932096 217.01 73728
+1157.005824 217.01 73728
+1157.079552 217.01 73728
+1157.153280 217.01 73728
+1157.227520 215.52 74240
+1157.301760 215.52 74240
+1157.376000 215.52 74240
+1157.450240 215.52 74240
+1157.524480 215.52 74240
+1157.598720 215.52 74240
+1157.672960 215.52 74240
+1157.747200 215.52 74240
+1157.821440 215.52 74240
+1157.895680 215.52 74240
+1157.969920 215.52 74240
+1158.044160 215.52 74240
+1158.118400 215.52 74240
+1158.192640 215.52 74240
+1158.266880 215.52 74240
+1158.341120 215.52 74240
+1158.415360 215.52 74240
+1158.489600 215.52 74240
+1158.563840 215.52 74240
+1158.638080 215.52 74240
+1158.712320 215.52 74240
+1158.786560 215.52 74240
+1158.860800 215.52 74240
+1158.935040 215.52 74240
+1159.009280 215.52 74240
+1159.083520 215.52 74240
+1159.157760 215.52 74240
+1159.232000 215.52 74240
+1159.306240 215.52 74240
+1159.380480 215.52 74240
+1159.454720 215.52 74240
+1159.528960 215.52 74240
+1159.603200 215.52 74240
+1159.677440 215.52 74240
+1159.751680 215.52 74240
+1159.825920 215.52 74240
+1159.900160 215.52 74240
+1159.974400 215.52 74240
+1160.048640 215.52 74240
+1160.122880 215.52 74240
+1160.197120 215.52 74240
+1160.271360 215.52 74240
+1160.345600 215.52 74240
+1160.419840 215.52 74240
+1160.494080 215.52 74240
+1160.568320 215.52 74240
+1160.642560 215.52 74240
+1160.716800 215.52 74240
+1160.791040 215.52 74240
+1160.865280 215.52 74240
+1160.939520 215.52 74240
+1161.013760 215.52 74240
+1161.088000 215.52 74240
+1161.162240 215.52 74240
+1161.236480 215.52 74240
+1161.310720 215.52 74240
+1161.384960 215.52 74240
+1161.459200 215.52 74240
+1161.533440 215.52 74240
+1161.607680 215.52 74240
+1161.681920 215.52 74240
+1161.756160 215.52 74240
+1161.830400 215.52 74240
+1161.904640 215.52 74240
+1161.979392 214.04 74752
+1162.054144 214.04 74752
+1162.128896 214.04 74752
+1162.203648 214.04 74752
+1162.278400 214.04 74752
+1162.353152 214.04 74752
+1162.427904 214.04 74752
+1162.502656 214.04 74752
+1162.577408 214.04 74752
+1162.652160 214.04 74752
+1162.726912 214.04 74752
+1162.801664 214.04 74752
+1162.876416 214.04 74752
+1162.951168 214.04 74752
+1163.025920 214.04 74752
+1163.100672 214.04 74752
+1163.175424 214.04 74752
+1163.250176 214.04 74752
+1163.324928 214.04 74752
+1163.399680 214.04 74752
+1163.474432 214.04 74752
+1163.549184 214.04 74752
+1163.623936 214.04 74752
+1163.698688 214.04 74752
+1163.773440 214.04 74752
+1163.848192 214.04 74752
+1163.922944 214.04 74752
+1163.997696 214.04 74752
+1164.072448 214.04 74752
+1164.147200 214.04 74752
+1164.221952 214.04 74752
+1164.296704 214.04 74752
+1164.371968 212.59 75264
+1164.447232 212.59 75264
+1164.522496 212.59 75264
+1164.597760 212.59 75264
+1164.673024 212.59 75264
+1164.748288 212.59 75264
+1164.823552 212.59 75264
+1164.898816 212.59 75264
+1164.974080 212.59 75264
+1165.049344 212.59 75264
+1165.124608 212.59 75264
+1165.199872 212.59 75264
+1165.275136 212.59 75264
+1165.350400 212.59 75264
+1165.425664 212.59 75264
+1165.500928 212.59 75264
+1165.576192 212.59 75264
+1165.651456 212.59 75264
+1165.726720 212.59 75264
+1165.801984 212.59 75264
+1165.877248 212.59 75264
+1165.952512 212.59 75264
+1166.027776 212.59 75264
+1166.103040 212.59 75264
+1166.178304 212.59 75264
+1166.253568 212.59 75264
+1166.328832 212.59 75264
+1166.404096 212.59 75264
+1166.479360 212.59 75264
+1166.554624 212.59 75264
+1166.629888 212.59 75264
+1166.705152 212.59 75264
+1166.780416 212.59 75264
+1166.855680 212.59 75264
+1166.930944 212.59 75264
+1167.006208 212.59 75264
+1167.081472 212.59 75264
+1167.156736 212.59 75264
+1167.232000 212.59 75264
+1167.307264 212.59 75264
+1167.382528 212.59 75264
+1167.457792 212.59 75264
+1167.533056 212.59 75264
+1167.608320 212.59 75264
+1167.683584 212.59 75264
+1167.758848 212.59 75264
+1167.834112 212.59 75264
+1167.909376 212.59 75264
+1167.984640 212.59 75264
+1168.059904 212.59 75264
+1168.135168 212.59 75264
+1168.210432 212.59 75264
+1168.285696 212.59 75264
+1168.360960 212.59 75264
+1168.436224 212.59 75264
+1168.511488 212.59 75264
+1168.586752 212.59 75264
+1168.662016 212.59 75264
+1168.737280 212.59 75264
+1168.812544 212.59 75264
+1168.887808 212.59 75264
+1168.963072 212.59 75264
+1169.038336 212.59 75264
+1169.113600 212.59 75264
+1169.188864 212.59 75264
+1169.264128 212.59 75264
+1169.339392 212.59 75264
+1169.414656 212.59 75264
+1169.489920 212.59 75264
+1169.565184 212.59 75264
+1169.640448 212.59 75264
+1169.715712 212.59 75264
+1169.790976 212.59 75264
+1169.866240 212.59 75264
+1169.941504 212.59 75264
+1170.016768 212.59 75264
+1170.092032 212.59 75264
+1170.167296 212.59 75264
+1170.242560 212.59 75264
+1170.317824 212.59 75264
+1170.393088 212.59 75264
+1170.468352 212.59 75264
+1170.543616 212.59 75264
+1170.618880 212.59 75264
+1170.694144 212.59 75264
+1170.769408 212.59 75264
+1170.844672 212.59 75264
+1170.919936 212.59 75264
+1170.995200 212.59 75264
+1171.070464 212.59 75264
+1171.145728 212.59 75264
+1171.220992 212.59 75264
+1171.296256 212.59 75264
+1171.371520 212.59 75264
+1171.446784 212.59 75264
+1171.522048 212.59 75264
+1171.597824 211.15 75776
+1171.673600 211.15 75776
+1171.749376 211.15 75776
+1171.825152 211.15 75776
+1171.900928 211.15 75776
+1171.976704 211.15 75776
+1172.052480 211.15 75776
+1172.128256 211.15 75776
+1172.204032 211.15 75776
+1172.279808 211.15 75776
+1172.355584 211.15 75776
+1172.431360 211.15 75776
+1172.507136 211.15 75776
+1172.582912 211.15 75776
+1172.658688 211.15 75776
+1172.734464 211.15 75776
+1172.810240 211.15 75776
+1172.886016 211.15 75776
+1172.961792 211.15 75776
+1173.037568 211.15 75776
+1173.113344 211.15 75776
+1173.189120 211.15 75776
+1173.264896 211.15 75776
+1173.340672 211.15 75776
+1173.416448 211.15 75776
+1173.492224 211.15 75776
+1173.568000 211.15 75776
+1173.643776 211.15 75776
+1173.719552 211.15 75776
+1173.795328 211.15 75776
+1173.871104 211.15 75776
+1173.946880 211.15 75776
+1174.022656 211.15 75776
+1174.098432 211.15 75776
+1174.174208 211.15 75776
+1174.249984 211.15 75776
+1174.325760 211.15 75776
+1174.401536 211.15 75776
+1174.477312 211.15 75776
+1174.553088 211.15 75776
+1174.628864 211.15 75776
+1174.704640 211.15 75776
+1174.780416 211.15 75776
+1174.856192 211.15 75776
+1174.931968 211.15 75776
+1175.007744 211.15 75776
+1175.083520 211.15 75776
+1175.159296 211.15 75776
+1175.235072 211.15 75776
+1175.310848 211.15 75776
+1175.386624 211.15 75776
+1175.462400 211.15 75776
+1175.538176 211.15 75776
+1175.613952 211.15 75776
+1175.689728 211.15 75776
+1175.765504 211.15 75776
+1175.841280 211.15 75776
+1175.917056 211.15 75776
+1175.992832 211.15 75776
+1176.068608 211.15 75776
+1176.144384 211.15 75776
+1176.220160 211.15 75776
+1176.295936 211.15 75776
+1176.371712 211.15 75776
+1176.448000 209.73 76288
+1176.524288 209.73 76288
+1176.600576 209.73 76288
+1176.676864 209.73 76288
+1176.753152 209.73 76288
+1176.829440 209.73 76288
+1176.905728 209.73 76288
+1176.982016 209.73 76288
+1177.058304 209.73 76288
+1177.134592 209.73 76288
+1177.210880 209.73 76288
+1177.287168 209.73 76288
+1177.363456 209.73 76288
+1177.439744 209.73 76288
+1177.516032 209.73 76288
+1177.592320 209.73 76288
+1177.668608 209.73 76288
+1177.744896 209.73 76288
+1177.821184 209.73 76288
+1177.897472 209.73 76288
+1177.973760 209.73 76288
+1178.050048 209.73 76288
+1178.126336 209.73 76288
+1178.202624 209.73 76288
+1178.278912 209.73 76288
+1178.355200 209.73 76288
+1178.431488 209.73 76288
+1178.507776 209.73 76288
+1178.584064 209.73 76288
+1178.660352 209.73 76288
+1178.736640 209.73 76288
+1178.812928 209.73 76288
+1178.889728 208.33 76800
+1178.966528 208.33 76800
+1179.043328 208.33 76800
+1179.120128 208.33 76800
+1179.196928 208.33 76800
+1179.273728 208.33 76800
+1179.350528 208.33 76800
+1179.427328 208.33 76800
+1179.504128 208.33 76800
+1179.580928 208.33 76800
+1179.657728 208.33 76800
+1179.734528 208.33 76800
+1179.811328 208.33 76800
+1179.888128 208.33 76800
+1179.964928 208.33 76800
+1180.041728 208.33 76800
+1180.118528 208.33 76800
+1180.195328 208.33 76800
+1180.272128 208.33 76800
+1180.348928 208.33 76800
+1180.425728 208.33 76800
+1180.502528 208.33 76800
+1180.579328 208.33 76800
+1180.656128 208.33 76800
+1180.732928 208.33 76800
+1180.809728 208.33 76800
+1180.886528 208.33 76800
+1180.963328 208.33 76800
+1181.040128 208.33 76800
+1181.116928 208.33 76800
+1181.193728 208.33 76800
+1181.270528 208.33 76800
+1181.347328 208.33 76800
+1181.424128 208.33 76800
+1181.500928 208.33 76800
+1181.577728 208.33 76800
+1181.654528 208.33 76800
+1181.731328 208.33 76800
+1181.808128 208.33 76800
+1181.884928 208.33 76800
+1181.961728 208.33 76800
+1182.038528 208.33 76800
+1182.115328 208.33 76800
+1182.192128 208.33 76800
+1182.268928 208.33 76800
+1182.345728 208.33 76800
+1182.422528 208.33 76800
+1182.499328 208.33 76800
+1182.576128 208.33 76800
+1182.652928 208.33 76800
+1182.729728 208.33 76800
+1182.806528 208.33 76800
+1182.883328 208.33 76800
+1182.960128 208.33 76800
+1183.036928 208.33 76800
+1183.113728 208.33 76800
+1183.190528 208.33 76800
+1183.267328 208.33 76800
+1183.344128 208.33 76800
+1183.420928 208.33 76800
+1183.497728 208.33 76800
+1183.574528 208.33 76800
+1183.651328 208.33 76800
+1183.728128 208.33 76800
+1183.805440 206.95 77312
+1183.882752 206.95 77312
+1183.960064 206.95 77312
+1184.037376 206.95 77312
+1184.114688 206.95 77312
+1184.192000 206.95 77312
+1184.269312 206.95 77312
+1184.346624 206.95 77312
+1184.423936 206.95 77312
+1184.501248 206.95 77312
+1184.578560 206.95 77312
+1184.655872 206.95 77312
+1184.733184 206.95 77312
+1184.810496 206.95 77312
+1184.887808 206.95 77312
+1184.965120 206.95 77312
+1185.042432 206.95 77312
+1185.119744 206.95 77312
+1185.197056 206.95 77312
+1185.274368 206.95 77312
+1185.351680 206.95 77312
+1185.428992 206.95 77312
+1185.506304 206.95 77312
+1185.583616 206.95 77312
+1185.660928 206.95 77312
+1185.738240 206.95 77312
+1185.815552 206.95 77312
+1185.892864 206.95 77312
+1185.970176 206.95 77312
+1186.047488 206.95 77312
+1186.124800 206.95 77312
+1186.202112 206.95 77312
+1186.279936 205.59 77824
+1186.357760 205.59 77824
+1186.435584 205.59 77824
+1186.513408 205.59 77824
+1186.591232 205.59 77824
+1186.669056 205.59 77824
+1186.746880 205.59 77824
+1186.824704 205.59 77824
+1186.902528 205.59 77824
+1186.980352 205.59 77824
+1187.058176 205.59 77824
+1187.136000 205.59 77824
+1187.213824 205.59 77824
+1187.291648 205.59 77824
+1187.369472 205.59 77824
+1187.447296 205.59 77824
+1187.525120 205.59 77824
+1187.602944 205.59 77824
+1187.680768 205.59 77824
+1187.758592 205.59 77824
+1187.836416 205.59 77824
+1187.914240 205.59 77824
+1187.992064 205.59 77824
+1188.069888 205.59 77824
+1188.147712 205.59 77824
+1188.225536 205.59 77824
+1188.303360 205.59 77824
+1188.381184 205.59 77824
+1188.459008 205.59 77824
+1188.536832 205.59 77824
+1188.614656 205.59 77824
+1188.692480 205.59 77824
+1188.770304 205.59 77824
+1188.848128 205.59 77824
+1188.925952 205.59 77824
+1189.003776 205.59 77824
+1189.081600 205.59 77824
+1189.159424 205.59 77824
+1189.237248 205.59 77824
+1189.315072 205.59 77824
+1189.392896 205.59 77824
+1189.470720 205.59 77824
+1189.548544 205.59 77824
+1189.626368 205.59 77824
+1189.704192 205.59 77824
+1189.782016 205.59 77824
+1189.859840 205.59 77824
+1189.937664 205.59 77824
+1190.015488 205.59 77824
+1190.093312 205.59 77824
+1190.171136 205.59 77824
+1190.248960 205.59 77824
+1190.326784 205.59 77824
+1190.404608 205.59 77824
+1190.482432 205.59 77824
+1190.560256 205.59 77824
+1190.638080 205.59 77824
+1190.715904 205.59 77824
+1190.793728 205.59 77824
+1190.871552 205.59 77824
+1190.949376 205.59 77824
+1191.027200 205.59 77824
+1191.105024 205.59 77824
+1191.182848 205.59 77824
+1191.260672 205.59 77824
+1191.338496 205.59 77824
+1191.416320 205.59 77824
+1191.494144 205.59 77824
+1191.571968 205.59 77824
+1191.649792 205.59 77824
+1191.727616 205.59 77824
+1191.805440 205.59 77824
+1191.883264 205.59 77824
+1191.961088 205.59 77824
+1192.038912 205.59 77824
+1192.116736 205.59 77824
+1192.194560 205.59 77824
+1192.272384 205.59 77824
+1192.350208 205.59 77824
+1192.428032 205.59 77824
+1192.505856 205.59 77824
+1192.583680 205.59 77824
+1192.661504 205.59 77824
+1192.739328 205.59 77824
+1192.817152 205.59 77824
+1192.894976 205.59 77824
+1192.972800 205.59 77824
+1193.050624 205.59 77824
+1193.128448 205.59 77824
+1193.206272 205.59 77824
+1193.284096 205.59 77824
+1193.361920 205.59 77824
+1193.439744 205.59 77824
+1193.517568 205.59 77824
+1193.595392 205.59 77824
+1193.673216 205.59 77824
+1193.751552 204.25 78336
+1193.829888 204.25 78336
+1193.908224 204.25 78336
+1193.986560 204.25 78336
+1194.064896 204.25 78336
+1194.143232 204.25 78336
+1194.221568 204.25 78336
+1194.299904 204.25 78336
+1194.378240 204.25 78336
+1194.456576 204.25 78336
+1194.534912 204.25 78336
+1194.613248 204.25 78336
+1194.691584 204.25 78336
+1194.769920 204.25 78336
+1194.848256 204.25 78336
+1194.926592 204.25 78336
+1195.004928 204.25 78336
+1195.083264 204.25 78336
+1195.161600 204.25 78336
+1195.239936 204.25 78336
+1195.318272 204.25 78336
+1195.396608 204.25 78336
+1195.474944 204.25 78336
+1195.553280 204.25 78336
+1195.631616 204.25 78336
+1195.709952 204.25 78336
+1195.788288 204.25 78336
+1195.866624 204.25 78336
+1195.944960 204.25 78336
+1196.023296 204.25 78336
+1196.101632 204.25 78336
+1196.179968 204.25 78336
+1196.258816 202.92 78848
+1196.337664 202.92 78848
+1196.416512 202.92 78848
+1196.495360 202.92 78848
+1196.574208 202.92 78848
+1196.653056 202.92 78848
+1196.731904 202.92 78848
+1196.810752 202.92 78848
+1196.889600 202.92 78848
+1196.968448 202.92 78848
+1197.047296 202.92 78848
+1197.126144 202.92 78848
+1197.204992 202.92 78848
+1197.283840 202.92 78848
+1197.362688 202.92 78848
+1197.441536 202.92 78848
+1197.520384 202.92 78848
+1197.599232 202.92 78848
+1197.678080 202.92 78848
+1197.756928 202.92 78848
+1197.835776 202.92 78848
+1197.914624 202.92 78848
+1197.993472 202.92 78848
+1198.072320 202.92 78848
+1198.151168 202.92 78848
+1198.230016 202.92 78848
+1198.308864 202.92 78848
+1198.387712 202.92 78848
+1198.466560 202.92 78848
+1198.545408 202.92 78848
+1198.624256 202.92 78848
+1198.703104 202.92 78848
+1198.781952 202.92 78848
+1198.860800 202.92 78848
+1198.939648 202.92 78848
+1199.018496 202.92 78848
+1199.097344 202.92 78848
+1199.176192 202.92 78848
+1199.255040 202.92 78848
+1199.333888 202.92 78848
+1199.412736 202.92 78848
+1199.491584 202.92 78848
+1199.570432 202.92 78848
+1199.649280 202.92 78848
+1199.728128 202.92 78848
+1199.806976 202.92 78848
+1199.885824 202.92 78848
+1199.964672 202.92 78848
+1200.043520 202.92 78848
+1200.122368 202.92 78848
+1200.201216 202.92 78848
+1200.280064 202.92 78848
+1200.358912 202.92 78848
+1200.437760 202.92 78848
+1200.516608 202.92 78848
+1200.595456 202.92 78848
+1200.674304 202.92 78848
+1200.753152 202.92 78848
+1200.832000 202.92 78848
+1200.910848 202.92 78848
+1200.989696 202.92 78848
+1201.068544 202.92 78848
+1201.147392 202.92 78848
+1201.226240 202.92 78848
+1201.305600 201.61 79360
+1201.384960 201.61 79360
+1201.464320 201.61 79360
+1201.543680 201.61 79360
+1201.623040 201.61 79360
+1201.702400 201.61 79360
+1201.781760 201.61 79360
+1201.861120 201.61 79360
+1201.940480 201.61 79360
+1202.019840 201.61 79360
+1202.099200 201.61 79360
+1202.178560 201.61 79360
+1202.257920 201.61 79360
+1202.337280 201.61 79360
+1202.416640 201.61 79360
+1202.496000 201.61 79360
+1202.575360 201.61 79360
+1202.654720 201.61 79360
+1202.734080 201.61 79360
+1202.813440 201.61 79360
+1202.892800 201.61 79360
+1202.972160 201.61 79360
+1203.051520 201.61 79360
+1203.130880 201.61 79360
+1203.210240 201.61 79360
+1203.289600 201.61 79360
+1203.368960 201.61 79360
+1203.448320 201.61 79360
+1203.527680 201.61 79360
+1203.607040 201.61 79360
+1203.686400 201.61 79360
+1203.765760 201.61 79360
+1203.845120 201.61 79360
+1203.924480 201.61 79360
+1204.003840 201.61 79360
+1204.083200 201.61 79360
+1204.162560 201.61 79360
+1204.241920 201.61 79360
+1204.321280 201.61 79360
+1204.400640 201.61 79360
+1204.480000 201.61 79360
+1204.559360 201.61 79360
+1204.638720 201.61 79360
+1204.718080 201.61 79360
+1204.797440 201.61 79360
+1204.876800 201.61 79360
+1204.956160 201.61 79360
+1205.035520 201.61 79360
+1205.115392 200.32 79872
+1205.195264 200.32 79872
+1205.275136 200.32 79872
+1205.355008 200.32 79872
+1205.434880 200.32 79872
+1205.514752 200.32 79872
+1205.594624 200.32 79872
+1205.674496 200.32 79872
+1205.754368 200.32 79872
+1205.834240 200.32 79872
+1205.914112 200.32 79872
+1205.993984 200.32 79872
+1206.073856 200.32 79872
+1206.153728 200.32 79872
+1206.233600 200.32 79872
+1206.313472 200.32 79872
+1206.393344 200.32 79872
+1206.473216 200.32 79872
+1206.553088 200.32 79872
+1206.632960 200.32 79872
+1206.712832 200.32 79872
+1206.792704 200.32 79872
+1206.872576 200.32 79872
+1206.952448 200.32 79872
+1207.032320 200.32 79872
+1207.112192 200.32 79872
+1207.192064 200.32 79872
+1207.271936 200.32 79872
+1207.351808 200.32 79872
+1207.431680 200.32 79872
+1207.511552 200.32 79872
+1207.591424 200.32 79872
+1207.671808 199.04 80384
+1207.752192 199.04 80384
+1207.832576 199.04 80384
+1207.912960 199.04 80384
+1207.993344 199.04 80384
+1208.073728 199.04 80384
+1208.154112 199.04 80384
+1208.234496 199.04 80384
+1208.314880 199.04 80384
+1208.395264 199.04 80384
+1208.475648 199.04 80384
+1208.556032 199.04 80384
+1208.636416 199.04 80384
+1208.716800 199.04 80384
+1208.797184 199.04 80384
+1208.877568 199.04 80384
+1208.957952 199.04 80384
+1209.038336 199.04 80384
+1209.118720 199.04 80384
+1209.199104 199.04 80384
+1209.279488 199.04 80384
+1209.359872 199.04 80384
+1209.440256 199.04 80384
+1209.520640 199.04 80384
+1209.601024 199.04 80384
+1209.681408 199.04 80384
+1209.761792 199.04 80384
+1209.842176 199.04 80384
+1209.922560 199.04 80384
+1210.002944 199.04 80384
+1210.083328 199.04 80384
+1210.163712 199.04 80384
+1210.244096 199.04 80384
+1210.324480 199.04 80384
+1210.404864 199.04 80384
+1210.485248 199.04 80384
+1210.565632 199.04 80384
+1210.646016 199.04 80384
+1210.726400 199.04 80384
+1210.806784 199.04 80384
+1210.887168 199.04 80384
+1210.967552 199.04 80384
+1211.047936 199.04 80384
+1211.128320 199.04 80384
+1211.208704 199.04 80384
+1211.289088 199.04 80384
+1211.369472 199.04 80384
+1211.449856 199.04 80384
+1211.530240 199.04 80384
+1211.610624 199.04 80384
+1211.691008 199.04 80384
+1211.771392 199.04 80384
+1211.851776 199.04 80384
+1211.932160 199.04 80384
+1212.012544 199.04 80384
+1212.092928 199.04 80384
+1212.173312 199.04 80384
+1212.253696 199.04 80384
+1212.334080 199.04 80384
+1212.414464 199.04 80384
+1212.494848 199.04 80384
+1212.575232 199.04 80384
+1212.655616 199.04 80384
+1212.736000 199.04 80384
+1212.816384 199.04 80384
+1212.896768 199.04 80384
+1212.977152 199.04 80384
+1213.057536 199.04 80384
+1213.137920 199.04 80384
+1213.218304 199.04 80384
+1213.298688 199.04 80384
+1213.379072 199.04 80384
+1213.459456 199.04 80384
+1213.539840 199.04 80384
+1213.620224 199.04 80384
+1213.700608 199.04 80384
+1213.780992 199.04 80384
+1213.861376 199.04 80384
+1213.941760 199.04 80384
+1214.022144 199.04 80384
+1214.102528 199.04 80384
+1214.182912 199.04 80384
+1214.263296 199.04 80384
+1214.343680 199.04 80384
+1214.424064 199.04 80384
+1214.504448 199.04 80384
+1214.584832 199.04 80384
+1214.665216 199.04 80384
+1214.745600 199.04 80384
+1214.825984 199.04 80384
+1214.906368 199.04 80384
+1214.986752 199.04 80384
+1215.067136 199.04 80384
+1215.147520 199.04 80384
+1215.227904 199.04 80384
+1215.308288 199.04 80384
+1215.389184 197.78 80896
+1215.470080 197.78 80896
+1215.550976 197.78 80896
+1215.631872 197.78 80896
+1215.712768 197.78 80896
+1215.793664 197.78 80896
+1215.874560 197.78 80896
+1215.955456 197.78 80896
+1216.036352 197.78 80896
+1216.117248 197.78 80896
+1216.198144 197.78 80896
+1216.279040 197.78 80896
+1216.359936 197.78 80896
+1216.440832 197.78 80896
+1216.521728 197.78 80896
+1216.602624 197.78 80896
+1216.683520 197.78 80896
+1216.764416 197.78 80896
+1216.845312 197.78 80896
+1216.926208 197.78 80896
+1217.007104 197.78 80896
+1217.088000 197.78 80896
+1217.168896 197.78 80896
+1217.249792 197.78 80896
+1217.330688 197.78 80896
+1217.411584 197.78 80896
+1217.492480 197.78 80896
+1217.573376 197.78 80896
+1217.654272 197.78 80896
+1217.735168 197.78 80896
+1217.816064 197.78 80896
+1217.896960 197.78 80896
+1217.978368 196.54 81408
+1218.059776 196.54 81408
+1218.141184 196.54 81408
+1218.222592 196.54 81408
+1218.304000 196.54 81408
+1218.385408 196.54 81408
+1218.466816 196.54 81408
+1218.548224 196.54 81408
+1218.629632 196.54 81408
+1218.711040 196.54 81408
+1218.792448 196.54 81408
+1218.873856 196.54 81408
+1218.955264 196.54 81408
+1219.036672 196.54 81408
+1219.118080 196.54 81408
+1219.199488 196.54 81408
+1219.280896 196.54 81408
+1219.362304 196.54 81408
+1219.443712 196.54 81408
+1219.525120 196.54 81408
+1219.606528 196.54 81408
+1219.687936 196.54 81408
+1219.769344 196.54 81408
+1219.850752 196.54 81408
+1219.932160 196.54 81408
+1220.013568 196.54 81408
+1220.094976 196.54 81408
+1220.176384 196.54 81408
+1220.257792 196.54 81408
+1220.339200 196.54 81408
+1220.420608 196.54 81408
+1220.502016 196.54 81408
+1220.583424 196.54 81408
+1220.664832 196.54 81408
+1220.746240 196.54 81408
+1220.827648 196.54 81408
+1220.909056 196.54 81408
+1220.990464 196.54 81408
+1221.071872 196.54 81408
+1221.153280 196.54 81408
+1221.234688 196.54 81408
+1221.316096 196.54 81408
+1221.397504 196.54 81408
+1221.478912 196.54 81408
+1221.560320 196.54 81408
+1221.641728 196.54 81408
+1221.723136 196.54 81408
+1221.804544 196.54 81408
+1221.886464 195.31 81920
+1221.968384 195.31 81920
+1222.050304 195.31 81920
+1222.132224 195.31 81920
+1222.214144 195.31 81920
+1222.296064 195.31 81920
+1222.377984 195.31 81920
+1222.459904 195.31 81920
+1222.541824 195.31 81920
+1222.623744 195.31 81920
+1222.705664 195.31 81920
+1222.787584 195.31 81920
+1222.869504 195.31 81920
+1222.951424 195.31 81920
+1223.033344 195.31 81920
+1223.115264 195.31 81920
+1223.197184 195.31 81920
+1223.279104 195.31 81920
+1223.361024 195.31 81920
+1223.442944 195.31 81920
+1223.524864 195.31 81920
+1223.606784 195.31 81920
+1223.688704 195.31 81920
+1223.770624 195.31 81920
+1223.852544 195.31 81920
+1223.934464 195.31 81920
+1224.016384 195.31 81920
+1224.098304 195.31 81920
+1224.180224 195.31 81920
+1224.262144 195.31 81920
+1224.344064 195.31 81920
+1224.425984 195.31 81920
+1224.508416 194.10 82432
+1224.590848 194.10 82432
+1224.673280 194.10 82432
+1224.755712 194.10 82432
+1224.838144 194.10 82432
+1224.920576 194.10 82432
+1225.003008 194.10 82432
+1225.085440 194.10 82432
+1225.167872 194.10 82432
+1225.250304 194.10 82432
+1225.332736 194.10 82432
+1225.415168 194.10 82432
+1225.497600 194.10 82432
+1225.580032 194.10 82432
+1225.662464 194.10 82432
+1225.744896 194.10 82432
+1225.827328 194.10 82432
+1225.909760 194.10 82432
+1225.992192 194.10 82432
+1226.074624 194.10 82432
+1226.157056 194.10 82432
+1226.239488 194.10 82432
+1226.321920 194.10 82432
+1226.404352 194.10 82432
+1226.486784 194.10 82432
+1226.569216 194.10 82432
+1226.651648 194.10 82432
+1226.734080 194.10 82432
+1226.816512 194.10 82432
+1226.898944 194.10 82432
+1226.981376 194.10 82432
+1227.063808 194.10 82432
+1227.146240 194.10 82432
+1227.228672 194.10 82432
+1227.311104 194.10 82432
+1227.393536 194.10 82432
+1227.475968 194.10 82432
+1227.558400 194.10 82432
+1227.640832 194.10 82432
+1227.723264 194.10 82432
+1227.805696 194.10 82432
+1227.888128 194.10 82432
+1227.970560 194.10 82432
+1228.052992 194.10 82432
+1228.135424 194.10 82432
+1228.217856 194.10 82432
+1228.300288 194.10 82432
+1228.382720 194.10 82432
+1228.465664 192.90 82944
+1228.548608 192.90 82944
+1228.631552 192.90 82944
+1228.714496 192.90 82944
+1228.797440 192.90 82944
+1228.880384 192.90 82944
+1228.963328 192.90 82944
+1229.046272 192.90 82944
+1229.129216 192.90 82944
+1229.212160 192.90 82944
+1229.295104 192.90 82944
+1229.378048 192.90 82944
+1229.460992 192.90 82944
+1229.543936 192.90 82944
+1229.626880 192.90 82944
+1229.709824 192.90 82944
+1229.792768 192.90 82944
+1229.875712 192.90 82944
+1229.958656 192.90 82944
+1230.041600 192.90 82944
+1230.124544 192.90 82944
+1230.207488 192.90 82944
+1230.290432 192.90 82944
+1230.373376 192.90 82944
+1230.456320 192.90 82944
+1230.539264 192.90 82944
+1230.622208 192.90 82944
+1230.705152 192.90 82944
+1230.788096 192.90 82944
+1230.871040 192.90 82944
+1230.953984 192.90 82944
+1231.036928 192.90 82944
+1231.119872 192.90 82944
+1231.202816 192.90 82944
+1231.285760 192.90 82944
+1231.368704 192.90 82944
+1231.451648 192.90 82944
+1231.534592 192.90 82944
+1231.617536 192.90 82944
+1231.700480 192.90 82944
+1231.783424 192.90 82944
+1231.866368 192.90 82944
+1231.949312 192.90 82944
+1232.032256 192.90 82944
+1232.115200 192.90 82944
+1232.198144 192.90 82944
+1232.281088 192.90 82944
+1232.364032 192.90 82944
+1232.447488 191.72 83456
+1232.530944 191.72 83456
+1232.614400 191.72 83456
+1232.697856 191.72 83456
+1232.781312 191.72 83456
+1232.864768 191.72 83456
+1232.948224 191.72 83456
+1233.031680 191.72 83456
+1233.115136 191.72 83456
+1233.198592 191.72 83456
+1233.282048 191.72 83456
+1233.365504 191.72 83456
+1233.448960 191.72 83456
+1233.532416 191.72 83456
+1233.615872 191.72 83456
+1233.699328 191.72 83456
+1233.782784 191.72 83456
+1233.866240 191.72 83456
+1233.949696 191.72 83456
+1234.033152 191.72 83456
+1234.116608 191.72 83456
+1234.200064 191.72 83456
+1234.283520 191.72 83456
+1234.366976 191.72 83456
+1234.450432 191.72 83456
+1234.533888 191.72 83456
+1234.617344 191.72 83456
+1234.700800 191.72 83456
+1234.784256 191.72 83456
+1234.867712 191.72 83456
+1234.951168 191.72 83456
+1235.034624 191.72 83456
+1235.118080 191.72 83456
+1235.201536 191.72 83456
+1235.284992 191.72 83456
+1235.368448 191.72 83456
+1235.451904 191.72 83456
+1235.535360 191.72 83456
+1235.618816 191.72 83456
+1235.702272 191.72 83456
+1235.785728 191.72 83456
+1235.869184 191.72 83456
+1235.952640 191.72 83456
+1236.036096 191.72 83456
+1236.119552 191.72 83456
+1236.203008 191.72 83456
+1236.286464 191.72 83456
+1236.369920 191.72 83456
+1236.453376 191.72 83456
+1236.536832 191.72 83456
+1236.620288 191.72 83456
+1236.703744 191.72 83456
+1236.787200 191.72 83456
+1236.870656 191.72 83456
+1236.954112 191.72 83456
+1237.037568 191.72 83456
+1237.121024 191.72 83456
+1237.204480 191.72 83456
+1237.287936 191.72 83456
+1237.371392 191.72 83456
+1237.454848 191.72 83456
+1237.538304 191.72 83456
+1237.621760 191.72 83456
+1237.705216 191.72 83456
+1237.788672 191.72 83456
+1237.872128 191.72 83456
+1237.955584 191.72 83456
+1238.039040 191.72 83456
+1238.122496 191.72 83456
+1238.205952 191.72 83456
+1238.289408 191.72 83456
+1238.372864 191.72 83456
+1238.456320 191.72 83456
+1238.539776 191.72 83456
+1238.623232 191.72 83456
+1238.706688 191.72 83456
+1238.790144 191.72 83456
+1238.873600 191.72 83456
+1238.957056 191.72 83456
+1239.040512 191.72 83456
+1239.124480 190.55 83968
+1239.208448 190.55 83968
+1239.292416 190.55 83968
+1239.376384 190.55 83968
+1239.460352 190.55 83968
+1239.544320 190.55 83968
+1239.628288 190.55 83968
+1239.712256 190.55 83968
+1239.796224 190.55 83968
+1239.880192 190.55 83968
+1239.964160 190.55 83968
+1240.048128 190.55 83968
+1240.132096 190.55 83968
+1240.216064 190.55 83968
+1240.300032 190.55 83968
+1240.384000 190.55 83968
+1240.467968 190.55 83968
+1240.551936 190.55 83968
+1240.635904 190.55 83968
+1240.719872 190.55 83968
+1240.803840 190.55 83968
+1240.887808 190.55 83968
+1240.971776 190.55 83968
+1241.055744 190.55 83968
+1241.139712 190.55 83968
+1241.223680 190.55 83968
+1241.307648 190.55 83968
+1241.391616 190.55 83968
+1241.475584 190.55 83968
+1241.559552 190.55 83968
+1241.643520 190.55 83968
+1241.727488 190.55 83968
+1241.811968 189.39 84480
+1241.896448 189.39 84480
+1241.980928 189.39 84480
+1242.065408 189.39 84480
+1242.149888 189.39 84480
+1242.234368 189.39 84480
+1242.318848 189.39 84480
+1242.403328 189.39 84480
+1242.487808 189.39 84480
+1242.572288 189.39 84480
+1242.656768 189.39 84480
+1242.741248 189.39 84480
+1242.825728 189.39 84480
+1242.910208 189.39 84480
+1242.994688 189.39 84480
+1243.079168 189.39 84480
+1243.163648 189.39 84480
+1243.248128 189.39 84480
+1243.332608 189.39 84480
+1243.417088 189.39 84480
+1243.501568 189.39 84480
+1243.586048 189.39 84480
+1243.670528 189.39 84480
+1243.755008 189.39 84480
+1243.839488 189.39 84480
+1243.923968 189.39 84480
+1244.008448 189.39 84480
+1244.092928 189.39 84480
+1244.177408 189.39 84480
+1244.261888 189.39 84480
+1244.346368 189.39 84480
+1244.430848 189.39 84480
+1244.515840 188.25 84992
+1244.600832 188.25 84992
+1244.685824 188.25 84992
+1244.770816 188.25 84992
+1244.855808 188.25 84992
+1244.940800 188.25 84992
+1245.025792 188.25 84992
+1245.110784 188.25 84992
+1245.195776 188.25 84992
+1245.280768 188.25 84992
+1245.365760 188.25 84992
+1245.450752 188.25 84992
+1245.535744 188.25 84992
+1245.620736 188.25 84992
+1245.705728 188.25 84992
+1245.790720 188.25 84992
+1245.875712 188.25 84992
+1245.960704 188.25 84992
+1246.045696 188.25 84992
+1246.130688 188.25 84992
+1246.215680 188.25 84992
+1246.300672 188.25 84992
+1246.385664 188.25 84992
+1246.470656 188.25 84992
+1246.555648 188.25 84992
+1246.640640 188.25 84992
+1246.725632 188.25 84992
+1246.810624 188.25 84992
+1246.895616 188.25 84992
+1246.980608 188.25 84992
+1247.065600 188.25 84992
+1247.150592 188.25 84992
+1247.235584 188.25 84992
+1247.320576 188.25 84992
+1247.405568 188.25 84992
+1247.490560 188.25 84992
+1247.575552 188.25 84992
+1247.660544 188.25 84992
+1247.745536 188.25 84992
+1247.830528 188.25 84992
+1247.915520 188.25 84992
+1248.000512 188.25 84992
+1248.085504 188.25 84992
+1248.170496 188.25 84992
+1248.255488 188.25 84992
+1248.340480 188.25 84992
+1248.425472 188.25 84992
+1248.510464 188.25 84992
+1248.595968 187.13 85504
+1248.681472 187.13 85504
+1248.766976 187.13 85504
+1248.852480 187.13 85504
+1248.937984 187.13 85504
+1249.023488 187.13 85504
+1249.108992 187.13 85504
+1249.194496 187.13 85504
+1249.280000 187.13 85504
+1249.365504 187.13 85504
+1249.451008 187.13 85504
+1249.536512 187.13 85504
+1249.622016 187.13 85504
+1249.707520 187.13 85504
+1249.793024 187.13 85504
+1249.878528 187.13 85504
+1249.964032 187.13 85504
+1250.049536 187.13 85504
+1250.135040 187.13 85504
+1250.220544 187.13 85504
+1250.306048 187.13 85504
+1250.391552 187.13 85504
+1250.477056 187.13 85504
+1250.562560 187.13 85504
+1250.648064 187.13 85504
+1250.733568 187.13 85504
+1250.819072 187.13 85504
+1250.904576 187.13 85504
+1250.990080 187.13 85504
+1251.075584 187.13 85504
+1251.161088 187.13 85504
+1251.246592 187.13 85504
+1251.332608 186.01 86016
+1251.418624 186.01 86016
+1251.504640 186.01 86016
+1251.590656 186.01 86016
+1251.676672 186.01 86016
+1251.762688 186.01 86016
+1251.848704 186.01 86016
+1251.934720 186.01 86016
+1252.020736 186.01 86016
+1252.106752 186.01 86016
+1252.192768 186.01 86016
+1252.278784 186.01 86016
+1252.364800 186.01 86016
+1252.450816 186.01 86016
+1252.536832 186.01 86016
+1252.622848 186.01 86016
+1252.708864 186.01 86016
+1252.794880 186.01 86016
+1252.880896 186.01 86016
+1252.966912 186.01 86016
+1253.052928 186.01 86016
+1253.138944 186.01 86016
+1253.224960 186.01 86016
+1253.310976 186.01 86016
+1253.396992 186.01 86016
+1253.483008 186.01 86016
+1253.569024 186.01 86016
+1253.655040 186.01 86016
+1253.741056 186.01 86016
+1253.827072 186.01 86016
+1253.913088 186.01 86016
+1253.999104 186.01 86016
+1254.085120 186.01 86016
+1254.171136 186.01 86016
+1254.257152 186.01 86016
+1254.343168 186.01 86016
+1254.429184 186.01 86016
+1254.515200 186.01 86016
+1254.601216 186.01 86016
+1254.687232 186.01 86016
+1254.773248 186.01 86016
+1254.859264 186.01 86016
+1254.945280 186.01 86016
+1255.031296 186.01 86016
+1255.117312 186.01 86016
+1255.203328 186.01 86016
+1255.289344 186.01 86016
+1255.375360 186.01 86016
+1255.461888 184.91 86528
+1255.548416 184.91 86528
+1255.634944 184.91 86528
+1255.721472 184.91 86528
+1255.808000 184.91 86528
+1255.894528 184.91 86528
+1255.981056 184.91 86528
+1256.067584 184.91 86528
+1256.154112 184.91 86528
+1256.240640 184.91 86528
+1256.327168 184.91 86528
+1256.413696 184.91 86528
+1256.500224 184.91 86528
+1256.586752 184.91 86528
+1256.673280 184.91 86528
+1256.759808 184.91 86528
+1256.846336 184.91 86528
+1256.932864 184.91 86528
+1257.019392 184.91 86528
+1257.105920 184.91 86528
+1257.192448 184.91 86528
+1257.278976 184.91 86528
+1257.365504 184.91 86528
+1257.452032 184.91 86528
+1257.538560 184.91 86528
+1257.625088 184.91 86528
+1257.711616 184.91 86528
+1257.798144 184.91 86528
+1257.884672 184.91 86528
+1257.971200 184.91 86528
+1258.057728 184.91 86528
+1258.144256 184.91 86528
+1258.231296 183.82 87040
+1258.318336 183.82 87040
+1258.405376 183.82 87040
+1258.492416 183.82 87040
+1258.579456 183.82 87040
+1258.666496 183.82 87040
+1258.753536 183.82 87040
+1258.840576 183.82 87040
+1258.927616 183.82 87040
+1259.014656 183.82 87040
+1259.101696 183.82 87040
+1259.188736 183.82 87040
+1259.275776 183.82 87040
+1259.362816 183.82 87040
+1259.449856 183.82 87040
+1259.536896 183.82 87040
+1259.623936 183.82 87040
+1259.710976 183.82 87040
+1259.798016 183.82 87040
+1259.885056 183.82 87040
+1259.972096 183.82 87040
+1260.059136 183.82 87040
+1260.146176 183.82 87040
+1260.233216 183.82 87040
+1260.320256 183.82 87040
+1260.407296 183.82 87040
+1260.494336 183.82 87040
+1260.581376 183.82 87040
+1260.668416 183.82 87040
+1260.755456 183.82 87040
+1260.842496 183.82 87040
+1260.929536 183.82 87040
+1261.017088 182.75 87552
+1261.104640 182.75 87552
+1261.192192 182.75 87552
+1261.279744 182.75 87552
+1261.367296 182.75 87552
+1261.454848 182.75 87552
+1261.542400 182.75 87552
+1261.629952 182.75 87552
+1261.717504 182.75 87552
+1261.805056 182.75 87552
+1261.892608 182.75 87552
+1261.980160 182.75 87552
+1262.067712 182.75 87552
+1262.155264 182.75 87552
+1262.242816 182.75 87552
+1262.330368 182.75 87552
+1262.417920 182.75 87552
+1262.505472 182.75 87552
+1262.593024 182.75 87552
+1262.680576 182.75 87552
+1262.768128 182.75 87552
+1262.855680 182.75 87552
+1262.943232 182.75 87552
+1263.030784 182.75 87552
+1263.118336 182.75 87552
+1263.205888 182.75 87552
+1263.293440 182.75 87552
+1263.380992 182.75 87552
+1263.468544 182.75 87552
+1263.556096 182.75 87552
+1263.643648 182.75 87552
+1263.731200 182.75 87552
+1263.819264 181.69 88064
+1263.907328 181.69 88064
+1263.995392 181.69 88064
+1264.083456 181.69 88064
+1264.171520 181.69 88064
+1264.259584 181.69 88064
+1264.347648 181.69 88064
+1264.435712 181.69 88064
+1264.523776 181.69 88064
+1264.611840 181.69 88064
+1264.699904 181.69 88064
+1264.787968 181.69 88064
+1264.876032 181.69 88064
+1264.964096 181.69 88064
+1265.052160 181.69 88064
+1265.140224 181.69 88064
+1265.228288 181.69 88064
+1265.316352 181.69 88064
+1265.404416 181.69 88064
+1265.492480 181.69 88064
+1265.580544 181.69 88064
+1265.668608 181.69 88064
+1265.756672 181.69 88064
+1265.844736 181.69 88064
+1265.932800 181.69 88064
+1266.020864 181.69 88064
+1266.108928 181.69 88064
+1266.196992 181.69 88064
+1266.285056 181.69 88064
+1266.373120 181.69 88064
+1266.461184 181.69 88064
+1266.549248 181.69 88064
+1266.637312 181.69 88064
+1266.725376 181.69 88064
+1266.813440 181.69 88064
+1266.901504 181.69 88064
+1266.989568 181.69 88064
+1267.077632 181.69 88064
+1267.165696 181.69 88064
+1267.253760 181.69 88064
+1267.341824 181.69 88064
+1267.429888 181.69 88064
+1267.517952 181.69 88064
+1267.606016 181.69 88064
+1267.694080 181.69 88064
+1267.782144 181.69 88064
+1267.870208 181.69 88064
+1267.958272 181.69 88064
+1268.046848 180.64 88576
+1268.135424 180.64 88576
+1268.224000 180.64 88576
+1268.312576 180.64 88576
+1268.401152 180.64 88576
+1268.489728 180.64 88576
+1268.578304 180.64 88576
+1268.666880 180.64 88576
+1268.755456 180.64 88576
+1268.844032 180.64 88576
+1268.932608 180.64 88576
+1269.021184 180.64 88576
+1269.109760 180.64 88576
+1269.198336 180.64 88576
+1269.286912 180.64 88576
+1269.375488 180.64 88576
+1269.464064 180.64 88576
+1269.552640 180.64 88576
+1269.641216 180.64 88576
+1269.729792 180.64 88576
+1269.818368 180.64 88576
+1269.906944 180.64 88576
+1269.995520 180.64 88576
+1270.084096 180.64 88576
+1270.172672 180.64 88576
+1270.261248 180.64 88576
+1270.349824 180.64 88576
+1270.438400 180.64 88576
+1270.526976 180.64 88576
+1270.615552 180.64 88576
+1270.704128 180.64 88576
+1270.792704 180.64 88576
+1270.881792 179.60 89088
+1270.970880 179.60 89088
+1271.059968 179.60 89088
+1271.149056 179.60 89088
+1271.238144 179.60 89088
+1271.327232 179.60 89088
+1271.416320 179.60 89088
+1271.505408 179.60 89088
+1271.594496 179.60 89088
+1271.683584 179.60 89088
+1271.772672 179.60 89088
+1271.861760 179.60 89088
+1271.950848 179.60 89088
+1272.039936 179.60 89088
+1272.129024 179.60 89088
+1272.218112 179.60 89088
+1272.307200 179.60 89088
+1272.396288 179.60 89088
+1272.485376 179.60 89088
+1272.574464 179.60 89088
+1272.663552 179.60 89088
+1272.752640 179.60 89088
+1272.841728 179.60 89088
+1272.930816 179.60 89088
+1273.019904 179.60 89088
+1273.108992 179.60 89088
+1273.198080 179.60 89088
+1273.287168 179.60 89088
+1273.376256 179.60 89088
+1273.465344 179.60 89088
+1273.554432 179.60 89088
+1273.643520 179.60 89088
+1273.732608 179.60 89088
+1273.821696 179.60 89088
+1273.910784 179.60 89088
+1273.999872 179.60 89088
+1274.088960 179.60 89088
+1274.178048 179.60 89088
+1274.267136 179.60 89088
+1274.356224 179.60 89088
+1274.445312 179.60 89088
+1274.534400 179.60 89088
+1274.623488 179.60 89088
+1274.712576 179.60 89088
+1274.801664 179.60 89088
+1274.890752 179.60 89088
+1274.979840 179.60 89088
+1275.068928 179.60 89088
+1275.158016 179.60 89088
+1275.247104 179.60 89088
+1275.336192 179.60 89088
+1275.425280 179.60 89088
+1275.514368 179.60 89088
+1275.603456 179.60 89088
+1275.692544 179.60 89088
+1275.781632 179.60 89088
+1275.870720 179.60 89088
+1275.959808 179.60 89088
+1276.048896 179.60 89088
+1276.137984 179.60 89088
+1276.227072 179.60 89088
+1276.316160 179.60 89088
+1276.405248 179.60 89088
+1276.494336 179.60 89088
+1276.583936 178.57 89600
+1276.673536 178.57 89600
+1276.763136 178.57 89600
+1276.852736 178.57 89600
+1276.942336 178.57 89600
+1277.031936 178.57 89600
+1277.121536 178.57 89600
+1277.211136 178.57 89600
+1277.300736 178.57 89600
+1277.390336 178.57 89600
+1277.479936 178.57 89600
+1277.569536 178.57 89600
+1277.659136 178.57 89600
+1277.748736 178.57 89600
+1277.838336 178.57 89600
+1277.927936 178.57 89600
+1278.017536 178.57 89600
+1278.107136 178.57 89600
+1278.196736 178.57 89600
+1278.286336 178.57 89600
+1278.375936 178.57 89600
+1278.465536 178.57 89600
+1278.555136 178.57 89600
+1278.644736 178.57 89600
+1278.734336 178.57 89600
+1278.823936 178.57 89600
+1278.913536 178.57 89600
+1279.003136 178.57 89600
+1279.092736 178.57 89600
+1279.182336 178.57 89600
+1279.271936 178.57 89600
+1279.361536 178.57 89600
+1279.451648 177.56 90112
+1279.541760 177.56 90112
+1279.631872 177.56 90112
+1279.721984 177.56 90112
+1279.812096 177.56 90112
+1279.902208 177.56 90112
+1279.992320 177.56 90112
+1280.082432 177.56 90112
+1280.172544 177.56 90112
+1280.262656 177.56 90112
+1280.352768 177.56 90112
+1280.442880 177.56 90112
+1280.532992 177.56 90112
+1280.623104 177.56 90112
+1280.713216 177.56 90112
+1280.803328 177.56 90112
+1280.893440 177.56 90112
+1280.983552 177.56 90112
+1281.073664 177.56 90112
+1281.163776 177.56 90112
+1281.253888 177.56 90112
+1281.344000 177.56 90112
+1281.434112 177.56 90112
+1281.524224 177.56 90112
+1281.614336 177.56 90112
+1281.704448 177.56 90112
+1281.794560 177.56 90112
+1281.884672 177.56 90112
+1281.974784 177.56 90112
+1282.064896 177.56 90112
+1282.155008 177.56 90112
+1282.245120 177.56 90112
+1282.335232 177.56 90112
+1282.425344 177.56 90112
+1282.515456 177.56 90112
+1282.605568 177.56 90112
+1282.695680 177.56 90112
+1282.785792 177.56 90112
+1282.875904 177.56 90112
+1282.966016 177.56 90112
+1283.056128 177.56 90112
+1283.146240 177.56 90112
+1283.236352 177.56 90112
+1283.326464 177.56 90112
+1283.416576 177.56 90112
+1283.506688 177.56 90112
+1283.596800 177.56 90112
+1283.686912 177.56 90112
+1283.777536 176.55 90624
+1283.868160 176.55 90624
+1283.958784 176.55 90624
+1284.049408 176.55 90624
+1284.140032 176.55 90624
+1284.230656 176.55 90624
+1284.321280 176.55 90624
+1284.411904 176.55 90624
+1284.502528 176.55 90624
+1284.593152 176.55 90624
+1284.683776 176.55 90624
+1284.774400 176.55 90624
+1284.865024 176.55 90624
+1284.955648 176.55 90624
+1285.046272 176.55 90624
+1285.136896 176.55 90624
+1285.227520 176.55 90624
+1285.318144 176.55 90624
+1285.408768 176.55 90624
+1285.499392 176.55 90624
+1285.590016 176.55 90624
+1285.680640 176.55 90624
+1285.771264 176.55 90624
+1285.861888 176.55 90624
+1285.952512 176.55 90624
+1286.043136 176.55 90624
+1286.133760 176.55 90624
+1286.224384 176.55 90624
+1286.315008 176.55 90624
+1286.405632 176.55 90624
+1286.496256 176.55 90624
+1286.586880 176.55 90624
+1286.678016 175.56 91136
+1286.769152 175.56 91136
+1286.860288 175.56 91136
+1286.951424 175.56 91136
+1287.042560 175.56 91136
+1287.133696 175.56 91136
+1287.224832 175.56 91136
+1287.315968 175.56 91136
+1287.407104 175.56 91136
+1287.498240 175.56 91136
+1287.589376 175.56 91136
+1287.680512 175.56 91136
+1287.771648 175.56 91136
+1287.862784 175.56 91136
+1287.953920 175.56 91136
+1288.045056 175.56 91136
+1288.136192 175.56 91136
+1288.227328 175.56 91136
+1288.318464 175.56 91136
+1288.409600 175.56 91136
+1288.500736 175.56 91136
+1288.591872 175.56 91136
+1288.683008 175.56 91136
+1288.774144 175.56 91136
+1288.865280 175.56 91136
+1288.956416 175.56 91136
+1289.047552 175.56 91136
+1289.138688 175.56 91136
+1289.229824 175.56 91136
+1289.320960 175.56 91136
+1289.412096 175.56 91136
+1289.503232 175.56 91136
+1289.594880 174.58 91648
+1289.686528 174.58 91648
+1289.778176 174.58 91648
+1289.869824 174.58 91648
+1289.961472 174.58 91648
+1290.053120 174.58 91648
+1290.144768 174.58 91648
+1290.236416 174.58 91648
+1290.328064 174.58 91648
+1290.419712 174.58 91648
+1290.511360 174.58 91648
+1290.603008 174.58 91648
+1290.694656 174.58 91648
+1290.786304 174.58 91648
+1290.877952 174.58 91648
+1290.969600 174.58 91648
+1291.061248 174.58 91648
+1291.152896 174.58 91648
+1291.244544 174.58 91648
+1291.336192 174.58 91648
+1291.427840 174.58 91648
+1291.519488 174.58 91648
+1291.611136 174.58 91648
+1291.702784 174.58 91648
+1291.794432 174.58 91648
+1291.886080 174.58 91648
+1291.977728 174.58 91648
+1292.069376 174.58 91648
+1292.161024 174.58 91648
+1292.252672 174.58 91648
+1292.344320 174.58 91648
+1292.435968 174.58 91648
+1292.528128 173.61 92160
+1292.620288 173.61 92160
+1292.712448 173.61 92160
+1292.804608 173.61 92160
+1292.896768 173.61 92160
+1292.988928 173.61 92160
+1293.081088 173.61 92160
+1293.173248 173.61 92160
+1293.265408 173.61 92160
+1293.357568 173.61 92160
+1293.449728 173.61 92160
+1293.541888 173.61 92160
+1293.634048 173.61 92160
+1293.726208 173.61 92160
+1293.818368 173.61 92160
+1293.910528 173.61 92160
+1294.002688 173.61 92160
+1294.094848 173.61 92160
+1294.187008 173.61 92160
+1294.279168 173.61 92160
+1294.371328 173.61 92160
+1294.463488 173.61 92160
+1294.555648 173.61 92160
+1294.647808 173.61 92160
+1294.739968 173.61 92160
+1294.832128 173.61 92160
+1294.924288 173.61 92160
+1295.016448 173.61 92160
+1295.108608 173.61 92160
+1295.200768 173.61 92160
+1295.292928 173.61 92160
+1295.385088 173.61 92160
+1295.477760 172.65 92672
+1295.570432 172.65 92672
+1295.663104 172.65 92672
+1295.755776 172.65 92672
+1295.848448 172.65 92672
+1295.941120 172.65 92672
+1296.033792 172.65 92672
+1296.126464 172.65 92672
+1296.219136 172.65 92672
+1296.311808 172.65 92672
+1296.404480 172.65 92672
+1296.497152 172.65 92672
+1296.589824 172.65 92672
+1296.682496 172.65 92672
+1296.775168 172.65 92672
+1296.867840 172.65 92672
+1296.960512 172.65 92672
+1297.053184 172.65 92672
+1297.145856 172.65 92672
+1297.238528 172.65 92672
+1297.331200 172.65 92672
+1297.423872 172.65 92672
+1297.516544 172.65 92672
+1297.609216 172.65 92672
+1297.701888 172.65 92672
+1297.794560 172.65 92672
+1297.887232 172.65 92672
+1297.979904 172.65 92672
+1298.072576 172.65 92672
+1298.165248 172.65 92672
+1298.257920 172.65 92672
+1298.350592 172.65 92672
+1298.443776 171.70 93184
+1298.536960 171.70 93184
+1298.630144 171.70 93184
+1298.723328 171.70 93184
+1298.816512 171.70 93184
+1298.909696 171.70 93184
+1299.002880 171.70 93184
+1299.096064 171.70 93184
+1299.189248 171.70 93184
+1299.282432 171.70 93184
+1299.375616 171.70 93184
+1299.468800 171.70 93184
+1299.561984 171.70 93184
+1299.655168 171.70 93184
+1299.748352 171.70 93184
+1299.841536 171.70 93184
+1299.934720 171.70 93184
+1300.027904 171.70 93184
+1300.121088 171.70 93184
+1300.214272 171.70 93184
+1300.307456 171.70 93184
+1300.400640 171.70 93184
+1300.493824 171.70 93184
+1300.587008 171.70 93184
+1300.680192 171.70 93184
+1300.773376 171.70 93184
+1300.866560 171.70 93184
+1300.959744 171.70 93184
+1301.052928 171.70 93184
+1301.146112 171.70 93184
+1301.239296 171.70 93184
+1301.332480 171.70 93184
+1301.426176 170.77 93696
+1301.519872 170.77 93696
+1301.613568 170.77 93696
+1301.707264 170.77 93696
+1301.800960 170.77 93696
+1301.894656 170.77 93696
+1301.988352 170.77 93696
+1302.082048 170.77 93696
+1302.175744 170.77 93696
+1302.269440 170.77 93696
+1302.363136 170.77 93696
+1302.456832 170.77 93696
+1302.550528 170.77 93696
+1302.644224 170.77 93696
+1302.737920 170.77 93696
+1302.831616 170.77 93696
+1302.925312 170.77 93696
+1303.019008 170.77 93696
+1303.112704 170.77 93696
+1303.206400 170.77 93696
+1303.300096 170.77 93696
+1303.393792 170.77 93696
+1303.487488 170.77 93696
+1303.581184 170.77 93696
+1303.674880 170.77 93696
+1303.768576 170.77 93696
+1303.862272 170.77 93696
+1303.955968 170.77 93696
+1304.049664 170.77 93696
+1304.143360 170.77 93696
+1304.237056 170.77 93696
+1304.330752 170.77 93696
+1304.424960 169.84 94208
+1304.519168 169.84 94208
+1304.613376 169.84 94208
+1304.707584 169.84 94208
+1304.801792 169.84 94208
+1304.896000 169.84 94208
+1304.990208 169.84 94208
+1305.084416 169.84 94208
+1305.178624 169.84 94208
+1305.272832 169.84 94208
+1305.367040 169.84 94208
+1305.461248 169.84 94208
+1305.555456 169.84 94208
+1305.649664 169.84 94208
+1305.743872 169.84 94208
+1305.838080 169.84 94208
+1305.932288 169.84 94208
+1306.026496 169.84 94208
+1306.120704 169.84 94208
+1306.214912 169.84 94208
+1306.309120 169.84 94208
+1306.403328 169.84 94208
+1306.497536 169.84 94208
+1306.591744 169.84 94208
+1306.685952 169.84 94208
+1306.780160 169.84 94208
+1306.874368 169.84 94208
+1306.968576 169.84 94208
+1307.062784 169.84 94208
+1307.156992 169.84 94208
+1307.251200 169.84 94208
+1307.345408 169.84 94208
+1307.440128 168.92 94720
+1307.534848 168.92 94720
+1307.629568 168.92 94720
+1307.724288 168.92 94720
+1307.819008 168.92 94720
+1307.913728 168.92 94720
+1308.008448 168.92 94720
+1308.103168 168.92 94720
+1308.197888 168.92 94720
+1308.292608 168.92 94720
+1308.387328 168.92 94720
+1308.482048 168.92 94720
+1308.576768 168.92 94720
+1308.671488 168.92 94720
+1308.766208 168.92 94720
+1308.860928 168.92 94720
+1308.955648 168.92 94720
+1309.050368 168.92 94720
+1309.145088 168.92 94720
+1309.239808 168.92 94720
+1309.334528 168.92 94720
+1309.429248 168.92 94720
+1309.523968 168.92 94720
+1309.618688 168.92 94720
+1309.713408 168.92 94720
+1309.808128 168.92 94720
+1309.902848 168.92 94720
+1309.997568 168.92 94720
+1310.092288 168.92 94720
+1310.187008 168.92 94720
+1310.281728 168.92 94720
+1310.376448 168.92 94720
+1310.471680 168.01 95232
+1310.566912 168.01 95232
+1310.662144 168.01 95232
+1310.757376 168.01 95232
+1310.852608 168.01 95232
+1310.947840 168.01 95232
+1311.043072 168.01 95232
+1311.138304 168.01 95232
+1311.233536 168.01 95232
+1311.328768 168.01 95232
+1311.424000 168.01 95232
+1311.519232 168.01 95232
+1311.614464 168.01 95232
+1311.709696 168.01 95232
+1311.804928 168.01 95232
+1311.900160 168.01 95232
+1311.995392 168.01 95232
+1312.090624 168.01 95232
+1312.185856 168.01 95232
+1312.281088 168.01 95232
+1312.376320 168.01 95232
+1312.471552 168.01 95232
+1312.566784 168.01 95232
+1312.662016 168.01 95232
+1312.757248 168.01 95232
+1312.852480 168.01 95232
+1312.947712 168.01 95232
+1313.042944 168.01 95232
+1313.138176 168.01 95232
+1313.233408 168.01 95232
+1313.328640 168.01 95232
+1313.423872 168.01 95232
+1313.519616 167.11 95744
+1313.615360 167.11 95744
+1313.711104 167.11 95744
+1313.806848 167.11 95744
+1313.902592 167.11 95744
+1313.998336 167.11 95744
+1314.094080 167.11 95744
+1314.189824 167.11 95744
+1314.285568 167.11 95744
+1314.381312 167.11 95744
+1314.477056 167.11 95744
+1314.572800 167.11 95744
+1314.668544 167.11 95744
+1314.764288 167.11 95744
+1314.860032 167.11 95744
+1314.955776 167.11 95744
+1315.052032 166.22 96256
+1315.148288 166.22 96256
+1315.244544 166.22 96256
+1315.340800 166.22 96256
+1315.437056 166.22 96256
+1315.533312 166.22 96256
+1315.629568 166.22 96256
+1315.725824 166.22 96256
+1315.822080 166.22 96256
+1315.918336 166.22 96256
+1316.014592 166.22 96256
+1316.110848 166.22 96256
+1316.207104 166.22 96256
+1316.303360 166.22 96256
+1316.399616 166.22 96256
+1316.495872 166.22 96256
+1316.592128 166.22 96256
+1316.688384 166.22 96256
+1316.784640 166.22 96256
+1316.880896 166.22 96256
+1316.977152 166.22 96256
+1317.073408 166.22 96256
+1317.169664 166.22 96256
+1317.265920 166.22 96256
+1317.362176 166.22 96256
+1317.458432 166.22 96256
+1317.554688 166.22 96256
+1317.650944 166.22 96256
+1317.747200 166.22 96256
+1317.843456 166.22 96256
+1317.939712 166.22 96256
+1318.035968 166.22 96256
+1318.132736 165.34 96768
+1318.229504 165.34 96768
+1318.326272 165.34 96768
+1318.423040 165.34 96768
+1318.519808 165.34 96768
+1318.616576 165.34 96768
+1318.713344 165.34 96768
+1318.810112 165.34 96768
+1318.906880 165.34 96768
+1319.003648 165.34 96768
+1319.100416 165.34 96768
+1319.197184 165.34 96768
+1319.293952 165.34 96768
+1319.390720 165.34 96768
+1319.487488 165.34 96768
+1319.584256 165.34 96768
+1319.681024 165.34 96768
+1319.777792 165.34 96768
+1319.874560 165.34 96768
+1319.971328 165.34 96768
+1320.068096 165.34 96768
+1320.164864 165.34 96768
+1320.261632 165.34 96768
+1320.358400 165.34 96768
+1320.455168 165.34 96768
+1320.551936 165.34 96768
+1320.648704 165.34 96768
+1320.745472 165.34 96768
+1320.842240 165.34 96768
+1320.939008 165.34 96768
+1321.035776 165.34 96768
+1321.132544 165.34 96768
+1321.229824 164.47 97280
+1321.327104 164.47 97280
+1321.424384 164.47 97280
+1321.521664 164.47 97280
+1321.618944 164.47 97280
+1321.716224 164.47 97280
+1321.813504 164.47 97280
+1321.910784 164.47 97280
+1322.008064 164.47 97280
+1322.105344 164.47 97280
+1322.202624 164.47 97280
+1322.299904 164.47 97280
+1322.397184 164.47 97280
+1322.494464 164.47 97280
+1322.591744 164.47 97280
+1322.689024 164.47 97280
+1322.786304 164.47 97280
+1322.883584 164.47 97280
+1322.980864 164.47 97280
+1323.078144 164.47 97280
+1323.175424 164.47 97280
+1323.272704 164.47 97280
+1323.369984 164.47 97280
+1323.467264 164.47 97280
+1323.564544 164.47 97280
+1323.661824 164.47 97280
+1323.759104 164.47 97280
+1323.856384 164.47 97280
+1323.953664 164.47 97280
+1324.050944 164.47 97280
+1324.148224 164.47 97280
+1324.245504 164.47 97280
+1324.343296 163.61 97792
+1324.441088 163.61 97792
+1324.538880 163.61 97792
+1324.636672 163.61 97792
+1324.734464 163.61 97792
+1324.832256 163.61 97792
+1324.930048 163.61 97792
+1325.027840 163.61 97792
+1325.125632 163.61 97792
+1325.223424 163.61 97792
+1325.321216 163.61 97792
+1325.419008 163.61 97792
+1325.516800 163.61 97792
+1325.614592 163.61 97792
+1325.712384 163.61 97792
+1325.810176 163.61 97792
+1325.907968 163.61 97792
+1326.005760 163.61 97792
+1326.103552 163.61 97792
+1326.201344 163.61 97792
+1326.299136 163.61 97792
+1326.396928 163.61 97792
+1326.494720 163.61 97792
+1326.592512 163.61 97792
+1326.690304 163.61 97792
+1326.788096 163.61 97792
+1326.885888 163.61 97792
+1326.983680 163.61 97792
+1327.081472 163.61 97792
+1327.179264 163.61 97792
+1327.277056 163.61 97792
+1327.374848 163.61 97792
+1327.473152 162.76 98304
+1327.571456 162.76 98304
+1327.669760 162.76 98304
+1327.768064 162.76 98304
+1327.866368 162.76 98304
+1327.964672 162.76 98304
+1328.062976 162.76 98304
+1328.161280 162.76 98304
+1328.259584 162.76 98304
+1328.357888 162.76 98304
+1328.456192 162.76 98304
+1328.554496 162.76 98304
+1328.652800 162.76 98304
+1328.751104 162.76 98304
+1328.849408 162.76 98304
+1328.947712 162.76 98304
+1329.046016 162.76 98304
+1329.144320 162.76 98304
+1329.242624 162.76 98304
+1329.340928 162.76 98304
+1329.439232 162.76 98304
+1329.537536 162.76 98304
+1329.635840 162.76 98304
+1329.734144 162.76 98304
+1329.832448 162.76 98304
+1329.930752 162.76 98304
+1330.029056 162.76 98304
+1330.127360 162.76 98304
+1330.225664 162.76 98304
+1330.323968 162.76 98304
+1330.422272 162.76 98304
+1330.520576 162.76 98304
+1330.619392 161.92 98816
+1330.718208 161.92 98816
+1330.817024 161.92 98816
+1330.915840 161.92 98816
+1331.014656 161.92 98816
+1331.113472 161.92 98816
+1331.212288 161.92 98816
+1331.311104 161.92 98816
+1331.409920 161.92 98816
+1331.508736 161.92 98816
+1331.607552 161.92 98816
+1331.706368 161.92 98816
+1331.805184 161.92 98816
+1331.904000 161.92 98816
+1332.002816 161.92 98816
+1332.101632 161.92 98816
+1332.200960 161.08 99328
+1332.300288 161.08 99328
+1332.399616 161.08 99328
+1332.498944 161.08 99328
+1332.598272 161.08 99328
+1332.697600 161.08 99328
+1332.796928 161.08 99328
+1332.896256 161.08 99328
+1332.995584 161.08 99328
+1333.094912 161.08 99328
+1333.194240 161.08 99328
+1333.293568 161.08 99328
+1333.392896 161.08 99328
+1333.492224 161.08 99328
+1333.591552 161.08 99328
+1333.690880 161.08 99328
+1333.790208 161.08 99328
+1333.889536 161.08 99328
+1333.988864 161.08 99328
+1334.088192 161.08 99328
+1334.187520 161.08 99328
+1334.286848 161.08 99328
+1334.386176 161.08 99328
+1334.485504 161.08 99328
+1334.584832 161.08 99328
+1334.684160 161.08 99328
+1334.783488 161.08 99328
+1334.882816 161.08 99328
+1334.982144 161.08 99328
+1335.081472 161.08 99328
+1335.180800 161.08 99328
+1335.280128 161.08 99328
+1335.380480 159.44 100352
+1335.480832 159.44 100352
+1335.581184 159.44 100352
+1335.681536 159.44 100352
+1335.781888 159.44 100352
+1335.882240 159.44 100352
+1335.982592 159.44 100352
+1336.082944 159.44 100352
+1336.183296 159.44 100352
+1336.283648 159.44 100352
+1336.384000 159.44 100352
+1336.484352 159.44 100352
+1336.584704 159.44 100352
+1336.685056 159.44 100352
+1336.785408 159.44 100352
+1336.885760 159.44 100352
+1336.986112 159.44 100352
+1337.086464 159.44 100352
+1337.186816 159.44 100352
+1337.287168 159.44 100352
+1337.387520 159.44 100352
+1337.487872 159.44 100352
+1337.588224 159.44 100352
+1337.688576 159.44 100352
+1337.788928 159.44 100352
+1337.889280 159.44 100352
+1337.989632 159.44 100352
+1338.089984 159.44 100352
+1338.190336 159.44 100352
+1338.290688 159.44 100352
+1338.391040 159.44 100352
+1338.491392 159.44 100352
+1338.592256 158.63 100864
+1338.693120 158.63 100864
+1338.793984 158.63 100864
+1338.894848 158.63 100864
+1338.995712 158.63 100864
+1339.096576 158.63 100864
+1339.197440 158.63 100864
+1339.298304 158.63 100864
+1339.399168 158.63 100864
+1339.500032 158.63 100864
+1339.600896 158.63 100864
+1339.701760 158.63 100864
+1339.802624 158.63 100864
+1339.903488 158.63 100864
+1340.004352 158.63 100864
+1340.105216 158.63 100864
+1340.206080 158.63 100864
+1340.306944 158.63 100864
+1340.407808 158.63 100864
+1340.508672 158.63 100864
+1340.609536 158.63 100864
+1340.710400 158.63 100864
+1340.811264 158.63 100864
+1340.912128 158.63 100864
+1341.012992 158.63 100864
+1341.113856 158.63 100864
+1341.214720 158.63 100864
+1341.315584 158.63 100864
+1341.416448 158.63 100864
+1341.517312 158.63 100864
+1341.618176 158.63 100864
+1341.719040 158.63 100864
+1341.820416 157.83 101376
+1341.921792 157.83 101376
+1342.023168 157.83 101376
+1342.124544 157.83 101376
+1342.225920 157.83 101376
+1342.327296 157.83 101376
+1342.428672 157.83 101376
+1342.530048 157.83 101376
+1342.631424 157.83 101376
+1342.732800 157.83 101376
+1342.834176 157.83 101376
+1342.935552 157.83 101376
+1343.036928 157.83 101376
+1343.138304 157.83 101376
+1343.239680 157.83 101376
+1343.341056 157.83 101376
+1343.442944 157.04 101888
+1343.544832 157.04 101888
+1343.646720 157.04 101888
+1343.748608 157.04 101888
+1343.850496 157.04 101888
+1343.952384 157.04 101888
+1344.054272 157.04 101888
+1344.156160 157.04 101888
+1344.258048 157.04 101888
+1344.359936 157.04 101888
+1344.461824 157.04 101888
+1344.563712 157.04 101888
+1344.665600 157.04 101888
+1344.767488 157.04 101888
+1344.869376 157.04 101888
+1344.971264 157.04 101888
+1345.073152 157.04 101888
+1345.175040 157.04 101888
+1345.276928 157.04 101888
+1345.378816 157.04 101888
+1345.480704 157.04 101888
+1345.582592 157.04 101888
+1345.684480 157.04 101888
+1345.786368 157.04 101888
+1345.888256 157.04 101888
+1345.990144 157.04 101888
+1346.092032 157.04 101888
+1346.193920 157.04 101888
+1346.295808 157.04 101888
+1346.397696 157.04 101888
+1346.499584 157.04 101888
+1346.601472 157.04 101888
+1346.703872 156.25 102400
+1346.806272 156.25 102400
+1346.908672 156.25 102400
+1347.011072 156.25 102400
+1347.113472 156.25 102400
+1347.215872 156.25 102400
+1347.318272 156.25 102400
+1347.420672 156.25 102400
+1347.523072 156.25 102400
+1347.625472 156.25 102400
+1347.727872 156.25 102400
+1347.830272 156.25 102400
+1347.932672 156.25 102400
+1348.035072 156.25 102400
+1348.137472 156.25 102400
+1348.239872 156.25 102400
+1348.342272 156.25 102400
+1348.444672 156.25 102400
+1348.547072 156.25 102400
+1348.649472 156.25 102400
+1348.751872 156.25 102400
+1348.854272 156.25 102400
+1348.956672 156.25 102400
+1349.059072 156.25 102400
+1349.161472 156.25 102400
+1349.263872 156.25 102400
+1349.366272 156.25 102400
+1349.468672 156.25 102400
+1349.571072 156.25 102400
+1349.673472 156.25 102400
+1349.775872 156.25 102400
+1349.878272 156.25 102400
+1349.981184 155.47 102912
+1350.084096 155.47 102912
+1350.187008 155.47 102912
+1350.289920 155.47 102912
+1350.392832 155.47 102912
+1350.495744 155.47 102912
+1350.598656 155.47 102912
+1350.701568 155.47 102912
+1350.804480 155.47 102912
+1350.907392 155.47 102912
+1351.010304 155.47 102912
+1351.113216 155.47 102912
+1351.216128 155.47 102912
+1351.319040 155.47 102912
+1351.421952 155.47 102912
+1351.524864 155.47 102912
+1351.628288 154.70 103424
+1351.731712 154.70 103424
+1351.835136 154.70 103424
+1351.938560 154.70 103424
+1352.041984 154.70 103424
+1352.145408 154.70 103424
+1352.248832 154.70 103424
+1352.352256 154.70 103424
+1352.455680 154.70 103424
+1352.559104 154.70 103424
+1352.662528 154.70 103424
+1352.765952 154.70 103424
+1352.869376 154.70 103424
+1352.972800 154.70 103424
+1353.076224 154.70 103424
+1353.179648 154.70 103424
+1353.283072 154.70 103424
+1353.386496 154.70 103424
+1353.489920 154.70 103424
+1353.593344 154.70 103424
+1353.696768 154.70 103424
+1353.800192 154.70 103424
+1353.903616 154.70 103424
+1354.007040 154.70 103424
+1354.110464 154.70 103424
+1354.213888 154.70 103424
+1354.317312 154.70 103424
+1354.420736 154.70 103424
+1354.524160 154.70 103424
+1354.627584 154.70 103424
+1354.731008 154.70 103424
+1354.834432 154.70 103424
+1354.938368 153.94 103936
+1355.042304 153.94 103936
+1355.146240 153.94 103936
+1355.250176 153.94 103936
+1355.354112 153.94 103936
+1355.458048 153.94 103936
+1355.561984 153.94 103936
+1355.665920 153.94 103936
+1355.769856 153.94 103936
+1355.873792 153.94 103936
+1355.977728 153.94 103936
+1356.081664 153.94 103936
+1356.185600 153.94 103936
+1356.289536 153.94 103936
+1356.393472 153.94 103936
+1356.497408 153.94 103936
+1356.601856 153.19 104448
+1356.706304 153.19 104448
+1356.810752 153.19 104448
+1356.915200 153.19 104448
+1357.019648 153.19 104448
+1357.124096 153.19 104448
+1357.228544 153.19 104448
+1357.332992 153.19 104448
+1357.437440 153.19 104448
+1357.541888 153.19 104448
+1357.646336 153.19 104448
+1357.750784 153.19 104448
+1357.855232 153.19 104448
+1357.959680 153.19 104448
+1358.064128 153.19 104448
+1358.168576 153.19 104448
+1358.273024 153.19 104448
+1358.377472 153.19 104448
+1358.481920 153.19 104448
+1358.586368 153.19 104448
+1358.690816 153.19 104448
+1358.795264 153.19 104448
+1358.899712 153.19 104448
+1359.004160 153.19 104448
+1359.108608 153.19 104448
+1359.213056 153.19 104448
+1359.317504 153.19 104448
+1359.421952 153.19 104448
+1359.526400 153.19 104448
+1359.630848 153.19 104448
+1359.735296 153.19 104448
+1359.839744 153.19 104448
+1359.944704 152.44 104960
+1360.049664 152.44 104960
+1360.154624 152.44 104960
+1360.259584 152.44 104960
+1360.364544 152.44 104960
+1360.469504 152.44 104960
+1360.574464 152.44 104960
+1360.679424 152.44 104960
+1360.784384 152.44 104960
+1360.889344 152.44 104960
+1360.994304 152.44 104960
+1361.099264 152.44 104960
+1361.204224 152.44 104960
+1361.309184 152.44 104960
+1361.414144 152.44 104960
+1361.519104 152.44 104960
+1361.624064 152.44 104960
+1361.729024 152.44 104960
+1361.833984 152.44 104960
+1361.938944 152.44 104960
+1362.043904 152.44 104960
+1362.148864 152.44 104960
+1362.253824 152.44 104960
+1362.358784 152.44 104960
+1362.463744 152.44 104960
+1362.568704 152.44 104960
+1362.673664 152.44 104960
+1362.778624 152.44 104960
+1362.883584 152.44 104960
+1362.988544 152.44 104960
+1363.093504 152.44 104960
+1363.198464 152.44 104960
+1363.303936 151.70 105472
+1363.409408 151.70 105472
+1363.514880 151.70 105472
+1363.620352 151.70 105472
+1363.725824 151.70 105472
+1363.831296 151.70 105472
+1363.936768 151.70 105472
+1364.042240 151.70 105472
+1364.147712 151.70 105472
+1364.253184 151.70 105472
+1364.358656 151.70 105472
+1364.464128 151.70 105472
+1364.569600 151.70 105472
+1364.675072 151.70 105472
+1364.780544 151.70 105472
+1364.886016 151.70 105472
+1364.992512 150.24 106496
+1365.099008 150.24 106496
+1365.205504 150.24 106496
+1365.312000 150.24 106496
+1365.418496 150.24 106496
+1365.524992 150.24 106496
+1365.631488 150.24 106496
+1365.737984 150.24 106496
+1365.844480 150.24 106496
+1365.950976 150.24 106496
+1366.057472 150.24 106496
+1366.163968 150.24 106496
+1366.270464 150.24 106496
+1366.376960 150.24 106496
+1366.483456 150.24 106496
+1366.589952 150.24 106496
+1366.696448 150.24 106496
+1366.802944 150.24 106496
+1366.909440 150.24 106496
+1367.015936 150.24 106496
+1367.122432 150.24 106496
+1367.228928 150.24 106496
+1367.335424 150.24 106496
+1367.441920 150.24 106496
+1367.548416 150.24 106496
+1367.654912 150.24 106496
+1367.761408 150.24 106496
+1367.867904 150.24 106496
+1367.974400 150.24 106496
+1368.080896 150.24 106496
+1368.187392 150.24 106496
+1368.293888 150.24 106496
+1368.400896 149.52 107008
+1368.507904 149.52 107008
+1368.614912 149.52 107008
+1368.721920 149.52 107008
+1368.828928 149.52 107008
+1368.935936 149.52 107008
+1369.042944 149.52 107008
+1369.149952 149.52 107008
+1369.256960 149.52 107008
+1369.363968 149.52 107008
+1369.470976 149.52 107008
+1369.577984 149.52 107008
+1369.684992 149.52 107008
+1369.792000 149.52 107008
+1369.899008 149.52 107008
+1370.006016 149.52 107008
+1370.113536 148.81 107520
+1370.221056 148.81 107520
+1370.328576 148.81 107520
+1370.436096 148.81 107520
+1370.543616 148.81 107520
+1370.651136 148.81 107520
+1370.758656 148.81 107520
+1370.866176 148.81 107520
+1370.973696 148.81 107520
+1371.081216 148.81 107520
+1371.188736 148.81 107520
+1371.296256 148.81 107520
+1371.403776 148.81 107520
+1371.511296 148.81 107520
+1371.618816 148.81 107520
+1371.726336 148.81 107520
+1371.833856 148.81 107520
+1371.941376 148.81 107520
+1372.048896 148.81 107520
+1372.156416 148.81 107520
+1372.263936 148.81 107520
+1372.371456 148.81 107520
+1372.478976 148.81 107520
+1372.586496 148.81 107520
+1372.694016 148.81 107520
+1372.801536 148.81 107520
+1372.909056 148.81 107520
+1373.016576 148.81 107520
+1373.124096 148.81 107520
+1373.231616 148.81 107520
+1373.339136 148.81 107520
+1373.446656 148.81 107520
+1373.554688 148.10 108032
+1373.662720 148.10 108032
+1373.770752 148.10 108032
+1373.878784 148.10 108032
+1373.986816 148.10 108032
+1374.094848 148.10 108032
+1374.202880 148.10 108032
+1374.310912 148.10 108032
+1374.418944 148.10 108032
+1374.526976 148.10 108032
+1374.635008 148.10 108032
+1374.743040 148.10 108032
+1374.851072 148.10 108032
+1374.959104 148.10 108032
+1375.067136 148.10 108032
+1375.175168 148.10 108032
+1375.283712 147.41 108544
+1375.392256 147.41 108544
+1375.500800 147.41 108544
+1375.609344 147.41 108544
+1375.717888 147.41 108544
+1375.826432 147.41 108544
+1375.934976 147.41 108544
+1376.043520 147.41 108544
+1376.152064 147.41 108544
+1376.260608 147.41 108544
+1376.369152 147.41 108544
+1376.477696 147.41 108544
+1376.586240 147.41 108544
+1376.694784 147.41 108544
+1376.803328 147.41 108544
+1376.911872 147.41 108544
+1377.020416 147.41 108544
+1377.128960 147.41 108544
+1377.237504 147.41 108544
+1377.346048 147.41 108544
+1377.454592 147.41 108544
+1377.563136 147.41 108544
+1377.671680 147.41 108544
+1377.780224 147.41 108544
+1377.888768 147.41 108544
+1377.997312 147.41 108544
+1378.105856 147.41 108544
+1378.214400 147.41 108544
+1378.322944 147.41 108544
+1378.431488 147.41 108544
+1378.540032 147.41 108544
+1378.648576 147.41 108544
+1378.757632 146.71 109056
+1378.866688 146.71 109056
+1378.975744 146.71 109056
+1379.084800 146.71 109056
+1379.193856 146.71 109056
+1379.302912 146.71 109056
+1379.411968 146.71 109056
+1379.521024 146.71 109056
+1379.630080 146.71 109056
+1379.739136 146.71 109056
+1379.848192 146.71 109056
+1379.957248 146.71 109056
+1380.066304 146.71 109056
+1380.175360 146.71 109056
+1380.284416 146.71 109056
+1380.393472 146.71 109056
+1380.503040 146.03 109568
+1380.612608 146.03 109568
+1380.722176 146.03 109568
+1380.831744 146.03 109568
+1380.941312 146.03 109568
+1381.050880 146.03 109568
+1381.160448 146.03 109568
+1381.270016 146.03 109568
+1381.379584 146.03 109568
+1381.489152 146.03 109568
+1381.598720 146.03 109568
+1381.708288 146.03 109568
+1381.817856 146.03 109568
+1381.927424 146.03 109568
+1382.036992 146.03 109568
+1382.146560 146.03 109568
+1382.256128 146.03 109568
+1382.365696 146.03 109568
+1382.475264 146.03 109568
+1382.584832 146.03 109568
+1382.694400 146.03 109568
+1382.803968 146.03 109568
+1382.913536 146.03 109568
+1383.023104 146.03 109568
+1383.132672 146.03 109568
+1383.242240 146.03 109568
+1383.351808 146.03 109568
+1383.461376 146.03 109568
+1383.570944 146.03 109568
+1383.680512 146.03 109568
+1383.790080 146.03 109568
+1383.899648 146.03 109568
+1384.010240 144.68 110592
+1384.120832 144.68 110592
+1384.231424 144.68 110592
+1384.342016 144.68 110592
+1384.452608 144.68 110592
+1384.563200 144.68 110592
+1384.673792 144.68 110592
+1384.784384 144.68 110592
+1384.894976 144.68 110592
+1385.005568 144.68 110592
+1385.116160 144.68 110592
+1385.226752 144.68 110592
+1385.337344 144.68 110592
+1385.447936 144.68 110592
+1385.558528 144.68 110592
+1385.669120 144.68 110592
+1385.780224 144.01 111104
+1385.891328 144.01 111104
+1386.002432 144.01 111104
+1386.113536 144.01 111104
+1386.224640 144.01 111104
+1386.335744 144.01 111104
+1386.446848 144.01 111104
+1386.557952 144.01 111104
+1386.669056 144.01 111104
+1386.780160 144.01 111104
+1386.891264 144.01 111104
+1387.002368 144.01 111104
+1387.113472 144.01 111104
+1387.224576 144.01 111104
+1387.335680 144.01 111104
+1387.446784 144.01 111104
+1387.558400 143.35 111616
+1387.670016 143.35 111616
+1387.781632 143.35 111616
+1387.893248 143.35 111616
+1388.004864 143.35 111616
+1388.116480 143.35 111616
+1388.228096 143.35 111616
+1388.339712 143.35 111616
+1388.451328 143.35 111616
+1388.562944 143.35 111616
+1388.674560 143.35 111616
+1388.786176 143.35 111616
+1388.897792 143.35 111616
+1389.009408 143.35 111616
+1389.121024 143.35 111616
+1389.232640 143.35 111616
+1389.344256 143.35 111616
+1389.455872 143.35 111616
+1389.567488 143.35 111616
+1389.679104 143.35 111616
+1389.790720 143.35 111616
+1389.902336 143.35 111616
+1390.013952 143.35 111616
+1390.125568 143.35 111616
+1390.237184 143.35 111616
+1390.348800 143.35 111616
+1390.460416 143.35 111616
+1390.572032 143.35 111616
+1390.683648 143.35 111616
+1390.795264 143.35 111616
+1390.906880 143.35 111616
+1391.018496 143.35 111616
+1391.130624 142.69 112128
+1391.242752 142.69 112128
+1391.354880 142.69 112128
+1391.467008 142.69 112128
+1391.579136 142.69 112128
+1391.691264 142.69 112128
+1391.803392 142.69 112128
+1391.915520 142.69 112128
+1392.027648 142.69 112128
+1392.139776 142.69 112128
+1392.251904 142.69 112128
+1392.364032 142.69 112128
+1392.476160 142.69 112128
+1392.588288 142.69 112128
+1392.700416 142.69 112128
+1392.812544 142.69 112128
+1392.924672 142.69 112128
+1393.036800 142.69 112128
+1393.148928 142.69 112128
+1393.261056 142.69 112128
+1393.373184 142.69 112128
+1393.485312 142.69 112128
+1393.597440 142.69 112128
+1393.709568 142.69 112128
+1393.822208 142.05 112640
+1393.934848 142.05 112640
+1394.047488 142.05 112640
+1394.160128 142.05 112640
+1394.272768 142.05 112640
+1394.385408 142.05 112640
+1394.498048 142.05 112640
+1394.610688 142.05 112640
+1394.723328 142.05 112640
+1394.835968 142.05 112640
+1394.948608 142.05 112640
+1395.061248 142.05 112640
+1395.173888 142.05 112640
+1395.286528 142.05 112640
+1395.399168 142.05 112640
+1395.511808 142.05 112640
+1395.624960 141.40 113152
+1395.738112 141.40 113152
+1395.851264 141.40 113152
+1395.964416 141.40 113152
+1396.077568 141.40 113152
+1396.190720 141.40 113152
+1396.303872 141.40 113152
+1396.417024 141.40 113152
+1396.530176 141.40 113152
+1396.643328 141.40 113152
+1396.756480 141.40 113152
+1396.869632 141.40 113152
+1396.982784 141.40 113152
+1397.095936 141.40 113152
+1397.209088 141.40 113152
+1397.322240 141.40 113152
+1397.435392 141.40 113152
+1397.548544 141.40 113152
+1397.661696 141.40 113152
+1397.774848 141.40 113152
+1397.888000 141.40 113152
+1398.001152 141.40 113152
+1398.114304 141.40 113152
+1398.227456 141.40 113152
+1398.341632 140.13 114176
+1398.455808 140.13 114176
+1398.569984 140.13 114176
+1398.684160 140.13 114176
+1398.798336 140.13 114176
+1398.912512 140.13 114176
+1399.026688 140.13 114176
+1399.140864 140.13 114176
+1399.255040 140.13 114176
+1399.369216 140.13 114176
+1399.483392 140.13 114176
+1399.597568 140.13 114176
+1399.711744 140.13 114176
+1399.825920 140.13 114176
+1399.940096 140.13 114176
+1400.054272 140.13 114176
+1400.168448 140.13 114176
+1400.282624 140.13 114176
+1400.396800 140.13 114176
+1400.510976 140.13 114176
+1400.625152 140.13 114176
+1400.739328 140.13 114176
+1400.853504 140.13 114176
+1400.967680 140.13 114176
+1401.082368 139.51 114688
+1401.197056 139.51 114688
+1401.311744 139.51 114688
+1401.426432 139.51 114688
+1401.541120 139.51 114688
+1401.655808 139.51 114688
+1401.770496 139.51 114688
+1401.885184 139.51 114688
+1401.999872 139.51 114688
+1402.114560 139.51 114688
+1402.229248 139.51 114688
+1402.343936 139.51 114688
+1402.458624 139.51 114688
+1402.573312 139.51 114688
+1402.688000 139.51 114688
+1402.802688 139.51 114688
+1402.917888 138.89 115200
+1403.033088 138.89 115200
+1403.148288 138.89 115200
+1403.263488 138.89 115200
+1403.378688 138.89 115200
+1403.493888 138.89 115200
+1403.609088 138.89 115200
+1403.724288 138.89 115200
+1403.839488 138.89 115200
+1403.954688 138.89 115200
+1404.069888 138.89 115200
+1404.185088 138.89 115200
+1404.300288 138.89 115200
+1404.415488 138.89 115200
+1404.530688 138.89 115200
+1404.645888 138.89 115200
+1404.761088 138.89 115200
+1404.876288 138.89 115200
+1404.991488 138.89 115200
+1405.106688 138.89 115200
+1405.221888 138.89 115200
+1405.337088 138.89 115200
+1405.452288 138.89 115200
+1405.567488 138.89 115200
+1405.683200 138.27 115712
+1405.798912 138.27 115712
+1405.914624 138.27 115712
+1406.030336 138.27 115712
+1406.146048 138.27 115712
+1406.261760 138.27 115712
+1406.377472 138.27 115712
+1406.493184 138.27 115712
+1406.608896 138.27 115712
+1406.724608 138.27 115712
+1406.840320 138.27 115712
+1406.956032 138.27 115712
+1407.071744 138.27 115712
+1407.187456 138.27 115712
+1407.303168 138.27 115712
+1407.418880 138.27 115712
+1407.535616 137.06 116736
+1407.652352 137.06 116736
+1407.769088 137.06 116736
+1407.885824 137.06 116736
+1408.002560 137.06 116736
+1408.119296 137.06 116736
+1408.236032 137.06 116736
+1408.352768 137.06 116736
+1408.469504 137.06 116736
+1408.586240 137.06 116736
+1408.702976 137.06 116736
+1408.819712 137.06 116736
+1408.936448 137.06 116736
+1409.053184 137.06 116736
+1409.169920 137.06 116736
+1409.286656 137.06 116736
+1409.403392 137.06 116736
+1409.520128 137.06 116736
+1409.636864 137.06 116736
+1409.753600 137.06 116736
+1409.870336 137.06 116736
+1409.987072 137.06 116736
+1410.103808 137.06 116736
+1410.220544 137.06 116736
+1410.337792 136.46 117248
+1410.455040 136.46 117248
+1410.572288 136.46 117248
+1410.689536 136.46 117248
+1410.806784 136.46 117248
+1410.924032 136.46 117248
+1411.041280 136.46 117248
+1411.158528 136.46 117248
+1411.275776 136.46 117248
+1411.393024 136.46 117248
+1411.510272 136.46 117248
+1411.627520 136.46 117248
+1411.744768 136.46 117248
+1411.862016 136.46 117248
+1411.979264 136.46 117248
+1412.096512 136.46 117248
+1412.213760 136.46 117248
+1412.331008 136.46 117248
+1412.448256 136.46 117248
+1412.565504 136.46 117248
+1412.682752 136.46 117248
+1412.800000 136.46 117248
+1412.917248 136.46 117248
+1413.034496 136.46 117248
+1413.152256 135.87 117760
+1413.270016 135.87 117760
+1413.387776 135.87 117760
+1413.505536 135.87 117760
+1413.623296 135.87 117760
+1413.741056 135.87 117760
+1413.858816 135.87 117760
+1413.976576 135.87 117760
+1414.094336 135.87 117760
+1414.212096 135.87 117760
+1414.329856 135.87 117760
+1414.447616 135.87 117760
+1414.565376 135.87 117760
+1414.683136 135.87 117760
+1414.800896 135.87 117760
+1414.918656 135.87 117760
+1415.036928 135.28 118272
+1415.155200 135.28 118272
+1415.273472 135.28 118272
+1415.391744 135.28 118272
+1415.510016 135.28 118272
+1415.628288 135.28 118272
+1415.746560 135.28 118272
+1415.864832 135.28 118272
+1415.983104 135.28 118272
+1416.101376 135.28 118272
+1416.219648 135.28 118272
+1416.337920 135.28 118272
+1416.456192 135.28 118272
+1416.574464 135.28 118272
+1416.692736 135.28 118272
+1416.811008 135.28 118272
+1416.929280 135.28 118272
+1417.047552 135.28 118272
+1417.165824 135.28 118272
+1417.284096 135.28 118272
+1417.402368 135.28 118272
+1417.520640 135.28 118272
+1417.638912 135.28 118272
+1417.757184 135.28 118272
+1417.876480 134.12 119296
+1417.995776 134.12 119296
+1418.115072 134.12 119296
+1418.234368 134.12 119296
+1418.353664 134.12 119296
+1418.472960 134.12 119296
+1418.592256 134.12 119296
+1418.711552 134.12 119296
+1418.830848 134.12 119296
+1418.950144 134.12 119296
+1419.069440 134.12 119296
+1419.188736 134.12 119296
+1419.308032 134.12 119296
+1419.427328 134.12 119296
+1419.546624 134.12 119296
+1419.665920 134.12 119296
+1419.785728 133.55 119808
+1419.905536 133.55 119808
+1420.025344 133.55 119808
+1420.145152 133.55 119808
+1420.264960 133.55 119808
+1420.384768 133.55 119808
+1420.504576 133.55 119808
+1420.624384 133.55 119808
+1420.744192 133.55 119808
+1420.864000 133.55 119808
+1420.983808 133.55 119808
+1421.103616 133.55 119808
+1421.223424 133.55 119808
+1421.343232 133.55 119808
+1421.463040 133.55 119808
+1421.582848 133.55 119808
+1421.703168 132.98 120320
+1421.823488 132.98 120320
+1421.943808 132.98 120320
+1422.064128 132.98 120320
+1422.184448 132.98 120320
+1422.304768 132.98 120320
+1422.425088 132.98 120320
+1422.545408 132.98 120320
+1422.665728 132.98 120320
+1422.786048 132.98 120320
+1422.906368 132.98 120320
+1423.026688 132.98 120320
+1423.147008 132.98 120320
+1423.267328 132.98 120320
+1423.387648 132.98 120320
+1423.507968 132.98 120320
+1423.628288 132.98 120320
+1423.748608 132.98 120320
+1423.868928 132.98 120320
+1423.989248 132.98 120320
+1424.109568 132.98 120320
+1424.229888 132.98 120320
+1424.350208 132.98 120320
+1424.470528 132.98 120320
+1424.591360 132.42 120832
+1424.712192 132.42 120832
+1424.833024 132.42 120832
+1424.953856 132.42 120832
+1425.074688 132.42 120832
+1425.195520 132.42 120832
+1425.316352 132.42 120832
+1425.437184 132.42 120832
+1425.558016 132.42 120832
+1425.678848 132.42 120832
+1425.799680 132.42 120832
+1425.920512 132.42 120832
+1426.041344 132.42 120832
+1426.162176 132.42 120832
+1426.283008 132.42 120832
+1426.403840 132.42 120832
+1426.525696 131.30 121856
+1426.647552 131.30 121856
+1426.769408 131.30 121856
+1426.891264 131.30 121856
+1427.013120 131.30 121856
+1427.134976 131.30 121856
+1427.256832 131.30 121856
+1427.378688 131.30 121856
+1427.500544 131.30 121856
+1427.622400 131.30 121856
+1427.744256 131.30 121856
+1427.866112 131.30 121856
+1427.987968 131.30 121856
+1428.109824 131.30 121856
+1428.231680 131.30 121856
+1428.353536 131.30 121856
+1428.475392 131.30 121856
+1428.597248 131.30 121856
+1428.719104 131.30 121856
+1428.840960 131.30 121856
+1428.962816 131.30 121856
+1429.084672 131.30 121856
+1429.206528 131.30 121856
+1429.328384 131.30 121856
+1429.450752 130.75 122368
+1429.573120 130.75 122368
+1429.695488 130.75 122368
+1429.817856 130.75 122368
+1429.940224 130.75 122368
+1430.062592 130.75 122368
+1430.184960 130.75 122368
+1430.307328 130.75 122368
+1430.429696 130.75 122368
+1430.552064 130.75 122368
+1430.674432 130.75 122368
+1430.796800 130.75 122368
+1430.919168 130.75 122368
+1431.041536 130.75 122368
+1431.163904 130.75 122368
+1431.286272 130.75 122368
+1431.409152 130.21 122880
+1431.532032 130.21 122880
+1431.654912 130.21 122880
+1431.777792 130.21 122880
+1431.900672 130.21 122880
+1432.023552 130.21 122880
+1432.146432 130.21 122880
+1432.269312 130.21 122880
+1432.392192 130.21 122880
+1432.515072 130.21 122880
+1432.637952 130.21 122880
+1432.760832 130.21 122880
+1432.883712 130.21 122880
+1433.006592 130.21 122880
+1433.129472 130.21 122880
+1433.252352 130.21 122880
+1433.376256 129.13 123904
+1433.500160 129.13 123904
+1433.624064 129.13 123904
+1433.747968 129.13 123904
+1433.871872 129.13 123904
+1433.995776 129.13 123904
+1434.119680 129.13 123904
+1434.243584 129.13 123904
+1434.367488 129.13 123904
+1434.491392 129.13 123904
+1434.615296 129.13 123904
+1434.739200 129.13 123904
+1434.863104 129.13 123904
+1434.987008 129.13 123904
+1435.110912 129.13 123904
+1435.234816 129.13 123904
+1435.359232 128.60 124416
+1435.483648 128.60 124416
+1435.608064 128.60 124416
+1435.732480 128.60 124416
+1435.856896 128.60 124416
+1435.981312 128.60 124416
+1436.105728 128.60 124416
+1436.230144 128.60 124416
+1436.354560 128.60 124416
+1436.478976 128.60 124416
+1436.603392 128.60 124416
+1436.727808 128.60 124416
+1436.852224 128.60 124416
+1436.976640 128.60 124416
+1437.101056 128.60 124416
+1437.225472 128.60 124416
+1437.349888 128.60 124416
+1437.474304 128.60 124416
+1437.598720 128.60 124416
+1437.723136 128.60 124416
+1437.847552 128.60 124416
+1437.971968 128.60 124416
+1438.096384 128.60 124416
+1438.220800 128.60 124416
+1438.345728 128.07 124928
+1438.470656 128.07 124928
+1438.595584 128.07 124928
+1438.720512 128.07 124928
+1438.845440 128.07 124928
+1438.970368 128.07 124928
+1439.095296 128.07 124928
+1439.220224 128.07 124928
+1439.345152 128.07 124928
+1439.470080 128.07 124928
+1439.595008 128.07 124928
+1439.719936 128.07 124928
+1439.844864 128.07 124928
+1439.969792 128.07 124928
+1440.094720 128.07 124928
+1440.219648 128.07 124928
+1440.345600 127.03 125952
+1440.471552 127.03 125952
+1440.597504 127.03 125952
+1440.723456 127.03 125952
+1440.849408 127.03 125952
+1440.975360 127.03 125952
+1441.101312 127.03 125952
+1441.227264 127.03 125952
+1441.353216 127.03 125952
+1441.479168 127.03 125952
+1441.605120 127.03 125952
+1441.731072 127.03 125952
+1441.857024 127.03 125952
+1441.982976 127.03 125952
+1442.108928 127.03 125952
+1442.234880 127.03 125952
+1442.361344 126.52 126464
+1442.487808 126.52 126464
+1442.614272 126.52 126464
+1442.740736 126.52 126464
+1442.867200 126.52 126464
+1442.993664 126.52 126464
+1443.120128 126.52 126464
+1443.246592 126.52 126464
+1443.373056 126.52 126464
+1443.499520 126.52 126464
+1443.625984 126.52 126464
+1443.752448 126.52 126464
+1443.878912 126.52 126464
+1444.005376 126.52 126464
+1444.131840 126.52 126464
+1444.258304 126.52 126464
+1444.385280 126.01 126976
+1444.512256 126.01 126976
+1444.639232 126.01 126976
+1444.766208 126.01 126976
+1444.893184 126.01 126976
+1445.020160 126.01 126976
+1445.147136 126.01 126976
+1445.274112 126.01 126976
+1445.401088 126.01 126976
+1445.528064 126.01 126976
+1445.655040 126.01 126976
+1445.782016 126.01 126976
+1445.908992 126.01 126976
+1446.035968 126.01 126976
+1446.162944 126.01 126976
+1446.289920 126.01 126976
+1446.417920 125.00 128000
+1446.545920 125.00 128000
+1446.673920 125.00 128000
+1446.801920 125.00 128000
+1446.929920 125.00 128000
+1447.057920 125.00 128000
+1447.185920 125.00 128000
+1447.313920 125.00 128000
+1447.441920 125.00 128000
+1447.569920 125.00 128000
+1447.697920 125.00 128000
+1447.825920 125.00 128000
+1447.953920 125.00 128000
+1448.081920 125.00 128000
+1448.209920 125.00 128000
+1448.337920 125.00 128000
+1448.465920 125.00 128000
+1448.593920 125.00 128000
+1448.721920 125.00 128000
+1448.849920 125.00 128000
+1448.977920 125.00 128000
+1449.105920 125.00 128000
+1449.233920 125.00 128000
+1449.361920 125.00 128000
+1449.490432 124.50 128512
+1449.618944 124.50 128512
+1449.747456 124.50 128512
+1449.875968 124.50 128512
+1450.004480 124.50 128512
+1450.132992 124.50 128512
+1450.261504 124.50 128512
+1450.390016 124.50 128512
+1450.518528 124.50 128512
+1450.647040 124.50 128512
+1450.775552 124.50 128512
+1450.904064 124.50 128512
+1451.032576 124.50 128512
+1451.161088 124.50 128512
+1451.289600 124.50 128512
+1451.418112 124.50 128512
+1451.547136 124.01 129024
+1451.676160 124.01 129024
+1451.805184 124.01 129024
+1451.934208 124.01 129024
+1452.063232 124.01 129024
+1452.192256 124.01 129024
+1452.321280 124.01 129024
+1452.450304 124.01 129024
+1452.579328 124.01 129024
+1452.708352 124.01 129024
+1452.837376 124.01 129024
+1452.966400 124.01 129024
+1453.095424 124.01 129024
+1453.224448 124.01 129024
+1453.353472 124.01 129024
+1453.482496 124.01 129024
+1453.612544 123.03 130048
+1453.742592 123.03 130048
+1453.872640 123.03 130048
+1454.002688 123.03 130048
+1454.132736 123.03 130048
+1454.262784 123.03 130048
+1454.392832 123.03 130048
+1454.522880 123.03 130048
+1454.652928 123.03 130048
+1454.782976 123.03 130048
+1454.913024 123.03 130048
+1455.043072 123.03 130048
+1455.173120 123.03 130048
+1455.303168 123.03 130048
+1455.433216 123.03 130048
+1455.563264 123.03 130048
+1455.693824 122.55 130560
+1455.824384 122.55 130560
+1455.954944 122.55 130560
+1456.085504 122.55 130560
+1456.216064 122.55 130560
+1456.346624 122.55 130560
+1456.477184 122.55 130560
+1456.607744 122.55 130560
+1456.738304 122.55 130560
+1456.868864 122.55 130560
+1456.999424 122.55 130560
+1457.129984 122.55 130560
+1457.260544 122.55 130560
+1457.391104 122.55 130560
+1457.521664 122.55 130560
+1457.652224 122.55 130560
+1457.783296 122.07 131072
+1457.914368 122.07 131072
+1458.045440 122.07 131072
+1458.176512 122.07 131072
+1458.307584 122.07 131072
+1458.438656 122.07 131072
+1458.569728 122.07 131072
+1458.700800 122.07 131072
+1458.831872 122.07 131072
+1458.962944 122.07 131072
+1459.094016 122.07 131072
+1459.225088 122.07 131072
+1459.356160 122.07 131072
+1459.487232 122.07 131072
+1459.618304 122.07 131072
+1459.749376 122.07 131072
+1459.881472 121.12 132096
+1460.013568 121.12 132096
+1460.145664 121.12 132096
+1460.277760 121.12 132096
+1460.409856 121.12 132096
+1460.541952 121.12 132096
+1460.674048 121.12 132096
+1460.806144 121.12 132096
+1460.938240 121.12 132096
+1461.070336 121.12 132096
+1461.202432 121.12 132096
+1461.334528 121.12 132096
+1461.466624 121.12 132096
+1461.598720 121.12 132096
+1461.730816 121.12 132096
+1461.862912 121.12 132096
+1461.995008 121.12 132096
+1462.127104 121.12 132096
+1462.259200 121.12 132096
+1462.391296 121.12 132096
+1462.523392 121.12 132096
+1462.655488 121.12 132096
+1462.787584 121.12 132096
+1462.919680 121.12 132096
+1463.051776 121.12 132096
+1463.183872 121.12 132096
+1463.315968 121.12 132096
+1463.448064 121.12 132096
+1463.580160 121.12 132096
+1463.712256 121.12 132096
+1463.844352 121.12 132096
+1463.976448 121.12 132096
+1464.109568 120.19 133120
+1464.242688 120.19 133120
+1464.375808 120.19 133120
+1464.508928 120.19 133120
+1464.642048 120.19 133120
+1464.775168 120.19 133120
+1464.908288 120.19 133120
+1465.041408 120.19 133120
+1465.174528 120.19 133120
+1465.307648 120.19 133120
+1465.440768 120.19 133120
+1465.573888 120.19 133120
+1465.707008 120.19 133120
+1465.840128 120.19 133120
+1465.973248 120.19 133120
+1466.106368 120.19 133120
+1466.240512 119.27 134144
+1466.374656 119.27 134144
+1466.508800 119.27 134144
+1466.642944 119.27 134144
+1466.777088 119.27 134144
+1466.911232 119.27 134144
+1467.045376 119.27 134144
+1467.179520 119.27 134144
+1467.313664 119.27 134144
+1467.447808 119.27 134144
+1467.581952 119.27 134144
+1467.716096 119.27 134144
+1467.850240 119.27 134144
+1467.984384 119.27 134144
+1468.118528 119.27 134144
+1468.252672 119.27 134144
+1468.387840 118.37 135168
+1468.523008 118.37 135168
+1468.658176 118.37 135168
+1468.793344 118.37 135168
+1468.928512 118.37 135168
+1469.063680 118.37 135168
+1469.198848 118.37 135168
+1469.334016 118.37 135168
+1469.469184 118.37 135168
+1469.604352 118.37 135168
+1469.739520 118.37 135168
+1469.874688 118.37 135168
+1470.009856 118.37 135168
+1470.145024 118.37 135168
+1470.280192 118.37 135168
+1470.415360 118.37 135168
+1470.550528 118.37 135168
+1470.685696 118.37 135168
+1470.820864 118.37 135168
+1470.956032 118.37 135168
+1471.091200 118.37 135168
+1471.226368 118.37 135168
+1471.361536 118.37 135168
+1471.496704 118.37 135168
+1471.632896 117.48 136192
+1471.769088 117.48 136192
+1471.905280 117.48 136192
+1472.041472 117.48 136192
+1472.177664 117.48 136192
+1472.313856 117.48 136192
+1472.450048 117.48 136192
+1472.586240 117.48 136192
+1472.722432 117.48 136192
+1472.858624 117.48 136192
+1472.994816 117.48 136192
+1473.131008 117.48 136192
+1473.267200 117.48 136192
+1473.403392 117.48 136192
+1473.539584 117.48 136192
+1473.675776 117.48 136192
+1473.812992 116.60 137216
+1473.950208 116.60 137216
+1474.087424 116.60 137216
+1474.224640 116.60 137216
+1474.361856 116.60 137216
+1474.499072 116.60 137216
+1474.636288 116.60 137216
+1474.773504 116.60 137216
+1474.910720 116.60 137216
+1475.047936 116.60 137216
+1475.185152 116.60 137216
+1475.322368 116.60 137216
+1475.459584 116.60 137216
+1475.596800 116.60 137216
+1475.734016 116.60 137216
+1475.871232 116.60 137216
+1476.009472 115.74 138240
+1476.147712 115.74 138240
+1476.285952 115.74 138240
+1476.424192 115.74 138240
+1476.562432 115.74 138240
+1476.700672 115.74 138240
+1476.838912 115.74 138240
+1476.977152 115.74 138240
+1477.115392 115.74 138240
+1477.253632 115.74 138240
+1477.391872 115.74 138240
+1477.530112 115.74 138240
+1477.668352 115.74 138240
+1477.806592 115.74 138240
+1477.944832 115.74 138240
+1478.083072 115.74 138240
+1478.221312 115.74 138240
+1478.359552 115.74 138240
+1478.497792 115.74 138240
+1478.636032 115.74 138240
+1478.774272 115.74 138240
+1478.912512 115.74 138240
+1479.050752 115.74 138240
+1479.188992 115.74 138240
+1479.327232 115.74 138240
+1479.465472 115.74 138240
+1479.603712 115.74 138240
+1479.741952 115.74 138240
+1479.880192 115.74 138240
+1480.018432 115.74 138240
+1480.156672 115.74 138240
+1480.294912 115.74 138240
+1480.434176 114.89 139264
+1480.573440 114.89 139264
+1480.712704 114.89 139264
+1480.851968 114.89 139264
+1480.991232 114.89 139264
+1481.130496 114.89 139264
+1481.269760 114.89 139264
+1481.409024 114.89 139264
+1481.548288 114.89 139264
+1481.687552 114.89 139264
+1481.826816 114.89 139264
+1481.966080 114.89 139264
+1482.105344 114.89 139264
+1482.244608 114.89 139264
+1482.383872 114.89 139264
+1482.523136 114.89 139264
+1482.663424 114.05 140288
+1482.803712 114.05 140288
+1482.944000 114.05 140288
+1483.084288 114.05 140288
+1483.224576 114.05 140288
+1483.364864 114.05 140288
+1483.505152 114.05 140288
+1483.645440 114.05 140288
+1483.785728 114.05 140288
+1483.926016 114.05 140288
+1484.066304 114.05 140288
+1484.206592 114.05 140288
+1484.346880 114.05 140288
+1484.487168 114.05 140288
+1484.627456 114.05 140288
+1484.767744 114.05 140288
+1484.908032 114.05 140288
+1485.048320 114.05 140288
+1485.188608 114.05 140288
+1485.328896 114.05 140288
+1485.469184 114.05 140288
+1485.609472 114.05 140288
+1485.749760 114.05 140288
+1485.890048 114.05 140288
+1486.031360 113.22 141312
+1486.172672 113.22 141312
+1486.313984 113.22 141312
+1486.455296 113.22 141312
+1486.596608 113.22 141312
+1486.737920 113.22 141312
+1486.879232 113.22 141312
+1487.020544 113.22 141312
+1487.161856 113.22 141312
+1487.303168 113.22 141312
+1487.444480 113.22 141312
+1487.585792 113.22 141312
+1487.727104 113.22 141312
+1487.868416 113.22 141312
+1488.009728 113.22 141312
+1488.151040 113.22 141312
+1488.293376 112.41 142336
+1488.435712 112.41 142336
+1488.578048 112.41 142336
+1488.720384 112.41 142336
+1488.862720 112.41 142336
+1489.005056 112.41 142336
+1489.147392 112.41 142336
+1489.289728 112.41 142336
+1489.432064 112.41 142336
+1489.574400 112.41 142336
+1489.716736 112.41 142336
+1489.859072 112.41 142336
+1490.001408 112.41 142336
+1490.143744 112.41 142336
+1490.286080 112.41 142336
+1490.428416 112.41 142336
+1490.571776 111.61 143360
+1490.715136 111.61 143360
+1490.858496 111.61 143360
+1491.001856 111.61 143360
+1491.145216 111.61 143360
+1491.288576 111.61 143360
+1491.431936 111.61 143360
+1491.575296 111.61 143360
+1491.718656 111.61 143360
+1491.862016 111.61 143360
+1492.005376 111.61 143360
+1492.148736 111.61 143360
+1492.292096 111.61 143360
+1492.435456 111.61 143360
+1492.578816 111.61 143360
+1492.722176 111.61 143360
+1492.865536 111.61 143360
+1493.008896 111.61 143360
+1493.152256 111.61 143360
+1493.295616 111.61 143360
+1493.438976 111.61 143360
+1493.582336 111.61 143360
+1493.725696 111.61 143360
+1493.869056 111.61 143360
+1494.013440 110.82 144384
+1494.157824 110.82 144384
+1494.302208 110.82 144384
+1494.446592 110.82 144384
+1494.590976 110.82 144384
+1494.735360 110.82 144384
+1494.879744 110.82 144384
+1495.024128 110.82 144384
+1495.168512 110.82 144384
+1495.312896 110.82 144384
+1495.457280 110.82 144384
+1495.601664 110.82 144384
+1495.746048 110.82 144384
+1495.890432 110.82 144384
+1496.034816 110.82 144384
+1496.179200 110.82 144384
+1496.324608 110.04 145408
+1496.470016 110.04 145408
+1496.615424 110.04 145408
+1496.760832 110.04 145408
+1496.906240 110.04 145408
+1497.051648 110.04 145408
+1497.197056 110.04 145408
+1497.342464 110.04 145408
+1497.488896 109.27 146432
+1497.635328 109.27 146432
+1497.781760 109.27 146432
+1497.928192 109.27 146432
+1498.074624 109.27 146432
+1498.221056 109.27 146432
+1498.367488 109.27 146432
+1498.513920 109.27 146432
+1498.660352 109.27 146432
+1498.806784 109.27 146432
+1498.953216 109.27 146432
+1499.099648 109.27 146432
+1499.246080 109.27 146432
+1499.392512 109.27 146432
+1499.538944 109.27 146432
+1499.685376 109.27 146432
+1499.832832 108.51 147456
+1499.980288 108.51 147456
+1500.127744 108.51 147456
+1500.275200 108.51 147456
+1500.422656 108.51 147456
+1500.570112 108.51 147456
+1500.717568 108.51 147456
+1500.865024 108.51 147456
+1501.012480 108.51 147456
+1501.159936 108.51 147456
+1501.307392 108.51 147456
+1501.454848 108.51 147456
+1501.602304 108.51 147456
+1501.749760 108.51 147456
+1501.897216 108.51 147456
+1502.044672 108.51 147456
+1502.192128 108.51 147456
+1502.339584 108.51 147456
+1502.487040 108.51 147456
+1502.634496 108.51 147456
+1502.781952 108.51 147456
+1502.929408 108.51 147456
+1503.076864 108.51 147456
+1503.224320 108.51 147456
+1503.372800 107.76 148480
+1503.521280 107.76 148480
+1503.669760 107.76 148480
+1503.818240 107.76 148480
+1503.966720 107.76 148480
+1504.115200 107.76 148480
+1504.263680 107.76 148480
+1504.412160 107.76 148480
+1504.560640 107.76 148480
+1504.709120 107.76 148480
+1504.857600 107.76 148480
+1505.006080 107.76 148480
+1505.154560 107.76 148480
+1505.303040 107.76 148480
+1505.451520 107.76 148480
+1505.600000 107.76 148480
+1505.749504 107.02 149504
+1505.899008 107.02 149504
+1506.048512 107.02 149504
+1506.198016 107.02 149504
+1506.347520 107.02 149504
+1506.497024 107.02 149504
+1506.646528 107.02 149504
+1506.796032 107.02 149504
+1506.946560 106.29 150528
+1507.097088 106.29 150528
+1507.247616 106.29 150528
+1507.398144 106.29 150528
+1507.548672 106.29 150528
+1507.699200 106.29 150528
+1507.849728 106.29 150528
+1508.000256 106.29 150528
+1508.150784 106.29 150528
+1508.301312 106.29 150528
+1508.451840 106.29 150528
+1508.602368 106.29 150528
+1508.752896 106.29 150528
+1508.903424 106.29 150528
+1509.053952 106.29 150528
+1509.204480 106.29 150528
+1509.355008 106.29 150528
+1509.505536 106.29 150528
+1509.656064 106.29 150528
+1509.806592 106.29 150528
+1509.957120 106.29 150528
+1510.107648 106.29 150528
+1510.258176 106.29 150528
+1510.408704 106.29 150528
+1510.560256 105.57 151552
+1510.711808 105.57 151552
+1510.863360 105.57 151552
+1511.014912 105.57 151552
+1511.166464 105.57 151552
+1511.318016 105.57 151552
+1511.469568 105.57 151552
+1511.621120 105.57 151552
+1511.772672 105.57 151552
+1511.924224 105.57 151552
+1512.075776 105.57 151552
+1512.227328 105.57 151552
+1512.378880 105.57 151552
+1512.530432 105.57 151552
+1512.681984 105.57 151552
+1512.833536 105.57 151552
+1512.986112 104.87 152576
+1513.138688 104.87 152576
+1513.291264 104.87 152576
+1513.443840 104.87 152576
+1513.596416 104.87 152576
+1513.748992 104.87 152576
+1513.901568 104.87 152576
+1514.054144 104.87 152576
+1514.207744 104.17 153600
+1514.361344 104.17 153600
+1514.514944 104.17 153600
+1514.668544 104.17 153600
+1514.822144 104.17 153600
+1514.975744 104.17 153600
+1515.129344 104.17 153600
+1515.282944 104.17 153600
+1515.436544 104.17 153600
+1515.590144 104.17 153600
+1515.743744 104.17 153600
+1515.897344 104.17 153600
+1516.050944 104.17 153600
+1516.204544 104.17 153600
+1516.358144 104.17 153600
+1516.511744 104.17 153600
+1516.666368 103.48 154624
+1516.820992 103.48 154624
+1516.975616 103.48 154624
+1517.130240 103.48 154624
+1517.284864 103.48 154624
+1517.439488 103.48 154624
+1517.594112 103.48 154624
+1517.748736 103.48 154624
+1517.904384 102.80 155648
+1518.060032 102.80 155648
+1518.215680 102.80 155648
+1518.371328 102.80 155648
+1518.526976 102.80 155648
+1518.682624 102.80 155648
+1518.838272 102.80 155648
+1518.993920 102.80 155648
+1519.149568 102.80 155648
+1519.305216 102.80 155648
+1519.460864 102.80 155648
+1519.616512 102.80 155648
+1519.772160 102.80 155648
+1519.927808 102.80 155648
+1520.083456 102.80 155648
+1520.239104 102.80 155648
+1520.394752 102.80 155648
+1520.550400 102.80 155648
+1520.706048 102.80 155648
+1520.861696 102.80 155648
+1521.017344 102.80 155648
+1521.172992 102.80 155648
+1521.328640 102.80 155648
+1521.484288 102.80 155648
+1521.640960 102.12 156672
+1521.797632 102.12 156672
+1521.954304 102.12 156672
+1522.110976 102.12 156672
+1522.267648 102.12 156672
+1522.424320 102.12 156672
+1522.580992 102.12 156672
+1522.737664 102.12 156672
+1522.895360 101.46 157696
+1523.053056 101.46 157696
+1523.210752 101.46 157696
+1523.368448 101.46 157696
+1523.526144 101.46 157696
+1523.683840 101.46 157696
+1523.841536 101.46 157696
+1523.999232 101.46 157696
+1524.156928 101.46 157696
+1524.314624 101.46 157696
+1524.472320 101.46 157696
+1524.630016 101.46 157696
+1524.787712 101.46 157696
+1524.945408 101.46 157696
+1525.103104 101.46 157696
+1525.260800 101.46 157696
+1525.419520 100.81 158720
+1525.578240 100.81 158720
+1525.736960 100.81 158720
+1525.895680 100.81 158720
+1526.054400 100.81 158720
+1526.213120 100.81 158720
+1526.371840 100.81 158720
+1526.530560 100.81 158720
+1526.689280 100.81 158720
+1526.848000 100.81 158720
+1527.006720 100.81 158720
+1527.165440 100.81 158720
+1527.325184 100.16 159744
+1527.484928 100.16 159744
+1527.644672 100.16 159744
+1527.804416 100.16 159744
+1527.964160 100.16 159744
+1528.123904 100.16 159744
+1528.283648 100.16 159744
+1528.443392 100.16 159744
+1528.604160 99.52 160768
+1528.764928 99.52 160768
+1528.925696 99.52 160768
+1529.086464 99.52 160768
+1529.247232 99.52 160768
+1529.408000 99.52 160768
+1529.568768 99.52 160768
+1529.729536 99.52 160768
+1529.890304 99.52 160768
+1530.051072 99.52 160768
+1530.211840 99.52 160768
+1530.372608 99.52 160768
+1530.533376 99.52 160768
+1530.694144 99.52 160768
+1530.854912 99.52 160768
+1531.015680 99.52 160768
+1531.176448 99.52 160768
+1531.337216 99.52 160768
+1531.497984 99.52 160768
+1531.658752 99.52 160768
+1531.819520 99.52 160768
+1531.980288 99.52 160768
+1532.141056 99.52 160768
+1532.301824 99.52 160768
+1532.463616 98.89 161792
+1532.625408 98.89 161792
+1532.787200 98.89 161792
+1532.948992 98.89 161792
+1533.110784 98.89 161792
+1533.272576 98.89 161792
+1533.434368 98.89 161792
+1533.596160 98.89 161792
+1533.758976 98.27 162816
+1533.921792 98.27 162816
+1534.084608 98.27 162816
+1534.247424 98.27 162816
+1534.410240 98.27 162816
+1534.573056 98.27 162816
+1534.735872 98.27 162816
+1534.898688 98.27 162816
+1535.061504 98.27 162816
+1535.224320 98.27 162816
+1535.387136 98.27 162816
+1535.549952 98.27 162816
+1535.713792 97.66 163840
+1535.877632 97.66 163840
+1536.041472 97.66 163840
+1536.205312 97.66 163840
+1536.369152 97.66 163840
+1536.532992 97.66 163840
+1536.696832 97.66 163840
+1536.860672 97.66 163840
+1537.025536 97.05 164864
+1537.190400 97.05 164864
+1537.355264 97.05 164864
+1537.520128 97.05 164864
+1537.684992 97.05 164864
+1537.849856 97.05 164864
+1538.014720 97.05 164864
+1538.179584 97.05 164864
+1538.344448 97.05 164864
+1538.509312 97.05 164864
+1538.674176 97.05 164864
+1538.839040 97.05 164864
+1539.004928 96.45 165888
+1539.170816 96.45 165888
+1539.336704 96.45 165888
+1539.502592 96.45 165888
+1539.668480 96.45 165888
+1539.834368 96.45 165888
+1540.000256 96.45 165888
+1540.166144 96.45 165888
+1540.332032 96.45 165888
+1540.497920 96.45 165888
+1540.663808 96.45 165888
+1540.829696 96.45 165888
+1540.996608 95.86 166912
+1541.163520 95.86 166912
+1541.330432 95.86 166912
+1541.497344 95.86 166912
+1541.664256 95.86 166912
+1541.831168 95.86 166912
+1541.998080 95.86 166912
+1542.164992 95.86 166912
+1542.331904 95.86 166912
+1542.498816 95.86 166912
+1542.665728 95.86 166912
+1542.832640 95.86 166912
+1542.999552 95.86 166912
+1543.166464 95.86 166912
+1543.333376 95.86 166912
+1543.500288 95.86 166912
+1543.667200 95.86 166912
+1543.834112 95.86 166912
+1544.001024 95.86 166912
+1544.167936 95.86 166912
+1544.335872 95.27 167936
+1544.503808 95.27 167936
+1544.671744 95.27 167936
+1544.839680 95.27 167936
+1545.007616 95.27 167936
+1545.175552 95.27 167936
+1545.343488 95.27 167936
+1545.511424 95.27 167936
+1545.680384 94.70 168960
+1545.849344 94.70 168960
+1546.018304 94.70 168960
+1546.187264 94.70 168960
+1546.356224 94.70 168960
+1546.525184 94.70 168960
+1546.694144 94.70 168960
+1546.863104 94.70 168960
+1547.033088 94.13 169984
+1547.203072 94.13 169984
+1547.373056 94.13 169984
+1547.543040 94.13 169984
+1547.713024 94.13 169984
+1547.883008 94.13 169984
+1548.052992 94.13 169984
+1548.222976 94.13 169984
+1548.392960 94.13 169984
+1548.562944 94.13 169984
+1548.732928 94.13 169984
+1548.902912 94.13 169984
+1549.073920 93.56 171008
+1549.244928 93.56 171008
+1549.415936 93.56 171008
+1549.586944 93.56 171008
+1549.757952 93.56 171008
+1549.928960 93.56 171008
+1550.099968 93.56 171008
+1550.270976 93.56 171008
+1550.443008 93.01 172032
+1550.615040 93.01 172032
+1550.787072 93.01 172032
+1550.959104 93.01 172032
+1551.131136 93.01 172032
+1551.303168 93.01 172032
+1551.475200 93.01 172032
+1551.647232 93.01 172032
+1551.819264 93.01 172032
+1551.991296 93.01 172032
+1552.163328 93.01 172032
+1552.335360 93.01 172032
+1552.508416 92.46 173056
+1552.681472 92.46 173056
+1552.854528 92.46 173056
+1553.027584 92.46 173056
+1553.200640 92.46 173056
+1553.373696 92.46 173056
+1553.546752 92.46 173056
+1553.719808 92.46 173056
+1553.893888 91.91 174080
+1554.067968 91.91 174080
+1554.242048 91.91 174080
+1554.416128 91.91 174080
+1554.590208 91.91 174080
+1554.764288 91.91 174080
+1554.938368 91.91 174080
+1555.112448 91.91 174080
+1555.287552 91.37 175104
+1555.462656 91.37 175104
+1555.637760 91.37 175104
+1555.812864 91.37 175104
+1555.987968 91.37 175104
+1556.163072 91.37 175104
+1556.338176 91.37 175104
+1556.513280 91.37 175104
+1556.689408 90.84 176128
+1556.865536 90.84 176128
+1557.041664 90.84 176128
+1557.217792 90.84 176128
+1557.393920 90.84 176128
+1557.570048 90.84 176128
+1557.746176 90.84 176128
+1557.922304 90.84 176128
+1558.098432 90.84 176128
+1558.274560 90.84 176128
+1558.450688 90.84 176128
+1558.626816 90.84 176128
+1558.803968 90.32 177152
+1558.981120 90.32 177152
+1559.158272 90.32 177152
+1559.335424 90.32 177152
+1559.512576 90.32 177152
+1559.689728 90.32 177152
+1559.866880 90.32 177152
+1560.044032 90.32 177152
+1560.222208 89.80 178176
+1560.400384 89.80 178176
+1560.578560 89.80 178176
+1560.756736 89.80 178176
+1560.934912 89.80 178176
+1561.113088 89.80 178176
+1561.291264 89.80 178176
+1561.469440 89.80 178176
+1561.647616 89.80 178176
+1561.825792 89.80 178176
+1562.003968 89.80 178176
+1562.182144 89.80 178176
+1562.360320 89.80 178176
+1562.538496 89.80 178176
+1562.716672 89.80 178176
+1562.894848 89.80 178176
+1563.074048 89.29 179200
+1563.253248 89.29 179200
+1563.432448 89.29 179200
+1563.611648 89.29 179200
+1563.790848 89.29 179200
+1563.970048 89.29 179200
+1564.149248 89.29 179200
+1564.328448 89.29 179200
+1564.508672 88.78 180224
+1564.688896 88.78 180224
+1564.869120 88.78 180224
+1565.049344 88.78 180224
+1565.229568 88.78 180224
+1565.409792 88.78 180224
+1565.590016 88.78 180224
+1565.770240 88.78 180224
+1565.950464 88.78 180224
+1566.130688 88.78 180224
+1566.310912 88.78 180224
+1566.491136 88.78 180224
+1566.672384 88.28 181248
+1566.853632 88.28 181248
+1567.034880 88.28 181248
+1567.216128 88.28 181248
+1567.397376 88.28 181248
+1567.578624 88.28 181248
+1567.759872 88.28 181248
+1567.941120 88.28 181248
+1568.123392 87.78 182272
+1568.305664 87.78 182272
+1568.487936 87.78 182272
+1568.670208 87.78 182272
+1568.852480 87.78 182272
+1569.034752 87.78 182272
+1569.217024 87.78 182272
+1569.399296 87.78 182272
+1569.582592 87.29 183296
+1569.765888 87.29 183296
+1569.949184 87.29 183296
+1570.132480 87.29 183296
+1570.315776 87.29 183296
+1570.499072 87.29 183296
+1570.682368 87.29 183296
+1570.865664 87.29 183296
+1571.049984 86.81 184320
+1571.234304 86.81 184320
+1571.418624 86.81 184320
+1571.602944 86.81 184320
+1571.787264 86.81 184320
+1571.971584 86.81 184320
+1572.155904 86.81 184320
+1572.340224 86.81 184320
+1572.525568 86.33 185344
+1572.710912 86.33 185344
+1572.896256 86.33 185344
+1573.081600 86.33 185344
+1573.266944 86.33 185344
+1573.452288 86.33 185344
+1573.637632 86.33 185344
+1573.822976 86.33 185344
+1574.009344 85.85 186368
+1574.195712 85.85 186368
+1574.382080 85.85 186368
+1574.568448 85.85 186368
+1574.754816 85.85 186368
+1574.941184 85.85 186368
+1575.127552 85.85 186368
+1575.313920 85.85 186368
+1575.501312 85.38 187392
+1575.688704 85.38 187392
+1575.876096 85.38 187392
+1576.063488 85.38 187392
+1576.250880 85.38 187392
+1576.438272 85.38 187392
+1576.625664 85.38 187392
+1576.813056 85.38 187392
+1577.001472 84.92 188416
+1577.189888 84.92 188416
+1577.378304 84.92 188416
+1577.566720 84.92 188416
+1577.755136 84.92 188416
+1577.943552 84.92 188416
+1578.131968 84.92 188416
+1578.320384 84.92 188416
+1578.509824 84.46 189440
+1578.699264 84.46 189440
+1578.888704 84.46 189440
+1579.078144 84.46 189440
+1579.267584 84.46 189440
+1579.457024 84.46 189440
+1579.646464 84.46 189440
+1579.835904 84.46 189440
+1580.026368 84.01 190464
+1580.216832 84.01 190464
+1580.407296 84.01 190464
+1580.597760 84.01 190464
+1580.788224 84.01 190464
+1580.978688 84.01 190464
+1581.169152 84.01 190464
+1581.359616 84.01 190464
+1581.551104 83.56 191488
+1581.742592 83.56 191488
+1581.934080 83.56 191488
+1582.125568 83.56 191488
+1582.318080 83.11 192512
+1582.510592 83.11 192512
+1582.703104 83.11 192512
+1582.895616 83.11 192512
+1583.088128 83.11 192512
+1583.280640 83.11 192512
+1583.473152 83.11 192512
+1583.665664 83.11 192512
+1583.859200 82.67 193536
+1584.052736 82.67 193536
+1584.246272 82.67 193536
+1584.439808 82.67 193536
+1584.633344 82.67 193536
+1584.826880 82.67 193536
+1585.020416 82.67 193536
+1585.213952 82.67 193536
+1585.408512 82.24 194560
+1585.603072 82.24 194560
+1585.797632 82.24 194560
+1585.992192 82.24 194560
+1586.186752 82.24 194560
+1586.381312 82.24 194560
+1586.575872 82.24 194560
+1586.770432 82.24 194560
+1586.966016 81.81 195584
+1587.161600 81.81 195584
+1587.357184 81.81 195584
+1587.552768 81.81 195584
+1587.748352 81.81 195584
+1587.943936 81.81 195584
+1588.139520 81.81 195584
+1588.335104 81.81 195584
+1588.531712 81.38 196608
+1588.728320 81.38 196608
+1588.924928 81.38 196608
+1589.121536 81.38 196608
+1589.318144 81.38 196608
+1589.514752 81.38 196608
+1589.711360 81.38 196608
+1589.907968 81.38 196608
+1590.105600 80.96 197632
+1590.303232 80.96 197632
+1590.500864 80.96 197632
+1590.698496 80.96 197632
+1590.897152 80.54 198656
+1591.095808 80.54 198656
+1591.294464 80.54 198656
+1591.493120 80.54 198656
+1591.691776 80.54 198656
+1591.890432 80.54 198656
+1592.089088 80.54 198656
+1592.287744 80.54 198656
+1592.488448 79.72 200704
+1592.689152 79.72 200704
+1592.889856 79.72 200704
+1593.090560 79.72 200704
+1593.291264 79.72 200704
+1593.491968 79.72 200704
+1593.692672 79.72 200704
+1593.893376 79.72 200704
+1594.095104 79.31 201728
+1594.296832 79.31 201728
+1594.498560 79.31 201728
+1594.700288 79.31 201728
+1594.902016 79.31 201728
+1595.103744 79.31 201728
+1595.305472 79.31 201728
+1595.507200 79.31 201728
+1595.709952 78.91 202752
+1595.912704 78.91 202752
+1596.115456 78.91 202752
+1596.318208 78.91 202752
+1596.521984 78.52 203776
+1596.725760 78.52 203776
+1596.929536 78.52 203776
+1597.133312 78.52 203776
+1597.337088 78.52 203776
+1597.540864 78.52 203776
+1597.744640 78.52 203776
+1597.948416 78.52 203776
+1598.153216 78.12 204800
+1598.358016 78.12 204800
+1598.562816 78.12 204800
+1598.767616 78.12 204800
+1598.972416 78.12 204800
+1599.177216 78.12 204800
+1599.382016 78.12 204800
+1599.586816 78.12 204800
+1599.792640 77.74 205824
+1599.998464 77.74 205824
+1600.204288 77.74 205824
+1600.410112 77.74 205824
+1600.616960 77.35 206848
+1600.823808 77.35 206848
+1601.030656 77.35 206848
+1601.237504 77.35 206848
+1601.444352 77.35 206848
+1601.651200 77.35 206848
+1601.858048 77.35 206848
+1602.064896 77.35 206848
+1602.272768 76.97 207872
+1602.480640 76.97 207872
+1602.688512 76.97 207872
+1602.896384 76.97 207872
+1603.105280 76.59 208896
+1603.314176 76.59 208896
+1603.523072 76.59 208896
+1603.731968 76.59 208896
+1603.940864 76.59 208896
+1604.149760 76.59 208896
+1604.358656 76.59 208896
+1604.567552 76.59 208896
+1604.777472 76.22 209920
+1604.987392 76.22 209920
+1605.197312 76.22 209920
+1605.407232 76.22 209920
+1605.617152 76.22 209920
+1605.827072 76.22 209920
+1606.036992 76.22 209920
+1606.246912 76.22 209920
+1606.457856 75.85 210944
+1606.668800 75.85 210944
+1606.879744 75.85 210944
+1607.090688 75.85 210944
+1607.303680 75.12 212992
+1607.516672 75.12 212992
+1607.729664 75.12 212992
+1607.942656 75.12 212992
+1608.155648 75.12 212992
+1608.368640 75.12 212992
+1608.581632 75.12 212992
+1608.794624 75.12 212992
+1609.008640 74.76 214016
+1609.222656 74.76 214016
+1609.436672 74.76 214016
+1609.650688 74.76 214016
+1609.865728 74.40 215040
+1610.080768 74.40 215040
+1610.295808 74.40 215040
+1610.510848 74.40 215040
+1610.725888 74.40 215040
+1610.940928 74.40 215040
+1611.155968 74.40 215040
+1611.371008 74.40 215040
+1611.587072 74.05 216064
+1611.803136 74.05 216064
+1612.019200 74.05 216064
+1612.235264 74.05 216064
+1612.452352 73.70 217088
+1612.669440 73.70 217088
+1612.886528 73.70 217088
+1613.103616 73.70 217088
+1613.320704 73.70 217088
+1613.537792 73.70 217088
+1613.754880 73.70 217088
+1613.971968 73.70 217088
+1614.190080 73.36 218112
+1614.408192 73.36 218112
+1614.626304 73.36 218112
+1614.844416 73.36 218112
+1615.063552 73.01 219136
+1615.282688 73.01 219136
+1615.501824 73.01 219136
+1615.720960 73.01 219136
+1615.940096 73.01 219136
+1616.159232 73.01 219136
+1616.378368 73.01 219136
+1616.597504 73.01 219136
+1616.818688 72.34 221184
+1617.039872 72.34 221184
+1617.261056 72.34 221184
+1617.482240 72.34 221184
+1617.704448 72.00 222208
+1617.926656 72.00 222208
+1618.148864 72.00 222208
+1618.371072 72.00 222208
+1618.594304 71.67 223232
+1618.817536 71.67 223232
+1619.040768 71.67 223232
+1619.264000 71.67 223232
+1619.487232 71.67 223232
+1619.710464 71.67 223232
+1619.933696 71.67 223232
+1620.156928 71.67 223232
+1620.381184 71.35 224256
+1620.605440 71.35 224256
+1620.829696 71.35 224256
+1621.053952 71.35 224256
+1621.278208 71.35 224256
+1621.502464 71.35 224256
+1621.727744 71.02 225280
+1621.953024 71.02 225280
+1622.178304 71.02 225280
+1622.403584 71.02 225280
+1622.629888 70.70 226304
+1622.856192 70.70 226304
+1623.082496 70.70 226304
+1623.308800 70.70 226304
+1623.535104 70.70 226304
+1623.761408 70.70 226304
+1623.989760 70.07 228352
+1624.218112 70.07 228352
+1624.446464 70.07 228352
+1624.674816 70.07 228352
+1624.903168 70.07 228352
+1625.131520 70.07 228352
+1625.360896 69.75 229376
+1625.590272 69.75 229376
+1625.819648 69.75 229376
+1626.049024 69.75 229376
+1626.279424 69.44 230400
+1626.509824 69.44 230400
+1626.740224 69.44 230400
+1626.970624 69.44 230400
+1627.201024 69.44 230400
+1627.431424 69.44 230400
+1627.662848 69.14 231424
+1627.894272 69.14 231424
+1628.125696 69.14 231424
+1628.357120 69.14 231424
+1628.590592 68.53 233472
+1628.824064 68.53 233472
+1629.057536 68.53 233472
+1629.291008 68.53 233472
+1629.524480 68.53 233472
+1629.757952 68.53 233472
+1629.992448 68.23 234496
+1630.226944 68.23 234496
+1630.461440 68.23 234496
+1630.695936 68.23 234496
+1630.930432 68.23 234496
+1631.164928 68.23 234496
+1631.400448 67.93 235520
+1631.635968 67.93 235520
+1631.871488 67.93 235520
+1632.107008 67.93 235520
+1632.343552 67.64 236544
+1632.580096 67.64 236544
+1632.816640 67.64 236544
+1633.053184 67.64 236544
+1633.289728 67.64 236544
+1633.526272 67.64 236544
+1633.764864 67.06 238592
+1634.003456 67.06 238592
+1634.242048 67.06 238592
+1634.480640 67.06 238592
+1634.720256 66.77 239616
+1634.959872 66.77 239616
+1635.199488 66.77 239616
+1635.439104 66.77 239616
+1635.679744 66.49 240640
+1635.920384 66.49 240640
+1636.161024 66.49 240640
+1636.401664 66.49 240640
+1636.642304 66.49 240640
+1636.882944 66.49 240640
+1637.124608 66.21 241664
+1637.366272 66.21 241664
+1637.607936 66.21 241664
+1637.849600 66.21 241664
+1638.093312 65.65 243712
+1638.337024 65.65 243712
+1638.580736 65.65 243712
+1638.824448 65.65 243712
+1639.068160 65.65 243712
+1639.311872 65.65 243712
+1639.556608 65.38 244736
+1639.801344 65.38 244736
+1640.046080 65.38 244736
+1640.290816 65.38 244736
+1640.536576 65.10 245760
+1640.782336 65.10 245760
+1641.028096 65.10 245760
+1641.273856 65.10 245760
+1641.521664 64.57 247808
+1641.769472 64.57 247808
+1642.017280 64.57 247808
+1642.265088 64.57 247808
+1642.513920 64.30 248832
+1642.762752 64.30 248832
+1643.011584 64.30 248832
+1643.260416 64.30 248832
+1643.509248 64.30 248832
+1643.758080 64.30 248832
+1644.007936 64.04 249856
+1644.257792 64.04 249856
+1644.507648 64.04 249856
+1644.757504 64.04 249856
+1645.009408 63.52 251904
+1645.261312 63.52 251904
+1645.513216 63.52 251904
+1645.765120 63.52 251904
+1646.018048 63.26 252928
+1646.270976 63.26 252928
+1646.523904 63.26 252928
+1646.776832 63.26 252928
+1647.030784 63.00 253952
+1647.284736 63.00 253952
+1647.538688 63.00 253952
+1647.792640 63.00 253952
+1648.048640 62.50 256000
+1648.304640 62.50 256000
+1648.560640 62.50 256000
+1648.816640 62.50 256000
+1649.072640 62.50 256000
+1649.328640 62.50 256000
+1649.585664 62.25 257024
+1649.842688 62.25 257024
+1650.099712 62.25 257024
+1650.356736 62.25 257024
+1650.614784 62.00 258048
+1650.872832 62.00 258048
+1651.130880 62.00 258048
+1651.388928 62.00 258048
+1651.649024 61.52 260096
+1651.909120 61.52 260096
+1652.169216 61.52 260096
+1652.429312 61.52 260096
+1652.690432 61.27 261120
+1652.951552 61.27 261120
+1653.212672 61.27 261120
+1653.473792 61.27 261120
+1653.735936 61.04 262144
+1653.998080 61.04 262144
+1654.260224 61.04 262144
+1654.522368 61.04 262144
+1654.786560 60.56 264192
+1655.050752 60.56 264192
+1655.314944 60.56 264192
+1655.579136 60.56 264192
+1655.843328 60.56 264192
+1656.107520 60.56 264192
+1656.371712 60.56 264192
+1656.635904 60.56 264192
+1656.902144 60.10 266240
+1657.168384 60.10 266240
+1657.434624 60.10 266240
+1657.700864 60.10 266240
+1657.969152 59.64 268288
+1658.237440 59.64 268288
+1658.505728 59.64 268288
+1658.774016 59.64 268288
+1659.044352 59.19 270336
+1659.314688 59.19 270336
+1659.585024 59.19 270336
+1659.855360 59.19 270336
+1660.125696 59.19 270336
+1660.396032 59.19 270336
+1660.668416 58.74 272384
+1660.940800 58.74 272384
+1661.213184 58.74 272384
+1661.485568 58.74 272384
+1661.760000 58.30 274432
+1662.034432 58.30 274432
+1662.308864 58.30 274432
+1662.583296 58.30 274432
+1662.859776 57.87 276480
+1663.136256 57.87 276480
+1663.412736 57.87 276480
+1663.689216 57.87 276480
+1663.965696 57.87 276480
+1664.242176 57.87 276480
+1664.518656 57.87 276480
+1664.795136 57.87 276480
+1665.073664 57.44 278528
+1665.352192 57.44 278528
+1665.630720 57.44 278528
+1665.909248 57.44 278528
+1666.189824 57.03 280576
+1666.470400 57.03 280576
+1666.750976 57.03 280576
+1667.031552 57.03 280576
+1667.312128 57.03 280576
+1667.592704 57.03 280576
+1667.875328 56.61 282624
+1668.157952 56.61 282624
+1668.440576 56.61 282624
+1668.723200 56.61 282624
+1669.007872 56.21 284672
+1669.292544 56.21 284672
+1669.577216 56.21 284672
+1669.861888 56.21 284672
+1670.148608 55.80 286720
+1670.435328 55.80 286720
+1670.722048 55.80 286720
+1671.008768 55.80 286720
+1671.295488 55.80 286720
+1671.582208 55.80 286720
+1671.870976 55.41 288768
+1672.159744 55.41 288768
+1672.448512 55.41 288768
+1672.737280 55.41 288768
+1673.028096 55.02 290816
+1673.318912 55.02 290816
+1673.611776 54.63 292864
+1673.904640 54.63 292864
+1674.197504 54.63 292864
+1674.490368 54.63 292864
+1674.785280 54.25 294912
+1675.080192 54.25 294912
+1675.375104 54.25 294912
+1675.670016 54.25 294912
+1675.964928 54.25 294912
+1676.259840 54.25 294912
+1676.556800 53.88 296960
+1676.853760 53.88 296960
+1677.150720 53.88 296960
+1677.447680 53.88 296960
+1677.746688 53.51 299008
+1678.045696 53.51 299008
+1678.346752 53.15 301056
+1678.647808 53.15 301056
+1678.948864 53.15 301056
+1679.249920 53.15 301056
+1679.550976 53.15 301056
+1679.852032 53.15 301056
+1680.155136 52.79 303104
+1680.458240 52.79 303104
+1680.761344 52.79 303104
+1681.064448 52.79 303104
+1681.369600 52.43 305152
+1681.674752 52.43 305152
+1681.981952 52.08 307200
+1682.289152 52.08 307200
+1682.596352 52.08 307200
+1682.903552 52.08 307200
+1683.212800 51.74 309248
+1683.522048 51.74 309248
+1683.833344 51.40 311296
+1684.144640 51.40 311296
+1684.455936 51.40 311296
+1684.767232 51.40 311296
+1685.078528 51.40 311296
+1685.389824 51.40 311296
+1685.703168 51.06 313344
+1686.016512 51.06 313344
+1686.331904 50.73 315392
+1686.647296 50.73 315392
+1686.962688 50.73 315392
+1687.278080 50.73 315392
+1687.595520 50.40 317440
+1687.912960 50.40 317440
+1688.230400 50.40 317440
+1688.549888 50.08 319488
+1688.869376 50.08 319488
+1689.190912 49.76 321536
+1689.512448 49.76 321536
+1689.833984 49.76 321536
+1690.155520 49.76 321536
+1690.477056 49.76 321536
+1690.798592 49.76 321536
+1691.122176 49.45 323584
+1691.445760 49.45 323584
+1691.771392 49.14 325632
+1692.097024 49.14 325632
+1692.422656 49.14 325632
+1692.750336 48.83 327680
+1693.078016 48.83 327680
+1693.407744 48.52 329728
+1693.737472 48.52 329728
+1694.067200 48.52 329728
+1694.398976 48.23 331776
+1694.730752 48.23 331776
+1695.062528 48.23 331776
+1695.396352 47.93 333824
+1695.730176 47.93 333824
+1696.064000 47.93 333824
+1696.397824 47.93 333824
+1696.731648 47.93 333824
+1697.067520 47.64 335872
+1697.403392 47.64 335872
+1697.741312 47.35 337920
+1698.079232 47.35 337920
+1698.419200 47.06 339968
+1698.759168 47.06 339968
+1699.099136 47.06 339968
+1699.441152 46.78 342016
+1699.783168 46.78 342016
+1700.127232 46.50 344064
+1700.471296 46.50 344064
+1700.815360 46.50 344064
+1701.161472 46.23 346112
+1701.507584 46.23 346112
+1701.855744 45.96 348160
+1702.203904 45.96 348160
+1702.554112 45.69 350208
+1702.904320 45.69 350208
+1703.256576 45.42 352256
+1703.608832 45.42 352256
+1703.961088 45.42 352256
+1704.315392 45.16 354304
+1704.669696 45.16 354304
+1705.026048 44.90 356352
+1705.382400 44.90 356352
+1705.738752 44.90 356352
+1706.095104 44.90 356352
+1706.453504 44.64 358400
+1706.811904 44.64 358400
+1707.172352 44.39 360448
+1707.532800 44.39 360448
+1707.893248 44.39 360448
+1708.255744 44.14 362496
+1708.618240 44.14 362496
+1708.982784 43.89 364544
+1709.347328 43.89 364544
+1709.713920 43.65 366592
+1710.080512 43.65 366592
+1710.449152 43.40 368640
+1710.817792 43.40 368640
+1711.188480 43.16 370688
+1711.559168 43.16 370688
+1711.931904 42.93 372736
+1712.304640 42.93 372736
+1712.679424 42.69 374784
+1713.054208 42.69 374784
+1713.431040 42.46 376832
+1713.807872 42.46 376832
+1714.186752 42.23 378880
+1714.565632 42.23 378880
+1714.946560 42.00 380928
+1715.327488 42.00 380928
+1715.710464 41.78 382976
+1716.095488 41.56 385024
+1716.480512 41.56 385024
+1716.867584 41.34 387072
+1717.254656 41.34 387072
+1717.643776 41.12 389120
+1718.032896 41.12 389120
+1718.424064 40.90 391168
+1718.815232 40.90 391168
+1719.208448 40.69 393216
+1719.601664 40.69 393216
+1719.996928 40.48 395264
+1720.394240 40.27 397312
+1720.791552 40.27 397312
+1721.192960 39.86 401408
+1721.594368 39.86 401408
+1721.997824 39.66 403456
+1722.401280 39.66 403456
+1722.806784 39.46 405504
+1723.214336 39.26 407552
+1723.621888 39.26 407552
+1724.031488 39.06 409600
+1724.441088 39.06 409600
+1724.852736 38.87 411648
+1725.266432 38.68 413696
+1725.680128 38.68 413696
+1726.095872 38.49 415744
+1726.513664 38.30 417792
+1726.931456 38.30 417792
+1727.351296 38.11 419840
+1727.771136 38.11 419840
+1728.193024 37.92 421888
+1728.619008 37.56 425984
+1729.044992 37.56 425984
+1729.473024 37.38 428032
+1729.903104 37.20 430080
+1730.333184 37.20 430080
+1730.765312 37.03 432128
+1731.199488 36.85 434176
+1731.633664 36.85 434176
+1732.069888 36.68 436224
+1732.508160 36.51 438272
+1732.946432 36.51 438272
+1733.388800 36.17 442368
+1733.833216 36.00 444416
+1734.279680 35.84 446464
+1734.726144 35.84 446464
+1735.174656 35.67 448512
+1735.625216 35.51 450560
+1736.077824 35.35 452608
+1736.530432 35.35 452608
+1736.987136 35.03 456704
+1737.445888 34.88 458752
+1737.906688 34.72 460800
+1738.367488 34.72 460800
+1738.830336 34.57 462848
+1739.297280 34.27 466944
+1739.766272 34.12 468992
+1740.235264 34.12 468992
+1740.706304 33.97 471040
+1741.179392 33.82 473088
+1741.656576 33.53 477184
+1742.135808 33.39 479232
+1742.617088 33.24 481280
+1743.098368 33.24 481280
+1743.581696 33.10 483328
+1744.069120 32.83 487424
+1744.558592 32.69 489472
+1745.050112 32.55 491520
+1745.545728 32.28 495616
+1746.043392 32.15 497664
+1746.541056 32.15 497664
+1747.040768 32.02 499712
+1747.544576 31.76 503808
+1748.050432 31.63 505856
+1748.558336 31.50 507904
+1749.070336 31.25 512000
+1749.584384 31.13 514048
+1750.100480 31.00 516096
+1750.620672 30.76 520192
+1751.142912 30.64 522240
+1751.667200 30.52 524288
+1752.195584 30.28 528384
+1752.723968 30.28 528384
+1753.256448 30.05 532480
+1753.793024 29.82 536576
+1754.333696 29.59 540672
+1754.874368 29.59 540672
+1755.419136 29.37 544768
+1755.968000 29.15 548864
+1756.520960 28.94 552960
+1757.073920 28.94 552960
+1757.630976 28.72 557056
+1758.192128 28.51 561152
+1758.757376 28.31 565248
+1759.326720 28.10 569344
+1759.900160 27.90 573440
+1760.473600 27.90 573440
+1761.051136 27.70 577536
+1761.636864 27.32 585728
+1762.226688 27.13 589824
+1762.816512 27.13 589824
+1763.410432 26.94 593920
+1764.012544 26.57 602112
+1764.614656 26.57 602112
+1765.220864 26.39 606208
+1765.835264 26.04 614400
+1766.453760 25.87 618496
+1767.076352 25.70 622592
+1767.703040 25.53 626688
+1768.333824 25.37 630784
+1768.972800 25.04 638976
+1769.615872 24.88 643072
+1770.263040 24.72 647168
+1770.914304 24.57 651264
+1771.573760 24.26 659456
+1772.237312 24.11 663552
+1772.904960 23.96 667648
+1773.580800 23.67 675840
+1774.260736 23.53 679936
+1774.948864 23.25 688128
+1775.645184 22.98 696320
+1776.349696 22.71 704512
+1777.058304 22.58 708608
+1777.771008 22.45 712704
+1778.491904 22.19 720896
+1779.220992 21.95 729088
+1779.958272 21.70 737280
+1780.703744 21.46 745472
+1781.457408 21.23 753664
+1782.219264 21.00 761856
+1782.989312 20.78 770048
+1783.767552 20.56 778240
+1784.553984 20.35 786432
+1785.356800 19.93 802816
+1786.167808 19.73 811008
+1786.987008 19.53 819200
+1787.818496 19.24 831488
+1788.658176 19.05 839680
+1789.514240 18.69 856064
+1790.382592 18.43 868352
+1791.259136 18.25 876544
+1792.152064 17.92 892928
+1793.057280 17.68 905216
+1793.978880 17.36 921600
+1794.916864 17.06 937984
+1795.875328 16.69 958464
+1796.850176 16.41 974848
+1797.845504 16.08 995328
+1798.857216 15.81 1011712
+1799.889408 15.50 1032192
+1800.946176 15.14 1056768
+1802.027520 14.80 1081344
+1803.133440 14.47 1105920
+1804.263936 14.15 1130496
+1805.419008 13.85 1155072
+1806.606848 13.47 1187840
+1807.835648 13.02 1228800
+1809.097216 12.68 1261568
+1810.399744 12.28 1302528
+1811.751424 11.84 1351680
+1813.160448 11.36 1409024
+1814.618624 10.97 1458176
+1816.142336 10.50 1523712
+1817.747968 9.96 1605632
+1819.427328 9.53 1679360
+1821.213184 8.96 1785856
+1823.130112 8.35 1916928
+1825.194496 7.75 2064384
+1827.455488 7.08 2260992
+1829.978624 6.34 2523136
+1832.894976 5.49 2916352
+1836.466688 4.48 3571712
+1841.512960 3.17 5046272
+1848.656384 2.24 7143424
+EOF
+plot $data using 1:2 with linespoints
+pause -1
@@ -0,0 +1,11064 @@
+$data <<EOF
+0.159744 100.16 159744
+0.272384 142.05 112640
+0.364544 173.61 92160
+0.444416 200.32 79872
+0.516096 223.21 71680
+0.581376 245.10 65280
+0.641792 264.83 60416
+0.698112 284.09 56320
+0.751360 300.48 53248
+0.802048 315.66 50688
+0.850176 332.45 48128
+0.896256 347.22 46080
+0.940800 359.20 44544
+0.983552 374.25 42752
+1.024768 388.20 41216
+1.064704 400.64 39936
+1.103616 411.18 38912
+1.141248 425.17 37632
+1.177856 437.06 36608
+1.213696 446.43 35840
+1.248512 459.56 34816
+1.282560 469.92 34048
+1.315840 480.77 33280
+1.348480 490.20 32640
+1.380480 500.00 32000
+1.411968 508.13 31488
+1.442688 520.83 30720
+1.472896 529.66 30208
+1.502464 541.13 29568
+1.531648 548.25 29184
+1.560320 558.04 28672
+1.588480 568.18 28160
+1.616256 576.04 27776
+1.643648 584.11 27392
+1.670656 592.42 27008
+1.697280 600.96 26624
+1.723520 609.76 26240
+1.749376 618.81 25856
+1.774976 625.00 25600
+1.800320 631.31 25344
+1.825152 644.33 24832
+1.849728 651.04 24576
+1.874048 657.89 24320
+1.898112 664.89 24064
+1.921920 672.04 23808
+1.945472 679.35 23552
+1.968768 686.81 23296
+1.991808 694.44 23040
+2.014592 702.25 22784
+2.037120 710.23 22528
+2.059392 718.39 22272
+2.081664 718.39 22272
+2.103680 726.74 22016
+2.125440 735.29 21760
+2.146944 744.05 21504
+2.168320 748.50 21376
+2.189440 757.58 21120
+2.210304 766.87 20864
+2.231168 766.87 20864
+2.251776 776.40 20608
+2.272256 781.25 20480
+2.292480 791.14 20224
+2.312576 796.18 20096
+2.332544 801.28 19968
+2.352384 806.45 19840
+2.371968 816.99 19584
+2.391424 822.37 19456
+2.410880 822.37 19456
+2.430080 833.33 19200
+2.449152 838.93 19072
+2.468096 844.59 18944
+2.486912 850.34 18816
+2.505600 856.16 18688
+2.524160 862.07 18560
+2.542592 868.06 18432
+2.560896 874.13 18304
+2.579072 880.28 18176
+2.597120 886.52 18048
+2.615040 892.86 17920
+2.632960 892.86 17920
+2.650752 899.28 17792
+2.668288 912.41 17536
+2.685824 912.41 17536
+2.703232 919.12 17408
+2.720512 925.93 17280
+2.737792 925.93 17280
+2.754944 932.84 17152
+2.771968 939.85 17024
+2.788864 946.97 16896
+2.805760 946.97 16896
+2.822528 954.20 16768
+2.839168 961.54 16640
+2.855680 968.99 16512
+2.872192 968.99 16512
+2.888576 976.56 16384
+2.904896 980.39 16320
+2.921152 984.25 16256
+2.937280 992.06 16128
+2.953344 996.02 16064
+2.969344 1000.00 16000
+2.985216 1008.06 15872
+3.001024 1012.15 15808
+3.016768 1016.26 15744
+3.032512 1016.26 15744
+3.048128 1024.59 15616
+3.063680 1028.81 15552
+3.079168 1033.06 15488
+3.094528 1041.67 15360
+3.109824 1046.03 15296
+3.125056 1050.42 15232
+3.140288 1050.42 15232
+3.155392 1059.32 15104
+3.170432 1063.83 15040
+3.185408 1068.38 14976
+3.200320 1072.96 14912
+3.215104 1082.25 14784
+3.229888 1082.25 14784
+3.244608 1086.96 14720
+3.259264 1091.70 14656
+3.273856 1096.49 14592
+3.288448 1096.49 14592
+3.302912 1106.19 14464
+3.317312 1111.11 14400
+3.331648 1116.07 14336
+3.345984 1116.07 14336
+3.360256 1121.08 14272
+3.374400 1131.22 14144
+3.388480 1136.36 14080
+3.402560 1136.36 14080
+3.416576 1141.55 14016
+3.430528 1146.79 13952
+3.444416 1152.07 13888
+3.458304 1152.07 13888
+3.472128 1157.41 13824
+3.485824 1168.22 13696
+3.499520 1168.22 13696
+3.513152 1173.71 13632
+3.526720 1179.25 13568
+3.540288 1179.25 13568
+3.553792 1184.83 13504
+3.567232 1190.48 13440
+3.580672 1190.48 13440
+3.594048 1196.17 13376
+3.607360 1201.92 13312
+3.620672 1201.92 13312
+3.633856 1213.59 13184
+3.647040 1213.59 13184
+3.660160 1219.51 13120
+3.673216 1225.49 13056
+3.686272 1225.49 13056
+3.699264 1231.53 12992
+3.712192 1237.62 12928
+3.725120 1237.62 12928
+3.737984 1243.78 12864
+3.750848 1243.78 12864
+3.763648 1250.00 12800
+3.776384 1256.28 12736
+3.789120 1256.28 12736
+3.801792 1262.63 12672
+3.814464 1262.63 12672
+3.827072 1269.04 12608
+3.839680 1269.04 12608
+3.852224 1275.51 12544
+3.864640 1288.66 12416
+3.877056 1288.66 12416
+3.889408 1295.34 12352
+3.901760 1295.34 12352
+3.914048 1302.08 12288
+3.926336 1302.08 12288
+3.938560 1308.90 12224
+3.950784 1308.90 12224
+3.962944 1315.79 12160
+3.975104 1315.79 12160
+3.987200 1322.75 12096
+3.999232 1329.79 12032
+4.011264 1329.79 12032
+4.023232 1336.90 11968
+4.035200 1336.90 11968
+4.047104 1344.09 11904
+4.059008 1344.09 11904
+4.070848 1351.35 11840
+4.082688 1351.35 11840
+4.094464 1358.70 11776
+4.106240 1358.70 11776
+4.117952 1366.12 11712
+4.129664 1366.12 11712
+4.141312 1373.63 11648
+4.152960 1373.63 11648
+4.164544 1381.22 11584
+4.176128 1381.22 11584
+4.187648 1388.89 11520
+4.199168 1388.89 11520
+4.210624 1396.65 11456
+4.222080 1396.65 11456
+4.233472 1404.49 11392
+4.244864 1404.49 11392
+4.256256 1404.49 11392
+4.267584 1412.43 11328
+4.278912 1412.43 11328
+4.290176 1420.45 11264
+4.301440 1420.45 11264
+4.312640 1428.57 11200
+4.323840 1428.57 11200
+4.334976 1436.78 11136
+4.346112 1436.78 11136
+4.357248 1436.78 11136
+4.368384 1436.78 11136
+4.379520 1436.78 11136
+4.390592 1445.09 11072
+4.401664 1445.09 11072
+4.412672 1453.49 11008
+4.423680 1453.49 11008
+4.434624 1461.99 10944
+4.445568 1461.99 10944
+4.456448 1470.59 10880
+4.467328 1470.59 10880
+4.478208 1470.59 10880
+4.489024 1479.29 10816
+4.499840 1479.29 10816
+4.510592 1488.10 10752
+4.521344 1488.10 10752
+4.532096 1488.10 10752
+4.542784 1497.01 10688
+4.553472 1497.01 10688
+4.564096 1506.02 10624
+4.574720 1506.02 10624
+4.585280 1515.15 10560
+4.595840 1515.15 10560
+4.606400 1515.15 10560
+4.616896 1524.39 10496
+4.627392 1524.39 10496
+4.637824 1533.74 10432
+4.648256 1533.74 10432
+4.658688 1533.74 10432
+4.669120 1533.74 10432
+4.679552 1533.74 10432
+4.689984 1533.74 10432
+4.700352 1543.21 10368
+4.710720 1543.21 10368
+4.721024 1552.80 10304
+4.731328 1552.80 10304
+4.741632 1552.80 10304
+4.751872 1562.50 10240
+4.762112 1562.50 10240
+4.772288 1572.33 10176
+4.782464 1572.33 10176
+4.792640 1572.33 10176
+4.802752 1582.28 10112
+4.812864 1582.28 10112
+4.822976 1582.28 10112
+4.833024 1592.36 10048
+4.843072 1592.36 10048
+4.853120 1592.36 10048
+4.863168 1592.36 10048
+4.873216 1592.36 10048
+4.883200 1602.56 9984
+4.893184 1602.56 9984
+4.903168 1602.56 9984
+4.913152 1602.56 9984
+4.923072 1612.90 9920
+4.932992 1612.90 9920
+4.942848 1623.38 9856
+4.952704 1623.38 9856
+4.962496 1633.99 9792
+4.972288 1633.99 9792
+4.982080 1633.99 9792
+4.991872 1633.99 9792
+5.001600 1644.74 9728
+5.011328 1644.74 9728
+5.021056 1644.74 9728
+5.030784 1644.74 9728
+5.040512 1644.74 9728
+5.050240 1644.74 9728
+5.059904 1655.63 9664
+5.069568 1655.63 9664
+5.079168 1666.67 9600
+5.088768 1666.67 9600
+5.098368 1666.67 9600
+5.107968 1666.67 9600
+5.117504 1677.85 9536
+5.127040 1677.85 9536
+5.136512 1689.19 9472
+5.145984 1689.19 9472
+5.155456 1689.19 9472
+5.164928 1689.19 9472
+5.174336 1700.68 9408
+5.183744 1700.68 9408
+5.193152 1700.68 9408
+5.202560 1700.68 9408
+5.211968 1700.68 9408
+5.221376 1700.68 9408
+5.230720 1712.33 9344
+5.240064 1712.33 9344
+5.249408 1712.33 9344
+5.258752 1712.33 9344
+5.268032 1724.14 9280
+5.277312 1724.14 9280
+5.286528 1736.11 9216
+5.295744 1736.11 9216
+5.304960 1736.11 9216
+5.314176 1736.11 9216
+5.323392 1736.11 9216
+5.332608 1736.11 9216
+5.341760 1748.25 9152
+5.350912 1748.25 9152
+5.360064 1748.25 9152
+5.369216 1748.25 9152
+5.378304 1760.56 9088
+5.387392 1760.56 9088
+5.396480 1760.56 9088
+5.405568 1760.56 9088
+5.414592 1773.05 9024
+5.423616 1773.05 9024
+5.432576 1785.71 8960
+5.441536 1785.71 8960
+5.450496 1785.71 8960
+5.459456 1785.71 8960
+5.468416 1785.71 8960
+5.477376 1785.71 8960
+5.486336 1785.71 8960
+5.495296 1785.71 8960
+5.504192 1798.56 8896
+5.513088 1798.56 8896
+5.521984 1798.56 8896
+5.530880 1798.56 8896
+5.539712 1811.59 8832
+5.548544 1811.59 8832
+5.557312 1824.82 8768
+5.566080 1824.82 8768
+5.574848 1824.82 8768
+5.583616 1824.82 8768
+5.592384 1824.82 8768
+5.601152 1824.82 8768
+5.609920 1824.82 8768
+5.618688 1824.82 8768
+5.627392 1838.24 8704
+5.636096 1838.24 8704
+5.644800 1838.24 8704
+5.653504 1838.24 8704
+5.662144 1851.85 8640
+5.670784 1851.85 8640
+5.679424 1851.85 8640
+5.688064 1851.85 8640
+5.696704 1851.85 8640
+5.705344 1851.85 8640
+5.713984 1851.85 8640
+5.722624 1851.85 8640
+5.731200 1865.67 8576
+5.739776 1865.67 8576
+5.748288 1879.70 8512
+5.756800 1879.70 8512
+5.765312 1879.70 8512
+5.773824 1879.70 8512
+5.782272 1893.94 8448
+5.790720 1893.94 8448
+5.799168 1893.94 8448
+5.807616 1893.94 8448
+5.816064 1893.94 8448
+5.824512 1893.94 8448
+5.832960 1893.94 8448
+5.841408 1893.94 8448
+5.849792 1908.40 8384
+5.858176 1908.40 8384
+5.866560 1908.40 8384
+5.874944 1908.40 8384
+5.883264 1923.08 8320
+5.891584 1923.08 8320
+5.899904 1923.08 8320
+5.908224 1923.08 8320
+5.916480 1937.98 8256
+5.924736 1937.98 8256
+5.932992 1937.98 8256
+5.941248 1937.98 8256
+5.949504 1937.98 8256
+5.957760 1937.98 8256
+5.966016 1937.98 8256
+5.974272 1937.98 8256
+5.982464 1953.12 8192
+5.990656 1953.12 8192
+5.998848 1953.12 8192
+6.007040 1953.12 8192
+6.015200 1960.78 8160
+6.023360 1960.78 8160
+6.031520 1960.78 8160
+6.039680 1960.78 8160
+6.047808 1968.50 8128
+6.055936 1968.50 8128
+6.064064 1968.50 8128
+6.072192 1968.50 8128
+6.080256 1984.13 8064
+6.088320 1984.13 8064
+6.096384 1984.13 8064
+6.104448 1984.13 8064
+6.112512 1984.13 8064
+6.120576 1984.13 8064
+6.128608 1992.03 8032
+6.136640 1992.03 8032
+6.144672 1992.03 8032
+6.152704 1992.03 8032
+6.160704 2000.00 8000
+6.176704 2000.00 8000
+6.192576 2016.13 7936
+6.208448 2016.13 7936
+6.224256 2024.29 7904
+6.240064 2024.29 7904
+6.255808 2032.52 7872
+6.271552 2032.52 7872
+6.287296 2032.52 7872
+6.302912 2049.18 7808
+6.318528 2049.18 7808
+6.334080 2057.61 7776
+6.349632 2057.61 7776
+6.365120 2066.12 7744
+6.380608 2066.12 7744
+6.395968 2083.33 7680
+6.411328 2083.33 7680
+6.426688 2083.33 7680
+6.441984 2092.05 7648
+6.457280 2092.05 7648
+6.472512 2100.84 7616
+6.487744 2100.84 7616
+6.502976 2100.84 7616
+6.518080 2118.64 7552
+6.533184 2118.64 7552
+6.548224 2127.66 7520
+6.563264 2127.66 7520
+6.578240 2136.75 7488
+6.593216 2136.75 7488
+6.608192 2136.75 7488
+6.623104 2145.92 7456
+6.638016 2145.92 7456
+6.652800 2164.50 7392
+6.667584 2164.50 7392
+6.682368 2164.50 7392
+6.697088 2173.91 7360
+6.711808 2173.91 7360
+6.726528 2173.91 7360
+6.741184 2183.41 7328
+6.755840 2183.41 7328
+6.770432 2192.98 7296
+6.785024 2192.98 7296
+6.799616 2192.98 7296
+6.814080 2212.39 7232
+6.828544 2212.39 7232
+6.842944 2222.22 7200
+6.857344 2222.22 7200
+6.871744 2222.22 7200
+6.886080 2232.14 7168
+6.900416 2232.14 7168
+6.914752 2232.14 7168
+6.929024 2242.15 7136
+6.943296 2242.15 7136
+6.957440 2262.44 7072
+6.971584 2262.44 7072
+6.985728 2262.44 7072
+6.999808 2272.73 7040
+7.013888 2272.73 7040
+7.027968 2272.73 7040
+7.042048 2272.73 7040
+7.056064 2283.11 7008
+7.070080 2283.11 7008
+7.084032 2293.58 6976
+7.097984 2293.58 6976
+7.111872 2304.15 6944
+7.125760 2304.15 6944
+7.139648 2304.15 6944
+7.153536 2304.15 6944
+7.167360 2314.81 6912
+7.181184 2314.81 6912
+7.194880 2336.45 6848
+7.208576 2336.45 6848
+7.222272 2336.45 6848
+7.235968 2336.45 6848
+7.249600 2347.42 6816
+7.263232 2347.42 6816
+7.276800 2358.49 6784
+7.290368 2358.49 6784
+7.303936 2358.49 6784
+7.317504 2358.49 6784
+7.331008 2369.67 6752
+7.344512 2369.67 6752
+7.357952 2380.95 6720
+7.371392 2380.95 6720
+7.384832 2380.95 6720
+7.398272 2380.95 6720
+7.411648 2392.34 6688
+7.425024 2392.34 6688
+7.438336 2403.85 6656
+7.451648 2403.85 6656
+7.464960 2403.85 6656
+7.478272 2403.85 6656
+7.491456 2427.18 6592
+7.504640 2427.18 6592
+7.517824 2427.18 6592
+7.531008 2427.18 6592
+7.544128 2439.02 6560
+7.557248 2439.02 6560
+7.570304 2450.98 6528
+7.583360 2450.98 6528
+7.596416 2450.98 6528
+7.609472 2450.98 6528
+7.622464 2463.05 6496
+7.635456 2463.05 6496
+7.648384 2475.25 6464
+7.661312 2475.25 6464
+7.674240 2475.25 6464
+7.687168 2475.25 6464
+7.700032 2487.56 6432
+7.712896 2487.56 6432
+7.725760 2487.56 6432
+7.738624 2487.56 6432
+7.751424 2500.00 6400
+7.764224 2500.00 6400
+7.776960 2512.56 6368
+7.789696 2512.56 6368
+7.802432 2512.56 6368
+7.815168 2512.56 6368
+7.827840 2525.25 6336
+7.840512 2525.25 6336
+7.853184 2525.25 6336
+7.865856 2525.25 6336
+7.878464 2538.07 6304
+7.891072 2538.07 6304
+7.903680 2538.07 6304
+7.916288 2538.07 6304
+7.928832 2551.02 6272
+7.941376 2551.02 6272
+7.953792 2577.32 6208
+7.966208 2577.32 6208
+7.978624 2577.32 6208
+7.991040 2577.32 6208
+8.003392 2590.67 6176
+8.015744 2590.67 6176
+8.028096 2590.67 6176
+8.040448 2590.67 6176
+8.052736 2604.17 6144
+8.065024 2604.17 6144
+8.077312 2604.17 6144
+8.089600 2604.17 6144
+8.101824 2617.80 6112
+8.114048 2617.80 6112
+8.126272 2617.80 6112
+8.138496 2617.80 6112
+8.150656 2631.58 6080
+8.162816 2631.58 6080
+8.174976 2631.58 6080
+8.187136 2631.58 6080
+8.199232 2645.50 6048
+8.211328 2645.50 6048
+8.223360 2659.57 6016
+8.235392 2659.57 6016
+8.247424 2659.57 6016
+8.259456 2659.57 6016
+8.271424 2673.80 5984
+8.283392 2673.80 5984
+8.295360 2673.80 5984
+8.307328 2673.80 5984
+8.319232 2688.17 5952
+8.331136 2688.17 5952
+8.343040 2688.17 5952
+8.354944 2688.17 5952
+8.366784 2702.70 5920
+8.378624 2702.70 5920
+8.390464 2702.70 5920
+8.402304 2702.70 5920
+8.414080 2717.39 5888
+8.425856 2717.39 5888
+8.437632 2717.39 5888
+8.449408 2717.39 5888
+8.461120 2732.24 5856
+8.472832 2732.24 5856
+8.484544 2732.24 5856
+8.496256 2732.24 5856
+8.507904 2747.25 5824
+8.519552 2747.25 5824
+8.531200 2747.25 5824
+8.542848 2747.25 5824
+8.554432 2762.43 5792
+8.566016 2762.43 5792
+8.577600 2762.43 5792
+8.589184 2762.43 5792
+8.600704 2777.78 5760
+8.612224 2777.78 5760
+8.623744 2777.78 5760
+8.635264 2777.78 5760
+8.646720 2793.30 5728
+8.658176 2793.30 5728
+8.669632 2793.30 5728
+8.681088 2793.30 5728
+8.692480 2808.99 5696
+8.703872 2808.99 5696
+8.715264 2808.99 5696
+8.726656 2808.99 5696
+8.738048 2808.99 5696
+8.749440 2808.99 5696
+8.760768 2824.86 5664
+8.772096 2824.86 5664
+8.783424 2824.86 5664
+8.794752 2824.86 5664
+8.806016 2840.91 5632
+8.817280 2840.91 5632
+8.828544 2840.91 5632
+8.839808 2840.91 5632
+8.851008 2857.14 5600
+8.862208 2857.14 5600
+8.873408 2857.14 5600
+8.884608 2857.14 5600
+8.895744 2873.56 5568
+8.906880 2873.56 5568
+8.918016 2873.56 5568
+8.929152 2873.56 5568
+8.940288 2873.56 5568
+8.951424 2873.56 5568
+8.962560 2873.56 5568
+8.973696 2873.56 5568
+8.984832 2873.56 5568
+8.995968 2873.56 5568
+9.007040 2890.17 5536
+9.018112 2890.17 5536
+9.029184 2890.17 5536
+9.040256 2890.17 5536
+9.051264 2906.98 5504
+9.062272 2906.98 5504
+9.073280 2906.98 5504
+9.084288 2906.98 5504
+9.095232 2923.98 5472
+9.106176 2923.98 5472
+9.117120 2923.98 5472
+9.128064 2923.98 5472
+9.138944 2941.18 5440
+9.149824 2941.18 5440
+9.160704 2941.18 5440
+9.171584 2941.18 5440
+9.182464 2941.18 5440
+9.193344 2941.18 5440
+9.204160 2958.58 5408
+9.214976 2958.58 5408
+9.225792 2958.58 5408
+9.236608 2958.58 5408
+9.247360 2976.19 5376
+9.258112 2976.19 5376
+9.268864 2976.19 5376
+9.279616 2976.19 5376
+9.290368 2976.19 5376
+9.301120 2976.19 5376
+9.311808 2994.01 5344
+9.322496 2994.01 5344
+9.333184 2994.01 5344
+9.343872 2994.01 5344
+9.354496 3012.05 5312
+9.370432 3012.05 5312
+9.386368 3012.05 5312
+9.402208 3030.30 5280
+9.418048 3030.30 5280
+9.433888 3030.30 5280
+9.449728 3030.30 5280
+9.465472 3048.78 5248
+9.481216 3048.78 5248
+9.496960 3048.78 5248
+9.512608 3067.48 5216
+9.528256 3067.48 5216
+9.543904 3067.48 5216
+9.559552 3067.48 5216
+9.575200 3067.48 5216
+9.590848 3067.48 5216
+9.606496 3067.48 5216
+9.622144 3067.48 5216
+9.637696 3086.42 5184
+9.653248 3086.42 5184
+9.668704 3105.59 5152
+9.684160 3105.59 5152
+9.699616 3105.59 5152
+9.715072 3105.59 5152
+9.730432 3125.00 5120
+9.745792 3125.00 5120
+9.761152 3125.00 5120
+9.776416 3144.65 5088
+9.791680 3144.65 5088
+9.806944 3144.65 5088
+9.822208 3144.65 5088
+9.837376 3164.56 5056
+9.852544 3164.56 5056
+9.867712 3164.56 5056
+9.882880 3164.56 5056
+9.897952 3184.71 5024
+9.913024 3184.71 5024
+9.928096 3184.71 5024
+9.943168 3184.71 5024
+9.958240 3184.71 5024
+9.973312 3184.71 5024
+9.988384 3184.71 5024
+10.003360 3205.13 4992
+10.018336 3205.13 4992
+10.033312 3205.13 4992
+10.048288 3205.13 4992
+10.063264 3205.13 4992
+10.078144 3225.81 4960
+10.093024 3225.81 4960
+10.107904 3225.81 4960
+10.122688 3246.75 4928
+10.137472 3246.75 4928
+10.152160 3267.97 4896
+10.166848 3267.97 4896
+10.181536 3267.97 4896
+10.196224 3267.97 4896
+10.210912 3267.97 4896
+10.225600 3267.97 4896
+10.240192 3289.47 4864
+10.254784 3289.47 4864
+10.269376 3289.47 4864
+10.283968 3289.47 4864
+10.298560 3289.47 4864
+10.313152 3289.47 4864
+10.327744 3289.47 4864
+10.342336 3289.47 4864
+10.356832 3311.26 4832
+10.371328 3311.26 4832
+10.385728 3333.33 4800
+10.400128 3333.33 4800
+10.414528 3333.33 4800
+10.428928 3333.33 4800
+10.443328 3333.33 4800
+10.457728 3333.33 4800
+10.472032 3355.70 4768
+10.486336 3355.70 4768
+10.500544 3378.38 4736
+10.514752 3378.38 4736
+10.528960 3378.38 4736
+10.543168 3378.38 4736
+10.557376 3378.38 4736
+10.571584 3378.38 4736
+10.585696 3401.36 4704
+10.599808 3401.36 4704
+10.613920 3401.36 4704
+10.628032 3401.36 4704
+10.642144 3401.36 4704
+10.656256 3401.36 4704
+10.670368 3401.36 4704
+10.684480 3401.36 4704
+10.698496 3424.66 4672
+10.712512 3424.66 4672
+10.726528 3424.66 4672
+10.740544 3424.66 4672
+10.754560 3424.66 4672
+10.768480 3448.28 4640
+10.782400 3448.28 4640
+10.796320 3448.28 4640
+10.810144 3472.22 4608
+10.823968 3472.22 4608
+10.837792 3472.22 4608
+10.851616 3472.22 4608
+10.865440 3472.22 4608
+10.879264 3472.22 4608
+10.893088 3472.22 4608
+10.906912 3472.22 4608
+10.920640 3496.50 4576
+10.934368 3496.50 4576
+10.948096 3496.50 4576
+10.961824 3496.50 4576
+10.975552 3496.50 4576
+10.989184 3521.13 4544
+11.002816 3521.13 4544
+11.016448 3521.13 4544
+11.030080 3521.13 4544
+11.043712 3521.13 4544
+11.057248 3546.10 4512
+11.070784 3546.10 4512
+11.084320 3546.10 4512
+11.097760 3571.43 4480
+11.111200 3571.43 4480
+11.124640 3571.43 4480
+11.138080 3571.43 4480
+11.151520 3571.43 4480
+11.164960 3571.43 4480
+11.178400 3571.43 4480
+11.191840 3571.43 4480
+11.205280 3571.43 4480
+11.218720 3571.43 4480
+11.232160 3571.43 4480
+11.245504 3597.12 4448
+11.258848 3597.12 4448
+11.272192 3597.12 4448
+11.285536 3597.12 4448
+11.298880 3597.12 4448
+11.312128 3623.19 4416
+11.325376 3623.19 4416
+11.338624 3623.19 4416
+11.351776 3649.64 4384
+11.364928 3649.64 4384
+11.378080 3649.64 4384
+11.391232 3649.64 4384
+11.404384 3649.64 4384
+11.417536 3649.64 4384
+11.430688 3649.64 4384
+11.443840 3649.64 4384
+11.456992 3649.64 4384
+11.470144 3649.64 4384
+11.483200 3676.47 4352
+11.496256 3676.47 4352
+11.509312 3676.47 4352
+11.522368 3676.47 4352
+11.535424 3676.47 4352
+11.548480 3676.47 4352
+11.561440 3703.70 4320
+11.574400 3703.70 4320
+11.587360 3703.70 4320
+11.600320 3703.70 4320
+11.613280 3703.70 4320
+11.626240 3703.70 4320
+11.639200 3703.70 4320
+11.652160 3703.70 4320
+11.665120 3703.70 4320
+11.678080 3703.70 4320
+11.690944 3731.34 4288
+11.703808 3731.34 4288
+11.716672 3731.34 4288
+11.729440 3759.40 4256
+11.742208 3759.40 4256
+11.754976 3759.40 4256
+11.767744 3759.40 4256
+11.780512 3759.40 4256
+11.793184 3787.88 4224
+11.805856 3787.88 4224
+11.818528 3787.88 4224
+11.831200 3787.88 4224
+11.843872 3787.88 4224
+11.856544 3787.88 4224
+11.869216 3787.88 4224
+11.881888 3787.88 4224
+11.894560 3787.88 4224
+11.907232 3787.88 4224
+11.919904 3787.88 4224
+11.932480 3816.79 4192
+11.945056 3816.79 4192
+11.957632 3816.79 4192
+11.970208 3816.79 4192
+11.982784 3816.79 4192
+11.995264 3846.15 4160
+12.007744 3846.15 4160
+12.020224 3846.15 4160
+12.032704 3846.15 4160
+12.045184 3846.15 4160
+12.057664 3846.15 4160
+12.070048 3875.97 4128
+12.082432 3875.97 4128
+12.094816 3875.97 4128
+12.107200 3875.97 4128
+12.119584 3875.97 4128
+12.131968 3875.97 4128
+12.144352 3875.97 4128
+12.156736 3875.97 4128
+12.169120 3875.97 4128
+12.181504 3875.97 4128
+12.193792 3906.25 4096
+12.206080 3906.25 4096
+12.218368 3906.25 4096
+12.230656 3906.25 4096
+12.242944 3906.25 4096
+12.255232 3906.25 4096
+12.267472 3921.57 4080
+12.279712 3921.57 4080
+12.291952 3921.57 4080
+12.304192 3921.57 4080
+12.316432 3921.57 4080
+12.328624 3937.01 4064
+12.340816 3937.01 4064
+12.353008 3937.01 4064
+12.365200 3937.01 4064
+12.377392 3937.01 4064
+12.389488 3968.25 4032
+12.401584 3968.25 4032
+12.413680 3968.25 4032
+12.425776 3968.25 4032
+12.437872 3968.25 4032
+12.449968 3968.25 4032
+12.462064 3968.25 4032
+12.474160 3968.25 4032
+12.486208 3984.06 4016
+12.498256 3984.06 4016
+12.510304 3984.06 4016
+12.522352 3984.06 4016
+12.534400 3984.06 4016
+12.546448 3984.06 4016
+12.558448 4000.00 4000
+12.574448 4000.00 4000
+12.590448 4000.00 4000
+12.606448 4000.00 4000
+12.622320 4032.26 3968
+12.638192 4032.26 3968
+12.654064 4032.26 3968
+12.669936 4032.26 3968
+12.685744 4048.58 3952
+12.701552 4048.58 3952
+12.717360 4048.58 3952
+12.733168 4048.58 3952
+12.748912 4065.04 3936
+12.764656 4065.04 3936
+12.780400 4065.04 3936
+12.796144 4065.04 3936
+12.811888 4065.04 3936
+12.827632 4065.04 3936
+12.843248 4098.36 3904
+12.858864 4098.36 3904
+12.874480 4098.36 3904
+12.890096 4098.36 3904
+12.905648 4115.23 3888
+12.921200 4115.23 3888
+12.936752 4115.23 3888
+12.952304 4115.23 3888
+12.967792 4132.23 3872
+12.983280 4132.23 3872
+12.998768 4132.23 3872
+13.014256 4132.23 3872
+13.029616 4166.67 3840
+13.044976 4166.67 3840
+13.060336 4166.67 3840
+13.075696 4166.67 3840
+13.091056 4166.67 3840
+13.106416 4166.67 3840
+13.121712 4184.10 3824
+13.137008 4184.10 3824
+13.152304 4184.10 3824
+13.167600 4184.10 3824
+13.182832 4201.68 3808
+13.198064 4201.68 3808
+13.213296 4201.68 3808
+13.228528 4201.68 3808
+13.243760 4201.68 3808
+13.258992 4201.68 3808
+13.274096 4237.29 3776
+13.289200 4237.29 3776
+13.304304 4237.29 3776
+13.319408 4237.29 3776
+13.334448 4255.32 3760
+13.349488 4255.32 3760
+13.364528 4255.32 3760
+13.379568 4255.32 3760
+13.394544 4273.50 3744
+13.409520 4273.50 3744
+13.424496 4273.50 3744
+13.439472 4273.50 3744
+13.454448 4273.50 3744
+13.469424 4273.50 3744
+13.484336 4291.85 3728
+13.499248 4291.85 3728
+13.514160 4291.85 3728
+13.529072 4291.85 3728
+13.543856 4329.00 3696
+13.558640 4329.00 3696
+13.573424 4329.00 3696
+13.588208 4329.00 3696
+13.602992 4329.00 3696
+13.617776 4329.00 3696
+13.632496 4347.83 3680
+13.647216 4347.83 3680
+13.661936 4347.83 3680
+13.676656 4347.83 3680
+13.691376 4347.83 3680
+13.706096 4347.83 3680
+13.720752 4366.81 3664
+13.735408 4366.81 3664
+13.750064 4366.81 3664
+13.764720 4366.81 3664
+13.779312 4385.96 3648
+13.793904 4385.96 3648
+13.808496 4385.96 3648
+13.823088 4385.96 3648
+13.837680 4385.96 3648
+13.852272 4385.96 3648
+13.866736 4424.78 3616
+13.881200 4424.78 3616
+13.895664 4424.78 3616
+13.910128 4424.78 3616
+13.924528 4444.44 3600
+13.938928 4444.44 3600
+13.953328 4444.44 3600
+13.967728 4444.44 3600
+13.982128 4444.44 3600
+13.996528 4444.44 3600
+14.010864 4464.29 3584
+14.025200 4464.29 3584
+14.039536 4464.29 3584
+14.053872 4464.29 3584
+14.068208 4464.29 3584
+14.082544 4464.29 3584
+14.096816 4484.30 3568
+14.111088 4484.30 3568
+14.125360 4484.30 3568
+14.139632 4484.30 3568
+14.153776 4524.89 3536
+14.167920 4524.89 3536
+14.182064 4524.89 3536
+14.196208 4524.89 3536
+14.210352 4524.89 3536
+14.224496 4524.89 3536
+14.238576 4545.45 3520
+14.252656 4545.45 3520
+14.266736 4545.45 3520
+14.280816 4545.45 3520
+14.294896 4545.45 3520
+14.308976 4545.45 3520
+14.323056 4545.45 3520
+14.337136 4545.45 3520
+14.351152 4566.21 3504
+14.365168 4566.21 3504
+14.379184 4566.21 3504
+14.393200 4566.21 3504
+14.407152 4587.16 3488
+14.421104 4587.16 3488
+14.435056 4587.16 3488
+14.449008 4587.16 3488
+14.462896 4608.29 3472
+14.476784 4608.29 3472
+14.490672 4608.29 3472
+14.504560 4608.29 3472
+14.518448 4608.29 3472
+14.532336 4608.29 3472
+14.546224 4608.29 3472
+14.560112 4608.29 3472
+14.573936 4629.63 3456
+14.587760 4629.63 3456
+14.601584 4629.63 3456
+14.615408 4629.63 3456
+14.629104 4672.90 3424
+14.642800 4672.90 3424
+14.656496 4672.90 3424
+14.670192 4672.90 3424
+14.683888 4672.90 3424
+14.697584 4672.90 3424
+14.711280 4672.90 3424
+14.724976 4672.90 3424
+14.738608 4694.84 3408
+14.752240 4694.84 3408
+14.765872 4694.84 3408
+14.779504 4694.84 3408
+14.793072 4716.98 3392
+14.806640 4716.98 3392
+14.820208 4716.98 3392
+14.833776 4716.98 3392
+14.847344 4716.98 3392
+14.860912 4716.98 3392
+14.874480 4716.98 3392
+14.888048 4716.98 3392
+14.901552 4739.34 3376
+14.915056 4739.34 3376
+14.928560 4739.34 3376
+14.942064 4739.34 3376
+14.955504 4761.90 3360
+14.968944 4761.90 3360
+14.982384 4761.90 3360
+14.995824 4761.90 3360
+15.009264 4761.90 3360
+15.022704 4761.90 3360
+15.036144 4761.90 3360
+15.049584 4761.90 3360
+15.062960 4784.69 3344
+15.076336 4784.69 3344
+15.089712 4784.69 3344
+15.103088 4784.69 3344
+15.116400 4807.69 3328
+15.129712 4807.69 3328
+15.143024 4807.69 3328
+15.156336 4807.69 3328
+15.169648 4807.69 3328
+15.182960 4807.69 3328
+15.196272 4807.69 3328
+15.209584 4807.69 3328
+15.222768 4854.37 3296
+15.235952 4854.37 3296
+15.249136 4854.37 3296
+15.262320 4854.37 3296
+15.275504 4854.37 3296
+15.288688 4854.37 3296
+15.301872 4854.37 3296
+15.315056 4854.37 3296
+15.328176 4878.05 3280
+15.341296 4878.05 3280
+15.354416 4878.05 3280
+15.367536 4878.05 3280
+15.380592 4901.96 3264
+15.393648 4901.96 3264
+15.406704 4901.96 3264
+15.419760 4901.96 3264
+15.432816 4901.96 3264
+15.445872 4901.96 3264
+15.458928 4901.96 3264
+15.471984 4901.96 3264
+15.484976 4926.11 3248
+15.497968 4926.11 3248
+15.510960 4926.11 3248
+15.523952 4926.11 3248
+15.536880 4950.50 3232
+15.549808 4950.50 3232
+15.562736 4950.50 3232
+15.575664 4950.50 3232
+15.588592 4950.50 3232
+15.601520 4950.50 3232
+15.614448 4950.50 3232
+15.627376 4950.50 3232
+15.640240 4975.12 3216
+15.653104 4975.12 3216
+15.665968 4975.12 3216
+15.678832 4975.12 3216
+15.691696 4975.12 3216
+15.704560 4975.12 3216
+15.717424 4975.12 3216
+15.730288 4975.12 3216
+15.743088 5000.00 3200
+15.759088 5000.00 3200
+15.775088 5000.00 3200
+15.791008 5025.13 3184
+15.806928 5025.13 3184
+15.822848 5025.13 3184
+15.838768 5025.13 3184
+15.854688 5025.13 3184
+15.870608 5025.13 3184
+15.886528 5025.13 3184
+15.902368 5050.51 3168
+15.918208 5050.51 3168
+15.934048 5050.51 3168
+15.949888 5050.51 3168
+15.965728 5050.51 3168
+15.981568 5050.51 3168
+15.997328 5076.14 3152
+16.013088 5076.14 3152
+16.028848 5076.14 3152
+16.044608 5076.14 3152
+16.060368 5076.14 3152
+16.076128 5076.14 3152
+16.091808 5102.04 3136
+16.107488 5102.04 3136
+16.123168 5102.04 3136
+16.138848 5102.04 3136
+16.154368 5154.64 3104
+16.169888 5154.64 3104
+16.185408 5154.64 3104
+16.200928 5154.64 3104
+16.216448 5154.64 3104
+16.231968 5154.64 3104
+16.247408 5181.35 3088
+16.262848 5181.35 3088
+16.278288 5181.35 3088
+16.293728 5181.35 3088
+16.309168 5181.35 3088
+16.324608 5181.35 3088
+16.339968 5208.33 3072
+16.355328 5208.33 3072
+16.370688 5208.33 3072
+16.386048 5208.33 3072
+16.401408 5208.33 3072
+16.416768 5208.33 3072
+16.432128 5208.33 3072
+16.447408 5235.60 3056
+16.462688 5235.60 3056
+16.477968 5235.60 3056
+16.493248 5235.60 3056
+16.508528 5235.60 3056
+16.523808 5235.60 3056
+16.539008 5263.16 3040
+16.554208 5263.16 3040
+16.569408 5263.16 3040
+16.584608 5263.16 3040
+16.599808 5263.16 3040
+16.615008 5263.16 3040
+16.630208 5263.16 3040
+16.645328 5291.01 3024
+16.660448 5291.01 3024
+16.675568 5291.01 3024
+16.690608 5319.15 3008
+16.705648 5319.15 3008
+16.720688 5319.15 3008
+16.735728 5319.15 3008
+16.750768 5319.15 3008
+16.765808 5319.15 3008
+16.780768 5347.59 2992
+16.795728 5347.59 2992
+16.810688 5347.59 2992
+16.825648 5347.59 2992
+16.840608 5347.59 2992
+16.855568 5347.59 2992
+16.870528 5347.59 2992
+16.885408 5376.34 2976
+16.900288 5376.34 2976
+16.915168 5376.34 2976
+16.930048 5376.34 2976
+16.944928 5376.34 2976
+16.959808 5376.34 2976
+16.974608 5405.41 2960
+16.989408 5405.41 2960
+17.004208 5405.41 2960
+17.019008 5405.41 2960
+17.033808 5405.41 2960
+17.048608 5405.41 2960
+17.063328 5434.78 2944
+17.078048 5434.78 2944
+17.092768 5434.78 2944
+17.107488 5434.78 2944
+17.122208 5434.78 2944
+17.136928 5434.78 2944
+17.151648 5434.78 2944
+17.166288 5464.48 2928
+17.180928 5464.48 2928
+17.195568 5464.48 2928
+17.210208 5464.48 2928
+17.224848 5464.48 2928
+17.239488 5464.48 2928
+17.254048 5494.51 2912
+17.268608 5494.51 2912
+17.283168 5494.51 2912
+17.297728 5494.51 2912
+17.312288 5494.51 2912
+17.326848 5494.51 2912
+17.341408 5494.51 2912
+17.355888 5524.86 2896
+17.370368 5524.86 2896
+17.384848 5524.86 2896
+17.399328 5524.86 2896
+17.413808 5524.86 2896
+17.428288 5524.86 2896
+17.442688 5555.56 2880
+17.457088 5555.56 2880
+17.471488 5555.56 2880
+17.485888 5555.56 2880
+17.500288 5555.56 2880
+17.514688 5555.56 2880
+17.529008 5586.59 2864
+17.543328 5586.59 2864
+17.557648 5586.59 2864
+17.571968 5586.59 2864
+17.586288 5586.59 2864
+17.600608 5586.59 2864
+17.614928 5586.59 2864
+17.629168 5617.98 2848
+17.643408 5617.98 2848
+17.657648 5617.98 2848
+17.671888 5617.98 2848
+17.686128 5617.98 2848
+17.700368 5617.98 2848
+17.714608 5617.98 2848
+17.728848 5617.98 2848
+17.743088 5617.98 2848
+17.757248 5649.72 2832
+17.771408 5649.72 2832
+17.785568 5649.72 2832
+17.799728 5649.72 2832
+17.813888 5649.72 2832
+17.828048 5649.72 2832
+17.842208 5649.72 2832
+17.856288 5681.82 2816
+17.870368 5681.82 2816
+17.884448 5681.82 2816
+17.898528 5681.82 2816
+17.912608 5681.82 2816
+17.926688 5681.82 2816
+17.940688 5714.29 2800
+17.954688 5714.29 2800
+17.968688 5714.29 2800
+17.982688 5714.29 2800
+17.996688 5714.29 2800
+18.010688 5714.29 2800
+18.024688 5714.29 2800
+18.038608 5747.13 2784
+18.052528 5747.13 2784
+18.066448 5747.13 2784
+18.080368 5747.13 2784
+18.094288 5747.13 2784
+18.108208 5747.13 2784
+18.122128 5747.13 2784
+18.136048 5747.13 2784
+18.149968 5747.13 2784
+18.163888 5747.13 2784
+18.177808 5747.13 2784
+18.191728 5747.13 2784
+18.205648 5747.13 2784
+18.219568 5747.13 2784
+18.233488 5747.13 2784
+18.247408 5747.13 2784
+18.261248 5780.35 2768
+18.275088 5780.35 2768
+18.288928 5780.35 2768
+18.302768 5780.35 2768
+18.316608 5780.35 2768
+18.330448 5780.35 2768
+18.344208 5813.95 2752
+18.357968 5813.95 2752
+18.371728 5813.95 2752
+18.385488 5813.95 2752
+18.399248 5813.95 2752
+18.413008 5813.95 2752
+18.426688 5847.95 2736
+18.440368 5847.95 2736
+18.454048 5847.95 2736
+18.467728 5847.95 2736
+18.481408 5847.95 2736
+18.495088 5847.95 2736
+18.508768 5847.95 2736
+18.522368 5882.35 2720
+18.535968 5882.35 2720
+18.549568 5882.35 2720
+18.563168 5882.35 2720
+18.576768 5882.35 2720
+18.590368 5882.35 2720
+18.603968 5882.35 2720
+18.617568 5882.35 2720
+18.631168 5882.35 2720
+18.644688 5917.16 2704
+18.658208 5917.16 2704
+18.671728 5917.16 2704
+18.685248 5917.16 2704
+18.698768 5917.16 2704
+18.712288 5917.16 2704
+18.725808 5917.16 2704
+18.739248 5952.38 2688
+18.752688 5952.38 2688
+18.766128 5952.38 2688
+18.779568 5952.38 2688
+18.793008 5952.38 2688
+18.806448 5952.38 2688
+18.819888 5952.38 2688
+18.833328 5952.38 2688
+18.846768 5952.38 2688
+18.860128 5988.02 2672
+18.873488 5988.02 2672
+18.886848 5988.02 2672
+18.900208 5988.02 2672
+18.913568 5988.02 2672
+18.926928 5988.02 2672
+18.940288 5988.02 2672
+18.953568 6024.10 2656
+18.969504 6024.10 2656
+18.985440 6024.10 2656
+19.001376 6024.10 2656
+19.017312 6024.10 2656
+19.033152 6060.61 2640
+19.048992 6060.61 2640
+19.064832 6060.61 2640
+19.080672 6060.61 2640
+19.096512 6060.61 2640
+19.112352 6060.61 2640
+19.128192 6060.61 2640
+19.144032 6060.61 2640
+19.159776 6097.56 2624
+19.175520 6097.56 2624
+19.191264 6097.56 2624
+19.207008 6097.56 2624
+19.222752 6097.56 2624
+19.238496 6097.56 2624
+19.254144 6134.97 2608
+19.269792 6134.97 2608
+19.285440 6134.97 2608
+19.301088 6134.97 2608
+19.316736 6134.97 2608
+19.332384 6134.97 2608
+19.348032 6134.97 2608
+19.363680 6134.97 2608
+19.379328 6134.97 2608
+19.394976 6134.97 2608
+19.410624 6134.97 2608
+19.426272 6134.97 2608
+19.441920 6134.97 2608
+19.457568 6134.97 2608
+19.473216 6134.97 2608
+19.488864 6134.97 2608
+19.504416 6172.84 2592
+19.519968 6172.84 2592
+19.535520 6172.84 2592
+19.551072 6172.84 2592
+19.566624 6172.84 2592
+19.582080 6211.18 2576
+19.597536 6211.18 2576
+19.612992 6211.18 2576
+19.628448 6211.18 2576
+19.643904 6211.18 2576
+19.659360 6211.18 2576
+19.674816 6211.18 2576
+19.690272 6211.18 2576
+19.705632 6250.00 2560
+19.720992 6250.00 2560
+19.736352 6250.00 2560
+19.751712 6250.00 2560
+19.767072 6250.00 2560
+19.782336 6289.31 2544
+19.797600 6289.31 2544
+19.812864 6289.31 2544
+19.828128 6289.31 2544
+19.843392 6289.31 2544
+19.858656 6289.31 2544
+19.873920 6289.31 2544
+19.889184 6289.31 2544
+19.904352 6329.11 2528
+19.919520 6329.11 2528
+19.934688 6329.11 2528
+19.949856 6329.11 2528
+19.965024 6329.11 2528
+19.980192 6329.11 2528
+19.995360 6329.11 2528
+20.010528 6329.11 2528
+20.025600 6369.43 2512
+20.040672 6369.43 2512
+20.055744 6369.43 2512
+20.070816 6369.43 2512
+20.085888 6369.43 2512
+20.100960 6369.43 2512
+20.116032 6369.43 2512
+20.131104 6369.43 2512
+20.146176 6369.43 2512
+20.161248 6369.43 2512
+20.176320 6369.43 2512
+20.191392 6369.43 2512
+20.206464 6369.43 2512
+20.221536 6369.43 2512
+20.236512 6410.26 2496
+20.251488 6410.26 2496
+20.266464 6410.26 2496
+20.281440 6410.26 2496
+20.296416 6410.26 2496
+20.311392 6410.26 2496
+20.326368 6410.26 2496
+20.341344 6410.26 2496
+20.356320 6410.26 2496
+20.371296 6410.26 2496
+20.386176 6451.61 2480
+20.401056 6451.61 2480
+20.415936 6451.61 2480
+20.430816 6451.61 2480
+20.445696 6451.61 2480
+20.460576 6451.61 2480
+20.475360 6493.51 2464
+20.490144 6493.51 2464
+20.504928 6493.51 2464
+20.519712 6493.51 2464
+20.534496 6493.51 2464
+20.549184 6535.95 2448
+20.563872 6535.95 2448
+20.578560 6535.95 2448
+20.593248 6535.95 2448
+20.607936 6535.95 2448
+20.622624 6535.95 2448
+20.637312 6535.95 2448
+20.652000 6535.95 2448
+20.666688 6535.95 2448
+20.681376 6535.95 2448
+20.696064 6535.95 2448
+20.710656 6578.95 2432
+20.725248 6578.95 2432
+20.739840 6578.95 2432
+20.754432 6578.95 2432
+20.769024 6578.95 2432
+20.783616 6578.95 2432
+20.798208 6578.95 2432
+20.812800 6578.95 2432
+20.827392 6578.95 2432
+20.841984 6578.95 2432
+20.856576 6578.95 2432
+20.871168 6578.95 2432
+20.885760 6578.95 2432
+20.900352 6578.95 2432
+20.914944 6578.95 2432
+20.929536 6578.95 2432
+20.944032 6622.52 2416
+20.958528 6622.52 2416
+20.973024 6622.52 2416
+20.987520 6622.52 2416
+21.002016 6622.52 2416
+21.016416 6666.67 2400
+21.030816 6666.67 2400
+21.045216 6666.67 2400
+21.059616 6666.67 2400
+21.074016 6666.67 2400
+21.088416 6666.67 2400
+21.102816 6666.67 2400
+21.117216 6666.67 2400
+21.131616 6666.67 2400
+21.146016 6666.67 2400
+21.160416 6666.67 2400
+21.174720 6711.41 2384
+21.189024 6711.41 2384
+21.203328 6711.41 2384
+21.217632 6711.41 2384
+21.231936 6711.41 2384
+21.246144 6756.76 2368
+21.260352 6756.76 2368
+21.274560 6756.76 2368
+21.288768 6756.76 2368
+21.302976 6756.76 2368
+21.317184 6756.76 2368
+21.331392 6756.76 2368
+21.345600 6756.76 2368
+21.359808 6756.76 2368
+21.374016 6756.76 2368
+21.388224 6756.76 2368
+21.402336 6802.72 2352
+21.416448 6802.72 2352
+21.430560 6802.72 2352
+21.444672 6802.72 2352
+21.458784 6802.72 2352
+21.472896 6802.72 2352
+21.487008 6802.72 2352
+21.501120 6802.72 2352
+21.515232 6802.72 2352
+21.529344 6802.72 2352
+21.543456 6802.72 2352
+21.557568 6802.72 2352
+21.571680 6802.72 2352
+21.585792 6802.72 2352
+21.599904 6802.72 2352
+21.614016 6802.72 2352
+21.628032 6849.32 2336
+21.642048 6849.32 2336
+21.656064 6849.32 2336
+21.670080 6849.32 2336
+21.684096 6849.32 2336
+21.698112 6849.32 2336
+21.712128 6849.32 2336
+21.726144 6849.32 2336
+21.740160 6849.32 2336
+21.754176 6849.32 2336
+21.768096 6896.55 2320
+21.782016 6896.55 2320
+21.795936 6896.55 2320
+21.809856 6896.55 2320
+21.823776 6896.55 2320
+21.837696 6896.55 2320
+21.851520 6944.44 2304
+21.865344 6944.44 2304
+21.879168 6944.44 2304
+21.892992 6944.44 2304
+21.906816 6944.44 2304
+21.920640 6944.44 2304
+21.934464 6944.44 2304
+21.948288 6944.44 2304
+21.962112 6944.44 2304
+21.975936 6944.44 2304
+21.989760 6944.44 2304
+22.003584 6944.44 2304
+22.017408 6944.44 2304
+22.031232 6944.44 2304
+22.045056 6944.44 2304
+22.058880 6944.44 2304
+22.072608 6993.01 2288
+22.086336 6993.01 2288
+22.100064 6993.01 2288
+22.113792 6993.01 2288
+22.127520 6993.01 2288
+22.141248 6993.01 2288
+22.154976 6993.01 2288
+22.168704 6993.01 2288
+22.182432 6993.01 2288
+22.196160 6993.01 2288
+22.209792 7042.25 2272
+22.225696 7042.25 2272
+22.241600 7042.25 2272
+22.257504 7042.25 2272
+22.273408 7042.25 2272
+22.289312 7042.25 2272
+22.305216 7042.25 2272
+22.321120 7042.25 2272
+22.337024 7042.25 2272
+22.352816 7092.20 2256
+22.368608 7092.20 2256
+22.384400 7092.20 2256
+22.400192 7092.20 2256
+22.415984 7092.20 2256
+22.431664 7142.86 2240
+22.447344 7142.86 2240
+22.463024 7142.86 2240
+22.478704 7142.86 2240
+22.494384 7142.86 2240
+22.510064 7142.86 2240
+22.525744 7142.86 2240
+22.541424 7142.86 2240
+22.557104 7142.86 2240
+22.572784 7142.86 2240
+22.588464 7142.86 2240
+22.604144 7142.86 2240
+22.619824 7142.86 2240
+22.635504 7142.86 2240
+22.651184 7142.86 2240
+22.666864 7142.86 2240
+22.682544 7142.86 2240
+22.698224 7142.86 2240
+22.713792 7194.24 2224
+22.729360 7194.24 2224
+22.744928 7194.24 2224
+22.760496 7194.24 2224
+22.776064 7194.24 2224
+22.791632 7194.24 2224
+22.807200 7194.24 2224
+22.822768 7194.24 2224
+22.838336 7194.24 2224
+22.853792 7246.38 2208
+22.869248 7246.38 2208
+22.884704 7246.38 2208
+22.900160 7246.38 2208
+22.915616 7246.38 2208
+22.930960 7299.27 2192
+22.946304 7299.27 2192
+22.961648 7299.27 2192
+22.976992 7299.27 2192
+22.992336 7299.27 2192
+23.007680 7299.27 2192
+23.023024 7299.27 2192
+23.038368 7299.27 2192
+23.053712 7299.27 2192
+23.069056 7299.27 2192
+23.084400 7299.27 2192
+23.099744 7299.27 2192
+23.115088 7299.27 2192
+23.130432 7299.27 2192
+23.145776 7299.27 2192
+23.161120 7299.27 2192
+23.176464 7299.27 2192
+23.191808 7299.27 2192
+23.207040 7352.94 2176
+23.222272 7352.94 2176
+23.237504 7352.94 2176
+23.252736 7352.94 2176
+23.267968 7352.94 2176
+23.283200 7352.94 2176
+23.298432 7352.94 2176
+23.313664 7352.94 2176
+23.328896 7352.94 2176
+23.344016 7407.41 2160
+23.359136 7407.41 2160
+23.374256 7407.41 2160
+23.389376 7407.41 2160
+23.404496 7407.41 2160
+23.419616 7407.41 2160
+23.434736 7407.41 2160
+23.449856 7407.41 2160
+23.464976 7407.41 2160
+23.480096 7407.41 2160
+23.495216 7407.41 2160
+23.510336 7407.41 2160
+23.525456 7407.41 2160
+23.540576 7407.41 2160
+23.555696 7407.41 2160
+23.570816 7407.41 2160
+23.585936 7407.41 2160
+23.601056 7407.41 2160
+23.616176 7407.41 2160
+23.631184 7462.69 2144
+23.646192 7462.69 2144
+23.661200 7462.69 2144
+23.676208 7462.69 2144
+23.691104 7518.80 2128
+23.706000 7518.80 2128
+23.720896 7518.80 2128
+23.735792 7518.80 2128
+23.750688 7518.80 2128
+23.765584 7518.80 2128
+23.780480 7518.80 2128
+23.795376 7518.80 2128
+23.810272 7518.80 2128
+23.825056 7575.76 2112
+23.839840 7575.76 2112
+23.854624 7575.76 2112
+23.869408 7575.76 2112
+23.884192 7575.76 2112
+23.898976 7575.76 2112
+23.913760 7575.76 2112
+23.928544 7575.76 2112
+23.943328 7575.76 2112
+23.958112 7575.76 2112
+23.972896 7575.76 2112
+23.987680 7575.76 2112
+24.002464 7575.76 2112
+24.017248 7575.76 2112
+24.032032 7575.76 2112
+24.046816 7575.76 2112
+24.061600 7575.76 2112
+24.076384 7575.76 2112
+24.091168 7575.76 2112
+24.105840 7633.59 2096
+24.120512 7633.59 2096
+24.135184 7633.59 2096
+24.149856 7633.59 2096
+24.164528 7633.59 2096
+24.179200 7633.59 2096
+24.193872 7633.59 2096
+24.208544 7633.59 2096
+24.223216 7633.59 2096
+24.237776 7692.31 2080
+24.252336 7692.31 2080
+24.266896 7692.31 2080
+24.281456 7692.31 2080
+24.296016 7692.31 2080
+24.310576 7692.31 2080
+24.325136 7692.31 2080
+24.339696 7692.31 2080
+24.354256 7692.31 2080
+24.368704 7751.94 2064
+24.383152 7751.94 2064
+24.397600 7751.94 2064
+24.412048 7751.94 2064
+24.426496 7751.94 2064
+24.440944 7751.94 2064
+24.455392 7751.94 2064
+24.469840 7751.94 2064
+24.484288 7751.94 2064
+24.498736 7751.94 2064
+24.513184 7751.94 2064
+24.527632 7751.94 2064
+24.542080 7751.94 2064
+24.556528 7751.94 2064
+24.570976 7751.94 2064
+24.585424 7751.94 2064
+24.599872 7751.94 2064
+24.614320 7751.94 2064
+24.628656 7812.50 2048
+24.642992 7812.50 2048
+24.657328 7812.50 2048
+24.671664 7812.50 2048
+24.686000 7812.50 2048
+24.700336 7812.50 2048
+24.714672 7812.50 2048
+24.729008 7812.50 2048
+24.743344 7812.50 2048
+24.757624 7843.14 2040
+24.771904 7843.14 2040
+24.786184 7843.14 2040
+24.800464 7843.14 2040
+24.814744 7843.14 2040
+24.829024 7843.14 2040
+24.843304 7843.14 2040
+24.857584 7843.14 2040
+24.871864 7843.14 2040
+24.886144 7843.14 2040
+24.900368 7874.02 2032
+24.914592 7874.02 2032
+24.928816 7874.02 2032
+24.943040 7874.02 2032
+24.957264 7874.02 2032
+24.971488 7874.02 2032
+24.985712 7874.02 2032
+24.999936 7874.02 2032
+25.014160 7874.02 2032
+25.028272 7936.51 2016
+25.042384 7936.51 2016
+25.056496 7936.51 2016
+25.070608 7936.51 2016
+25.084720 7936.51 2016
+25.098832 7936.51 2016
+25.112944 7936.51 2016
+25.127056 7936.51 2016
+25.141168 7936.51 2016
+25.155280 7936.51 2016
+25.169392 7936.51 2016
+25.183504 7936.51 2016
+25.197616 7936.51 2016
+25.211672 7968.13 2008
+25.225728 7968.13 2008
+25.239784 7968.13 2008
+25.253840 7968.13 2008
+25.267896 7968.13 2008
+25.281952 7968.13 2008
+25.296008 7968.13 2008
+25.310064 7968.13 2008
+25.324120 7968.13 2008
+25.338176 7968.13 2008
+25.352176 8000.00 2000
+25.368176 8000.00 2000
+25.384176 8000.00 2000
+25.400176 8000.00 2000
+25.416176 8000.00 2000
+25.432176 8000.00 2000
+25.448176 8000.00 2000
+25.464176 8000.00 2000
+25.480048 8064.52 1984
+25.495920 8064.52 1984
+25.511792 8064.52 1984
+25.527664 8064.52 1984
+25.543536 8064.52 1984
+25.559408 8064.52 1984
+25.575280 8064.52 1984
+25.591152 8064.52 1984
+25.606960 8097.17 1976
+25.622768 8097.17 1976
+25.638576 8097.17 1976
+25.654384 8097.17 1976
+25.670192 8097.17 1976
+25.686000 8097.17 1976
+25.701808 8097.17 1976
+25.717616 8097.17 1976
+25.733360 8130.08 1968
+25.749104 8130.08 1968
+25.764848 8130.08 1968
+25.780592 8130.08 1968
+25.796336 8130.08 1968
+25.812080 8130.08 1968
+25.827824 8130.08 1968
+25.843568 8130.08 1968
+25.859312 8130.08 1968
+25.875056 8130.08 1968
+25.890800 8130.08 1968
+25.906544 8130.08 1968
+25.922160 8196.72 1952
+25.937776 8196.72 1952
+25.953392 8196.72 1952
+25.969008 8196.72 1952
+25.984624 8196.72 1952
+26.000240 8196.72 1952
+26.015856 8196.72 1952
+26.031472 8196.72 1952
+26.047024 8230.45 1944
+26.062576 8230.45 1944
+26.078128 8230.45 1944
+26.093680 8230.45 1944
+26.109232 8230.45 1944
+26.124784 8230.45 1944
+26.140336 8230.45 1944
+26.155888 8230.45 1944
+26.171376 8264.46 1936
+26.186864 8264.46 1936
+26.202352 8264.46 1936
+26.217840 8264.46 1936
+26.233328 8264.46 1936
+26.248816 8264.46 1936
+26.264304 8264.46 1936
+26.279792 8264.46 1936
+26.295152 8333.33 1920
+26.310512 8333.33 1920
+26.325872 8333.33 1920
+26.341232 8333.33 1920
+26.356592 8333.33 1920
+26.371952 8333.33 1920
+26.387312 8333.33 1920
+26.402672 8333.33 1920
+26.418032 8333.33 1920
+26.433392 8333.33 1920
+26.448752 8333.33 1920
+26.464112 8333.33 1920
+26.479408 8368.20 1912
+26.494704 8368.20 1912
+26.510000 8368.20 1912
+26.525296 8368.20 1912
+26.540592 8368.20 1912
+26.555888 8368.20 1912
+26.571184 8368.20 1912
+26.586480 8368.20 1912
+26.601712 8403.36 1904
+26.616944 8403.36 1904
+26.632176 8403.36 1904
+26.647408 8403.36 1904
+26.662640 8403.36 1904
+26.677872 8403.36 1904
+26.693104 8403.36 1904
+26.708336 8403.36 1904
+26.723568 8403.36 1904
+26.738800 8403.36 1904
+26.754032 8403.36 1904
+26.769264 8403.36 1904
+26.784368 8474.58 1888
+26.799472 8474.58 1888
+26.814576 8474.58 1888
+26.829680 8474.58 1888
+26.844784 8474.58 1888
+26.859888 8474.58 1888
+26.874992 8474.58 1888
+26.890096 8474.58 1888
+26.905136 8510.64 1880
+26.920176 8510.64 1880
+26.935216 8510.64 1880
+26.950256 8510.64 1880
+26.965296 8510.64 1880
+26.980336 8510.64 1880
+26.995376 8510.64 1880
+27.010416 8510.64 1880
+27.025392 8547.01 1872
+27.040368 8547.01 1872
+27.055344 8547.01 1872
+27.070320 8547.01 1872
+27.085296 8547.01 1872
+27.100272 8547.01 1872
+27.115248 8547.01 1872
+27.130224 8547.01 1872
+27.145200 8547.01 1872
+27.160176 8547.01 1872
+27.175152 8547.01 1872
+27.190128 8547.01 1872
+27.205040 8583.69 1864
+27.219952 8583.69 1864
+27.234864 8583.69 1864
+27.249776 8583.69 1864
+27.264688 8583.69 1864
+27.279600 8583.69 1864
+27.294512 8583.69 1864
+27.309424 8583.69 1864
+27.324208 8658.01 1848
+27.338992 8658.01 1848
+27.353776 8658.01 1848
+27.368560 8658.01 1848
+27.383344 8658.01 1848
+27.398128 8658.01 1848
+27.412912 8658.01 1848
+27.427696 8658.01 1848
+27.442480 8658.01 1848
+27.457264 8658.01 1848
+27.472048 8658.01 1848
+27.486832 8658.01 1848
+27.501552 8695.65 1840
+27.516272 8695.65 1840
+27.530992 8695.65 1840
+27.545712 8695.65 1840
+27.560432 8695.65 1840
+27.575152 8695.65 1840
+27.589872 8695.65 1840
+27.604592 8695.65 1840
+27.619312 8695.65 1840
+27.634032 8695.65 1840
+27.648752 8695.65 1840
+27.663472 8695.65 1840
+27.678128 8733.62 1832
+27.692784 8733.62 1832
+27.707440 8733.62 1832
+27.722096 8733.62 1832
+27.736752 8733.62 1832
+27.751408 8733.62 1832
+27.766064 8733.62 1832
+27.780720 8733.62 1832
+27.795312 8771.93 1824
+27.809904 8771.93 1824
+27.824496 8771.93 1824
+27.839088 8771.93 1824
+27.853680 8771.93 1824
+27.868272 8771.93 1824
+27.882864 8771.93 1824
+27.897456 8771.93 1824
+27.912048 8771.93 1824
+27.926640 8771.93 1824
+27.941232 8771.93 1824
+27.955824 8771.93 1824
+27.970288 8849.56 1808
+27.984752 8849.56 1808
+27.999216 8849.56 1808
+28.013680 8849.56 1808
+28.028144 8849.56 1808
+28.042608 8849.56 1808
+28.057072 8849.56 1808
+28.071536 8849.56 1808
+28.085936 8888.89 1800
+28.100336 8888.89 1800
+28.114736 8888.89 1800
+28.129136 8888.89 1800
+28.143536 8888.89 1800
+28.157936 8888.89 1800
+28.172336 8888.89 1800
+28.186736 8888.89 1800
+28.201136 8888.89 1800
+28.215536 8888.89 1800
+28.229936 8888.89 1800
+28.244336 8888.89 1800
+28.258672 8928.57 1792
+28.273008 8928.57 1792
+28.287344 8928.57 1792
+28.301680 8928.57 1792
+28.316016 8928.57 1792
+28.330352 8928.57 1792
+28.344688 8928.57 1792
+28.359024 8928.57 1792
+28.373360 8928.57 1792
+28.387696 8928.57 1792
+28.402032 8928.57 1792
+28.416368 8928.57 1792
+28.430640 8968.61 1784
+28.444912 8968.61 1784
+28.459184 8968.61 1784
+28.473456 8968.61 1784
+28.487728 8968.61 1784
+28.502000 8968.61 1784
+28.516272 8968.61 1784
+28.530544 8968.61 1784
+28.544688 9049.77 1768
+28.560600 9049.77 1768
+28.576512 9049.77 1768
+28.592424 9049.77 1768
+28.608336 9049.77 1768
+28.624248 9049.77 1768
+28.640160 9049.77 1768
+28.656072 9049.77 1768
+28.671984 9049.77 1768
+28.687896 9049.77 1768
+28.703736 9090.91 1760
+28.719576 9090.91 1760
+28.735416 9090.91 1760
+28.751256 9090.91 1760
+28.767096 9090.91 1760
+28.782936 9090.91 1760
+28.798776 9090.91 1760
+28.814616 9090.91 1760
+28.830456 9090.91 1760
+28.846296 9090.91 1760
+28.862136 9090.91 1760
+28.877976 9090.91 1760
+28.893816 9090.91 1760
+28.909656 9090.91 1760
+28.925496 9090.91 1760
+28.941264 9132.42 1752
+28.957032 9132.42 1752
+28.972800 9132.42 1752
+28.988568 9132.42 1752
+29.004336 9132.42 1752
+29.020104 9132.42 1752
+29.035872 9132.42 1752
+29.051568 9174.31 1744
+29.067264 9174.31 1744
+29.082960 9174.31 1744
+29.098656 9174.31 1744
+29.114352 9174.31 1744
+29.130048 9174.31 1744
+29.145744 9174.31 1744
+29.161368 9216.59 1736
+29.176992 9216.59 1736
+29.192616 9216.59 1736
+29.208240 9216.59 1736
+29.223864 9216.59 1736
+29.239488 9216.59 1736
+29.255112 9216.59 1736
+29.270736 9216.59 1736
+29.286360 9216.59 1736
+29.301984 9216.59 1736
+29.317608 9216.59 1736
+29.333232 9216.59 1736
+29.348856 9216.59 1736
+29.364480 9216.59 1736
+29.380032 9259.26 1728
+29.395584 9259.26 1728
+29.411136 9259.26 1728
+29.426688 9259.26 1728
+29.442240 9259.26 1728
+29.457792 9259.26 1728
+29.473344 9259.26 1728
+29.488752 9345.79 1712
+29.504160 9345.79 1712
+29.519568 9345.79 1712
+29.534976 9345.79 1712
+29.550384 9345.79 1712
+29.565792 9345.79 1712
+29.581200 9345.79 1712
+29.596608 9345.79 1712
+29.612016 9345.79 1712
+29.627424 9345.79 1712
+29.642832 9345.79 1712
+29.658240 9345.79 1712
+29.673648 9345.79 1712
+29.689056 9345.79 1712
+29.704392 9389.67 1704
+29.719728 9389.67 1704
+29.735064 9389.67 1704
+29.750400 9389.67 1704
+29.765736 9389.67 1704
+29.781072 9389.67 1704
+29.796408 9389.67 1704
+29.811744 9389.67 1704
+29.827008 9433.96 1696
+29.842272 9433.96 1696
+29.857536 9433.96 1696
+29.872800 9433.96 1696
+29.888064 9433.96 1696
+29.903328 9433.96 1696
+29.918592 9433.96 1696
+29.933856 9433.96 1696
+29.949120 9433.96 1696
+29.964384 9433.96 1696
+29.979648 9433.96 1696
+29.994912 9433.96 1696
+30.010176 9433.96 1696
+30.025440 9433.96 1696
+30.040632 9478.67 1688
+30.055824 9478.67 1688
+30.071016 9478.67 1688
+30.086208 9478.67 1688
+30.101400 9478.67 1688
+30.116592 9478.67 1688
+30.131784 9478.67 1688
+30.146904 9523.81 1680
+30.162024 9523.81 1680
+30.177144 9523.81 1680
+30.192264 9523.81 1680
+30.207384 9523.81 1680
+30.222504 9523.81 1680
+30.237624 9523.81 1680
+30.252744 9523.81 1680
+30.267864 9523.81 1680
+30.282984 9523.81 1680
+30.298104 9523.81 1680
+30.313224 9523.81 1680
+30.328344 9523.81 1680
+30.343464 9523.81 1680
+30.358512 9569.38 1672
+30.373560 9569.38 1672
+30.388608 9569.38 1672
+30.403656 9569.38 1672
+30.418704 9569.38 1672
+30.433752 9569.38 1672
+30.448800 9569.38 1672
+30.463776 9615.38 1664
+30.478752 9615.38 1664
+30.493728 9615.38 1664
+30.508704 9615.38 1664
+30.523680 9615.38 1664
+30.538656 9615.38 1664
+30.553632 9615.38 1664
+30.568608 9615.38 1664
+30.583584 9615.38 1664
+30.598560 9615.38 1664
+30.613536 9615.38 1664
+30.628512 9615.38 1664
+30.643488 9615.38 1664
+30.658464 9615.38 1664
+30.673296 9708.74 1648
+30.688128 9708.74 1648
+30.702960 9708.74 1648
+30.717792 9708.74 1648
+30.732624 9708.74 1648
+30.747456 9708.74 1648
+30.762288 9708.74 1648
+30.777120 9708.74 1648
+30.791952 9708.74 1648
+30.806784 9708.74 1648
+30.821616 9708.74 1648
+30.836448 9708.74 1648
+30.851280 9708.74 1648
+30.866112 9708.74 1648
+30.880944 9708.74 1648
+30.895704 9756.10 1640
+30.910464 9756.10 1640
+30.925224 9756.10 1640
+30.939984 9756.10 1640
+30.954744 9756.10 1640
+30.969504 9756.10 1640
+30.984264 9756.10 1640
+30.998952 9803.92 1632
+31.013640 9803.92 1632
+31.028328 9803.92 1632
+31.043016 9803.92 1632
+31.057704 9803.92 1632
+31.072392 9803.92 1632
+31.087080 9803.92 1632
+31.101768 9803.92 1632
+31.116456 9803.92 1632
+31.131144 9803.92 1632
+31.145832 9803.92 1632
+31.160520 9803.92 1632
+31.175208 9803.92 1632
+31.189896 9803.92 1632
+31.204512 9852.22 1624
+31.219128 9852.22 1624
+31.233744 9852.22 1624
+31.248360 9852.22 1624
+31.262976 9852.22 1624
+31.277592 9852.22 1624
+31.292208 9852.22 1624
+31.306752 9900.99 1616
+31.321296 9900.99 1616
+31.335840 9900.99 1616
+31.350384 9900.99 1616
+31.364928 9900.99 1616
+31.379472 9900.99 1616
+31.394016 9900.99 1616
+31.408560 9900.99 1616
+31.423104 9900.99 1616
+31.437648 9900.99 1616
+31.452192 9900.99 1616
+31.466736 9900.99 1616
+31.481280 9900.99 1616
+31.495824 9900.99 1616
+31.510296 9950.25 1608
+31.524768 9950.25 1608
+31.539240 9950.25 1608
+31.553712 9950.25 1608
+31.568184 9950.25 1608
+31.582656 9950.25 1608
+31.597128 9950.25 1608
+31.611600 9950.25 1608
+31.626072 9950.25 1608
+31.640544 9950.25 1608
+31.655016 9950.25 1608
+31.669488 9950.25 1608
+31.683960 9950.25 1608
+31.698432 9950.25 1608
+31.712904 9950.25 1608
+31.727304 10000.00 1600
+31.743304 10000.00 1600
+31.759304 10000.00 1600
+31.775304 10000.00 1600
+31.791304 10000.00 1600
+31.807304 10000.00 1600
+31.823224 10050.25 1592
+31.839144 10050.25 1592
+31.855064 10050.25 1592
+31.870984 10050.25 1592
+31.886904 10050.25 1592
+31.902824 10050.25 1592
+31.918744 10050.25 1592
+31.934664 10050.25 1592
+31.950584 10050.25 1592
+31.966504 10050.25 1592
+31.982424 10050.25 1592
+31.998344 10050.25 1592
+32.014264 10050.25 1592
+32.030104 10101.01 1584
+32.045944 10101.01 1584
+32.061784 10101.01 1584
+32.077624 10101.01 1584
+32.093464 10101.01 1584
+32.109304 10101.01 1584
+32.125144 10101.01 1584
+32.140984 10101.01 1584
+32.156824 10101.01 1584
+32.172664 10101.01 1584
+32.188504 10101.01 1584
+32.204344 10101.01 1584
+32.220184 10101.01 1584
+32.235944 10152.28 1576
+32.251704 10152.28 1576
+32.267464 10152.28 1576
+32.283224 10152.28 1576
+32.298984 10152.28 1576
+32.314744 10152.28 1576
+32.330504 10152.28 1576
+32.346264 10152.28 1576
+32.362024 10152.28 1576
+32.377784 10152.28 1576
+32.393544 10152.28 1576
+32.409304 10152.28 1576
+32.424984 10204.08 1568
+32.440664 10204.08 1568
+32.456344 10204.08 1568
+32.472024 10204.08 1568
+32.487704 10204.08 1568
+32.503384 10204.08 1568
+32.519064 10204.08 1568
+32.534584 10309.28 1552
+32.550104 10309.28 1552
+32.565624 10309.28 1552
+32.581144 10309.28 1552
+32.596664 10309.28 1552
+32.612184 10309.28 1552
+32.627704 10309.28 1552
+32.643224 10309.28 1552
+32.658744 10309.28 1552
+32.674264 10309.28 1552
+32.689784 10309.28 1552
+32.705304 10309.28 1552
+32.720824 10309.28 1552
+32.736264 10362.69 1544
+32.751704 10362.69 1544
+32.767144 10362.69 1544
+32.782584 10362.69 1544
+32.798024 10362.69 1544
+32.813464 10362.69 1544
+32.828904 10362.69 1544
+32.844344 10362.69 1544
+32.859784 10362.69 1544
+32.875224 10362.69 1544
+32.890664 10362.69 1544
+32.906104 10362.69 1544
+32.921464 10416.67 1536
+32.936824 10416.67 1536
+32.952184 10416.67 1536
+32.967544 10416.67 1536
+32.982904 10416.67 1536
+32.998264 10416.67 1536
+33.013624 10416.67 1536
+33.028984 10416.67 1536
+33.044344 10416.67 1536
+33.059704 10416.67 1536
+33.075064 10416.67 1536
+33.090424 10416.67 1536
+33.105784 10416.67 1536
+33.121064 10471.20 1528
+33.136344 10471.20 1528
+33.151624 10471.20 1528
+33.166904 10471.20 1528
+33.182184 10471.20 1528
+33.197464 10471.20 1528
+33.212744 10471.20 1528
+33.228024 10471.20 1528
+33.243304 10471.20 1528
+33.258584 10471.20 1528
+33.273864 10471.20 1528
+33.289144 10471.20 1528
+33.304424 10471.20 1528
+33.319624 10526.32 1520
+33.334824 10526.32 1520
+33.350024 10526.32 1520
+33.365224 10526.32 1520
+33.380424 10526.32 1520
+33.395624 10526.32 1520
+33.410824 10526.32 1520
+33.426024 10526.32 1520
+33.441224 10526.32 1520
+33.456424 10526.32 1520
+33.471624 10526.32 1520
+33.486824 10526.32 1520
+33.502024 10526.32 1520
+33.517144 10582.01 1512
+33.532264 10582.01 1512
+33.547384 10582.01 1512
+33.562504 10582.01 1512
+33.577624 10582.01 1512
+33.592744 10582.01 1512
+33.607784 10638.30 1504
+33.622824 10638.30 1504
+33.637864 10638.30 1504
+33.652904 10638.30 1504
+33.667944 10638.30 1504
+33.682984 10638.30 1504
+33.698024 10638.30 1504
+33.713064 10638.30 1504
+33.728104 10638.30 1504
+33.743144 10638.30 1504
+33.758184 10638.30 1504
+33.773224 10638.30 1504
+33.788264 10638.30 1504
+33.803224 10695.19 1496
+33.818184 10695.19 1496
+33.833144 10695.19 1496
+33.848104 10695.19 1496
+33.863064 10695.19 1496
+33.878024 10695.19 1496
+33.892984 10695.19 1496
+33.907944 10695.19 1496
+33.922904 10695.19 1496
+33.937864 10695.19 1496
+33.952824 10695.19 1496
+33.967784 10695.19 1496
+33.982744 10695.19 1496
+33.997624 10752.69 1488
+34.012504 10752.69 1488
+34.027384 10752.69 1488
+34.042264 10752.69 1488
+34.057144 10752.69 1488
+34.072024 10752.69 1488
+34.086904 10752.69 1488
+34.101784 10752.69 1488
+34.116664 10752.69 1488
+34.131544 10752.69 1488
+34.146424 10752.69 1488
+34.161304 10752.69 1488
+34.176184 10752.69 1488
+34.190984 10810.81 1480
+34.205784 10810.81 1480
+34.220584 10810.81 1480
+34.235384 10810.81 1480
+34.250184 10810.81 1480
+34.264984 10810.81 1480
+34.279784 10810.81 1480
+34.294584 10810.81 1480
+34.309384 10810.81 1480
+34.324184 10810.81 1480
+34.338984 10810.81 1480
+34.353784 10810.81 1480
+34.368504 10869.57 1472
+34.383224 10869.57 1472
+34.397944 10869.57 1472
+34.412664 10869.57 1472
+34.427384 10869.57 1472
+34.442104 10869.57 1472
+34.456824 10869.57 1472
+34.471544 10869.57 1472
+34.486264 10869.57 1472
+34.500984 10869.57 1472
+34.515704 10869.57 1472
+34.530424 10869.57 1472
+34.545144 10869.57 1472
+34.559784 10928.96 1464
+34.574424 10928.96 1464
+34.589064 10928.96 1464
+34.603704 10928.96 1464
+34.618344 10928.96 1464
+34.632984 10928.96 1464
+34.647624 10928.96 1464
+34.662264 10928.96 1464
+34.676904 10928.96 1464
+34.691544 10928.96 1464
+34.706184 10928.96 1464
+34.720824 10928.96 1464
+34.735464 10928.96 1464
+34.750024 10989.01 1456
+34.764584 10989.01 1456
+34.779144 10989.01 1456
+34.793704 10989.01 1456
+34.808264 10989.01 1456
+34.822824 10989.01 1456
+34.837384 10989.01 1456
+34.851944 10989.01 1456
+34.866504 10989.01 1456
+34.881064 10989.01 1456
+34.895624 10989.01 1456
+34.910184 10989.01 1456
+34.924744 10989.01 1456
+34.939224 11049.72 1448
+34.955152 11049.72 1448
+34.971080 11049.72 1448
+34.987008 11049.72 1448
+35.002936 11049.72 1448
+35.018864 11049.72 1448
+35.034792 11049.72 1448
+35.050720 11049.72 1448
+35.066648 11049.72 1448
+35.082576 11049.72 1448
+35.098504 11049.72 1448
+35.114432 11049.72 1448
+35.130272 11111.11 1440
+35.146112 11111.11 1440
+35.161952 11111.11 1440
+35.177792 11111.11 1440
+35.193632 11111.11 1440
+35.209472 11111.11 1440
+35.225312 11111.11 1440
+35.241152 11111.11 1440
+35.256992 11111.11 1440
+35.272832 11111.11 1440
+35.288672 11111.11 1440
+35.304424 11173.18 1432
+35.320176 11173.18 1432
+35.335928 11173.18 1432
+35.351680 11173.18 1432
+35.367432 11173.18 1432
+35.383184 11173.18 1432
+35.398936 11173.18 1432
+35.414688 11173.18 1432
+35.430440 11173.18 1432
+35.446192 11173.18 1432
+35.461944 11173.18 1432
+35.477696 11173.18 1432
+35.493360 11235.96 1424
+35.509024 11235.96 1424
+35.524688 11235.96 1424
+35.540352 11235.96 1424
+35.556016 11235.96 1424
+35.571680 11235.96 1424
+35.587344 11235.96 1424
+35.603008 11235.96 1424
+35.618672 11235.96 1424
+35.634336 11235.96 1424
+35.650000 11235.96 1424
+35.665664 11235.96 1424
+35.681328 11235.96 1424
+35.696992 11235.96 1424
+35.712656 11235.96 1424
+35.728320 11235.96 1424
+35.743984 11235.96 1424
+35.759560 11299.44 1416
+35.775136 11299.44 1416
+35.790712 11299.44 1416
+35.806288 11299.44 1416
+35.821864 11299.44 1416
+35.837440 11299.44 1416
+35.853016 11299.44 1416
+35.868592 11299.44 1416
+35.884168 11299.44 1416
+35.899744 11299.44 1416
+35.915320 11299.44 1416
+35.930896 11299.44 1416
+35.946384 11363.64 1408
+35.961872 11363.64 1408
+35.977360 11363.64 1408
+35.992848 11363.64 1408
+36.008336 11363.64 1408
+36.023824 11363.64 1408
+36.039312 11363.64 1408
+36.054800 11363.64 1408
+36.070288 11363.64 1408
+36.085776 11363.64 1408
+36.101264 11363.64 1408
+36.116752 11363.64 1408
+36.132152 11428.57 1400
+36.147552 11428.57 1400
+36.162952 11428.57 1400
+36.178352 11428.57 1400
+36.193752 11428.57 1400
+36.209152 11428.57 1400
+36.224552 11428.57 1400
+36.239952 11428.57 1400
+36.255352 11428.57 1400
+36.270752 11428.57 1400
+36.286152 11428.57 1400
+36.301464 11494.25 1392
+36.316776 11494.25 1392
+36.332088 11494.25 1392
+36.347400 11494.25 1392
+36.362712 11494.25 1392
+36.378024 11494.25 1392
+36.393336 11494.25 1392
+36.408648 11494.25 1392
+36.423960 11494.25 1392
+36.439272 11494.25 1392
+36.454584 11494.25 1392
+36.469896 11494.25 1392
+36.485208 11494.25 1392
+36.500520 11494.25 1392
+36.515832 11494.25 1392
+36.531144 11494.25 1392
+36.546456 11494.25 1392
+36.561768 11494.25 1392
+36.577080 11494.25 1392
+36.592392 11494.25 1392
+36.607704 11494.25 1392
+36.623016 11494.25 1392
+36.638328 11494.25 1392
+36.653640 11494.25 1392
+36.668952 11494.25 1392
+36.684264 11494.25 1392
+36.699576 11494.25 1392
+36.714888 11494.25 1392
+36.730200 11494.25 1392
+36.745424 11560.69 1384
+36.760648 11560.69 1384
+36.775872 11560.69 1384
+36.791096 11560.69 1384
+36.806320 11560.69 1384
+36.821544 11560.69 1384
+36.836768 11560.69 1384
+36.851992 11560.69 1384
+36.867216 11560.69 1384
+36.882440 11560.69 1384
+36.897664 11560.69 1384
+36.912888 11560.69 1384
+36.928024 11627.91 1376
+36.943160 11627.91 1376
+36.958296 11627.91 1376
+36.973432 11627.91 1376
+36.988568 11627.91 1376
+37.003704 11627.91 1376
+37.018840 11627.91 1376
+37.033976 11627.91 1376
+37.049112 11627.91 1376
+37.064248 11627.91 1376
+37.079384 11627.91 1376
+37.094520 11627.91 1376
+37.109568 11695.91 1368
+37.124616 11695.91 1368
+37.139664 11695.91 1368
+37.154712 11695.91 1368
+37.169760 11695.91 1368
+37.184808 11695.91 1368
+37.199856 11695.91 1368
+37.214904 11695.91 1368
+37.229952 11695.91 1368
+37.245000 11695.91 1368
+37.260048 11695.91 1368
+37.275008 11764.71 1360
+37.289968 11764.71 1360
+37.304928 11764.71 1360
+37.319888 11764.71 1360
+37.334848 11764.71 1360
+37.349808 11764.71 1360
+37.364768 11764.71 1360
+37.379728 11764.71 1360
+37.394688 11764.71 1360
+37.409648 11764.71 1360
+37.424608 11764.71 1360
+37.439568 11764.71 1360
+37.454528 11764.71 1360
+37.469488 11764.71 1360
+37.484448 11764.71 1360
+37.499408 11764.71 1360
+37.514368 11764.71 1360
+37.529328 11764.71 1360
+37.544200 11834.32 1352
+37.559072 11834.32 1352
+37.573944 11834.32 1352
+37.588816 11834.32 1352
+37.603688 11834.32 1352
+37.618560 11834.32 1352
+37.633432 11834.32 1352
+37.648304 11834.32 1352
+37.663176 11834.32 1352
+37.678048 11834.32 1352
+37.692920 11834.32 1352
+37.707704 11904.76 1344
+37.722488 11904.76 1344
+37.737272 11904.76 1344
+37.752056 11904.76 1344
+37.766840 11904.76 1344
+37.781624 11904.76 1344
+37.796408 11904.76 1344
+37.811192 11904.76 1344
+37.825976 11904.76 1344
+37.840760 11904.76 1344
+37.855544 11904.76 1344
+37.870328 11904.76 1344
+37.885112 11904.76 1344
+37.899896 11904.76 1344
+37.914680 11904.76 1344
+37.929464 11904.76 1344
+37.944248 11904.76 1344
+37.959032 11904.76 1344
+37.973728 11976.05 1336
+37.988424 11976.05 1336
+38.003120 11976.05 1336
+38.017816 11976.05 1336
+38.032512 11976.05 1336
+38.047208 11976.05 1336
+38.061904 11976.05 1336
+38.076600 11976.05 1336
+38.091296 11976.05 1336
+38.105992 11976.05 1336
+38.120688 11976.05 1336
+38.135296 12048.19 1328
+38.151232 12048.19 1328
+38.167168 12048.19 1328
+38.183104 12048.19 1328
+38.199040 12048.19 1328
+38.214976 12048.19 1328
+38.230912 12048.19 1328
+38.246848 12048.19 1328
+38.262784 12048.19 1328
+38.278720 12048.19 1328
+38.294656 12048.19 1328
+38.310496 12121.21 1320
+38.326336 12121.21 1320
+38.342176 12121.21 1320
+38.358016 12121.21 1320
+38.373856 12121.21 1320
+38.389696 12121.21 1320
+38.405536 12121.21 1320
+38.421376 12121.21 1320
+38.437216 12121.21 1320
+38.453056 12121.21 1320
+38.468896 12121.21 1320
+38.484736 12121.21 1320
+38.500576 12121.21 1320
+38.516416 12121.21 1320
+38.532256 12121.21 1320
+38.548096 12121.21 1320
+38.563840 12195.12 1312
+38.579584 12195.12 1312
+38.595328 12195.12 1312
+38.611072 12195.12 1312
+38.626816 12195.12 1312
+38.642560 12195.12 1312
+38.658304 12195.12 1312
+38.674048 12195.12 1312
+38.689792 12195.12 1312
+38.705536 12195.12 1312
+38.721280 12195.12 1312
+38.736928 12269.94 1304
+38.752576 12269.94 1304
+38.768224 12269.94 1304
+38.783872 12269.94 1304
+38.799520 12269.94 1304
+38.815168 12269.94 1304
+38.830816 12269.94 1304
+38.846464 12269.94 1304
+38.862112 12269.94 1304
+38.877760 12269.94 1304
+38.893408 12269.94 1304
+38.909056 12269.94 1304
+38.924704 12269.94 1304
+38.940352 12269.94 1304
+38.956000 12269.94 1304
+38.971648 12269.94 1304
+38.987296 12269.94 1304
+39.002944 12269.94 1304
+39.018592 12269.94 1304
+39.034240 12269.94 1304
+39.049888 12269.94 1304
+39.065536 12269.94 1304
+39.081184 12269.94 1304
+39.096832 12269.94 1304
+39.112480 12269.94 1304
+39.128128 12269.94 1304
+39.143776 12269.94 1304
+39.159424 12269.94 1304
+39.175072 12269.94 1304
+39.190720 12269.94 1304
+39.206368 12269.94 1304
+39.222016 12269.94 1304
+39.237568 12345.68 1296
+39.253120 12345.68 1296
+39.268672 12345.68 1296
+39.284224 12345.68 1296
+39.299776 12345.68 1296
+39.315328 12345.68 1296
+39.330880 12345.68 1296
+39.346432 12345.68 1296
+39.361984 12345.68 1296
+39.377536 12345.68 1296
+39.392992 12422.36 1288
+39.408448 12422.36 1288
+39.423904 12422.36 1288
+39.439360 12422.36 1288
+39.454816 12422.36 1288
+39.470272 12422.36 1288
+39.485728 12422.36 1288
+39.501184 12422.36 1288
+39.516640 12422.36 1288
+39.532096 12422.36 1288
+39.547552 12422.36 1288
+39.563008 12422.36 1288
+39.578464 12422.36 1288
+39.593920 12422.36 1288
+39.609376 12422.36 1288
+39.624832 12422.36 1288
+39.640192 12500.00 1280
+39.655552 12500.00 1280
+39.670912 12500.00 1280
+39.686272 12500.00 1280
+39.701632 12500.00 1280
+39.716992 12500.00 1280
+39.732352 12500.00 1280
+39.747712 12500.00 1280
+39.763072 12500.00 1280
+39.778432 12500.00 1280
+39.793792 12500.00 1280
+39.809056 12578.62 1272
+39.824320 12578.62 1272
+39.839584 12578.62 1272
+39.854848 12578.62 1272
+39.870112 12578.62 1272
+39.885376 12578.62 1272
+39.900640 12578.62 1272
+39.915904 12578.62 1272
+39.931168 12578.62 1272
+39.946432 12578.62 1272
+39.961696 12578.62 1272
+39.976960 12578.62 1272
+39.992224 12578.62 1272
+40.007488 12578.62 1272
+40.022752 12578.62 1272
+40.038016 12578.62 1272
+40.053184 12658.23 1264
+40.068352 12658.23 1264
+40.083520 12658.23 1264
+40.098688 12658.23 1264
+40.113856 12658.23 1264
+40.129024 12658.23 1264
+40.144192 12658.23 1264
+40.159360 12658.23 1264
+40.174528 12658.23 1264
+40.189696 12658.23 1264
+40.204864 12658.23 1264
+40.220032 12658.23 1264
+40.235200 12658.23 1264
+40.250368 12658.23 1264
+40.265536 12658.23 1264
+40.280704 12658.23 1264
+40.295776 12738.85 1256
+40.310848 12738.85 1256
+40.325920 12738.85 1256
+40.340992 12738.85 1256
+40.356064 12738.85 1256
+40.371136 12738.85 1256
+40.386208 12738.85 1256
+40.401280 12738.85 1256
+40.416352 12738.85 1256
+40.431424 12738.85 1256
+40.446496 12738.85 1256
+40.461568 12738.85 1256
+40.476640 12738.85 1256
+40.491712 12738.85 1256
+40.506784 12738.85 1256
+40.521856 12738.85 1256
+40.536928 12738.85 1256
+40.552000 12738.85 1256
+40.567072 12738.85 1256
+40.582144 12738.85 1256
+40.597216 12738.85 1256
+40.612288 12738.85 1256
+40.627360 12738.85 1256
+40.642432 12738.85 1256
+40.657504 12738.85 1256
+40.672576 12738.85 1256
+40.687648 12738.85 1256
+40.702624 12820.51 1248
+40.717600 12820.51 1248
+40.732576 12820.51 1248
+40.747552 12820.51 1248
+40.762528 12820.51 1248
+40.777504 12820.51 1248
+40.792480 12820.51 1248
+40.807456 12820.51 1248
+40.822432 12820.51 1248
+40.837408 12820.51 1248
+40.852384 12820.51 1248
+40.867360 12820.51 1248
+40.882336 12820.51 1248
+40.897312 12820.51 1248
+40.912288 12820.51 1248
+40.927264 12820.51 1248
+40.942240 12820.51 1248
+40.957216 12820.51 1248
+40.972192 12820.51 1248
+40.987168 12820.51 1248
+41.002144 12820.51 1248
+41.017024 12903.23 1240
+41.031904 12903.23 1240
+41.046784 12903.23 1240
+41.061664 12903.23 1240
+41.076544 12903.23 1240
+41.091424 12903.23 1240
+41.106304 12903.23 1240
+41.121184 12903.23 1240
+41.136064 12903.23 1240
+41.150944 12903.23 1240
+41.165824 12903.23 1240
+41.180608 12987.01 1232
+41.195392 12987.01 1232
+41.210176 12987.01 1232
+41.224960 12987.01 1232
+41.239744 12987.01 1232
+41.254528 12987.01 1232
+41.269312 12987.01 1232
+41.284096 12987.01 1232
+41.298880 12987.01 1232
+41.313664 12987.01 1232
+41.328352 13071.90 1224
+41.344264 13071.90 1224
+41.360176 13071.90 1224
+41.376088 13071.90 1224
+41.392000 13071.90 1224
+41.407912 13071.90 1224
+41.423824 13071.90 1224
+41.439736 13071.90 1224
+41.455648 13071.90 1224
+41.471560 13071.90 1224
+41.487472 13071.90 1224
+41.503384 13071.90 1224
+41.519296 13071.90 1224
+41.535208 13071.90 1224
+41.551120 13071.90 1224
+41.567032 13071.90 1224
+41.582944 13071.90 1224
+41.598856 13071.90 1224
+41.614768 13071.90 1224
+41.630680 13071.90 1224
+41.646488 13157.89 1216
+41.662296 13157.89 1216
+41.678104 13157.89 1216
+41.693912 13157.89 1216
+41.709720 13157.89 1216
+41.725528 13157.89 1216
+41.741336 13157.89 1216
+41.757144 13157.89 1216
+41.772952 13157.89 1216
+41.788760 13157.89 1216
+41.804568 13157.89 1216
+41.820376 13157.89 1216
+41.836184 13157.89 1216
+41.851992 13157.89 1216
+41.867800 13157.89 1216
+41.883608 13157.89 1216
+41.899416 13157.89 1216
+41.915224 13157.89 1216
+41.931032 13157.89 1216
+41.946840 13157.89 1216
+41.962648 13157.89 1216
+41.978456 13157.89 1216
+41.994264 13157.89 1216
+42.010072 13157.89 1216
+42.025880 13157.89 1216
+42.041688 13157.89 1216
+42.057496 13157.89 1216
+42.073304 13157.89 1216
+42.089112 13157.89 1216
+42.104920 13157.89 1216
+42.120624 13245.03 1208
+42.136328 13245.03 1208
+42.152032 13245.03 1208
+42.167736 13245.03 1208
+42.183440 13245.03 1208
+42.199144 13245.03 1208
+42.214848 13245.03 1208
+42.230552 13245.03 1208
+42.246256 13245.03 1208
+42.261856 13333.33 1200
+42.277456 13333.33 1200
+42.293056 13333.33 1200
+42.308656 13333.33 1200
+42.324256 13333.33 1200
+42.339856 13333.33 1200
+42.355456 13333.33 1200
+42.371056 13333.33 1200
+42.386656 13333.33 1200
+42.402256 13333.33 1200
+42.417856 13333.33 1200
+42.433456 13333.33 1200
+42.449056 13333.33 1200
+42.464656 13333.33 1200
+42.480256 13333.33 1200
+42.495856 13333.33 1200
+42.511456 13333.33 1200
+42.527056 13333.33 1200
+42.542656 13333.33 1200
+42.558256 13333.33 1200
+42.573752 13422.82 1192
+42.589248 13422.82 1192
+42.604744 13422.82 1192
+42.620240 13422.82 1192
+42.635736 13422.82 1192
+42.651232 13422.82 1192
+42.666728 13422.82 1192
+42.682224 13422.82 1192
+42.697720 13422.82 1192
+42.713216 13422.82 1192
+42.728608 13513.51 1184
+42.744000 13513.51 1184
+42.759392 13513.51 1184
+42.774784 13513.51 1184
+42.790176 13513.51 1184
+42.805568 13513.51 1184
+42.820960 13513.51 1184
+42.836352 13513.51 1184
+42.851744 13513.51 1184
+42.867136 13513.51 1184
+42.882528 13513.51 1184
+42.897920 13513.51 1184
+42.913312 13513.51 1184
+42.928704 13513.51 1184
+42.944096 13513.51 1184
+42.959488 13513.51 1184
+42.974880 13513.51 1184
+42.990272 13513.51 1184
+43.005664 13513.51 1184
+43.021056 13513.51 1184
+43.036344 13605.44 1176
+43.051632 13605.44 1176
+43.066920 13605.44 1176
+43.082208 13605.44 1176
+43.097496 13605.44 1176
+43.112784 13605.44 1176
+43.128072 13605.44 1176
+43.143360 13605.44 1176
+43.158648 13605.44 1176
+43.173936 13605.44 1176
+43.189224 13605.44 1176
+43.204512 13605.44 1176
+43.219800 13605.44 1176
+43.235088 13605.44 1176
+43.250376 13605.44 1176
+43.265664 13605.44 1176
+43.280952 13605.44 1176
+43.296240 13605.44 1176
+43.311528 13605.44 1176
+43.326816 13605.44 1176
+43.342104 13605.44 1176
+43.357392 13605.44 1176
+43.372680 13605.44 1176
+43.387968 13605.44 1176
+43.403256 13605.44 1176
+43.418544 13605.44 1176
+43.433832 13605.44 1176
+43.449120 13605.44 1176
+43.464408 13605.44 1176
+43.479592 13698.63 1168
+43.494776 13698.63 1168
+43.509960 13698.63 1168
+43.525144 13698.63 1168
+43.540328 13698.63 1168
+43.555512 13698.63 1168
+43.570696 13698.63 1168
+43.585880 13698.63 1168
+43.601064 13698.63 1168
+43.616248 13698.63 1168
+43.631432 13698.63 1168
+43.646616 13698.63 1168
+43.661800 13698.63 1168
+43.676984 13698.63 1168
+43.692168 13698.63 1168
+43.707352 13698.63 1168
+43.722536 13698.63 1168
+43.737720 13698.63 1168
+43.752904 13698.63 1168
+43.768088 13698.63 1168
+43.783168 13793.10 1160
+43.798248 13793.10 1160
+43.813328 13793.10 1160
+43.828408 13793.10 1160
+43.843488 13793.10 1160
+43.858568 13793.10 1160
+43.873648 13793.10 1160
+43.888728 13793.10 1160
+43.903808 13793.10 1160
+43.918888 13793.10 1160
+43.933864 13888.89 1152
+43.948840 13888.89 1152
+43.963816 13888.89 1152
+43.978792 13888.89 1152
+43.993768 13888.89 1152
+44.008744 13888.89 1152
+44.023720 13888.89 1152
+44.038696 13888.89 1152
+44.053672 13888.89 1152
+44.068648 13888.89 1152
+44.083624 13888.89 1152
+44.098600 13888.89 1152
+44.113576 13888.89 1152
+44.128552 13888.89 1152
+44.143528 13888.89 1152
+44.158504 13888.89 1152
+44.173480 13888.89 1152
+44.188456 13888.89 1152
+44.203432 13888.89 1152
+44.218408 13888.89 1152
+44.233384 13888.89 1152
+44.248360 13888.89 1152
+44.263336 13888.89 1152
+44.278312 13888.89 1152
+44.293288 13888.89 1152
+44.308264 13888.89 1152
+44.323240 13888.89 1152
+44.338216 13888.89 1152
+44.353192 13888.89 1152
+44.368064 13986.01 1144
+44.382936 13986.01 1144
+44.397808 13986.01 1144
+44.412680 13986.01 1144
+44.427552 13986.01 1144
+44.442424 13986.01 1144
+44.457296 13986.01 1144
+44.472168 13986.01 1144
+44.487040 13986.01 1144
+44.501912 13986.01 1144
+44.516784 13986.01 1144
+44.531656 13986.01 1144
+44.546528 13986.01 1144
+44.561400 13986.01 1144
+44.576272 13986.01 1144
+44.591144 13986.01 1144
+44.606016 13986.01 1144
+44.620888 13986.01 1144
+44.635760 13986.01 1144
+44.650632 13986.01 1144
+44.665400 14084.51 1136
+44.681304 14084.51 1136
+44.697208 14084.51 1136
+44.713112 14084.51 1136
+44.729016 14084.51 1136
+44.744920 14084.51 1136
+44.760824 14084.51 1136
+44.776728 14084.51 1136
+44.792632 14084.51 1136
+44.808536 14084.51 1136
+44.824440 14084.51 1136
+44.840344 14084.51 1136
+44.856248 14084.51 1136
+44.872152 14084.51 1136
+44.888056 14084.51 1136
+44.903960 14084.51 1136
+44.919864 14084.51 1136
+44.935768 14084.51 1136
+44.951560 14184.40 1128
+44.967352 14184.40 1128
+44.983144 14184.40 1128
+44.998936 14184.40 1128
+45.014728 14184.40 1128
+45.030520 14184.40 1128
+45.046312 14184.40 1128
+45.062104 14184.40 1128
+45.077896 14184.40 1128
+45.093576 14285.71 1120
+45.109256 14285.71 1120
+45.124936 14285.71 1120
+45.140616 14285.71 1120
+45.156296 14285.71 1120
+45.171976 14285.71 1120
+45.187656 14285.71 1120
+45.203336 14285.71 1120
+45.219016 14285.71 1120
+45.234696 14285.71 1120
+45.250376 14285.71 1120
+45.266056 14285.71 1120
+45.281736 14285.71 1120
+45.297416 14285.71 1120
+45.313096 14285.71 1120
+45.328776 14285.71 1120
+45.344456 14285.71 1120
+45.360136 14285.71 1120
+45.375816 14285.71 1120
+45.391496 14285.71 1120
+45.407176 14285.71 1120
+45.422856 14285.71 1120
+45.438536 14285.71 1120
+45.454216 14285.71 1120
+45.469896 14285.71 1120
+45.485576 14285.71 1120
+45.501256 14285.71 1120
+45.516936 14285.71 1120
+45.532616 14285.71 1120
+45.548296 14285.71 1120
+45.563976 14285.71 1120
+45.579656 14285.71 1120
+45.595336 14285.71 1120
+45.611016 14285.71 1120
+45.626696 14285.71 1120
+45.642376 14285.71 1120
+45.658056 14285.71 1120
+45.673624 14388.49 1112
+45.689192 14388.49 1112
+45.704760 14388.49 1112
+45.720328 14388.49 1112
+45.735896 14388.49 1112
+45.751464 14388.49 1112
+45.767032 14388.49 1112
+45.782600 14388.49 1112
+45.798168 14388.49 1112
+45.813736 14388.49 1112
+45.829304 14388.49 1112
+45.844872 14388.49 1112
+45.860440 14388.49 1112
+45.876008 14388.49 1112
+45.891576 14388.49 1112
+45.907144 14388.49 1112
+45.922712 14388.49 1112
+45.938280 14388.49 1112
+45.953736 14492.75 1104
+45.969192 14492.75 1104
+45.984648 14492.75 1104
+46.000104 14492.75 1104
+46.015560 14492.75 1104
+46.031016 14492.75 1104
+46.046472 14492.75 1104
+46.061928 14492.75 1104
+46.077384 14492.75 1104
+46.092728 14598.54 1096
+46.108072 14598.54 1096
+46.123416 14598.54 1096
+46.138760 14598.54 1096
+46.154104 14598.54 1096
+46.169448 14598.54 1096
+46.184792 14598.54 1096
+46.200136 14598.54 1096
+46.215480 14598.54 1096
+46.230824 14598.54 1096
+46.246168 14598.54 1096
+46.261512 14598.54 1096
+46.276856 14598.54 1096
+46.292200 14598.54 1096
+46.307544 14598.54 1096
+46.322888 14598.54 1096
+46.338232 14598.54 1096
+46.353576 14598.54 1096
+46.368920 14598.54 1096
+46.384264 14598.54 1096
+46.399608 14598.54 1096
+46.414952 14598.54 1096
+46.430296 14598.54 1096
+46.445640 14598.54 1096
+46.460984 14598.54 1096
+46.476328 14598.54 1096
+46.491672 14598.54 1096
+46.507016 14598.54 1096
+46.522360 14598.54 1096
+46.537704 14598.54 1096
+46.553048 14598.54 1096
+46.568392 14598.54 1096
+46.583736 14598.54 1096
+46.599080 14598.54 1096
+46.614424 14598.54 1096
+46.629768 14598.54 1096
+46.645112 14598.54 1096
+46.660344 14705.88 1088
+46.675576 14705.88 1088
+46.690808 14705.88 1088
+46.706040 14705.88 1088
+46.721272 14705.88 1088
+46.736504 14705.88 1088
+46.751736 14705.88 1088
+46.766968 14705.88 1088
+46.782200 14705.88 1088
+46.797432 14705.88 1088
+46.812664 14705.88 1088
+46.827896 14705.88 1088
+46.843128 14705.88 1088
+46.858360 14705.88 1088
+46.873592 14705.88 1088
+46.888824 14705.88 1088
+46.904056 14705.88 1088
+46.919288 14705.88 1088
+46.934408 14814.81 1080
+46.949528 14814.81 1080
+46.964648 14814.81 1080
+46.979768 14814.81 1080
+46.994888 14814.81 1080
+47.010008 14814.81 1080
+47.025128 14814.81 1080
+47.040248 14814.81 1080
+47.055368 14814.81 1080
+47.070488 14814.81 1080
+47.085608 14814.81 1080
+47.100728 14814.81 1080
+47.115848 14814.81 1080
+47.130968 14814.81 1080
+47.146088 14814.81 1080
+47.161208 14814.81 1080
+47.176328 14814.81 1080
+47.191448 14814.81 1080
+47.206568 14814.81 1080
+47.221688 14814.81 1080
+47.236808 14814.81 1080
+47.251928 14814.81 1080
+47.267048 14814.81 1080
+47.282168 14814.81 1080
+47.297288 14814.81 1080
+47.312408 14814.81 1080
+47.327528 14814.81 1080
+47.342648 14814.81 1080
+47.357768 14814.81 1080
+47.372888 14814.81 1080
+47.388008 14814.81 1080
+47.403128 14814.81 1080
+47.418248 14814.81 1080
+47.433368 14814.81 1080
+47.448488 14814.81 1080
+47.463608 14814.81 1080
+47.478728 14814.81 1080
+47.493736 14925.37 1072
+47.508744 14925.37 1072
+47.523752 14925.37 1072
+47.538760 14925.37 1072
+47.553768 14925.37 1072
+47.568776 14925.37 1072
+47.583784 14925.37 1072
+47.598792 14925.37 1072
+47.613800 14925.37 1072
+47.628696 15037.59 1064
+47.644656 15037.59 1064
+47.660616 15037.59 1064
+47.676576 15037.59 1064
+47.692536 15037.59 1064
+47.708496 15037.59 1064
+47.724456 15037.59 1064
+47.740416 15037.59 1064
+47.756376 15037.59 1064
+47.772336 15037.59 1064
+47.788296 15037.59 1064
+47.804256 15037.59 1064
+47.820216 15037.59 1064
+47.836176 15037.59 1064
+47.852136 15037.59 1064
+47.868096 15037.59 1064
+47.884056 15037.59 1064
+47.899896 15151.52 1056
+47.915736 15151.52 1056
+47.931576 15151.52 1056
+47.947416 15151.52 1056
+47.963256 15151.52 1056
+47.979096 15151.52 1056
+47.994936 15151.52 1056
+48.010776 15151.52 1056
+48.026616 15151.52 1056
+48.042456 15151.52 1056
+48.058296 15151.52 1056
+48.074136 15151.52 1056
+48.089976 15151.52 1056
+48.105816 15151.52 1056
+48.121656 15151.52 1056
+48.137496 15151.52 1056
+48.153336 15151.52 1056
+48.169176 15151.52 1056
+48.185016 15151.52 1056
+48.200856 15151.52 1056
+48.216696 15151.52 1056
+48.232536 15151.52 1056
+48.248376 15151.52 1056
+48.264216 15151.52 1056
+48.280056 15151.52 1056
+48.295896 15151.52 1056
+48.311736 15151.52 1056
+48.327576 15151.52 1056
+48.343416 15151.52 1056
+48.359256 15151.52 1056
+48.375096 15151.52 1056
+48.390936 15151.52 1056
+48.406776 15151.52 1056
+48.422616 15151.52 1056
+48.438336 15267.18 1048
+48.454056 15267.18 1048
+48.469776 15267.18 1048
+48.485496 15267.18 1048
+48.501216 15267.18 1048
+48.516936 15267.18 1048
+48.532656 15267.18 1048
+48.548376 15267.18 1048
+48.564096 15267.18 1048
+48.579816 15267.18 1048
+48.595536 15267.18 1048
+48.611256 15267.18 1048
+48.626976 15267.18 1048
+48.642696 15267.18 1048
+48.658416 15267.18 1048
+48.674136 15267.18 1048
+48.689856 15267.18 1048
+48.705456 15384.62 1040
+48.721056 15384.62 1040
+48.736656 15384.62 1040
+48.752256 15384.62 1040
+48.767856 15384.62 1040
+48.783456 15384.62 1040
+48.799056 15384.62 1040
+48.814656 15384.62 1040
+48.830256 15384.62 1040
+48.845856 15384.62 1040
+48.861456 15384.62 1040
+48.877056 15384.62 1040
+48.892656 15384.62 1040
+48.908256 15384.62 1040
+48.923856 15384.62 1040
+48.939456 15384.62 1040
+48.955056 15384.62 1040
+48.970536 15503.88 1032
+48.986016 15503.88 1032
+49.001496 15503.88 1032
+49.016976 15503.88 1032
+49.032456 15503.88 1032
+49.047936 15503.88 1032
+49.063416 15503.88 1032
+49.078896 15503.88 1032
+49.094376 15503.88 1032
+49.109856 15503.88 1032
+49.125336 15503.88 1032
+49.140816 15503.88 1032
+49.156296 15503.88 1032
+49.171776 15503.88 1032
+49.187256 15503.88 1032
+49.202736 15503.88 1032
+49.218216 15503.88 1032
+49.233696 15503.88 1032
+49.249176 15503.88 1032
+49.264656 15503.88 1032
+49.280136 15503.88 1032
+49.295616 15503.88 1032
+49.311096 15503.88 1032
+49.326576 15503.88 1032
+49.342056 15503.88 1032
+49.357536 15503.88 1032
+49.373016 15503.88 1032
+49.388496 15503.88 1032
+49.403976 15503.88 1032
+49.419456 15503.88 1032
+49.434936 15503.88 1032
+49.450416 15503.88 1032
+49.465896 15503.88 1032
+49.481376 15503.88 1032
+49.496856 15503.88 1032
+49.512216 15625.00 1024
+49.527576 15625.00 1024
+49.542936 15625.00 1024
+49.558296 15625.00 1024
+49.573656 15625.00 1024
+49.589016 15625.00 1024
+49.604376 15625.00 1024
+49.619736 15625.00 1024
+49.635096 15625.00 1024
+49.650456 15625.00 1024
+49.665816 15625.00 1024
+49.681176 15625.00 1024
+49.696536 15625.00 1024
+49.711896 15625.00 1024
+49.727256 15625.00 1024
+49.742616 15625.00 1024
+49.757976 15625.00 1024
+49.773276 15686.27 1020
+49.788576 15686.27 1020
+49.803876 15686.27 1020
+49.819176 15686.27 1020
+49.834476 15686.27 1020
+49.849776 15686.27 1020
+49.865076 15686.27 1020
+49.880376 15686.27 1020
+49.895676 15686.27 1020
+49.910976 15686.27 1020
+49.926276 15686.27 1020
+49.941576 15686.27 1020
+49.956876 15686.27 1020
+49.972176 15686.27 1020
+49.987476 15686.27 1020
+50.002776 15686.27 1020
+50.018076 15686.27 1020
+50.033316 15748.03 1016
+50.048556 15748.03 1016
+50.063796 15748.03 1016
+50.079036 15748.03 1016
+50.094276 15748.03 1016
+50.109516 15748.03 1016
+50.124756 15748.03 1016
+50.139996 15748.03 1016
+50.155236 15748.03 1016
+50.170476 15748.03 1016
+50.185716 15748.03 1016
+50.200956 15748.03 1016
+50.216196 15748.03 1016
+50.231436 15748.03 1016
+50.246676 15748.03 1016
+50.261916 15748.03 1016
+50.277156 15748.03 1016
+50.292276 15873.02 1008
+50.307396 15873.02 1008
+50.322516 15873.02 1008
+50.337636 15873.02 1008
+50.352756 15873.02 1008
+50.367876 15873.02 1008
+50.382996 15873.02 1008
+50.398116 15873.02 1008
+50.413236 15873.02 1008
+50.428356 15873.02 1008
+50.443476 15873.02 1008
+50.458596 15873.02 1008
+50.473716 15873.02 1008
+50.488836 15873.02 1008
+50.503956 15873.02 1008
+50.519076 15873.02 1008
+50.534196 15873.02 1008
+50.549316 15873.02 1008
+50.564436 15873.02 1008
+50.579556 15873.02 1008
+50.594676 15873.02 1008
+50.609796 15873.02 1008
+50.624916 15873.02 1008
+50.640036 15873.02 1008
+50.655156 15873.02 1008
+50.670216 15936.25 1004
+50.685276 15936.25 1004
+50.700336 15936.25 1004
+50.715396 15936.25 1004
+50.730456 15936.25 1004
+50.745516 15936.25 1004
+50.760576 15936.25 1004
+50.775636 15936.25 1004
+50.790696 15936.25 1004
+50.805756 15936.25 1004
+50.820816 15936.25 1004
+50.835876 15936.25 1004
+50.850936 15936.25 1004
+50.865996 15936.25 1004
+50.881056 15936.25 1004
+50.896116 15936.25 1004
+50.911176 15936.25 1004
+50.926176 16000.00 1000
+50.942176 16000.00 1000
+50.958176 16000.00 1000
+50.974176 16000.00 1000
+50.990176 16000.00 1000
+51.006176 16000.00 1000
+51.022176 16000.00 1000
+51.038176 16000.00 1000
+51.054176 16000.00 1000
+51.070176 16000.00 1000
+51.086176 16000.00 1000
+51.102176 16000.00 1000
+51.118176 16000.00 1000
+51.134176 16000.00 1000
+51.150176 16000.00 1000
+51.166176 16000.00 1000
+51.182048 16129.03 992
+51.197920 16129.03 992
+51.213792 16129.03 992
+51.229664 16129.03 992
+51.245536 16129.03 992
+51.261408 16129.03 992
+51.277280 16129.03 992
+51.293152 16129.03 992
+51.309024 16129.03 992
+51.324896 16129.03 992
+51.340768 16129.03 992
+51.356640 16129.03 992
+51.372512 16129.03 992
+51.388384 16129.03 992
+51.404256 16129.03 992
+51.420128 16129.03 992
+51.435936 16194.33 988
+51.451744 16194.33 988
+51.467552 16194.33 988
+51.483360 16194.33 988
+51.499168 16194.33 988
+51.514976 16194.33 988
+51.530784 16194.33 988
+51.546592 16194.33 988
+51.562400 16194.33 988
+51.578208 16194.33 988
+51.594016 16194.33 988
+51.609824 16194.33 988
+51.625632 16194.33 988
+51.641440 16194.33 988
+51.657248 16194.33 988
+51.673056 16194.33 988
+51.688800 16260.16 984
+51.704544 16260.16 984
+51.720288 16260.16 984
+51.736032 16260.16 984
+51.751776 16260.16 984
+51.767520 16260.16 984
+51.783264 16260.16 984
+51.799008 16260.16 984
+51.814752 16260.16 984
+51.830496 16260.16 984
+51.846240 16260.16 984
+51.861984 16260.16 984
+51.877728 16260.16 984
+51.893472 16260.16 984
+51.909216 16260.16 984
+51.924960 16260.16 984
+51.940704 16260.16 984
+51.956448 16260.16 984
+51.972192 16260.16 984
+51.987936 16260.16 984
+52.003680 16260.16 984
+52.019424 16260.16 984
+52.035168 16260.16 984
+52.050912 16260.16 984
+52.066528 16393.44 976
+52.082144 16393.44 976
+52.097760 16393.44 976
+52.113376 16393.44 976
+52.128992 16393.44 976
+52.144608 16393.44 976
+52.160224 16393.44 976
+52.175840 16393.44 976
+52.191456 16393.44 976
+52.207072 16393.44 976
+52.222688 16393.44 976
+52.238304 16393.44 976
+52.253920 16393.44 976
+52.269536 16393.44 976
+52.285152 16393.44 976
+52.300768 16393.44 976
+52.316320 16460.91 972
+52.331872 16460.91 972
+52.347424 16460.91 972
+52.362976 16460.91 972
+52.378528 16460.91 972
+52.394080 16460.91 972
+52.409632 16460.91 972
+52.425184 16460.91 972
+52.440736 16460.91 972
+52.456288 16460.91 972
+52.471840 16460.91 972
+52.487392 16460.91 972
+52.502944 16460.91 972
+52.518496 16460.91 972
+52.534048 16460.91 972
+52.549600 16460.91 972
+52.565088 16528.93 968
+52.580576 16528.93 968
+52.596064 16528.93 968
+52.611552 16528.93 968
+52.627040 16528.93 968
+52.642528 16528.93 968
+52.658016 16528.93 968
+52.673504 16528.93 968
+52.688992 16528.93 968
+52.704480 16528.93 968
+52.719968 16528.93 968
+52.735456 16528.93 968
+52.750944 16528.93 968
+52.766432 16528.93 968
+52.781920 16528.93 968
+52.797408 16528.93 968
+52.812768 16666.67 960
+52.828128 16666.67 960
+52.843488 16666.67 960
+52.858848 16666.67 960
+52.874208 16666.67 960
+52.889568 16666.67 960
+52.904928 16666.67 960
+52.920288 16666.67 960
+52.935648 16666.67 960
+52.951008 16666.67 960
+52.966368 16666.67 960
+52.981728 16666.67 960
+52.997088 16666.67 960
+53.012448 16666.67 960
+53.027808 16666.67 960
+53.043168 16666.67 960
+53.058528 16666.67 960
+53.073888 16666.67 960
+53.089248 16666.67 960
+53.104608 16666.67 960
+53.119968 16666.67 960
+53.135328 16666.67 960
+53.150688 16666.67 960
+53.166048 16666.67 960
+53.181344 16736.40 956
+53.196640 16736.40 956
+53.211936 16736.40 956
+53.227232 16736.40 956
+53.242528 16736.40 956
+53.257824 16736.40 956
+53.273120 16736.40 956
+53.288416 16736.40 956
+53.303712 16736.40 956
+53.319008 16736.40 956
+53.334304 16736.40 956
+53.349600 16736.40 956
+53.364896 16736.40 956
+53.380192 16736.40 956
+53.395488 16736.40 956
+53.410784 16736.40 956
+53.426016 16806.72 952
+53.441248 16806.72 952
+53.456480 16806.72 952
+53.471712 16806.72 952
+53.486944 16806.72 952
+53.502176 16806.72 952
+53.517408 16806.72 952
+53.532640 16806.72 952
+53.547872 16806.72 952
+53.563104 16806.72 952
+53.578336 16806.72 952
+53.593568 16806.72 952
+53.608800 16806.72 952
+53.624032 16806.72 952
+53.639264 16806.72 952
+53.654496 16806.72 952
+53.669728 16806.72 952
+53.684960 16806.72 952
+53.700192 16806.72 952
+53.715424 16806.72 952
+53.730656 16806.72 952
+53.745888 16806.72 952
+53.761120 16806.72 952
+53.776352 16806.72 952
+53.791456 16949.15 944
+53.806560 16949.15 944
+53.821664 16949.15 944
+53.836768 16949.15 944
+53.851872 16949.15 944
+53.866976 16949.15 944
+53.882080 16949.15 944
+53.897184 16949.15 944
+53.912288 16949.15 944
+53.927392 16949.15 944
+53.942496 16949.15 944
+53.957600 16949.15 944
+53.972704 16949.15 944
+53.987808 16949.15 944
+54.002912 16949.15 944
+54.018016 16949.15 944
+54.033056 17021.28 940
+54.049036 17021.28 940
+54.065016 17021.28 940
+54.080996 17021.28 940
+54.096976 17021.28 940
+54.112956 17021.28 940
+54.128936 17021.28 940
+54.144916 17021.28 940
+54.160896 17021.28 940
+54.176876 17021.28 940
+54.192856 17021.28 940
+54.208836 17021.28 940
+54.224816 17021.28 940
+54.240796 17021.28 940
+54.256776 17021.28 940
+54.272688 17094.02 936
+54.288600 17094.02 936
+54.304512 17094.02 936
+54.320424 17094.02 936
+54.336336 17094.02 936
+54.352248 17094.02 936
+54.368160 17094.02 936
+54.384072 17094.02 936
+54.399984 17094.02 936
+54.415896 17094.02 936
+54.431808 17094.02 936
+54.447720 17094.02 936
+54.463632 17094.02 936
+54.479544 17094.02 936
+54.495456 17094.02 936
+54.511368 17094.02 936
+54.527280 17094.02 936
+54.543192 17094.02 936
+54.559104 17094.02 936
+54.575016 17094.02 936
+54.590928 17094.02 936
+54.606840 17094.02 936
+54.622752 17094.02 936
+54.638596 17167.38 932
+54.654440 17167.38 932
+54.670284 17167.38 932
+54.686128 17167.38 932
+54.701972 17167.38 932
+54.717816 17167.38 932
+54.733660 17167.38 932
+54.749504 17167.38 932
+54.765348 17167.38 932
+54.781192 17167.38 932
+54.797036 17167.38 932
+54.812880 17167.38 932
+54.828724 17167.38 932
+54.844568 17167.38 932
+54.860412 17167.38 932
+54.876120 17316.02 924
+54.891828 17316.02 924
+54.907536 17316.02 924
+54.923244 17316.02 924
+54.938952 17316.02 924
+54.954660 17316.02 924
+54.970368 17316.02 924
+54.986076 17316.02 924
+55.001784 17316.02 924
+55.017492 17316.02 924
+55.033200 17316.02 924
+55.048908 17316.02 924
+55.064616 17316.02 924
+55.080324 17316.02 924
+55.096032 17316.02 924
+55.111740 17316.02 924
+55.127448 17316.02 924
+55.143156 17316.02 924
+55.158864 17316.02 924
+55.174572 17316.02 924
+55.190280 17316.02 924
+55.205988 17316.02 924
+55.221696 17316.02 924
+55.237336 17391.30 920
+55.252976 17391.30 920
+55.268616 17391.30 920
+55.284256 17391.30 920
+55.299896 17391.30 920
+55.315536 17391.30 920
+55.331176 17391.30 920
+55.346816 17391.30 920
+55.362456 17391.30 920
+55.378096 17391.30 920
+55.393736 17391.30 920
+55.409376 17391.30 920
+55.425016 17391.30 920
+55.440656 17391.30 920
+55.456296 17391.30 920
+55.471936 17391.30 920
+55.487576 17391.30 920
+55.503216 17391.30 920
+55.518856 17391.30 920
+55.534496 17391.30 920
+55.550136 17391.30 920
+55.565776 17391.30 920
+55.581348 17467.25 916
+55.596920 17467.25 916
+55.612492 17467.25 916
+55.628064 17467.25 916
+55.643636 17467.25 916
+55.659208 17467.25 916
+55.674780 17467.25 916
+55.690352 17467.25 916
+55.705924 17467.25 916
+55.721496 17467.25 916
+55.737068 17467.25 916
+55.752640 17467.25 916
+55.768212 17467.25 916
+55.783784 17467.25 916
+55.799356 17467.25 916
+55.814860 17543.86 912
+55.830364 17543.86 912
+55.845868 17543.86 912
+55.861372 17543.86 912
+55.876876 17543.86 912
+55.892380 17543.86 912
+55.907884 17543.86 912
+55.923388 17543.86 912
+55.938892 17543.86 912
+55.954396 17543.86 912
+55.969900 17543.86 912
+55.985404 17543.86 912
+56.000908 17543.86 912
+56.016412 17543.86 912
+56.031916 17543.86 912
+56.047420 17543.86 912
+56.062924 17543.86 912
+56.078428 17543.86 912
+56.093932 17543.86 912
+56.109436 17543.86 912
+56.124940 17543.86 912
+56.140444 17543.86 912
+56.155948 17543.86 912
+56.171316 17699.12 904
+56.186684 17699.12 904
+56.202052 17699.12 904
+56.217420 17699.12 904
+56.232788 17699.12 904
+56.248156 17699.12 904
+56.263524 17699.12 904
+56.278892 17699.12 904
+56.294260 17699.12 904
+56.309628 17699.12 904
+56.324996 17699.12 904
+56.340364 17699.12 904
+56.355732 17699.12 904
+56.371100 17699.12 904
+56.386468 17699.12 904
+56.401768 17777.78 900
+56.417068 17777.78 900
+56.432368 17777.78 900
+56.447668 17777.78 900
+56.462968 17777.78 900
+56.478268 17777.78 900
+56.493568 17777.78 900
+56.508868 17777.78 900
+56.524168 17777.78 900
+56.539468 17777.78 900
+56.554768 17777.78 900
+56.570068 17777.78 900
+56.585368 17777.78 900
+56.600668 17777.78 900
+56.615968 17777.78 900
+56.631268 17777.78 900
+56.646568 17777.78 900
+56.661868 17777.78 900
+56.677168 17777.78 900
+56.692468 17777.78 900
+56.707768 17777.78 900
+56.723068 17777.78 900
+56.738368 17777.78 900
+56.753600 17857.14 896
+56.768832 17857.14 896
+56.784064 17857.14 896
+56.799296 17857.14 896
+56.814528 17857.14 896
+56.829760 17857.14 896
+56.844992 17857.14 896
+56.860224 17857.14 896
+56.875456 17857.14 896
+56.890688 17857.14 896
+56.905920 17857.14 896
+56.921152 17857.14 896
+56.936384 17857.14 896
+56.951616 17857.14 896
+56.966848 17857.14 896
+56.982080 17857.14 896
+56.997312 17857.14 896
+57.012544 17857.14 896
+57.027776 17857.14 896
+57.043008 17857.14 896
+57.058240 17857.14 896
+57.073472 17857.14 896
+57.088636 17937.22 892
+57.103800 17937.22 892
+57.118964 17937.22 892
+57.134128 17937.22 892
+57.149292 17937.22 892
+57.164456 17937.22 892
+57.179620 17937.22 892
+57.194784 17937.22 892
+57.209948 17937.22 892
+57.225112 17937.22 892
+57.240276 17937.22 892
+57.255440 17937.22 892
+57.270604 17937.22 892
+57.285768 17937.22 892
+57.300932 17937.22 892
+57.315960 18099.55 884
+57.331872 18099.55 884
+57.347784 18099.55 884
+57.363696 18099.55 884
+57.379608 18099.55 884
+57.395520 18099.55 884
+57.411432 18099.55 884
+57.427344 18099.55 884
+57.443256 18099.55 884
+57.459168 18099.55 884
+57.475080 18099.55 884
+57.490992 18099.55 884
+57.506904 18099.55 884
+57.522816 18099.55 884
+57.538728 18099.55 884
+57.554640 18099.55 884
+57.570552 18099.55 884
+57.586464 18099.55 884
+57.602376 18099.55 884
+57.618288 18099.55 884
+57.634200 18099.55 884
+57.650112 18099.55 884
+57.665952 18181.82 880
+57.681792 18181.82 880
+57.697632 18181.82 880
+57.713472 18181.82 880
+57.729312 18181.82 880
+57.745152 18181.82 880
+57.760992 18181.82 880
+57.776832 18181.82 880
+57.792672 18181.82 880
+57.808512 18181.82 880
+57.824352 18181.82 880
+57.840192 18181.82 880
+57.856032 18181.82 880
+57.871872 18181.82 880
+57.887712 18181.82 880
+57.903552 18181.82 880
+57.919392 18181.82 880
+57.935232 18181.82 880
+57.951072 18181.82 880
+57.966912 18181.82 880
+57.982752 18181.82 880
+57.998592 18181.82 880
+58.014432 18181.82 880
+58.030272 18181.82 880
+58.046112 18181.82 880
+58.061952 18181.82 880
+58.077792 18181.82 880
+58.093632 18181.82 880
+58.109400 18264.84 876
+58.125168 18264.84 876
+58.140936 18264.84 876
+58.156704 18264.84 876
+58.172472 18264.84 876
+58.188240 18264.84 876
+58.204008 18264.84 876
+58.219776 18264.84 876
+58.235544 18264.84 876
+58.251312 18264.84 876
+58.267080 18264.84 876
+58.282848 18264.84 876
+58.298616 18264.84 876
+58.314384 18264.84 876
+58.330080 18348.62 872
+58.345776 18348.62 872
+58.361472 18348.62 872
+58.377168 18348.62 872
+58.392864 18348.62 872
+58.408560 18348.62 872
+58.424256 18348.62 872
+58.439952 18348.62 872
+58.455648 18348.62 872
+58.471344 18348.62 872
+58.487040 18348.62 872
+58.502736 18348.62 872
+58.518432 18348.62 872
+58.534128 18348.62 872
+58.549752 18433.18 868
+58.565376 18433.18 868
+58.581000 18433.18 868
+58.596624 18433.18 868
+58.612248 18433.18 868
+58.627872 18433.18 868
+58.643496 18433.18 868
+58.659120 18433.18 868
+58.674744 18433.18 868
+58.690368 18433.18 868
+58.705992 18433.18 868
+58.721616 18433.18 868
+58.737240 18433.18 868
+58.752864 18433.18 868
+58.768488 18433.18 868
+58.784112 18433.18 868
+58.799736 18433.18 868
+58.815360 18433.18 868
+58.830984 18433.18 868
+58.846608 18433.18 868
+58.862232 18433.18 868
+58.877856 18433.18 868
+58.893480 18433.18 868
+58.909104 18433.18 868
+58.924728 18433.18 868
+58.940352 18433.18 868
+58.955976 18433.18 868
+58.971600 18433.18 868
+58.987224 18433.18 868
+59.002776 18518.52 864
+59.018328 18518.52 864
+59.033880 18518.52 864
+59.049432 18518.52 864
+59.064984 18518.52 864
+59.080536 18518.52 864
+59.096088 18518.52 864
+59.111640 18518.52 864
+59.127192 18518.52 864
+59.142744 18518.52 864
+59.158296 18518.52 864
+59.173848 18518.52 864
+59.189400 18518.52 864
+59.204952 18518.52 864
+59.220360 18691.59 856
+59.235768 18691.59 856
+59.251176 18691.59 856
+59.266584 18691.59 856
+59.281992 18691.59 856
+59.297400 18691.59 856
+59.312808 18691.59 856
+59.328216 18691.59 856
+59.343624 18691.59 856
+59.359032 18691.59 856
+59.374440 18691.59 856
+59.389848 18691.59 856
+59.405256 18691.59 856
+59.420664 18691.59 856
+59.436072 18691.59 856
+59.451480 18691.59 856
+59.466888 18691.59 856
+59.482296 18691.59 856
+59.497704 18691.59 856
+59.513112 18691.59 856
+59.528520 18691.59 856
+59.543928 18691.59 856
+59.559336 18691.59 856
+59.574744 18691.59 856
+59.590152 18691.59 856
+59.605560 18691.59 856
+59.620968 18691.59 856
+59.636376 18691.59 856
+59.651784 18691.59 856
+59.667120 18779.34 852
+59.682456 18779.34 852
+59.697792 18779.34 852
+59.713128 18779.34 852
+59.728464 18779.34 852
+59.743800 18779.34 852
+59.759136 18779.34 852
+59.774472 18779.34 852
+59.789808 18779.34 852
+59.805144 18779.34 852
+59.820480 18779.34 852
+59.835816 18779.34 852
+59.851152 18779.34 852
+59.866488 18779.34 852
+59.881752 18867.92 848
+59.897016 18867.92 848
+59.912280 18867.92 848
+59.927544 18867.92 848
+59.942808 18867.92 848
+59.958072 18867.92 848
+59.973336 18867.92 848
+59.988600 18867.92 848
+60.003864 18867.92 848
+60.019128 18867.92 848
+60.034392 18867.92 848
+60.049656 18867.92 848
+60.064920 18867.92 848
+60.080184 18867.92 848
+60.095448 18867.92 848
+60.110712 18867.92 848
+60.125976 18867.92 848
+60.141240 18867.92 848
+60.156504 18867.92 848
+60.171768 18867.92 848
+60.187032 18867.92 848
+60.202296 18867.92 848
+60.217560 18867.92 848
+60.232824 18867.92 848
+60.248088 18867.92 848
+60.263352 18867.92 848
+60.278616 18867.92 848
+60.293880 18867.92 848
+60.309072 18957.35 844
+60.324264 18957.35 844
+60.339456 18957.35 844
+60.354648 18957.35 844
+60.369840 18957.35 844
+60.385032 18957.35 844
+60.400224 18957.35 844
+60.415416 18957.35 844
+60.430608 18957.35 844
+60.445800 18957.35 844
+60.460992 18957.35 844
+60.476184 18957.35 844
+60.491376 18957.35 844
+60.506568 18957.35 844
+60.521688 19047.62 840
+60.537648 19047.62 840
+60.553608 19047.62 840
+60.569568 19047.62 840
+60.585528 19047.62 840
+60.601488 19047.62 840
+60.617448 19047.62 840
+60.633408 19047.62 840
+60.649368 19047.62 840
+60.665328 19047.62 840
+60.681288 19047.62 840
+60.697248 19047.62 840
+60.713208 19047.62 840
+60.729168 19047.62 840
+60.745128 19047.62 840
+60.761088 19047.62 840
+60.777048 19047.62 840
+60.793008 19047.62 840
+60.808968 19047.62 840
+60.824928 19047.62 840
+60.840888 19047.62 840
+60.856848 19047.62 840
+60.872808 19047.62 840
+60.888768 19047.62 840
+60.904728 19047.62 840
+60.920688 19047.62 840
+60.936648 19047.62 840
+60.952532 19138.76 836
+60.968416 19138.76 836
+60.984300 19138.76 836
+61.000184 19138.76 836
+61.016068 19138.76 836
+61.031952 19138.76 836
+61.047836 19138.76 836
+61.063720 19138.76 836
+61.079604 19138.76 836
+61.095488 19138.76 836
+61.111372 19138.76 836
+61.127256 19138.76 836
+61.143140 19138.76 836
+61.159024 19138.76 836
+61.174832 19230.77 832
+61.190640 19230.77 832
+61.206448 19230.77 832
+61.222256 19230.77 832
+61.238064 19230.77 832
+61.253872 19230.77 832
+61.269680 19230.77 832
+61.285488 19230.77 832
+61.301296 19230.77 832
+61.317104 19230.77 832
+61.332912 19230.77 832
+61.348720 19230.77 832
+61.364528 19230.77 832
+61.380336 19230.77 832
+61.396144 19230.77 832
+61.411952 19230.77 832
+61.427760 19230.77 832
+61.443568 19230.77 832
+61.459376 19230.77 832
+61.475184 19230.77 832
+61.490992 19230.77 832
+61.506800 19230.77 832
+61.522608 19230.77 832
+61.538416 19230.77 832
+61.554224 19230.77 832
+61.570032 19230.77 832
+61.585840 19230.77 832
+61.601496 19417.48 824
+61.617152 19417.48 824
+61.632808 19417.48 824
+61.648464 19417.48 824
+61.664120 19417.48 824
+61.679776 19417.48 824
+61.695432 19417.48 824
+61.711088 19417.48 824
+61.726744 19417.48 824
+61.742400 19417.48 824
+61.758056 19417.48 824
+61.773712 19417.48 824
+61.789368 19417.48 824
+61.805024 19417.48 824
+61.820680 19417.48 824
+61.836336 19417.48 824
+61.851992 19417.48 824
+61.867648 19417.48 824
+61.883304 19417.48 824
+61.898960 19417.48 824
+61.914616 19417.48 824
+61.930272 19417.48 824
+61.945928 19417.48 824
+61.961584 19417.48 824
+61.977240 19417.48 824
+61.992896 19417.48 824
+62.008552 19417.48 824
+62.024132 19512.20 820
+62.039712 19512.20 820
+62.055292 19512.20 820
+62.070872 19512.20 820
+62.086452 19512.20 820
+62.102032 19512.20 820
+62.117612 19512.20 820
+62.133192 19512.20 820
+62.148772 19512.20 820
+62.164352 19512.20 820
+62.179932 19512.20 820
+62.195512 19512.20 820
+62.211092 19512.20 820
+62.226596 19607.84 816
+62.242100 19607.84 816
+62.257604 19607.84 816
+62.273108 19607.84 816
+62.288612 19607.84 816
+62.304116 19607.84 816
+62.319620 19607.84 816
+62.335124 19607.84 816
+62.350628 19607.84 816
+62.366132 19607.84 816
+62.381636 19607.84 816
+62.397140 19607.84 816
+62.412644 19607.84 816
+62.428148 19607.84 816
+62.443652 19607.84 816
+62.459156 19607.84 816
+62.474660 19607.84 816
+62.490164 19607.84 816
+62.505668 19607.84 816
+62.521172 19607.84 816
+62.536676 19607.84 816
+62.552180 19607.84 816
+62.567684 19607.84 816
+62.583188 19607.84 816
+62.598692 19607.84 816
+62.614196 19607.84 816
+62.629700 19607.84 816
+62.645128 19704.43 812
+62.660556 19704.43 812
+62.675984 19704.43 812
+62.691412 19704.43 812
+62.706840 19704.43 812
+62.722268 19704.43 812
+62.737696 19704.43 812
+62.753124 19704.43 812
+62.768552 19704.43 812
+62.783980 19704.43 812
+62.799408 19704.43 812
+62.814836 19704.43 812
+62.830264 19704.43 812
+62.845692 19704.43 812
+62.861044 19801.98 808
+62.876396 19801.98 808
+62.891748 19801.98 808
+62.907100 19801.98 808
+62.922452 19801.98 808
+62.937804 19801.98 808
+62.953156 19801.98 808
+62.968508 19801.98 808
+62.983860 19801.98 808
+62.999212 19801.98 808
+63.014564 19801.98 808
+63.029916 19801.98 808
+63.045268 19801.98 808
+63.060620 19801.98 808
+63.075972 19801.98 808
+63.091324 19801.98 808
+63.106676 19801.98 808
+63.122028 19801.98 808
+63.137380 19801.98 808
+63.152732 19801.98 808
+63.168084 19801.98 808
+63.183436 19801.98 808
+63.198788 19801.98 808
+63.214140 19801.98 808
+63.229492 19801.98 808
+63.244844 19801.98 808
+63.260196 19801.98 808
+63.275472 19900.50 804
+63.290748 19900.50 804
+63.306024 19900.50 804
+63.321300 19900.50 804
+63.336576 19900.50 804
+63.351852 19900.50 804
+63.367128 19900.50 804
+63.382404 19900.50 804
+63.397680 19900.50 804
+63.412956 19900.50 804
+63.428232 19900.50 804
+63.443508 19900.50 804
+63.458784 19900.50 804
+63.474060 19900.50 804
+63.489336 19900.50 804
+63.504612 19900.50 804
+63.519888 19900.50 804
+63.535164 19900.50 804
+63.550440 19900.50 804
+63.565716 19900.50 804
+63.580992 19900.50 804
+63.596268 19900.50 804
+63.611544 19900.50 804
+63.626820 19900.50 804
+63.642096 19900.50 804
+63.657372 19900.50 804
+63.672648 19900.50 804
+63.687848 20000.00 800
+63.703848 20000.00 800
+63.719848 20000.00 800
+63.735848 20000.00 800
+63.751848 20000.00 800
+63.767848 20000.00 800
+63.783848 20000.00 800
+63.799848 20000.00 800
+63.815848 20000.00 800
+63.831848 20000.00 800
+63.847848 20000.00 800
+63.863848 20000.00 800
+63.879768 20100.50 796
+63.895688 20100.50 796
+63.911608 20100.50 796
+63.927528 20100.50 796
+63.943448 20100.50 796
+63.959368 20100.50 796
+63.975288 20100.50 796
+63.991208 20100.50 796
+64.007128 20100.50 796
+64.023048 20100.50 796
+64.038968 20100.50 796
+64.054888 20100.50 796
+64.070808 20100.50 796
+64.086728 20100.50 796
+64.102648 20100.50 796
+64.118568 20100.50 796
+64.134488 20100.50 796
+64.150408 20100.50 796
+64.166328 20100.50 796
+64.182248 20100.50 796
+64.198168 20100.50 796
+64.214088 20100.50 796
+64.230008 20100.50 796
+64.245928 20100.50 796
+64.261848 20100.50 796
+64.277768 20100.50 796
+64.293608 20202.02 792
+64.309448 20202.02 792
+64.325288 20202.02 792
+64.341128 20202.02 792
+64.356968 20202.02 792
+64.372808 20202.02 792
+64.388648 20202.02 792
+64.404488 20202.02 792
+64.420328 20202.02 792
+64.436168 20202.02 792
+64.452008 20202.02 792
+64.467848 20202.02 792
+64.483688 20202.02 792
+64.499528 20202.02 792
+64.515368 20202.02 792
+64.531208 20202.02 792
+64.547048 20202.02 792
+64.562888 20202.02 792
+64.578728 20202.02 792
+64.594568 20202.02 792
+64.610408 20202.02 792
+64.626248 20202.02 792
+64.642088 20202.02 792
+64.657928 20202.02 792
+64.673768 20202.02 792
+64.689608 20202.02 792
+64.705368 20304.57 788
+64.721128 20304.57 788
+64.736888 20304.57 788
+64.752648 20304.57 788
+64.768408 20304.57 788
+64.784168 20304.57 788
+64.799928 20304.57 788
+64.815688 20304.57 788
+64.831448 20304.57 788
+64.847208 20304.57 788
+64.862968 20304.57 788
+64.878728 20304.57 788
+64.894488 20304.57 788
+64.910248 20304.57 788
+64.926008 20304.57 788
+64.941768 20304.57 788
+64.957528 20304.57 788
+64.973288 20304.57 788
+64.989048 20304.57 788
+65.004808 20304.57 788
+65.020568 20304.57 788
+65.036328 20304.57 788
+65.052088 20304.57 788
+65.067848 20304.57 788
+65.083608 20304.57 788
+65.099288 20408.16 784
+65.114968 20408.16 784
+65.130648 20408.16 784
+65.146328 20408.16 784
+65.162008 20408.16 784
+65.177688 20408.16 784
+65.193368 20408.16 784
+65.209048 20408.16 784
+65.224728 20408.16 784
+65.240408 20408.16 784
+65.256088 20408.16 784
+65.271768 20408.16 784
+65.287448 20408.16 784
+65.302968 20618.56 776
+65.318488 20618.56 776
+65.334008 20618.56 776
+65.349528 20618.56 776
+65.365048 20618.56 776
+65.380568 20618.56 776
+65.396088 20618.56 776
+65.411608 20618.56 776
+65.427128 20618.56 776
+65.442648 20618.56 776
+65.458168 20618.56 776
+65.473688 20618.56 776
+65.489208 20618.56 776
+65.504728 20618.56 776
+65.520248 20618.56 776
+65.535768 20618.56 776
+65.551288 20618.56 776
+65.566808 20618.56 776
+65.582328 20618.56 776
+65.597848 20618.56 776
+65.613368 20618.56 776
+65.628888 20618.56 776
+65.644408 20618.56 776
+65.659928 20618.56 776
+65.675448 20618.56 776
+65.690968 20618.56 776
+65.706408 20725.39 772
+65.721848 20725.39 772
+65.737288 20725.39 772
+65.752728 20725.39 772
+65.768168 20725.39 772
+65.783608 20725.39 772
+65.799048 20725.39 772
+65.814488 20725.39 772
+65.829928 20725.39 772
+65.845368 20725.39 772
+65.860808 20725.39 772
+65.876248 20725.39 772
+65.891688 20725.39 772
+65.907128 20725.39 772
+65.922568 20725.39 772
+65.938008 20725.39 772
+65.953448 20725.39 772
+65.968888 20725.39 772
+65.984328 20725.39 772
+65.999768 20725.39 772
+66.015208 20725.39 772
+66.030648 20725.39 772
+66.046088 20725.39 772
+66.061528 20725.39 772
+66.076968 20725.39 772
+66.092328 20833.33 768
+66.107688 20833.33 768
+66.123048 20833.33 768
+66.138408 20833.33 768
+66.153768 20833.33 768
+66.169128 20833.33 768
+66.184488 20833.33 768
+66.199848 20833.33 768
+66.215208 20833.33 768
+66.230568 20833.33 768
+66.245928 20833.33 768
+66.261288 20833.33 768
+66.276648 20833.33 768
+66.292008 20833.33 768
+66.307368 20833.33 768
+66.322728 20833.33 768
+66.338088 20833.33 768
+66.353448 20833.33 768
+66.368808 20833.33 768
+66.384168 20833.33 768
+66.399528 20833.33 768
+66.414888 20833.33 768
+66.430248 20833.33 768
+66.445608 20833.33 768
+66.460968 20833.33 768
+66.476328 20833.33 768
+66.491608 20942.41 764
+66.506888 20942.41 764
+66.522168 20942.41 764
+66.537448 20942.41 764
+66.552728 20942.41 764
+66.568008 20942.41 764
+66.583288 20942.41 764
+66.598568 20942.41 764
+66.613848 20942.41 764
+66.629128 20942.41 764
+66.644408 20942.41 764
+66.659688 20942.41 764
+66.674968 20942.41 764
+66.690248 20942.41 764
+66.705528 20942.41 764
+66.720808 20942.41 764
+66.736088 20942.41 764
+66.751368 20942.41 764
+66.766648 20942.41 764
+66.781928 20942.41 764
+66.797208 20942.41 764
+66.812488 20942.41 764
+66.827768 20942.41 764
+66.843048 20942.41 764
+66.858328 20942.41 764
+66.873528 21052.63 760
+66.889488 21052.63 760
+66.905448 21052.63 760
+66.921408 21052.63 760
+66.937368 21052.63 760
+66.953328 21052.63 760
+66.969288 21052.63 760
+66.985248 21052.63 760
+67.001208 21052.63 760
+67.017168 21052.63 760
+67.033128 21052.63 760
+67.049088 21052.63 760
+67.065048 21052.63 760
+67.081008 21052.63 760
+67.096968 21052.63 760
+67.112928 21052.63 760
+67.128888 21052.63 760
+67.144848 21052.63 760
+67.160808 21052.63 760
+67.176768 21052.63 760
+67.192728 21052.63 760
+67.208688 21052.63 760
+67.224648 21052.63 760
+67.240608 21052.63 760
+67.256568 21052.63 760
+67.272444 21164.02 756
+67.288320 21164.02 756
+67.304196 21164.02 756
+67.320072 21164.02 756
+67.335948 21164.02 756
+67.351824 21164.02 756
+67.367700 21164.02 756
+67.383576 21164.02 756
+67.399452 21164.02 756
+67.415328 21164.02 756
+67.431204 21164.02 756
+67.447080 21164.02 756
+67.462872 21276.60 752
+67.478664 21276.60 752
+67.494456 21276.60 752
+67.510248 21276.60 752
+67.526040 21276.60 752
+67.541832 21276.60 752
+67.557624 21276.60 752
+67.573416 21276.60 752
+67.589208 21276.60 752
+67.605000 21276.60 752
+67.620792 21276.60 752
+67.636584 21276.60 752
+67.652376 21276.60 752
+67.668168 21276.60 752
+67.683960 21276.60 752
+67.699752 21276.60 752
+67.715544 21276.60 752
+67.731336 21276.60 752
+67.747128 21276.60 752
+67.762920 21276.60 752
+67.778712 21276.60 752
+67.794504 21276.60 752
+67.810296 21276.60 752
+67.826088 21276.60 752
+67.841796 21390.37 748
+67.857504 21390.37 748
+67.873212 21390.37 748
+67.888920 21390.37 748
+67.904628 21390.37 748
+67.920336 21390.37 748
+67.936044 21390.37 748
+67.951752 21390.37 748
+67.967460 21390.37 748
+67.983168 21390.37 748
+67.998876 21390.37 748
+68.014584 21390.37 748
+68.030292 21390.37 748
+68.046000 21390.37 748
+68.061708 21390.37 748
+68.077416 21390.37 748
+68.093124 21390.37 748
+68.108832 21390.37 748
+68.124540 21390.37 748
+68.140248 21390.37 748
+68.155956 21390.37 748
+68.171664 21390.37 748
+68.187372 21390.37 748
+68.203080 21390.37 748
+68.218788 21390.37 748
+68.234412 21505.38 744
+68.250036 21505.38 744
+68.265660 21505.38 744
+68.281284 21505.38 744
+68.296908 21505.38 744
+68.312532 21505.38 744
+68.328156 21505.38 744
+68.343780 21505.38 744
+68.359404 21505.38 744
+68.375028 21505.38 744
+68.390652 21505.38 744
+68.406276 21505.38 744
+68.421900 21505.38 744
+68.437524 21505.38 744
+68.453148 21505.38 744
+68.468772 21505.38 744
+68.484396 21505.38 744
+68.500020 21505.38 744
+68.515644 21505.38 744
+68.531268 21505.38 744
+68.546892 21505.38 744
+68.562516 21505.38 744
+68.578140 21505.38 744
+68.593764 21505.38 744
+68.609304 21621.62 740
+68.624844 21621.62 740
+68.640384 21621.62 740
+68.655924 21621.62 740
+68.671464 21621.62 740
+68.687004 21621.62 740
+68.702544 21621.62 740
+68.718084 21621.62 740
+68.733624 21621.62 740
+68.749164 21621.62 740
+68.764704 21621.62 740
+68.780244 21621.62 740
+68.795784 21621.62 740
+68.811324 21621.62 740
+68.826864 21621.62 740
+68.842404 21621.62 740
+68.857944 21621.62 740
+68.873484 21621.62 740
+68.889024 21621.62 740
+68.904564 21621.62 740
+68.920104 21621.62 740
+68.935644 21621.62 740
+68.951184 21621.62 740
+68.966724 21621.62 740
+68.982264 21621.62 740
+68.997720 21739.13 736
+69.013176 21739.13 736
+69.028632 21739.13 736
+69.044088 21739.13 736
+69.059544 21739.13 736
+69.075000 21739.13 736
+69.090456 21739.13 736
+69.105912 21739.13 736
+69.121368 21739.13 736
+69.136824 21739.13 736
+69.152280 21739.13 736
+69.167736 21739.13 736
+69.183192 21739.13 736
+69.198648 21739.13 736
+69.214104 21739.13 736
+69.229560 21739.13 736
+69.245016 21739.13 736
+69.260472 21739.13 736
+69.275928 21739.13 736
+69.291384 21739.13 736
+69.306840 21739.13 736
+69.322296 21739.13 736
+69.337752 21739.13 736
+69.353208 21739.13 736
+69.368580 21857.92 732
+69.383952 21857.92 732
+69.399324 21857.92 732
+69.414696 21857.92 732
+69.430068 21857.92 732
+69.445440 21857.92 732
+69.460812 21857.92 732
+69.476184 21857.92 732
+69.491556 21857.92 732
+69.506928 21857.92 732
+69.522300 21857.92 732
+69.537672 21857.92 732
+69.553044 21857.92 732
+69.568416 21857.92 732
+69.583788 21857.92 732
+69.599160 21857.92 732
+69.614532 21857.92 732
+69.629904 21857.92 732
+69.645276 21857.92 732
+69.660648 21857.92 732
+69.676020 21857.92 732
+69.691392 21857.92 732
+69.706764 21857.92 732
+69.722136 21857.92 732
+69.737424 21978.02 728
+69.752712 21978.02 728
+69.768000 21978.02 728
+69.783288 21978.02 728
+69.798576 21978.02 728
+69.813864 21978.02 728
+69.829152 21978.02 728
+69.844440 21978.02 728
+69.859728 21978.02 728
+69.875016 21978.02 728
+69.890304 21978.02 728
+69.905592 21978.02 728
+69.920880 21978.02 728
+69.936168 21978.02 728
+69.951456 21978.02 728
+69.966744 21978.02 728
+69.982032 21978.02 728
+69.997320 21978.02 728
+70.012608 21978.02 728
+70.027896 21978.02 728
+70.043184 21978.02 728
+70.058472 21978.02 728
+70.073760 21978.02 728
+70.089048 21978.02 728
+70.104336 21978.02 728
+70.119540 22099.45 724
+70.135468 22099.45 724
+70.151396 22099.45 724
+70.167324 22099.45 724
+70.183252 22099.45 724
+70.199180 22099.45 724
+70.215108 22099.45 724
+70.231036 22099.45 724
+70.246964 22099.45 724
+70.262892 22099.45 724
+70.278820 22099.45 724
+70.294748 22099.45 724
+70.310676 22099.45 724
+70.326604 22099.45 724
+70.342532 22099.45 724
+70.358460 22099.45 724
+70.374388 22099.45 724
+70.390316 22099.45 724
+70.406244 22099.45 724
+70.422172 22099.45 724
+70.438100 22099.45 724
+70.454028 22099.45 724
+70.469956 22099.45 724
+70.485796 22222.22 720
+70.501636 22222.22 720
+70.517476 22222.22 720
+70.533316 22222.22 720
+70.549156 22222.22 720
+70.564996 22222.22 720
+70.580836 22222.22 720
+70.596676 22222.22 720
+70.612516 22222.22 720
+70.628356 22222.22 720
+70.644196 22222.22 720
+70.660036 22222.22 720
+70.675876 22222.22 720
+70.691716 22222.22 720
+70.707556 22222.22 720
+70.723396 22222.22 720
+70.739236 22222.22 720
+70.755076 22222.22 720
+70.770916 22222.22 720
+70.786756 22222.22 720
+70.802596 22222.22 720
+70.818436 22222.22 720
+70.834276 22222.22 720
+70.850028 22346.37 716
+70.865780 22346.37 716
+70.881532 22346.37 716
+70.897284 22346.37 716
+70.913036 22346.37 716
+70.928788 22346.37 716
+70.944540 22346.37 716
+70.960292 22346.37 716
+70.976044 22346.37 716
+70.991796 22346.37 716
+71.007548 22346.37 716
+71.023300 22346.37 716
+71.039052 22346.37 716
+71.054804 22346.37 716
+71.070556 22346.37 716
+71.086308 22346.37 716
+71.102060 22346.37 716
+71.117812 22346.37 716
+71.133564 22346.37 716
+71.149316 22346.37 716
+71.165068 22346.37 716
+71.180820 22346.37 716
+71.196572 22346.37 716
+71.212324 22346.37 716
+71.227988 22471.91 712
+71.243652 22471.91 712
+71.259316 22471.91 712
+71.274980 22471.91 712
+71.290644 22471.91 712
+71.306308 22471.91 712
+71.321972 22471.91 712
+71.337636 22471.91 712
+71.353300 22471.91 712
+71.368964 22471.91 712
+71.384628 22471.91 712
+71.400292 22471.91 712
+71.415956 22471.91 712
+71.431620 22471.91 712
+71.447284 22471.91 712
+71.462948 22471.91 712
+71.478612 22471.91 712
+71.494276 22471.91 712
+71.509940 22471.91 712
+71.525604 22471.91 712
+71.541268 22471.91 712
+71.556932 22471.91 712
+71.572596 22471.91 712
+71.588260 22471.91 712
+71.603924 22471.91 712
+71.619588 22471.91 712
+71.635252 22471.91 712
+71.650916 22471.91 712
+71.666580 22471.91 712
+71.682244 22471.91 712
+71.697908 22471.91 712
+71.713572 22471.91 712
+71.729236 22471.91 712
+71.744900 22471.91 712
+71.760476 22598.87 708
+71.776052 22598.87 708
+71.791628 22598.87 708
+71.807204 22598.87 708
+71.822780 22598.87 708
+71.838356 22598.87 708
+71.853932 22598.87 708
+71.869508 22598.87 708
+71.885084 22598.87 708
+71.900660 22598.87 708
+71.916236 22598.87 708
+71.931812 22598.87 708
+71.947388 22598.87 708
+71.962964 22598.87 708
+71.978540 22598.87 708
+71.994116 22598.87 708
+72.009692 22598.87 708
+72.025268 22598.87 708
+72.040844 22598.87 708
+72.056420 22598.87 708
+72.071996 22598.87 708
+72.087572 22598.87 708
+72.103148 22598.87 708
+72.118724 22598.87 708
+72.134212 22727.27 704
+72.149700 22727.27 704
+72.165188 22727.27 704
+72.180676 22727.27 704
+72.196164 22727.27 704
+72.211652 22727.27 704
+72.227140 22727.27 704
+72.242628 22727.27 704
+72.258116 22727.27 704
+72.273604 22727.27 704
+72.289092 22727.27 704
+72.304580 22727.27 704
+72.320068 22727.27 704
+72.335556 22727.27 704
+72.351044 22727.27 704
+72.366532 22727.27 704
+72.382020 22727.27 704
+72.397508 22727.27 704
+72.412996 22727.27 704
+72.428484 22727.27 704
+72.443972 22727.27 704
+72.459460 22727.27 704
+72.474948 22727.27 704
+72.490348 22857.14 700
+72.505748 22857.14 700
+72.521148 22857.14 700
+72.536548 22857.14 700
+72.551948 22857.14 700
+72.567348 22857.14 700
+72.582748 22857.14 700
+72.598148 22857.14 700
+72.613548 22857.14 700
+72.628948 22857.14 700
+72.644348 22857.14 700
+72.659748 22857.14 700
+72.675148 22857.14 700
+72.690548 22857.14 700
+72.705948 22857.14 700
+72.721348 22857.14 700
+72.736748 22857.14 700
+72.752148 22857.14 700
+72.767548 22857.14 700
+72.782948 22857.14 700
+72.798348 22857.14 700
+72.813748 22857.14 700
+72.829148 22857.14 700
+72.844460 22988.51 696
+72.859772 22988.51 696
+72.875084 22988.51 696
+72.890396 22988.51 696
+72.905708 22988.51 696
+72.921020 22988.51 696
+72.936332 22988.51 696
+72.951644 22988.51 696
+72.966956 22988.51 696
+72.982268 22988.51 696
+72.997580 22988.51 696
+73.012892 22988.51 696
+73.028204 22988.51 696
+73.043516 22988.51 696
+73.058828 22988.51 696
+73.074140 22988.51 696
+73.089452 22988.51 696
+73.104764 22988.51 696
+73.120076 22988.51 696
+73.135388 22988.51 696
+73.150700 22988.51 696
+73.166012 22988.51 696
+73.181324 22988.51 696
+73.196636 22988.51 696
+73.211948 22988.51 696
+73.227260 22988.51 696
+73.242572 22988.51 696
+73.257884 22988.51 696
+73.273196 22988.51 696
+73.288508 22988.51 696
+73.303820 22988.51 696
+73.319132 22988.51 696
+73.334444 22988.51 696
+73.349756 22988.51 696
+73.365068 22988.51 696
+73.380380 22988.51 696
+73.395692 22988.51 696
+73.411004 22988.51 696
+73.426316 22988.51 696
+73.441628 22988.51 696
+73.456940 22988.51 696
+73.472252 22988.51 696
+73.487564 22988.51 696
+73.502876 22988.51 696
+73.518188 22988.51 696
+73.533500 22988.51 696
+73.548812 22988.51 696
+73.564124 22988.51 696
+73.579436 22988.51 696
+73.594748 22988.51 696
+73.610060 22988.51 696
+73.625372 22988.51 696
+73.640684 22988.51 696
+73.655996 22988.51 696
+73.671308 22988.51 696
+73.686620 22988.51 696
+73.701932 22988.51 696
+73.717244 22988.51 696
+73.732468 23121.39 692
+73.748384 23121.39 692
+73.764300 23121.39 692
+73.780216 23121.39 692
+73.796132 23121.39 692
+73.812048 23121.39 692
+73.827964 23121.39 692
+73.843880 23121.39 692
+73.859796 23121.39 692
+73.875712 23121.39 692
+73.891628 23121.39 692
+73.907544 23121.39 692
+73.923460 23121.39 692
+73.939376 23121.39 692
+73.955292 23121.39 692
+73.971208 23121.39 692
+73.987124 23121.39 692
+74.003040 23121.39 692
+74.018956 23121.39 692
+74.034872 23121.39 692
+74.050788 23121.39 692
+74.066704 23121.39 692
+74.082620 23121.39 692
+74.098444 23255.81 688
+74.114268 23255.81 688
+74.130092 23255.81 688
+74.145916 23255.81 688
+74.161740 23255.81 688
+74.177564 23255.81 688
+74.193388 23255.81 688
+74.209212 23255.81 688
+74.225036 23255.81 688
+74.240860 23255.81 688
+74.256684 23255.81 688
+74.272508 23255.81 688
+74.288332 23255.81 688
+74.304156 23255.81 688
+74.319980 23255.81 688
+74.335804 23255.81 688
+74.351628 23255.81 688
+74.367452 23255.81 688
+74.383276 23255.81 688
+74.399100 23255.81 688
+74.414924 23255.81 688
+74.430748 23255.81 688
+74.446480 23391.81 684
+74.462212 23391.81 684
+74.477944 23391.81 684
+74.493676 23391.81 684
+74.509408 23391.81 684
+74.525140 23391.81 684
+74.540872 23391.81 684
+74.556604 23391.81 684
+74.572336 23391.81 684
+74.588068 23391.81 684
+74.603800 23391.81 684
+74.619532 23391.81 684
+74.635264 23391.81 684
+74.650996 23391.81 684
+74.666728 23391.81 684
+74.682460 23391.81 684
+74.698192 23391.81 684
+74.713924 23391.81 684
+74.729656 23391.81 684
+74.745388 23391.81 684
+74.761120 23391.81 684
+74.776852 23391.81 684
+74.792492 23529.41 680
+74.808132 23529.41 680
+74.823772 23529.41 680
+74.839412 23529.41 680
+74.855052 23529.41 680
+74.870692 23529.41 680
+74.886332 23529.41 680
+74.901972 23529.41 680
+74.917612 23529.41 680
+74.933252 23529.41 680
+74.948892 23529.41 680
+74.964532 23529.41 680
+74.980172 23529.41 680
+74.995812 23529.41 680
+75.011452 23529.41 680
+75.027092 23529.41 680
+75.042732 23529.41 680
+75.058372 23529.41 680
+75.074012 23529.41 680
+75.089652 23529.41 680
+75.105292 23529.41 680
+75.120932 23529.41 680
+75.136572 23529.41 680
+75.152212 23529.41 680
+75.167852 23529.41 680
+75.183492 23529.41 680
+75.199132 23529.41 680
+75.214772 23529.41 680
+75.230412 23529.41 680
+75.246052 23529.41 680
+75.261692 23529.41 680
+75.277332 23529.41 680
+75.292972 23529.41 680
+75.308612 23529.41 680
+75.324160 23668.64 676
+75.339708 23668.64 676
+75.355256 23668.64 676
+75.370804 23668.64 676
+75.386352 23668.64 676
+75.401900 23668.64 676
+75.417448 23668.64 676
+75.432996 23668.64 676
+75.448544 23668.64 676
+75.464092 23668.64 676
+75.479640 23668.64 676
+75.495188 23668.64 676
+75.510736 23668.64 676
+75.526284 23668.64 676
+75.541832 23668.64 676
+75.557380 23668.64 676
+75.572928 23668.64 676
+75.588476 23668.64 676
+75.604024 23668.64 676
+75.619572 23668.64 676
+75.635120 23668.64 676
+75.650668 23668.64 676
+75.666124 23809.52 672
+75.681580 23809.52 672
+75.697036 23809.52 672
+75.712492 23809.52 672
+75.727948 23809.52 672
+75.743404 23809.52 672
+75.758860 23809.52 672
+75.774316 23809.52 672
+75.789772 23809.52 672
+75.805228 23809.52 672
+75.820684 23809.52 672
+75.836140 23809.52 672
+75.851596 23809.52 672
+75.867052 23809.52 672
+75.882508 23809.52 672
+75.897964 23809.52 672
+75.913420 23809.52 672
+75.928876 23809.52 672
+75.944332 23809.52 672
+75.959788 23809.52 672
+75.975244 23809.52 672
+75.990700 23809.52 672
+76.006156 23809.52 672
+76.021612 23809.52 672
+76.037068 23809.52 672
+76.052524 23809.52 672
+76.067980 23809.52 672
+76.083436 23809.52 672
+76.098892 23809.52 672
+76.114348 23809.52 672
+76.129804 23809.52 672
+76.145260 23809.52 672
+76.160716 23809.52 672
+76.176080 23952.10 668
+76.191444 23952.10 668
+76.206808 23952.10 668
+76.222172 23952.10 668
+76.237536 23952.10 668
+76.252900 23952.10 668
+76.268264 23952.10 668
+76.283628 23952.10 668
+76.298992 23952.10 668
+76.314356 23952.10 668
+76.329720 23952.10 668
+76.345084 23952.10 668
+76.360448 23952.10 668
+76.375812 23952.10 668
+76.391176 23952.10 668
+76.406540 23952.10 668
+76.421904 23952.10 668
+76.437268 23952.10 668
+76.452632 23952.10 668
+76.467996 23952.10 668
+76.483360 23952.10 668
+76.498724 23952.10 668
+76.514088 23952.10 668
+76.529360 24096.39 664
+76.545296 24096.39 664
+76.561232 24096.39 664
+76.577168 24096.39 664
+76.593104 24096.39 664
+76.609040 24096.39 664
+76.624976 24096.39 664
+76.640912 24096.39 664
+76.656848 24096.39 664
+76.672784 24096.39 664
+76.688720 24096.39 664
+76.704656 24096.39 664
+76.720592 24096.39 664
+76.736528 24096.39 664
+76.752464 24096.39 664
+76.768400 24096.39 664
+76.784336 24096.39 664
+76.800272 24096.39 664
+76.816208 24096.39 664
+76.832144 24096.39 664
+76.848080 24096.39 664
+76.863920 24242.42 660
+76.879760 24242.42 660
+76.895600 24242.42 660
+76.911440 24242.42 660
+76.927280 24242.42 660
+76.943120 24242.42 660
+76.958960 24242.42 660
+76.974800 24242.42 660
+76.990640 24242.42 660
+77.006480 24242.42 660
+77.022320 24242.42 660
+77.038160 24242.42 660
+77.054000 24242.42 660
+77.069840 24242.42 660
+77.085680 24242.42 660
+77.101520 24242.42 660
+77.117360 24242.42 660
+77.133200 24242.42 660
+77.149040 24242.42 660
+77.164880 24242.42 660
+77.180720 24242.42 660
+77.196560 24242.42 660
+77.212400 24242.42 660
+77.228240 24242.42 660
+77.244080 24242.42 660
+77.259920 24242.42 660
+77.275760 24242.42 660
+77.291600 24242.42 660
+77.307440 24242.42 660
+77.323280 24242.42 660
+77.339120 24242.42 660
+77.354960 24242.42 660
+77.370704 24390.24 656
+77.386448 24390.24 656
+77.402192 24390.24 656
+77.417936 24390.24 656
+77.433680 24390.24 656
+77.449424 24390.24 656
+77.465168 24390.24 656
+77.480912 24390.24 656
+77.496656 24390.24 656
+77.512400 24390.24 656
+77.528144 24390.24 656
+77.543888 24390.24 656
+77.559632 24390.24 656
+77.575376 24390.24 656
+77.591120 24390.24 656
+77.606864 24390.24 656
+77.622608 24390.24 656
+77.638352 24390.24 656
+77.654096 24390.24 656
+77.669840 24390.24 656
+77.685584 24390.24 656
+77.701232 24539.88 652
+77.716880 24539.88 652
+77.732528 24539.88 652
+77.748176 24539.88 652
+77.763824 24539.88 652
+77.779472 24539.88 652
+77.795120 24539.88 652
+77.810768 24539.88 652
+77.826416 24539.88 652
+77.842064 24539.88 652
+77.857712 24539.88 652
+77.873360 24539.88 652
+77.889008 24539.88 652
+77.904656 24539.88 652
+77.920304 24539.88 652
+77.935952 24539.88 652
+77.951600 24539.88 652
+77.967248 24539.88 652
+77.982896 24539.88 652
+77.998544 24539.88 652
+78.014192 24539.88 652
+78.029840 24539.88 652
+78.045488 24539.88 652
+78.061136 24539.88 652
+78.076784 24539.88 652
+78.092432 24539.88 652
+78.108080 24539.88 652
+78.123728 24539.88 652
+78.139376 24539.88 652
+78.155024 24539.88 652
+78.170672 24539.88 652
+78.186320 24539.88 652
+78.201968 24539.88 652
+78.217616 24539.88 652
+78.233264 24539.88 652
+78.248912 24539.88 652
+78.264560 24539.88 652
+78.280208 24539.88 652
+78.295856 24539.88 652
+78.311504 24539.88 652
+78.327152 24539.88 652
+78.342800 24539.88 652
+78.358448 24539.88 652
+78.374096 24539.88 652
+78.389744 24539.88 652
+78.405392 24539.88 652
+78.421040 24539.88 652
+78.436688 24539.88 652
+78.452336 24539.88 652
+78.467984 24539.88 652
+78.483632 24539.88 652
+78.499280 24539.88 652
+78.514928 24539.88 652
+78.530576 24539.88 652
+78.546224 24539.88 652
+78.561872 24539.88 652
+78.577520 24539.88 652
+78.593168 24539.88 652
+78.608816 24539.88 652
+78.624464 24539.88 652
+78.640112 24539.88 652
+78.655760 24539.88 652
+78.671408 24539.88 652
+78.687056 24539.88 652
+78.702608 24691.36 648
+78.718160 24691.36 648
+78.733712 24691.36 648
+78.749264 24691.36 648
+78.764816 24691.36 648
+78.780368 24691.36 648
+78.795920 24691.36 648
+78.811472 24691.36 648
+78.827024 24691.36 648
+78.842576 24691.36 648
+78.858128 24691.36 648
+78.873680 24691.36 648
+78.889232 24691.36 648
+78.904784 24691.36 648
+78.920336 24691.36 648
+78.935888 24691.36 648
+78.951440 24691.36 648
+78.966992 24691.36 648
+78.982544 24691.36 648
+78.998096 24691.36 648
+79.013648 24691.36 648
+79.029200 24691.36 648
+79.044656 24844.72 644
+79.060112 24844.72 644
+79.075568 24844.72 644
+79.091024 24844.72 644
+79.106480 24844.72 644
+79.121936 24844.72 644
+79.137392 24844.72 644
+79.152848 24844.72 644
+79.168304 24844.72 644
+79.183760 24844.72 644
+79.199216 24844.72 644
+79.214672 24844.72 644
+79.230128 24844.72 644
+79.245584 24844.72 644
+79.261040 24844.72 644
+79.276496 24844.72 644
+79.291952 24844.72 644
+79.307408 24844.72 644
+79.322864 24844.72 644
+79.338320 24844.72 644
+79.353776 24844.72 644
+79.369232 24844.72 644
+79.384688 24844.72 644
+79.400144 24844.72 644
+79.415600 24844.72 644
+79.431056 24844.72 644
+79.446512 24844.72 644
+79.461968 24844.72 644
+79.477424 24844.72 644
+79.492880 24844.72 644
+79.508336 24844.72 644
+79.523792 24844.72 644
+79.539152 25000.00 640
+79.699152 25000.00 640
+79.859152 25000.00 640
+80.019152 25000.00 640
+80.179152 25000.00 640
+80.339152 25000.00 640
+80.499152 25000.00 640
+80.659152 25000.00 640
+80.819152 25000.00 640
+80.979152 25000.00 640
+81.139152 25000.00 640
+81.299152 25000.00 640
+81.459152 25000.00 640
+81.619152 25000.00 640
+81.779152 25000.00 640
+81.939152 25000.00 640
+82.099152 25000.00 640
+82.259152 25000.00 640
+82.419152 25000.00 640
+82.579152 25000.00 640
+82.739152 25000.00 640
+82.899152 25000.00 640
+83.059152 25000.00 640
+83.219152 25000.00 640
+83.379152 25000.00 640
+83.539152 25000.00 640
+83.699152 25000.00 640
+83.859152 25000.00 640
+84.019152 25000.00 640
+84.179152 25000.00 640
+84.339152 25000.00 640
+84.499152 25000.00 640
+84.659152 25000.00 640
+84.819152 25000.00 640
+84.979152 25000.00 640
+85.139152 25000.00 640
+85.299152 25000.00 640
+85.459152 25000.00 640
+85.619152 25000.00 640
+85.779152 25000.00 640
+85.939152 25000.00 640
+86.099152 25000.00 640
+86.259152 25000.00 640
+86.419152 25000.00 640
+86.579152 25000.00 640
+86.739152 25000.00 640
+86.899152 25000.00 640
+87.059152 25000.00 640
+87.219152 25000.00 640
+87.379152 25000.00 640
+87.539152 25000.00 640
+87.699152 25000.00 640
+87.859152 25000.00 640
+88.019152 25000.00 640
+88.179152 25000.00 640
+88.339152 25000.00 640
+88.499152 25000.00 640
+88.659152 25000.00 640
+88.819152 25000.00 640
+88.979152 25000.00 640
+89.139152 25000.00 640
+89.299152 25000.00 640
+89.459152 25000.00 640
+89.619152 25000.00 640
+89.779152 25000.00 640
+89.939152 25000.00 640
+90.099152 25000.00 640
+90.259152 25000.00 640
+90.419152 25000.00 640
+90.579152 25000.00 640
+90.739152 25000.00 640
+90.899152 25000.00 640
+91.059152 25000.00 640
+91.219152 25000.00 640
+91.379152 25000.00 640
+91.539152 25000.00 640
+91.699152 25000.00 640
+91.859152 25000.00 640
+92.019152 25000.00 640
+92.179152 25000.00 640
+92.339152 25000.00 640
+92.499152 25000.00 640
+92.659152 25000.00 640
+92.819152 25000.00 640
+92.979152 25000.00 640
+93.139152 25000.00 640
+93.299152 25000.00 640
+93.459152 25000.00 640
+93.619152 25000.00 640
+93.779152 25000.00 640
+93.939152 25000.00 640
+94.099152 25000.00 640
+94.259152 25000.00 640
+94.419152 25000.00 640
+94.579152 25000.00 640
+94.739152 25000.00 640
+94.899152 25000.00 640
+95.059152 25000.00 640
+95.219152 25000.00 640
+95.379152 25000.00 640
+95.539152 25000.00 640
+95.699152 25000.00 640
+95.859152 25000.00 640
+96.019152 25000.00 640
+96.179152 25000.00 640
+96.339152 25000.00 640
+96.499152 25000.00 640
+96.659152 25000.00 640
+96.819152 25000.00 640
+96.979152 25000.00 640
+97.139152 25000.00 640
+97.299152 25000.00 640
+97.459152 25000.00 640
+97.619152 25000.00 640
+97.779152 25000.00 640
+97.939152 25000.00 640
+98.099152 25000.00 640
+98.259152 25000.00 640
+98.419152 25000.00 640
+98.579152 25000.00 640
+98.739152 25000.00 640
+98.899152 25000.00 640
+99.059152 25000.00 640
+99.219152 25000.00 640
+99.379152 25000.00 640
+99.539152 25000.00 640
+99.699152 25000.00 640
+99.859152 25000.00 640
+100.019152 25000.00 640
+100.179152 25000.00 640
+100.339152 25000.00 640
+100.499152 25000.00 640
+100.659152 25000.00 640
+100.819152 25000.00 640
+100.979152 25000.00 640
+101.139152 25000.00 640
+101.299152 25000.00 640
+101.459152 25000.00 640
+101.619152 25000.00 640
+101.779152 25000.00 640
+101.939152 25000.00 640
+102.099152 25000.00 640
+102.259152 25000.00 640
+102.419152 25000.00 640
+102.579152 25000.00 640
+102.739152 25000.00 640
+102.899152 25000.00 640
+103.059152 25000.00 640
+103.219152 25000.00 640
+103.379152 25000.00 640
+103.539152 25000.00 640
+103.699152 25000.00 640
+103.859152 25000.00 640
+104.019152 25000.00 640
+104.179152 25000.00 640
+104.339152 25000.00 640
+104.499152 25000.00 640
+104.659152 25000.00 640
+104.819152 25000.00 640
+104.979152 25000.00 640
+105.139152 25000.00 640
+105.299152 25000.00 640
+105.459152 25000.00 640
+105.619152 25000.00 640
+105.779152 25000.00 640
+105.939152 25000.00 640
+106.099152 25000.00 640
+106.259152 25000.00 640
+106.419152 25000.00 640
+106.579152 25000.00 640
+106.739152 25000.00 640
+106.899152 25000.00 640
+107.059152 25000.00 640
+107.219152 25000.00 640
+107.379152 25000.00 640
+107.539152 25000.00 640
+107.699152 25000.00 640
+107.859152 25000.00 640
+108.019152 25000.00 640
+108.179152 25000.00 640
+108.339152 25000.00 640
+108.499152 25000.00 640
+108.659152 25000.00 640
+108.819152 25000.00 640
+108.979152 25000.00 640
+109.139152 25000.00 640
+109.299152 25000.00 640
+109.459152 25000.00 640
+109.619152 25000.00 640
+109.779152 25000.00 640
+109.939152 25000.00 640
+110.099152 25000.00 640
+110.259152 25000.00 640
+110.419152 25000.00 640
+110.579152 25000.00 640
+110.739152 25000.00 640
+110.899152 25000.00 640
+111.059152 25000.00 640
+111.219152 25000.00 640
+111.379152 25000.00 640
+111.539152 25000.00 640
+111.699152 25000.00 640
+111.859152 25000.00 640
+112.019152 25000.00 640
+112.179152 25000.00 640
+112.339152 25000.00 640
+112.499152 25000.00 640
+112.659152 25000.00 640
+112.819152 25000.00 640
+112.979152 25000.00 640
+113.139152 25000.00 640
+113.299152 25000.00 640
+113.459152 25000.00 640
+113.619152 25000.00 640
+113.779152 25000.00 640
+113.939152 25000.00 640
+114.099152 25000.00 640
+114.259152 25000.00 640
+114.419152 25000.00 640
+114.579152 25000.00 640
+114.739152 25000.00 640
+114.899152 25000.00 640
+115.059152 25000.00 640
+115.219152 25000.00 640
+115.379152 25000.00 640
+115.539152 25000.00 640
+115.699152 25000.00 640
+115.859152 25000.00 640
+116.019152 25000.00 640
+116.179152 25000.00 640
+116.339152 25000.00 640
+116.499152 25000.00 640
+116.659152 25000.00 640
+116.819152 25000.00 640
+116.979152 25000.00 640
+117.139152 25000.00 640
+117.299152 25000.00 640
+117.459152 25000.00 640
+117.619152 25000.00 640
+117.779152 25000.00 640
+117.939152 25000.00 640
+118.099152 25000.00 640
+118.259152 25000.00 640
+118.419152 25000.00 640
+118.579152 25000.00 640
+118.739152 25000.00 640
+118.899152 25000.00 640
+119.059152 25000.00 640
+119.219152 25000.00 640
+119.379152 25000.00 640
+119.539152 25000.00 640
+119.699152 25000.00 640
+119.859152 25000.00 640
+120.019152 25000.00 640
+120.179152 25000.00 640
+120.339152 25000.00 640
+120.499152 25000.00 640
+120.659152 25000.00 640
+120.819152 25000.00 640
+120.979152 25000.00 640
+121.139152 25000.00 640
+121.299152 25000.00 640
+121.459152 25000.00 640
+121.619152 25000.00 640
+121.779152 25000.00 640
+121.939152 25000.00 640
+122.099152 25000.00 640
+122.259152 25000.00 640
+122.419152 25000.00 640
+122.579152 25000.00 640
+122.739152 25000.00 640
+122.899152 25000.00 640
+123.059152 25000.00 640
+123.219152 25000.00 640
+123.379152 25000.00 640
+123.539152 25000.00 640
+123.699152 25000.00 640
+123.859152 25000.00 640
+124.019152 25000.00 640
+124.179152 25000.00 640
+124.339152 25000.00 640
+124.499152 25000.00 640
+124.659152 25000.00 640
+124.819152 25000.00 640
+124.979152 25000.00 640
+125.139152 25000.00 640
+125.299152 25000.00 640
+125.459152 25000.00 640
+125.619152 25000.00 640
+125.779152 25000.00 640
+125.939152 25000.00 640
+126.099152 25000.00 640
+126.259152 25000.00 640
+126.419152 25000.00 640
+126.579152 25000.00 640
+126.739152 25000.00 640
+126.899152 25000.00 640
+127.059152 25000.00 640
+127.219152 25000.00 640
+127.379152 25000.00 640
+127.539152 25000.00 640
+127.699152 25000.00 640
+127.859152 25000.00 640
+128.019152 25000.00 640
+128.179152 25000.00 640
+128.339152 25000.00 640
+128.499152 25000.00 640
+128.659152 25000.00 640
+128.819152 25000.00 640
+128.979152 25000.00 640
+129.139152 25000.00 640
+129.299152 25000.00 640
+129.459152 25000.00 640
+129.619152 25000.00 640
+129.779152 25000.00 640
+129.939152 25000.00 640
+130.099152 25000.00 640
+130.259152 25000.00 640
+130.419152 25000.00 640
+130.579152 25000.00 640
+130.739152 25000.00 640
+130.899152 25000.00 640
+131.059152 25000.00 640
+131.219152 25000.00 640
+131.379152 25000.00 640
+131.539152 25000.00 640
+131.699152 25000.00 640
+131.859152 25000.00 640
+132.019152 25000.00 640
+132.179152 25000.00 640
+132.339152 25000.00 640
+132.499152 25000.00 640
+132.659152 25000.00 640
+132.819152 25000.00 640
+132.979152 25000.00 640
+133.139152 25000.00 640
+133.299152 25000.00 640
+133.459152 25000.00 640
+133.619152 25000.00 640
+133.779152 25000.00 640
+133.939152 25000.00 640
+134.099152 25000.00 640
+134.259152 25000.00 640
+134.419152 25000.00 640
+134.579152 25000.00 640
+134.739152 25000.00 640
+134.899152 25000.00 640
+135.059152 25000.00 640
+135.219152 25000.00 640
+135.379152 25000.00 640
+135.539152 25000.00 640
+135.699152 25000.00 640
+135.859152 25000.00 640
+136.019152 25000.00 640
+136.179152 25000.00 640
+136.339152 25000.00 640
+136.499152 25000.00 640
+136.659152 25000.00 640
+136.819152 25000.00 640
+136.979152 25000.00 640
+137.139152 25000.00 640
+137.299152 25000.00 640
+137.459152 25000.00 640
+137.619152 25000.00 640
+137.779152 25000.00 640
+137.939152 25000.00 640
+138.099152 25000.00 640
+138.259152 25000.00 640
+138.419152 25000.00 640
+138.579152 25000.00 640
+138.739152 25000.00 640
+138.899152 25000.00 640
+139.059152 25000.00 640
+139.219152 25000.00 640
+139.379152 25000.00 640
+139.539152 25000.00 640
+139.699152 25000.00 640
+139.859152 25000.00 640
+140.019152 25000.00 640
+140.179152 25000.00 640
+140.339152 25000.00 640
+140.499152 25000.00 640
+140.659152 25000.00 640
+140.819152 25000.00 640
+140.979152 25000.00 640
+141.139152 25000.00 640
+141.299152 25000.00 640
+141.459152 25000.00 640
+141.619152 25000.00 640
+141.779152 25000.00 640
+141.939152 25000.00 640
+142.099152 25000.00 640
+142.259152 25000.00 640
+142.419152 25000.00 640
+142.579152 25000.00 640
+142.739152 25000.00 640
+142.899152 25000.00 640
+143.059152 25000.00 640
+143.219152 25000.00 640
+143.379152 25000.00 640
+143.539152 25000.00 640
+143.699152 25000.00 640
+143.859152 25000.00 640
+144.019152 25000.00 640
+144.179152 25000.00 640
+144.339152 25000.00 640
+144.499152 25000.00 640
+144.659152 25000.00 640
+144.819152 25000.00 640
+144.979152 25000.00 640
+145.139152 25000.00 640
+145.299152 25000.00 640
+145.459152 25000.00 640
+145.619152 25000.00 640
+145.779152 25000.00 640
+145.939152 25000.00 640
+146.099152 25000.00 640
+146.259152 25000.00 640
+146.419152 25000.00 640
+146.579152 25000.00 640
+146.739152 25000.00 640
+146.899152 25000.00 640
+147.059152 25000.00 640
+147.219152 25000.00 640
+147.379152 25000.00 640
+147.539152 25000.00 640
+147.699152 25000.00 640
+147.859152 25000.00 640
+148.019152 25000.00 640
+148.179152 25000.00 640
+148.339152 25000.00 640
+148.499152 25000.00 640
+148.659152 25000.00 640
+148.819152 25000.00 640
+148.979152 25000.00 640
+149.139152 25000.00 640
+149.299152 25000.00 640
+149.459152 25000.00 640
+149.619152 25000.00 640
+149.779152 25000.00 640
+149.939152 25000.00 640
+150.099152 25000.00 640
+150.259152 25000.00 640
+150.419152 25000.00 640
+150.579152 25000.00 640
+150.739152 25000.00 640
+150.899152 25000.00 640
+151.059152 25000.00 640
+151.219152 25000.00 640
+151.379152 25000.00 640
+151.539152 25000.00 640
+151.699152 25000.00 640
+151.859152 25000.00 640
+152.019152 25000.00 640
+152.179152 25000.00 640
+152.339152 25000.00 640
+152.499152 25000.00 640
+152.659152 25000.00 640
+152.819152 25000.00 640
+152.979152 25000.00 640
+153.139152 25000.00 640
+153.299152 25000.00 640
+153.459152 25000.00 640
+153.619152 25000.00 640
+153.779152 25000.00 640
+153.939152 25000.00 640
+154.099152 25000.00 640
+154.259152 25000.00 640
+154.419152 25000.00 640
+154.579152 25000.00 640
+154.739152 25000.00 640
+154.899152 25000.00 640
+155.059152 25000.00 640
+155.219152 25000.00 640
+155.379152 25000.00 640
+155.539152 25000.00 640
+155.699152 25000.00 640
+155.859152 25000.00 640
+156.019152 25000.00 640
+156.179152 25000.00 640
+156.339152 25000.00 640
+156.499152 25000.00 640
+156.659152 25000.00 640
+156.819152 25000.00 640
+156.979152 25000.00 640
+157.139152 25000.00 640
+157.299152 25000.00 640
+157.459152 25000.00 640
+157.619152 25000.00 640
+157.779152 25000.00 640
+157.939152 25000.00 640
+158.099152 25000.00 640
+158.259152 25000.00 640
+158.419152 25000.00 640
+158.579152 25000.00 640
+158.739152 25000.00 640
+158.899152 25000.00 640
+159.059152 25000.00 640
+159.219152 25000.00 640
+159.379152 25000.00 640
+159.539152 25000.00 640
+159.699152 25000.00 640
+159.859152 25000.00 640
+160.019152 25000.00 640
+160.179152 25000.00 640
+160.339152 25000.00 640
+160.499152 25000.00 640
+160.659152 25000.00 640
+160.819152 25000.00 640
+160.979152 25000.00 640
+161.139152 25000.00 640
+161.299152 25000.00 640
+161.459152 25000.00 640
+161.619152 25000.00 640
+161.779152 25000.00 640
+161.939152 25000.00 640
+162.099152 25000.00 640
+162.259152 25000.00 640
+162.419152 25000.00 640
+162.579152 25000.00 640
+162.739152 25000.00 640
+162.899152 25000.00 640
+163.059152 25000.00 640
+163.219152 25000.00 640
+163.379152 25000.00 640
+163.539152 25000.00 640
+163.699152 25000.00 640
+163.724752 25000.00 640
+163.740852 24844.72 644
+163.756308 24844.72 644
+163.771764 24844.72 644
+163.787220 24844.72 644
+163.802676 24844.72 644
+163.818132 24844.72 644
+163.833588 24844.72 644
+163.849044 24844.72 644
+163.864500 24844.72 644
+163.879956 24844.72 644
+163.895412 24844.72 644
+163.910868 24844.72 644
+163.926324 24844.72 644
+163.941780 24844.72 644
+163.957236 24844.72 644
+163.972692 24844.72 644
+163.988148 24844.72 644
+164.003604 24844.72 644
+164.019060 24844.72 644
+164.034516 24844.72 644
+164.049972 24844.72 644
+164.065428 24844.72 644
+164.080884 24844.72 644
+164.096340 24844.72 644
+164.111796 24844.72 644
+164.127252 24844.72 644
+164.142708 24844.72 644
+164.158164 24844.72 644
+164.173620 24844.72 644
+164.189076 24844.72 644
+164.204532 24844.72 644
+164.219988 24844.72 644
+164.235540 24691.36 648
+164.251092 24691.36 648
+164.266644 24691.36 648
+164.282196 24691.36 648
+164.297748 24691.36 648
+164.313300 24691.36 648
+164.328852 24691.36 648
+164.344404 24691.36 648
+164.359956 24691.36 648
+164.375508 24691.36 648
+164.391060 24691.36 648
+164.406612 24691.36 648
+164.422164 24691.36 648
+164.437716 24691.36 648
+164.453268 24691.36 648
+164.468820 24691.36 648
+164.484372 24691.36 648
+164.499924 24691.36 648
+164.515476 24691.36 648
+164.531028 24691.36 648
+164.546580 24691.36 648
+164.562132 24691.36 648
+164.577780 24539.88 652
+164.593428 24539.88 652
+164.609076 24539.88 652
+164.624724 24539.88 652
+164.640372 24539.88 652
+164.656020 24539.88 652
+164.671668 24539.88 652
+164.687316 24539.88 652
+164.702964 24539.88 652
+164.718612 24539.88 652
+164.734260 24539.88 652
+164.749908 24539.88 652
+164.765556 24539.88 652
+164.781204 24539.88 652
+164.796852 24539.88 652
+164.812500 24539.88 652
+164.828148 24539.88 652
+164.843796 24539.88 652
+164.859444 24539.88 652
+164.875092 24539.88 652
+164.890740 24539.88 652
+164.906388 24539.88 652
+164.922036 24539.88 652
+164.937684 24539.88 652
+164.953332 24539.88 652
+164.968980 24539.88 652
+164.984628 24539.88 652
+165.000276 24539.88 652
+165.015924 24539.88 652
+165.031572 24539.88 652
+165.047220 24539.88 652
+165.062868 24539.88 652
+165.078516 24539.88 652
+165.094164 24539.88 652
+165.109812 24539.88 652
+165.125460 24539.88 652
+165.141108 24539.88 652
+165.156756 24539.88 652
+165.172404 24539.88 652
+165.188052 24539.88 652
+165.203700 24539.88 652
+165.219348 24539.88 652
+165.234996 24539.88 652
+165.250644 24539.88 652
+165.266292 24539.88 652
+165.281940 24539.88 652
+165.297588 24539.88 652
+165.313236 24539.88 652
+165.328884 24539.88 652
+165.344532 24539.88 652
+165.360180 24539.88 652
+165.375828 24539.88 652
+165.391476 24539.88 652
+165.407124 24539.88 652
+165.422772 24539.88 652
+165.438420 24539.88 652
+165.454068 24539.88 652
+165.469716 24539.88 652
+165.485364 24539.88 652
+165.501012 24539.88 652
+165.516660 24539.88 652
+165.532308 24539.88 652
+165.547956 24539.88 652
+165.563604 24539.88 652
+165.579348 24390.24 656
+165.595092 24390.24 656
+165.610836 24390.24 656
+165.626580 24390.24 656
+165.642324 24390.24 656
+165.658068 24390.24 656
+165.673812 24390.24 656
+165.689556 24390.24 656
+165.705300 24390.24 656
+165.721044 24390.24 656
+165.736788 24390.24 656
+165.752532 24390.24 656
+165.768276 24390.24 656
+165.784020 24390.24 656
+165.799764 24390.24 656
+165.815508 24390.24 656
+165.831252 24390.24 656
+165.846996 24390.24 656
+165.862740 24390.24 656
+165.878484 24390.24 656
+165.894228 24390.24 656
+165.910068 24242.42 660
+165.925908 24242.42 660
+165.941748 24242.42 660
+165.957588 24242.42 660
+165.973428 24242.42 660
+165.989268 24242.42 660
+166.005108 24242.42 660
+166.020948 24242.42 660
+166.036788 24242.42 660
+166.052628 24242.42 660
+166.068468 24242.42 660
+166.084308 24242.42 660
+166.100148 24242.42 660
+166.115988 24242.42 660
+166.131828 24242.42 660
+166.147668 24242.42 660
+166.163508 24242.42 660
+166.179348 24242.42 660
+166.195188 24242.42 660
+166.211028 24242.42 660
+166.226868 24242.42 660
+166.242708 24242.42 660
+166.258548 24242.42 660
+166.274388 24242.42 660
+166.290228 24242.42 660
+166.306068 24242.42 660
+166.321908 24242.42 660
+166.337748 24242.42 660
+166.353588 24242.42 660
+166.369428 24242.42 660
+166.385268 24242.42 660
+166.401108 24242.42 660
+166.417044 24096.39 664
+166.432980 24096.39 664
+166.448916 24096.39 664
+166.464852 24096.39 664
+166.480788 24096.39 664
+166.496724 24096.39 664
+166.512660 24096.39 664
+166.528596 24096.39 664
+166.544532 24096.39 664
+166.560468 24096.39 664
+166.576404 24096.39 664
+166.592340 24096.39 664
+166.608276 24096.39 664
+166.624212 24096.39 664
+166.640148 24096.39 664
+166.656084 24096.39 664
+166.672020 24096.39 664
+166.687956 24096.39 664
+166.703892 24096.39 664
+166.719828 24096.39 664
+166.735764 24096.39 664
+166.751796 23952.10 668
+166.767160 23952.10 668
+166.782524 23952.10 668
+166.797888 23952.10 668
+166.813252 23952.10 668
+166.828616 23952.10 668
+166.843980 23952.10 668
+166.859344 23952.10 668
+166.874708 23952.10 668
+166.890072 23952.10 668
+166.905436 23952.10 668
+166.920800 23952.10 668
+166.936164 23952.10 668
+166.951528 23952.10 668
+166.966892 23952.10 668
+166.982256 23952.10 668
+166.997620 23952.10 668
+167.012984 23952.10 668
+167.028348 23952.10 668
+167.043712 23952.10 668
+167.059076 23952.10 668
+167.074440 23952.10 668
+167.089804 23952.10 668
+167.105260 23809.52 672
+167.120716 23809.52 672
+167.136172 23809.52 672
+167.151628 23809.52 672
+167.167084 23809.52 672
+167.182540 23809.52 672
+167.197996 23809.52 672
+167.213452 23809.52 672
+167.228908 23809.52 672
+167.244364 23809.52 672
+167.259820 23809.52 672
+167.275276 23809.52 672
+167.290732 23809.52 672
+167.306188 23809.52 672
+167.321644 23809.52 672
+167.337100 23809.52 672
+167.352556 23809.52 672
+167.368012 23809.52 672
+167.383468 23809.52 672
+167.398924 23809.52 672
+167.414380 23809.52 672
+167.429836 23809.52 672
+167.445292 23809.52 672
+167.460748 23809.52 672
+167.476204 23809.52 672
+167.491660 23809.52 672
+167.507116 23809.52 672
+167.522572 23809.52 672
+167.538028 23809.52 672
+167.553484 23809.52 672
+167.568940 23809.52 672
+167.584396 23809.52 672
+167.599852 23809.52 672
+167.615400 23668.64 676
+167.630948 23668.64 676
+167.646496 23668.64 676
+167.662044 23668.64 676
+167.677592 23668.64 676
+167.693140 23668.64 676
+167.708688 23668.64 676
+167.724236 23668.64 676
+167.739784 23668.64 676
+167.755332 23668.64 676
+167.770880 23668.64 676
+167.786428 23668.64 676
+167.801976 23668.64 676
+167.817524 23668.64 676
+167.833072 23668.64 676
+167.848620 23668.64 676
+167.864168 23668.64 676
+167.879716 23668.64 676
+167.895264 23668.64 676
+167.910812 23668.64 676
+167.926360 23668.64 676
+167.941908 23668.64 676
+167.957548 23529.41 680
+167.973188 23529.41 680
+167.988828 23529.41 680
+168.004468 23529.41 680
+168.020108 23529.41 680
+168.035748 23529.41 680
+168.051388 23529.41 680
+168.067028 23529.41 680
+168.082668 23529.41 680
+168.098308 23529.41 680
+168.113948 23529.41 680
+168.129588 23529.41 680
+168.145228 23529.41 680
+168.160868 23529.41 680
+168.176508 23529.41 680
+168.192148 23529.41 680
+168.207788 23529.41 680
+168.223428 23529.41 680
+168.239068 23529.41 680
+168.254708 23529.41 680
+168.270348 23529.41 680
+168.285988 23529.41 680
+168.301628 23529.41 680
+168.317268 23529.41 680
+168.332908 23529.41 680
+168.348548 23529.41 680
+168.364188 23529.41 680
+168.379828 23529.41 680
+168.395468 23529.41 680
+168.411108 23529.41 680
+168.426748 23529.41 680
+168.442388 23529.41 680
+168.458028 23529.41 680
+168.473668 23529.41 680
+168.489400 23391.81 684
+168.505132 23391.81 684
+168.520864 23391.81 684
+168.536596 23391.81 684
+168.552328 23391.81 684
+168.568060 23391.81 684
+168.583792 23391.81 684
+168.599524 23391.81 684
+168.615256 23391.81 684
+168.630988 23391.81 684
+168.646720 23391.81 684
+168.662452 23391.81 684
+168.678184 23391.81 684
+168.693916 23391.81 684
+168.709648 23391.81 684
+168.725380 23391.81 684
+168.741112 23391.81 684
+168.756844 23391.81 684
+168.772576 23391.81 684
+168.788308 23391.81 684
+168.804040 23391.81 684
+168.819772 23391.81 684
+168.835596 23255.81 688
+168.851420 23255.81 688
+168.867244 23255.81 688
+168.883068 23255.81 688
+168.898892 23255.81 688
+168.914716 23255.81 688
+168.930540 23255.81 688
+168.946364 23255.81 688
+168.962188 23255.81 688
+168.978012 23255.81 688
+168.993836 23255.81 688
+169.009660 23255.81 688
+169.025484 23255.81 688
+169.041308 23255.81 688
+169.057132 23255.81 688
+169.072956 23255.81 688
+169.088780 23255.81 688
+169.104604 23255.81 688
+169.120428 23255.81 688
+169.136252 23255.81 688
+169.152076 23255.81 688
+169.167900 23255.81 688
+169.183816 23121.39 692
+169.199732 23121.39 692
+169.215648 23121.39 692
+169.231564 23121.39 692
+169.247480 23121.39 692
+169.263396 23121.39 692
+169.279312 23121.39 692
+169.295228 23121.39 692
+169.311144 23121.39 692
+169.327060 23121.39 692
+169.342976 23121.39 692
+169.358892 23121.39 692
+169.374808 23121.39 692
+169.390724 23121.39 692
+169.406640 23121.39 692
+169.422556 23121.39 692
+169.438472 23121.39 692
+169.454388 23121.39 692
+169.470304 23121.39 692
+169.486220 23121.39 692
+169.502136 23121.39 692
+169.518052 23121.39 692
+169.534060 22988.51 696
+169.549372 22988.51 696
+169.564684 22988.51 696
+169.579996 22988.51 696
+169.595308 22988.51 696
+169.610620 22988.51 696
+169.625932 22988.51 696
+169.641244 22988.51 696
+169.656556 22988.51 696
+169.671868 22988.51 696
+169.687180 22988.51 696
+169.702492 22988.51 696
+169.717804 22988.51 696
+169.733116 22988.51 696
+169.748428 22988.51 696
+169.763740 22988.51 696
+169.779052 22988.51 696
+169.794364 22988.51 696
+169.809676 22988.51 696
+169.824988 22988.51 696
+169.840300 22988.51 696
+169.855612 22988.51 696
+169.870924 22988.51 696
+169.886236 22988.51 696
+169.901548 22988.51 696
+169.916860 22988.51 696
+169.932172 22988.51 696
+169.947484 22988.51 696
+169.962796 22988.51 696
+169.978108 22988.51 696
+169.993420 22988.51 696
+170.008732 22988.51 696
+170.024044 22988.51 696
+170.039356 22988.51 696
+170.054668 22988.51 696
+170.069980 22988.51 696
+170.085292 22988.51 696
+170.100604 22988.51 696
+170.115916 22988.51 696
+170.131228 22988.51 696
+170.146540 22988.51 696
+170.161852 22988.51 696
+170.177164 22988.51 696
+170.192476 22988.51 696
+170.207788 22988.51 696
+170.223100 22988.51 696
+170.238412 22988.51 696
+170.253724 22988.51 696
+170.269036 22988.51 696
+170.284348 22988.51 696
+170.299660 22988.51 696
+170.314972 22988.51 696
+170.330284 22988.51 696
+170.345596 22988.51 696
+170.360908 22988.51 696
+170.376220 22988.51 696
+170.391532 22988.51 696
+170.406844 22988.51 696
+170.422156 22988.51 696
+170.437556 22857.14 700
+170.452956 22857.14 700
+170.468356 22857.14 700
+170.483756 22857.14 700
+170.499156 22857.14 700
+170.514556 22857.14 700
+170.529956 22857.14 700
+170.545356 22857.14 700
+170.560756 22857.14 700
+170.576156 22857.14 700
+170.591556 22857.14 700
+170.606956 22857.14 700
+170.622356 22857.14 700
+170.637756 22857.14 700
+170.653156 22857.14 700
+170.668556 22857.14 700
+170.683956 22857.14 700
+170.699356 22857.14 700
+170.714756 22857.14 700
+170.730156 22857.14 700
+170.745556 22857.14 700
+170.760956 22857.14 700
+170.776356 22857.14 700
+170.791844 22727.27 704
+170.807332 22727.27 704
+170.822820 22727.27 704
+170.838308 22727.27 704
+170.853796 22727.27 704
+170.869284 22727.27 704
+170.884772 22727.27 704
+170.900260 22727.27 704
+170.915748 22727.27 704
+170.931236 22727.27 704
+170.946724 22727.27 704
+170.962212 22727.27 704
+170.977700 22727.27 704
+170.993188 22727.27 704
+171.008676 22727.27 704
+171.024164 22727.27 704
+171.039652 22727.27 704
+171.055140 22727.27 704
+171.070628 22727.27 704
+171.086116 22727.27 704
+171.101604 22727.27 704
+171.117092 22727.27 704
+171.132580 22727.27 704
+171.148156 22598.87 708
+171.163732 22598.87 708
+171.179308 22598.87 708
+171.194884 22598.87 708
+171.210460 22598.87 708
+171.226036 22598.87 708
+171.241612 22598.87 708
+171.257188 22598.87 708
+171.272764 22598.87 708
+171.288340 22598.87 708
+171.303916 22598.87 708
+171.319492 22598.87 708
+171.335068 22598.87 708
+171.350644 22598.87 708
+171.366220 22598.87 708
+171.381796 22598.87 708
+171.397372 22598.87 708
+171.412948 22598.87 708
+171.428524 22598.87 708
+171.444100 22598.87 708
+171.459676 22598.87 708
+171.475252 22598.87 708
+171.490828 22598.87 708
+171.506492 22471.91 712
+171.522156 22471.91 712
+171.537820 22471.91 712
+171.553484 22471.91 712
+171.569148 22471.91 712
+171.584812 22471.91 712
+171.600476 22471.91 712
+171.616140 22471.91 712
+171.631804 22471.91 712
+171.647468 22471.91 712
+171.663132 22471.91 712
+171.678796 22471.91 712
+171.694460 22471.91 712
+171.710124 22471.91 712
+171.725788 22471.91 712
+171.741452 22471.91 712
+171.757116 22471.91 712
+171.772780 22471.91 712
+171.788444 22471.91 712
+171.804108 22471.91 712
+171.819772 22471.91 712
+171.835436 22471.91 712
+171.851100 22471.91 712
+171.866764 22471.91 712
+171.882428 22471.91 712
+171.898092 22471.91 712
+171.913756 22471.91 712
+171.929420 22471.91 712
+171.945084 22471.91 712
+171.960748 22471.91 712
+171.976412 22471.91 712
+171.992076 22471.91 712
+172.007740 22471.91 712
+172.023404 22471.91 712
+172.039068 22471.91 712
+172.054820 22346.37 716
+172.070572 22346.37 716
+172.086324 22346.37 716
+172.102076 22346.37 716
+172.117828 22346.37 716
+172.133580 22346.37 716
+172.149332 22346.37 716
+172.165084 22346.37 716
+172.180836 22346.37 716
+172.196588 22346.37 716
+172.212340 22346.37 716
+172.228092 22346.37 716
+172.243844 22346.37 716
+172.259596 22346.37 716
+172.275348 22346.37 716
+172.291100 22346.37 716
+172.306852 22346.37 716
+172.322604 22346.37 716
+172.338356 22346.37 716
+172.354108 22346.37 716
+172.369860 22346.37 716
+172.385612 22346.37 716
+172.401364 22346.37 716
+172.417116 22346.37 716
+172.432956 22222.22 720
+172.448796 22222.22 720
+172.464636 22222.22 720
+172.480476 22222.22 720
+172.496316 22222.22 720
+172.512156 22222.22 720
+172.527996 22222.22 720
+172.543836 22222.22 720
+172.559676 22222.22 720
+172.575516 22222.22 720
+172.591356 22222.22 720
+172.607196 22222.22 720
+172.623036 22222.22 720
+172.638876 22222.22 720
+172.654716 22222.22 720
+172.670556 22222.22 720
+172.686396 22222.22 720
+172.702236 22222.22 720
+172.718076 22222.22 720
+172.733916 22222.22 720
+172.749756 22222.22 720
+172.765596 22222.22 720
+172.781436 22222.22 720
+172.797364 22099.45 724
+172.813292 22099.45 724
+172.829220 22099.45 724
+172.845148 22099.45 724
+172.861076 22099.45 724
+172.877004 22099.45 724
+172.892932 22099.45 724
+172.908860 22099.45 724
+172.924788 22099.45 724
+172.940716 22099.45 724
+172.956644 22099.45 724
+172.972572 22099.45 724
+172.988500 22099.45 724
+173.004428 22099.45 724
+173.020356 22099.45 724
+173.036284 22099.45 724
+173.052212 22099.45 724
+173.068140 22099.45 724
+173.084068 22099.45 724
+173.099996 22099.45 724
+173.115924 22099.45 724
+173.131852 22099.45 724
+173.147780 22099.45 724
+173.163796 21978.02 728
+173.179084 21978.02 728
+173.194372 21978.02 728
+173.209660 21978.02 728
+173.224948 21978.02 728
+173.240236 21978.02 728
+173.255524 21978.02 728
+173.270812 21978.02 728
+173.286100 21978.02 728
+173.301388 21978.02 728
+173.316676 21978.02 728
+173.331964 21978.02 728
+173.347252 21978.02 728
+173.362540 21978.02 728
+173.377828 21978.02 728
+173.393116 21978.02 728
+173.408404 21978.02 728
+173.423692 21978.02 728
+173.438980 21978.02 728
+173.454268 21978.02 728
+173.469556 21978.02 728
+173.484844 21978.02 728
+173.500132 21978.02 728
+173.515420 21978.02 728
+173.530708 21978.02 728
+173.546080 21857.92 732
+173.561452 21857.92 732
+173.576824 21857.92 732
+173.592196 21857.92 732
+173.607568 21857.92 732
+173.622940 21857.92 732
+173.638312 21857.92 732
+173.653684 21857.92 732
+173.669056 21857.92 732
+173.684428 21857.92 732
+173.699800 21857.92 732
+173.715172 21857.92 732
+173.730544 21857.92 732
+173.745916 21857.92 732
+173.761288 21857.92 732
+173.776660 21857.92 732
+173.792032 21857.92 732
+173.807404 21857.92 732
+173.822776 21857.92 732
+173.838148 21857.92 732
+173.853520 21857.92 732
+173.868892 21857.92 732
+173.884264 21857.92 732
+173.899636 21857.92 732
+173.915092 21739.13 736
+173.930548 21739.13 736
+173.946004 21739.13 736
+173.961460 21739.13 736
+173.976916 21739.13 736
+173.992372 21739.13 736
+174.007828 21739.13 736
+174.023284 21739.13 736
+174.038740 21739.13 736
+174.054196 21739.13 736
+174.069652 21739.13 736
+174.085108 21739.13 736
+174.100564 21739.13 736
+174.116020 21739.13 736
+174.131476 21739.13 736
+174.146932 21739.13 736
+174.162388 21739.13 736
+174.177844 21739.13 736
+174.193300 21739.13 736
+174.208756 21739.13 736
+174.224212 21739.13 736
+174.239668 21739.13 736
+174.255124 21739.13 736
+174.270580 21739.13 736
+174.286120 21621.62 740
+174.301660 21621.62 740
+174.317200 21621.62 740
+174.332740 21621.62 740
+174.348280 21621.62 740
+174.363820 21621.62 740
+174.379360 21621.62 740
+174.394900 21621.62 740
+174.410440 21621.62 740
+174.425980 21621.62 740
+174.441520 21621.62 740
+174.457060 21621.62 740
+174.472600 21621.62 740
+174.488140 21621.62 740
+174.503680 21621.62 740
+174.519220 21621.62 740
+174.534760 21621.62 740
+174.550300 21621.62 740
+174.565840 21621.62 740
+174.581380 21621.62 740
+174.596920 21621.62 740
+174.612460 21621.62 740
+174.628000 21621.62 740
+174.643540 21621.62 740
+174.659080 21621.62 740
+174.674704 21505.38 744
+174.690328 21505.38 744
+174.705952 21505.38 744
+174.721576 21505.38 744
+174.737200 21505.38 744
+174.752824 21505.38 744
+174.768448 21505.38 744
+174.784072 21505.38 744
+174.799696 21505.38 744
+174.815320 21505.38 744
+174.830944 21505.38 744
+174.846568 21505.38 744
+174.862192 21505.38 744
+174.877816 21505.38 744
+174.893440 21505.38 744
+174.909064 21505.38 744
+174.924688 21505.38 744
+174.940312 21505.38 744
+174.955936 21505.38 744
+174.971560 21505.38 744
+174.987184 21505.38 744
+175.002808 21505.38 744
+175.018432 21505.38 744
+175.034056 21505.38 744
+175.049764 21390.37 748
+175.065472 21390.37 748
+175.081180 21390.37 748
+175.096888 21390.37 748
+175.112596 21390.37 748
+175.128304 21390.37 748
+175.144012 21390.37 748
+175.159720 21390.37 748
+175.175428 21390.37 748
+175.191136 21390.37 748
+175.206844 21390.37 748
+175.222552 21390.37 748
+175.238260 21390.37 748
+175.253968 21390.37 748
+175.269676 21390.37 748
+175.285384 21390.37 748
+175.301092 21390.37 748
+175.316800 21390.37 748
+175.332508 21390.37 748
+175.348216 21390.37 748
+175.363924 21390.37 748
+175.379632 21390.37 748
+175.395340 21390.37 748
+175.411048 21390.37 748
+175.426840 21276.60 752
+175.442632 21276.60 752
+175.458424 21276.60 752
+175.474216 21276.60 752
+175.490008 21276.60 752
+175.505800 21276.60 752
+175.521592 21276.60 752
+175.537384 21276.60 752
+175.553176 21276.60 752
+175.568968 21276.60 752
+175.584760 21276.60 752
+175.600552 21276.60 752
+175.616344 21276.60 752
+175.632136 21276.60 752
+175.647928 21276.60 752
+175.663720 21276.60 752
+175.679512 21276.60 752
+175.695304 21276.60 752
+175.711096 21276.60 752
+175.726888 21276.60 752
+175.742680 21276.60 752
+175.758472 21276.60 752
+175.774264 21276.60 752
+175.790056 21276.60 752
+175.805848 21276.60 752
+175.821724 21164.02 756
+175.837600 21164.02 756
+175.853476 21164.02 756
+175.869352 21164.02 756
+175.885228 21164.02 756
+175.901104 21164.02 756
+175.916980 21164.02 756
+175.932856 21164.02 756
+175.948732 21164.02 756
+175.964608 21164.02 756
+175.980484 21164.02 756
+175.996360 21164.02 756
+176.012320 21052.63 760
+176.028280 21052.63 760
+176.044240 21052.63 760
+176.060200 21052.63 760
+176.076160 21052.63 760
+176.092120 21052.63 760
+176.108080 21052.63 760
+176.124040 21052.63 760
+176.140000 21052.63 760
+176.155960 21052.63 760
+176.171920 21052.63 760
+176.187880 21052.63 760
+176.203840 21052.63 760
+176.219800 21052.63 760
+176.235760 21052.63 760
+176.251720 21052.63 760
+176.267680 21052.63 760
+176.283640 21052.63 760
+176.299600 21052.63 760
+176.315560 21052.63 760
+176.331520 21052.63 760
+176.347480 21052.63 760
+176.363440 21052.63 760
+176.379400 21052.63 760
+176.395444 20942.41 764
+176.410724 20942.41 764
+176.426004 20942.41 764
+176.441284 20942.41 764
+176.456564 20942.41 764
+176.471844 20942.41 764
+176.487124 20942.41 764
+176.502404 20942.41 764
+176.517684 20942.41 764
+176.532964 20942.41 764
+176.548244 20942.41 764
+176.563524 20942.41 764
+176.578804 20942.41 764
+176.594084 20942.41 764
+176.609364 20942.41 764
+176.624644 20942.41 764
+176.639924 20942.41 764
+176.655204 20942.41 764
+176.670484 20942.41 764
+176.685764 20942.41 764
+176.701044 20942.41 764
+176.716324 20942.41 764
+176.731604 20942.41 764
+176.746884 20942.41 764
+176.762164 20942.41 764
+176.777444 20942.41 764
+176.792804 20833.33 768
+176.808164 20833.33 768
+176.823524 20833.33 768
+176.838884 20833.33 768
+176.854244 20833.33 768
+176.869604 20833.33 768
+176.884964 20833.33 768
+176.900324 20833.33 768
+176.915684 20833.33 768
+176.931044 20833.33 768
+176.946404 20833.33 768
+176.961764 20833.33 768
+176.977124 20833.33 768
+176.992484 20833.33 768
+177.007844 20833.33 768
+177.023204 20833.33 768
+177.038564 20833.33 768
+177.053924 20833.33 768
+177.069284 20833.33 768
+177.084644 20833.33 768
+177.100004 20833.33 768
+177.115364 20833.33 768
+177.130724 20833.33 768
+177.146084 20833.33 768
+177.161444 20833.33 768
+177.176804 20833.33 768
+177.192244 20725.39 772
+177.207684 20725.39 772
+177.223124 20725.39 772
+177.238564 20725.39 772
+177.254004 20725.39 772
+177.269444 20725.39 772
+177.284884 20725.39 772
+177.300324 20725.39 772
+177.315764 20725.39 772
+177.331204 20725.39 772
+177.346644 20725.39 772
+177.362084 20725.39 772
+177.377524 20725.39 772
+177.392964 20725.39 772
+177.408404 20725.39 772
+177.423844 20725.39 772
+177.439284 20725.39 772
+177.454724 20725.39 772
+177.470164 20725.39 772
+177.485604 20725.39 772
+177.501044 20725.39 772
+177.516484 20725.39 772
+177.531924 20725.39 772
+177.547364 20725.39 772
+177.562804 20725.39 772
+177.578324 20618.56 776
+177.593844 20618.56 776
+177.609364 20618.56 776
+177.624884 20618.56 776
+177.640404 20618.56 776
+177.655924 20618.56 776
+177.671444 20618.56 776
+177.686964 20618.56 776
+177.702484 20618.56 776
+177.718004 20618.56 776
+177.733524 20618.56 776
+177.749044 20618.56 776
+177.764564 20618.56 776
+177.780084 20618.56 776
+177.795604 20618.56 776
+177.811124 20618.56 776
+177.826644 20618.56 776
+177.842164 20618.56 776
+177.857684 20618.56 776
+177.873204 20618.56 776
+177.888724 20618.56 776
+177.904244 20618.56 776
+177.919764 20618.56 776
+177.935284 20618.56 776
+177.950804 20618.56 776
+177.966324 20618.56 776
+177.982004 20408.16 784
+177.997684 20408.16 784
+178.013364 20408.16 784
+178.029044 20408.16 784
+178.044724 20408.16 784
+178.060404 20408.16 784
+178.076084 20408.16 784
+178.091764 20408.16 784
+178.107444 20408.16 784
+178.123124 20408.16 784
+178.138804 20408.16 784
+178.154484 20408.16 784
+178.170164 20408.16 784
+178.185924 20304.57 788
+178.201684 20304.57 788
+178.217444 20304.57 788
+178.233204 20304.57 788
+178.248964 20304.57 788
+178.264724 20304.57 788
+178.280484 20304.57 788
+178.296244 20304.57 788
+178.312004 20304.57 788
+178.327764 20304.57 788
+178.343524 20304.57 788
+178.359284 20304.57 788
+178.375044 20304.57 788
+178.390804 20304.57 788
+178.406564 20304.57 788
+178.422324 20304.57 788
+178.438084 20304.57 788
+178.453844 20304.57 788
+178.469604 20304.57 788
+178.485364 20304.57 788
+178.501124 20304.57 788
+178.516884 20304.57 788
+178.532644 20304.57 788
+178.548404 20304.57 788
+178.564164 20304.57 788
+178.580004 20202.02 792
+178.595844 20202.02 792
+178.611684 20202.02 792
+178.627524 20202.02 792
+178.643364 20202.02 792
+178.659204 20202.02 792
+178.675044 20202.02 792
+178.690884 20202.02 792
+178.706724 20202.02 792
+178.722564 20202.02 792
+178.738404 20202.02 792
+178.754244 20202.02 792
+178.770084 20202.02 792
+178.785924 20202.02 792
+178.801764 20202.02 792
+178.817604 20202.02 792
+178.833444 20202.02 792
+178.849284 20202.02 792
+178.865124 20202.02 792
+178.880964 20202.02 792
+178.896804 20202.02 792
+178.912644 20202.02 792
+178.928484 20202.02 792
+178.944324 20202.02 792
+178.960164 20202.02 792
+178.976004 20202.02 792
+178.991924 20100.50 796
+179.007844 20100.50 796
+179.023764 20100.50 796
+179.039684 20100.50 796
+179.055604 20100.50 796
+179.071524 20100.50 796
+179.087444 20100.50 796
+179.103364 20100.50 796
+179.119284 20100.50 796
+179.135204 20100.50 796
+179.151124 20100.50 796
+179.167044 20100.50 796
+179.182964 20100.50 796
+179.198884 20100.50 796
+179.214804 20100.50 796
+179.230724 20100.50 796
+179.246644 20100.50 796
+179.262564 20100.50 796
+179.278484 20100.50 796
+179.294404 20100.50 796
+179.310324 20100.50 796
+179.326244 20100.50 796
+179.342164 20100.50 796
+179.358084 20100.50 796
+179.374004 20100.50 796
+179.390004 20000.00 800
+179.406004 20000.00 800
+179.422004 20000.00 800
+179.438004 20000.00 800
+179.454004 20000.00 800
+179.470004 20000.00 800
+179.486004 20000.00 800
+179.502004 20000.00 800
+179.518004 20000.00 800
+179.534004 20000.00 800
+179.550004 20000.00 800
+179.566004 20000.00 800
+179.582004 20000.00 800
+179.598084 19900.50 804
+179.613360 19900.50 804
+179.628636 19900.50 804
+179.643912 19900.50 804
+179.659188 19900.50 804
+179.674464 19900.50 804
+179.689740 19900.50 804
+179.705016 19900.50 804
+179.720292 19900.50 804
+179.735568 19900.50 804
+179.750844 19900.50 804
+179.766120 19900.50 804
+179.781396 19900.50 804
+179.796672 19900.50 804
+179.811948 19900.50 804
+179.827224 19900.50 804
+179.842500 19900.50 804
+179.857776 19900.50 804
+179.873052 19900.50 804
+179.888328 19900.50 804
+179.903604 19900.50 804
+179.918880 19900.50 804
+179.934156 19900.50 804
+179.949432 19900.50 804
+179.964708 19900.50 804
+179.979984 19900.50 804
+179.995260 19900.50 804
+180.010612 19801.98 808
+180.025964 19801.98 808
+180.041316 19801.98 808
+180.056668 19801.98 808
+180.072020 19801.98 808
+180.087372 19801.98 808
+180.102724 19801.98 808
+180.118076 19801.98 808
+180.133428 19801.98 808
+180.148780 19801.98 808
+180.164132 19801.98 808
+180.179484 19801.98 808
+180.194836 19801.98 808
+180.210188 19801.98 808
+180.225540 19801.98 808
+180.240892 19801.98 808
+180.256244 19801.98 808
+180.271596 19801.98 808
+180.286948 19801.98 808
+180.302300 19801.98 808
+180.317652 19801.98 808
+180.333004 19801.98 808
+180.348356 19801.98 808
+180.363708 19801.98 808
+180.379060 19801.98 808
+180.394412 19801.98 808
+180.409764 19801.98 808
+180.425192 19704.43 812
+180.440620 19704.43 812
+180.456048 19704.43 812
+180.471476 19704.43 812
+180.486904 19704.43 812
+180.502332 19704.43 812
+180.517760 19704.43 812
+180.533188 19704.43 812
+180.548616 19704.43 812
+180.564044 19704.43 812
+180.579472 19704.43 812
+180.594900 19704.43 812
+180.610328 19704.43 812
+180.625756 19704.43 812
+180.641260 19607.84 816
+180.656764 19607.84 816
+180.672268 19607.84 816
+180.687772 19607.84 816
+180.703276 19607.84 816
+180.718780 19607.84 816
+180.734284 19607.84 816
+180.749788 19607.84 816
+180.765292 19607.84 816
+180.780796 19607.84 816
+180.796300 19607.84 816
+180.811804 19607.84 816
+180.827308 19607.84 816
+180.842812 19607.84 816
+180.858316 19607.84 816
+180.873820 19607.84 816
+180.889324 19607.84 816
+180.904828 19607.84 816
+180.920332 19607.84 816
+180.935836 19607.84 816
+180.951340 19607.84 816
+180.966844 19607.84 816
+180.982348 19607.84 816
+180.997852 19607.84 816
+181.013356 19607.84 816
+181.028860 19607.84 816
+181.044364 19607.84 816
+181.059944 19512.20 820
+181.075524 19512.20 820
+181.091104 19512.20 820
+181.106684 19512.20 820
+181.122264 19512.20 820
+181.137844 19512.20 820
+181.153424 19512.20 820
+181.169004 19512.20 820
+181.184584 19512.20 820
+181.200164 19512.20 820
+181.215744 19512.20 820
+181.231324 19512.20 820
+181.246904 19512.20 820
+181.262560 19417.48 824
+181.278216 19417.48 824
+181.293872 19417.48 824
+181.309528 19417.48 824
+181.325184 19417.48 824
+181.340840 19417.48 824
+181.356496 19417.48 824
+181.372152 19417.48 824
+181.387808 19417.48 824
+181.403464 19417.48 824
+181.419120 19417.48 824
+181.434776 19417.48 824
+181.450432 19417.48 824
+181.466088 19417.48 824
+181.481744 19417.48 824
+181.497400 19417.48 824
+181.513056 19417.48 824
+181.528712 19417.48 824
+181.544368 19417.48 824
+181.560024 19417.48 824
+181.575680 19417.48 824
+181.591336 19417.48 824
+181.606992 19417.48 824
+181.622648 19417.48 824
+181.638304 19417.48 824
+181.653960 19417.48 824
+181.669616 19417.48 824
+181.685424 19230.77 832
+181.701232 19230.77 832
+181.717040 19230.77 832
+181.732848 19230.77 832
+181.748656 19230.77 832
+181.764464 19230.77 832
+181.780272 19230.77 832
+181.796080 19230.77 832
+181.811888 19230.77 832
+181.827696 19230.77 832
+181.843504 19230.77 832
+181.859312 19230.77 832
+181.875120 19230.77 832
+181.890928 19230.77 832
+181.906736 19230.77 832
+181.922544 19230.77 832
+181.938352 19230.77 832
+181.954160 19230.77 832
+181.969968 19230.77 832
+181.985776 19230.77 832
+182.001584 19230.77 832
+182.017392 19230.77 832
+182.033200 19230.77 832
+182.049008 19230.77 832
+182.064816 19230.77 832
+182.080624 19230.77 832
+182.096432 19230.77 832
+182.112316 19138.76 836
+182.128200 19138.76 836
+182.144084 19138.76 836
+182.159968 19138.76 836
+182.175852 19138.76 836
+182.191736 19138.76 836
+182.207620 19138.76 836
+182.223504 19138.76 836
+182.239388 19138.76 836
+182.255272 19138.76 836
+182.271156 19138.76 836
+182.287040 19138.76 836
+182.302924 19138.76 836
+182.318884 19047.62 840
+182.334844 19047.62 840
+182.350804 19047.62 840
+182.366764 19047.62 840
+182.382724 19047.62 840
+182.398684 19047.62 840
+182.414644 19047.62 840
+182.430604 19047.62 840
+182.446564 19047.62 840
+182.462524 19047.62 840
+182.478484 19047.62 840
+182.494444 19047.62 840
+182.510404 19047.62 840
+182.526364 19047.62 840
+182.542324 19047.62 840
+182.558284 19047.62 840
+182.574244 19047.62 840
+182.590204 19047.62 840
+182.606164 19047.62 840
+182.622124 19047.62 840
+182.638084 19047.62 840
+182.654044 19047.62 840
+182.670004 19047.62 840
+182.685964 19047.62 840
+182.701924 19047.62 840
+182.717884 19047.62 840
+182.733844 19047.62 840
+182.749880 18957.35 844
+182.765072 18957.35 844
+182.780264 18957.35 844
+182.795456 18957.35 844
+182.810648 18957.35 844
+182.825840 18957.35 844
+182.841032 18957.35 844
+182.856224 18957.35 844
+182.871416 18957.35 844
+182.886608 18957.35 844
+182.901800 18957.35 844
+182.916992 18957.35 844
+182.932184 18957.35 844
+182.947376 18957.35 844
+182.962568 18957.35 844
+182.977832 18867.92 848
+182.993096 18867.92 848
+183.008360 18867.92 848
+183.023624 18867.92 848
+183.038888 18867.92 848
+183.054152 18867.92 848
+183.069416 18867.92 848
+183.084680 18867.92 848
+183.099944 18867.92 848
+183.115208 18867.92 848
+183.130472 18867.92 848
+183.145736 18867.92 848
+183.161000 18867.92 848
+183.176264 18867.92 848
+183.191528 18867.92 848
+183.206792 18867.92 848
+183.222056 18867.92 848
+183.237320 18867.92 848
+183.252584 18867.92 848
+183.267848 18867.92 848
+183.283112 18867.92 848
+183.298376 18867.92 848
+183.313640 18867.92 848
+183.328904 18867.92 848
+183.344168 18867.92 848
+183.359432 18867.92 848
+183.374696 18867.92 848
+183.389960 18867.92 848
+183.405296 18779.34 852
+183.420632 18779.34 852
+183.435968 18779.34 852
+183.451304 18779.34 852
+183.466640 18779.34 852
+183.481976 18779.34 852
+183.497312 18779.34 852
+183.512648 18779.34 852
+183.527984 18779.34 852
+183.543320 18779.34 852
+183.558656 18779.34 852
+183.573992 18779.34 852
+183.589328 18779.34 852
+183.604664 18779.34 852
+183.620072 18691.59 856
+183.635480 18691.59 856
+183.650888 18691.59 856
+183.666296 18691.59 856
+183.681704 18691.59 856
+183.697112 18691.59 856
+183.712520 18691.59 856
+183.727928 18691.59 856
+183.743336 18691.59 856
+183.758744 18691.59 856
+183.774152 18691.59 856
+183.789560 18691.59 856
+183.804968 18691.59 856
+183.820376 18691.59 856
+183.835784 18691.59 856
+183.851192 18691.59 856
+183.866600 18691.59 856
+183.882008 18691.59 856
+183.897416 18691.59 856
+183.912824 18691.59 856
+183.928232 18691.59 856
+183.943640 18691.59 856
+183.959048 18691.59 856
+183.974456 18691.59 856
+183.989864 18691.59 856
+184.005272 18691.59 856
+184.020680 18691.59 856
+184.036088 18691.59 856
+184.051496 18691.59 856
+184.067048 18518.52 864
+184.082600 18518.52 864
+184.098152 18518.52 864
+184.113704 18518.52 864
+184.129256 18518.52 864
+184.144808 18518.52 864
+184.160360 18518.52 864
+184.175912 18518.52 864
+184.191464 18518.52 864
+184.207016 18518.52 864
+184.222568 18518.52 864
+184.238120 18518.52 864
+184.253672 18518.52 864
+184.269224 18518.52 864
+184.284848 18433.18 868
+184.300472 18433.18 868
+184.316096 18433.18 868
+184.331720 18433.18 868
+184.347344 18433.18 868
+184.362968 18433.18 868
+184.378592 18433.18 868
+184.394216 18433.18 868
+184.409840 18433.18 868
+184.425464 18433.18 868
+184.441088 18433.18 868
+184.456712 18433.18 868
+184.472336 18433.18 868
+184.487960 18433.18 868
+184.503584 18433.18 868
+184.519208 18433.18 868
+184.534832 18433.18 868
+184.550456 18433.18 868
+184.566080 18433.18 868
+184.581704 18433.18 868
+184.597328 18433.18 868
+184.612952 18433.18 868
+184.628576 18433.18 868
+184.644200 18433.18 868
+184.659824 18433.18 868
+184.675448 18433.18 868
+184.691072 18433.18 868
+184.706696 18433.18 868
+184.722392 18348.62 872
+184.738088 18348.62 872
+184.753784 18348.62 872
+184.769480 18348.62 872
+184.785176 18348.62 872
+184.800872 18348.62 872
+184.816568 18348.62 872
+184.832264 18348.62 872
+184.847960 18348.62 872
+184.863656 18348.62 872
+184.879352 18348.62 872
+184.895048 18348.62 872
+184.910744 18348.62 872
+184.926440 18348.62 872
+184.942136 18348.62 872
+184.957904 18264.84 876
+184.973672 18264.84 876
+184.989440 18264.84 876
+185.005208 18264.84 876
+185.020976 18264.84 876
+185.036744 18264.84 876
+185.052512 18264.84 876
+185.068280 18264.84 876
+185.084048 18264.84 876
+185.099816 18264.84 876
+185.115584 18264.84 876
+185.131352 18264.84 876
+185.147120 18264.84 876
+185.162888 18264.84 876
+185.178728 18181.82 880
+185.194568 18181.82 880
+185.210408 18181.82 880
+185.226248 18181.82 880
+185.242088 18181.82 880
+185.257928 18181.82 880
+185.273768 18181.82 880
+185.289608 18181.82 880
+185.305448 18181.82 880
+185.321288 18181.82 880
+185.337128 18181.82 880
+185.352968 18181.82 880
+185.368808 18181.82 880
+185.384648 18181.82 880
+185.400488 18181.82 880
+185.416328 18181.82 880
+185.432168 18181.82 880
+185.448008 18181.82 880
+185.463848 18181.82 880
+185.479688 18181.82 880
+185.495528 18181.82 880
+185.511368 18181.82 880
+185.527208 18181.82 880
+185.543048 18181.82 880
+185.558888 18181.82 880
+185.574728 18181.82 880
+185.590568 18181.82 880
+185.606408 18181.82 880
+185.622320 18099.55 884
+185.638232 18099.55 884
+185.654144 18099.55 884
+185.670056 18099.55 884
+185.685968 18099.55 884
+185.701880 18099.55 884
+185.717792 18099.55 884
+185.733704 18099.55 884
+185.749616 18099.55 884
+185.765528 18099.55 884
+185.781440 18099.55 884
+185.797352 18099.55 884
+185.813264 18099.55 884
+185.829176 18099.55 884
+185.845088 18099.55 884
+185.861000 18099.55 884
+185.876912 18099.55 884
+185.892824 18099.55 884
+185.908736 18099.55 884
+185.924648 18099.55 884
+185.940560 18099.55 884
+185.956472 18099.55 884
+185.972528 17937.22 892
+185.987692 17937.22 892
+186.002856 17937.22 892
+186.018020 17937.22 892
+186.033184 17937.22 892
+186.048348 17937.22 892
+186.063512 17937.22 892
+186.078676 17937.22 892
+186.093840 17937.22 892
+186.109004 17937.22 892
+186.124168 17937.22 892
+186.139332 17937.22 892
+186.154496 17937.22 892
+186.169660 17937.22 892
+186.184824 17937.22 892
+186.200056 17857.14 896
+186.215288 17857.14 896
+186.230520 17857.14 896
+186.245752 17857.14 896
+186.260984 17857.14 896
+186.276216 17857.14 896
+186.291448 17857.14 896
+186.306680 17857.14 896
+186.321912 17857.14 896
+186.337144 17857.14 896
+186.352376 17857.14 896
+186.367608 17857.14 896
+186.382840 17857.14 896
+186.398072 17857.14 896
+186.413304 17857.14 896
+186.428536 17857.14 896
+186.443768 17857.14 896
+186.459000 17857.14 896
+186.474232 17857.14 896
+186.489464 17857.14 896
+186.504696 17857.14 896
+186.519928 17857.14 896
+186.535228 17777.78 900
+186.550528 17777.78 900
+186.565828 17777.78 900
+186.581128 17777.78 900
+186.596428 17777.78 900
+186.611728 17777.78 900
+186.627028 17777.78 900
+186.642328 17777.78 900
+186.657628 17777.78 900
+186.672928 17777.78 900
+186.688228 17777.78 900
+186.703528 17777.78 900
+186.718828 17777.78 900
+186.734128 17777.78 900
+186.749428 17777.78 900
+186.764728 17777.78 900
+186.780028 17777.78 900
+186.795328 17777.78 900
+186.810628 17777.78 900
+186.825928 17777.78 900
+186.841228 17777.78 900
+186.856528 17777.78 900
+186.871828 17777.78 900
+186.887196 17699.12 904
+186.902564 17699.12 904
+186.917932 17699.12 904
+186.933300 17699.12 904
+186.948668 17699.12 904
+186.964036 17699.12 904
+186.979404 17699.12 904
+186.994772 17699.12 904
+187.010140 17699.12 904
+187.025508 17699.12 904
+187.040876 17699.12 904
+187.056244 17699.12 904
+187.071612 17699.12 904
+187.086980 17699.12 904
+187.102348 17699.12 904
+187.117852 17543.86 912
+187.133356 17543.86 912
+187.148860 17543.86 912
+187.164364 17543.86 912
+187.179868 17543.86 912
+187.195372 17543.86 912
+187.210876 17543.86 912
+187.226380 17543.86 912
+187.241884 17543.86 912
+187.257388 17543.86 912
+187.272892 17543.86 912
+187.288396 17543.86 912
+187.303900 17543.86 912
+187.319404 17543.86 912
+187.334908 17543.86 912
+187.350412 17543.86 912
+187.365916 17543.86 912
+187.381420 17543.86 912
+187.396924 17543.86 912
+187.412428 17543.86 912
+187.427932 17543.86 912
+187.443436 17543.86 912
+187.459008 17467.25 916
+187.474580 17467.25 916
+187.490152 17467.25 916
+187.505724 17467.25 916
+187.521296 17467.25 916
+187.536868 17467.25 916
+187.552440 17467.25 916
+187.568012 17467.25 916
+187.583584 17467.25 916
+187.599156 17467.25 916
+187.614728 17467.25 916
+187.630300 17467.25 916
+187.645872 17467.25 916
+187.661444 17467.25 916
+187.677016 17467.25 916
+187.692656 17391.30 920
+187.708296 17391.30 920
+187.723936 17391.30 920
+187.739576 17391.30 920
+187.755216 17391.30 920
+187.770856 17391.30 920
+187.786496 17391.30 920
+187.802136 17391.30 920
+187.817776 17391.30 920
+187.833416 17391.30 920
+187.849056 17391.30 920
+187.864696 17391.30 920
+187.880336 17391.30 920
+187.895976 17391.30 920
+187.911616 17391.30 920
+187.927256 17391.30 920
+187.942896 17391.30 920
+187.958536 17391.30 920
+187.974176 17391.30 920
+187.989816 17391.30 920
+188.005456 17391.30 920
+188.021096 17391.30 920
+188.036736 17391.30 920
+188.052444 17316.02 924
+188.068152 17316.02 924
+188.083860 17316.02 924
+188.099568 17316.02 924
+188.115276 17316.02 924
+188.130984 17316.02 924
+188.146692 17316.02 924
+188.162400 17316.02 924
+188.178108 17316.02 924
+188.193816 17316.02 924
+188.209524 17316.02 924
+188.225232 17316.02 924
+188.240940 17316.02 924
+188.256648 17316.02 924
+188.272356 17316.02 924
+188.288064 17316.02 924
+188.303772 17316.02 924
+188.319480 17316.02 924
+188.335188 17316.02 924
+188.350896 17316.02 924
+188.366604 17316.02 924
+188.382312 17316.02 924
+188.398020 17316.02 924
+188.413864 17167.38 932
+188.429708 17167.38 932
+188.445552 17167.38 932
+188.461396 17167.38 932
+188.477240 17167.38 932
+188.493084 17167.38 932
+188.508928 17167.38 932
+188.524772 17167.38 932
+188.540616 17167.38 932
+188.556460 17167.38 932
+188.572304 17167.38 932
+188.588148 17167.38 932
+188.603992 17167.38 932
+188.619836 17167.38 932
+188.635680 17167.38 932
+188.651592 17094.02 936
+188.667504 17094.02 936
+188.683416 17094.02 936
+188.699328 17094.02 936
+188.715240 17094.02 936
+188.731152 17094.02 936
+188.747064 17094.02 936
+188.762976 17094.02 936
+188.778888 17094.02 936
+188.794800 17094.02 936
+188.810712 17094.02 936
+188.826624 17094.02 936
+188.842536 17094.02 936
+188.858448 17094.02 936
+188.874360 17094.02 936
+188.890272 17094.02 936
+188.906184 17094.02 936
+188.922096 17094.02 936
+188.938008 17094.02 936
+188.953920 17094.02 936
+188.969832 17094.02 936
+188.985744 17094.02 936
+189.001724 17021.28 940
+189.017704 17021.28 940
+189.033684 17021.28 940
+189.049664 17021.28 940
+189.065644 17021.28 940
+189.081624 17021.28 940
+189.097604 17021.28 940
+189.113584 17021.28 940
+189.129564 17021.28 940
+189.145544 17021.28 940
+189.161524 17021.28 940
+189.177504 17021.28 940
+189.193484 17021.28 940
+189.209464 17021.28 940
+189.225444 17021.28 940
+189.241492 16949.15 944
+189.256596 16949.15 944
+189.271700 16949.15 944
+189.286804 16949.15 944
+189.301908 16949.15 944
+189.317012 16949.15 944
+189.332116 16949.15 944
+189.347220 16949.15 944
+189.362324 16949.15 944
+189.377428 16949.15 944
+189.392532 16949.15 944
+189.407636 16949.15 944
+189.422740 16949.15 944
+189.437844 16949.15 944
+189.452948 16949.15 944
+189.468052 16949.15 944
+189.483284 16806.72 952
+189.498516 16806.72 952
+189.513748 16806.72 952
+189.528980 16806.72 952
+189.544212 16806.72 952
+189.559444 16806.72 952
+189.574676 16806.72 952
+189.589908 16806.72 952
+189.605140 16806.72 952
+189.620372 16806.72 952
+189.635604 16806.72 952
+189.650836 16806.72 952
+189.666068 16806.72 952
+189.681300 16806.72 952
+189.696532 16806.72 952
+189.711764 16806.72 952
+189.726996 16806.72 952
+189.742228 16806.72 952
+189.757460 16806.72 952
+189.772692 16806.72 952
+189.787924 16806.72 952
+189.803156 16806.72 952
+189.818388 16806.72 952
+189.833620 16806.72 952
+189.848916 16736.40 956
+189.864212 16736.40 956
+189.879508 16736.40 956
+189.894804 16736.40 956
+189.910100 16736.40 956
+189.925396 16736.40 956
+189.940692 16736.40 956
+189.955988 16736.40 956
+189.971284 16736.40 956
+189.986580 16736.40 956
+190.001876 16736.40 956
+190.017172 16736.40 956
+190.032468 16736.40 956
+190.047764 16736.40 956
+190.063060 16736.40 956
+190.078356 16736.40 956
+190.093716 16666.67 960
+190.109076 16666.67 960
+190.124436 16666.67 960
+190.139796 16666.67 960
+190.155156 16666.67 960
+190.170516 16666.67 960
+190.185876 16666.67 960
+190.201236 16666.67 960
+190.216596 16666.67 960
+190.231956 16666.67 960
+190.247316 16666.67 960
+190.262676 16666.67 960
+190.278036 16666.67 960
+190.293396 16666.67 960
+190.308756 16666.67 960
+190.324116 16666.67 960
+190.339476 16666.67 960
+190.354836 16666.67 960
+190.370196 16666.67 960
+190.385556 16666.67 960
+190.400916 16666.67 960
+190.416276 16666.67 960
+190.431636 16666.67 960
+190.446996 16666.67 960
+190.462484 16528.93 968
+190.477972 16528.93 968
+190.493460 16528.93 968
+190.508948 16528.93 968
+190.524436 16528.93 968
+190.539924 16528.93 968
+190.555412 16528.93 968
+190.570900 16528.93 968
+190.586388 16528.93 968
+190.601876 16528.93 968
+190.617364 16528.93 968
+190.632852 16528.93 968
+190.648340 16528.93 968
+190.663828 16528.93 968
+190.679316 16528.93 968
+190.694804 16528.93 968
+190.710356 16460.91 972
+190.725908 16460.91 972
+190.741460 16460.91 972
+190.757012 16460.91 972
+190.772564 16460.91 972
+190.788116 16460.91 972
+190.803668 16460.91 972
+190.819220 16460.91 972
+190.834772 16460.91 972
+190.850324 16460.91 972
+190.865876 16460.91 972
+190.881428 16460.91 972
+190.896980 16460.91 972
+190.912532 16460.91 972
+190.928084 16460.91 972
+190.943636 16460.91 972
+190.959252 16393.44 976
+190.974868 16393.44 976
+190.990484 16393.44 976
+191.006100 16393.44 976
+191.021716 16393.44 976
+191.037332 16393.44 976
+191.052948 16393.44 976
+191.068564 16393.44 976
+191.084180 16393.44 976
+191.099796 16393.44 976
+191.115412 16393.44 976
+191.131028 16393.44 976
+191.146644 16393.44 976
+191.162260 16393.44 976
+191.177876 16393.44 976
+191.193492 16393.44 976
+191.209236 16260.16 984
+191.224980 16260.16 984
+191.240724 16260.16 984
+191.256468 16260.16 984
+191.272212 16260.16 984
+191.287956 16260.16 984
+191.303700 16260.16 984
+191.319444 16260.16 984
+191.335188 16260.16 984
+191.350932 16260.16 984
+191.366676 16260.16 984
+191.382420 16260.16 984
+191.398164 16260.16 984
+191.413908 16260.16 984
+191.429652 16260.16 984
+191.445396 16260.16 984
+191.461140 16260.16 984
+191.476884 16260.16 984
+191.492628 16260.16 984
+191.508372 16260.16 984
+191.524116 16260.16 984
+191.539860 16260.16 984
+191.555604 16260.16 984
+191.571348 16260.16 984
+191.587156 16194.33 988
+191.602964 16194.33 988
+191.618772 16194.33 988
+191.634580 16194.33 988
+191.650388 16194.33 988
+191.666196 16194.33 988
+191.682004 16194.33 988
+191.697812 16194.33 988
+191.713620 16194.33 988
+191.729428 16194.33 988
+191.745236 16194.33 988
+191.761044 16194.33 988
+191.776852 16194.33 988
+191.792660 16194.33 988
+191.808468 16194.33 988
+191.824276 16194.33 988
+191.840148 16129.03 992
+191.856020 16129.03 992
+191.871892 16129.03 992
+191.887764 16129.03 992
+191.903636 16129.03 992
+191.919508 16129.03 992
+191.935380 16129.03 992
+191.951252 16129.03 992
+191.967124 16129.03 992
+191.982996 16129.03 992
+191.998868 16129.03 992
+192.014740 16129.03 992
+192.030612 16129.03 992
+192.046484 16129.03 992
+192.062356 16129.03 992
+192.078228 16129.03 992
+192.094228 16000.00 1000
+192.110228 16000.00 1000
+192.126228 16000.00 1000
+192.142228 16000.00 1000
+192.158228 16000.00 1000
+192.174228 16000.00 1000
+192.190228 16000.00 1000
+192.206228 16000.00 1000
+192.222228 16000.00 1000
+192.238228 16000.00 1000
+192.254228 16000.00 1000
+192.270228 16000.00 1000
+192.286228 16000.00 1000
+192.302228 16000.00 1000
+192.318228 16000.00 1000
+192.334228 16000.00 1000
+192.350292 15936.25 1004
+192.365352 15936.25 1004
+192.380412 15936.25 1004
+192.395472 15936.25 1004
+192.410532 15936.25 1004
+192.425592 15936.25 1004
+192.440652 15936.25 1004
+192.455712 15936.25 1004
+192.470772 15936.25 1004
+192.485832 15936.25 1004
+192.500892 15936.25 1004
+192.515952 15936.25 1004
+192.531012 15936.25 1004
+192.546072 15936.25 1004
+192.561132 15936.25 1004
+192.576192 15936.25 1004
+192.591252 15936.25 1004
+192.606372 15873.02 1008
+192.621492 15873.02 1008
+192.636612 15873.02 1008
+192.651732 15873.02 1008
+192.666852 15873.02 1008
+192.681972 15873.02 1008
+192.697092 15873.02 1008
+192.712212 15873.02 1008
+192.727332 15873.02 1008
+192.742452 15873.02 1008
+192.757572 15873.02 1008
+192.772692 15873.02 1008
+192.787812 15873.02 1008
+192.802932 15873.02 1008
+192.818052 15873.02 1008
+192.833172 15873.02 1008
+192.848292 15873.02 1008
+192.863412 15873.02 1008
+192.878532 15873.02 1008
+192.893652 15873.02 1008
+192.908772 15873.02 1008
+192.923892 15873.02 1008
+192.939012 15873.02 1008
+192.954132 15873.02 1008
+192.969252 15873.02 1008
+192.984372 15873.02 1008
+192.999612 15748.03 1016
+193.014852 15748.03 1016
+193.030092 15748.03 1016
+193.045332 15748.03 1016
+193.060572 15748.03 1016
+193.075812 15748.03 1016
+193.091052 15748.03 1016
+193.106292 15748.03 1016
+193.121532 15748.03 1016
+193.136772 15748.03 1016
+193.152012 15748.03 1016
+193.167252 15748.03 1016
+193.182492 15748.03 1016
+193.197732 15748.03 1016
+193.212972 15748.03 1016
+193.228212 15748.03 1016
+193.243452 15748.03 1016
+193.258752 15686.27 1020
+193.274052 15686.27 1020
+193.289352 15686.27 1020
+193.304652 15686.27 1020
+193.319952 15686.27 1020
+193.335252 15686.27 1020
+193.350552 15686.27 1020
+193.365852 15686.27 1020
+193.381152 15686.27 1020
+193.396452 15686.27 1020
+193.411752 15686.27 1020
+193.427052 15686.27 1020
+193.442352 15686.27 1020
+193.457652 15686.27 1020
+193.472952 15686.27 1020
+193.488252 15686.27 1020
+193.503552 15686.27 1020
+193.518912 15625.00 1024
+193.534272 15625.00 1024
+193.549632 15625.00 1024
+193.564992 15625.00 1024
+193.580352 15625.00 1024
+193.595712 15625.00 1024
+193.611072 15625.00 1024
+193.626432 15625.00 1024
+193.641792 15625.00 1024
+193.657152 15625.00 1024
+193.672512 15625.00 1024
+193.687872 15625.00 1024
+193.703232 15625.00 1024
+193.718592 15625.00 1024
+193.733952 15625.00 1024
+193.749312 15625.00 1024
+193.764672 15625.00 1024
+193.780152 15503.88 1032
+193.795632 15503.88 1032
+193.811112 15503.88 1032
+193.826592 15503.88 1032
+193.842072 15503.88 1032
+193.857552 15503.88 1032
+193.873032 15503.88 1032
+193.888512 15503.88 1032
+193.903992 15503.88 1032
+193.919472 15503.88 1032
+193.934952 15503.88 1032
+193.950432 15503.88 1032
+193.965912 15503.88 1032
+193.981392 15503.88 1032
+193.996872 15503.88 1032
+194.012352 15503.88 1032
+194.027832 15503.88 1032
+194.043312 15503.88 1032
+194.058792 15503.88 1032
+194.074272 15503.88 1032
+194.089752 15503.88 1032
+194.105232 15503.88 1032
+194.120712 15503.88 1032
+194.136192 15503.88 1032
+194.151672 15503.88 1032
+194.167152 15503.88 1032
+194.182632 15503.88 1032
+194.198112 15503.88 1032
+194.213592 15503.88 1032
+194.229072 15503.88 1032
+194.244552 15503.88 1032
+194.260032 15503.88 1032
+194.275512 15503.88 1032
+194.290992 15503.88 1032
+194.306592 15384.62 1040
+194.322192 15384.62 1040
+194.337792 15384.62 1040
+194.353392 15384.62 1040
+194.368992 15384.62 1040
+194.384592 15384.62 1040
+194.400192 15384.62 1040
+194.415792 15384.62 1040
+194.431392 15384.62 1040
+194.446992 15384.62 1040
+194.462592 15384.62 1040
+194.478192 15384.62 1040
+194.493792 15384.62 1040
+194.509392 15384.62 1040
+194.524992 15384.62 1040
+194.540592 15384.62 1040
+194.556192 15384.62 1040
+194.571912 15267.18 1048
+194.587632 15267.18 1048
+194.603352 15267.18 1048
+194.619072 15267.18 1048
+194.634792 15267.18 1048
+194.650512 15267.18 1048
+194.666232 15267.18 1048
+194.681952 15267.18 1048
+194.697672 15267.18 1048
+194.713392 15267.18 1048
+194.729112 15267.18 1048
+194.744832 15267.18 1048
+194.760552 15267.18 1048
+194.776272 15267.18 1048
+194.791992 15267.18 1048
+194.807712 15267.18 1048
+194.823432 15267.18 1048
+194.839272 15151.52 1056
+194.855112 15151.52 1056
+194.870952 15151.52 1056
+194.886792 15151.52 1056
+194.902632 15151.52 1056
+194.918472 15151.52 1056
+194.934312 15151.52 1056
+194.950152 15151.52 1056
+194.965992 15151.52 1056
+194.981832 15151.52 1056
+194.997672 15151.52 1056
+195.013512 15151.52 1056
+195.029352 15151.52 1056
+195.045192 15151.52 1056
+195.061032 15151.52 1056
+195.076872 15151.52 1056
+195.092712 15151.52 1056
+195.108552 15151.52 1056
+195.124392 15151.52 1056
+195.140232 15151.52 1056
+195.156072 15151.52 1056
+195.171912 15151.52 1056
+195.187752 15151.52 1056
+195.203592 15151.52 1056
+195.219432 15151.52 1056
+195.235272 15151.52 1056
+195.251112 15151.52 1056
+195.266952 15151.52 1056
+195.282792 15151.52 1056
+195.298632 15151.52 1056
+195.314472 15151.52 1056
+195.330312 15151.52 1056
+195.346152 15151.52 1056
+195.361992 15151.52 1056
+195.377832 15151.52 1056
+195.393792 15037.59 1064
+195.409752 15037.59 1064
+195.425712 15037.59 1064
+195.441672 15037.59 1064
+195.457632 15037.59 1064
+195.473592 15037.59 1064
+195.489552 15037.59 1064
+195.505512 15037.59 1064
+195.521472 15037.59 1064
+195.537432 15037.59 1064
+195.553392 15037.59 1064
+195.569352 15037.59 1064
+195.585312 15037.59 1064
+195.601272 15037.59 1064
+195.617232 15037.59 1064
+195.633192 15037.59 1064
+195.649152 15037.59 1064
+195.665232 14925.37 1072
+195.680240 14925.37 1072
+195.695248 14925.37 1072
+195.710256 14925.37 1072
+195.725264 14925.37 1072
+195.740272 14925.37 1072
+195.755280 14925.37 1072
+195.770288 14925.37 1072
+195.785296 14925.37 1072
+195.800416 14814.81 1080
+195.815536 14814.81 1080
+195.830656 14814.81 1080
+195.845776 14814.81 1080
+195.860896 14814.81 1080
+195.876016 14814.81 1080
+195.891136 14814.81 1080
+195.906256 14814.81 1080
+195.921376 14814.81 1080
+195.936496 14814.81 1080
+195.951616 14814.81 1080
+195.966736 14814.81 1080
+195.981856 14814.81 1080
+195.996976 14814.81 1080
+196.012096 14814.81 1080
+196.027216 14814.81 1080
+196.042336 14814.81 1080
+196.057456 14814.81 1080
+196.072576 14814.81 1080
+196.087696 14814.81 1080
+196.102816 14814.81 1080
+196.117936 14814.81 1080
+196.133056 14814.81 1080
+196.148176 14814.81 1080
+196.163296 14814.81 1080
+196.178416 14814.81 1080
+196.193536 14814.81 1080
+196.208656 14814.81 1080
+196.223776 14814.81 1080
+196.238896 14814.81 1080
+196.254016 14814.81 1080
+196.269136 14814.81 1080
+196.284256 14814.81 1080
+196.299376 14814.81 1080
+196.314496 14814.81 1080
+196.329616 14814.81 1080
+196.344848 14705.88 1088
+196.360080 14705.88 1088
+196.375312 14705.88 1088
+196.390544 14705.88 1088
+196.405776 14705.88 1088
+196.421008 14705.88 1088
+196.436240 14705.88 1088
+196.451472 14705.88 1088
+196.466704 14705.88 1088
+196.481936 14705.88 1088
+196.497168 14705.88 1088
+196.512400 14705.88 1088
+196.527632 14705.88 1088
+196.542864 14705.88 1088
+196.558096 14705.88 1088
+196.573328 14705.88 1088
+196.588560 14705.88 1088
+196.603792 14705.88 1088
+196.619024 14705.88 1088
+196.634368 14598.54 1096
+196.649712 14598.54 1096
+196.665056 14598.54 1096
+196.680400 14598.54 1096
+196.695744 14598.54 1096
+196.711088 14598.54 1096
+196.726432 14598.54 1096
+196.741776 14598.54 1096
+196.757120 14598.54 1096
+196.772464 14598.54 1096
+196.787808 14598.54 1096
+196.803152 14598.54 1096
+196.818496 14598.54 1096
+196.833840 14598.54 1096
+196.849184 14598.54 1096
+196.864528 14598.54 1096
+196.879872 14598.54 1096
+196.895216 14598.54 1096
+196.910560 14598.54 1096
+196.925904 14598.54 1096
+196.941248 14598.54 1096
+196.956592 14598.54 1096
+196.971936 14598.54 1096
+196.987280 14598.54 1096
+197.002624 14598.54 1096
+197.017968 14598.54 1096
+197.033312 14598.54 1096
+197.048656 14598.54 1096
+197.064000 14598.54 1096
+197.079344 14598.54 1096
+197.094688 14598.54 1096
+197.110032 14598.54 1096
+197.125376 14598.54 1096
+197.140720 14598.54 1096
+197.156064 14598.54 1096
+197.171408 14598.54 1096
+197.186864 14492.75 1104
+197.202320 14492.75 1104
+197.217776 14492.75 1104
+197.233232 14492.75 1104
+197.248688 14492.75 1104
+197.264144 14492.75 1104
+197.279600 14492.75 1104
+197.295056 14492.75 1104
+197.310512 14492.75 1104
+197.326080 14388.49 1112
+197.341648 14388.49 1112
+197.357216 14388.49 1112
+197.372784 14388.49 1112
+197.388352 14388.49 1112
+197.403920 14388.49 1112
+197.419488 14388.49 1112
+197.435056 14388.49 1112
+197.450624 14388.49 1112
+197.466192 14388.49 1112
+197.481760 14388.49 1112
+197.497328 14388.49 1112
+197.512896 14388.49 1112
+197.528464 14388.49 1112
+197.544032 14388.49 1112
+197.559600 14388.49 1112
+197.575168 14388.49 1112
+197.590736 14388.49 1112
+197.606304 14388.49 1112
+197.621984 14285.71 1120
+197.637664 14285.71 1120
+197.653344 14285.71 1120
+197.669024 14285.71 1120
+197.684704 14285.71 1120
+197.700384 14285.71 1120
+197.716064 14285.71 1120
+197.731744 14285.71 1120
+197.747424 14285.71 1120
+197.763104 14285.71 1120
+197.778784 14285.71 1120
+197.794464 14285.71 1120
+197.810144 14285.71 1120
+197.825824 14285.71 1120
+197.841504 14285.71 1120
+197.857184 14285.71 1120
+197.872864 14285.71 1120
+197.888544 14285.71 1120
+197.904224 14285.71 1120
+197.919904 14285.71 1120
+197.935584 14285.71 1120
+197.951264 14285.71 1120
+197.966944 14285.71 1120
+197.982624 14285.71 1120
+197.998304 14285.71 1120
+198.013984 14285.71 1120
+198.029664 14285.71 1120
+198.045344 14285.71 1120
+198.061024 14285.71 1120
+198.076704 14285.71 1120
+198.092384 14285.71 1120
+198.108064 14285.71 1120
+198.123744 14285.71 1120
+198.139424 14285.71 1120
+198.155104 14285.71 1120
+198.170784 14285.71 1120
+198.186576 14184.40 1128
+198.202368 14184.40 1128
+198.218160 14184.40 1128
+198.233952 14184.40 1128
+198.249744 14184.40 1128
+198.265536 14184.40 1128
+198.281328 14184.40 1128
+198.297120 14184.40 1128
+198.312912 14184.40 1128
+198.328816 14084.51 1136
+198.344720 14084.51 1136
+198.360624 14084.51 1136
+198.376528 14084.51 1136
+198.392432 14084.51 1136
+198.408336 14084.51 1136
+198.424240 14084.51 1136
+198.440144 14084.51 1136
+198.456048 14084.51 1136
+198.471952 14084.51 1136
+198.487856 14084.51 1136
+198.503760 14084.51 1136
+198.519664 14084.51 1136
+198.535568 14084.51 1136
+198.551472 14084.51 1136
+198.567376 14084.51 1136
+198.583280 14084.51 1136
+198.599184 14084.51 1136
+198.615088 14084.51 1136
+198.631104 13986.01 1144
+198.645976 13986.01 1144
+198.660848 13986.01 1144
+198.675720 13986.01 1144
+198.690592 13986.01 1144
+198.705464 13986.01 1144
+198.720336 13986.01 1144
+198.735208 13986.01 1144
+198.750080 13986.01 1144
+198.764952 13986.01 1144
+198.779824 13986.01 1144
+198.794696 13986.01 1144
+198.809568 13986.01 1144
+198.824440 13986.01 1144
+198.839312 13986.01 1144
+198.854184 13986.01 1144
+198.869056 13986.01 1144
+198.883928 13986.01 1144
+198.898800 13986.01 1144
+198.913776 13888.89 1152
+198.928752 13888.89 1152
+198.943728 13888.89 1152
+198.958704 13888.89 1152
+198.973680 13888.89 1152
+198.988656 13888.89 1152
+199.003632 13888.89 1152
+199.018608 13888.89 1152
+199.033584 13888.89 1152
+199.048560 13888.89 1152
+199.063536 13888.89 1152
+199.078512 13888.89 1152
+199.093488 13888.89 1152
+199.108464 13888.89 1152
+199.123440 13888.89 1152
+199.138416 13888.89 1152
+199.153392 13888.89 1152
+199.168368 13888.89 1152
+199.183344 13888.89 1152
+199.198320 13888.89 1152
+199.213296 13888.89 1152
+199.228272 13888.89 1152
+199.243248 13888.89 1152
+199.258224 13888.89 1152
+199.273200 13888.89 1152
+199.288176 13888.89 1152
+199.303152 13888.89 1152
+199.318128 13888.89 1152
+199.333104 13888.89 1152
+199.348080 13888.89 1152
+199.363160 13793.10 1160
+199.378240 13793.10 1160
+199.393320 13793.10 1160
+199.408400 13793.10 1160
+199.423480 13793.10 1160
+199.438560 13793.10 1160
+199.453640 13793.10 1160
+199.468720 13793.10 1160
+199.483800 13793.10 1160
+199.498880 13793.10 1160
+199.514064 13698.63 1168
+199.529248 13698.63 1168
+199.544432 13698.63 1168
+199.559616 13698.63 1168
+199.574800 13698.63 1168
+199.589984 13698.63 1168
+199.605168 13698.63 1168
+199.620352 13698.63 1168
+199.635536 13698.63 1168
+199.650720 13698.63 1168
+199.665904 13698.63 1168
+199.681088 13698.63 1168
+199.696272 13698.63 1168
+199.711456 13698.63 1168
+199.726640 13698.63 1168
+199.741824 13698.63 1168
+199.757008 13698.63 1168
+199.772192 13698.63 1168
+199.787376 13698.63 1168
+199.802664 13605.44 1176
+199.817952 13605.44 1176
+199.833240 13605.44 1176
+199.848528 13605.44 1176
+199.863816 13605.44 1176
+199.879104 13605.44 1176
+199.894392 13605.44 1176
+199.909680 13605.44 1176
+199.924968 13605.44 1176
+199.940256 13605.44 1176
+199.955544 13605.44 1176
+199.970832 13605.44 1176
+199.986120 13605.44 1176
+200.001408 13605.44 1176
+200.016696 13605.44 1176
+200.031984 13605.44 1176
+200.047272 13605.44 1176
+200.062560 13605.44 1176
+200.077848 13605.44 1176
+200.093136 13605.44 1176
+200.108424 13605.44 1176
+200.123712 13605.44 1176
+200.139000 13605.44 1176
+200.154288 13605.44 1176
+200.169576 13605.44 1176
+200.184864 13605.44 1176
+200.200152 13605.44 1176
+200.215440 13605.44 1176
+200.230728 13605.44 1176
+200.246016 13605.44 1176
+200.261408 13513.51 1184
+200.276800 13513.51 1184
+200.292192 13513.51 1184
+200.307584 13513.51 1184
+200.322976 13513.51 1184
+200.338368 13513.51 1184
+200.353760 13513.51 1184
+200.369152 13513.51 1184
+200.384544 13513.51 1184
+200.399936 13513.51 1184
+200.415328 13513.51 1184
+200.430720 13513.51 1184
+200.446112 13513.51 1184
+200.461504 13513.51 1184
+200.476896 13513.51 1184
+200.492288 13513.51 1184
+200.507680 13513.51 1184
+200.523072 13513.51 1184
+200.538464 13513.51 1184
+200.553960 13422.82 1192
+200.569456 13422.82 1192
+200.584952 13422.82 1192
+200.600448 13422.82 1192
+200.615944 13422.82 1192
+200.631440 13422.82 1192
+200.646936 13422.82 1192
+200.662432 13422.82 1192
+200.677928 13422.82 1192
+200.693424 13422.82 1192
+200.709024 13333.33 1200
+200.724624 13333.33 1200
+200.740224 13333.33 1200
+200.755824 13333.33 1200
+200.771424 13333.33 1200
+200.787024 13333.33 1200
+200.802624 13333.33 1200
+200.818224 13333.33 1200
+200.833824 13333.33 1200
+200.849424 13333.33 1200
+200.865024 13333.33 1200
+200.880624 13333.33 1200
+200.896224 13333.33 1200
+200.911824 13333.33 1200
+200.927424 13333.33 1200
+200.943024 13333.33 1200
+200.958624 13333.33 1200
+200.974224 13333.33 1200
+200.989824 13333.33 1200
+201.005424 13333.33 1200
+201.021128 13245.03 1208
+201.036832 13245.03 1208
+201.052536 13245.03 1208
+201.068240 13245.03 1208
+201.083944 13245.03 1208
+201.099648 13245.03 1208
+201.115352 13245.03 1208
+201.131056 13245.03 1208
+201.146760 13245.03 1208
+201.162464 13245.03 1208
+201.178272 13157.89 1216
+201.194080 13157.89 1216
+201.209888 13157.89 1216
+201.225696 13157.89 1216
+201.241504 13157.89 1216
+201.257312 13157.89 1216
+201.273120 13157.89 1216
+201.288928 13157.89 1216
+201.304736 13157.89 1216
+201.320544 13157.89 1216
+201.336352 13157.89 1216
+201.352160 13157.89 1216
+201.367968 13157.89 1216
+201.383776 13157.89 1216
+201.399584 13157.89 1216
+201.415392 13157.89 1216
+201.431200 13157.89 1216
+201.447008 13157.89 1216
+201.462816 13157.89 1216
+201.478624 13157.89 1216
+201.494432 13157.89 1216
+201.510240 13157.89 1216
+201.526048 13157.89 1216
+201.541856 13157.89 1216
+201.557664 13157.89 1216
+201.573472 13157.89 1216
+201.589280 13157.89 1216
+201.605088 13157.89 1216
+201.620896 13157.89 1216
+201.636808 13071.90 1224
+201.652720 13071.90 1224
+201.668632 13071.90 1224
+201.684544 13071.90 1224
+201.700456 13071.90 1224
+201.716368 13071.90 1224
+201.732280 13071.90 1224
+201.748192 13071.90 1224
+201.764104 13071.90 1224
+201.780016 13071.90 1224
+201.795928 13071.90 1224
+201.811840 13071.90 1224
+201.827752 13071.90 1224
+201.843664 13071.90 1224
+201.859576 13071.90 1224
+201.875488 13071.90 1224
+201.891400 13071.90 1224
+201.907312 13071.90 1224
+201.923224 13071.90 1224
+201.939136 13071.90 1224
+201.955152 12987.01 1232
+201.969936 12987.01 1232
+201.984720 12987.01 1232
+201.999504 12987.01 1232
+202.014288 12987.01 1232
+202.029072 12987.01 1232
+202.043856 12987.01 1232
+202.058640 12987.01 1232
+202.073424 12987.01 1232
+202.088208 12987.01 1232
+202.102992 12987.01 1232
+202.117872 12903.23 1240
+202.132752 12903.23 1240
+202.147632 12903.23 1240
+202.162512 12903.23 1240
+202.177392 12903.23 1240
+202.192272 12903.23 1240
+202.207152 12903.23 1240
+202.222032 12903.23 1240
+202.236912 12903.23 1240
+202.251792 12903.23 1240
+202.266768 12820.51 1248
+202.281744 12820.51 1248
+202.296720 12820.51 1248
+202.311696 12820.51 1248
+202.326672 12820.51 1248
+202.341648 12820.51 1248
+202.356624 12820.51 1248
+202.371600 12820.51 1248
+202.386576 12820.51 1248
+202.401552 12820.51 1248
+202.416528 12820.51 1248
+202.431504 12820.51 1248
+202.446480 12820.51 1248
+202.461456 12820.51 1248
+202.476432 12820.51 1248
+202.491408 12820.51 1248
+202.506384 12820.51 1248
+202.521360 12820.51 1248
+202.536336 12820.51 1248
+202.551312 12820.51 1248
+202.566288 12820.51 1248
+202.581264 12820.51 1248
+202.596336 12738.85 1256
+202.611408 12738.85 1256
+202.626480 12738.85 1256
+202.641552 12738.85 1256
+202.656624 12738.85 1256
+202.671696 12738.85 1256
+202.686768 12738.85 1256
+202.701840 12738.85 1256
+202.716912 12738.85 1256
+202.731984 12738.85 1256
+202.747056 12738.85 1256
+202.762128 12738.85 1256
+202.777200 12738.85 1256
+202.792272 12738.85 1256
+202.807344 12738.85 1256
+202.822416 12738.85 1256
+202.837488 12738.85 1256
+202.852560 12738.85 1256
+202.867632 12738.85 1256
+202.882704 12738.85 1256
+202.897776 12738.85 1256
+202.912848 12738.85 1256
+202.927920 12738.85 1256
+202.942992 12738.85 1256
+202.958064 12738.85 1256
+202.973136 12738.85 1256
+202.988304 12658.23 1264
+203.003472 12658.23 1264
+203.018640 12658.23 1264
+203.033808 12658.23 1264
+203.048976 12658.23 1264
+203.064144 12658.23 1264
+203.079312 12658.23 1264
+203.094480 12658.23 1264
+203.109648 12658.23 1264
+203.124816 12658.23 1264
+203.139984 12658.23 1264
+203.155152 12658.23 1264
+203.170320 12658.23 1264
+203.185488 12658.23 1264
+203.200656 12658.23 1264
+203.215824 12658.23 1264
+203.231088 12578.62 1272
+203.246352 12578.62 1272
+203.261616 12578.62 1272
+203.276880 12578.62 1272
+203.292144 12578.62 1272
+203.307408 12578.62 1272
+203.322672 12578.62 1272
+203.337936 12578.62 1272
+203.353200 12578.62 1272
+203.368464 12578.62 1272
+203.383728 12578.62 1272
+203.398992 12578.62 1272
+203.414256 12578.62 1272
+203.429520 12578.62 1272
+203.444784 12578.62 1272
+203.460048 12578.62 1272
+203.475408 12500.00 1280
+203.490768 12500.00 1280
+203.506128 12500.00 1280
+203.521488 12500.00 1280
+203.536848 12500.00 1280
+203.552208 12500.00 1280
+203.567568 12500.00 1280
+203.582928 12500.00 1280
+203.598288 12500.00 1280
+203.613648 12500.00 1280
+203.629008 12500.00 1280
+203.644464 12422.36 1288
+203.659920 12422.36 1288
+203.675376 12422.36 1288
+203.690832 12422.36 1288
+203.706288 12422.36 1288
+203.721744 12422.36 1288
+203.737200 12422.36 1288
+203.752656 12422.36 1288
+203.768112 12422.36 1288
+203.783568 12422.36 1288
+203.799024 12422.36 1288
+203.814480 12422.36 1288
+203.829936 12422.36 1288
+203.845392 12422.36 1288
+203.860848 12422.36 1288
+203.876304 12422.36 1288
+203.891856 12345.68 1296
+203.907408 12345.68 1296
+203.922960 12345.68 1296
+203.938512 12345.68 1296
+203.954064 12345.68 1296
+203.969616 12345.68 1296
+203.985168 12345.68 1296
+204.000720 12345.68 1296
+204.016272 12345.68 1296
+204.031824 12345.68 1296
+204.047376 12345.68 1296
+204.063024 12269.94 1304
+204.078672 12269.94 1304
+204.094320 12269.94 1304
+204.109968 12269.94 1304
+204.125616 12269.94 1304
+204.141264 12269.94 1304
+204.156912 12269.94 1304
+204.172560 12269.94 1304
+204.188208 12269.94 1304
+204.203856 12269.94 1304
+204.219504 12269.94 1304
+204.235152 12269.94 1304
+204.250800 12269.94 1304
+204.266448 12269.94 1304
+204.282096 12269.94 1304
+204.297744 12269.94 1304
+204.313392 12269.94 1304
+204.329040 12269.94 1304
+204.344688 12269.94 1304
+204.360336 12269.94 1304
+204.375984 12269.94 1304
+204.391632 12269.94 1304
+204.407280 12269.94 1304
+204.422928 12269.94 1304
+204.438576 12269.94 1304
+204.454224 12269.94 1304
+204.469872 12269.94 1304
+204.485520 12269.94 1304
+204.501168 12269.94 1304
+204.516816 12269.94 1304
+204.532464 12269.94 1304
+204.548112 12269.94 1304
+204.563856 12195.12 1312
+204.579600 12195.12 1312
+204.595344 12195.12 1312
+204.611088 12195.12 1312
+204.626832 12195.12 1312
+204.642576 12195.12 1312
+204.658320 12195.12 1312
+204.674064 12195.12 1312
+204.689808 12195.12 1312
+204.705552 12195.12 1312
+204.721392 12121.21 1320
+204.737232 12121.21 1320
+204.753072 12121.21 1320
+204.768912 12121.21 1320
+204.784752 12121.21 1320
+204.800592 12121.21 1320
+204.816432 12121.21 1320
+204.832272 12121.21 1320
+204.848112 12121.21 1320
+204.863952 12121.21 1320
+204.879792 12121.21 1320
+204.895632 12121.21 1320
+204.911472 12121.21 1320
+204.927312 12121.21 1320
+204.943152 12121.21 1320
+204.958992 12121.21 1320
+204.974928 12048.19 1328
+204.990864 12048.19 1328
+205.006800 12048.19 1328
+205.022736 12048.19 1328
+205.038672 12048.19 1328
+205.054608 12048.19 1328
+205.070544 12048.19 1328
+205.086480 12048.19 1328
+205.102416 12048.19 1328
+205.118352 12048.19 1328
+205.134288 12048.19 1328
+205.150320 11976.05 1336
+205.165016 11976.05 1336
+205.179712 11976.05 1336
+205.194408 11976.05 1336
+205.209104 11976.05 1336
+205.223800 11976.05 1336
+205.238496 11976.05 1336
+205.253192 11976.05 1336
+205.267888 11976.05 1336
+205.282584 11976.05 1336
+205.297280 11976.05 1336
+205.311976 11976.05 1336
+205.326760 11904.76 1344
+205.341544 11904.76 1344
+205.356328 11904.76 1344
+205.371112 11904.76 1344
+205.385896 11904.76 1344
+205.400680 11904.76 1344
+205.415464 11904.76 1344
+205.430248 11904.76 1344
+205.445032 11904.76 1344
+205.459816 11904.76 1344
+205.474600 11904.76 1344
+205.489384 11904.76 1344
+205.504168 11904.76 1344
+205.518952 11904.76 1344
+205.533736 11904.76 1344
+205.548520 11904.76 1344
+205.563304 11904.76 1344
+205.578176 11834.32 1352
+205.593048 11834.32 1352
+205.607920 11834.32 1352
+205.622792 11834.32 1352
+205.637664 11834.32 1352
+205.652536 11834.32 1352
+205.667408 11834.32 1352
+205.682280 11834.32 1352
+205.697152 11834.32 1352
+205.712024 11834.32 1352
+205.726896 11834.32 1352
+205.741768 11834.32 1352
+205.756728 11764.71 1360
+205.771688 11764.71 1360
+205.786648 11764.71 1360
+205.801608 11764.71 1360
+205.816568 11764.71 1360
+205.831528 11764.71 1360
+205.846488 11764.71 1360
+205.861448 11764.71 1360
+205.876408 11764.71 1360
+205.891368 11764.71 1360
+205.906328 11764.71 1360
+205.921288 11764.71 1360
+205.936248 11764.71 1360
+205.951208 11764.71 1360
+205.966168 11764.71 1360
+205.981128 11764.71 1360
+205.996088 11764.71 1360
+206.011136 11695.91 1368
+206.026184 11695.91 1368
+206.041232 11695.91 1368
+206.056280 11695.91 1368
+206.071328 11695.91 1368
+206.086376 11695.91 1368
+206.101424 11695.91 1368
+206.116472 11695.91 1368
+206.131520 11695.91 1368
+206.146568 11695.91 1368
+206.161616 11695.91 1368
+206.176664 11695.91 1368
+206.191800 11627.91 1376
+206.206936 11627.91 1376
+206.222072 11627.91 1376
+206.237208 11627.91 1376
+206.252344 11627.91 1376
+206.267480 11627.91 1376
+206.282616 11627.91 1376
+206.297752 11627.91 1376
+206.312888 11627.91 1376
+206.328024 11627.91 1376
+206.343160 11627.91 1376
+206.358384 11560.69 1384
+206.373608 11560.69 1384
+206.388832 11560.69 1384
+206.404056 11560.69 1384
+206.419280 11560.69 1384
+206.434504 11560.69 1384
+206.449728 11560.69 1384
+206.464952 11560.69 1384
+206.480176 11560.69 1384
+206.495400 11560.69 1384
+206.510624 11560.69 1384
+206.525848 11560.69 1384
+206.541160 11494.25 1392
+206.556472 11494.25 1392
+206.571784 11494.25 1392
+206.587096 11494.25 1392
+206.602408 11494.25 1392
+206.617720 11494.25 1392
+206.633032 11494.25 1392
+206.648344 11494.25 1392
+206.663656 11494.25 1392
+206.678968 11494.25 1392
+206.694280 11494.25 1392
+206.709592 11494.25 1392
+206.724904 11494.25 1392
+206.740216 11494.25 1392
+206.755528 11494.25 1392
+206.770840 11494.25 1392
+206.786152 11494.25 1392
+206.801464 11494.25 1392
+206.816776 11494.25 1392
+206.832088 11494.25 1392
+206.847400 11494.25 1392
+206.862712 11494.25 1392
+206.878024 11494.25 1392
+206.893336 11494.25 1392
+206.908648 11494.25 1392
+206.923960 11494.25 1392
+206.939272 11494.25 1392
+206.954584 11494.25 1392
+206.969896 11494.25 1392
+206.985296 11428.57 1400
+207.000696 11428.57 1400
+207.016096 11428.57 1400
+207.031496 11428.57 1400
+207.046896 11428.57 1400
+207.062296 11428.57 1400
+207.077696 11428.57 1400
+207.093096 11428.57 1400
+207.108496 11428.57 1400
+207.123896 11428.57 1400
+207.139296 11428.57 1400
+207.154696 11428.57 1400
+207.170184 11363.64 1408
+207.185672 11363.64 1408
+207.201160 11363.64 1408
+207.216648 11363.64 1408
+207.232136 11363.64 1408
+207.247624 11363.64 1408
+207.263112 11363.64 1408
+207.278600 11363.64 1408
+207.294088 11363.64 1408
+207.309576 11363.64 1408
+207.325064 11363.64 1408
+207.340640 11299.44 1416
+207.356216 11299.44 1416
+207.371792 11299.44 1416
+207.387368 11299.44 1416
+207.402944 11299.44 1416
+207.418520 11299.44 1416
+207.434096 11299.44 1416
+207.449672 11299.44 1416
+207.465248 11299.44 1416
+207.480824 11299.44 1416
+207.496400 11299.44 1416
+207.511976 11299.44 1416
+207.527640 11235.96 1424
+207.543304 11235.96 1424
+207.558968 11235.96 1424
+207.574632 11235.96 1424
+207.590296 11235.96 1424
+207.605960 11235.96 1424
+207.621624 11235.96 1424
+207.637288 11235.96 1424
+207.652952 11235.96 1424
+207.668616 11235.96 1424
+207.684280 11235.96 1424
+207.699944 11235.96 1424
+207.715608 11235.96 1424
+207.731272 11235.96 1424
+207.746936 11235.96 1424
+207.762600 11235.96 1424
+207.778264 11235.96 1424
+207.793928 11235.96 1424
+207.809680 11173.18 1432
+207.825432 11173.18 1432
+207.841184 11173.18 1432
+207.856936 11173.18 1432
+207.872688 11173.18 1432
+207.888440 11173.18 1432
+207.904192 11173.18 1432
+207.919944 11173.18 1432
+207.935696 11173.18 1432
+207.951448 11173.18 1432
+207.967200 11173.18 1432
+207.983040 11111.11 1440
+207.998880 11111.11 1440
+208.014720 11111.11 1440
+208.030560 11111.11 1440
+208.046400 11111.11 1440
+208.062240 11111.11 1440
+208.078080 11111.11 1440
+208.093920 11111.11 1440
+208.109760 11111.11 1440
+208.125600 11111.11 1440
+208.141440 11111.11 1440
+208.157280 11111.11 1440
+208.173208 11049.72 1448
+208.189136 11049.72 1448
+208.205064 11049.72 1448
+208.220992 11049.72 1448
+208.236920 11049.72 1448
+208.252848 11049.72 1448
+208.268776 11049.72 1448
+208.284704 11049.72 1448
+208.300632 11049.72 1448
+208.316560 11049.72 1448
+208.332488 11049.72 1448
+208.348504 10989.01 1456
+208.363064 10989.01 1456
+208.377624 10989.01 1456
+208.392184 10989.01 1456
+208.406744 10989.01 1456
+208.421304 10989.01 1456
+208.435864 10989.01 1456
+208.450424 10989.01 1456
+208.464984 10989.01 1456
+208.479544 10989.01 1456
+208.494104 10989.01 1456
+208.508664 10989.01 1456
+208.523224 10989.01 1456
+208.537864 10928.96 1464
+208.552504 10928.96 1464
+208.567144 10928.96 1464
+208.581784 10928.96 1464
+208.596424 10928.96 1464
+208.611064 10928.96 1464
+208.625704 10928.96 1464
+208.640344 10928.96 1464
+208.654984 10928.96 1464
+208.669624 10928.96 1464
+208.684264 10928.96 1464
+208.698904 10928.96 1464
+208.713544 10928.96 1464
+208.728264 10869.57 1472
+208.742984 10869.57 1472
+208.757704 10869.57 1472
+208.772424 10869.57 1472
+208.787144 10869.57 1472
+208.801864 10869.57 1472
+208.816584 10869.57 1472
+208.831304 10869.57 1472
+208.846024 10869.57 1472
+208.860744 10869.57 1472
+208.875464 10869.57 1472
+208.890184 10869.57 1472
+208.904904 10869.57 1472
+208.919704 10810.81 1480
+208.934504 10810.81 1480
+208.949304 10810.81 1480
+208.964104 10810.81 1480
+208.978904 10810.81 1480
+208.993704 10810.81 1480
+209.008504 10810.81 1480
+209.023304 10810.81 1480
+209.038104 10810.81 1480
+209.052904 10810.81 1480
+209.067704 10810.81 1480
+209.082504 10810.81 1480
+209.097304 10810.81 1480
+209.112184 10752.69 1488
+209.127064 10752.69 1488
+209.141944 10752.69 1488
+209.156824 10752.69 1488
+209.171704 10752.69 1488
+209.186584 10752.69 1488
+209.201464 10752.69 1488
+209.216344 10752.69 1488
+209.231224 10752.69 1488
+209.246104 10752.69 1488
+209.260984 10752.69 1488
+209.275864 10752.69 1488
+209.290824 10695.19 1496
+209.305784 10695.19 1496
+209.320744 10695.19 1496
+209.335704 10695.19 1496
+209.350664 10695.19 1496
+209.365624 10695.19 1496
+209.380584 10695.19 1496
+209.395544 10695.19 1496
+209.410504 10695.19 1496
+209.425464 10695.19 1496
+209.440424 10695.19 1496
+209.455384 10695.19 1496
+209.470344 10695.19 1496
+209.485384 10638.30 1504
+209.500424 10638.30 1504
+209.515464 10638.30 1504
+209.530504 10638.30 1504
+209.545544 10638.30 1504
+209.560584 10638.30 1504
+209.575624 10638.30 1504
+209.590664 10638.30 1504
+209.605704 10638.30 1504
+209.620744 10638.30 1504
+209.635784 10638.30 1504
+209.650824 10638.30 1504
+209.665864 10638.30 1504
+209.680984 10582.01 1512
+209.696104 10582.01 1512
+209.711224 10582.01 1512
+209.726344 10582.01 1512
+209.741464 10582.01 1512
+209.756584 10582.01 1512
+209.771784 10526.32 1520
+209.786984 10526.32 1520
+209.802184 10526.32 1520
+209.817384 10526.32 1520
+209.832584 10526.32 1520
+209.847784 10526.32 1520
+209.862984 10526.32 1520
+209.878184 10526.32 1520
+209.893384 10526.32 1520
+209.908584 10526.32 1520
+209.923784 10526.32 1520
+209.938984 10526.32 1520
+209.954184 10526.32 1520
+209.969464 10471.20 1528
+209.984744 10471.20 1528
+210.000024 10471.20 1528
+210.015304 10471.20 1528
+210.030584 10471.20 1528
+210.045864 10471.20 1528
+210.061144 10471.20 1528
+210.076424 10471.20 1528
+210.091704 10471.20 1528
+210.106984 10471.20 1528
+210.122264 10471.20 1528
+210.137544 10471.20 1528
+210.152824 10471.20 1528
+210.168184 10416.67 1536
+210.183544 10416.67 1536
+210.198904 10416.67 1536
+210.214264 10416.67 1536
+210.229624 10416.67 1536
+210.244984 10416.67 1536
+210.260344 10416.67 1536
+210.275704 10416.67 1536
+210.291064 10416.67 1536
+210.306424 10416.67 1536
+210.321784 10416.67 1536
+210.337144 10416.67 1536
+210.352504 10416.67 1536
+210.367944 10362.69 1544
+210.383384 10362.69 1544
+210.398824 10362.69 1544
+210.414264 10362.69 1544
+210.429704 10362.69 1544
+210.445144 10362.69 1544
+210.460584 10362.69 1544
+210.476024 10362.69 1544
+210.491464 10362.69 1544
+210.506904 10362.69 1544
+210.522344 10362.69 1544
+210.537784 10362.69 1544
+210.553224 10362.69 1544
+210.568744 10309.28 1552
+210.584264 10309.28 1552
+210.599784 10309.28 1552
+210.615304 10309.28 1552
+210.630824 10309.28 1552
+210.646344 10309.28 1552
+210.661864 10309.28 1552
+210.677384 10309.28 1552
+210.692904 10309.28 1552
+210.708424 10309.28 1552
+210.723944 10309.28 1552
+210.739464 10309.28 1552
+210.755144 10204.08 1568
+210.770824 10204.08 1568
+210.786504 10204.08 1568
+210.802184 10204.08 1568
+210.817864 10204.08 1568
+210.833544 10204.08 1568
+210.849224 10204.08 1568
+210.864984 10152.28 1576
+210.880744 10152.28 1576
+210.896504 10152.28 1576
+210.912264 10152.28 1576
+210.928024 10152.28 1576
+210.943784 10152.28 1576
+210.959544 10152.28 1576
+210.975304 10152.28 1576
+210.991064 10152.28 1576
+211.006824 10152.28 1576
+211.022584 10152.28 1576
+211.038344 10152.28 1576
+211.054104 10152.28 1576
+211.069944 10101.01 1584
+211.085784 10101.01 1584
+211.101624 10101.01 1584
+211.117464 10101.01 1584
+211.133304 10101.01 1584
+211.149144 10101.01 1584
+211.164984 10101.01 1584
+211.180824 10101.01 1584
+211.196664 10101.01 1584
+211.212504 10101.01 1584
+211.228344 10101.01 1584
+211.244184 10101.01 1584
+211.260104 10050.25 1592
+211.276024 10050.25 1592
+211.291944 10050.25 1592
+211.307864 10050.25 1592
+211.323784 10050.25 1592
+211.339704 10050.25 1592
+211.355624 10050.25 1592
+211.371544 10050.25 1592
+211.387464 10050.25 1592
+211.403384 10050.25 1592
+211.419304 10050.25 1592
+211.435224 10050.25 1592
+211.451144 10050.25 1592
+211.467144 10000.00 1600
+211.483144 10000.00 1600
+211.499144 10000.00 1600
+211.515144 10000.00 1600
+211.531144 10000.00 1600
+211.547144 10000.00 1600
+211.563144 10000.00 1600
+211.579224 9950.25 1608
+211.593696 9950.25 1608
+211.608168 9950.25 1608
+211.622640 9950.25 1608
+211.637112 9950.25 1608
+211.651584 9950.25 1608
+211.666056 9950.25 1608
+211.680528 9950.25 1608
+211.695000 9950.25 1608
+211.709472 9950.25 1608
+211.723944 9950.25 1608
+211.738416 9950.25 1608
+211.752888 9950.25 1608
+211.767360 9950.25 1608
+211.781904 9900.99 1616
+211.796448 9900.99 1616
+211.810992 9900.99 1616
+211.825536 9900.99 1616
+211.840080 9900.99 1616
+211.854624 9900.99 1616
+211.869168 9900.99 1616
+211.883712 9900.99 1616
+211.898256 9900.99 1616
+211.912800 9900.99 1616
+211.927344 9900.99 1616
+211.941888 9900.99 1616
+211.956432 9900.99 1616
+211.970976 9900.99 1616
+211.985592 9852.22 1624
+212.000208 9852.22 1624
+212.014824 9852.22 1624
+212.029440 9852.22 1624
+212.044056 9852.22 1624
+212.058672 9852.22 1624
+212.073288 9852.22 1624
+212.087976 9803.92 1632
+212.102664 9803.92 1632
+212.117352 9803.92 1632
+212.132040 9803.92 1632
+212.146728 9803.92 1632
+212.161416 9803.92 1632
+212.176104 9803.92 1632
+212.190792 9803.92 1632
+212.205480 9803.92 1632
+212.220168 9803.92 1632
+212.234856 9803.92 1632
+212.249544 9803.92 1632
+212.264232 9803.92 1632
+212.278920 9803.92 1632
+212.293680 9756.10 1640
+212.308440 9756.10 1640
+212.323200 9756.10 1640
+212.337960 9756.10 1640
+212.352720 9756.10 1640
+212.367480 9756.10 1640
+212.382240 9756.10 1640
+212.397072 9708.74 1648
+212.411904 9708.74 1648
+212.426736 9708.74 1648
+212.441568 9708.74 1648
+212.456400 9708.74 1648
+212.471232 9708.74 1648
+212.486064 9708.74 1648
+212.500896 9708.74 1648
+212.515728 9708.74 1648
+212.530560 9708.74 1648
+212.545392 9708.74 1648
+212.560224 9708.74 1648
+212.575056 9708.74 1648
+212.589888 9708.74 1648
+212.604720 9708.74 1648
+212.619696 9615.38 1664
+212.634672 9615.38 1664
+212.649648 9615.38 1664
+212.664624 9615.38 1664
+212.679600 9615.38 1664
+212.694576 9615.38 1664
+212.709552 9615.38 1664
+212.724528 9615.38 1664
+212.739504 9615.38 1664
+212.754480 9615.38 1664
+212.769456 9615.38 1664
+212.784432 9615.38 1664
+212.799408 9615.38 1664
+212.814384 9615.38 1664
+212.829432 9569.38 1672
+212.844480 9569.38 1672
+212.859528 9569.38 1672
+212.874576 9569.38 1672
+212.889624 9569.38 1672
+212.904672 9569.38 1672
+212.919720 9569.38 1672
+212.934840 9523.81 1680
+212.949960 9523.81 1680
+212.965080 9523.81 1680
+212.980200 9523.81 1680
+212.995320 9523.81 1680
+213.010440 9523.81 1680
+213.025560 9523.81 1680
+213.040680 9523.81 1680
+213.055800 9523.81 1680
+213.070920 9523.81 1680
+213.086040 9523.81 1680
+213.101160 9523.81 1680
+213.116280 9523.81 1680
+213.131400 9523.81 1680
+213.146592 9478.67 1688
+213.161784 9478.67 1688
+213.176976 9478.67 1688
+213.192168 9478.67 1688
+213.207360 9478.67 1688
+213.222552 9478.67 1688
+213.237744 9478.67 1688
+213.253008 9433.96 1696
+213.268272 9433.96 1696
+213.283536 9433.96 1696
+213.298800 9433.96 1696
+213.314064 9433.96 1696
+213.329328 9433.96 1696
+213.344592 9433.96 1696
+213.359856 9433.96 1696
+213.375120 9433.96 1696
+213.390384 9433.96 1696
+213.405648 9433.96 1696
+213.420912 9433.96 1696
+213.436176 9433.96 1696
+213.451440 9433.96 1696
+213.466704 9433.96 1696
+213.482040 9389.67 1704
+213.497376 9389.67 1704
+213.512712 9389.67 1704
+213.528048 9389.67 1704
+213.543384 9389.67 1704
+213.558720 9389.67 1704
+213.574056 9389.67 1704
+213.589464 9345.79 1712
+213.604872 9345.79 1712
+213.620280 9345.79 1712
+213.635688 9345.79 1712
+213.651096 9345.79 1712
+213.666504 9345.79 1712
+213.681912 9345.79 1712
+213.697320 9345.79 1712
+213.712728 9345.79 1712
+213.728136 9345.79 1712
+213.743544 9345.79 1712
+213.758952 9345.79 1712
+213.774360 9345.79 1712
+213.789768 9345.79 1712
+213.805320 9259.26 1728
+213.820872 9259.26 1728
+213.836424 9259.26 1728
+213.851976 9259.26 1728
+213.867528 9259.26 1728
+213.883080 9259.26 1728
+213.898632 9259.26 1728
+213.914256 9216.59 1736
+213.929880 9216.59 1736
+213.945504 9216.59 1736
+213.961128 9216.59 1736
+213.976752 9216.59 1736
+213.992376 9216.59 1736
+214.008000 9216.59 1736
+214.023624 9216.59 1736
+214.039248 9216.59 1736
+214.054872 9216.59 1736
+214.070496 9216.59 1736
+214.086120 9216.59 1736
+214.101744 9216.59 1736
+214.117368 9216.59 1736
+214.133064 9174.31 1744
+214.148760 9174.31 1744
+214.164456 9174.31 1744
+214.180152 9174.31 1744
+214.195848 9174.31 1744
+214.211544 9174.31 1744
+214.227240 9174.31 1744
+214.243008 9132.42 1752
+214.258776 9132.42 1752
+214.274544 9132.42 1752
+214.290312 9132.42 1752
+214.306080 9132.42 1752
+214.321848 9132.42 1752
+214.337616 9132.42 1752
+214.353456 9090.91 1760
+214.369296 9090.91 1760
+214.385136 9090.91 1760
+214.400976 9090.91 1760
+214.416816 9090.91 1760
+214.432656 9090.91 1760
+214.448496 9090.91 1760
+214.464336 9090.91 1760
+214.480176 9090.91 1760
+214.496016 9090.91 1760
+214.511856 9090.91 1760
+214.527696 9090.91 1760
+214.543536 9090.91 1760
+214.559376 9090.91 1760
+214.575216 9090.91 1760
+214.591128 9049.77 1768
+214.607040 9049.77 1768
+214.622952 9049.77 1768
+214.638864 9049.77 1768
+214.654776 9049.77 1768
+214.670688 9049.77 1768
+214.686600 9049.77 1768
+214.702512 9049.77 1768
+214.718424 9049.77 1768
+214.734336 9049.77 1768
+214.750392 8968.61 1784
+214.764664 8968.61 1784
+214.778936 8968.61 1784
+214.793208 8968.61 1784
+214.807480 8968.61 1784
+214.821752 8968.61 1784
+214.836024 8968.61 1784
+214.850296 8968.61 1784
+214.864632 8928.57 1792
+214.878968 8928.57 1792
+214.893304 8928.57 1792
+214.907640 8928.57 1792
+214.921976 8928.57 1792
+214.936312 8928.57 1792
+214.950648 8928.57 1792
+214.964984 8928.57 1792
+214.979320 8928.57 1792
+214.993656 8928.57 1792
+215.007992 8928.57 1792
+215.022328 8928.57 1792
+215.036728 8888.89 1800
+215.051128 8888.89 1800
+215.065528 8888.89 1800
+215.079928 8888.89 1800
+215.094328 8888.89 1800
+215.108728 8888.89 1800
+215.123128 8888.89 1800
+215.137528 8888.89 1800
+215.151928 8888.89 1800
+215.166328 8888.89 1800
+215.180728 8888.89 1800
+215.195128 8888.89 1800
+215.209592 8849.56 1808
+215.224056 8849.56 1808
+215.238520 8849.56 1808
+215.252984 8849.56 1808
+215.267448 8849.56 1808
+215.281912 8849.56 1808
+215.296376 8849.56 1808
+215.310840 8849.56 1808
+215.325432 8771.93 1824
+215.340024 8771.93 1824
+215.354616 8771.93 1824
+215.369208 8771.93 1824
+215.383800 8771.93 1824
+215.398392 8771.93 1824
+215.412984 8771.93 1824
+215.427576 8771.93 1824
+215.442168 8771.93 1824
+215.456760 8771.93 1824
+215.471352 8771.93 1824
+215.485944 8771.93 1824
+215.500600 8733.62 1832
+215.515256 8733.62 1832
+215.529912 8733.62 1832
+215.544568 8733.62 1832
+215.559224 8733.62 1832
+215.573880 8733.62 1832
+215.588536 8733.62 1832
+215.603192 8733.62 1832
+215.617912 8695.65 1840
+215.632632 8695.65 1840
+215.647352 8695.65 1840
+215.662072 8695.65 1840
+215.676792 8695.65 1840
+215.691512 8695.65 1840
+215.706232 8695.65 1840
+215.720952 8695.65 1840
+215.735672 8695.65 1840
+215.750392 8695.65 1840
+215.765112 8695.65 1840
+215.779832 8695.65 1840
+215.794616 8658.01 1848
+215.809400 8658.01 1848
+215.824184 8658.01 1848
+215.838968 8658.01 1848
+215.853752 8658.01 1848
+215.868536 8658.01 1848
+215.883320 8658.01 1848
+215.898104 8658.01 1848
+215.912888 8658.01 1848
+215.927672 8658.01 1848
+215.942456 8658.01 1848
+215.957240 8658.01 1848
+215.972152 8583.69 1864
+215.987064 8583.69 1864
+216.001976 8583.69 1864
+216.016888 8583.69 1864
+216.031800 8583.69 1864
+216.046712 8583.69 1864
+216.061624 8583.69 1864
+216.076536 8583.69 1864
+216.091512 8547.01 1872
+216.106488 8547.01 1872
+216.121464 8547.01 1872
+216.136440 8547.01 1872
+216.151416 8547.01 1872
+216.166392 8547.01 1872
+216.181368 8547.01 1872
+216.196344 8547.01 1872
+216.211320 8547.01 1872
+216.226296 8547.01 1872
+216.241272 8547.01 1872
+216.256248 8547.01 1872
+216.271288 8510.64 1880
+216.286328 8510.64 1880
+216.301368 8510.64 1880
+216.316408 8510.64 1880
+216.331448 8510.64 1880
+216.346488 8510.64 1880
+216.361528 8510.64 1880
+216.376568 8510.64 1880
+216.391672 8474.58 1888
+216.406776 8474.58 1888
+216.421880 8474.58 1888
+216.436984 8474.58 1888
+216.452088 8474.58 1888
+216.467192 8474.58 1888
+216.482296 8474.58 1888
+216.497400 8474.58 1888
+216.512632 8403.36 1904
+216.527864 8403.36 1904
+216.543096 8403.36 1904
+216.558328 8403.36 1904
+216.573560 8403.36 1904
+216.588792 8403.36 1904
+216.604024 8403.36 1904
+216.619256 8403.36 1904
+216.634488 8403.36 1904
+216.649720 8403.36 1904
+216.664952 8403.36 1904
+216.680184 8403.36 1904
+216.695480 8368.20 1912
+216.710776 8368.20 1912
+216.726072 8368.20 1912
+216.741368 8368.20 1912
+216.756664 8368.20 1912
+216.771960 8368.20 1912
+216.787256 8368.20 1912
+216.802552 8368.20 1912
+216.817912 8333.33 1920
+216.833272 8333.33 1920
+216.848632 8333.33 1920
+216.863992 8333.33 1920
+216.879352 8333.33 1920
+216.894712 8333.33 1920
+216.910072 8333.33 1920
+216.925432 8333.33 1920
+216.940792 8333.33 1920
+216.956152 8333.33 1920
+216.971512 8333.33 1920
+216.986872 8333.33 1920
+217.002360 8264.46 1936
+217.017848 8264.46 1936
+217.033336 8264.46 1936
+217.048824 8264.46 1936
+217.064312 8264.46 1936
+217.079800 8264.46 1936
+217.095288 8264.46 1936
+217.110776 8264.46 1936
+217.126328 8230.45 1944
+217.141880 8230.45 1944
+217.157432 8230.45 1944
+217.172984 8230.45 1944
+217.188536 8230.45 1944
+217.204088 8230.45 1944
+217.219640 8230.45 1944
+217.235192 8230.45 1944
+217.250808 8196.72 1952
+217.266424 8196.72 1952
+217.282040 8196.72 1952
+217.297656 8196.72 1952
+217.313272 8196.72 1952
+217.328888 8196.72 1952
+217.344504 8196.72 1952
+217.360120 8196.72 1952
+217.375864 8130.08 1968
+217.391608 8130.08 1968
+217.407352 8130.08 1968
+217.423096 8130.08 1968
+217.438840 8130.08 1968
+217.454584 8130.08 1968
+217.470328 8130.08 1968
+217.486072 8130.08 1968
+217.501816 8130.08 1968
+217.517560 8130.08 1968
+217.533304 8130.08 1968
+217.549048 8130.08 1968
+217.564856 8097.17 1976
+217.580664 8097.17 1976
+217.596472 8097.17 1976
+217.612280 8097.17 1976
+217.628088 8097.17 1976
+217.643896 8097.17 1976
+217.659704 8097.17 1976
+217.675512 8097.17 1976
+217.691384 8064.52 1984
+217.707256 8064.52 1984
+217.723128 8064.52 1984
+217.739000 8064.52 1984
+217.754872 8064.52 1984
+217.770744 8064.52 1984
+217.786616 8064.52 1984
+217.802488 8064.52 1984
+217.818488 8000.00 2000
+217.834488 8000.00 2000
+217.850488 8000.00 2000
+217.866488 8000.00 2000
+217.882488 8000.00 2000
+217.898488 8000.00 2000
+217.914488 8000.00 2000
+217.930488 8000.00 2000
+217.946552 7968.13 2008
+217.960608 7968.13 2008
+217.974664 7968.13 2008
+217.988720 7968.13 2008
+218.002776 7968.13 2008
+218.016832 7968.13 2008
+218.030888 7968.13 2008
+218.044944 7968.13 2008
+218.059000 7968.13 2008
+218.073112 7936.51 2016
+218.087224 7936.51 2016
+218.101336 7936.51 2016
+218.115448 7936.51 2016
+218.129560 7936.51 2016
+218.143672 7936.51 2016
+218.157784 7936.51 2016
+218.171896 7936.51 2016
+218.186008 7936.51 2016
+218.200120 7936.51 2016
+218.214232 7936.51 2016
+218.228344 7936.51 2016
+218.242456 7936.51 2016
+218.256568 7936.51 2016
+218.270792 7874.02 2032
+218.285016 7874.02 2032
+218.299240 7874.02 2032
+218.313464 7874.02 2032
+218.327688 7874.02 2032
+218.341912 7874.02 2032
+218.356136 7874.02 2032
+218.370360 7874.02 2032
+218.384584 7874.02 2032
+218.398864 7843.14 2040
+218.413144 7843.14 2040
+218.427424 7843.14 2040
+218.441704 7843.14 2040
+218.455984 7843.14 2040
+218.470264 7843.14 2040
+218.484544 7843.14 2040
+218.498824 7843.14 2040
+218.513104 7843.14 2040
+218.527440 7812.50 2048
+218.541776 7812.50 2048
+218.556112 7812.50 2048
+218.570448 7812.50 2048
+218.584784 7812.50 2048
+218.599120 7812.50 2048
+218.613456 7812.50 2048
+218.627792 7812.50 2048
+218.642128 7812.50 2048
+218.656464 7812.50 2048
+218.670912 7751.94 2064
+218.685360 7751.94 2064
+218.699808 7751.94 2064
+218.714256 7751.94 2064
+218.728704 7751.94 2064
+218.743152 7751.94 2064
+218.757600 7751.94 2064
+218.772048 7751.94 2064
+218.786496 7751.94 2064
+218.800944 7751.94 2064
+218.815392 7751.94 2064
+218.829840 7751.94 2064
+218.844288 7751.94 2064
+218.858736 7751.94 2064
+218.873184 7751.94 2064
+218.887632 7751.94 2064
+218.902080 7751.94 2064
+218.916528 7751.94 2064
+218.931088 7692.31 2080
+218.945648 7692.31 2080
+218.960208 7692.31 2080
+218.974768 7692.31 2080
+218.989328 7692.31 2080
+219.003888 7692.31 2080
+219.018448 7692.31 2080
+219.033008 7692.31 2080
+219.047568 7692.31 2080
+219.062240 7633.59 2096
+219.076912 7633.59 2096
+219.091584 7633.59 2096
+219.106256 7633.59 2096
+219.120928 7633.59 2096
+219.135600 7633.59 2096
+219.150272 7633.59 2096
+219.164944 7633.59 2096
+219.179616 7633.59 2096
+219.194400 7575.76 2112
+219.209184 7575.76 2112
+219.223968 7575.76 2112
+219.238752 7575.76 2112
+219.253536 7575.76 2112
+219.268320 7575.76 2112
+219.283104 7575.76 2112
+219.297888 7575.76 2112
+219.312672 7575.76 2112
+219.327456 7575.76 2112
+219.342240 7575.76 2112
+219.357024 7575.76 2112
+219.371808 7575.76 2112
+219.386592 7575.76 2112
+219.401376 7575.76 2112
+219.416160 7575.76 2112
+219.430944 7575.76 2112
+219.445728 7575.76 2112
+219.460624 7518.80 2128
+219.475520 7518.80 2128
+219.490416 7518.80 2128
+219.505312 7518.80 2128
+219.520208 7518.80 2128
+219.535104 7518.80 2128
+219.550000 7518.80 2128
+219.564896 7518.80 2128
+219.579792 7518.80 2128
+219.594688 7518.80 2128
+219.609696 7462.69 2144
+219.624704 7462.69 2144
+219.639712 7462.69 2144
+219.654720 7462.69 2144
+219.669840 7407.41 2160
+219.684960 7407.41 2160
+219.700080 7407.41 2160
+219.715200 7407.41 2160
+219.730320 7407.41 2160
+219.745440 7407.41 2160
+219.760560 7407.41 2160
+219.775680 7407.41 2160
+219.790800 7407.41 2160
+219.805920 7407.41 2160
+219.821040 7407.41 2160
+219.836160 7407.41 2160
+219.851280 7407.41 2160
+219.866400 7407.41 2160
+219.881520 7407.41 2160
+219.896640 7407.41 2160
+219.911760 7407.41 2160
+219.926880 7407.41 2160
+219.942112 7352.94 2176
+219.957344 7352.94 2176
+219.972576 7352.94 2176
+219.987808 7352.94 2176
+220.003040 7352.94 2176
+220.018272 7352.94 2176
+220.033504 7352.94 2176
+220.048736 7352.94 2176
+220.063968 7352.94 2176
+220.079200 7352.94 2176
+220.094544 7299.27 2192
+220.109888 7299.27 2192
+220.125232 7299.27 2192
+220.140576 7299.27 2192
+220.155920 7299.27 2192
+220.171264 7299.27 2192
+220.186608 7299.27 2192
+220.201952 7299.27 2192
+220.217296 7299.27 2192
+220.232640 7299.27 2192
+220.247984 7299.27 2192
+220.263328 7299.27 2192
+220.278672 7299.27 2192
+220.294016 7299.27 2192
+220.309360 7299.27 2192
+220.324704 7299.27 2192
+220.340048 7299.27 2192
+220.355392 7299.27 2192
+220.370848 7246.38 2208
+220.386304 7246.38 2208
+220.401760 7246.38 2208
+220.417216 7246.38 2208
+220.432784 7194.24 2224
+220.448352 7194.24 2224
+220.463920 7194.24 2224
+220.479488 7194.24 2224
+220.495056 7194.24 2224
+220.510624 7194.24 2224
+220.526192 7194.24 2224
+220.541760 7194.24 2224
+220.557328 7194.24 2224
+220.572896 7194.24 2224
+220.588576 7142.86 2240
+220.604256 7142.86 2240
+220.619936 7142.86 2240
+220.635616 7142.86 2240
+220.651296 7142.86 2240
+220.666976 7142.86 2240
+220.682656 7142.86 2240
+220.698336 7142.86 2240
+220.714016 7142.86 2240
+220.729696 7142.86 2240
+220.745376 7142.86 2240
+220.761056 7142.86 2240
+220.776736 7142.86 2240
+220.792416 7142.86 2240
+220.808096 7142.86 2240
+220.823776 7142.86 2240
+220.839456 7142.86 2240
+220.855136 7142.86 2240
+220.870928 7092.20 2256
+220.886720 7092.20 2256
+220.902512 7092.20 2256
+220.918304 7092.20 2256
+220.934208 7042.25 2272
+220.950112 7042.25 2272
+220.966016 7042.25 2272
+220.981920 7042.25 2272
+220.997824 7042.25 2272
+221.013728 7042.25 2272
+221.029632 7042.25 2272
+221.045536 7042.25 2272
+221.061440 7042.25 2272
+221.077344 7042.25 2272
+221.093360 6993.01 2288
+221.107088 6993.01 2288
+221.120816 6993.01 2288
+221.134544 6993.01 2288
+221.148272 6993.01 2288
+221.162000 6993.01 2288
+221.175728 6993.01 2288
+221.189456 6993.01 2288
+221.203184 6993.01 2288
+221.216912 6993.01 2288
+221.230736 6944.44 2304
+221.244560 6944.44 2304
+221.258384 6944.44 2304
+221.272208 6944.44 2304
+221.286032 6944.44 2304
+221.299856 6944.44 2304
+221.313680 6944.44 2304
+221.327504 6944.44 2304
+221.341328 6944.44 2304
+221.355152 6944.44 2304
+221.368976 6944.44 2304
+221.382800 6944.44 2304
+221.396624 6944.44 2304
+221.410448 6944.44 2304
+221.424272 6944.44 2304
+221.438096 6944.44 2304
+221.452016 6896.55 2320
+221.465936 6896.55 2320
+221.479856 6896.55 2320
+221.493776 6896.55 2320
+221.507696 6896.55 2320
+221.521712 6849.32 2336
+221.535728 6849.32 2336
+221.549744 6849.32 2336
+221.563760 6849.32 2336
+221.577776 6849.32 2336
+221.591792 6849.32 2336
+221.605808 6849.32 2336
+221.619824 6849.32 2336
+221.633840 6849.32 2336
+221.647856 6849.32 2336
+221.661872 6849.32 2336
+221.675984 6802.72 2352
+221.690096 6802.72 2352
+221.704208 6802.72 2352
+221.718320 6802.72 2352
+221.732432 6802.72 2352
+221.746544 6802.72 2352
+221.760656 6802.72 2352
+221.774768 6802.72 2352
+221.788880 6802.72 2352
+221.802992 6802.72 2352
+221.817104 6802.72 2352
+221.831216 6802.72 2352
+221.845328 6802.72 2352
+221.859440 6802.72 2352
+221.873552 6802.72 2352
+221.887664 6802.72 2352
+221.901872 6756.76 2368
+221.916080 6756.76 2368
+221.930288 6756.76 2368
+221.944496 6756.76 2368
+221.958704 6756.76 2368
+221.972912 6756.76 2368
+221.987120 6756.76 2368
+222.001328 6756.76 2368
+222.015536 6756.76 2368
+222.029744 6756.76 2368
+222.043952 6756.76 2368
+222.058256 6711.41 2384
+222.072560 6711.41 2384
+222.086864 6711.41 2384
+222.101168 6711.41 2384
+222.115472 6711.41 2384
+222.129872 6666.67 2400
+222.144272 6666.67 2400
+222.158672 6666.67 2400
+222.173072 6666.67 2400
+222.187472 6666.67 2400
+222.201872 6666.67 2400
+222.216272 6666.67 2400
+222.230672 6666.67 2400
+222.245072 6666.67 2400
+222.259472 6666.67 2400
+222.273872 6666.67 2400
+222.288368 6622.52 2416
+222.302864 6622.52 2416
+222.317360 6622.52 2416
+222.331856 6622.52 2416
+222.346352 6622.52 2416
+222.360944 6578.95 2432
+222.375536 6578.95 2432
+222.390128 6578.95 2432
+222.404720 6578.95 2432
+222.419312 6578.95 2432
+222.433904 6578.95 2432
+222.448496 6578.95 2432
+222.463088 6578.95 2432
+222.477680 6578.95 2432
+222.492272 6578.95 2432
+222.506864 6578.95 2432
+222.521456 6578.95 2432
+222.536048 6578.95 2432
+222.550640 6578.95 2432
+222.565232 6578.95 2432
+222.579824 6578.95 2432
+222.594512 6535.95 2448
+222.609200 6535.95 2448
+222.623888 6535.95 2448
+222.638576 6535.95 2448
+222.653264 6535.95 2448
+222.667952 6535.95 2448
+222.682640 6535.95 2448
+222.697328 6535.95 2448
+222.712016 6535.95 2448
+222.726704 6535.95 2448
+222.741392 6535.95 2448
+222.756176 6493.51 2464
+222.770960 6493.51 2464
+222.785744 6493.51 2464
+222.800528 6493.51 2464
+222.815312 6493.51 2464
+222.830192 6451.61 2480
+222.845072 6451.61 2480
+222.859952 6451.61 2480
+222.874832 6451.61 2480
+222.889712 6451.61 2480
+222.904688 6410.26 2496
+222.919664 6410.26 2496
+222.934640 6410.26 2496
+222.949616 6410.26 2496
+222.964592 6410.26 2496
+222.979568 6410.26 2496
+222.994544 6410.26 2496
+223.009520 6410.26 2496
+223.024496 6410.26 2496
+223.039472 6410.26 2496
+223.054448 6410.26 2496
+223.069520 6369.43 2512
+223.084592 6369.43 2512
+223.099664 6369.43 2512
+223.114736 6369.43 2512
+223.129808 6369.43 2512
+223.144880 6369.43 2512
+223.159952 6369.43 2512
+223.175024 6369.43 2512
+223.190096 6369.43 2512
+223.205168 6369.43 2512
+223.220240 6369.43 2512
+223.235312 6369.43 2512
+223.250384 6369.43 2512
+223.265552 6329.11 2528
+223.280720 6329.11 2528
+223.295888 6329.11 2528
+223.311056 6329.11 2528
+223.326224 6329.11 2528
+223.341392 6329.11 2528
+223.356560 6329.11 2528
+223.371728 6329.11 2528
+223.386992 6289.31 2544
+223.402256 6289.31 2544
+223.417520 6289.31 2544
+223.432784 6289.31 2544
+223.448048 6289.31 2544
+223.463312 6289.31 2544
+223.478576 6289.31 2544
+223.493840 6289.31 2544
+223.509200 6250.00 2560
+223.524560 6250.00 2560
+223.539920 6250.00 2560
+223.555280 6250.00 2560
+223.570640 6250.00 2560
+223.586000 6250.00 2560
+223.601456 6211.18 2576
+223.616912 6211.18 2576
+223.632368 6211.18 2576
+223.647824 6211.18 2576
+223.663280 6211.18 2576
+223.678736 6211.18 2576
+223.694192 6211.18 2576
+223.709648 6211.18 2576
+223.725200 6172.84 2592
+223.740752 6172.84 2592
+223.756304 6172.84 2592
+223.771856 6172.84 2592
+223.787408 6172.84 2592
+223.803056 6134.97 2608
+223.818704 6134.97 2608
+223.834352 6134.97 2608
+223.850000 6134.97 2608
+223.865648 6134.97 2608
+223.881296 6134.97 2608
+223.896944 6134.97 2608
+223.912592 6134.97 2608
+223.928240 6134.97 2608
+223.943888 6134.97 2608
+223.959536 6134.97 2608
+223.975184 6134.97 2608
+223.990832 6134.97 2608
+224.006480 6134.97 2608
+224.022128 6134.97 2608
+224.037776 6134.97 2608
+224.053520 6097.56 2624
+224.069264 6097.56 2624
+224.085008 6097.56 2624
+224.100752 6097.56 2624
+224.116496 6097.56 2624
+224.132336 6060.61 2640
+224.148176 6060.61 2640
+224.164016 6060.61 2640
+224.179856 6060.61 2640
+224.195696 6060.61 2640
+224.211536 6060.61 2640
+224.227376 6060.61 2640
+224.243216 6060.61 2640
+224.259152 6024.10 2656
+224.275088 6024.10 2656
+224.291024 6024.10 2656
+224.306960 6024.10 2656
+224.322896 6024.10 2656
+224.338832 6024.10 2656
+224.354864 5988.02 2672
+224.368224 5988.02 2672
+224.381584 5988.02 2672
+224.394944 5988.02 2672
+224.408304 5988.02 2672
+224.421664 5988.02 2672
+224.435104 5952.38 2688
+224.448544 5952.38 2688
+224.461984 5952.38 2688
+224.475424 5952.38 2688
+224.488864 5952.38 2688
+224.502304 5952.38 2688
+224.515744 5952.38 2688
+224.529184 5952.38 2688
+224.542624 5952.38 2688
+224.556064 5952.38 2688
+224.569584 5917.16 2704
+224.583104 5917.16 2704
+224.596624 5917.16 2704
+224.610144 5917.16 2704
+224.623664 5917.16 2704
+224.637184 5917.16 2704
+224.650784 5882.35 2720
+224.664384 5882.35 2720
+224.677984 5882.35 2720
+224.691584 5882.35 2720
+224.705184 5882.35 2720
+224.718784 5882.35 2720
+224.732384 5882.35 2720
+224.745984 5882.35 2720
+224.759584 5882.35 2720
+224.773184 5882.35 2720
+224.786864 5847.95 2736
+224.800544 5847.95 2736
+224.814224 5847.95 2736
+224.827904 5847.95 2736
+224.841584 5847.95 2736
+224.855264 5847.95 2736
+224.869024 5813.95 2752
+224.882784 5813.95 2752
+224.896544 5813.95 2752
+224.910304 5813.95 2752
+224.924064 5813.95 2752
+224.937824 5813.95 2752
+224.951664 5780.35 2768
+224.965504 5780.35 2768
+224.979344 5780.35 2768
+224.993184 5780.35 2768
+225.007024 5780.35 2768
+225.020864 5780.35 2768
+225.034704 5780.35 2768
+225.048624 5747.13 2784
+225.062544 5747.13 2784
+225.076464 5747.13 2784
+225.090384 5747.13 2784
+225.104304 5747.13 2784
+225.118224 5747.13 2784
+225.132144 5747.13 2784
+225.146064 5747.13 2784
+225.159984 5747.13 2784
+225.173904 5747.13 2784
+225.187824 5747.13 2784
+225.201744 5747.13 2784
+225.215664 5747.13 2784
+225.229584 5747.13 2784
+225.243504 5747.13 2784
+225.257424 5747.13 2784
+225.271424 5714.29 2800
+225.285424 5714.29 2800
+225.299424 5714.29 2800
+225.313424 5714.29 2800
+225.327424 5714.29 2800
+225.341424 5714.29 2800
+225.355504 5681.82 2816
+225.369584 5681.82 2816
+225.383664 5681.82 2816
+225.397744 5681.82 2816
+225.411824 5681.82 2816
+225.425904 5681.82 2816
+225.439984 5681.82 2816
+225.454144 5649.72 2832
+225.468304 5649.72 2832
+225.482464 5649.72 2832
+225.496624 5649.72 2832
+225.510784 5649.72 2832
+225.524944 5649.72 2832
+225.539184 5617.98 2848
+225.553424 5617.98 2848
+225.567664 5617.98 2848
+225.581904 5617.98 2848
+225.596144 5617.98 2848
+225.610384 5617.98 2848
+225.624624 5617.98 2848
+225.638864 5617.98 2848
+225.653104 5617.98 2848
+225.667344 5617.98 2848
+225.681664 5586.59 2864
+225.695984 5586.59 2864
+225.710304 5586.59 2864
+225.724624 5586.59 2864
+225.738944 5586.59 2864
+225.753264 5586.59 2864
+225.767664 5555.56 2880
+225.782064 5555.56 2880
+225.796464 5555.56 2880
+225.810864 5555.56 2880
+225.825264 5555.56 2880
+225.839664 5555.56 2880
+225.854144 5524.86 2896
+225.868624 5524.86 2896
+225.883104 5524.86 2896
+225.897584 5524.86 2896
+225.912064 5524.86 2896
+225.926544 5524.86 2896
+225.941024 5524.86 2896
+225.955584 5494.51 2912
+225.970144 5494.51 2912
+225.984704 5494.51 2912
+225.999264 5494.51 2912
+226.013824 5494.51 2912
+226.028384 5494.51 2912
+226.043024 5464.48 2928
+226.057664 5464.48 2928
+226.072304 5464.48 2928
+226.086944 5464.48 2928
+226.101584 5464.48 2928
+226.116224 5464.48 2928
+226.130864 5464.48 2928
+226.145584 5434.78 2944
+226.160304 5434.78 2944
+226.175024 5434.78 2944
+226.189744 5434.78 2944
+226.204464 5434.78 2944
+226.219184 5434.78 2944
+226.233984 5405.41 2960
+226.248784 5405.41 2960
+226.263584 5405.41 2960
+226.278384 5405.41 2960
+226.293184 5405.41 2960
+226.307984 5405.41 2960
+226.322864 5376.34 2976
+226.337744 5376.34 2976
+226.352624 5376.34 2976
+226.367504 5376.34 2976
+226.382384 5376.34 2976
+226.397264 5376.34 2976
+226.412144 5376.34 2976
+226.427104 5347.59 2992
+226.442064 5347.59 2992
+226.457024 5347.59 2992
+226.471984 5347.59 2992
+226.486944 5347.59 2992
+226.501904 5347.59 2992
+226.516944 5319.15 3008
+226.531984 5319.15 3008
+226.547024 5319.15 3008
+226.562064 5319.15 3008
+226.577104 5319.15 3008
+226.592144 5319.15 3008
+226.607184 5319.15 3008
+226.622304 5291.01 3024
+226.637424 5291.01 3024
+226.652544 5291.01 3024
+226.667744 5263.16 3040
+226.682944 5263.16 3040
+226.698144 5263.16 3040
+226.713344 5263.16 3040
+226.728544 5263.16 3040
+226.743744 5263.16 3040
+226.759024 5235.60 3056
+226.774304 5235.60 3056
+226.789584 5235.60 3056
+226.804864 5235.60 3056
+226.820144 5235.60 3056
+226.835424 5235.60 3056
+226.850704 5235.60 3056
+226.866064 5208.33 3072
+226.881424 5208.33 3072
+226.896784 5208.33 3072
+226.912144 5208.33 3072
+226.927504 5208.33 3072
+226.942864 5208.33 3072
+226.958304 5181.35 3088
+226.973744 5181.35 3088
+226.989184 5181.35 3088
+227.004624 5181.35 3088
+227.020064 5181.35 3088
+227.035504 5181.35 3088
+227.051024 5154.64 3104
+227.066544 5154.64 3104
+227.082064 5154.64 3104
+227.097584 5154.64 3104
+227.113104 5154.64 3104
+227.128624 5154.64 3104
+227.144144 5154.64 3104
+227.159824 5102.04 3136
+227.175504 5102.04 3136
+227.191184 5102.04 3136
+227.206944 5076.14 3152
+227.222704 5076.14 3152
+227.238464 5076.14 3152
+227.254224 5076.14 3152
+227.269984 5076.14 3152
+227.285744 5076.14 3152
+227.301584 5050.51 3168
+227.317424 5050.51 3168
+227.333264 5050.51 3168
+227.349104 5050.51 3168
+227.364944 5050.51 3168
+227.380784 5050.51 3168
+227.396624 5050.51 3168
+227.412544 5025.13 3184
+227.428464 5025.13 3184
+227.444384 5025.13 3184
+227.460304 5025.13 3184
+227.476224 5025.13 3184
+227.492144 5025.13 3184
+227.508144 5000.00 3200
+227.524144 5000.00 3200
+227.540144 5000.00 3200
+227.556224 4975.12 3216
+227.569088 4975.12 3216
+227.581952 4975.12 3216
+227.594816 4975.12 3216
+227.607680 4975.12 3216
+227.620544 4975.12 3216
+227.633408 4975.12 3216
+227.646272 4975.12 3216
+227.659200 4950.50 3232
+227.672128 4950.50 3232
+227.685056 4950.50 3232
+227.697984 4950.50 3232
+227.710912 4950.50 3232
+227.723840 4950.50 3232
+227.736768 4950.50 3232
+227.749696 4950.50 3232
+227.762688 4926.11 3248
+227.775680 4926.11 3248
+227.788672 4926.11 3248
+227.801664 4926.11 3248
+227.814720 4901.96 3264
+227.827776 4901.96 3264
+227.840832 4901.96 3264
+227.853888 4901.96 3264
+227.866944 4901.96 3264
+227.880000 4901.96 3264
+227.893056 4901.96 3264
+227.906112 4901.96 3264
+227.919232 4878.05 3280
+227.932352 4878.05 3280
+227.945472 4878.05 3280
+227.958592 4878.05 3280
+227.971776 4854.37 3296
+227.984960 4854.37 3296
+227.998144 4854.37 3296
+228.011328 4854.37 3296
+228.024512 4854.37 3296
+228.037696 4854.37 3296
+228.050880 4854.37 3296
+228.064064 4854.37 3296
+228.077376 4807.69 3328
+228.090688 4807.69 3328
+228.104000 4807.69 3328
+228.117312 4807.69 3328
+228.130624 4807.69 3328
+228.143936 4807.69 3328
+228.157248 4807.69 3328
+228.170560 4807.69 3328
+228.183936 4784.69 3344
+228.197312 4784.69 3344
+228.210688 4784.69 3344
+228.224064 4784.69 3344
+228.237504 4761.90 3360
+228.250944 4761.90 3360
+228.264384 4761.90 3360
+228.277824 4761.90 3360
+228.291264 4761.90 3360
+228.304704 4761.90 3360
+228.318144 4761.90 3360
+228.331584 4761.90 3360
+228.345088 4739.34 3376
+228.358592 4739.34 3376
+228.372096 4739.34 3376
+228.385600 4739.34 3376
+228.399168 4716.98 3392
+228.412736 4716.98 3392
+228.426304 4716.98 3392
+228.439872 4716.98 3392
+228.453440 4716.98 3392
+228.467008 4716.98 3392
+228.480576 4716.98 3392
+228.494144 4716.98 3392
+228.507776 4694.84 3408
+228.521408 4694.84 3408
+228.535040 4694.84 3408
+228.548672 4694.84 3408
+228.562368 4672.90 3424
+228.576064 4672.90 3424
+228.589760 4672.90 3424
+228.603456 4672.90 3424
+228.617152 4672.90 3424
+228.630848 4672.90 3424
+228.644544 4672.90 3424
+228.658240 4672.90 3424
+228.672064 4629.63 3456
+228.685888 4629.63 3456
+228.699712 4629.63 3456
+228.713536 4629.63 3456
+228.727424 4608.29 3472
+228.741312 4608.29 3472
+228.755200 4608.29 3472
+228.769088 4608.29 3472
+228.782976 4608.29 3472
+228.796864 4608.29 3472
+228.810752 4608.29 3472
+228.824640 4608.29 3472
+228.838592 4587.16 3488
+228.852544 4587.16 3488
+228.866496 4587.16 3488
+228.880448 4587.16 3488
+228.894464 4566.21 3504
+228.908480 4566.21 3504
+228.922496 4566.21 3504
+228.936512 4566.21 3504
+228.950592 4545.45 3520
+228.964672 4545.45 3520
+228.978752 4545.45 3520
+228.992832 4545.45 3520
+229.006912 4545.45 3520
+229.020992 4545.45 3520
+229.035072 4545.45 3520
+229.049152 4545.45 3520
+229.063296 4524.89 3536
+229.077440 4524.89 3536
+229.091584 4524.89 3536
+229.105728 4524.89 3536
+229.119872 4524.89 3536
+229.134016 4524.89 3536
+229.148288 4484.30 3568
+229.162560 4484.30 3568
+229.176832 4484.30 3568
+229.191104 4484.30 3568
+229.205440 4464.29 3584
+229.219776 4464.29 3584
+229.234112 4464.29 3584
+229.248448 4464.29 3584
+229.262784 4464.29 3584
+229.277120 4464.29 3584
+229.291520 4444.44 3600
+229.305920 4444.44 3600
+229.320320 4444.44 3600
+229.334720 4444.44 3600
+229.349120 4444.44 3600
+229.363520 4444.44 3600
+229.377984 4424.78 3616
+229.392448 4424.78 3616
+229.406912 4424.78 3616
+229.421376 4424.78 3616
+229.435968 4385.96 3648
+229.450560 4385.96 3648
+229.465152 4385.96 3648
+229.479744 4385.96 3648
+229.494336 4385.96 3648
+229.508928 4385.96 3648
+229.523584 4366.81 3664
+229.538240 4366.81 3664
+229.552896 4366.81 3664
+229.567552 4366.81 3664
+229.582272 4347.83 3680
+229.596992 4347.83 3680
+229.611712 4347.83 3680
+229.626432 4347.83 3680
+229.641152 4347.83 3680
+229.655872 4347.83 3680
+229.670656 4329.00 3696
+229.685440 4329.00 3696
+229.700224 4329.00 3696
+229.715008 4329.00 3696
+229.729792 4329.00 3696
+229.744576 4329.00 3696
+229.759488 4291.85 3728
+229.774400 4291.85 3728
+229.789312 4291.85 3728
+229.804224 4291.85 3728
+229.819200 4273.50 3744
+229.834176 4273.50 3744
+229.849152 4273.50 3744
+229.864128 4273.50 3744
+229.879104 4273.50 3744
+229.894080 4273.50 3744
+229.909120 4255.32 3760
+229.924160 4255.32 3760
+229.939200 4255.32 3760
+229.954240 4255.32 3760
+229.969344 4237.29 3776
+229.984448 4237.29 3776
+229.999552 4237.29 3776
+230.014656 4237.29 3776
+230.029888 4201.68 3808
+230.045120 4201.68 3808
+230.060352 4201.68 3808
+230.075584 4201.68 3808
+230.090816 4201.68 3808
+230.106048 4201.68 3808
+230.121344 4184.10 3824
+230.136640 4184.10 3824
+230.151936 4184.10 3824
+230.167232 4184.10 3824
+230.182592 4166.67 3840
+230.197952 4166.67 3840
+230.213312 4166.67 3840
+230.228672 4166.67 3840
+230.244032 4166.67 3840
+230.259392 4166.67 3840
+230.274880 4132.23 3872
+230.290368 4132.23 3872
+230.305856 4132.23 3872
+230.321344 4132.23 3872
+230.336896 4115.23 3888
+230.352448 4115.23 3888
+230.368000 4115.23 3888
+230.383552 4115.23 3888
+230.399168 4098.36 3904
+230.414784 4098.36 3904
+230.430400 4098.36 3904
+230.446016 4098.36 3904
+230.461760 4065.04 3936
+230.477504 4065.04 3936
+230.493248 4065.04 3936
+230.508992 4065.04 3936
+230.524736 4065.04 3936
+230.540480 4065.04 3936
+230.556288 4048.58 3952
+230.572096 4048.58 3952
+230.587904 4048.58 3952
+230.603712 4048.58 3952
+230.619584 4032.26 3968
+230.635456 4032.26 3968
+230.651328 4032.26 3968
+230.667200 4032.26 3968
+230.683200 4000.00 4000
+230.699200 4000.00 4000
+230.715200 4000.00 4000
+230.731200 4000.00 4000
+230.747264 3984.06 4016
+230.759312 3984.06 4016
+230.771360 3984.06 4016
+230.783408 3984.06 4016
+230.795456 3984.06 4016
+230.807504 3984.06 4016
+230.819600 3968.25 4032
+230.831696 3968.25 4032
+230.843792 3968.25 4032
+230.855888 3968.25 4032
+230.867984 3968.25 4032
+230.880080 3968.25 4032
+230.892176 3968.25 4032
+230.904272 3968.25 4032
+230.916464 3937.01 4064
+230.928656 3937.01 4064
+230.940848 3937.01 4064
+230.953040 3937.01 4064
+230.965232 3937.01 4064
+230.977472 3921.57 4080
+230.989712 3921.57 4080
+231.001952 3921.57 4080
+231.014192 3921.57 4080
+231.026432 3921.57 4080
+231.038720 3906.25 4096
+231.051008 3906.25 4096
+231.063296 3906.25 4096
+231.075584 3906.25 4096
+231.087872 3906.25 4096
+231.100160 3906.25 4096
+231.112544 3875.97 4128
+231.124928 3875.97 4128
+231.137312 3875.97 4128
+231.149696 3875.97 4128
+231.162080 3875.97 4128
+231.174464 3875.97 4128
+231.186848 3875.97 4128
+231.199232 3875.97 4128
+231.211616 3875.97 4128
+231.224000 3875.97 4128
+231.236480 3846.15 4160
+231.248960 3846.15 4160
+231.261440 3846.15 4160
+231.273920 3846.15 4160
+231.286400 3846.15 4160
+231.298880 3846.15 4160
+231.311456 3816.79 4192
+231.324032 3816.79 4192
+231.336608 3816.79 4192
+231.349184 3816.79 4192
+231.361760 3816.79 4192
+231.374432 3787.88 4224
+231.387104 3787.88 4224
+231.399776 3787.88 4224
+231.412448 3787.88 4224
+231.425120 3787.88 4224
+231.437792 3787.88 4224
+231.450464 3787.88 4224
+231.463136 3787.88 4224
+231.475808 3787.88 4224
+231.488480 3787.88 4224
+231.501152 3787.88 4224
+231.513920 3759.40 4256
+231.526688 3759.40 4256
+231.539456 3759.40 4256
+231.552224 3759.40 4256
+231.564992 3759.40 4256
+231.577856 3731.34 4288
+231.590720 3731.34 4288
+231.603584 3731.34 4288
+231.616544 3703.70 4320
+231.629504 3703.70 4320
+231.642464 3703.70 4320
+231.655424 3703.70 4320
+231.668384 3703.70 4320
+231.681344 3703.70 4320
+231.694304 3703.70 4320
+231.707264 3703.70 4320
+231.720224 3703.70 4320
+231.733184 3703.70 4320
+231.746240 3676.47 4352
+231.759296 3676.47 4352
+231.772352 3676.47 4352
+231.785408 3676.47 4352
+231.798464 3676.47 4352
+231.811520 3676.47 4352
+231.824672 3649.64 4384
+231.837824 3649.64 4384
+231.850976 3649.64 4384
+231.864128 3649.64 4384
+231.877280 3649.64 4384
+231.890432 3649.64 4384
+231.903584 3649.64 4384
+231.916736 3649.64 4384
+231.929888 3649.64 4384
+231.943040 3649.64 4384
+231.956288 3623.19 4416
+231.969536 3623.19 4416
+231.982784 3623.19 4416
+231.996128 3597.12 4448
+232.009472 3597.12 4448
+232.022816 3597.12 4448
+232.036160 3597.12 4448
+232.049504 3597.12 4448
+232.062944 3571.43 4480
+232.076384 3571.43 4480
+232.089824 3571.43 4480
+232.103264 3571.43 4480
+232.116704 3571.43 4480
+232.130144 3571.43 4480
+232.143584 3571.43 4480
+232.157024 3571.43 4480
+232.170464 3571.43 4480
+232.183904 3571.43 4480
+232.197344 3571.43 4480
+232.210880 3546.10 4512
+232.224416 3546.10 4512
+232.237952 3546.10 4512
+232.251584 3521.13 4544
+232.265216 3521.13 4544
+232.278848 3521.13 4544
+232.292480 3521.13 4544
+232.306112 3521.13 4544
+232.319840 3496.50 4576
+232.333568 3496.50 4576
+232.347296 3496.50 4576
+232.361024 3496.50 4576
+232.374752 3496.50 4576
+232.388576 3472.22 4608
+232.402400 3472.22 4608
+232.416224 3472.22 4608
+232.430048 3472.22 4608
+232.443872 3472.22 4608
+232.457696 3472.22 4608
+232.471520 3472.22 4608
+232.485344 3472.22 4608
+232.499264 3448.28 4640
+232.513184 3448.28 4640
+232.527104 3448.28 4640
+232.541120 3424.66 4672
+232.555136 3424.66 4672
+232.569152 3424.66 4672
+232.583168 3424.66 4672
+232.597184 3424.66 4672
+232.611296 3401.36 4704
+232.625408 3401.36 4704
+232.639520 3401.36 4704
+232.653632 3401.36 4704
+232.667744 3401.36 4704
+232.681856 3401.36 4704
+232.695968 3401.36 4704
+232.710080 3401.36 4704
+232.724288 3378.38 4736
+232.738496 3378.38 4736
+232.752704 3378.38 4736
+232.766912 3378.38 4736
+232.781120 3378.38 4736
+232.795328 3378.38 4736
+232.809632 3355.70 4768
+232.823936 3355.70 4768
+232.838336 3333.33 4800
+232.852736 3333.33 4800
+232.867136 3333.33 4800
+232.881536 3333.33 4800
+232.895936 3333.33 4800
+232.910336 3333.33 4800
+232.924832 3311.26 4832
+232.939328 3311.26 4832
+232.953920 3289.47 4864
+232.968512 3289.47 4864
+232.983104 3289.47 4864
+232.997696 3289.47 4864
+233.012288 3289.47 4864
+233.026880 3289.47 4864
+233.041472 3289.47 4864
+233.056064 3289.47 4864
+233.070752 3267.97 4896
+233.085440 3267.97 4896
+233.100128 3267.97 4896
+233.114816 3267.97 4896
+233.129504 3267.97 4896
+233.144192 3267.97 4896
+233.158976 3246.75 4928
+233.173760 3246.75 4928
+233.188640 3225.81 4960
+233.203520 3225.81 4960
+233.218400 3225.81 4960
+233.233376 3205.13 4992
+233.248352 3205.13 4992
+233.263328 3205.13 4992
+233.278304 3205.13 4992
+233.293280 3205.13 4992
+233.308352 3184.71 5024
+233.323424 3184.71 5024
+233.338496 3184.71 5024
+233.353568 3184.71 5024
+233.368640 3184.71 5024
+233.383712 3184.71 5024
+233.398784 3184.71 5024
+233.413952 3164.56 5056
+233.429120 3164.56 5056
+233.444288 3164.56 5056
+233.459456 3164.56 5056
+233.474720 3144.65 5088
+233.489984 3144.65 5088
+233.505248 3144.65 5088
+233.520512 3144.65 5088
+233.535872 3125.00 5120
+233.551232 3125.00 5120
+233.566592 3125.00 5120
+233.582048 3105.59 5152
+233.597504 3105.59 5152
+233.612960 3105.59 5152
+233.628416 3105.59 5152
+233.643968 3086.42 5184
+233.659520 3086.42 5184
+233.675168 3067.48 5216
+233.690816 3067.48 5216
+233.706464 3067.48 5216
+233.722112 3067.48 5216
+233.737760 3067.48 5216
+233.753408 3067.48 5216
+233.769056 3067.48 5216
+233.784704 3067.48 5216
+233.800448 3048.78 5248
+233.816192 3048.78 5248
+233.831936 3048.78 5248
+233.847776 3030.30 5280
+233.863616 3030.30 5280
+233.879456 3030.30 5280
+233.895296 3030.30 5280
+233.911232 3012.05 5312
+233.927168 3012.05 5312
+233.943104 3012.05 5312
+233.959136 2994.01 5344
+233.969824 2994.01 5344
+233.980512 2994.01 5344
+233.991264 2976.19 5376
+234.002016 2976.19 5376
+234.012768 2976.19 5376
+234.023520 2976.19 5376
+234.034272 2976.19 5376
+234.045024 2976.19 5376
+234.055840 2958.58 5408
+234.066656 2958.58 5408
+234.077472 2958.58 5408
+234.088288 2958.58 5408
+234.099168 2941.18 5440
+234.110048 2941.18 5440
+234.120928 2941.18 5440
+234.131808 2941.18 5440
+234.142688 2941.18 5440
+234.153568 2941.18 5440
+234.164512 2923.98 5472
+234.175456 2923.98 5472
+234.186400 2923.98 5472
+234.197344 2923.98 5472
+234.208352 2906.98 5504
+234.219360 2906.98 5504
+234.230368 2906.98 5504
+234.241376 2906.98 5504
+234.252448 2890.17 5536
+234.263520 2890.17 5536
+234.274592 2890.17 5536
+234.285664 2890.17 5536
+234.296800 2873.56 5568
+234.307936 2873.56 5568
+234.319072 2873.56 5568
+234.330208 2873.56 5568
+234.341344 2873.56 5568
+234.352480 2873.56 5568
+234.363616 2873.56 5568
+234.374752 2873.56 5568
+234.385888 2873.56 5568
+234.397024 2873.56 5568
+234.408224 2857.14 5600
+234.419424 2857.14 5600
+234.430624 2857.14 5600
+234.441824 2857.14 5600
+234.453088 2840.91 5632
+234.464352 2840.91 5632
+234.475616 2840.91 5632
+234.486880 2840.91 5632
+234.498208 2824.86 5664
+234.509536 2824.86 5664
+234.520864 2824.86 5664
+234.532192 2824.86 5664
+234.543584 2808.99 5696
+234.554976 2808.99 5696
+234.566368 2808.99 5696
+234.577760 2808.99 5696
+234.589152 2808.99 5696
+234.600544 2808.99 5696
+234.612000 2793.30 5728
+234.623456 2793.30 5728
+234.634912 2793.30 5728
+234.646368 2793.30 5728
+234.657888 2777.78 5760
+234.669408 2777.78 5760
+234.680928 2777.78 5760
+234.692448 2777.78 5760
+234.704032 2762.43 5792
+234.715616 2762.43 5792
+234.727200 2762.43 5792
+234.738784 2762.43 5792
+234.750432 2747.25 5824
+234.762080 2747.25 5824
+234.773728 2747.25 5824
+234.785376 2747.25 5824
+234.797088 2732.24 5856
+234.808800 2732.24 5856
+234.820512 2732.24 5856
+234.832224 2732.24 5856
+234.844000 2717.39 5888
+234.855776 2717.39 5888
+234.867552 2717.39 5888
+234.879328 2717.39 5888
+234.891168 2702.70 5920
+234.903008 2702.70 5920
+234.914848 2702.70 5920
+234.926688 2702.70 5920
+234.938592 2688.17 5952
+234.950496 2688.17 5952
+234.962400 2688.17 5952
+234.974304 2688.17 5952
+234.986272 2673.80 5984
+234.998240 2673.80 5984
+235.010208 2673.80 5984
+235.022176 2673.80 5984
+235.034208 2659.57 6016
+235.046240 2659.57 6016
+235.058272 2659.57 6016
+235.070304 2659.57 6016
+235.082400 2645.50 6048
+235.094496 2645.50 6048
+235.106656 2631.58 6080
+235.118816 2631.58 6080
+235.130976 2631.58 6080
+235.143136 2631.58 6080
+235.155360 2617.80 6112
+235.167584 2617.80 6112
+235.179808 2617.80 6112
+235.192032 2617.80 6112
+235.204320 2604.17 6144
+235.216608 2604.17 6144
+235.228896 2604.17 6144
+235.241184 2604.17 6144
+235.253536 2590.67 6176
+235.265888 2590.67 6176
+235.278240 2590.67 6176
+235.290592 2590.67 6176
+235.303008 2577.32 6208
+235.315424 2577.32 6208
+235.327840 2577.32 6208
+235.340256 2577.32 6208
+235.352800 2551.02 6272
+235.365344 2551.02 6272
+235.377952 2538.07 6304
+235.390560 2538.07 6304
+235.403168 2538.07 6304
+235.415776 2538.07 6304
+235.428448 2525.25 6336
+235.441120 2525.25 6336
+235.453792 2525.25 6336
+235.466464 2525.25 6336
+235.479200 2512.56 6368
+235.491936 2512.56 6368
+235.504672 2512.56 6368
+235.517408 2512.56 6368
+235.530208 2500.00 6400
+235.543008 2500.00 6400
+235.555872 2487.56 6432
+235.568736 2487.56 6432
+235.581600 2487.56 6432
+235.594464 2487.56 6432
+235.607392 2475.25 6464
+235.620320 2475.25 6464
+235.633248 2475.25 6464
+235.646176 2475.25 6464
+235.659168 2463.05 6496
+235.672160 2463.05 6496
+235.685216 2450.98 6528
+235.698272 2450.98 6528
+235.711328 2450.98 6528
+235.724384 2450.98 6528
+235.737504 2439.02 6560
+235.750624 2439.02 6560
+235.763808 2427.18 6592
+235.776992 2427.18 6592
+235.790176 2427.18 6592
+235.803360 2427.18 6592
+235.816672 2403.85 6656
+235.829984 2403.85 6656
+235.843296 2403.85 6656
+235.856608 2403.85 6656
+235.869984 2392.34 6688
+235.883360 2392.34 6688
+235.896800 2380.95 6720
+235.910240 2380.95 6720
+235.923680 2380.95 6720
+235.937120 2380.95 6720
+235.950624 2369.67 6752
+235.964128 2369.67 6752
+235.977696 2358.49 6784
+235.991264 2358.49 6784
+236.004832 2358.49 6784
+236.018400 2358.49 6784
+236.032032 2347.42 6816
+236.045664 2347.42 6816
+236.059360 2336.45 6848
+236.073056 2336.45 6848
+236.086752 2336.45 6848
+236.100448 2336.45 6848
+236.114272 2314.81 6912
+236.128096 2314.81 6912
+236.141984 2304.15 6944
+236.155872 2304.15 6944
+236.169760 2304.15 6944
+236.183648 2304.15 6944
+236.197600 2293.58 6976
+236.211552 2293.58 6976
+236.225568 2283.11 7008
+236.239584 2283.11 7008
+236.253664 2272.73 7040
+236.267744 2272.73 7040
+236.281824 2272.73 7040
+236.295904 2272.73 7040
+236.310048 2262.44 7072
+236.324192 2262.44 7072
+236.338336 2262.44 7072
+236.352608 2242.15 7136
+236.366880 2242.15 7136
+236.381216 2232.14 7168
+236.395552 2232.14 7168
+236.409888 2232.14 7168
+236.424288 2222.22 7200
+236.438688 2222.22 7200
+236.453088 2222.22 7200
+236.467552 2212.39 7232
+236.482016 2212.39 7232
+236.496608 2192.98 7296
+236.511200 2192.98 7296
+236.525792 2192.98 7296
+236.540448 2183.41 7328
+236.555104 2183.41 7328
+236.569824 2173.91 7360
+236.584544 2173.91 7360
+236.599264 2173.91 7360
+236.614048 2164.50 7392
+236.628832 2164.50 7392
+236.643616 2164.50 7392
+236.658528 2145.92 7456
+236.673440 2145.92 7456
+236.688416 2136.75 7488
+236.703392 2136.75 7488
+236.718368 2136.75 7488
+236.733408 2127.66 7520
+236.748448 2127.66 7520
+236.763552 2118.64 7552
+236.778656 2118.64 7552
+236.793888 2100.84 7616
+236.809120 2100.84 7616
+236.824352 2100.84 7616
+236.839648 2092.05 7648
+236.854944 2092.05 7648
+236.870304 2083.33 7680
+236.885664 2083.33 7680
+236.901024 2083.33 7680
+236.916512 2066.12 7744
+236.932000 2066.12 7744
+236.947552 2057.61 7776
+236.963104 2057.61 7776
+236.978720 2049.18 7808
+236.994336 2049.18 7808
+237.010080 2032.52 7872
+237.025824 2032.52 7872
+237.041568 2032.52 7872
+237.057376 2024.29 7904
+237.073184 2024.29 7904
+237.089056 2016.13 7936
+237.104928 2016.13 7936
+237.120928 2000.00 8000
+237.136928 2000.00 8000
+237.152992 1992.03 8032
+237.161024 1992.03 8032
+237.169056 1992.03 8032
+237.177088 1992.03 8032
+237.185152 1984.13 8064
+237.193216 1984.13 8064
+237.201280 1984.13 8064
+237.209344 1984.13 8064
+237.217408 1984.13 8064
+237.225472 1984.13 8064
+237.233600 1968.50 8128
+237.241728 1968.50 8128
+237.249856 1968.50 8128
+237.257984 1968.50 8128
+237.266144 1960.78 8160
+237.274304 1960.78 8160
+237.282464 1960.78 8160
+237.290624 1960.78 8160
+237.298816 1953.12 8192
+237.307008 1953.12 8192
+237.315200 1953.12 8192
+237.323392 1953.12 8192
+237.331648 1937.98 8256
+237.339904 1937.98 8256
+237.348160 1937.98 8256
+237.356416 1937.98 8256
+237.364672 1937.98 8256
+237.372928 1937.98 8256
+237.381184 1937.98 8256
+237.389440 1937.98 8256
+237.397760 1923.08 8320
+237.406080 1923.08 8320
+237.414400 1923.08 8320
+237.422720 1923.08 8320
+237.431104 1908.40 8384
+237.439488 1908.40 8384
+237.447872 1908.40 8384
+237.456256 1908.40 8384
+237.464704 1893.94 8448
+237.473152 1893.94 8448
+237.481600 1893.94 8448
+237.490048 1893.94 8448
+237.498496 1893.94 8448
+237.506944 1893.94 8448
+237.515392 1893.94 8448
+237.523840 1893.94 8448
+237.532352 1879.70 8512
+237.540864 1879.70 8512
+237.549376 1879.70 8512
+237.557888 1879.70 8512
+237.566464 1865.67 8576
+237.575040 1865.67 8576
+237.583680 1851.85 8640
+237.592320 1851.85 8640
+237.600960 1851.85 8640
+237.609600 1851.85 8640
+237.618240 1851.85 8640
+237.626880 1851.85 8640
+237.635520 1851.85 8640
+237.644160 1851.85 8640
+237.652864 1838.24 8704
+237.661568 1838.24 8704
+237.670272 1838.24 8704
+237.678976 1838.24 8704
+237.687744 1824.82 8768
+237.696512 1824.82 8768
+237.705280 1824.82 8768
+237.714048 1824.82 8768
+237.722816 1824.82 8768
+237.731584 1824.82 8768
+237.740352 1824.82 8768
+237.749120 1824.82 8768
+237.757952 1811.59 8832
+237.766784 1811.59 8832
+237.775680 1798.56 8896
+237.784576 1798.56 8896
+237.793472 1798.56 8896
+237.802368 1798.56 8896
+237.811328 1785.71 8960
+237.820288 1785.71 8960
+237.829248 1785.71 8960
+237.838208 1785.71 8960
+237.847168 1785.71 8960
+237.856128 1785.71 8960
+237.865088 1785.71 8960
+237.874048 1785.71 8960
+237.883072 1773.05 9024
+237.892096 1773.05 9024
+237.901184 1760.56 9088
+237.910272 1760.56 9088
+237.919360 1760.56 9088
+237.928448 1760.56 9088
+237.937600 1748.25 9152
+237.946752 1748.25 9152
+237.955904 1748.25 9152
+237.965056 1748.25 9152
+237.974272 1736.11 9216
+237.983488 1736.11 9216
+237.992704 1736.11 9216
+238.001920 1736.11 9216
+238.011136 1736.11 9216
+238.020352 1736.11 9216
+238.029632 1724.14 9280
+238.038912 1724.14 9280
+238.048256 1712.33 9344
+238.057600 1712.33 9344
+238.066944 1712.33 9344
+238.076288 1712.33 9344
+238.085696 1700.68 9408
+238.095104 1700.68 9408
+238.104512 1700.68 9408
+238.113920 1700.68 9408
+238.123328 1700.68 9408
+238.132736 1700.68 9408
+238.142208 1689.19 9472
+238.151680 1689.19 9472
+238.161152 1689.19 9472
+238.170624 1689.19 9472
+238.180160 1677.85 9536
+238.189696 1677.85 9536
+238.199296 1666.67 9600
+238.208896 1666.67 9600
+238.218496 1666.67 9600
+238.228096 1666.67 9600
+238.237760 1655.63 9664
+238.247424 1655.63 9664
+238.257152 1644.74 9728
+238.266880 1644.74 9728
+238.276608 1644.74 9728
+238.286336 1644.74 9728
+238.296064 1644.74 9728
+238.305792 1644.74 9728
+238.315584 1633.99 9792
+238.325376 1633.99 9792
+238.335168 1633.99 9792
+238.344960 1633.99 9792
+238.354816 1623.38 9856
+238.364672 1623.38 9856
+238.374592 1612.90 9920
+238.384512 1612.90 9920
+238.394496 1602.56 9984
+238.404480 1602.56 9984
+238.414464 1602.56 9984
+238.424448 1602.56 9984
+238.434496 1592.36 10048
+238.444544 1592.36 10048
+238.454592 1592.36 10048
+238.464640 1592.36 10048
+238.474688 1592.36 10048
+238.484800 1582.28 10112
+238.494912 1582.28 10112
+238.505024 1582.28 10112
+238.515200 1572.33 10176
+238.525376 1572.33 10176
+238.535552 1572.33 10176
+238.545792 1562.50 10240
+238.556032 1562.50 10240
+238.566336 1552.80 10304
+238.576640 1552.80 10304
+238.586944 1552.80 10304
+238.597312 1543.21 10368
+238.607680 1543.21 10368
+238.618112 1533.74 10432
+238.628544 1533.74 10432
+238.638976 1533.74 10432
+238.649408 1533.74 10432
+238.659840 1533.74 10432
+238.670272 1533.74 10432
+238.680768 1524.39 10496
+238.691264 1524.39 10496
+238.701824 1515.15 10560
+238.712384 1515.15 10560
+238.722944 1515.15 10560
+238.733568 1506.02 10624
+238.744192 1506.02 10624
+238.754880 1497.01 10688
+238.765568 1497.01 10688
+238.776320 1488.10 10752
+238.787072 1488.10 10752
+238.797824 1488.10 10752
+238.808640 1479.29 10816
+238.819456 1479.29 10816
+238.830336 1470.59 10880
+238.841216 1470.59 10880
+238.852096 1470.59 10880
+238.863040 1461.99 10944
+238.873984 1461.99 10944
+238.884992 1453.49 11008
+238.896000 1453.49 11008
+238.907072 1445.09 11072
+238.918144 1445.09 11072
+238.929280 1436.78 11136
+238.940416 1436.78 11136
+238.951552 1436.78 11136
+238.962688 1436.78 11136
+238.973824 1436.78 11136
+238.985024 1428.57 11200
+238.996224 1428.57 11200
+239.007488 1420.45 11264
+239.018752 1420.45 11264
+239.030080 1412.43 11328
+239.041408 1412.43 11328
+239.052800 1404.49 11392
+239.064192 1404.49 11392
+239.075584 1404.49 11392
+239.087040 1396.65 11456
+239.098496 1396.65 11456
+239.110016 1388.89 11520
+239.121536 1388.89 11520
+239.133120 1381.22 11584
+239.144704 1381.22 11584
+239.156352 1373.63 11648
+239.168000 1373.63 11648
+239.179712 1366.12 11712
+239.191424 1366.12 11712
+239.203200 1358.70 11776
+239.214976 1358.70 11776
+239.226816 1351.35 11840
+239.238656 1351.35 11840
+239.250560 1344.09 11904
+239.262464 1344.09 11904
+239.274432 1336.90 11968
+239.286400 1336.90 11968
+239.298432 1329.79 12032
+239.310464 1329.79 12032
+239.322560 1322.75 12096
+239.334720 1315.79 12160
+239.346880 1315.79 12160
+239.359104 1308.90 12224
+239.371328 1308.90 12224
+239.383616 1302.08 12288
+239.395904 1302.08 12288
+239.408256 1295.34 12352
+239.420608 1295.34 12352
+239.433024 1288.66 12416
+239.445440 1288.66 12416
+239.457984 1275.51 12544
+239.470592 1269.04 12608
+239.483200 1269.04 12608
+239.495872 1262.63 12672
+239.508544 1262.63 12672
+239.521280 1256.28 12736
+239.534016 1256.28 12736
+239.546816 1250.00 12800
+239.559680 1243.78 12864
+239.572544 1243.78 12864
+239.585472 1237.62 12928
+239.598400 1237.62 12928
+239.611392 1231.53 12992
+239.624448 1225.49 13056
+239.637504 1225.49 13056
+239.650624 1219.51 13120
+239.663808 1213.59 13184
+239.676992 1213.59 13184
+239.690304 1201.92 13312
+239.703616 1201.92 13312
+239.716992 1196.17 13376
+239.730432 1190.48 13440
+239.743872 1190.48 13440
+239.757376 1184.83 13504
+239.770944 1179.25 13568
+239.784512 1179.25 13568
+239.798144 1173.71 13632
+239.811840 1168.22 13696
+239.825536 1168.22 13696
+239.839360 1157.41 13824
+239.853248 1152.07 13888
+239.867136 1152.07 13888
+239.881088 1146.79 13952
+239.895104 1141.55 14016
+239.909184 1136.36 14080
+239.923264 1136.36 14080
+239.937408 1131.22 14144
+239.951680 1121.08 14272
+239.966016 1116.07 14336
+239.980352 1116.07 14336
+239.994752 1111.11 14400
+240.009216 1106.19 14464
+240.023808 1096.49 14592
+240.038400 1096.49 14592
+240.053056 1091.70 14656
+240.067776 1086.96 14720
+240.082560 1082.25 14784
+240.097344 1082.25 14784
+240.112256 1072.96 14912
+240.127232 1068.38 14976
+240.142272 1063.83 15040
+240.157376 1059.32 15104
+240.172608 1050.42 15232
+240.187840 1050.42 15232
+240.203136 1046.03 15296
+240.218496 1041.67 15360
+240.233984 1033.06 15488
+240.249536 1028.81 15552
+240.265152 1024.59 15616
+240.280896 1016.26 15744
+240.296640 1016.26 15744
+240.312448 1012.15 15808
+240.328320 1008.06 15872
+240.344320 1000.00 16000
+240.360384 996.02 16064
+240.376512 992.06 16128
+240.392768 984.25 16256
+240.409088 980.39 16320
+240.425472 976.56 16384
+240.441984 968.99 16512
+240.458496 968.99 16512
+240.475136 961.54 16640
+240.491904 954.20 16768
+240.508800 946.97 16896
+240.525696 946.97 16896
+240.542720 939.85 17024
+240.559872 932.84 17152
+240.577152 925.93 17280
+240.594432 925.93 17280
+240.611840 919.12 17408
+240.629376 912.41 17536
+240.646912 912.41 17536
+240.664704 899.28 17792
+240.682624 892.86 17920
+240.700544 892.86 17920
+240.718592 886.52 18048
+240.736768 880.28 18176
+240.755072 874.13 18304
+240.773504 868.06 18432
+240.792064 862.07 18560
+240.810752 856.16 18688
+240.829568 850.34 18816
+240.848512 844.59 18944
+240.867584 838.93 19072
+240.886784 833.33 19200
+240.906240 822.37 19456
+240.925696 822.37 19456
+240.945280 816.99 19584
+240.965120 806.45 19840
+240.985088 801.28 19968
+241.005184 796.18 20096
+241.025408 791.14 20224
+241.045888 781.25 20480
+241.066496 776.40 20608
+241.087360 766.87 20864
+241.108224 766.87 20864
+241.129344 757.58 21120
+241.150720 748.50 21376
+241.172224 744.05 21504
+241.193984 735.29 21760
+241.216000 726.74 22016
+241.238272 718.39 22272
+241.260544 718.39 22272
+241.283072 710.23 22528
+241.305856 702.25 22784
+241.328896 694.44 23040
+241.352192 686.81 23296
+241.375744 679.35 23552
+241.399552 672.04 23808
+241.423616 664.89 24064
+241.447936 657.89 24320
+241.472512 651.04 24576
+241.497344 644.33 24832
+241.522688 631.31 25344
+241.548288 625.00 25600
+241.574144 618.81 25856
+241.600384 609.76 26240
+241.627008 600.96 26624
+241.654016 592.42 27008
+241.681408 584.11 27392
+241.709184 576.04 27776
+241.737344 568.18 28160
+241.766016 558.04 28672
+241.795200 548.25 29184
+241.824768 541.13 29568
+241.854976 529.66 30208
+241.885696 520.83 30720
+241.917184 508.13 31488
+241.949184 500.00 32000
+241.981824 490.20 32640
+242.015104 480.77 33280
+242.049152 469.92 34048
+242.083968 459.56 34816
+242.119808 446.43 35840
+242.156416 437.06 36608
+242.194048 425.17 37632
+242.232960 411.18 38912
+242.272896 400.64 39936
+242.314112 388.20 41216
+242.356864 374.25 42752
+242.401408 359.20 44544
+242.447488 347.22 46080
+242.495616 332.45 48128
+242.546304 315.66 50688
+242.599552 300.48 53248
+242.655872 284.09 56320
+242.716288 264.83 60416
+242.781568 245.10 65280
+242.853248 223.21 71680
+242.933120 200.32 79872
+243.025280 173.61 92160
+243.137920 142.05 112640
+243.297664 100.16 159744
+243.522944 71.02 225280
+EOF
+plot $data using 1:2 with linespoints
+pause -1
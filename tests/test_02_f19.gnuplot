@@ -0,0 +1,1004 @@
+$data <<EOF
+11.337728 1.41 11337728
+19.333120 2.00 7995392
+25.853952 2.45 6520832
+31.522816 2.82 5668864
+36.569088 3.17 5046272
+41.156608 3.49 4587520
+45.416448 3.76 4259840
+49.414144 4.00 3997696
+53.182464 4.25 3768320
+56.754176 4.48 3571712
+60.162048 4.70 3407872
+63.422464 4.91 3260416
+66.551808 5.11 3129344
+69.566464 5.31 3014656
+72.482816 5.49 2916352
+75.317248 5.64 2834432
+78.053376 5.85 2736128
+80.723968 5.99 2670592
+83.312640 6.18 2588672
+85.835776 6.34 2523136
+88.309760 6.47 2473984
+90.718208 6.64 2408448
+93.077504 6.78 2359296
+95.371264 6.98 2293760
+97.632256 7.08 2260992
+99.844096 7.23 2211840
+102.023168 7.34 2179072
+104.153088 7.51 2129920
+106.250240 7.63 2097152
+108.314624 7.75 2064384
+110.346240 7.88 2031616
+112.345088 8.00 1998848
+114.311168 8.14 1966080
+116.244480 8.28 1933312
+118.161408 8.35 1916928
+120.045568 8.49 1884160
+121.896960 8.64 1851392
+123.731968 8.72 1835008
+125.542400 8.84 1810432
+127.328256 8.96 1785856
+129.097728 9.04 1769472
+130.842624 9.17 1744896
+132.571136 9.26 1728512
+134.275072 9.39 1703936
+135.954432 9.53 1679360
+137.617408 9.62 1662976
+139.264000 9.72 1646592
+140.894208 9.81 1630208
+142.516224 9.86 1622016
+144.121856 9.96 1605632
+145.702912 10.12 1581056
+147.267584 10.23 1564672
+148.815872 10.33 1548288
+150.355968 10.39 1540096
+151.879680 10.50 1523712
+153.387008 10.61 1507328
+154.886144 10.67 1499136
+156.368896 10.79 1482752
+157.835264 10.91 1466368
+159.293440 10.97 1458176
+160.735232 11.10 1441792
+162.168832 11.16 1433600
+163.594240 11.22 1425408
+165.011456 11.29 1417216
+166.412288 11.42 1400832
+167.804928 11.49 1392640
+169.189376 11.56 1384448
+170.557440 11.70 1368064
+171.917312 11.77 1359872
+173.268992 11.84 1351680
+174.604288 11.98 1335296
+175.939584 11.98 1335296
+177.266688 12.06 1327104
+178.577408 12.21 1310720
+179.879936 12.28 1302528
+181.174272 12.36 1294336
+182.460416 12.44 1286144
+183.746560 12.44 1286144
+185.016320 12.60 1269760
+186.277888 12.68 1261568
+187.531264 12.77 1253376
+188.776448 12.85 1245184
+190.021632 12.85 1245184
+191.258624 12.93 1236992
+192.487424 13.02 1228800
+193.708032 13.11 1220608
+194.920448 13.20 1212416
+196.124672 13.29 1204224
+197.320704 13.38 1196032
+198.508544 13.47 1187840
+199.688192 13.56 1179648
+200.867840 13.56 1179648
+202.039296 13.66 1171456
+203.202560 13.75 1163264
+204.357632 13.85 1155072
+205.504512 13.95 1146880
+206.651392 13.95 1146880
+207.798272 13.95 1146880
+208.936960 14.05 1138688
+210.067456 14.15 1130496
+211.189760 14.26 1122304
+212.312064 14.26 1122304
+213.426176 14.36 1114112
+214.532096 14.47 1105920
+215.638016 14.47 1105920
+216.735744 14.58 1097728
+217.825280 14.69 1089536
+218.914816 14.69 1089536
+219.996160 14.80 1081344
+221.077504 14.80 1081344
+222.150656 14.91 1073152
+223.215616 15.02 1064960
+224.272384 15.14 1056768
+225.329152 15.14 1056768
+226.385920 15.14 1056768
+227.434496 15.26 1048576
+228.478976 15.32 1044480
+229.519360 15.38 1040384
+230.559744 15.38 1040384
+231.591936 15.50 1032192
+232.620032 15.56 1028096
+233.644032 15.62 1024000
+234.668032 15.62 1024000
+235.683840 15.75 1015808
+236.695552 15.81 1011712
+237.703168 15.88 1007616
+238.710784 15.88 1007616
+239.710208 16.01 999424
+240.705536 16.08 995328
+241.696768 16.14 991232
+242.688000 16.14 991232
+243.671040 16.28 983040
+244.649984 16.34 978944
+245.628928 16.34 978944
+246.603776 16.41 974848
+247.570432 16.55 966656
+248.537088 16.55 966656
+249.499648 16.62 962560
+250.458112 16.69 958464
+251.416576 16.69 958464
+252.370944 16.77 954368
+253.317120 16.91 946176
+254.263296 16.91 946176
+255.205376 16.98 942080
+256.143360 17.06 937984
+257.081344 17.06 937984
+258.015232 17.13 933888
+258.940928 17.28 925696
+259.866624 17.28 925696
+260.788224 17.36 921600
+261.709824 17.36 921600
+262.627328 17.44 917504
+263.540736 17.52 913408
+264.454144 17.52 913408
+265.359360 17.68 905216
+266.264576 17.68 905216
+267.165696 17.76 901120
+268.062720 17.84 897024
+268.959744 17.84 897024
+269.852672 17.92 892928
+270.745600 17.92 892928
+271.634432 18.00 888832
+272.523264 18.00 888832
+273.408000 18.08 884736
+274.284544 18.25 876544
+275.161088 18.25 876544
+276.033536 18.34 872448
+276.905984 18.34 872448
+277.774336 18.43 868352
+278.642688 18.43 868352
+279.506944 18.51 864256
+280.371200 18.51 864256
+281.231360 18.60 860160
+282.091520 18.60 860160
+282.947584 18.69 856064
+283.799552 18.78 851968
+284.651520 18.78 851968
+285.495296 18.96 843776
+286.339072 18.96 843776
+287.178752 19.05 839680
+288.018432 19.05 839680
+288.854016 19.15 835584
+289.689600 19.15 835584
+290.521088 19.24 831488
+291.352576 19.24 831488
+292.179968 19.34 827392
+293.007360 19.34 827392
+293.830656 19.43 823296
+294.653952 19.43 823296
+295.473152 19.53 819200
+296.292352 19.53 819200
+297.107456 19.63 815104
+297.922560 19.63 815104
+298.733568 19.73 811008
+299.544576 19.73 811008
+300.355584 19.73 811008
+301.162496 19.83 806912
+301.969408 19.83 806912
+302.772224 19.93 802816
+303.575040 19.93 802816
+304.369664 20.14 794624
+305.164288 20.14 794624
+305.954816 20.24 790528
+306.745344 20.24 790528
+307.531776 20.35 786432
+308.318208 20.35 786432
+309.100544 20.45 782336
+309.882880 20.45 782336
+310.665216 20.45 782336
+311.443456 20.56 778240
+312.221696 20.56 778240
+312.995840 20.67 774144
+313.769984 20.67 774144
+314.540032 20.78 770048
+315.310080 20.78 770048
+316.080128 20.78 770048
+316.846080 20.89 765952
+317.612032 20.89 765952
+318.373888 21.00 761856
+319.135744 21.00 761856
+319.893504 21.11 757760
+320.651264 21.11 757760
+321.409024 21.11 757760
+322.162688 21.23 753664
+322.916352 21.23 753664
+323.665920 21.35 749568
+324.415488 21.35 749568
+325.165056 21.35 749568
+325.910528 21.46 745472
+326.656000 21.46 745472
+327.397376 21.58 741376
+328.138752 21.58 741376
+328.880128 21.58 741376
+329.617408 21.70 737280
+330.354688 21.70 737280
+331.087872 21.82 733184
+331.821056 21.82 733184
+332.554240 21.82 733184
+333.283328 21.95 729088
+334.012416 21.95 729088
+334.737408 22.07 724992
+335.462400 22.07 724992
+336.187392 22.07 724992
+336.908288 22.19 720896
+337.629184 22.19 720896
+338.350080 22.19 720896
+339.066880 22.32 716800
+339.783680 22.32 716800
+340.496384 22.45 712704
+341.209088 22.45 712704
+341.921792 22.45 712704
+342.634496 22.45 712704
+343.347200 22.45 712704
+344.059904 22.45 712704
+344.768512 22.58 708608
+345.477120 22.58 708608
+346.185728 22.58 708608
+346.890240 22.71 704512
+347.594752 22.71 704512
+348.295168 22.84 700416
+348.995584 22.84 700416
+349.696000 22.84 700416
+350.396416 22.84 700416
+351.092736 22.98 696320
+351.789056 22.98 696320
+352.481280 23.11 692224
+353.173504 23.11 692224
+353.865728 23.11 692224
+354.557952 23.11 692224
+355.246080 23.25 688128
+355.934208 23.25 688128
+356.618240 23.39 684032
+357.302272 23.39 684032
+357.986304 23.39 684032
+358.670336 23.39 684032
+359.350272 23.53 679936
+360.030208 23.53 679936
+360.706048 23.67 675840
+361.381888 23.67 675840
+362.057728 23.67 675840
+362.733568 23.67 675840
+363.405312 23.82 671744
+364.077056 23.82 671744
+364.744704 23.96 667648
+365.412352 23.96 667648
+366.080000 23.96 667648
+366.747648 23.96 667648
+367.415296 23.96 667648
+368.082944 23.96 667648
+368.746496 24.11 663552
+369.410048 24.11 663552
+370.073600 24.11 663552
+370.737152 24.11 663552
+371.396608 24.26 659456
+372.056064 24.26 659456
+372.711424 24.41 655360
+373.366784 24.41 655360
+374.022144 24.41 655360
+374.677504 24.41 655360
+375.328768 24.57 651264
+375.980032 24.57 651264
+376.631296 24.57 651264
+377.282560 24.57 651264
+377.929728 24.72 647168
+378.576896 24.72 647168
+379.219968 24.88 643072
+379.863040 24.88 643072
+380.506112 24.88 643072
+381.149184 24.88 643072
+381.792256 24.88 643072
+382.435328 24.88 643072
+383.078400 24.88 643072
+383.721472 24.88 643072
+384.360448 25.04 638976
+384.999424 25.04 638976
+385.634304 25.20 634880
+386.269184 25.20 634880
+386.904064 25.20 634880
+387.538944 25.20 634880
+388.169728 25.37 630784
+388.800512 25.37 630784
+389.431296 25.37 630784
+390.062080 25.37 630784
+390.688768 25.53 626688
+391.315456 25.53 626688
+391.942144 25.53 626688
+392.568832 25.53 626688
+393.191424 25.70 622592
+393.814016 25.70 622592
+394.436608 25.70 622592
+395.059200 25.70 622592
+395.681792 25.70 622592
+396.304384 25.70 622592
+396.922880 25.87 618496
+397.541376 25.87 618496
+398.159872 25.87 618496
+398.778368 25.87 618496
+399.392768 26.04 614400
+400.007168 26.04 614400
+400.621568 26.04 614400
+401.235968 26.04 614400
+401.846272 26.22 610304
+402.456576 26.22 610304
+403.066880 26.22 610304
+403.677184 26.22 610304
+404.283392 26.39 606208
+404.889600 26.39 606208
+405.495808 26.39 606208
+406.102016 26.39 606208
+406.704128 26.57 602112
+407.306240 26.57 602112
+407.908352 26.57 602112
+408.510464 26.57 602112
+409.112576 26.57 602112
+409.714688 26.57 602112
+410.312704 26.76 598016
+410.910720 26.76 598016
+411.508736 26.76 598016
+412.106752 26.76 598016
+412.700672 26.94 593920
+413.294592 26.94 593920
+413.888512 26.94 593920
+414.482432 26.94 593920
+415.072256 27.13 589824
+415.662080 27.13 589824
+416.251904 27.13 589824
+416.841728 27.13 589824
+417.431552 27.13 589824
+418.021376 27.13 589824
+418.611200 27.13 589824
+419.201024 27.13 589824
+419.786752 27.32 585728
+420.372480 27.32 585728
+420.958208 27.32 585728
+421.543936 27.32 585728
+422.125568 27.51 581632
+422.707200 27.51 581632
+423.288832 27.51 581632
+423.870464 27.51 581632
+424.448000 27.70 577536
+425.025536 27.70 577536
+425.603072 27.70 577536
+426.180608 27.70 577536
+426.754048 27.90 573440
+427.327488 27.90 573440
+427.900928 27.90 573440
+428.474368 27.90 573440
+429.047808 27.90 573440
+429.621248 27.90 573440
+430.194688 27.90 573440
+430.768128 27.90 573440
+431.341568 27.90 573440
+431.915008 27.90 573440
+432.484352 28.10 569344
+433.053696 28.10 569344
+433.623040 28.10 569344
+434.192384 28.10 569344
+434.757632 28.31 565248
+435.322880 28.31 565248
+435.888128 28.31 565248
+436.453376 28.31 565248
+437.014528 28.51 561152
+437.575680 28.51 561152
+438.136832 28.51 561152
+438.697984 28.51 561152
+439.259136 28.51 561152
+439.820288 28.51 561152
+440.381440 28.51 561152
+440.942592 28.51 561152
+441.499648 28.72 557056
+442.056704 28.72 557056
+442.613760 28.72 557056
+443.170816 28.72 557056
+443.723776 28.94 552960
+444.276736 28.94 552960
+444.829696 28.94 552960
+445.382656 28.94 552960
+445.935616 28.94 552960
+446.488576 28.94 552960
+447.041536 28.94 552960
+447.594496 28.94 552960
+448.147456 28.94 552960
+448.700416 28.94 552960
+449.249280 29.15 548864
+449.798144 29.15 548864
+450.347008 29.15 548864
+450.895872 29.15 548864
+451.440640 29.37 544768
+451.985408 29.37 544768
+452.530176 29.37 544768
+453.074944 29.37 544768
+453.619712 29.37 544768
+454.164480 29.37 544768
+454.705152 29.59 540672
+455.245824 29.59 540672
+455.786496 29.59 540672
+456.327168 29.59 540672
+456.867840 29.59 540672
+457.408512 29.59 540672
+457.949184 29.59 540672
+458.489856 29.59 540672
+459.026432 29.82 536576
+459.563008 29.82 536576
+460.099584 29.82 536576
+460.636160 29.82 536576
+461.172736 29.82 536576
+461.709312 29.82 536576
+462.241792 30.05 532480
+462.774272 30.05 532480
+463.306752 30.05 532480
+463.839232 30.05 532480
+464.367616 30.28 528384
+464.896000 30.28 528384
+465.424384 30.28 528384
+465.952768 30.28 528384
+466.481152 30.28 528384
+467.009536 30.28 528384
+467.537920 30.28 528384
+468.066304 30.28 528384
+468.594688 30.28 528384
+469.123072 30.28 528384
+469.647360 30.52 524288
+470.171648 30.52 524288
+470.695936 30.52 524288
+471.220224 30.52 524288
+471.744512 30.52 524288
+472.268800 30.52 524288
+472.791040 30.64 522240
+473.313280 30.64 522240
+473.835520 30.64 522240
+474.357760 30.64 522240
+474.877952 30.76 520192
+475.398144 30.76 520192
+475.918336 30.76 520192
+476.438528 30.76 520192
+476.958720 30.76 520192
+477.478912 30.76 520192
+477.995008 31.00 516096
+478.511104 31.00 516096
+479.027200 31.00 516096
+479.543296 31.00 516096
+480.057344 31.13 514048
+480.571392 31.13 514048
+481.085440 31.13 514048
+481.599488 31.13 514048
+482.113536 31.13 514048
+482.627584 31.13 514048
+483.139584 31.25 512000
+483.651584 31.25 512000
+484.163584 31.25 512000
+484.675584 31.25 512000
+485.187584 31.25 512000
+485.699584 31.25 512000
+486.207488 31.50 507904
+486.715392 31.50 507904
+487.223296 31.50 507904
+487.731200 31.50 507904
+488.237056 31.63 505856
+488.742912 31.63 505856
+489.248768 31.63 505856
+489.754624 31.63 505856
+490.260480 31.63 505856
+490.768384 31.50 507904
+491.276288 31.50 507904
+491.784192 31.50 507904
+492.292096 31.50 507904
+492.804096 31.25 512000
+493.316096 31.25 512000
+493.828096 31.25 512000
+494.340096 31.25 512000
+494.852096 31.25 512000
+495.364096 31.25 512000
+495.878144 31.13 514048
+496.392192 31.13 514048
+496.906240 31.13 514048
+497.420288 31.13 514048
+497.934336 31.13 514048
+498.448384 31.13 514048
+498.964480 31.00 516096
+499.480576 31.00 516096
+499.996672 31.00 516096
+500.512768 31.00 516096
+501.032960 30.76 520192
+501.553152 30.76 520192
+502.073344 30.76 520192
+502.593536 30.76 520192
+503.113728 30.76 520192
+503.633920 30.76 520192
+504.156160 30.64 522240
+504.678400 30.64 522240
+505.200640 30.64 522240
+505.722880 30.64 522240
+506.247168 30.52 524288
+506.771456 30.52 524288
+507.295744 30.52 524288
+507.820032 30.52 524288
+508.344320 30.52 524288
+508.868608 30.52 524288
+509.396992 30.28 528384
+509.925376 30.28 528384
+510.453760 30.28 528384
+510.982144 30.28 528384
+511.510528 30.28 528384
+512.038912 30.28 528384
+512.567296 30.28 528384
+513.095680 30.28 528384
+513.624064 30.28 528384
+514.152448 30.28 528384
+514.684928 30.05 532480
+515.217408 30.05 532480
+515.749888 30.05 532480
+516.282368 30.05 532480
+516.818944 29.82 536576
+517.355520 29.82 536576
+517.892096 29.82 536576
+518.428672 29.82 536576
+518.965248 29.82 536576
+519.501824 29.82 536576
+520.042496 29.59 540672
+520.583168 29.59 540672
+521.123840 29.59 540672
+521.664512 29.59 540672
+522.205184 29.59 540672
+522.745856 29.59 540672
+523.286528 29.59 540672
+523.827200 29.59 540672
+524.371968 29.37 544768
+524.916736 29.37 544768
+525.461504 29.37 544768
+526.006272 29.37 544768
+526.551040 29.37 544768
+527.095808 29.37 544768
+527.644672 29.15 548864
+528.193536 29.15 548864
+528.742400 29.15 548864
+529.291264 29.15 548864
+529.844224 28.94 552960
+530.397184 28.94 552960
+530.950144 28.94 552960
+531.503104 28.94 552960
+532.056064 28.94 552960
+532.609024 28.94 552960
+533.161984 28.94 552960
+533.714944 28.94 552960
+534.267904 28.94 552960
+534.820864 28.94 552960
+535.377920 28.72 557056
+535.934976 28.72 557056
+536.492032 28.72 557056
+537.049088 28.72 557056
+537.610240 28.51 561152
+538.171392 28.51 561152
+538.732544 28.51 561152
+539.293696 28.51 561152
+539.854848 28.51 561152
+540.416000 28.51 561152
+540.977152 28.51 561152
+541.538304 28.51 561152
+542.103552 28.31 565248
+542.668800 28.31 565248
+543.234048 28.31 565248
+543.799296 28.31 565248
+544.368640 28.10 569344
+544.937984 28.10 569344
+545.507328 28.10 569344
+546.076672 28.10 569344
+546.650112 27.90 573440
+547.223552 27.90 573440
+547.796992 27.90 573440
+548.370432 27.90 573440
+548.943872 27.90 573440
+549.517312 27.90 573440
+550.090752 27.90 573440
+550.664192 27.90 573440
+551.237632 27.90 573440
+551.811072 27.90 573440
+552.388608 27.70 577536
+552.966144 27.70 577536
+553.543680 27.70 577536
+554.121216 27.70 577536
+554.702848 27.51 581632
+555.284480 27.51 581632
+555.866112 27.51 581632
+556.447744 27.51 581632
+557.033472 27.32 585728
+557.619200 27.32 585728
+558.204928 27.32 585728
+558.790656 27.32 585728
+559.380480 27.13 589824
+559.970304 27.13 589824
+560.560128 27.13 589824
+561.149952 27.13 589824
+561.739776 27.13 589824
+562.329600 27.13 589824
+562.919424 27.13 589824
+563.509248 27.13 589824
+564.103168 26.94 593920
+564.697088 26.94 593920
+565.291008 26.94 593920
+565.884928 26.94 593920
+566.482944 26.76 598016
+567.080960 26.76 598016
+567.678976 26.76 598016
+568.276992 26.76 598016
+568.879104 26.57 602112
+569.481216 26.57 602112
+570.083328 26.57 602112
+570.685440 26.57 602112
+571.287552 26.57 602112
+571.889664 26.57 602112
+572.495872 26.39 606208
+573.102080 26.39 606208
+573.708288 26.39 606208
+574.314496 26.39 606208
+574.924800 26.22 610304
+575.535104 26.22 610304
+576.145408 26.22 610304
+576.755712 26.22 610304
+577.370112 26.04 614400
+577.984512 26.04 614400
+578.598912 26.04 614400
+579.213312 26.04 614400
+579.831808 25.87 618496
+580.450304 25.87 618496
+581.068800 25.87 618496
+581.687296 25.87 618496
+582.309888 25.70 622592
+582.932480 25.70 622592
+583.555072 25.70 622592
+584.177664 25.70 622592
+584.800256 25.70 622592
+585.422848 25.70 622592
+586.049536 25.53 626688
+586.676224 25.53 626688
+587.302912 25.53 626688
+587.929600 25.53 626688
+588.560384 25.37 630784
+589.191168 25.37 630784
+589.821952 25.37 630784
+590.452736 25.37 630784
+591.087616 25.20 634880
+591.722496 25.20 634880
+592.357376 25.20 634880
+592.992256 25.20 634880
+593.631232 25.04 638976
+594.270208 25.04 638976
+594.913280 24.88 643072
+595.556352 24.88 643072
+596.199424 24.88 643072
+596.842496 24.88 643072
+597.485568 24.88 643072
+598.128640 24.88 643072
+598.771712 24.88 643072
+599.414784 24.88 643072
+600.061952 24.72 647168
+600.709120 24.72 647168
+601.360384 24.57 651264
+602.011648 24.57 651264
+602.662912 24.57 651264
+603.314176 24.57 651264
+603.969536 24.41 655360
+604.624896 24.41 655360
+605.280256 24.41 655360
+605.935616 24.41 655360
+606.595072 24.26 659456
+607.254528 24.26 659456
+607.918080 24.11 663552
+608.581632 24.11 663552
+609.245184 24.11 663552
+609.908736 24.11 663552
+610.576384 23.96 667648
+611.244032 23.96 667648
+611.911680 23.96 667648
+612.579328 23.96 667648
+613.246976 23.96 667648
+613.914624 23.96 667648
+614.586368 23.82 671744
+615.258112 23.82 671744
+615.933952 23.67 675840
+616.609792 23.67 675840
+617.285632 23.67 675840
+617.961472 23.67 675840
+618.641408 23.53 679936
+619.321344 23.53 679936
+620.005376 23.39 684032
+620.689408 23.39 684032
+621.373440 23.39 684032
+622.057472 23.39 684032
+622.745600 23.25 688128
+623.433728 23.25 688128
+624.125952 23.11 692224
+624.818176 23.11 692224
+625.510400 23.11 692224
+626.202624 23.11 692224
+626.898944 22.98 696320
+627.595264 22.98 696320
+628.295680 22.84 700416
+628.996096 22.84 700416
+629.696512 22.84 700416
+630.396928 22.84 700416
+631.101440 22.71 704512
+631.805952 22.71 704512
+632.514560 22.58 708608
+633.223168 22.58 708608
+633.931776 22.58 708608
+634.644480 22.45 712704
+635.357184 22.45 712704
+636.069888 22.45 712704
+636.782592 22.45 712704
+637.495296 22.45 712704
+638.208000 22.45 712704
+638.924800 22.32 716800
+639.641600 22.32 716800
+640.362496 22.19 720896
+641.083392 22.19 720896
+641.804288 22.19 720896
+642.529280 22.07 724992
+643.254272 22.07 724992
+643.979264 22.07 724992
+644.708352 21.95 729088
+645.437440 21.95 729088
+646.170624 21.82 733184
+646.903808 21.82 733184
+647.636992 21.82 733184
+648.374272 21.70 737280
+649.111552 21.70 737280
+649.852928 21.58 741376
+650.594304 21.58 741376
+651.335680 21.58 741376
+652.081152 21.46 745472
+652.826624 21.46 745472
+653.576192 21.35 749568
+654.325760 21.35 749568
+655.075328 21.35 749568
+655.828992 21.23 753664
+656.582656 21.23 753664
+657.340416 21.11 757760
+658.098176 21.11 757760
+658.855936 21.11 757760
+659.617792 21.00 761856
+660.379648 21.00 761856
+661.145600 20.89 765952
+661.911552 20.89 765952
+662.681600 20.78 770048
+663.451648 20.78 770048
+664.221696 20.78 770048
+664.995840 20.67 774144
+665.769984 20.67 774144
+666.548224 20.56 778240
+667.326464 20.56 778240
+668.108800 20.45 782336
+668.891136 20.45 782336
+669.673472 20.45 782336
+670.459904 20.35 786432
+671.246336 20.35 786432
+672.036864 20.24 790528
+672.827392 20.24 790528
+673.622016 20.14 794624
+674.416640 20.14 794624
+675.219456 19.93 802816
+676.022272 19.93 802816
+676.829184 19.83 806912
+677.636096 19.83 806912
+678.447104 19.73 811008
+679.258112 19.73 811008
+680.069120 19.73 811008
+680.884224 19.63 815104
+681.699328 19.63 815104
+682.518528 19.53 819200
+683.337728 19.53 819200
+684.161024 19.43 823296
+684.984320 19.43 823296
+685.811712 19.34 827392
+686.639104 19.34 827392
+687.470592 19.24 831488
+688.302080 19.24 831488
+689.137664 19.15 835584
+689.973248 19.15 835584
+690.812928 19.05 839680
+691.652608 19.05 839680
+692.496384 18.96 843776
+693.340160 18.96 843776
+694.192128 18.78 851968
+695.044096 18.78 851968
+695.900160 18.69 856064
+696.760320 18.60 860160
+697.620480 18.60 860160
+698.484736 18.51 864256
+699.348992 18.51 864256
+700.217344 18.43 868352
+701.085696 18.43 868352
+701.958144 18.34 872448
+702.830592 18.34 872448
+703.707136 18.25 876544
+704.583680 18.25 876544
+705.468416 18.08 884736
+706.357248 18.00 888832
+707.246080 18.00 888832
+708.139008 17.92 892928
+709.031936 17.92 892928
+709.928960 17.84 897024
+710.825984 17.84 897024
+711.727104 17.76 901120
+712.632320 17.68 905216
+713.537536 17.68 905216
+714.450944 17.52 913408
+715.364352 17.52 913408
+716.281856 17.44 917504
+717.203456 17.36 921600
+718.125056 17.36 921600
+719.050752 17.28 925696
+719.976448 17.28 925696
+720.910336 17.13 933888
+721.848320 17.06 937984
+722.786304 17.06 937984
+723.728384 16.98 942080
+724.674560 16.91 946176
+725.620736 16.91 946176
+726.575104 16.77 954368
+727.533568 16.69 958464
+728.492032 16.69 958464
+729.454592 16.62 962560
+730.421248 16.55 966656
+731.387904 16.55 966656
+732.362752 16.41 974848
+733.341696 16.34 978944
+734.320640 16.34 978944
+735.303680 16.28 983040
+736.294912 16.14 991232
+737.286144 16.14 991232
+738.281472 16.08 995328
+739.280896 16.01 999424
+740.288512 15.88 1007616
+741.296128 15.88 1007616
+742.307840 15.81 1011712
+743.323648 15.75 1015808
+744.347648 15.62 1024000
+745.371648 15.62 1024000
+746.399744 15.56 1028096
+747.431936 15.50 1032192
+748.472320 15.38 1040384
+749.512704 15.38 1040384
+750.557184 15.32 1044480
+751.605760 15.26 1048576
+752.662528 15.14 1056768
+753.719296 15.14 1056768
+754.776064 15.14 1056768
+755.841024 15.02 1064960
+756.914176 14.91 1073152
+757.995520 14.80 1081344
+759.076864 14.80 1081344
+760.166400 14.69 1089536
+761.255936 14.69 1089536
+762.353664 14.58 1097728
+763.459584 14.47 1105920
+764.565504 14.47 1105920
+765.679616 14.36 1114112
+766.801920 14.26 1122304
+767.924224 14.26 1122304
+769.054720 14.15 1130496
+770.193408 14.05 1138688
+771.340288 13.95 1146880
+772.487168 13.95 1146880
+773.634048 13.95 1146880
+774.789120 13.85 1155072
+775.952384 13.75 1163264
+777.123840 13.66 1171456
+778.303488 13.56 1179648
+779.483136 13.56 1179648
+780.670976 13.47 1187840
+781.867008 13.38 1196032
+783.071232 13.29 1204224
+784.283648 13.20 1212416
+785.504256 13.11 1220608
+786.733056 13.02 1228800
+787.970048 12.93 1236992
+789.215232 12.85 1245184
+790.460416 12.85 1245184
+791.713792 12.77 1253376
+792.975360 12.68 1261568
+794.245120 12.60 1269760
+795.531264 12.44 1286144
+796.817408 12.44 1286144
+798.111744 12.36 1294336
+799.414272 12.28 1302528
+800.724992 12.21 1310720
+802.052096 12.06 1327104
+803.387392 11.98 1335296
+804.722688 11.98 1335296
+806.074368 11.84 1351680
+807.434240 11.77 1359872
+808.802304 11.70 1368064
+810.186752 11.56 1384448
+811.579392 11.49 1392640
+812.980224 11.42 1400832
+814.397440 11.29 1417216
+815.822848 11.22 1425408
+817.256448 11.16 1433600
+818.698240 11.10 1441792
+820.156416 10.97 1458176
+821.622784 10.91 1466368
+823.105536 10.79 1482752
+824.604672 10.67 1499136
+826.112000 10.61 1507328
+827.635712 10.50 1523712
+829.175808 10.39 1540096
+830.724096 10.33 1548288
+832.288768 10.23 1564672
+833.869824 10.12 1581056
+835.475456 9.96 1605632
+837.097472 9.86 1622016
+838.727680 9.81 1630208
+840.374272 9.72 1646592
+842.037248 9.62 1662976
+843.716608 9.53 1679360
+845.420544 9.39 1703936
+847.149056 9.26 1728512
+848.893952 9.17 1744896
+850.663424 9.04 1769472
+852.449280 8.96 1785856
+854.259712 8.84 1810432
+856.094720 8.72 1835008
+857.946112 8.64 1851392
+859.830272 8.49 1884160
+861.747200 8.35 1916928
+863.680512 8.28 1933312
+865.646592 8.14 1966080
+867.645440 8.00 1998848
+869.677056 7.88 2031616
+871.741440 7.75 2064384
+873.838592 7.63 2097152
+875.968512 7.51 2129920
+878.147584 7.34 2179072
+880.359424 7.23 2211840
+882.620416 7.08 2260992
+884.914176 6.98 2293760
+887.273472 6.78 2359296
+889.681920 6.64 2408448
+892.155904 6.47 2473984
+894.679040 6.34 2523136
+897.267712 6.18 2588672
+899.938304 5.99 2670592
+902.674432 5.85 2736128
+905.508864 5.64 2834432
+908.425216 5.49 2916352
+911.439872 5.31 3014656
+914.569216 5.11 3129344
+917.829632 4.91 3260416
+921.237504 4.70 3407872
+924.809216 4.48 3571712
+928.577536 4.25 3768320
+932.575232 4.00 3997696
+936.835072 3.76 4259840
+941.422592 3.49 4587520
+946.468864 3.17 5046272
+952.137728 2.82 5668864
+958.658560 2.45 6520832
+966.653952 2.00 7995392
+977.991680 1.41 11337728
+993.982464 1.00 15990784
+EOF
+plot $data using 1:2 with linespoints
+pause -1
@@ -0,0 +1,5204 @@
+$data <<EOF
+1.122304 14.26 1122304
+1.916928 20.14 794624
+2.568192 24.57 651264
+3.129344 28.51 561152
+3.635200 31.63 505856
+4.096000 34.72 460800
+4.524032 37.38 428032
+4.921344 40.27 397312
+5.296128 42.69 374784
+5.652480 44.90 356352
+5.992448 47.06 339968
+6.318080 49.14 325632
+6.631424 51.06 313344
+6.932480 53.15 301056
+7.223296 55.02 290816
+7.503872 57.03 280576
+7.778304 58.30 274432
+8.042496 60.56 264192
+8.300544 62.00 258048
+8.553472 63.26 252928
+8.799232 65.10 245760
+9.039872 66.49 240640
+9.275392 67.93 235520
+9.505792 69.44 230400
+9.731072 71.02 225280
+9.953280 72.00 222208
+10.170368 73.70 217088
+10.384384 74.76 214016
+10.593280 76.59 208896
+10.799104 77.74 205824
+11.001856 78.91 202752
+11.200512 80.54 198656
+11.396096 81.81 195584
+11.589632 82.67 193536
+11.780096 84.01 190464
+11.967488 85.38 187392
+12.152832 86.33 185344
+12.335104 87.78 182272
+12.515328 88.78 180224
+12.693504 89.80 178176
+12.869632 90.84 176128
+13.043712 91.91 174080
+13.215744 93.01 172032
+13.385728 94.13 169984
+13.553664 95.27 167936
+13.720576 95.86 166912
+13.885440 97.05 164864
+14.048256 98.27 162816
+14.209024 99.52 160768
+14.368768 100.16 159744
+14.526464 101.46 157696
+14.683136 102.12 156672
+14.838784 102.80 155648
+14.992384 104.17 153600
+15.143936 105.57 151552
+15.294464 106.29 150528
+15.443968 107.02 149504
+15.591424 108.51 147456
+15.738880 108.51 147456
+15.884288 110.04 145408
+16.028672 110.82 144384
+16.172032 111.61 143360
+16.314368 112.41 142336
+16.454656 114.05 140288
+16.594944 114.05 140288
+16.733184 115.74 138240
+16.871424 115.74 138240
+17.008640 116.60 137216
+17.143808 118.37 135168
+17.278976 118.37 135168
+17.413120 119.27 134144
+17.545216 121.12 132096
+17.677312 121.12 132096
+17.808384 122.07 131072
+17.938944 122.55 130560
+18.067968 124.01 129024
+18.196480 124.50 128512
+18.324480 125.00 128000
+18.451456 126.01 126976
+18.577920 126.52 126464
+18.703872 127.03 125952
+18.828288 128.60 124416
+18.952192 129.13 123904
+19.075072 130.21 122880
+19.197440 130.75 122368
+19.319296 131.30 121856
+19.440128 132.42 120832
+19.560448 132.98 120320
+19.680256 133.55 119808
+19.799552 134.12 119296
+19.917824 135.28 118272
+20.035584 135.87 117760
+20.152832 136.46 117248
+20.269568 137.06 116736
+20.385280 138.27 115712
+20.500480 138.89 115200
+20.615168 139.51 114688
+20.729344 140.13 114176
+20.842496 141.40 113152
+20.955136 142.05 112640
+21.067264 142.69 112128
+21.178880 143.35 111616
+21.289984 144.01 111104
+21.401088 144.01 111104
+21.511680 144.68 110592
+21.621248 146.03 109568
+21.730304 146.71 109056
+21.838848 147.41 108544
+21.946880 148.10 108032
+22.054400 148.81 107520
+22.161920 148.81 107520
+22.268928 149.52 107008
+22.375424 150.24 106496
+22.480896 151.70 105472
+22.585856 152.44 104960
+22.690304 153.19 104448
+22.794752 153.19 104448
+22.898688 153.94 103936
+23.002112 154.70 103424
+23.105024 155.47 102912
+23.207936 155.47 102912
+23.310336 156.25 102400
+23.412224 157.04 101888
+23.513600 157.83 101376
+23.614976 157.83 101376
+23.715840 158.63 100864
+23.816192 159.44 100352
+23.915520 161.08 99328
+24.014848 161.08 99328
+24.113664 161.92 98816
+24.211968 162.76 98304
+24.309760 163.61 97792
+24.407552 163.61 97792
+24.504832 164.47 97280
+24.601600 165.34 96768
+24.698368 165.34 96768
+24.794624 166.22 96256
+24.890368 167.11 95744
+24.986112 167.11 95744
+25.081344 168.01 95232
+25.176064 168.92 94720
+25.270784 168.92 94720
+25.364992 169.84 94208
+25.458688 170.77 93696
+25.552384 170.77 93696
+25.645568 171.70 93184
+25.738752 171.70 93184
+25.831424 172.65 92672
+25.923584 173.61 92160
+26.015744 173.61 92160
+26.107392 174.58 91648
+26.198528 175.56 91136
+26.289664 175.56 91136
+26.380288 176.55 90624
+26.470912 176.55 90624
+26.561024 177.56 90112
+26.650624 178.57 89600
+26.740224 178.57 89600
+26.829312 179.60 89088
+26.918400 179.60 89088
+27.007488 179.60 89088
+27.096576 179.60 89088
+27.185152 180.64 88576
+27.273216 181.69 88064
+27.361280 181.69 88064
+27.448832 182.75 87552
+27.536384 182.75 87552
+27.623424 183.82 87040
+27.710464 183.82 87040
+27.796992 184.91 86528
+27.883520 184.91 86528
+27.969536 186.01 86016
+28.055552 186.01 86016
+28.141056 187.13 85504
+28.226048 188.25 84992
+28.311040 188.25 84992
+28.395520 189.39 84480
+28.480000 189.39 84480
+28.563968 190.55 83968
+28.647936 190.55 83968
+28.731392 191.72 83456
+28.814848 191.72 83456
+28.898304 191.72 83456
+28.981760 191.72 83456
+29.064704 192.90 82944
+29.147648 192.90 82944
+29.230080 194.10 82432
+29.312512 194.10 82432
+29.394432 195.31 81920
+29.476352 195.31 81920
+29.557760 196.54 81408
+29.639168 196.54 81408
+29.720064 197.78 80896
+29.800960 197.78 80896
+29.881344 199.04 80384
+29.961728 199.04 80384
+30.042112 199.04 80384
+30.122496 199.04 80384
+30.202880 199.04 80384
+30.282880 200.00 80000
+30.442880 200.00 80000
+30.602880 200.00 80000
+30.762880 200.00 80000
+30.922880 200.00 80000
+31.082880 200.00 80000
+31.242880 200.00 80000
+31.402880 200.00 80000
+31.562880 200.00 80000
+31.722880 200.00 80000
+31.882880 200.00 80000
+32.042880 200.00 80000
+32.202880 200.00 80000
+32.362880 200.00 80000
+32.522880 200.00 80000
+32.682880 200.00 80000
+32.842880 200.00 80000
+33.002880 200.00 80000
+33.162880 200.00 80000
+33.322880 200.00 80000
+33.482880 200.00 80000
+33.642880 200.00 80000
+33.802880 200.00 80000
+33.962880 200.00 80000
+34.122880 200.00 80000
+34.282880 200.00 80000
+34.442880 200.00 80000
+34.602880 200.00 80000
+34.762880 200.00 80000
+34.922880 200.00 80000
+35.082880 200.00 80000
+35.242880 200.00 80000
+35.402880 200.00 80000
+35.562880 200.00 80000
+35.722880 200.00 80000
+35.882880 200.00 80000
+36.042880 200.00 80000
+36.202880 200.00 80000
+36.362880 200.00 80000
+36.522880 200.00 80000
+36.682880 200.00 80000
+36.842880 200.00 80000
+37.002880 200.00 80000
+37.162880 200.00 80000
+37.322880 200.00 80000
+37.482880 200.00 80000
+37.642880 200.00 80000
+37.802880 200.00 80000
+37.962880 200.00 80000
+38.122880 200.00 80000
+38.282880 200.00 80000
+38.442880 200.00 80000
+38.602880 200.00 80000
+38.762880 200.00 80000
+38.922880 200.00 80000
+39.082880 200.00 80000
+39.242880 200.00 80000
+39.402880 200.00 80000
+39.562880 200.00 80000
+39.722880 200.00 80000
+39.882880 200.00 80000
+40.042880 200.00 80000
+40.202880 200.00 80000
+40.362880 200.00 80000
+40.522880 200.00 80000
+40.682880 200.00 80000
+40.842880 200.00 80000
+41.002880 200.00 80000
+41.162880 200.00 80000
+41.322880 200.00 80000
+41.482880 200.00 80000
+41.642880 200.00 80000
+41.802880 200.00 80000
+41.962880 200.00 80000
+42.122880 200.00 80000
+42.282880 200.00 80000
+42.442880 200.00 80000
+42.602880 200.00 80000
+42.762880 200.00 80000
+42.922880 200.00 80000
+43.082880 200.00 80000
+43.242880 200.00 80000
+43.402880 200.00 80000
+43.562880 200.00 80000
+43.722880 200.00 80000
+43.882880 200.00 80000
+44.042880 200.00 80000
+44.202880 200.00 80000
+44.362880 200.00 80000
+44.522880 200.00 80000
+44.682880 200.00 80000
+44.842880 200.00 80000
+45.002880 200.00 80000
+45.162880 200.00 80000
+45.322880 200.00 80000
+45.482880 200.00 80000
+45.642880 200.00 80000
+45.802880 200.00 80000
+45.962880 200.00 80000
+46.122880 200.00 80000
+46.282880 200.00 80000
+46.442880 200.00 80000
+46.602880 200.00 80000
+46.762880 200.00 80000
+46.922880 200.00 80000
+47.082880 200.00 80000
+47.242880 200.00 80000
+47.402880 200.00 80000
+47.562880 200.00 80000
+47.722880 200.00 80000
+47.882880 200.00 80000
+48.042880 200.00 80000
+48.202880 200.00 80000
+48.362880 200.00 80000
+48.522880 200.00 80000
+48.682880 200.00 80000
+48.842880 200.00 80000
+49.002880 200.00 80000
+49.162880 200.00 80000
+49.322880 200.00 80000
+49.482880 200.00 80000
+49.642880 200.00 80000
+49.802880 200.00 80000
+49.962880 200.00 80000
+50.122880 200.00 80000
+50.282880 200.00 80000
+50.442880 200.00 80000
+50.602880 200.00 80000
+50.762880 200.00 80000
+50.922880 200.00 80000
+51.082880 200.00 80000
+51.242880 200.00 80000
+51.402880 200.00 80000
+51.562880 200.00 80000
+51.722880 200.00 80000
+51.882880 200.00 80000
+52.042880 200.00 80000
+52.202880 200.00 80000
+52.362880 200.00 80000
+52.522880 200.00 80000
+52.682880 200.00 80000
+52.842880 200.00 80000
+53.002880 200.00 80000
+53.162880 200.00 80000
+53.322880 200.00 80000
+53.482880 200.00 80000
+53.642880 200.00 80000
+53.802880 200.00 80000
+53.962880 200.00 80000
+54.122880 200.00 80000
+54.282880 200.00 80000
+54.442880 200.00 80000
+54.602880 200.00 80000
+54.762880 200.00 80000
+54.922880 200.00 80000
+55.082880 200.00 80000
+55.242880 200.00 80000
+55.402880 200.00 80000
+55.562880 200.00 80000
+55.722880 200.00 80000
+55.882880 200.00 80000
+56.042880 200.00 80000
+56.202880 200.00 80000
+56.362880 200.00 80000
+56.522880 200.00 80000
+56.682880 200.00 80000
+56.842880 200.00 80000
+57.002880 200.00 80000
+57.162880 200.00 80000
+57.322880 200.00 80000
+57.482880 200.00 80000
+57.642880 200.00 80000
+57.802880 200.00 80000
+57.962880 200.00 80000
+58.122880 200.00 80000
+58.282880 200.00 80000
+58.442880 200.00 80000
+58.602880 200.00 80000
+58.762880 200.00 80000
+58.922880 200.00 80000
+59.082880 200.00 80000
+59.242880 200.00 80000
+59.402880 200.00 80000
+59.562880 200.00 80000
+59.722880 200.00 80000
+59.882880 200.00 80000
+60.042880 200.00 80000
+60.202880 200.00 80000
+60.362880 200.00 80000
+60.522880 200.00 80000
+60.682880 200.00 80000
+60.842880 200.00 80000
+61.002880 200.00 80000
+61.162880 200.00 80000
+61.322880 200.00 80000
+61.482880 200.00 80000
+61.642880 200.00 80000
+61.802880 200.00 80000
+61.962880 200.00 80000
+62.122880 200.00 80000
+62.282880 200.00 80000
+62.442880 200.00 80000
+62.602880 200.00 80000
+62.762880 200.00 80000
+62.922880 200.00 80000
+63.082880 200.00 80000
+63.242880 200.00 80000
+63.402880 200.00 80000
+63.562880 200.00 80000
+63.722880 200.00 80000
+63.882880 200.00 80000
+64.042880 200.00 80000
+64.202880 200.00 80000
+64.362880 200.00 80000
+64.522880 200.00 80000
+64.682880 200.00 80000
+64.842880 200.00 80000
+65.002880 200.00 80000
+65.162880 200.00 80000
+65.322880 200.00 80000
+65.482880 200.00 80000
+65.642880 200.00 80000
+65.802880 200.00 80000
+65.962880 200.00 80000
+66.122880 200.00 80000
+66.282880 200.00 80000
+66.442880 200.00 80000
+66.602880 200.00 80000
+66.762880 200.00 80000
+66.922880 200.00 80000
+67.082880 200.00 80000
+67.242880 200.00 80000
+67.402880 200.00 80000
+67.562880 200.00 80000
+67.722880 200.00 80000
+67.882880 200.00 80000
+68.042880 200.00 80000
+68.202880 200.00 80000
+68.362880 200.00 80000
+68.522880 200.00 80000
+68.682880 200.00 80000
+68.842880 200.00 80000
+69.002880 200.00 80000
+69.162880 200.00 80000
+69.322880 200.00 80000
+69.482880 200.00 80000
+69.642880 200.00 80000
+69.802880 200.00 80000
+69.962880 200.00 80000
+70.122880 200.00 80000
+70.282880 200.00 80000
+70.442880 200.00 80000
+70.602880 200.00 80000
+70.762880 200.00 80000
+70.922880 200.00 80000
+71.082880 200.00 80000
+71.242880 200.00 80000
+71.402880 200.00 80000
+71.562880 200.00 80000
+71.722880 200.00 80000
+71.882880 200.00 80000
+72.042880 200.00 80000
+72.202880 200.00 80000
+72.362880 200.00 80000
+72.522880 200.00 80000
+72.682880 200.00 80000
+72.842880 200.00 80000
+73.002880 200.00 80000
+73.162880 200.00 80000
+73.322880 200.00 80000
+73.482880 200.00 80000
+73.642880 200.00 80000
+73.802880 200.00 80000
+73.962880 200.00 80000
+74.122880 200.00 80000
+74.282880 200.00 80000
+74.442880 200.00 80000
+74.602880 200.00 80000
+74.762880 200.00 80000
+74.922880 200.00 80000
+75.082880 200.00 80000
+75.242880 200.00 80000
+75.402880 200.00 80000
+75.562880 200.00 80000
+75.722880 200.00 80000
+75.882880 200.00 80000
+76.042880 200.00 80000
+76.202880 200.00 80000
+76.362880 200.00 80000
+76.522880 200.00 80000
+76.682880 200.00 80000
+76.842880 200.00 80000
+77.002880 200.00 80000
+77.162880 200.00 80000
+77.322880 200.00 80000
+77.482880 200.00 80000
+77.642880 200.00 80000
+77.802880 200.00 80000
+77.962880 200.00 80000
+78.122880 200.00 80000
+78.282880 200.00 80000
+78.442880 200.00 80000
+78.602880 200.00 80000
+78.762880 200.00 80000
+78.922880 200.00 80000
+79.082880 200.00 80000
+79.242880 200.00 80000
+79.402880 200.00 80000
+79.562880 200.00 80000
+79.722880 200.00 80000
+79.882880 200.00 80000
+80.042880 200.00 80000
+80.202880 200.00 80000
+80.362880 200.00 80000
+80.522880 200.00 80000
+80.682880 200.00 80000
+80.842880 200.00 80000
+81.002880 200.00 80000
+81.162880 200.00 80000
+81.322880 200.00 80000
+81.482880 200.00 80000
+81.642880 200.00 80000
+81.802880 200.00 80000
+81.962880 200.00 80000
+82.122880 200.00 80000
+82.282880 200.00 80000
+82.442880 200.00 80000
+82.602880 200.00 80000
+82.762880 200.00 80000
+82.922880 200.00 80000
+83.082880 200.00 80000
+83.242880 200.00 80000
+83.402880 200.00 80000
+83.562880 200.00 80000
+83.722880 200.00 80000
+83.882880 200.00 80000
+84.042880 200.00 80000
+84.202880 200.00 80000
+84.362880 200.00 80000
+84.522880 200.00 80000
+84.682880 200.00 80000
+84.842880 200.00 80000
+85.002880 200.00 80000
+85.162880 200.00 80000
+85.322880 200.00 80000
+85.482880 200.00 80000
+85.642880 200.00 80000
+85.802880 200.00 80000
+85.962880 200.00 80000
+86.122880 200.00 80000
+86.282880 200.00 80000
+86.442880 200.00 80000
+86.602880 200.00 80000
+86.762880 200.00 80000
+86.922880 200.00 80000
+87.082880 200.00 80000
+87.242880 200.00 80000
+87.402880 200.00 80000
+87.562880 200.00 80000
+87.722880 200.00 80000
+87.882880 200.00 80000
+88.042880 200.00 80000
+88.202880 200.00 80000
+88.362880 200.00 80000
+88.522880 200.00 80000
+88.682880 200.00 80000
+88.842880 200.00 80000
+89.002880 200.00 80000
+89.162880 200.00 80000
+89.322880 200.00 80000
+89.482880 200.00 80000
+89.642880 200.00 80000
+89.802880 200.00 80000
+89.962880 200.00 80000
+90.122880 200.00 80000
+90.282880 200.00 80000
+90.442880 200.00 80000
+90.602880 200.00 80000
+90.762880 200.00 80000
+90.922880 200.00 80000
+91.082880 200.00 80000
+91.242880 200.00 80000
+91.402880 200.00 80000
+91.562880 200.00 80000
+91.722880 200.00 80000
+91.882880 200.00 80000
+92.042880 200.00 80000
+92.202880 200.00 80000
+92.362880 200.00 80000
+92.522880 200.00 80000
+92.682880 200.00 80000
+92.842880 200.00 80000
+93.002880 200.00 80000
+93.162880 200.00 80000
+93.322880 200.00 80000
+93.482880 200.00 80000
+93.642880 200.00 80000
+93.802880 200.00 80000
+93.962880 200.00 80000
+94.122880 200.00 80000
+94.282880 200.00 80000
+94.442880 200.00 80000
+94.602880 200.00 80000
+94.762880 200.00 80000
+94.922880 200.00 80000
+95.082880 200.00 80000
+95.242880 200.00 80000
+95.402880 200.00 80000
+95.562880 200.00 80000
+95.722880 200.00 80000
+95.882880 200.00 80000
+96.042880 200.00 80000
+96.202880 200.00 80000
+96.362880 200.00 80000
+96.522880 200.00 80000
+96.682880 200.00 80000
+96.842880 200.00 80000
+97.002880 200.00 80000
+97.162880 200.00 80000
+97.322880 200.00 80000
+97.482880 200.00 80000
+97.642880 200.00 80000
+97.802880 200.00 80000
+97.962880 200.00 80000
+98.122880 200.00 80000
+98.282880 200.00 80000
+98.442880 200.00 80000
+98.602880 200.00 80000
+98.762880 200.00 80000
+98.922880 200.00 80000
+99.082880 200.00 80000
+99.242880 200.00 80000
+99.402880 200.00 80000
+99.562880 200.00 80000
+99.722880 200.00 80000
+99.882880 200.00 80000
+100.042880 200.00 80000
+100.202880 200.00 80000
+100.362880 200.00 80000
+100.522880 200.00 80000
+100.682880 200.00 80000
+100.842880 200.00 80000
+101.002880 200.00 80000
+101.162880 200.00 80000
+101.322880 200.00 80000
+101.482880 200.00 80000
+101.642880 200.00 80000
+101.802880 200.00 80000
+101.962880 200.00 80000
+102.122880 200.00 80000
+102.282880 200.00 80000
+102.442880 200.00 80000
+102.602880 200.00 80000
+102.762880 200.00 80000
+102.922880 200.00 80000
+103.082880 200.00 80000
+103.242880 200.00 80000
+103.402880 200.00 80000
+103.562880 200.00 80000
+103.722880 200.00 80000
+103.882880 200.00 80000
+104.042880 200.00 80000
+104.202880 200.00 80000
+104.362880 200.00 80000
+104.522880 200.00 80000
+104.682880 200.00 80000
+104.842880 200.00 80000
+105.002880 200.00 80000
+105.162880 200.00 80000
+105.322880 200.00 80000
+105.482880 200.00 80000
+105.642880 200.00 80000
+105.802880 200.00 80000
+105.962880 200.00 80000
+106.122880 200.00 80000
+106.282880 200.00 80000
+106.442880 200.00 80000
+106.602880 200.00 80000
+106.762880 200.00 80000
+106.922880 200.00 80000
+107.082880 200.00 80000
+107.242880 200.00 80000
+107.402880 200.00 80000
+107.562880 200.00 80000
+107.722880 200.00 80000
+107.882880 200.00 80000
+108.042880 200.00 80000
+108.202880 200.00 80000
+108.362880 200.00 80000
+108.522880 200.00 80000
+108.682880 200.00 80000
+108.842880 200.00 80000
+109.002880 200.00 80000
+109.162880 200.00 80000
+109.322880 200.00 80000
+109.482880 200.00 80000
+109.642880 200.00 80000
+109.802880 200.00 80000
+109.962880 200.00 80000
+110.122880 200.00 80000
+110.282880 200.00 80000
+110.442880 200.00 80000
+110.602880 200.00 80000
+110.762880 200.00 80000
+110.922880 200.00 80000
+111.082880 200.00 80000
+111.242880 200.00 80000
+111.402880 200.00 80000
+111.562880 200.00 80000
+111.722880 200.00 80000
+111.882880 200.00 80000
+112.042880 200.00 80000
+112.202880 200.00 80000
+112.362880 200.00 80000
+112.522880 200.00 80000
+112.682880 200.00 80000
+112.842880 200.00 80000
+113.002880 200.00 80000
+113.162880 200.00 80000
+113.322880 200.00 80000
+113.482880 200.00 80000
+113.642880 200.00 80000
+113.802880 200.00 80000
+113.962880 200.00 80000
+114.122880 200.00 80000
+114.282880 200.00 80000
+114.442880 200.00 80000
+114.602880 200.00 80000
+114.762880 200.00 80000
+114.922880 200.00 80000
+115.082880 200.00 80000
+115.242880 200.00 80000
+115.402880 200.00 80000
+115.562880 200.00 80000
+115.722880 200.00 80000
+115.882880 200.00 80000
+116.042880 200.00 80000
+116.202880 200.00 80000
+116.362880 200.00 80000
+116.522880 200.00 80000
+116.682880 200.00 80000
+116.842880 200.00 80000
+117.002880 200.00 80000
+117.162880 200.00 80000
+117.322880 200.00 80000
+117.482880 200.00 80000
+117.642880 200.00 80000
+117.802880 200.00 80000
+117.962880 200.00 80000
+118.122880 200.00 80000
+118.282880 200.00 80000
+118.442880 200.00 80000
+118.602880 200.00 80000
+118.762880 200.00 80000
+118.922880 200.00 80000
+119.082880 200.00 80000
+119.242880 200.00 80000
+119.402880 200.00 80000
+119.562880 200.00 80000
+119.722880 200.00 80000
+119.882880 200.00 80000
+120.042880 200.00 80000
+120.202880 200.00 80000
+120.362880 200.00 80000
+120.522880 200.00 80000
+120.682880 200.00 80000
+120.842880 200.00 80000
+121.002880 200.00 80000
+121.162880 200.00 80000
+121.322880 200.00 80000
+121.482880 200.00 80000
+121.642880 200.00 80000
+121.802880 200.00 80000
+121.962880 200.00 80000
+122.122880 200.00 80000
+122.282880 200.00 80000
+122.442880 200.00 80000
+122.602880 200.00 80000
+122.762880 200.00 80000
+122.922880 200.00 80000
+123.082880 200.00 80000
+123.242880 200.00 80000
+123.402880 200.00 80000
+123.562880 200.00 80000
+123.722880 200.00 80000
+123.882880 200.00 80000
+124.042880 200.00 80000
+124.202880 200.00 80000
+124.362880 200.00 80000
+124.522880 200.00 80000
+124.682880 200.00 80000
+124.842880 200.00 80000
+125.002880 200.00 80000
+125.162880 200.00 80000
+125.322880 200.00 80000
+125.482880 200.00 80000
+125.642880 200.00 80000
+125.802880 200.00 80000
+125.962880 200.00 80000
+126.122880 200.00 80000
+126.282880 200.00 80000
+126.442880 200.00 80000
+126.602880 200.00 80000
+126.762880 200.00 80000
+126.922880 200.00 80000
+127.082880 200.00 80000
+127.242880 200.00 80000
+127.402880 200.00 80000
+127.562880 200.00 80000
+127.722880 200.00 80000
+127.882880 200.00 80000
+128.042880 200.00 80000
+128.202880 200.00 80000
+128.362880 200.00 80000
+128.522880 200.00 80000
+128.682880 200.00 80000
+128.842880 200.00 80000
+129.002880 200.00 80000
+129.162880 200.00 80000
+129.322880 200.00 80000
+129.482880 200.00 80000
+129.642880 200.00 80000
+129.802880 200.00 80000
+129.962880 200.00 80000
+130.122880 200.00 80000
+130.282880 200.00 80000
+130.442880 200.00 80000
+130.602880 200.00 80000
+130.762880 200.00 80000
+130.922880 200.00 80000
+131.082880 200.00 80000
+131.242880 200.00 80000
+131.402880 200.00 80000
+131.562880 200.00 80000
+131.722880 200.00 80000
+131.882880 200.00 80000
+132.042880 200.00 80000
+132.202880 200.00 80000
+132.362880 200.00 80000
+132.522880 200.00 80000
+132.682880 200.00 80000
+132.842880 200.00 80000
+133.002880 200.00 80000
+133.162880 200.00 80000
+133.322880 200.00 80000
+133.482880 200.00 80000
+133.642880 200.00 80000
+133.802880 200.00 80000
+133.962880 200.00 80000
+134.122880 200.00 80000
+134.282880 200.00 80000
+134.442880 200.00 80000
+134.602880 200.00 80000
+134.762880 200.00 80000
+134.922880 200.00 80000
+135.082880 200.00 80000
+135.242880 200.00 80000
+135.402880 200.00 80000
+135.562880 200.00 80000
+135.722880 200.00 80000
+135.882880 200.00 80000
+136.042880 200.00 80000
+136.202880 200.00 80000
+136.362880 200.00 80000
+136.522880 200.00 80000
+136.682880 200.00 80000
+136.842880 200.00 80000
+137.002880 200.00 80000
+137.162880 200.00 80000
+137.322880 200.00 80000
+137.482880 200.00 80000
+137.642880 200.00 80000
+137.802880 200.00 80000
+137.962880 200.00 80000
+138.122880 200.00 80000
+138.282880 200.00 80000
+138.442880 200.00 80000
+138.602880 200.00 80000
+138.762880 200.00 80000
+138.922880 200.00 80000
+139.082880 200.00 80000
+139.242880 200.00 80000
+139.402880 200.00 80000
+139.562880 200.00 80000
+139.722880 200.00 80000
+139.882880 200.00 80000
+140.042880 200.00 80000
+140.202880 200.00 80000
+140.362880 200.00 80000
+140.522880 200.00 80000
+140.682880 200.00 80000
+140.842880 200.00 80000
+141.002880 200.00 80000
+141.162880 200.00 80000
+141.322880 200.00 80000
+141.482880 200.00 80000
+141.642880 200.00 80000
+141.802880 200.00 80000
+141.962880 200.00 80000
+142.122880 200.00 80000
+142.282880 200.00 80000
+142.442880 200.00 80000
+142.602880 200.00 80000
+142.762880 200.00 80000
+142.922880 200.00 80000
+143.082880 200.00 80000
+143.242880 200.00 80000
+143.402880 200.00 80000
+143.562880 200.00 80000
+143.722880 200.00 80000
+143.882880 200.00 80000
+144.042880 200.00 80000
+144.202880 200.00 80000
+144.362880 200.00 80000
+144.522880 200.00 80000
+144.682880 200.00 80000
+144.842880 200.00 80000
+145.002880 200.00 80000
+145.162880 200.00 80000
+145.322880 200.00 80000
+145.482880 200.00 80000
+145.642880 200.00 80000
+145.802880 200.00 80000
+145.962880 200.00 80000
+146.122880 200.00 80000
+146.282880 200.00 80000
+146.442880 200.00 80000
+146.602880 200.00 80000
+146.762880 200.00 80000
+146.922880 200.00 80000
+147.082880 200.00 80000
+147.242880 200.00 80000
+147.402880 200.00 80000
+147.562880 200.00 80000
+147.722880 200.00 80000
+147.882880 200.00 80000
+148.042880 200.00 80000
+148.202880 200.00 80000
+148.362880 200.00 80000
+148.522880 200.00 80000
+148.682880 200.00 80000
+148.842880 200.00 80000
+149.002880 200.00 80000
+149.162880 200.00 80000
+149.322880 200.00 80000
+149.482880 200.00 80000
+149.642880 200.00 80000
+149.802880 200.00 80000
+149.962880 200.00 80000
+150.122880 200.00 80000
+150.282880 200.00 80000
+150.442880 200.00 80000
+150.602880 200.00 80000
+150.762880 200.00 80000
+150.922880 200.00 80000
+151.082880 200.00 80000
+151.242880 200.00 80000
+151.402880 200.00 80000
+151.562880 200.00 80000
+151.722880 200.00 80000
+151.882880 200.00 80000
+152.042880 200.00 80000
+152.202880 200.00 80000
+152.362880 200.00 80000
+152.522880 200.00 80000
+152.682880 200.00 80000
+152.842880 200.00 80000
+153.002880 200.00 80000
+153.162880 200.00 80000
+153.322880 200.00 80000
+153.482880 200.00 80000
+153.642880 200.00 80000
+153.802880 200.00 80000
+153.962880 200.00 80000
+154.122880 200.00 80000
+154.282880 200.00 80000
+154.442880 200.00 80000
+154.602880 200.00 80000
+154.762880 200.00 80000
+154.922880 200.00 80000
+155.082880 200.00 80000
+155.242880 200.00 80000
+155.402880 200.00 80000
+155.562880 200.00 80000
+155.722880 200.00 80000
+155.882880 200.00 80000
+156.042880 200.00 80000
+156.202880 200.00 80000
+156.362880 200.00 80000
+156.522880 200.00 80000
+156.682880 200.00 80000
+156.842880 200.00 80000
+157.002880 200.00 80000
+157.162880 200.00 80000
+157.322880 200.00 80000
+157.482880 200.00 80000
+157.642880 200.00 80000
+157.802880 200.00 80000
+157.962880 200.00 80000
+158.122880 200.00 80000
+158.282880 200.00 80000
+158.442880 200.00 80000
+158.602880 200.00 80000
+158.762880 200.00 80000
+158.922880 200.00 80000
+159.082880 200.00 80000
+159.242880 200.00 80000
+159.402880 200.00 80000
+159.562880 200.00 80000
+159.722880 200.00 80000
+159.882880 200.00 80000
+160.042880 200.00 80000
+160.202880 200.00 80000
+160.362880 200.00 80000
+160.522880 200.00 80000
+160.682880 200.00 80000
+160.842880 200.00 80000
+161.002880 200.00 80000
+161.162880 200.00 80000
+161.322880 200.00 80000
+161.482880 200.00 80000
+161.642880 200.00 80000
+161.802880 200.00 80000
+161.962880 200.00 80000
+162.122880 200.00 80000
+162.282880 200.00 80000
+162.442880 200.00 80000
+162.602880 200.00 80000
+162.762880 200.00 80000
+162.922880 200.00 80000
+163.082880 200.00 80000
+163.242880 200.00 80000
+163.402880 200.00 80000
+163.562880 200.00 80000
+163.722880 200.00 80000
+163.882880 200.00 80000
+164.042880 200.00 80000
+164.202880 200.00 80000
+164.362880 200.00 80000
+164.522880 200.00 80000
+164.682880 200.00 80000
+164.842880 200.00 80000
+165.002880 200.00 80000
+165.162880 200.00 80000
+165.322880 200.00 80000
+165.482880 200.00 80000
+165.642880 200.00 80000
+165.802880 200.00 80000
+165.962880 200.00 80000
+166.122880 200.00 80000
+166.282880 200.00 80000
+166.442880 200.00 80000
+166.602880 200.00 80000
+166.762880 200.00 80000
+166.922880 200.00 80000
+167.082880 200.00 80000
+167.242880 200.00 80000
+167.402880 200.00 80000
+167.562880 200.00 80000
+167.722880 200.00 80000
+167.882880 200.00 80000
+168.042880 200.00 80000
+168.202880 200.00 80000
+168.362880 200.00 80000
+168.522880 200.00 80000
+168.682880 200.00 80000
+168.842880 200.00 80000
+169.002880 200.00 80000
+169.162880 200.00 80000
+169.322880 200.00 80000
+169.482880 200.00 80000
+169.642880 200.00 80000
+169.802880 200.00 80000
+169.962880 200.00 80000
+170.122880 200.00 80000
+170.282880 200.00 80000
+170.442880 200.00 80000
+170.602880 200.00 80000
+170.762880 200.00 80000
+170.922880 200.00 80000
+171.082880 200.00 80000
+171.242880 200.00 80000
+171.402880 200.00 80000
+171.562880 200.00 80000
+171.722880 200.00 80000
+171.882880 200.00 80000
+172.042880 200.00 80000
+172.202880 200.00 80000
+172.362880 200.00 80000
+172.522880 200.00 80000
+172.682880 200.00 80000
+172.842880 200.00 80000
+173.002880 200.00 80000
+173.162880 200.00 80000
+173.322880 200.00 80000
+173.482880 200.00 80000
+173.642880 200.00 80000
+173.802880 200.00 80000
+173.962880 200.00 80000
+174.122880 200.00 80000
+174.282880 200.00 80000
+174.442880 200.00 80000
+174.602880 200.00 80000
+174.762880 200.00 80000
+174.922880 200.00 80000
+175.082880 200.00 80000
+175.242880 200.00 80000
+175.402880 200.00 80000
+175.562880 200.00 80000
+175.722880 200.00 80000
+175.882880 200.00 80000
+176.042880 200.00 80000
+176.202880 200.00 80000
+176.362880 200.00 80000
+176.522880 200.00 80000
+176.682880 200.00 80000
+176.842880 200.00 80000
+177.002880 200.00 80000
+177.162880 200.00 80000
+177.322880 200.00 80000
+177.482880 200.00 80000
+177.642880 200.00 80000
+177.802880 200.00 80000
+177.962880 200.00 80000
+178.122880 200.00 80000
+178.282880 200.00 80000
+178.442880 200.00 80000
+178.602880 200.00 80000
+178.762880 200.00 80000
+178.922880 200.00 80000
+179.082880 200.00 80000
+179.242880 200.00 80000
+179.402880 200.00 80000
+179.562880 200.00 80000
+179.722880 200.00 80000
+179.882880 200.00 80000
+180.042880 200.00 80000
+180.202880 200.00 80000
+180.362880 200.00 80000
+180.522880 200.00 80000
+180.682880 200.00 80000
+180.842880 200.00 80000
+181.002880 200.00 80000
+181.162880 200.00 80000
+181.322880 200.00 80000
+181.482880 200.00 80000
+181.642880 200.00 80000
+181.802880 200.00 80000
+181.962880 200.00 80000
+182.122880 200.00 80000
+182.282880 200.00 80000
+182.442880 200.00 80000
+182.602880 200.00 80000
+182.762880 200.00 80000
+182.922880 200.00 80000
+183.082880 200.00 80000
+183.242880 200.00 80000
+183.402880 200.00 80000
+183.562880 200.00 80000
+183.722880 200.00 80000
+183.882880 200.00 80000
+184.042880 200.00 80000
+184.202880 200.00 80000
+184.362880 200.00 80000
+184.522880 200.00 80000
+184.682880 200.00 80000
+184.842880 200.00 80000
+185.002880 200.00 80000
+185.162880 200.00 80000
+185.322880 200.00 80000
+185.482880 200.00 80000
+185.642880 200.00 80000
+185.802880 200.00 80000
+185.962880 200.00 80000
+186.122880 200.00 80000
+186.282880 200.00 80000
+186.442880 200.00 80000
+186.602880 200.00 80000
+186.762880 200.00 80000
+186.922880 200.00 80000
+187.082880 200.00 80000
+187.242880 200.00 80000
+187.402880 200.00 80000
+187.562880 200.00 80000
+187.722880 200.00 80000
+187.882880 200.00 80000
+188.042880 200.00 80000
+188.202880 200.00 80000
+188.362880 200.00 80000
+188.522880 200.00 80000
+188.682880 200.00 80000
+188.842880 200.00 80000
+189.002880 200.00 80000
+189.162880 200.00 80000
+189.322880 200.00 80000
+189.482880 200.00 80000
+189.642880 200.00 80000
+189.802880 200.00 80000
+189.962880 200.00 80000
+190.122880 200.00 80000
+190.282880 200.00 80000
+190.442880 200.00 80000
+190.602880 200.00 80000
+190.762880 200.00 80000
+190.922880 200.00 80000
+191.082880 200.00 80000
+191.242880 200.00 80000
+191.402880 200.00 80000
+191.562880 200.00 80000
+191.722880 200.00 80000
+191.882880 200.00 80000
+192.042880 200.00 80000
+192.202880 200.00 80000
+192.362880 200.00 80000
+192.522880 200.00 80000
+192.682880 200.00 80000
+192.842880 200.00 80000
+193.002880 200.00 80000
+193.162880 200.00 80000
+193.322880 200.00 80000
+193.482880 200.00 80000
+193.642880 200.00 80000
+193.802880 200.00 80000
+193.962880 200.00 80000
+194.122880 200.00 80000
+194.282880 200.00 80000
+194.442880 200.00 80000
+194.602880 200.00 80000
+194.762880 200.00 80000
+194.922880 200.00 80000
+195.082880 200.00 80000
+195.242880 200.00 80000
+195.402880 200.00 80000
+195.562880 200.00 80000
+195.722880 200.00 80000
+195.882880 200.00 80000
+196.042880 200.00 80000
+196.202880 200.00 80000
+196.362880 200.00 80000
+196.522880 200.00 80000
+196.682880 200.00 80000
+196.842880 200.00 80000
+197.002880 200.00 80000
+197.162880 200.00 80000
+197.322880 200.00 80000
+197.482880 200.00 80000
+197.642880 200.00 80000
+197.802880 200.00 80000
+197.962880 200.00 80000
+198.122880 200.00 80000
+198.282880 200.00 80000
+198.442880 200.00 80000
+198.602880 200.00 80000
+198.762880 200.00 80000
+198.922880 200.00 80000
+199.082880 200.00 80000
+199.242880 200.00 80000
+199.402880 200.00 80000
+199.562880 200.00 80000
+199.722880 200.00 80000
+199.882880 200.00 80000
+200.042880 200.00 80000
+200.202880 200.00 80000
+200.362880 200.00 80000
+200.522880 200.00 80000
+200.682880 200.00 80000
+200.842880 200.00 80000
+201.002880 200.00 80000
+201.162880 200.00 80000
+201.322880 200.00 80000
+201.482880 200.00 80000
+201.642880 200.00 80000
+201.802880 200.00 80000
+201.962880 200.00 80000
+202.122880 200.00 80000
+202.282880 200.00 80000
+202.442880 200.00 80000
+202.602880 200.00 80000
+202.762880 200.00 80000
+202.922880 200.00 80000
+203.082880 200.00 80000
+203.242880 200.00 80000
+203.402880 200.00 80000
+203.562880 200.00 80000
+203.722880 200.00 80000
+203.882880 200.00 80000
+204.042880 200.00 80000
+204.202880 200.00 80000
+204.362880 200.00 80000
+204.522880 200.00 80000
+204.682880 200.00 80000
+204.842880 200.00 80000
+205.002880 200.00 80000
+205.162880 200.00 80000
+205.322880 200.00 80000
+205.482880 200.00 80000
+205.642880 200.00 80000
+205.802880 200.00 80000
+205.962880 200.00 80000
+206.122880 200.00 80000
+206.282880 200.00 80000
+206.442880 200.00 80000
+206.602880 200.00 80000
+206.762880 200.00 80000
+206.922880 200.00 80000
+207.082880 200.00 80000
+207.242880 200.00 80000
+207.402880 200.00 80000
+207.562880 200.00 80000
+207.722880 200.00 80000
+207.882880 200.00 80000
+208.042880 200.00 80000
+208.202880 200.00 80000
+208.362880 200.00 80000
+208.522880 200.00 80000
+208.682880 200.00 80000
+208.842880 200.00 80000
+209.002880 200.00 80000
+209.162880 200.00 80000
+209.322880 200.00 80000
+209.482880 200.00 80000
+209.642880 200.00 80000
+209.802880 200.00 80000
+209.962880 200.00 80000
+210.122880 200.00 80000
+210.282880 200.00 80000
+210.442880 200.00 80000
+210.602880 200.00 80000
+210.762880 200.00 80000
+210.922880 200.00 80000
+211.082880 200.00 80000
+211.242880 200.00 80000
+211.402880 200.00 80000
+211.562880 200.00 80000
+211.722880 200.00 80000
+211.882880 200.00 80000
+212.042880 200.00 80000
+212.202880 200.00 80000
+212.362880 200.00 80000
+212.522880 200.00 80000
+212.682880 200.00 80000
+212.842880 200.00 80000
+213.002880 200.00 80000
+213.162880 200.00 80000
+213.322880 200.00 80000
+213.482880 200.00 80000
+213.642880 200.00 80000
+213.802880 200.00 80000
+213.962880 200.00 80000
+214.122880 200.00 80000
+214.282880 200.00 80000
+214.442880 200.00 80000
+214.602880 200.00 80000
+214.762880 200.00 80000
+214.922880 200.00 80000
+215.082880 200.00 80000
+215.242880 200.00 80000
+215.402880 200.00 80000
+215.562880 200.00 80000
+215.722880 200.00 80000
+215.882880 200.00 80000
+216.042880 200.00 80000
+216.202880 200.00 80000
+216.362880 200.00 80000
+216.522880 200.00 80000
+216.682880 200.00 80000
+216.842880 200.00 80000
+217.002880 200.00 80000
+217.162880 200.00 80000
+217.322880 200.00 80000
+217.482880 200.00 80000
+217.642880 200.00 80000
+217.802880 200.00 80000
+217.962880 200.00 80000
+218.122880 200.00 80000
+218.282880 200.00 80000
+218.442880 200.00 80000
+218.602880 200.00 80000
+218.762880 200.00 80000
+218.922880 200.00 80000
+219.082880 200.00 80000
+219.242880 200.00 80000
+219.402880 200.00 80000
+219.562880 200.00 80000
+219.722880 200.00 80000
+219.882880 200.00 80000
+220.042880 200.00 80000
+220.202880 200.00 80000
+220.362880 200.00 80000
+220.522880 200.00 80000
+220.682880 200.00 80000
+220.842880 200.00 80000
+221.002880 200.00 80000
+221.162880 200.00 80000
+221.322880 200.00 80000
+221.482880 200.00 80000
+221.642880 200.00 80000
+221.802880 200.00 80000
+221.962880 200.00 80000
+222.122880 200.00 80000
+222.282880 200.00 80000
+222.442880 200.00 80000
+222.602880 200.00 80000
+222.762880 200.00 80000
+222.922880 200.00 80000
+223.082880 200.00 80000
+223.242880 200.00 80000
+223.402880 200.00 80000
+223.562880 200.00 80000
+223.722880 200.00 80000
+223.882880 200.00 80000
+224.042880 200.00 80000
+224.202880 200.00 80000
+224.362880 200.00 80000
+224.522880 200.00 80000
+224.682880 200.00 80000
+224.842880 200.00 80000
+225.002880 200.00 80000
+225.162880 200.00 80000
+225.322880 200.00 80000
+225.482880 200.00 80000
+225.642880 200.00 80000
+225.802880 200.00 80000
+225.962880 200.00 80000
+226.122880 200.00 80000
+226.282880 200.00 80000
+226.442880 200.00 80000
+226.602880 200.00 80000
+226.762880 200.00 80000
+226.922880 200.00 80000
+227.082880 200.00 80000
+227.242880 200.00 80000
+227.402880 200.00 80000
+227.562880 200.00 80000
+227.722880 200.00 80000
+227.882880 200.00 80000
+228.042880 200.00 80000
+228.202880 200.00 80000
+228.362880 200.00 80000
+228.522880 200.00 80000
+228.682880 200.00 80000
+228.842880 200.00 80000
+229.002880 200.00 80000
+229.162880 200.00 80000
+229.322880 200.00 80000
+229.482880 200.00 80000
+229.642880 200.00 80000
+229.802880 200.00 80000
+229.962880 200.00 80000
+230.122880 200.00 80000
+230.282880 200.00 80000
+230.442880 200.00 80000
+230.602880 200.00 80000
+230.762880 200.00 80000
+230.922880 200.00 80000
+231.082880 200.00 80000
+231.242880 200.00 80000
+231.402880 200.00 80000
+231.562880 200.00 80000
+231.722880 200.00 80000
+231.882880 200.00 80000
+232.042880 200.00 80000
+232.202880 200.00 80000
+232.362880 200.00 80000
+232.522880 200.00 80000
+232.682880 200.00 80000
+232.842880 200.00 80000
+233.002880 200.00 80000
+233.162880 200.00 80000
+233.322880 200.00 80000
+233.482880 200.00 80000
+233.642880 200.00 80000
+233.802880 200.00 80000
+233.962880 200.00 80000
+234.122880 200.00 80000
+234.282880 200.00 80000
+234.442880 200.00 80000
+234.602880 200.00 80000
+234.762880 200.00 80000
+234.922880 200.00 80000
+235.082880 200.00 80000
+235.242880 200.00 80000
+235.402880 200.00 80000
+235.562880 200.00 80000
+235.722880 200.00 80000
+235.882880 200.00 80000
+236.042880 200.00 80000
+236.202880 200.00 80000
+236.362880 200.00 80000
+236.522880 200.00 80000
+236.682880 200.00 80000
+236.842880 200.00 80000
+237.002880 200.00 80000
+237.162880 200.00 80000
+237.322880 200.00 80000
+237.482880 200.00 80000
+237.642880 200.00 80000
+237.802880 200.00 80000
+237.962880 200.00 80000
+238.122880 200.00 80000
+238.282880 200.00 80000
+238.442880 200.00 80000
+238.602880 200.00 80000
+238.762880 200.00 80000
+238.922880 200.00 80000
+239.082880 200.00 80000
+239.242880 200.00 80000
+239.402880 200.00 80000
+239.562880 200.00 80000
+239.722880 200.00 80000
+239.882880 200.00 80000
+240.042880 200.00 80000
+240.202880 200.00 80000
+240.362880 200.00 80000
+240.522880 200.00 80000
+240.682880 200.00 80000
+240.842880 200.00 80000
+241.002880 200.00 80000
+241.162880 200.00 80000
+241.322880 200.00 80000
+241.482880 200.00 80000
+241.642880 200.00 80000
+241.802880 200.00 80000
+241.962880 200.00 80000
+242.122880 200.00 80000
+242.282880 200.00 80000
+242.442880 200.00 80000
+242.602880 200.00 80000
+242.762880 200.00 80000
+242.922880 200.00 80000
+243.082880 200.00 80000
+243.242880 200.00 80000
+243.402880 200.00 80000
+243.562880 200.00 80000
+243.722880 200.00 80000
+243.882880 200.00 80000
+244.042880 200.00 80000
+244.202880 200.00 80000
+244.362880 200.00 80000
+244.522880 200.00 80000
+244.682880 200.00 80000
+244.842880 200.00 80000
+245.002880 200.00 80000
+245.162880 200.00 80000
+245.322880 200.00 80000
+245.482880 200.00 80000
+245.642880 200.00 80000
+245.802880 200.00 80000
+245.962880 200.00 80000
+246.122880 200.00 80000
+246.282880 200.00 80000
+246.442880 200.00 80000
+246.602880 200.00 80000
+246.762880 200.00 80000
+246.922880 200.00 80000
+247.082880 200.00 80000
+247.242880 200.00 80000
+247.402880 200.00 80000
+247.562880 200.00 80000
+247.722880 200.00 80000
+247.882880 200.00 80000
+248.042880 200.00 80000
+248.202880 200.00 80000
+248.362880 200.00 80000
+248.522880 200.00 80000
+248.682880 200.00 80000
+248.842880 200.00 80000
+249.002880 200.00 80000
+249.162880 200.00 80000
+249.322880 200.00 80000
+249.482880 200.00 80000
+249.642880 200.00 80000
+249.802880 200.00 80000
+249.962880 200.00 80000
+250.122880 200.00 80000
+250.282880 200.00 80000
+250.442880 200.00 80000
+250.602880 200.00 80000
+250.762880 200.00 80000
+250.922880 200.00 80000
+251.082880 200.00 80000
+251.242880 200.00 80000
+251.402880 200.00 80000
+251.562880 200.00 80000
+251.722880 200.00 80000
+251.882880 200.00 80000
+252.042880 200.00 80000
+252.202880 200.00 80000
+252.362880 200.00 80000
+252.522880 200.00 80000
+252.682880 200.00 80000
+252.842880 200.00 80000
+253.002880 200.00 80000
+253.162880 200.00 80000
+253.322880 200.00 80000
+253.482880 200.00 80000
+253.642880 200.00 80000
+253.802880 200.00 80000
+253.962880 200.00 80000
+254.122880 200.00 80000
+254.282880 200.00 80000
+254.442880 200.00 80000
+254.602880 200.00 80000
+254.762880 200.00 80000
+254.922880 200.00 80000
+255.082880 200.00 80000
+255.242880 200.00 80000
+255.402880 200.00 80000
+255.562880 200.00 80000
+255.722880 200.00 80000
+255.882880 200.00 80000
+256.042880 200.00 80000
+256.202880 200.00 80000
+256.362880 200.00 80000
+256.522880 200.00 80000
+256.682880 200.00 80000
+256.842880 200.00 80000
+257.002880 200.00 80000
+257.162880 200.00 80000
+257.322880 200.00 80000
+257.482880 200.00 80000
+257.642880 200.00 80000
+257.802880 200.00 80000
+257.962880 200.00 80000
+258.122880 200.00 80000
+258.282880 200.00 80000
+258.442880 200.00 80000
+258.602880 200.00 80000
+258.762880 200.00 80000
+258.922880 200.00 80000
+259.082880 200.00 80000
+259.242880 200.00 80000
+259.402880 200.00 80000
+259.562880 200.00 80000
+259.722880 200.00 80000
+259.882880 200.00 80000
+260.042880 200.00 80000
+260.202880 200.00 80000
+260.362880 200.00 80000
+260.522880 200.00 80000
+260.682880 200.00 80000
+260.842880 200.00 80000
+261.002880 200.00 80000
+261.162880 200.00 80000
+261.322880 200.00 80000
+261.482880 200.00 80000
+261.642880 200.00 80000
+261.802880 200.00 80000
+261.962880 200.00 80000
+262.122880 200.00 80000
+262.282880 200.00 80000
+262.442880 200.00 80000
+262.602880 200.00 80000
+262.762880 200.00 80000
+262.922880 200.00 80000
+263.082880 200.00 80000
+263.242880 200.00 80000
+263.402880 200.00 80000
+263.562880 200.00 80000
+263.722880 200.00 80000
+263.882880 200.00 80000
+264.042880 200.00 80000
+264.202880 200.00 80000
+264.362880 200.00 80000
+264.522880 200.00 80000
+264.682880 200.00 80000
+264.842880 200.00 80000
+265.002880 200.00 80000
+265.162880 200.00 80000
+265.322880 200.00 80000
+265.482880 200.00 80000
+265.642880 200.00 80000
+265.802880 200.00 80000
+265.962880 200.00 80000
+266.122880 200.00 80000
+266.282880 200.00 80000
+266.442880 200.00 80000
+266.602880 200.00 80000
+266.762880 200.00 80000
+266.922880 200.00 80000
+267.082880 200.00 80000
+267.242880 200.00 80000
+267.402880 200.00 80000
+267.562880 200.00 80000
+267.722880 200.00 80000
+267.882880 200.00 80000
+268.042880 200.00 80000
+268.202880 200.00 80000
+268.362880 200.00 80000
+268.522880 200.00 80000
+268.682880 200.00 80000
+268.842880 200.00 80000
+269.002880 200.00 80000
+269.162880 200.00 80000
+269.322880 200.00 80000
+269.482880 200.00 80000
+269.642880 200.00 80000
+269.802880 200.00 80000
+269.962880 200.00 80000
+270.122880 200.00 80000
+270.282880 200.00 80000
+270.442880 200.00 80000
+270.602880 200.00 80000
+270.762880 200.00 80000
+270.922880 200.00 80000
+271.082880 200.00 80000
+271.242880 200.00 80000
+271.402880 200.00 80000
+271.562880 200.00 80000
+271.722880 200.00 80000
+271.882880 200.00 80000
+272.042880 200.00 80000
+272.202880 200.00 80000
+272.362880 200.00 80000
+272.522880 200.00 80000
+272.682880 200.00 80000
+272.842880 200.00 80000
+273.002880 200.00 80000
+273.162880 200.00 80000
+273.322880 200.00 80000
+273.482880 200.00 80000
+273.642880 200.00 80000
+273.802880 200.00 80000
+273.962880 200.00 80000
+274.122880 200.00 80000
+274.282880 200.00 80000
+274.442880 200.00 80000
+274.602880 200.00 80000
+274.762880 200.00 80000
+274.922880 200.00 80000
+275.082880 200.00 80000
+275.242880 200.00 80000
+275.402880 200.00 80000
+275.562880 200.00 80000
+275.722880 200.00 80000
+275.882880 200.00 80000
+276.042880 200.00 80000
+276.202880 200.00 80000
+276.362880 200.00 80000
+276.522880 200.00 80000
+276.682880 200.00 80000
+276.842880 200.00 80000
+277.002880 200.00 80000
+277.162880 200.00 80000
+277.322880 200.00 80000
+277.482880 200.00 80000
+277.642880 200.00 80000
+277.802880 200.00 80000
+277.962880 200.00 80000
+278.122880 200.00 80000
+278.282880 200.00 80000
+278.442880 200.00 80000
+278.602880 200.00 80000
+278.762880 200.00 80000
+278.922880 200.00 80000
+279.082880 200.00 80000
+279.242880 200.00 80000
+279.402880 200.00 80000
+279.562880 200.00 80000
+279.722880 200.00 80000
+279.882880 200.00 80000
+280.042880 200.00 80000
+280.202880 200.00 80000
+280.362880 200.00 80000
+280.522880 200.00 80000
+280.682880 200.00 80000
+280.842880 200.00 80000
+281.002880 200.00 80000
+281.162880 200.00 80000
+281.322880 200.00 80000
+281.482880 200.00 80000
+281.642880 200.00 80000
+281.802880 200.00 80000
+281.962880 200.00 80000
+282.122880 200.00 80000
+282.282880 200.00 80000
+282.442880 200.00 80000
+282.602880 200.00 80000
+282.762880 200.00 80000
+282.922880 200.00 80000
+283.082880 200.00 80000
+283.242880 200.00 80000
+283.402880 200.00 80000
+283.562880 200.00 80000
+283.722880 200.00 80000
+283.882880 200.00 80000
+284.042880 200.00 80000
+284.202880 200.00 80000
+284.362880 200.00 80000
+284.522880 200.00 80000
+284.682880 200.00 80000
+284.842880 200.00 80000
+285.002880 200.00 80000
+285.162880 200.00 80000
+285.322880 200.00 80000
+285.482880 200.00 80000
+285.642880 200.00 80000
+285.802880 200.00 80000
+285.962880 200.00 80000
+286.122880 200.00 80000
+286.282880 200.00 80000
+286.442880 200.00 80000
+286.602880 200.00 80000
+286.762880 200.00 80000
+286.922880 200.00 80000
+287.082880 200.00 80000
+287.242880 200.00 80000
+287.402880 200.00 80000
+287.562880 200.00 80000
+287.722880 200.00 80000
+287.882880 200.00 80000
+288.042880 200.00 80000
+288.202880 200.00 80000
+288.362880 200.00 80000
+288.522880 200.00 80000
+288.682880 200.00 80000
+288.842880 200.00 80000
+289.002880 200.00 80000
+289.162880 200.00 80000
+289.322880 200.00 80000
+289.482880 200.00 80000
+289.642880 200.00 80000
+289.802880 200.00 80000
+289.962880 200.00 80000
+290.122880 200.00 80000
+290.282880 200.00 80000
+290.442880 200.00 80000
+290.602880 200.00 80000
+290.762880 200.00 80000
+290.922880 200.00 80000
+291.082880 200.00 80000
+291.242880 200.00 80000
+291.402880 200.00 80000
+291.562880 200.00 80000
+291.722880 200.00 80000
+291.882880 200.00 80000
+292.042880 200.00 80000
+292.202880 200.00 80000
+292.362880 200.00 80000
+292.522880 200.00 80000
+292.682880 200.00 80000
+292.842880 200.00 80000
+293.002880 200.00 80000
+293.162880 200.00 80000
+293.322880 200.00 80000
+293.482880 200.00 80000
+293.642880 200.00 80000
+293.802880 200.00 80000
+293.962880 200.00 80000
+294.122880 200.00 80000
+294.282880 200.00 80000
+294.442880 200.00 80000
+294.602880 200.00 80000
+294.762880 200.00 80000
+294.922880 200.00 80000
+295.082880 200.00 80000
+295.242880 200.00 80000
+295.402880 200.00 80000
+295.562880 200.00 80000
+295.722880 200.00 80000
+295.882880 200.00 80000
+296.042880 200.00 80000
+296.202880 200.00 80000
+296.362880 200.00 80000
+296.522880 200.00 80000
+296.682880 200.00 80000
+296.842880 200.00 80000
+297.002880 200.00 80000
+297.162880 200.00 80000
+297.322880 200.00 80000
+297.482880 200.00 80000
+297.642880 200.00 80000
+297.802880 200.00 80000
+297.962880 200.00 80000
+298.122880 200.00 80000
+298.282880 200.00 80000
+298.442880 200.00 80000
+298.602880 200.00 80000
+298.762880 200.00 80000
+298.922880 200.00 80000
+299.082880 200.00 80000
+299.242880 200.00 80000
+299.402880 200.00 80000
+299.562880 200.00 80000
+299.722880 200.00 80000
+299.882880 200.00 80000
+300.042880 200.00 80000
+300.202880 200.00 80000
+300.362880 200.00 80000
+300.522880 200.00 80000
+300.682880 200.00 80000
+300.842880 200.00 80000
+301.002880 200.00 80000
+301.162880 200.00 80000
+301.322880 200.00 80000
+301.482880 200.00 80000
+301.642880 200.00 80000
+301.802880 200.00 80000
+301.962880 200.00 80000
+302.122880 200.00 80000
+302.282880 200.00 80000
+302.442880 200.00 80000
+302.602880 200.00 80000
+302.762880 200.00 80000
+302.922880 200.00 80000
+303.082880 200.00 80000
+303.242880 200.00 80000
+303.402880 200.00 80000
+303.562880 200.00 80000
+303.722880 200.00 80000
+303.882880 200.00 80000
+304.042880 200.00 80000
+304.202880 200.00 80000
+304.362880 200.00 80000
+304.522880 200.00 80000
+304.682880 200.00 80000
+304.842880 200.00 80000
+305.002880 200.00 80000
+305.162880 200.00 80000
+305.322880 200.00 80000
+305.482880 200.00 80000
+305.642880 200.00 80000
+305.802880 200.00 80000
+305.962880 200.00 80000
+306.122880 200.00 80000
+306.282880 200.00 80000
+306.442880 200.00 80000
+306.602880 200.00 80000
+306.762880 200.00 80000
+306.922880 200.00 80000
+307.082880 200.00 80000
+307.242880 200.00 80000
+307.402880 200.00 80000
+307.562880 200.00 80000
+307.722880 200.00 80000
+307.882880 200.00 80000
+308.042880 200.00 80000
+308.202880 200.00 80000
+308.362880 200.00 80000
+308.522880 200.00 80000
+308.682880 200.00 80000
+308.842880 200.00 80000
+309.002880 200.00 80000
+309.162880 200.00 80000
+309.322880 200.00 80000
+309.482880 200.00 80000
+309.642880 200.00 80000
+309.802880 200.00 80000
+309.962880 200.00 80000
+310.122880 200.00 80000
+310.282880 200.00 80000
+310.442880 200.00 80000
+310.602880 200.00 80000
+310.762880 200.00 80000
+310.922880 200.00 80000
+311.082880 200.00 80000
+311.242880 200.00 80000
+311.402880 200.00 80000
+311.562880 200.00 80000
+311.722880 200.00 80000
+311.882880 200.00 80000
+312.042880 200.00 80000
+312.202880 200.00 80000
+312.362880 200.00 80000
+312.522880 200.00 80000
+312.682880 200.00 80000
+312.842880 200.00 80000
+313.002880 200.00 80000
+313.162880 200.00 80000
+313.322880 200.00 80000
+313.482880 200.00 80000
+313.642880 200.00 80000
+313.802880 200.00 80000
+313.962880 200.00 80000
+314.122880 200.00 80000
+314.282880 200.00 80000
+314.442880 200.00 80000
+314.602880 200.00 80000
+314.762880 200.00 80000
+314.922880 200.00 80000
+315.082880 200.00 80000
+315.242880 200.00 80000
+315.402880 200.00 80000
+315.562880 200.00 80000
+315.722880 200.00 80000
+315.882880 200.00 80000
+316.042880 200.00 80000
+316.202880 200.00 80000
+316.362880 200.00 80000
+316.522880 200.00 80000
+316.682880 200.00 80000
+316.842880 200.00 80000
+317.002880 200.00 80000
+317.162880 200.00 80000
+317.322880 200.00 80000
+317.482880 200.00 80000
+317.642880 200.00 80000
+317.802880 200.00 80000
+317.962880 200.00 80000
+318.122880 200.00 80000
+318.282880 200.00 80000
+318.442880 200.00 80000
+318.602880 200.00 80000
+318.762880 200.00 80000
+318.922880 200.00 80000
+319.082880 200.00 80000
+319.242880 200.00 80000
+319.402880 200.00 80000
+319.562880 200.00 80000
+319.722880 200.00 80000
+319.882880 200.00 80000
+320.042880 200.00 80000
+320.202880 200.00 80000
+320.362880 200.00 80000
+320.522880 200.00 80000
+320.682880 200.00 80000
+320.842880 200.00 80000
+321.002880 200.00 80000
+321.162880 200.00 80000
+321.322880 200.00 80000
+321.482880 200.00 80000
+321.642880 200.00 80000
+321.802880 200.00 80000
+321.962880 200.00 80000
+322.122880 200.00 80000
+322.282880 200.00 80000
+322.442880 200.00 80000
+322.602880 200.00 80000
+322.762880 200.00 80000
+322.922880 200.00 80000
+323.082880 200.00 80000
+323.242880 200.00 80000
+323.402880 200.00 80000
+323.562880 200.00 80000
+323.722880 200.00 80000
+323.882880 200.00 80000
+324.042880 200.00 80000
+324.202880 200.00 80000
+324.362880 200.00 80000
+324.522880 200.00 80000
+324.682880 200.00 80000
+324.842880 200.00 80000
+325.002880 200.00 80000
+325.162880 200.00 80000
+325.322880 200.00 80000
+325.482880 200.00 80000
+325.642880 200.00 80000
+325.802880 200.00 80000
+325.962880 200.00 80000
+326.122880 200.00 80000
+326.282880 200.00 80000
+326.442880 200.00 80000
+326.602880 200.00 80000
+326.762880 200.00 80000
+326.922880 200.00 80000
+327.082880 200.00 80000
+327.242880 200.00 80000
+327.402880 200.00 80000
+327.562880 200.00 80000
+327.722880 200.00 80000
+327.882880 200.00 80000
+328.042880 200.00 80000
+328.202880 200.00 80000
+328.362880 200.00 80000
+328.522880 200.00 80000
+328.682880 200.00 80000
+328.842880 200.00 80000
+329.002880 200.00 80000
+329.162880 200.00 80000
+329.322880 200.00 80000
+329.482880 200.00 80000
+329.642880 200.00 80000
+329.802880 200.00 80000
+329.962880 200.00 80000
+330.122880 200.00 80000
+330.282880 200.00 80000
+330.442880 200.00 80000
+330.602880 200.00 80000
+330.762880 200.00 80000
+330.922880 200.00 80000
+331.082880 200.00 80000
+331.242880 200.00 80000
+331.402880 200.00 80000
+331.562880 200.00 80000
+331.722880 200.00 80000
+331.882880 200.00 80000
+332.042880 200.00 80000
+332.202880 200.00 80000
+332.362880 200.00 80000
+332.522880 200.00 80000
+332.682880 200.00 80000
+332.842880 200.00 80000
+333.002880 200.00 80000
+333.162880 200.00 80000
+333.322880 200.00 80000
+333.482880 200.00 80000
+333.642880 200.00 80000
+333.802880 200.00 80000
+333.962880 200.00 80000
+334.122880 200.00 80000
+334.282880 200.00 80000
+334.442880 200.00 80000
+334.602880 200.00 80000
+334.762880 200.00 80000
+334.922880 200.00 80000
+335.082880 200.00 80000
+335.242880 200.00 80000
+335.402880 200.00 80000
+335.562880 200.00 80000
+335.722880 200.00 80000
+335.882880 200.00 80000
+336.042880 200.00 80000
+336.202880 200.00 80000
+336.362880 200.00 80000
+336.522880 200.00 80000
+336.682880 200.00 80000
+336.842880 200.00 80000
+337.002880 200.00 80000
+337.162880 200.00 80000
+337.322880 200.00 80000
+337.482880 200.00 80000
+337.642880 200.00 80000
+337.802880 200.00 80000
+337.962880 200.00 80000
+338.122880 200.00 80000
+338.282880 200.00 80000
+338.442880 200.00 80000
+338.602880 200.00 80000
+338.762880 200.00 80000
+338.922880 200.00 80000
+339.082880 200.00 80000
+339.242880 200.00 80000
+339.402880 200.00 80000
+339.562880 200.00 80000
+339.722880 200.00 80000
+339.882880 200.00 80000
+340.042880 200.00 80000
+340.202880 200.00 80000
+340.362880 200.00 80000
+340.522880 200.00 80000
+340.682880 200.00 80000
+340.842880 200.00 80000
+341.002880 200.00 80000
+341.162880 200.00 80000
+341.322880 200.00 80000
+341.482880 200.00 80000
+341.642880 200.00 80000
+341.802880 200.00 80000
+341.962880 200.00 80000
+342.122880 200.00 80000
+342.282880 200.00 80000
+342.442880 200.00 80000
+342.602880 200.00 80000
+342.762880 200.00 80000
+342.922880 200.00 80000
+343.082880 200.00 80000
+343.242880 200.00 80000
+343.402880 200.00 80000
+343.562880 200.00 80000
+343.722880 200.00 80000
+343.882880 200.00 80000
+344.042880 200.00 80000
+344.202880 200.00 80000
+344.362880 200.00 80000
+344.522880 200.00 80000
+344.682880 200.00 80000
+344.842880 200.00 80000
+345.002880 200.00 80000
+345.162880 200.00 80000
+345.322880 200.00 80000
+345.482880 200.00 80000
+345.642880 200.00 80000
+345.802880 200.00 80000
+345.962880 200.00 80000
+346.122880 200.00 80000
+346.282880 200.00 80000
+346.442880 200.00 80000
+346.602880 200.00 80000
+346.762880 200.00 80000
+346.922880 200.00 80000
+347.082880 200.00 80000
+347.242880 200.00 80000
+347.402880 200.00 80000
+347.562880 200.00 80000
+347.722880 200.00 80000
+347.882880 200.00 80000
+348.042880 200.00 80000
+348.202880 200.00 80000
+348.362880 200.00 80000
+348.522880 200.00 80000
+348.682880 200.00 80000
+348.842880 200.00 80000
+349.002880 200.00 80000
+349.162880 200.00 80000
+349.322880 200.00 80000
+349.482880 200.00 80000
+349.642880 200.00 80000
+349.802880 200.00 80000
+349.962880 200.00 80000
+350.122880 200.00 80000
+350.282880 200.00 80000
+350.442880 200.00 80000
+350.602880 200.00 80000
+350.762880 200.00 80000
+350.922880 200.00 80000
+351.082880 200.00 80000
+351.242880 200.00 80000
+351.402880 200.00 80000
+351.562880 200.00 80000
+351.722880 200.00 80000
+351.882880 200.00 80000
+352.042880 200.00 80000
+352.202880 200.00 80000
+352.362880 200.00 80000
+352.522880 200.00 80000
+352.682880 200.00 80000
+352.842880 200.00 80000
+353.002880 200.00 80000
+353.162880 200.00 80000
+353.322880 200.00 80000
+353.482880 200.00 80000
+353.642880 200.00 80000
+353.802880 200.00 80000
+353.962880 200.00 80000
+354.122880 200.00 80000
+354.282880 200.00 80000
+354.442880 200.00 80000
+354.602880 200.00 80000
+354.762880 200.00 80000
+354.922880 200.00 80000
+355.082880 200.00 80000
+355.242880 200.00 80000
+355.402880 200.00 80000
+355.562880 200.00 80000
+355.722880 200.00 80000
+355.882880 200.00 80000
+356.042880 200.00 80000
+356.202880 200.00 80000
+356.362880 200.00 80000
+356.522880 200.00 80000
+356.682880 200.00 80000
+356.842880 200.00 80000
+357.002880 200.00 80000
+357.162880 200.00 80000
+357.322880 200.00 80000
+357.482880 200.00 80000
+357.642880 200.00 80000
+357.802880 200.00 80000
+357.962880 200.00 80000
+358.122880 200.00 80000
+358.282880 200.00 80000
+358.442880 200.00 80000
+358.602880 200.00 80000
+358.762880 200.00 80000
+358.922880 200.00 80000
+359.082880 200.00 80000
+359.242880 200.00 80000
+359.402880 200.00 80000
+359.562880 200.00 80000
+359.722880 200.00 80000
+359.882880 200.00 80000
+360.042880 200.00 80000
+360.202880 200.00 80000
+360.362880 200.00 80000
+360.522880 200.00 80000
+360.682880 200.00 80000
+360.842880 200.00 80000
+361.002880 200.00 80000
+361.162880 200.00 80000
+361.322880 200.00 80000
+361.482880 200.00 80000
+361.642880 200.00 80000
+361.802880 200.00 80000
+361.962880 200.00 80000
+362.122880 200.00 80000
+362.282880 200.00 80000
+362.442880 200.00 80000
+362.602880 200.00 80000
+362.762880 200.00 80000
+362.922880 200.00 80000
+363.082880 200.00 80000
+363.242880 200.00 80000
+363.402880 200.00 80000
+363.562880 200.00 80000
+363.722880 200.00 80000
+363.882880 200.00 80000
+364.042880 200.00 80000
+364.202880 200.00 80000
+364.362880 200.00 80000
+364.522880 200.00 80000
+364.682880 200.00 80000
+364.842880 200.00 80000
+365.002880 200.00 80000
+365.162880 200.00 80000
+365.322880 200.00 80000
+365.482880 200.00 80000
+365.642880 200.00 80000
+365.802880 200.00 80000
+365.962880 200.00 80000
+366.122880 200.00 80000
+366.282880 200.00 80000
+366.442880 200.00 80000
+366.602880 200.00 80000
+366.762880 200.00 80000
+366.922880 200.00 80000
+367.082880 200.00 80000
+367.242880 200.00 80000
+367.402880 200.00 80000
+367.562880 200.00 80000
+367.722880 200.00 80000
+367.882880 200.00 80000
+368.042880 200.00 80000
+368.202880 200.00 80000
+368.362880 200.00 80000
+368.522880 200.00 80000
+368.682880 200.00 80000
+368.842880 200.00 80000
+369.002880 200.00 80000
+369.162880 200.00 80000
+369.322880 200.00 80000
+369.482880 200.00 80000
+369.642880 200.00 80000
+369.802880 200.00 80000
+369.962880 200.00 80000
+370.122880 200.00 80000
+370.282880 200.00 80000
+370.442880 200.00 80000
+370.602880 200.00 80000
+370.762880 200.00 80000
+370.922880 200.00 80000
+371.082880 200.00 80000
+371.242880 200.00 80000
+371.402880 200.00 80000
+371.562880 200.00 80000
+371.722880 200.00 80000
+371.882880 200.00 80000
+372.042880 200.00 80000
+372.202880 200.00 80000
+372.362880 200.00 80000
+372.522880 200.00 80000
+372.682880 200.00 80000
+372.842880 200.00 80000
+373.002880 200.00 80000
+373.162880 200.00 80000
+373.322880 200.00 80000
+373.482880 200.00 80000
+373.642880 200.00 80000
+373.802880 200.00 80000
+373.962880 200.00 80000
+374.122880 200.00 80000
+374.282880 200.00 80000
+374.442880 200.00 80000
+374.602880 200.00 80000
+374.762880 200.00 80000
+374.922880 200.00 80000
+375.082880 200.00 80000
+375.242880 200.00 80000
+375.402880 200.00 80000
+375.562880 200.00 80000
+375.722880 200.00 80000
+375.882880 200.00 80000
+376.042880 200.00 80000
+376.202880 200.00 80000
+376.362880 200.00 80000
+376.522880 200.00 80000
+376.682880 200.00 80000
+376.842880 200.00 80000
+377.002880 200.00 80000
+377.162880 200.00 80000
+377.322880 200.00 80000
+377.482880 200.00 80000
+377.642880 200.00 80000
+377.802880 200.00 80000
+377.962880 200.00 80000
+378.122880 200.00 80000
+378.282880 200.00 80000
+378.442880 200.00 80000
+378.602880 200.00 80000
+378.762880 200.00 80000
+378.922880 200.00 80000
+379.082880 200.00 80000
+379.242880 200.00 80000
+379.402880 200.00 80000
+379.562880 200.00 80000
+379.722880 200.00 80000
+379.882880 200.00 80000
+380.042880 200.00 80000
+380.202880 200.00 80000
+380.362880 200.00 80000
+380.522880 200.00 80000
+380.682880 200.00 80000
+380.842880 200.00 80000
+381.002880 200.00 80000
+381.162880 200.00 80000
+381.322880 200.00 80000
+381.482880 200.00 80000
+381.642880 200.00 80000
+381.802880 200.00 80000
+381.962880 200.00 80000
+382.122880 200.00 80000
+382.282880 200.00 80000
+382.442880 200.00 80000
+382.602880 200.00 80000
+382.762880 200.00 80000
+382.922880 200.00 80000
+383.082880 200.00 80000
+383.242880 200.00 80000
+383.402880 200.00 80000
+383.562880 200.00 80000
+383.722880 200.00 80000
+383.882880 200.00 80000
+384.042880 200.00 80000
+384.202880 200.00 80000
+384.362880 200.00 80000
+384.522880 200.00 80000
+384.682880 200.00 80000
+384.842880 200.00 80000
+385.002880 200.00 80000
+385.162880 200.00 80000
+385.322880 200.00 80000
+385.482880 200.00 80000
+385.642880 200.00 80000
+385.802880 200.00 80000
+385.962880 200.00 80000
+386.122880 200.00 80000
+386.282880 200.00 80000
+386.442880 200.00 80000
+386.602880 200.00 80000
+386.762880 200.00 80000
+386.922880 200.00 80000
+387.082880 200.00 80000
+387.242880 200.00 80000
+387.402880 200.00 80000
+387.562880 200.00 80000
+387.722880 200.00 80000
+387.882880 200.00 80000
+388.042880 200.00 80000
+388.202880 200.00 80000
+388.362880 200.00 80000
+388.522880 200.00 80000
+388.682880 200.00 80000
+388.842880 200.00 80000
+389.002880 200.00 80000
+389.162880 200.00 80000
+389.322880 200.00 80000
+389.482880 200.00 80000
+389.642880 200.00 80000
+389.802880 200.00 80000
+389.962880 200.00 80000
+390.122880 200.00 80000
+390.282880 200.00 80000
+390.442880 200.00 80000
+390.602880 200.00 80000
+390.762880 200.00 80000
+390.922880 200.00 80000
+391.082880 200.00 80000
+391.242880 200.00 80000
+391.402880 200.00 80000
+391.562880 200.00 80000
+391.722880 200.00 80000
+391.882880 200.00 80000
+392.042880 200.00 80000
+392.202880 200.00 80000
+392.362880 200.00 80000
+392.522880 200.00 80000
+392.682880 200.00 80000
+392.842880 200.00 80000
+393.002880 200.00 80000
+393.162880 200.00 80000
+393.322880 200.00 80000
+393.482880 200.00 80000
+393.642880 200.00 80000
+393.802880 200.00 80000
+393.962880 200.00 80000
+394.122880 200.00 80000
+394.282880 200.00 80000
+394.442880 200.00 80000
+394.602880 200.00 80000
+394.762880 200.00 80000
+394.922880 200.00 80000
+395.082880 200.00 80000
+395.242880 200.00 80000
+395.402880 200.00 80000
+395.562880 200.00 80000
+395.722880 200.00 80000
+395.882880 200.00 80000
+396.042880 200.00 80000
+396.202880 200.00 80000
+396.362880 200.00 80000
+396.522880 200.00 80000
+396.682880 200.00 80000
+396.842880 200.00 80000
+397.002880 200.00 80000
+397.162880 200.00 80000
+397.322880 200.00 80000
+397.482880 200.00 80000
+397.642880 200.00 80000
+397.802880 200.00 80000
+397.962880 200.00 80000
+398.122880 200.00 80000
+398.282880 200.00 80000
+398.442880 200.00 80000
+398.602880 200.00 80000
+398.762880 200.00 80000
+398.922880 200.00 80000
+399.082880 200.00 80000
+399.242880 200.00 80000
+399.402880 200.00 80000
+399.562880 200.00 80000
+399.722880 200.00 80000
+399.882880 200.00 80000
+400.042880 200.00 80000
+400.202880 200.00 80000
+400.362880 200.00 80000
+400.522880 200.00 80000
+400.682880 200.00 80000
+400.842880 200.00 80000
+401.002880 200.00 80000
+401.162880 200.00 80000
+401.322880 200.00 80000
+401.482880 200.00 80000
+401.642880 200.00 80000
+401.802880 200.00 80000
+401.962880 200.00 80000
+402.122880 200.00 80000
+402.282880 200.00 80000
+402.442880 200.00 80000
+402.602880 200.00 80000
+402.762880 200.00 80000
+402.922880 200.00 80000
+403.082880 200.00 80000
+403.242880 200.00 80000
+403.402880 200.00 80000
+403.562880 200.00 80000
+403.722880 200.00 80000
+403.882880 200.00 80000
+404.042880 200.00 80000
+404.202880 200.00 80000
+404.362880 200.00 80000
+404.522880 200.00 80000
+404.682880 200.00 80000
+404.842880 200.00 80000
+405.002880 200.00 80000
+405.162880 200.00 80000
+405.322880 200.00 80000
+405.482880 200.00 80000
+405.642880 200.00 80000
+405.802880 200.00 80000
+405.962880 200.00 80000
+406.122880 200.00 80000
+406.282880 200.00 80000
+406.442880 200.00 80000
+406.602880 200.00 80000
+406.762880 200.00 80000
+406.922880 200.00 80000
+407.082880 200.00 80000
+407.242880 200.00 80000
+407.402880 200.00 80000
+407.562880 200.00 80000
+407.722880 200.00 80000
+407.882880 200.00 80000
+408.042880 200.00 80000
+408.202880 200.00 80000
+408.362880 200.00 80000
+408.522880 200.00 80000
+408.682880 200.00 80000
+408.842880 200.00 80000
+409.002880 200.00 80000
+409.162880 200.00 80000
+409.322880 200.00 80000
+409.482880 200.00 80000
+409.642880 200.00 80000
+409.802880 200.00 80000
+409.962880 200.00 80000
+410.122880 200.00 80000
+410.282880 200.00 80000
+410.442880 200.00 80000
+410.602880 200.00 80000
+410.762880 200.00 80000
+410.922880 200.00 80000
+411.082880 200.00 80000
+411.242880 200.00 80000
+411.402880 200.00 80000
+411.562880 200.00 80000
+411.722880 200.00 80000
+411.882880 200.00 80000
+412.042880 200.00 80000
+412.202880 200.00 80000
+412.362880 200.00 80000
+412.522880 200.00 80000
+412.682880 200.00 80000
+412.842880 200.00 80000
+413.002880 200.00 80000
+413.162880 200.00 80000
+413.322880 200.00 80000
+413.482880 200.00 80000
+413.642880 200.00 80000
+413.802880 200.00 80000
+413.962880 200.00 80000
+414.122880 200.00 80000
+414.282880 200.00 80000
+414.442880 200.00 80000
+414.602880 200.00 80000
+414.762880 200.00 80000
+414.922880 200.00 80000
+415.082880 200.00 80000
+415.242880 200.00 80000
+415.402880 200.00 80000
+415.562880 200.00 80000
+415.722880 200.00 80000
+415.882880 200.00 80000
+416.042880 200.00 80000
+416.202880 200.00 80000
+416.362880 200.00 80000
+416.522880 200.00 80000
+416.682880 200.00 80000
+416.842880 200.00 80000
+417.002880 200.00 80000
+417.162880 200.00 80000
+417.322880 200.00 80000
+417.482880 200.00 80000
+417.642880 200.00 80000
+417.802880 200.00 80000
+417.962880 200.00 80000
+418.122880 200.00 80000
+418.282880 200.00 80000
+418.442880 200.00 80000
+418.602880 200.00 80000
+418.762880 200.00 80000
+418.922880 200.00 80000
+419.082880 200.00 80000
+419.242880 200.00 80000
+419.402880 200.00 80000
+419.562880 200.00 80000
+419.722880 200.00 80000
+419.882880 200.00 80000
+420.042880 200.00 80000
+420.202880 200.00 80000
+420.362880 200.00 80000
+420.522880 200.00 80000
+420.682880 200.00 80000
+420.842880 200.00 80000
+421.002880 200.00 80000
+421.162880 200.00 80000
+421.322880 200.00 80000
+421.482880 200.00 80000
+421.642880 200.00 80000
+421.802880 200.00 80000
+421.962880 200.00 80000
+422.122880 200.00 80000
+422.282880 200.00 80000
+422.442880 200.00 80000
+422.602880 200.00 80000
+422.762880 200.00 80000
+422.922880 200.00 80000
+423.082880 200.00 80000
+423.242880 200.00 80000
+423.402880 200.00 80000
+423.562880 200.00 80000
+423.722880 200.00 80000
+423.882880 200.00 80000
+424.042880 200.00 80000
+424.202880 200.00 80000
+424.362880 200.00 80000
+424.522880 200.00 80000
+424.682880 200.00 80000
+424.842880 200.00 80000
+425.002880 200.00 80000
+425.162880 200.00 80000
+425.322880 200.00 80000
+425.482880 200.00 80000
+425.642880 200.00 80000
+425.802880 200.00 80000
+425.962880 200.00 80000
+426.122880 200.00 80000
+426.282880 200.00 80000
+426.442880 200.00 80000
+426.602880 200.00 80000
+426.762880 200.00 80000
+426.922880 200.00 80000
+427.082880 200.00 80000
+427.242880 200.00 80000
+427.402880 200.00 80000
+427.562880 200.00 80000
+427.722880 200.00 80000
+427.882880 200.00 80000
+428.042880 200.00 80000
+428.202880 200.00 80000
+428.362880 200.00 80000
+428.522880 200.00 80000
+428.682880 200.00 80000
+428.842880 200.00 80000
+429.002880 200.00 80000
+429.162880 200.00 80000
+429.322880 200.00 80000
+429.482880 200.00 80000
+429.642880 200.00 80000
+429.802880 200.00 80000
+429.962880 200.00 80000
+430.122880 200.00 80000
+430.282880 200.00 80000
+430.442880 200.00 80000
+430.602880 200.00 80000
+430.762880 200.00 80000
+430.922880 200.00 80000
+431.082880 200.00 80000
+431.242880 200.00 80000
+431.402880 200.00 80000
+431.562880 200.00 80000
+431.722880 200.00 80000
+431.882880 200.00 80000
+432.042880 200.00 80000
+432.202880 200.00 80000
+432.362880 200.00 80000
+432.522880 200.00 80000
+432.682880 200.00 80000
+432.842880 200.00 80000
+433.002880 200.00 80000
+433.162880 200.00 80000
+433.322880 200.00 80000
+433.482880 200.00 80000
+433.642880 200.00 80000
+433.802880 200.00 80000
+433.962880 200.00 80000
+434.122880 200.00 80000
+434.282880 200.00 80000
+434.442880 200.00 80000
+434.602880 200.00 80000
+434.762880 200.00 80000
+434.922880 200.00 80000
+435.082880 200.00 80000
+435.242880 200.00 80000
+435.402880 200.00 80000
+435.562880 200.00 80000
+435.722880 200.00 80000
+435.882880 200.00 80000
+436.042880 200.00 80000
+436.202880 200.00 80000
+436.362880 200.00 80000
+436.522880 200.00 80000
+436.682880 200.00 80000
+436.842880 200.00 80000
+437.002880 200.00 80000
+437.162880 200.00 80000
+437.322880 200.00 80000
+437.482880 200.00 80000
+437.642880 200.00 80000
+437.802880 200.00 80000
+437.962880 200.00 80000
+438.122880 200.00 80000
+438.282880 200.00 80000
+438.442880 200.00 80000
+438.602880 200.00 80000
+438.762880 200.00 80000
+438.922880 200.00 80000
+439.082880 200.00 80000
+439.242880 200.00 80000
+439.402880 200.00 80000
+439.562880 200.00 80000
+439.722880 200.00 80000
+439.882880 200.00 80000
+440.042880 200.00 80000
+440.202880 200.00 80000
+440.362880 200.00 80000
+440.522880 200.00 80000
+440.682880 200.00 80000
+440.842880 200.00 80000
+441.002880 200.00 80000
+441.162880 200.00 80000
+441.322880 200.00 80000
+441.482880 200.00 80000
+441.642880 200.00 80000
+441.802880 200.00 80000
+441.962880 200.00 80000
+442.122880 200.00 80000
+442.282880 200.00 80000
+442.442880 200.00 80000
+442.602880 200.00 80000
+442.762880 200.00 80000
+442.922880 200.00 80000
+443.082880 200.00 80000
+443.242880 200.00 80000
+443.402880 200.00 80000
+443.562880 200.00 80000
+443.722880 200.00 80000
+443.882880 200.00 80000
+444.042880 200.00 80000
+444.202880 200.00 80000
+444.362880 200.00 80000
+444.522880 200.00 80000
+444.682880 200.00 80000
+444.842880 200.00 80000
+445.002880 200.00 80000
+445.162880 200.00 80000
+445.322880 200.00 80000
+445.482880 200.00 80000
+445.642880 200.00 80000
+445.802880 200.00 80000
+445.962880 200.00 80000
+446.122880 200.00 80000
+446.282880 200.00 80000
+446.442880 200.00 80000
+446.602880 200.00 80000
+446.762880 200.00 80000
+446.922880 200.00 80000
+447.082880 200.00 80000
+447.242880 200.00 80000
+447.402880 200.00 80000
+447.562880 200.00 80000
+447.722880 200.00 80000
+447.882880 200.00 80000
+448.042880 200.00 80000
+448.202880 200.00 80000
+448.362880 200.00 80000
+448.522880 200.00 80000
+448.682880 200.00 80000
+448.842880 200.00 80000
+449.002880 200.00 80000
+449.162880 200.00 80000
+449.322880 200.00 80000
+449.482880 200.00 80000
+449.642880 200.00 80000
+449.802880 200.00 80000
+449.962880 200.00 80000
+450.122880 200.00 80000
+450.282880 200.00 80000
+450.442880 200.00 80000
+450.602880 200.00 80000
+450.762880 200.00 80000
+450.922880 200.00 80000
+451.082880 200.00 80000
+451.242880 200.00 80000
+451.402880 200.00 80000
+451.562880 200.00 80000
+451.722880 200.00 80000
+451.882880 200.00 80000
+452.042880 200.00 80000
+452.202880 200.00 80000
+452.362880 200.00 80000
+452.522880 200.00 80000
+452.682880 200.00 80000
+452.842880 200.00 80000
+453.002880 200.00 80000
+453.162880 200.00 80000
+453.322880 200.00 80000
+453.482880 200.00 80000
+453.642880 200.00 80000
+453.802880 200.00 80000
+453.962880 200.00 80000
+454.122880 200.00 80000
+454.282880 200.00 80000
+454.442880 200.00 80000
+454.602880 200.00 80000
+454.762880 200.00 80000
+454.922880 200.00 80000
+455.082880 200.00 80000
+455.242880 200.00 80000
+455.402880 200.00 80000
+455.562880 200.00 80000
+455.722880 200.00 80000
+455.882880 200.00 80000
+456.042880 200.00 80000
+456.202880 200.00 80000
+456.362880 200.00 80000
+456.522880 200.00 80000
+456.682880 200.00 80000
+456.842880 200.00 80000
+457.002880 200.00 80000
+457.162880 200.00 80000
+457.322880 200.00 80000
+457.482880 200.00 80000
+457.642880 200.00 80000
+457.802880 200.00 80000
+457.962880 200.00 80000
+458.122880 200.00 80000
+458.282880 200.00 80000
+458.442880 200.00 80000
+458.602880 200.00 80000
+458.762880 200.00 80000
+458.922880 200.00 80000
+459.082880 200.00 80000
+459.242880 200.00 80000
+459.402880 200.00 80000
+459.562880 200.00 80000
+459.722880 200.00 80000
+459.882880 200.00 80000
+460.042880 200.00 80000
+460.202880 200.00 80000
+460.362880 200.00 80000
+460.522880 200.00 80000
+460.682880 200.00 80000
+460.842880 200.00 80000
+461.002880 200.00 80000
+461.162880 200.00 80000
+461.322880 200.00 80000
+461.482880 200.00 80000
+461.642880 200.00 80000
+461.802880 200.00 80000
+461.962880 200.00 80000
+462.122880 200.00 80000
+462.282880 200.00 80000
+462.442880 200.00 80000
+462.602880 200.00 80000
+462.762880 200.00 80000
+462.922880 200.00 80000
+463.082880 200.00 80000
+463.242880 200.00 80000
+463.402880 200.00 80000
+463.562880 200.00 80000
+463.722880 200.00 80000
+463.882880 200.00 80000
+464.042880 200.00 80000
+464.202880 200.00 80000
+464.362880 200.00 80000
+464.522880 200.00 80000
+464.682880 200.00 80000
+464.842880 200.00 80000
+465.002880 200.00 80000
+465.162880 200.00 80000
+465.322880 200.00 80000
+465.482880 200.00 80000
+465.642880 200.00 80000
+465.802880 200.00 80000
+465.962880 200.00 80000
+466.122880 200.00 80000
+466.282880 200.00 80000
+466.442880 200.00 80000
+466.602880 200.00 80000
+466.762880 200.00 80000
+466.922880 200.00 80000
+467.082880 200.00 80000
+467.242880 200.00 80000
+467.402880 200.00 80000
+467.562880 200.00 80000
+467.722880 200.00 80000
+467.882880 200.00 80000
+468.042880 200.00 80000
+468.202880 200.00 80000
+468.362880 200.00 80000
+468.522880 200.00 80000
+468.682880 200.00 80000
+468.842880 200.00 80000
+469.002880 200.00 80000
+469.162880 200.00 80000
+469.322880 200.00 80000
+469.482880 200.00 80000
+469.642880 200.00 80000
+469.802880 200.00 80000
+469.962880 200.00 80000
+470.122880 200.00 80000
+470.282880 200.00 80000
+470.442880 200.00 80000
+470.602880 200.00 80000
+470.762880 200.00 80000
+470.922880 200.00 80000
+471.082880 200.00 80000
+471.242880 200.00 80000
+471.402880 200.00 80000
+471.562880 200.00 80000
+471.722880 200.00 80000
+471.882880 200.00 80000
+472.042880 200.00 80000
+472.202880 200.00 80000
+472.362880 200.00 80000
+472.522880 200.00 80000
+472.682880 200.00 80000
+472.842880 200.00 80000
+473.002880 200.00 80000
+473.162880 200.00 80000
+473.322880 200.00 80000
+473.482880 200.00 80000
+473.642880 200.00 80000
+473.802880 200.00 80000
+473.962880 200.00 80000
+474.122880 200.00 80000
+474.282880 200.00 80000
+474.442880 200.00 80000
+474.602880 200.00 80000
+474.762880 200.00 80000
+474.922880 200.00 80000
+475.082880 200.00 80000
+475.242880 200.00 80000
+475.402880 200.00 80000
+475.562880 200.00 80000
+475.722880 200.00 80000
+475.882880 200.00 80000
+476.042880 200.00 80000
+476.202880 200.00 80000
+476.362880 200.00 80000
+476.522880 200.00 80000
+476.682880 200.00 80000
+476.842880 200.00 80000
+477.002880 200.00 80000
+477.162880 200.00 80000
+477.322880 200.00 80000
+477.482880 200.00 80000
+477.642880 200.00 80000
+477.802880 200.00 80000
+477.962880 200.00 80000
+478.122880 200.00 80000
+478.282880 200.00 80000
+478.442880 200.00 80000
+478.602880 200.00 80000
+478.762880 200.00 80000
+478.922880 200.00 80000
+479.082880 200.00 80000
+479.242880 200.00 80000
+479.402880 200.00 80000
+479.562880 200.00 80000
+479.722880 200.00 80000
+479.882880 200.00 80000
+480.042880 200.00 80000
+480.202880 200.00 80000
+480.362880 200.00 80000
+480.522880 200.00 80000
+480.682880 200.00 80000
+480.842880 200.00 80000
+481.002880 200.00 80000
+481.162880 200.00 80000
+481.322880 200.00 80000
+481.482880 200.00 80000
+481.642880 200.00 80000
+481.802880 200.00 80000
+481.962880 200.00 80000
+482.122880 200.00 80000
+482.282880 200.00 80000
+482.442880 200.00 80000
+482.602880 200.00 80000
+482.762880 200.00 80000
+482.922880 200.00 80000
+483.082880 200.00 80000
+483.242880 200.00 80000
+483.402880 200.00 80000
+483.562880 200.00 80000
+483.722880 200.00 80000
+483.882880 200.00 80000
+484.042880 200.00 80000
+484.202880 200.00 80000
+484.362880 200.00 80000
+484.522880 200.00 80000
+484.682880 200.00 80000
+484.842880 200.00 80000
+485.002880 200.00 80000
+485.162880 200.00 80000
+485.322880 200.00 80000
+485.482880 200.00 80000
+485.642880 200.00 80000
+485.802880 200.00 80000
+485.962880 200.00 80000
+486.122880 200.00 80000
+486.282880 200.00 80000
+486.442880 200.00 80000
+486.602880 200.00 80000
+486.762880 200.00 80000
+486.922880 200.00 80000
+487.082880 200.00 80000
+487.242880 200.00 80000
+487.402880 200.00 80000
+487.562880 200.00 80000
+487.722880 200.00 80000
+487.882880 200.00 80000
+488.042880 200.00 80000
+488.202880 200.00 80000
+488.362880 200.00 80000
+488.522880 200.00 80000
+488.682880 200.00 80000
+488.842880 200.00 80000
+489.002880 200.00 80000
+489.162880 200.00 80000
+489.322880 200.00 80000
+489.482880 200.00 80000
+489.642880 200.00 80000
+489.802880 200.00 80000
+489.962880 200.00 80000
+490.122880 200.00 80000
+490.282880 200.00 80000
+490.442880 200.00 80000
+490.602880 200.00 80000
+490.762880 200.00 80000
+490.922880 200.00 80000
+491.082880 200.00 80000
+491.242880 200.00 80000
+491.402880 200.00 80000
+491.562880 200.00 80000
+491.722880 200.00 80000
+491.882880 200.00 80000
+492.042880 200.00 80000
+492.202880 200.00 80000
+492.362880 200.00 80000
+492.522880 200.00 80000
+492.682880 200.00 80000
+492.842880 200.00 80000
+493.002880 200.00 80000
+493.162880 200.00 80000
+493.322880 200.00 80000
+493.482880 200.00 80000
+493.642880 200.00 80000
+493.802880 200.00 80000
+493.962880 200.00 80000
+494.122880 200.00 80000
+494.282880 200.00 80000
+494.442880 200.00 80000
+494.602880 200.00 80000
+494.762880 200.00 80000
+494.922880 200.00 80000
+495.082880 200.00 80000
+495.242880 200.00 80000
+495.402880 200.00 80000
+495.562880 200.00 80000
+495.722880 200.00 80000
+495.882880 200.00 80000
+496.042880 200.00 80000
+496.202880 200.00 80000
+496.362880 200.00 80000
+496.522880 200.00 80000
+496.682880 200.00 80000
+496.842880 200.00 80000
+497.002880 200.00 80000
+497.162880 200.00 80000
+497.322880 200.00 80000
+497.482880 200.00 80000
+497.642880 200.00 80000
+497.802880 200.00 80000
+497.962880 200.00 80000
+498.122880 200.00 80000
+498.282880 200.00 80000
+498.442880 200.00 80000
+498.602880 200.00 80000
+498.762880 200.00 80000
+498.922880 200.00 80000
+499.082880 200.00 80000
+499.242880 200.00 80000
+499.402880 200.00 80000
+499.562880 200.00 80000
+499.722880 200.00 80000
+499.882880 200.00 80000
+500.042880 200.00 80000
+500.202880 200.00 80000
+500.362880 200.00 80000
+500.522880 200.00 80000
+500.682880 200.00 80000
+500.842880 200.00 80000
+501.002880 200.00 80000
+501.162880 200.00 80000
+501.322880 200.00 80000
+501.482880 200.00 80000
+501.642880 200.00 80000
+501.802880 200.00 80000
+501.962880 200.00 80000
+502.122880 200.00 80000
+502.282880 200.00 80000
+502.442880 200.00 80000
+502.602880 200.00 80000
+502.762880 200.00 80000
+502.922880 200.00 80000
+503.082880 200.00 80000
+503.242880 200.00 80000
+503.402880 200.00 80000
+503.562880 200.00 80000
+503.722880 200.00 80000
+503.882880 200.00 80000
+504.042880 200.00 80000
+504.202880 200.00 80000
+504.362880 200.00 80000
+504.522880 200.00 80000
+504.682880 200.00 80000
+504.842880 200.00 80000
+505.002880 200.00 80000
+505.162880 200.00 80000
+505.322880 200.00 80000
+505.482880 200.00 80000
+505.642880 200.00 80000
+505.802880 200.00 80000
+505.962880 200.00 80000
+506.122880 200.00 80000
+506.282880 200.00 80000
+506.442880 200.00 80000
+506.602880 200.00 80000
+506.762880 200.00 80000
+506.922880 200.00 80000
+507.082880 200.00 80000
+507.242880 200.00 80000
+507.402880 200.00 80000
+507.562880 200.00 80000
+507.722880 200.00 80000
+507.882880 200.00 80000
+508.042880 200.00 80000
+508.202880 200.00 80000
+508.362880 200.00 80000
+508.522880 200.00 80000
+508.682880 200.00 80000
+508.842880 200.00 80000
+509.002880 200.00 80000
+509.162880 200.00 80000
+509.322880 200.00 80000
+509.482880 200.00 80000
+509.642880 200.00 80000
+509.802880 200.00 80000
+509.962880 200.00 80000
+510.122880 200.00 80000
+510.282880 200.00 80000
+510.442880 200.00 80000
+510.602880 200.00 80000
+510.762880 200.00 80000
+510.922880 200.00 80000
+511.082880 200.00 80000
+511.242880 200.00 80000
+511.402880 200.00 80000
+511.562880 200.00 80000
+511.722880 200.00 80000
+511.882880 200.00 80000
+512.042880 200.00 80000
+512.202880 200.00 80000
+512.362880 200.00 80000
+512.522880 200.00 80000
+512.682880 200.00 80000
+512.842880 200.00 80000
+513.002880 200.00 80000
+513.162880 200.00 80000
+513.322880 200.00 80000
+513.482880 200.00 80000
+513.642880 200.00 80000
+513.802880 200.00 80000
+513.962880 200.00 80000
+514.122880 200.00 80000
+514.282880 200.00 80000
+514.442880 200.00 80000
+514.602880 200.00 80000
+514.762880 200.00 80000
+514.922880 200.00 80000
+515.082880 200.00 80000
+515.242880 200.00 80000
+515.402880 200.00 80000
+515.562880 200.00 80000
+515.722880 200.00 80000
+515.882880 200.00 80000
+516.042880 200.00 80000
+516.202880 200.00 80000
+516.362880 200.00 80000
+516.522880 200.00 80000
+516.682880 200.00 80000
+516.842880 200.00 80000
+517.002880 200.00 80000
+517.162880 200.00 80000
+517.322880 200.00 80000
+517.482880 200.00 80000
+517.642880 200.00 80000
+517.802880 200.00 80000
+517.962880 200.00 80000
+518.122880 200.00 80000
+518.282880 200.00 80000
+518.442880 200.00 80000
+518.602880 200.00 80000
+518.762880 200.00 80000
+518.922880 200.00 80000
+519.082880 200.00 80000
+519.242880 200.00 80000
+519.402880 200.00 80000
+519.562880 200.00 80000
+519.722880 200.00 80000
+519.882880 200.00 80000
+520.042880 200.00 80000
+520.202880 200.00 80000
+520.362880 200.00 80000
+520.522880 200.00 80000
+520.682880 200.00 80000
+520.842880 200.00 80000
+521.002880 200.00 80000
+521.162880 200.00 80000
+521.322880 200.00 80000
+521.482880 200.00 80000
+521.642880 200.00 80000
+521.802880 200.00 80000
+521.962880 200.00 80000
+522.122880 200.00 80000
+522.282880 200.00 80000
+522.442880 200.00 80000
+522.602880 200.00 80000
+522.762880 200.00 80000
+522.922880 200.00 80000
+523.082880 200.00 80000
+523.242880 200.00 80000
+523.402880 200.00 80000
+523.562880 200.00 80000
+523.722880 200.00 80000
+523.882880 200.00 80000
+524.042880 200.00 80000
+524.202880 200.00 80000
+524.362880 200.00 80000
+524.522880 200.00 80000
+524.682880 200.00 80000
+524.842880 200.00 80000
+525.002880 200.00 80000
+525.162880 200.00 80000
+525.322880 200.00 80000
+525.482880 200.00 80000
+525.642880 200.00 80000
+525.802880 200.00 80000
+525.962880 200.00 80000
+526.122880 200.00 80000
+526.282880 200.00 80000
+526.442880 200.00 80000
+526.602880 200.00 80000
+526.762880 200.00 80000
+526.922880 200.00 80000
+527.082880 200.00 80000
+527.242880 200.00 80000
+527.402880 200.00 80000
+527.562880 200.00 80000
+527.722880 200.00 80000
+527.882880 200.00 80000
+528.042880 200.00 80000
+528.202880 200.00 80000
+528.362880 200.00 80000
+528.522880 200.00 80000
+528.682880 200.00 80000
+528.842880 200.00 80000
+529.002880 200.00 80000
+529.162880 200.00 80000
+529.322880 200.00 80000
+529.482880 200.00 80000
+529.642880 200.00 80000
+529.802880 200.00 80000
+529.962880 200.00 80000
+530.122880 200.00 80000
+530.282880 200.00 80000
+530.442880 200.00 80000
+530.602880 200.00 80000
+530.762880 200.00 80000
+530.922880 200.00 80000
+531.082880 200.00 80000
+531.242880 200.00 80000
+531.402880 200.00 80000
+531.562880 200.00 80000
+531.722880 200.00 80000
+531.882880 200.00 80000
+532.042880 200.00 80000
+532.202880 200.00 80000
+532.362880 200.00 80000
+532.522880 200.00 80000
+532.682880 200.00 80000
+532.842880 200.00 80000
+533.002880 200.00 80000
+533.162880 200.00 80000
+533.322880 200.00 80000
+533.482880 200.00 80000
+533.642880 200.00 80000
+533.802880 200.00 80000
+533.962880 200.00 80000
+534.122880 200.00 80000
+534.282880 200.00 80000
+534.442880 200.00 80000
+534.602880 200.00 80000
+534.762880 200.00 80000
+534.922880 200.00 80000
+535.082880 200.00 80000
+535.242880 200.00 80000
+535.402880 200.00 80000
+535.562880 200.00 80000
+535.722880 200.00 80000
+535.882880 200.00 80000
+536.042880 200.00 80000
+536.202880 200.00 80000
+536.362880 200.00 80000
+536.522880 200.00 80000
+536.682880 200.00 80000
+536.842880 200.00 80000
+537.002880 200.00 80000
+537.162880 200.00 80000
+537.322880 200.00 80000
+537.482880 200.00 80000
+537.642880 200.00 80000
+537.802880 200.00 80000
+537.962880 200.00 80000
+538.122880 200.00 80000
+538.282880 200.00 80000
+538.442880 200.00 80000
+538.602880 200.00 80000
+538.762880 200.00 80000
+538.922880 200.00 80000
+539.082880 200.00 80000
+539.242880 200.00 80000
+539.402880 200.00 80000
+539.562880 200.00 80000
+539.722880 200.00 80000
+539.882880 200.00 80000
+540.042880 200.00 80000
+540.202880 200.00 80000
+540.362880 200.00 80000
+540.522880 200.00 80000
+540.682880 200.00 80000
+540.842880 200.00 80000
+541.002880 200.00 80000
+541.162880 200.00 80000
+541.322880 200.00 80000
+541.482880 200.00 80000
+541.642880 200.00 80000
+541.802880 200.00 80000
+541.962880 200.00 80000
+542.122880 200.00 80000
+542.282880 200.00 80000
+542.442880 200.00 80000
+542.602880 200.00 80000
+542.762880 200.00 80000
+542.922880 200.00 80000
+543.082880 200.00 80000
+543.242880 200.00 80000
+543.402880 200.00 80000
+543.562880 200.00 80000
+543.722880 200.00 80000
+543.882880 200.00 80000
+544.042880 200.00 80000
+544.202880 200.00 80000
+544.362880 200.00 80000
+544.522880 200.00 80000
+544.682880 200.00 80000
+544.842880 200.00 80000
+545.002880 200.00 80000
+545.162880 200.00 80000
+545.322880 200.00 80000
+545.482880 200.00 80000
+545.642880 200.00 80000
+545.802880 200.00 80000
+545.962880 200.00 80000
+546.122880 200.00 80000
+546.282880 200.00 80000
+546.442880 200.00 80000
+546.602880 200.00 80000
+546.762880 200.00 80000
+546.922880 200.00 80000
+547.082880 200.00 80000
+547.242880 200.00 80000
+547.402880 200.00 80000
+547.562880 200.00 80000
+547.722880 200.00 80000
+547.882880 200.00 80000
+548.042880 200.00 80000
+548.202880 200.00 80000
+548.362880 200.00 80000
+548.522880 200.00 80000
+548.682880 200.00 80000
+548.842880 200.00 80000
+549.002880 200.00 80000
+549.162880 200.00 80000
+549.322880 200.00 80000
+549.482880 200.00 80000
+549.642880 200.00 80000
+549.802880 200.00 80000
+549.962880 200.00 80000
+550.122880 200.00 80000
+550.282880 200.00 80000
+550.442880 200.00 80000
+550.602880 200.00 80000
+550.762880 200.00 80000
+550.922880 200.00 80000
+551.082880 200.00 80000
+551.242880 200.00 80000
+551.402880 200.00 80000
+551.562880 200.00 80000
+551.722880 200.00 80000
+551.882880 200.00 80000
+552.042880 200.00 80000
+552.202880 200.00 80000
+552.362880 200.00 80000
+552.522880 200.00 80000
+552.682880 200.00 80000
+552.842880 200.00 80000
+553.002880 200.00 80000
+553.162880 200.00 80000
+553.322880 200.00 80000
+553.482880 200.00 80000
+553.642880 200.00 80000
+553.802880 200.00 80000
+553.962880 200.00 80000
+554.122880 200.00 80000
+554.282880 200.00 80000
+554.442880 200.00 80000
+554.602880 200.00 80000
+554.762880 200.00 80000
+554.922880 200.00 80000
+555.082880 200.00 80000
+555.242880 200.00 80000
+555.402880 200.00 80000
+555.562880 200.00 80000
+555.722880 200.00 80000
+555.882880 200.00 80000
+556.042880 200.00 80000
+556.202880 200.00 80000
+556.362880 200.00 80000
+556.522880 200.00 80000
+556.682880 200.00 80000
+556.842880 200.00 80000
+557.002880 200.00 80000
+557.162880 200.00 80000
+557.322880 200.00 80000
+557.482880 200.00 80000
+557.642880 200.00 80000
+557.802880 200.00 80000
+557.962880 200.00 80000
+558.122880 200.00 80000
+558.282880 200.00 80000
+558.442880 200.00 80000
+558.602880 200.00 80000
+558.762880 200.00 80000
+558.922880 200.00 80000
+559.082880 200.00 80000
+559.242880 200.00 80000
+559.402880 200.00 80000
+559.562880 200.00 80000
+559.722880 200.00 80000
+559.882880 200.00 80000
+560.042880 200.00 80000
+560.202880 200.00 80000
+560.362880 200.00 80000
+560.522880 200.00 80000
+560.682880 200.00 80000
+560.842880 200.00 80000
+561.002880 200.00 80000
+561.162880 200.00 80000
+561.322880 200.00 80000
+561.482880 200.00 80000
+561.642880 200.00 80000
+561.802880 200.00 80000
+561.962880 200.00 80000
+562.122880 200.00 80000
+562.282880 200.00 80000
+562.442880 200.00 80000
+562.602880 200.00 80000
+562.762880 200.00 80000
+562.922880 200.00 80000
+563.082880 200.00 80000
+563.242880 200.00 80000
+563.402880 200.00 80000
+563.562880 200.00 80000
+563.722880 200.00 80000
+563.882880 200.00 80000
+564.042880 200.00 80000
+564.202880 200.00 80000
+564.362880 200.00 80000
+564.522880 200.00 80000
+564.682880 200.00 80000
+564.842880 200.00 80000
+565.002880 200.00 80000
+565.162880 200.00 80000
+565.322880 200.00 80000
+565.482880 200.00 80000
+565.642880 200.00 80000
+565.802880 200.00 80000
+565.962880 200.00 80000
+566.122880 200.00 80000
+566.282880 200.00 80000
+566.442880 200.00 80000
+566.602880 200.00 80000
+566.762880 200.00 80000
+566.922880 200.00 80000
+567.082880 200.00 80000
+567.242880 200.00 80000
+567.402880 200.00 80000
+567.562880 200.00 80000
+567.722880 200.00 80000
+567.882880 200.00 80000
+568.042880 200.00 80000
+568.202880 200.00 80000
+568.362880 200.00 80000
+568.522880 200.00 80000
+568.682880 200.00 80000
+568.842880 200.00 80000
+569.002880 200.00 80000
+569.162880 200.00 80000
+569.322880 200.00 80000
+569.482880 200.00 80000
+569.642880 200.00 80000
+569.802880 200.00 80000
+569.962880 200.00 80000
+570.122880 200.00 80000
+570.282880 200.00 80000
+570.442880 200.00 80000
+570.602880 200.00 80000
+570.762880 200.00 80000
+570.922880 200.00 80000
+571.082880 200.00 80000
+571.242880 200.00 80000
+571.402880 200.00 80000
+571.562880 200.00 80000
+571.722880 200.00 80000
+571.882880 200.00 80000
+572.042880 200.00 80000
+572.202880 200.00 80000
+572.362880 200.00 80000
+572.522880 200.00 80000
+572.682880 200.00 80000
+572.842880 200.00 80000
+573.002880 200.00 80000
+573.162880 200.00 80000
+573.322880 200.00 80000
+573.482880 200.00 80000
+573.642880 200.00 80000
+573.802880 200.00 80000
+573.962880 200.00 80000
+574.122880 200.00 80000
+574.282880 200.00 80000
+574.442880 200.00 80000
+574.602880 200.00 80000
+574.762880 200.00 80000
+574.922880 200.00 80000
+575.082880 200.00 80000
+575.242880 200.00 80000
+575.402880 200.00 80000
+575.562880 200.00 80000
+575.722880 200.00 80000
+575.882880 200.00 80000
+576.042880 200.00 80000
+576.202880 200.00 80000
+576.362880 200.00 80000
+576.522880 200.00 80000
+576.682880 200.00 80000
+576.842880 200.00 80000
+577.002880 200.00 80000
+577.162880 200.00 80000
+577.322880 200.00 80000
+577.482880 200.00 80000
+577.642880 200.00 80000
+577.802880 200.00 80000
+577.962880 200.00 80000
+578.122880 200.00 80000
+578.282880 200.00 80000
+578.442880 200.00 80000
+578.602880 200.00 80000
+578.762880 200.00 80000
+578.922880 200.00 80000
+579.082880 200.00 80000
+579.242880 200.00 80000
+579.402880 200.00 80000
+579.562880 200.00 80000
+579.722880 200.00 80000
+579.882880 200.00 80000
+580.042880 200.00 80000
+580.202880 200.00 80000
+580.362880 200.00 80000
+580.522880 200.00 80000
+580.682880 200.00 80000
+580.842880 200.00 80000
+581.002880 200.00 80000
+581.162880 200.00 80000
+581.322880 200.00 80000
+581.482880 200.00 80000
+581.642880 200.00 80000
+581.802880 200.00 80000
+581.962880 200.00 80000
+582.122880 200.00 80000
+582.282880 200.00 80000
+582.442880 200.00 80000
+582.602880 200.00 80000
+582.762880 200.00 80000
+582.922880 200.00 80000
+583.082880 200.00 80000
+583.242880 200.00 80000
+583.402880 200.00 80000
+583.562880 200.00 80000
+583.722880 200.00 80000
+583.882880 200.00 80000
+584.042880 200.00 80000
+584.202880 200.00 80000
+584.362880 200.00 80000
+584.522880 200.00 80000
+584.682880 200.00 80000
+584.842880 200.00 80000
+585.002880 200.00 80000
+585.162880 200.00 80000
+585.322880 200.00 80000
+585.482880 200.00 80000
+585.642880 200.00 80000
+585.802880 200.00 80000
+585.962880 200.00 80000
+586.122880 200.00 80000
+586.282880 200.00 80000
+586.442880 200.00 80000
+586.602880 200.00 80000
+586.762880 200.00 80000
+586.922880 200.00 80000
+587.082880 200.00 80000
+587.242880 200.00 80000
+587.402880 200.00 80000
+587.562880 200.00 80000
+587.722880 200.00 80000
+587.882880 200.00 80000
+588.042880 200.00 80000
+588.202880 200.00 80000
+588.362880 200.00 80000
+588.522880 200.00 80000
+588.682880 200.00 80000
+588.842880 200.00 80000
+589.002880 200.00 80000
+589.162880 200.00 80000
+589.322880 200.00 80000
+589.482880 200.00 80000
+589.642880 200.00 80000
+589.802880 200.00 80000
+589.962880 200.00 80000
+590.122880 200.00 80000
+590.282880 200.00 80000
+590.442880 200.00 80000
+590.602880 200.00 80000
+590.762880 200.00 80000
+590.922880 200.00 80000
+591.082880 200.00 80000
+591.242880 200.00 80000
+591.402880 200.00 80000
+591.562880 200.00 80000
+591.722880 200.00 80000
+591.882880 200.00 80000
+592.042880 200.00 80000
+592.202880 200.00 80000
+592.362880 200.00 80000
+592.522880 200.00 80000
+592.682880 200.00 80000
+592.842880 200.00 80000
+593.002880 200.00 80000
+593.162880 200.00 80000
+593.322880 200.00 80000
+593.482880 200.00 80000
+593.642880 200.00 80000
+593.802880 200.00 80000
+593.962880 200.00 80000
+594.122880 200.00 80000
+594.282880 200.00 80000
+594.442880 200.00 80000
+594.602880 200.00 80000
+594.762880 200.00 80000
+594.922880 200.00 80000
+595.082880 200.00 80000
+595.242880 200.00 80000
+595.402880 200.00 80000
+595.562880 200.00 80000
+595.722880 200.00 80000
+595.882880 200.00 80000
+596.042880 200.00 80000
+596.202880 200.00 80000
+596.362880 200.00 80000
+596.522880 200.00 80000
+596.682880 200.00 80000
+596.842880 200.00 80000
+597.002880 200.00 80000
+597.162880 200.00 80000
+597.322880 200.00 80000
+597.482880 200.00 80000
+597.642880 200.00 80000
+597.802880 200.00 80000
+597.962880 200.00 80000
+598.122880 200.00 80000
+598.282880 200.00 80000
+598.442880 200.00 80000
+598.602880 200.00 80000
+598.762880 200.00 80000
+598.922880 200.00 80000
+599.082880 200.00 80000
+599.242880 200.00 80000
+599.402880 200.00 80000
+599.562880 200.00 80000
+599.722880 200.00 80000
+599.882880 200.00 80000
+600.042880 200.00 80000
+600.202880 200.00 80000
+600.362880 200.00 80000
+600.522880 200.00 80000
+600.682880 200.00 80000
+600.842880 200.00 80000
+601.002880 200.00 80000
+601.162880 200.00 80000
+601.322880 200.00 80000
+601.482880 200.00 80000
+601.642880 200.00 80000
+601.802880 200.00 80000
+601.962880 200.00 80000
+602.122880 200.00 80000
+602.282880 200.00 80000
+602.442880 200.00 80000
+602.602880 200.00 80000
+602.762880 200.00 80000
+602.922880 200.00 80000
+603.082880 200.00 80000
+603.242880 200.00 80000
+603.402880 200.00 80000
+603.562880 200.00 80000
+603.722880 200.00 80000
+603.882880 200.00 80000
+604.042880 200.00 80000
+604.202880 200.00 80000
+604.362880 200.00 80000
+604.522880 200.00 80000
+604.682880 200.00 80000
+604.842880 200.00 80000
+605.002880 200.00 80000
+605.162880 200.00 80000
+605.322880 200.00 80000
+605.482880 200.00 80000
+605.642880 200.00 80000
+605.802880 200.00 80000
+605.962880 200.00 80000
+606.122880 200.00 80000
+606.282880 200.00 80000
+606.442880 200.00 80000
+606.602880 200.00 80000
+606.762880 200.00 80000
+606.922880 200.00 80000
+607.082880 200.00 80000
+607.242880 200.00 80000
+607.402880 200.00 80000
+607.562880 200.00 80000
+607.722880 200.00 80000
+607.882880 200.00 80000
+608.042880 200.00 80000
+608.202880 200.00 80000
+608.362880 200.00 80000
+608.522880 200.00 80000
+608.682880 200.00 80000
+608.842880 200.00 80000
+609.002880 200.00 80000
+609.162880 200.00 80000
+609.322880 200.00 80000
+609.482880 200.00 80000
+609.642880 200.00 80000
+609.802880 200.00 80000
+609.962880 200.00 80000
+610.122880 200.00 80000
+610.282880 200.00 80000
+610.442880 200.00 80000
+610.602880 200.00 80000
+610.762880 200.00 80000
+610.922880 200.00 80000
+611.082880 200.00 80000
+611.242880 200.00 80000
+611.402880 200.00 80000
+611.562880 200.00 80000
+611.722880 200.00 80000
+611.882880 200.00 80000
+612.042880 200.00 80000
+612.202880 200.00 80000
+612.362880 200.00 80000
+612.522880 200.00 80000
+612.682880 200.00 80000
+612.842880 200.00 80000
+613.002880 200.00 80000
+613.162880 200.00 80000
+613.322880 200.00 80000
+613.482880 200.00 80000
+613.642880 200.00 80000
+613.802880 200.00 80000
+613.962880 200.00 80000
+614.122880 200.00 80000
+614.282880 200.00 80000
+614.442880 200.00 80000
+614.602880 200.00 80000
+614.762880 200.00 80000
+614.922880 200.00 80000
+615.082880 200.00 80000
+615.242880 200.00 80000
+615.402880 200.00 80000
+615.562880 200.00 80000
+615.722880 200.00 80000
+615.882880 200.00 80000
+616.042880 200.00 80000
+616.202880 200.00 80000
+616.362880 200.00 80000
+616.522880 200.00 80000
+616.682880 200.00 80000
+616.842880 200.00 80000
+617.002880 200.00 80000
+617.162880 200.00 80000
+617.322880 200.00 80000
+617.482880 200.00 80000
+617.642880 200.00 80000
+617.802880 200.00 80000
+617.962880 200.00 80000
+618.122880 200.00 80000
+618.282880 200.00 80000
+618.442880 200.00 80000
+618.602880 200.00 80000
+618.762880 200.00 80000
+618.922880 200.00 80000
+619.082880 200.00 80000
+619.242880 200.00 80000
+619.402880 200.00 80000
+619.562880 200.00 80000
+619.722880 200.00 80000
+619.882880 200.00 80000
+620.042880 200.00 80000
+620.202880 200.00 80000
+620.362880 200.00 80000
+620.522880 200.00 80000
+620.682880 200.00 80000
+620.842880 200.00 80000
+621.002880 200.00 80000
+621.162880 200.00 80000
+621.322880 200.00 80000
+621.482880 200.00 80000
+621.642880 200.00 80000
+621.802880 200.00 80000
+621.962880 200.00 80000
+622.122880 200.00 80000
+622.282880 200.00 80000
+622.442880 200.00 80000
+622.602880 200.00 80000
+622.762880 200.00 80000
+622.922880 200.00 80000
+623.082880 200.00 80000
+623.242880 200.00 80000
+623.402880 200.00 80000
+623.562880 200.00 80000
+623.722880 200.00 80000
+623.882880 200.00 80000
+624.042880 200.00 80000
+624.202880 200.00 80000
+624.362880 200.00 80000
+624.522880 200.00 80000
+624.682880 200.00 80000
+624.842880 200.00 80000
+625.002880 200.00 80000
+625.162880 200.00 80000
+625.322880 200.00 80000
+625.482880 200.00 80000
+625.642880 200.00 80000
+625.802880 200.00 80000
+625.962880 200.00 80000
+626.122880 200.00 80000
+626.282880 200.00 80000
+626.442880 200.00 80000
+626.602880 200.00 80000
+626.762880 200.00 80000
+626.922880 200.00 80000
+627.082880 200.00 80000
+627.242880 200.00 80000
+627.402880 200.00 80000
+627.562880 200.00 80000
+627.722880 200.00 80000
+627.882880 200.00 80000
+628.042880 200.00 80000
+628.202880 200.00 80000
+628.362880 200.00 80000
+628.522880 200.00 80000
+628.682880 200.00 80000
+628.842880 200.00 80000
+629.002880 200.00 80000
+629.162880 200.00 80000
+629.322880 200.00 80000
+629.482880 200.00 80000
+629.642880 200.00 80000
+629.802880 200.00 80000
+629.962880 200.00 80000
+630.122880 200.00 80000
+630.282880 200.00 80000
+630.442880 200.00 80000
+630.602880 200.00 80000
+630.762880 200.00 80000
+630.922880 200.00 80000
+631.082880 200.00 80000
+631.242880 200.00 80000
+631.402880 200.00 80000
+631.562880 200.00 80000
+631.722880 200.00 80000
+631.882880 200.00 80000
+632.042880 200.00 80000
+632.202880 200.00 80000
+632.362880 200.00 80000
+632.522880 200.00 80000
+632.682880 200.00 80000
+632.842880 200.00 80000
+633.002880 200.00 80000
+633.162880 200.00 80000
+633.322880 200.00 80000
+633.482880 200.00 80000
+633.642880 200.00 80000
+633.802880 200.00 80000
+633.962880 200.00 80000
+634.122880 200.00 80000
+634.282880 200.00 80000
+634.442880 200.00 80000
+634.602880 200.00 80000
+634.762880 200.00 80000
+634.922880 200.00 80000
+635.082880 200.00 80000
+635.242880 200.00 80000
+635.402880 200.00 80000
+635.562880 200.00 80000
+635.722880 200.00 80000
+635.882880 200.00 80000
+636.042880 200.00 80000
+636.202880 200.00 80000
+636.362880 200.00 80000
+636.522880 200.00 80000
+636.682880 200.00 80000
+636.842880 200.00 80000
+637.002880 200.00 80000
+637.162880 200.00 80000
+637.322880 200.00 80000
+637.482880 200.00 80000
+637.642880 200.00 80000
+637.802880 200.00 80000
+637.962880 200.00 80000
+638.122880 200.00 80000
+638.282880 200.00 80000
+638.442880 200.00 80000
+638.602880 200.00 80000
+638.762880 200.00 80000
+638.922880 200.00 80000
+639.082880 200.00 80000
+639.242880 200.00 80000
+639.402880 200.00 80000
+639.562880 200.00 80000
+639.722880 200.00 80000
+639.882880 200.00 80000
+640.042880 200.00 80000
+640.202880 200.00 80000
+640.362880 200.00 80000
+640.522880 200.00 80000
+640.682880 200.00 80000
+640.842880 200.00 80000
+641.002880 200.00 80000
+641.162880 200.00 80000
+641.322880 200.00 80000
+641.482880 200.00 80000
+641.642880 200.00 80000
+641.802880 200.00 80000
+641.962880 200.00 80000
+642.122880 200.00 80000
+642.282880 200.00 80000
+642.442880 200.00 80000
+642.602880 200.00 80000
+642.762880 200.00 80000
+642.922880 200.00 80000
+643.082880 200.00 80000
+643.242880 200.00 80000
+643.402880 200.00 80000
+643.562880 200.00 80000
+643.722880 200.00 80000
+643.882880 200.00 80000
+644.042880 200.00 80000
+644.202880 200.00 80000
+644.362880 200.00 80000
+644.522880 200.00 80000
+644.682880 200.00 80000
+644.842880 200.00 80000
+645.002880 200.00 80000
+645.162880 200.00 80000
+645.322880 200.00 80000
+645.482880 200.00 80000
+645.642880 200.00 80000
+645.802880 200.00 80000
+645.962880 200.00 80000
+646.122880 200.00 80000
+646.282880 200.00 80000
+646.442880 200.00 80000
+646.602880 200.00 80000
+646.762880 200.00 80000
+646.922880 200.00 80000
+647.082880 200.00 80000
+647.242880 200.00 80000
+647.402880 200.00 80000
+647.562880 200.00 80000
+647.722880 200.00 80000
+647.882880 200.00 80000
+648.042880 200.00 80000
+648.202880 200.00 80000
+648.362880 200.00 80000
+648.522880 200.00 80000
+648.682880 200.00 80000
+648.842880 200.00 80000
+649.002880 200.00 80000
+649.162880 200.00 80000
+649.322880 200.00 80000
+649.482880 200.00 80000
+649.642880 200.00 80000
+649.802880 200.00 80000
+649.962880 200.00 80000
+650.122880 200.00 80000
+650.282880 200.00 80000
+650.442880 200.00 80000
+650.602880 200.00 80000
+650.762880 200.00 80000
+650.922880 200.00 80000
+651.082880 200.00 80000
+651.242880 200.00 80000
+651.402880 200.00 80000
+651.562880 200.00 80000
+651.722880 200.00 80000
+651.882880 200.00 80000
+652.042880 200.00 80000
+652.202880 200.00 80000
+652.362880 200.00 80000
+652.522880 200.00 80000
+652.682880 200.00 80000
+652.842880 200.00 80000
+653.002880 200.00 80000
+653.162880 200.00 80000
+653.322880 200.00 80000
+653.482880 200.00 80000
+653.642880 200.00 80000
+653.802880 200.00 80000
+653.962880 200.00 80000
+654.122880 200.00 80000
+654.282880 200.00 80000
+654.442880 200.00 80000
+654.602880 200.00 80000
+654.762880 200.00 80000
+654.922880 200.00 80000
+655.082880 200.00 80000
+655.242880 200.00 80000
+655.402880 200.00 80000
+655.562880 200.00 80000
+655.722880 200.00 80000
+655.882880 200.00 80000
+656.042880 200.00 80000
+656.202880 200.00 80000
+656.362880 200.00 80000
+656.522880 200.00 80000
+656.682880 200.00 80000
+656.842880 200.00 80000
+657.002880 200.00 80000
+657.162880 200.00 80000
+657.322880 200.00 80000
+657.482880 200.00 80000
+657.642880 200.00 80000
+657.802880 200.00 80000
+657.962880 200.00 80000
+658.122880 200.00 80000
+658.282880 200.00 80000
+658.442880 200.00 80000
+658.602880 200.00 80000
+658.762880 200.00 80000
+658.922880 200.00 80000
+659.082880 200.00 80000
+659.242880 200.00 80000
+659.402880 200.00 80000
+659.562880 200.00 80000
+659.722880 200.00 80000
+659.882880 200.00 80000
+660.042880 200.00 80000
+660.202880 200.00 80000
+660.362880 200.00 80000
+660.522880 200.00 80000
+660.682880 200.00 80000
+660.842880 200.00 80000
+661.002880 200.00 80000
+661.162880 200.00 80000
+661.322880 200.00 80000
+661.482880 200.00 80000
+661.642880 200.00 80000
+661.802880 200.00 80000
+661.962880 200.00 80000
+662.122880 200.00 80000
+662.282880 200.00 80000
+662.442880 200.00 80000
+662.602880 200.00 80000
+662.762880 200.00 80000
+662.922880 200.00 80000
+663.082880 200.00 80000
+663.242880 200.00 80000
+663.402880 200.00 80000
+663.562880 200.00 80000
+663.722880 200.00 80000
+663.882880 200.00 80000
+664.042880 200.00 80000
+664.202880 200.00 80000
+664.362880 200.00 80000
+664.522880 200.00 80000
+664.682880 200.00 80000
+664.842880 200.00 80000
+665.002880 200.00 80000
+665.162880 200.00 80000
+665.322880 200.00 80000
+665.482880 200.00 80000
+665.642880 200.00 80000
+665.802880 200.00 80000
+665.962880 200.00 80000
+666.122880 200.00 80000
+666.282880 200.00 80000
+666.442880 200.00 80000
+666.602880 200.00 80000
+666.762880 200.00 80000
+666.922880 200.00 80000
+667.082880 200.00 80000
+667.242880 200.00 80000
+667.402880 200.00 80000
+667.562880 200.00 80000
+667.722880 200.00 80000
+667.882880 200.00 80000
+668.042880 200.00 80000
+668.202880 200.00 80000
+668.362880 200.00 80000
+668.522880 200.00 80000
+668.682880 200.00 80000
+668.842880 200.00 80000
+669.002880 200.00 80000
+669.162880 200.00 80000
+669.322880 200.00 80000
+669.482880 200.00 80000
+669.642880 200.00 80000
+669.802880 200.00 80000
+669.962880 200.00 80000
+670.122880 200.00 80000
+670.282880 200.00 80000
+670.442880 200.00 80000
+670.602880 200.00 80000
+670.762880 200.00 80000
+670.922880 200.00 80000
+671.082880 200.00 80000
+671.242880 200.00 80000
+671.402880 200.00 80000
+671.562880 200.00 80000
+671.722880 200.00 80000
+671.882880 200.00 80000
+672.042880 200.00 80000
+672.202880 200.00 80000
+672.362880 200.00 80000
+672.522880 200.00 80000
+672.682880 200.00 80000
+672.842880 200.00 80000
+673.002880 200.00 80000
+673.162880 200.00 80000
+673.322880 200.00 80000
+673.482880 200.00 80000
+673.642880 200.00 80000
+673.802880 200.00 80000
+673.962880 200.00 80000
+674.122880 200.00 80000
+674.282880 200.00 80000
+674.442880 200.00 80000
+674.602880 200.00 80000
+674.762880 200.00 80000
+674.922880 200.00 80000
+675.082880 200.00 80000
+675.242880 200.00 80000
+675.402880 200.00 80000
+675.562880 200.00 80000
+675.722880 200.00 80000
+675.882880 200.00 80000
+676.042880 200.00 80000
+676.202880 200.00 80000
+676.362880 200.00 80000
+676.522880 200.00 80000
+676.682880 200.00 80000
+676.842880 200.00 80000
+677.002880 200.00 80000
+677.162880 200.00 80000
+677.322880 200.00 80000
+677.482880 200.00 80000
+677.642880 200.00 80000
+677.802880 200.00 80000
+677.962880 200.00 80000
+678.122880 200.00 80000
+678.282880 200.00 80000
+678.442880 200.00 80000
+678.602880 200.00 80000
+678.762880 200.00 80000
+678.922880 200.00 80000
+679.082880 200.00 80000
+679.242880 200.00 80000
+679.402880 200.00 80000
+679.562880 200.00 80000
+679.722880 200.00 80000
+679.882880 200.00 80000
+680.042880 200.00 80000
+680.202880 200.00 80000
+680.362880 200.00 80000
+680.522880 200.00 80000
+680.682880 200.00 80000
+680.842880 200.00 80000
+681.002880 200.00 80000
+681.162880 200.00 80000
+681.322880 200.00 80000
+681.482880 200.00 80000
+681.642880 200.00 80000
+681.802880 200.00 80000
+681.962880 200.00 80000
+682.122880 200.00 80000
+682.282880 200.00 80000
+682.442880 200.00 80000
+682.602880 200.00 80000
+682.762880 200.00 80000
+682.922880 200.00 80000
+683.082880 200.00 80000
+683.242880 200.00 80000
+683.402880 200.00 80000
+683.562880 200.00 80000
+683.722880 200.00 80000
+683.882880 200.00 80000
+684.042880 200.00 80000
+684.202880 200.00 80000
+684.362880 200.00 80000
+684.522880 200.00 80000
+684.682880 200.00 80000
+684.842880 200.00 80000
+685.002880 200.00 80000
+685.162880 200.00 80000
+685.322880 200.00 80000
+685.482880 200.00 80000
+685.642880 200.00 80000
+685.802880 200.00 80000
+685.962880 200.00 80000
+686.122880 200.00 80000
+686.282880 200.00 80000
+686.442880 200.00 80000
+686.602880 200.00 80000
+686.762880 200.00 80000
+686.922880 200.00 80000
+687.082880 200.00 80000
+687.242880 200.00 80000
+687.402880 200.00 80000
+687.562880 200.00 80000
+687.722880 200.00 80000
+687.882880 200.00 80000
+688.042880 200.00 80000
+688.202880 200.00 80000
+688.362880 200.00 80000
+688.522880 200.00 80000
+688.682880 200.00 80000
+688.842880 200.00 80000
+689.002880 200.00 80000
+689.162880 200.00 80000
+689.322880 200.00 80000
+689.482880 200.00 80000
+689.642880 200.00 80000
+689.802880 200.00 80000
+689.962880 200.00 80000
+690.122880 200.00 80000
+690.282880 200.00 80000
+690.442880 200.00 80000
+690.602880 200.00 80000
+690.762880 200.00 80000
+690.922880 200.00 80000
+691.082880 200.00 80000
+691.242880 200.00 80000
+691.402880 200.00 80000
+691.562880 200.00 80000
+691.722880 200.00 80000
+691.882880 200.00 80000
+692.042880 200.00 80000
+692.202880 200.00 80000
+692.362880 200.00 80000
+692.522880 200.00 80000
+692.682880 200.00 80000
+692.842880 200.00 80000
+693.002880 200.00 80000
+693.162880 200.00 80000
+693.322880 200.00 80000
+693.482880 200.00 80000
+693.642880 200.00 80000
+693.802880 200.00 80000
+693.962880 200.00 80000
+694.122880 200.00 80000
+694.282880 200.00 80000
+694.442880 200.00 80000
+694.602880 200.00 80000
+694.762880 200.00 80000
+694.922880 200.00 80000
+695.082880 200.00 80000
+695.242880 200.00 80000
+695.402880 200.00 80000
+695.562880 200.00 80000
+695.722880 200.00 80000
+695.882880 200.00 80000
+696.042880 200.00 80000
+696.202880 200.00 80000
+696.362880 200.00 80000
+696.522880 200.00 80000
+696.682880 200.00 80000
+696.842880 200.00 80000
+697.002880 200.00 80000
+697.162880 200.00 80000
+697.322880 200.00 80000
+697.482880 200.00 80000
+697.642880 200.00 80000
+697.802880 200.00 80000
+697.962880 200.00 80000
+698.122880 200.00 80000
+698.282880 200.00 80000
+698.442880 200.00 80000
+698.602880 200.00 80000
+698.762880 200.00 80000
+698.922880 200.00 80000
+699.082880 200.00 80000
+699.242880 200.00 80000
+699.402880 200.00 80000
+699.562880 200.00 80000
+699.722880 200.00 80000
+699.882880 200.00 80000
+700.042880 200.00 80000
+700.202880 200.00 80000
+700.362880 200.00 80000
+700.522880 200.00 80000
+700.682880 200.00 80000
+700.842880 200.00 80000
+701.002880 200.00 80000
+701.162880 200.00 80000
+701.322880 200.00 80000
+701.482880 200.00 80000
+701.642880 200.00 80000
+701.802880 200.00 80000
+701.962880 200.00 80000
+702.122880 200.00 80000
+702.282880 200.00 80000
+702.442880 200.00 80000
+702.602880 200.00 80000
+702.762880 200.00 80000
+702.922880 200.00 80000
+703.082880 200.00 80000
+703.242880 200.00 80000
+703.402880 200.00 80000
+703.562880 200.00 80000
+703.722880 200.00 80000
+703.882880 200.00 80000
+704.042880 200.00 80000
+704.202880 200.00 80000
+704.362880 200.00 80000
+704.522880 200.00 80000
+704.682880 200.00 80000
+704.842880 200.00 80000
+705.002880 200.00 80000
+705.162880 200.00 80000
+705.322880 200.00 80000
+705.482880 200.00 80000
+705.642880 200.00 80000
+705.802880 200.00 80000
+705.962880 200.00 80000
+706.122880 200.00 80000
+706.282880 200.00 80000
+706.442880 200.00 80000
+706.602880 200.00 80000
+706.762880 200.00 80000
+706.922880 200.00 80000
+707.082880 200.00 80000
+707.242880 200.00 80000
+707.402880 200.00 80000
+707.562880 200.00 80000
+707.722880 200.00 80000
+707.882880 200.00 80000
+708.042880 200.00 80000
+708.202880 200.00 80000
+708.362880 200.00 80000
+708.522880 200.00 80000
+708.682880 200.00 80000
+708.842880 200.00 80000
+709.002880 200.00 80000
+709.162880 200.00 80000
+709.322880 200.00 80000
+709.482880 200.00 80000
+709.642880 200.00 80000
+709.802880 200.00 80000
+709.962880 200.00 80000
+710.122880 200.00 80000
+710.282880 200.00 80000
+710.442880 200.00 80000
+710.602880 200.00 80000
+710.762880 200.00 80000
+710.922880 200.00 80000
+711.082880 200.00 80000
+711.242880 200.00 80000
+711.402880 200.00 80000
+711.562880 200.00 80000
+711.722880 200.00 80000
+711.882880 200.00 80000
+712.042880 200.00 80000
+712.202880 200.00 80000
+712.362880 200.00 80000
+712.522880 200.00 80000
+712.682880 200.00 80000
+712.842880 200.00 80000
+713.002880 200.00 80000
+713.162880 200.00 80000
+713.322880 200.00 80000
+713.482880 200.00 80000
+713.642880 200.00 80000
+713.802880 200.00 80000
+713.962880 200.00 80000
+714.122880 200.00 80000
+714.282880 200.00 80000
+714.442880 200.00 80000
+714.602880 200.00 80000
+714.762880 200.00 80000
+714.922880 200.00 80000
+715.082880 200.00 80000
+715.242880 200.00 80000
+715.402880 200.00 80000
+715.562880 200.00 80000
+715.722880 200.00 80000
+715.882880 200.00 80000
+716.042880 200.00 80000
+716.202880 200.00 80000
+716.362880 200.00 80000
+716.522880 200.00 80000
+716.682880 200.00 80000
+716.842880 200.00 80000
+717.002880 200.00 80000
+717.162880 200.00 80000
+717.322880 200.00 80000
+717.482880 200.00 80000
+717.642880 200.00 80000
+717.802880 200.00 80000
+717.962880 200.00 80000
+718.122880 200.00 80000
+718.282880 200.00 80000
+718.442880 200.00 80000
+718.602880 200.00 80000
+718.762880 200.00 80000
+718.922880 200.00 80000
+719.082880 200.00 80000
+719.242880 200.00 80000
+719.402880 200.00 80000
+719.562880 200.00 80000
+719.722880 200.00 80000
+719.882880 200.00 80000
+720.042880 200.00 80000
+720.202880 200.00 80000
+720.362880 200.00 80000
+720.522880 200.00 80000
+720.682880 200.00 80000
+720.842880 200.00 80000
+721.002880 200.00 80000
+721.162880 200.00 80000
+721.322880 200.00 80000
+721.482880 200.00 80000
+721.642880 200.00 80000
+721.802880 200.00 80000
+721.962880 200.00 80000
+722.122880 200.00 80000
+722.282880 200.00 80000
+722.442880 200.00 80000
+722.602880 200.00 80000
+722.762880 200.00 80000
+722.922880 200.00 80000
+723.082880 200.00 80000
+723.242880 200.00 80000
+723.402880 200.00 80000
+723.562880 200.00 80000
+723.722880 200.00 80000
+723.882880 200.00 80000
+724.042880 200.00 80000
+724.202880 200.00 80000
+724.362880 200.00 80000
+724.522880 200.00 80000
+724.682880 200.00 80000
+724.842880 200.00 80000
+725.002880 200.00 80000
+725.162880 200.00 80000
+725.322880 200.00 80000
+725.482880 200.00 80000
+725.642880 200.00 80000
+725.802880 200.00 80000
+725.962880 200.00 80000
+726.122880 200.00 80000
+726.282880 200.00 80000
+726.442880 200.00 80000
+726.602880 200.00 80000
+726.762880 200.00 80000
+726.922880 200.00 80000
+727.082880 200.00 80000
+727.242880 200.00 80000
+727.402880 200.00 80000
+727.562880 200.00 80000
+727.722880 200.00 80000
+727.882880 200.00 80000
+728.042880 200.00 80000
+728.202880 200.00 80000
+728.362880 200.00 80000
+728.522880 200.00 80000
+728.682880 200.00 80000
+728.842880 200.00 80000
+729.002880 200.00 80000
+729.162880 200.00 80000
+729.322880 200.00 80000
+729.482880 200.00 80000
+729.642880 200.00 80000
+729.802880 200.00 80000
+729.962880 200.00 80000
+730.122880 200.00 80000
+730.282880 200.00 80000
+730.442880 200.00 80000
+730.602880 200.00 80000
+730.762880 200.00 80000
+730.922880 200.00 80000
+731.082880 200.00 80000
+731.242880 200.00 80000
+731.402880 200.00 80000
+731.562880 200.00 80000
+731.722880 200.00 80000
+731.882880 200.00 80000
+732.042880 200.00 80000
+732.202880 200.00 80000
+732.362880 200.00 80000
+732.522880 200.00 80000
+732.682880 200.00 80000
+732.842880 200.00 80000
+733.002880 200.00 80000
+733.162880 200.00 80000
+733.322880 200.00 80000
+733.482880 200.00 80000
+733.642880 200.00 80000
+733.802880 200.00 80000
+733.962880 200.00 80000
+734.122880 200.00 80000
+734.282880 200.00 80000
+734.442880 200.00 80000
+734.602880 200.00 80000
+734.762880 200.00 80000
+734.922880 200.00 80000
+735.082880 200.00 80000
+735.242880 200.00 80000
+735.402880 200.00 80000
+735.562880 200.00 80000
+735.722880 200.00 80000
+735.882880 200.00 80000
+736.042880 200.00 80000
+736.202880 200.00 80000
+736.362880 200.00 80000
+736.522880 200.00 80000
+736.682880 200.00 80000
+736.842880 200.00 80000
+737.002880 200.00 80000
+737.162880 200.00 80000
+737.322880 200.00 80000
+737.482880 200.00 80000
+737.642880 200.00 80000
+737.802880 200.00 80000
+737.962880 200.00 80000
+738.122880 200.00 80000
+738.282880 200.00 80000
+738.442880 200.00 80000
+738.602880 200.00 80000
+738.762880 200.00 80000
+738.922880 200.00 80000
+739.082880 200.00 80000
+739.242880 200.00 80000
+739.402880 200.00 80000
+739.562880 200.00 80000
+739.722880 200.00 80000
+739.882880 200.00 80000
+740.042880 200.00 80000
+740.202880 200.00 80000
+740.362880 200.00 80000
+740.522880 200.00 80000
+740.682880 200.00 80000
+740.842880 200.00 80000
+741.002880 200.00 80000
+741.162880 200.00 80000
+741.322880 200.00 80000
+741.482880 200.00 80000
+741.642880 200.00 80000
+741.802880 200.00 80000
+741.962880 200.00 80000
+742.122880 200.00 80000
+742.282880 200.00 80000
+742.442880 200.00 80000
+742.602880 200.00 80000
+742.762880 200.00 80000
+742.922880 200.00 80000
+743.082880 200.00 80000
+743.242880 200.00 80000
+743.402880 200.00 80000
+743.562880 200.00 80000
+743.722880 200.00 80000
+743.882880 200.00 80000
+744.042880 200.00 80000
+744.202880 200.00 80000
+744.362880 200.00 80000
+744.522880 200.00 80000
+744.682880 200.00 80000
+744.842880 200.00 80000
+745.002880 200.00 80000
+745.162880 200.00 80000
+745.322880 200.00 80000
+745.482880 200.00 80000
+745.642880 200.00 80000
+745.802880 200.00 80000
+745.962880 200.00 80000
+746.122880 200.00 80000
+746.282880 200.00 80000
+746.442880 200.00 80000
+746.602880 200.00 80000
+746.762880 200.00 80000
+746.922880 200.00 80000
+747.082880 200.00 80000
+747.242880 200.00 80000
+747.402880 200.00 80000
+747.562880 200.00 80000
+747.722880 200.00 80000
+747.882880 200.00 80000
+748.042880 200.00 80000
+748.202880 200.00 80000
+748.362880 200.00 80000
+748.522880 200.00 80000
+748.682880 200.00 80000
+748.842880 200.00 80000
+749.002880 200.00 80000
+749.162880 200.00 80000
+749.322880 200.00 80000
+749.482880 200.00 80000
+749.642880 200.00 80000
+749.802880 200.00 80000
+749.962880 200.00 80000
+750.122880 200.00 80000
+750.282880 200.00 80000
+750.442880 200.00 80000
+750.602880 200.00 80000
+750.762880 200.00 80000
+750.922880 200.00 80000
+751.082880 200.00 80000
+751.242880 200.00 80000
+751.402880 200.00 80000
+751.562880 200.00 80000
+751.722880 200.00 80000
+751.882880 200.00 80000
+752.042880 200.00 80000
+752.202880 200.00 80000
+752.362880 200.00 80000
+752.522880 200.00 80000
+752.682880 200.00 80000
+752.842880 200.00 80000
+753.002880 200.00 80000
+753.162880 200.00 80000
+753.322880 200.00 80000
+753.482880 200.00 80000
+753.642880 200.00 80000
+753.802880 200.00 80000
+753.962880 200.00 80000
+754.122880 200.00 80000
+754.282880 200.00 80000
+754.442880 200.00 80000
+754.602880 200.00 80000
+754.762880 200.00 80000
+754.922880 200.00 80000
+755.082880 200.00 80000
+755.242880 200.00 80000
+755.402880 200.00 80000
+755.562880 200.00 80000
+755.722880 200.00 80000
+755.882880 200.00 80000
+756.042880 200.00 80000
+756.202880 200.00 80000
+756.362880 200.00 80000
+756.522880 200.00 80000
+756.682880 200.00 80000
+756.842880 200.00 80000
+757.002880 200.00 80000
+757.162880 200.00 80000
+757.322880 200.00 80000
+757.482880 200.00 80000
+757.642880 200.00 80000
+757.802880 200.00 80000
+757.962880 200.00 80000
+758.122880 200.00 80000
+758.282880 200.00 80000
+758.442880 200.00 80000
+758.602880 200.00 80000
+758.762880 200.00 80000
+758.922880 200.00 80000
+759.082880 200.00 80000
+759.242880 200.00 80000
+759.402880 200.00 80000
+759.562880 200.00 80000
+759.722880 200.00 80000
+759.882880 200.00 80000
+760.042880 200.00 80000
+760.202880 200.00 80000
+760.362880 200.00 80000
+760.522880 200.00 80000
+760.682880 200.00 80000
+760.842880 200.00 80000
+761.002880 200.00 80000
+761.162880 200.00 80000
+761.322880 200.00 80000
+761.482880 200.00 80000
+761.642880 200.00 80000
+761.802880 200.00 80000
+761.962880 200.00 80000
+762.122880 200.00 80000
+762.282880 200.00 80000
+762.442880 200.00 80000
+762.602880 200.00 80000
+762.762880 200.00 80000
+762.922880 200.00 80000
+763.082880 200.00 80000
+763.242880 200.00 80000
+763.402880 200.00 80000
+763.562880 200.00 80000
+763.722880 200.00 80000
+763.882880 200.00 80000
+764.042880 200.00 80000
+764.202880 200.00 80000
+764.362880 200.00 80000
+764.522880 200.00 80000
+764.682880 200.00 80000
+764.842880 200.00 80000
+765.002880 200.00 80000
+765.162880 200.00 80000
+765.322880 200.00 80000
+765.482880 200.00 80000
+765.642880 200.00 80000
+765.802880 200.00 80000
+765.962880 200.00 80000
+766.122880 200.00 80000
+766.282880 200.00 80000
+766.442880 200.00 80000
+766.602880 200.00 80000
+766.762880 200.00 80000
+766.922880 200.00 80000
+767.082880 200.00 80000
+767.242880 200.00 80000
+767.402880 200.00 80000
+767.562880 200.00 80000
+767.722880 200.00 80000
+767.882880 200.00 80000
+768.042880 200.00 80000
+768.202880 200.00 80000
+768.362880 200.00 80000
+768.522880 200.00 80000
+768.682880 200.00 80000
+768.842880 200.00 80000
+769.002880 200.00 80000
+769.162880 200.00 80000
+769.322880 200.00 80000
+769.482880 200.00 80000
+769.642880 200.00 80000
+769.802880 200.00 80000
+769.962880 200.00 80000
+770.122880 200.00 80000
+770.282880 200.00 80000
+770.442880 200.00 80000
+770.602880 200.00 80000
+770.762880 200.00 80000
+770.922880 200.00 80000
+771.082880 200.00 80000
+771.242880 200.00 80000
+771.402880 200.00 80000
+771.562880 200.00 80000
+771.722880 200.00 80000
+771.882880 200.00 80000
+772.042880 200.00 80000
+772.202880 200.00 80000
+772.362880 200.00 80000
+772.522880 200.00 80000
+772.682880 200.00 80000
+772.842880 200.00 80000
+773.002880 200.00 80000
+773.162880 200.00 80000
+773.322880 200.00 80000
+773.482880 200.00 80000
+773.642880 200.00 80000
+773.802880 200.00 80000
+773.962880 200.00 80000
+774.122880 200.00 80000
+774.282880 200.00 80000
+774.442880 200.00 80000
+774.602880 200.00 80000
+774.762880 200.00 80000
+774.922880 200.00 80000
+775.082880 200.00 80000
+775.242880 200.00 80000
+775.402880 200.00 80000
+775.562880 200.00 80000
+775.722880 200.00 80000
+775.882880 200.00 80000
+776.042880 200.00 80000
+776.202880 200.00 80000
+776.362880 200.00 80000
+776.522880 200.00 80000
+776.682880 200.00 80000
+776.842880 200.00 80000
+777.002880 200.00 80000
+777.162880 200.00 80000
+777.322880 200.00 80000
+777.482880 200.00 80000
+777.642880 200.00 80000
+777.802880 200.00 80000
+777.962880 200.00 80000
+778.122880 200.00 80000
+778.282880 200.00 80000
+778.442880 200.00 80000
+778.602880 200.00 80000
+778.762880 200.00 80000
+778.922880 200.00 80000
+779.082880 200.00 80000
+779.242880 200.00 80000
+779.402880 200.00 80000
+779.562880 200.00 80000
+779.722880 200.00 80000
+779.882880 200.00 80000
+780.042880 200.00 80000
+780.202880 200.00 80000
+780.362880 200.00 80000
+780.522880 200.00 80000
+780.682880 200.00 80000
+780.842880 200.00 80000
+781.002880 200.00 80000
+781.162880 200.00 80000
+781.322880 200.00 80000
+781.482880 200.00 80000
+781.642880 200.00 80000
+781.802880 200.00 80000
+781.962880 200.00 80000
+782.122880 200.00 80000
+782.282880 200.00 80000
+782.442880 200.00 80000
+782.602880 200.00 80000
+782.762880 200.00 80000
+782.922880 200.00 80000
+783.082880 200.00 80000
+783.242880 200.00 80000
+783.402880 200.00 80000
+783.562880 200.00 80000
+783.722880 200.00 80000
+783.882880 200.00 80000
+784.042880 200.00 80000
+784.202880 200.00 80000
+784.362880 200.00 80000
+784.522880 200.00 80000
+784.682880 200.00 80000
+784.842880 200.00 80000
+785.002880 200.00 80000
+785.162880 200.00 80000
+785.322880 200.00 80000
+785.482880 200.00 80000
+785.642880 200.00 80000
+785.802880 200.00 80000
+785.962880 200.00 80000
+786.122880 200.00 80000
+786.282880 200.00 80000
+786.442880 200.00 80000
+786.602880 200.00 80000
+786.762880 200.00 80000
+786.922880 200.00 80000
+787.082880 200.00 80000
+787.242880 200.00 80000
+787.402880 200.00 80000
+787.562880 200.00 80000
+787.722880 200.00 80000
+787.882880 200.00 80000
+788.042880 200.00 80000
+788.202880 200.00 80000
+788.362880 200.00 80000
+788.522880 200.00 80000
+788.682880 200.00 80000
+788.842880 200.00 80000
+789.002880 200.00 80000
+789.162880 200.00 80000
+789.322880 200.00 80000
+789.482880 200.00 80000
+789.642880 200.00 80000
+789.802880 200.00 80000
+789.962880 200.00 80000
+790.122880 200.00 80000
+790.282880 200.00 80000
+790.442880 200.00 80000
+790.602880 200.00 80000
+790.762880 200.00 80000
+790.922880 200.00 80000
+791.082880 200.00 80000
+791.242880 200.00 80000
+791.402880 200.00 80000
+791.562880 200.00 80000
+791.722880 200.00 80000
+791.882880 200.00 80000
+792.042880 200.00 80000
+792.202880 200.00 80000
+792.362880 200.00 80000
+792.522880 200.00 80000
+792.682880 200.00 80000
+792.842880 200.00 80000
+793.002880 200.00 80000
+793.162880 200.00 80000
+793.322880 200.00 80000
+793.482880 200.00 80000
+793.642880 200.00 80000
+793.802880 200.00 80000
+793.962880 200.00 80000
+794.122880 200.00 80000
+794.282880 200.00 80000
+794.442880 200.00 80000
+794.602880 200.00 80000
+794.762880 200.00 80000
+794.922880 200.00 80000
+795.082880 200.00 80000
+795.242880 200.00 80000
+795.402880 200.00 80000
+795.562880 200.00 80000
+795.722880 200.00 80000
+795.882880 200.00 80000
+796.042880 200.00 80000
+796.202880 200.00 80000
+796.362880 200.00 80000
+796.522880 200.00 80000
+796.682880 200.00 80000
+796.842880 200.00 80000
+797.002880 200.00 80000
+797.162880 200.00 80000
+797.322880 200.00 80000
+797.482880 200.00 80000
+797.642880 200.00 80000
+797.802880 200.00 80000
+797.962880 200.00 80000
+798.122880 200.00 80000
+798.282880 200.00 80000
+798.363264 199.04 80384
+798.443648 199.04 80384
+798.524032 199.04 80384
+798.604416 199.04 80384
+798.684800 199.04 80384
+798.765696 197.78 80896
+798.846592 197.78 80896
+798.928000 196.54 81408
+799.009408 196.54 81408
+799.091328 195.31 81920
+799.173248 195.31 81920
+799.255680 194.10 82432
+799.338112 194.10 82432
+799.421056 192.90 82944
+799.504000 192.90 82944
+799.587456 191.72 83456
+799.670912 191.72 83456
+799.754368 191.72 83456
+799.837824 191.72 83456
+799.921792 190.55 83968
+800.005760 190.55 83968
+800.090240 189.39 84480
+800.174720 189.39 84480
+800.259712 188.25 84992
+800.344704 188.25 84992
+800.430208 187.13 85504
+800.516224 186.01 86016
+800.602240 186.01 86016
+800.688768 184.91 86528
+800.775296 184.91 86528
+800.862336 183.82 87040
+800.949376 183.82 87040
+801.036928 182.75 87552
+801.124480 182.75 87552
+801.212544 181.69 88064
+801.300608 181.69 88064
+801.389184 180.64 88576
+801.478272 179.60 89088
+801.567360 179.60 89088
+801.656448 179.60 89088
+801.745536 179.60 89088
+801.835136 178.57 89600
+801.924736 178.57 89600
+802.014848 177.56 90112
+802.105472 176.55 90624
+802.196096 176.55 90624
+802.287232 175.56 91136
+802.378368 175.56 91136
+802.470016 174.58 91648
+802.562176 173.61 92160
+802.654336 173.61 92160
+802.747008 172.65 92672
+802.840192 171.70 93184
+802.933376 171.70 93184
+803.027072 170.77 93696
+803.120768 170.77 93696
+803.214976 169.84 94208
+803.309696 168.92 94720
+803.404416 168.92 94720
+803.499648 168.01 95232
+803.595392 167.11 95744
+803.691136 167.11 95744
+803.787392 166.22 96256
+803.884160 165.34 96768
+803.980928 165.34 96768
+804.078208 164.47 97280
+804.176000 163.61 97792
+804.273792 163.61 97792
+804.372096 162.76 98304
+804.470912 161.92 98816
+804.570240 161.08 99328
+804.669568 161.08 99328
+804.769920 159.44 100352
+804.870784 158.63 100864
+804.972160 157.83 101376
+805.073536 157.83 101376
+805.175424 157.04 101888
+805.277824 156.25 102400
+805.380736 155.47 102912
+805.483648 155.47 102912
+805.587072 154.70 103424
+805.691008 153.94 103936
+805.795456 153.19 104448
+805.899904 153.19 104448
+806.004864 152.44 104960
+806.110336 151.70 105472
+806.216832 150.24 106496
+806.323840 149.52 107008
+806.431360 148.81 107520
+806.538880 148.81 107520
+806.646912 148.10 108032
+806.755456 147.41 108544
+806.864512 146.71 109056
+806.974080 146.03 109568
+807.084672 144.68 110592
+807.195776 144.01 111104
+807.306880 144.01 111104
+807.418496 143.35 111616
+807.530624 142.69 112128
+807.643264 142.05 112640
+807.756416 141.40 113152
+807.870592 140.13 114176
+807.985280 139.51 114688
+808.100480 138.89 115200
+808.216192 138.27 115712
+808.332928 137.06 116736
+808.450176 136.46 117248
+808.567936 135.87 117760
+808.686208 135.28 118272
+808.805504 134.12 119296
+808.925312 133.55 119808
+809.045632 132.98 120320
+809.166464 132.42 120832
+809.288320 131.30 121856
+809.410688 130.75 122368
+809.533568 130.21 122880
+809.657472 129.13 123904
+809.781888 128.60 124416
+809.907840 127.03 125952
+810.034304 126.52 126464
+810.161280 126.01 126976
+810.289280 125.00 128000
+810.417792 124.50 128512
+810.546816 124.01 129024
+810.677376 122.55 130560
+810.808448 122.07 131072
+810.940544 121.12 132096
+811.072640 121.12 132096
+811.206784 119.27 134144
+811.341952 118.37 135168
+811.477120 118.37 135168
+811.614336 116.60 137216
+811.752576 115.74 138240
+811.890816 115.74 138240
+812.031104 114.05 140288
+812.171392 114.05 140288
+812.313728 112.41 142336
+812.457088 111.61 143360
+812.601472 110.82 144384
+812.746880 110.04 145408
+812.894336 108.51 147456
+813.041792 108.51 147456
+813.191296 107.02 149504
+813.341824 106.29 150528
+813.493376 105.57 151552
+813.646976 104.17 153600
+813.802624 102.80 155648
+813.959296 102.12 156672
+814.116992 101.46 157696
+814.276736 100.16 159744
+814.437504 99.52 160768
+814.600320 98.27 162816
+814.765184 97.05 164864
+814.932096 95.86 166912
+815.100032 95.27 167936
+815.270016 94.13 169984
+815.442048 93.01 172032
+815.616128 91.91 174080
+815.792256 90.84 176128
+815.970432 89.80 178176
+816.150656 88.78 180224
+816.332928 87.78 182272
+816.518272 86.33 185344
+816.705664 85.38 187392
+816.896128 84.01 190464
+817.089664 82.67 193536
+817.285248 81.81 195584
+817.483904 80.54 198656
+817.686656 78.91 202752
+817.892480 77.74 205824
+818.101376 76.59 208896
+818.315392 74.76 214016
+818.532480 73.70 217088
+818.754688 72.00 222208
+818.979968 71.02 225280
+819.210368 69.44 230400
+819.445888 67.93 235520
+819.686528 66.49 240640
+819.932288 65.10 245760
+820.185216 63.26 252928
+820.443264 62.00 258048
+820.707456 60.56 264192
+820.981888 58.30 274432
+821.262464 57.03 280576
+821.553280 55.02 290816
+821.854336 53.15 301056
+822.167680 51.06 313344
+822.493312 49.14 325632
+822.833280 47.06 339968
+823.189632 44.90 356352
+823.564416 42.69 374784
+823.961728 40.27 397312
+824.389760 37.38 428032
+824.850560 34.72 460800
+825.356416 31.63 505856
+825.917568 28.51 561152
+826.568832 24.57 651264
+827.363456 20.14 794624
+828.485760 14.26 1122304
+830.075008 10.07 1589248
+EOF
+plot $data using 1:2 with linespoints
+pause -1
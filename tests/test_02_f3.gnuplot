@@ -0,0 +1,806 @@
+$data <<EOF
+0.112640 142.05 112640
+0.192640 200.00 80000
+0.352640 200.00 80000
+0.512640 200.00 80000
+0.672640 200.00 80000
+0.832640 200.00 80000
+0.992640 200.00 80000
+1.152640 200.00 80000
+1.312640 200.00 80000
+1.472640 200.00 80000
+1.632640 200.00 80000
+1.792640 200.00 80000
+1.952640 200.00 80000
+2.112640 200.00 80000
+2.272640 200.00 80000
+2.432640 200.00 80000
+2.592640 200.00 80000
+2.752640 200.00 80000
+2.912640 200.00 80000
+3.072640 200.00 80000
+3.232640 200.00 80000
+3.392640 200.00 80000
+3.552640 200.00 80000
+3.712640 200.00 80000
+3.872640 200.00 80000
+4.032640 200.00 80000
+4.192640 200.00 80000
+4.352640 200.00 80000
+4.512640 200.00 80000
+4.672640 200.00 80000
+4.832640 200.00 80000
+4.992640 200.00 80000
+5.152640 200.00 80000
+5.312640 200.00 80000
+5.472640 200.00 80000
+5.632640 200.00 80000
+5.792640 200.00 80000
+5.952640 200.00 80000
+6.112640 200.00 80000
+6.272640 200.00 80000
+6.432640 200.00 80000
+6.592640 200.00 80000
+6.752640 200.00 80000
+6.912640 200.00 80000
+7.072640 200.00 80000
+7.232640 200.00 80000
+7.392640 200.00 80000
+7.552640 200.00 80000
+7.712640 200.00 80000
+7.872640 200.00 80000
+8.032640 200.00 80000
+8.192640 200.00 80000
+8.352640 200.00 80000
+8.512640 200.00 80000
+8.672640 200.00 80000
+8.832640 200.00 80000
+8.992640 200.00 80000
+9.152640 200.00 80000
+9.312640 200.00 80000
+9.472640 200.00 80000
+9.632640 200.00 80000
+9.792640 200.00 80000
+9.952640 200.00 80000
+10.112640 200.00 80000
+10.272640 200.00 80000
+10.432640 200.00 80000
+10.592640 200.00 80000
+10.752640 200.00 80000
+10.912640 200.00 80000
+11.072640 200.00 80000
+11.232640 200.00 80000
+11.392640 200.00 80000
+11.552640 200.00 80000
+11.712640 200.00 80000
+11.872640 200.00 80000
+12.032640 200.00 80000
+12.192640 200.00 80000
+12.352640 200.00 80000
+12.512640 200.00 80000
+12.672640 200.00 80000
+12.832640 200.00 80000
+12.992640 200.00 80000
+13.152640 200.00 80000
+13.312640 200.00 80000
+13.472640 200.00 80000
+13.632640 200.00 80000
+13.792640 200.00 80000
+13.952640 200.00 80000
+14.112640 200.00 80000
+14.272640 200.00 80000
+14.432640 200.00 80000
+14.592640 200.00 80000
+14.752640 200.00 80000
+14.912640 200.00 80000
+15.072640 200.00 80000
+15.232640 200.00 80000
+15.392640 200.00 80000
+15.552640 200.00 80000
+15.712640 200.00 80000
+15.872640 200.00 80000
+16.032640 200.00 80000
+16.192640 200.00 80000
+16.352640 200.00 80000
+16.512640 200.00 80000
+16.672640 200.00 80000
+16.832640 200.00 80000
+16.992640 200.00 80000
+17.152640 200.00 80000
+17.312640 200.00 80000
+17.472640 200.00 80000
+17.632640 200.00 80000
+17.792640 200.00 80000
+17.952640 200.00 80000
+18.112640 200.00 80000
+18.272640 200.00 80000
+18.432640 200.00 80000
+18.592640 200.00 80000
+18.752640 200.00 80000
+18.912640 200.00 80000
+19.072640 200.00 80000
+19.232640 200.00 80000
+19.392640 200.00 80000
+19.552640 200.00 80000
+19.712640 200.00 80000
+19.872640 200.00 80000
+20.032640 200.00 80000
+20.192640 200.00 80000
+20.352640 200.00 80000
+20.512640 200.00 80000
+20.672640 200.00 80000
+20.832640 200.00 80000
+20.992640 200.00 80000
+21.152640 200.00 80000
+21.312640 200.00 80000
+21.472640 200.00 80000
+21.632640 200.00 80000
+21.792640 200.00 80000
+21.952640 200.00 80000
+22.112640 200.00 80000
+22.272640 200.00 80000
+22.432640 200.00 80000
+22.592640 200.00 80000
+22.752640 200.00 80000
+22.912640 200.00 80000
+23.072640 200.00 80000
+23.232640 200.00 80000
+23.392640 200.00 80000
+23.552640 200.00 80000
+23.712640 200.00 80000
+23.872640 200.00 80000
+24.032640 200.00 80000
+24.192640 200.00 80000
+24.352640 200.00 80000
+24.512640 200.00 80000
+24.672640 200.00 80000
+24.832640 200.00 80000
+24.992640 200.00 80000
+25.152640 200.00 80000
+25.312640 200.00 80000
+25.472640 200.00 80000
+25.632640 200.00 80000
+25.792640 200.00 80000
+25.952640 200.00 80000
+26.112640 200.00 80000
+26.272640 200.00 80000
+26.432640 200.00 80000
+26.592640 200.00 80000
+26.752640 200.00 80000
+26.912640 200.00 80000
+27.072640 200.00 80000
+27.232640 200.00 80000
+27.392640 200.00 80000
+27.552640 200.00 80000
+27.712640 200.00 80000
+27.872640 200.00 80000
+28.032640 200.00 80000
+28.192640 200.00 80000
+28.352640 200.00 80000
+28.512640 200.00 80000
+28.672640 200.00 80000
+28.832640 200.00 80000
+28.992640 200.00 80000
+29.152640 200.00 80000
+29.312640 200.00 80000
+29.472640 200.00 80000
+29.632640 200.00 80000
+29.792640 200.00 80000
+29.952640 200.00 80000
+30.112640 200.00 80000
+30.272640 200.00 80000
+30.432640 200.00 80000
+30.592640 200.00 80000
+30.752640 200.00 80000
+30.912640 200.00 80000
+31.072640 200.00 80000
+31.232640 200.00 80000
+31.392640 200.00 80000
+31.552640 200.00 80000
+31.712640 200.00 80000
+31.872640 200.00 80000
+32.032640 200.00 80000
+32.192640 200.00 80000
+32.352640 200.00 80000
+32.512640 200.00 80000
+32.672640 200.00 80000
+32.832640 200.00 80000
+32.992640 200.00 80000
+33.152640 200.00 80000
+33.312640 200.00 80000
+33.472640 200.00 80000
+33.632640 200.00 80000
+33.792640 200.00 80000
+33.952640 200.00 80000
+34.112640 200.00 80000
+34.272640 200.00 80000
+34.432640 200.00 80000
+34.592640 200.00 80000
+34.752640 200.00 80000
+34.912640 200.00 80000
+35.072640 200.00 80000
+35.232640 200.00 80000
+35.392640 200.00 80000
+35.552640 200.00 80000
+35.712640 200.00 80000
+35.872640 200.00 80000
+36.032640 200.00 80000
+36.192640 200.00 80000
+36.352640 200.00 80000
+36.512640 200.00 80000
+36.672640 200.00 80000
+36.832640 200.00 80000
+36.992640 200.00 80000
+37.152640 200.00 80000
+37.312640 200.00 80000
+37.472640 200.00 80000
+37.632640 200.00 80000
+37.792640 200.00 80000
+37.952640 200.00 80000
+38.112640 200.00 80000
+38.272640 200.00 80000
+38.432640 200.00 80000
+38.592640 200.00 80000
+38.752640 200.00 80000
+38.912640 200.00 80000
+39.072640 200.00 80000
+39.232640 200.00 80000
+39.392640 200.00 80000
+39.552640 200.00 80000
+39.712640 200.00 80000
+39.872640 200.00 80000
+40.032640 200.00 80000
+40.192640 200.00 80000
+40.352640 200.00 80000
+40.512640 200.00 80000
+40.672640 200.00 80000
+40.832640 200.00 80000
+40.992640 200.00 80000
+41.152640 200.00 80000
+41.312640 200.00 80000
+41.472640 200.00 80000
+41.632640 200.00 80000
+41.792640 200.00 80000
+41.952640 200.00 80000
+42.112640 200.00 80000
+42.272640 200.00 80000
+42.432640 200.00 80000
+42.592640 200.00 80000
+42.752640 200.00 80000
+42.912640 200.00 80000
+43.072640 200.00 80000
+43.232640 200.00 80000
+43.392640 200.00 80000
+43.552640 200.00 80000
+43.712640 200.00 80000
+43.872640 200.00 80000
+44.032640 200.00 80000
+44.192640 200.00 80000
+44.352640 200.00 80000
+44.512640 200.00 80000
+44.672640 200.00 80000
+44.832640 200.00 80000
+44.992640 200.00 80000
+45.152640 200.00 80000
+45.312640 200.00 80000
+45.472640 200.00 80000
+45.632640 200.00 80000
+45.792640 200.00 80000
+45.952640 200.00 80000
+46.112640 200.00 80000
+46.272640 200.00 80000
+46.432640 200.00 80000
+46.592640 200.00 80000
+46.752640 200.00 80000
+46.912640 200.00 80000
+47.072640 200.00 80000
+47.232640 200.00 80000
+47.392640 200.00 80000
+47.552640 200.00 80000
+47.712640 200.00 80000
+47.872640 200.00 80000
+48.032640 200.00 80000
+48.192640 200.00 80000
+48.352640 200.00 80000
+48.512640 200.00 80000
+48.672640 200.00 80000
+48.832640 200.00 80000
+48.992640 200.00 80000
+49.152640 200.00 80000
+49.312640 200.00 80000
+49.472640 200.00 80000
+49.632640 200.00 80000
+49.792640 200.00 80000
+49.952640 200.00 80000
+50.112640 200.00 80000
+50.272640 200.00 80000
+50.432640 200.00 80000
+50.592640 200.00 80000
+50.752640 200.00 80000
+50.912640 200.00 80000
+51.072640 200.00 80000
+51.232640 200.00 80000
+51.392640 200.00 80000
+51.552640 200.00 80000
+51.712640 200.00 80000
+51.872640 200.00 80000
+52.032640 200.00 80000
+52.192640 200.00 80000
+52.352640 200.00 80000
+52.512640 200.00 80000
+52.672640 200.00 80000
+52.832640 200.00 80000
+52.992640 200.00 80000
+53.152640 200.00 80000
+53.312640 200.00 80000
+53.472640 200.00 80000
+53.632640 200.00 80000
+53.792640 200.00 80000
+53.952640 200.00 80000
+54.112640 200.00 80000
+54.272640 200.00 80000
+54.432640 200.00 80000
+54.592640 200.00 80000
+54.752640 200.00 80000
+54.912640 200.00 80000
+55.072640 200.00 80000
+55.232640 200.00 80000
+55.392640 200.00 80000
+55.552640 200.00 80000
+55.712640 200.00 80000
+55.872640 200.00 80000
+56.032640 200.00 80000
+56.192640 200.00 80000
+56.352640 200.00 80000
+56.512640 200.00 80000
+56.672640 200.00 80000
+56.832640 200.00 80000
+56.992640 200.00 80000
+57.152640 200.00 80000
+57.312640 200.00 80000
+57.472640 200.00 80000
+57.632640 200.00 80000
+57.792640 200.00 80000
+57.952640 200.00 80000
+58.112640 200.00 80000
+58.272640 200.00 80000
+58.432640 200.00 80000
+58.592640 200.00 80000
+58.752640 200.00 80000
+58.912640 200.00 80000
+59.072640 200.00 80000
+59.232640 200.00 80000
+59.392640 200.00 80000
+59.552640 200.00 80000
+59.712640 200.00 80000
+59.872640 200.00 80000
+60.032640 200.00 80000
+60.192640 200.00 80000
+60.352640 200.00 80000
+60.512640 200.00 80000
+60.672640 200.00 80000
+60.832640 200.00 80000
+60.992640 200.00 80000
+61.152640 200.00 80000
+61.312640 200.00 80000
+61.472640 200.00 80000
+61.632640 200.00 80000
+61.792640 200.00 80000
+61.952640 200.00 80000
+62.112640 200.00 80000
+62.272640 200.00 80000
+62.432640 200.00 80000
+62.592640 200.00 80000
+62.752640 200.00 80000
+62.912640 200.00 80000
+63.072640 200.00 80000
+63.232640 200.00 80000
+63.392640 200.00 80000
+63.552640 200.00 80000
+63.712640 200.00 80000
+63.872640 200.00 80000
+64.032640 200.00 80000
+64.192640 200.00 80000
+64.352640 200.00 80000
+64.512640 200.00 80000
+64.672640 200.00 80000
+64.832640 200.00 80000
+64.992640 200.00 80000
+65.152640 200.00 80000
+65.312640 200.00 80000
+65.472640 200.00 80000
+65.632640 200.00 80000
+65.792640 200.00 80000
+65.952640 200.00 80000
+66.112640 200.00 80000
+66.272640 200.00 80000
+66.432640 200.00 80000
+66.592640 200.00 80000
+66.752640 200.00 80000
+66.912640 200.00 80000
+67.072640 200.00 80000
+67.232640 200.00 80000
+67.392640 200.00 80000
+67.552640 200.00 80000
+67.712640 200.00 80000
+67.872640 200.00 80000
+68.032640 200.00 80000
+68.192640 200.00 80000
+68.352640 200.00 80000
+68.512640 200.00 80000
+68.672640 200.00 80000
+68.832640 200.00 80000
+68.992640 200.00 80000
+69.152640 200.00 80000
+69.312640 200.00 80000
+69.472640 200.00 80000
+69.632640 200.00 80000
+69.792640 200.00 80000
+69.952640 200.00 80000
+70.112640 200.00 80000
+70.272640 200.00 80000
+70.432640 200.00 80000
+70.592640 200.00 80000
+70.752640 200.00 80000
+70.912640 200.00 80000
+71.072640 200.00 80000
+71.232640 200.00 80000
+71.392640 200.00 80000
+71.552640 200.00 80000
+71.712640 200.00 80000
+71.872640 200.00 80000
+72.032640 200.00 80000
+72.192640 200.00 80000
+72.352640 200.00 80000
+72.512640 200.00 80000
+72.672640 200.00 80000
+72.832640 200.00 80000
+72.992640 200.00 80000
+73.152640 200.00 80000
+73.312640 200.00 80000
+73.472640 200.00 80000
+73.632640 200.00 80000
+73.792640 200.00 80000
+73.952640 200.00 80000
+74.112640 200.00 80000
+74.272640 200.00 80000
+74.432640 200.00 80000
+74.592640 200.00 80000
+74.752640 200.00 80000
+74.912640 200.00 80000
+75.072640 200.00 80000
+75.232640 200.00 80000
+75.392640 200.00 80000
+75.552640 200.00 80000
+75.712640 200.00 80000
+75.872640 200.00 80000
+76.032640 200.00 80000
+76.192640 200.00 80000
+76.352640 200.00 80000
+76.512640 200.00 80000
+76.672640 200.00 80000
+76.832640 200.00 80000
+76.992640 200.00 80000
+77.152640 200.00 80000
+77.312640 200.00 80000
+77.472640 200.00 80000
+77.632640 200.00 80000
+77.792640 200.00 80000
+77.952640 200.00 80000
+78.112640 200.00 80000
+78.272640 200.00 80000
+78.432640 200.00 80000
+78.592640 200.00 80000
+78.752640 200.00 80000
+78.912640 200.00 80000
+79.072640 200.00 80000
+79.232640 200.00 80000
+79.392640 200.00 80000
+79.552640 200.00 80000
+79.712640 200.00 80000
+79.872640 200.00 80000
+80.032640 200.00 80000
+80.192640 200.00 80000
+80.352640 200.00 80000
+80.512640 200.00 80000
+80.672640 200.00 80000
+80.832640 200.00 80000
+80.992640 200.00 80000
+81.152640 200.00 80000
+81.312640 200.00 80000
+81.472640 200.00 80000
+81.632640 200.00 80000
+81.792640 200.00 80000
+81.952640 200.00 80000
+82.112640 200.00 80000
+82.272640 200.00 80000
+82.432640 200.00 80000
+82.592640 200.00 80000
+82.752640 200.00 80000
+82.912640 200.00 80000
+83.072640 200.00 80000
+83.232640 200.00 80000
+83.392640 200.00 80000
+83.552640 200.00 80000
+83.712640 200.00 80000
+83.872640 200.00 80000
+84.032640 200.00 80000
+84.192640 200.00 80000
+84.352640 200.00 80000
+84.512640 200.00 80000
+84.672640 200.00 80000
+84.832640 200.00 80000
+84.992640 200.00 80000
+85.152640 200.00 80000
+85.312640 200.00 80000
+85.472640 200.00 80000
+85.632640 200.00 80000
+85.792640 200.00 80000
+85.952640 200.00 80000
+86.112640 200.00 80000
+86.272640 200.00 80000
+86.432640 200.00 80000
+86.592640 200.00 80000
+86.752640 200.00 80000
+86.912640 200.00 80000
+87.072640 200.00 80000
+87.232640 200.00 80000
+87.392640 200.00 80000
+87.552640 200.00 80000
+87.712640 200.00 80000
+87.872640 200.00 80000
+88.032640 200.00 80000
+88.192640 200.00 80000
+88.352640 200.00 80000
+88.512640 200.00 80000
+88.672640 200.00 80000
+88.832640 200.00 80000
+88.992640 200.00 80000
+89.152640 200.00 80000
+89.312640 200.00 80000
+89.472640 200.00 80000
+89.632640 200.00 80000
+89.792640 200.00 80000
+89.952640 200.00 80000
+90.112640 200.00 80000
+90.272640 200.00 80000
+90.432640 200.00 80000
+90.592640 200.00 80000
+90.752640 200.00 80000
+90.912640 200.00 80000
+91.072640 200.00 80000
+91.232640 200.00 80000
+91.392640 200.00 80000
+91.552640 200.00 80000
+91.712640 200.00 80000
+91.872640 200.00 80000
+92.032640 200.00 80000
+92.192640 200.00 80000
+92.352640 200.00 80000
+92.512640 200.00 80000
+92.672640 200.00 80000
+92.832640 200.00 80000
+92.992640 200.00 80000
+93.152640 200.00 80000
+93.312640 200.00 80000
+93.472640 200.00 80000
+93.632640 200.00 80000
+93.792640 200.00 80000
+93.952640 200.00 80000
+94.112640 200.00 80000
+94.272640 200.00 80000
+94.432640 200.00 80000
+94.592640 200.00 80000
+94.752640 200.00 80000
+94.912640 200.00 80000
+95.072640 200.00 80000
+95.232640 200.00 80000
+95.392640 200.00 80000
+95.552640 200.00 80000
+95.712640 200.00 80000
+95.872640 200.00 80000
+96.032640 200.00 80000
+96.192640 200.00 80000
+96.352640 200.00 80000
+96.512640 200.00 80000
+96.672640 200.00 80000
+96.832640 200.00 80000
+96.992640 200.00 80000
+97.152640 200.00 80000
+97.312640 200.00 80000
+97.472640 200.00 80000
+97.632640 200.00 80000
+97.792640 200.00 80000
+97.952640 200.00 80000
+98.112640 200.00 80000
+98.272640 200.00 80000
+98.432640 200.00 80000
+98.592640 200.00 80000
+98.752640 200.00 80000
+98.912640 200.00 80000
+99.072640 200.00 80000
+99.232640 200.00 80000
+99.392640 200.00 80000
+99.552640 200.00 80000
+99.712640 200.00 80000
+99.872640 200.00 80000
+100.032640 200.00 80000
+100.192640 200.00 80000
+100.352640 200.00 80000
+100.512640 200.00 80000
+100.672640 200.00 80000
+100.832640 200.00 80000
+100.992640 200.00 80000
+101.152640 200.00 80000
+101.312640 200.00 80000
+101.472640 200.00 80000
+101.632640 200.00 80000
+101.792640 200.00 80000
+101.952640 200.00 80000
+102.112640 200.00 80000
+102.272640 200.00 80000
+102.432640 200.00 80000
+102.592640 200.00 80000
+102.752640 200.00 80000
+102.912640 200.00 80000
+103.072640 200.00 80000
+103.232640 200.00 80000
+103.392640 200.00 80000
+103.552640 200.00 80000
+103.712640 200.00 80000
+103.872640 200.00 80000
+104.032640 200.00 80000
+104.192640 200.00 80000
+104.352640 200.00 80000
+104.512640 200.00 80000
+104.672640 200.00 80000
+104.832640 200.00 80000
+104.992640 200.00 80000
+105.152640 200.00 80000
+105.312640 200.00 80000
+105.472640 200.00 80000
+105.632640 200.00 80000
+105.792640 200.00 80000
+105.952640 200.00 80000
+106.112640 200.00 80000
+106.272640 200.00 80000
+106.432640 200.00 80000
+106.592640 200.00 80000
+106.752640 200.00 80000
+106.912640 200.00 80000
+107.072640 200.00 80000
+107.232640 200.00 80000
+107.392640 200.00 80000
+107.552640 200.00 80000
+107.712640 200.00 80000
+107.872640 200.00 80000
+108.032640 200.00 80000
+108.192640 200.00 80000
+108.352640 200.00 80000
+108.512640 200.00 80000
+108.672640 200.00 80000
+108.832640 200.00 80000
+108.992640 200.00 80000
+109.152640 200.00 80000
+109.312640 200.00 80000
+109.472640 200.00 80000
+109.632640 200.00 80000
+109.792640 200.00 80000
+109.952640 200.00 80000
+110.112640 200.00 80000
+110.272640 200.00 80000
+110.432640 200.00 80000
+110.592640 200.00 80000
+110.752640 200.00 80000
+110.912640 200.00 80000
+111.072640 200.00 80000
+111.232640 200.00 80000
+111.392640 200.00 80000
+111.552640 200.00 80000
+111.712640 200.00 80000
+111.872640 200.00 80000
+112.032640 200.00 80000
+112.192640 200.00 80000
+112.352640 200.00 80000
+112.512640 200.00 80000
+112.672640 200.00 80000
+112.832640 200.00 80000
+112.992640 200.00 80000
+113.152640 200.00 80000
+113.312640 200.00 80000
+113.472640 200.00 80000
+113.632640 200.00 80000
+113.792640 200.00 80000
+113.952640 200.00 80000
+114.112640 200.00 80000
+114.272640 200.00 80000
+114.432640 200.00 80000
+114.592640 200.00 80000
+114.752640 200.00 80000
+114.912640 200.00 80000
+115.072640 200.00 80000
+115.232640 200.00 80000
+115.392640 200.00 80000
+115.552640 200.00 80000
+115.712640 200.00 80000
+115.872640 200.00 80000
+116.032640 200.00 80000
+116.192640 200.00 80000
+116.352640 200.00 80000
+116.512640 200.00 80000
+116.672640 200.00 80000
+116.832640 200.00 80000
+116.992640 200.00 80000
+117.152640 200.00 80000
+117.312640 200.00 80000
+117.472640 200.00 80000
+117.632640 200.00 80000
+117.792640 200.00 80000
+117.952640 200.00 80000
+118.112640 200.00 80000
+118.272640 200.00 80000
+118.432640 200.00 80000
+118.592640 200.00 80000
+118.752640 200.00 80000
+118.912640 200.00 80000
+119.072640 200.00 80000
+119.232640 200.00 80000
+119.392640 200.00 80000
+119.552640 200.00 80000
+119.712640 200.00 80000
+119.872640 200.00 80000
+120.032640 200.00 80000
+120.192640 200.00 80000
+120.352640 200.00 80000
+120.512640 200.00 80000
+120.672640 200.00 80000
+120.832640 200.00 80000
+120.992640 200.00 80000
+121.152640 200.00 80000
+121.312640 200.00 80000
+121.472640 200.00 80000
+121.632640 200.00 80000
+121.792640 200.00 80000
+121.952640 200.00 80000
+122.112640 200.00 80000
+122.272640 200.00 80000
+122.432640 200.00 80000
+122.592640 200.00 80000
+122.752640 200.00 80000
+122.912640 200.00 80000
+123.072640 200.00 80000
+123.232640 200.00 80000
+123.392640 200.00 80000
+123.552640 200.00 80000
+123.712640 200.00 80000
+123.872640 200.00 80000
+124.032640 200.00 80000
+124.192640 200.00 80000
+124.352640 200.00 80000
+124.512640 200.00 80000
+124.672640 200.00 80000
+124.832640 200.00 80000
+124.992640 200.00 80000
+125.152640 200.00 80000
+125.312640 200.00 80000
+125.472640 200.00 80000
+125.632640 200.00 80000
+125.792640 200.00 80000
+125.952640 200.00 80000
+126.112640 200.00 80000
+126.272640 200.00 80000
+126.432640 200.00 80000
+126.592640 200.00 80000
+126.752640 200.00 80000
+126.912640 200.00 80000
+127.072640 200.00 80000
+127.232640 200.00 80000
+127.392640 200.00 80000
+127.552640 200.00 80000
+127.712640 200.00 80000
+127.872640 200.00 80000
+127.985280 142.05 112640
+128.145024 100.16 159744
+EOF
+plot $data using 1:2 with linespoints
+pause -1
@@ -0,0 +1,824 @@
+$data <<EOF
+0.356352 44.90 356352
+0.609280 63.26 252928
+0.815104 77.74 205824
+0.993280 89.80 178176
+1.153024 100.16 159744
+1.298432 110.04 145408
+1.433600 118.37 135168
+1.560064 126.52 126464
+1.679360 134.12 119296
+1.792000 142.05 112640
+1.899520 148.81 107520
+2.002432 155.47 102912
+2.101248 161.92 98816
+2.196480 168.01 95232
+2.288640 173.61 92160
+2.377728 179.60 89088
+2.464256 184.91 86528
+2.548224 190.55 83968
+2.630144 195.31 81920
+2.710144 200.00 80000
+2.870144 200.00 80000
+3.030144 200.00 80000
+3.190144 200.00 80000
+3.350144 200.00 80000
+3.510144 200.00 80000
+3.670144 200.00 80000
+3.830144 200.00 80000
+3.990144 200.00 80000
+4.150144 200.00 80000
+4.310144 200.00 80000
+4.470144 200.00 80000
+4.630144 200.00 80000
+4.790144 200.00 80000
+4.950144 200.00 80000
+5.110144 200.00 80000
+5.270144 200.00 80000
+5.430144 200.00 80000
+5.590144 200.00 80000
+5.750144 200.00 80000
+5.910144 200.00 80000
+6.070144 200.00 80000
+6.230144 200.00 80000
+6.390144 200.00 80000
+6.550144 200.00 80000
+6.710144 200.00 80000
+6.870144 200.00 80000
+7.030144 200.00 80000
+7.190144 200.00 80000
+7.350144 200.00 80000
+7.510144 200.00 80000
+7.670144 200.00 80000
+7.830144 200.00 80000
+7.990144 200.00 80000
+8.150144 200.00 80000
+8.310144 200.00 80000
+8.470144 200.00 80000
+8.630144 200.00 80000
+8.790144 200.00 80000
+8.950144 200.00 80000
+9.110144 200.00 80000
+9.270144 200.00 80000
+9.430144 200.00 80000
+9.590144 200.00 80000
+9.750144 200.00 80000
+9.910144 200.00 80000
+10.070144 200.00 80000
+10.230144 200.00 80000
+10.390144 200.00 80000
+10.550144 200.00 80000
+10.710144 200.00 80000
+10.870144 200.00 80000
+11.030144 200.00 80000
+11.190144 200.00 80000
+11.350144 200.00 80000
+11.510144 200.00 80000
+11.670144 200.00 80000
+11.830144 200.00 80000
+11.990144 200.00 80000
+12.150144 200.00 80000
+12.310144 200.00 80000
+12.470144 200.00 80000
+12.630144 200.00 80000
+12.790144 200.00 80000
+12.950144 200.00 80000
+13.110144 200.00 80000
+13.270144 200.00 80000
+13.430144 200.00 80000
+13.590144 200.00 80000
+13.750144 200.00 80000
+13.910144 200.00 80000
+14.070144 200.00 80000
+14.230144 200.00 80000
+14.390144 200.00 80000
+14.550144 200.00 80000
+14.710144 200.00 80000
+14.870144 200.00 80000
+15.030144 200.00 80000
+15.190144 200.00 80000
+15.350144 200.00 80000
+15.510144 200.00 80000
+15.670144 200.00 80000
+15.830144 200.00 80000
+15.990144 200.00 80000
+16.150144 200.00 80000
+16.310144 200.00 80000
+16.470144 200.00 80000
+16.630144 200.00 80000
+16.790144 200.00 80000
+16.950144 200.00 80000
+17.110144 200.00 80000
+17.270144 200.00 80000
+17.430144 200.00 80000
+17.590144 200.00 80000
+17.750144 200.00 80000
+17.910144 200.00 80000
+18.070144 200.00 80000
+18.230144 200.00 80000
+18.390144 200.00 80000
+18.550144 200.00 80000
+18.710144 200.00 80000
+18.870144 200.00 80000
+19.030144 200.00 80000
+19.190144 200.00 80000
+19.350144 200.00 80000
+19.510144 200.00 80000
+19.670144 200.00 80000
+19.830144 200.00 80000
+19.990144 200.00 80000
+20.150144 200.00 80000
+20.310144 200.00 80000
+20.470144 200.00 80000
+20.630144 200.00 80000
+20.790144 200.00 80000
+20.950144 200.00 80000
+21.110144 200.00 80000
+21.270144 200.00 80000
+21.430144 200.00 80000
+21.590144 200.00 80000
+21.750144 200.00 80000
+21.910144 200.00 80000
+22.070144 200.00 80000
+22.230144 200.00 80000
+22.390144 200.00 80000
+22.550144 200.00 80000
+22.710144 200.00 80000
+22.870144 200.00 80000
+23.030144 200.00 80000
+23.190144 200.00 80000
+23.350144 200.00 80000
+23.510144 200.00 80000
+23.670144 200.00 80000
+23.830144 200.00 80000
+23.990144 200.00 80000
+24.150144 200.00 80000
+24.310144 200.00 80000
+24.470144 200.00 80000
+24.630144 200.00 80000
+24.790144 200.00 80000
+24.950144 200.00 80000
+25.110144 200.00 80000
+25.270144 200.00 80000
+25.430144 200.00 80000
+25.590144 200.00 80000
+25.750144 200.00 80000
+25.910144 200.00 80000
+26.070144 200.00 80000
+26.230144 200.00 80000
+26.390144 200.00 80000
+26.550144 200.00 80000
+26.710144 200.00 80000
+26.870144 200.00 80000
+27.030144 200.00 80000
+27.190144 200.00 80000
+27.350144 200.00 80000
+27.510144 200.00 80000
+27.670144 200.00 80000
+27.830144 200.00 80000
+27.990144 200.00 80000
+28.150144 200.00 80000
+28.310144 200.00 80000
+28.470144 200.00 80000
+28.630144 200.00 80000
+28.790144 200.00 80000
+28.950144 200.00 80000
+29.110144 200.00 80000
+29.270144 200.00 80000
+29.430144 200.00 80000
+29.590144 200.00 80000
+29.750144 200.00 80000
+29.910144 200.00 80000
+30.070144 200.00 80000
+30.230144 200.00 80000
+30.390144 200.00 80000
+30.550144 200.00 80000
+30.710144 200.00 80000
+30.870144 200.00 80000
+31.030144 200.00 80000
+31.190144 200.00 80000
+31.350144 200.00 80000
+31.510144 200.00 80000
+31.670144 200.00 80000
+31.830144 200.00 80000
+31.990144 200.00 80000
+32.150144 200.00 80000
+32.310144 200.00 80000
+32.470144 200.00 80000
+32.630144 200.00 80000
+32.790144 200.00 80000
+32.950144 200.00 80000
+33.110144 200.00 80000
+33.270144 200.00 80000
+33.430144 200.00 80000
+33.590144 200.00 80000
+33.750144 200.00 80000
+33.910144 200.00 80000
+34.070144 200.00 80000
+34.230144 200.00 80000
+34.390144 200.00 80000
+34.550144 200.00 80000
+34.710144 200.00 80000
+34.870144 200.00 80000
+35.030144 200.00 80000
+35.190144 200.00 80000
+35.350144 200.00 80000
+35.510144 200.00 80000
+35.670144 200.00 80000
+35.830144 200.00 80000
+35.990144 200.00 80000
+36.150144 200.00 80000
+36.310144 200.00 80000
+36.470144 200.00 80000
+36.630144 200.00 80000
+36.790144 200.00 80000
+36.950144 200.00 80000
+37.110144 200.00 80000
+37.270144 200.00 80000
+37.430144 200.00 80000
+37.590144 200.00 80000
+37.750144 200.00 80000
+37.910144 200.00 80000
+38.070144 200.00 80000
+38.230144 200.00 80000
+38.390144 200.00 80000
+38.550144 200.00 80000
+38.710144 200.00 80000
+38.870144 200.00 80000
+39.030144 200.00 80000
+39.190144 200.00 80000
+39.350144 200.00 80000
+39.510144 200.00 80000
+39.670144 200.00 80000
+39.830144 200.00 80000
+39.990144 200.00 80000
+40.150144 200.00 80000
+40.310144 200.00 80000
+40.470144 200.00 80000
+40.630144 200.00 80000
+40.790144 200.00 80000
+40.950144 200.00 80000
+41.110144 200.00 80000
+41.270144 200.00 80000
+41.430144 200.00 80000
+41.590144 200.00 80000
+41.750144 200.00 80000
+41.910144 200.00 80000
+42.070144 200.00 80000
+42.230144 200.00 80000
+42.390144 200.00 80000
+42.550144 200.00 80000
+42.710144 200.00 80000
+42.870144 200.00 80000
+43.030144 200.00 80000
+43.190144 200.00 80000
+43.350144 200.00 80000
+43.510144 200.00 80000
+43.670144 200.00 80000
+43.830144 200.00 80000
+43.990144 200.00 80000
+44.150144 200.00 80000
+44.310144 200.00 80000
+44.470144 200.00 80000
+44.630144 200.00 80000
+44.790144 200.00 80000
+44.950144 200.00 80000
+45.110144 200.00 80000
+45.270144 200.00 80000
+45.430144 200.00 80000
+45.590144 200.00 80000
+45.750144 200.00 80000
+45.910144 200.00 80000
+46.070144 200.00 80000
+46.230144 200.00 80000
+46.390144 200.00 80000
+46.550144 200.00 80000
+46.710144 200.00 80000
+46.870144 200.00 80000
+47.030144 200.00 80000
+47.190144 200.00 80000
+47.350144 200.00 80000
+47.510144 200.00 80000
+47.670144 200.00 80000
+47.830144 200.00 80000
+47.990144 200.00 80000
+48.150144 200.00 80000
+48.310144 200.00 80000
+48.470144 200.00 80000
+48.630144 200.00 80000
+48.790144 200.00 80000
+48.950144 200.00 80000
+49.110144 200.00 80000
+49.270144 200.00 80000
+49.430144 200.00 80000
+49.590144 200.00 80000
+49.750144 200.00 80000
+49.910144 200.00 80000
+50.070144 200.00 80000
+50.230144 200.00 80000
+50.390144 200.00 80000
+50.550144 200.00 80000
+50.710144 200.00 80000
+50.870144 200.00 80000
+51.030144 200.00 80000
+51.190144 200.00 80000
+51.350144 200.00 80000
+51.510144 200.00 80000
+51.670144 200.00 80000
+51.830144 200.00 80000
+51.990144 200.00 80000
+52.150144 200.00 80000
+52.310144 200.00 80000
+52.470144 200.00 80000
+52.630144 200.00 80000
+52.790144 200.00 80000
+52.950144 200.00 80000
+53.110144 200.00 80000
+53.270144 200.00 80000
+53.430144 200.00 80000
+53.590144 200.00 80000
+53.750144 200.00 80000
+53.910144 200.00 80000
+54.070144 200.00 80000
+54.230144 200.00 80000
+54.390144 200.00 80000
+54.550144 200.00 80000
+54.710144 200.00 80000
+54.870144 200.00 80000
+55.030144 200.00 80000
+55.190144 200.00 80000
+55.350144 200.00 80000
+55.510144 200.00 80000
+55.670144 200.00 80000
+55.830144 200.00 80000
+55.990144 200.00 80000
+56.150144 200.00 80000
+56.310144 200.00 80000
+56.470144 200.00 80000
+56.630144 200.00 80000
+56.790144 200.00 80000
+56.950144 200.00 80000
+57.110144 200.00 80000
+57.270144 200.00 80000
+57.430144 200.00 80000
+57.590144 200.00 80000
+57.750144 200.00 80000
+57.910144 200.00 80000
+58.070144 200.00 80000
+58.230144 200.00 80000
+58.390144 200.00 80000
+58.550144 200.00 80000
+58.710144 200.00 80000
+58.870144 200.00 80000
+59.030144 200.00 80000
+59.190144 200.00 80000
+59.350144 200.00 80000
+59.510144 200.00 80000
+59.670144 200.00 80000
+59.830144 200.00 80000
+59.990144 200.00 80000
+60.150144 200.00 80000
+60.310144 200.00 80000
+60.470144 200.00 80000
+60.630144 200.00 80000
+60.790144 200.00 80000
+60.950144 200.00 80000
+61.110144 200.00 80000
+61.270144 200.00 80000
+61.430144 200.00 80000
+61.590144 200.00 80000
+61.750144 200.00 80000
+61.910144 200.00 80000
+62.070144 200.00 80000
+62.230144 200.00 80000
+62.390144 200.00 80000
+62.550144 200.00 80000
+62.710144 200.00 80000
+62.870144 200.00 80000
+63.030144 200.00 80000
+63.190144 200.00 80000
+63.350144 200.00 80000
+63.510144 200.00 80000
+63.670144 200.00 80000
+63.830144 200.00 80000
+63.990144 200.00 80000
+64.150144 200.00 80000
+64.310144 200.00 80000
+64.470144 200.00 80000
+64.630144 200.00 80000
+64.790144 200.00 80000
+64.950144 200.00 80000
+65.110144 200.00 80000
+65.270144 200.00 80000
+65.430144 200.00 80000
+65.590144 200.00 80000
+65.750144 200.00 80000
+65.910144 200.00 80000
+66.070144 200.00 80000
+66.230144 200.00 80000
+66.390144 200.00 80000
+66.550144 200.00 80000
+66.710144 200.00 80000
+66.870144 200.00 80000
+67.030144 200.00 80000
+67.190144 200.00 80000
+67.350144 200.00 80000
+67.510144 200.00 80000
+67.670144 200.00 80000
+67.830144 200.00 80000
+67.990144 200.00 80000
+68.150144 200.00 80000
+68.310144 200.00 80000
+68.470144 200.00 80000
+68.630144 200.00 80000
+68.790144 200.00 80000
+68.950144 200.00 80000
+69.110144 200.00 80000
+69.270144 200.00 80000
+69.430144 200.00 80000
+69.590144 200.00 80000
+69.750144 200.00 80000
+69.910144 200.00 80000
+70.070144 200.00 80000
+70.230144 200.00 80000
+70.390144 200.00 80000
+70.550144 200.00 80000
+70.710144 200.00 80000
+70.870144 200.00 80000
+71.030144 200.00 80000
+71.190144 200.00 80000
+71.350144 200.00 80000
+71.510144 200.00 80000
+71.670144 200.00 80000
+71.830144 200.00 80000
+71.990144 200.00 80000
+72.150144 200.00 80000
+72.310144 200.00 80000
+72.470144 200.00 80000
+72.630144 200.00 80000
+72.790144 200.00 80000
+72.950144 200.00 80000
+73.110144 200.00 80000
+73.270144 200.00 80000
+73.430144 200.00 80000
+73.590144 200.00 80000
+73.750144 200.00 80000
+73.910144 200.00 80000
+74.070144 200.00 80000
+74.230144 200.00 80000
+74.390144 200.00 80000
+74.550144 200.00 80000
+74.710144 200.00 80000
+74.870144 200.00 80000
+75.030144 200.00 80000
+75.190144 200.00 80000
+75.350144 200.00 80000
+75.510144 200.00 80000
+75.670144 200.00 80000
+75.830144 200.00 80000
+75.990144 200.00 80000
+76.150144 200.00 80000
+76.310144 200.00 80000
+76.470144 200.00 80000
+76.630144 200.00 80000
+76.790144 200.00 80000
+76.950144 200.00 80000
+77.110144 200.00 80000
+77.270144 200.00 80000
+77.430144 200.00 80000
+77.590144 200.00 80000
+77.750144 200.00 80000
+77.910144 200.00 80000
+78.070144 200.00 80000
+78.230144 200.00 80000
+78.390144 200.00 80000
+78.550144 200.00 80000
+78.710144 200.00 80000
+78.870144 200.00 80000
+79.030144 200.00 80000
+79.190144 200.00 80000
+79.350144 200.00 80000
+79.510144 200.00 80000
+79.670144 200.00 80000
+79.830144 200.00 80000
+79.990144 200.00 80000
+80.150144 200.00 80000
+80.310144 200.00 80000
+80.470144 200.00 80000
+80.630144 200.00 80000
+80.790144 200.00 80000
+80.950144 200.00 80000
+81.110144 200.00 80000
+81.270144 200.00 80000
+81.430144 200.00 80000
+81.590144 200.00 80000
+81.750144 200.00 80000
+81.910144 200.00 80000
+82.070144 200.00 80000
+82.230144 200.00 80000
+82.390144 200.00 80000
+82.550144 200.00 80000
+82.710144 200.00 80000
+82.870144 200.00 80000
+83.030144 200.00 80000
+83.190144 200.00 80000
+83.350144 200.00 80000
+83.510144 200.00 80000
+83.670144 200.00 80000
+83.830144 200.00 80000
+83.990144 200.00 80000
+84.150144 200.00 80000
+84.310144 200.00 80000
+84.470144 200.00 80000
+84.630144 200.00 80000
+84.790144 200.00 80000
+84.950144 200.00 80000
+85.110144 200.00 80000
+85.270144 200.00 80000
+85.430144 200.00 80000
+85.590144 200.00 80000
+85.750144 200.00 80000
+85.910144 200.00 80000
+86.070144 200.00 80000
+86.230144 200.00 80000
+86.390144 200.00 80000
+86.550144 200.00 80000
+86.710144 200.00 80000
+86.870144 200.00 80000
+87.030144 200.00 80000
+87.190144 200.00 80000
+87.350144 200.00 80000
+87.510144 200.00 80000
+87.670144 200.00 80000
+87.830144 200.00 80000
+87.990144 200.00 80000
+88.150144 200.00 80000
+88.310144 200.00 80000
+88.470144 200.00 80000
+88.630144 200.00 80000
+88.790144 200.00 80000
+88.950144 200.00 80000
+89.110144 200.00 80000
+89.270144 200.00 80000
+89.430144 200.00 80000
+89.590144 200.00 80000
+89.750144 200.00 80000
+89.910144 200.00 80000
+90.070144 200.00 80000
+90.230144 200.00 80000
+90.390144 200.00 80000
+90.550144 200.00 80000
+90.710144 200.00 80000
+90.870144 200.00 80000
+91.030144 200.00 80000
+91.190144 200.00 80000
+91.350144 200.00 80000
+91.510144 200.00 80000
+91.670144 200.00 80000
+91.830144 200.00 80000
+91.990144 200.00 80000
+92.150144 200.00 80000
+92.310144 200.00 80000
+92.470144 200.00 80000
+92.630144 200.00 80000
+92.790144 200.00 80000
+92.950144 200.00 80000
+93.110144 200.00 80000
+93.270144 200.00 80000
+93.430144 200.00 80000
+93.590144 200.00 80000
+93.750144 200.00 80000
+93.910144 200.00 80000
+94.070144 200.00 80000
+94.230144 200.00 80000
+94.390144 200.00 80000
+94.550144 200.00 80000
+94.710144 200.00 80000
+94.870144 200.00 80000
+95.030144 200.00 80000
+95.190144 200.00 80000
+95.350144 200.00 80000
+95.510144 200.00 80000
+95.670144 200.00 80000
+95.830144 200.00 80000
+95.990144 200.00 80000
+96.150144 200.00 80000
+96.310144 200.00 80000
+96.470144 200.00 80000
+96.630144 200.00 80000
+96.790144 200.00 80000
+96.950144 200.00 80000
+97.110144 200.00 80000
+97.270144 200.00 80000
+97.430144 200.00 80000
+97.590144 200.00 80000
+97.750144 200.00 80000
+97.910144 200.00 80000
+98.070144 200.00 80000
+98.230144 200.00 80000
+98.390144 200.00 80000
+98.550144 200.00 80000
+98.710144 200.00 80000
+98.870144 200.00 80000
+99.030144 200.00 80000
+99.190144 200.00 80000
+99.350144 200.00 80000
+99.510144 200.00 80000
+99.670144 200.00 80000
+99.830144 200.00 80000
+99.990144 200.00 80000
+100.150144 200.00 80000
+100.310144 200.00 80000
+100.470144 200.00 80000
+100.630144 200.00 80000
+100.790144 200.00 80000
+100.950144 200.00 80000
+101.110144 200.00 80000
+101.270144 200.00 80000
+101.430144 200.00 80000
+101.590144 200.00 80000
+101.750144 200.00 80000
+101.910144 200.00 80000
+102.070144 200.00 80000
+102.230144 200.00 80000
+102.390144 200.00 80000
+102.550144 200.00 80000
+102.710144 200.00 80000
+102.870144 200.00 80000
+103.030144 200.00 80000
+103.190144 200.00 80000
+103.350144 200.00 80000
+103.510144 200.00 80000
+103.670144 200.00 80000
+103.830144 200.00 80000
+103.990144 200.00 80000
+104.150144 200.00 80000
+104.310144 200.00 80000
+104.470144 200.00 80000
+104.630144 200.00 80000
+104.790144 200.00 80000
+104.950144 200.00 80000
+105.110144 200.00 80000
+105.270144 200.00 80000
+105.430144 200.00 80000
+105.590144 200.00 80000
+105.750144 200.00 80000
+105.910144 200.00 80000
+106.070144 200.00 80000
+106.230144 200.00 80000
+106.390144 200.00 80000
+106.550144 200.00 80000
+106.710144 200.00 80000
+106.870144 200.00 80000
+107.030144 200.00 80000
+107.190144 200.00 80000
+107.350144 200.00 80000
+107.510144 200.00 80000
+107.670144 200.00 80000
+107.830144 200.00 80000
+107.990144 200.00 80000
+108.150144 200.00 80000
+108.310144 200.00 80000
+108.470144 200.00 80000
+108.630144 200.00 80000
+108.790144 200.00 80000
+108.950144 200.00 80000
+109.110144 200.00 80000
+109.270144 200.00 80000
+109.430144 200.00 80000
+109.590144 200.00 80000
+109.750144 200.00 80000
+109.910144 200.00 80000
+110.070144 200.00 80000
+110.230144 200.00 80000
+110.390144 200.00 80000
+110.550144 200.00 80000
+110.710144 200.00 80000
+110.870144 200.00 80000
+111.030144 200.00 80000
+111.190144 200.00 80000
+111.350144 200.00 80000
+111.510144 200.00 80000
+111.670144 200.00 80000
+111.830144 200.00 80000
+111.990144 200.00 80000
+112.150144 200.00 80000
+112.310144 200.00 80000
+112.470144 200.00 80000
+112.630144 200.00 80000
+112.790144 200.00 80000
+112.950144 200.00 80000
+113.110144 200.00 80000
+113.270144 200.00 80000
+113.430144 200.00 80000
+113.590144 200.00 80000
+113.750144 200.00 80000
+113.910144 200.00 80000
+114.070144 200.00 80000
+114.230144 200.00 80000
+114.390144 200.00 80000
+114.550144 200.00 80000
+114.710144 200.00 80000
+114.870144 200.00 80000
+115.030144 200.00 80000
+115.190144 200.00 80000
+115.350144 200.00 80000
+115.510144 200.00 80000
+115.670144 200.00 80000
+115.830144 200.00 80000
+115.990144 200.00 80000
+116.150144 200.00 80000
+116.310144 200.00 80000
+116.470144 200.00 80000
+116.630144 200.00 80000
+116.790144 200.00 80000
+116.950144 200.00 80000
+117.110144 200.00 80000
+117.270144 200.00 80000
+117.430144 200.00 80000
+117.590144 200.00 80000
+117.750144 200.00 80000
+117.910144 200.00 80000
+118.070144 200.00 80000
+118.230144 200.00 80000
+118.390144 200.00 80000
+118.550144 200.00 80000
+118.710144 200.00 80000
+118.870144 200.00 80000
+119.030144 200.00 80000
+119.190144 200.00 80000
+119.350144 200.00 80000
+119.510144 200.00 80000
+119.670144 200.00 80000
+119.830144 200.00 80000
+119.990144 200.00 80000
+120.150144 200.00 80000
+120.310144 200.00 80000
+120.470144 200.00 80000
+120.630144 200.00 80000
+120.790144 200.00 80000
+120.950144 200.00 80000
+121.110144 200.00 80000
+121.270144 200.00 80000
+121.430144 200.00 80000
+121.590144 200.00 80000
+121.750144 200.00 80000
+121.910144 200.00 80000
+122.070144 200.00 80000
+122.230144 200.00 80000
+122.390144 200.00 80000
+122.550144 200.00 80000
+122.710144 200.00 80000
+122.870144 200.00 80000
+123.030144 200.00 80000
+123.190144 200.00 80000
+123.350144 200.00 80000
+123.510144 200.00 80000
+123.670144 200.00 80000
+123.830144 200.00 80000
+123.990144 200.00 80000
+124.150144 200.00 80000
+124.310144 200.00 80000
+124.470144 200.00 80000
+124.630144 200.00 80000
+124.790144 200.00 80000
+124.950144 200.00 80000
+125.110144 200.00 80000
+125.270144 200.00 80000
+125.430144 200.00 80000
+125.590144 200.00 80000
+125.750144 200.00 80000
+125.910144 200.00 80000
+126.070144 200.00 80000
+126.230144 200.00 80000
+126.390144 200.00 80000
+126.550144 200.00 80000
+126.710144 200.00 80000
+126.870144 200.00 80000
+127.030144 200.00 80000
+127.190144 200.00 80000
+127.350144 200.00 80000
+127.510144 200.00 80000
+127.592064 195.31 81920
+127.676032 190.55 83968
+127.762560 184.91 86528
+127.851648 179.60 89088
+127.943808 173.61 92160
+128.039040 168.01 95232
+128.137856 161.92 98816
+128.240768 155.47 102912
+128.348288 148.81 107520
+128.460928 142.05 112640
+128.580224 134.12 119296
+128.706688 126.52 126464
+128.841856 118.37 135168
+128.987264 110.04 145408
+129.147008 100.16 159744
+129.325184 89.80 178176
+129.531008 77.74 205824
+129.783936 63.26 252928
+130.140288 44.90 356352
+130.646144 31.63 505856
+EOF
+plot $data using 1:2 with linespoints
+pause -1
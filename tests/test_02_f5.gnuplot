@@ -0,0 +1,2237 @@
+$data <<EOF
+0.112640 142.05 112640
+0.192512 200.32 79872
+0.257792 245.10 65280
+0.314112 284.09 56320
+0.364800 315.66 50688
+0.410880 347.22 46080
+0.453632 374.25 42752
+0.493568 400.64 39936
+0.531200 425.17 37632
+0.567040 446.43 35840
+0.601088 469.92 34048
+0.633728 490.20 32640
+0.665216 508.13 31488
+0.695424 529.66 30208
+0.724608 548.25 29184
+0.752768 568.18 28160
+0.780160 584.11 27392
+0.806784 600.96 26624
+0.832640 618.81 25856
+0.857984 631.31 25344
+0.882560 651.04 24576
+0.906624 664.89 24064
+0.930176 679.35 23552
+0.953216 694.44 23040
+0.975744 710.23 22528
+0.998016 718.39 22272
+1.019776 735.29 21760
+1.041152 748.50 21376
+1.062016 766.87 20864
+1.082624 776.40 20608
+1.102848 791.14 20224
+1.122816 801.28 19968
+1.142400 816.99 19584
+1.161856 822.37 19456
+1.180928 838.93 19072
+1.199744 850.34 18816
+1.218304 862.07 18560
+1.236608 874.13 18304
+1.254656 886.52 18048
+1.272576 892.86 17920
+1.290112 912.41 17536
+1.307520 919.12 17408
+1.324800 925.93 17280
+1.341824 939.85 17024
+1.358720 946.97 16896
+1.375360 961.54 16640
+1.391872 968.99 16512
+1.408192 980.39 16320
+1.424320 992.06 16128
+1.440320 1000.00 16000
+1.456128 1012.15 15808
+1.471872 1016.26 15744
+1.487424 1028.81 15552
+1.502784 1041.67 15360
+1.518016 1050.42 15232
+1.533120 1059.32 15104
+1.548096 1068.38 14976
+1.562880 1082.25 14784
+1.577600 1086.96 14720
+1.592192 1096.49 14592
+1.606656 1106.19 14464
+1.620992 1116.07 14336
+1.635264 1121.08 14272
+1.649344 1136.36 14080
+1.663360 1141.55 14016
+1.677248 1152.07 13888
+1.691072 1157.41 13824
+1.704768 1168.22 13696
+1.718336 1179.25 13568
+1.731840 1184.83 13504
+1.745280 1190.48 13440
+1.758592 1201.92 13312
+1.771776 1213.59 13184
+1.784896 1219.51 13120
+1.797952 1225.49 13056
+1.810880 1237.62 12928
+1.823744 1243.78 12864
+1.836544 1250.00 12800
+1.849280 1256.28 12736
+1.861952 1262.63 12672
+1.874560 1269.04 12608
+1.886976 1288.66 12416
+1.899328 1295.34 12352
+1.911616 1302.08 12288
+1.923840 1308.90 12224
+1.936000 1315.79 12160
+1.948096 1322.75 12096
+1.960128 1329.79 12032
+1.972096 1336.90 11968
+1.984000 1344.09 11904
+1.995840 1351.35 11840
+2.007616 1358.70 11776
+2.019328 1366.12 11712
+2.030976 1373.63 11648
+2.042560 1381.22 11584
+2.054080 1388.89 11520
+2.065536 1396.65 11456
+2.076928 1404.49 11392
+2.088256 1412.43 11328
+2.099520 1420.45 11264
+2.110720 1428.57 11200
+2.121856 1436.78 11136
+2.132992 1436.78 11136
+2.144128 1436.78 11136
+2.155200 1445.09 11072
+2.166208 1453.49 11008
+2.177152 1461.99 10944
+2.188032 1470.59 10880
+2.198848 1479.29 10816
+2.209600 1488.10 10752
+2.220352 1488.10 10752
+2.231040 1497.01 10688
+2.241664 1506.02 10624
+2.252224 1515.15 10560
+2.262720 1524.39 10496
+2.273152 1533.74 10432
+2.283584 1533.74 10432
+2.294016 1533.74 10432
+2.304384 1543.21 10368
+2.314688 1552.80 10304
+2.324992 1552.80 10304
+2.335232 1562.50 10240
+2.345408 1572.33 10176
+2.355520 1582.28 10112
+2.365632 1582.28 10112
+2.375680 1592.36 10048
+2.385728 1592.36 10048
+2.395712 1602.56 9984
+2.405696 1602.56 9984
+2.415616 1612.90 9920
+2.425472 1623.38 9856
+2.435264 1633.99 9792
+2.445056 1633.99 9792
+2.454784 1644.74 9728
+2.464512 1644.74 9728
+2.474240 1644.74 9728
+2.483904 1655.63 9664
+2.493504 1666.67 9600
+2.503104 1666.67 9600
+2.512640 1677.85 9536
+2.522112 1689.19 9472
+2.531584 1689.19 9472
+2.540992 1700.68 9408
+2.550400 1700.68 9408
+2.559808 1700.68 9408
+2.569152 1712.33 9344
+2.578496 1712.33 9344
+2.587776 1724.14 9280
+2.596992 1736.11 9216
+2.606208 1736.11 9216
+2.615424 1736.11 9216
+2.624576 1748.25 9152
+2.633728 1748.25 9152
+2.642816 1760.56 9088
+2.651904 1760.56 9088
+2.660928 1773.05 9024
+2.669888 1785.71 8960
+2.678848 1785.71 8960
+2.687808 1785.71 8960
+2.696768 1785.71 8960
+2.705664 1798.56 8896
+2.714560 1798.56 8896
+2.723392 1811.59 8832
+2.732160 1824.82 8768
+2.740928 1824.82 8768
+2.749696 1824.82 8768
+2.758464 1824.82 8768
+2.767168 1838.24 8704
+2.775872 1838.24 8704
+2.784512 1851.85 8640
+2.793152 1851.85 8640
+2.801792 1851.85 8640
+2.810432 1851.85 8640
+2.819008 1865.67 8576
+2.827520 1879.70 8512
+2.836032 1879.70 8512
+2.844480 1893.94 8448
+2.852928 1893.94 8448
+2.861376 1893.94 8448
+2.869824 1893.94 8448
+2.878208 1908.40 8384
+2.886592 1908.40 8384
+2.894912 1923.08 8320
+2.903232 1923.08 8320
+2.911488 1937.98 8256
+2.919744 1937.98 8256
+2.928000 1937.98 8256
+2.936256 1937.98 8256
+2.944448 1953.12 8192
+2.952640 1953.12 8192
+2.960800 1960.78 8160
+2.968960 1960.78 8160
+2.977088 1968.50 8128
+2.985216 1968.50 8128
+2.993280 1984.13 8064
+3.001344 1984.13 8064
+3.009408 1984.13 8064
+3.017440 1992.03 8032
+3.025472 1992.03 8032
+3.033472 2000.00 8000
+3.049344 2016.13 7936
+3.065152 2024.29 7904
+3.080896 2032.52 7872
+3.096640 2032.52 7872
+3.112256 2049.18 7808
+3.127808 2057.61 7776
+3.143296 2066.12 7744
+3.158656 2083.33 7680
+3.173952 2092.05 7648
+3.189184 2100.84 7616
+3.204416 2100.84 7616
+3.219520 2118.64 7552
+3.234560 2127.66 7520
+3.249536 2136.75 7488
+3.264448 2145.92 7456
+3.279232 2164.50 7392
+3.294016 2164.50 7392
+3.308736 2173.91 7360
+3.323392 2183.41 7328
+3.337984 2192.98 7296
+3.352576 2192.98 7296
+3.367040 2212.39 7232
+3.381440 2222.22 7200
+3.395776 2232.14 7168
+3.410112 2232.14 7168
+3.424384 2242.15 7136
+3.438528 2262.44 7072
+3.452608 2272.73 7040
+3.466688 2272.73 7040
+3.480704 2283.11 7008
+3.494656 2293.58 6976
+3.508544 2304.15 6944
+3.522432 2304.15 6944
+3.536256 2314.81 6912
+3.549952 2336.45 6848
+3.563648 2336.45 6848
+3.577280 2347.42 6816
+3.590848 2358.49 6784
+3.604416 2358.49 6784
+3.617920 2369.67 6752
+3.631360 2380.95 6720
+3.644800 2380.95 6720
+3.658176 2392.34 6688
+3.671488 2403.85 6656
+3.684800 2403.85 6656
+3.697984 2427.18 6592
+3.711168 2427.18 6592
+3.724288 2439.02 6560
+3.737344 2450.98 6528
+3.750400 2450.98 6528
+3.763392 2463.05 6496
+3.776320 2475.25 6464
+3.789248 2475.25 6464
+3.802112 2487.56 6432
+3.814976 2487.56 6432
+3.827776 2500.00 6400
+3.840512 2512.56 6368
+3.853248 2512.56 6368
+3.865920 2525.25 6336
+3.878592 2525.25 6336
+3.891200 2538.07 6304
+3.903808 2538.07 6304
+3.916352 2551.02 6272
+3.928768 2577.32 6208
+3.941184 2577.32 6208
+3.953536 2590.67 6176
+3.965888 2590.67 6176
+3.978176 2604.17 6144
+3.990464 2604.17 6144
+4.002688 2617.80 6112
+4.014912 2617.80 6112
+4.027072 2631.58 6080
+4.039232 2631.58 6080
+4.051328 2645.50 6048
+4.063360 2659.57 6016
+4.075392 2659.57 6016
+4.087360 2673.80 5984
+4.099328 2673.80 5984
+4.111232 2688.17 5952
+4.123136 2688.17 5952
+4.134976 2702.70 5920
+4.146816 2702.70 5920
+4.158592 2717.39 5888
+4.170368 2717.39 5888
+4.182080 2732.24 5856
+4.193792 2732.24 5856
+4.205440 2747.25 5824
+4.217088 2747.25 5824
+4.228672 2762.43 5792
+4.240256 2762.43 5792
+4.251776 2777.78 5760
+4.263296 2777.78 5760
+4.274752 2793.30 5728
+4.286208 2793.30 5728
+4.297600 2808.99 5696
+4.308992 2808.99 5696
+4.320384 2808.99 5696
+4.331712 2824.86 5664
+4.343040 2824.86 5664
+4.354304 2840.91 5632
+4.365568 2840.91 5632
+4.376768 2857.14 5600
+4.387968 2857.14 5600
+4.399104 2873.56 5568
+4.410240 2873.56 5568
+4.421376 2873.56 5568
+4.432512 2873.56 5568
+4.443648 2873.56 5568
+4.454720 2890.17 5536
+4.465792 2890.17 5536
+4.476800 2906.98 5504
+4.487808 2906.98 5504
+4.498752 2923.98 5472
+4.509696 2923.98 5472
+4.520576 2941.18 5440
+4.531456 2941.18 5440
+4.542336 2941.18 5440
+4.553152 2958.58 5408
+4.563968 2958.58 5408
+4.574720 2976.19 5376
+4.585472 2976.19 5376
+4.596224 2976.19 5376
+4.606912 2994.01 5344
+4.617600 2994.01 5344
+4.628224 3012.05 5312
+4.644160 3012.05 5312
+4.660000 3030.30 5280
+4.675840 3030.30 5280
+4.691584 3048.78 5248
+4.707232 3067.48 5216
+4.722880 3067.48 5216
+4.738528 3067.48 5216
+4.754176 3067.48 5216
+4.769728 3086.42 5184
+4.785184 3105.59 5152
+4.800640 3105.59 5152
+4.816000 3125.00 5120
+4.831360 3125.00 5120
+4.846624 3144.65 5088
+4.861888 3144.65 5088
+4.877056 3164.56 5056
+4.892224 3164.56 5056
+4.907296 3184.71 5024
+4.922368 3184.71 5024
+4.937440 3184.71 5024
+4.952416 3205.13 4992
+4.967392 3205.13 4992
+4.982368 3205.13 4992
+4.997248 3225.81 4960
+5.012032 3246.75 4928
+5.026720 3267.97 4896
+5.041408 3267.97 4896
+5.056096 3267.97 4896
+5.070688 3289.47 4864
+5.085280 3289.47 4864
+5.099872 3289.47 4864
+5.114464 3289.47 4864
+5.128960 3311.26 4832
+5.143360 3333.33 4800
+5.157760 3333.33 4800
+5.172160 3333.33 4800
+5.186464 3355.70 4768
+5.200672 3378.38 4736
+5.214880 3378.38 4736
+5.229088 3378.38 4736
+5.243200 3401.36 4704
+5.257312 3401.36 4704
+5.271424 3401.36 4704
+5.285536 3401.36 4704
+5.299552 3424.66 4672
+5.313568 3424.66 4672
+5.327584 3424.66 4672
+5.341504 3448.28 4640
+5.355328 3472.22 4608
+5.369152 3472.22 4608
+5.382976 3472.22 4608
+5.396800 3472.22 4608
+5.410528 3496.50 4576
+5.424256 3496.50 4576
+5.437984 3496.50 4576
+5.451616 3521.13 4544
+5.465248 3521.13 4544
+5.478784 3546.10 4512
+5.492320 3546.10 4512
+5.505760 3571.43 4480
+5.519200 3571.43 4480
+5.532640 3571.43 4480
+5.546080 3571.43 4480
+5.559520 3571.43 4480
+5.572864 3597.12 4448
+5.586208 3597.12 4448
+5.599552 3597.12 4448
+5.612800 3623.19 4416
+5.625952 3649.64 4384
+5.639104 3649.64 4384
+5.652256 3649.64 4384
+5.665408 3649.64 4384
+5.678560 3649.64 4384
+5.691616 3676.47 4352
+5.704672 3676.47 4352
+5.717728 3676.47 4352
+5.730688 3703.70 4320
+5.743648 3703.70 4320
+5.756608 3703.70 4320
+5.769568 3703.70 4320
+5.782528 3703.70 4320
+5.795392 3731.34 4288
+5.808256 3731.34 4288
+5.821024 3759.40 4256
+5.833792 3759.40 4256
+5.846464 3787.88 4224
+5.859136 3787.88 4224
+5.871808 3787.88 4224
+5.884480 3787.88 4224
+5.897152 3787.88 4224
+5.909824 3787.88 4224
+5.922400 3816.79 4192
+5.934976 3816.79 4192
+5.947456 3846.15 4160
+5.959936 3846.15 4160
+5.972416 3846.15 4160
+5.984800 3875.97 4128
+5.997184 3875.97 4128
+6.009568 3875.97 4128
+6.021952 3875.97 4128
+6.034336 3875.97 4128
+6.046624 3906.25 4096
+6.058912 3906.25 4096
+6.071200 3906.25 4096
+6.083440 3921.57 4080
+6.095680 3921.57 4080
+6.107920 3921.57 4080
+6.120112 3937.01 4064
+6.132304 3937.01 4064
+6.144400 3968.25 4032
+6.156496 3968.25 4032
+6.168592 3968.25 4032
+6.180688 3968.25 4032
+6.192736 3984.06 4016
+6.204784 3984.06 4016
+6.216832 3984.06 4016
+6.228832 4000.00 4000
+6.244832 4000.00 4000
+6.260704 4032.26 3968
+6.276576 4032.26 3968
+6.292384 4048.58 3952
+6.308192 4048.58 3952
+6.323936 4065.04 3936
+6.339680 4065.04 3936
+6.355424 4065.04 3936
+6.371040 4098.36 3904
+6.386656 4098.36 3904
+6.402208 4115.23 3888
+6.417760 4115.23 3888
+6.433248 4132.23 3872
+6.448736 4132.23 3872
+6.464096 4166.67 3840
+6.479456 4166.67 3840
+6.494816 4166.67 3840
+6.510112 4184.10 3824
+6.525408 4184.10 3824
+6.540640 4201.68 3808
+6.555872 4201.68 3808
+6.571104 4201.68 3808
+6.586208 4237.29 3776
+6.601312 4237.29 3776
+6.616352 4255.32 3760
+6.631392 4255.32 3760
+6.646368 4273.50 3744
+6.661344 4273.50 3744
+6.676320 4273.50 3744
+6.691232 4291.85 3728
+6.706144 4291.85 3728
+6.720928 4329.00 3696
+6.735712 4329.00 3696
+6.750496 4329.00 3696
+6.765216 4347.83 3680
+6.779936 4347.83 3680
+6.794656 4347.83 3680
+6.809312 4366.81 3664
+6.823968 4366.81 3664
+6.838560 4385.96 3648
+6.853152 4385.96 3648
+6.867744 4385.96 3648
+6.882208 4424.78 3616
+6.896672 4424.78 3616
+6.911072 4444.44 3600
+6.925472 4444.44 3600
+6.939872 4444.44 3600
+6.954208 4464.29 3584
+6.968544 4464.29 3584
+6.982880 4464.29 3584
+6.997152 4484.30 3568
+7.011424 4484.30 3568
+7.025568 4524.89 3536
+7.039712 4524.89 3536
+7.053856 4524.89 3536
+7.067936 4545.45 3520
+7.082016 4545.45 3520
+7.096096 4545.45 3520
+7.110176 4545.45 3520
+7.124192 4566.21 3504
+7.138208 4566.21 3504
+7.152160 4587.16 3488
+7.166112 4587.16 3488
+7.180000 4608.29 3472
+7.193888 4608.29 3472
+7.207776 4608.29 3472
+7.221664 4608.29 3472
+7.235488 4629.63 3456
+7.249312 4629.63 3456
+7.263008 4672.90 3424
+7.276704 4672.90 3424
+7.290400 4672.90 3424
+7.304096 4672.90 3424
+7.317728 4694.84 3408
+7.331360 4694.84 3408
+7.344928 4716.98 3392
+7.358496 4716.98 3392
+7.372064 4716.98 3392
+7.385632 4716.98 3392
+7.399136 4739.34 3376
+7.412640 4739.34 3376
+7.426080 4761.90 3360
+7.439520 4761.90 3360
+7.452960 4761.90 3360
+7.466400 4761.90 3360
+7.479776 4784.69 3344
+7.493152 4784.69 3344
+7.506464 4807.69 3328
+7.519776 4807.69 3328
+7.533088 4807.69 3328
+7.546400 4807.69 3328
+7.559584 4854.37 3296
+7.572768 4854.37 3296
+7.585952 4854.37 3296
+7.599136 4854.37 3296
+7.612256 4878.05 3280
+7.625376 4878.05 3280
+7.638432 4901.96 3264
+7.651488 4901.96 3264
+7.664544 4901.96 3264
+7.677600 4901.96 3264
+7.690592 4926.11 3248
+7.703584 4926.11 3248
+7.716512 4950.50 3232
+7.729440 4950.50 3232
+7.742368 4950.50 3232
+7.755296 4950.50 3232
+7.768160 4975.12 3216
+7.781024 4975.12 3216
+7.793888 4975.12 3216
+7.806752 4975.12 3216
+7.819552 5000.00 3200
+7.835552 5000.00 3200
+7.851472 5025.13 3184
+7.867392 5025.13 3184
+7.883312 5025.13 3184
+7.899152 5050.51 3168
+7.914992 5050.51 3168
+7.930832 5050.51 3168
+7.946592 5076.14 3152
+7.962352 5076.14 3152
+7.978112 5076.14 3152
+7.993792 5102.04 3136
+8.009472 5102.04 3136
+8.024992 5154.64 3104
+8.040512 5154.64 3104
+8.056032 5154.64 3104
+8.071472 5181.35 3088
+8.086912 5181.35 3088
+8.102352 5181.35 3088
+8.117712 5208.33 3072
+8.133072 5208.33 3072
+8.148432 5208.33 3072
+8.163792 5208.33 3072
+8.179072 5235.60 3056
+8.194352 5235.60 3056
+8.209632 5235.60 3056
+8.224832 5263.16 3040
+8.240032 5263.16 3040
+8.255232 5263.16 3040
+8.270352 5291.01 3024
+8.285472 5291.01 3024
+8.300512 5319.15 3008
+8.315552 5319.15 3008
+8.330592 5319.15 3008
+8.345552 5347.59 2992
+8.360512 5347.59 2992
+8.375472 5347.59 2992
+8.390352 5376.34 2976
+8.405232 5376.34 2976
+8.420112 5376.34 2976
+8.434912 5405.41 2960
+8.449712 5405.41 2960
+8.464512 5405.41 2960
+8.479232 5434.78 2944
+8.493952 5434.78 2944
+8.508672 5434.78 2944
+8.523392 5434.78 2944
+8.538032 5464.48 2928
+8.552672 5464.48 2928
+8.567312 5464.48 2928
+8.581872 5494.51 2912
+8.596432 5494.51 2912
+8.610992 5494.51 2912
+8.625472 5524.86 2896
+8.639952 5524.86 2896
+8.654432 5524.86 2896
+8.668832 5555.56 2880
+8.683232 5555.56 2880
+8.697632 5555.56 2880
+8.711952 5586.59 2864
+8.726272 5586.59 2864
+8.740592 5586.59 2864
+8.754912 5586.59 2864
+8.769152 5617.98 2848
+8.783392 5617.98 2848
+8.797632 5617.98 2848
+8.811872 5617.98 2848
+8.826032 5649.72 2832
+8.840192 5649.72 2832
+8.854352 5649.72 2832
+8.868512 5649.72 2832
+8.882592 5681.82 2816
+8.896672 5681.82 2816
+8.910752 5681.82 2816
+8.924752 5714.29 2800
+8.938752 5714.29 2800
+8.952752 5714.29 2800
+8.966672 5747.13 2784
+8.980592 5747.13 2784
+8.994512 5747.13 2784
+9.008432 5747.13 2784
+9.022352 5747.13 2784
+9.036272 5747.13 2784
+9.050192 5747.13 2784
+9.064112 5747.13 2784
+9.077952 5780.35 2768
+9.091792 5780.35 2768
+9.105632 5780.35 2768
+9.119392 5813.95 2752
+9.133152 5813.95 2752
+9.146912 5813.95 2752
+9.160592 5847.95 2736
+9.174272 5847.95 2736
+9.187952 5847.95 2736
+9.201632 5847.95 2736
+9.215232 5882.35 2720
+9.228832 5882.35 2720
+9.242432 5882.35 2720
+9.256032 5882.35 2720
+9.269552 5917.16 2704
+9.283072 5917.16 2704
+9.296592 5917.16 2704
+9.310112 5917.16 2704
+9.323552 5952.38 2688
+9.336992 5952.38 2688
+9.350432 5952.38 2688
+9.363872 5952.38 2688
+9.377232 5988.02 2672
+9.390592 5988.02 2672
+9.403952 5988.02 2672
+9.417312 5988.02 2672
+9.430592 6024.10 2656
+9.446528 6024.10 2656
+9.462368 6060.61 2640
+9.478208 6060.61 2640
+9.494048 6060.61 2640
+9.509888 6060.61 2640
+9.525632 6097.56 2624
+9.541376 6097.56 2624
+9.557120 6097.56 2624
+9.572768 6134.97 2608
+9.588416 6134.97 2608
+9.604064 6134.97 2608
+9.619712 6134.97 2608
+9.635360 6134.97 2608
+9.651008 6134.97 2608
+9.666656 6134.97 2608
+9.682304 6134.97 2608
+9.697856 6172.84 2592
+9.713408 6172.84 2592
+9.728960 6172.84 2592
+9.744416 6211.18 2576
+9.759872 6211.18 2576
+9.775328 6211.18 2576
+9.790784 6211.18 2576
+9.806144 6250.00 2560
+9.821504 6250.00 2560
+9.836768 6289.31 2544
+9.852032 6289.31 2544
+9.867296 6289.31 2544
+9.882560 6289.31 2544
+9.897728 6329.11 2528
+9.912896 6329.11 2528
+9.928064 6329.11 2528
+9.943232 6329.11 2528
+9.958304 6369.43 2512
+9.973376 6369.43 2512
+9.988448 6369.43 2512
+10.003520 6369.43 2512
+10.018592 6369.43 2512
+10.033664 6369.43 2512
+10.048736 6369.43 2512
+10.063712 6410.26 2496
+10.078688 6410.26 2496
+10.093664 6410.26 2496
+10.108640 6410.26 2496
+10.123616 6410.26 2496
+10.138496 6451.61 2480
+10.153376 6451.61 2480
+10.168256 6451.61 2480
+10.183040 6493.51 2464
+10.197824 6493.51 2464
+10.212608 6493.51 2464
+10.227296 6535.95 2448
+10.241984 6535.95 2448
+10.256672 6535.95 2448
+10.271360 6535.95 2448
+10.286048 6535.95 2448
+10.300640 6578.95 2432
+10.315232 6578.95 2432
+10.329824 6578.95 2432
+10.344416 6578.95 2432
+10.359008 6578.95 2432
+10.373600 6578.95 2432
+10.388192 6578.95 2432
+10.402784 6578.95 2432
+10.417280 6622.52 2416
+10.431776 6622.52 2416
+10.446272 6622.52 2416
+10.460672 6666.67 2400
+10.475072 6666.67 2400
+10.489472 6666.67 2400
+10.503872 6666.67 2400
+10.518272 6666.67 2400
+10.532576 6711.41 2384
+10.546880 6711.41 2384
+10.561184 6711.41 2384
+10.575392 6756.76 2368
+10.589600 6756.76 2368
+10.603808 6756.76 2368
+10.618016 6756.76 2368
+10.632224 6756.76 2368
+10.646336 6802.72 2352
+10.660448 6802.72 2352
+10.674560 6802.72 2352
+10.688672 6802.72 2352
+10.702784 6802.72 2352
+10.716896 6802.72 2352
+10.731008 6802.72 2352
+10.745120 6802.72 2352
+10.759136 6849.32 2336
+10.773152 6849.32 2336
+10.787168 6849.32 2336
+10.801184 6849.32 2336
+10.815200 6849.32 2336
+10.829120 6896.55 2320
+10.843040 6896.55 2320
+10.856960 6896.55 2320
+10.870784 6944.44 2304
+10.884608 6944.44 2304
+10.898432 6944.44 2304
+10.912256 6944.44 2304
+10.926080 6944.44 2304
+10.939904 6944.44 2304
+10.953728 6944.44 2304
+10.967552 6944.44 2304
+10.981280 6993.01 2288
+10.995008 6993.01 2288
+11.008736 6993.01 2288
+11.022464 6993.01 2288
+11.036192 6993.01 2288
+11.049824 7042.25 2272
+11.065728 7042.25 2272
+11.081632 7042.25 2272
+11.097536 7042.25 2272
+11.113440 7042.25 2272
+11.129232 7092.20 2256
+11.145024 7092.20 2256
+11.160704 7142.86 2240
+11.176384 7142.86 2240
+11.192064 7142.86 2240
+11.207744 7142.86 2240
+11.223424 7142.86 2240
+11.239104 7142.86 2240
+11.254784 7142.86 2240
+11.270464 7142.86 2240
+11.286144 7142.86 2240
+11.301712 7194.24 2224
+11.317280 7194.24 2224
+11.332848 7194.24 2224
+11.348416 7194.24 2224
+11.363984 7194.24 2224
+11.379440 7246.38 2208
+11.394896 7246.38 2208
+11.410240 7299.27 2192
+11.425584 7299.27 2192
+11.440928 7299.27 2192
+11.456272 7299.27 2192
+11.471616 7299.27 2192
+11.486960 7299.27 2192
+11.502304 7299.27 2192
+11.517648 7299.27 2192
+11.532992 7299.27 2192
+11.548224 7352.94 2176
+11.563456 7352.94 2176
+11.578688 7352.94 2176
+11.593920 7352.94 2176
+11.609152 7352.94 2176
+11.624272 7407.41 2160
+11.639392 7407.41 2160
+11.654512 7407.41 2160
+11.669632 7407.41 2160
+11.684752 7407.41 2160
+11.699872 7407.41 2160
+11.714992 7407.41 2160
+11.730112 7407.41 2160
+11.745232 7407.41 2160
+11.760240 7462.69 2144
+11.775248 7462.69 2144
+11.790144 7518.80 2128
+11.805040 7518.80 2128
+11.819936 7518.80 2128
+11.834832 7518.80 2128
+11.849728 7518.80 2128
+11.864512 7575.76 2112
+11.879296 7575.76 2112
+11.894080 7575.76 2112
+11.908864 7575.76 2112
+11.923648 7575.76 2112
+11.938432 7575.76 2112
+11.953216 7575.76 2112
+11.968000 7575.76 2112
+11.982784 7575.76 2112
+11.997456 7633.59 2096
+12.012128 7633.59 2096
+12.026800 7633.59 2096
+12.041472 7633.59 2096
+12.056144 7633.59 2096
+12.070704 7692.31 2080
+12.085264 7692.31 2080
+12.099824 7692.31 2080
+12.114384 7692.31 2080
+12.128832 7751.94 2064
+12.143280 7751.94 2064
+12.157728 7751.94 2064
+12.172176 7751.94 2064
+12.186624 7751.94 2064
+12.201072 7751.94 2064
+12.215520 7751.94 2064
+12.229968 7751.94 2064
+12.244416 7751.94 2064
+12.258752 7812.50 2048
+12.273088 7812.50 2048
+12.287424 7812.50 2048
+12.301760 7812.50 2048
+12.316096 7812.50 2048
+12.330376 7843.14 2040
+12.344656 7843.14 2040
+12.358936 7843.14 2040
+12.373216 7843.14 2040
+12.387496 7843.14 2040
+12.401720 7874.02 2032
+12.415944 7874.02 2032
+12.430168 7874.02 2032
+12.444392 7874.02 2032
+12.458504 7936.51 2016
+12.472616 7936.51 2016
+12.486728 7936.51 2016
+12.500840 7936.51 2016
+12.514952 7936.51 2016
+12.529064 7936.51 2016
+12.543176 7936.51 2016
+12.557232 7968.13 2008
+12.571288 7968.13 2008
+12.585344 7968.13 2008
+12.599400 7968.13 2008
+12.613456 7968.13 2008
+12.627456 8000.00 2000
+12.643456 8000.00 2000
+12.659456 8000.00 2000
+12.675456 8000.00 2000
+12.691328 8064.52 1984
+12.707200 8064.52 1984
+12.723072 8064.52 1984
+12.738944 8064.52 1984
+12.754752 8097.17 1976
+12.770560 8097.17 1976
+12.786368 8097.17 1976
+12.802176 8097.17 1976
+12.817920 8130.08 1968
+12.833664 8130.08 1968
+12.849408 8130.08 1968
+12.865152 8130.08 1968
+12.880896 8130.08 1968
+12.896640 8130.08 1968
+12.912256 8196.72 1952
+12.927872 8196.72 1952
+12.943488 8196.72 1952
+12.959104 8196.72 1952
+12.974656 8230.45 1944
+12.990208 8230.45 1944
+13.005760 8230.45 1944
+13.021312 8230.45 1944
+13.036800 8264.46 1936
+13.052288 8264.46 1936
+13.067776 8264.46 1936
+13.083264 8264.46 1936
+13.098624 8333.33 1920
+13.113984 8333.33 1920
+13.129344 8333.33 1920
+13.144704 8333.33 1920
+13.160064 8333.33 1920
+13.175424 8333.33 1920
+13.190720 8368.20 1912
+13.206016 8368.20 1912
+13.221312 8368.20 1912
+13.236608 8368.20 1912
+13.251840 8403.36 1904
+13.267072 8403.36 1904
+13.282304 8403.36 1904
+13.297536 8403.36 1904
+13.312768 8403.36 1904
+13.328000 8403.36 1904
+13.343104 8474.58 1888
+13.358208 8474.58 1888
+13.373312 8474.58 1888
+13.388416 8474.58 1888
+13.403456 8510.64 1880
+13.418496 8510.64 1880
+13.433536 8510.64 1880
+13.448576 8510.64 1880
+13.463552 8547.01 1872
+13.478528 8547.01 1872
+13.493504 8547.01 1872
+13.508480 8547.01 1872
+13.523456 8547.01 1872
+13.538432 8547.01 1872
+13.553344 8583.69 1864
+13.568256 8583.69 1864
+13.583168 8583.69 1864
+13.598080 8583.69 1864
+13.612864 8658.01 1848
+13.627648 8658.01 1848
+13.642432 8658.01 1848
+13.657216 8658.01 1848
+13.672000 8658.01 1848
+13.686784 8658.01 1848
+13.701504 8695.65 1840
+13.716224 8695.65 1840
+13.730944 8695.65 1840
+13.745664 8695.65 1840
+13.760384 8695.65 1840
+13.775104 8695.65 1840
+13.789760 8733.62 1832
+13.804416 8733.62 1832
+13.819072 8733.62 1832
+13.833728 8733.62 1832
+13.848320 8771.93 1824
+13.862912 8771.93 1824
+13.877504 8771.93 1824
+13.892096 8771.93 1824
+13.906688 8771.93 1824
+13.921280 8771.93 1824
+13.935744 8849.56 1808
+13.950208 8849.56 1808
+13.964672 8849.56 1808
+13.979136 8849.56 1808
+13.993536 8888.89 1800
+14.007936 8888.89 1800
+14.022336 8888.89 1800
+14.036736 8888.89 1800
+14.051136 8888.89 1800
+14.065536 8888.89 1800
+14.079872 8928.57 1792
+14.094208 8928.57 1792
+14.108544 8928.57 1792
+14.122880 8928.57 1792
+14.137216 8928.57 1792
+14.151552 8928.57 1792
+14.165824 8968.61 1784
+14.180096 8968.61 1784
+14.194368 8968.61 1784
+14.208640 8968.61 1784
+14.222784 9049.77 1768
+14.238696 9049.77 1768
+14.254608 9049.77 1768
+14.270520 9049.77 1768
+14.286432 9049.77 1768
+14.302272 9090.91 1760
+14.318112 9090.91 1760
+14.333952 9090.91 1760
+14.349792 9090.91 1760
+14.365632 9090.91 1760
+14.381472 9090.91 1760
+14.397312 9090.91 1760
+14.413080 9132.42 1752
+14.428848 9132.42 1752
+14.444616 9132.42 1752
+14.460384 9132.42 1752
+14.476080 9174.31 1744
+14.491776 9174.31 1744
+14.507472 9174.31 1744
+14.523096 9216.59 1736
+14.538720 9216.59 1736
+14.554344 9216.59 1736
+14.569968 9216.59 1736
+14.585592 9216.59 1736
+14.601216 9216.59 1736
+14.616840 9216.59 1736
+14.632392 9259.26 1728
+14.647944 9259.26 1728
+14.663496 9259.26 1728
+14.679048 9259.26 1728
+14.694456 9345.79 1712
+14.709864 9345.79 1712
+14.725272 9345.79 1712
+14.740680 9345.79 1712
+14.756088 9345.79 1712
+14.771496 9345.79 1712
+14.786904 9345.79 1712
+14.802240 9389.67 1704
+14.817576 9389.67 1704
+14.832912 9389.67 1704
+14.848248 9389.67 1704
+14.863512 9433.96 1696
+14.878776 9433.96 1696
+14.894040 9433.96 1696
+14.909304 9433.96 1696
+14.924568 9433.96 1696
+14.939832 9433.96 1696
+14.955096 9433.96 1696
+14.970288 9478.67 1688
+14.985480 9478.67 1688
+15.000672 9478.67 1688
+15.015792 9523.81 1680
+15.030912 9523.81 1680
+15.046032 9523.81 1680
+15.061152 9523.81 1680
+15.076272 9523.81 1680
+15.091392 9523.81 1680
+15.106512 9523.81 1680
+15.121560 9569.38 1672
+15.136608 9569.38 1672
+15.151656 9569.38 1672
+15.166704 9569.38 1672
+15.181680 9615.38 1664
+15.196656 9615.38 1664
+15.211632 9615.38 1664
+15.226608 9615.38 1664
+15.241584 9615.38 1664
+15.256560 9615.38 1664
+15.271536 9615.38 1664
+15.286368 9708.74 1648
+15.301200 9708.74 1648
+15.316032 9708.74 1648
+15.330864 9708.74 1648
+15.345696 9708.74 1648
+15.360528 9708.74 1648
+15.375360 9708.74 1648
+15.390120 9756.10 1640
+15.404880 9756.10 1640
+15.419640 9756.10 1640
+15.434400 9756.10 1640
+15.449088 9803.92 1632
+15.463776 9803.92 1632
+15.478464 9803.92 1632
+15.493152 9803.92 1632
+15.507840 9803.92 1632
+15.522528 9803.92 1632
+15.537216 9803.92 1632
+15.551832 9852.22 1624
+15.566448 9852.22 1624
+15.581064 9852.22 1624
+15.595608 9900.99 1616
+15.610152 9900.99 1616
+15.624696 9900.99 1616
+15.639240 9900.99 1616
+15.653784 9900.99 1616
+15.668328 9900.99 1616
+15.682872 9900.99 1616
+15.697416 9900.99 1616
+15.711888 9950.25 1608
+15.726360 9950.25 1608
+15.740832 9950.25 1608
+15.755304 9950.25 1608
+15.769776 9950.25 1608
+15.784248 9950.25 1608
+15.798720 9950.25 1608
+15.813120 10000.00 1600
+15.973120 10000.00 1600
+16.133120 10000.00 1600
+16.293120 10000.00 1600
+16.453120 10000.00 1600
+16.613120 10000.00 1600
+16.773120 10000.00 1600
+16.933120 10000.00 1600
+17.093120 10000.00 1600
+17.253120 10000.00 1600
+17.413120 10000.00 1600
+17.573120 10000.00 1600
+17.733120 10000.00 1600
+17.893120 10000.00 1600
+18.053120 10000.00 1600
+18.213120 10000.00 1600
+18.373120 10000.00 1600
+18.533120 10000.00 1600
+18.693120 10000.00 1600
+18.853120 10000.00 1600
+19.013120 10000.00 1600
+19.173120 10000.00 1600
+19.333120 10000.00 1600
+19.493120 10000.00 1600
+19.653120 10000.00 1600
+19.813120 10000.00 1600
+19.973120 10000.00 1600
+20.133120 10000.00 1600
+20.293120 10000.00 1600
+20.453120 10000.00 1600
+20.613120 10000.00 1600
+20.773120 10000.00 1600
+20.933120 10000.00 1600
+21.093120 10000.00 1600
+21.253120 10000.00 1600
+21.413120 10000.00 1600
+21.573120 10000.00 1600
+21.733120 10000.00 1600
+21.893120 10000.00 1600
+22.053120 10000.00 1600
+22.213120 10000.00 1600
+22.373120 10000.00 1600
+22.533120 10000.00 1600
+22.693120 10000.00 1600
+22.853120 10000.00 1600
+23.013120 10000.00 1600
+23.173120 10000.00 1600
+23.333120 10000.00 1600
+23.493120 10000.00 1600
+23.653120 10000.00 1600
+23.813120 10000.00 1600
+23.816320 10000.00 1600
+23.832400 9950.25 1608
+23.846872 9950.25 1608
+23.861344 9950.25 1608
+23.875816 9950.25 1608
+23.890288 9950.25 1608
+23.904760 9950.25 1608
+23.919232 9950.25 1608
+23.933776 9900.99 1616
+23.948320 9900.99 1616
+23.962864 9900.99 1616
+23.977408 9900.99 1616
+23.991952 9900.99 1616
+24.006496 9900.99 1616
+24.021040 9900.99 1616
+24.035656 9852.22 1624
+24.050272 9852.22 1624
+24.064888 9852.22 1624
+24.079504 9852.22 1624
+24.094192 9803.92 1632
+24.108880 9803.92 1632
+24.123568 9803.92 1632
+24.138256 9803.92 1632
+24.152944 9803.92 1632
+24.167632 9803.92 1632
+24.182320 9803.92 1632
+24.197080 9756.10 1640
+24.211840 9756.10 1640
+24.226600 9756.10 1640
+24.241360 9756.10 1640
+24.256192 9708.74 1648
+24.271024 9708.74 1648
+24.285856 9708.74 1648
+24.300688 9708.74 1648
+24.315520 9708.74 1648
+24.330352 9708.74 1648
+24.345184 9708.74 1648
+24.360160 9615.38 1664
+24.375136 9615.38 1664
+24.390112 9615.38 1664
+24.405088 9615.38 1664
+24.420064 9615.38 1664
+24.435040 9615.38 1664
+24.450016 9615.38 1664
+24.465064 9569.38 1672
+24.480112 9569.38 1672
+24.495160 9569.38 1672
+24.510280 9523.81 1680
+24.525400 9523.81 1680
+24.540520 9523.81 1680
+24.555640 9523.81 1680
+24.570760 9523.81 1680
+24.585880 9523.81 1680
+24.601000 9523.81 1680
+24.616120 9523.81 1680
+24.631312 9478.67 1688
+24.646504 9478.67 1688
+24.661696 9478.67 1688
+24.676960 9433.96 1696
+24.692224 9433.96 1696
+24.707488 9433.96 1696
+24.722752 9433.96 1696
+24.738016 9433.96 1696
+24.753280 9433.96 1696
+24.768544 9433.96 1696
+24.783880 9389.67 1704
+24.799216 9389.67 1704
+24.814552 9389.67 1704
+24.829888 9389.67 1704
+24.845296 9345.79 1712
+24.860704 9345.79 1712
+24.876112 9345.79 1712
+24.891520 9345.79 1712
+24.906928 9345.79 1712
+24.922336 9345.79 1712
+24.937744 9345.79 1712
+24.953296 9259.26 1728
+24.968848 9259.26 1728
+24.984400 9259.26 1728
+25.000024 9216.59 1736
+25.015648 9216.59 1736
+25.031272 9216.59 1736
+25.046896 9216.59 1736
+25.062520 9216.59 1736
+25.078144 9216.59 1736
+25.093768 9216.59 1736
+25.109392 9216.59 1736
+25.125088 9174.31 1744
+25.140784 9174.31 1744
+25.156480 9174.31 1744
+25.172248 9132.42 1752
+25.188016 9132.42 1752
+25.203784 9132.42 1752
+25.219552 9132.42 1752
+25.235392 9090.91 1760
+25.251232 9090.91 1760
+25.267072 9090.91 1760
+25.282912 9090.91 1760
+25.298752 9090.91 1760
+25.314592 9090.91 1760
+25.330432 9090.91 1760
+25.346344 9049.77 1768
+25.362256 9049.77 1768
+25.378168 9049.77 1768
+25.394080 9049.77 1768
+25.409992 9049.77 1768
+25.426048 8968.61 1784
+25.440320 8968.61 1784
+25.454592 8968.61 1784
+25.468864 8968.61 1784
+25.483200 8928.57 1792
+25.497536 8928.57 1792
+25.511872 8928.57 1792
+25.526208 8928.57 1792
+25.540544 8928.57 1792
+25.554880 8928.57 1792
+25.569280 8888.89 1800
+25.583680 8888.89 1800
+25.598080 8888.89 1800
+25.612480 8888.89 1800
+25.626880 8888.89 1800
+25.641280 8888.89 1800
+25.655744 8849.56 1808
+25.670208 8849.56 1808
+25.684672 8849.56 1808
+25.699136 8849.56 1808
+25.713728 8771.93 1824
+25.728320 8771.93 1824
+25.742912 8771.93 1824
+25.757504 8771.93 1824
+25.772096 8771.93 1824
+25.786688 8771.93 1824
+25.801344 8733.62 1832
+25.816000 8733.62 1832
+25.830656 8733.62 1832
+25.845312 8733.62 1832
+25.860032 8695.65 1840
+25.874752 8695.65 1840
+25.889472 8695.65 1840
+25.904192 8695.65 1840
+25.918912 8695.65 1840
+25.933632 8695.65 1840
+25.948416 8658.01 1848
+25.963200 8658.01 1848
+25.977984 8658.01 1848
+25.992768 8658.01 1848
+26.007552 8658.01 1848
+26.022336 8658.01 1848
+26.037248 8583.69 1864
+26.052160 8583.69 1864
+26.067072 8583.69 1864
+26.081984 8583.69 1864
+26.096960 8547.01 1872
+26.111936 8547.01 1872
+26.126912 8547.01 1872
+26.141888 8547.01 1872
+26.156864 8547.01 1872
+26.171840 8547.01 1872
+26.186880 8510.64 1880
+26.201920 8510.64 1880
+26.216960 8510.64 1880
+26.232000 8510.64 1880
+26.247104 8474.58 1888
+26.262208 8474.58 1888
+26.277312 8474.58 1888
+26.292416 8474.58 1888
+26.307648 8403.36 1904
+26.322880 8403.36 1904
+26.338112 8403.36 1904
+26.353344 8403.36 1904
+26.368576 8403.36 1904
+26.383808 8403.36 1904
+26.399104 8368.20 1912
+26.414400 8368.20 1912
+26.429696 8368.20 1912
+26.444992 8368.20 1912
+26.460352 8333.33 1920
+26.475712 8333.33 1920
+26.491072 8333.33 1920
+26.506432 8333.33 1920
+26.521792 8333.33 1920
+26.537152 8333.33 1920
+26.552640 8264.46 1936
+26.568128 8264.46 1936
+26.583616 8264.46 1936
+26.599104 8264.46 1936
+26.614656 8230.45 1944
+26.630208 8230.45 1944
+26.645760 8230.45 1944
+26.661312 8230.45 1944
+26.676928 8196.72 1952
+26.692544 8196.72 1952
+26.708160 8196.72 1952
+26.723776 8196.72 1952
+26.739520 8130.08 1968
+26.755264 8130.08 1968
+26.771008 8130.08 1968
+26.786752 8130.08 1968
+26.802496 8130.08 1968
+26.818240 8130.08 1968
+26.834048 8097.17 1976
+26.849856 8097.17 1976
+26.865664 8097.17 1976
+26.881472 8097.17 1976
+26.897344 8064.52 1984
+26.913216 8064.52 1984
+26.929088 8064.52 1984
+26.944960 8064.52 1984
+26.960960 8000.00 2000
+26.976960 8000.00 2000
+26.992960 8000.00 2000
+27.008960 8000.00 2000
+27.025024 7968.13 2008
+27.039080 7968.13 2008
+27.053136 7968.13 2008
+27.067192 7968.13 2008
+27.081248 7968.13 2008
+27.095360 7936.51 2016
+27.109472 7936.51 2016
+27.123584 7936.51 2016
+27.137696 7936.51 2016
+27.151808 7936.51 2016
+27.165920 7936.51 2016
+27.180144 7874.02 2032
+27.194368 7874.02 2032
+27.208592 7874.02 2032
+27.222816 7874.02 2032
+27.237040 7874.02 2032
+27.251320 7843.14 2040
+27.265600 7843.14 2040
+27.279880 7843.14 2040
+27.294160 7843.14 2040
+27.308440 7843.14 2040
+27.322776 7812.50 2048
+27.337112 7812.50 2048
+27.351448 7812.50 2048
+27.365784 7812.50 2048
+27.380232 7751.94 2064
+27.394680 7751.94 2064
+27.409128 7751.94 2064
+27.423576 7751.94 2064
+27.438024 7751.94 2064
+27.452472 7751.94 2064
+27.466920 7751.94 2064
+27.481368 7751.94 2064
+27.495816 7751.94 2064
+27.510376 7692.31 2080
+27.524936 7692.31 2080
+27.539496 7692.31 2080
+27.554056 7692.31 2080
+27.568616 7692.31 2080
+27.583288 7633.59 2096
+27.597960 7633.59 2096
+27.612632 7633.59 2096
+27.627304 7633.59 2096
+27.642088 7575.76 2112
+27.656872 7575.76 2112
+27.671656 7575.76 2112
+27.686440 7575.76 2112
+27.701224 7575.76 2112
+27.716008 7575.76 2112
+27.730792 7575.76 2112
+27.745576 7575.76 2112
+27.760360 7575.76 2112
+27.775144 7575.76 2112
+27.790040 7518.80 2128
+27.804936 7518.80 2128
+27.819832 7518.80 2128
+27.834728 7518.80 2128
+27.849736 7462.69 2144
+27.864744 7462.69 2144
+27.879864 7407.41 2160
+27.894984 7407.41 2160
+27.910104 7407.41 2160
+27.925224 7407.41 2160
+27.940344 7407.41 2160
+27.955464 7407.41 2160
+27.970584 7407.41 2160
+27.985704 7407.41 2160
+28.000824 7407.41 2160
+28.015944 7407.41 2160
+28.031176 7352.94 2176
+28.046408 7352.94 2176
+28.061640 7352.94 2176
+28.076872 7352.94 2176
+28.092216 7299.27 2192
+28.107560 7299.27 2192
+28.122904 7299.27 2192
+28.138248 7299.27 2192
+28.153592 7299.27 2192
+28.168936 7299.27 2192
+28.184280 7299.27 2192
+28.199624 7299.27 2192
+28.214968 7299.27 2192
+28.230424 7246.38 2208
+28.245880 7246.38 2208
+28.261336 7246.38 2208
+28.276904 7194.24 2224
+28.292472 7194.24 2224
+28.308040 7194.24 2224
+28.323608 7194.24 2224
+28.339288 7142.86 2240
+28.354968 7142.86 2240
+28.370648 7142.86 2240
+28.386328 7142.86 2240
+28.402008 7142.86 2240
+28.417688 7142.86 2240
+28.433368 7142.86 2240
+28.449048 7142.86 2240
+28.464728 7142.86 2240
+28.480520 7092.20 2256
+28.496312 7092.20 2256
+28.512104 7092.20 2256
+28.528008 7042.25 2272
+28.543912 7042.25 2272
+28.559816 7042.25 2272
+28.575720 7042.25 2272
+28.591736 6993.01 2288
+28.605464 6993.01 2288
+28.619192 6993.01 2288
+28.632920 6993.01 2288
+28.646648 6993.01 2288
+28.660472 6944.44 2304
+28.674296 6944.44 2304
+28.688120 6944.44 2304
+28.701944 6944.44 2304
+28.715768 6944.44 2304
+28.729592 6944.44 2304
+28.743416 6944.44 2304
+28.757240 6944.44 2304
+28.771160 6896.55 2320
+28.785080 6896.55 2320
+28.799000 6896.55 2320
+28.813016 6849.32 2336
+28.827032 6849.32 2336
+28.841048 6849.32 2336
+28.855064 6849.32 2336
+28.869080 6849.32 2336
+28.883192 6802.72 2352
+28.897304 6802.72 2352
+28.911416 6802.72 2352
+28.925528 6802.72 2352
+28.939640 6802.72 2352
+28.953752 6802.72 2352
+28.967864 6802.72 2352
+28.981976 6802.72 2352
+28.996184 6756.76 2368
+29.010392 6756.76 2368
+29.024600 6756.76 2368
+29.038808 6756.76 2368
+29.053016 6756.76 2368
+29.067224 6756.76 2368
+29.081528 6711.41 2384
+29.095832 6711.41 2384
+29.110232 6666.67 2400
+29.124632 6666.67 2400
+29.139032 6666.67 2400
+29.153432 6666.67 2400
+29.167832 6666.67 2400
+29.182232 6666.67 2400
+29.196728 6622.52 2416
+29.211224 6622.52 2416
+29.225816 6578.95 2432
+29.240408 6578.95 2432
+29.255000 6578.95 2432
+29.269592 6578.95 2432
+29.284184 6578.95 2432
+29.298776 6578.95 2432
+29.313368 6578.95 2432
+29.327960 6578.95 2432
+29.342648 6535.95 2448
+29.357336 6535.95 2448
+29.372024 6535.95 2448
+29.386712 6535.95 2448
+29.401400 6535.95 2448
+29.416088 6535.95 2448
+29.430872 6493.51 2464
+29.445656 6493.51 2464
+29.460536 6451.61 2480
+29.475416 6451.61 2480
+29.490296 6451.61 2480
+29.505272 6410.26 2496
+29.520248 6410.26 2496
+29.535224 6410.26 2496
+29.550200 6410.26 2496
+29.565176 6410.26 2496
+29.580248 6369.43 2512
+29.595320 6369.43 2512
+29.610392 6369.43 2512
+29.625464 6369.43 2512
+29.640536 6369.43 2512
+29.655608 6369.43 2512
+29.670680 6369.43 2512
+29.685848 6329.11 2528
+29.701016 6329.11 2528
+29.716184 6329.11 2528
+29.731352 6329.11 2528
+29.746616 6289.31 2544
+29.761880 6289.31 2544
+29.777144 6289.31 2544
+29.792408 6289.31 2544
+29.807768 6250.00 2560
+29.823128 6250.00 2560
+29.838488 6250.00 2560
+29.853944 6211.18 2576
+29.869400 6211.18 2576
+29.884856 6211.18 2576
+29.900312 6211.18 2576
+29.915864 6172.84 2592
+29.931416 6172.84 2592
+29.947064 6134.97 2608
+29.962712 6134.97 2608
+29.978360 6134.97 2608
+29.994008 6134.97 2608
+30.009656 6134.97 2608
+30.025304 6134.97 2608
+30.040952 6134.97 2608
+30.056600 6134.97 2608
+30.072344 6097.56 2624
+30.088088 6097.56 2624
+30.103832 6097.56 2624
+30.119672 6060.61 2640
+30.135512 6060.61 2640
+30.151352 6060.61 2640
+30.167192 6060.61 2640
+30.183128 6024.10 2656
+30.199064 6024.10 2656
+30.215000 6024.10 2656
+30.231032 5988.02 2672
+30.244392 5988.02 2672
+30.257752 5988.02 2672
+30.271192 5952.38 2688
+30.284632 5952.38 2688
+30.298072 5952.38 2688
+30.311512 5952.38 2688
+30.324952 5952.38 2688
+30.338472 5917.16 2704
+30.351992 5917.16 2704
+30.365512 5917.16 2704
+30.379112 5882.35 2720
+30.392712 5882.35 2720
+30.406312 5882.35 2720
+30.419912 5882.35 2720
+30.433512 5882.35 2720
+30.447192 5847.95 2736
+30.460872 5847.95 2736
+30.474552 5847.95 2736
+30.488312 5813.95 2752
+30.502072 5813.95 2752
+30.515832 5813.95 2752
+30.529672 5780.35 2768
+30.543512 5780.35 2768
+30.557352 5780.35 2768
+30.571272 5747.13 2784
+30.585192 5747.13 2784
+30.599112 5747.13 2784
+30.613032 5747.13 2784
+30.626952 5747.13 2784
+30.640872 5747.13 2784
+30.654792 5747.13 2784
+30.668712 5747.13 2784
+30.682712 5714.29 2800
+30.696712 5714.29 2800
+30.710712 5714.29 2800
+30.724792 5681.82 2816
+30.738872 5681.82 2816
+30.752952 5681.82 2816
+30.767032 5681.82 2816
+30.781192 5649.72 2832
+30.795352 5649.72 2832
+30.809512 5649.72 2832
+30.823752 5617.98 2848
+30.837992 5617.98 2848
+30.852232 5617.98 2848
+30.866472 5617.98 2848
+30.880712 5617.98 2848
+30.895032 5586.59 2864
+30.909352 5586.59 2864
+30.923672 5586.59 2864
+30.938072 5555.56 2880
+30.952472 5555.56 2880
+30.966872 5555.56 2880
+30.981352 5524.86 2896
+30.995832 5524.86 2896
+31.010312 5524.86 2896
+31.024872 5494.51 2912
+31.039432 5494.51 2912
+31.053992 5494.51 2912
+31.068632 5464.48 2928
+31.083272 5464.48 2928
+31.097912 5464.48 2928
+31.112552 5464.48 2928
+31.127272 5434.78 2944
+31.141992 5434.78 2944
+31.156712 5434.78 2944
+31.171512 5405.41 2960
+31.186312 5405.41 2960
+31.201112 5405.41 2960
+31.215992 5376.34 2976
+31.230872 5376.34 2976
+31.245752 5376.34 2976
+31.260712 5347.59 2992
+31.275672 5347.59 2992
+31.290632 5347.59 2992
+31.305672 5319.15 3008
+31.320712 5319.15 3008
+31.335752 5319.15 3008
+31.350792 5319.15 3008
+31.365912 5291.01 3024
+31.381112 5263.16 3040
+31.396312 5263.16 3040
+31.411512 5263.16 3040
+31.426792 5235.60 3056
+31.442072 5235.60 3056
+31.457352 5235.60 3056
+31.472632 5235.60 3056
+31.487992 5208.33 3072
+31.503352 5208.33 3072
+31.518712 5208.33 3072
+31.534152 5181.35 3088
+31.549592 5181.35 3088
+31.565032 5181.35 3088
+31.580552 5154.64 3104
+31.596072 5154.64 3104
+31.611592 5154.64 3104
+31.627272 5102.04 3136
+31.642952 5102.04 3136
+31.658712 5076.14 3152
+31.674472 5076.14 3152
+31.690232 5076.14 3152
+31.706072 5050.51 3168
+31.721912 5050.51 3168
+31.737752 5050.51 3168
+31.753672 5025.13 3184
+31.769592 5025.13 3184
+31.785512 5025.13 3184
+31.801512 5000.00 3200
+31.817512 5000.00 3200
+31.833592 4975.12 3216
+31.846456 4975.12 3216
+31.859320 4975.12 3216
+31.872184 4975.12 3216
+31.885112 4950.50 3232
+31.898040 4950.50 3232
+31.910968 4950.50 3232
+31.923896 4950.50 3232
+31.936888 4926.11 3248
+31.949880 4926.11 3248
+31.962936 4901.96 3264
+31.975992 4901.96 3264
+31.989048 4901.96 3264
+32.002104 4901.96 3264
+32.015224 4878.05 3280
+32.028344 4878.05 3280
+32.041528 4854.37 3296
+32.054712 4854.37 3296
+32.067896 4854.37 3296
+32.081080 4854.37 3296
+32.094392 4807.69 3328
+32.107704 4807.69 3328
+32.121016 4807.69 3328
+32.134328 4807.69 3328
+32.147704 4784.69 3344
+32.161080 4784.69 3344
+32.174520 4761.90 3360
+32.187960 4761.90 3360
+32.201400 4761.90 3360
+32.214840 4761.90 3360
+32.228344 4739.34 3376
+32.241848 4739.34 3376
+32.255416 4716.98 3392
+32.268984 4716.98 3392
+32.282552 4716.98 3392
+32.296120 4716.98 3392
+32.309752 4694.84 3408
+32.323384 4694.84 3408
+32.337080 4672.90 3424
+32.350776 4672.90 3424
+32.364472 4672.90 3424
+32.378168 4672.90 3424
+32.391992 4629.63 3456
+32.405816 4629.63 3456
+32.419704 4608.29 3472
+32.433592 4608.29 3472
+32.447480 4608.29 3472
+32.461368 4608.29 3472
+32.475320 4587.16 3488
+32.489272 4587.16 3488
+32.503288 4566.21 3504
+32.517304 4566.21 3504
+32.531384 4545.45 3520
+32.545464 4545.45 3520
+32.559544 4545.45 3520
+32.573624 4545.45 3520
+32.587768 4524.89 3536
+32.601912 4524.89 3536
+32.616056 4524.89 3536
+32.630328 4484.30 3568
+32.644600 4484.30 3568
+32.658936 4464.29 3584
+32.673272 4464.29 3584
+32.687608 4464.29 3584
+32.702008 4444.44 3600
+32.716408 4444.44 3600
+32.730808 4444.44 3600
+32.745272 4424.78 3616
+32.759736 4424.78 3616
+32.774328 4385.96 3648
+32.788920 4385.96 3648
+32.803512 4385.96 3648
+32.818168 4366.81 3664
+32.832824 4366.81 3664
+32.847544 4347.83 3680
+32.862264 4347.83 3680
+32.876984 4347.83 3680
+32.891768 4329.00 3696
+32.906552 4329.00 3696
+32.921336 4329.00 3696
+32.936248 4291.85 3728
+32.951160 4291.85 3728
+32.966136 4273.50 3744
+32.981112 4273.50 3744
+32.996088 4273.50 3744
+33.011128 4255.32 3760
+33.026168 4255.32 3760
+33.041272 4237.29 3776
+33.056376 4237.29 3776
+33.071608 4201.68 3808
+33.086840 4201.68 3808
+33.102072 4201.68 3808
+33.117368 4184.10 3824
+33.132664 4184.10 3824
+33.148024 4166.67 3840
+33.163384 4166.67 3840
+33.178744 4166.67 3840
+33.194232 4132.23 3872
+33.209720 4132.23 3872
+33.225272 4115.23 3888
+33.240824 4115.23 3888
+33.256440 4098.36 3904
+33.272056 4098.36 3904
+33.287800 4065.04 3936
+33.303544 4065.04 3936
+33.319288 4065.04 3936
+33.335096 4048.58 3952
+33.350904 4048.58 3952
+33.366776 4032.26 3968
+33.382648 4032.26 3968
+33.398648 4000.00 4000
+33.414648 4000.00 4000
+33.430712 3984.06 4016
+33.442760 3984.06 4016
+33.454856 3968.25 4032
+33.466952 3968.25 4032
+33.479048 3968.25 4032
+33.491144 3968.25 4032
+33.503336 3937.01 4064
+33.515528 3937.01 4064
+33.527720 3937.01 4064
+33.539960 3921.57 4080
+33.552200 3921.57 4080
+33.564440 3921.57 4080
+33.576728 3906.25 4096
+33.589016 3906.25 4096
+33.601400 3875.97 4128
+33.613784 3875.97 4128
+33.626168 3875.97 4128
+33.638552 3875.97 4128
+33.650936 3875.97 4128
+33.663320 3875.97 4128
+33.675800 3846.15 4160
+33.688280 3846.15 4160
+33.700856 3816.79 4192
+33.713432 3816.79 4192
+33.726008 3816.79 4192
+33.738680 3787.88 4224
+33.751352 3787.88 4224
+33.764024 3787.88 4224
+33.776696 3787.88 4224
+33.789368 3787.88 4224
+33.802136 3759.40 4256
+33.814904 3759.40 4256
+33.827672 3759.40 4256
+33.840536 3731.34 4288
+33.853496 3703.70 4320
+33.866456 3703.70 4320
+33.879416 3703.70 4320
+33.892376 3703.70 4320
+33.905336 3703.70 4320
+33.918296 3703.70 4320
+33.931352 3676.47 4352
+33.944408 3676.47 4352
+33.957560 3649.64 4384
+33.970712 3649.64 4384
+33.983864 3649.64 4384
+33.997016 3649.64 4384
+34.010168 3649.64 4384
+34.023320 3649.64 4384
+34.036568 3623.19 4416
+34.049912 3597.12 4448
+34.063256 3597.12 4448
+34.076600 3597.12 4448
+34.090040 3571.43 4480
+34.103480 3571.43 4480
+34.116920 3571.43 4480
+34.130360 3571.43 4480
+34.143800 3571.43 4480
+34.157336 3546.10 4512
+34.170968 3521.13 4544
+34.184600 3521.13 4544
+34.198232 3521.13 4544
+34.211960 3496.50 4576
+34.225688 3496.50 4576
+34.239416 3496.50 4576
+34.253240 3472.22 4608
+34.267064 3472.22 4608
+34.280888 3472.22 4608
+34.294712 3472.22 4608
+34.308632 3448.28 4640
+34.322648 3424.66 4672
+34.336664 3424.66 4672
+34.350680 3424.66 4672
+34.364792 3401.36 4704
+34.378904 3401.36 4704
+34.393016 3401.36 4704
+34.407128 3401.36 4704
+34.421336 3378.38 4736
+34.435544 3378.38 4736
+34.449848 3355.70 4768
+34.464152 3355.70 4768
+34.478552 3333.33 4800
+34.492952 3333.33 4800
+34.507448 3311.26 4832
+34.521944 3311.26 4832
+34.536536 3289.47 4864
+34.551128 3289.47 4864
+34.565720 3289.47 4864
+34.580312 3289.47 4864
+34.595000 3267.97 4896
+34.609688 3267.97 4896
+34.624472 3246.75 4928
+34.639256 3246.75 4928
+34.654136 3225.81 4960
+34.669112 3205.13 4992
+34.684088 3205.13 4992
+34.699064 3205.13 4992
+34.714136 3184.71 5024
+34.729208 3184.71 5024
+34.744280 3184.71 5024
+34.759448 3164.56 5056
+34.774616 3164.56 5056
+34.789880 3144.65 5088
+34.805144 3144.65 5088
+34.820504 3125.00 5120
+34.835960 3105.59 5152
+34.851416 3105.59 5152
+34.866968 3086.42 5184
+34.882520 3086.42 5184
+34.898168 3067.48 5216
+34.913816 3067.48 5216
+34.929464 3067.48 5216
+34.945112 3067.48 5216
+34.960856 3048.78 5248
+34.976696 3030.30 5280
+34.992536 3030.30 5280
+35.008472 3012.05 5312
+35.024504 2994.01 5344
+35.035192 2994.01 5344
+35.045944 2976.19 5376
+35.056696 2976.19 5376
+35.067448 2976.19 5376
+35.078264 2958.58 5408
+35.089080 2958.58 5408
+35.099960 2941.18 5440
+35.110840 2941.18 5440
+35.121720 2941.18 5440
+35.132664 2923.98 5472
+35.143608 2923.98 5472
+35.154616 2906.98 5504
+35.165624 2906.98 5504
+35.176696 2890.17 5536
+35.187768 2890.17 5536
+35.198904 2873.56 5568
+35.210040 2873.56 5568
+35.221176 2873.56 5568
+35.232312 2873.56 5568
+35.243448 2873.56 5568
+35.254648 2857.14 5600
+35.265848 2857.14 5600
+35.277112 2840.91 5632
+35.288376 2840.91 5632
+35.299704 2824.86 5664
+35.311032 2824.86 5664
+35.322424 2808.99 5696
+35.333816 2808.99 5696
+35.345208 2808.99 5696
+35.356664 2793.30 5728
+35.368120 2793.30 5728
+35.379640 2777.78 5760
+35.391160 2777.78 5760
+35.402744 2762.43 5792
+35.414328 2762.43 5792
+35.425976 2747.25 5824
+35.437624 2747.25 5824
+35.449336 2732.24 5856
+35.461048 2732.24 5856
+35.472824 2717.39 5888
+35.484600 2717.39 5888
+35.496440 2702.70 5920
+35.508280 2702.70 5920
+35.520184 2688.17 5952
+35.532088 2688.17 5952
+35.544056 2673.80 5984
+35.556024 2673.80 5984
+35.568056 2659.57 6016
+35.580088 2659.57 6016
+35.592184 2645.50 6048
+35.604344 2631.58 6080
+35.616504 2631.58 6080
+35.628728 2617.80 6112
+35.640952 2617.80 6112
+35.653240 2604.17 6144
+35.665528 2604.17 6144
+35.677880 2590.67 6176
+35.690232 2590.67 6176
+35.702648 2577.32 6208
+35.715064 2577.32 6208
+35.727608 2551.02 6272
+35.740216 2538.07 6304
+35.752824 2538.07 6304
+35.765496 2525.25 6336
+35.778168 2525.25 6336
+35.790904 2512.56 6368
+35.803640 2512.56 6368
+35.816440 2500.00 6400
+35.829304 2487.56 6432
+35.842168 2487.56 6432
+35.855096 2475.25 6464
+35.868024 2475.25 6464
+35.881016 2463.05 6496
+35.894072 2450.98 6528
+35.907128 2450.98 6528
+35.920248 2439.02 6560
+35.933432 2427.18 6592
+35.946616 2427.18 6592
+35.959928 2403.85 6656
+35.973240 2403.85 6656
+35.986616 2392.34 6688
+36.000056 2380.95 6720
+36.013496 2380.95 6720
+36.027000 2369.67 6752
+36.040568 2358.49 6784
+36.054136 2358.49 6784
+36.067768 2347.42 6816
+36.081464 2336.45 6848
+36.095160 2336.45 6848
+36.108984 2314.81 6912
+36.122872 2304.15 6944
+36.136760 2304.15 6944
+36.150712 2293.58 6976
+36.164728 2283.11 7008
+36.178808 2272.73 7040
+36.192888 2272.73 7040
+36.207032 2262.44 7072
+36.221176 2262.44 7072
+36.235448 2242.15 7136
+36.249784 2232.14 7168
+36.264184 2222.22 7200
+36.278584 2222.22 7200
+36.293048 2212.39 7232
+36.307640 2192.98 7296
+36.322296 2183.41 7328
+36.337016 2173.91 7360
+36.351736 2173.91 7360
+36.366520 2164.50 7392
+36.381432 2145.92 7456
+36.396408 2136.75 7488
+36.411384 2136.75 7488
+36.426424 2127.66 7520
+36.441528 2118.64 7552
+36.456760 2100.84 7616
+36.472056 2092.05 7648
+36.487416 2083.33 7680
+36.502776 2083.33 7680
+36.518264 2066.12 7744
+36.533816 2057.61 7776
+36.549432 2049.18 7808
+36.565176 2032.52 7872
+36.580984 2024.29 7904
+36.596856 2016.13 7936
+36.612856 2000.00 8000
+36.628920 1992.03 8032
+36.636952 1992.03 8032
+36.645016 1984.13 8064
+36.653080 1984.13 8064
+36.661144 1984.13 8064
+36.669272 1968.50 8128
+36.677400 1968.50 8128
+36.685560 1960.78 8160
+36.693720 1960.78 8160
+36.701912 1953.12 8192
+36.710104 1953.12 8192
+36.718360 1937.98 8256
+36.726616 1937.98 8256
+36.734872 1937.98 8256
+36.743128 1937.98 8256
+36.751448 1923.08 8320
+36.759768 1923.08 8320
+36.768152 1908.40 8384
+36.776536 1908.40 8384
+36.784984 1893.94 8448
+36.793432 1893.94 8448
+36.801880 1893.94 8448
+36.810328 1893.94 8448
+36.818840 1879.70 8512
+36.827352 1879.70 8512
+36.835928 1865.67 8576
+36.844568 1851.85 8640
+36.853208 1851.85 8640
+36.861848 1851.85 8640
+36.870488 1851.85 8640
+36.879192 1838.24 8704
+36.887896 1838.24 8704
+36.896664 1824.82 8768
+36.905432 1824.82 8768
+36.914200 1824.82 8768
+36.922968 1824.82 8768
+36.931800 1811.59 8832
+36.940696 1798.56 8896
+36.949592 1798.56 8896
+36.958552 1785.71 8960
+36.967512 1785.71 8960
+36.976472 1785.71 8960
+36.985432 1785.71 8960
+36.994456 1773.05 9024
+37.003544 1760.56 9088
+37.012632 1760.56 9088
+37.021784 1748.25 9152
+37.030936 1748.25 9152
+37.040152 1736.11 9216
+37.049368 1736.11 9216
+37.058584 1736.11 9216
+37.067864 1724.14 9280
+37.077208 1712.33 9344
+37.086552 1712.33 9344
+37.095960 1700.68 9408
+37.105368 1700.68 9408
+37.114776 1700.68 9408
+37.124248 1689.19 9472
+37.133720 1689.19 9472
+37.143256 1677.85 9536
+37.152856 1666.67 9600
+37.162456 1666.67 9600
+37.172120 1655.63 9664
+37.181848 1644.74 9728
+37.191576 1644.74 9728
+37.201304 1644.74 9728
+37.211096 1633.99 9792
+37.220888 1633.99 9792
+37.230744 1623.38 9856
+37.240664 1612.90 9920
+37.250648 1602.56 9984
+37.260632 1602.56 9984
+37.270680 1592.36 10048
+37.280728 1592.36 10048
+37.290840 1582.28 10112
+37.300952 1582.28 10112
+37.311128 1572.33 10176
+37.321368 1562.50 10240
+37.331672 1552.80 10304
+37.341976 1552.80 10304
+37.352344 1543.21 10368
+37.362776 1533.74 10432
+37.373208 1533.74 10432
+37.383640 1533.74 10432
+37.394136 1524.39 10496
+37.404696 1515.15 10560
+37.415320 1506.02 10624
+37.426008 1497.01 10688
+37.436760 1488.10 10752
+37.447512 1488.10 10752
+37.458328 1479.29 10816
+37.469208 1470.59 10880
+37.480152 1461.99 10944
+37.491160 1453.49 11008
+37.502232 1445.09 11072
+37.513368 1436.78 11136
+37.524504 1436.78 11136
+37.535640 1436.78 11136
+37.546840 1428.57 11200
+37.558104 1420.45 11264
+37.569432 1412.43 11328
+37.580824 1404.49 11392
+37.592280 1396.65 11456
+37.603800 1388.89 11520
+37.615384 1381.22 11584
+37.627032 1373.63 11648
+37.638744 1366.12 11712
+37.650520 1358.70 11776
+37.662360 1351.35 11840
+37.674264 1344.09 11904
+37.686232 1336.90 11968
+37.698264 1329.79 12032
+37.710360 1322.75 12096
+37.722520 1315.79 12160
+37.734744 1308.90 12224
+37.747032 1302.08 12288
+37.759384 1295.34 12352
+37.771800 1288.66 12416
+37.784408 1269.04 12608
+37.797080 1262.63 12672
+37.809816 1256.28 12736
+37.822616 1250.00 12800
+37.835480 1243.78 12864
+37.848408 1237.62 12928
+37.861464 1225.49 13056
+37.874584 1219.51 13120
+37.887768 1213.59 13184
+37.901080 1201.92 13312
+37.914520 1190.48 13440
+37.928024 1184.83 13504
+37.941592 1179.25 13568
+37.955288 1168.22 13696
+37.969112 1157.41 13824
+37.983000 1152.07 13888
+37.997016 1141.55 14016
+38.011096 1136.36 14080
+38.025368 1121.08 14272
+38.039704 1116.07 14336
+38.054168 1106.19 14464
+38.068760 1096.49 14592
+38.083480 1086.96 14720
+38.098264 1082.25 14784
+38.113240 1068.38 14976
+38.128344 1059.32 15104
+38.143576 1050.42 15232
+38.158936 1041.67 15360
+38.174488 1028.81 15552
+38.190232 1016.26 15744
+38.206040 1012.15 15808
+38.222040 1000.00 16000
+38.238168 992.06 16128
+38.254488 980.39 16320
+38.271000 968.99 16512
+38.287640 961.54 16640
+38.304536 946.97 16896
+38.321560 939.85 17024
+38.338840 925.93 17280
+38.356248 919.12 17408
+38.373784 912.41 17536
+38.391704 892.86 17920
+38.409752 886.52 18048
+38.428056 874.13 18304
+38.446616 862.07 18560
+38.465432 850.34 18816
+38.484504 838.93 19072
+38.503960 822.37 19456
+38.523544 816.99 19584
+38.543512 801.28 19968
+38.563736 791.14 20224
+38.584344 776.40 20608
+38.605208 766.87 20864
+38.626584 748.50 21376
+38.648344 735.29 21760
+38.670616 718.39 22272
+38.693144 710.23 22528
+38.716184 694.44 23040
+38.739736 679.35 23552
+38.763800 664.89 24064
+38.788376 651.04 24576
+38.813720 631.31 25344
+38.839576 618.81 25856
+38.866200 600.96 26624
+38.893592 584.11 27392
+38.921752 568.18 28160
+38.950936 548.25 29184
+38.981144 529.66 30208
+39.012632 508.13 31488
+39.045272 490.20 32640
+39.079320 469.92 34048
+39.115160 446.43 35840
+39.152792 425.17 37632
+39.192728 400.64 39936
+39.235480 374.25 42752
+39.281560 347.22 46080
+39.332248 315.66 50688
+39.388568 284.09 56320
+39.453848 245.10 65280
+39.533720 200.32 79872
+39.646360 142.05 112640
+39.806104 100.16 159744
+EOF
+plot $data using 1:2 with linespoints
+pause -1
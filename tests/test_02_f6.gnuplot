@@ -0,0 +1,56 @@
+$data <<EOF
+0.112640 142.05 112640
+0.192640 200.00 80000
+0.352640 200.00 80000
+0.512640 200.00 80000
+0.672640 200.00 80000
+0.832640 200.00 80000
+0.992640 200.00 80000
+1.152640 200.00 80000
+1.312640 200.00 80000
+1.472640 200.00 80000
+1.632640 200.00 80000
+1.792640 200.00 80000
+1.952640 200.00 80000
+2.112640 200.00 80000
+2.272640 200.00 80000
+2.432640 200.00 80000
+2.592640 200.00 80000
+2.752640 200.00 80000
+2.912640 200.00 80000
+3.072640 200.00 80000
+3.232640 200.00 80000
+3.392640 200.00 80000
+3.552640 200.00 80000
+3.712640 200.00 80000
+3.872640 200.00 80000
+4.032640 200.00 80000
+4.192640 200.00 80000
+4.352640 200.00 80000
+4.512640 200.00 80000
+4.672640 200.00 80000
+4.832640 200.00 80000
+4.992640 200.00 80000
+5.152640 200.00 80000
+5.312640 200.00 80000
+5.472640 200.00 80000
+5.632640 200.00 80000
+5.792640 200.00 80000
+5.952640 200.00 80000
+6.112640 200.00 80000
+6.272640 200.00 80000
+6.432640 200.00 80000
+6.592640 200.00 80000
+6.752640 200.00 80000
+6.912640 200.00 80000
+7.072640 200.00 80000
+7.232640 200.00 80000
+7.392640 200.00 80000
+7.552640 200.00 80000
+7.712640 200.00 80000
+7.872640 200.00 80000
+7.985280 142.05 112640
+8.145024 100.16 159744
+EOF
+plot $data using 1:2 with linespoints
+pause -1
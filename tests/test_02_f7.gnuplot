@@ -0,0 +1,453 @@
+$data <<EOF
+0.112640 142.05 112640
+0.192512 200.32 79872
+0.257792 245.10 65280
+0.314112 284.09 56320
+0.364800 315.66 50688
+0.410880 347.22 46080
+0.453632 374.25 42752
+0.493568 400.64 39936
+0.531200 425.17 37632
+0.567040 446.43 35840
+0.601088 469.92 34048
+0.633728 490.20 32640
+0.665216 508.13 31488
+0.695424 529.66 30208
+0.724608 548.25 29184
+0.752768 568.18 28160
+0.780160 584.11 27392
+0.806784 600.96 26624
+0.832640 618.81 25856
+0.857984 631.31 25344
+0.882560 651.04 24576
+0.906624 664.89 24064
+0.930176 679.35 23552
+0.953216 694.44 23040
+0.975744 710.23 22528
+0.998016 718.39 22272
+1.019776 735.29 21760
+1.041152 748.50 21376
+1.062016 766.87 20864
+1.082624 776.40 20608
+1.102848 791.14 20224
+1.122816 801.28 19968
+1.142400 816.99 19584
+1.161856 822.37 19456
+1.180928 838.93 19072
+1.199744 850.34 18816
+1.218304 862.07 18560
+1.236608 874.13 18304
+1.254656 886.52 18048
+1.272576 892.86 17920
+1.290112 912.41 17536
+1.307520 919.12 17408
+1.324800 925.93 17280
+1.341824 939.85 17024
+1.358720 946.97 16896
+1.375360 961.54 16640
+1.391872 968.99 16512
+1.408192 980.39 16320
+1.424320 992.06 16128
+1.440320 1000.00 16000
+1.456128 1012.15 15808
+1.471872 1016.26 15744
+1.487424 1028.81 15552
+1.502784 1041.67 15360
+1.518016 1050.42 15232
+1.533120 1059.32 15104
+1.548096 1068.38 14976
+1.562880 1082.25 14784
+1.577600 1086.96 14720
+1.592192 1096.49 14592
+1.606656 1106.19 14464
+1.620992 1116.07 14336
+1.635264 1121.08 14272
+1.649344 1136.36 14080
+1.663360 1141.55 14016
+1.677248 1152.07 13888
+1.691072 1157.41 13824
+1.704768 1168.22 13696
+1.718336 1179.25 13568
+1.731840 1184.83 13504
+1.745280 1190.48 13440
+1.758592 1201.92 13312
+1.771776 1213.59 13184
+1.784896 1219.51 13120
+1.797952 1225.49 13056
+1.810880 1237.62 12928
+1.823744 1243.78 12864
+1.836544 1250.00 12800
+1.849280 1256.28 12736
+1.861952 1262.63 12672
+1.874560 1269.04 12608
+1.886976 1288.66 12416
+1.899328 1295.34 12352
+1.911616 1302.08 12288
+1.923840 1308.90 12224
+1.936000 1315.79 12160
+1.948096 1322.75 12096
+1.960128 1329.79 12032
+1.972096 1336.90 11968
+1.984000 1344.09 11904
+1.995840 1351.35 11840
+2.007616 1358.70 11776
+2.019328 1366.12 11712
+2.030976 1373.63 11648
+2.042560 1381.22 11584
+2.054080 1388.89 11520
+2.065536 1396.65 11456
+2.076928 1404.49 11392
+2.088256 1412.43 11328
+2.099520 1420.45 11264
+2.110720 1428.57 11200
+2.121856 1436.78 11136
+2.132992 1436.78 11136
+2.144128 1436.78 11136
+2.155200 1445.09 11072
+2.166208 1453.49 11008
+2.177152 1461.99 10944
+2.188032 1470.59 10880
+2.198848 1479.29 10816
+2.209600 1488.10 10752
+2.220352 1488.10 10752
+2.231040 1497.01 10688
+2.241664 1506.02 10624
+2.252224 1515.15 10560
+2.262720 1524.39 10496
+2.273152 1533.74 10432
+2.283584 1533.74 10432
+2.294016 1533.74 10432
+2.304384 1543.21 10368
+2.314688 1552.80 10304
+2.324992 1552.80 10304
+2.335232 1562.50 10240
+2.345408 1572.33 10176
+2.355520 1582.28 10112
+2.365632 1582.28 10112
+2.375680 1592.36 10048
+2.385728 1592.36 10048
+2.395712 1602.56 9984
+2.405696 1602.56 9984
+2.415616 1612.90 9920
+2.425472 1623.38 9856
+2.435264 1633.99 9792
+2.445056 1633.99 9792
+2.454784 1644.74 9728
+2.464512 1644.74 9728
+2.474240 1644.74 9728
+2.483904 1655.63 9664
+2.493504 1666.67 9600
+2.503104 1666.67 9600
+2.512640 1677.85 9536
+2.522112 1689.19 9472
+2.531584 1689.19 9472
+2.540992 1700.68 9408
+2.550400 1700.68 9408
+2.559808 1700.68 9408
+2.569152 1712.33 9344
+2.578496 1712.33 9344
+2.587776 1724.14 9280
+2.596992 1736.11 9216
+2.606208 1736.11 9216
+2.615424 1736.11 9216
+2.624576 1748.25 9152
+2.633728 1748.25 9152
+2.642816 1760.56 9088
+2.651904 1760.56 9088
+2.660928 1773.05 9024
+2.669888 1785.71 8960
+2.678848 1785.71 8960
+2.687808 1785.71 8960
+2.696768 1785.71 8960
+2.705664 1798.56 8896
+2.714560 1798.56 8896
+2.723392 1811.59 8832
+2.732160 1824.82 8768
+2.740928 1824.82 8768
+2.749696 1824.82 8768
+2.758464 1824.82 8768
+2.767168 1838.24 8704
+2.775872 1838.24 8704
+2.784512 1851.85 8640
+2.793152 1851.85 8640
+2.801792 1851.85 8640
+2.810432 1851.85 8640
+2.819008 1865.67 8576
+2.827520 1879.70 8512
+2.836032 1879.70 8512
+2.844480 1893.94 8448
+2.852928 1893.94 8448
+2.861376 1893.94 8448
+2.869824 1893.94 8448
+2.878208 1908.40 8384
+2.886592 1908.40 8384
+2.894912 1923.08 8320
+2.903232 1923.08 8320
+2.911488 1937.98 8256
+2.919744 1937.98 8256
+2.928000 1937.98 8256
+2.936256 1937.98 8256
+2.944448 1953.12 8192
+2.952640 1953.12 8192
+2.960800 1960.78 8160
+2.968960 1960.78 8160
+2.977088 1968.50 8128
+2.985216 1968.50 8128
+2.993280 1984.13 8064
+3.001344 1984.13 8064
+3.009408 1984.13 8064
+3.017440 1992.03 8032
+3.025472 1992.03 8032
+3.033472 2000.00 8000
+3.049344 2016.13 7936
+3.065152 2024.29 7904
+3.080896 2032.52 7872
+3.096640 2032.52 7872
+3.112256 2049.18 7808
+3.127808 2057.61 7776
+3.143296 2066.12 7744
+3.158656 2083.33 7680
+3.173952 2092.05 7648
+3.189184 2100.84 7616
+3.204416 2100.84 7616
+3.219520 2118.64 7552
+3.234560 2127.66 7520
+3.249536 2136.75 7488
+3.264448 2145.92 7456
+3.279232 2164.50 7392
+3.294016 2164.50 7392
+3.308736 2173.91 7360
+3.323392 2183.41 7328
+3.337984 2192.98 7296
+3.352576 2192.98 7296
+3.367040 2212.39 7232
+3.381440 2222.22 7200
+3.395776 2232.14 7168
+3.410112 2232.14 7168
+3.424448 2232.14 7168
+3.438848 2222.22 7200
+3.453312 2212.39 7232
+3.467904 2192.98 7296
+3.482496 2192.98 7296
+3.497152 2183.41 7328
+3.511872 2173.91 7360
+3.526656 2164.50 7392
+3.541440 2164.50 7392
+3.556352 2145.92 7456
+3.571328 2136.75 7488
+3.586368 2127.66 7520
+3.601472 2118.64 7552
+3.616704 2100.84 7616
+3.631936 2100.84 7616
+3.647232 2092.05 7648
+3.662592 2083.33 7680
+3.678080 2066.12 7744
+3.693632 2057.61 7776
+3.709248 2049.18 7808
+3.724992 2032.52 7872
+3.740736 2032.52 7872
+3.756544 2024.29 7904
+3.772416 2016.13 7936
+3.788416 2000.00 8000
+3.804480 1992.03 8032
+3.812544 1984.13 8064
+3.820608 1984.13 8064
+3.828672 1984.13 8064
+3.836800 1968.50 8128
+3.844928 1968.50 8128
+3.853088 1960.78 8160
+3.861248 1960.78 8160
+3.869440 1953.12 8192
+3.877632 1953.12 8192
+3.885888 1937.98 8256
+3.894144 1937.98 8256
+3.902400 1937.98 8256
+3.910656 1937.98 8256
+3.918976 1923.08 8320
+3.927296 1923.08 8320
+3.935680 1908.40 8384
+3.944064 1908.40 8384
+3.952512 1893.94 8448
+3.960960 1893.94 8448
+3.969408 1893.94 8448
+3.977856 1893.94 8448
+3.986368 1879.70 8512
+3.994880 1879.70 8512
+4.003456 1865.67 8576
+4.012096 1851.85 8640
+4.020736 1851.85 8640
+4.029376 1851.85 8640
+4.038016 1851.85 8640
+4.046720 1838.24 8704
+4.055424 1838.24 8704
+4.064192 1824.82 8768
+4.072960 1824.82 8768
+4.081728 1824.82 8768
+4.090496 1824.82 8768
+4.099328 1811.59 8832
+4.108224 1798.56 8896
+4.117120 1798.56 8896
+4.126080 1785.71 8960
+4.135040 1785.71 8960
+4.144000 1785.71 8960
+4.152960 1785.71 8960
+4.161984 1773.05 9024
+4.171072 1760.56 9088
+4.180160 1760.56 9088
+4.189312 1748.25 9152
+4.198464 1748.25 9152
+4.207680 1736.11 9216
+4.216896 1736.11 9216
+4.226112 1736.11 9216
+4.235392 1724.14 9280
+4.244736 1712.33 9344
+4.254080 1712.33 9344
+4.263488 1700.68 9408
+4.272896 1700.68 9408
+4.282304 1700.68 9408
+4.291776 1689.19 9472
+4.301248 1689.19 9472
+4.310784 1677.85 9536
+4.320384 1666.67 9600
+4.329984 1666.67 9600
+4.339648 1655.63 9664
+4.349376 1644.74 9728
+4.359104 1644.74 9728
+4.368832 1644.74 9728
+4.378624 1633.99 9792
+4.388416 1633.99 9792
+4.398272 1623.38 9856
+4.408192 1612.90 9920
+4.418176 1602.56 9984
+4.428160 1602.56 9984
+4.438208 1592.36 10048
+4.448256 1592.36 10048
+4.458368 1582.28 10112
+4.468480 1582.28 10112
+4.478656 1572.33 10176
+4.488896 1562.50 10240
+4.499200 1552.80 10304
+4.509504 1552.80 10304
+4.519872 1543.21 10368
+4.530304 1533.74 10432
+4.540736 1533.74 10432
+4.551168 1533.74 10432
+4.561664 1524.39 10496
+4.572224 1515.15 10560
+4.582848 1506.02 10624
+4.593536 1497.01 10688
+4.604288 1488.10 10752
+4.615040 1488.10 10752
+4.625856 1479.29 10816
+4.636736 1470.59 10880
+4.647680 1461.99 10944
+4.658688 1453.49 11008
+4.669760 1445.09 11072
+4.680896 1436.78 11136
+4.692032 1436.78 11136
+4.703168 1436.78 11136
+4.714368 1428.57 11200
+4.725632 1420.45 11264
+4.736960 1412.43 11328
+4.748352 1404.49 11392
+4.759808 1396.65 11456
+4.771328 1388.89 11520
+4.782912 1381.22 11584
+4.794560 1373.63 11648
+4.806272 1366.12 11712
+4.818048 1358.70 11776
+4.829888 1351.35 11840
+4.841792 1344.09 11904
+4.853760 1336.90 11968
+4.865792 1329.79 12032
+4.877888 1322.75 12096
+4.890048 1315.79 12160
+4.902272 1308.90 12224
+4.914560 1302.08 12288
+4.926912 1295.34 12352
+4.939328 1288.66 12416
+4.951936 1269.04 12608
+4.964608 1262.63 12672
+4.977344 1256.28 12736
+4.990144 1250.00 12800
+5.003008 1243.78 12864
+5.015936 1237.62 12928
+5.028992 1225.49 13056
+5.042112 1219.51 13120
+5.055296 1213.59 13184
+5.068608 1201.92 13312
+5.082048 1190.48 13440
+5.095552 1184.83 13504
+5.109120 1179.25 13568
+5.122816 1168.22 13696
+5.136640 1157.41 13824
+5.150528 1152.07 13888
+5.164544 1141.55 14016
+5.178624 1136.36 14080
+5.192896 1121.08 14272
+5.207232 1116.07 14336
+5.221696 1106.19 14464
+5.236288 1096.49 14592
+5.251008 1086.96 14720
+5.265792 1082.25 14784
+5.280768 1068.38 14976
+5.295872 1059.32 15104
+5.311104 1050.42 15232
+5.326464 1041.67 15360
+5.342016 1028.81 15552
+5.357760 1016.26 15744
+5.373568 1012.15 15808
+5.389568 1000.00 16000
+5.405696 992.06 16128
+5.422016 980.39 16320
+5.438528 968.99 16512
+5.455168 961.54 16640
+5.472064 946.97 16896
+5.489088 939.85 17024
+5.506368 925.93 17280
+5.523776 919.12 17408
+5.541312 912.41 17536
+5.559232 892.86 17920
+5.577280 886.52 18048
+5.595584 874.13 18304
+5.614144 862.07 18560
+5.632960 850.34 18816
+5.652032 838.93 19072
+5.671488 822.37 19456
+5.691072 816.99 19584
+5.711040 801.28 19968
+5.731264 791.14 20224
+5.751872 776.40 20608
+5.772736 766.87 20864
+5.794112 748.50 21376
+5.815872 735.29 21760
+5.838144 718.39 22272
+5.860672 710.23 22528
+5.883712 694.44 23040
+5.907264 679.35 23552
+5.931328 664.89 24064
+5.955904 651.04 24576
+5.981248 631.31 25344
+6.007104 618.81 25856
+6.033728 600.96 26624
+6.061120 584.11 27392
+6.089280 568.18 28160
+6.118464 548.25 29184
+6.148672 529.66 30208
+6.180160 508.13 31488
+6.212800 490.20 32640
+6.246848 469.92 34048
+6.282688 446.43 35840
+6.320320 425.17 37632
+6.360256 400.64 39936
+6.403008 374.25 42752
+6.449088 347.22 46080
+6.499776 315.66 50688
+6.556096 284.09 56320
+6.621376 245.10 65280
+6.701248 200.32 79872
+6.813888 142.05 112640
+6.973632 100.16 159744
+EOF
+plot $data using 1:2 with linespoints
+pause -1
@@ -0,0 +1,11613 @@
+$data <<EOF
+0.356352 44.90 356352
+0.609280 63.26 252928
+0.815104 77.74 205824
+0.993280 89.80 178176
+1.153024 100.16 159744
+1.298432 110.04 145408
+1.433600 118.37 135168
+1.560064 126.52 126464
+1.679360 134.12 119296
+1.792000 142.05 112640
+1.899520 148.81 107520
+2.002432 155.47 102912
+2.101248 161.92 98816
+2.196480 168.01 95232
+2.288640 173.61 92160
+2.377728 179.60 89088
+2.464256 184.91 86528
+2.548224 190.55 83968
+2.630144 195.31 81920
+2.710016 200.32 79872
+2.787840 205.59 77824
+2.863616 211.15 75776
+2.937856 215.52 74240
+3.010560 220.07 72704
+3.082240 223.21 71680
+3.152384 228.10 70144
+3.221504 231.48 69120
+3.289088 236.74 67584
+3.355136 242.25 66048
+3.420416 245.10 65280
+3.484672 249.00 64256
+3.547904 253.04 63232
+3.610112 257.20 62208
+3.671296 261.51 61184
+3.731712 264.83 60416
+3.791360 268.24 59648
+3.849984 272.93 58624
+3.907840 276.55 57856
+3.965184 279.02 57344
+4.021504 284.09 56320
+4.077312 286.70 55808
+4.132608 289.35 55296
+4.187136 293.43 54528
+4.240896 297.62 53760
+4.294144 300.48 53248
+4.346624 304.88 52480
+4.398592 307.88 51968
+4.450048 310.95 51456
+4.501248 312.50 51200
+4.551936 315.66 50688
+4.602112 318.88 50176
+4.651520 323.83 49408
+4.700416 327.23 48896
+4.749056 328.95 48640
+4.797184 332.45 48128
+4.844800 336.02 47616
+4.892160 337.84 47360
+4.939008 341.53 46848
+4.985344 345.30 46336
+5.031424 347.22 46080
+5.076992 351.12 45568
+5.122304 353.11 45312
+5.167104 357.14 44800
+5.211648 359.20 44544
+5.255936 361.27 44288
+5.299968 363.37 44032
+5.343744 365.50 43776
+5.387008 369.82 43264
+5.430016 372.02 43008
+5.472768 374.25 42752
+5.515008 378.79 42240
+5.556992 381.10 41984
+5.598720 383.44 41728
+5.640192 385.80 41472
+5.681408 388.20 41216
+5.722368 390.62 40960
+5.763072 393.08 40704
+5.803520 395.57 40448
+5.843712 398.09 40192
+5.883648 400.64 39936
+5.923328 403.23 39680
+5.962752 405.84 39424
+6.001920 408.50 39168
+6.040832 411.18 38912
+6.079744 411.18 38912
+6.118400 413.91 38656
+6.156800 416.67 38400
+6.194688 422.30 37888
+6.232320 425.17 37632
+6.269952 425.17 37632
+6.307328 428.08 37376
+6.344448 431.03 37120
+6.381312 434.03 36864
+6.418176 434.03 36864
+6.454784 437.06 36608
+6.491136 440.14 36352
+6.527232 443.26 36096
+6.563328 443.26 36096
+6.599168 446.43 35840
+6.635008 446.43 35840
+6.670592 449.64 35584
+6.705920 452.90 35328
+6.740992 456.20 35072
+6.776064 456.20 35072
+6.810880 459.56 34816
+6.845440 462.96 34560
+6.880000 462.96 34560
+6.914560 462.96 34560
+6.948864 466.42 34304
+6.982912 469.92 34048
+7.016704 473.48 33792
+7.050496 473.48 33792
+7.084032 477.10 33536
+7.117568 477.10 33536
+7.150848 480.77 33280
+7.183872 484.50 33024
+7.216896 484.50 33024
+7.249664 488.28 32768
+7.282432 488.28 32768
+7.315072 490.20 32640
+7.347584 492.13 32512
+7.379840 496.03 32256
+7.412096 496.03 32256
+7.444224 498.01 32128
+7.476224 500.00 32000
+7.507968 504.03 31744
+7.539712 504.03 31744
+7.571328 506.07 31616
+7.602816 508.13 31488
+7.634048 512.30 31232
+7.665280 512.30 31232
+7.696384 514.40 31104
+7.727360 516.53 30976
+7.758336 516.53 30976
+7.789056 520.83 30720
+7.819648 523.01 30592
+7.850240 523.01 30592
+7.880704 525.21 30464
+7.910912 529.66 30208
+7.941120 529.66 30208
+7.971200 531.91 30080
+8.001152 534.19 29952
+8.031104 534.19 29952
+8.060928 536.48 29824
+8.090496 541.13 29568
+8.120064 541.13 29568
+8.149504 543.48 29440
+8.178816 545.85 29312
+8.208128 545.85 29312
+8.237312 548.25 29184
+8.266496 548.25 29184
+8.295424 553.10 28928
+8.324224 555.56 28800
+8.353024 555.56 28800
+8.381696 558.04 28672
+8.410368 558.04 28672
+8.438912 560.54 28544
+8.467200 565.61 28288
+8.495488 565.61 28288
+8.523648 568.18 28160
+8.551808 568.18 28160
+8.579840 570.78 28032
+8.607872 570.78 28032
+8.635776 573.39 27904
+8.663552 576.04 27776
+8.691328 576.04 27776
+8.718976 578.70 27648
+8.746624 578.70 27648
+8.774016 584.11 27392
+8.801408 584.11 27392
+8.828672 586.85 27264
+8.855936 586.85 27264
+8.883072 589.62 27136
+8.910208 589.62 27136
+8.937216 592.42 27008
+8.964096 595.24 26880
+8.990976 595.24 26880
+9.017728 598.09 26752
+9.044480 598.09 26752
+9.071104 600.96 26624
+9.097728 600.96 26624
+9.124096 606.80 26368
+9.150464 606.80 26368
+9.176704 609.76 26240
+9.202944 609.76 26240
+9.229056 612.75 26112
+9.255168 612.75 26112
+9.281152 615.76 25984
+9.307136 615.76 25984
+9.332992 618.81 25856
+9.358848 618.81 25856
+9.384576 621.89 25728
+9.410304 621.89 25728
+9.435904 625.00 25600
+9.461504 625.00 25600
+9.487104 625.00 25600
+9.512576 628.14 25472
+9.538048 628.14 25472
+9.563392 631.31 25344
+9.588736 631.31 25344
+9.613952 634.52 25216
+9.639168 634.52 25216
+9.664256 637.76 25088
+9.689344 637.76 25088
+9.714176 644.33 24832
+9.739008 644.33 24832
+9.763712 647.67 24704
+9.788416 647.67 24704
+9.813120 647.67 24704
+9.837696 651.04 24576
+9.862272 651.04 24576
+9.886720 654.45 24448
+9.911168 654.45 24448
+9.935488 657.89 24320
+9.959808 657.89 24320
+9.984128 657.89 24320
+10.008320 661.38 24192
+10.032512 661.38 24192
+10.056576 664.89 24064
+10.080640 664.89 24064
+10.104576 668.45 23936
+10.128512 668.45 23936
+10.152448 668.45 23936
+10.176256 672.04 23808
+10.200064 672.04 23808
+10.223744 675.68 23680
+10.247424 675.68 23680
+10.271104 675.68 23680
+10.294656 679.35 23552
+10.318208 679.35 23552
+10.341632 683.06 23424
+10.365056 683.06 23424
+10.388480 683.06 23424
+10.411776 686.81 23296
+10.435072 686.81 23296
+10.458240 690.61 23168
+10.481408 690.61 23168
+10.504576 690.61 23168
+10.527616 694.44 23040
+10.550656 694.44 23040
+10.573568 698.32 22912
+10.596480 698.32 22912
+10.619392 698.32 22912
+10.642176 702.25 22784
+10.664960 702.25 22784
+10.687744 702.25 22784
+10.710400 706.21 22656
+10.733056 706.21 22656
+10.755584 710.23 22528
+10.778112 710.23 22528
+10.800640 710.23 22528
+10.823040 714.29 22400
+10.845440 714.29 22400
+10.867840 714.29 22400
+10.890112 718.39 22272
+10.912384 718.39 22272
+10.934656 718.39 22272
+10.956928 718.39 22272
+10.979200 718.39 22272
+11.001344 722.54 22144
+11.023488 722.54 22144
+11.045632 722.54 22144
+11.067776 722.54 22144
+11.089792 726.74 22016
+11.111808 726.74 22016
+11.133696 730.99 21888
+11.155584 730.99 21888
+11.177472 730.99 21888
+11.199360 730.99 21888
+11.221120 735.29 21760
+11.242880 735.29 21760
+11.264512 739.64 21632
+11.286144 739.64 21632
+11.307776 739.64 21632
+11.329408 739.64 21632
+11.350912 744.05 21504
+11.372416 744.05 21504
+11.393792 748.50 21376
+11.415168 748.50 21376
+11.436544 748.50 21376
+11.457920 748.50 21376
+11.479168 753.01 21248
+11.500416 753.01 21248
+11.521536 757.58 21120
+11.542656 757.58 21120
+11.563776 757.58 21120
+11.584896 757.58 21120
+11.605888 762.20 20992
+11.626880 762.20 20992
+11.647744 766.87 20864
+11.668608 766.87 20864
+11.689472 766.87 20864
+11.710336 766.87 20864
+11.731200 766.87 20864
+11.752064 766.87 20864
+11.772800 771.60 20736
+11.793536 771.60 20736
+11.814272 771.60 20736
+11.835008 771.60 20736
+11.855616 776.40 20608
+11.876224 776.40 20608
+11.896832 776.40 20608
+11.917440 776.40 20608
+11.937920 781.25 20480
+11.958400 781.25 20480
+11.978752 786.16 20352
+11.999104 786.16 20352
+12.019456 786.16 20352
+12.039808 786.16 20352
+12.060032 791.14 20224
+12.080256 791.14 20224
+12.100480 791.14 20224
+12.120704 791.14 20224
+12.140800 796.18 20096
+12.160896 796.18 20096
+12.180992 796.18 20096
+12.201088 796.18 20096
+12.221184 796.18 20096
+12.241280 796.18 20096
+12.261248 801.28 19968
+12.281216 801.28 19968
+12.301184 801.28 19968
+12.321152 801.28 19968
+12.340992 806.45 19840
+12.360832 806.45 19840
+12.380672 806.45 19840
+12.400512 806.45 19840
+12.420224 811.69 19712
+12.439936 811.69 19712
+12.459520 816.99 19584
+12.479104 816.99 19584
+12.498688 816.99 19584
+12.518272 816.99 19584
+12.537728 822.37 19456
+12.557184 822.37 19456
+12.576640 822.37 19456
+12.596096 822.37 19456
+12.615552 822.37 19456
+12.635008 822.37 19456
+12.654464 822.37 19456
+12.673920 822.37 19456
+12.693248 827.81 19328
+12.712576 827.81 19328
+12.731904 827.81 19328
+12.751232 827.81 19328
+12.770432 833.33 19200
+12.789632 833.33 19200
+12.808832 833.33 19200
+12.828032 833.33 19200
+12.847104 838.93 19072
+12.866176 838.93 19072
+12.885120 844.59 18944
+12.904064 844.59 18944
+12.923008 844.59 18944
+12.941952 844.59 18944
+12.960768 850.34 18816
+12.979584 850.34 18816
+12.998400 850.34 18816
+13.017216 850.34 18816
+13.036032 850.34 18816
+13.054848 850.34 18816
+13.073664 850.34 18816
+13.092480 850.34 18816
+13.111168 856.16 18688
+13.129856 856.16 18688
+13.148544 856.16 18688
+13.167232 856.16 18688
+13.185792 862.07 18560
+13.204352 862.07 18560
+13.222912 862.07 18560
+13.241472 862.07 18560
+13.259904 868.06 18432
+13.278336 868.06 18432
+13.296768 868.06 18432
+13.315200 868.06 18432
+13.333632 868.06 18432
+13.352064 868.06 18432
+13.370496 868.06 18432
+13.388928 868.06 18432
+13.407232 874.13 18304
+13.425536 874.13 18304
+13.443840 874.13 18304
+13.462144 874.13 18304
+13.480320 880.28 18176
+13.498496 880.28 18176
+13.516672 880.28 18176
+13.534848 880.28 18176
+13.552896 886.52 18048
+13.570944 886.52 18048
+13.588992 886.52 18048
+13.607040 886.52 18048
+13.625088 886.52 18048
+13.643136 886.52 18048
+13.661056 892.86 17920
+13.678976 892.86 17920
+13.696896 892.86 17920
+13.714816 892.86 17920
+13.732736 892.86 17920
+13.750656 892.86 17920
+13.768576 892.86 17920
+13.786496 892.86 17920
+13.804288 899.28 17792
+13.822080 899.28 17792
+13.839872 899.28 17792
+13.857664 899.28 17792
+13.875328 905.80 17664
+13.892992 905.80 17664
+13.910656 905.80 17664
+13.928320 905.80 17664
+13.945856 912.41 17536
+13.963392 912.41 17536
+13.980928 912.41 17536
+13.998464 912.41 17536
+14.016000 912.41 17536
+14.033536 912.41 17536
+14.051072 912.41 17536
+14.068608 912.41 17536
+14.086144 912.41 17536
+14.103680 912.41 17536
+14.121088 919.12 17408
+14.138496 919.12 17408
+14.155904 919.12 17408
+14.173312 919.12 17408
+14.190592 925.93 17280
+14.207872 925.93 17280
+14.225152 925.93 17280
+14.242432 925.93 17280
+14.259712 925.93 17280
+14.276992 925.93 17280
+14.294272 925.93 17280
+14.311552 925.93 17280
+14.328832 925.93 17280
+14.346112 925.93 17280
+14.363264 932.84 17152
+14.380416 932.84 17152
+14.397568 932.84 17152
+14.414720 932.84 17152
+14.431744 939.85 17024
+14.448768 939.85 17024
+14.465792 939.85 17024
+14.482816 939.85 17024
+14.499712 946.97 16896
+14.516608 946.97 16896
+14.533504 946.97 16896
+14.550400 946.97 16896
+14.567296 946.97 16896
+14.584192 946.97 16896
+14.601088 946.97 16896
+14.617984 946.97 16896
+14.634880 946.97 16896
+14.651776 946.97 16896
+14.668544 954.20 16768
+14.685312 954.20 16768
+14.702080 954.20 16768
+14.718848 954.20 16768
+14.735616 954.20 16768
+14.752384 954.20 16768
+14.769024 961.54 16640
+14.785664 961.54 16640
+14.802304 961.54 16640
+14.818944 961.54 16640
+14.835456 968.99 16512
+14.851968 968.99 16512
+14.868480 968.99 16512
+14.884992 968.99 16512
+14.901504 968.99 16512
+14.918016 968.99 16512
+14.934528 968.99 16512
+14.951040 968.99 16512
+14.967552 968.99 16512
+14.984064 968.99 16512
+15.000448 976.56 16384
+15.016832 976.56 16384
+15.033216 976.56 16384
+15.049600 976.56 16384
+15.065984 976.56 16384
+15.082368 976.56 16384
+15.098688 980.39 16320
+15.115008 980.39 16320
+15.131328 980.39 16320
+15.147648 980.39 16320
+15.163904 984.25 16256
+15.180160 984.25 16256
+15.196416 984.25 16256
+15.212672 984.25 16256
+15.228928 984.25 16256
+15.245184 984.25 16256
+15.261312 992.06 16128
+15.277440 992.06 16128
+15.293568 992.06 16128
+15.309696 992.06 16128
+15.325824 992.06 16128
+15.341952 992.06 16128
+15.358016 996.02 16064
+15.374080 996.02 16064
+15.390144 996.02 16064
+15.406208 996.02 16064
+15.422208 1000.00 16000
+15.438208 1000.00 16000
+15.454208 1000.00 16000
+15.470208 1000.00 16000
+15.486208 1000.00 16000
+15.502208 1000.00 16000
+15.518080 1008.06 15872
+15.533952 1008.06 15872
+15.549824 1008.06 15872
+15.565696 1008.06 15872
+15.581568 1008.06 15872
+15.597440 1008.06 15872
+15.613248 1012.15 15808
+15.629056 1012.15 15808
+15.644864 1012.15 15808
+15.660672 1012.15 15808
+15.676480 1012.15 15808
+15.692288 1012.15 15808
+15.708032 1016.26 15744
+15.723776 1016.26 15744
+15.739520 1016.26 15744
+15.755264 1016.26 15744
+15.770880 1024.59 15616
+15.786496 1024.59 15616
+15.802112 1024.59 15616
+15.817728 1024.59 15616
+15.833344 1024.59 15616
+15.848960 1024.59 15616
+15.864576 1024.59 15616
+15.880192 1024.59 15616
+15.895744 1028.81 15552
+15.911296 1028.81 15552
+15.926848 1028.81 15552
+15.942400 1028.81 15552
+15.957888 1033.06 15488
+15.973376 1033.06 15488
+15.988864 1033.06 15488
+16.004352 1033.06 15488
+16.019840 1033.06 15488
+16.035328 1033.06 15488
+16.050816 1033.06 15488
+16.066304 1033.06 15488
+16.081664 1041.67 15360
+16.097024 1041.67 15360
+16.112384 1041.67 15360
+16.127744 1041.67 15360
+16.143040 1046.03 15296
+16.158336 1046.03 15296
+16.173632 1046.03 15296
+16.188928 1046.03 15296
+16.204224 1046.03 15296
+16.219520 1046.03 15296
+16.234816 1046.03 15296
+16.250112 1046.03 15296
+16.265344 1050.42 15232
+16.280576 1050.42 15232
+16.295808 1050.42 15232
+16.311040 1050.42 15232
+16.326144 1059.32 15104
+16.341248 1059.32 15104
+16.356352 1059.32 15104
+16.371456 1059.32 15104
+16.386560 1059.32 15104
+16.401664 1059.32 15104
+16.416768 1059.32 15104
+16.431872 1059.32 15104
+16.446912 1063.83 15040
+16.461952 1063.83 15040
+16.476992 1063.83 15040
+16.492032 1063.83 15040
+16.507008 1068.38 14976
+16.521984 1068.38 14976
+16.536960 1068.38 14976
+16.551936 1068.38 14976
+16.566912 1068.38 14976
+16.581888 1068.38 14976
+16.596864 1068.38 14976
+16.611840 1068.38 14976
+16.626752 1072.96 14912
+16.641664 1072.96 14912
+16.656576 1072.96 14912
+16.671488 1072.96 14912
+16.686272 1082.25 14784
+16.701056 1082.25 14784
+16.715840 1082.25 14784
+16.730624 1082.25 14784
+16.745408 1082.25 14784
+16.760192 1082.25 14784
+16.774976 1082.25 14784
+16.789760 1082.25 14784
+16.804480 1086.96 14720
+16.819200 1086.96 14720
+16.833920 1086.96 14720
+16.848640 1086.96 14720
+16.863296 1091.70 14656
+16.877952 1091.70 14656
+16.892608 1091.70 14656
+16.907264 1091.70 14656
+16.921920 1091.70 14656
+16.936576 1091.70 14656
+16.951232 1091.70 14656
+16.965888 1091.70 14656
+16.980480 1096.49 14592
+16.995072 1096.49 14592
+17.009664 1096.49 14592
+17.024256 1096.49 14592
+17.038848 1096.49 14592
+17.053440 1096.49 14592
+17.068032 1096.49 14592
+17.082624 1096.49 14592
+17.097088 1106.19 14464
+17.111552 1106.19 14464
+17.126016 1106.19 14464
+17.140480 1106.19 14464
+17.154880 1111.11 14400
+17.169280 1111.11 14400
+17.183680 1111.11 14400
+17.198080 1111.11 14400
+17.212480 1111.11 14400
+17.226880 1111.11 14400
+17.241280 1111.11 14400
+17.255680 1111.11 14400
+17.270016 1116.07 14336
+17.284352 1116.07 14336
+17.298688 1116.07 14336
+17.313024 1116.07 14336
+17.327360 1116.07 14336
+17.341696 1116.07 14336
+17.356032 1116.07 14336
+17.370368 1116.07 14336
+17.384640 1121.08 14272
+17.398912 1121.08 14272
+17.413184 1121.08 14272
+17.427456 1121.08 14272
+17.441600 1131.22 14144
+17.455744 1131.22 14144
+17.469888 1131.22 14144
+17.484032 1131.22 14144
+17.498176 1131.22 14144
+17.512320 1131.22 14144
+17.526464 1131.22 14144
+17.540608 1131.22 14144
+17.554688 1136.36 14080
+17.568768 1136.36 14080
+17.582848 1136.36 14080
+17.596928 1136.36 14080
+17.611008 1136.36 14080
+17.625088 1136.36 14080
+17.639168 1136.36 14080
+17.653248 1136.36 14080
+17.667264 1141.55 14016
+17.681280 1141.55 14016
+17.695296 1141.55 14016
+17.709312 1141.55 14016
+17.723328 1141.55 14016
+17.737344 1141.55 14016
+17.751360 1141.55 14016
+17.765376 1141.55 14016
+17.779328 1146.79 13952
+17.793280 1146.79 13952
+17.807232 1146.79 13952
+17.821184 1146.79 13952
+17.835072 1152.07 13888
+17.848960 1152.07 13888
+17.862848 1152.07 13888
+17.876736 1152.07 13888
+17.890624 1152.07 13888
+17.904512 1152.07 13888
+17.918400 1152.07 13888
+17.932288 1152.07 13888
+17.946112 1157.41 13824
+17.959936 1157.41 13824
+17.973760 1157.41 13824
+17.987584 1157.41 13824
+18.001408 1157.41 13824
+18.015232 1157.41 13824
+18.029056 1157.41 13824
+18.042880 1157.41 13824
+18.056576 1168.22 13696
+18.070272 1168.22 13696
+18.083968 1168.22 13696
+18.097664 1168.22 13696
+18.111360 1168.22 13696
+18.125056 1168.22 13696
+18.138752 1168.22 13696
+18.152448 1168.22 13696
+18.166080 1173.71 13632
+18.179712 1173.71 13632
+18.193344 1173.71 13632
+18.206976 1173.71 13632
+18.220608 1173.71 13632
+18.234240 1173.71 13632
+18.247872 1173.71 13632
+18.261504 1173.71 13632
+18.275072 1179.25 13568
+18.288640 1179.25 13568
+18.302208 1179.25 13568
+18.315776 1179.25 13568
+18.329344 1179.25 13568
+18.342912 1179.25 13568
+18.356480 1179.25 13568
+18.370048 1179.25 13568
+18.383552 1184.83 13504
+18.397056 1184.83 13504
+18.410560 1184.83 13504
+18.424064 1184.83 13504
+18.437504 1190.48 13440
+18.450944 1190.48 13440
+18.464384 1190.48 13440
+18.477824 1190.48 13440
+18.491264 1190.48 13440
+18.504704 1190.48 13440
+18.518144 1190.48 13440
+18.531584 1190.48 13440
+18.544960 1196.17 13376
+18.558336 1196.17 13376
+18.571712 1196.17 13376
+18.585088 1196.17 13376
+18.598464 1196.17 13376
+18.611840 1196.17 13376
+18.625216 1196.17 13376
+18.638592 1196.17 13376
+18.651904 1201.92 13312
+18.665216 1201.92 13312
+18.678528 1201.92 13312
+18.691840 1201.92 13312
+18.705152 1201.92 13312
+18.718464 1201.92 13312
+18.731776 1201.92 13312
+18.745088 1201.92 13312
+18.758272 1213.59 13184
+18.771456 1213.59 13184
+18.784640 1213.59 13184
+18.797824 1213.59 13184
+18.811008 1213.59 13184
+18.824192 1213.59 13184
+18.837376 1213.59 13184
+18.850560 1213.59 13184
+18.863680 1219.51 13120
+18.876800 1219.51 13120
+18.889920 1219.51 13120
+18.903040 1219.51 13120
+18.916160 1219.51 13120
+18.929280 1219.51 13120
+18.942400 1219.51 13120
+18.955520 1219.51 13120
+18.968576 1225.49 13056
+18.981632 1225.49 13056
+18.994688 1225.49 13056
+19.007744 1225.49 13056
+19.020800 1225.49 13056
+19.033856 1225.49 13056
+19.046912 1225.49 13056
+19.059968 1225.49 13056
+19.072960 1231.53 12992
+19.085952 1231.53 12992
+19.098944 1231.53 12992
+19.111936 1231.53 12992
+19.124928 1231.53 12992
+19.137920 1231.53 12992
+19.150912 1231.53 12992
+19.163904 1231.53 12992
+19.176832 1237.62 12928
+19.189760 1237.62 12928
+19.202688 1237.62 12928
+19.215616 1237.62 12928
+19.228544 1237.62 12928
+19.241472 1237.62 12928
+19.254400 1237.62 12928
+19.267328 1237.62 12928
+19.280192 1243.78 12864
+19.293056 1243.78 12864
+19.305920 1243.78 12864
+19.318784 1243.78 12864
+19.331648 1243.78 12864
+19.344512 1243.78 12864
+19.357376 1243.78 12864
+19.370240 1243.78 12864
+19.383040 1250.00 12800
+19.395840 1250.00 12800
+19.408640 1250.00 12800
+19.421440 1250.00 12800
+19.434240 1250.00 12800
+19.447040 1250.00 12800
+19.459840 1250.00 12800
+19.472640 1250.00 12800
+19.485440 1250.00 12800
+19.498240 1250.00 12800
+19.511040 1250.00 12800
+19.523840 1250.00 12800
+19.536576 1256.28 12736
+19.549312 1256.28 12736
+19.562048 1256.28 12736
+19.574784 1256.28 12736
+19.587520 1256.28 12736
+19.600256 1256.28 12736
+19.612992 1256.28 12736
+19.625728 1256.28 12736
+19.638400 1262.63 12672
+19.651072 1262.63 12672
+19.663744 1262.63 12672
+19.676416 1262.63 12672
+19.689088 1262.63 12672
+19.701760 1262.63 12672
+19.714432 1262.63 12672
+19.727104 1262.63 12672
+19.739712 1269.04 12608
+19.752320 1269.04 12608
+19.764928 1269.04 12608
+19.777536 1269.04 12608
+19.790144 1269.04 12608
+19.802752 1269.04 12608
+19.815360 1269.04 12608
+19.827968 1269.04 12608
+19.840512 1275.51 12544
+19.853056 1275.51 12544
+19.865600 1275.51 12544
+19.878144 1275.51 12544
+19.890688 1275.51 12544
+19.903232 1275.51 12544
+19.915776 1275.51 12544
+19.928320 1275.51 12544
+19.940736 1288.66 12416
+19.953152 1288.66 12416
+19.965568 1288.66 12416
+19.977984 1288.66 12416
+19.990400 1288.66 12416
+20.002816 1288.66 12416
+20.015232 1288.66 12416
+20.027648 1288.66 12416
+20.040000 1295.34 12352
+20.052352 1295.34 12352
+20.064704 1295.34 12352
+20.077056 1295.34 12352
+20.089408 1295.34 12352
+20.101760 1295.34 12352
+20.114112 1295.34 12352
+20.126464 1295.34 12352
+20.138816 1295.34 12352
+20.151168 1295.34 12352
+20.163520 1295.34 12352
+20.175872 1295.34 12352
+20.188160 1302.08 12288
+20.200448 1302.08 12288
+20.212736 1302.08 12288
+20.225024 1302.08 12288
+20.237312 1302.08 12288
+20.249600 1302.08 12288
+20.261888 1302.08 12288
+20.274176 1302.08 12288
+20.286400 1308.90 12224
+20.298624 1308.90 12224
+20.310848 1308.90 12224
+20.323072 1308.90 12224
+20.335296 1308.90 12224
+20.347520 1308.90 12224
+20.359744 1308.90 12224
+20.371968 1308.90 12224
+20.384128 1315.79 12160
+20.396288 1315.79 12160
+20.408448 1315.79 12160
+20.420608 1315.79 12160
+20.432768 1315.79 12160
+20.444928 1315.79 12160
+20.457088 1315.79 12160
+20.469248 1315.79 12160
+20.481408 1315.79 12160
+20.493568 1315.79 12160
+20.505728 1315.79 12160
+20.517888 1315.79 12160
+20.529984 1322.75 12096
+20.542080 1322.75 12096
+20.554176 1322.75 12096
+20.566272 1322.75 12096
+20.578368 1322.75 12096
+20.590464 1322.75 12096
+20.602560 1322.75 12096
+20.614656 1322.75 12096
+20.626688 1329.79 12032
+20.638720 1329.79 12032
+20.650752 1329.79 12032
+20.662784 1329.79 12032
+20.674816 1329.79 12032
+20.686848 1329.79 12032
+20.698880 1329.79 12032
+20.710912 1329.79 12032
+20.722880 1336.90 11968
+20.734848 1336.90 11968
+20.746816 1336.90 11968
+20.758784 1336.90 11968
+20.770752 1336.90 11968
+20.782720 1336.90 11968
+20.794688 1336.90 11968
+20.806656 1336.90 11968
+20.818624 1336.90 11968
+20.830592 1336.90 11968
+20.842560 1336.90 11968
+20.854528 1336.90 11968
+20.866432 1344.09 11904
+20.878336 1344.09 11904
+20.890240 1344.09 11904
+20.902144 1344.09 11904
+20.914048 1344.09 11904
+20.925952 1344.09 11904
+20.937856 1344.09 11904
+20.949760 1344.09 11904
+20.961600 1351.35 11840
+20.973440 1351.35 11840
+20.985280 1351.35 11840
+20.997120 1351.35 11840
+21.008960 1351.35 11840
+21.020800 1351.35 11840
+21.032640 1351.35 11840
+21.044480 1351.35 11840
+21.056320 1351.35 11840
+21.068160 1351.35 11840
+21.080000 1351.35 11840
+21.091840 1351.35 11840
+21.103616 1358.70 11776
+21.115392 1358.70 11776
+21.127168 1358.70 11776
+21.138944 1358.70 11776
+21.150720 1358.70 11776
+21.162496 1358.70 11776
+21.174272 1358.70 11776
+21.186048 1358.70 11776
+21.197760 1366.12 11712
+21.209472 1366.12 11712
+21.221184 1366.12 11712
+21.232896 1366.12 11712
+21.244608 1366.12 11712
+21.256320 1366.12 11712
+21.268032 1366.12 11712
+21.279744 1366.12 11712
+21.291456 1366.12 11712
+21.303168 1366.12 11712
+21.314880 1366.12 11712
+21.326592 1366.12 11712
+21.338240 1373.63 11648
+21.349888 1373.63 11648
+21.361536 1373.63 11648
+21.373184 1373.63 11648
+21.384832 1373.63 11648
+21.396480 1373.63 11648
+21.408128 1373.63 11648
+21.419776 1373.63 11648
+21.431360 1381.22 11584
+21.442944 1381.22 11584
+21.454528 1381.22 11584
+21.466112 1381.22 11584
+21.477696 1381.22 11584
+21.489280 1381.22 11584
+21.500864 1381.22 11584
+21.512448 1381.22 11584
+21.524032 1381.22 11584
+21.535616 1381.22 11584
+21.547200 1381.22 11584
+21.558784 1381.22 11584
+21.570304 1388.89 11520
+21.581824 1388.89 11520
+21.593344 1388.89 11520
+21.604864 1388.89 11520
+21.616384 1388.89 11520
+21.627904 1388.89 11520
+21.639424 1388.89 11520
+21.650944 1388.89 11520
+21.662400 1396.65 11456
+21.673856 1396.65 11456
+21.685312 1396.65 11456
+21.696768 1396.65 11456
+21.708224 1396.65 11456
+21.719680 1396.65 11456
+21.731136 1396.65 11456
+21.742592 1396.65 11456
+21.754048 1396.65 11456
+21.765504 1396.65 11456
+21.776960 1396.65 11456
+21.788416 1396.65 11456
+21.799808 1404.49 11392
+21.811200 1404.49 11392
+21.822592 1404.49 11392
+21.833984 1404.49 11392
+21.845376 1404.49 11392
+21.856768 1404.49 11392
+21.868160 1404.49 11392
+21.879552 1404.49 11392
+21.890944 1404.49 11392
+21.902336 1404.49 11392
+21.913728 1404.49 11392
+21.925120 1404.49 11392
+21.936448 1412.43 11328
+21.947776 1412.43 11328
+21.959104 1412.43 11328
+21.970432 1412.43 11328
+21.981760 1412.43 11328
+21.993088 1412.43 11328
+22.004416 1412.43 11328
+22.015744 1412.43 11328
+22.027008 1420.45 11264
+22.038272 1420.45 11264
+22.049536 1420.45 11264
+22.060800 1420.45 11264
+22.072064 1420.45 11264
+22.083328 1420.45 11264
+22.094592 1420.45 11264
+22.105856 1420.45 11264
+22.117120 1420.45 11264
+22.128384 1420.45 11264
+22.139648 1420.45 11264
+22.150912 1420.45 11264
+22.162112 1428.57 11200
+22.173312 1428.57 11200
+22.184512 1428.57 11200
+22.195712 1428.57 11200
+22.206912 1428.57 11200
+22.218112 1428.57 11200
+22.229312 1428.57 11200
+22.240512 1428.57 11200
+22.251712 1428.57 11200
+22.262912 1428.57 11200
+22.274112 1428.57 11200
+22.285312 1428.57 11200
+22.296448 1436.78 11136
+22.307584 1436.78 11136
+22.318720 1436.78 11136
+22.329856 1436.78 11136
+22.340992 1436.78 11136
+22.352128 1436.78 11136
+22.363264 1436.78 11136
+22.374400 1436.78 11136
+22.385536 1436.78 11136
+22.396672 1436.78 11136
+22.407808 1436.78 11136
+22.418944 1436.78 11136
+22.430080 1436.78 11136
+22.441216 1436.78 11136
+22.452352 1436.78 11136
+22.463488 1436.78 11136
+22.474624 1436.78 11136
+22.485760 1436.78 11136
+22.496896 1436.78 11136
+22.508032 1436.78 11136
+22.519104 1445.09 11072
+22.530176 1445.09 11072
+22.541248 1445.09 11072
+22.552320 1445.09 11072
+22.563392 1445.09 11072
+22.574464 1445.09 11072
+22.585536 1445.09 11072
+22.596608 1445.09 11072
+22.607680 1445.09 11072
+22.618752 1445.09 11072
+22.629824 1445.09 11072
+22.640896 1445.09 11072
+22.651968 1445.09 11072
+22.663040 1445.09 11072
+22.674112 1445.09 11072
+22.685184 1445.09 11072
+22.696192 1453.49 11008
+22.707200 1453.49 11008
+22.718208 1453.49 11008
+22.729216 1453.49 11008
+22.740224 1453.49 11008
+22.751232 1453.49 11008
+22.762240 1453.49 11008
+22.773248 1453.49 11008
+22.784192 1461.99 10944
+22.795136 1461.99 10944
+22.806080 1461.99 10944
+22.817024 1461.99 10944
+22.827968 1461.99 10944
+22.838912 1461.99 10944
+22.849856 1461.99 10944
+22.860800 1461.99 10944
+22.871744 1461.99 10944
+22.882688 1461.99 10944
+22.893632 1461.99 10944
+22.904576 1461.99 10944
+22.915520 1461.99 10944
+22.926464 1461.99 10944
+22.937408 1461.99 10944
+22.948352 1461.99 10944
+22.959232 1470.59 10880
+22.970112 1470.59 10880
+22.980992 1470.59 10880
+22.991872 1470.59 10880
+23.002752 1470.59 10880
+23.013632 1470.59 10880
+23.024512 1470.59 10880
+23.035392 1470.59 10880
+23.046208 1479.29 10816
+23.057024 1479.29 10816
+23.067840 1479.29 10816
+23.078656 1479.29 10816
+23.089472 1479.29 10816
+23.100288 1479.29 10816
+23.111104 1479.29 10816
+23.121920 1479.29 10816
+23.132736 1479.29 10816
+23.143552 1479.29 10816
+23.154368 1479.29 10816
+23.165184 1479.29 10816
+23.176000 1479.29 10816
+23.186816 1479.29 10816
+23.197632 1479.29 10816
+23.208448 1479.29 10816
+23.219200 1488.10 10752
+23.229952 1488.10 10752
+23.240704 1488.10 10752
+23.251456 1488.10 10752
+23.262208 1488.10 10752
+23.272960 1488.10 10752
+23.283712 1488.10 10752
+23.294464 1488.10 10752
+23.305152 1497.01 10688
+23.315840 1497.01 10688
+23.326528 1497.01 10688
+23.337216 1497.01 10688
+23.347904 1497.01 10688
+23.358592 1497.01 10688
+23.369280 1497.01 10688
+23.379968 1497.01 10688
+23.390656 1497.01 10688
+23.401344 1497.01 10688
+23.412032 1497.01 10688
+23.422720 1497.01 10688
+23.433408 1497.01 10688
+23.444096 1497.01 10688
+23.454784 1497.01 10688
+23.465472 1497.01 10688
+23.476096 1506.02 10624
+23.486720 1506.02 10624
+23.497344 1506.02 10624
+23.507968 1506.02 10624
+23.518592 1506.02 10624
+23.529216 1506.02 10624
+23.539840 1506.02 10624
+23.550464 1506.02 10624
+23.561024 1515.15 10560
+23.571584 1515.15 10560
+23.582144 1515.15 10560
+23.592704 1515.15 10560
+23.603264 1515.15 10560
+23.613824 1515.15 10560
+23.624384 1515.15 10560
+23.634944 1515.15 10560
+23.645504 1515.15 10560
+23.656064 1515.15 10560
+23.666624 1515.15 10560
+23.677184 1515.15 10560
+23.687744 1515.15 10560
+23.698304 1515.15 10560
+23.708864 1515.15 10560
+23.719424 1515.15 10560
+23.729920 1524.39 10496
+23.740416 1524.39 10496
+23.750912 1524.39 10496
+23.761408 1524.39 10496
+23.771904 1524.39 10496
+23.782400 1524.39 10496
+23.792896 1524.39 10496
+23.803392 1524.39 10496
+23.813824 1533.74 10432
+23.824256 1533.74 10432
+23.834688 1533.74 10432
+23.845120 1533.74 10432
+23.855552 1533.74 10432
+23.865984 1533.74 10432
+23.876416 1533.74 10432
+23.886848 1533.74 10432
+23.897280 1533.74 10432
+23.907712 1533.74 10432
+23.918144 1533.74 10432
+23.928576 1533.74 10432
+23.939008 1533.74 10432
+23.949440 1533.74 10432
+23.959872 1533.74 10432
+23.970304 1533.74 10432
+23.980736 1533.74 10432
+23.991168 1533.74 10432
+24.001600 1533.74 10432
+24.012032 1533.74 10432
+24.022464 1533.74 10432
+24.032896 1533.74 10432
+24.043328 1533.74 10432
+24.053760 1533.74 10432
+24.064128 1543.21 10368
+24.074496 1543.21 10368
+24.084864 1543.21 10368
+24.095232 1543.21 10368
+24.105600 1543.21 10368
+24.115968 1543.21 10368
+24.126336 1543.21 10368
+24.136704 1543.21 10368
+24.147072 1543.21 10368
+24.157440 1543.21 10368
+24.167808 1543.21 10368
+24.178176 1543.21 10368
+24.188544 1543.21 10368
+24.198912 1543.21 10368
+24.209280 1543.21 10368
+24.219648 1543.21 10368
+24.229952 1552.80 10304
+24.240256 1552.80 10304
+24.250560 1552.80 10304
+24.260864 1552.80 10304
+24.271168 1552.80 10304
+24.281472 1552.80 10304
+24.291776 1552.80 10304
+24.302080 1552.80 10304
+24.312384 1552.80 10304
+24.322688 1552.80 10304
+24.332992 1552.80 10304
+24.343296 1552.80 10304
+24.353600 1552.80 10304
+24.363904 1552.80 10304
+24.374208 1552.80 10304
+24.384512 1552.80 10304
+24.394752 1562.50 10240
+24.404992 1562.50 10240
+24.415232 1562.50 10240
+24.425472 1562.50 10240
+24.435712 1562.50 10240
+24.445952 1562.50 10240
+24.456192 1562.50 10240
+24.466432 1562.50 10240
+24.476608 1572.33 10176
+24.486784 1572.33 10176
+24.496960 1572.33 10176
+24.507136 1572.33 10176
+24.517312 1572.33 10176
+24.527488 1572.33 10176
+24.537664 1572.33 10176
+24.547840 1572.33 10176
+24.558016 1572.33 10176
+24.568192 1572.33 10176
+24.578368 1572.33 10176
+24.588544 1572.33 10176
+24.598720 1572.33 10176
+24.608896 1572.33 10176
+24.619072 1572.33 10176
+24.629248 1572.33 10176
+24.639360 1582.28 10112
+24.649472 1582.28 10112
+24.659584 1582.28 10112
+24.669696 1582.28 10112
+24.679808 1582.28 10112
+24.689920 1582.28 10112
+24.700032 1582.28 10112
+24.710144 1582.28 10112
+24.720256 1582.28 10112
+24.730368 1582.28 10112
+24.740480 1582.28 10112
+24.750592 1582.28 10112
+24.760704 1582.28 10112
+24.770816 1582.28 10112
+24.780928 1582.28 10112
+24.791040 1582.28 10112
+24.801088 1592.36 10048
+24.811136 1592.36 10048
+24.821184 1592.36 10048
+24.831232 1592.36 10048
+24.841280 1592.36 10048
+24.851328 1592.36 10048
+24.861376 1592.36 10048
+24.871424 1592.36 10048
+24.881472 1592.36 10048
+24.891520 1592.36 10048
+24.901568 1592.36 10048
+24.911616 1592.36 10048
+24.921664 1592.36 10048
+24.931712 1592.36 10048
+24.941760 1592.36 10048
+24.951808 1592.36 10048
+24.961856 1592.36 10048
+24.971904 1592.36 10048
+24.981952 1592.36 10048
+24.992000 1592.36 10048
+25.002048 1592.36 10048
+25.012096 1592.36 10048
+25.022144 1592.36 10048
+25.032192 1592.36 10048
+25.042176 1602.56 9984
+25.052160 1602.56 9984
+25.062144 1602.56 9984
+25.072128 1602.56 9984
+25.082112 1602.56 9984
+25.092096 1602.56 9984
+25.102080 1602.56 9984
+25.112064 1602.56 9984
+25.122048 1602.56 9984
+25.132032 1602.56 9984
+25.142016 1602.56 9984
+25.152000 1602.56 9984
+25.161984 1602.56 9984
+25.171968 1602.56 9984
+25.181952 1602.56 9984
+25.191936 1602.56 9984
+25.201856 1612.90 9920
+25.211776 1612.90 9920
+25.221696 1612.90 9920
+25.231616 1612.90 9920
+25.241536 1612.90 9920
+25.251456 1612.90 9920
+25.261376 1612.90 9920
+25.271296 1612.90 9920
+25.281216 1612.90 9920
+25.291136 1612.90 9920
+25.301056 1612.90 9920
+25.310976 1612.90 9920
+25.320896 1612.90 9920
+25.330816 1612.90 9920
+25.340736 1612.90 9920
+25.350656 1612.90 9920
+25.360512 1623.38 9856
+25.370368 1623.38 9856
+25.380224 1623.38 9856
+25.390080 1623.38 9856
+25.399936 1623.38 9856
+25.409792 1623.38 9856
+25.419648 1623.38 9856
+25.429504 1623.38 9856
+25.439296 1633.99 9792
+25.449088 1633.99 9792
+25.458880 1633.99 9792
+25.468672 1633.99 9792
+25.478464 1633.99 9792
+25.488256 1633.99 9792
+25.498048 1633.99 9792
+25.507840 1633.99 9792
+25.517632 1633.99 9792
+25.527424 1633.99 9792
+25.537216 1633.99 9792
+25.547008 1633.99 9792
+25.556800 1633.99 9792
+25.566592 1633.99 9792
+25.576384 1633.99 9792
+25.586176 1633.99 9792
+25.595904 1644.74 9728
+25.605632 1644.74 9728
+25.615360 1644.74 9728
+25.625088 1644.74 9728
+25.634816 1644.74 9728
+25.644544 1644.74 9728
+25.654272 1644.74 9728
+25.664000 1644.74 9728
+25.673728 1644.74 9728
+25.683456 1644.74 9728
+25.693184 1644.74 9728
+25.702912 1644.74 9728
+25.712640 1644.74 9728
+25.722368 1644.74 9728
+25.732096 1644.74 9728
+25.741824 1644.74 9728
+25.751552 1644.74 9728
+25.761280 1644.74 9728
+25.771008 1644.74 9728
+25.780736 1644.74 9728
+25.790464 1644.74 9728
+25.800192 1644.74 9728
+25.809920 1644.74 9728
+25.819648 1644.74 9728
+25.829376 1644.74 9728
+25.839104 1644.74 9728
+25.848832 1644.74 9728
+25.858560 1644.74 9728
+25.868288 1644.74 9728
+25.878016 1644.74 9728
+25.887744 1644.74 9728
+25.897472 1644.74 9728
+25.907136 1655.63 9664
+25.916800 1655.63 9664
+25.926464 1655.63 9664
+25.936128 1655.63 9664
+25.945792 1655.63 9664
+25.955456 1655.63 9664
+25.965120 1655.63 9664
+25.974784 1655.63 9664
+25.984448 1655.63 9664
+25.994112 1655.63 9664
+26.003776 1655.63 9664
+26.013440 1655.63 9664
+26.023104 1655.63 9664
+26.032768 1655.63 9664
+26.042432 1655.63 9664
+26.052096 1655.63 9664
+26.061696 1666.67 9600
+26.071296 1666.67 9600
+26.080896 1666.67 9600
+26.090496 1666.67 9600
+26.100096 1666.67 9600
+26.109696 1666.67 9600
+26.119296 1666.67 9600
+26.128896 1666.67 9600
+26.138496 1666.67 9600
+26.148096 1666.67 9600
+26.157696 1666.67 9600
+26.167296 1666.67 9600
+26.176896 1666.67 9600
+26.186496 1666.67 9600
+26.196096 1666.67 9600
+26.205696 1666.67 9600
+26.215232 1677.85 9536
+26.224768 1677.85 9536
+26.234304 1677.85 9536
+26.243840 1677.85 9536
+26.253376 1677.85 9536
+26.262912 1677.85 9536
+26.272448 1677.85 9536
+26.281984 1677.85 9536
+26.291456 1689.19 9472
+26.300928 1689.19 9472
+26.310400 1689.19 9472
+26.319872 1689.19 9472
+26.329344 1689.19 9472
+26.338816 1689.19 9472
+26.348288 1689.19 9472
+26.357760 1689.19 9472
+26.367232 1689.19 9472
+26.376704 1689.19 9472
+26.386176 1689.19 9472
+26.395648 1689.19 9472
+26.405120 1689.19 9472
+26.414592 1689.19 9472
+26.424064 1689.19 9472
+26.433536 1689.19 9472
+26.442944 1700.68 9408
+26.452352 1700.68 9408
+26.461760 1700.68 9408
+26.471168 1700.68 9408
+26.480576 1700.68 9408
+26.489984 1700.68 9408
+26.499392 1700.68 9408
+26.508800 1700.68 9408
+26.518208 1700.68 9408
+26.527616 1700.68 9408
+26.537024 1700.68 9408
+26.546432 1700.68 9408
+26.555840 1700.68 9408
+26.565248 1700.68 9408
+26.574656 1700.68 9408
+26.584064 1700.68 9408
+26.593472 1700.68 9408
+26.602880 1700.68 9408
+26.612288 1700.68 9408
+26.621696 1700.68 9408
+26.631104 1700.68 9408
+26.640512 1700.68 9408
+26.649920 1700.68 9408
+26.659328 1700.68 9408
+26.668736 1700.68 9408
+26.678144 1700.68 9408
+26.687552 1700.68 9408
+26.696960 1700.68 9408
+26.706368 1700.68 9408
+26.715776 1700.68 9408
+26.725184 1700.68 9408
+26.734592 1700.68 9408
+26.743936 1712.33 9344
+26.753280 1712.33 9344
+26.762624 1712.33 9344
+26.771968 1712.33 9344
+26.781312 1712.33 9344
+26.790656 1712.33 9344
+26.800000 1712.33 9344
+26.809344 1712.33 9344
+26.818688 1712.33 9344
+26.828032 1712.33 9344
+26.837376 1712.33 9344
+26.846720 1712.33 9344
+26.856064 1712.33 9344
+26.865408 1712.33 9344
+26.874752 1712.33 9344
+26.884096 1712.33 9344
+26.893376 1724.14 9280
+26.902656 1724.14 9280
+26.911936 1724.14 9280
+26.921216 1724.14 9280
+26.930496 1724.14 9280
+26.939776 1724.14 9280
+26.949056 1724.14 9280
+26.958336 1724.14 9280
+26.967616 1724.14 9280
+26.976896 1724.14 9280
+26.986176 1724.14 9280
+26.995456 1724.14 9280
+27.004736 1724.14 9280
+27.014016 1724.14 9280
+27.023296 1724.14 9280
+27.032576 1724.14 9280
+27.041792 1736.11 9216
+27.051008 1736.11 9216
+27.060224 1736.11 9216
+27.069440 1736.11 9216
+27.078656 1736.11 9216
+27.087872 1736.11 9216
+27.097088 1736.11 9216
+27.106304 1736.11 9216
+27.115520 1736.11 9216
+27.124736 1736.11 9216
+27.133952 1736.11 9216
+27.143168 1736.11 9216
+27.152384 1736.11 9216
+27.161600 1736.11 9216
+27.170816 1736.11 9216
+27.180032 1736.11 9216
+27.189248 1736.11 9216
+27.198464 1736.11 9216
+27.207680 1736.11 9216
+27.216896 1736.11 9216
+27.226112 1736.11 9216
+27.235328 1736.11 9216
+27.244544 1736.11 9216
+27.253760 1736.11 9216
+27.262976 1736.11 9216
+27.272192 1736.11 9216
+27.281408 1736.11 9216
+27.290624 1736.11 9216
+27.299840 1736.11 9216
+27.309056 1736.11 9216
+27.318272 1736.11 9216
+27.327488 1736.11 9216
+27.336640 1748.25 9152
+27.345792 1748.25 9152
+27.354944 1748.25 9152
+27.364096 1748.25 9152
+27.373248 1748.25 9152
+27.382400 1748.25 9152
+27.391552 1748.25 9152
+27.400704 1748.25 9152
+27.409856 1748.25 9152
+27.419008 1748.25 9152
+27.428160 1748.25 9152
+27.437312 1748.25 9152
+27.446464 1748.25 9152
+27.455616 1748.25 9152
+27.464768 1748.25 9152
+27.473920 1748.25 9152
+27.483008 1760.56 9088
+27.492096 1760.56 9088
+27.501184 1760.56 9088
+27.510272 1760.56 9088
+27.519360 1760.56 9088
+27.528448 1760.56 9088
+27.537536 1760.56 9088
+27.546624 1760.56 9088
+27.555712 1760.56 9088
+27.564800 1760.56 9088
+27.573888 1760.56 9088
+27.582976 1760.56 9088
+27.592064 1760.56 9088
+27.601152 1760.56 9088
+27.610240 1760.56 9088
+27.619328 1760.56 9088
+27.628352 1773.05 9024
+27.637376 1773.05 9024
+27.646400 1773.05 9024
+27.655424 1773.05 9024
+27.664448 1773.05 9024
+27.673472 1773.05 9024
+27.682496 1773.05 9024
+27.691520 1773.05 9024
+27.700544 1773.05 9024
+27.709568 1773.05 9024
+27.718592 1773.05 9024
+27.727616 1773.05 9024
+27.736640 1773.05 9024
+27.745664 1773.05 9024
+27.754688 1773.05 9024
+27.763712 1773.05 9024
+27.772736 1773.05 9024
+27.781760 1773.05 9024
+27.790784 1773.05 9024
+27.799808 1773.05 9024
+27.808832 1773.05 9024
+27.817856 1773.05 9024
+27.826880 1773.05 9024
+27.835904 1773.05 9024
+27.844864 1785.71 8960
+27.853824 1785.71 8960
+27.862784 1785.71 8960
+27.871744 1785.71 8960
+27.880704 1785.71 8960
+27.889664 1785.71 8960
+27.898624 1785.71 8960
+27.907584 1785.71 8960
+27.916544 1785.71 8960
+27.925504 1785.71 8960
+27.934464 1785.71 8960
+27.943424 1785.71 8960
+27.952384 1785.71 8960
+27.961344 1785.71 8960
+27.970304 1785.71 8960
+27.979264 1785.71 8960
+27.988224 1785.71 8960
+27.997184 1785.71 8960
+28.006144 1785.71 8960
+28.015104 1785.71 8960
+28.024064 1785.71 8960
+28.033024 1785.71 8960
+28.041984 1785.71 8960
+28.050944 1785.71 8960
+28.059904 1785.71 8960
+28.068864 1785.71 8960
+28.077824 1785.71 8960
+28.086784 1785.71 8960
+28.095744 1785.71 8960
+28.104704 1785.71 8960
+28.113664 1785.71 8960
+28.122624 1785.71 8960
+28.131520 1798.56 8896
+28.140416 1798.56 8896
+28.149312 1798.56 8896
+28.158208 1798.56 8896
+28.167104 1798.56 8896
+28.176000 1798.56 8896
+28.184896 1798.56 8896
+28.193792 1798.56 8896
+28.202688 1798.56 8896
+28.211584 1798.56 8896
+28.220480 1798.56 8896
+28.229376 1798.56 8896
+28.238272 1798.56 8896
+28.247168 1798.56 8896
+28.256064 1798.56 8896
+28.264960 1798.56 8896
+28.273792 1811.59 8832
+28.282624 1811.59 8832
+28.291456 1811.59 8832
+28.300288 1811.59 8832
+28.309120 1811.59 8832
+28.317952 1811.59 8832
+28.326784 1811.59 8832
+28.335616 1811.59 8832
+28.344448 1811.59 8832
+28.353280 1811.59 8832
+28.362112 1811.59 8832
+28.370944 1811.59 8832
+28.379776 1811.59 8832
+28.388608 1811.59 8832
+28.397440 1811.59 8832
+28.406272 1811.59 8832
+28.415040 1824.82 8768
+28.423808 1824.82 8768
+28.432576 1824.82 8768
+28.441344 1824.82 8768
+28.450112 1824.82 8768
+28.458880 1824.82 8768
+28.467648 1824.82 8768
+28.476416 1824.82 8768
+28.485184 1824.82 8768
+28.493952 1824.82 8768
+28.502720 1824.82 8768
+28.511488 1824.82 8768
+28.520256 1824.82 8768
+28.529024 1824.82 8768
+28.537792 1824.82 8768
+28.546560 1824.82 8768
+28.555328 1824.82 8768
+28.564096 1824.82 8768
+28.572864 1824.82 8768
+28.581632 1824.82 8768
+28.590400 1824.82 8768
+28.599168 1824.82 8768
+28.607936 1824.82 8768
+28.616704 1824.82 8768
+28.625472 1824.82 8768
+28.634240 1824.82 8768
+28.643008 1824.82 8768
+28.651776 1824.82 8768
+28.660544 1824.82 8768
+28.669312 1824.82 8768
+28.678080 1824.82 8768
+28.686848 1824.82 8768
+28.695616 1824.82 8768
+28.704384 1824.82 8768
+28.713152 1824.82 8768
+28.721920 1824.82 8768
+28.730688 1824.82 8768
+28.739456 1824.82 8768
+28.748224 1824.82 8768
+28.756992 1824.82 8768
+28.765696 1838.24 8704
+28.774400 1838.24 8704
+28.783104 1838.24 8704
+28.791808 1838.24 8704
+28.800512 1838.24 8704
+28.809216 1838.24 8704
+28.817920 1838.24 8704
+28.826624 1838.24 8704
+28.835328 1838.24 8704
+28.844032 1838.24 8704
+28.852736 1838.24 8704
+28.861440 1838.24 8704
+28.870144 1838.24 8704
+28.878848 1838.24 8704
+28.887552 1838.24 8704
+28.896256 1838.24 8704
+28.904896 1851.85 8640
+28.913536 1851.85 8640
+28.922176 1851.85 8640
+28.930816 1851.85 8640
+28.939456 1851.85 8640
+28.948096 1851.85 8640
+28.956736 1851.85 8640
+28.965376 1851.85 8640
+28.974016 1851.85 8640
+28.982656 1851.85 8640
+28.991296 1851.85 8640
+28.999936 1851.85 8640
+29.008576 1851.85 8640
+29.017216 1851.85 8640
+29.025856 1851.85 8640
+29.034496 1851.85 8640
+29.043136 1851.85 8640
+29.051776 1851.85 8640
+29.060416 1851.85 8640
+29.069056 1851.85 8640
+29.077696 1851.85 8640
+29.086336 1851.85 8640
+29.094976 1851.85 8640
+29.103616 1851.85 8640
+29.112256 1851.85 8640
+29.120896 1851.85 8640
+29.129536 1851.85 8640
+29.138176 1851.85 8640
+29.146816 1851.85 8640
+29.155456 1851.85 8640
+29.164096 1851.85 8640
+29.172736 1851.85 8640
+29.181376 1851.85 8640
+29.190016 1851.85 8640
+29.198656 1851.85 8640
+29.207296 1851.85 8640
+29.215936 1851.85 8640
+29.224576 1851.85 8640
+29.233216 1851.85 8640
+29.241856 1851.85 8640
+29.250432 1865.67 8576
+29.259008 1865.67 8576
+29.267584 1865.67 8576
+29.276160 1865.67 8576
+29.284736 1865.67 8576
+29.293312 1865.67 8576
+29.301888 1865.67 8576
+29.310464 1865.67 8576
+29.319040 1865.67 8576
+29.327616 1865.67 8576
+29.336192 1865.67 8576
+29.344768 1865.67 8576
+29.353344 1865.67 8576
+29.361920 1865.67 8576
+29.370496 1865.67 8576
+29.379072 1865.67 8576
+29.387584 1879.70 8512
+29.396096 1879.70 8512
+29.404608 1879.70 8512
+29.413120 1879.70 8512
+29.421632 1879.70 8512
+29.430144 1879.70 8512
+29.438656 1879.70 8512
+29.447168 1879.70 8512
+29.455680 1879.70 8512
+29.464192 1879.70 8512
+29.472704 1879.70 8512
+29.481216 1879.70 8512
+29.489728 1879.70 8512
+29.498240 1879.70 8512
+29.506752 1879.70 8512
+29.515264 1879.70 8512
+29.523712 1893.94 8448
+29.532160 1893.94 8448
+29.540608 1893.94 8448
+29.549056 1893.94 8448
+29.557504 1893.94 8448
+29.565952 1893.94 8448
+29.574400 1893.94 8448
+29.582848 1893.94 8448
+29.591296 1893.94 8448
+29.599744 1893.94 8448
+29.608192 1893.94 8448
+29.616640 1893.94 8448
+29.625088 1893.94 8448
+29.633536 1893.94 8448
+29.641984 1893.94 8448
+29.650432 1893.94 8448
+29.658880 1893.94 8448
+29.667328 1893.94 8448
+29.675776 1893.94 8448
+29.684224 1893.94 8448
+29.692672 1893.94 8448
+29.701120 1893.94 8448
+29.709568 1893.94 8448
+29.718016 1893.94 8448
+29.726464 1893.94 8448
+29.734912 1893.94 8448
+29.743360 1893.94 8448
+29.751808 1893.94 8448
+29.760256 1893.94 8448
+29.768704 1893.94 8448
+29.777152 1893.94 8448
+29.785600 1893.94 8448
+29.794048 1893.94 8448
+29.802496 1893.94 8448
+29.810944 1893.94 8448
+29.819392 1893.94 8448
+29.827840 1893.94 8448
+29.836288 1893.94 8448
+29.844736 1893.94 8448
+29.853184 1893.94 8448
+29.861568 1908.40 8384
+29.869952 1908.40 8384
+29.878336 1908.40 8384
+29.886720 1908.40 8384
+29.895104 1908.40 8384
+29.903488 1908.40 8384
+29.911872 1908.40 8384
+29.920256 1908.40 8384
+29.928640 1908.40 8384
+29.937024 1908.40 8384
+29.945408 1908.40 8384
+29.953792 1908.40 8384
+29.962176 1908.40 8384
+29.970560 1908.40 8384
+29.978944 1908.40 8384
+29.987328 1908.40 8384
+29.995712 1908.40 8384
+30.004096 1908.40 8384
+30.012480 1908.40 8384
+30.020864 1908.40 8384
+30.029248 1908.40 8384
+30.037632 1908.40 8384
+30.046016 1908.40 8384
+30.054400 1908.40 8384
+30.062720 1923.08 8320
+30.071040 1923.08 8320
+30.079360 1923.08 8320
+30.087680 1923.08 8320
+30.096000 1923.08 8320
+30.104320 1923.08 8320
+30.112640 1923.08 8320
+30.120960 1923.08 8320
+30.129280 1923.08 8320
+30.137600 1923.08 8320
+30.145920 1923.08 8320
+30.154240 1923.08 8320
+30.162560 1923.08 8320
+30.170880 1923.08 8320
+30.179200 1923.08 8320
+30.187520 1923.08 8320
+30.195776 1937.98 8256
+30.204032 1937.98 8256
+30.212288 1937.98 8256
+30.220544 1937.98 8256
+30.228800 1937.98 8256
+30.237056 1937.98 8256
+30.245312 1937.98 8256
+30.253568 1937.98 8256
+30.261824 1937.98 8256
+30.270080 1937.98 8256
+30.278336 1937.98 8256
+30.286592 1937.98 8256
+30.294848 1937.98 8256
+30.303104 1937.98 8256
+30.311360 1937.98 8256
+30.319616 1937.98 8256
+30.327872 1937.98 8256
+30.336128 1937.98 8256
+30.344384 1937.98 8256
+30.352640 1937.98 8256
+30.360896 1937.98 8256
+30.369152 1937.98 8256
+30.377408 1937.98 8256
+30.385664 1937.98 8256
+30.393920 1937.98 8256
+30.402176 1937.98 8256
+30.410432 1937.98 8256
+30.418688 1937.98 8256
+30.426944 1937.98 8256
+30.435200 1937.98 8256
+30.443456 1937.98 8256
+30.451712 1937.98 8256
+30.459968 1937.98 8256
+30.468224 1937.98 8256
+30.476480 1937.98 8256
+30.484736 1937.98 8256
+30.492992 1937.98 8256
+30.501248 1937.98 8256
+30.509504 1937.98 8256
+30.517760 1937.98 8256
+30.525952 1953.12 8192
+30.534144 1953.12 8192
+30.542336 1953.12 8192
+30.550528 1953.12 8192
+30.558720 1953.12 8192
+30.566912 1953.12 8192
+30.575104 1953.12 8192
+30.583296 1953.12 8192
+30.591488 1953.12 8192
+30.599680 1953.12 8192
+30.607872 1953.12 8192
+30.616064 1953.12 8192
+30.624256 1953.12 8192
+30.632448 1953.12 8192
+30.640640 1953.12 8192
+30.648832 1953.12 8192
+30.657024 1953.12 8192
+30.665216 1953.12 8192
+30.673408 1953.12 8192
+30.681600 1953.12 8192
+30.689792 1953.12 8192
+30.697984 1953.12 8192
+30.706176 1953.12 8192
+30.714368 1953.12 8192
+30.722528 1960.78 8160
+30.730688 1960.78 8160
+30.738848 1960.78 8160
+30.747008 1960.78 8160
+30.755168 1960.78 8160
+30.763328 1960.78 8160
+30.771488 1960.78 8160
+30.779648 1960.78 8160
+30.787808 1960.78 8160
+30.795968 1960.78 8160
+30.804128 1960.78 8160
+30.812288 1960.78 8160
+30.820448 1960.78 8160
+30.828608 1960.78 8160
+30.836768 1960.78 8160
+30.844928 1960.78 8160
+30.853056 1968.50 8128
+30.861184 1968.50 8128
+30.869312 1968.50 8128
+30.877440 1968.50 8128
+30.885568 1968.50 8128
+30.893696 1968.50 8128
+30.901824 1968.50 8128
+30.909952 1968.50 8128
+30.918080 1968.50 8128
+30.926208 1968.50 8128
+30.934336 1968.50 8128
+30.942464 1968.50 8128
+30.950592 1968.50 8128
+30.958720 1968.50 8128
+30.966848 1968.50 8128
+30.974976 1968.50 8128
+30.983104 1968.50 8128
+30.991232 1968.50 8128
+30.999360 1968.50 8128
+31.007488 1968.50 8128
+31.015616 1968.50 8128
+31.023744 1968.50 8128
+31.031872 1968.50 8128
+31.040000 1968.50 8128
+31.048064 1984.13 8064
+31.056128 1984.13 8064
+31.064192 1984.13 8064
+31.072256 1984.13 8064
+31.080320 1984.13 8064
+31.088384 1984.13 8064
+31.096448 1984.13 8064
+31.104512 1984.13 8064
+31.112576 1984.13 8064
+31.120640 1984.13 8064
+31.128704 1984.13 8064
+31.136768 1984.13 8064
+31.144832 1984.13 8064
+31.152896 1984.13 8064
+31.160960 1984.13 8064
+31.169024 1984.13 8064
+31.177088 1984.13 8064
+31.185152 1984.13 8064
+31.193216 1984.13 8064
+31.201280 1984.13 8064
+31.209344 1984.13 8064
+31.217408 1984.13 8064
+31.225472 1984.13 8064
+31.233536 1984.13 8064
+31.241568 1992.03 8032
+31.249600 1992.03 8032
+31.257632 1992.03 8032
+31.265664 1992.03 8032
+31.273696 1992.03 8032
+31.281728 1992.03 8032
+31.289760 1992.03 8032
+31.297792 1992.03 8032
+31.305824 1992.03 8032
+31.313856 1992.03 8032
+31.321888 1992.03 8032
+31.329920 1992.03 8032
+31.337952 1992.03 8032
+31.345984 1992.03 8032
+31.354016 1992.03 8032
+31.362048 1992.03 8032
+31.370048 2000.00 8000
+31.386048 2000.00 8000
+31.402048 2000.00 8000
+31.418048 2000.00 8000
+31.434048 2000.00 8000
+31.450048 2000.00 8000
+31.466048 2000.00 8000
+31.482048 2000.00 8000
+31.498048 2000.00 8000
+31.514048 2000.00 8000
+31.530048 2000.00 8000
+31.546048 2000.00 8000
+31.561920 2016.13 7936
+31.577792 2016.13 7936
+31.593664 2016.13 7936
+31.609536 2016.13 7936
+31.625408 2016.13 7936
+31.641280 2016.13 7936
+31.657152 2016.13 7936
+31.673024 2016.13 7936
+31.688896 2016.13 7936
+31.704768 2016.13 7936
+31.720640 2016.13 7936
+31.736512 2016.13 7936
+31.752320 2024.29 7904
+31.768128 2024.29 7904
+31.783936 2024.29 7904
+31.799744 2024.29 7904
+31.815552 2024.29 7904
+31.831360 2024.29 7904
+31.847168 2024.29 7904
+31.862976 2024.29 7904
+31.878784 2024.29 7904
+31.894592 2024.29 7904
+31.910400 2024.29 7904
+31.926208 2024.29 7904
+31.941952 2032.52 7872
+31.957696 2032.52 7872
+31.973440 2032.52 7872
+31.989184 2032.52 7872
+32.004928 2032.52 7872
+32.020672 2032.52 7872
+32.036416 2032.52 7872
+32.052160 2032.52 7872
+32.067776 2049.18 7808
+32.083392 2049.18 7808
+32.099008 2049.18 7808
+32.114624 2049.18 7808
+32.130240 2049.18 7808
+32.145856 2049.18 7808
+32.161472 2049.18 7808
+32.177088 2049.18 7808
+32.192704 2049.18 7808
+32.208320 2049.18 7808
+32.223936 2049.18 7808
+32.239552 2049.18 7808
+32.255168 2049.18 7808
+32.270784 2049.18 7808
+32.286400 2049.18 7808
+32.302016 2049.18 7808
+32.317568 2057.61 7776
+32.333120 2057.61 7776
+32.348672 2057.61 7776
+32.364224 2057.61 7776
+32.379776 2057.61 7776
+32.395328 2057.61 7776
+32.410880 2057.61 7776
+32.426432 2057.61 7776
+32.441920 2066.12 7744
+32.457408 2066.12 7744
+32.472896 2066.12 7744
+32.488384 2066.12 7744
+32.503872 2066.12 7744
+32.519360 2066.12 7744
+32.534848 2066.12 7744
+32.550336 2066.12 7744
+32.565824 2066.12 7744
+32.581312 2066.12 7744
+32.596800 2066.12 7744
+32.612288 2066.12 7744
+32.627776 2066.12 7744
+32.643264 2066.12 7744
+32.658752 2066.12 7744
+32.674240 2066.12 7744
+32.689600 2083.33 7680
+32.704960 2083.33 7680
+32.720320 2083.33 7680
+32.735680 2083.33 7680
+32.751040 2083.33 7680
+32.766400 2083.33 7680
+32.781760 2083.33 7680
+32.797120 2083.33 7680
+32.812416 2092.05 7648
+32.827712 2092.05 7648
+32.843008 2092.05 7648
+32.858304 2092.05 7648
+32.873600 2092.05 7648
+32.888896 2092.05 7648
+32.904192 2092.05 7648
+32.919488 2092.05 7648
+32.934784 2092.05 7648
+32.950080 2092.05 7648
+32.965376 2092.05 7648
+32.980672 2092.05 7648
+32.995968 2092.05 7648
+33.011264 2092.05 7648
+33.026560 2092.05 7648
+33.041856 2092.05 7648
+33.057088 2100.84 7616
+33.072320 2100.84 7616
+33.087552 2100.84 7616
+33.102784 2100.84 7616
+33.118016 2100.84 7616
+33.133248 2100.84 7616
+33.148480 2100.84 7616
+33.163712 2100.84 7616
+33.178816 2118.64 7552
+33.193920 2118.64 7552
+33.209024 2118.64 7552
+33.224128 2118.64 7552
+33.239232 2118.64 7552
+33.254336 2118.64 7552
+33.269440 2118.64 7552
+33.284544 2118.64 7552
+33.299648 2118.64 7552
+33.314752 2118.64 7552
+33.329856 2118.64 7552
+33.344960 2118.64 7552
+33.360064 2118.64 7552
+33.375168 2118.64 7552
+33.390272 2118.64 7552
+33.405376 2118.64 7552
+33.420416 2127.66 7520
+33.435456 2127.66 7520
+33.450496 2127.66 7520
+33.465536 2127.66 7520
+33.480576 2127.66 7520
+33.495616 2127.66 7520
+33.510656 2127.66 7520
+33.525696 2127.66 7520
+33.540672 2136.75 7488
+33.555648 2136.75 7488
+33.570624 2136.75 7488
+33.585600 2136.75 7488
+33.600576 2136.75 7488
+33.615552 2136.75 7488
+33.630528 2136.75 7488
+33.645504 2136.75 7488
+33.660480 2136.75 7488
+33.675456 2136.75 7488
+33.690432 2136.75 7488
+33.705408 2136.75 7488
+33.720384 2136.75 7488
+33.735360 2136.75 7488
+33.750336 2136.75 7488
+33.765312 2136.75 7488
+33.780224 2145.92 7456
+33.795136 2145.92 7456
+33.810048 2145.92 7456
+33.824960 2145.92 7456
+33.839872 2145.92 7456
+33.854784 2145.92 7456
+33.869696 2145.92 7456
+33.884608 2145.92 7456
+33.899392 2164.50 7392
+33.914176 2164.50 7392
+33.928960 2164.50 7392
+33.943744 2164.50 7392
+33.958528 2164.50 7392
+33.973312 2164.50 7392
+33.988096 2164.50 7392
+34.002880 2164.50 7392
+34.017664 2164.50 7392
+34.032448 2164.50 7392
+34.047232 2164.50 7392
+34.062016 2164.50 7392
+34.076800 2164.50 7392
+34.091584 2164.50 7392
+34.106368 2164.50 7392
+34.121152 2164.50 7392
+34.135872 2173.91 7360
+34.150592 2173.91 7360
+34.165312 2173.91 7360
+34.180032 2173.91 7360
+34.194752 2173.91 7360
+34.209472 2173.91 7360
+34.224192 2173.91 7360
+34.238912 2173.91 7360
+34.253568 2183.41 7328
+34.268224 2183.41 7328
+34.282880 2183.41 7328
+34.297536 2183.41 7328
+34.312192 2183.41 7328
+34.326848 2183.41 7328
+34.341504 2183.41 7328
+34.356160 2183.41 7328
+34.370816 2183.41 7328
+34.385472 2183.41 7328
+34.400128 2183.41 7328
+34.414784 2183.41 7328
+34.429440 2183.41 7328
+34.444096 2183.41 7328
+34.458752 2183.41 7328
+34.473408 2183.41 7328
+34.488000 2192.98 7296
+34.502592 2192.98 7296
+34.517184 2192.98 7296
+34.531776 2192.98 7296
+34.546368 2192.98 7296
+34.560960 2192.98 7296
+34.575552 2192.98 7296
+34.590144 2192.98 7296
+34.604736 2192.98 7296
+34.619328 2192.98 7296
+34.633920 2192.98 7296
+34.648512 2192.98 7296
+34.663104 2192.98 7296
+34.677696 2192.98 7296
+34.692288 2192.98 7296
+34.706880 2192.98 7296
+34.721344 2212.39 7232
+34.735808 2212.39 7232
+34.750272 2212.39 7232
+34.764736 2212.39 7232
+34.779200 2212.39 7232
+34.793664 2212.39 7232
+34.808128 2212.39 7232
+34.822592 2212.39 7232
+34.836992 2222.22 7200
+34.851392 2222.22 7200
+34.865792 2222.22 7200
+34.880192 2222.22 7200
+34.894592 2222.22 7200
+34.908992 2222.22 7200
+34.923392 2222.22 7200
+34.937792 2222.22 7200
+34.952192 2222.22 7200
+34.966592 2222.22 7200
+34.980992 2222.22 7200
+34.995392 2222.22 7200
+35.009792 2222.22 7200
+35.024192 2222.22 7200
+35.038592 2222.22 7200
+35.052992 2222.22 7200
+35.067328 2232.14 7168
+35.081664 2232.14 7168
+35.096000 2232.14 7168
+35.110336 2232.14 7168
+35.124672 2232.14 7168
+35.139008 2232.14 7168
+35.153344 2232.14 7168
+35.167680 2232.14 7168
+35.182016 2232.14 7168
+35.196352 2232.14 7168
+35.210688 2232.14 7168
+35.225024 2232.14 7168
+35.239360 2232.14 7168
+35.253696 2232.14 7168
+35.268032 2232.14 7168
+35.282368 2232.14 7168
+35.296640 2242.15 7136
+35.310912 2242.15 7136
+35.325184 2242.15 7136
+35.339456 2242.15 7136
+35.353728 2242.15 7136
+35.368000 2242.15 7136
+35.382272 2242.15 7136
+35.396544 2242.15 7136
+35.410688 2262.44 7072
+35.424832 2262.44 7072
+35.438976 2262.44 7072
+35.453120 2262.44 7072
+35.467264 2262.44 7072
+35.481408 2262.44 7072
+35.495552 2262.44 7072
+35.509696 2262.44 7072
+35.523840 2262.44 7072
+35.537984 2262.44 7072
+35.552128 2262.44 7072
+35.566272 2262.44 7072
+35.580416 2262.44 7072
+35.594560 2262.44 7072
+35.608704 2262.44 7072
+35.622848 2262.44 7072
+35.636928 2272.73 7040
+35.651008 2272.73 7040
+35.665088 2272.73 7040
+35.679168 2272.73 7040
+35.693248 2272.73 7040
+35.707328 2272.73 7040
+35.721408 2272.73 7040
+35.735488 2272.73 7040
+35.749568 2272.73 7040
+35.763648 2272.73 7040
+35.777728 2272.73 7040
+35.791808 2272.73 7040
+35.805888 2272.73 7040
+35.819968 2272.73 7040
+35.834048 2272.73 7040
+35.848128 2272.73 7040
+35.862144 2283.11 7008
+35.876160 2283.11 7008
+35.890176 2283.11 7008
+35.904192 2283.11 7008
+35.918208 2283.11 7008
+35.932224 2283.11 7008
+35.946240 2283.11 7008
+35.960256 2283.11 7008
+35.974272 2283.11 7008
+35.988288 2283.11 7008
+36.002304 2283.11 7008
+36.016320 2283.11 7008
+36.030336 2283.11 7008
+36.044352 2283.11 7008
+36.058368 2283.11 7008
+36.072384 2283.11 7008
+36.086336 2293.58 6976
+36.100288 2293.58 6976
+36.114240 2293.58 6976
+36.128192 2293.58 6976
+36.142144 2293.58 6976
+36.156096 2293.58 6976
+36.170048 2293.58 6976
+36.184000 2293.58 6976
+36.197888 2304.15 6944
+36.211776 2304.15 6944
+36.225664 2304.15 6944
+36.239552 2304.15 6944
+36.253440 2304.15 6944
+36.267328 2304.15 6944
+36.281216 2304.15 6944
+36.295104 2304.15 6944
+36.308992 2304.15 6944
+36.322880 2304.15 6944
+36.336768 2304.15 6944
+36.350656 2304.15 6944
+36.364544 2304.15 6944
+36.378432 2304.15 6944
+36.392320 2304.15 6944
+36.406208 2304.15 6944
+36.420032 2314.81 6912
+36.433856 2314.81 6912
+36.447680 2314.81 6912
+36.461504 2314.81 6912
+36.475328 2314.81 6912
+36.489152 2314.81 6912
+36.502976 2314.81 6912
+36.516800 2314.81 6912
+36.530624 2314.81 6912
+36.544448 2314.81 6912
+36.558272 2314.81 6912
+36.572096 2314.81 6912
+36.585920 2314.81 6912
+36.599744 2314.81 6912
+36.613568 2314.81 6912
+36.627392 2314.81 6912
+36.641088 2336.45 6848
+36.654784 2336.45 6848
+36.668480 2336.45 6848
+36.682176 2336.45 6848
+36.695872 2336.45 6848
+36.709568 2336.45 6848
+36.723264 2336.45 6848
+36.736960 2336.45 6848
+36.750656 2336.45 6848
+36.764352 2336.45 6848
+36.778048 2336.45 6848
+36.791744 2336.45 6848
+36.805440 2336.45 6848
+36.819136 2336.45 6848
+36.832832 2336.45 6848
+36.846528 2336.45 6848
+36.860160 2347.42 6816
+36.873792 2347.42 6816
+36.887424 2347.42 6816
+36.901056 2347.42 6816
+36.914688 2347.42 6816
+36.928320 2347.42 6816
+36.941952 2347.42 6816
+36.955584 2347.42 6816
+36.969216 2347.42 6816
+36.982848 2347.42 6816
+36.996480 2347.42 6816
+37.010112 2347.42 6816
+37.023744 2347.42 6816
+37.037376 2347.42 6816
+37.051008 2347.42 6816
+37.064640 2347.42 6816
+37.078208 2358.49 6784
+37.091776 2358.49 6784
+37.105344 2358.49 6784
+37.118912 2358.49 6784
+37.132480 2358.49 6784
+37.146048 2358.49 6784
+37.159616 2358.49 6784
+37.173184 2358.49 6784
+37.186752 2358.49 6784
+37.200320 2358.49 6784
+37.213888 2358.49 6784
+37.227456 2358.49 6784
+37.241024 2358.49 6784
+37.254592 2358.49 6784
+37.268160 2358.49 6784
+37.281728 2358.49 6784
+37.295232 2369.67 6752
+37.308736 2369.67 6752
+37.322240 2369.67 6752
+37.335744 2369.67 6752
+37.349248 2369.67 6752
+37.362752 2369.67 6752
+37.376256 2369.67 6752
+37.389760 2369.67 6752
+37.403200 2380.95 6720
+37.416640 2380.95 6720
+37.430080 2380.95 6720
+37.443520 2380.95 6720
+37.456960 2380.95 6720
+37.470400 2380.95 6720
+37.483840 2380.95 6720
+37.497280 2380.95 6720
+37.510720 2380.95 6720
+37.524160 2380.95 6720
+37.537600 2380.95 6720
+37.551040 2380.95 6720
+37.564480 2380.95 6720
+37.577920 2380.95 6720
+37.591360 2380.95 6720
+37.604800 2380.95 6720
+37.618176 2392.34 6688
+37.631552 2392.34 6688
+37.644928 2392.34 6688
+37.658304 2392.34 6688
+37.671680 2392.34 6688
+37.685056 2392.34 6688
+37.698432 2392.34 6688
+37.711808 2392.34 6688
+37.725184 2392.34 6688
+37.738560 2392.34 6688
+37.751936 2392.34 6688
+37.765312 2392.34 6688
+37.778688 2392.34 6688
+37.792064 2392.34 6688
+37.805440 2392.34 6688
+37.818816 2392.34 6688
+37.832128 2403.85 6656
+37.845440 2403.85 6656
+37.858752 2403.85 6656
+37.872064 2403.85 6656
+37.885376 2403.85 6656
+37.898688 2403.85 6656
+37.912000 2403.85 6656
+37.925312 2403.85 6656
+37.938624 2403.85 6656
+37.951936 2403.85 6656
+37.965248 2403.85 6656
+37.978560 2403.85 6656
+37.991872 2403.85 6656
+38.005184 2403.85 6656
+38.018496 2403.85 6656
+38.031808 2403.85 6656
+38.044992 2427.18 6592
+38.058176 2427.18 6592
+38.071360 2427.18 6592
+38.084544 2427.18 6592
+38.097728 2427.18 6592
+38.110912 2427.18 6592
+38.124096 2427.18 6592
+38.137280 2427.18 6592
+38.150464 2427.18 6592
+38.163648 2427.18 6592
+38.176832 2427.18 6592
+38.190016 2427.18 6592
+38.203200 2427.18 6592
+38.216384 2427.18 6592
+38.229568 2427.18 6592
+38.242752 2427.18 6592
+38.255872 2439.02 6560
+38.268992 2439.02 6560
+38.282112 2439.02 6560
+38.295232 2439.02 6560
+38.308352 2439.02 6560
+38.321472 2439.02 6560
+38.334592 2439.02 6560
+38.347712 2439.02 6560
+38.360832 2439.02 6560
+38.373952 2439.02 6560
+38.387072 2439.02 6560
+38.400192 2439.02 6560
+38.413312 2439.02 6560
+38.426432 2439.02 6560
+38.439552 2439.02 6560
+38.452672 2439.02 6560
+38.465728 2450.98 6528
+38.478784 2450.98 6528
+38.491840 2450.98 6528
+38.504896 2450.98 6528
+38.517952 2450.98 6528
+38.531008 2450.98 6528
+38.544064 2450.98 6528
+38.557120 2450.98 6528
+38.570176 2450.98 6528
+38.583232 2450.98 6528
+38.596288 2450.98 6528
+38.609344 2450.98 6528
+38.622400 2450.98 6528
+38.635456 2450.98 6528
+38.648512 2450.98 6528
+38.661568 2450.98 6528
+38.674560 2463.05 6496
+38.687552 2463.05 6496
+38.700544 2463.05 6496
+38.713536 2463.05 6496
+38.726528 2463.05 6496
+38.739520 2463.05 6496
+38.752512 2463.05 6496
+38.765504 2463.05 6496
+38.778496 2463.05 6496
+38.791488 2463.05 6496
+38.804480 2463.05 6496
+38.817472 2463.05 6496
+38.830464 2463.05 6496
+38.843456 2463.05 6496
+38.856448 2463.05 6496
+38.869440 2463.05 6496
+38.882368 2475.25 6464
+38.895296 2475.25 6464
+38.908224 2475.25 6464
+38.921152 2475.25 6464
+38.934080 2475.25 6464
+38.947008 2475.25 6464
+38.959936 2475.25 6464
+38.972864 2475.25 6464
+38.985792 2475.25 6464
+38.998720 2475.25 6464
+39.011648 2475.25 6464
+39.024576 2475.25 6464
+39.037504 2475.25 6464
+39.050432 2475.25 6464
+39.063360 2475.25 6464
+39.076288 2475.25 6464
+39.089152 2487.56 6432
+39.102016 2487.56 6432
+39.114880 2487.56 6432
+39.127744 2487.56 6432
+39.140608 2487.56 6432
+39.153472 2487.56 6432
+39.166336 2487.56 6432
+39.179200 2487.56 6432
+39.192064 2487.56 6432
+39.204928 2487.56 6432
+39.217792 2487.56 6432
+39.230656 2487.56 6432
+39.243520 2487.56 6432
+39.256384 2487.56 6432
+39.269248 2487.56 6432
+39.282112 2487.56 6432
+39.294912 2500.00 6400
+39.307712 2500.00 6400
+39.320512 2500.00 6400
+39.333312 2500.00 6400
+39.346112 2500.00 6400
+39.358912 2500.00 6400
+39.371712 2500.00 6400
+39.384512 2500.00 6400
+39.397312 2500.00 6400
+39.410112 2500.00 6400
+39.422912 2500.00 6400
+39.435712 2500.00 6400
+39.448512 2500.00 6400
+39.461312 2500.00 6400
+39.474112 2500.00 6400
+39.486912 2500.00 6400
+39.499712 2500.00 6400
+39.512512 2500.00 6400
+39.525312 2500.00 6400
+39.538112 2500.00 6400
+39.550912 2500.00 6400
+39.563712 2500.00 6400
+39.576512 2500.00 6400
+39.589312 2500.00 6400
+39.602048 2512.56 6368
+39.614784 2512.56 6368
+39.627520 2512.56 6368
+39.640256 2512.56 6368
+39.652992 2512.56 6368
+39.665728 2512.56 6368
+39.678464 2512.56 6368
+39.691200 2512.56 6368
+39.703936 2512.56 6368
+39.716672 2512.56 6368
+39.729408 2512.56 6368
+39.742144 2512.56 6368
+39.754880 2512.56 6368
+39.767616 2512.56 6368
+39.780352 2512.56 6368
+39.793088 2512.56 6368
+39.805760 2525.25 6336
+39.818432 2525.25 6336
+39.831104 2525.25 6336
+39.843776 2525.25 6336
+39.856448 2525.25 6336
+39.869120 2525.25 6336
+39.881792 2525.25 6336
+39.894464 2525.25 6336
+39.907136 2525.25 6336
+39.919808 2525.25 6336
+39.932480 2525.25 6336
+39.945152 2525.25 6336
+39.957824 2525.25 6336
+39.970496 2525.25 6336
+39.983168 2525.25 6336
+39.995840 2525.25 6336
+40.008448 2538.07 6304
+40.021056 2538.07 6304
+40.033664 2538.07 6304
+40.046272 2538.07 6304
+40.058880 2538.07 6304
+40.071488 2538.07 6304
+40.084096 2538.07 6304
+40.096704 2538.07 6304
+40.109312 2538.07 6304
+40.121920 2538.07 6304
+40.134528 2538.07 6304
+40.147136 2538.07 6304
+40.159744 2538.07 6304
+40.172352 2538.07 6304
+40.184960 2538.07 6304
+40.197568 2538.07 6304
+40.210112 2551.02 6272
+40.222656 2551.02 6272
+40.235200 2551.02 6272
+40.247744 2551.02 6272
+40.260288 2551.02 6272
+40.272832 2551.02 6272
+40.285376 2551.02 6272
+40.297920 2551.02 6272
+40.310464 2551.02 6272
+40.323008 2551.02 6272
+40.335552 2551.02 6272
+40.348096 2551.02 6272
+40.360640 2551.02 6272
+40.373184 2551.02 6272
+40.385728 2551.02 6272
+40.398272 2551.02 6272
+40.410688 2577.32 6208
+40.423104 2577.32 6208
+40.435520 2577.32 6208
+40.447936 2577.32 6208
+40.460352 2577.32 6208
+40.472768 2577.32 6208
+40.485184 2577.32 6208
+40.497600 2577.32 6208
+40.510016 2577.32 6208
+40.522432 2577.32 6208
+40.534848 2577.32 6208
+40.547264 2577.32 6208
+40.559680 2577.32 6208
+40.572096 2577.32 6208
+40.584512 2577.32 6208
+40.596928 2577.32 6208
+40.609280 2590.67 6176
+40.621632 2590.67 6176
+40.633984 2590.67 6176
+40.646336 2590.67 6176
+40.658688 2590.67 6176
+40.671040 2590.67 6176
+40.683392 2590.67 6176
+40.695744 2590.67 6176
+40.708096 2590.67 6176
+40.720448 2590.67 6176
+40.732800 2590.67 6176
+40.745152 2590.67 6176
+40.757504 2590.67 6176
+40.769856 2590.67 6176
+40.782208 2590.67 6176
+40.794560 2590.67 6176
+40.806912 2590.67 6176
+40.819264 2590.67 6176
+40.831616 2590.67 6176
+40.843968 2590.67 6176
+40.856320 2590.67 6176
+40.868672 2590.67 6176
+40.881024 2590.67 6176
+40.893376 2590.67 6176
+40.905664 2604.17 6144
+40.917952 2604.17 6144
+40.930240 2604.17 6144
+40.942528 2604.17 6144
+40.954816 2604.17 6144
+40.967104 2604.17 6144
+40.979392 2604.17 6144
+40.991680 2604.17 6144
+41.003968 2604.17 6144
+41.016256 2604.17 6144
+41.028544 2604.17 6144
+41.040832 2604.17 6144
+41.053120 2604.17 6144
+41.065408 2604.17 6144
+41.077696 2604.17 6144
+41.089984 2604.17 6144
+41.102208 2617.80 6112
+41.114432 2617.80 6112
+41.126656 2617.80 6112
+41.138880 2617.80 6112
+41.151104 2617.80 6112
+41.163328 2617.80 6112
+41.175552 2617.80 6112
+41.187776 2617.80 6112
+41.200000 2617.80 6112
+41.212224 2617.80 6112
+41.224448 2617.80 6112
+41.236672 2617.80 6112
+41.248896 2617.80 6112
+41.261120 2617.80 6112
+41.273344 2617.80 6112
+41.285568 2617.80 6112
+41.297728 2631.58 6080
+41.309888 2631.58 6080
+41.322048 2631.58 6080
+41.334208 2631.58 6080
+41.346368 2631.58 6080
+41.358528 2631.58 6080
+41.370688 2631.58 6080
+41.382848 2631.58 6080
+41.395008 2631.58 6080
+41.407168 2631.58 6080
+41.419328 2631.58 6080
+41.431488 2631.58 6080
+41.443648 2631.58 6080
+41.455808 2631.58 6080
+41.467968 2631.58 6080
+41.480128 2631.58 6080
+41.492288 2631.58 6080
+41.504448 2631.58 6080
+41.516608 2631.58 6080
+41.528768 2631.58 6080
+41.540928 2631.58 6080
+41.553088 2631.58 6080
+41.565248 2631.58 6080
+41.577408 2631.58 6080
+41.589504 2645.50 6048
+41.601600 2645.50 6048
+41.613696 2645.50 6048
+41.625792 2645.50 6048
+41.637888 2645.50 6048
+41.649984 2645.50 6048
+41.662080 2645.50 6048
+41.674176 2645.50 6048
+41.686272 2645.50 6048
+41.698368 2645.50 6048
+41.710464 2645.50 6048
+41.722560 2645.50 6048
+41.734656 2645.50 6048
+41.746752 2645.50 6048
+41.758848 2645.50 6048
+41.770944 2645.50 6048
+41.782976 2659.57 6016
+41.795008 2659.57 6016
+41.807040 2659.57 6016
+41.819072 2659.57 6016
+41.831104 2659.57 6016
+41.843136 2659.57 6016
+41.855168 2659.57 6016
+41.867200 2659.57 6016
+41.879232 2659.57 6016
+41.891264 2659.57 6016
+41.903296 2659.57 6016
+41.915328 2659.57 6016
+41.927360 2659.57 6016
+41.939392 2659.57 6016
+41.951424 2659.57 6016
+41.963456 2659.57 6016
+41.975424 2673.80 5984
+41.987392 2673.80 5984
+41.999360 2673.80 5984
+42.011328 2673.80 5984
+42.023296 2673.80 5984
+42.035264 2673.80 5984
+42.047232 2673.80 5984
+42.059200 2673.80 5984
+42.071168 2673.80 5984
+42.083136 2673.80 5984
+42.095104 2673.80 5984
+42.107072 2673.80 5984
+42.119040 2673.80 5984
+42.131008 2673.80 5984
+42.142976 2673.80 5984
+42.154944 2673.80 5984
+42.166912 2673.80 5984
+42.178880 2673.80 5984
+42.190848 2673.80 5984
+42.202816 2673.80 5984
+42.214784 2673.80 5984
+42.226752 2673.80 5984
+42.238720 2673.80 5984
+42.250688 2673.80 5984
+42.262592 2688.17 5952
+42.274496 2688.17 5952
+42.286400 2688.17 5952
+42.298304 2688.17 5952
+42.310208 2688.17 5952
+42.322112 2688.17 5952
+42.334016 2688.17 5952
+42.345920 2688.17 5952
+42.357824 2688.17 5952
+42.369728 2688.17 5952
+42.381632 2688.17 5952
+42.393536 2688.17 5952
+42.405440 2688.17 5952
+42.417344 2688.17 5952
+42.429248 2688.17 5952
+42.441152 2688.17 5952
+42.452992 2702.70 5920
+42.464832 2702.70 5920
+42.476672 2702.70 5920
+42.488512 2702.70 5920
+42.500352 2702.70 5920
+42.512192 2702.70 5920
+42.524032 2702.70 5920
+42.535872 2702.70 5920
+42.547712 2702.70 5920
+42.559552 2702.70 5920
+42.571392 2702.70 5920
+42.583232 2702.70 5920
+42.595072 2702.70 5920
+42.606912 2702.70 5920
+42.618752 2702.70 5920
+42.630592 2702.70 5920
+42.642432 2702.70 5920
+42.654272 2702.70 5920
+42.666112 2702.70 5920
+42.677952 2702.70 5920
+42.689792 2702.70 5920
+42.701632 2702.70 5920
+42.713472 2702.70 5920
+42.725312 2702.70 5920
+42.737088 2717.39 5888
+42.748864 2717.39 5888
+42.760640 2717.39 5888
+42.772416 2717.39 5888
+42.784192 2717.39 5888
+42.795968 2717.39 5888
+42.807744 2717.39 5888
+42.819520 2717.39 5888
+42.831296 2717.39 5888
+42.843072 2717.39 5888
+42.854848 2717.39 5888
+42.866624 2717.39 5888
+42.878400 2717.39 5888
+42.890176 2717.39 5888
+42.901952 2717.39 5888
+42.913728 2717.39 5888
+42.925440 2732.24 5856
+42.937152 2732.24 5856
+42.948864 2732.24 5856
+42.960576 2732.24 5856
+42.972288 2732.24 5856
+42.984000 2732.24 5856
+42.995712 2732.24 5856
+43.007424 2732.24 5856
+43.019136 2732.24 5856
+43.030848 2732.24 5856
+43.042560 2732.24 5856
+43.054272 2732.24 5856
+43.065984 2732.24 5856
+43.077696 2732.24 5856
+43.089408 2732.24 5856
+43.101120 2732.24 5856
+43.112832 2732.24 5856
+43.124544 2732.24 5856
+43.136256 2732.24 5856
+43.147968 2732.24 5856
+43.159680 2732.24 5856
+43.171392 2732.24 5856
+43.183104 2732.24 5856
+43.194816 2732.24 5856
+43.206464 2747.25 5824
+43.218112 2747.25 5824
+43.229760 2747.25 5824
+43.241408 2747.25 5824
+43.253056 2747.25 5824
+43.264704 2747.25 5824
+43.276352 2747.25 5824
+43.288000 2747.25 5824
+43.299648 2747.25 5824
+43.311296 2747.25 5824
+43.322944 2747.25 5824
+43.334592 2747.25 5824
+43.346240 2747.25 5824
+43.357888 2747.25 5824
+43.369536 2747.25 5824
+43.381184 2747.25 5824
+43.392768 2762.43 5792
+43.404352 2762.43 5792
+43.415936 2762.43 5792
+43.427520 2762.43 5792
+43.439104 2762.43 5792
+43.450688 2762.43 5792
+43.462272 2762.43 5792
+43.473856 2762.43 5792
+43.485440 2762.43 5792
+43.497024 2762.43 5792
+43.508608 2762.43 5792
+43.520192 2762.43 5792
+43.531776 2762.43 5792
+43.543360 2762.43 5792
+43.554944 2762.43 5792
+43.566528 2762.43 5792
+43.578112 2762.43 5792
+43.589696 2762.43 5792
+43.601280 2762.43 5792
+43.612864 2762.43 5792
+43.624448 2762.43 5792
+43.636032 2762.43 5792
+43.647616 2762.43 5792
+43.659200 2762.43 5792
+43.670720 2777.78 5760
+43.682240 2777.78 5760
+43.693760 2777.78 5760
+43.705280 2777.78 5760
+43.716800 2777.78 5760
+43.728320 2777.78 5760
+43.739840 2777.78 5760
+43.751360 2777.78 5760
+43.762880 2777.78 5760
+43.774400 2777.78 5760
+43.785920 2777.78 5760
+43.797440 2777.78 5760
+43.808960 2777.78 5760
+43.820480 2777.78 5760
+43.832000 2777.78 5760
+43.843520 2777.78 5760
+43.854976 2793.30 5728
+43.866432 2793.30 5728
+43.877888 2793.30 5728
+43.889344 2793.30 5728
+43.900800 2793.30 5728
+43.912256 2793.30 5728
+43.923712 2793.30 5728
+43.935168 2793.30 5728
+43.946624 2793.30 5728
+43.958080 2793.30 5728
+43.969536 2793.30 5728
+43.980992 2793.30 5728
+43.992448 2793.30 5728
+44.003904 2793.30 5728
+44.015360 2793.30 5728
+44.026816 2793.30 5728
+44.038272 2793.30 5728
+44.049728 2793.30 5728
+44.061184 2793.30 5728
+44.072640 2793.30 5728
+44.084096 2793.30 5728
+44.095552 2793.30 5728
+44.107008 2793.30 5728
+44.118464 2793.30 5728
+44.129856 2808.99 5696
+44.141248 2808.99 5696
+44.152640 2808.99 5696
+44.164032 2808.99 5696
+44.175424 2808.99 5696
+44.186816 2808.99 5696
+44.198208 2808.99 5696
+44.209600 2808.99 5696
+44.220992 2808.99 5696
+44.232384 2808.99 5696
+44.243776 2808.99 5696
+44.255168 2808.99 5696
+44.266560 2808.99 5696
+44.277952 2808.99 5696
+44.289344 2808.99 5696
+44.300736 2808.99 5696
+44.312128 2808.99 5696
+44.323520 2808.99 5696
+44.334912 2808.99 5696
+44.346304 2808.99 5696
+44.357696 2808.99 5696
+44.369088 2808.99 5696
+44.380480 2808.99 5696
+44.391872 2808.99 5696
+44.403200 2824.86 5664
+44.414528 2824.86 5664
+44.425856 2824.86 5664
+44.437184 2824.86 5664
+44.448512 2824.86 5664
+44.459840 2824.86 5664
+44.471168 2824.86 5664
+44.482496 2824.86 5664
+44.493824 2824.86 5664
+44.505152 2824.86 5664
+44.516480 2824.86 5664
+44.527808 2824.86 5664
+44.539136 2824.86 5664
+44.550464 2824.86 5664
+44.561792 2824.86 5664
+44.573120 2824.86 5664
+44.584384 2840.91 5632
+44.595648 2840.91 5632
+44.606912 2840.91 5632
+44.618176 2840.91 5632
+44.629440 2840.91 5632
+44.640704 2840.91 5632
+44.651968 2840.91 5632
+44.663232 2840.91 5632
+44.674496 2840.91 5632
+44.685760 2840.91 5632
+44.697024 2840.91 5632
+44.708288 2840.91 5632
+44.719552 2840.91 5632
+44.730816 2840.91 5632
+44.742080 2840.91 5632
+44.753344 2840.91 5632
+44.764608 2840.91 5632
+44.775872 2840.91 5632
+44.787136 2840.91 5632
+44.798400 2840.91 5632
+44.809664 2840.91 5632
+44.820928 2840.91 5632
+44.832192 2840.91 5632
+44.843456 2840.91 5632
+44.854656 2857.14 5600
+44.865856 2857.14 5600
+44.877056 2857.14 5600
+44.888256 2857.14 5600
+44.899456 2857.14 5600
+44.910656 2857.14 5600
+44.921856 2857.14 5600
+44.933056 2857.14 5600
+44.944256 2857.14 5600
+44.955456 2857.14 5600
+44.966656 2857.14 5600
+44.977856 2857.14 5600
+44.989056 2857.14 5600
+45.000256 2857.14 5600
+45.011456 2857.14 5600
+45.022656 2857.14 5600
+45.033856 2857.14 5600
+45.045056 2857.14 5600
+45.056256 2857.14 5600
+45.067456 2857.14 5600
+45.078656 2857.14 5600
+45.089856 2857.14 5600
+45.101056 2857.14 5600
+45.112256 2857.14 5600
+45.123392 2873.56 5568
+45.134528 2873.56 5568
+45.145664 2873.56 5568
+45.156800 2873.56 5568
+45.167936 2873.56 5568
+45.179072 2873.56 5568
+45.190208 2873.56 5568
+45.201344 2873.56 5568
+45.212480 2873.56 5568
+45.223616 2873.56 5568
+45.234752 2873.56 5568
+45.245888 2873.56 5568
+45.257024 2873.56 5568
+45.268160 2873.56 5568
+45.279296 2873.56 5568
+45.290432 2873.56 5568
+45.301568 2873.56 5568
+45.312704 2873.56 5568
+45.323840 2873.56 5568
+45.334976 2873.56 5568
+45.346112 2873.56 5568
+45.357248 2873.56 5568
+45.368384 2873.56 5568
+45.379520 2873.56 5568
+45.390656 2873.56 5568
+45.401792 2873.56 5568
+45.412928 2873.56 5568
+45.424064 2873.56 5568
+45.435200 2873.56 5568
+45.446336 2873.56 5568
+45.457472 2873.56 5568
+45.468608 2873.56 5568
+45.479744 2873.56 5568
+45.490880 2873.56 5568
+45.502016 2873.56 5568
+45.513152 2873.56 5568
+45.524288 2873.56 5568
+45.535424 2873.56 5568
+45.546560 2873.56 5568
+45.557696 2873.56 5568
+45.568768 2890.17 5536
+45.579840 2890.17 5536
+45.590912 2890.17 5536
+45.601984 2890.17 5536
+45.613056 2890.17 5536
+45.624128 2890.17 5536
+45.635200 2890.17 5536
+45.646272 2890.17 5536
+45.657344 2890.17 5536
+45.668416 2890.17 5536
+45.679488 2890.17 5536
+45.690560 2890.17 5536
+45.701632 2890.17 5536
+45.712704 2890.17 5536
+45.723776 2890.17 5536
+45.734848 2890.17 5536
+45.745920 2890.17 5536
+45.756992 2890.17 5536
+45.768064 2890.17 5536
+45.779136 2890.17 5536
+45.790208 2890.17 5536
+45.801280 2890.17 5536
+45.812352 2890.17 5536
+45.823424 2890.17 5536
+45.834496 2890.17 5536
+45.845568 2890.17 5536
+45.856640 2890.17 5536
+45.867712 2890.17 5536
+45.878784 2890.17 5536
+45.889856 2890.17 5536
+45.900928 2890.17 5536
+45.912000 2890.17 5536
+45.923008 2906.98 5504
+45.934016 2906.98 5504
+45.945024 2906.98 5504
+45.956032 2906.98 5504
+45.967040 2906.98 5504
+45.978048 2906.98 5504
+45.989056 2906.98 5504
+46.000064 2906.98 5504
+46.011072 2906.98 5504
+46.022080 2906.98 5504
+46.033088 2906.98 5504
+46.044096 2906.98 5504
+46.055104 2906.98 5504
+46.066112 2906.98 5504
+46.077120 2906.98 5504
+46.088128 2906.98 5504
+46.099072 2923.98 5472
+46.110016 2923.98 5472
+46.120960 2923.98 5472
+46.131904 2923.98 5472
+46.142848 2923.98 5472
+46.153792 2923.98 5472
+46.164736 2923.98 5472
+46.175680 2923.98 5472
+46.186624 2923.98 5472
+46.197568 2923.98 5472
+46.208512 2923.98 5472
+46.219456 2923.98 5472
+46.230400 2923.98 5472
+46.241344 2923.98 5472
+46.252288 2923.98 5472
+46.263232 2923.98 5472
+46.274176 2923.98 5472
+46.285120 2923.98 5472
+46.296064 2923.98 5472
+46.307008 2923.98 5472
+46.317952 2923.98 5472
+46.328896 2923.98 5472
+46.339840 2923.98 5472
+46.350784 2923.98 5472
+46.361728 2923.98 5472
+46.372672 2923.98 5472
+46.383616 2923.98 5472
+46.394560 2923.98 5472
+46.405504 2923.98 5472
+46.416448 2923.98 5472
+46.427392 2923.98 5472
+46.438336 2923.98 5472
+46.449216 2941.18 5440
+46.460096 2941.18 5440
+46.470976 2941.18 5440
+46.481856 2941.18 5440
+46.492736 2941.18 5440
+46.503616 2941.18 5440
+46.514496 2941.18 5440
+46.525376 2941.18 5440
+46.536256 2941.18 5440
+46.547136 2941.18 5440
+46.558016 2941.18 5440
+46.568896 2941.18 5440
+46.579776 2941.18 5440
+46.590656 2941.18 5440
+46.601536 2941.18 5440
+46.612416 2941.18 5440
+46.623232 2958.58 5408
+46.634048 2958.58 5408
+46.644864 2958.58 5408
+46.655680 2958.58 5408
+46.666496 2958.58 5408
+46.677312 2958.58 5408
+46.688128 2958.58 5408
+46.698944 2958.58 5408
+46.709760 2958.58 5408
+46.720576 2958.58 5408
+46.731392 2958.58 5408
+46.742208 2958.58 5408
+46.753024 2958.58 5408
+46.763840 2958.58 5408
+46.774656 2958.58 5408
+46.785472 2958.58 5408
+46.796288 2958.58 5408
+46.807104 2958.58 5408
+46.817920 2958.58 5408
+46.828736 2958.58 5408
+46.839552 2958.58 5408
+46.850368 2958.58 5408
+46.861184 2958.58 5408
+46.872000 2958.58 5408
+46.882816 2958.58 5408
+46.893632 2958.58 5408
+46.904448 2958.58 5408
+46.915264 2958.58 5408
+46.926080 2958.58 5408
+46.936896 2958.58 5408
+46.947712 2958.58 5408
+46.958528 2958.58 5408
+46.969280 2976.19 5376
+46.980032 2976.19 5376
+46.990784 2976.19 5376
+47.001536 2976.19 5376
+47.012288 2976.19 5376
+47.023040 2976.19 5376
+47.033792 2976.19 5376
+47.044544 2976.19 5376
+47.055296 2976.19 5376
+47.066048 2976.19 5376
+47.076800 2976.19 5376
+47.087552 2976.19 5376
+47.098304 2976.19 5376
+47.109056 2976.19 5376
+47.119808 2976.19 5376
+47.130560 2976.19 5376
+47.141248 2994.01 5344
+47.151936 2994.01 5344
+47.162624 2994.01 5344
+47.173312 2994.01 5344
+47.184000 2994.01 5344
+47.194688 2994.01 5344
+47.205376 2994.01 5344
+47.216064 2994.01 5344
+47.226752 2994.01 5344
+47.237440 2994.01 5344
+47.248128 2994.01 5344
+47.258816 2994.01 5344
+47.269504 2994.01 5344
+47.280192 2994.01 5344
+47.290880 2994.01 5344
+47.301568 2994.01 5344
+47.312256 2994.01 5344
+47.322944 2994.01 5344
+47.333632 2994.01 5344
+47.344320 2994.01 5344
+47.355008 2994.01 5344
+47.365696 2994.01 5344
+47.376384 2994.01 5344
+47.387072 2994.01 5344
+47.397760 2994.01 5344
+47.408448 2994.01 5344
+47.419136 2994.01 5344
+47.429824 2994.01 5344
+47.440512 2994.01 5344
+47.451200 2994.01 5344
+47.461888 2994.01 5344
+47.472576 2994.01 5344
+47.483200 3012.05 5312
+47.499136 3012.05 5312
+47.515072 3012.05 5312
+47.531008 3012.05 5312
+47.546944 3012.05 5312
+47.562880 3012.05 5312
+47.578816 3012.05 5312
+47.594752 3012.05 5312
+47.610688 3012.05 5312
+47.626624 3012.05 5312
+47.642560 3012.05 5312
+47.658400 3030.30 5280
+47.674240 3030.30 5280
+47.690080 3030.30 5280
+47.705920 3030.30 5280
+47.721760 3030.30 5280
+47.737600 3030.30 5280
+47.753440 3030.30 5280
+47.769280 3030.30 5280
+47.785120 3030.30 5280
+47.800960 3030.30 5280
+47.816800 3030.30 5280
+47.832640 3030.30 5280
+47.848480 3030.30 5280
+47.864320 3030.30 5280
+47.880160 3030.30 5280
+47.896000 3030.30 5280
+47.911840 3030.30 5280
+47.927680 3030.30 5280
+47.943520 3030.30 5280
+47.959360 3030.30 5280
+47.975200 3030.30 5280
+47.990944 3048.78 5248
+48.006688 3048.78 5248
+48.022432 3048.78 5248
+48.038176 3048.78 5248
+48.053920 3048.78 5248
+48.069664 3048.78 5248
+48.085408 3048.78 5248
+48.101152 3048.78 5248
+48.116896 3048.78 5248
+48.132640 3048.78 5248
+48.148384 3048.78 5248
+48.164032 3067.48 5216
+48.179680 3067.48 5216
+48.195328 3067.48 5216
+48.210976 3067.48 5216
+48.226624 3067.48 5216
+48.242272 3067.48 5216
+48.257920 3067.48 5216
+48.273568 3067.48 5216
+48.289216 3067.48 5216
+48.304864 3067.48 5216
+48.320512 3067.48 5216
+48.336160 3067.48 5216
+48.351808 3067.48 5216
+48.367456 3067.48 5216
+48.383104 3067.48 5216
+48.398752 3067.48 5216
+48.414400 3067.48 5216
+48.430048 3067.48 5216
+48.445696 3067.48 5216
+48.461344 3067.48 5216
+48.476992 3067.48 5216
+48.492640 3067.48 5216
+48.508288 3067.48 5216
+48.523936 3067.48 5216
+48.539584 3067.48 5216
+48.555232 3067.48 5216
+48.570880 3067.48 5216
+48.586528 3067.48 5216
+48.602176 3067.48 5216
+48.617824 3067.48 5216
+48.633472 3067.48 5216
+48.649120 3067.48 5216
+48.664672 3086.42 5184
+48.680224 3086.42 5184
+48.695776 3086.42 5184
+48.711328 3086.42 5184
+48.726880 3086.42 5184
+48.742432 3086.42 5184
+48.757984 3086.42 5184
+48.773536 3086.42 5184
+48.789088 3086.42 5184
+48.804640 3086.42 5184
+48.820192 3086.42 5184
+48.835744 3086.42 5184
+48.851296 3086.42 5184
+48.866848 3086.42 5184
+48.882400 3086.42 5184
+48.897952 3086.42 5184
+48.913504 3086.42 5184
+48.929056 3086.42 5184
+48.944608 3086.42 5184
+48.960160 3086.42 5184
+48.975712 3086.42 5184
+48.991168 3105.59 5152
+49.006624 3105.59 5152
+49.022080 3105.59 5152
+49.037536 3105.59 5152
+49.052992 3105.59 5152
+49.068448 3105.59 5152
+49.083904 3105.59 5152
+49.099360 3105.59 5152
+49.114816 3105.59 5152
+49.130272 3105.59 5152
+49.145728 3105.59 5152
+49.161184 3105.59 5152
+49.176640 3105.59 5152
+49.192096 3105.59 5152
+49.207552 3105.59 5152
+49.223008 3105.59 5152
+49.238464 3105.59 5152
+49.253920 3105.59 5152
+49.269376 3105.59 5152
+49.284832 3105.59 5152
+49.300288 3105.59 5152
+49.315744 3105.59 5152
+49.331104 3125.00 5120
+49.346464 3125.00 5120
+49.361824 3125.00 5120
+49.377184 3125.00 5120
+49.392544 3125.00 5120
+49.407904 3125.00 5120
+49.423264 3125.00 5120
+49.438624 3125.00 5120
+49.453984 3125.00 5120
+49.469344 3125.00 5120
+49.484608 3144.65 5088
+49.499872 3144.65 5088
+49.515136 3144.65 5088
+49.530400 3144.65 5088
+49.545664 3144.65 5088
+49.560928 3144.65 5088
+49.576192 3144.65 5088
+49.591456 3144.65 5088
+49.606720 3144.65 5088
+49.621984 3144.65 5088
+49.637248 3144.65 5088
+49.652512 3144.65 5088
+49.667776 3144.65 5088
+49.683040 3144.65 5088
+49.698304 3144.65 5088
+49.713568 3144.65 5088
+49.728832 3144.65 5088
+49.744096 3144.65 5088
+49.759360 3144.65 5088
+49.774624 3144.65 5088
+49.789888 3144.65 5088
+49.805152 3144.65 5088
+49.820320 3164.56 5056
+49.835488 3164.56 5056
+49.850656 3164.56 5056
+49.865824 3164.56 5056
+49.880992 3164.56 5056
+49.896160 3164.56 5056
+49.911328 3164.56 5056
+49.926496 3164.56 5056
+49.941664 3164.56 5056
+49.956832 3164.56 5056
+49.972000 3164.56 5056
+49.987168 3164.56 5056
+50.002336 3164.56 5056
+50.017504 3164.56 5056
+50.032672 3164.56 5056
+50.047840 3164.56 5056
+50.063008 3164.56 5056
+50.078176 3164.56 5056
+50.093344 3164.56 5056
+50.108512 3164.56 5056
+50.123680 3164.56 5056
+50.138752 3184.71 5024
+50.153824 3184.71 5024
+50.168896 3184.71 5024
+50.183968 3184.71 5024
+50.199040 3184.71 5024
+50.214112 3184.71 5024
+50.229184 3184.71 5024
+50.244256 3184.71 5024
+50.259328 3184.71 5024
+50.274400 3184.71 5024
+50.289472 3184.71 5024
+50.304544 3184.71 5024
+50.319616 3184.71 5024
+50.334688 3184.71 5024
+50.349760 3184.71 5024
+50.364832 3184.71 5024
+50.379904 3184.71 5024
+50.394976 3184.71 5024
+50.410048 3184.71 5024
+50.425120 3184.71 5024
+50.440192 3184.71 5024
+50.455264 3184.71 5024
+50.470336 3184.71 5024
+50.485408 3184.71 5024
+50.500480 3184.71 5024
+50.515552 3184.71 5024
+50.530624 3184.71 5024
+50.545696 3184.71 5024
+50.560768 3184.71 5024
+50.575840 3184.71 5024
+50.590912 3184.71 5024
+50.605984 3184.71 5024
+50.620960 3205.13 4992
+50.635936 3205.13 4992
+50.650912 3205.13 4992
+50.665888 3205.13 4992
+50.680864 3205.13 4992
+50.695840 3205.13 4992
+50.710816 3205.13 4992
+50.725792 3205.13 4992
+50.740768 3205.13 4992
+50.755744 3205.13 4992
+50.770720 3205.13 4992
+50.785696 3205.13 4992
+50.800672 3205.13 4992
+50.815648 3205.13 4992
+50.830624 3205.13 4992
+50.845600 3205.13 4992
+50.860576 3205.13 4992
+50.875552 3205.13 4992
+50.890528 3205.13 4992
+50.905504 3205.13 4992
+50.920480 3205.13 4992
+50.935360 3225.81 4960
+50.950240 3225.81 4960
+50.965120 3225.81 4960
+50.980000 3225.81 4960
+50.994880 3225.81 4960
+51.009760 3225.81 4960
+51.024640 3225.81 4960
+51.039520 3225.81 4960
+51.054400 3225.81 4960
+51.069280 3225.81 4960
+51.084160 3225.81 4960
+51.099040 3225.81 4960
+51.113920 3225.81 4960
+51.128800 3225.81 4960
+51.143680 3225.81 4960
+51.158560 3225.81 4960
+51.173440 3225.81 4960
+51.188320 3225.81 4960
+51.203200 3225.81 4960
+51.218080 3225.81 4960
+51.232960 3225.81 4960
+51.247840 3225.81 4960
+51.262624 3246.75 4928
+51.277408 3246.75 4928
+51.292192 3246.75 4928
+51.306976 3246.75 4928
+51.321760 3246.75 4928
+51.336544 3246.75 4928
+51.351328 3246.75 4928
+51.366112 3246.75 4928
+51.380896 3246.75 4928
+51.395680 3246.75 4928
+51.410368 3267.97 4896
+51.425056 3267.97 4896
+51.439744 3267.97 4896
+51.454432 3267.97 4896
+51.469120 3267.97 4896
+51.483808 3267.97 4896
+51.498496 3267.97 4896
+51.513184 3267.97 4896
+51.527872 3267.97 4896
+51.542560 3267.97 4896
+51.557248 3267.97 4896
+51.571936 3267.97 4896
+51.586624 3267.97 4896
+51.601312 3267.97 4896
+51.616000 3267.97 4896
+51.630688 3267.97 4896
+51.645376 3267.97 4896
+51.660064 3267.97 4896
+51.674752 3267.97 4896
+51.689440 3267.97 4896
+51.704128 3267.97 4896
+51.718816 3267.97 4896
+51.733408 3289.47 4864
+51.748000 3289.47 4864
+51.762592 3289.47 4864
+51.777184 3289.47 4864
+51.791776 3289.47 4864
+51.806368 3289.47 4864
+51.820960 3289.47 4864
+51.835552 3289.47 4864
+51.850144 3289.47 4864
+51.864736 3289.47 4864
+51.879328 3289.47 4864
+51.893920 3289.47 4864
+51.908512 3289.47 4864
+51.923104 3289.47 4864
+51.937696 3289.47 4864
+51.952288 3289.47 4864
+51.966880 3289.47 4864
+51.981472 3289.47 4864
+51.996064 3289.47 4864
+52.010656 3289.47 4864
+52.025248 3289.47 4864
+52.039840 3289.47 4864
+52.054432 3289.47 4864
+52.069024 3289.47 4864
+52.083616 3289.47 4864
+52.098208 3289.47 4864
+52.112800 3289.47 4864
+52.127392 3289.47 4864
+52.141984 3289.47 4864
+52.156576 3289.47 4864
+52.171168 3289.47 4864
+52.185760 3289.47 4864
+52.200352 3289.47 4864
+52.214944 3289.47 4864
+52.229536 3289.47 4864
+52.244128 3289.47 4864
+52.258720 3289.47 4864
+52.273312 3289.47 4864
+52.287904 3289.47 4864
+52.302496 3289.47 4864
+52.317088 3289.47 4864
+52.331680 3289.47 4864
+52.346176 3311.26 4832
+52.360672 3311.26 4832
+52.375168 3311.26 4832
+52.389664 3311.26 4832
+52.404160 3311.26 4832
+52.418656 3311.26 4832
+52.433152 3311.26 4832
+52.447648 3311.26 4832
+52.462144 3311.26 4832
+52.476640 3311.26 4832
+52.491136 3311.26 4832
+52.505632 3311.26 4832
+52.520128 3311.26 4832
+52.534624 3311.26 4832
+52.549120 3311.26 4832
+52.563616 3311.26 4832
+52.578112 3311.26 4832
+52.592608 3311.26 4832
+52.607104 3311.26 4832
+52.621600 3311.26 4832
+52.636096 3311.26 4832
+52.650592 3311.26 4832
+52.664992 3333.33 4800
+52.679392 3333.33 4800
+52.693792 3333.33 4800
+52.708192 3333.33 4800
+52.722592 3333.33 4800
+52.736992 3333.33 4800
+52.751392 3333.33 4800
+52.765792 3333.33 4800
+52.780192 3333.33 4800
+52.794592 3333.33 4800
+52.808992 3333.33 4800
+52.823392 3333.33 4800
+52.837792 3333.33 4800
+52.852192 3333.33 4800
+52.866592 3333.33 4800
+52.880992 3333.33 4800
+52.895392 3333.33 4800
+52.909792 3333.33 4800
+52.924192 3333.33 4800
+52.938592 3333.33 4800
+52.952992 3333.33 4800
+52.967296 3355.70 4768
+52.981600 3355.70 4768
+52.995904 3355.70 4768
+53.010208 3355.70 4768
+53.024512 3355.70 4768
+53.038816 3355.70 4768
+53.053120 3355.70 4768
+53.067424 3355.70 4768
+53.081728 3355.70 4768
+53.096032 3355.70 4768
+53.110336 3355.70 4768
+53.124544 3378.38 4736
+53.138752 3378.38 4736
+53.152960 3378.38 4736
+53.167168 3378.38 4736
+53.181376 3378.38 4736
+53.195584 3378.38 4736
+53.209792 3378.38 4736
+53.224000 3378.38 4736
+53.238208 3378.38 4736
+53.252416 3378.38 4736
+53.266624 3378.38 4736
+53.280832 3378.38 4736
+53.295040 3378.38 4736
+53.309248 3378.38 4736
+53.323456 3378.38 4736
+53.337664 3378.38 4736
+53.351872 3378.38 4736
+53.366080 3378.38 4736
+53.380288 3378.38 4736
+53.394496 3378.38 4736
+53.408704 3378.38 4736
+53.422816 3401.36 4704
+53.436928 3401.36 4704
+53.451040 3401.36 4704
+53.465152 3401.36 4704
+53.479264 3401.36 4704
+53.493376 3401.36 4704
+53.507488 3401.36 4704
+53.521600 3401.36 4704
+53.535712 3401.36 4704
+53.549824 3401.36 4704
+53.563936 3401.36 4704
+53.578048 3401.36 4704
+53.592160 3401.36 4704
+53.606272 3401.36 4704
+53.620384 3401.36 4704
+53.634496 3401.36 4704
+53.648608 3401.36 4704
+53.662720 3401.36 4704
+53.676832 3401.36 4704
+53.690944 3401.36 4704
+53.705056 3401.36 4704
+53.719168 3401.36 4704
+53.733280 3401.36 4704
+53.747392 3401.36 4704
+53.761504 3401.36 4704
+53.775616 3401.36 4704
+53.789728 3401.36 4704
+53.803840 3401.36 4704
+53.817952 3401.36 4704
+53.832064 3401.36 4704
+53.846176 3401.36 4704
+53.860288 3401.36 4704
+53.874400 3401.36 4704
+53.888512 3401.36 4704
+53.902624 3401.36 4704
+53.916736 3401.36 4704
+53.930848 3401.36 4704
+53.944960 3401.36 4704
+53.959072 3401.36 4704
+53.973184 3401.36 4704
+53.987296 3401.36 4704
+54.001408 3401.36 4704
+54.015520 3401.36 4704
+54.029536 3424.66 4672
+54.043552 3424.66 4672
+54.057568 3424.66 4672
+54.071584 3424.66 4672
+54.085600 3424.66 4672
+54.099616 3424.66 4672
+54.113632 3424.66 4672
+54.127648 3424.66 4672
+54.141664 3424.66 4672
+54.155680 3424.66 4672
+54.169696 3424.66 4672
+54.183712 3424.66 4672
+54.197728 3424.66 4672
+54.211744 3424.66 4672
+54.225760 3424.66 4672
+54.239776 3424.66 4672
+54.253792 3424.66 4672
+54.267808 3424.66 4672
+54.281824 3424.66 4672
+54.295840 3424.66 4672
+54.309856 3424.66 4672
+54.323776 3448.28 4640
+54.337696 3448.28 4640
+54.351616 3448.28 4640
+54.365536 3448.28 4640
+54.379456 3448.28 4640
+54.393376 3448.28 4640
+54.407296 3448.28 4640
+54.421216 3448.28 4640
+54.435136 3448.28 4640
+54.449056 3448.28 4640
+54.462976 3448.28 4640
+54.476896 3448.28 4640
+54.490816 3448.28 4640
+54.504736 3448.28 4640
+54.518656 3448.28 4640
+54.532576 3448.28 4640
+54.546496 3448.28 4640
+54.560416 3448.28 4640
+54.574336 3448.28 4640
+54.588256 3448.28 4640
+54.602176 3448.28 4640
+54.616000 3472.22 4608
+54.629824 3472.22 4608
+54.643648 3472.22 4608
+54.657472 3472.22 4608
+54.671296 3472.22 4608
+54.685120 3472.22 4608
+54.698944 3472.22 4608
+54.712768 3472.22 4608
+54.726592 3472.22 4608
+54.740416 3472.22 4608
+54.754240 3472.22 4608
+54.768064 3472.22 4608
+54.781888 3472.22 4608
+54.795712 3472.22 4608
+54.809536 3472.22 4608
+54.823360 3472.22 4608
+54.837184 3472.22 4608
+54.851008 3472.22 4608
+54.864832 3472.22 4608
+54.878656 3472.22 4608
+54.892480 3472.22 4608
+54.906304 3472.22 4608
+54.920128 3472.22 4608
+54.933952 3472.22 4608
+54.947776 3472.22 4608
+54.961600 3472.22 4608
+54.975424 3472.22 4608
+54.989248 3472.22 4608
+55.003072 3472.22 4608
+55.016896 3472.22 4608
+55.030720 3472.22 4608
+55.044544 3472.22 4608
+55.058368 3472.22 4608
+55.072192 3472.22 4608
+55.086016 3472.22 4608
+55.099840 3472.22 4608
+55.113664 3472.22 4608
+55.127488 3472.22 4608
+55.141312 3472.22 4608
+55.155136 3472.22 4608
+55.168960 3472.22 4608
+55.182784 3472.22 4608
+55.196608 3472.22 4608
+55.210336 3496.50 4576
+55.224064 3496.50 4576
+55.237792 3496.50 4576
+55.251520 3496.50 4576
+55.265248 3496.50 4576
+55.278976 3496.50 4576
+55.292704 3496.50 4576
+55.306432 3496.50 4576
+55.320160 3496.50 4576
+55.333888 3496.50 4576
+55.347616 3496.50 4576
+55.361344 3496.50 4576
+55.375072 3496.50 4576
+55.388800 3496.50 4576
+55.402528 3496.50 4576
+55.416256 3496.50 4576
+55.429984 3496.50 4576
+55.443712 3496.50 4576
+55.457440 3496.50 4576
+55.471168 3496.50 4576
+55.484896 3496.50 4576
+55.498528 3521.13 4544
+55.512160 3521.13 4544
+55.525792 3521.13 4544
+55.539424 3521.13 4544
+55.553056 3521.13 4544
+55.566688 3521.13 4544
+55.580320 3521.13 4544
+55.593952 3521.13 4544
+55.607584 3521.13 4544
+55.621216 3521.13 4544
+55.634848 3521.13 4544
+55.648480 3521.13 4544
+55.662112 3521.13 4544
+55.675744 3521.13 4544
+55.689376 3521.13 4544
+55.703008 3521.13 4544
+55.716640 3521.13 4544
+55.730272 3521.13 4544
+55.743904 3521.13 4544
+55.757536 3521.13 4544
+55.771168 3521.13 4544
+55.784800 3521.13 4544
+55.798336 3546.10 4512
+55.811872 3546.10 4512
+55.825408 3546.10 4512
+55.838944 3546.10 4512
+55.852480 3546.10 4512
+55.866016 3546.10 4512
+55.879552 3546.10 4512
+55.893088 3546.10 4512
+55.906624 3546.10 4512
+55.920160 3546.10 4512
+55.933696 3546.10 4512
+55.947232 3546.10 4512
+55.960768 3546.10 4512
+55.974304 3546.10 4512
+55.987840 3546.10 4512
+56.001376 3546.10 4512
+56.014912 3546.10 4512
+56.028448 3546.10 4512
+56.041984 3546.10 4512
+56.055520 3546.10 4512
+56.069056 3546.10 4512
+56.082592 3546.10 4512
+56.096128 3546.10 4512
+56.109664 3546.10 4512
+56.123200 3546.10 4512
+56.136736 3546.10 4512
+56.150272 3546.10 4512
+56.163808 3546.10 4512
+56.177344 3546.10 4512
+56.190880 3546.10 4512
+56.204416 3546.10 4512
+56.217952 3546.10 4512
+56.231392 3571.43 4480
+56.244832 3571.43 4480
+56.258272 3571.43 4480
+56.271712 3571.43 4480
+56.285152 3571.43 4480
+56.298592 3571.43 4480
+56.312032 3571.43 4480
+56.325472 3571.43 4480
+56.338912 3571.43 4480
+56.352352 3571.43 4480
+56.365792 3571.43 4480
+56.379232 3571.43 4480
+56.392672 3571.43 4480
+56.406112 3571.43 4480
+56.419552 3571.43 4480
+56.432992 3571.43 4480
+56.446432 3571.43 4480
+56.459872 3571.43 4480
+56.473312 3571.43 4480
+56.486752 3571.43 4480
+56.500192 3571.43 4480
+56.513632 3571.43 4480
+56.527072 3571.43 4480
+56.540512 3571.43 4480
+56.553952 3571.43 4480
+56.567392 3571.43 4480
+56.580832 3571.43 4480
+56.594272 3571.43 4480
+56.607712 3571.43 4480
+56.621152 3571.43 4480
+56.634592 3571.43 4480
+56.648032 3571.43 4480
+56.661472 3571.43 4480
+56.674912 3571.43 4480
+56.688352 3571.43 4480
+56.701792 3571.43 4480
+56.715232 3571.43 4480
+56.728672 3571.43 4480
+56.742112 3571.43 4480
+56.755552 3571.43 4480
+56.768992 3571.43 4480
+56.782432 3571.43 4480
+56.795776 3597.12 4448
+56.809120 3597.12 4448
+56.822464 3597.12 4448
+56.835808 3597.12 4448
+56.849152 3597.12 4448
+56.862496 3597.12 4448
+56.875840 3597.12 4448
+56.889184 3597.12 4448
+56.902528 3597.12 4448
+56.915872 3597.12 4448
+56.929216 3597.12 4448
+56.942560 3597.12 4448
+56.955904 3597.12 4448
+56.969248 3597.12 4448
+56.982592 3597.12 4448
+56.995936 3597.12 4448
+57.009280 3597.12 4448
+57.022624 3597.12 4448
+57.035968 3597.12 4448
+57.049312 3597.12 4448
+57.062656 3597.12 4448
+57.076000 3597.12 4448
+57.089248 3623.19 4416
+57.102496 3623.19 4416
+57.115744 3623.19 4416
+57.128992 3623.19 4416
+57.142240 3623.19 4416
+57.155488 3623.19 4416
+57.168736 3623.19 4416
+57.181984 3623.19 4416
+57.195232 3623.19 4416
+57.208480 3623.19 4416
+57.221728 3623.19 4416
+57.234976 3623.19 4416
+57.248224 3623.19 4416
+57.261472 3623.19 4416
+57.274720 3623.19 4416
+57.287968 3623.19 4416
+57.301216 3623.19 4416
+57.314464 3623.19 4416
+57.327712 3623.19 4416
+57.340960 3623.19 4416
+57.354208 3623.19 4416
+57.367360 3649.64 4384
+57.380512 3649.64 4384
+57.393664 3649.64 4384
+57.406816 3649.64 4384
+57.419968 3649.64 4384
+57.433120 3649.64 4384
+57.446272 3649.64 4384
+57.459424 3649.64 4384
+57.472576 3649.64 4384
+57.485728 3649.64 4384
+57.498880 3649.64 4384
+57.512032 3649.64 4384
+57.525184 3649.64 4384
+57.538336 3649.64 4384
+57.551488 3649.64 4384
+57.564640 3649.64 4384
+57.577792 3649.64 4384
+57.590944 3649.64 4384
+57.604096 3649.64 4384
+57.617248 3649.64 4384
+57.630400 3649.64 4384
+57.643552 3649.64 4384
+57.656704 3649.64 4384
+57.669856 3649.64 4384
+57.683008 3649.64 4384
+57.696160 3649.64 4384
+57.709312 3649.64 4384
+57.722464 3649.64 4384
+57.735616 3649.64 4384
+57.748768 3649.64 4384
+57.761920 3649.64 4384
+57.775072 3649.64 4384
+57.788224 3649.64 4384
+57.801376 3649.64 4384
+57.814528 3649.64 4384
+57.827680 3649.64 4384
+57.840832 3649.64 4384
+57.853984 3649.64 4384
+57.867136 3649.64 4384
+57.880288 3649.64 4384
+57.893440 3649.64 4384
+57.906592 3649.64 4384
+57.919744 3649.64 4384
+57.932896 3649.64 4384
+57.946048 3649.64 4384
+57.959200 3649.64 4384
+57.972352 3649.64 4384
+57.985504 3649.64 4384
+57.998656 3649.64 4384
+58.011808 3649.64 4384
+58.024960 3649.64 4384
+58.038112 3649.64 4384
+58.051264 3649.64 4384
+58.064320 3676.47 4352
+58.077376 3676.47 4352
+58.090432 3676.47 4352
+58.103488 3676.47 4352
+58.116544 3676.47 4352
+58.129600 3676.47 4352
+58.142656 3676.47 4352
+58.155712 3676.47 4352
+58.168768 3676.47 4352
+58.181824 3676.47 4352
+58.194880 3676.47 4352
+58.207936 3676.47 4352
+58.220992 3676.47 4352
+58.234048 3676.47 4352
+58.247104 3676.47 4352
+58.260160 3676.47 4352
+58.273216 3676.47 4352
+58.286272 3676.47 4352
+58.299328 3676.47 4352
+58.312384 3676.47 4352
+58.325440 3676.47 4352
+58.338496 3676.47 4352
+58.351456 3703.70 4320
+58.364416 3703.70 4320
+58.377376 3703.70 4320
+58.390336 3703.70 4320
+58.403296 3703.70 4320
+58.416256 3703.70 4320
+58.429216 3703.70 4320
+58.442176 3703.70 4320
+58.455136 3703.70 4320
+58.468096 3703.70 4320
+58.481056 3703.70 4320
+58.494016 3703.70 4320
+58.506976 3703.70 4320
+58.519936 3703.70 4320
+58.532896 3703.70 4320
+58.545856 3703.70 4320
+58.558816 3703.70 4320
+58.571776 3703.70 4320
+58.584736 3703.70 4320
+58.597696 3703.70 4320
+58.610656 3703.70 4320
+58.623616 3703.70 4320
+58.636576 3703.70 4320
+58.649536 3703.70 4320
+58.662496 3703.70 4320
+58.675456 3703.70 4320
+58.688416 3703.70 4320
+58.701376 3703.70 4320
+58.714336 3703.70 4320
+58.727296 3703.70 4320
+58.740256 3703.70 4320
+58.753216 3703.70 4320
+58.766176 3703.70 4320
+58.779136 3703.70 4320
+58.792096 3703.70 4320
+58.805056 3703.70 4320
+58.818016 3703.70 4320
+58.830976 3703.70 4320
+58.843936 3703.70 4320
+58.856896 3703.70 4320
+58.869856 3703.70 4320
+58.882816 3703.70 4320
+58.895776 3703.70 4320
+58.908736 3703.70 4320
+58.921696 3703.70 4320
+58.934656 3703.70 4320
+58.947616 3703.70 4320
+58.960576 3703.70 4320
+58.973536 3703.70 4320
+58.986496 3703.70 4320
+58.999456 3703.70 4320
+59.012416 3703.70 4320
+59.025376 3703.70 4320
+59.038240 3731.34 4288
+59.051104 3731.34 4288
+59.063968 3731.34 4288
+59.076832 3731.34 4288
+59.089696 3731.34 4288
+59.102560 3731.34 4288
+59.115424 3731.34 4288
+59.128288 3731.34 4288
+59.141152 3731.34 4288
+59.154016 3731.34 4288
+59.166880 3731.34 4288
+59.179744 3731.34 4288
+59.192608 3731.34 4288
+59.205472 3731.34 4288
+59.218336 3731.34 4288
+59.231200 3731.34 4288
+59.244064 3731.34 4288
+59.256928 3731.34 4288
+59.269792 3731.34 4288
+59.282656 3731.34 4288
+59.295520 3731.34 4288
+59.308288 3759.40 4256
+59.321056 3759.40 4256
+59.333824 3759.40 4256
+59.346592 3759.40 4256
+59.359360 3759.40 4256
+59.372128 3759.40 4256
+59.384896 3759.40 4256
+59.397664 3759.40 4256
+59.410432 3759.40 4256
+59.423200 3759.40 4256
+59.435968 3759.40 4256
+59.448736 3759.40 4256
+59.461504 3759.40 4256
+59.474272 3759.40 4256
+59.487040 3759.40 4256
+59.499808 3759.40 4256
+59.512576 3759.40 4256
+59.525344 3759.40 4256
+59.538112 3759.40 4256
+59.550880 3759.40 4256
+59.563648 3759.40 4256
+59.576416 3759.40 4256
+59.589088 3787.88 4224
+59.601760 3787.88 4224
+59.614432 3787.88 4224
+59.627104 3787.88 4224
+59.639776 3787.88 4224
+59.652448 3787.88 4224
+59.665120 3787.88 4224
+59.677792 3787.88 4224
+59.690464 3787.88 4224
+59.703136 3787.88 4224
+59.715808 3787.88 4224
+59.728480 3787.88 4224
+59.741152 3787.88 4224
+59.753824 3787.88 4224
+59.766496 3787.88 4224
+59.779168 3787.88 4224
+59.791840 3787.88 4224
+59.804512 3787.88 4224
+59.817184 3787.88 4224
+59.829856 3787.88 4224
+59.842528 3787.88 4224
+59.855200 3787.88 4224
+59.867872 3787.88 4224
+59.880544 3787.88 4224
+59.893216 3787.88 4224
+59.905888 3787.88 4224
+59.918560 3787.88 4224
+59.931232 3787.88 4224
+59.943904 3787.88 4224
+59.956576 3787.88 4224
+59.969248 3787.88 4224
+59.981920 3787.88 4224
+59.994592 3787.88 4224
+60.007264 3787.88 4224
+60.019936 3787.88 4224
+60.032608 3787.88 4224
+60.045280 3787.88 4224
+60.057952 3787.88 4224
+60.070624 3787.88 4224
+60.083296 3787.88 4224
+60.095968 3787.88 4224
+60.108640 3787.88 4224
+60.121312 3787.88 4224
+60.133984 3787.88 4224
+60.146656 3787.88 4224
+60.159328 3787.88 4224
+60.172000 3787.88 4224
+60.184672 3787.88 4224
+60.197344 3787.88 4224
+60.210016 3787.88 4224
+60.222688 3787.88 4224
+60.235360 3787.88 4224
+60.248032 3787.88 4224
+60.260608 3816.79 4192
+60.273184 3816.79 4192
+60.285760 3816.79 4192
+60.298336 3816.79 4192
+60.310912 3816.79 4192
+60.323488 3816.79 4192
+60.336064 3816.79 4192
+60.348640 3816.79 4192
+60.361216 3816.79 4192
+60.373792 3816.79 4192
+60.386368 3816.79 4192
+60.398944 3816.79 4192
+60.411520 3816.79 4192
+60.424096 3816.79 4192
+60.436672 3816.79 4192
+60.449248 3816.79 4192
+60.461824 3816.79 4192
+60.474400 3816.79 4192
+60.486976 3816.79 4192
+60.499552 3816.79 4192
+60.512128 3816.79 4192
+60.524704 3816.79 4192
+60.537280 3816.79 4192
+60.549856 3816.79 4192
+60.562432 3816.79 4192
+60.575008 3816.79 4192
+60.587584 3816.79 4192
+60.600160 3816.79 4192
+60.612736 3816.79 4192
+60.625312 3816.79 4192
+60.637888 3816.79 4192
+60.650464 3816.79 4192
+60.662944 3846.15 4160
+60.675424 3846.15 4160
+60.687904 3846.15 4160
+60.700384 3846.15 4160
+60.712864 3846.15 4160
+60.725344 3846.15 4160
+60.737824 3846.15 4160
+60.750304 3846.15 4160
+60.762784 3846.15 4160
+60.775264 3846.15 4160
+60.787744 3846.15 4160
+60.800224 3846.15 4160
+60.812704 3846.15 4160
+60.825184 3846.15 4160
+60.837664 3846.15 4160
+60.850144 3846.15 4160
+60.862624 3846.15 4160
+60.875104 3846.15 4160
+60.887584 3846.15 4160
+60.900064 3846.15 4160
+60.912544 3846.15 4160
+60.924928 3875.97 4128
+60.937312 3875.97 4128
+60.949696 3875.97 4128
+60.962080 3875.97 4128
+60.974464 3875.97 4128
+60.986848 3875.97 4128
+60.999232 3875.97 4128
+61.011616 3875.97 4128
+61.024000 3875.97 4128
+61.036384 3875.97 4128
+61.048768 3875.97 4128
+61.061152 3875.97 4128
+61.073536 3875.97 4128
+61.085920 3875.97 4128
+61.098304 3875.97 4128
+61.110688 3875.97 4128
+61.123072 3875.97 4128
+61.135456 3875.97 4128
+61.147840 3875.97 4128
+61.160224 3875.97 4128
+61.172608 3875.97 4128
+61.184992 3875.97 4128
+61.197376 3875.97 4128
+61.209760 3875.97 4128
+61.222144 3875.97 4128
+61.234528 3875.97 4128
+61.246912 3875.97 4128
+61.259296 3875.97 4128
+61.271680 3875.97 4128
+61.284064 3875.97 4128
+61.296448 3875.97 4128
+61.308832 3875.97 4128
+61.321216 3875.97 4128
+61.333600 3875.97 4128
+61.345984 3875.97 4128
+61.358368 3875.97 4128
+61.370752 3875.97 4128
+61.383136 3875.97 4128
+61.395520 3875.97 4128
+61.407904 3875.97 4128
+61.420288 3875.97 4128
+61.432672 3875.97 4128
+61.445056 3875.97 4128
+61.457440 3875.97 4128
+61.469824 3875.97 4128
+61.482208 3875.97 4128
+61.494592 3875.97 4128
+61.506976 3875.97 4128
+61.519360 3875.97 4128
+61.531744 3875.97 4128
+61.544128 3875.97 4128
+61.556512 3875.97 4128
+61.568896 3875.97 4128
+61.581280 3875.97 4128
+61.593568 3906.25 4096
+61.605856 3906.25 4096
+61.618144 3906.25 4096
+61.630432 3906.25 4096
+61.642720 3906.25 4096
+61.655008 3906.25 4096
+61.667296 3906.25 4096
+61.679584 3906.25 4096
+61.691872 3906.25 4096
+61.704160 3906.25 4096
+61.716448 3906.25 4096
+61.728736 3906.25 4096
+61.741024 3906.25 4096
+61.753312 3906.25 4096
+61.765600 3906.25 4096
+61.777888 3906.25 4096
+61.790176 3906.25 4096
+61.802464 3906.25 4096
+61.814752 3906.25 4096
+61.827040 3906.25 4096
+61.839328 3906.25 4096
+61.851616 3906.25 4096
+61.863904 3906.25 4096
+61.876192 3906.25 4096
+61.888480 3906.25 4096
+61.900768 3906.25 4096
+61.913056 3906.25 4096
+61.925344 3906.25 4096
+61.937632 3906.25 4096
+61.949920 3906.25 4096
+61.962208 3906.25 4096
+61.974496 3906.25 4096
+61.986736 3921.57 4080
+61.998976 3921.57 4080
+62.011216 3921.57 4080
+62.023456 3921.57 4080
+62.035696 3921.57 4080
+62.047936 3921.57 4080
+62.060176 3921.57 4080
+62.072416 3921.57 4080
+62.084656 3921.57 4080
+62.096896 3921.57 4080
+62.109136 3921.57 4080
+62.121376 3921.57 4080
+62.133616 3921.57 4080
+62.145856 3921.57 4080
+62.158096 3921.57 4080
+62.170336 3921.57 4080
+62.182576 3921.57 4080
+62.194816 3921.57 4080
+62.207056 3921.57 4080
+62.219296 3921.57 4080
+62.231536 3921.57 4080
+62.243728 3937.01 4064
+62.255920 3937.01 4064
+62.268112 3937.01 4064
+62.280304 3937.01 4064
+62.292496 3937.01 4064
+62.304688 3937.01 4064
+62.316880 3937.01 4064
+62.329072 3937.01 4064
+62.341264 3937.01 4064
+62.353456 3937.01 4064
+62.365648 3937.01 4064
+62.377840 3937.01 4064
+62.390032 3937.01 4064
+62.402224 3937.01 4064
+62.414416 3937.01 4064
+62.426608 3937.01 4064
+62.438800 3937.01 4064
+62.450992 3937.01 4064
+62.463184 3937.01 4064
+62.475376 3937.01 4064
+62.487568 3937.01 4064
+62.499760 3937.01 4064
+62.511952 3937.01 4064
+62.524144 3937.01 4064
+62.536336 3937.01 4064
+62.548528 3937.01 4064
+62.560720 3937.01 4064
+62.572912 3937.01 4064
+62.585104 3937.01 4064
+62.597296 3937.01 4064
+62.609488 3937.01 4064
+62.621680 3937.01 4064
+62.633776 3968.25 4032
+62.645872 3968.25 4032
+62.657968 3968.25 4032
+62.670064 3968.25 4032
+62.682160 3968.25 4032
+62.694256 3968.25 4032
+62.706352 3968.25 4032
+62.718448 3968.25 4032
+62.730544 3968.25 4032
+62.742640 3968.25 4032
+62.754736 3968.25 4032
+62.766832 3968.25 4032
+62.778928 3968.25 4032
+62.791024 3968.25 4032
+62.803120 3968.25 4032
+62.815216 3968.25 4032
+62.827312 3968.25 4032
+62.839408 3968.25 4032
+62.851504 3968.25 4032
+62.863600 3968.25 4032
+62.875696 3968.25 4032
+62.887792 3968.25 4032
+62.899888 3968.25 4032
+62.911984 3968.25 4032
+62.924080 3968.25 4032
+62.936176 3968.25 4032
+62.948272 3968.25 4032
+62.960368 3968.25 4032
+62.972464 3968.25 4032
+62.984560 3968.25 4032
+62.996656 3968.25 4032
+63.008752 3968.25 4032
+63.020800 3984.06 4016
+63.032848 3984.06 4016
+63.044896 3984.06 4016
+63.056944 3984.06 4016
+63.068992 3984.06 4016
+63.081040 3984.06 4016
+63.093088 3984.06 4016
+63.105136 3984.06 4016
+63.117184 3984.06 4016
+63.129232 3984.06 4016
+63.141280 3984.06 4016
+63.153328 3984.06 4016
+63.165376 3984.06 4016
+63.177424 3984.06 4016
+63.189472 3984.06 4016
+63.201520 3984.06 4016
+63.213568 3984.06 4016
+63.225616 3984.06 4016
+63.237664 3984.06 4016
+63.249712 3984.06 4016
+63.261760 3984.06 4016
+63.273760 4000.00 4000
+63.433760 4000.00 4000
+63.593760 4000.00 4000
+63.753760 4000.00 4000
+63.913760 4000.00 4000
+64.073760 4000.00 4000
+64.233760 4000.00 4000
+64.393760 4000.00 4000
+64.553760 4000.00 4000
+64.713760 4000.00 4000
+64.873760 4000.00 4000
+65.033760 4000.00 4000
+65.193760 4000.00 4000
+65.353760 4000.00 4000
+65.513760 4000.00 4000
+65.673760 4000.00 4000
+65.833760 4000.00 4000
+65.993760 4000.00 4000
+66.153760 4000.00 4000
+66.313760 4000.00 4000
+66.473760 4000.00 4000
+66.633760 4000.00 4000
+66.793760 4000.00 4000
+66.953760 4000.00 4000
+67.113760 4000.00 4000
+67.273760 4000.00 4000
+67.433760 4000.00 4000
+67.593760 4000.00 4000
+67.753760 4000.00 4000
+67.913760 4000.00 4000
+68.073760 4000.00 4000
+68.233760 4000.00 4000
+68.393760 4000.00 4000
+68.553760 4000.00 4000
+68.713760 4000.00 4000
+68.873760 4000.00 4000
+69.033760 4000.00 4000
+69.193760 4000.00 4000
+69.353760 4000.00 4000
+69.513760 4000.00 4000
+69.673760 4000.00 4000
+69.833760 4000.00 4000
+69.993760 4000.00 4000
+70.153760 4000.00 4000
+70.313760 4000.00 4000
+70.473760 4000.00 4000
+70.633760 4000.00 4000
+70.793760 4000.00 4000
+70.953760 4000.00 4000
+71.113760 4000.00 4000
+71.273760 4000.00 4000
+71.433760 4000.00 4000
+71.593760 4000.00 4000
+71.753760 4000.00 4000
+71.913760 4000.00 4000
+72.073760 4000.00 4000
+72.233760 4000.00 4000
+72.393760 4000.00 4000
+72.553760 4000.00 4000
+72.713760 4000.00 4000
+72.873760 4000.00 4000
+73.033760 4000.00 4000
+73.193760 4000.00 4000
+73.353760 4000.00 4000
+73.513760 4000.00 4000
+73.673760 4000.00 4000
+73.833760 4000.00 4000
+73.993760 4000.00 4000
+74.153760 4000.00 4000
+74.313760 4000.00 4000
+74.473760 4000.00 4000
+74.633760 4000.00 4000
+74.793760 4000.00 4000
+74.953760 4000.00 4000
+75.113760 4000.00 4000
+75.273760 4000.00 4000
+75.433760 4000.00 4000
+75.593760 4000.00 4000
+75.753760 4000.00 4000
+75.913760 4000.00 4000
+76.073760 4000.00 4000
+76.233760 4000.00 4000
+76.393760 4000.00 4000
+76.553760 4000.00 4000
+76.713760 4000.00 4000
+76.873760 4000.00 4000
+77.033760 4000.00 4000
+77.193760 4000.00 4000
+77.353760 4000.00 4000
+77.513760 4000.00 4000
+77.673760 4000.00 4000
+77.833760 4000.00 4000
+77.993760 4000.00 4000
+78.153760 4000.00 4000
+78.313760 4000.00 4000
+78.473760 4000.00 4000
+78.633760 4000.00 4000
+78.793760 4000.00 4000
+78.953760 4000.00 4000
+79.113760 4000.00 4000
+79.273760 4000.00 4000
+79.433760 4000.00 4000
+79.593760 4000.00 4000
+79.753760 4000.00 4000
+79.913760 4000.00 4000
+80.073760 4000.00 4000
+80.233760 4000.00 4000
+80.393760 4000.00 4000
+80.553760 4000.00 4000
+80.713760 4000.00 4000
+80.873760 4000.00 4000
+81.033760 4000.00 4000
+81.193760 4000.00 4000
+81.353760 4000.00 4000
+81.513760 4000.00 4000
+81.673760 4000.00 4000
+81.833760 4000.00 4000
+81.993760 4000.00 4000
+82.153760 4000.00 4000
+82.313760 4000.00 4000
+82.473760 4000.00 4000
+82.633760 4000.00 4000
+82.793760 4000.00 4000
+82.953760 4000.00 4000
+83.113760 4000.00 4000
+83.273760 4000.00 4000
+83.433760 4000.00 4000
+83.593760 4000.00 4000
+83.753760 4000.00 4000
+83.913760 4000.00 4000
+84.073760 4000.00 4000
+84.233760 4000.00 4000
+84.393760 4000.00 4000
+84.553760 4000.00 4000
+84.713760 4000.00 4000
+84.873760 4000.00 4000
+85.033760 4000.00 4000
+85.193760 4000.00 4000
+85.353760 4000.00 4000
+85.513760 4000.00 4000
+85.673760 4000.00 4000
+85.833760 4000.00 4000
+85.993760 4000.00 4000
+86.153760 4000.00 4000
+86.313760 4000.00 4000
+86.473760 4000.00 4000
+86.633760 4000.00 4000
+86.793760 4000.00 4000
+86.953760 4000.00 4000
+87.113760 4000.00 4000
+87.273760 4000.00 4000
+87.433760 4000.00 4000
+87.593760 4000.00 4000
+87.753760 4000.00 4000
+87.913760 4000.00 4000
+88.073760 4000.00 4000
+88.233760 4000.00 4000
+88.393760 4000.00 4000
+88.553760 4000.00 4000
+88.713760 4000.00 4000
+88.873760 4000.00 4000
+89.033760 4000.00 4000
+89.193760 4000.00 4000
+89.353760 4000.00 4000
+89.513760 4000.00 4000
+89.673760 4000.00 4000
+89.833760 4000.00 4000
+89.993760 4000.00 4000
+90.153760 4000.00 4000
+90.313760 4000.00 4000
+90.473760 4000.00 4000
+90.633760 4000.00 4000
+90.793760 4000.00 4000
+90.953760 4000.00 4000
+91.113760 4000.00 4000
+91.273760 4000.00 4000
+91.433760 4000.00 4000
+91.593760 4000.00 4000
+91.753760 4000.00 4000
+91.913760 4000.00 4000
+92.073760 4000.00 4000
+92.233760 4000.00 4000
+92.393760 4000.00 4000
+92.553760 4000.00 4000
+92.713760 4000.00 4000
+92.873760 4000.00 4000
+93.033760 4000.00 4000
+93.193760 4000.00 4000
+93.353760 4000.00 4000
+93.513760 4000.00 4000
+93.673760 4000.00 4000
+93.833760 4000.00 4000
+93.993760 4000.00 4000
+94.153760 4000.00 4000
+94.313760 4000.00 4000
+94.473760 4000.00 4000
+94.633760 4000.00 4000
+94.793760 4000.00 4000
+94.953760 4000.00 4000
+95.113760 4000.00 4000
+95.273760 4000.00 4000
+95.433760 4000.00 4000
+95.593760 4000.00 4000
+95.753760 4000.00 4000
+95.913760 4000.00 4000
+96.073760 4000.00 4000
+96.233760 4000.00 4000
+96.393760 4000.00 4000
+96.553760 4000.00 4000
+96.713760 4000.00 4000
+96.873760 4000.00 4000
+97.033760 4000.00 4000
+97.193760 4000.00 4000
+97.353760 4000.00 4000
+97.513760 4000.00 4000
+97.673760 4000.00 4000
+97.833760 4000.00 4000
+97.993760 4000.00 4000
+98.153760 4000.00 4000
+98.313760 4000.00 4000
+98.473760 4000.00 4000
+98.633760 4000.00 4000
+98.793760 4000.00 4000
+98.953760 4000.00 4000
+99.113760 4000.00 4000
+99.273760 4000.00 4000
+99.433760 4000.00 4000
+99.593760 4000.00 4000
+99.753760 4000.00 4000
+99.913760 4000.00 4000
+100.073760 4000.00 4000
+100.233760 4000.00 4000
+100.393760 4000.00 4000
+100.553760 4000.00 4000
+100.713760 4000.00 4000
+100.873760 4000.00 4000
+101.033760 4000.00 4000
+101.193760 4000.00 4000
+101.353760 4000.00 4000
+101.513760 4000.00 4000
+101.673760 4000.00 4000
+101.833760 4000.00 4000
+101.993760 4000.00 4000
+102.153760 4000.00 4000
+102.313760 4000.00 4000
+102.473760 4000.00 4000
+102.633760 4000.00 4000
+102.793760 4000.00 4000
+102.953760 4000.00 4000
+103.113760 4000.00 4000
+103.273760 4000.00 4000
+103.433760 4000.00 4000
+103.593760 4000.00 4000
+103.753760 4000.00 4000
+103.913760 4000.00 4000
+104.073760 4000.00 4000
+104.233760 4000.00 4000
+104.393760 4000.00 4000
+104.553760 4000.00 4000
+104.713760 4000.00 4000
+104.873760 4000.00 4000
+105.033760 4000.00 4000
+105.193760 4000.00 4000
+105.353760 4000.00 4000
+105.513760 4000.00 4000
+105.673760 4000.00 4000
+105.833760 4000.00 4000
+105.993760 4000.00 4000
+106.153760 4000.00 4000
+106.313760 4000.00 4000
+106.473760 4000.00 4000
+106.633760 4000.00 4000
+106.793760 4000.00 4000
+106.953760 4000.00 4000
+107.113760 4000.00 4000
+107.273760 4000.00 4000
+107.433760 4000.00 4000
+107.593760 4000.00 4000
+107.753760 4000.00 4000
+107.913760 4000.00 4000
+108.073760 4000.00 4000
+108.233760 4000.00 4000
+108.393760 4000.00 4000
+108.553760 4000.00 4000
+108.713760 4000.00 4000
+108.873760 4000.00 4000
+109.033760 4000.00 4000
+109.193760 4000.00 4000
+109.353760 4000.00 4000
+109.513760 4000.00 4000
+109.673760 4000.00 4000
+109.833760 4000.00 4000
+109.993760 4000.00 4000
+110.153760 4000.00 4000
+110.313760 4000.00 4000
+110.473760 4000.00 4000
+110.633760 4000.00 4000
+110.793760 4000.00 4000
+110.953760 4000.00 4000
+111.113760 4000.00 4000
+111.273760 4000.00 4000
+111.433760 4000.00 4000
+111.593760 4000.00 4000
+111.753760 4000.00 4000
+111.913760 4000.00 4000
+112.073760 4000.00 4000
+112.233760 4000.00 4000
+112.393760 4000.00 4000
+112.553760 4000.00 4000
+112.713760 4000.00 4000
+112.873760 4000.00 4000
+113.033760 4000.00 4000
+113.193760 4000.00 4000
+113.353760 4000.00 4000
+113.513760 4000.00 4000
+113.673760 4000.00 4000
+113.833760 4000.00 4000
+113.993760 4000.00 4000
+114.153760 4000.00 4000
+114.313760 4000.00 4000
+114.473760 4000.00 4000
+114.633760 4000.00 4000
+114.793760 4000.00 4000
+114.953760 4000.00 4000
+115.113760 4000.00 4000
+115.273760 4000.00 4000
+115.433760 4000.00 4000
+115.593760 4000.00 4000
+115.753760 4000.00 4000
+115.913760 4000.00 4000
+116.073760 4000.00 4000
+116.233760 4000.00 4000
+116.393760 4000.00 4000
+116.553760 4000.00 4000
+116.713760 4000.00 4000
+116.873760 4000.00 4000
+117.033760 4000.00 4000
+117.193760 4000.00 4000
+117.353760 4000.00 4000
+117.513760 4000.00 4000
+117.673760 4000.00 4000
+117.833760 4000.00 4000
+117.993760 4000.00 4000
+118.153760 4000.00 4000
+118.313760 4000.00 4000
+118.473760 4000.00 4000
+118.633760 4000.00 4000
+118.793760 4000.00 4000
+118.953760 4000.00 4000
+119.113760 4000.00 4000
+119.273760 4000.00 4000
+119.433760 4000.00 4000
+119.593760 4000.00 4000
+119.753760 4000.00 4000
+119.913760 4000.00 4000
+120.073760 4000.00 4000
+120.233760 4000.00 4000
+120.393760 4000.00 4000
+120.553760 4000.00 4000
+120.713760 4000.00 4000
+120.873760 4000.00 4000
+121.033760 4000.00 4000
+121.193760 4000.00 4000
+121.353760 4000.00 4000
+121.513760 4000.00 4000
+121.673760 4000.00 4000
+121.833760 4000.00 4000
+121.993760 4000.00 4000
+122.153760 4000.00 4000
+122.313760 4000.00 4000
+122.473760 4000.00 4000
+122.633760 4000.00 4000
+122.793760 4000.00 4000
+122.953760 4000.00 4000
+123.113760 4000.00 4000
+123.273760 4000.00 4000
+123.433760 4000.00 4000
+123.593760 4000.00 4000
+123.753760 4000.00 4000
+123.913760 4000.00 4000
+124.073760 4000.00 4000
+124.233760 4000.00 4000
+124.393760 4000.00 4000
+124.553760 4000.00 4000
+124.713760 4000.00 4000
+124.873760 4000.00 4000
+125.033760 4000.00 4000
+125.193760 4000.00 4000
+125.353760 4000.00 4000
+125.513760 4000.00 4000
+125.673760 4000.00 4000
+125.833760 4000.00 4000
+125.993760 4000.00 4000
+126.153760 4000.00 4000
+126.313760 4000.00 4000
+126.473760 4000.00 4000
+126.633760 4000.00 4000
+126.793760 4000.00 4000
+126.953760 4000.00 4000
+127.113760 4000.00 4000
+127.273760 4000.00 4000
+127.433760 4000.00 4000
+127.593760 4000.00 4000
+127.753760 4000.00 4000
+127.913760 4000.00 4000
+128.073760 4000.00 4000
+128.233760 4000.00 4000
+128.393760 4000.00 4000
+128.553760 4000.00 4000
+128.713760 4000.00 4000
+128.873760 4000.00 4000
+129.033760 4000.00 4000
+129.193760 4000.00 4000
+129.353760 4000.00 4000
+129.513760 4000.00 4000
+129.673760 4000.00 4000
+129.833760 4000.00 4000
+129.993760 4000.00 4000
+130.153760 4000.00 4000
+130.313760 4000.00 4000
+130.473760 4000.00 4000
+130.633760 4000.00 4000
+130.793760 4000.00 4000
+130.953760 4000.00 4000
+131.113760 4000.00 4000
+131.273760 4000.00 4000
+131.433760 4000.00 4000
+131.593760 4000.00 4000
+131.753760 4000.00 4000
+131.913760 4000.00 4000
+132.073760 4000.00 4000
+132.233760 4000.00 4000
+132.393760 4000.00 4000
+132.553760 4000.00 4000
+132.713760 4000.00 4000
+132.873760 4000.00 4000
+133.033760 4000.00 4000
+133.193760 4000.00 4000
+133.353760 4000.00 4000
+133.513760 4000.00 4000
+133.673760 4000.00 4000
+133.833760 4000.00 4000
+133.993760 4000.00 4000
+134.153760 4000.00 4000
+134.313760 4000.00 4000
+134.473760 4000.00 4000
+134.633760 4000.00 4000
+134.793760 4000.00 4000
+134.953760 4000.00 4000
+135.113760 4000.00 4000
+135.273760 4000.00 4000
+135.433760 4000.00 4000
+135.593760 4000.00 4000
+135.753760 4000.00 4000
+135.913760 4000.00 4000
+136.073760 4000.00 4000
+136.233760 4000.00 4000
+136.393760 4000.00 4000
+136.553760 4000.00 4000
+136.713760 4000.00 4000
+136.873760 4000.00 4000
+137.033760 4000.00 4000
+137.193760 4000.00 4000
+137.353760 4000.00 4000
+137.513760 4000.00 4000
+137.673760 4000.00 4000
+137.833760 4000.00 4000
+137.993760 4000.00 4000
+138.153760 4000.00 4000
+138.313760 4000.00 4000
+138.473760 4000.00 4000
+138.633760 4000.00 4000
+138.793760 4000.00 4000
+138.953760 4000.00 4000
+139.113760 4000.00 4000
+139.273760 4000.00 4000
+139.433760 4000.00 4000
+139.593760 4000.00 4000
+139.753760 4000.00 4000
+139.913760 4000.00 4000
+140.073760 4000.00 4000
+140.233760 4000.00 4000
+140.393760 4000.00 4000
+140.553760 4000.00 4000
+140.713760 4000.00 4000
+140.873760 4000.00 4000
+141.033760 4000.00 4000
+141.193760 4000.00 4000
+141.353760 4000.00 4000
+141.513760 4000.00 4000
+141.673760 4000.00 4000
+141.833760 4000.00 4000
+141.993760 4000.00 4000
+142.153760 4000.00 4000
+142.313760 4000.00 4000
+142.473760 4000.00 4000
+142.633760 4000.00 4000
+142.793760 4000.00 4000
+142.953760 4000.00 4000
+143.113760 4000.00 4000
+143.273760 4000.00 4000
+143.433760 4000.00 4000
+143.593760 4000.00 4000
+143.753760 4000.00 4000
+143.913760 4000.00 4000
+144.073760 4000.00 4000
+144.233760 4000.00 4000
+144.393760 4000.00 4000
+144.553760 4000.00 4000
+144.713760 4000.00 4000
+144.873760 4000.00 4000
+145.033760 4000.00 4000
+145.193760 4000.00 4000
+145.353760 4000.00 4000
+145.513760 4000.00 4000
+145.673760 4000.00 4000
+145.833760 4000.00 4000
+145.993760 4000.00 4000
+146.153760 4000.00 4000
+146.313760 4000.00 4000
+146.473760 4000.00 4000
+146.633760 4000.00 4000
+146.793760 4000.00 4000
+146.953760 4000.00 4000
+147.113760 4000.00 4000
+147.273760 4000.00 4000
+147.433760 4000.00 4000
+147.593760 4000.00 4000
+147.753760 4000.00 4000
+147.913760 4000.00 4000
+148.073760 4000.00 4000
+148.233760 4000.00 4000
+148.393760 4000.00 4000
+148.553760 4000.00 4000
+148.713760 4000.00 4000
+148.873760 4000.00 4000
+149.033760 4000.00 4000
+149.193760 4000.00 4000
+149.353760 4000.00 4000
+149.513760 4000.00 4000
+149.673760 4000.00 4000
+149.833760 4000.00 4000
+149.993760 4000.00 4000
+150.153760 4000.00 4000
+150.313760 4000.00 4000
+150.473760 4000.00 4000
+150.633760 4000.00 4000
+150.793760 4000.00 4000
+150.953760 4000.00 4000
+151.113760 4000.00 4000
+151.273760 4000.00 4000
+151.433760 4000.00 4000
+151.593760 4000.00 4000
+151.753760 4000.00 4000
+151.913760 4000.00 4000
+152.073760 4000.00 4000
+152.233760 4000.00 4000
+152.393760 4000.00 4000
+152.553760 4000.00 4000
+152.713760 4000.00 4000
+152.873760 4000.00 4000
+153.033760 4000.00 4000
+153.193760 4000.00 4000
+153.353760 4000.00 4000
+153.513760 4000.00 4000
+153.673760 4000.00 4000
+153.833760 4000.00 4000
+153.993760 4000.00 4000
+154.153760 4000.00 4000
+154.313760 4000.00 4000
+154.473760 4000.00 4000
+154.633760 4000.00 4000
+154.793760 4000.00 4000
+154.953760 4000.00 4000
+155.113760 4000.00 4000
+155.273760 4000.00 4000
+155.433760 4000.00 4000
+155.593760 4000.00 4000
+155.753760 4000.00 4000
+155.913760 4000.00 4000
+156.073760 4000.00 4000
+156.233760 4000.00 4000
+156.393760 4000.00 4000
+156.553760 4000.00 4000
+156.713760 4000.00 4000
+156.873760 4000.00 4000
+157.033760 4000.00 4000
+157.193760 4000.00 4000
+157.353760 4000.00 4000
+157.513760 4000.00 4000
+157.673760 4000.00 4000
+157.833760 4000.00 4000
+157.993760 4000.00 4000
+158.153760 4000.00 4000
+158.313760 4000.00 4000
+158.473760 4000.00 4000
+158.633760 4000.00 4000
+158.793760 4000.00 4000
+158.953760 4000.00 4000
+159.113760 4000.00 4000
+159.273760 4000.00 4000
+159.433760 4000.00 4000
+159.593760 4000.00 4000
+159.753760 4000.00 4000
+159.913760 4000.00 4000
+160.073760 4000.00 4000
+160.233760 4000.00 4000
+160.393760 4000.00 4000
+160.553760 4000.00 4000
+160.713760 4000.00 4000
+160.873760 4000.00 4000
+161.033760 4000.00 4000
+161.193760 4000.00 4000
+161.353760 4000.00 4000
+161.513760 4000.00 4000
+161.673760 4000.00 4000
+161.833760 4000.00 4000
+161.993760 4000.00 4000
+162.153760 4000.00 4000
+162.313760 4000.00 4000
+162.473760 4000.00 4000
+162.633760 4000.00 4000
+162.793760 4000.00 4000
+162.953760 4000.00 4000
+163.113760 4000.00 4000
+163.273760 4000.00 4000
+163.433760 4000.00 4000
+163.593760 4000.00 4000
+163.753760 4000.00 4000
+163.913760 4000.00 4000
+164.073760 4000.00 4000
+164.233760 4000.00 4000
+164.393760 4000.00 4000
+164.553760 4000.00 4000
+164.713760 4000.00 4000
+164.873760 4000.00 4000
+165.033760 4000.00 4000
+165.193760 4000.00 4000
+165.353760 4000.00 4000
+165.513760 4000.00 4000
+165.673760 4000.00 4000
+165.833760 4000.00 4000
+165.993760 4000.00 4000
+166.153760 4000.00 4000
+166.313760 4000.00 4000
+166.473760 4000.00 4000
+166.633760 4000.00 4000
+166.793760 4000.00 4000
+166.953760 4000.00 4000
+167.113760 4000.00 4000
+167.273760 4000.00 4000
+167.433760 4000.00 4000
+167.593760 4000.00 4000
+167.753760 4000.00 4000
+167.913760 4000.00 4000
+168.073760 4000.00 4000
+168.233760 4000.00 4000
+168.393760 4000.00 4000
+168.553760 4000.00 4000
+168.713760 4000.00 4000
+168.873760 4000.00 4000
+169.033760 4000.00 4000
+169.193760 4000.00 4000
+169.353760 4000.00 4000
+169.513760 4000.00 4000
+169.673760 4000.00 4000
+169.833760 4000.00 4000
+169.993760 4000.00 4000
+170.153760 4000.00 4000
+170.313760 4000.00 4000
+170.473760 4000.00 4000
+170.633760 4000.00 4000
+170.793760 4000.00 4000
+170.953760 4000.00 4000
+171.113760 4000.00 4000
+171.273760 4000.00 4000
+171.433760 4000.00 4000
+171.593760 4000.00 4000
+171.753760 4000.00 4000
+171.913760 4000.00 4000
+172.073760 4000.00 4000
+172.233760 4000.00 4000
+172.393760 4000.00 4000
+172.553760 4000.00 4000
+172.713760 4000.00 4000
+172.873760 4000.00 4000
+173.033760 4000.00 4000
+173.193760 4000.00 4000
+173.353760 4000.00 4000
+173.513760 4000.00 4000
+173.673760 4000.00 4000
+173.833760 4000.00 4000
+173.993760 4000.00 4000
+174.153760 4000.00 4000
+174.313760 4000.00 4000
+174.473760 4000.00 4000
+174.633760 4000.00 4000
+174.793760 4000.00 4000
+174.953760 4000.00 4000
+175.113760 4000.00 4000
+175.273760 4000.00 4000
+175.433760 4000.00 4000
+175.593760 4000.00 4000
+175.753760 4000.00 4000
+175.913760 4000.00 4000
+176.073760 4000.00 4000
+176.233760 4000.00 4000
+176.393760 4000.00 4000
+176.553760 4000.00 4000
+176.713760 4000.00 4000
+176.873760 4000.00 4000
+177.033760 4000.00 4000
+177.193760 4000.00 4000
+177.353760 4000.00 4000
+177.513760 4000.00 4000
+177.673760 4000.00 4000
+177.833760 4000.00 4000
+177.993760 4000.00 4000
+178.153760 4000.00 4000
+178.313760 4000.00 4000
+178.473760 4000.00 4000
+178.633760 4000.00 4000
+178.793760 4000.00 4000
+178.953760 4000.00 4000
+179.113760 4000.00 4000
+179.273760 4000.00 4000
+179.433760 4000.00 4000
+179.593760 4000.00 4000
+179.753760 4000.00 4000
+179.913760 4000.00 4000
+180.073760 4000.00 4000
+180.233760 4000.00 4000
+180.393760 4000.00 4000
+180.553760 4000.00 4000
+180.713760 4000.00 4000
+180.873760 4000.00 4000
+181.033760 4000.00 4000
+181.193760 4000.00 4000
+181.353760 4000.00 4000
+181.513760 4000.00 4000
+181.673760 4000.00 4000
+181.833760 4000.00 4000
+181.993760 4000.00 4000
+182.153760 4000.00 4000
+182.313760 4000.00 4000
+182.473760 4000.00 4000
+182.633760 4000.00 4000
+182.793760 4000.00 4000
+182.953760 4000.00 4000
+183.113760 4000.00 4000
+183.273760 4000.00 4000
+183.433760 4000.00 4000
+183.593760 4000.00 4000
+183.753760 4000.00 4000
+183.913760 4000.00 4000
+184.073760 4000.00 4000
+184.233760 4000.00 4000
+184.393760 4000.00 4000
+184.553760 4000.00 4000
+184.713760 4000.00 4000
+184.873760 4000.00 4000
+185.033760 4000.00 4000
+185.193760 4000.00 4000
+185.353760 4000.00 4000
+185.513760 4000.00 4000
+185.673760 4000.00 4000
+185.833760 4000.00 4000
+185.993760 4000.00 4000
+186.153760 4000.00 4000
+186.313760 4000.00 4000
+186.473760 4000.00 4000
+186.633760 4000.00 4000
+186.793760 4000.00 4000
+186.953760 4000.00 4000
+187.113760 4000.00 4000
+187.273760 4000.00 4000
+187.433760 4000.00 4000
+187.593760 4000.00 4000
+187.753760 4000.00 4000
+187.913760 4000.00 4000
+188.073760 4000.00 4000
+188.233760 4000.00 4000
+188.393760 4000.00 4000
+188.553760 4000.00 4000
+188.713760 4000.00 4000
+188.873760 4000.00 4000
+189.033760 4000.00 4000
+189.193760 4000.00 4000
+189.353760 4000.00 4000
+189.513760 4000.00 4000
+189.673760 4000.00 4000
+189.833760 4000.00 4000
+189.993760 4000.00 4000
+190.153760 4000.00 4000
+190.313760 4000.00 4000
+190.473760 4000.00 4000
+190.633760 4000.00 4000
+190.793760 4000.00 4000
+190.953760 4000.00 4000
+191.113760 4000.00 4000
+191.273760 4000.00 4000
+191.433760 4000.00 4000
+191.593760 4000.00 4000
+191.753760 4000.00 4000
+191.913760 4000.00 4000
+192.073760 4000.00 4000
+192.233760 4000.00 4000
+192.393760 4000.00 4000
+192.553760 4000.00 4000
+192.713760 4000.00 4000
+192.873760 4000.00 4000
+193.033760 4000.00 4000
+193.193760 4000.00 4000
+193.353760 4000.00 4000
+193.513760 4000.00 4000
+193.673760 4000.00 4000
+193.833760 4000.00 4000
+193.993760 4000.00 4000
+194.153760 4000.00 4000
+194.313760 4000.00 4000
+194.473760 4000.00 4000
+194.633760 4000.00 4000
+194.793760 4000.00 4000
+194.953760 4000.00 4000
+195.113760 4000.00 4000
+195.273760 4000.00 4000
+195.433760 4000.00 4000
+195.593760 4000.00 4000
+195.753760 4000.00 4000
+195.913760 4000.00 4000
+196.073760 4000.00 4000
+196.233760 4000.00 4000
+196.393760 4000.00 4000
+196.553760 4000.00 4000
+196.713760 4000.00 4000
+196.873760 4000.00 4000
+197.033760 4000.00 4000
+197.193760 4000.00 4000
+197.353760 4000.00 4000
+197.513760 4000.00 4000
+197.673760 4000.00 4000
+197.833760 4000.00 4000
+197.993760 4000.00 4000
+198.153760 4000.00 4000
+198.313760 4000.00 4000
+198.473760 4000.00 4000
+198.633760 4000.00 4000
+198.793760 4000.00 4000
+198.953760 4000.00 4000
+199.113760 4000.00 4000
+199.273760 4000.00 4000
+199.433760 4000.00 4000
+199.593760 4000.00 4000
+199.753760 4000.00 4000
+199.913760 4000.00 4000
+200.073760 4000.00 4000
+200.233760 4000.00 4000
+200.393760 4000.00 4000
+200.553760 4000.00 4000
+200.713760 4000.00 4000
+200.873760 4000.00 4000
+201.033760 4000.00 4000
+201.193760 4000.00 4000
+201.353760 4000.00 4000
+201.513760 4000.00 4000
+201.673760 4000.00 4000
+201.833760 4000.00 4000
+201.993760 4000.00 4000
+202.153760 4000.00 4000
+202.313760 4000.00 4000
+202.473760 4000.00 4000
+202.633760 4000.00 4000
+202.793760 4000.00 4000
+202.953760 4000.00 4000
+203.113760 4000.00 4000
+203.273760 4000.00 4000
+203.433760 4000.00 4000
+203.593760 4000.00 4000
+203.753760 4000.00 4000
+203.913760 4000.00 4000
+204.073760 4000.00 4000
+204.233760 4000.00 4000
+204.393760 4000.00 4000
+204.553760 4000.00 4000
+204.713760 4000.00 4000
+204.873760 4000.00 4000
+205.033760 4000.00 4000
+205.193760 4000.00 4000
+205.353760 4000.00 4000
+205.513760 4000.00 4000
+205.673760 4000.00 4000
+205.833760 4000.00 4000
+205.993760 4000.00 4000
+206.153760 4000.00 4000
+206.313760 4000.00 4000
+206.473760 4000.00 4000
+206.633760 4000.00 4000
+206.793760 4000.00 4000
+206.953760 4000.00 4000
+207.113760 4000.00 4000
+207.273760 4000.00 4000
+207.433760 4000.00 4000
+207.593760 4000.00 4000
+207.753760 4000.00 4000
+207.913760 4000.00 4000
+208.073760 4000.00 4000
+208.233760 4000.00 4000
+208.393760 4000.00 4000
+208.553760 4000.00 4000
+208.713760 4000.00 4000
+208.873760 4000.00 4000
+209.033760 4000.00 4000
+209.193760 4000.00 4000
+209.353760 4000.00 4000
+209.513760 4000.00 4000
+209.673760 4000.00 4000
+209.833760 4000.00 4000
+209.993760 4000.00 4000
+210.153760 4000.00 4000
+210.313760 4000.00 4000
+210.473760 4000.00 4000
+210.633760 4000.00 4000
+210.793760 4000.00 4000
+210.953760 4000.00 4000
+211.113760 4000.00 4000
+211.273760 4000.00 4000
+211.433760 4000.00 4000
+211.593760 4000.00 4000
+211.753760 4000.00 4000
+211.913760 4000.00 4000
+212.073760 4000.00 4000
+212.233760 4000.00 4000
+212.393760 4000.00 4000
+212.553760 4000.00 4000
+212.713760 4000.00 4000
+212.873760 4000.00 4000
+213.033760 4000.00 4000
+213.193760 4000.00 4000
+213.353760 4000.00 4000
+213.513760 4000.00 4000
+213.673760 4000.00 4000
+213.833760 4000.00 4000
+213.993760 4000.00 4000
+214.153760 4000.00 4000
+214.313760 4000.00 4000
+214.473760 4000.00 4000
+214.633760 4000.00 4000
+214.793760 4000.00 4000
+214.953760 4000.00 4000
+215.113760 4000.00 4000
+215.273760 4000.00 4000
+215.433760 4000.00 4000
+215.593760 4000.00 4000
+215.753760 4000.00 4000
+215.913760 4000.00 4000
+216.073760 4000.00 4000
+216.233760 4000.00 4000
+216.393760 4000.00 4000
+216.553760 4000.00 4000
+216.713760 4000.00 4000
+216.873760 4000.00 4000
+217.033760 4000.00 4000
+217.193760 4000.00 4000
+217.353760 4000.00 4000
+217.513760 4000.00 4000
+217.673760 4000.00 4000
+217.833760 4000.00 4000
+217.993760 4000.00 4000
+218.153760 4000.00 4000
+218.313760 4000.00 4000
+218.473760 4000.00 4000
+218.633760 4000.00 4000
+218.793760 4000.00 4000
+218.953760 4000.00 4000
+219.113760 4000.00 4000
+219.273760 4000.00 4000
+219.433760 4000.00 4000
+219.593760 4000.00 4000
+219.753760 4000.00 4000
+219.913760 4000.00 4000
+220.073760 4000.00 4000
+220.233760 4000.00 4000
+220.393760 4000.00 4000
+220.553760 4000.00 4000
+220.713760 4000.00 4000
+220.873760 4000.00 4000
+221.033760 4000.00 4000
+221.193760 4000.00 4000
+221.353760 4000.00 4000
+221.513760 4000.00 4000
+221.673760 4000.00 4000
+221.833760 4000.00 4000
+221.993760 4000.00 4000
+222.153760 4000.00 4000
+222.313760 4000.00 4000
+222.473760 4000.00 4000
+222.633760 4000.00 4000
+222.793760 4000.00 4000
+222.953760 4000.00 4000
+223.113760 4000.00 4000
+223.273760 4000.00 4000
+223.433760 4000.00 4000
+223.593760 4000.00 4000
+223.753760 4000.00 4000
+223.913760 4000.00 4000
+224.073760 4000.00 4000
+224.233760 4000.00 4000
+224.393760 4000.00 4000
+224.553760 4000.00 4000
+224.713760 4000.00 4000
+224.873760 4000.00 4000
+225.033760 4000.00 4000
+225.193760 4000.00 4000
+225.353760 4000.00 4000
+225.513760 4000.00 4000
+225.673760 4000.00 4000
+225.833760 4000.00 4000
+225.993760 4000.00 4000
+226.153760 4000.00 4000
+226.313760 4000.00 4000
+226.473760 4000.00 4000
+226.633760 4000.00 4000
+226.793760 4000.00 4000
+226.953760 4000.00 4000
+227.113760 4000.00 4000
+227.273760 4000.00 4000
+227.433760 4000.00 4000
+227.593760 4000.00 4000
+227.753760 4000.00 4000
+227.913760 4000.00 4000
+228.073760 4000.00 4000
+228.233760 4000.00 4000
+228.393760 4000.00 4000
+228.553760 4000.00 4000
+228.713760 4000.00 4000
+228.873760 4000.00 4000
+229.033760 4000.00 4000
+229.193760 4000.00 4000
+229.353760 4000.00 4000
+229.513760 4000.00 4000
+229.673760 4000.00 4000
+229.833760 4000.00 4000
+229.993760 4000.00 4000
+230.153760 4000.00 4000
+230.313760 4000.00 4000
+230.473760 4000.00 4000
+230.633760 4000.00 4000
+230.793760 4000.00 4000
+230.953760 4000.00 4000
+231.113760 4000.00 4000
+231.273760 4000.00 4000
+231.433760 4000.00 4000
+231.593760 4000.00 4000
+231.753760 4000.00 4000
+231.913760 4000.00 4000
+232.073760 4000.00 4000
+232.233760 4000.00 4000
+232.393760 4000.00 4000
+232.553760 4000.00 4000
+232.713760 4000.00 4000
+232.873760 4000.00 4000
+233.033760 4000.00 4000
+233.193760 4000.00 4000
+233.353760 4000.00 4000
+233.513760 4000.00 4000
+233.673760 4000.00 4000
+233.833760 4000.00 4000
+233.993760 4000.00 4000
+234.153760 4000.00 4000
+234.313760 4000.00 4000
+234.473760 4000.00 4000
+234.633760 4000.00 4000
+234.793760 4000.00 4000
+234.953760 4000.00 4000
+235.113760 4000.00 4000
+235.273760 4000.00 4000
+235.433760 4000.00 4000
+235.593760 4000.00 4000
+235.753760 4000.00 4000
+235.913760 4000.00 4000
+236.073760 4000.00 4000
+236.233760 4000.00 4000
+236.393760 4000.00 4000
+236.553760 4000.00 4000
+236.713760 4000.00 4000
+236.873760 4000.00 4000
+237.033760 4000.00 4000
+237.193760 4000.00 4000
+237.353760 4000.00 4000
+237.513760 4000.00 4000
+237.673760 4000.00 4000
+237.833760 4000.00 4000
+237.993760 4000.00 4000
+238.153760 4000.00 4000
+238.313760 4000.00 4000
+238.473760 4000.00 4000
+238.633760 4000.00 4000
+238.793760 4000.00 4000
+238.953760 4000.00 4000
+239.113760 4000.00 4000
+239.273760 4000.00 4000
+239.433760 4000.00 4000
+239.593760 4000.00 4000
+239.753760 4000.00 4000
+239.913760 4000.00 4000
+240.073760 4000.00 4000
+240.233760 4000.00 4000
+240.393760 4000.00 4000
+240.553760 4000.00 4000
+240.713760 4000.00 4000
+240.873760 4000.00 4000
+241.033760 4000.00 4000
+241.193760 4000.00 4000
+241.353760 4000.00 4000
+241.513760 4000.00 4000
+241.673760 4000.00 4000
+241.833760 4000.00 4000
+241.993760 4000.00 4000
+242.153760 4000.00 4000
+242.313760 4000.00 4000
+242.473760 4000.00 4000
+242.633760 4000.00 4000
+242.793760 4000.00 4000
+242.953760 4000.00 4000
+243.113760 4000.00 4000
+243.273760 4000.00 4000
+243.433760 4000.00 4000
+243.593760 4000.00 4000
+243.753760 4000.00 4000
+243.913760 4000.00 4000
+244.073760 4000.00 4000
+244.233760 4000.00 4000
+244.393760 4000.00 4000
+244.553760 4000.00 4000
+244.713760 4000.00 4000
+244.873760 4000.00 4000
+245.033760 4000.00 4000
+245.193760 4000.00 4000
+245.353760 4000.00 4000
+245.513760 4000.00 4000
+245.673760 4000.00 4000
+245.833760 4000.00 4000
+245.993760 4000.00 4000
+246.153760 4000.00 4000
+246.313760 4000.00 4000
+246.473760 4000.00 4000
+246.633760 4000.00 4000
+246.793760 4000.00 4000
+246.953760 4000.00 4000
+247.113760 4000.00 4000
+247.273760 4000.00 4000
+247.433760 4000.00 4000
+247.593760 4000.00 4000
+247.753760 4000.00 4000
+247.913760 4000.00 4000
+248.073760 4000.00 4000
+248.233760 4000.00 4000
+248.393760 4000.00 4000
+248.553760 4000.00 4000
+248.713760 4000.00 4000
+248.873760 4000.00 4000
+249.033760 4000.00 4000
+249.193760 4000.00 4000
+249.353760 4000.00 4000
+249.513760 4000.00 4000
+249.673760 4000.00 4000
+249.833760 4000.00 4000
+249.993760 4000.00 4000
+250.153760 4000.00 4000
+250.313760 4000.00 4000
+250.473760 4000.00 4000
+250.633760 4000.00 4000
+250.793760 4000.00 4000
+250.953760 4000.00 4000
+251.113760 4000.00 4000
+251.273760 4000.00 4000
+251.433760 4000.00 4000
+251.593760 4000.00 4000
+251.753760 4000.00 4000
+251.913760 4000.00 4000
+252.073760 4000.00 4000
+252.233760 4000.00 4000
+252.393760 4000.00 4000
+252.553760 4000.00 4000
+252.713760 4000.00 4000
+252.873760 4000.00 4000
+253.033760 4000.00 4000
+253.193760 4000.00 4000
+253.353760 4000.00 4000
+253.513760 4000.00 4000
+253.673760 4000.00 4000
+253.833760 4000.00 4000
+253.993760 4000.00 4000
+254.153760 4000.00 4000
+254.313760 4000.00 4000
+254.473760 4000.00 4000
+254.633760 4000.00 4000
+254.793760 4000.00 4000
+254.953760 4000.00 4000
+255.113760 4000.00 4000
+255.273760 4000.00 4000
+255.433760 4000.00 4000
+255.593760 4000.00 4000
+255.753760 4000.00 4000
+255.913760 4000.00 4000
+256.073760 4000.00 4000
+256.233760 4000.00 4000
+256.393760 4000.00 4000
+256.553760 4000.00 4000
+256.713760 4000.00 4000
+256.873760 4000.00 4000
+257.033760 4000.00 4000
+257.193760 4000.00 4000
+257.353760 4000.00 4000
+257.513760 4000.00 4000
+257.673760 4000.00 4000
+257.833760 4000.00 4000
+257.993760 4000.00 4000
+258.153760 4000.00 4000
+258.313760 4000.00 4000
+258.473760 4000.00 4000
+258.633760 4000.00 4000
+258.793760 4000.00 4000
+258.953760 4000.00 4000
+259.113760 4000.00 4000
+259.273760 4000.00 4000
+259.433760 4000.00 4000
+259.593760 4000.00 4000
+259.753760 4000.00 4000
+259.913760 4000.00 4000
+260.073760 4000.00 4000
+260.233760 4000.00 4000
+260.393760 4000.00 4000
+260.553760 4000.00 4000
+260.713760 4000.00 4000
+260.873760 4000.00 4000
+261.033760 4000.00 4000
+261.193760 4000.00 4000
+261.353760 4000.00 4000
+261.513760 4000.00 4000
+261.673760 4000.00 4000
+261.833760 4000.00 4000
+261.993760 4000.00 4000
+262.153760 4000.00 4000
+262.313760 4000.00 4000
+262.473760 4000.00 4000
+262.633760 4000.00 4000
+262.793760 4000.00 4000
+262.953760 4000.00 4000
+263.113760 4000.00 4000
+263.273760 4000.00 4000
+263.433760 4000.00 4000
+263.593760 4000.00 4000
+263.753760 4000.00 4000
+263.913760 4000.00 4000
+264.073760 4000.00 4000
+264.233760 4000.00 4000
+264.393760 4000.00 4000
+264.553760 4000.00 4000
+264.713760 4000.00 4000
+264.873760 4000.00 4000
+265.033760 4000.00 4000
+265.193760 4000.00 4000
+265.353760 4000.00 4000
+265.513760 4000.00 4000
+265.673760 4000.00 4000
+265.833760 4000.00 4000
+265.993760 4000.00 4000
+266.153760 4000.00 4000
+266.313760 4000.00 4000
+266.473760 4000.00 4000
+266.633760 4000.00 4000
+266.793760 4000.00 4000
+266.953760 4000.00 4000
+267.113760 4000.00 4000
+267.273760 4000.00 4000
+267.433760 4000.00 4000
+267.593760 4000.00 4000
+267.753760 4000.00 4000
+267.913760 4000.00 4000
+268.073760 4000.00 4000
+268.233760 4000.00 4000
+268.393760 4000.00 4000
+268.553760 4000.00 4000
+268.713760 4000.00 4000
+268.873760 4000.00 4000
+269.033760 4000.00 4000
+269.193760 4000.00 4000
+269.353760 4000.00 4000
+269.513760 4000.00 4000
+269.673760 4000.00 4000
+269.833760 4000.00 4000
+269.993760 4000.00 4000
+270.153760 4000.00 4000
+270.313760 4000.00 4000
+270.473760 4000.00 4000
+270.633760 4000.00 4000
+270.793760 4000.00 4000
+270.953760 4000.00 4000
+271.113760 4000.00 4000
+271.273760 4000.00 4000
+271.433760 4000.00 4000
+271.593760 4000.00 4000
+271.753760 4000.00 4000
+271.913760 4000.00 4000
+272.073760 4000.00 4000
+272.233760 4000.00 4000
+272.393760 4000.00 4000
+272.553760 4000.00 4000
+272.713760 4000.00 4000
+272.873760 4000.00 4000
+273.033760 4000.00 4000
+273.193760 4000.00 4000
+273.353760 4000.00 4000
+273.513760 4000.00 4000
+273.673760 4000.00 4000
+273.833760 4000.00 4000
+273.993760 4000.00 4000
+274.153760 4000.00 4000
+274.313760 4000.00 4000
+274.473760 4000.00 4000
+274.633760 4000.00 4000
+274.793760 4000.00 4000
+274.953760 4000.00 4000
+275.113760 4000.00 4000
+275.273760 4000.00 4000
+275.433760 4000.00 4000
+275.593760 4000.00 4000
+275.753760 4000.00 4000
+275.913760 4000.00 4000
+276.073760 4000.00 4000
+276.233760 4000.00 4000
+276.393760 4000.00 4000
+276.553760 4000.00 4000
+276.713760 4000.00 4000
+276.873760 4000.00 4000
+277.033760 4000.00 4000
+277.193760 4000.00 4000
+277.353760 4000.00 4000
+277.513760 4000.00 4000
+277.673760 4000.00 4000
+277.833760 4000.00 4000
+277.993760 4000.00 4000
+278.153760 4000.00 4000
+278.313760 4000.00 4000
+278.473760 4000.00 4000
+278.633760 4000.00 4000
+278.793760 4000.00 4000
+278.953760 4000.00 4000
+279.113760 4000.00 4000
+279.273760 4000.00 4000
+279.433760 4000.00 4000
+279.593760 4000.00 4000
+279.753760 4000.00 4000
+279.913760 4000.00 4000
+280.073760 4000.00 4000
+280.233760 4000.00 4000
+280.393760 4000.00 4000
+280.553760 4000.00 4000
+280.713760 4000.00 4000
+280.873760 4000.00 4000
+281.033760 4000.00 4000
+281.193760 4000.00 4000
+281.353760 4000.00 4000
+281.513760 4000.00 4000
+281.673760 4000.00 4000
+281.833760 4000.00 4000
+281.993760 4000.00 4000
+282.153760 4000.00 4000
+282.313760 4000.00 4000
+282.473760 4000.00 4000
+282.633760 4000.00 4000
+282.793760 4000.00 4000
+282.953760 4000.00 4000
+283.113760 4000.00 4000
+283.273760 4000.00 4000
+283.433760 4000.00 4000
+283.593760 4000.00 4000
+283.753760 4000.00 4000
+283.913760 4000.00 4000
+284.073760 4000.00 4000
+284.233760 4000.00 4000
+284.393760 4000.00 4000
+284.553760 4000.00 4000
+284.713760 4000.00 4000
+284.873760 4000.00 4000
+285.033760 4000.00 4000
+285.193760 4000.00 4000
+285.353760 4000.00 4000
+285.513760 4000.00 4000
+285.673760 4000.00 4000
+285.833760 4000.00 4000
+285.993760 4000.00 4000
+286.153760 4000.00 4000
+286.313760 4000.00 4000
+286.473760 4000.00 4000
+286.633760 4000.00 4000
+286.793760 4000.00 4000
+286.953760 4000.00 4000
+287.113760 4000.00 4000
+287.273760 4000.00 4000
+287.433760 4000.00 4000
+287.593760 4000.00 4000
+287.753760 4000.00 4000
+287.913760 4000.00 4000
+288.073760 4000.00 4000
+288.233760 4000.00 4000
+288.393760 4000.00 4000
+288.553760 4000.00 4000
+288.713760 4000.00 4000
+288.873760 4000.00 4000
+289.033760 4000.00 4000
+289.193760 4000.00 4000
+289.353760 4000.00 4000
+289.513760 4000.00 4000
+289.673760 4000.00 4000
+289.833760 4000.00 4000
+289.993760 4000.00 4000
+290.153760 4000.00 4000
+290.313760 4000.00 4000
+290.473760 4000.00 4000
+290.633760 4000.00 4000
+290.793760 4000.00 4000
+290.953760 4000.00 4000
+291.113760 4000.00 4000
+291.273760 4000.00 4000
+291.433760 4000.00 4000
+291.593760 4000.00 4000
+291.753760 4000.00 4000
+291.913760 4000.00 4000
+292.073760 4000.00 4000
+292.233760 4000.00 4000
+292.393760 4000.00 4000
+292.553760 4000.00 4000
+292.713760 4000.00 4000
+292.873760 4000.00 4000
+293.033760 4000.00 4000
+293.193760 4000.00 4000
+293.353760 4000.00 4000
+293.513760 4000.00 4000
+293.673760 4000.00 4000
+293.833760 4000.00 4000
+293.993760 4000.00 4000
+294.153760 4000.00 4000
+294.313760 4000.00 4000
+294.473760 4000.00 4000
+294.633760 4000.00 4000
+294.793760 4000.00 4000
+294.953760 4000.00 4000
+295.113760 4000.00 4000
+295.273760 4000.00 4000
+295.433760 4000.00 4000
+295.593760 4000.00 4000
+295.753760 4000.00 4000
+295.913760 4000.00 4000
+296.073760 4000.00 4000
+296.233760 4000.00 4000
+296.393760 4000.00 4000
+296.553760 4000.00 4000
+296.713760 4000.00 4000
+296.873760 4000.00 4000
+297.033760 4000.00 4000
+297.193760 4000.00 4000
+297.353760 4000.00 4000
+297.513760 4000.00 4000
+297.673760 4000.00 4000
+297.833760 4000.00 4000
+297.993760 4000.00 4000
+298.153760 4000.00 4000
+298.313760 4000.00 4000
+298.473760 4000.00 4000
+298.633760 4000.00 4000
+298.793760 4000.00 4000
+298.953760 4000.00 4000
+299.113760 4000.00 4000
+299.273760 4000.00 4000
+299.433760 4000.00 4000
+299.593760 4000.00 4000
+299.753760 4000.00 4000
+299.913760 4000.00 4000
+300.073760 4000.00 4000
+300.233760 4000.00 4000
+300.393760 4000.00 4000
+300.553760 4000.00 4000
+300.713760 4000.00 4000
+300.873760 4000.00 4000
+301.033760 4000.00 4000
+301.193760 4000.00 4000
+301.353760 4000.00 4000
+301.513760 4000.00 4000
+301.673760 4000.00 4000
+301.833760 4000.00 4000
+301.993760 4000.00 4000
+302.153760 4000.00 4000
+302.313760 4000.00 4000
+302.473760 4000.00 4000
+302.633760 4000.00 4000
+302.793760 4000.00 4000
+302.953760 4000.00 4000
+303.113760 4000.00 4000
+303.273760 4000.00 4000
+303.433760 4000.00 4000
+303.593760 4000.00 4000
+303.753760 4000.00 4000
+303.913760 4000.00 4000
+304.073760 4000.00 4000
+304.233760 4000.00 4000
+304.393760 4000.00 4000
+304.553760 4000.00 4000
+304.713760 4000.00 4000
+304.873760 4000.00 4000
+305.033760 4000.00 4000
+305.193760 4000.00 4000
+305.353760 4000.00 4000
+305.513760 4000.00 4000
+305.673760 4000.00 4000
+305.833760 4000.00 4000
+305.993760 4000.00 4000
+306.153760 4000.00 4000
+306.313760 4000.00 4000
+306.473760 4000.00 4000
+306.633760 4000.00 4000
+306.793760 4000.00 4000
+306.953760 4000.00 4000
+307.113760 4000.00 4000
+307.273760 4000.00 4000
+307.433760 4000.00 4000
+307.593760 4000.00 4000
+307.753760 4000.00 4000
+307.913760 4000.00 4000
+308.073760 4000.00 4000
+308.233760 4000.00 4000
+308.393760 4000.00 4000
+308.553760 4000.00 4000
+308.713760 4000.00 4000
+308.873760 4000.00 4000
+309.033760 4000.00 4000
+309.193760 4000.00 4000
+309.353760 4000.00 4000
+309.513760 4000.00 4000
+309.673760 4000.00 4000
+309.833760 4000.00 4000
+309.993760 4000.00 4000
+310.153760 4000.00 4000
+310.313760 4000.00 4000
+310.473760 4000.00 4000
+310.633760 4000.00 4000
+310.793760 4000.00 4000
+310.953760 4000.00 4000
+311.113760 4000.00 4000
+311.273760 4000.00 4000
+311.433760 4000.00 4000
+311.593760 4000.00 4000
+311.753760 4000.00 4000
+311.913760 4000.00 4000
+312.073760 4000.00 4000
+312.233760 4000.00 4000
+312.393760 4000.00 4000
+312.553760 4000.00 4000
+312.713760 4000.00 4000
+312.873760 4000.00 4000
+313.033760 4000.00 4000
+313.193760 4000.00 4000
+313.353760 4000.00 4000
+313.513760 4000.00 4000
+313.673760 4000.00 4000
+313.833760 4000.00 4000
+313.993760 4000.00 4000
+314.153760 4000.00 4000
+314.313760 4000.00 4000
+314.473760 4000.00 4000
+314.633760 4000.00 4000
+314.793760 4000.00 4000
+314.953760 4000.00 4000
+315.113760 4000.00 4000
+315.273760 4000.00 4000
+315.433760 4000.00 4000
+315.593760 4000.00 4000
+315.753760 4000.00 4000
+315.913760 4000.00 4000
+316.073760 4000.00 4000
+316.233760 4000.00 4000
+316.393760 4000.00 4000
+316.553760 4000.00 4000
+316.713760 4000.00 4000
+316.873760 4000.00 4000
+317.033760 4000.00 4000
+317.193760 4000.00 4000
+317.353760 4000.00 4000
+317.513760 4000.00 4000
+317.673760 4000.00 4000
+317.833760 4000.00 4000
+317.993760 4000.00 4000
+318.153760 4000.00 4000
+318.313760 4000.00 4000
+318.473760 4000.00 4000
+318.633760 4000.00 4000
+318.793760 4000.00 4000
+318.953760 4000.00 4000
+319.113760 4000.00 4000
+319.273760 4000.00 4000
+319.433760 4000.00 4000
+319.593760 4000.00 4000
+319.753760 4000.00 4000
+319.913760 4000.00 4000
+320.073760 4000.00 4000
+320.233760 4000.00 4000
+320.393760 4000.00 4000
+320.553760 4000.00 4000
+320.713760 4000.00 4000
+320.873760 4000.00 4000
+321.033760 4000.00 4000
+321.193760 4000.00 4000
+321.353760 4000.00 4000
+321.513760 4000.00 4000
+321.673760 4000.00 4000
+321.833760 4000.00 4000
+321.993760 4000.00 4000
+322.153760 4000.00 4000
+322.313760 4000.00 4000
+322.473760 4000.00 4000
+322.633760 4000.00 4000
+322.793760 4000.00 4000
+322.953760 4000.00 4000
+323.113760 4000.00 4000
+323.273760 4000.00 4000
+323.433760 4000.00 4000
+323.593760 4000.00 4000
+323.753760 4000.00 4000
+323.913760 4000.00 4000
+324.073760 4000.00 4000
+324.233760 4000.00 4000
+324.393760 4000.00 4000
+324.553760 4000.00 4000
+324.713760 4000.00 4000
+324.873760 4000.00 4000
+325.033760 4000.00 4000
+325.193760 4000.00 4000
+325.353760 4000.00 4000
+325.513760 4000.00 4000
+325.673760 4000.00 4000
+325.833760 4000.00 4000
+325.993760 4000.00 4000
+326.153760 4000.00 4000
+326.313760 4000.00 4000
+326.473760 4000.00 4000
+326.633760 4000.00 4000
+326.793760 4000.00 4000
+326.953760 4000.00 4000
+327.113760 4000.00 4000
+327.273760 4000.00 4000
+327.433760 4000.00 4000
+327.593760 4000.00 4000
+327.753760 4000.00 4000
+327.913760 4000.00 4000
+328.073760 4000.00 4000
+328.233760 4000.00 4000
+328.393760 4000.00 4000
+328.553760 4000.00 4000
+328.713760 4000.00 4000
+328.873760 4000.00 4000
+329.033760 4000.00 4000
+329.193760 4000.00 4000
+329.353760 4000.00 4000
+329.513760 4000.00 4000
+329.673760 4000.00 4000
+329.833760 4000.00 4000
+329.993760 4000.00 4000
+330.153760 4000.00 4000
+330.313760 4000.00 4000
+330.473760 4000.00 4000
+330.633760 4000.00 4000
+330.793760 4000.00 4000
+330.953760 4000.00 4000
+331.113760 4000.00 4000
+331.273760 4000.00 4000
+331.433760 4000.00 4000
+331.593760 4000.00 4000
+331.753760 4000.00 4000
+331.913760 4000.00 4000
+332.073760 4000.00 4000
+332.233760 4000.00 4000
+332.393760 4000.00 4000
+332.553760 4000.00 4000
+332.713760 4000.00 4000
+332.873760 4000.00 4000
+333.033760 4000.00 4000
+333.193760 4000.00 4000
+333.353760 4000.00 4000
+333.513760 4000.00 4000
+333.673760 4000.00 4000
+333.833760 4000.00 4000
+333.993760 4000.00 4000
+334.153760 4000.00 4000
+334.313760 4000.00 4000
+334.473760 4000.00 4000
+334.633760 4000.00 4000
+334.793760 4000.00 4000
+334.953760 4000.00 4000
+335.113760 4000.00 4000
+335.273760 4000.00 4000
+335.433760 4000.00 4000
+335.593760 4000.00 4000
+335.753760 4000.00 4000
+335.913760 4000.00 4000
+336.073760 4000.00 4000
+336.233760 4000.00 4000
+336.393760 4000.00 4000
+336.553760 4000.00 4000
+336.713760 4000.00 4000
+336.873760 4000.00 4000
+337.033760 4000.00 4000
+337.193760 4000.00 4000
+337.353760 4000.00 4000
+337.513760 4000.00 4000
+337.673760 4000.00 4000
+337.833760 4000.00 4000
+337.993760 4000.00 4000
+338.153760 4000.00 4000
+338.313760 4000.00 4000
+338.473760 4000.00 4000
+338.633760 4000.00 4000
+338.793760 4000.00 4000
+338.953760 4000.00 4000
+339.113760 4000.00 4000
+339.273760 4000.00 4000
+339.433760 4000.00 4000
+339.593760 4000.00 4000
+339.753760 4000.00 4000
+339.913760 4000.00 4000
+340.073760 4000.00 4000
+340.233760 4000.00 4000
+340.393760 4000.00 4000
+340.553760 4000.00 4000
+340.713760 4000.00 4000
+340.873760 4000.00 4000
+341.033760 4000.00 4000
+341.193760 4000.00 4000
+341.353760 4000.00 4000
+341.513760 4000.00 4000
+341.673760 4000.00 4000
+341.833760 4000.00 4000
+341.993760 4000.00 4000
+342.153760 4000.00 4000
+342.313760 4000.00 4000
+342.473760 4000.00 4000
+342.633760 4000.00 4000
+342.793760 4000.00 4000
+342.953760 4000.00 4000
+343.113760 4000.00 4000
+343.273760 4000.00 4000
+343.433760 4000.00 4000
+343.593760 4000.00 4000
+343.753760 4000.00 4000
+343.913760 4000.00 4000
+344.073760 4000.00 4000
+344.233760 4000.00 4000
+344.393760 4000.00 4000
+344.553760 4000.00 4000
+344.713760 4000.00 4000
+344.873760 4000.00 4000
+345.033760 4000.00 4000
+345.193760 4000.00 4000
+345.353760 4000.00 4000
+345.513760 4000.00 4000
+345.673760 4000.00 4000
+345.833760 4000.00 4000
+345.993760 4000.00 4000
+346.153760 4000.00 4000
+346.313760 4000.00 4000
+346.473760 4000.00 4000
+346.633760 4000.00 4000
+346.793760 4000.00 4000
+346.953760 4000.00 4000
+347.113760 4000.00 4000
+347.273760 4000.00 4000
+347.433760 4000.00 4000
+347.593760 4000.00 4000
+347.753760 4000.00 4000
+347.913760 4000.00 4000
+348.073760 4000.00 4000
+348.233760 4000.00 4000
+348.393760 4000.00 4000
+348.553760 4000.00 4000
+348.713760 4000.00 4000
+348.873760 4000.00 4000
+349.033760 4000.00 4000
+349.193760 4000.00 4000
+349.353760 4000.00 4000
+349.513760 4000.00 4000
+349.673760 4000.00 4000
+349.833760 4000.00 4000
+349.993760 4000.00 4000
+350.153760 4000.00 4000
+350.313760 4000.00 4000
+350.473760 4000.00 4000
+350.633760 4000.00 4000
+350.793760 4000.00 4000
+350.953760 4000.00 4000
+351.113760 4000.00 4000
+351.273760 4000.00 4000
+351.433760 4000.00 4000
+351.593760 4000.00 4000
+351.753760 4000.00 4000
+351.913760 4000.00 4000
+352.073760 4000.00 4000
+352.233760 4000.00 4000
+352.393760 4000.00 4000
+352.553760 4000.00 4000
+352.713760 4000.00 4000
+352.873760 4000.00 4000
+353.033760 4000.00 4000
+353.193760 4000.00 4000
+353.353760 4000.00 4000
+353.513760 4000.00 4000
+353.673760 4000.00 4000
+353.833760 4000.00 4000
+353.993760 4000.00 4000
+354.153760 4000.00 4000
+354.313760 4000.00 4000
+354.473760 4000.00 4000
+354.633760 4000.00 4000
+354.793760 4000.00 4000
+354.953760 4000.00 4000
+355.113760 4000.00 4000
+355.273760 4000.00 4000
+355.433760 4000.00 4000
+355.593760 4000.00 4000
+355.753760 4000.00 4000
+355.913760 4000.00 4000
+356.073760 4000.00 4000
+356.233760 4000.00 4000
+356.393760 4000.00 4000
+356.553760 4000.00 4000
+356.713760 4000.00 4000
+356.873760 4000.00 4000
+357.033760 4000.00 4000
+357.193760 4000.00 4000
+357.353760 4000.00 4000
+357.513760 4000.00 4000
+357.673760 4000.00 4000
+357.833760 4000.00 4000
+357.993760 4000.00 4000
+358.153760 4000.00 4000
+358.313760 4000.00 4000
+358.473760 4000.00 4000
+358.633760 4000.00 4000
+358.793760 4000.00 4000
+358.953760 4000.00 4000
+359.113760 4000.00 4000
+359.273760 4000.00 4000
+359.433760 4000.00 4000
+359.593760 4000.00 4000
+359.753760 4000.00 4000
+359.913760 4000.00 4000
+360.073760 4000.00 4000
+360.233760 4000.00 4000
+360.393760 4000.00 4000
+360.553760 4000.00 4000
+360.713760 4000.00 4000
+360.873760 4000.00 4000
+361.033760 4000.00 4000
+361.193760 4000.00 4000
+361.353760 4000.00 4000
+361.513760 4000.00 4000
+361.673760 4000.00 4000
+361.833760 4000.00 4000
+361.993760 4000.00 4000
+362.153760 4000.00 4000
+362.313760 4000.00 4000
+362.473760 4000.00 4000
+362.633760 4000.00 4000
+362.793760 4000.00 4000
+362.953760 4000.00 4000
+363.113760 4000.00 4000
+363.273760 4000.00 4000
+363.433760 4000.00 4000
+363.593760 4000.00 4000
+363.753760 4000.00 4000
+363.913760 4000.00 4000
+364.073760 4000.00 4000
+364.233760 4000.00 4000
+364.393760 4000.00 4000
+364.553760 4000.00 4000
+364.713760 4000.00 4000
+364.873760 4000.00 4000
+365.033760 4000.00 4000
+365.193760 4000.00 4000
+365.353760 4000.00 4000
+365.513760 4000.00 4000
+365.673760 4000.00 4000
+365.833760 4000.00 4000
+365.993760 4000.00 4000
+366.153760 4000.00 4000
+366.313760 4000.00 4000
+366.473760 4000.00 4000
+366.633760 4000.00 4000
+366.793760 4000.00 4000
+366.953760 4000.00 4000
+367.113760 4000.00 4000
+367.273760 4000.00 4000
+367.433760 4000.00 4000
+367.593760 4000.00 4000
+367.753760 4000.00 4000
+367.913760 4000.00 4000
+368.073760 4000.00 4000
+368.233760 4000.00 4000
+368.393760 4000.00 4000
+368.553760 4000.00 4000
+368.713760 4000.00 4000
+368.873760 4000.00 4000
+369.033760 4000.00 4000
+369.193760 4000.00 4000
+369.353760 4000.00 4000
+369.513760 4000.00 4000
+369.673760 4000.00 4000
+369.833760 4000.00 4000
+369.993760 4000.00 4000
+370.153760 4000.00 4000
+370.313760 4000.00 4000
+370.473760 4000.00 4000
+370.633760 4000.00 4000
+370.793760 4000.00 4000
+370.953760 4000.00 4000
+371.113760 4000.00 4000
+371.273760 4000.00 4000
+371.433760 4000.00 4000
+371.593760 4000.00 4000
+371.753760 4000.00 4000
+371.913760 4000.00 4000
+372.073760 4000.00 4000
+372.233760 4000.00 4000
+372.393760 4000.00 4000
+372.553760 4000.00 4000
+372.713760 4000.00 4000
+372.873760 4000.00 4000
+373.033760 4000.00 4000
+373.193760 4000.00 4000
+373.353760 4000.00 4000
+373.513760 4000.00 4000
+373.673760 4000.00 4000
+373.833760 4000.00 4000
+373.993760 4000.00 4000
+374.153760 4000.00 4000
+374.313760 4000.00 4000
+374.473760 4000.00 4000
+374.633760 4000.00 4000
+374.793760 4000.00 4000
+374.953760 4000.00 4000
+375.113760 4000.00 4000
+375.273760 4000.00 4000
+375.433760 4000.00 4000
+375.593760 4000.00 4000
+375.753760 4000.00 4000
+375.913760 4000.00 4000
+376.073760 4000.00 4000
+376.233760 4000.00 4000
+376.393760 4000.00 4000
+376.553760 4000.00 4000
+376.713760 4000.00 4000
+376.873760 4000.00 4000
+377.033760 4000.00 4000
+377.193760 4000.00 4000
+377.353760 4000.00 4000
+377.513760 4000.00 4000
+377.673760 4000.00 4000
+377.833760 4000.00 4000
+377.993760 4000.00 4000
+378.153760 4000.00 4000
+378.313760 4000.00 4000
+378.473760 4000.00 4000
+378.633760 4000.00 4000
+378.793760 4000.00 4000
+378.953760 4000.00 4000
+379.113760 4000.00 4000
+379.273760 4000.00 4000
+379.433760 4000.00 4000
+379.593760 4000.00 4000
+379.753760 4000.00 4000
+379.913760 4000.00 4000
+380.073760 4000.00 4000
+380.233760 4000.00 4000
+380.393760 4000.00 4000
+380.553760 4000.00 4000
+380.713760 4000.00 4000
+380.873760 4000.00 4000
+381.033760 4000.00 4000
+381.193760 4000.00 4000
+381.353760 4000.00 4000
+381.513760 4000.00 4000
+381.673760 4000.00 4000
+381.833760 4000.00 4000
+381.993760 4000.00 4000
+382.153760 4000.00 4000
+382.313760 4000.00 4000
+382.473760 4000.00 4000
+382.633760 4000.00 4000
+382.793760 4000.00 4000
+382.953760 4000.00 4000
+383.113760 4000.00 4000
+383.273760 4000.00 4000
+383.433760 4000.00 4000
+383.593760 4000.00 4000
+383.753760 4000.00 4000
+383.913760 4000.00 4000
+384.073760 4000.00 4000
+384.233760 4000.00 4000
+384.393760 4000.00 4000
+384.553760 4000.00 4000
+384.713760 4000.00 4000
+384.873760 4000.00 4000
+385.033760 4000.00 4000
+385.193760 4000.00 4000
+385.353760 4000.00 4000
+385.513760 4000.00 4000
+385.673760 4000.00 4000
+385.833760 4000.00 4000
+385.993760 4000.00 4000
+386.153760 4000.00 4000
+386.313760 4000.00 4000
+386.473760 4000.00 4000
+386.633760 4000.00 4000
+386.793760 4000.00 4000
+386.953760 4000.00 4000
+387.113760 4000.00 4000
+387.273760 4000.00 4000
+387.433760 4000.00 4000
+387.593760 4000.00 4000
+387.753760 4000.00 4000
+387.913760 4000.00 4000
+388.073760 4000.00 4000
+388.233760 4000.00 4000
+388.393760 4000.00 4000
+388.553760 4000.00 4000
+388.713760 4000.00 4000
+388.873760 4000.00 4000
+389.033760 4000.00 4000
+389.193760 4000.00 4000
+389.353760 4000.00 4000
+389.513760 4000.00 4000
+389.673760 4000.00 4000
+389.833760 4000.00 4000
+389.993760 4000.00 4000
+390.153760 4000.00 4000
+390.313760 4000.00 4000
+390.473760 4000.00 4000
+390.633760 4000.00 4000
+390.793760 4000.00 4000
+390.953760 4000.00 4000
+391.113760 4000.00 4000
+391.273760 4000.00 4000
+391.433760 4000.00 4000
+391.593760 4000.00 4000
+391.753760 4000.00 4000
+391.913760 4000.00 4000
+392.073760 4000.00 4000
+392.233760 4000.00 4000
+392.393760 4000.00 4000
+392.553760 4000.00 4000
+392.713760 4000.00 4000
+392.873760 4000.00 4000
+393.033760 4000.00 4000
+393.193760 4000.00 4000
+393.353760 4000.00 4000
+393.513760 4000.00 4000
+393.673760 4000.00 4000
+393.833760 4000.00 4000
+393.993760 4000.00 4000
+394.153760 4000.00 4000
+394.313760 4000.00 4000
+394.473760 4000.00 4000
+394.633760 4000.00 4000
+394.793760 4000.00 4000
+394.953760 4000.00 4000
+395.113760 4000.00 4000
+395.273760 4000.00 4000
+395.433760 4000.00 4000
+395.593760 4000.00 4000
+395.753760 4000.00 4000
+395.913760 4000.00 4000
+396.073760 4000.00 4000
+396.233760 4000.00 4000
+396.393760 4000.00 4000
+396.553760 4000.00 4000
+396.713760 4000.00 4000
+396.873760 4000.00 4000
+397.033760 4000.00 4000
+397.193760 4000.00 4000
+397.353760 4000.00 4000
+397.513760 4000.00 4000
+397.673760 4000.00 4000
+397.833760 4000.00 4000
+397.993760 4000.00 4000
+398.153760 4000.00 4000
+398.313760 4000.00 4000
+398.473760 4000.00 4000
+398.633760 4000.00 4000
+398.793760 4000.00 4000
+398.953760 4000.00 4000
+399.113760 4000.00 4000
+399.273760 4000.00 4000
+399.433760 4000.00 4000
+399.593760 4000.00 4000
+399.753760 4000.00 4000
+399.913760 4000.00 4000
+400.073760 4000.00 4000
+400.233760 4000.00 4000
+400.393760 4000.00 4000
+400.553760 4000.00 4000
+400.713760 4000.00 4000
+400.873760 4000.00 4000
+401.033760 4000.00 4000
+401.193760 4000.00 4000
+401.353760 4000.00 4000
+401.513760 4000.00 4000
+401.673760 4000.00 4000
+401.833760 4000.00 4000
+401.993760 4000.00 4000
+402.153760 4000.00 4000
+402.313760 4000.00 4000
+402.473760 4000.00 4000
+402.633760 4000.00 4000
+402.793760 4000.00 4000
+402.953760 4000.00 4000
+403.113760 4000.00 4000
+403.273760 4000.00 4000
+403.433760 4000.00 4000
+403.593760 4000.00 4000
+403.753760 4000.00 4000
+403.913760 4000.00 4000
+404.073760 4000.00 4000
+404.233760 4000.00 4000
+404.393760 4000.00 4000
+404.553760 4000.00 4000
+404.713760 4000.00 4000
+404.873760 4000.00 4000
+405.033760 4000.00 4000
+405.193760 4000.00 4000
+405.353760 4000.00 4000
+405.513760 4000.00 4000
+405.673760 4000.00 4000
+405.833760 4000.00 4000
+405.993760 4000.00 4000
+406.153760 4000.00 4000
+406.313760 4000.00 4000
+406.473760 4000.00 4000
+406.633760 4000.00 4000
+406.793760 4000.00 4000
+406.953760 4000.00 4000
+407.113760 4000.00 4000
+407.273760 4000.00 4000
+407.433760 4000.00 4000
+407.593760 4000.00 4000
+407.753760 4000.00 4000
+407.913760 4000.00 4000
+408.073760 4000.00 4000
+408.233760 4000.00 4000
+408.393760 4000.00 4000
+408.553760 4000.00 4000
+408.713760 4000.00 4000
+408.873760 4000.00 4000
+409.033760 4000.00 4000
+409.193760 4000.00 4000
+409.353760 4000.00 4000
+409.513760 4000.00 4000
+409.673760 4000.00 4000
+409.833760 4000.00 4000
+409.993760 4000.00 4000
+410.153760 4000.00 4000
+410.313760 4000.00 4000
+410.473760 4000.00 4000
+410.633760 4000.00 4000
+410.793760 4000.00 4000
+410.953760 4000.00 4000
+411.113760 4000.00 4000
+411.273760 4000.00 4000
+411.433760 4000.00 4000
+411.593760 4000.00 4000
+411.753760 4000.00 4000
+411.913760 4000.00 4000
+412.073760 4000.00 4000
+412.233760 4000.00 4000
+412.393760 4000.00 4000
+412.553760 4000.00 4000
+412.713760 4000.00 4000
+412.873760 4000.00 4000
+413.033760 4000.00 4000
+413.193760 4000.00 4000
+413.353760 4000.00 4000
+413.513760 4000.00 4000
+413.673760 4000.00 4000
+413.833760 4000.00 4000
+413.993760 4000.00 4000
+414.153760 4000.00 4000
+414.313760 4000.00 4000
+414.473760 4000.00 4000
+414.633760 4000.00 4000
+414.793760 4000.00 4000
+414.953760 4000.00 4000
+415.113760 4000.00 4000
+415.273760 4000.00 4000
+415.433760 4000.00 4000
+415.593760 4000.00 4000
+415.753760 4000.00 4000
+415.913760 4000.00 4000
+416.073760 4000.00 4000
+416.233760 4000.00 4000
+416.393760 4000.00 4000
+416.553760 4000.00 4000
+416.713760 4000.00 4000
+416.873760 4000.00 4000
+417.033760 4000.00 4000
+417.193760 4000.00 4000
+417.353760 4000.00 4000
+417.513760 4000.00 4000
+417.673760 4000.00 4000
+417.833760 4000.00 4000
+417.993760 4000.00 4000
+418.153760 4000.00 4000
+418.313760 4000.00 4000
+418.473760 4000.00 4000
+418.633760 4000.00 4000
+418.793760 4000.00 4000
+418.953760 4000.00 4000
+419.113760 4000.00 4000
+419.273760 4000.00 4000
+419.433760 4000.00 4000
+419.593760 4000.00 4000
+419.753760 4000.00 4000
+419.913760 4000.00 4000
+420.073760 4000.00 4000
+420.233760 4000.00 4000
+420.393760 4000.00 4000
+420.553760 4000.00 4000
+420.713760 4000.00 4000
+420.873760 4000.00 4000
+421.033760 4000.00 4000
+421.193760 4000.00 4000
+421.353760 4000.00 4000
+421.513760 4000.00 4000
+421.673760 4000.00 4000
+421.833760 4000.00 4000
+421.993760 4000.00 4000
+422.153760 4000.00 4000
+422.313760 4000.00 4000
+422.473760 4000.00 4000
+422.633760 4000.00 4000
+422.793760 4000.00 4000
+422.953760 4000.00 4000
+423.113760 4000.00 4000
+423.273760 4000.00 4000
+423.433760 4000.00 4000
+423.593760 4000.00 4000
+423.753760 4000.00 4000
+423.913760 4000.00 4000
+424.073760 4000.00 4000
+424.233760 4000.00 4000
+424.393760 4000.00 4000
+424.553760 4000.00 4000
+424.713760 4000.00 4000
+424.873760 4000.00 4000
+425.033760 4000.00 4000
+425.193760 4000.00 4000
+425.353760 4000.00 4000
+425.513760 4000.00 4000
+425.673760 4000.00 4000
+425.833760 4000.00 4000
+425.993760 4000.00 4000
+426.153760 4000.00 4000
+426.313760 4000.00 4000
+426.473760 4000.00 4000
+426.633760 4000.00 4000
+426.793760 4000.00 4000
+426.953760 4000.00 4000
+427.113760 4000.00 4000
+427.273760 4000.00 4000
+427.433760 4000.00 4000
+427.593760 4000.00 4000
+427.753760 4000.00 4000
+427.913760 4000.00 4000
+428.073760 4000.00 4000
+428.233760 4000.00 4000
+428.393760 4000.00 4000
+428.553760 4000.00 4000
+428.713760 4000.00 4000
+428.873760 4000.00 4000
+429.033760 4000.00 4000
+429.193760 4000.00 4000
+429.353760 4000.00 4000
+429.513760 4000.00 4000
+429.673760 4000.00 4000
+429.833760 4000.00 4000
+429.993760 4000.00 4000
+430.153760 4000.00 4000
+430.313760 4000.00 4000
+430.473760 4000.00 4000
+430.633760 4000.00 4000
+430.793760 4000.00 4000
+430.953760 4000.00 4000
+431.113760 4000.00 4000
+431.273760 4000.00 4000
+431.433760 4000.00 4000
+431.593760 4000.00 4000
+431.753760 4000.00 4000
+431.913760 4000.00 4000
+432.073760 4000.00 4000
+432.233760 4000.00 4000
+432.393760 4000.00 4000
+432.553760 4000.00 4000
+432.713760 4000.00 4000
+432.873760 4000.00 4000
+433.033760 4000.00 4000
+433.193760 4000.00 4000
+433.353760 4000.00 4000
+433.513760 4000.00 4000
+433.673760 4000.00 4000
+433.833760 4000.00 4000
+433.993760 4000.00 4000
+434.153760 4000.00 4000
+434.313760 4000.00 4000
+434.473760 4000.00 4000
+434.633760 4000.00 4000
+434.793760 4000.00 4000
+434.953760 4000.00 4000
+435.113760 4000.00 4000
+435.273760 4000.00 4000
+435.433760 4000.00 4000
+435.593760 4000.00 4000
+435.753760 4000.00 4000
+435.913760 4000.00 4000
+436.073760 4000.00 4000
+436.233760 4000.00 4000
+436.393760 4000.00 4000
+436.553760 4000.00 4000
+436.713760 4000.00 4000
+436.873760 4000.00 4000
+437.033760 4000.00 4000
+437.193760 4000.00 4000
+437.353760 4000.00 4000
+437.513760 4000.00 4000
+437.673760 4000.00 4000
+437.833760 4000.00 4000
+437.993760 4000.00 4000
+438.153760 4000.00 4000
+438.313760 4000.00 4000
+438.473760 4000.00 4000
+438.633760 4000.00 4000
+438.793760 4000.00 4000
+438.953760 4000.00 4000
+439.113760 4000.00 4000
+439.273760 4000.00 4000
+439.433760 4000.00 4000
+439.593760 4000.00 4000
+439.753760 4000.00 4000
+439.913760 4000.00 4000
+440.073760 4000.00 4000
+440.233760 4000.00 4000
+440.393760 4000.00 4000
+440.553760 4000.00 4000
+440.713760 4000.00 4000
+440.873760 4000.00 4000
+441.033760 4000.00 4000
+441.193760 4000.00 4000
+441.353760 4000.00 4000
+441.513760 4000.00 4000
+441.673760 4000.00 4000
+441.833760 4000.00 4000
+441.993760 4000.00 4000
+442.153760 4000.00 4000
+442.313760 4000.00 4000
+442.473760 4000.00 4000
+442.633760 4000.00 4000
+442.793760 4000.00 4000
+442.953760 4000.00 4000
+443.113760 4000.00 4000
+443.273760 4000.00 4000
+443.433760 4000.00 4000
+443.593760 4000.00 4000
+443.753760 4000.00 4000
+443.913760 4000.00 4000
+444.073760 4000.00 4000
+444.233760 4000.00 4000
+444.393760 4000.00 4000
+444.553760 4000.00 4000
+444.713760 4000.00 4000
+444.873760 4000.00 4000
+445.033760 4000.00 4000
+445.193760 4000.00 4000
+445.353760 4000.00 4000
+445.513760 4000.00 4000
+445.673760 4000.00 4000
+445.833760 4000.00 4000
+445.993760 4000.00 4000
+446.153760 4000.00 4000
+446.313760 4000.00 4000
+446.473760 4000.00 4000
+446.633760 4000.00 4000
+446.793760 4000.00 4000
+446.953760 4000.00 4000
+447.113760 4000.00 4000
+447.273760 4000.00 4000
+447.433760 4000.00 4000
+447.593760 4000.00 4000
+447.753760 4000.00 4000
+447.913760 4000.00 4000
+448.073760 4000.00 4000
+448.233760 4000.00 4000
+448.393760 4000.00 4000
+448.553760 4000.00 4000
+448.713760 4000.00 4000
+448.873760 4000.00 4000
+449.033760 4000.00 4000
+449.193760 4000.00 4000
+449.353760 4000.00 4000
+449.513760 4000.00 4000
+449.673760 4000.00 4000
+449.833760 4000.00 4000
+449.993760 4000.00 4000
+450.153760 4000.00 4000
+450.313760 4000.00 4000
+450.473760 4000.00 4000
+450.633760 4000.00 4000
+450.793760 4000.00 4000
+450.953760 4000.00 4000
+451.113760 4000.00 4000
+451.273760 4000.00 4000
+451.433760 4000.00 4000
+451.593760 4000.00 4000
+451.753760 4000.00 4000
+451.913760 4000.00 4000
+452.073760 4000.00 4000
+452.233760 4000.00 4000
+452.393760 4000.00 4000
+452.553760 4000.00 4000
+452.713760 4000.00 4000
+452.873760 4000.00 4000
+453.033760 4000.00 4000
+453.193760 4000.00 4000
+453.353760 4000.00 4000
+453.513760 4000.00 4000
+453.673760 4000.00 4000
+453.833760 4000.00 4000
+453.993760 4000.00 4000
+454.153760 4000.00 4000
+454.313760 4000.00 4000
+454.473760 4000.00 4000
+454.633760 4000.00 4000
+454.793760 4000.00 4000
+454.953760 4000.00 4000
+455.113760 4000.00 4000
+455.273760 4000.00 4000
+455.433760 4000.00 4000
+455.593760 4000.00 4000
+455.753760 4000.00 4000
+455.913760 4000.00 4000
+456.073760 4000.00 4000
+456.233760 4000.00 4000
+456.393760 4000.00 4000
+456.553760 4000.00 4000
+456.713760 4000.00 4000
+456.873760 4000.00 4000
+457.033760 4000.00 4000
+457.193760 4000.00 4000
+457.353760 4000.00 4000
+457.513760 4000.00 4000
+457.673760 4000.00 4000
+457.833760 4000.00 4000
+457.993760 4000.00 4000
+458.153760 4000.00 4000
+458.313760 4000.00 4000
+458.473760 4000.00 4000
+458.633760 4000.00 4000
+458.793760 4000.00 4000
+458.953760 4000.00 4000
+459.113760 4000.00 4000
+459.273760 4000.00 4000
+459.433760 4000.00 4000
+459.593760 4000.00 4000
+459.753760 4000.00 4000
+459.913760 4000.00 4000
+460.073760 4000.00 4000
+460.233760 4000.00 4000
+460.393760 4000.00 4000
+460.553760 4000.00 4000
+460.713760 4000.00 4000
+460.873760 4000.00 4000
+461.033760 4000.00 4000
+461.193760 4000.00 4000
+461.353760 4000.00 4000
+461.513760 4000.00 4000
+461.673760 4000.00 4000
+461.833760 4000.00 4000
+461.993760 4000.00 4000
+462.153760 4000.00 4000
+462.313760 4000.00 4000
+462.473760 4000.00 4000
+462.633760 4000.00 4000
+462.793760 4000.00 4000
+462.953760 4000.00 4000
+463.113760 4000.00 4000
+463.273760 4000.00 4000
+463.433760 4000.00 4000
+463.593760 4000.00 4000
+463.753760 4000.00 4000
+463.913760 4000.00 4000
+464.073760 4000.00 4000
+464.233760 4000.00 4000
+464.393760 4000.00 4000
+464.553760 4000.00 4000
+464.713760 4000.00 4000
+464.873760 4000.00 4000
+465.033760 4000.00 4000
+465.193760 4000.00 4000
+465.353760 4000.00 4000
+465.513760 4000.00 4000
+465.673760 4000.00 4000
+465.833760 4000.00 4000
+465.993760 4000.00 4000
+466.153760 4000.00 4000
+466.313760 4000.00 4000
+466.473760 4000.00 4000
+466.633760 4000.00 4000
+466.793760 4000.00 4000
+466.953760 4000.00 4000
+467.113760 4000.00 4000
+467.273760 4000.00 4000
+467.433760 4000.00 4000
+467.593760 4000.00 4000
+467.753760 4000.00 4000
+467.913760 4000.00 4000
+468.073760 4000.00 4000
+468.233760 4000.00 4000
+468.393760 4000.00 4000
+468.553760 4000.00 4000
+468.713760 4000.00 4000
+468.873760 4000.00 4000
+469.033760 4000.00 4000
+469.193760 4000.00 4000
+469.353760 4000.00 4000
+469.513760 4000.00 4000
+469.673760 4000.00 4000
+469.833760 4000.00 4000
+469.993760 4000.00 4000
+470.153760 4000.00 4000
+470.313760 4000.00 4000
+470.473760 4000.00 4000
+470.633760 4000.00 4000
+470.793760 4000.00 4000
+470.953760 4000.00 4000
+471.113760 4000.00 4000
+471.273760 4000.00 4000
+471.433760 4000.00 4000
+471.593760 4000.00 4000
+471.753760 4000.00 4000
+471.913760 4000.00 4000
+472.073760 4000.00 4000
+472.233760 4000.00 4000
+472.393760 4000.00 4000
+472.553760 4000.00 4000
+472.713760 4000.00 4000
+472.873760 4000.00 4000
+473.033760 4000.00 4000
+473.193760 4000.00 4000
+473.353760 4000.00 4000
+473.513760 4000.00 4000
+473.673760 4000.00 4000
+473.833760 4000.00 4000
+473.993760 4000.00 4000
+474.153760 4000.00 4000
+474.313760 4000.00 4000
+474.473760 4000.00 4000
+474.633760 4000.00 4000
+474.793760 4000.00 4000
+474.953760 4000.00 4000
+475.113760 4000.00 4000
+475.273760 4000.00 4000
+475.433760 4000.00 4000
+475.593760 4000.00 4000
+475.753760 4000.00 4000
+475.913760 4000.00 4000
+476.073760 4000.00 4000
+476.233760 4000.00 4000
+476.393760 4000.00 4000
+476.553760 4000.00 4000
+476.713760 4000.00 4000
+476.873760 4000.00 4000
+477.033760 4000.00 4000
+477.193760 4000.00 4000
+477.353760 4000.00 4000
+477.513760 4000.00 4000
+477.673760 4000.00 4000
+477.833760 4000.00 4000
+477.993760 4000.00 4000
+478.153760 4000.00 4000
+478.313760 4000.00 4000
+478.473760 4000.00 4000
+478.633760 4000.00 4000
+478.793760 4000.00 4000
+478.953760 4000.00 4000
+479.113760 4000.00 4000
+479.273760 4000.00 4000
+479.433760 4000.00 4000
+479.593760 4000.00 4000
+479.753760 4000.00 4000
+479.913760 4000.00 4000
+480.073760 4000.00 4000
+480.233760 4000.00 4000
+480.393760 4000.00 4000
+480.553760 4000.00 4000
+480.713760 4000.00 4000
+480.873760 4000.00 4000
+481.033760 4000.00 4000
+481.193760 4000.00 4000
+481.353760 4000.00 4000
+481.513760 4000.00 4000
+481.673760 4000.00 4000
+481.833760 4000.00 4000
+481.993760 4000.00 4000
+482.153760 4000.00 4000
+482.313760 4000.00 4000
+482.473760 4000.00 4000
+482.633760 4000.00 4000
+482.793760 4000.00 4000
+482.953760 4000.00 4000
+483.113760 4000.00 4000
+483.273760 4000.00 4000
+483.433760 4000.00 4000
+483.593760 4000.00 4000
+483.753760 4000.00 4000
+483.913760 4000.00 4000
+484.073760 4000.00 4000
+484.233760 4000.00 4000
+484.393760 4000.00 4000
+484.553760 4000.00 4000
+484.713760 4000.00 4000
+484.873760 4000.00 4000
+485.033760 4000.00 4000
+485.193760 4000.00 4000
+485.353760 4000.00 4000
+485.513760 4000.00 4000
+485.673760 4000.00 4000
+485.833760 4000.00 4000
+485.993760 4000.00 4000
+486.153760 4000.00 4000
+486.313760 4000.00 4000
+486.473760 4000.00 4000
+486.633760 4000.00 4000
+486.793760 4000.00 4000
+486.953760 4000.00 4000
+487.113760 4000.00 4000
+487.273760 4000.00 4000
+487.433760 4000.00 4000
+487.593760 4000.00 4000
+487.753760 4000.00 4000
+487.913760 4000.00 4000
+488.073760 4000.00 4000
+488.233760 4000.00 4000
+488.393760 4000.00 4000
+488.553760 4000.00 4000
+488.713760 4000.00 4000
+488.873760 4000.00 4000
+489.033760 4000.00 4000
+489.193760 4000.00 4000
+489.353760 4000.00 4000
+489.513760 4000.00 4000
+489.673760 4000.00 4000
+489.833760 4000.00 4000
+489.993760 4000.00 4000
+490.153760 4000.00 4000
+490.313760 4000.00 4000
+490.473760 4000.00 4000
+490.633760 4000.00 4000
+490.793760 4000.00 4000
+490.953760 4000.00 4000
+491.113760 4000.00 4000
+491.273760 4000.00 4000
+491.433760 4000.00 4000
+491.593760 4000.00 4000
+491.753760 4000.00 4000
+491.913760 4000.00 4000
+492.073760 4000.00 4000
+492.233760 4000.00 4000
+492.393760 4000.00 4000
+492.553760 4000.00 4000
+492.713760 4000.00 4000
+492.873760 4000.00 4000
+493.033760 4000.00 4000
+493.193760 4000.00 4000
+493.353760 4000.00 4000
+493.513760 4000.00 4000
+493.673760 4000.00 4000
+493.833760 4000.00 4000
+493.993760 4000.00 4000
+494.153760 4000.00 4000
+494.313760 4000.00 4000
+494.473760 4000.00 4000
+494.633760 4000.00 4000
+494.793760 4000.00 4000
+494.953760 4000.00 4000
+495.113760 4000.00 4000
+495.273760 4000.00 4000
+495.433760 4000.00 4000
+495.593760 4000.00 4000
+495.753760 4000.00 4000
+495.913760 4000.00 4000
+496.073760 4000.00 4000
+496.233760 4000.00 4000
+496.393760 4000.00 4000
+496.553760 4000.00 4000
+496.713760 4000.00 4000
+496.873760 4000.00 4000
+497.033760 4000.00 4000
+497.193760 4000.00 4000
+497.353760 4000.00 4000
+497.513760 4000.00 4000
+497.673760 4000.00 4000
+497.833760 4000.00 4000
+497.993760 4000.00 4000
+498.153760 4000.00 4000
+498.313760 4000.00 4000
+498.473760 4000.00 4000
+498.633760 4000.00 4000
+498.793760 4000.00 4000
+498.953760 4000.00 4000
+499.113760 4000.00 4000
+499.273760 4000.00 4000
+499.433760 4000.00 4000
+499.593760 4000.00 4000
+499.753760 4000.00 4000
+499.913760 4000.00 4000
+500.073760 4000.00 4000
+500.233760 4000.00 4000
+500.393760 4000.00 4000
+500.553760 4000.00 4000
+500.713760 4000.00 4000
+500.873760 4000.00 4000
+501.033760 4000.00 4000
+501.193760 4000.00 4000
+501.353760 4000.00 4000
+501.513760 4000.00 4000
+501.673760 4000.00 4000
+501.833760 4000.00 4000
+501.993760 4000.00 4000
+502.153760 4000.00 4000
+502.313760 4000.00 4000
+502.473760 4000.00 4000
+502.633760 4000.00 4000
+502.793760 4000.00 4000
+502.953760 4000.00 4000
+503.113760 4000.00 4000
+503.273760 4000.00 4000
+503.433760 4000.00 4000
+503.593760 4000.00 4000
+503.753760 4000.00 4000
+503.913760 4000.00 4000
+504.073760 4000.00 4000
+504.233760 4000.00 4000
+504.393760 4000.00 4000
+504.553760 4000.00 4000
+504.713760 4000.00 4000
+504.873760 4000.00 4000
+505.033760 4000.00 4000
+505.193760 4000.00 4000
+505.353760 4000.00 4000
+505.513760 4000.00 4000
+505.673760 4000.00 4000
+505.833760 4000.00 4000
+505.993760 4000.00 4000
+506.153760 4000.00 4000
+506.313760 4000.00 4000
+506.473760 4000.00 4000
+506.633760 4000.00 4000
+506.793760 4000.00 4000
+506.953760 4000.00 4000
+507.113760 4000.00 4000
+507.273760 4000.00 4000
+507.433760 4000.00 4000
+507.593760 4000.00 4000
+507.753760 4000.00 4000
+507.913760 4000.00 4000
+508.073760 4000.00 4000
+508.233760 4000.00 4000
+508.393760 4000.00 4000
+508.553760 4000.00 4000
+508.713760 4000.00 4000
+508.873760 4000.00 4000
+509.033760 4000.00 4000
+509.193760 4000.00 4000
+509.353760 4000.00 4000
+509.513760 4000.00 4000
+509.673760 4000.00 4000
+509.833760 4000.00 4000
+509.993760 4000.00 4000
+510.153760 4000.00 4000
+510.313760 4000.00 4000
+510.473760 4000.00 4000
+510.633760 4000.00 4000
+510.793760 4000.00 4000
+510.953760 4000.00 4000
+511.113760 4000.00 4000
+511.273760 4000.00 4000
+511.433760 4000.00 4000
+511.529760 4000.00 4000
+511.545824 3984.06 4016
+511.557872 3984.06 4016
+511.569920 3984.06 4016
+511.581968 3984.06 4016
+511.594016 3984.06 4016
+511.606064 3984.06 4016
+511.618112 3984.06 4016
+511.630160 3984.06 4016
+511.642208 3984.06 4016
+511.654256 3984.06 4016
+511.666304 3984.06 4016
+511.678352 3984.06 4016
+511.690400 3984.06 4016
+511.702448 3984.06 4016
+511.714496 3984.06 4016
+511.726544 3984.06 4016
+511.738592 3984.06 4016
+511.750640 3984.06 4016
+511.762688 3984.06 4016
+511.774736 3984.06 4016
+511.786784 3984.06 4016
+511.798880 3968.25 4032
+511.810976 3968.25 4032
+511.823072 3968.25 4032
+511.835168 3968.25 4032
+511.847264 3968.25 4032
+511.859360 3968.25 4032
+511.871456 3968.25 4032
+511.883552 3968.25 4032
+511.895648 3968.25 4032
+511.907744 3968.25 4032
+511.919840 3968.25 4032
+511.931936 3968.25 4032
+511.944032 3968.25 4032
+511.956128 3968.25 4032
+511.968224 3968.25 4032
+511.980320 3968.25 4032
+511.992416 3968.25 4032
+512.004512 3968.25 4032
+512.016608 3968.25 4032
+512.028704 3968.25 4032
+512.040800 3968.25 4032
+512.052896 3968.25 4032
+512.064992 3968.25 4032
+512.077088 3968.25 4032
+512.089184 3968.25 4032
+512.101280 3968.25 4032
+512.113376 3968.25 4032
+512.125472 3968.25 4032
+512.137568 3968.25 4032
+512.149664 3968.25 4032
+512.161760 3968.25 4032
+512.173856 3968.25 4032
+512.186048 3937.01 4064
+512.198240 3937.01 4064
+512.210432 3937.01 4064
+512.222624 3937.01 4064
+512.234816 3937.01 4064
+512.247008 3937.01 4064
+512.259200 3937.01 4064
+512.271392 3937.01 4064
+512.283584 3937.01 4064
+512.295776 3937.01 4064
+512.307968 3937.01 4064
+512.320160 3937.01 4064
+512.332352 3937.01 4064
+512.344544 3937.01 4064
+512.356736 3937.01 4064
+512.368928 3937.01 4064
+512.381120 3937.01 4064
+512.393312 3937.01 4064
+512.405504 3937.01 4064
+512.417696 3937.01 4064
+512.429888 3937.01 4064
+512.442080 3937.01 4064
+512.454272 3937.01 4064
+512.466464 3937.01 4064
+512.478656 3937.01 4064
+512.490848 3937.01 4064
+512.503040 3937.01 4064
+512.515232 3937.01 4064
+512.527424 3937.01 4064
+512.539616 3937.01 4064
+512.551808 3937.01 4064
+512.564000 3937.01 4064
+512.576240 3921.57 4080
+512.588480 3921.57 4080
+512.600720 3921.57 4080
+512.612960 3921.57 4080
+512.625200 3921.57 4080
+512.637440 3921.57 4080
+512.649680 3921.57 4080
+512.661920 3921.57 4080
+512.674160 3921.57 4080
+512.686400 3921.57 4080
+512.698640 3921.57 4080
+512.710880 3921.57 4080
+512.723120 3921.57 4080
+512.735360 3921.57 4080
+512.747600 3921.57 4080
+512.759840 3921.57 4080
+512.772080 3921.57 4080
+512.784320 3921.57 4080
+512.796560 3921.57 4080
+512.808800 3921.57 4080
+512.821040 3921.57 4080
+512.833328 3906.25 4096
+512.845616 3906.25 4096
+512.857904 3906.25 4096
+512.870192 3906.25 4096
+512.882480 3906.25 4096
+512.894768 3906.25 4096
+512.907056 3906.25 4096
+512.919344 3906.25 4096
+512.931632 3906.25 4096
+512.943920 3906.25 4096
+512.956208 3906.25 4096
+512.968496 3906.25 4096
+512.980784 3906.25 4096
+512.993072 3906.25 4096
+513.005360 3906.25 4096
+513.017648 3906.25 4096
+513.029936 3906.25 4096
+513.042224 3906.25 4096
+513.054512 3906.25 4096
+513.066800 3906.25 4096
+513.079088 3906.25 4096
+513.091376 3906.25 4096
+513.103664 3906.25 4096
+513.115952 3906.25 4096
+513.128240 3906.25 4096
+513.140528 3906.25 4096
+513.152816 3906.25 4096
+513.165104 3906.25 4096
+513.177392 3906.25 4096
+513.189680 3906.25 4096
+513.201968 3906.25 4096
+513.214256 3906.25 4096
+513.226640 3875.97 4128
+513.239024 3875.97 4128
+513.251408 3875.97 4128
+513.263792 3875.97 4128
+513.276176 3875.97 4128
+513.288560 3875.97 4128
+513.300944 3875.97 4128
+513.313328 3875.97 4128
+513.325712 3875.97 4128
+513.338096 3875.97 4128
+513.350480 3875.97 4128
+513.362864 3875.97 4128
+513.375248 3875.97 4128
+513.387632 3875.97 4128
+513.400016 3875.97 4128
+513.412400 3875.97 4128
+513.424784 3875.97 4128
+513.437168 3875.97 4128
+513.449552 3875.97 4128
+513.461936 3875.97 4128
+513.474320 3875.97 4128
+513.486704 3875.97 4128
+513.499088 3875.97 4128
+513.511472 3875.97 4128
+513.523856 3875.97 4128
+513.536240 3875.97 4128
+513.548624 3875.97 4128
+513.561008 3875.97 4128
+513.573392 3875.97 4128
+513.585776 3875.97 4128
+513.598160 3875.97 4128
+513.610544 3875.97 4128
+513.622928 3875.97 4128
+513.635312 3875.97 4128
+513.647696 3875.97 4128
+513.660080 3875.97 4128
+513.672464 3875.97 4128
+513.684848 3875.97 4128
+513.697232 3875.97 4128
+513.709616 3875.97 4128
+513.722000 3875.97 4128
+513.734384 3875.97 4128
+513.746768 3875.97 4128
+513.759152 3875.97 4128
+513.771536 3875.97 4128
+513.783920 3875.97 4128
+513.796304 3875.97 4128
+513.808688 3875.97 4128
+513.821072 3875.97 4128
+513.833456 3875.97 4128
+513.845840 3875.97 4128
+513.858224 3875.97 4128
+513.870608 3875.97 4128
+513.883088 3846.15 4160
+513.895568 3846.15 4160
+513.908048 3846.15 4160
+513.920528 3846.15 4160
+513.933008 3846.15 4160
+513.945488 3846.15 4160
+513.957968 3846.15 4160
+513.970448 3846.15 4160
+513.982928 3846.15 4160
+513.995408 3846.15 4160
+514.007888 3846.15 4160
+514.020368 3846.15 4160
+514.032848 3846.15 4160
+514.045328 3846.15 4160
+514.057808 3846.15 4160
+514.070288 3846.15 4160
+514.082768 3846.15 4160
+514.095248 3846.15 4160
+514.107728 3846.15 4160
+514.120208 3846.15 4160
+514.132688 3846.15 4160
+514.145168 3846.15 4160
+514.157744 3816.79 4192
+514.170320 3816.79 4192
+514.182896 3816.79 4192
+514.195472 3816.79 4192
+514.208048 3816.79 4192
+514.220624 3816.79 4192
+514.233200 3816.79 4192
+514.245776 3816.79 4192
+514.258352 3816.79 4192
+514.270928 3816.79 4192
+514.283504 3816.79 4192
+514.296080 3816.79 4192
+514.308656 3816.79 4192
+514.321232 3816.79 4192
+514.333808 3816.79 4192
+514.346384 3816.79 4192
+514.358960 3816.79 4192
+514.371536 3816.79 4192
+514.384112 3816.79 4192
+514.396688 3816.79 4192
+514.409264 3816.79 4192
+514.421840 3816.79 4192
+514.434416 3816.79 4192
+514.446992 3816.79 4192
+514.459568 3816.79 4192
+514.472144 3816.79 4192
+514.484720 3816.79 4192
+514.497296 3816.79 4192
+514.509872 3816.79 4192
+514.522448 3816.79 4192
+514.535024 3816.79 4192
+514.547600 3816.79 4192
+514.560272 3787.88 4224
+514.572944 3787.88 4224
+514.585616 3787.88 4224
+514.598288 3787.88 4224
+514.610960 3787.88 4224
+514.623632 3787.88 4224
+514.636304 3787.88 4224
+514.648976 3787.88 4224
+514.661648 3787.88 4224
+514.674320 3787.88 4224
+514.686992 3787.88 4224
+514.699664 3787.88 4224
+514.712336 3787.88 4224
+514.725008 3787.88 4224
+514.737680 3787.88 4224
+514.750352 3787.88 4224
+514.763024 3787.88 4224
+514.775696 3787.88 4224
+514.788368 3787.88 4224
+514.801040 3787.88 4224
+514.813712 3787.88 4224
+514.826384 3787.88 4224
+514.839056 3787.88 4224
+514.851728 3787.88 4224
+514.864400 3787.88 4224
+514.877072 3787.88 4224
+514.889744 3787.88 4224
+514.902416 3787.88 4224
+514.915088 3787.88 4224
+514.927760 3787.88 4224
+514.940432 3787.88 4224
+514.953104 3787.88 4224
+514.965776 3787.88 4224
+514.978448 3787.88 4224
+514.991120 3787.88 4224
+515.003792 3787.88 4224
+515.016464 3787.88 4224
+515.029136 3787.88 4224
+515.041808 3787.88 4224
+515.054480 3787.88 4224
+515.067152 3787.88 4224
+515.079824 3787.88 4224
+515.092496 3787.88 4224
+515.105168 3787.88 4224
+515.117840 3787.88 4224
+515.130512 3787.88 4224
+515.143184 3787.88 4224
+515.155856 3787.88 4224
+515.168528 3787.88 4224
+515.181200 3787.88 4224
+515.193872 3787.88 4224
+515.206544 3787.88 4224
+515.219216 3787.88 4224
+515.231984 3759.40 4256
+515.244752 3759.40 4256
+515.257520 3759.40 4256
+515.270288 3759.40 4256
+515.283056 3759.40 4256
+515.295824 3759.40 4256
+515.308592 3759.40 4256
+515.321360 3759.40 4256
+515.334128 3759.40 4256
+515.346896 3759.40 4256
+515.359664 3759.40 4256
+515.372432 3759.40 4256
+515.385200 3759.40 4256
+515.397968 3759.40 4256
+515.410736 3759.40 4256
+515.423504 3759.40 4256
+515.436272 3759.40 4256
+515.449040 3759.40 4256
+515.461808 3759.40 4256
+515.474576 3759.40 4256
+515.487344 3759.40 4256
+515.500208 3731.34 4288
+515.513072 3731.34 4288
+515.525936 3731.34 4288
+515.538800 3731.34 4288
+515.551664 3731.34 4288
+515.564528 3731.34 4288
+515.577392 3731.34 4288
+515.590256 3731.34 4288
+515.603120 3731.34 4288
+515.615984 3731.34 4288
+515.628848 3731.34 4288
+515.641712 3731.34 4288
+515.654576 3731.34 4288
+515.667440 3731.34 4288
+515.680304 3731.34 4288
+515.693168 3731.34 4288
+515.706032 3731.34 4288
+515.718896 3731.34 4288
+515.731760 3731.34 4288
+515.744624 3731.34 4288
+515.757488 3731.34 4288
+515.770352 3731.34 4288
+515.783312 3703.70 4320
+515.796272 3703.70 4320
+515.809232 3703.70 4320
+515.822192 3703.70 4320
+515.835152 3703.70 4320
+515.848112 3703.70 4320
+515.861072 3703.70 4320
+515.874032 3703.70 4320
+515.886992 3703.70 4320
+515.899952 3703.70 4320
+515.912912 3703.70 4320
+515.925872 3703.70 4320
+515.938832 3703.70 4320
+515.951792 3703.70 4320
+515.964752 3703.70 4320
+515.977712 3703.70 4320
+515.990672 3703.70 4320
+516.003632 3703.70 4320
+516.016592 3703.70 4320
+516.029552 3703.70 4320
+516.042512 3703.70 4320
+516.055472 3703.70 4320
+516.068432 3703.70 4320
+516.081392 3703.70 4320
+516.094352 3703.70 4320
+516.107312 3703.70 4320
+516.120272 3703.70 4320
+516.133232 3703.70 4320
+516.146192 3703.70 4320
+516.159152 3703.70 4320
+516.172112 3703.70 4320
+516.185072 3703.70 4320
+516.198032 3703.70 4320
+516.210992 3703.70 4320
+516.223952 3703.70 4320
+516.236912 3703.70 4320
+516.249872 3703.70 4320
+516.262832 3703.70 4320
+516.275792 3703.70 4320
+516.288752 3703.70 4320
+516.301712 3703.70 4320
+516.314672 3703.70 4320
+516.327632 3703.70 4320
+516.340592 3703.70 4320
+516.353552 3703.70 4320
+516.366512 3703.70 4320
+516.379472 3703.70 4320
+516.392432 3703.70 4320
+516.405392 3703.70 4320
+516.418352 3703.70 4320
+516.431312 3703.70 4320
+516.444272 3703.70 4320
+516.457232 3703.70 4320
+516.470288 3676.47 4352
+516.483344 3676.47 4352
+516.496400 3676.47 4352
+516.509456 3676.47 4352
+516.522512 3676.47 4352
+516.535568 3676.47 4352
+516.548624 3676.47 4352
+516.561680 3676.47 4352
+516.574736 3676.47 4352
+516.587792 3676.47 4352
+516.600848 3676.47 4352
+516.613904 3676.47 4352
+516.626960 3676.47 4352
+516.640016 3676.47 4352
+516.653072 3676.47 4352
+516.666128 3676.47 4352
+516.679184 3676.47 4352
+516.692240 3676.47 4352
+516.705296 3676.47 4352
+516.718352 3676.47 4352
+516.731408 3676.47 4352
+516.744560 3649.64 4384
+516.757712 3649.64 4384
+516.770864 3649.64 4384
+516.784016 3649.64 4384
+516.797168 3649.64 4384
+516.810320 3649.64 4384
+516.823472 3649.64 4384
+516.836624 3649.64 4384
+516.849776 3649.64 4384
+516.862928 3649.64 4384
+516.876080 3649.64 4384
+516.889232 3649.64 4384
+516.902384 3649.64 4384
+516.915536 3649.64 4384
+516.928688 3649.64 4384
+516.941840 3649.64 4384
+516.954992 3649.64 4384
+516.968144 3649.64 4384
+516.981296 3649.64 4384
+516.994448 3649.64 4384
+517.007600 3649.64 4384
+517.020752 3649.64 4384
+517.033904 3649.64 4384
+517.047056 3649.64 4384
+517.060208 3649.64 4384
+517.073360 3649.64 4384
+517.086512 3649.64 4384
+517.099664 3649.64 4384
+517.112816 3649.64 4384
+517.125968 3649.64 4384
+517.139120 3649.64 4384
+517.152272 3649.64 4384
+517.165424 3649.64 4384
+517.178576 3649.64 4384
+517.191728 3649.64 4384
+517.204880 3649.64 4384
+517.218032 3649.64 4384
+517.231184 3649.64 4384
+517.244336 3649.64 4384
+517.257488 3649.64 4384
+517.270640 3649.64 4384
+517.283792 3649.64 4384
+517.296944 3649.64 4384
+517.310096 3649.64 4384
+517.323248 3649.64 4384
+517.336400 3649.64 4384
+517.349552 3649.64 4384
+517.362704 3649.64 4384
+517.375856 3649.64 4384
+517.389008 3649.64 4384
+517.402160 3649.64 4384
+517.415312 3649.64 4384
+517.428464 3649.64 4384
+517.441616 3649.64 4384
+517.454864 3623.19 4416
+517.468112 3623.19 4416
+517.481360 3623.19 4416
+517.494608 3623.19 4416
+517.507856 3623.19 4416
+517.521104 3623.19 4416
+517.534352 3623.19 4416
+517.547600 3623.19 4416
+517.560848 3623.19 4416
+517.574096 3623.19 4416
+517.587344 3623.19 4416
+517.600592 3623.19 4416
+517.613840 3623.19 4416
+517.627088 3623.19 4416
+517.640336 3623.19 4416
+517.653584 3623.19 4416
+517.666832 3623.19 4416
+517.680080 3623.19 4416
+517.693328 3623.19 4416
+517.706576 3623.19 4416
+517.719824 3623.19 4416
+517.733168 3597.12 4448
+517.746512 3597.12 4448
+517.759856 3597.12 4448
+517.773200 3597.12 4448
+517.786544 3597.12 4448
+517.799888 3597.12 4448
+517.813232 3597.12 4448
+517.826576 3597.12 4448
+517.839920 3597.12 4448
+517.853264 3597.12 4448
+517.866608 3597.12 4448
+517.879952 3597.12 4448
+517.893296 3597.12 4448
+517.906640 3597.12 4448
+517.919984 3597.12 4448
+517.933328 3597.12 4448
+517.946672 3597.12 4448
+517.960016 3597.12 4448
+517.973360 3597.12 4448
+517.986704 3597.12 4448
+518.000048 3597.12 4448
+518.013488 3571.43 4480
+518.026928 3571.43 4480
+518.040368 3571.43 4480
+518.053808 3571.43 4480
+518.067248 3571.43 4480
+518.080688 3571.43 4480
+518.094128 3571.43 4480
+518.107568 3571.43 4480
+518.121008 3571.43 4480
+518.134448 3571.43 4480
+518.147888 3571.43 4480
+518.161328 3571.43 4480
+518.174768 3571.43 4480
+518.188208 3571.43 4480
+518.201648 3571.43 4480
+518.215088 3571.43 4480
+518.228528 3571.43 4480
+518.241968 3571.43 4480
+518.255408 3571.43 4480
+518.268848 3571.43 4480
+518.282288 3571.43 4480
+518.295728 3571.43 4480
+518.309168 3571.43 4480
+518.322608 3571.43 4480
+518.336048 3571.43 4480
+518.349488 3571.43 4480
+518.362928 3571.43 4480
+518.376368 3571.43 4480
+518.389808 3571.43 4480
+518.403248 3571.43 4480
+518.416688 3571.43 4480
+518.430128 3571.43 4480
+518.443568 3571.43 4480
+518.457008 3571.43 4480
+518.470448 3571.43 4480
+518.483888 3571.43 4480
+518.497328 3571.43 4480
+518.510768 3571.43 4480
+518.524208 3571.43 4480
+518.537648 3571.43 4480
+518.551088 3571.43 4480
+518.564528 3571.43 4480
+518.577968 3571.43 4480
+518.591504 3546.10 4512
+518.605040 3546.10 4512
+518.618576 3546.10 4512
+518.632112 3546.10 4512
+518.645648 3546.10 4512
+518.659184 3546.10 4512
+518.672720 3546.10 4512
+518.686256 3546.10 4512
+518.699792 3546.10 4512
+518.713328 3546.10 4512
+518.726864 3546.10 4512
+518.740400 3546.10 4512
+518.753936 3546.10 4512
+518.767472 3546.10 4512
+518.781008 3546.10 4512
+518.794544 3546.10 4512
+518.808080 3546.10 4512
+518.821616 3546.10 4512
+518.835152 3546.10 4512
+518.848688 3546.10 4512
+518.862224 3546.10 4512
+518.875760 3546.10 4512
+518.889296 3546.10 4512
+518.902832 3546.10 4512
+518.916368 3546.10 4512
+518.929904 3546.10 4512
+518.943440 3546.10 4512
+518.956976 3546.10 4512
+518.970512 3546.10 4512
+518.984048 3546.10 4512
+518.997584 3546.10 4512
+519.011120 3546.10 4512
+519.024752 3521.13 4544
+519.038384 3521.13 4544
+519.052016 3521.13 4544
+519.065648 3521.13 4544
+519.079280 3521.13 4544
+519.092912 3521.13 4544
+519.106544 3521.13 4544
+519.120176 3521.13 4544
+519.133808 3521.13 4544
+519.147440 3521.13 4544
+519.161072 3521.13 4544
+519.174704 3521.13 4544
+519.188336 3521.13 4544
+519.201968 3521.13 4544
+519.215600 3521.13 4544
+519.229232 3521.13 4544
+519.242864 3521.13 4544
+519.256496 3521.13 4544
+519.270128 3521.13 4544
+519.283760 3521.13 4544
+519.297392 3521.13 4544
+519.311120 3496.50 4576
+519.324848 3496.50 4576
+519.338576 3496.50 4576
+519.352304 3496.50 4576
+519.366032 3496.50 4576
+519.379760 3496.50 4576
+519.393488 3496.50 4576
+519.407216 3496.50 4576
+519.420944 3496.50 4576
+519.434672 3496.50 4576
+519.448400 3496.50 4576
+519.462128 3496.50 4576
+519.475856 3496.50 4576
+519.489584 3496.50 4576
+519.503312 3496.50 4576
+519.517040 3496.50 4576
+519.530768 3496.50 4576
+519.544496 3496.50 4576
+519.558224 3496.50 4576
+519.571952 3496.50 4576
+519.585680 3496.50 4576
+519.599408 3496.50 4576
+519.613232 3472.22 4608
+519.627056 3472.22 4608
+519.640880 3472.22 4608
+519.654704 3472.22 4608
+519.668528 3472.22 4608
+519.682352 3472.22 4608
+519.696176 3472.22 4608
+519.710000 3472.22 4608
+519.723824 3472.22 4608
+519.737648 3472.22 4608
+519.751472 3472.22 4608
+519.765296 3472.22 4608
+519.779120 3472.22 4608
+519.792944 3472.22 4608
+519.806768 3472.22 4608
+519.820592 3472.22 4608
+519.834416 3472.22 4608
+519.848240 3472.22 4608
+519.862064 3472.22 4608
+519.875888 3472.22 4608
+519.889712 3472.22 4608
+519.903536 3472.22 4608
+519.917360 3472.22 4608
+519.931184 3472.22 4608
+519.945008 3472.22 4608
+519.958832 3472.22 4608
+519.972656 3472.22 4608
+519.986480 3472.22 4608
+520.000304 3472.22 4608
+520.014128 3472.22 4608
+520.027952 3472.22 4608
+520.041776 3472.22 4608
+520.055600 3472.22 4608
+520.069424 3472.22 4608
+520.083248 3472.22 4608
+520.097072 3472.22 4608
+520.110896 3472.22 4608
+520.124720 3472.22 4608
+520.138544 3472.22 4608
+520.152368 3472.22 4608
+520.166192 3472.22 4608
+520.180016 3472.22 4608
+520.193936 3448.28 4640
+520.207856 3448.28 4640
+520.221776 3448.28 4640
+520.235696 3448.28 4640
+520.249616 3448.28 4640
+520.263536 3448.28 4640
+520.277456 3448.28 4640
+520.291376 3448.28 4640
+520.305296 3448.28 4640
+520.319216 3448.28 4640
+520.333136 3448.28 4640
+520.347056 3448.28 4640
+520.360976 3448.28 4640
+520.374896 3448.28 4640
+520.388816 3448.28 4640
+520.402736 3448.28 4640
+520.416656 3448.28 4640
+520.430576 3448.28 4640
+520.444496 3448.28 4640
+520.458416 3448.28 4640
+520.472336 3448.28 4640
+520.486256 3448.28 4640
+520.500272 3424.66 4672
+520.514288 3424.66 4672
+520.528304 3424.66 4672
+520.542320 3424.66 4672
+520.556336 3424.66 4672
+520.570352 3424.66 4672
+520.584368 3424.66 4672
+520.598384 3424.66 4672
+520.612400 3424.66 4672
+520.626416 3424.66 4672
+520.640432 3424.66 4672
+520.654448 3424.66 4672
+520.668464 3424.66 4672
+520.682480 3424.66 4672
+520.696496 3424.66 4672
+520.710512 3424.66 4672
+520.724528 3424.66 4672
+520.738544 3424.66 4672
+520.752560 3424.66 4672
+520.766576 3424.66 4672
+520.780592 3424.66 4672
+520.794704 3401.36 4704
+520.808816 3401.36 4704
+520.822928 3401.36 4704
+520.837040 3401.36 4704
+520.851152 3401.36 4704
+520.865264 3401.36 4704
+520.879376 3401.36 4704
+520.893488 3401.36 4704
+520.907600 3401.36 4704
+520.921712 3401.36 4704
+520.935824 3401.36 4704
+520.949936 3401.36 4704
+520.964048 3401.36 4704
+520.978160 3401.36 4704
+520.992272 3401.36 4704
+521.006384 3401.36 4704
+521.020496 3401.36 4704
+521.034608 3401.36 4704
+521.048720 3401.36 4704
+521.062832 3401.36 4704
+521.076944 3401.36 4704
+521.091056 3401.36 4704
+521.105168 3401.36 4704
+521.119280 3401.36 4704
+521.133392 3401.36 4704
+521.147504 3401.36 4704
+521.161616 3401.36 4704
+521.175728 3401.36 4704
+521.189840 3401.36 4704
+521.203952 3401.36 4704
+521.218064 3401.36 4704
+521.232176 3401.36 4704
+521.246288 3401.36 4704
+521.260400 3401.36 4704
+521.274512 3401.36 4704
+521.288624 3401.36 4704
+521.302736 3401.36 4704
+521.316848 3401.36 4704
+521.330960 3401.36 4704
+521.345072 3401.36 4704
+521.359184 3401.36 4704
+521.373296 3401.36 4704
+521.387408 3401.36 4704
+521.401616 3378.38 4736
+521.415824 3378.38 4736
+521.430032 3378.38 4736
+521.444240 3378.38 4736
+521.458448 3378.38 4736
+521.472656 3378.38 4736
+521.486864 3378.38 4736
+521.501072 3378.38 4736
+521.515280 3378.38 4736
+521.529488 3378.38 4736
+521.543696 3378.38 4736
+521.557904 3378.38 4736
+521.572112 3378.38 4736
+521.586320 3378.38 4736
+521.600528 3378.38 4736
+521.614736 3378.38 4736
+521.628944 3378.38 4736
+521.643152 3378.38 4736
+521.657360 3378.38 4736
+521.671568 3378.38 4736
+521.685776 3378.38 4736
+521.700080 3355.70 4768
+521.714384 3355.70 4768
+521.728688 3355.70 4768
+521.742992 3355.70 4768
+521.757296 3355.70 4768
+521.771600 3355.70 4768
+521.785904 3355.70 4768
+521.800208 3355.70 4768
+521.814512 3355.70 4768
+521.828816 3355.70 4768
+521.843120 3355.70 4768
+521.857520 3333.33 4800
+521.871920 3333.33 4800
+521.886320 3333.33 4800
+521.900720 3333.33 4800
+521.915120 3333.33 4800
+521.929520 3333.33 4800
+521.943920 3333.33 4800
+521.958320 3333.33 4800
+521.972720 3333.33 4800
+521.987120 3333.33 4800
+522.001520 3333.33 4800
+522.015920 3333.33 4800
+522.030320 3333.33 4800
+522.044720 3333.33 4800
+522.059120 3333.33 4800
+522.073520 3333.33 4800
+522.087920 3333.33 4800
+522.102320 3333.33 4800
+522.116720 3333.33 4800
+522.131120 3333.33 4800
+522.145520 3333.33 4800
+522.160016 3311.26 4832
+522.174512 3311.26 4832
+522.189008 3311.26 4832
+522.203504 3311.26 4832
+522.218000 3311.26 4832
+522.232496 3311.26 4832
+522.246992 3311.26 4832
+522.261488 3311.26 4832
+522.275984 3311.26 4832
+522.290480 3311.26 4832
+522.304976 3311.26 4832
+522.319472 3311.26 4832
+522.333968 3311.26 4832
+522.348464 3311.26 4832
+522.362960 3311.26 4832
+522.377456 3311.26 4832
+522.391952 3311.26 4832
+522.406448 3311.26 4832
+522.420944 3311.26 4832
+522.435440 3311.26 4832
+522.449936 3311.26 4832
+522.464528 3289.47 4864
+522.479120 3289.47 4864
+522.493712 3289.47 4864
+522.508304 3289.47 4864
+522.522896 3289.47 4864
+522.537488 3289.47 4864
+522.552080 3289.47 4864
+522.566672 3289.47 4864
+522.581264 3289.47 4864
+522.595856 3289.47 4864
+522.610448 3289.47 4864
+522.625040 3289.47 4864
+522.639632 3289.47 4864
+522.654224 3289.47 4864
+522.668816 3289.47 4864
+522.683408 3289.47 4864
+522.698000 3289.47 4864
+522.712592 3289.47 4864
+522.727184 3289.47 4864
+522.741776 3289.47 4864
+522.756368 3289.47 4864
+522.770960 3289.47 4864
+522.785552 3289.47 4864
+522.800144 3289.47 4864
+522.814736 3289.47 4864
+522.829328 3289.47 4864
+522.843920 3289.47 4864
+522.858512 3289.47 4864
+522.873104 3289.47 4864
+522.887696 3289.47 4864
+522.902288 3289.47 4864
+522.916880 3289.47 4864
+522.931472 3289.47 4864
+522.946064 3289.47 4864
+522.960656 3289.47 4864
+522.975248 3289.47 4864
+522.989840 3289.47 4864
+523.004432 3289.47 4864
+523.019024 3289.47 4864
+523.033616 3289.47 4864
+523.048208 3289.47 4864
+523.062800 3289.47 4864
+523.077392 3289.47 4864
+523.092080 3267.97 4896
+523.106768 3267.97 4896
+523.121456 3267.97 4896
+523.136144 3267.97 4896
+523.150832 3267.97 4896
+523.165520 3267.97 4896
+523.180208 3267.97 4896
+523.194896 3267.97 4896
+523.209584 3267.97 4896
+523.224272 3267.97 4896
+523.238960 3267.97 4896
+523.253648 3267.97 4896
+523.268336 3267.97 4896
+523.283024 3267.97 4896
+523.297712 3267.97 4896
+523.312400 3267.97 4896
+523.327088 3267.97 4896
+523.341776 3267.97 4896
+523.356464 3267.97 4896
+523.371152 3267.97 4896
+523.385840 3267.97 4896
+523.400624 3246.75 4928
+523.415408 3246.75 4928
+523.430192 3246.75 4928
+523.444976 3246.75 4928
+523.459760 3246.75 4928
+523.474544 3246.75 4928
+523.489328 3246.75 4928
+523.504112 3246.75 4928
+523.518896 3246.75 4928
+523.533680 3246.75 4928
+523.548464 3246.75 4928
+523.563344 3225.81 4960
+523.578224 3225.81 4960
+523.593104 3225.81 4960
+523.607984 3225.81 4960
+523.622864 3225.81 4960
+523.637744 3225.81 4960
+523.652624 3225.81 4960
+523.667504 3225.81 4960
+523.682384 3225.81 4960
+523.697264 3225.81 4960
+523.712144 3225.81 4960
+523.727024 3225.81 4960
+523.741904 3225.81 4960
+523.756784 3225.81 4960
+523.771664 3225.81 4960
+523.786544 3225.81 4960
+523.801424 3225.81 4960
+523.816304 3225.81 4960
+523.831184 3225.81 4960
+523.846064 3225.81 4960
+523.860944 3225.81 4960
+523.875920 3205.13 4992
+523.890896 3205.13 4992
+523.905872 3205.13 4992
+523.920848 3205.13 4992
+523.935824 3205.13 4992
+523.950800 3205.13 4992
+523.965776 3205.13 4992
+523.980752 3205.13 4992
+523.995728 3205.13 4992
+524.010704 3205.13 4992
+524.025680 3205.13 4992
+524.040656 3205.13 4992
+524.055632 3205.13 4992
+524.070608 3205.13 4992
+524.085584 3205.13 4992
+524.100560 3205.13 4992
+524.115536 3205.13 4992
+524.130512 3205.13 4992
+524.145488 3205.13 4992
+524.160464 3205.13 4992
+524.175440 3205.13 4992
+524.190416 3205.13 4992
+524.205488 3184.71 5024
+524.220560 3184.71 5024
+524.235632 3184.71 5024
+524.250704 3184.71 5024
+524.265776 3184.71 5024
+524.280848 3184.71 5024
+524.295920 3184.71 5024
+524.310992 3184.71 5024
+524.326064 3184.71 5024
+524.341136 3184.71 5024
+524.356208 3184.71 5024
+524.371280 3184.71 5024
+524.386352 3184.71 5024
+524.401424 3184.71 5024
+524.416496 3184.71 5024
+524.431568 3184.71 5024
+524.446640 3184.71 5024
+524.461712 3184.71 5024
+524.476784 3184.71 5024
+524.491856 3184.71 5024
+524.506928 3184.71 5024
+524.522000 3184.71 5024
+524.537072 3184.71 5024
+524.552144 3184.71 5024
+524.567216 3184.71 5024
+524.582288 3184.71 5024
+524.597360 3184.71 5024
+524.612432 3184.71 5024
+524.627504 3184.71 5024
+524.642576 3184.71 5024
+524.657648 3184.71 5024
+524.672720 3184.71 5024
+524.687888 3164.56 5056
+524.703056 3164.56 5056
+524.718224 3164.56 5056
+524.733392 3164.56 5056
+524.748560 3164.56 5056
+524.763728 3164.56 5056
+524.778896 3164.56 5056
+524.794064 3164.56 5056
+524.809232 3164.56 5056
+524.824400 3164.56 5056
+524.839568 3164.56 5056
+524.854736 3164.56 5056
+524.869904 3164.56 5056
+524.885072 3164.56 5056
+524.900240 3164.56 5056
+524.915408 3164.56 5056
+524.930576 3164.56 5056
+524.945744 3164.56 5056
+524.960912 3164.56 5056
+524.976080 3164.56 5056
+524.991248 3164.56 5056
+525.006512 3144.65 5088
+525.021776 3144.65 5088
+525.037040 3144.65 5088
+525.052304 3144.65 5088
+525.067568 3144.65 5088
+525.082832 3144.65 5088
+525.098096 3144.65 5088
+525.113360 3144.65 5088
+525.128624 3144.65 5088
+525.143888 3144.65 5088
+525.159152 3144.65 5088
+525.174416 3144.65 5088
+525.189680 3144.65 5088
+525.204944 3144.65 5088
+525.220208 3144.65 5088
+525.235472 3144.65 5088
+525.250736 3144.65 5088
+525.266000 3144.65 5088
+525.281264 3144.65 5088
+525.296528 3144.65 5088
+525.311792 3144.65 5088
+525.327152 3125.00 5120
+525.342512 3125.00 5120
+525.357872 3125.00 5120
+525.373232 3125.00 5120
+525.388592 3125.00 5120
+525.403952 3125.00 5120
+525.419312 3125.00 5120
+525.434672 3125.00 5120
+525.450032 3125.00 5120
+525.465392 3125.00 5120
+525.480752 3125.00 5120
+525.496208 3105.59 5152
+525.511664 3105.59 5152
+525.527120 3105.59 5152
+525.542576 3105.59 5152
+525.558032 3105.59 5152
+525.573488 3105.59 5152
+525.588944 3105.59 5152
+525.604400 3105.59 5152
+525.619856 3105.59 5152
+525.635312 3105.59 5152
+525.650768 3105.59 5152
+525.666224 3105.59 5152
+525.681680 3105.59 5152
+525.697136 3105.59 5152
+525.712592 3105.59 5152
+525.728048 3105.59 5152
+525.743504 3105.59 5152
+525.758960 3105.59 5152
+525.774416 3105.59 5152
+525.789872 3105.59 5152
+525.805328 3105.59 5152
+525.820880 3086.42 5184
+525.836432 3086.42 5184
+525.851984 3086.42 5184
+525.867536 3086.42 5184
+525.883088 3086.42 5184
+525.898640 3086.42 5184
+525.914192 3086.42 5184
+525.929744 3086.42 5184
+525.945296 3086.42 5184
+525.960848 3086.42 5184
+525.976400 3086.42 5184
+525.991952 3086.42 5184
+526.007504 3086.42 5184
+526.023056 3086.42 5184
+526.038608 3086.42 5184
+526.054160 3086.42 5184
+526.069712 3086.42 5184
+526.085264 3086.42 5184
+526.100816 3086.42 5184
+526.116368 3086.42 5184
+526.131920 3086.42 5184
+526.147472 3086.42 5184
+526.163120 3067.48 5216
+526.178768 3067.48 5216
+526.194416 3067.48 5216
+526.210064 3067.48 5216
+526.225712 3067.48 5216
+526.241360 3067.48 5216
+526.257008 3067.48 5216
+526.272656 3067.48 5216
+526.288304 3067.48 5216
+526.303952 3067.48 5216
+526.319600 3067.48 5216
+526.335248 3067.48 5216
+526.350896 3067.48 5216
+526.366544 3067.48 5216
+526.382192 3067.48 5216
+526.397840 3067.48 5216
+526.413488 3067.48 5216
+526.429136 3067.48 5216
+526.444784 3067.48 5216
+526.460432 3067.48 5216
+526.476080 3067.48 5216
+526.491728 3067.48 5216
+526.507376 3067.48 5216
+526.523024 3067.48 5216
+526.538672 3067.48 5216
+526.554320 3067.48 5216
+526.569968 3067.48 5216
+526.585616 3067.48 5216
+526.601264 3067.48 5216
+526.616912 3067.48 5216
+526.632560 3067.48 5216
+526.648208 3067.48 5216
+526.663952 3048.78 5248
+526.679696 3048.78 5248
+526.695440 3048.78 5248
+526.711184 3048.78 5248
+526.726928 3048.78 5248
+526.742672 3048.78 5248
+526.758416 3048.78 5248
+526.774160 3048.78 5248
+526.789904 3048.78 5248
+526.805648 3048.78 5248
+526.821488 3030.30 5280
+526.837328 3030.30 5280
+526.853168 3030.30 5280
+526.869008 3030.30 5280
+526.884848 3030.30 5280
+526.900688 3030.30 5280
+526.916528 3030.30 5280
+526.932368 3030.30 5280
+526.948208 3030.30 5280
+526.964048 3030.30 5280
+526.979888 3030.30 5280
+526.995728 3030.30 5280
+527.011568 3030.30 5280
+527.027408 3030.30 5280
+527.043248 3030.30 5280
+527.059088 3030.30 5280
+527.074928 3030.30 5280
+527.090768 3030.30 5280
+527.106608 3030.30 5280
+527.122448 3030.30 5280
+527.138288 3030.30 5280
+527.154128 3030.30 5280
+527.170064 3012.05 5312
+527.186000 3012.05 5312
+527.201936 3012.05 5312
+527.217872 3012.05 5312
+527.233808 3012.05 5312
+527.249744 3012.05 5312
+527.265680 3012.05 5312
+527.281616 3012.05 5312
+527.297552 3012.05 5312
+527.313488 3012.05 5312
+527.329520 2994.01 5344
+527.340208 2994.01 5344
+527.350896 2994.01 5344
+527.361584 2994.01 5344
+527.372272 2994.01 5344
+527.382960 2994.01 5344
+527.393648 2994.01 5344
+527.404336 2994.01 5344
+527.415024 2994.01 5344
+527.425712 2994.01 5344
+527.436400 2994.01 5344
+527.447088 2994.01 5344
+527.457776 2994.01 5344
+527.468464 2994.01 5344
+527.479152 2994.01 5344
+527.489840 2994.01 5344
+527.500528 2994.01 5344
+527.511216 2994.01 5344
+527.521904 2994.01 5344
+527.532592 2994.01 5344
+527.543280 2994.01 5344
+527.553968 2994.01 5344
+527.564656 2994.01 5344
+527.575344 2994.01 5344
+527.586032 2994.01 5344
+527.596720 2994.01 5344
+527.607408 2994.01 5344
+527.618096 2994.01 5344
+527.628784 2994.01 5344
+527.639472 2994.01 5344
+527.650160 2994.01 5344
+527.660848 2994.01 5344
+527.671600 2976.19 5376
+527.682352 2976.19 5376
+527.693104 2976.19 5376
+527.703856 2976.19 5376
+527.714608 2976.19 5376
+527.725360 2976.19 5376
+527.736112 2976.19 5376
+527.746864 2976.19 5376
+527.757616 2976.19 5376
+527.768368 2976.19 5376
+527.779120 2976.19 5376
+527.789872 2976.19 5376
+527.800624 2976.19 5376
+527.811376 2976.19 5376
+527.822128 2976.19 5376
+527.832880 2976.19 5376
+527.843696 2958.58 5408
+527.854512 2958.58 5408
+527.865328 2958.58 5408
+527.876144 2958.58 5408
+527.886960 2958.58 5408
+527.897776 2958.58 5408
+527.908592 2958.58 5408
+527.919408 2958.58 5408
+527.930224 2958.58 5408
+527.941040 2958.58 5408
+527.951856 2958.58 5408
+527.962672 2958.58 5408
+527.973488 2958.58 5408
+527.984304 2958.58 5408
+527.995120 2958.58 5408
+528.005936 2958.58 5408
+528.016752 2958.58 5408
+528.027568 2958.58 5408
+528.038384 2958.58 5408
+528.049200 2958.58 5408
+528.060016 2958.58 5408
+528.070832 2958.58 5408
+528.081648 2958.58 5408
+528.092464 2958.58 5408
+528.103280 2958.58 5408
+528.114096 2958.58 5408
+528.124912 2958.58 5408
+528.135728 2958.58 5408
+528.146544 2958.58 5408
+528.157360 2958.58 5408
+528.168176 2958.58 5408
+528.178992 2958.58 5408
+528.189872 2941.18 5440
+528.200752 2941.18 5440
+528.211632 2941.18 5440
+528.222512 2941.18 5440
+528.233392 2941.18 5440
+528.244272 2941.18 5440
+528.255152 2941.18 5440
+528.266032 2941.18 5440
+528.276912 2941.18 5440
+528.287792 2941.18 5440
+528.298672 2941.18 5440
+528.309552 2941.18 5440
+528.320432 2941.18 5440
+528.331312 2941.18 5440
+528.342192 2941.18 5440
+528.353072 2941.18 5440
+528.364016 2923.98 5472
+528.374960 2923.98 5472
+528.385904 2923.98 5472
+528.396848 2923.98 5472
+528.407792 2923.98 5472
+528.418736 2923.98 5472
+528.429680 2923.98 5472
+528.440624 2923.98 5472
+528.451568 2923.98 5472
+528.462512 2923.98 5472
+528.473456 2923.98 5472
+528.484400 2923.98 5472
+528.495344 2923.98 5472
+528.506288 2923.98 5472
+528.517232 2923.98 5472
+528.528176 2923.98 5472
+528.539120 2923.98 5472
+528.550064 2923.98 5472
+528.561008 2923.98 5472
+528.571952 2923.98 5472
+528.582896 2923.98 5472
+528.593840 2923.98 5472
+528.604784 2923.98 5472
+528.615728 2923.98 5472
+528.626672 2923.98 5472
+528.637616 2923.98 5472
+528.648560 2923.98 5472
+528.659504 2923.98 5472
+528.670448 2923.98 5472
+528.681392 2923.98 5472
+528.692336 2923.98 5472
+528.703280 2923.98 5472
+528.714288 2906.98 5504
+528.725296 2906.98 5504
+528.736304 2906.98 5504
+528.747312 2906.98 5504
+528.758320 2906.98 5504
+528.769328 2906.98 5504
+528.780336 2906.98 5504
+528.791344 2906.98 5504
+528.802352 2906.98 5504
+528.813360 2906.98 5504
+528.824368 2906.98 5504
+528.835376 2906.98 5504
+528.846384 2906.98 5504
+528.857392 2906.98 5504
+528.868400 2906.98 5504
+528.879408 2906.98 5504
+528.890480 2890.17 5536
+528.901552 2890.17 5536
+528.912624 2890.17 5536
+528.923696 2890.17 5536
+528.934768 2890.17 5536
+528.945840 2890.17 5536
+528.956912 2890.17 5536
+528.967984 2890.17 5536
+528.979056 2890.17 5536
+528.990128 2890.17 5536
+529.001200 2890.17 5536
+529.012272 2890.17 5536
+529.023344 2890.17 5536
+529.034416 2890.17 5536
+529.045488 2890.17 5536
+529.056560 2890.17 5536
+529.067632 2890.17 5536
+529.078704 2890.17 5536
+529.089776 2890.17 5536
+529.100848 2890.17 5536
+529.111920 2890.17 5536
+529.122992 2890.17 5536
+529.134064 2890.17 5536
+529.145136 2890.17 5536
+529.156208 2890.17 5536
+529.167280 2890.17 5536
+529.178352 2890.17 5536
+529.189424 2890.17 5536
+529.200496 2890.17 5536
+529.211568 2890.17 5536
+529.222640 2890.17 5536
+529.233712 2890.17 5536
+529.244848 2873.56 5568
+529.255984 2873.56 5568
+529.267120 2873.56 5568
+529.278256 2873.56 5568
+529.289392 2873.56 5568
+529.300528 2873.56 5568
+529.311664 2873.56 5568
+529.322800 2873.56 5568
+529.333936 2873.56 5568
+529.345072 2873.56 5568
+529.356208 2873.56 5568
+529.367344 2873.56 5568
+529.378480 2873.56 5568
+529.389616 2873.56 5568
+529.400752 2873.56 5568
+529.411888 2873.56 5568
+529.423024 2873.56 5568
+529.434160 2873.56 5568
+529.445296 2873.56 5568
+529.456432 2873.56 5568
+529.467568 2873.56 5568
+529.478704 2873.56 5568
+529.489840 2873.56 5568
+529.500976 2873.56 5568
+529.512112 2873.56 5568
+529.523248 2873.56 5568
+529.534384 2873.56 5568
+529.545520 2873.56 5568
+529.556656 2873.56 5568
+529.567792 2873.56 5568
+529.578928 2873.56 5568
+529.590064 2873.56 5568
+529.601200 2873.56 5568
+529.612336 2873.56 5568
+529.623472 2873.56 5568
+529.634608 2873.56 5568
+529.645744 2873.56 5568
+529.656880 2873.56 5568
+529.668016 2873.56 5568
+529.679152 2873.56 5568
+529.690352 2857.14 5600
+529.701552 2857.14 5600
+529.712752 2857.14 5600
+529.723952 2857.14 5600
+529.735152 2857.14 5600
+529.746352 2857.14 5600
+529.757552 2857.14 5600
+529.768752 2857.14 5600
+529.779952 2857.14 5600
+529.791152 2857.14 5600
+529.802352 2857.14 5600
+529.813552 2857.14 5600
+529.824752 2857.14 5600
+529.835952 2857.14 5600
+529.847152 2857.14 5600
+529.858352 2857.14 5600
+529.869552 2857.14 5600
+529.880752 2857.14 5600
+529.891952 2857.14 5600
+529.903152 2857.14 5600
+529.914352 2857.14 5600
+529.925552 2857.14 5600
+529.936752 2857.14 5600
+529.947952 2857.14 5600
+529.959216 2840.91 5632
+529.970480 2840.91 5632
+529.981744 2840.91 5632
+529.993008 2840.91 5632
+530.004272 2840.91 5632
+530.015536 2840.91 5632
+530.026800 2840.91 5632
+530.038064 2840.91 5632
+530.049328 2840.91 5632
+530.060592 2840.91 5632
+530.071856 2840.91 5632
+530.083120 2840.91 5632
+530.094384 2840.91 5632
+530.105648 2840.91 5632
+530.116912 2840.91 5632
+530.128176 2840.91 5632
+530.139440 2840.91 5632
+530.150704 2840.91 5632
+530.161968 2840.91 5632
+530.173232 2840.91 5632
+530.184496 2840.91 5632
+530.195760 2840.91 5632
+530.207024 2840.91 5632
+530.218288 2840.91 5632
+530.229616 2824.86 5664
+530.240944 2824.86 5664
+530.252272 2824.86 5664
+530.263600 2824.86 5664
+530.274928 2824.86 5664
+530.286256 2824.86 5664
+530.297584 2824.86 5664
+530.308912 2824.86 5664
+530.320240 2824.86 5664
+530.331568 2824.86 5664
+530.342896 2824.86 5664
+530.354224 2824.86 5664
+530.365552 2824.86 5664
+530.376880 2824.86 5664
+530.388208 2824.86 5664
+530.399536 2824.86 5664
+530.410928 2808.99 5696
+530.422320 2808.99 5696
+530.433712 2808.99 5696
+530.445104 2808.99 5696
+530.456496 2808.99 5696
+530.467888 2808.99 5696
+530.479280 2808.99 5696
+530.490672 2808.99 5696
+530.502064 2808.99 5696
+530.513456 2808.99 5696
+530.524848 2808.99 5696
+530.536240 2808.99 5696
+530.547632 2808.99 5696
+530.559024 2808.99 5696
+530.570416 2808.99 5696
+530.581808 2808.99 5696
+530.593200 2808.99 5696
+530.604592 2808.99 5696
+530.615984 2808.99 5696
+530.627376 2808.99 5696
+530.638768 2808.99 5696
+530.650160 2808.99 5696
+530.661552 2808.99 5696
+530.672944 2808.99 5696
+530.684400 2793.30 5728
+530.695856 2793.30 5728
+530.707312 2793.30 5728
+530.718768 2793.30 5728
+530.730224 2793.30 5728
+530.741680 2793.30 5728
+530.753136 2793.30 5728
+530.764592 2793.30 5728
+530.776048 2793.30 5728
+530.787504 2793.30 5728
+530.798960 2793.30 5728
+530.810416 2793.30 5728
+530.821872 2793.30 5728
+530.833328 2793.30 5728
+530.844784 2793.30 5728
+530.856240 2793.30 5728
+530.867696 2793.30 5728
+530.879152 2793.30 5728
+530.890608 2793.30 5728
+530.902064 2793.30 5728
+530.913520 2793.30 5728
+530.924976 2793.30 5728
+530.936432 2793.30 5728
+530.947888 2793.30 5728
+530.959408 2777.78 5760
+530.970928 2777.78 5760
+530.982448 2777.78 5760
+530.993968 2777.78 5760
+531.005488 2777.78 5760
+531.017008 2777.78 5760
+531.028528 2777.78 5760
+531.040048 2777.78 5760
+531.051568 2777.78 5760
+531.063088 2777.78 5760
+531.074608 2777.78 5760
+531.086128 2777.78 5760
+531.097648 2777.78 5760
+531.109168 2777.78 5760
+531.120688 2777.78 5760
+531.132208 2777.78 5760
+531.143792 2762.43 5792
+531.155376 2762.43 5792
+531.166960 2762.43 5792
+531.178544 2762.43 5792
+531.190128 2762.43 5792
+531.201712 2762.43 5792
+531.213296 2762.43 5792
+531.224880 2762.43 5792
+531.236464 2762.43 5792
+531.248048 2762.43 5792
+531.259632 2762.43 5792
+531.271216 2762.43 5792
+531.282800 2762.43 5792
+531.294384 2762.43 5792
+531.305968 2762.43 5792
+531.317552 2762.43 5792
+531.329136 2762.43 5792
+531.340720 2762.43 5792
+531.352304 2762.43 5792
+531.363888 2762.43 5792
+531.375472 2762.43 5792
+531.387056 2762.43 5792
+531.398640 2762.43 5792
+531.410224 2762.43 5792
+531.421872 2747.25 5824
+531.433520 2747.25 5824
+531.445168 2747.25 5824
+531.456816 2747.25 5824
+531.468464 2747.25 5824
+531.480112 2747.25 5824
+531.491760 2747.25 5824
+531.503408 2747.25 5824
+531.515056 2747.25 5824
+531.526704 2747.25 5824
+531.538352 2747.25 5824
+531.550000 2747.25 5824
+531.561648 2747.25 5824
+531.573296 2747.25 5824
+531.584944 2747.25 5824
+531.596592 2747.25 5824
+531.608304 2732.24 5856
+531.620016 2732.24 5856
+531.631728 2732.24 5856
+531.643440 2732.24 5856
+531.655152 2732.24 5856
+531.666864 2732.24 5856
+531.678576 2732.24 5856
+531.690288 2732.24 5856
+531.702000 2732.24 5856
+531.713712 2732.24 5856
+531.725424 2732.24 5856
+531.737136 2732.24 5856
+531.748848 2732.24 5856
+531.760560 2732.24 5856
+531.772272 2732.24 5856
+531.783984 2732.24 5856
+531.795696 2732.24 5856
+531.807408 2732.24 5856
+531.819120 2732.24 5856
+531.830832 2732.24 5856
+531.842544 2732.24 5856
+531.854256 2732.24 5856
+531.865968 2732.24 5856
+531.877680 2732.24 5856
+531.889456 2717.39 5888
+531.901232 2717.39 5888
+531.913008 2717.39 5888
+531.924784 2717.39 5888
+531.936560 2717.39 5888
+531.948336 2717.39 5888
+531.960112 2717.39 5888
+531.971888 2717.39 5888
+531.983664 2717.39 5888
+531.995440 2717.39 5888
+532.007216 2717.39 5888
+532.018992 2717.39 5888
+532.030768 2717.39 5888
+532.042544 2717.39 5888
+532.054320 2717.39 5888
+532.066096 2717.39 5888
+532.077936 2702.70 5920
+532.089776 2702.70 5920
+532.101616 2702.70 5920
+532.113456 2702.70 5920
+532.125296 2702.70 5920
+532.137136 2702.70 5920
+532.148976 2702.70 5920
+532.160816 2702.70 5920
+532.172656 2702.70 5920
+532.184496 2702.70 5920
+532.196336 2702.70 5920
+532.208176 2702.70 5920
+532.220016 2702.70 5920
+532.231856 2702.70 5920
+532.243696 2702.70 5920
+532.255536 2702.70 5920
+532.267376 2702.70 5920
+532.279216 2702.70 5920
+532.291056 2702.70 5920
+532.302896 2702.70 5920
+532.314736 2702.70 5920
+532.326576 2702.70 5920
+532.338416 2702.70 5920
+532.350256 2702.70 5920
+532.362160 2688.17 5952
+532.374064 2688.17 5952
+532.385968 2688.17 5952
+532.397872 2688.17 5952
+532.409776 2688.17 5952
+532.421680 2688.17 5952
+532.433584 2688.17 5952
+532.445488 2688.17 5952
+532.457392 2688.17 5952
+532.469296 2688.17 5952
+532.481200 2688.17 5952
+532.493104 2688.17 5952
+532.505008 2688.17 5952
+532.516912 2688.17 5952
+532.528816 2688.17 5952
+532.540720 2688.17 5952
+532.552688 2673.80 5984
+532.564656 2673.80 5984
+532.576624 2673.80 5984
+532.588592 2673.80 5984
+532.600560 2673.80 5984
+532.612528 2673.80 5984
+532.624496 2673.80 5984
+532.636464 2673.80 5984
+532.648432 2673.80 5984
+532.660400 2673.80 5984
+532.672368 2673.80 5984
+532.684336 2673.80 5984
+532.696304 2673.80 5984
+532.708272 2673.80 5984
+532.720240 2673.80 5984
+532.732208 2673.80 5984
+532.744176 2673.80 5984
+532.756144 2673.80 5984
+532.768112 2673.80 5984
+532.780080 2673.80 5984
+532.792048 2673.80 5984
+532.804016 2673.80 5984
+532.815984 2673.80 5984
+532.827952 2673.80 5984
+532.839984 2659.57 6016
+532.852016 2659.57 6016
+532.864048 2659.57 6016
+532.876080 2659.57 6016
+532.888112 2659.57 6016
+532.900144 2659.57 6016
+532.912176 2659.57 6016
+532.924208 2659.57 6016
+532.936240 2659.57 6016
+532.948272 2659.57 6016
+532.960304 2659.57 6016
+532.972336 2659.57 6016
+532.984368 2659.57 6016
+532.996400 2659.57 6016
+533.008432 2659.57 6016
+533.020464 2659.57 6016
+533.032560 2645.50 6048
+533.044656 2645.50 6048
+533.056752 2645.50 6048
+533.068848 2645.50 6048
+533.080944 2645.50 6048
+533.093040 2645.50 6048
+533.105136 2645.50 6048
+533.117232 2645.50 6048
+533.129328 2645.50 6048
+533.141424 2645.50 6048
+533.153520 2645.50 6048
+533.165616 2645.50 6048
+533.177712 2645.50 6048
+533.189808 2645.50 6048
+533.201904 2645.50 6048
+533.214000 2645.50 6048
+533.226160 2631.58 6080
+533.238320 2631.58 6080
+533.250480 2631.58 6080
+533.262640 2631.58 6080
+533.274800 2631.58 6080
+533.286960 2631.58 6080
+533.299120 2631.58 6080
+533.311280 2631.58 6080
+533.323440 2631.58 6080
+533.335600 2631.58 6080
+533.347760 2631.58 6080
+533.359920 2631.58 6080
+533.372080 2631.58 6080
+533.384240 2631.58 6080
+533.396400 2631.58 6080
+533.408560 2631.58 6080
+533.420720 2631.58 6080
+533.432880 2631.58 6080
+533.445040 2631.58 6080
+533.457200 2631.58 6080
+533.469360 2631.58 6080
+533.481520 2631.58 6080
+533.493680 2631.58 6080
+533.505840 2631.58 6080
+533.518064 2617.80 6112
+533.530288 2617.80 6112
+533.542512 2617.80 6112
+533.554736 2617.80 6112
+533.566960 2617.80 6112
+533.579184 2617.80 6112
+533.591408 2617.80 6112
+533.603632 2617.80 6112
+533.615856 2617.80 6112
+533.628080 2617.80 6112
+533.640304 2617.80 6112
+533.652528 2617.80 6112
+533.664752 2617.80 6112
+533.676976 2617.80 6112
+533.689200 2617.80 6112
+533.701424 2617.80 6112
+533.713712 2604.17 6144
+533.726000 2604.17 6144
+533.738288 2604.17 6144
+533.750576 2604.17 6144
+533.762864 2604.17 6144
+533.775152 2604.17 6144
+533.787440 2604.17 6144
+533.799728 2604.17 6144
+533.812016 2604.17 6144
+533.824304 2604.17 6144
+533.836592 2604.17 6144
+533.848880 2604.17 6144
+533.861168 2604.17 6144
+533.873456 2604.17 6144
+533.885744 2604.17 6144
+533.898032 2604.17 6144
+533.910384 2590.67 6176
+533.922736 2590.67 6176
+533.935088 2590.67 6176
+533.947440 2590.67 6176
+533.959792 2590.67 6176
+533.972144 2590.67 6176
+533.984496 2590.67 6176
+533.996848 2590.67 6176
+534.009200 2590.67 6176
+534.021552 2590.67 6176
+534.033904 2590.67 6176
+534.046256 2590.67 6176
+534.058608 2590.67 6176
+534.070960 2590.67 6176
+534.083312 2590.67 6176
+534.095664 2590.67 6176
+534.108016 2590.67 6176
+534.120368 2590.67 6176
+534.132720 2590.67 6176
+534.145072 2590.67 6176
+534.157424 2590.67 6176
+534.169776 2590.67 6176
+534.182128 2590.67 6176
+534.194480 2590.67 6176
+534.206896 2577.32 6208
+534.219312 2577.32 6208
+534.231728 2577.32 6208
+534.244144 2577.32 6208
+534.256560 2577.32 6208
+534.268976 2577.32 6208
+534.281392 2577.32 6208
+534.293808 2577.32 6208
+534.306224 2577.32 6208
+534.318640 2577.32 6208
+534.331056 2577.32 6208
+534.343472 2577.32 6208
+534.355888 2577.32 6208
+534.368304 2577.32 6208
+534.380720 2577.32 6208
+534.393136 2577.32 6208
+534.405680 2551.02 6272
+534.418224 2551.02 6272
+534.430768 2551.02 6272
+534.443312 2551.02 6272
+534.455856 2551.02 6272
+534.468400 2551.02 6272
+534.480944 2551.02 6272
+534.493488 2551.02 6272
+534.506032 2551.02 6272
+534.518576 2551.02 6272
+534.531120 2551.02 6272
+534.543664 2551.02 6272
+534.556208 2551.02 6272
+534.568752 2551.02 6272
+534.581296 2551.02 6272
+534.593840 2551.02 6272
+534.606448 2538.07 6304
+534.619056 2538.07 6304
+534.631664 2538.07 6304
+534.644272 2538.07 6304
+534.656880 2538.07 6304
+534.669488 2538.07 6304
+534.682096 2538.07 6304
+534.694704 2538.07 6304
+534.707312 2538.07 6304
+534.719920 2538.07 6304
+534.732528 2538.07 6304
+534.745136 2538.07 6304
+534.757744 2538.07 6304
+534.770352 2538.07 6304
+534.782960 2538.07 6304
+534.795568 2538.07 6304
+534.808240 2525.25 6336
+534.820912 2525.25 6336
+534.833584 2525.25 6336
+534.846256 2525.25 6336
+534.858928 2525.25 6336
+534.871600 2525.25 6336
+534.884272 2525.25 6336
+534.896944 2525.25 6336
+534.909616 2525.25 6336
+534.922288 2525.25 6336
+534.934960 2525.25 6336
+534.947632 2525.25 6336
+534.960304 2525.25 6336
+534.972976 2525.25 6336
+534.985648 2525.25 6336
+534.998320 2525.25 6336
+535.011056 2512.56 6368
+535.023792 2512.56 6368
+535.036528 2512.56 6368
+535.049264 2512.56 6368
+535.062000 2512.56 6368
+535.074736 2512.56 6368
+535.087472 2512.56 6368
+535.100208 2512.56 6368
+535.112944 2512.56 6368
+535.125680 2512.56 6368
+535.138416 2512.56 6368
+535.151152 2512.56 6368
+535.163888 2512.56 6368
+535.176624 2512.56 6368
+535.189360 2512.56 6368
+535.202096 2512.56 6368
+535.214896 2500.00 6400
+535.227696 2500.00 6400
+535.240496 2500.00 6400
+535.253296 2500.00 6400
+535.266096 2500.00 6400
+535.278896 2500.00 6400
+535.291696 2500.00 6400
+535.304496 2500.00 6400
+535.317296 2500.00 6400
+535.330096 2500.00 6400
+535.342896 2500.00 6400
+535.355696 2500.00 6400
+535.368496 2500.00 6400
+535.381296 2500.00 6400
+535.394096 2500.00 6400
+535.406896 2500.00 6400
+535.419696 2500.00 6400
+535.432496 2500.00 6400
+535.445296 2500.00 6400
+535.458096 2500.00 6400
+535.470896 2500.00 6400
+535.483696 2500.00 6400
+535.496496 2500.00 6400
+535.509296 2500.00 6400
+535.522160 2487.56 6432
+535.535024 2487.56 6432
+535.547888 2487.56 6432
+535.560752 2487.56 6432
+535.573616 2487.56 6432
+535.586480 2487.56 6432
+535.599344 2487.56 6432
+535.612208 2487.56 6432
+535.625072 2487.56 6432
+535.637936 2487.56 6432
+535.650800 2487.56 6432
+535.663664 2487.56 6432
+535.676528 2487.56 6432
+535.689392 2487.56 6432
+535.702256 2487.56 6432
+535.715120 2487.56 6432
+535.728048 2475.25 6464
+535.740976 2475.25 6464
+535.753904 2475.25 6464
+535.766832 2475.25 6464
+535.779760 2475.25 6464
+535.792688 2475.25 6464
+535.805616 2475.25 6464
+535.818544 2475.25 6464
+535.831472 2475.25 6464
+535.844400 2475.25 6464
+535.857328 2475.25 6464
+535.870256 2475.25 6464
+535.883184 2475.25 6464
+535.896112 2475.25 6464
+535.909040 2475.25 6464
+535.921968 2475.25 6464
+535.934960 2463.05 6496
+535.947952 2463.05 6496
+535.960944 2463.05 6496
+535.973936 2463.05 6496
+535.986928 2463.05 6496
+535.999920 2463.05 6496
+536.012912 2463.05 6496
+536.025904 2463.05 6496
+536.038896 2463.05 6496
+536.051888 2463.05 6496
+536.064880 2463.05 6496
+536.077872 2463.05 6496
+536.090864 2463.05 6496
+536.103856 2463.05 6496
+536.116848 2463.05 6496
+536.129840 2463.05 6496
+536.142896 2450.98 6528
+536.155952 2450.98 6528
+536.169008 2450.98 6528
+536.182064 2450.98 6528
+536.195120 2450.98 6528
+536.208176 2450.98 6528
+536.221232 2450.98 6528
+536.234288 2450.98 6528
+536.247344 2450.98 6528
+536.260400 2450.98 6528
+536.273456 2450.98 6528
+536.286512 2450.98 6528
+536.299568 2450.98 6528
+536.312624 2450.98 6528
+536.325680 2450.98 6528
+536.338736 2450.98 6528
+536.351856 2439.02 6560
+536.364976 2439.02 6560
+536.378096 2439.02 6560
+536.391216 2439.02 6560
+536.404336 2439.02 6560
+536.417456 2439.02 6560
+536.430576 2439.02 6560
+536.443696 2439.02 6560
+536.456816 2439.02 6560
+536.469936 2439.02 6560
+536.483056 2439.02 6560
+536.496176 2439.02 6560
+536.509296 2439.02 6560
+536.522416 2439.02 6560
+536.535536 2439.02 6560
+536.548656 2439.02 6560
+536.561840 2427.18 6592
+536.575024 2427.18 6592
+536.588208 2427.18 6592
+536.601392 2427.18 6592
+536.614576 2427.18 6592
+536.627760 2427.18 6592
+536.640944 2427.18 6592
+536.654128 2427.18 6592
+536.667312 2427.18 6592
+536.680496 2427.18 6592
+536.693680 2427.18 6592
+536.706864 2427.18 6592
+536.720048 2427.18 6592
+536.733232 2427.18 6592
+536.746416 2427.18 6592
+536.759600 2427.18 6592
+536.772912 2403.85 6656
+536.786224 2403.85 6656
+536.799536 2403.85 6656
+536.812848 2403.85 6656
+536.826160 2403.85 6656
+536.839472 2403.85 6656
+536.852784 2403.85 6656
+536.866096 2403.85 6656
+536.879408 2403.85 6656
+536.892720 2403.85 6656
+536.906032 2403.85 6656
+536.919344 2403.85 6656
+536.932656 2403.85 6656
+536.945968 2403.85 6656
+536.959280 2403.85 6656
+536.972592 2403.85 6656
+536.985968 2392.34 6688
+536.999344 2392.34 6688
+537.012720 2392.34 6688
+537.026096 2392.34 6688
+537.039472 2392.34 6688
+537.052848 2392.34 6688
+537.066224 2392.34 6688
+537.079600 2392.34 6688
+537.092976 2392.34 6688
+537.106352 2392.34 6688
+537.119728 2392.34 6688
+537.133104 2392.34 6688
+537.146480 2392.34 6688
+537.159856 2392.34 6688
+537.173232 2392.34 6688
+537.186608 2392.34 6688
+537.200048 2380.95 6720
+537.213488 2380.95 6720
+537.226928 2380.95 6720
+537.240368 2380.95 6720
+537.253808 2380.95 6720
+537.267248 2380.95 6720
+537.280688 2380.95 6720
+537.294128 2380.95 6720
+537.307568 2380.95 6720
+537.321008 2380.95 6720
+537.334448 2380.95 6720
+537.347888 2380.95 6720
+537.361328 2380.95 6720
+537.374768 2380.95 6720
+537.388208 2380.95 6720
+537.401648 2380.95 6720
+537.415152 2369.67 6752
+537.428656 2369.67 6752
+537.442160 2369.67 6752
+537.455664 2369.67 6752
+537.469168 2369.67 6752
+537.482672 2369.67 6752
+537.496176 2369.67 6752
+537.509680 2369.67 6752
+537.523248 2358.49 6784
+537.536816 2358.49 6784
+537.550384 2358.49 6784
+537.563952 2358.49 6784
+537.577520 2358.49 6784
+537.591088 2358.49 6784
+537.604656 2358.49 6784
+537.618224 2358.49 6784
+537.631792 2358.49 6784
+537.645360 2358.49 6784
+537.658928 2358.49 6784
+537.672496 2358.49 6784
+537.686064 2358.49 6784
+537.699632 2358.49 6784
+537.713200 2358.49 6784
+537.726768 2358.49 6784
+537.740400 2347.42 6816
+537.754032 2347.42 6816
+537.767664 2347.42 6816
+537.781296 2347.42 6816
+537.794928 2347.42 6816
+537.808560 2347.42 6816
+537.822192 2347.42 6816
+537.835824 2347.42 6816
+537.849456 2347.42 6816
+537.863088 2347.42 6816
+537.876720 2347.42 6816
+537.890352 2347.42 6816
+537.903984 2347.42 6816
+537.917616 2347.42 6816
+537.931248 2347.42 6816
+537.944880 2347.42 6816
+537.958576 2336.45 6848
+537.972272 2336.45 6848
+537.985968 2336.45 6848
+537.999664 2336.45 6848
+538.013360 2336.45 6848
+538.027056 2336.45 6848
+538.040752 2336.45 6848
+538.054448 2336.45 6848
+538.068144 2336.45 6848
+538.081840 2336.45 6848
+538.095536 2336.45 6848
+538.109232 2336.45 6848
+538.122928 2336.45 6848
+538.136624 2336.45 6848
+538.150320 2336.45 6848
+538.164016 2336.45 6848
+538.177840 2314.81 6912
+538.191664 2314.81 6912
+538.205488 2314.81 6912
+538.219312 2314.81 6912
+538.233136 2314.81 6912
+538.246960 2314.81 6912
+538.260784 2314.81 6912
+538.274608 2314.81 6912
+538.288432 2314.81 6912
+538.302256 2314.81 6912
+538.316080 2314.81 6912
+538.329904 2314.81 6912
+538.343728 2314.81 6912
+538.357552 2314.81 6912
+538.371376 2314.81 6912
+538.385200 2314.81 6912
+538.399088 2304.15 6944
+538.412976 2304.15 6944
+538.426864 2304.15 6944
+538.440752 2304.15 6944
+538.454640 2304.15 6944
+538.468528 2304.15 6944
+538.482416 2304.15 6944
+538.496304 2304.15 6944
+538.510192 2304.15 6944
+538.524080 2304.15 6944
+538.537968 2304.15 6944
+538.551856 2304.15 6944
+538.565744 2304.15 6944
+538.579632 2304.15 6944
+538.593520 2304.15 6944
+538.607408 2304.15 6944
+538.621360 2293.58 6976
+538.635312 2293.58 6976
+538.649264 2293.58 6976
+538.663216 2293.58 6976
+538.677168 2293.58 6976
+538.691120 2293.58 6976
+538.705072 2293.58 6976
+538.719024 2293.58 6976
+538.733040 2283.11 7008
+538.747056 2283.11 7008
+538.761072 2283.11 7008
+538.775088 2283.11 7008
+538.789104 2283.11 7008
+538.803120 2283.11 7008
+538.817136 2283.11 7008
+538.831152 2283.11 7008
+538.845168 2283.11 7008
+538.859184 2283.11 7008
+538.873200 2283.11 7008
+538.887216 2283.11 7008
+538.901232 2283.11 7008
+538.915248 2283.11 7008
+538.929264 2283.11 7008
+538.943280 2283.11 7008
+538.957360 2272.73 7040
+538.971440 2272.73 7040
+538.985520 2272.73 7040
+538.999600 2272.73 7040
+539.013680 2272.73 7040
+539.027760 2272.73 7040
+539.041840 2272.73 7040
+539.055920 2272.73 7040
+539.070000 2272.73 7040
+539.084080 2272.73 7040
+539.098160 2272.73 7040
+539.112240 2272.73 7040
+539.126320 2272.73 7040
+539.140400 2272.73 7040
+539.154480 2272.73 7040
+539.168560 2272.73 7040
+539.182704 2262.44 7072
+539.196848 2262.44 7072
+539.210992 2262.44 7072
+539.225136 2262.44 7072
+539.239280 2262.44 7072
+539.253424 2262.44 7072
+539.267568 2262.44 7072
+539.281712 2262.44 7072
+539.295856 2262.44 7072
+539.310000 2262.44 7072
+539.324144 2262.44 7072
+539.338288 2262.44 7072
+539.352432 2262.44 7072
+539.366576 2262.44 7072
+539.380720 2262.44 7072
+539.394864 2262.44 7072
+539.409136 2242.15 7136
+539.423408 2242.15 7136
+539.437680 2242.15 7136
+539.451952 2242.15 7136
+539.466224 2242.15 7136
+539.480496 2242.15 7136
+539.494768 2242.15 7136
+539.509040 2242.15 7136
+539.523376 2232.14 7168
+539.537712 2232.14 7168
+539.552048 2232.14 7168
+539.566384 2232.14 7168
+539.580720 2232.14 7168
+539.595056 2232.14 7168
+539.609392 2232.14 7168
+539.623728 2232.14 7168
+539.638064 2232.14 7168
+539.652400 2232.14 7168
+539.666736 2232.14 7168
+539.681072 2232.14 7168
+539.695408 2232.14 7168
+539.709744 2232.14 7168
+539.724080 2232.14 7168
+539.738416 2232.14 7168
+539.752816 2222.22 7200
+539.767216 2222.22 7200
+539.781616 2222.22 7200
+539.796016 2222.22 7200
+539.810416 2222.22 7200
+539.824816 2222.22 7200
+539.839216 2222.22 7200
+539.853616 2222.22 7200
+539.868016 2222.22 7200
+539.882416 2222.22 7200
+539.896816 2222.22 7200
+539.911216 2222.22 7200
+539.925616 2222.22 7200
+539.940016 2222.22 7200
+539.954416 2222.22 7200
+539.968816 2222.22 7200
+539.983280 2212.39 7232
+539.997744 2212.39 7232
+540.012208 2212.39 7232
+540.026672 2212.39 7232
+540.041136 2212.39 7232
+540.055600 2212.39 7232
+540.070064 2212.39 7232
+540.084528 2212.39 7232
+540.099120 2192.98 7296
+540.113712 2192.98 7296
+540.128304 2192.98 7296
+540.142896 2192.98 7296
+540.157488 2192.98 7296
+540.172080 2192.98 7296
+540.186672 2192.98 7296
+540.201264 2192.98 7296
+540.215856 2192.98 7296
+540.230448 2192.98 7296
+540.245040 2192.98 7296
+540.259632 2192.98 7296
+540.274224 2192.98 7296
+540.288816 2192.98 7296
+540.303408 2192.98 7296
+540.318000 2192.98 7296
+540.332656 2183.41 7328
+540.347312 2183.41 7328
+540.361968 2183.41 7328
+540.376624 2183.41 7328
+540.391280 2183.41 7328
+540.405936 2183.41 7328
+540.420592 2183.41 7328
+540.435248 2183.41 7328
+540.449904 2183.41 7328
+540.464560 2183.41 7328
+540.479216 2183.41 7328
+540.493872 2183.41 7328
+540.508528 2183.41 7328
+540.523184 2183.41 7328
+540.537840 2183.41 7328
+540.552496 2183.41 7328
+540.567216 2173.91 7360
+540.581936 2173.91 7360
+540.596656 2173.91 7360
+540.611376 2173.91 7360
+540.626096 2173.91 7360
+540.640816 2173.91 7360
+540.655536 2173.91 7360
+540.670256 2173.91 7360
+540.685040 2164.50 7392
+540.699824 2164.50 7392
+540.714608 2164.50 7392
+540.729392 2164.50 7392
+540.744176 2164.50 7392
+540.758960 2164.50 7392
+540.773744 2164.50 7392
+540.788528 2164.50 7392
+540.803312 2164.50 7392
+540.818096 2164.50 7392
+540.832880 2164.50 7392
+540.847664 2164.50 7392
+540.862448 2164.50 7392
+540.877232 2164.50 7392
+540.892016 2164.50 7392
+540.906800 2164.50 7392
+540.921712 2145.92 7456
+540.936624 2145.92 7456
+540.951536 2145.92 7456
+540.966448 2145.92 7456
+540.981360 2145.92 7456
+540.996272 2145.92 7456
+541.011184 2145.92 7456
+541.026096 2145.92 7456
+541.041072 2136.75 7488
+541.056048 2136.75 7488
+541.071024 2136.75 7488
+541.086000 2136.75 7488
+541.100976 2136.75 7488
+541.115952 2136.75 7488
+541.130928 2136.75 7488
+541.145904 2136.75 7488
+541.160880 2136.75 7488
+541.175856 2136.75 7488
+541.190832 2136.75 7488
+541.205808 2136.75 7488
+541.220784 2136.75 7488
+541.235760 2136.75 7488
+541.250736 2136.75 7488
+541.265712 2136.75 7488
+541.280752 2127.66 7520
+541.295792 2127.66 7520
+541.310832 2127.66 7520
+541.325872 2127.66 7520
+541.340912 2127.66 7520
+541.355952 2127.66 7520
+541.370992 2127.66 7520
+541.386032 2127.66 7520
+541.401136 2118.64 7552
+541.416240 2118.64 7552
+541.431344 2118.64 7552
+541.446448 2118.64 7552
+541.461552 2118.64 7552
+541.476656 2118.64 7552
+541.491760 2118.64 7552
+541.506864 2118.64 7552
+541.521968 2118.64 7552
+541.537072 2118.64 7552
+541.552176 2118.64 7552
+541.567280 2118.64 7552
+541.582384 2118.64 7552
+541.597488 2118.64 7552
+541.612592 2118.64 7552
+541.627696 2118.64 7552
+541.642928 2100.84 7616
+541.658160 2100.84 7616
+541.673392 2100.84 7616
+541.688624 2100.84 7616
+541.703856 2100.84 7616
+541.719088 2100.84 7616
+541.734320 2100.84 7616
+541.749552 2100.84 7616
+541.764848 2092.05 7648
+541.780144 2092.05 7648
+541.795440 2092.05 7648
+541.810736 2092.05 7648
+541.826032 2092.05 7648
+541.841328 2092.05 7648
+541.856624 2092.05 7648
+541.871920 2092.05 7648
+541.887216 2092.05 7648
+541.902512 2092.05 7648
+541.917808 2092.05 7648
+541.933104 2092.05 7648
+541.948400 2092.05 7648
+541.963696 2092.05 7648
+541.978992 2092.05 7648
+541.994288 2092.05 7648
+542.009648 2083.33 7680
+542.025008 2083.33 7680
+542.040368 2083.33 7680
+542.055728 2083.33 7680
+542.071088 2083.33 7680
+542.086448 2083.33 7680
+542.101808 2083.33 7680
+542.117168 2083.33 7680
+542.132656 2066.12 7744
+542.148144 2066.12 7744
+542.163632 2066.12 7744
+542.179120 2066.12 7744
+542.194608 2066.12 7744
+542.210096 2066.12 7744
+542.225584 2066.12 7744
+542.241072 2066.12 7744
+542.256560 2066.12 7744
+542.272048 2066.12 7744
+542.287536 2066.12 7744
+542.303024 2066.12 7744
+542.318512 2066.12 7744
+542.334000 2066.12 7744
+542.349488 2066.12 7744
+542.364976 2066.12 7744
+542.380528 2057.61 7776
+542.396080 2057.61 7776
+542.411632 2057.61 7776
+542.427184 2057.61 7776
+542.442736 2057.61 7776
+542.458288 2057.61 7776
+542.473840 2057.61 7776
+542.489392 2057.61 7776
+542.505008 2049.18 7808
+542.520624 2049.18 7808
+542.536240 2049.18 7808
+542.551856 2049.18 7808
+542.567472 2049.18 7808
+542.583088 2049.18 7808
+542.598704 2049.18 7808
+542.614320 2049.18 7808
+542.629936 2049.18 7808
+542.645552 2049.18 7808
+542.661168 2049.18 7808
+542.676784 2049.18 7808
+542.692400 2049.18 7808
+542.708016 2049.18 7808
+542.723632 2049.18 7808
+542.739248 2049.18 7808
+542.754992 2032.52 7872
+542.770736 2032.52 7872
+542.786480 2032.52 7872
+542.802224 2032.52 7872
+542.817968 2032.52 7872
+542.833712 2032.52 7872
+542.849456 2032.52 7872
+542.865200 2032.52 7872
+542.881008 2024.29 7904
+542.896816 2024.29 7904
+542.912624 2024.29 7904
+542.928432 2024.29 7904
+542.944240 2024.29 7904
+542.960048 2024.29 7904
+542.975856 2024.29 7904
+542.991664 2024.29 7904
+543.007472 2024.29 7904
+543.023280 2024.29 7904
+543.039088 2024.29 7904
+543.054896 2024.29 7904
+543.070768 2016.13 7936
+543.086640 2016.13 7936
+543.102512 2016.13 7936
+543.118384 2016.13 7936
+543.134256 2016.13 7936
+543.150128 2016.13 7936
+543.166000 2016.13 7936
+543.181872 2016.13 7936
+543.197744 2016.13 7936
+543.213616 2016.13 7936
+543.229488 2016.13 7936
+543.245360 2016.13 7936
+543.261360 2000.00 8000
+543.277360 2000.00 8000
+543.293360 2000.00 8000
+543.309360 2000.00 8000
+543.325360 2000.00 8000
+543.341360 2000.00 8000
+543.357360 2000.00 8000
+543.373360 2000.00 8000
+543.389360 2000.00 8000
+543.405360 2000.00 8000
+543.421360 2000.00 8000
+543.437360 2000.00 8000
+543.453424 1992.03 8032
+543.461456 1992.03 8032
+543.469488 1992.03 8032
+543.477520 1992.03 8032
+543.485552 1992.03 8032
+543.493584 1992.03 8032
+543.501616 1992.03 8032
+543.509648 1992.03 8032
+543.517680 1992.03 8032
+543.525712 1992.03 8032
+543.533744 1992.03 8032
+543.541776 1992.03 8032
+543.549808 1992.03 8032
+543.557840 1992.03 8032
+543.565872 1992.03 8032
+543.573904 1992.03 8032
+543.581968 1984.13 8064
+543.590032 1984.13 8064
+543.598096 1984.13 8064
+543.606160 1984.13 8064
+543.614224 1984.13 8064
+543.622288 1984.13 8064
+543.630352 1984.13 8064
+543.638416 1984.13 8064
+543.646480 1984.13 8064
+543.654544 1984.13 8064
+543.662608 1984.13 8064
+543.670672 1984.13 8064
+543.678736 1984.13 8064
+543.686800 1984.13 8064
+543.694864 1984.13 8064
+543.702928 1984.13 8064
+543.710992 1984.13 8064
+543.719056 1984.13 8064
+543.727120 1984.13 8064
+543.735184 1984.13 8064
+543.743248 1984.13 8064
+543.751312 1984.13 8064
+543.759376 1984.13 8064
+543.767440 1984.13 8064
+543.775568 1968.50 8128
+543.783696 1968.50 8128
+543.791824 1968.50 8128
+543.799952 1968.50 8128
+543.808080 1968.50 8128
+543.816208 1968.50 8128
+543.824336 1968.50 8128
+543.832464 1968.50 8128
+543.840592 1968.50 8128
+543.848720 1968.50 8128
+543.856848 1968.50 8128
+543.864976 1968.50 8128
+543.873104 1968.50 8128
+543.881232 1968.50 8128
+543.889360 1968.50 8128
+543.897488 1968.50 8128
+543.905616 1968.50 8128
+543.913744 1968.50 8128
+543.921872 1968.50 8128
+543.930000 1968.50 8128
+543.938128 1968.50 8128
+543.946256 1968.50 8128
+543.954384 1968.50 8128
+543.962512 1968.50 8128
+543.970672 1960.78 8160
+543.978832 1960.78 8160
+543.986992 1960.78 8160
+543.995152 1960.78 8160
+544.003312 1960.78 8160
+544.011472 1960.78 8160
+544.019632 1960.78 8160
+544.027792 1960.78 8160
+544.035952 1960.78 8160
+544.044112 1960.78 8160
+544.052272 1960.78 8160
+544.060432 1960.78 8160
+544.068592 1960.78 8160
+544.076752 1960.78 8160
+544.084912 1960.78 8160
+544.093072 1960.78 8160
+544.101264 1953.12 8192
+544.109456 1953.12 8192
+544.117648 1953.12 8192
+544.125840 1953.12 8192
+544.134032 1953.12 8192
+544.142224 1953.12 8192
+544.150416 1953.12 8192
+544.158608 1953.12 8192
+544.166800 1953.12 8192
+544.174992 1953.12 8192
+544.183184 1953.12 8192
+544.191376 1953.12 8192
+544.199568 1953.12 8192
+544.207760 1953.12 8192
+544.215952 1953.12 8192
+544.224144 1953.12 8192
+544.232336 1953.12 8192
+544.240528 1953.12 8192
+544.248720 1953.12 8192
+544.256912 1953.12 8192
+544.265104 1953.12 8192
+544.273296 1953.12 8192
+544.281488 1953.12 8192
+544.289680 1953.12 8192
+544.297936 1937.98 8256
+544.306192 1937.98 8256
+544.314448 1937.98 8256
+544.322704 1937.98 8256
+544.330960 1937.98 8256
+544.339216 1937.98 8256
+544.347472 1937.98 8256
+544.355728 1937.98 8256
+544.363984 1937.98 8256
+544.372240 1937.98 8256
+544.380496 1937.98 8256
+544.388752 1937.98 8256
+544.397008 1937.98 8256
+544.405264 1937.98 8256
+544.413520 1937.98 8256
+544.421776 1937.98 8256
+544.430032 1937.98 8256
+544.438288 1937.98 8256
+544.446544 1937.98 8256
+544.454800 1937.98 8256
+544.463056 1937.98 8256
+544.471312 1937.98 8256
+544.479568 1937.98 8256
+544.487824 1937.98 8256
+544.496080 1937.98 8256
+544.504336 1937.98 8256
+544.512592 1937.98 8256
+544.520848 1937.98 8256
+544.529104 1937.98 8256
+544.537360 1937.98 8256
+544.545616 1937.98 8256
+544.553872 1937.98 8256
+544.562128 1937.98 8256
+544.570384 1937.98 8256
+544.578640 1937.98 8256
+544.586896 1937.98 8256
+544.595152 1937.98 8256
+544.603408 1937.98 8256
+544.611664 1937.98 8256
+544.619920 1937.98 8256
+544.628240 1923.08 8320
+544.636560 1923.08 8320
+544.644880 1923.08 8320
+544.653200 1923.08 8320
+544.661520 1923.08 8320
+544.669840 1923.08 8320
+544.678160 1923.08 8320
+544.686480 1923.08 8320
+544.694800 1923.08 8320
+544.703120 1923.08 8320
+544.711440 1923.08 8320
+544.719760 1923.08 8320
+544.728080 1923.08 8320
+544.736400 1923.08 8320
+544.744720 1923.08 8320
+544.753040 1923.08 8320
+544.761424 1908.40 8384
+544.769808 1908.40 8384
+544.778192 1908.40 8384
+544.786576 1908.40 8384
+544.794960 1908.40 8384
+544.803344 1908.40 8384
+544.811728 1908.40 8384
+544.820112 1908.40 8384
+544.828496 1908.40 8384
+544.836880 1908.40 8384
+544.845264 1908.40 8384
+544.853648 1908.40 8384
+544.862032 1908.40 8384
+544.870416 1908.40 8384
+544.878800 1908.40 8384
+544.887184 1908.40 8384
+544.895568 1908.40 8384
+544.903952 1908.40 8384
+544.912336 1908.40 8384
+544.920720 1908.40 8384
+544.929104 1908.40 8384
+544.937488 1908.40 8384
+544.945872 1908.40 8384
+544.954256 1908.40 8384
+544.962704 1893.94 8448
+544.971152 1893.94 8448
+544.979600 1893.94 8448
+544.988048 1893.94 8448
+544.996496 1893.94 8448
+545.004944 1893.94 8448
+545.013392 1893.94 8448
+545.021840 1893.94 8448
+545.030288 1893.94 8448
+545.038736 1893.94 8448
+545.047184 1893.94 8448
+545.055632 1893.94 8448
+545.064080 1893.94 8448
+545.072528 1893.94 8448
+545.080976 1893.94 8448
+545.089424 1893.94 8448
+545.097872 1893.94 8448
+545.106320 1893.94 8448
+545.114768 1893.94 8448
+545.123216 1893.94 8448
+545.131664 1893.94 8448
+545.140112 1893.94 8448
+545.148560 1893.94 8448
+545.157008 1893.94 8448
+545.165456 1893.94 8448
+545.173904 1893.94 8448
+545.182352 1893.94 8448
+545.190800 1893.94 8448
+545.199248 1893.94 8448
+545.207696 1893.94 8448
+545.216144 1893.94 8448
+545.224592 1893.94 8448
+545.233040 1893.94 8448
+545.241488 1893.94 8448
+545.249936 1893.94 8448
+545.258384 1893.94 8448
+545.266832 1893.94 8448
+545.275280 1893.94 8448
+545.283728 1893.94 8448
+545.292176 1893.94 8448
+545.300688 1879.70 8512
+545.309200 1879.70 8512
+545.317712 1879.70 8512
+545.326224 1879.70 8512
+545.334736 1879.70 8512
+545.343248 1879.70 8512
+545.351760 1879.70 8512
+545.360272 1879.70 8512
+545.368784 1879.70 8512
+545.377296 1879.70 8512
+545.385808 1879.70 8512
+545.394320 1879.70 8512
+545.402832 1879.70 8512
+545.411344 1879.70 8512
+545.419856 1879.70 8512
+545.428368 1879.70 8512
+545.436944 1865.67 8576
+545.445520 1865.67 8576
+545.454096 1865.67 8576
+545.462672 1865.67 8576
+545.471248 1865.67 8576
+545.479824 1865.67 8576
+545.488400 1865.67 8576
+545.496976 1865.67 8576
+545.505552 1865.67 8576
+545.514128 1865.67 8576
+545.522704 1865.67 8576
+545.531280 1865.67 8576
+545.539856 1865.67 8576
+545.548432 1865.67 8576
+545.557008 1865.67 8576
+545.565584 1865.67 8576
+545.574224 1851.85 8640
+545.582864 1851.85 8640
+545.591504 1851.85 8640
+545.600144 1851.85 8640
+545.608784 1851.85 8640
+545.617424 1851.85 8640
+545.626064 1851.85 8640
+545.634704 1851.85 8640
+545.643344 1851.85 8640
+545.651984 1851.85 8640
+545.660624 1851.85 8640
+545.669264 1851.85 8640
+545.677904 1851.85 8640
+545.686544 1851.85 8640
+545.695184 1851.85 8640
+545.703824 1851.85 8640
+545.712464 1851.85 8640
+545.721104 1851.85 8640
+545.729744 1851.85 8640
+545.738384 1851.85 8640
+545.747024 1851.85 8640
+545.755664 1851.85 8640
+545.764304 1851.85 8640
+545.772944 1851.85 8640
+545.781584 1851.85 8640
+545.790224 1851.85 8640
+545.798864 1851.85 8640
+545.807504 1851.85 8640
+545.816144 1851.85 8640
+545.824784 1851.85 8640
+545.833424 1851.85 8640
+545.842064 1851.85 8640
+545.850704 1851.85 8640
+545.859344 1851.85 8640
+545.867984 1851.85 8640
+545.876624 1851.85 8640
+545.885264 1851.85 8640
+545.893904 1851.85 8640
+545.902544 1851.85 8640
+545.911184 1851.85 8640
+545.919888 1838.24 8704
+545.928592 1838.24 8704
+545.937296 1838.24 8704
+545.946000 1838.24 8704
+545.954704 1838.24 8704
+545.963408 1838.24 8704
+545.972112 1838.24 8704
+545.980816 1838.24 8704
+545.989520 1838.24 8704
+545.998224 1838.24 8704
+546.006928 1838.24 8704
+546.015632 1838.24 8704
+546.024336 1838.24 8704
+546.033040 1838.24 8704
+546.041744 1838.24 8704
+546.050448 1838.24 8704
+546.059216 1824.82 8768
+546.067984 1824.82 8768
+546.076752 1824.82 8768
+546.085520 1824.82 8768
+546.094288 1824.82 8768
+546.103056 1824.82 8768
+546.111824 1824.82 8768
+546.120592 1824.82 8768
+546.129360 1824.82 8768
+546.138128 1824.82 8768
+546.146896 1824.82 8768
+546.155664 1824.82 8768
+546.164432 1824.82 8768
+546.173200 1824.82 8768
+546.181968 1824.82 8768
+546.190736 1824.82 8768
+546.199504 1824.82 8768
+546.208272 1824.82 8768
+546.217040 1824.82 8768
+546.225808 1824.82 8768
+546.234576 1824.82 8768
+546.243344 1824.82 8768
+546.252112 1824.82 8768
+546.260880 1824.82 8768
+546.269648 1824.82 8768
+546.278416 1824.82 8768
+546.287184 1824.82 8768
+546.295952 1824.82 8768
+546.304720 1824.82 8768
+546.313488 1824.82 8768
+546.322256 1824.82 8768
+546.331024 1824.82 8768
+546.339792 1824.82 8768
+546.348560 1824.82 8768
+546.357328 1824.82 8768
+546.366096 1824.82 8768
+546.374864 1824.82 8768
+546.383632 1824.82 8768
+546.392400 1824.82 8768
+546.401168 1824.82 8768
+546.410000 1811.59 8832
+546.418832 1811.59 8832
+546.427664 1811.59 8832
+546.436496 1811.59 8832
+546.445328 1811.59 8832
+546.454160 1811.59 8832
+546.462992 1811.59 8832
+546.471824 1811.59 8832
+546.480656 1811.59 8832
+546.489488 1811.59 8832
+546.498320 1811.59 8832
+546.507152 1811.59 8832
+546.515984 1811.59 8832
+546.524816 1811.59 8832
+546.533648 1811.59 8832
+546.542480 1811.59 8832
+546.551376 1798.56 8896
+546.560272 1798.56 8896
+546.569168 1798.56 8896
+546.578064 1798.56 8896
+546.586960 1798.56 8896
+546.595856 1798.56 8896
+546.604752 1798.56 8896
+546.613648 1798.56 8896
+546.622544 1798.56 8896
+546.631440 1798.56 8896
+546.640336 1798.56 8896
+546.649232 1798.56 8896
+546.658128 1798.56 8896
+546.667024 1798.56 8896
+546.675920 1798.56 8896
+546.684816 1798.56 8896
+546.693776 1785.71 8960
+546.702736 1785.71 8960
+546.711696 1785.71 8960
+546.720656 1785.71 8960
+546.729616 1785.71 8960
+546.738576 1785.71 8960
+546.747536 1785.71 8960
+546.756496 1785.71 8960
+546.765456 1785.71 8960
+546.774416 1785.71 8960
+546.783376 1785.71 8960
+546.792336 1785.71 8960
+546.801296 1785.71 8960
+546.810256 1785.71 8960
+546.819216 1785.71 8960
+546.828176 1785.71 8960
+546.837136 1785.71 8960
+546.846096 1785.71 8960
+546.855056 1785.71 8960
+546.864016 1785.71 8960
+546.872976 1785.71 8960
+546.881936 1785.71 8960
+546.890896 1785.71 8960
+546.899856 1785.71 8960
+546.908816 1785.71 8960
+546.917776 1785.71 8960
+546.926736 1785.71 8960
+546.935696 1785.71 8960
+546.944656 1785.71 8960
+546.953616 1785.71 8960
+546.962576 1785.71 8960
+546.971536 1785.71 8960
+546.980560 1773.05 9024
+546.989584 1773.05 9024
+546.998608 1773.05 9024
+547.007632 1773.05 9024
+547.016656 1773.05 9024
+547.025680 1773.05 9024
+547.034704 1773.05 9024
+547.043728 1773.05 9024
+547.052752 1773.05 9024
+547.061776 1773.05 9024
+547.070800 1773.05 9024
+547.079824 1773.05 9024
+547.088848 1773.05 9024
+547.097872 1773.05 9024
+547.106896 1773.05 9024
+547.115920 1773.05 9024
+547.124944 1773.05 9024
+547.133968 1773.05 9024
+547.142992 1773.05 9024
+547.152016 1773.05 9024
+547.161040 1773.05 9024
+547.170064 1773.05 9024
+547.179088 1773.05 9024
+547.188112 1773.05 9024
+547.197200 1760.56 9088
+547.206288 1760.56 9088
+547.215376 1760.56 9088
+547.224464 1760.56 9088
+547.233552 1760.56 9088
+547.242640 1760.56 9088
+547.251728 1760.56 9088
+547.260816 1760.56 9088
+547.269904 1760.56 9088
+547.278992 1760.56 9088
+547.288080 1760.56 9088
+547.297168 1760.56 9088
+547.306256 1760.56 9088
+547.315344 1760.56 9088
+547.324432 1760.56 9088
+547.333520 1760.56 9088
+547.342672 1748.25 9152
+547.351824 1748.25 9152
+547.360976 1748.25 9152
+547.370128 1748.25 9152
+547.379280 1748.25 9152
+547.388432 1748.25 9152
+547.397584 1748.25 9152
+547.406736 1748.25 9152
+547.415888 1748.25 9152
+547.425040 1748.25 9152
+547.434192 1748.25 9152
+547.443344 1748.25 9152
+547.452496 1748.25 9152
+547.461648 1748.25 9152
+547.470800 1748.25 9152
+547.479952 1748.25 9152
+547.489168 1736.11 9216
+547.498384 1736.11 9216
+547.507600 1736.11 9216
+547.516816 1736.11 9216
+547.526032 1736.11 9216
+547.535248 1736.11 9216
+547.544464 1736.11 9216
+547.553680 1736.11 9216
+547.562896 1736.11 9216
+547.572112 1736.11 9216
+547.581328 1736.11 9216
+547.590544 1736.11 9216
+547.599760 1736.11 9216
+547.608976 1736.11 9216
+547.618192 1736.11 9216
+547.627408 1736.11 9216
+547.636624 1736.11 9216
+547.645840 1736.11 9216
+547.655056 1736.11 9216
+547.664272 1736.11 9216
+547.673488 1736.11 9216
+547.682704 1736.11 9216
+547.691920 1736.11 9216
+547.701136 1736.11 9216
+547.710352 1736.11 9216
+547.719568 1736.11 9216
+547.728784 1736.11 9216
+547.738000 1736.11 9216
+547.747216 1736.11 9216
+547.756432 1736.11 9216
+547.765648 1736.11 9216
+547.774864 1736.11 9216
+547.784144 1724.14 9280
+547.793424 1724.14 9280
+547.802704 1724.14 9280
+547.811984 1724.14 9280
+547.821264 1724.14 9280
+547.830544 1724.14 9280
+547.839824 1724.14 9280
+547.849104 1724.14 9280
+547.858384 1724.14 9280
+547.867664 1724.14 9280
+547.876944 1724.14 9280
+547.886224 1724.14 9280
+547.895504 1724.14 9280
+547.904784 1724.14 9280
+547.914064 1724.14 9280
+547.923344 1724.14 9280
+547.932688 1712.33 9344
+547.942032 1712.33 9344
+547.951376 1712.33 9344
+547.960720 1712.33 9344
+547.970064 1712.33 9344
+547.979408 1712.33 9344
+547.988752 1712.33 9344
+547.998096 1712.33 9344
+548.007440 1712.33 9344
+548.016784 1712.33 9344
+548.026128 1712.33 9344
+548.035472 1712.33 9344
+548.044816 1712.33 9344
+548.054160 1712.33 9344
+548.063504 1712.33 9344
+548.072848 1712.33 9344
+548.082256 1700.68 9408
+548.091664 1700.68 9408
+548.101072 1700.68 9408
+548.110480 1700.68 9408
+548.119888 1700.68 9408
+548.129296 1700.68 9408
+548.138704 1700.68 9408
+548.148112 1700.68 9408
+548.157520 1700.68 9408
+548.166928 1700.68 9408
+548.176336 1700.68 9408
+548.185744 1700.68 9408
+548.195152 1700.68 9408
+548.204560 1700.68 9408
+548.213968 1700.68 9408
+548.223376 1700.68 9408
+548.232784 1700.68 9408
+548.242192 1700.68 9408
+548.251600 1700.68 9408
+548.261008 1700.68 9408
+548.270416 1700.68 9408
+548.279824 1700.68 9408
+548.289232 1700.68 9408
+548.298640 1700.68 9408
+548.308048 1700.68 9408
+548.317456 1700.68 9408
+548.326864 1700.68 9408
+548.336272 1700.68 9408
+548.345680 1700.68 9408
+548.355088 1700.68 9408
+548.364496 1700.68 9408
+548.373904 1700.68 9408
+548.383376 1689.19 9472
+548.392848 1689.19 9472
+548.402320 1689.19 9472
+548.411792 1689.19 9472
+548.421264 1689.19 9472
+548.430736 1689.19 9472
+548.440208 1689.19 9472
+548.449680 1689.19 9472
+548.459152 1689.19 9472
+548.468624 1689.19 9472
+548.478096 1689.19 9472
+548.487568 1689.19 9472
+548.497040 1689.19 9472
+548.506512 1689.19 9472
+548.515984 1689.19 9472
+548.525456 1689.19 9472
+548.534992 1677.85 9536
+548.544528 1677.85 9536
+548.554064 1677.85 9536
+548.563600 1677.85 9536
+548.573136 1677.85 9536
+548.582672 1677.85 9536
+548.592208 1677.85 9536
+548.601744 1677.85 9536
+548.611344 1666.67 9600
+548.620944 1666.67 9600
+548.630544 1666.67 9600
+548.640144 1666.67 9600
+548.649744 1666.67 9600
+548.659344 1666.67 9600
+548.668944 1666.67 9600
+548.678544 1666.67 9600
+548.688144 1666.67 9600
+548.697744 1666.67 9600
+548.707344 1666.67 9600
+548.716944 1666.67 9600
+548.726544 1666.67 9600
+548.736144 1666.67 9600
+548.745744 1666.67 9600
+548.755344 1666.67 9600
+548.765008 1655.63 9664
+548.774672 1655.63 9664
+548.784336 1655.63 9664
+548.794000 1655.63 9664
+548.803664 1655.63 9664
+548.813328 1655.63 9664
+548.822992 1655.63 9664
+548.832656 1655.63 9664
+548.842320 1655.63 9664
+548.851984 1655.63 9664
+548.861648 1655.63 9664
+548.871312 1655.63 9664
+548.880976 1655.63 9664
+548.890640 1655.63 9664
+548.900304 1655.63 9664
+548.909968 1655.63 9664
+548.919696 1644.74 9728
+548.929424 1644.74 9728
+548.939152 1644.74 9728
+548.948880 1644.74 9728
+548.958608 1644.74 9728
+548.968336 1644.74 9728
+548.978064 1644.74 9728
+548.987792 1644.74 9728
+548.997520 1644.74 9728
+549.007248 1644.74 9728
+549.016976 1644.74 9728
+549.026704 1644.74 9728
+549.036432 1644.74 9728
+549.046160 1644.74 9728
+549.055888 1644.74 9728
+549.065616 1644.74 9728
+549.075344 1644.74 9728
+549.085072 1644.74 9728
+549.094800 1644.74 9728
+549.104528 1644.74 9728
+549.114256 1644.74 9728
+549.123984 1644.74 9728
+549.133712 1644.74 9728
+549.143440 1644.74 9728
+549.153168 1644.74 9728
+549.162896 1644.74 9728
+549.172624 1644.74 9728
+549.182352 1644.74 9728
+549.192080 1644.74 9728
+549.201808 1644.74 9728
+549.211536 1644.74 9728
+549.221264 1644.74 9728
+549.231056 1633.99 9792
+549.240848 1633.99 9792
+549.250640 1633.99 9792
+549.260432 1633.99 9792
+549.270224 1633.99 9792
+549.280016 1633.99 9792
+549.289808 1633.99 9792
+549.299600 1633.99 9792
+549.309392 1633.99 9792
+549.319184 1633.99 9792
+549.328976 1633.99 9792
+549.338768 1633.99 9792
+549.348560 1633.99 9792
+549.358352 1633.99 9792
+549.368144 1633.99 9792
+549.377936 1633.99 9792
+549.387792 1623.38 9856
+549.397648 1623.38 9856
+549.407504 1623.38 9856
+549.417360 1623.38 9856
+549.427216 1623.38 9856
+549.437072 1623.38 9856
+549.446928 1623.38 9856
+549.456784 1623.38 9856
+549.466704 1612.90 9920
+549.476624 1612.90 9920
+549.486544 1612.90 9920
+549.496464 1612.90 9920
+549.506384 1612.90 9920
+549.516304 1612.90 9920
+549.526224 1612.90 9920
+549.536144 1612.90 9920
+549.546064 1612.90 9920
+549.555984 1612.90 9920
+549.565904 1612.90 9920
+549.575824 1612.90 9920
+549.585744 1612.90 9920
+549.595664 1612.90 9920
+549.605584 1612.90 9920
+549.615504 1612.90 9920
+549.625488 1602.56 9984
+549.635472 1602.56 9984
+549.645456 1602.56 9984
+549.655440 1602.56 9984
+549.665424 1602.56 9984
+549.675408 1602.56 9984
+549.685392 1602.56 9984
+549.695376 1602.56 9984
+549.705360 1602.56 9984
+549.715344 1602.56 9984
+549.725328 1602.56 9984
+549.735312 1602.56 9984
+549.745296 1602.56 9984
+549.755280 1602.56 9984
+549.765264 1602.56 9984
+549.775248 1602.56 9984
+549.785296 1592.36 10048
+549.795344 1592.36 10048
+549.805392 1592.36 10048
+549.815440 1592.36 10048
+549.825488 1592.36 10048
+549.835536 1592.36 10048
+549.845584 1592.36 10048
+549.855632 1592.36 10048
+549.865680 1592.36 10048
+549.875728 1592.36 10048
+549.885776 1592.36 10048
+549.895824 1592.36 10048
+549.905872 1592.36 10048
+549.915920 1592.36 10048
+549.925968 1592.36 10048
+549.936016 1592.36 10048
+549.946064 1592.36 10048
+549.956112 1592.36 10048
+549.966160 1592.36 10048
+549.976208 1592.36 10048
+549.986256 1592.36 10048
+549.996304 1592.36 10048
+550.006352 1592.36 10048
+550.016400 1592.36 10048
+550.026512 1582.28 10112
+550.036624 1582.28 10112
+550.046736 1582.28 10112
+550.056848 1582.28 10112
+550.066960 1582.28 10112
+550.077072 1582.28 10112
+550.087184 1582.28 10112
+550.097296 1582.28 10112
+550.107408 1582.28 10112
+550.117520 1582.28 10112
+550.127632 1582.28 10112
+550.137744 1582.28 10112
+550.147856 1582.28 10112
+550.157968 1582.28 10112
+550.168080 1582.28 10112
+550.178192 1582.28 10112
+550.188368 1572.33 10176
+550.198544 1572.33 10176
+550.208720 1572.33 10176
+550.218896 1572.33 10176
+550.229072 1572.33 10176
+550.239248 1572.33 10176
+550.249424 1572.33 10176
+550.259600 1572.33 10176
+550.269776 1572.33 10176
+550.279952 1572.33 10176
+550.290128 1572.33 10176
+550.300304 1572.33 10176
+550.310480 1572.33 10176
+550.320656 1572.33 10176
+550.330832 1572.33 10176
+550.341008 1572.33 10176
+550.351248 1562.50 10240
+550.361488 1562.50 10240
+550.371728 1562.50 10240
+550.381968 1562.50 10240
+550.392208 1562.50 10240
+550.402448 1562.50 10240
+550.412688 1562.50 10240
+550.422928 1562.50 10240
+550.433232 1552.80 10304
+550.443536 1552.80 10304
+550.453840 1552.80 10304
+550.464144 1552.80 10304
+550.474448 1552.80 10304
+550.484752 1552.80 10304
+550.495056 1552.80 10304
+550.505360 1552.80 10304
+550.515664 1552.80 10304
+550.525968 1552.80 10304
+550.536272 1552.80 10304
+550.546576 1552.80 10304
+550.556880 1552.80 10304
+550.567184 1552.80 10304
+550.577488 1552.80 10304
+550.587792 1552.80 10304
+550.598160 1543.21 10368
+550.608528 1543.21 10368
+550.618896 1543.21 10368
+550.629264 1543.21 10368
+550.639632 1543.21 10368
+550.650000 1543.21 10368
+550.660368 1543.21 10368
+550.670736 1543.21 10368
+550.681104 1543.21 10368
+550.691472 1543.21 10368
+550.701840 1543.21 10368
+550.712208 1543.21 10368
+550.722576 1543.21 10368
+550.732944 1543.21 10368
+550.743312 1543.21 10368
+550.753680 1543.21 10368
+550.764112 1533.74 10432
+550.774544 1533.74 10432
+550.784976 1533.74 10432
+550.795408 1533.74 10432
+550.805840 1533.74 10432
+550.816272 1533.74 10432
+550.826704 1533.74 10432
+550.837136 1533.74 10432
+550.847568 1533.74 10432
+550.858000 1533.74 10432
+550.868432 1533.74 10432
+550.878864 1533.74 10432
+550.889296 1533.74 10432
+550.899728 1533.74 10432
+550.910160 1533.74 10432
+550.920592 1533.74 10432
+550.931024 1533.74 10432
+550.941456 1533.74 10432
+550.951888 1533.74 10432
+550.962320 1533.74 10432
+550.972752 1533.74 10432
+550.983184 1533.74 10432
+550.993616 1533.74 10432
+551.004048 1533.74 10432
+551.014544 1524.39 10496
+551.025040 1524.39 10496
+551.035536 1524.39 10496
+551.046032 1524.39 10496
+551.056528 1524.39 10496
+551.067024 1524.39 10496
+551.077520 1524.39 10496
+551.088016 1524.39 10496
+551.098576 1515.15 10560
+551.109136 1515.15 10560
+551.119696 1515.15 10560
+551.130256 1515.15 10560
+551.140816 1515.15 10560
+551.151376 1515.15 10560
+551.161936 1515.15 10560
+551.172496 1515.15 10560
+551.183056 1515.15 10560
+551.193616 1515.15 10560
+551.204176 1515.15 10560
+551.214736 1515.15 10560
+551.225296 1515.15 10560
+551.235856 1515.15 10560
+551.246416 1515.15 10560
+551.256976 1515.15 10560
+551.267600 1506.02 10624
+551.278224 1506.02 10624
+551.288848 1506.02 10624
+551.299472 1506.02 10624
+551.310096 1506.02 10624
+551.320720 1506.02 10624
+551.331344 1506.02 10624
+551.341968 1506.02 10624
+551.352656 1497.01 10688
+551.363344 1497.01 10688
+551.374032 1497.01 10688
+551.384720 1497.01 10688
+551.395408 1497.01 10688
+551.406096 1497.01 10688
+551.416784 1497.01 10688
+551.427472 1497.01 10688
+551.438160 1497.01 10688
+551.448848 1497.01 10688
+551.459536 1497.01 10688
+551.470224 1497.01 10688
+551.480912 1497.01 10688
+551.491600 1497.01 10688
+551.502288 1497.01 10688
+551.512976 1497.01 10688
+551.523728 1488.10 10752
+551.534480 1488.10 10752
+551.545232 1488.10 10752
+551.555984 1488.10 10752
+551.566736 1488.10 10752
+551.577488 1488.10 10752
+551.588240 1488.10 10752
+551.598992 1488.10 10752
+551.609808 1479.29 10816
+551.620624 1479.29 10816
+551.631440 1479.29 10816
+551.642256 1479.29 10816
+551.653072 1479.29 10816
+551.663888 1479.29 10816
+551.674704 1479.29 10816
+551.685520 1479.29 10816
+551.696336 1479.29 10816
+551.707152 1479.29 10816
+551.717968 1479.29 10816
+551.728784 1479.29 10816
+551.739600 1479.29 10816
+551.750416 1479.29 10816
+551.761232 1479.29 10816
+551.772048 1479.29 10816
+551.782928 1470.59 10880
+551.793808 1470.59 10880
+551.804688 1470.59 10880
+551.815568 1470.59 10880
+551.826448 1470.59 10880
+551.837328 1470.59 10880
+551.848208 1470.59 10880
+551.859088 1470.59 10880
+551.870032 1461.99 10944
+551.880976 1461.99 10944
+551.891920 1461.99 10944
+551.902864 1461.99 10944
+551.913808 1461.99 10944
+551.924752 1461.99 10944
+551.935696 1461.99 10944
+551.946640 1461.99 10944
+551.957584 1461.99 10944
+551.968528 1461.99 10944
+551.979472 1461.99 10944
+551.990416 1461.99 10944
+552.001360 1461.99 10944
+552.012304 1461.99 10944
+552.023248 1461.99 10944
+552.034192 1461.99 10944
+552.045200 1453.49 11008
+552.056208 1453.49 11008
+552.067216 1453.49 11008
+552.078224 1453.49 11008
+552.089232 1453.49 11008
+552.100240 1453.49 11008
+552.111248 1453.49 11008
+552.122256 1453.49 11008
+552.133328 1445.09 11072
+552.144400 1445.09 11072
+552.155472 1445.09 11072
+552.166544 1445.09 11072
+552.177616 1445.09 11072
+552.188688 1445.09 11072
+552.199760 1445.09 11072
+552.210832 1445.09 11072
+552.221904 1445.09 11072
+552.232976 1445.09 11072
+552.244048 1445.09 11072
+552.255120 1445.09 11072
+552.266192 1445.09 11072
+552.277264 1445.09 11072
+552.288336 1445.09 11072
+552.299408 1445.09 11072
+552.310544 1436.78 11136
+552.321680 1436.78 11136
+552.332816 1436.78 11136
+552.343952 1436.78 11136
+552.355088 1436.78 11136
+552.366224 1436.78 11136
+552.377360 1436.78 11136
+552.388496 1436.78 11136
+552.399632 1436.78 11136
+552.410768 1436.78 11136
+552.421904 1436.78 11136
+552.433040 1436.78 11136
+552.444176 1436.78 11136
+552.455312 1436.78 11136
+552.466448 1436.78 11136
+552.477584 1436.78 11136
+552.488720 1436.78 11136
+552.499856 1436.78 11136
+552.510992 1436.78 11136
+552.522128 1436.78 11136
+552.533328 1428.57 11200
+552.544528 1428.57 11200
+552.555728 1428.57 11200
+552.566928 1428.57 11200
+552.578128 1428.57 11200
+552.589328 1428.57 11200
+552.600528 1428.57 11200
+552.611728 1428.57 11200
+552.622928 1428.57 11200
+552.634128 1428.57 11200
+552.645328 1428.57 11200
+552.656528 1428.57 11200
+552.667792 1420.45 11264
+552.679056 1420.45 11264
+552.690320 1420.45 11264
+552.701584 1420.45 11264
+552.712848 1420.45 11264
+552.724112 1420.45 11264
+552.735376 1420.45 11264
+552.746640 1420.45 11264
+552.757904 1420.45 11264
+552.769168 1420.45 11264
+552.780432 1420.45 11264
+552.791696 1420.45 11264
+552.803024 1412.43 11328
+552.814352 1412.43 11328
+552.825680 1412.43 11328
+552.837008 1412.43 11328
+552.848336 1412.43 11328
+552.859664 1412.43 11328
+552.870992 1412.43 11328
+552.882320 1412.43 11328
+552.893712 1404.49 11392
+552.905104 1404.49 11392
+552.916496 1404.49 11392
+552.927888 1404.49 11392
+552.939280 1404.49 11392
+552.950672 1404.49 11392
+552.962064 1404.49 11392
+552.973456 1404.49 11392
+552.984848 1404.49 11392
+552.996240 1404.49 11392
+553.007632 1404.49 11392
+553.019024 1404.49 11392
+553.030480 1396.65 11456
+553.041936 1396.65 11456
+553.053392 1396.65 11456
+553.064848 1396.65 11456
+553.076304 1396.65 11456
+553.087760 1396.65 11456
+553.099216 1396.65 11456
+553.110672 1396.65 11456
+553.122128 1396.65 11456
+553.133584 1396.65 11456
+553.145040 1396.65 11456
+553.156496 1396.65 11456
+553.168016 1388.89 11520
+553.179536 1388.89 11520
+553.191056 1388.89 11520
+553.202576 1388.89 11520
+553.214096 1388.89 11520
+553.225616 1388.89 11520
+553.237136 1388.89 11520
+553.248656 1388.89 11520
+553.260240 1381.22 11584
+553.271824 1381.22 11584
+553.283408 1381.22 11584
+553.294992 1381.22 11584
+553.306576 1381.22 11584
+553.318160 1381.22 11584
+553.329744 1381.22 11584
+553.341328 1381.22 11584
+553.352912 1381.22 11584
+553.364496 1381.22 11584
+553.376080 1381.22 11584
+553.387664 1381.22 11584
+553.399312 1373.63 11648
+553.410960 1373.63 11648
+553.422608 1373.63 11648
+553.434256 1373.63 11648
+553.445904 1373.63 11648
+553.457552 1373.63 11648
+553.469200 1373.63 11648
+553.480848 1373.63 11648
+553.492560 1366.12 11712
+553.504272 1366.12 11712
+553.515984 1366.12 11712
+553.527696 1366.12 11712
+553.539408 1366.12 11712
+553.551120 1366.12 11712
+553.562832 1366.12 11712
+553.574544 1366.12 11712
+553.586256 1366.12 11712
+553.597968 1366.12 11712
+553.609680 1366.12 11712
+553.621392 1366.12 11712
+553.633168 1358.70 11776
+553.644944 1358.70 11776
+553.656720 1358.70 11776
+553.668496 1358.70 11776
+553.680272 1358.70 11776
+553.692048 1358.70 11776
+553.703824 1358.70 11776
+553.715600 1358.70 11776
+553.727440 1351.35 11840
+553.739280 1351.35 11840
+553.751120 1351.35 11840
+553.762960 1351.35 11840
+553.774800 1351.35 11840
+553.786640 1351.35 11840
+553.798480 1351.35 11840
+553.810320 1351.35 11840
+553.822160 1351.35 11840
+553.834000 1351.35 11840
+553.845840 1351.35 11840
+553.857680 1351.35 11840
+553.869584 1344.09 11904
+553.881488 1344.09 11904
+553.893392 1344.09 11904
+553.905296 1344.09 11904
+553.917200 1344.09 11904
+553.929104 1344.09 11904
+553.941008 1344.09 11904
+553.952912 1344.09 11904
+553.964880 1336.90 11968
+553.976848 1336.90 11968
+553.988816 1336.90 11968
+554.000784 1336.90 11968
+554.012752 1336.90 11968
+554.024720 1336.90 11968
+554.036688 1336.90 11968
+554.048656 1336.90 11968
+554.060624 1336.90 11968
+554.072592 1336.90 11968
+554.084560 1336.90 11968
+554.096528 1336.90 11968
+554.108560 1329.79 12032
+554.120592 1329.79 12032
+554.132624 1329.79 12032
+554.144656 1329.79 12032
+554.156688 1329.79 12032
+554.168720 1329.79 12032
+554.180752 1329.79 12032
+554.192784 1329.79 12032
+554.204880 1322.75 12096
+554.216976 1322.75 12096
+554.229072 1322.75 12096
+554.241168 1322.75 12096
+554.253264 1322.75 12096
+554.265360 1322.75 12096
+554.277456 1322.75 12096
+554.289552 1322.75 12096
+554.301712 1315.79 12160
+554.313872 1315.79 12160
+554.326032 1315.79 12160
+554.338192 1315.79 12160
+554.350352 1315.79 12160
+554.362512 1315.79 12160
+554.374672 1315.79 12160
+554.386832 1315.79 12160
+554.398992 1315.79 12160
+554.411152 1315.79 12160
+554.423312 1315.79 12160
+554.435472 1315.79 12160
+554.447696 1308.90 12224
+554.459920 1308.90 12224
+554.472144 1308.90 12224
+554.484368 1308.90 12224
+554.496592 1308.90 12224
+554.508816 1308.90 12224
+554.521040 1308.90 12224
+554.533264 1308.90 12224
+554.545552 1302.08 12288
+554.557840 1302.08 12288
+554.570128 1302.08 12288
+554.582416 1302.08 12288
+554.594704 1302.08 12288
+554.606992 1302.08 12288
+554.619280 1302.08 12288
+554.631568 1302.08 12288
+554.643920 1295.34 12352
+554.656272 1295.34 12352
+554.668624 1295.34 12352
+554.680976 1295.34 12352
+554.693328 1295.34 12352
+554.705680 1295.34 12352
+554.718032 1295.34 12352
+554.730384 1295.34 12352
+554.742736 1295.34 12352
+554.755088 1295.34 12352
+554.767440 1295.34 12352
+554.779792 1295.34 12352
+554.792208 1288.66 12416
+554.804624 1288.66 12416
+554.817040 1288.66 12416
+554.829456 1288.66 12416
+554.841872 1288.66 12416
+554.854288 1288.66 12416
+554.866704 1288.66 12416
+554.879120 1288.66 12416
+554.891664 1275.51 12544
+554.904208 1275.51 12544
+554.916752 1275.51 12544
+554.929296 1275.51 12544
+554.941840 1275.51 12544
+554.954384 1275.51 12544
+554.966928 1275.51 12544
+554.979472 1275.51 12544
+554.992080 1269.04 12608
+555.004688 1269.04 12608
+555.017296 1269.04 12608
+555.029904 1269.04 12608
+555.042512 1269.04 12608
+555.055120 1269.04 12608
+555.067728 1269.04 12608
+555.080336 1269.04 12608
+555.093008 1262.63 12672
+555.105680 1262.63 12672
+555.118352 1262.63 12672
+555.131024 1262.63 12672
+555.143696 1262.63 12672
+555.156368 1262.63 12672
+555.169040 1262.63 12672
+555.181712 1262.63 12672
+555.194448 1256.28 12736
+555.207184 1256.28 12736
+555.219920 1256.28 12736
+555.232656 1256.28 12736
+555.245392 1256.28 12736
+555.258128 1256.28 12736
+555.270864 1256.28 12736
+555.283600 1256.28 12736
+555.296400 1250.00 12800
+555.309200 1250.00 12800
+555.322000 1250.00 12800
+555.334800 1250.00 12800
+555.347600 1250.00 12800
+555.360400 1250.00 12800
+555.373200 1250.00 12800
+555.386000 1250.00 12800
+555.398800 1250.00 12800
+555.411600 1250.00 12800
+555.424400 1250.00 12800
+555.437200 1250.00 12800
+555.450064 1243.78 12864
+555.462928 1243.78 12864
+555.475792 1243.78 12864
+555.488656 1243.78 12864
+555.501520 1243.78 12864
+555.514384 1243.78 12864
+555.527248 1243.78 12864
+555.540112 1243.78 12864
+555.553040 1237.62 12928
+555.565968 1237.62 12928
+555.578896 1237.62 12928
+555.591824 1237.62 12928
+555.604752 1237.62 12928
+555.617680 1237.62 12928
+555.630608 1237.62 12928
+555.643536 1237.62 12928
+555.656528 1231.53 12992
+555.669520 1231.53 12992
+555.682512 1231.53 12992
+555.695504 1231.53 12992
+555.708496 1231.53 12992
+555.721488 1231.53 12992
+555.734480 1231.53 12992
+555.747472 1231.53 12992
+555.760528 1225.49 13056
+555.773584 1225.49 13056
+555.786640 1225.49 13056
+555.799696 1225.49 13056
+555.812752 1225.49 13056
+555.825808 1225.49 13056
+555.838864 1225.49 13056
+555.851920 1225.49 13056
+555.865040 1219.51 13120
+555.878160 1219.51 13120
+555.891280 1219.51 13120
+555.904400 1219.51 13120
+555.917520 1219.51 13120
+555.930640 1219.51 13120
+555.943760 1219.51 13120
+555.956880 1219.51 13120
+555.970064 1213.59 13184
+555.983248 1213.59 13184
+555.996432 1213.59 13184
+556.009616 1213.59 13184
+556.022800 1213.59 13184
+556.035984 1213.59 13184
+556.049168 1213.59 13184
+556.062352 1213.59 13184
+556.075664 1201.92 13312
+556.088976 1201.92 13312
+556.102288 1201.92 13312
+556.115600 1201.92 13312
+556.128912 1201.92 13312
+556.142224 1201.92 13312
+556.155536 1201.92 13312
+556.168848 1201.92 13312
+556.182224 1196.17 13376
+556.195600 1196.17 13376
+556.208976 1196.17 13376
+556.222352 1196.17 13376
+556.235728 1196.17 13376
+556.249104 1196.17 13376
+556.262480 1196.17 13376
+556.275856 1196.17 13376
+556.289296 1190.48 13440
+556.302736 1190.48 13440
+556.316176 1190.48 13440
+556.329616 1190.48 13440
+556.343056 1190.48 13440
+556.356496 1190.48 13440
+556.369936 1190.48 13440
+556.383376 1190.48 13440
+556.396880 1184.83 13504
+556.410384 1184.83 13504
+556.423888 1184.83 13504
+556.437392 1184.83 13504
+556.450960 1179.25 13568
+556.464528 1179.25 13568
+556.478096 1179.25 13568
+556.491664 1179.25 13568
+556.505232 1179.25 13568
+556.518800 1179.25 13568
+556.532368 1179.25 13568
+556.545936 1179.25 13568
+556.559568 1173.71 13632
+556.573200 1173.71 13632
+556.586832 1173.71 13632
+556.600464 1173.71 13632
+556.614096 1173.71 13632
+556.627728 1173.71 13632
+556.641360 1173.71 13632
+556.654992 1173.71 13632
+556.668688 1168.22 13696
+556.682384 1168.22 13696
+556.696080 1168.22 13696
+556.709776 1168.22 13696
+556.723472 1168.22 13696
+556.737168 1168.22 13696
+556.750864 1168.22 13696
+556.764560 1168.22 13696
+556.778384 1157.41 13824
+556.792208 1157.41 13824
+556.806032 1157.41 13824
+556.819856 1157.41 13824
+556.833680 1157.41 13824
+556.847504 1157.41 13824
+556.861328 1157.41 13824
+556.875152 1157.41 13824
+556.889040 1152.07 13888
+556.902928 1152.07 13888
+556.916816 1152.07 13888
+556.930704 1152.07 13888
+556.944592 1152.07 13888
+556.958480 1152.07 13888
+556.972368 1152.07 13888
+556.986256 1152.07 13888
+557.000208 1146.79 13952
+557.014160 1146.79 13952
+557.028112 1146.79 13952
+557.042064 1146.79 13952
+557.056080 1141.55 14016
+557.070096 1141.55 14016
+557.084112 1141.55 14016
+557.098128 1141.55 14016
+557.112144 1141.55 14016
+557.126160 1141.55 14016
+557.140176 1141.55 14016
+557.154192 1141.55 14016
+557.168272 1136.36 14080
+557.182352 1136.36 14080
+557.196432 1136.36 14080
+557.210512 1136.36 14080
+557.224592 1136.36 14080
+557.238672 1136.36 14080
+557.252752 1136.36 14080
+557.266832 1136.36 14080
+557.280976 1131.22 14144
+557.295120 1131.22 14144
+557.309264 1131.22 14144
+557.323408 1131.22 14144
+557.337552 1131.22 14144
+557.351696 1131.22 14144
+557.365840 1131.22 14144
+557.379984 1131.22 14144
+557.394256 1121.08 14272
+557.408528 1121.08 14272
+557.422800 1121.08 14272
+557.437072 1121.08 14272
+557.451408 1116.07 14336
+557.465744 1116.07 14336
+557.480080 1116.07 14336
+557.494416 1116.07 14336
+557.508752 1116.07 14336
+557.523088 1116.07 14336
+557.537424 1116.07 14336
+557.551760 1116.07 14336
+557.566160 1111.11 14400
+557.580560 1111.11 14400
+557.594960 1111.11 14400
+557.609360 1111.11 14400
+557.623760 1111.11 14400
+557.638160 1111.11 14400
+557.652560 1111.11 14400
+557.666960 1111.11 14400
+557.681424 1106.19 14464
+557.695888 1106.19 14464
+557.710352 1106.19 14464
+557.724816 1106.19 14464
+557.739408 1096.49 14592
+557.754000 1096.49 14592
+557.768592 1096.49 14592
+557.783184 1096.49 14592
+557.797776 1096.49 14592
+557.812368 1096.49 14592
+557.826960 1096.49 14592
+557.841552 1096.49 14592
+557.856208 1091.70 14656
+557.870864 1091.70 14656
+557.885520 1091.70 14656
+557.900176 1091.70 14656
+557.914832 1091.70 14656
+557.929488 1091.70 14656
+557.944144 1091.70 14656
+557.958800 1091.70 14656
+557.973520 1086.96 14720
+557.988240 1086.96 14720
+558.002960 1086.96 14720
+558.017680 1086.96 14720
+558.032464 1082.25 14784
+558.047248 1082.25 14784
+558.062032 1082.25 14784
+558.076816 1082.25 14784
+558.091600 1082.25 14784
+558.106384 1082.25 14784
+558.121168 1082.25 14784
+558.135952 1082.25 14784
+558.150864 1072.96 14912
+558.165776 1072.96 14912
+558.180688 1072.96 14912
+558.195600 1072.96 14912
+558.210576 1068.38 14976
+558.225552 1068.38 14976
+558.240528 1068.38 14976
+558.255504 1068.38 14976
+558.270480 1068.38 14976
+558.285456 1068.38 14976
+558.300432 1068.38 14976
+558.315408 1068.38 14976
+558.330448 1063.83 15040
+558.345488 1063.83 15040
+558.360528 1063.83 15040
+558.375568 1063.83 15040
+558.390672 1059.32 15104
+558.405776 1059.32 15104
+558.420880 1059.32 15104
+558.435984 1059.32 15104
+558.451088 1059.32 15104
+558.466192 1059.32 15104
+558.481296 1059.32 15104
+558.496400 1059.32 15104
+558.511632 1050.42 15232
+558.526864 1050.42 15232
+558.542096 1050.42 15232
+558.557328 1050.42 15232
+558.572624 1046.03 15296
+558.587920 1046.03 15296
+558.603216 1046.03 15296
+558.618512 1046.03 15296
+558.633808 1046.03 15296
+558.649104 1046.03 15296
+558.664400 1046.03 15296
+558.679696 1046.03 15296
+558.695056 1041.67 15360
+558.710416 1041.67 15360
+558.725776 1041.67 15360
+558.741136 1041.67 15360
+558.756624 1033.06 15488
+558.772112 1033.06 15488
+558.787600 1033.06 15488
+558.803088 1033.06 15488
+558.818576 1033.06 15488
+558.834064 1033.06 15488
+558.849552 1033.06 15488
+558.865040 1033.06 15488
+558.880592 1028.81 15552
+558.896144 1028.81 15552
+558.911696 1028.81 15552
+558.927248 1028.81 15552
+558.942864 1024.59 15616
+558.958480 1024.59 15616
+558.974096 1024.59 15616
+558.989712 1024.59 15616
+559.005328 1024.59 15616
+559.020944 1024.59 15616
+559.036560 1024.59 15616
+559.052176 1024.59 15616
+559.067920 1016.26 15744
+559.083664 1016.26 15744
+559.099408 1016.26 15744
+559.115152 1016.26 15744
+559.130960 1012.15 15808
+559.146768 1012.15 15808
+559.162576 1012.15 15808
+559.178384 1012.15 15808
+559.194192 1012.15 15808
+559.210000 1012.15 15808
+559.225872 1008.06 15872
+559.241744 1008.06 15872
+559.257616 1008.06 15872
+559.273488 1008.06 15872
+559.289360 1008.06 15872
+559.305232 1008.06 15872
+559.321232 1000.00 16000
+559.337232 1000.00 16000
+559.353232 1000.00 16000
+559.369232 1000.00 16000
+559.385232 1000.00 16000
+559.401232 1000.00 16000
+559.417296 996.02 16064
+559.433360 996.02 16064
+559.449424 996.02 16064
+559.465488 996.02 16064
+559.481616 992.06 16128
+559.497744 992.06 16128
+559.513872 992.06 16128
+559.530000 992.06 16128
+559.546128 992.06 16128
+559.562256 992.06 16128
+559.578512 984.25 16256
+559.594768 984.25 16256
+559.611024 984.25 16256
+559.627280 984.25 16256
+559.643536 984.25 16256
+559.659792 984.25 16256
+559.676112 980.39 16320
+559.692432 980.39 16320
+559.708752 980.39 16320
+559.725072 980.39 16320
+559.741456 976.56 16384
+559.757840 976.56 16384
+559.774224 976.56 16384
+559.790608 976.56 16384
+559.806992 976.56 16384
+559.823376 976.56 16384
+559.839888 968.99 16512
+559.856400 968.99 16512
+559.872912 968.99 16512
+559.889424 968.99 16512
+559.905936 968.99 16512
+559.922448 968.99 16512
+559.938960 968.99 16512
+559.955472 968.99 16512
+559.971984 968.99 16512
+559.988496 968.99 16512
+560.005136 961.54 16640
+560.021776 961.54 16640
+560.038416 961.54 16640
+560.055056 961.54 16640
+560.071824 954.20 16768
+560.088592 954.20 16768
+560.105360 954.20 16768
+560.122128 954.20 16768
+560.138896 954.20 16768
+560.155664 954.20 16768
+560.172560 946.97 16896
+560.189456 946.97 16896
+560.206352 946.97 16896
+560.223248 946.97 16896
+560.240144 946.97 16896
+560.257040 946.97 16896
+560.273936 946.97 16896
+560.290832 946.97 16896
+560.307728 946.97 16896
+560.324624 946.97 16896
+560.341648 939.85 17024
+560.358672 939.85 17024
+560.375696 939.85 17024
+560.392720 939.85 17024
+560.409872 932.84 17152
+560.427024 932.84 17152
+560.444176 932.84 17152
+560.461328 932.84 17152
+560.478608 925.93 17280
+560.495888 925.93 17280
+560.513168 925.93 17280
+560.530448 925.93 17280
+560.547728 925.93 17280
+560.565008 925.93 17280
+560.582288 925.93 17280
+560.599568 925.93 17280
+560.616848 925.93 17280
+560.634128 925.93 17280
+560.651536 919.12 17408
+560.668944 919.12 17408
+560.686352 919.12 17408
+560.703760 919.12 17408
+560.721296 912.41 17536
+560.738832 912.41 17536
+560.756368 912.41 17536
+560.773904 912.41 17536
+560.791440 912.41 17536
+560.808976 912.41 17536
+560.826512 912.41 17536
+560.844048 912.41 17536
+560.861584 912.41 17536
+560.879120 912.41 17536
+560.896784 905.80 17664
+560.914448 905.80 17664
+560.932112 905.80 17664
+560.949776 905.80 17664
+560.967568 899.28 17792
+560.985360 899.28 17792
+561.003152 899.28 17792
+561.020944 899.28 17792
+561.038864 892.86 17920
+561.056784 892.86 17920
+561.074704 892.86 17920
+561.092624 892.86 17920
+561.110544 892.86 17920
+561.128464 892.86 17920
+561.146384 892.86 17920
+561.164304 892.86 17920
+561.182352 886.52 18048
+561.200400 886.52 18048
+561.218448 886.52 18048
+561.236496 886.52 18048
+561.254544 886.52 18048
+561.272592 886.52 18048
+561.290768 880.28 18176
+561.308944 880.28 18176
+561.327120 880.28 18176
+561.345296 880.28 18176
+561.363600 874.13 18304
+561.381904 874.13 18304
+561.400208 874.13 18304
+561.418512 874.13 18304
+561.436944 868.06 18432
+561.455376 868.06 18432
+561.473808 868.06 18432
+561.492240 868.06 18432
+561.510672 868.06 18432
+561.529104 868.06 18432
+561.547536 868.06 18432
+561.565968 868.06 18432
+561.584528 862.07 18560
+561.603088 862.07 18560
+561.621648 862.07 18560
+561.640208 862.07 18560
+561.658896 856.16 18688
+561.677584 856.16 18688
+561.696272 856.16 18688
+561.714960 856.16 18688
+561.733776 850.34 18816
+561.752592 850.34 18816
+561.771408 850.34 18816
+561.790224 850.34 18816
+561.809040 850.34 18816
+561.827856 850.34 18816
+561.846672 850.34 18816
+561.865488 850.34 18816
+561.884432 844.59 18944
+561.903376 844.59 18944
+561.922320 844.59 18944
+561.941264 844.59 18944
+561.960336 838.93 19072
+561.979408 838.93 19072
+561.998608 833.33 19200
+562.017808 833.33 19200
+562.037008 833.33 19200
+562.056208 833.33 19200
+562.075536 827.81 19328
+562.094864 827.81 19328
+562.114192 827.81 19328
+562.133520 827.81 19328
+562.152976 822.37 19456
+562.172432 822.37 19456
+562.191888 822.37 19456
+562.211344 822.37 19456
+562.230800 822.37 19456
+562.250256 822.37 19456
+562.269712 822.37 19456
+562.289168 822.37 19456
+562.308752 816.99 19584
+562.328336 816.99 19584
+562.347920 816.99 19584
+562.367504 816.99 19584
+562.387216 811.69 19712
+562.406928 811.69 19712
+562.426768 806.45 19840
+562.446608 806.45 19840
+562.466448 806.45 19840
+562.486288 806.45 19840
+562.506256 801.28 19968
+562.526224 801.28 19968
+562.546192 801.28 19968
+562.566160 801.28 19968
+562.586256 796.18 20096
+562.606352 796.18 20096
+562.626448 796.18 20096
+562.646544 796.18 20096
+562.666640 796.18 20096
+562.686736 796.18 20096
+562.706960 791.14 20224
+562.727184 791.14 20224
+562.747408 791.14 20224
+562.767632 791.14 20224
+562.787984 786.16 20352
+562.808336 786.16 20352
+562.828688 786.16 20352
+562.849040 786.16 20352
+562.869520 781.25 20480
+562.890000 781.25 20480
+562.910608 776.40 20608
+562.931216 776.40 20608
+562.951824 776.40 20608
+562.972432 776.40 20608
+562.993168 771.60 20736
+563.013904 771.60 20736
+563.034640 771.60 20736
+563.055376 771.60 20736
+563.076240 766.87 20864
+563.097104 766.87 20864
+563.117968 766.87 20864
+563.138832 766.87 20864
+563.159696 766.87 20864
+563.180560 766.87 20864
+563.201552 762.20 20992
+563.222544 762.20 20992
+563.243664 757.58 21120
+563.264784 757.58 21120
+563.285904 757.58 21120
+563.307024 757.58 21120
+563.328272 753.01 21248
+563.349520 753.01 21248
+563.370896 748.50 21376
+563.392272 748.50 21376
+563.413648 748.50 21376
+563.435024 748.50 21376
+563.456528 744.05 21504
+563.478032 744.05 21504
+563.499664 739.64 21632
+563.521296 739.64 21632
+563.542928 739.64 21632
+563.564560 739.64 21632
+563.586320 735.29 21760
+563.608080 735.29 21760
+563.629968 730.99 21888
+563.651856 730.99 21888
+563.673744 730.99 21888
+563.695632 730.99 21888
+563.717648 726.74 22016
+563.739664 726.74 22016
+563.761808 722.54 22144
+563.783952 722.54 22144
+563.806096 722.54 22144
+563.828240 722.54 22144
+563.850512 718.39 22272
+563.872784 718.39 22272
+563.895056 718.39 22272
+563.917328 718.39 22272
+563.939600 718.39 22272
+563.962000 714.29 22400
+563.984400 714.29 22400
+564.006800 714.29 22400
+564.029328 710.23 22528
+564.051856 710.23 22528
+564.074384 710.23 22528
+564.097040 706.21 22656
+564.119696 706.21 22656
+564.142480 702.25 22784
+564.165264 702.25 22784
+564.188048 702.25 22784
+564.210960 698.32 22912
+564.233872 698.32 22912
+564.256784 698.32 22912
+564.279824 694.44 23040
+564.302864 694.44 23040
+564.326032 690.61 23168
+564.349200 690.61 23168
+564.372368 690.61 23168
+564.395664 686.81 23296
+564.418960 686.81 23296
+564.442384 683.06 23424
+564.465808 683.06 23424
+564.489232 683.06 23424
+564.512784 679.35 23552
+564.536336 679.35 23552
+564.560016 675.68 23680
+564.583696 675.68 23680
+564.607376 675.68 23680
+564.631184 672.04 23808
+564.654992 672.04 23808
+564.678928 668.45 23936
+564.702864 668.45 23936
+564.726800 668.45 23936
+564.750864 664.89 24064
+564.774928 664.89 24064
+564.799120 661.38 24192
+564.823312 661.38 24192
+564.847632 657.89 24320
+564.871952 657.89 24320
+564.896272 657.89 24320
+564.920720 654.45 24448
+564.945168 654.45 24448
+564.969744 651.04 24576
+564.994320 651.04 24576
+565.019024 647.67 24704
+565.043728 647.67 24704
+565.068432 647.67 24704
+565.093264 644.33 24832
+565.118096 644.33 24832
+565.143184 637.76 25088
+565.168272 637.76 25088
+565.193488 634.52 25216
+565.218704 634.52 25216
+565.244048 631.31 25344
+565.269392 631.31 25344
+565.294864 628.14 25472
+565.320336 628.14 25472
+565.345936 625.00 25600
+565.371536 625.00 25600
+565.397136 625.00 25600
+565.422864 621.89 25728
+565.448592 621.89 25728
+565.474448 618.81 25856
+565.500304 618.81 25856
+565.526288 615.76 25984
+565.552272 615.76 25984
+565.578384 612.75 26112
+565.604496 612.75 26112
+565.630736 609.76 26240
+565.656976 609.76 26240
+565.683344 606.80 26368
+565.709712 606.80 26368
+565.736336 600.96 26624
+565.762960 600.96 26624
+565.789712 598.09 26752
+565.816464 598.09 26752
+565.843344 595.24 26880
+565.870224 595.24 26880
+565.897232 592.42 27008
+565.924368 589.62 27136
+565.951504 589.62 27136
+565.978768 586.85 27264
+566.006032 586.85 27264
+566.033424 584.11 27392
+566.060816 584.11 27392
+566.088464 578.70 27648
+566.116112 578.70 27648
+566.143888 576.04 27776
+566.171664 576.04 27776
+566.199568 573.39 27904
+566.227600 570.78 28032
+566.255632 570.78 28032
+566.283792 568.18 28160
+566.311952 568.18 28160
+566.340240 565.61 28288
+566.368528 565.61 28288
+566.397072 560.54 28544
+566.425744 558.04 28672
+566.454416 558.04 28672
+566.483216 555.56 28800
+566.512016 555.56 28800
+566.540944 553.10 28928
+566.570128 548.25 29184
+566.599312 548.25 29184
+566.628624 545.85 29312
+566.657936 545.85 29312
+566.687376 543.48 29440
+566.716944 541.13 29568
+566.746512 541.13 29568
+566.776336 536.48 29824
+566.806288 534.19 29952
+566.836240 534.19 29952
+566.866320 531.91 30080
+566.896528 529.66 30208
+566.926736 529.66 30208
+566.957200 525.21 30464
+566.987792 523.01 30592
+567.018384 523.01 30592
+567.049104 520.83 30720
+567.080080 516.53 30976
+567.111056 516.53 30976
+567.142160 514.40 31104
+567.173392 512.30 31232
+567.204624 512.30 31232
+567.236112 508.13 31488
+567.267728 506.07 31616
+567.299472 504.03 31744
+567.331216 504.03 31744
+567.363216 500.00 32000
+567.395344 498.01 32128
+567.427600 496.03 32256
+567.459856 496.03 32256
+567.492368 492.13 32512
+567.525008 490.20 32640
+567.557776 488.28 32768
+567.590544 488.28 32768
+567.623568 484.50 33024
+567.656592 484.50 33024
+567.689872 480.77 33280
+567.723408 477.10 33536
+567.756944 477.10 33536
+567.790736 473.48 33792
+567.824528 473.48 33792
+567.858576 469.92 34048
+567.892880 466.42 34304
+567.927440 462.96 34560
+567.962000 462.96 34560
+567.996560 462.96 34560
+568.031376 459.56 34816
+568.066448 456.20 35072
+568.101520 456.20 35072
+568.136848 452.90 35328
+568.172432 449.64 35584
+568.208272 446.43 35840
+568.244112 446.43 35840
+568.280208 443.26 36096
+568.316304 443.26 36096
+568.352656 440.14 36352
+568.389264 437.06 36608
+568.426128 434.03 36864
+568.462992 434.03 36864
+568.500112 431.03 37120
+568.537488 428.08 37376
+568.575120 425.17 37632
+568.612752 425.17 37632
+568.650640 422.30 37888
+568.689040 416.67 38400
+568.727696 413.91 38656
+568.766608 411.18 38912
+568.805520 411.18 38912
+568.844688 408.50 39168
+568.884112 405.84 39424
+568.923792 403.23 39680
+568.963728 400.64 39936
+569.003920 398.09 40192
+569.044368 395.57 40448
+569.085072 393.08 40704
+569.126032 390.62 40960
+569.167248 388.20 41216
+569.208720 385.80 41472
+569.250448 383.44 41728
+569.292432 381.10 41984
+569.334672 378.79 42240
+569.377424 374.25 42752
+569.420432 372.02 43008
+569.463696 369.82 43264
+569.507472 365.50 43776
+569.551504 363.37 44032
+569.595792 361.27 44288
+569.640336 359.20 44544
+569.685136 357.14 44800
+569.730448 353.11 45312
+569.776016 351.12 45568
+569.822096 347.22 46080
+569.868432 345.30 46336
+569.915280 341.53 46848
+569.962640 337.84 47360
+570.010256 336.02 47616
+570.058384 332.45 48128
+570.107024 328.95 48640
+570.155920 327.23 48896
+570.205328 323.83 49408
+570.255504 318.88 50176
+570.306192 315.66 50688
+570.357392 312.50 51200
+570.408848 310.95 51456
+570.460816 307.88 51968
+570.513296 304.88 52480
+570.566544 300.48 53248
+570.620304 297.62 53760
+570.674832 293.43 54528
+570.730128 289.35 55296
+570.785936 286.70 55808
+570.842256 284.09 56320
+570.899600 279.02 57344
+570.957456 276.55 57856
+571.016080 272.93 58624
+571.075728 268.24 59648
+571.136144 264.83 60416
+571.197328 261.51 61184
+571.259536 257.20 62208
+571.322768 253.04 63232
+571.387024 249.00 64256
+571.452304 245.10 65280
+571.518352 242.25 66048
+571.585936 236.74 67584
+571.655056 231.48 69120
+571.725200 228.10 70144
+571.796880 223.21 71680
+571.869584 220.07 72704
+571.943824 215.52 74240
+572.019600 211.15 75776
+572.097424 205.59 77824
+572.177296 200.32 79872
+572.259216 195.31 81920
+572.343184 190.55 83968
+572.429712 184.91 86528
+572.518800 179.60 89088
+572.610960 173.61 92160
+572.706192 168.01 95232
+572.805008 161.92 98816
+572.907920 155.47 102912
+573.015440 148.81 107520
+573.128080 142.05 112640
+573.247376 134.12 119296
+573.373840 126.52 126464
+573.509008 118.37 135168
+573.654416 110.04 145408
+573.814160 100.16 159744
+573.992336 89.80 178176
+574.198160 77.74 205824
+574.451088 63.26 252928
+574.807440 44.90 356352
+575.313296 31.63 505856
+EOF
+plot $data using 1:2 with linespoints
+pause -1
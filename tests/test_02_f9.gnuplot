@@ -0,0 +1,10213 @@
+$data <<EOF
+0.356352 44.90 356352
+0.609280 63.26 252928
+0.815104 77.74 205824
+0.993280 89.80 178176
+1.153024 100.16 159744
+1.298432 110.04 145408
+1.433600 118.37 135168
+1.560064 126.52 126464
+1.679360 134.12 119296
+1.792000 142.05 112640
+1.899520 148.81 107520
+2.002432 155.47 102912
+2.101248 161.92 98816
+2.196480 168.01 95232
+2.288640 173.61 92160
+2.377728 179.60 89088
+2.464256 184.91 86528
+2.548224 190.55 83968
+2.630144 195.31 81920
+2.710016 200.32 79872
+2.787840 205.59 77824
+2.863616 211.15 75776
+2.937856 215.52 74240
+3.010560 220.07 72704
+3.082240 223.21 71680
+3.152384 228.10 70144
+3.221504 231.48 69120
+3.289088 236.74 67584
+3.355136 242.25 66048
+3.420416 245.10 65280
+3.484672 249.00 64256
+3.547904 253.04 63232
+3.610112 257.20 62208
+3.671296 261.51 61184
+3.731712 264.83 60416
+3.791360 268.24 59648
+3.849984 272.93 58624
+3.907840 276.55 57856
+3.965184 279.02 57344
+4.021504 284.09 56320
+4.077312 286.70 55808
+4.132608 289.35 55296
+4.187136 293.43 54528
+4.240896 297.62 53760
+4.294144 300.48 53248
+4.346624 304.88 52480
+4.398592 307.88 51968
+4.450048 310.95 51456
+4.501248 312.50 51200
+4.551936 315.66 50688
+4.602112 318.88 50176
+4.651520 323.83 49408
+4.700416 327.23 48896
+4.749056 328.95 48640
+4.797184 332.45 48128
+4.844800 336.02 47616
+4.892160 337.84 47360
+4.939008 341.53 46848
+4.985344 345.30 46336
+5.031424 347.22 46080
+5.076992 351.12 45568
+5.122304 353.11 45312
+5.167104 357.14 44800
+5.211648 359.20 44544
+5.255936 361.27 44288
+5.299968 363.37 44032
+5.343744 365.50 43776
+5.387008 369.82 43264
+5.430016 372.02 43008
+5.472768 374.25 42752
+5.515008 378.79 42240
+5.556992 381.10 41984
+5.598720 383.44 41728
+5.640192 385.80 41472
+5.681408 388.20 41216
+5.722368 390.62 40960
+5.763072 393.08 40704
+5.803520 395.57 40448
+5.843712 398.09 40192
+5.883648 400.64 39936
+5.923328 403.23 39680
+5.962752 405.84 39424
+6.001920 408.50 39168
+6.040832 411.18 38912
+6.079744 411.18 38912
+6.118400 413.91 38656
+6.156800 416.67 38400
+6.194688 422.30 37888
+6.232320 425.17 37632
+6.269952 425.17 37632
+6.307328 428.08 37376
+6.344448 431.03 37120
+6.381312 434.03 36864
+6.418176 434.03 36864
+6.454784 437.06 36608
+6.491136 440.14 36352
+6.527232 443.26 36096
+6.563328 443.26 36096
+6.599168 446.43 35840
+6.635008 446.43 35840
+6.670592 449.64 35584
+6.705920 452.90 35328
+6.740992 456.20 35072
+6.776064 456.20 35072
+6.810880 459.56 34816
+6.845440 462.96 34560
+6.880000 462.96 34560
+6.914560 462.96 34560
+6.948864 466.42 34304
+6.982912 469.92 34048
+7.016704 473.48 33792
+7.050496 473.48 33792
+7.084032 477.10 33536
+7.117568 477.10 33536
+7.150848 480.77 33280
+7.183872 484.50 33024
+7.216896 484.50 33024
+7.249664 488.28 32768
+7.282432 488.28 32768
+7.315072 490.20 32640
+7.347584 492.13 32512
+7.379840 496.03 32256
+7.412096 496.03 32256
+7.444224 498.01 32128
+7.476224 500.00 32000
+7.507968 504.03 31744
+7.539712 504.03 31744
+7.571328 506.07 31616
+7.602816 508.13 31488
+7.634048 512.30 31232
+7.665280 512.30 31232
+7.696384 514.40 31104
+7.727360 516.53 30976
+7.758336 516.53 30976
+7.789056 520.83 30720
+7.819648 523.01 30592
+7.850240 523.01 30592
+7.880704 525.21 30464
+7.910912 529.66 30208
+7.941120 529.66 30208
+7.971200 531.91 30080
+8.001152 534.19 29952
+8.031104 534.19 29952
+8.060928 536.48 29824
+8.090496 541.13 29568
+8.120064 541.13 29568
+8.149504 543.48 29440
+8.178816 545.85 29312
+8.208128 545.85 29312
+8.237312 548.25 29184
+8.266496 548.25 29184
+8.295424 553.10 28928
+8.324224 555.56 28800
+8.353024 555.56 28800
+8.381696 558.04 28672
+8.410368 558.04 28672
+8.438912 560.54 28544
+8.467200 565.61 28288
+8.495488 565.61 28288
+8.523648 568.18 28160
+8.551808 568.18 28160
+8.579840 570.78 28032
+8.607872 570.78 28032
+8.635776 573.39 27904
+8.663552 576.04 27776
+8.691328 576.04 27776
+8.718976 578.70 27648
+8.746624 578.70 27648
+8.774016 584.11 27392
+8.801408 584.11 27392
+8.828672 586.85 27264
+8.855936 586.85 27264
+8.883072 589.62 27136
+8.910208 589.62 27136
+8.937216 592.42 27008
+8.964096 595.24 26880
+8.990976 595.24 26880
+9.017728 598.09 26752
+9.044480 598.09 26752
+9.071104 600.96 26624
+9.097728 600.96 26624
+9.124096 606.80 26368
+9.150464 606.80 26368
+9.176704 609.76 26240
+9.202944 609.76 26240
+9.229056 612.75 26112
+9.255168 612.75 26112
+9.281152 615.76 25984
+9.307136 615.76 25984
+9.332992 618.81 25856
+9.358848 618.81 25856
+9.384576 621.89 25728
+9.410304 621.89 25728
+9.435904 625.00 25600
+9.461504 625.00 25600
+9.487104 625.00 25600
+9.512576 628.14 25472
+9.538048 628.14 25472
+9.563392 631.31 25344
+9.588736 631.31 25344
+9.613952 634.52 25216
+9.639168 634.52 25216
+9.664256 637.76 25088
+9.689344 637.76 25088
+9.714176 644.33 24832
+9.739008 644.33 24832
+9.763712 647.67 24704
+9.788416 647.67 24704
+9.813120 647.67 24704
+9.837696 651.04 24576
+9.862272 651.04 24576
+9.886720 654.45 24448
+9.911168 654.45 24448
+9.935488 657.89 24320
+9.959808 657.89 24320
+9.984128 657.89 24320
+10.008320 661.38 24192
+10.032512 661.38 24192
+10.056576 664.89 24064
+10.080640 664.89 24064
+10.104576 668.45 23936
+10.128512 668.45 23936
+10.152448 668.45 23936
+10.176256 672.04 23808
+10.200064 672.04 23808
+10.223744 675.68 23680
+10.247424 675.68 23680
+10.271104 675.68 23680
+10.294656 679.35 23552
+10.318208 679.35 23552
+10.341632 683.06 23424
+10.365056 683.06 23424
+10.388480 683.06 23424
+10.411776 686.81 23296
+10.435072 686.81 23296
+10.458240 690.61 23168
+10.481408 690.61 23168
+10.504576 690.61 23168
+10.527616 694.44 23040
+10.550656 694.44 23040
+10.573568 698.32 22912
+10.596480 698.32 22912
+10.619392 698.32 22912
+10.642176 702.25 22784
+10.664960 702.25 22784
+10.687744 702.25 22784
+10.710400 706.21 22656
+10.733056 706.21 22656
+10.755584 710.23 22528
+10.778112 710.23 22528
+10.800640 710.23 22528
+10.823040 714.29 22400
+10.845440 714.29 22400
+10.867840 714.29 22400
+10.890112 718.39 22272
+10.912384 718.39 22272
+10.934656 718.39 22272
+10.956928 718.39 22272
+10.979200 718.39 22272
+11.001344 722.54 22144
+11.023488 722.54 22144
+11.045632 722.54 22144
+11.067776 722.54 22144
+11.089792 726.74 22016
+11.111808 726.74 22016
+11.133696 730.99 21888
+11.155584 730.99 21888
+11.177472 730.99 21888
+11.199360 730.99 21888
+11.221120 735.29 21760
+11.242880 735.29 21760
+11.264512 739.64 21632
+11.286144 739.64 21632
+11.307776 739.64 21632
+11.329408 739.64 21632
+11.350912 744.05 21504
+11.372416 744.05 21504
+11.393792 748.50 21376
+11.415168 748.50 21376
+11.436544 748.50 21376
+11.457920 748.50 21376
+11.479168 753.01 21248
+11.500416 753.01 21248
+11.521536 757.58 21120
+11.542656 757.58 21120
+11.563776 757.58 21120
+11.584896 757.58 21120
+11.605888 762.20 20992
+11.626880 762.20 20992
+11.647744 766.87 20864
+11.668608 766.87 20864
+11.689472 766.87 20864
+11.710336 766.87 20864
+11.731200 766.87 20864
+11.752064 766.87 20864
+11.772800 771.60 20736
+11.793536 771.60 20736
+11.814272 771.60 20736
+11.835008 771.60 20736
+11.855616 776.40 20608
+11.876224 776.40 20608
+11.896832 776.40 20608
+11.917440 776.40 20608
+11.937920 781.25 20480
+11.958400 781.25 20480
+11.978752 786.16 20352
+11.999104 786.16 20352
+12.019456 786.16 20352
+12.039808 786.16 20352
+12.060032 791.14 20224
+12.080256 791.14 20224
+12.100480 791.14 20224
+12.120704 791.14 20224
+12.140800 796.18 20096
+12.160896 796.18 20096
+12.180992 796.18 20096
+12.201088 796.18 20096
+12.221184 796.18 20096
+12.241280 796.18 20096
+12.261248 801.28 19968
+12.281216 801.28 19968
+12.301184 801.28 19968
+12.321152 801.28 19968
+12.340992 806.45 19840
+12.360832 806.45 19840
+12.380672 806.45 19840
+12.400512 806.45 19840
+12.420224 811.69 19712
+12.439936 811.69 19712
+12.459520 816.99 19584
+12.479104 816.99 19584
+12.498688 816.99 19584
+12.518272 816.99 19584
+12.537728 822.37 19456
+12.557184 822.37 19456
+12.576640 822.37 19456
+12.596096 822.37 19456
+12.615552 822.37 19456
+12.635008 822.37 19456
+12.654464 822.37 19456
+12.673920 822.37 19456
+12.693248 827.81 19328
+12.712576 827.81 19328
+12.731904 827.81 19328
+12.751232 827.81 19328
+12.770432 833.33 19200
+12.789632 833.33 19200
+12.808832 833.33 19200
+12.828032 833.33 19200
+12.847104 838.93 19072
+12.866176 838.93 19072
+12.885120 844.59 18944
+12.904064 844.59 18944
+12.923008 844.59 18944
+12.941952 844.59 18944
+12.960768 850.34 18816
+12.979584 850.34 18816
+12.998400 850.34 18816
+13.017216 850.34 18816
+13.036032 850.34 18816
+13.054848 850.34 18816
+13.073664 850.34 18816
+13.092480 850.34 18816
+13.111168 856.16 18688
+13.129856 856.16 18688
+13.148544 856.16 18688
+13.167232 856.16 18688
+13.185792 862.07 18560
+13.204352 862.07 18560
+13.222912 862.07 18560
+13.241472 862.07 18560
+13.259904 868.06 18432
+13.278336 868.06 18432
+13.296768 868.06 18432
+13.315200 868.06 18432
+13.333632 868.06 18432
+13.352064 868.06 18432
+13.370496 868.06 18432
+13.388928 868.06 18432
+13.407232 874.13 18304
+13.425536 874.13 18304
+13.443840 874.13 18304
+13.462144 874.13 18304
+13.480320 880.28 18176
+13.498496 880.28 18176
+13.516672 880.28 18176
+13.534848 880.28 18176
+13.552896 886.52 18048
+13.570944 886.52 18048
+13.588992 886.52 18048
+13.607040 886.52 18048
+13.625088 886.52 18048
+13.643136 886.52 18048
+13.661056 892.86 17920
+13.678976 892.86 17920
+13.696896 892.86 17920
+13.714816 892.86 17920
+13.732736 892.86 17920
+13.750656 892.86 17920
+13.768576 892.86 17920
+13.786496 892.86 17920
+13.804288 899.28 17792
+13.822080 899.28 17792
+13.839872 899.28 17792
+13.857664 899.28 17792
+13.875328 905.80 17664
+13.892992 905.80 17664
+13.910656 905.80 17664
+13.928320 905.80 17664
+13.945856 912.41 17536
+13.963392 912.41 17536
+13.980928 912.41 17536
+13.998464 912.41 17536
+14.016000 912.41 17536
+14.033536 912.41 17536
+14.051072 912.41 17536
+14.068608 912.41 17536
+14.086144 912.41 17536
+14.103680 912.41 17536
+14.121088 919.12 17408
+14.138496 919.12 17408
+14.155904 919.12 17408
+14.173312 919.12 17408
+14.190592 925.93 17280
+14.207872 925.93 17280
+14.225152 925.93 17280
+14.242432 925.93 17280
+14.259712 925.93 17280
+14.276992 925.93 17280
+14.294272 925.93 17280
+14.311552 925.93 17280
+14.328832 925.93 17280
+14.346112 925.93 17280
+14.363264 932.84 17152
+14.380416 932.84 17152
+14.397568 932.84 17152
+14.414720 932.84 17152
+14.431744 939.85 17024
+14.448768 939.85 17024
+14.465792 939.85 17024
+14.482816 939.85 17024
+14.499712 946.97 16896
+14.516608 946.97 16896
+14.533504 946.97 16896
+14.550400 946.97 16896
+14.567296 946.97 16896
+14.584192 946.97 16896
+14.601088 946.97 16896
+14.617984 946.97 16896
+14.634880 946.97 16896
+14.651776 946.97 16896
+14.668544 954.20 16768
+14.685312 954.20 16768
+14.702080 954.20 16768
+14.718848 954.20 16768
+14.735616 954.20 16768
+14.752384 954.20 16768
+14.769024 961.54 16640
+14.785664 961.54 16640
+14.802304 961.54 16640
+14.818944 961.54 16640
+14.835456 968.99 16512
+14.851968 968.99 16512
+14.868480 968.99 16512
+14.884992 968.99 16512
+14.901504 968.99 16512
+14.918016 968.99 16512
+14.934528 968.99 16512
+14.951040 968.99 16512
+14.967552 968.99 16512
+14.984064 968.99 16512
+15.000448 976.56 16384
+15.016832 976.56 16384
+15.033216 976.56 16384
+15.049600 976.56 16384
+15.065984 976.56 16384
+15.082368 976.56 16384
+15.098688 980.39 16320
+15.115008 980.39 16320
+15.131328 980.39 16320
+15.147648 980.39 16320
+15.163904 984.25 16256
+15.180160 984.25 16256
+15.196416 984.25 16256
+15.212672 984.25 16256
+15.228928 984.25 16256
+15.245184 984.25 16256
+15.261312 992.06 16128
+15.277440 992.06 16128
+15.293568 992.06 16128
+15.309696 992.06 16128
+15.325824 992.06 16128
+15.341952 992.06 16128
+15.358016 996.02 16064
+15.374080 996.02 16064
+15.390144 996.02 16064
+15.406208 996.02 16064
+15.422208 1000.00 16000
+15.438208 1000.00 16000
+15.454208 1000.00 16000
+15.470208 1000.00 16000
+15.486208 1000.00 16000
+15.502208 1000.00 16000
+15.518080 1008.06 15872
+15.533952 1008.06 15872
+15.549824 1008.06 15872
+15.565696 1008.06 15872
+15.581568 1008.06 15872
+15.597440 1008.06 15872
+15.613248 1012.15 15808
+15.629056 1012.15 15808
+15.644864 1012.15 15808
+15.660672 1012.15 15808
+15.676480 1012.15 15808
+15.692288 1012.15 15808
+15.708032 1016.26 15744
+15.723776 1016.26 15744
+15.739520 1016.26 15744
+15.755264 1016.26 15744
+15.770880 1024.59 15616
+15.786496 1024.59 15616
+15.802112 1024.59 15616
+15.817728 1024.59 15616
+15.833344 1024.59 15616
+15.848960 1024.59 15616
+15.864576 1024.59 15616
+15.880192 1024.59 15616
+15.895744 1028.81 15552
+15.911296 1028.81 15552
+15.926848 1028.81 15552
+15.942400 1028.81 15552
+15.957888 1033.06 15488
+15.973376 1033.06 15488
+15.988864 1033.06 15488
+16.004352 1033.06 15488
+16.019840 1033.06 15488
+16.035328 1033.06 15488
+16.050816 1033.06 15488
+16.066304 1033.06 15488
+16.081664 1041.67 15360
+16.097024 1041.67 15360
+16.112384 1041.67 15360
+16.127744 1041.67 15360
+16.143040 1046.03 15296
+16.158336 1046.03 15296
+16.173632 1046.03 15296
+16.188928 1046.03 15296
+16.204224 1046.03 15296
+16.219520 1046.03 15296
+16.234816 1046.03 15296
+16.250112 1046.03 15296
+16.265344 1050.42 15232
+16.280576 1050.42 15232
+16.295808 1050.42 15232
+16.311040 1050.42 15232
+16.326144 1059.32 15104
+16.341248 1059.32 15104
+16.356352 1059.32 15104
+16.371456 1059.32 15104
+16.386560 1059.32 15104
+16.401664 1059.32 15104
+16.416768 1059.32 15104
+16.431872 1059.32 15104
+16.446912 1063.83 15040
+16.461952 1063.83 15040
+16.476992 1063.83 15040
+16.492032 1063.83 15040
+16.507008 1068.38 14976
+16.521984 1068.38 14976
+16.536960 1068.38 14976
+16.551936 1068.38 14976
+16.566912 1068.38 14976
+16.581888 1068.38 14976
+16.596864 1068.38 14976
+16.611840 1068.38 14976
+16.626752 1072.96 14912
+16.641664 1072.96 14912
+16.656576 1072.96 14912
+16.671488 1072.96 14912
+16.686272 1082.25 14784
+16.701056 1082.25 14784
+16.715840 1082.25 14784
+16.730624 1082.25 14784
+16.745408 1082.25 14784
+16.760192 1082.25 14784
+16.774976 1082.25 14784
+16.789760 1082.25 14784
+16.804480 1086.96 14720
+16.819200 1086.96 14720
+16.833920 1086.96 14720
+16.848640 1086.96 14720
+16.863296 1091.70 14656
+16.877952 1091.70 14656
+16.892608 1091.70 14656
+16.907264 1091.70 14656
+16.921920 1091.70 14656
+16.936576 1091.70 14656
+16.951232 1091.70 14656
+16.965888 1091.70 14656
+16.980480 1096.49 14592
+16.995072 1096.49 14592
+17.009664 1096.49 14592
+17.024256 1096.49 14592
+17.038848 1096.49 14592
+17.053440 1096.49 14592
+17.068032 1096.49 14592
+17.082624 1096.49 14592
+17.097088 1106.19 14464
+17.111552 1106.19 14464
+17.126016 1106.19 14464
+17.140480 1106.19 14464
+17.154880 1111.11 14400
+17.169280 1111.11 14400
+17.183680 1111.11 14400
+17.198080 1111.11 14400
+17.212480 1111.11 14400
+17.226880 1111.11 14400
+17.241280 1111.11 14400
+17.255680 1111.11 14400
+17.270016 1116.07 14336
+17.284352 1116.07 14336
+17.298688 1116.07 14336
+17.313024 1116.07 14336
+17.327360 1116.07 14336
+17.341696 1116.07 14336
+17.356032 1116.07 14336
+17.370368 1116.07 14336
+17.384640 1121.08 14272
+17.398912 1121.08 14272
+17.413184 1121.08 14272
+17.427456 1121.08 14272
+17.441600 1131.22 14144
+17.455744 1131.22 14144
+17.469888 1131.22 14144
+17.484032 1131.22 14144
+17.498176 1131.22 14144
+17.512320 1131.22 14144
+17.526464 1131.22 14144
+17.540608 1131.22 14144
+17.554688 1136.36 14080
+17.568768 1136.36 14080
+17.582848 1136.36 14080
+17.596928 1136.36 14080
+17.611008 1136.36 14080
+17.625088 1136.36 14080
+17.639168 1136.36 14080
+17.653248 1136.36 14080
+17.667264 1141.55 14016
+17.681280 1141.55 14016
+17.695296 1141.55 14016
+17.709312 1141.55 14016
+17.723328 1141.55 14016
+17.737344 1141.55 14016
+17.751360 1141.55 14016
+17.765376 1141.55 14016
+17.779328 1146.79 13952
+17.793280 1146.79 13952
+17.807232 1146.79 13952
+17.821184 1146.79 13952
+17.835072 1152.07 13888
+17.848960 1152.07 13888
+17.862848 1152.07 13888
+17.876736 1152.07 13888
+17.890624 1152.07 13888
+17.904512 1152.07 13888
+17.918400 1152.07 13888
+17.932288 1152.07 13888
+17.946112 1157.41 13824
+17.959936 1157.41 13824
+17.973760 1157.41 13824
+17.987584 1157.41 13824
+18.001408 1157.41 13824
+18.015232 1157.41 13824
+18.029056 1157.41 13824
+18.042880 1157.41 13824
+18.056576 1168.22 13696
+18.070272 1168.22 13696
+18.083968 1168.22 13696
+18.097664 1168.22 13696
+18.111360 1168.22 13696
+18.125056 1168.22 13696
+18.138752 1168.22 13696
+18.152448 1168.22 13696
+18.166080 1173.71 13632
+18.179712 1173.71 13632
+18.193344 1173.71 13632
+18.206976 1173.71 13632
+18.220608 1173.71 13632
+18.234240 1173.71 13632
+18.247872 1173.71 13632
+18.261504 1173.71 13632
+18.275072 1179.25 13568
+18.288640 1179.25 13568
+18.302208 1179.25 13568
+18.315776 1179.25 13568
+18.329344 1179.25 13568
+18.342912 1179.25 13568
+18.356480 1179.25 13568
+18.370048 1179.25 13568
+18.383552 1184.83 13504
+18.397056 1184.83 13504
+18.410560 1184.83 13504
+18.424064 1184.83 13504
+18.437504 1190.48 13440
+18.450944 1190.48 13440
+18.464384 1190.48 13440
+18.477824 1190.48 13440
+18.491264 1190.48 13440
+18.504704 1190.48 13440
+18.518144 1190.48 13440
+18.531584 1190.48 13440
+18.544960 1196.17 13376
+18.558336 1196.17 13376
+18.571712 1196.17 13376
+18.585088 1196.17 13376
+18.598464 1196.17 13376
+18.611840 1196.17 13376
+18.625216 1196.17 13376
+18.638592 1196.17 13376
+18.651904 1201.92 13312
+18.665216 1201.92 13312
+18.678528 1201.92 13312
+18.691840 1201.92 13312
+18.705152 1201.92 13312
+18.718464 1201.92 13312
+18.731776 1201.92 13312
+18.745088 1201.92 13312
+18.758272 1213.59 13184
+18.771456 1213.59 13184
+18.784640 1213.59 13184
+18.797824 1213.59 13184
+18.811008 1213.59 13184
+18.824192 1213.59 13184
+18.837376 1213.59 13184
+18.850560 1213.59 13184
+18.863680 1219.51 13120
+18.876800 1219.51 13120
+18.889920 1219.51 13120
+18.903040 1219.51 13120
+18.916160 1219.51 13120
+18.929280 1219.51 13120
+18.942400 1219.51 13120
+18.955520 1219.51 13120
+18.968576 1225.49 13056
+18.981632 1225.49 13056
+18.994688 1225.49 13056
+19.007744 1225.49 13056
+19.020800 1225.49 13056
+19.033856 1225.49 13056
+19.046912 1225.49 13056
+19.059968 1225.49 13056
+19.072960 1231.53 12992
+19.085952 1231.53 12992
+19.098944 1231.53 12992
+19.111936 1231.53 12992
+19.124928 1231.53 12992
+19.137920 1231.53 12992
+19.150912 1231.53 12992
+19.163904 1231.53 12992
+19.176832 1237.62 12928
+19.189760 1237.62 12928
+19.202688 1237.62 12928
+19.215616 1237.62 12928
+19.228544 1237.62 12928
+19.241472 1237.62 12928
+19.254400 1237.62 12928
+19.267328 1237.62 12928
+19.280192 1243.78 12864
+19.293056 1243.78 12864
+19.305920 1243.78 12864
+19.318784 1243.78 12864
+19.331648 1243.78 12864
+19.344512 1243.78 12864
+19.357376 1243.78 12864
+19.370240 1243.78 12864
+19.383040 1250.00 12800
+19.395840 1250.00 12800
+19.408640 1250.00 12800
+19.421440 1250.00 12800
+19.434240 1250.00 12800
+19.447040 1250.00 12800
+19.459840 1250.00 12800
+19.472640 1250.00 12800
+19.485440 1250.00 12800
+19.498240 1250.00 12800
+19.511040 1250.00 12800
+19.523840 1250.00 12800
+19.536576 1256.28 12736
+19.549312 1256.28 12736
+19.562048 1256.28 12736
+19.574784 1256.28 12736
+19.587520 1256.28 12736
+19.600256 1256.28 12736
+19.612992 1256.28 12736
+19.625728 1256.28 12736
+19.638400 1262.63 12672
+19.651072 1262.63 12672
+19.663744 1262.63 12672
+19.676416 1262.63 12672
+19.689088 1262.63 12672
+19.701760 1262.63 12672
+19.714432 1262.63 12672
+19.727104 1262.63 12672
+19.739712 1269.04 12608
+19.752320 1269.04 12608
+19.764928 1269.04 12608
+19.777536 1269.04 12608
+19.790144 1269.04 12608
+19.802752 1269.04 12608
+19.815360 1269.04 12608
+19.827968 1269.04 12608
+19.840512 1275.51 12544
+19.853056 1275.51 12544
+19.865600 1275.51 12544
+19.878144 1275.51 12544
+19.890688 1275.51 12544
+19.903232 1275.51 12544
+19.915776 1275.51 12544
+19.928320 1275.51 12544
+19.940736 1288.66 12416
+19.953152 1288.66 12416
+19.965568 1288.66 12416
+19.977984 1288.66 12416
+19.990400 1288.66 12416
+20.002816 1288.66 12416
+20.015232 1288.66 12416
+20.027648 1288.66 12416
+20.040000 1295.34 12352
+20.052352 1295.34 12352
+20.064704 1295.34 12352
+20.077056 1295.34 12352
+20.089408 1295.34 12352
+20.101760 1295.34 12352
+20.114112 1295.34 12352
+20.126464 1295.34 12352
+20.138816 1295.34 12352
+20.151168 1295.34 12352
+20.163520 1295.34 12352
+20.175872 1295.34 12352
+20.188160 1302.08 12288
+20.200448 1302.08 12288
+20.212736 1302.08 12288
+20.225024 1302.08 12288
+20.237312 1302.08 12288
+20.249600 1302.08 12288
+20.261888 1302.08 12288
+20.274176 1302.08 12288
+20.286400 1308.90 12224
+20.298624 1308.90 12224
+20.310848 1308.90 12224
+20.323072 1308.90 12224
+20.335296 1308.90 12224
+20.347520 1308.90 12224
+20.359744 1308.90 12224
+20.371968 1308.90 12224
+20.384128 1315.79 12160
+20.396288 1315.79 12160
+20.408448 1315.79 12160
+20.420608 1315.79 12160
+20.432768 1315.79 12160
+20.444928 1315.79 12160
+20.457088 1315.79 12160
+20.469248 1315.79 12160
+20.481408 1315.79 12160
+20.493568 1315.79 12160
+20.505728 1315.79 12160
+20.517888 1315.79 12160
+20.529984 1322.75 12096
+20.542080 1322.75 12096
+20.554176 1322.75 12096
+20.566272 1322.75 12096
+20.578368 1322.75 12096
+20.590464 1322.75 12096
+20.602560 1322.75 12096
+20.614656 1322.75 12096
+20.626688 1329.79 12032
+20.638720 1329.79 12032
+20.650752 1329.79 12032
+20.662784 1329.79 12032
+20.674816 1329.79 12032
+20.686848 1329.79 12032
+20.698880 1329.79 12032
+20.710912 1329.79 12032
+20.722880 1336.90 11968
+20.734848 1336.90 11968
+20.746816 1336.90 11968
+20.758784 1336.90 11968
+20.770752 1336.90 11968
+20.782720 1336.90 11968
+20.794688 1336.90 11968
+20.806656 1336.90 11968
+20.818624 1336.90 11968
+20.830592 1336.90 11968
+20.842560 1336.90 11968
+20.854528 1336.90 11968
+20.866432 1344.09 11904
+20.878336 1344.09 11904
+20.890240 1344.09 11904
+20.902144 1344.09 11904
+20.914048 1344.09 11904
+20.925952 1344.09 11904
+20.937856 1344.09 11904
+20.949760 1344.09 11904
+20.961600 1351.35 11840
+20.973440 1351.35 11840
+20.985280 1351.35 11840
+20.997120 1351.35 11840
+21.008960 1351.35 11840
+21.020800 1351.35 11840
+21.032640 1351.35 11840
+21.044480 1351.35 11840
+21.056320 1351.35 11840
+21.068160 1351.35 11840
+21.080000 1351.35 11840
+21.091840 1351.35 11840
+21.103616 1358.70 11776
+21.115392 1358.70 11776
+21.127168 1358.70 11776
+21.138944 1358.70 11776
+21.150720 1358.70 11776
+21.162496 1358.70 11776
+21.174272 1358.70 11776
+21.186048 1358.70 11776
+21.197760 1366.12 11712
+21.209472 1366.12 11712
+21.221184 1366.12 11712
+21.232896 1366.12 11712
+21.244608 1366.12 11712
+21.256320 1366.12 11712
+21.268032 1366.12 11712
+21.279744 1366.12 11712
+21.291456 1366.12 11712
+21.303168 1366.12 11712
+21.314880 1366.12 11712
+21.326592 1366.12 11712
+21.338240 1373.63 11648
+21.349888 1373.63 11648
+21.361536 1373.63 11648
+21.373184 1373.63 11648
+21.384832 1373.63 11648
+21.396480 1373.63 11648
+21.408128 1373.63 11648
+21.419776 1373.63 11648
+21.431360 1381.22 11584
+21.442944 1381.22 11584
+21.454528 1381.22 11584
+21.466112 1381.22 11584
+21.477696 1381.22 11584
+21.489280 1381.22 11584
+21.500864 1381.22 11584
+21.512448 1381.22 11584
+21.524032 1381.22 11584
+21.535616 1381.22 11584
+21.547200 1381.22 11584
+21.558784 1381.22 11584
+21.570304 1388.89 11520
+21.581824 1388.89 11520
+21.593344 1388.89 11520
+21.604864 1388.89 11520
+21.616384 1388.89 11520
+21.627904 1388.89 11520
+21.639424 1388.89 11520
+21.650944 1388.89 11520
+21.662400 1396.65 11456
+21.673856 1396.65 11456
+21.685312 1396.65 11456
+21.696768 1396.65 11456
+21.708224 1396.65 11456
+21.719680 1396.65 11456
+21.731136 1396.65 11456
+21.742592 1396.65 11456
+21.754048 1396.65 11456
+21.765504 1396.65 11456
+21.776960 1396.65 11456
+21.788416 1396.65 11456
+21.799808 1404.49 11392
+21.811200 1404.49 11392
+21.822592 1404.49 11392
+21.833984 1404.49 11392
+21.845376 1404.49 11392
+21.856768 1404.49 11392
+21.868160 1404.49 11392
+21.879552 1404.49 11392
+21.890944 1404.49 11392
+21.902336 1404.49 11392
+21.913728 1404.49 11392
+21.925120 1404.49 11392
+21.936448 1412.43 11328
+21.947776 1412.43 11328
+21.959104 1412.43 11328
+21.970432 1412.43 11328
+21.981760 1412.43 11328
+21.993088 1412.43 11328
+22.004416 1412.43 11328
+22.015744 1412.43 11328
+22.027008 1420.45 11264
+22.038272 1420.45 11264
+22.049536 1420.45 11264
+22.060800 1420.45 11264
+22.072064 1420.45 11264
+22.083328 1420.45 11264
+22.094592 1420.45 11264
+22.105856 1420.45 11264
+22.117120 1420.45 11264
+22.128384 1420.45 11264
+22.139648 1420.45 11264
+22.150912 1420.45 11264
+22.162112 1428.57 11200
+22.173312 1428.57 11200
+22.184512 1428.57 11200
+22.195712 1428.57 11200
+22.206912 1428.57 11200
+22.218112 1428.57 11200
+22.229312 1428.57 11200
+22.240512 1428.57 11200
+22.251712 1428.57 11200
+22.262912 1428.57 11200
+22.274112 1428.57 11200
+22.285312 1428.57 11200
+22.296448 1436.78 11136
+22.307584 1436.78 11136
+22.318720 1436.78 11136
+22.329856 1436.78 11136
+22.340992 1436.78 11136
+22.352128 1436.78 11136
+22.363264 1436.78 11136
+22.374400 1436.78 11136
+22.385536 1436.78 11136
+22.396672 1436.78 11136
+22.407808 1436.78 11136
+22.418944 1436.78 11136
+22.430080 1436.78 11136
+22.441216 1436.78 11136
+22.452352 1436.78 11136
+22.463488 1436.78 11136
+22.474624 1436.78 11136
+22.485760 1436.78 11136
+22.496896 1436.78 11136
+22.508032 1436.78 11136
+22.519104 1445.09 11072
+22.530176 1445.09 11072
+22.541248 1445.09 11072
+22.552320 1445.09 11072
+22.563392 1445.09 11072
+22.574464 1445.09 11072
+22.585536 1445.09 11072
+22.596608 1445.09 11072
+22.607680 1445.09 11072
+22.618752 1445.09 11072
+22.629824 1445.09 11072
+22.640896 1445.09 11072
+22.651968 1445.09 11072
+22.663040 1445.09 11072
+22.674112 1445.09 11072
+22.685184 1445.09 11072
+22.696192 1453.49 11008
+22.707200 1453.49 11008
+22.718208 1453.49 11008
+22.729216 1453.49 11008
+22.740224 1453.49 11008
+22.751232 1453.49 11008
+22.762240 1453.49 11008
+22.773248 1453.49 11008
+22.784192 1461.99 10944
+22.795136 1461.99 10944
+22.806080 1461.99 10944
+22.817024 1461.99 10944
+22.827968 1461.99 10944
+22.838912 1461.99 10944
+22.849856 1461.99 10944
+22.860800 1461.99 10944
+22.871744 1461.99 10944
+22.882688 1461.99 10944
+22.893632 1461.99 10944
+22.904576 1461.99 10944
+22.915520 1461.99 10944
+22.926464 1461.99 10944
+22.937408 1461.99 10944
+22.948352 1461.99 10944
+22.959232 1470.59 10880
+22.970112 1470.59 10880
+22.980992 1470.59 10880
+22.991872 1470.59 10880
+23.002752 1470.59 10880
+23.013632 1470.59 10880
+23.024512 1470.59 10880
+23.035392 1470.59 10880
+23.046208 1479.29 10816
+23.057024 1479.29 10816
+23.067840 1479.29 10816
+23.078656 1479.29 10816
+23.089472 1479.29 10816
+23.100288 1479.29 10816
+23.111104 1479.29 10816
+23.121920 1479.29 10816
+23.132736 1479.29 10816
+23.143552 1479.29 10816
+23.154368 1479.29 10816
+23.165184 1479.29 10816
+23.176000 1479.29 10816
+23.186816 1479.29 10816
+23.197632 1479.29 10816
+23.208448 1479.29 10816
+23.219200 1488.10 10752
+23.229952 1488.10 10752
+23.240704 1488.10 10752
+23.251456 1488.10 10752
+23.262208 1488.10 10752
+23.272960 1488.10 10752
+23.283712 1488.10 10752
+23.294464 1488.10 10752
+23.305152 1497.01 10688
+23.315840 1497.01 10688
+23.326528 1497.01 10688
+23.337216 1497.01 10688
+23.347904 1497.01 10688
+23.358592 1497.01 10688
+23.369280 1497.01 10688
+23.379968 1497.01 10688
+23.390656 1497.01 10688
+23.401344 1497.01 10688
+23.412032 1497.01 10688
+23.422720 1497.01 10688
+23.433408 1497.01 10688
+23.444096 1497.01 10688
+23.454784 1497.01 10688
+23.465472 1497.01 10688
+23.476096 1506.02 10624
+23.486720 1506.02 10624
+23.497344 1506.02 10624
+23.507968 1506.02 10624
+23.518592 1506.02 10624
+23.529216 1506.02 10624
+23.539840 1506.02 10624
+23.550464 1506.02 10624
+23.561024 1515.15 10560
+23.571584 1515.15 10560
+23.582144 1515.15 10560
+23.592704 1515.15 10560
+23.603264 1515.15 10560
+23.613824 1515.15 10560
+23.624384 1515.15 10560
+23.634944 1515.15 10560
+23.645504 1515.15 10560
+23.656064 1515.15 10560
+23.666624 1515.15 10560
+23.677184 1515.15 10560
+23.687744 1515.15 10560
+23.698304 1515.15 10560
+23.708864 1515.15 10560
+23.719424 1515.15 10560
+23.729920 1524.39 10496
+23.740416 1524.39 10496
+23.750912 1524.39 10496
+23.761408 1524.39 10496
+23.771904 1524.39 10496
+23.782400 1524.39 10496
+23.792896 1524.39 10496
+23.803392 1524.39 10496
+23.813824 1533.74 10432
+23.824256 1533.74 10432
+23.834688 1533.74 10432
+23.845120 1533.74 10432
+23.855552 1533.74 10432
+23.865984 1533.74 10432
+23.876416 1533.74 10432
+23.886848 1533.74 10432
+23.897280 1533.74 10432
+23.907712 1533.74 10432
+23.918144 1533.74 10432
+23.928576 1533.74 10432
+23.939008 1533.74 10432
+23.949440 1533.74 10432
+23.959872 1533.74 10432
+23.970304 1533.74 10432
+23.980736 1533.74 10432
+23.991168 1533.74 10432
+24.001600 1533.74 10432
+24.012032 1533.74 10432
+24.022464 1533.74 10432
+24.032896 1533.74 10432
+24.043328 1533.74 10432
+24.053760 1533.74 10432
+24.064128 1543.21 10368
+24.074496 1543.21 10368
+24.084864 1543.21 10368
+24.095232 1543.21 10368
+24.105600 1543.21 10368
+24.115968 1543.21 10368
+24.126336 1543.21 10368
+24.136704 1543.21 10368
+24.147072 1543.21 10368
+24.157440 1543.21 10368
+24.167808 1543.21 10368
+24.178176 1543.21 10368
+24.188544 1543.21 10368
+24.198912 1543.21 10368
+24.209280 1543.21 10368
+24.219648 1543.21 10368
+24.229952 1552.80 10304
+24.240256 1552.80 10304
+24.250560 1552.80 10304
+24.260864 1552.80 10304
+24.271168 1552.80 10304
+24.281472 1552.80 10304
+24.291776 1552.80 10304
+24.302080 1552.80 10304
+24.312384 1552.80 10304
+24.322688 1552.80 10304
+24.332992 1552.80 10304
+24.343296 1552.80 10304
+24.353600 1552.80 10304
+24.363904 1552.80 10304
+24.374208 1552.80 10304
+24.384512 1552.80 10304
+24.394752 1562.50 10240
+24.404992 1562.50 10240
+24.415232 1562.50 10240
+24.425472 1562.50 10240
+24.435712 1562.50 10240
+24.445952 1562.50 10240
+24.456192 1562.50 10240
+24.466432 1562.50 10240
+24.476608 1572.33 10176
+24.486784 1572.33 10176
+24.496960 1572.33 10176
+24.507136 1572.33 10176
+24.517312 1572.33 10176
+24.527488 1572.33 10176
+24.537664 1572.33 10176
+24.547840 1572.33 10176
+24.558016 1572.33 10176
+24.568192 1572.33 10176
+24.578368 1572.33 10176
+24.588544 1572.33 10176
+24.598720 1572.33 10176
+24.608896 1572.33 10176
+24.619072 1572.33 10176
+24.629248 1572.33 10176
+24.639360 1582.28 10112
+24.649472 1582.28 10112
+24.659584 1582.28 10112
+24.669696 1582.28 10112
+24.679808 1582.28 10112
+24.689920 1582.28 10112
+24.700032 1582.28 10112
+24.710144 1582.28 10112
+24.720256 1582.28 10112
+24.730368 1582.28 10112
+24.740480 1582.28 10112
+24.750592 1582.28 10112
+24.760704 1582.28 10112
+24.770816 1582.28 10112
+24.780928 1582.28 10112
+24.791040 1582.28 10112
+24.801088 1592.36 10048
+24.811136 1592.36 10048
+24.821184 1592.36 10048
+24.831232 1592.36 10048
+24.841280 1592.36 10048
+24.851328 1592.36 10048
+24.861376 1592.36 10048
+24.871424 1592.36 10048
+24.881472 1592.36 10048
+24.891520 1592.36 10048
+24.901568 1592.36 10048
+24.911616 1592.36 10048
+24.921664 1592.36 10048
+24.931712 1592.36 10048
+24.941760 1592.36 10048
+24.951808 1592.36 10048
+24.961856 1592.36 10048
+24.971904 1592.36 10048
+24.981952 1592.36 10048
+24.992000 1592.36 10048
+25.002048 1592.36 10048
+25.012096 1592.36 10048
+25.022144 1592.36 10048
+25.032192 1592.36 10048
+25.042176 1602.56 9984
+25.052160 1602.56 9984
+25.062144 1602.56 9984
+25.072128 1602.56 9984
+25.082112 1602.56 9984
+25.092096 1602.56 9984
+25.102080 1602.56 9984
+25.112064 1602.56 9984
+25.122048 1602.56 9984
+25.132032 1602.56 9984
+25.142016 1602.56 9984
+25.152000 1602.56 9984
+25.161984 1602.56 9984
+25.171968 1602.56 9984
+25.181952 1602.56 9984
+25.191936 1602.56 9984
+25.201856 1612.90 9920
+25.211776 1612.90 9920
+25.221696 1612.90 9920
+25.231616 1612.90 9920
+25.241536 1612.90 9920
+25.251456 1612.90 9920
+25.261376 1612.90 9920
+25.271296 1612.90 9920
+25.281216 1612.90 9920
+25.291136 1612.90 9920
+25.301056 1612.90 9920
+25.310976 1612.90 9920
+25.320896 1612.90 9920
+25.330816 1612.90 9920
+25.340736 1612.90 9920
+25.350656 1612.90 9920
+25.360512 1623.38 9856
+25.370368 1623.38 9856
+25.380224 1623.38 9856
+25.390080 1623.38 9856
+25.399936 1623.38 9856
+25.409792 1623.38 9856
+25.419648 1623.38 9856
+25.429504 1623.38 9856
+25.439296 1633.99 9792
+25.449088 1633.99 9792
+25.458880 1633.99 9792
+25.468672 1633.99 9792
+25.478464 1633.99 9792
+25.488256 1633.99 9792
+25.498048 1633.99 9792
+25.507840 1633.99 9792
+25.517632 1633.99 9792
+25.527424 1633.99 9792
+25.537216 1633.99 9792
+25.547008 1633.99 9792
+25.556800 1633.99 9792
+25.566592 1633.99 9792
+25.576384 1633.99 9792
+25.586176 1633.99 9792
+25.595904 1644.74 9728
+25.605632 1644.74 9728
+25.615360 1644.74 9728
+25.625088 1644.74 9728
+25.634816 1644.74 9728
+25.644544 1644.74 9728
+25.654272 1644.74 9728
+25.664000 1644.74 9728
+25.673728 1644.74 9728
+25.683456 1644.74 9728
+25.693184 1644.74 9728
+25.702912 1644.74 9728
+25.712640 1644.74 9728
+25.722368 1644.74 9728
+25.732096 1644.74 9728
+25.741824 1644.74 9728
+25.751552 1644.74 9728
+25.761280 1644.74 9728
+25.771008 1644.74 9728
+25.780736 1644.74 9728
+25.790464 1644.74 9728
+25.800192 1644.74 9728
+25.809920 1644.74 9728
+25.819648 1644.74 9728
+25.829376 1644.74 9728
+25.839104 1644.74 9728
+25.848832 1644.74 9728
+25.858560 1644.74 9728
+25.868288 1644.74 9728
+25.878016 1644.74 9728
+25.887744 1644.74 9728
+25.897472 1644.74 9728
+25.907136 1655.63 9664
+25.916800 1655.63 9664
+25.926464 1655.63 9664
+25.936128 1655.63 9664
+25.945792 1655.63 9664
+25.955456 1655.63 9664
+25.965120 1655.63 9664
+25.974784 1655.63 9664
+25.984448 1655.63 9664
+25.994112 1655.63 9664
+26.003776 1655.63 9664
+26.013440 1655.63 9664
+26.023104 1655.63 9664
+26.032768 1655.63 9664
+26.042432 1655.63 9664
+26.052096 1655.63 9664
+26.061696 1666.67 9600
+26.071296 1666.67 9600
+26.080896 1666.67 9600
+26.090496 1666.67 9600
+26.100096 1666.67 9600
+26.109696 1666.67 9600
+26.119296 1666.67 9600
+26.128896 1666.67 9600
+26.138496 1666.67 9600
+26.148096 1666.67 9600
+26.157696 1666.67 9600
+26.167296 1666.67 9600
+26.176896 1666.67 9600
+26.186496 1666.67 9600
+26.196096 1666.67 9600
+26.205696 1666.67 9600
+26.215232 1677.85 9536
+26.224768 1677.85 9536
+26.234304 1677.85 9536
+26.243840 1677.85 9536
+26.253376 1677.85 9536
+26.262912 1677.85 9536
+26.272448 1677.85 9536
+26.281984 1677.85 9536
+26.291456 1689.19 9472
+26.300928 1689.19 9472
+26.310400 1689.19 9472
+26.319872 1689.19 9472
+26.329344 1689.19 9472
+26.338816 1689.19 9472
+26.348288 1689.19 9472
+26.357760 1689.19 9472
+26.367232 1689.19 9472
+26.376704 1689.19 9472
+26.386176 1689.19 9472
+26.395648 1689.19 9472
+26.405120 1689.19 9472
+26.414592 1689.19 9472
+26.424064 1689.19 9472
+26.433536 1689.19 9472
+26.442944 1700.68 9408
+26.452352 1700.68 9408
+26.461760 1700.68 9408
+26.471168 1700.68 9408
+26.480576 1700.68 9408
+26.489984 1700.68 9408
+26.499392 1700.68 9408
+26.508800 1700.68 9408
+26.518208 1700.68 9408
+26.527616 1700.68 9408
+26.537024 1700.68 9408
+26.546432 1700.68 9408
+26.555840 1700.68 9408
+26.565248 1700.68 9408
+26.574656 1700.68 9408
+26.584064 1700.68 9408
+26.593472 1700.68 9408
+26.602880 1700.68 9408
+26.612288 1700.68 9408
+26.621696 1700.68 9408
+26.631104 1700.68 9408
+26.640512 1700.68 9408
+26.649920 1700.68 9408
+26.659328 1700.68 9408
+26.668736 1700.68 9408
+26.678144 1700.68 9408
+26.687552 1700.68 9408
+26.696960 1700.68 9408
+26.706368 1700.68 9408
+26.715776 1700.68 9408
+26.725184 1700.68 9408
+26.734592 1700.68 9408
+26.743936 1712.33 9344
+26.753280 1712.33 9344
+26.762624 1712.33 9344
+26.771968 1712.33 9344
+26.781312 1712.33 9344
+26.790656 1712.33 9344
+26.800000 1712.33 9344
+26.809344 1712.33 9344
+26.818688 1712.33 9344
+26.828032 1712.33 9344
+26.837376 1712.33 9344
+26.846720 1712.33 9344
+26.856064 1712.33 9344
+26.865408 1712.33 9344
+26.874752 1712.33 9344
+26.884096 1712.33 9344
+26.893376 1724.14 9280
+26.902656 1724.14 9280
+26.911936 1724.14 9280
+26.921216 1724.14 9280
+26.930496 1724.14 9280
+26.939776 1724.14 9280
+26.949056 1724.14 9280
+26.958336 1724.14 9280
+26.967616 1724.14 9280
+26.976896 1724.14 9280
+26.986176 1724.14 9280
+26.995456 1724.14 9280
+27.004736 1724.14 9280
+27.014016 1724.14 9280
+27.023296 1724.14 9280
+27.032576 1724.14 9280
+27.041792 1736.11 9216
+27.051008 1736.11 9216
+27.060224 1736.11 9216
+27.069440 1736.11 9216
+27.078656 1736.11 9216
+27.087872 1736.11 9216
+27.097088 1736.11 9216
+27.106304 1736.11 9216
+27.115520 1736.11 9216
+27.124736 1736.11 9216
+27.133952 1736.11 9216
+27.143168 1736.11 9216
+27.152384 1736.11 9216
+27.161600 1736.11 9216
+27.170816 1736.11 9216
+27.180032 1736.11 9216
+27.189248 1736.11 9216
+27.198464 1736.11 9216
+27.207680 1736.11 9216
+27.216896 1736.11 9216
+27.226112 1736.11 9216
+27.235328 1736.11 9216
+27.244544 1736.11 9216
+27.253760 1736.11 9216
+27.262976 1736.11 9216
+27.272192 1736.11 9216
+27.281408 1736.11 9216
+27.290624 1736.11 9216
+27.299840 1736.11 9216
+27.309056 1736.11 9216
+27.318272 1736.11 9216
+27.327488 1736.11 9216
+27.336640 1748.25 9152
+27.345792 1748.25 9152
+27.354944 1748.25 9152
+27.364096 1748.25 9152
+27.373248 1748.25 9152
+27.382400 1748.25 9152
+27.391552 1748.25 9152
+27.400704 1748.25 9152
+27.409856 1748.25 9152
+27.419008 1748.25 9152
+27.428160 1748.25 9152
+27.437312 1748.25 9152
+27.446464 1748.25 9152
+27.455616 1748.25 9152
+27.464768 1748.25 9152
+27.473920 1748.25 9152
+27.483008 1760.56 9088
+27.492096 1760.56 9088
+27.501184 1760.56 9088
+27.510272 1760.56 9088
+27.519360 1760.56 9088
+27.528448 1760.56 9088
+27.537536 1760.56 9088
+27.546624 1760.56 9088
+27.555712 1760.56 9088
+27.564800 1760.56 9088
+27.573888 1760.56 9088
+27.582976 1760.56 9088
+27.592064 1760.56 9088
+27.601152 1760.56 9088
+27.610240 1760.56 9088
+27.619328 1760.56 9088
+27.628352 1773.05 9024
+27.637376 1773.05 9024
+27.646400 1773.05 9024
+27.655424 1773.05 9024
+27.664448 1773.05 9024
+27.673472 1773.05 9024
+27.682496 1773.05 9024
+27.691520 1773.05 9024
+27.700544 1773.05 9024
+27.709568 1773.05 9024
+27.718592 1773.05 9024
+27.727616 1773.05 9024
+27.736640 1773.05 9024
+27.745664 1773.05 9024
+27.754688 1773.05 9024
+27.763712 1773.05 9024
+27.772736 1773.05 9024
+27.781760 1773.05 9024
+27.790784 1773.05 9024
+27.799808 1773.05 9024
+27.808832 1773.05 9024
+27.817856 1773.05 9024
+27.826880 1773.05 9024
+27.835904 1773.05 9024
+27.844864 1785.71 8960
+27.853824 1785.71 8960
+27.862784 1785.71 8960
+27.871744 1785.71 8960
+27.880704 1785.71 8960
+27.889664 1785.71 8960
+27.898624 1785.71 8960
+27.907584 1785.71 8960
+27.916544 1785.71 8960
+27.925504 1785.71 8960
+27.934464 1785.71 8960
+27.943424 1785.71 8960
+27.952384 1785.71 8960
+27.961344 1785.71 8960
+27.970304 1785.71 8960
+27.979264 1785.71 8960
+27.988224 1785.71 8960
+27.997184 1785.71 8960
+28.006144 1785.71 8960
+28.015104 1785.71 8960
+28.024064 1785.71 8960
+28.033024 1785.71 8960
+28.041984 1785.71 8960
+28.050944 1785.71 8960
+28.059904 1785.71 8960
+28.068864 1785.71 8960
+28.077824 1785.71 8960
+28.086784 1785.71 8960
+28.095744 1785.71 8960
+28.104704 1785.71 8960
+28.113664 1785.71 8960
+28.122624 1785.71 8960
+28.131520 1798.56 8896
+28.140416 1798.56 8896
+28.149312 1798.56 8896
+28.158208 1798.56 8896
+28.167104 1798.56 8896
+28.176000 1798.56 8896
+28.184896 1798.56 8896
+28.193792 1798.56 8896
+28.202688 1798.56 8896
+28.211584 1798.56 8896
+28.220480 1798.56 8896
+28.229376 1798.56 8896
+28.238272 1798.56 8896
+28.247168 1798.56 8896
+28.256064 1798.56 8896
+28.264960 1798.56 8896
+28.273792 1811.59 8832
+28.282624 1811.59 8832
+28.291456 1811.59 8832
+28.300288 1811.59 8832
+28.309120 1811.59 8832
+28.317952 1811.59 8832
+28.326784 1811.59 8832
+28.335616 1811.59 8832
+28.344448 1811.59 8832
+28.353280 1811.59 8832
+28.362112 1811.59 8832
+28.370944 1811.59 8832
+28.379776 1811.59 8832
+28.388608 1811.59 8832
+28.397440 1811.59 8832
+28.406272 1811.59 8832
+28.415040 1824.82 8768
+28.423808 1824.82 8768
+28.432576 1824.82 8768
+28.441344 1824.82 8768
+28.450112 1824.82 8768
+28.458880 1824.82 8768
+28.467648 1824.82 8768
+28.476416 1824.82 8768
+28.485184 1824.82 8768
+28.493952 1824.82 8768
+28.502720 1824.82 8768
+28.511488 1824.82 8768
+28.520256 1824.82 8768
+28.529024 1824.82 8768
+28.537792 1824.82 8768
+28.546560 1824.82 8768
+28.555328 1824.82 8768
+28.564096 1824.82 8768
+28.572864 1824.82 8768
+28.581632 1824.82 8768
+28.590400 1824.82 8768
+28.599168 1824.82 8768
+28.607936 1824.82 8768
+28.616704 1824.82 8768
+28.625472 1824.82 8768
+28.634240 1824.82 8768
+28.643008 1824.82 8768
+28.651776 1824.82 8768
+28.660544 1824.82 8768
+28.669312 1824.82 8768
+28.678080 1824.82 8768
+28.686848 1824.82 8768
+28.695616 1824.82 8768
+28.704384 1824.82 8768
+28.713152 1824.82 8768
+28.721920 1824.82 8768
+28.730688 1824.82 8768
+28.739456 1824.82 8768
+28.748224 1824.82 8768
+28.756992 1824.82 8768
+28.765696 1838.24 8704
+28.774400 1838.24 8704
+28.783104 1838.24 8704
+28.791808 1838.24 8704
+28.800512 1838.24 8704
+28.809216 1838.24 8704
+28.817920 1838.24 8704
+28.826624 1838.24 8704
+28.835328 1838.24 8704
+28.844032 1838.24 8704
+28.852736 1838.24 8704
+28.861440 1838.24 8704
+28.870144 1838.24 8704
+28.878848 1838.24 8704
+28.887552 1838.24 8704
+28.896256 1838.24 8704
+28.904896 1851.85 8640
+28.913536 1851.85 8640
+28.922176 1851.85 8640
+28.930816 1851.85 8640
+28.939456 1851.85 8640
+28.948096 1851.85 8640
+28.956736 1851.85 8640
+28.965376 1851.85 8640
+28.974016 1851.85 8640
+28.982656 1851.85 8640
+28.991296 1851.85 8640
+28.999936 1851.85 8640
+29.008576 1851.85 8640
+29.017216 1851.85 8640
+29.025856 1851.85 8640
+29.034496 1851.85 8640
+29.043136 1851.85 8640
+29.051776 1851.85 8640
+29.060416 1851.85 8640
+29.069056 1851.85 8640
+29.077696 1851.85 8640
+29.086336 1851.85 8640
+29.094976 1851.85 8640
+29.103616 1851.85 8640
+29.112256 1851.85 8640
+29.120896 1851.85 8640
+29.129536 1851.85 8640
+29.138176 1851.85 8640
+29.146816 1851.85 8640
+29.155456 1851.85 8640
+29.164096 1851.85 8640
+29.172736 1851.85 8640
+29.181376 1851.85 8640
+29.190016 1851.85 8640
+29.198656 1851.85 8640
+29.207296 1851.85 8640
+29.215936 1851.85 8640
+29.224576 1851.85 8640
+29.233216 1851.85 8640
+29.241856 1851.85 8640
+29.250432 1865.67 8576
+29.259008 1865.67 8576
+29.267584 1865.67 8576
+29.276160 1865.67 8576
+29.284736 1865.67 8576
+29.293312 1865.67 8576
+29.301888 1865.67 8576
+29.310464 1865.67 8576
+29.319040 1865.67 8576
+29.327616 1865.67 8576
+29.336192 1865.67 8576
+29.344768 1865.67 8576
+29.353344 1865.67 8576
+29.361920 1865.67 8576
+29.370496 1865.67 8576
+29.379072 1865.67 8576
+29.387584 1879.70 8512
+29.396096 1879.70 8512
+29.404608 1879.70 8512
+29.413120 1879.70 8512
+29.421632 1879.70 8512
+29.430144 1879.70 8512
+29.438656 1879.70 8512
+29.447168 1879.70 8512
+29.455680 1879.70 8512
+29.464192 1879.70 8512
+29.472704 1879.70 8512
+29.481216 1879.70 8512
+29.489728 1879.70 8512
+29.498240 1879.70 8512
+29.506752 1879.70 8512
+29.515264 1879.70 8512
+29.523712 1893.94 8448
+29.532160 1893.94 8448
+29.540608 1893.94 8448
+29.549056 1893.94 8448
+29.557504 1893.94 8448
+29.565952 1893.94 8448
+29.574400 1893.94 8448
+29.582848 1893.94 8448
+29.591296 1893.94 8448
+29.599744 1893.94 8448
+29.608192 1893.94 8448
+29.616640 1893.94 8448
+29.625088 1893.94 8448
+29.633536 1893.94 8448
+29.641984 1893.94 8448
+29.650432 1893.94 8448
+29.658880 1893.94 8448
+29.667328 1893.94 8448
+29.675776 1893.94 8448
+29.684224 1893.94 8448
+29.692672 1893.94 8448
+29.701120 1893.94 8448
+29.709568 1893.94 8448
+29.718016 1893.94 8448
+29.726464 1893.94 8448
+29.734912 1893.94 8448
+29.743360 1893.94 8448
+29.751808 1893.94 8448
+29.760256 1893.94 8448
+29.768704 1893.94 8448
+29.777152 1893.94 8448
+29.785600 1893.94 8448
+29.794048 1893.94 8448
+29.802496 1893.94 8448
+29.810944 1893.94 8448
+29.819392 1893.94 8448
+29.827840 1893.94 8448
+29.836288 1893.94 8448
+29.844736 1893.94 8448
+29.853184 1893.94 8448
+29.861568 1908.40 8384
+29.869952 1908.40 8384
+29.878336 1908.40 8384
+29.886720 1908.40 8384
+29.895104 1908.40 8384
+29.903488 1908.40 8384
+29.911872 1908.40 8384
+29.920256 1908.40 8384
+29.928640 1908.40 8384
+29.937024 1908.40 8384
+29.945408 1908.40 8384
+29.953792 1908.40 8384
+29.962176 1908.40 8384
+29.970560 1908.40 8384
+29.978944 1908.40 8384
+29.987328 1908.40 8384
+29.995712 1908.40 8384
+30.004096 1908.40 8384
+30.012480 1908.40 8384
+30.020864 1908.40 8384
+30.029248 1908.40 8384
+30.037632 1908.40 8384
+30.046016 1908.40 8384
+30.054400 1908.40 8384
+30.062720 1923.08 8320
+30.071040 1923.08 8320
+30.079360 1923.08 8320
+30.087680 1923.08 8320
+30.096000 1923.08 8320
+30.104320 1923.08 8320
+30.112640 1923.08 8320
+30.120960 1923.08 8320
+30.129280 1923.08 8320
+30.137600 1923.08 8320
+30.145920 1923.08 8320
+30.154240 1923.08 8320
+30.162560 1923.08 8320
+30.170880 1923.08 8320
+30.179200 1923.08 8320
+30.187520 1923.08 8320
+30.195776 1937.98 8256
+30.204032 1937.98 8256
+30.212288 1937.98 8256
+30.220544 1937.98 8256
+30.228800 1937.98 8256
+30.237056 1937.98 8256
+30.245312 1937.98 8256
+30.253568 1937.98 8256
+30.261824 1937.98 8256
+30.270080 1937.98 8256
+30.278336 1937.98 8256
+30.286592 1937.98 8256
+30.294848 1937.98 8256
+30.303104 1937.98 8256
+30.311360 1937.98 8256
+30.319616 1937.98 8256
+30.327872 1937.98 8256
+30.336128 1937.98 8256
+30.344384 1937.98 8256
+30.352640 1937.98 8256
+30.360896 1937.98 8256
+30.369152 1937.98 8256
+30.377408 1937.98 8256
+30.385664 1937.98 8256
+30.393920 1937.98 8256
+30.402176 1937.98 8256
+30.410432 1937.98 8256
+30.418688 1937.98 8256
+30.426944 1937.98 8256
+30.435200 1937.98 8256
+30.443456 1937.98 8256
+30.451712 1937.98 8256
+30.459968 1937.98 8256
+30.468224 1937.98 8256
+30.476480 1937.98 8256
+30.484736 1937.98 8256
+30.492992 1937.98 8256
+30.501248 1937.98 8256
+30.509504 1937.98 8256
+30.517760 1937.98 8256
+30.525952 1953.12 8192
+30.534144 1953.12 8192
+30.542336 1953.12 8192
+30.550528 1953.12 8192
+30.558720 1953.12 8192
+30.566912 1953.12 8192
+30.575104 1953.12 8192
+30.583296 1953.12 8192
+30.591488 1953.12 8192
+30.599680 1953.12 8192
+30.607872 1953.12 8192
+30.616064 1953.12 8192
+30.624256 1953.12 8192
+30.632448 1953.12 8192
+30.640640 1953.12 8192
+30.648832 1953.12 8192
+30.657024 1953.12 8192
+30.665216 1953.12 8192
+30.673408 1953.12 8192
+30.681600 1953.12 8192
+30.689792 1953.12 8192
+30.697984 1953.12 8192
+30.706176 1953.12 8192
+30.714368 1953.12 8192
+30.722528 1960.78 8160
+30.730688 1960.78 8160
+30.738848 1960.78 8160
+30.747008 1960.78 8160
+30.755168 1960.78 8160
+30.763328 1960.78 8160
+30.771488 1960.78 8160
+30.779648 1960.78 8160
+30.787808 1960.78 8160
+30.795968 1960.78 8160
+30.804128 1960.78 8160
+30.812288 1960.78 8160
+30.820448 1960.78 8160
+30.828608 1960.78 8160
+30.836768 1960.78 8160
+30.844928 1960.78 8160
+30.853056 1968.50 8128
+30.861184 1968.50 8128
+30.869312 1968.50 8128
+30.877440 1968.50 8128
+30.885568 1968.50 8128
+30.893696 1968.50 8128
+30.901824 1968.50 8128
+30.909952 1968.50 8128
+30.918080 1968.50 8128
+30.926208 1968.50 8128
+30.934336 1968.50 8128
+30.942464 1968.50 8128
+30.950592 1968.50 8128
+30.958720 1968.50 8128
+30.966848 1968.50 8128
+30.974976 1968.50 8128
+30.983104 1968.50 8128
+30.991232 1968.50 8128
+30.999360 1968.50 8128
+31.007488 1968.50 8128
+31.015616 1968.50 8128
+31.023744 1968.50 8128
+31.031872 1968.50 8128
+31.040000 1968.50 8128
+31.048064 1984.13 8064
+31.056128 1984.13 8064
+31.064192 1984.13 8064
+31.072256 1984.13 8064
+31.080320 1984.13 8064
+31.088384 1984.13 8064
+31.096448 1984.13 8064
+31.104512 1984.13 8064
+31.112576 1984.13 8064
+31.120640 1984.13 8064
+31.128704 1984.13 8064
+31.136768 1984.13 8064
+31.144832 1984.13 8064
+31.152896 1984.13 8064
+31.160960 1984.13 8064
+31.169024 1984.13 8064
+31.177088 1984.13 8064
+31.185152 1984.13 8064
+31.193216 1984.13 8064
+31.201280 1984.13 8064
+31.209344 1984.13 8064
+31.217408 1984.13 8064
+31.225472 1984.13 8064
+31.233536 1984.13 8064
+31.241568 1992.03 8032
+31.249600 1992.03 8032
+31.257632 1992.03 8032
+31.265664 1992.03 8032
+31.273696 1992.03 8032
+31.281728 1992.03 8032
+31.289760 1992.03 8032
+31.297792 1992.03 8032
+31.305824 1992.03 8032
+31.313856 1992.03 8032
+31.321888 1992.03 8032
+31.329920 1992.03 8032
+31.337952 1992.03 8032
+31.345984 1992.03 8032
+31.354016 1992.03 8032
+31.362048 1992.03 8032
+31.370048 2000.00 8000
+31.386048 2000.00 8000
+31.402048 2000.00 8000
+31.418048 2000.00 8000
+31.434048 2000.00 8000
+31.450048 2000.00 8000
+31.466048 2000.00 8000
+31.482048 2000.00 8000
+31.498048 2000.00 8000
+31.514048 2000.00 8000
+31.530048 2000.00 8000
+31.546048 2000.00 8000
+31.561920 2016.13 7936
+31.577792 2016.13 7936
+31.593664 2016.13 7936
+31.609536 2016.13 7936
+31.625408 2016.13 7936
+31.641280 2016.13 7936
+31.657152 2016.13 7936
+31.673024 2016.13 7936
+31.688896 2016.13 7936
+31.704768 2016.13 7936
+31.720640 2016.13 7936
+31.736512 2016.13 7936
+31.752320 2024.29 7904
+31.768128 2024.29 7904
+31.783936 2024.29 7904
+31.799744 2024.29 7904
+31.815552 2024.29 7904
+31.831360 2024.29 7904
+31.847168 2024.29 7904
+31.862976 2024.29 7904
+31.878784 2024.29 7904
+31.894592 2024.29 7904
+31.910400 2024.29 7904
+31.926208 2024.29 7904
+31.941952 2032.52 7872
+31.957696 2032.52 7872
+31.973440 2032.52 7872
+31.989184 2032.52 7872
+32.004928 2032.52 7872
+32.020672 2032.52 7872
+32.036416 2032.52 7872
+32.052160 2032.52 7872
+32.067776 2049.18 7808
+32.083392 2049.18 7808
+32.099008 2049.18 7808
+32.114624 2049.18 7808
+32.130240 2049.18 7808
+32.145856 2049.18 7808
+32.161472 2049.18 7808
+32.177088 2049.18 7808
+32.192704 2049.18 7808
+32.208320 2049.18 7808
+32.223936 2049.18 7808
+32.239552 2049.18 7808
+32.255168 2049.18 7808
+32.270784 2049.18 7808
+32.286400 2049.18 7808
+32.302016 2049.18 7808
+32.317568 2057.61 7776
+32.333120 2057.61 7776
+32.348672 2057.61 7776
+32.364224 2057.61 7776
+32.379776 2057.61 7776
+32.395328 2057.61 7776
+32.410880 2057.61 7776
+32.426432 2057.61 7776
+32.441920 2066.12 7744
+32.457408 2066.12 7744
+32.472896 2066.12 7744
+32.488384 2066.12 7744
+32.503872 2066.12 7744
+32.519360 2066.12 7744
+32.534848 2066.12 7744
+32.550336 2066.12 7744
+32.565824 2066.12 7744
+32.581312 2066.12 7744
+32.596800 2066.12 7744
+32.612288 2066.12 7744
+32.627776 2066.12 7744
+32.643264 2066.12 7744
+32.658752 2066.12 7744
+32.674240 2066.12 7744
+32.689600 2083.33 7680
+32.704960 2083.33 7680
+32.720320 2083.33 7680
+32.735680 2083.33 7680
+32.751040 2083.33 7680
+32.766400 2083.33 7680
+32.781760 2083.33 7680
+32.797120 2083.33 7680
+32.812416 2092.05 7648
+32.827712 2092.05 7648
+32.843008 2092.05 7648
+32.858304 2092.05 7648
+32.873600 2092.05 7648
+32.888896 2092.05 7648
+32.904192 2092.05 7648
+32.919488 2092.05 7648
+32.934784 2092.05 7648
+32.950080 2092.05 7648
+32.965376 2092.05 7648
+32.980672 2092.05 7648
+32.995968 2092.05 7648
+33.011264 2092.05 7648
+33.026560 2092.05 7648
+33.041856 2092.05 7648
+33.057088 2100.84 7616
+33.072320 2100.84 7616
+33.087552 2100.84 7616
+33.102784 2100.84 7616
+33.118016 2100.84 7616
+33.133248 2100.84 7616
+33.148480 2100.84 7616
+33.163712 2100.84 7616
+33.178816 2118.64 7552
+33.193920 2118.64 7552
+33.209024 2118.64 7552
+33.224128 2118.64 7552
+33.239232 2118.64 7552
+33.254336 2118.64 7552
+33.269440 2118.64 7552
+33.284544 2118.64 7552
+33.299648 2118.64 7552
+33.314752 2118.64 7552
+33.329856 2118.64 7552
+33.344960 2118.64 7552
+33.360064 2118.64 7552
+33.375168 2118.64 7552
+33.390272 2118.64 7552
+33.405376 2118.64 7552
+33.420416 2127.66 7520
+33.435456 2127.66 7520
+33.450496 2127.66 7520
+33.465536 2127.66 7520
+33.480576 2127.66 7520
+33.495616 2127.66 7520
+33.510656 2127.66 7520
+33.525696 2127.66 7520
+33.540672 2136.75 7488
+33.555648 2136.75 7488
+33.570624 2136.75 7488
+33.585600 2136.75 7488
+33.600576 2136.75 7488
+33.615552 2136.75 7488
+33.630528 2136.75 7488
+33.645504 2136.75 7488
+33.660480 2136.75 7488
+33.675456 2136.75 7488
+33.690432 2136.75 7488
+33.705408 2136.75 7488
+33.720384 2136.75 7488
+33.735360 2136.75 7488
+33.750336 2136.75 7488
+33.765312 2136.75 7488
+33.780224 2145.92 7456
+33.795136 2145.92 7456
+33.810048 2145.92 7456
+33.824960 2145.92 7456
+33.839872 2145.92 7456
+33.854784 2145.92 7456
+33.869696 2145.92 7456
+33.884608 2145.92 7456
+33.899392 2164.50 7392
+33.914176 2164.50 7392
+33.928960 2164.50 7392
+33.943744 2164.50 7392
+33.958528 2164.50 7392
+33.973312 2164.50 7392
+33.988096 2164.50 7392
+34.002880 2164.50 7392
+34.017664 2164.50 7392
+34.032448 2164.50 7392
+34.047232 2164.50 7392
+34.062016 2164.50 7392
+34.076800 2164.50 7392
+34.091584 2164.50 7392
+34.106368 2164.50 7392
+34.121152 2164.50 7392
+34.135872 2173.91 7360
+34.150592 2173.91 7360
+34.165312 2173.91 7360
+34.180032 2173.91 7360
+34.194752 2173.91 7360
+34.209472 2173.91 7360
+34.224192 2173.91 7360
+34.238912 2173.91 7360
+34.253568 2183.41 7328
+34.268224 2183.41 7328
+34.282880 2183.41 7328
+34.297536 2183.41 7328
+34.312192 2183.41 7328
+34.326848 2183.41 7328
+34.341504 2183.41 7328
+34.356160 2183.41 7328
+34.370816 2183.41 7328
+34.385472 2183.41 7328
+34.400128 2183.41 7328
+34.414784 2183.41 7328
+34.429440 2183.41 7328
+34.444096 2183.41 7328
+34.458752 2183.41 7328
+34.473408 2183.41 7328
+34.488000 2192.98 7296
+34.502592 2192.98 7296
+34.517184 2192.98 7296
+34.531776 2192.98 7296
+34.546368 2192.98 7296
+34.560960 2192.98 7296
+34.575552 2192.98 7296
+34.590144 2192.98 7296
+34.604736 2192.98 7296
+34.619328 2192.98 7296
+34.633920 2192.98 7296
+34.648512 2192.98 7296
+34.663104 2192.98 7296
+34.677696 2192.98 7296
+34.692288 2192.98 7296
+34.706880 2192.98 7296
+34.721344 2212.39 7232
+34.735808 2212.39 7232
+34.750272 2212.39 7232
+34.764736 2212.39 7232
+34.779200 2212.39 7232
+34.793664 2212.39 7232
+34.808128 2212.39 7232
+34.822592 2212.39 7232
+34.836992 2222.22 7200
+34.851392 2222.22 7200
+34.865792 2222.22 7200
+34.880192 2222.22 7200
+34.894592 2222.22 7200
+34.908992 2222.22 7200
+34.923392 2222.22 7200
+34.937792 2222.22 7200
+34.952192 2222.22 7200
+34.966592 2222.22 7200
+34.980992 2222.22 7200
+34.995392 2222.22 7200
+35.009792 2222.22 7200
+35.024192 2222.22 7200
+35.038592 2222.22 7200
+35.052992 2222.22 7200
+35.067328 2232.14 7168
+35.081664 2232.14 7168
+35.096000 2232.14 7168
+35.110336 2232.14 7168
+35.124672 2232.14 7168
+35.139008 2232.14 7168
+35.153344 2232.14 7168
+35.167680 2232.14 7168
+35.182016 2232.14 7168
+35.196352 2232.14 7168
+35.210688 2232.14 7168
+35.225024 2232.14 7168
+35.239360 2232.14 7168
+35.253696 2232.14 7168
+35.268032 2232.14 7168
+35.282368 2232.14 7168
+35.296640 2242.15 7136
+35.310912 2242.15 7136
+35.325184 2242.15 7136
+35.339456 2242.15 7136
+35.353728 2242.15 7136
+35.368000 2242.15 7136
+35.382272 2242.15 7136
+35.396544 2242.15 7136
+35.410688 2262.44 7072
+35.424832 2262.44 7072
+35.438976 2262.44 7072
+35.453120 2262.44 7072
+35.467264 2262.44 7072
+35.481408 2262.44 7072
+35.495552 2262.44 7072
+35.509696 2262.44 7072
+35.523840 2262.44 7072
+35.537984 2262.44 7072
+35.552128 2262.44 7072
+35.566272 2262.44 7072
+35.580416 2262.44 7072
+35.594560 2262.44 7072
+35.608704 2262.44 7072
+35.622848 2262.44 7072
+35.636928 2272.73 7040
+35.651008 2272.73 7040
+35.665088 2272.73 7040
+35.679168 2272.73 7040
+35.693248 2272.73 7040
+35.707328 2272.73 7040
+35.721408 2272.73 7040
+35.735488 2272.73 7040
+35.749568 2272.73 7040
+35.763648 2272.73 7040
+35.777728 2272.73 7040
+35.791808 2272.73 7040
+35.805888 2272.73 7040
+35.819968 2272.73 7040
+35.834048 2272.73 7040
+35.848128 2272.73 7040
+35.862144 2283.11 7008
+35.876160 2283.11 7008
+35.890176 2283.11 7008
+35.904192 2283.11 7008
+35.918208 2283.11 7008
+35.932224 2283.11 7008
+35.946240 2283.11 7008
+35.960256 2283.11 7008
+35.974272 2283.11 7008
+35.988288 2283.11 7008
+36.002304 2283.11 7008
+36.016320 2283.11 7008
+36.030336 2283.11 7008
+36.044352 2283.11 7008
+36.058368 2283.11 7008
+36.072384 2283.11 7008
+36.086336 2293.58 6976
+36.100288 2293.58 6976
+36.114240 2293.58 6976
+36.128192 2293.58 6976
+36.142144 2293.58 6976
+36.156096 2293.58 6976
+36.170048 2293.58 6976
+36.184000 2293.58 6976
+36.197888 2304.15 6944
+36.211776 2304.15 6944
+36.225664 2304.15 6944
+36.239552 2304.15 6944
+36.253440 2304.15 6944
+36.267328 2304.15 6944
+36.281216 2304.15 6944
+36.295104 2304.15 6944
+36.308992 2304.15 6944
+36.322880 2304.15 6944
+36.336768 2304.15 6944
+36.350656 2304.15 6944
+36.364544 2304.15 6944
+36.378432 2304.15 6944
+36.392320 2304.15 6944
+36.406208 2304.15 6944
+36.420032 2314.81 6912
+36.433856 2314.81 6912
+36.447680 2314.81 6912
+36.461504 2314.81 6912
+36.475328 2314.81 6912
+36.489152 2314.81 6912
+36.502976 2314.81 6912
+36.516800 2314.81 6912
+36.530624 2314.81 6912
+36.544448 2314.81 6912
+36.558272 2314.81 6912
+36.572096 2314.81 6912
+36.585920 2314.81 6912
+36.599744 2314.81 6912
+36.613568 2314.81 6912
+36.627392 2314.81 6912
+36.641088 2336.45 6848
+36.654784 2336.45 6848
+36.668480 2336.45 6848
+36.682176 2336.45 6848
+36.695872 2336.45 6848
+36.709568 2336.45 6848
+36.723264 2336.45 6848
+36.736960 2336.45 6848
+36.750656 2336.45 6848
+36.764352 2336.45 6848
+36.778048 2336.45 6848
+36.791744 2336.45 6848
+36.805440 2336.45 6848
+36.819136 2336.45 6848
+36.832832 2336.45 6848
+36.846528 2336.45 6848
+36.860160 2347.42 6816
+36.873792 2347.42 6816
+36.887424 2347.42 6816
+36.901056 2347.42 6816
+36.914688 2347.42 6816
+36.928320 2347.42 6816
+36.941952 2347.42 6816
+36.955584 2347.42 6816
+36.969216 2347.42 6816
+36.982848 2347.42 6816
+36.996480 2347.42 6816
+37.010112 2347.42 6816
+37.023744 2347.42 6816
+37.037376 2347.42 6816
+37.051008 2347.42 6816
+37.064640 2347.42 6816
+37.078208 2358.49 6784
+37.091776 2358.49 6784
+37.105344 2358.49 6784
+37.118912 2358.49 6784
+37.132480 2358.49 6784
+37.146048 2358.49 6784
+37.159616 2358.49 6784
+37.173184 2358.49 6784
+37.186752 2358.49 6784
+37.200320 2358.49 6784
+37.213888 2358.49 6784
+37.227456 2358.49 6784
+37.241024 2358.49 6784
+37.254592 2358.49 6784
+37.268160 2358.49 6784
+37.281728 2358.49 6784
+37.295232 2369.67 6752
+37.308736 2369.67 6752
+37.322240 2369.67 6752
+37.335744 2369.67 6752
+37.349248 2369.67 6752
+37.362752 2369.67 6752
+37.376256 2369.67 6752
+37.389760 2369.67 6752
+37.403200 2380.95 6720
+37.416640 2380.95 6720
+37.430080 2380.95 6720
+37.443520 2380.95 6720
+37.456960 2380.95 6720
+37.470400 2380.95 6720
+37.483840 2380.95 6720
+37.497280 2380.95 6720
+37.510720 2380.95 6720
+37.524160 2380.95 6720
+37.537600 2380.95 6720
+37.551040 2380.95 6720
+37.564480 2380.95 6720
+37.577920 2380.95 6720
+37.591360 2380.95 6720
+37.604800 2380.95 6720
+37.618176 2392.34 6688
+37.631552 2392.34 6688
+37.644928 2392.34 6688
+37.658304 2392.34 6688
+37.671680 2392.34 6688
+37.685056 2392.34 6688
+37.698432 2392.34 6688
+37.711808 2392.34 6688
+37.725184 2392.34 6688
+37.738560 2392.34 6688
+37.751936 2392.34 6688
+37.765312 2392.34 6688
+37.778688 2392.34 6688
+37.792064 2392.34 6688
+37.805440 2392.34 6688
+37.818816 2392.34 6688
+37.832128 2403.85 6656
+37.845440 2403.85 6656
+37.858752 2403.85 6656
+37.872064 2403.85 6656
+37.885376 2403.85 6656
+37.898688 2403.85 6656
+37.912000 2403.85 6656
+37.925312 2403.85 6656
+37.938624 2403.85 6656
+37.951936 2403.85 6656
+37.965248 2403.85 6656
+37.978560 2403.85 6656
+37.991872 2403.85 6656
+38.005184 2403.85 6656
+38.018496 2403.85 6656
+38.031808 2403.85 6656
+38.044992 2427.18 6592
+38.058176 2427.18 6592
+38.071360 2427.18 6592
+38.084544 2427.18 6592
+38.097728 2427.18 6592
+38.110912 2427.18 6592
+38.124096 2427.18 6592
+38.137280 2427.18 6592
+38.150464 2427.18 6592
+38.163648 2427.18 6592
+38.176832 2427.18 6592
+38.190016 2427.18 6592
+38.203200 2427.18 6592
+38.216384 2427.18 6592
+38.229568 2427.18 6592
+38.242752 2427.18 6592
+38.255872 2439.02 6560
+38.268992 2439.02 6560
+38.282112 2439.02 6560
+38.295232 2439.02 6560
+38.308352 2439.02 6560
+38.321472 2439.02 6560
+38.334592 2439.02 6560
+38.347712 2439.02 6560
+38.360832 2439.02 6560
+38.373952 2439.02 6560
+38.387072 2439.02 6560
+38.400192 2439.02 6560
+38.413312 2439.02 6560
+38.426432 2439.02 6560
+38.439552 2439.02 6560
+38.452672 2439.02 6560
+38.465728 2450.98 6528
+38.478784 2450.98 6528
+38.491840 2450.98 6528
+38.504896 2450.98 6528
+38.517952 2450.98 6528
+38.531008 2450.98 6528
+38.544064 2450.98 6528
+38.557120 2450.98 6528
+38.570176 2450.98 6528
+38.583232 2450.98 6528
+38.596288 2450.98 6528
+38.609344 2450.98 6528
+38.622400 2450.98 6528
+38.635456 2450.98 6528
+38.648512 2450.98 6528
+38.661568 2450.98 6528
+38.674560 2463.05 6496
+38.687552 2463.05 6496
+38.700544 2463.05 6496
+38.713536 2463.05 6496
+38.726528 2463.05 6496
+38.739520 2463.05 6496
+38.752512 2463.05 6496
+38.765504 2463.05 6496
+38.778496 2463.05 6496
+38.791488 2463.05 6496
+38.804480 2463.05 6496
+38.817472 2463.05 6496
+38.830464 2463.05 6496
+38.843456 2463.05 6496
+38.856448 2463.05 6496
+38.869440 2463.05 6496
+38.882368 2475.25 6464
+38.895296 2475.25 6464
+38.908224 2475.25 6464
+38.921152 2475.25 6464
+38.934080 2475.25 6464
+38.947008 2475.25 6464
+38.959936 2475.25 6464
+38.972864 2475.25 6464
+38.985792 2475.25 6464
+38.998720 2475.25 6464
+39.011648 2475.25 6464
+39.024576 2475.25 6464
+39.037504 2475.25 6464
+39.050432 2475.25 6464
+39.063360 2475.25 6464
+39.076288 2475.25 6464
+39.089152 2487.56 6432
+39.102016 2487.56 6432
+39.114880 2487.56 6432
+39.127744 2487.56 6432
+39.140608 2487.56 6432
+39.153472 2487.56 6432
+39.166336 2487.56 6432
+39.179200 2487.56 6432
+39.192064 2487.56 6432
+39.204928 2487.56 6432
+39.217792 2487.56 6432
+39.230656 2487.56 6432
+39.243520 2487.56 6432
+39.256384 2487.56 6432
+39.269248 2487.56 6432
+39.282112 2487.56 6432
+39.294912 2500.00 6400
+39.307712 2500.00 6400
+39.320512 2500.00 6400
+39.333312 2500.00 6400
+39.346112 2500.00 6400
+39.358912 2500.00 6400
+39.371712 2500.00 6400
+39.384512 2500.00 6400
+39.397312 2500.00 6400
+39.410112 2500.00 6400
+39.422912 2500.00 6400
+39.435712 2500.00 6400
+39.448512 2500.00 6400
+39.461312 2500.00 6400
+39.474112 2500.00 6400
+39.486912 2500.00 6400
+39.499712 2500.00 6400
+39.512512 2500.00 6400
+39.525312 2500.00 6400
+39.538112 2500.00 6400
+39.550912 2500.00 6400
+39.563712 2500.00 6400
+39.576512 2500.00 6400
+39.589312 2500.00 6400
+39.602048 2512.56 6368
+39.614784 2512.56 6368
+39.627520 2512.56 6368
+39.640256 2512.56 6368
+39.652992 2512.56 6368
+39.665728 2512.56 6368
+39.678464 2512.56 6368
+39.691200 2512.56 6368
+39.703936 2512.56 6368
+39.716672 2512.56 6368
+39.729408 2512.56 6368
+39.742144 2512.56 6368
+39.754880 2512.56 6368
+39.767616 2512.56 6368
+39.780352 2512.56 6368
+39.793088 2512.56 6368
+39.805760 2525.25 6336
+39.818432 2525.25 6336
+39.831104 2525.25 6336
+39.843776 2525.25 6336
+39.856448 2525.25 6336
+39.869120 2525.25 6336
+39.881792 2525.25 6336
+39.894464 2525.25 6336
+39.907136 2525.25 6336
+39.919808 2525.25 6336
+39.932480 2525.25 6336
+39.945152 2525.25 6336
+39.957824 2525.25 6336
+39.970496 2525.25 6336
+39.983168 2525.25 6336
+39.995840 2525.25 6336
+40.008448 2538.07 6304
+40.021056 2538.07 6304
+40.033664 2538.07 6304
+40.046272 2538.07 6304
+40.058880 2538.07 6304
+40.071488 2538.07 6304
+40.084096 2538.07 6304
+40.096704 2538.07 6304
+40.109312 2538.07 6304
+40.121920 2538.07 6304
+40.134528 2538.07 6304
+40.147136 2538.07 6304
+40.159744 2538.07 6304
+40.172352 2538.07 6304
+40.184960 2538.07 6304
+40.197568 2538.07 6304
+40.210112 2551.02 6272
+40.222656 2551.02 6272
+40.235200 2551.02 6272
+40.247744 2551.02 6272
+40.260288 2551.02 6272
+40.272832 2551.02 6272
+40.285376 2551.02 6272
+40.297920 2551.02 6272
+40.310464 2551.02 6272
+40.323008 2551.02 6272
+40.335552 2551.02 6272
+40.348096 2551.02 6272
+40.360640 2551.02 6272
+40.373184 2551.02 6272
+40.385728 2551.02 6272
+40.398272 2551.02 6272
+40.410688 2577.32 6208
+40.423104 2577.32 6208
+40.435520 2577.32 6208
+40.447936 2577.32 6208
+40.460352 2577.32 6208
+40.472768 2577.32 6208
+40.485184 2577.32 6208
+40.497600 2577.32 6208
+40.510016 2577.32 6208
+40.522432 2577.32 6208
+40.534848 2577.32 6208
+40.547264 2577.32 6208
+40.559680 2577.32 6208
+40.572096 2577.32 6208
+40.584512 2577.32 6208
+40.596928 2577.32 6208
+40.609280 2590.67 6176
+40.621632 2590.67 6176
+40.633984 2590.67 6176
+40.646336 2590.67 6176
+40.658688 2590.67 6176
+40.671040 2590.67 6176
+40.683392 2590.67 6176
+40.695744 2590.67 6176
+40.708096 2590.67 6176
+40.720448 2590.67 6176
+40.732800 2590.67 6176
+40.745152 2590.67 6176
+40.757504 2590.67 6176
+40.769856 2590.67 6176
+40.782208 2590.67 6176
+40.794560 2590.67 6176
+40.806912 2590.67 6176
+40.819264 2590.67 6176
+40.831616 2590.67 6176
+40.843968 2590.67 6176
+40.856320 2590.67 6176
+40.868672 2590.67 6176
+40.881024 2590.67 6176
+40.893376 2590.67 6176
+40.905664 2604.17 6144
+40.917952 2604.17 6144
+40.930240 2604.17 6144
+40.942528 2604.17 6144
+40.954816 2604.17 6144
+40.967104 2604.17 6144
+40.979392 2604.17 6144
+40.991680 2604.17 6144
+41.003968 2604.17 6144
+41.016256 2604.17 6144
+41.028544 2604.17 6144
+41.040832 2604.17 6144
+41.053120 2604.17 6144
+41.065408 2604.17 6144
+41.077696 2604.17 6144
+41.089984 2604.17 6144
+41.102208 2617.80 6112
+41.114432 2617.80 6112
+41.126656 2617.80 6112
+41.138880 2617.80 6112
+41.151104 2617.80 6112
+41.163328 2617.80 6112
+41.175552 2617.80 6112
+41.187776 2617.80 6112
+41.200000 2617.80 6112
+41.212224 2617.80 6112
+41.224448 2617.80 6112
+41.236672 2617.80 6112
+41.248896 2617.80 6112
+41.261120 2617.80 6112
+41.273344 2617.80 6112
+41.285568 2617.80 6112
+41.297728 2631.58 6080
+41.309888 2631.58 6080
+41.322048 2631.58 6080
+41.334208 2631.58 6080
+41.346368 2631.58 6080
+41.358528 2631.58 6080
+41.370688 2631.58 6080
+41.382848 2631.58 6080
+41.395008 2631.58 6080
+41.407168 2631.58 6080
+41.419328 2631.58 6080
+41.431488 2631.58 6080
+41.443648 2631.58 6080
+41.455808 2631.58 6080
+41.467968 2631.58 6080
+41.480128 2631.58 6080
+41.492288 2631.58 6080
+41.504448 2631.58 6080
+41.516608 2631.58 6080
+41.528768 2631.58 6080
+41.540928 2631.58 6080
+41.553088 2631.58 6080
+41.565248 2631.58 6080
+41.577408 2631.58 6080
+41.589504 2645.50 6048
+41.601600 2645.50 6048
+41.613696 2645.50 6048
+41.625792 2645.50 6048
+41.637888 2645.50 6048
+41.649984 2645.50 6048
+41.662080 2645.50 6048
+41.674176 2645.50 6048
+41.686272 2645.50 6048
+41.698368 2645.50 6048
+41.710464 2645.50 6048
+41.722560 2645.50 6048
+41.734656 2645.50 6048
+41.746752 2645.50 6048
+41.758848 2645.50 6048
+41.770944 2645.50 6048
+41.782976 2659.57 6016
+41.795008 2659.57 6016
+41.807040 2659.57 6016
+41.819072 2659.57 6016
+41.831104 2659.57 6016
+41.843136 2659.57 6016
+41.855168 2659.57 6016
+41.867200 2659.57 6016
+41.879232 2659.57 6016
+41.891264 2659.57 6016
+41.903296 2659.57 6016
+41.915328 2659.57 6016
+41.927360 2659.57 6016
+41.939392 2659.57 6016
+41.951424 2659.57 6016
+41.963456 2659.57 6016
+41.975424 2673.80 5984
+41.987392 2673.80 5984
+41.999360 2673.80 5984
+42.011328 2673.80 5984
+42.023296 2673.80 5984
+42.035264 2673.80 5984
+42.047232 2673.80 5984
+42.059200 2673.80 5984
+42.071168 2673.80 5984
+42.083136 2673.80 5984
+42.095104 2673.80 5984
+42.107072 2673.80 5984
+42.119040 2673.80 5984
+42.131008 2673.80 5984
+42.142976 2673.80 5984
+42.154944 2673.80 5984
+42.166912 2673.80 5984
+42.178880 2673.80 5984
+42.190848 2673.80 5984
+42.202816 2673.80 5984
+42.214784 2673.80 5984
+42.226752 2673.80 5984
+42.238720 2673.80 5984
+42.250688 2673.80 5984
+42.262592 2688.17 5952
+42.274496 2688.17 5952
+42.286400 2688.17 5952
+42.298304 2688.17 5952
+42.310208 2688.17 5952
+42.322112 2688.17 5952
+42.334016 2688.17 5952
+42.345920 2688.17 5952
+42.357824 2688.17 5952
+42.369728 2688.17 5952
+42.381632 2688.17 5952
+42.393536 2688.17 5952
+42.405440 2688.17 5952
+42.417344 2688.17 5952
+42.429248 2688.17 5952
+42.441152 2688.17 5952
+42.452992 2702.70 5920
+42.464832 2702.70 5920
+42.476672 2702.70 5920
+42.488512 2702.70 5920
+42.500352 2702.70 5920
+42.512192 2702.70 5920
+42.524032 2702.70 5920
+42.535872 2702.70 5920
+42.547712 2702.70 5920
+42.559552 2702.70 5920
+42.571392 2702.70 5920
+42.583232 2702.70 5920
+42.595072 2702.70 5920
+42.606912 2702.70 5920
+42.618752 2702.70 5920
+42.630592 2702.70 5920
+42.642432 2702.70 5920
+42.654272 2702.70 5920
+42.666112 2702.70 5920
+42.677952 2702.70 5920
+42.689792 2702.70 5920
+42.701632 2702.70 5920
+42.713472 2702.70 5920
+42.725312 2702.70 5920
+42.737088 2717.39 5888
+42.748864 2717.39 5888
+42.760640 2717.39 5888
+42.772416 2717.39 5888
+42.784192 2717.39 5888
+42.795968 2717.39 5888
+42.807744 2717.39 5888
+42.819520 2717.39 5888
+42.831296 2717.39 5888
+42.843072 2717.39 5888
+42.854848 2717.39 5888
+42.866624 2717.39 5888
+42.878400 2717.39 5888
+42.890176 2717.39 5888
+42.901952 2717.39 5888
+42.913728 2717.39 5888
+42.925440 2732.24 5856
+42.937152 2732.24 5856
+42.948864 2732.24 5856
+42.960576 2732.24 5856
+42.972288 2732.24 5856
+42.984000 2732.24 5856
+42.995712 2732.24 5856
+43.007424 2732.24 5856
+43.019136 2732.24 5856
+43.030848 2732.24 5856
+43.042560 2732.24 5856
+43.054272 2732.24 5856
+43.065984 2732.24 5856
+43.077696 2732.24 5856
+43.089408 2732.24 5856
+43.101120 2732.24 5856
+43.112832 2732.24 5856
+43.124544 2732.24 5856
+43.136256 2732.24 5856
+43.147968 2732.24 5856
+43.159680 2732.24 5856
+43.171392 2732.24 5856
+43.183104 2732.24 5856
+43.194816 2732.24 5856
+43.206464 2747.25 5824
+43.218112 2747.25 5824
+43.229760 2747.25 5824
+43.241408 2747.25 5824
+43.253056 2747.25 5824
+43.264704 2747.25 5824
+43.276352 2747.25 5824
+43.288000 2747.25 5824
+43.299648 2747.25 5824
+43.311296 2747.25 5824
+43.322944 2747.25 5824
+43.334592 2747.25 5824
+43.346240 2747.25 5824
+43.357888 2747.25 5824
+43.369536 2747.25 5824
+43.381184 2747.25 5824
+43.392768 2762.43 5792
+43.404352 2762.43 5792
+43.415936 2762.43 5792
+43.427520 2762.43 5792
+43.439104 2762.43 5792
+43.450688 2762.43 5792
+43.462272 2762.43 5792
+43.473856 2762.43 5792
+43.485440 2762.43 5792
+43.497024 2762.43 5792
+43.508608 2762.43 5792
+43.520192 2762.43 5792
+43.531776 2762.43 5792
+43.543360 2762.43 5792
+43.554944 2762.43 5792
+43.566528 2762.43 5792
+43.578112 2762.43 5792
+43.589696 2762.43 5792
+43.601280 2762.43 5792
+43.612864 2762.43 5792
+43.624448 2762.43 5792
+43.636032 2762.43 5792
+43.647616 2762.43 5792
+43.659200 2762.43 5792
+43.670720 2777.78 5760
+43.682240 2777.78 5760
+43.693760 2777.78 5760
+43.705280 2777.78 5760
+43.716800 2777.78 5760
+43.728320 2777.78 5760
+43.739840 2777.78 5760
+43.751360 2777.78 5760
+43.762880 2777.78 5760
+43.774400 2777.78 5760
+43.785920 2777.78 5760
+43.797440 2777.78 5760
+43.808960 2777.78 5760
+43.820480 2777.78 5760
+43.832000 2777.78 5760
+43.843520 2777.78 5760
+43.854976 2793.30 5728
+43.866432 2793.30 5728
+43.877888 2793.30 5728
+43.889344 2793.30 5728
+43.900800 2793.30 5728
+43.912256 2793.30 5728
+43.923712 2793.30 5728
+43.935168 2793.30 5728
+43.946624 2793.30 5728
+43.958080 2793.30 5728
+43.969536 2793.30 5728
+43.980992 2793.30 5728
+43.992448 2793.30 5728
+44.003904 2793.30 5728
+44.015360 2793.30 5728
+44.026816 2793.30 5728
+44.038272 2793.30 5728
+44.049728 2793.30 5728
+44.061184 2793.30 5728
+44.072640 2793.30 5728
+44.084096 2793.30 5728
+44.095552 2793.30 5728
+44.107008 2793.30 5728
+44.118464 2793.30 5728
+44.129856 2808.99 5696
+44.141248 2808.99 5696
+44.152640 2808.99 5696
+44.164032 2808.99 5696
+44.175424 2808.99 5696
+44.186816 2808.99 5696
+44.198208 2808.99 5696
+44.209600 2808.99 5696
+44.220992 2808.99 5696
+44.232384 2808.99 5696
+44.243776 2808.99 5696
+44.255168 2808.99 5696
+44.266560 2808.99 5696
+44.277952 2808.99 5696
+44.289344 2808.99 5696
+44.300736 2808.99 5696
+44.312128 2808.99 5696
+44.323520 2808.99 5696
+44.334912 2808.99 5696
+44.346304 2808.99 5696
+44.357696 2808.99 5696
+44.369088 2808.99 5696
+44.380480 2808.99 5696
+44.391872 2808.99 5696
+44.403200 2824.86 5664
+44.414528 2824.86 5664
+44.425856 2824.86 5664
+44.437184 2824.86 5664
+44.448512 2824.86 5664
+44.459840 2824.86 5664
+44.471168 2824.86 5664
+44.482496 2824.86 5664
+44.493824 2824.86 5664
+44.505152 2824.86 5664
+44.516480 2824.86 5664
+44.527808 2824.86 5664
+44.539136 2824.86 5664
+44.550464 2824.86 5664
+44.561792 2824.86 5664
+44.573120 2824.86 5664
+44.584384 2840.91 5632
+44.595648 2840.91 5632
+44.606912 2840.91 5632
+44.618176 2840.91 5632
+44.629440 2840.91 5632
+44.640704 2840.91 5632
+44.651968 2840.91 5632
+44.663232 2840.91 5632
+44.674496 2840.91 5632
+44.685760 2840.91 5632
+44.697024 2840.91 5632
+44.708288 2840.91 5632
+44.719552 2840.91 5632
+44.730816 2840.91 5632
+44.742080 2840.91 5632
+44.753344 2840.91 5632
+44.764608 2840.91 5632
+44.775872 2840.91 5632
+44.787136 2840.91 5632
+44.798400 2840.91 5632
+44.809664 2840.91 5632
+44.820928 2840.91 5632
+44.832192 2840.91 5632
+44.843456 2840.91 5632
+44.854656 2857.14 5600
+44.865856 2857.14 5600
+44.877056 2857.14 5600
+44.888256 2857.14 5600
+44.899456 2857.14 5600
+44.910656 2857.14 5600
+44.921856 2857.14 5600
+44.933056 2857.14 5600
+44.944256 2857.14 5600
+44.955456 2857.14 5600
+44.966656 2857.14 5600
+44.977856 2857.14 5600
+44.989056 2857.14 5600
+45.000256 2857.14 5600
+45.011456 2857.14 5600
+45.022656 2857.14 5600
+45.033856 2857.14 5600
+45.045056 2857.14 5600
+45.056256 2857.14 5600
+45.067456 2857.14 5600
+45.078656 2857.14 5600
+45.089856 2857.14 5600
+45.101056 2857.14 5600
+45.112256 2857.14 5600
+45.123392 2873.56 5568
+45.134528 2873.56 5568
+45.145664 2873.56 5568
+45.156800 2873.56 5568
+45.167936 2873.56 5568
+45.179072 2873.56 5568
+45.190208 2873.56 5568
+45.201344 2873.56 5568
+45.212480 2873.56 5568
+45.223616 2873.56 5568
+45.234752 2873.56 5568
+45.245888 2873.56 5568
+45.257024 2873.56 5568
+45.268160 2873.56 5568
+45.279296 2873.56 5568
+45.290432 2873.56 5568
+45.301568 2873.56 5568
+45.312704 2873.56 5568
+45.323840 2873.56 5568
+45.334976 2873.56 5568
+45.346112 2873.56 5568
+45.357248 2873.56 5568
+45.368384 2873.56 5568
+45.379520 2873.56 5568
+45.390656 2873.56 5568
+45.401792 2873.56 5568
+45.412928 2873.56 5568
+45.424064 2873.56 5568
+45.435200 2873.56 5568
+45.446336 2873.56 5568
+45.457472 2873.56 5568
+45.468608 2873.56 5568
+45.479744 2873.56 5568
+45.490880 2873.56 5568
+45.502016 2873.56 5568
+45.513152 2873.56 5568
+45.524288 2873.56 5568
+45.535424 2873.56 5568
+45.546560 2873.56 5568
+45.557696 2873.56 5568
+45.568768 2890.17 5536
+45.579840 2890.17 5536
+45.590912 2890.17 5536
+45.601984 2890.17 5536
+45.613056 2890.17 5536
+45.624128 2890.17 5536
+45.635200 2890.17 5536
+45.646272 2890.17 5536
+45.657344 2890.17 5536
+45.668416 2890.17 5536
+45.679488 2890.17 5536
+45.690560 2890.17 5536
+45.701632 2890.17 5536
+45.712704 2890.17 5536
+45.723776 2890.17 5536
+45.734848 2890.17 5536
+45.745920 2890.17 5536
+45.756992 2890.17 5536
+45.768064 2890.17 5536
+45.779136 2890.17 5536
+45.790208 2890.17 5536
+45.801280 2890.17 5536
+45.812352 2890.17 5536
+45.823424 2890.17 5536
+45.834496 2890.17 5536
+45.845568 2890.17 5536
+45.856640 2890.17 5536
+45.867712 2890.17 5536
+45.878784 2890.17 5536
+45.889856 2890.17 5536
+45.900928 2890.17 5536
+45.912000 2890.17 5536
+45.923008 2906.98 5504
+45.934016 2906.98 5504
+45.945024 2906.98 5504
+45.956032 2906.98 5504
+45.967040 2906.98 5504
+45.978048 2906.98 5504
+45.989056 2906.98 5504
+46.000064 2906.98 5504
+46.011072 2906.98 5504
+46.022080 2906.98 5504
+46.033088 2906.98 5504
+46.044096 2906.98 5504
+46.055104 2906.98 5504
+46.066112 2906.98 5504
+46.077120 2906.98 5504
+46.088128 2906.98 5504
+46.099072 2923.98 5472
+46.110016 2923.98 5472
+46.120960 2923.98 5472
+46.131904 2923.98 5472
+46.142848 2923.98 5472
+46.153792 2923.98 5472
+46.164736 2923.98 5472
+46.175680 2923.98 5472
+46.186624 2923.98 5472
+46.197568 2923.98 5472
+46.208512 2923.98 5472
+46.219456 2923.98 5472
+46.230400 2923.98 5472
+46.241344 2923.98 5472
+46.252288 2923.98 5472
+46.263232 2923.98 5472
+46.274176 2923.98 5472
+46.285120 2923.98 5472
+46.296064 2923.98 5472
+46.307008 2923.98 5472
+46.317952 2923.98 5472
+46.328896 2923.98 5472
+46.339840 2923.98 5472
+46.350784 2923.98 5472
+46.361728 2923.98 5472
+46.372672 2923.98 5472
+46.383616 2923.98 5472
+46.394560 2923.98 5472
+46.405504 2923.98 5472
+46.416448 2923.98 5472
+46.427392 2923.98 5472
+46.438336 2923.98 5472
+46.449216 2941.18 5440
+46.460096 2941.18 5440
+46.470976 2941.18 5440
+46.481856 2941.18 5440
+46.492736 2941.18 5440
+46.503616 2941.18 5440
+46.514496 2941.18 5440
+46.525376 2941.18 5440
+46.536256 2941.18 5440
+46.547136 2941.18 5440
+46.558016 2941.18 5440
+46.568896 2941.18 5440
+46.579776 2941.18 5440
+46.590656 2941.18 5440
+46.601536 2941.18 5440
+46.612416 2941.18 5440
+46.623232 2958.58 5408
+46.634048 2958.58 5408
+46.644864 2958.58 5408
+46.655680 2958.58 5408
+46.666496 2958.58 5408
+46.677312 2958.58 5408
+46.688128 2958.58 5408
+46.698944 2958.58 5408
+46.709760 2958.58 5408
+46.720576 2958.58 5408
+46.731392 2958.58 5408
+46.742208 2958.58 5408
+46.753024 2958.58 5408
+46.763840 2958.58 5408
+46.774656 2958.58 5408
+46.785472 2958.58 5408
+46.796288 2958.58 5408
+46.807104 2958.58 5408
+46.817920 2958.58 5408
+46.828736 2958.58 5408
+46.839552 2958.58 5408
+46.850368 2958.58 5408
+46.861184 2958.58 5408
+46.872000 2958.58 5408
+46.882816 2958.58 5408
+46.893632 2958.58 5408
+46.904448 2958.58 5408
+46.915264 2958.58 5408
+46.926080 2958.58 5408
+46.936896 2958.58 5408
+46.947712 2958.58 5408
+46.958528 2958.58 5408
+46.969280 2976.19 5376
+46.980032 2976.19 5376
+46.990784 2976.19 5376
+47.001536 2976.19 5376
+47.012288 2976.19 5376
+47.023040 2976.19 5376
+47.033792 2976.19 5376
+47.044544 2976.19 5376
+47.055296 2976.19 5376
+47.066048 2976.19 5376
+47.076800 2976.19 5376
+47.087552 2976.19 5376
+47.098304 2976.19 5376
+47.109056 2976.19 5376
+47.119808 2976.19 5376
+47.130560 2976.19 5376
+47.141248 2994.01 5344
+47.151936 2994.01 5344
+47.162624 2994.01 5344
+47.173312 2994.01 5344
+47.184000 2994.01 5344
+47.194688 2994.01 5344
+47.205376 2994.01 5344
+47.216064 2994.01 5344
+47.226752 2994.01 5344
+47.237440 2994.01 5344
+47.248128 2994.01 5344
+47.258816 2994.01 5344
+47.269504 2994.01 5344
+47.280192 2994.01 5344
+47.290880 2994.01 5344
+47.301568 2994.01 5344
+47.312256 2994.01 5344
+47.322944 2994.01 5344
+47.333632 2994.01 5344
+47.344320 2994.01 5344
+47.355008 2994.01 5344
+47.365696 2994.01 5344
+47.376384 2994.01 5344
+47.387072 2994.01 5344
+47.397760 2994.01 5344
+47.408448 2994.01 5344
+47.419136 2994.01 5344
+47.429824 2994.01 5344
+47.440512 2994.01 5344
+47.451200 2994.01 5344
+47.461888 2994.01 5344
+47.472576 2994.01 5344
+47.483200 3012.05 5312
+47.499136 3012.05 5312
+47.515072 3012.05 5312
+47.531008 3012.05 5312
+47.546944 3012.05 5312
+47.562880 3012.05 5312
+47.578816 3012.05 5312
+47.594752 3012.05 5312
+47.610688 3012.05 5312
+47.626624 3012.05 5312
+47.642560 3012.05 5312
+47.658400 3030.30 5280
+47.674240 3030.30 5280
+47.690080 3030.30 5280
+47.705920 3030.30 5280
+47.721760 3030.30 5280
+47.737600 3030.30 5280
+47.753440 3030.30 5280
+47.769280 3030.30 5280
+47.785120 3030.30 5280
+47.800960 3030.30 5280
+47.816800 3030.30 5280
+47.832640 3030.30 5280
+47.848480 3030.30 5280
+47.864320 3030.30 5280
+47.880160 3030.30 5280
+47.896000 3030.30 5280
+47.911840 3030.30 5280
+47.927680 3030.30 5280
+47.943520 3030.30 5280
+47.959360 3030.30 5280
+47.975200 3030.30 5280
+47.990944 3048.78 5248
+48.006688 3048.78 5248
+48.022432 3048.78 5248
+48.038176 3048.78 5248
+48.053920 3048.78 5248
+48.069664 3048.78 5248
+48.085408 3048.78 5248
+48.101152 3048.78 5248
+48.116896 3048.78 5248
+48.132640 3048.78 5248
+48.148384 3048.78 5248
+48.164032 3067.48 5216
+48.179680 3067.48 5216
+48.195328 3067.48 5216
+48.210976 3067.48 5216
+48.226624 3067.48 5216
+48.242272 3067.48 5216
+48.257920 3067.48 5216
+48.273568 3067.48 5216
+48.289216 3067.48 5216
+48.304864 3067.48 5216
+48.320512 3067.48 5216
+48.336160 3067.48 5216
+48.351808 3067.48 5216
+48.367456 3067.48 5216
+48.383104 3067.48 5216
+48.398752 3067.48 5216
+48.414400 3067.48 5216
+48.430048 3067.48 5216
+48.445696 3067.48 5216
+48.461344 3067.48 5216
+48.476992 3067.48 5216
+48.492640 3067.48 5216
+48.508288 3067.48 5216
+48.523936 3067.48 5216
+48.539584 3067.48 5216
+48.555232 3067.48 5216
+48.570880 3067.48 5216
+48.586528 3067.48 5216
+48.602176 3067.48 5216
+48.617824 3067.48 5216
+48.633472 3067.48 5216
+48.649120 3067.48 5216
+48.664672 3086.42 5184
+48.680224 3086.42 5184
+48.695776 3086.42 5184
+48.711328 3086.42 5184
+48.726880 3086.42 5184
+48.742432 3086.42 5184
+48.757984 3086.42 5184
+48.773536 3086.42 5184
+48.789088 3086.42 5184
+48.804640 3086.42 5184
+48.820192 3086.42 5184
+48.835744 3086.42 5184
+48.851296 3086.42 5184
+48.866848 3086.42 5184
+48.882400 3086.42 5184
+48.897952 3086.42 5184
+48.913504 3086.42 5184
+48.929056 3086.42 5184
+48.944608 3086.42 5184
+48.960160 3086.42 5184
+48.975712 3086.42 5184
+48.991168 3105.59 5152
+49.006624 3105.59 5152
+49.022080 3105.59 5152
+49.037536 3105.59 5152
+49.052992 3105.59 5152
+49.068448 3105.59 5152
+49.083904 3105.59 5152
+49.099360 3105.59 5152
+49.114816 3105.59 5152
+49.130272 3105.59 5152
+49.145728 3105.59 5152
+49.161184 3105.59 5152
+49.176640 3105.59 5152
+49.192096 3105.59 5152
+49.207552 3105.59 5152
+49.223008 3105.59 5152
+49.238464 3105.59 5152
+49.253920 3105.59 5152
+49.269376 3105.59 5152
+49.284832 3105.59 5152
+49.300288 3105.59 5152
+49.315744 3105.59 5152
+49.331104 3125.00 5120
+49.346464 3125.00 5120
+49.361824 3125.00 5120
+49.377184 3125.00 5120
+49.392544 3125.00 5120
+49.407904 3125.00 5120
+49.423264 3125.00 5120
+49.438624 3125.00 5120
+49.453984 3125.00 5120
+49.469344 3125.00 5120
+49.484608 3144.65 5088
+49.499872 3144.65 5088
+49.515136 3144.65 5088
+49.530400 3144.65 5088
+49.545664 3144.65 5088
+49.560928 3144.65 5088
+49.576192 3144.65 5088
+49.591456 3144.65 5088
+49.606720 3144.65 5088
+49.621984 3144.65 5088
+49.637248 3144.65 5088
+49.652512 3144.65 5088
+49.667776 3144.65 5088
+49.683040 3144.65 5088
+49.698304 3144.65 5088
+49.713568 3144.65 5088
+49.728832 3144.65 5088
+49.744096 3144.65 5088
+49.759360 3144.65 5088
+49.774624 3144.65 5088
+49.789888 3144.65 5088
+49.805152 3144.65 5088
+49.820320 3164.56 5056
+49.835488 3164.56 5056
+49.850656 3164.56 5056
+49.865824 3164.56 5056
+49.880992 3164.56 5056
+49.896160 3164.56 5056
+49.911328 3164.56 5056
+49.926496 3164.56 5056
+49.941664 3164.56 5056
+49.956832 3164.56 5056
+49.972000 3164.56 5056
+49.987168 3164.56 5056
+50.002336 3164.56 5056
+50.017504 3164.56 5056
+50.032672 3164.56 5056
+50.047840 3164.56 5056
+50.063008 3164.56 5056
+50.078176 3164.56 5056
+50.093344 3164.56 5056
+50.108512 3164.56 5056
+50.123680 3164.56 5056
+50.138752 3184.71 5024
+50.153824 3184.71 5024
+50.168896 3184.71 5024
+50.183968 3184.71 5024
+50.199040 3184.71 5024
+50.214112 3184.71 5024
+50.229184 3184.71 5024
+50.244256 3184.71 5024
+50.259328 3184.71 5024
+50.274400 3184.71 5024
+50.289472 3184.71 5024
+50.304544 3184.71 5024
+50.319616 3184.71 5024
+50.334688 3184.71 5024
+50.349760 3184.71 5024
+50.364832 3184.71 5024
+50.379904 3184.71 5024
+50.394976 3184.71 5024
+50.410048 3184.71 5024
+50.425120 3184.71 5024
+50.440192 3184.71 5024
+50.455264 3184.71 5024
+50.470336 3184.71 5024
+50.485408 3184.71 5024
+50.500480 3184.71 5024
+50.515552 3184.71 5024
+50.530624 3184.71 5024
+50.545696 3184.71 5024
+50.560768 3184.71 5024
+50.575840 3184.71 5024
+50.590912 3184.71 5024
+50.605984 3184.71 5024
+50.620960 3205.13 4992
+50.635936 3205.13 4992
+50.650912 3205.13 4992
+50.665888 3205.13 4992
+50.680864 3205.13 4992
+50.695840 3205.13 4992
+50.710816 3205.13 4992
+50.725792 3205.13 4992
+50.740768 3205.13 4992
+50.755744 3205.13 4992
+50.770720 3205.13 4992
+50.785696 3205.13 4992
+50.800672 3205.13 4992
+50.815648 3205.13 4992
+50.830624 3205.13 4992
+50.845600 3205.13 4992
+50.860576 3205.13 4992
+50.875552 3205.13 4992
+50.890528 3205.13 4992
+50.905504 3205.13 4992
+50.920480 3205.13 4992
+50.935360 3225.81 4960
+50.950240 3225.81 4960
+50.965120 3225.81 4960
+50.980000 3225.81 4960
+50.994880 3225.81 4960
+51.009760 3225.81 4960
+51.024640 3225.81 4960
+51.039520 3225.81 4960
+51.054400 3225.81 4960
+51.069280 3225.81 4960
+51.084160 3225.81 4960
+51.099040 3225.81 4960
+51.113920 3225.81 4960
+51.128800 3225.81 4960
+51.143680 3225.81 4960
+51.158560 3225.81 4960
+51.173440 3225.81 4960
+51.188320 3225.81 4960
+51.203200 3225.81 4960
+51.218080 3225.81 4960
+51.232960 3225.81 4960
+51.247840 3225.81 4960
+51.262624 3246.75 4928
+51.277408 3246.75 4928
+51.292192 3246.75 4928
+51.306976 3246.75 4928
+51.321760 3246.75 4928
+51.336544 3246.75 4928
+51.351328 3246.75 4928
+51.366112 3246.75 4928
+51.380896 3246.75 4928
+51.395680 3246.75 4928
+51.410368 3267.97 4896
+51.425056 3267.97 4896
+51.439744 3267.97 4896
+51.454432 3267.97 4896
+51.469120 3267.97 4896
+51.483808 3267.97 4896
+51.498496 3267.97 4896
+51.513184 3267.97 4896
+51.527872 3267.97 4896
+51.542560 3267.97 4896
+51.557248 3267.97 4896
+51.571936 3267.97 4896
+51.586624 3267.97 4896
+51.601312 3267.97 4896
+51.616000 3267.97 4896
+51.630688 3267.97 4896
+51.645376 3267.97 4896
+51.660064 3267.97 4896
+51.674752 3267.97 4896
+51.689440 3267.97 4896
+51.704128 3267.97 4896
+51.718816 3267.97 4896
+51.733408 3289.47 4864
+51.748000 3289.47 4864
+51.762592 3289.47 4864
+51.777184 3289.47 4864
+51.791776 3289.47 4864
+51.806368 3289.47 4864
+51.820960 3289.47 4864
+51.835552 3289.47 4864
+51.850144 3289.47 4864
+51.864736 3289.47 4864
+51.879328 3289.47 4864
+51.893920 3289.47 4864
+51.908512 3289.47 4864
+51.923104 3289.47 4864
+51.937696 3289.47 4864
+51.952288 3289.47 4864
+51.966880 3289.47 4864
+51.981472 3289.47 4864
+51.996064 3289.47 4864
+52.010656 3289.47 4864
+52.025248 3289.47 4864
+52.039840 3289.47 4864
+52.054432 3289.47 4864
+52.069024 3289.47 4864
+52.083616 3289.47 4864
+52.098208 3289.47 4864
+52.112800 3289.47 4864
+52.127392 3289.47 4864
+52.141984 3289.47 4864
+52.156576 3289.47 4864
+52.171168 3289.47 4864
+52.185760 3289.47 4864
+52.200352 3289.47 4864
+52.214944 3289.47 4864
+52.229536 3289.47 4864
+52.244128 3289.47 4864
+52.258720 3289.47 4864
+52.273312 3289.47 4864
+52.287904 3289.47 4864
+52.302496 3289.47 4864
+52.317088 3289.47 4864
+52.331680 3289.47 4864
+52.346176 3311.26 4832
+52.360672 3311.26 4832
+52.375168 3311.26 4832
+52.389664 3311.26 4832
+52.404160 3311.26 4832
+52.418656 3311.26 4832
+52.433152 3311.26 4832
+52.447648 3311.26 4832
+52.462144 3311.26 4832
+52.476640 3311.26 4832
+52.491136 3311.26 4832
+52.505632 3311.26 4832
+52.520128 3311.26 4832
+52.534624 3311.26 4832
+52.549120 3311.26 4832
+52.563616 3311.26 4832
+52.578112 3311.26 4832
+52.592608 3311.26 4832
+52.607104 3311.26 4832
+52.621600 3311.26 4832
+52.636096 3311.26 4832
+52.650592 3311.26 4832
+52.664992 3333.33 4800
+52.679392 3333.33 4800
+52.693792 3333.33 4800
+52.708192 3333.33 4800
+52.722592 3333.33 4800
+52.736992 3333.33 4800
+52.751392 3333.33 4800
+52.765792 3333.33 4800
+52.780192 3333.33 4800
+52.794592 3333.33 4800
+52.808992 3333.33 4800
+52.823392 3333.33 4800
+52.837792 3333.33 4800
+52.852192 3333.33 4800
+52.866592 3333.33 4800
+52.880992 3333.33 4800
+52.895392 3333.33 4800
+52.909792 3333.33 4800
+52.924192 3333.33 4800
+52.938592 3333.33 4800
+52.952992 3333.33 4800
+52.967296 3355.70 4768
+52.981600 3355.70 4768
+52.995904 3355.70 4768
+53.010208 3355.70 4768
+53.024512 3355.70 4768
+53.038816 3355.70 4768
+53.053120 3355.70 4768
+53.067424 3355.70 4768
+53.081728 3355.70 4768
+53.096032 3355.70 4768
+53.110336 3355.70 4768
+53.124544 3378.38 4736
+53.138752 3378.38 4736
+53.152960 3378.38 4736
+53.167168 3378.38 4736
+53.181376 3378.38 4736
+53.195584 3378.38 4736
+53.209792 3378.38 4736
+53.224000 3378.38 4736
+53.238208 3378.38 4736
+53.252416 3378.38 4736
+53.266624 3378.38 4736
+53.280832 3378.38 4736
+53.295040 3378.38 4736
+53.309248 3378.38 4736
+53.323456 3378.38 4736
+53.337664 3378.38 4736
+53.351872 3378.38 4736
+53.366080 3378.38 4736
+53.380288 3378.38 4736
+53.394496 3378.38 4736
+53.408704 3378.38 4736
+53.422816 3401.36 4704
+53.436928 3401.36 4704
+53.451040 3401.36 4704
+53.465152 3401.36 4704
+53.479264 3401.36 4704
+53.493376 3401.36 4704
+53.507488 3401.36 4704
+53.521600 3401.36 4704
+53.535712 3401.36 4704
+53.549824 3401.36 4704
+53.563936 3401.36 4704
+53.578048 3401.36 4704
+53.592160 3401.36 4704
+53.606272 3401.36 4704
+53.620384 3401.36 4704
+53.634496 3401.36 4704
+53.648608 3401.36 4704
+53.662720 3401.36 4704
+53.676832 3401.36 4704
+53.690944 3401.36 4704
+53.705056 3401.36 4704
+53.719168 3401.36 4704
+53.733280 3401.36 4704
+53.747392 3401.36 4704
+53.761504 3401.36 4704
+53.775616 3401.36 4704
+53.789728 3401.36 4704
+53.803840 3401.36 4704
+53.817952 3401.36 4704
+53.832064 3401.36 4704
+53.846176 3401.36 4704
+53.860288 3401.36 4704
+53.874400 3401.36 4704
+53.888512 3401.36 4704
+53.902624 3401.36 4704
+53.916736 3401.36 4704
+53.930848 3401.36 4704
+53.944960 3401.36 4704
+53.959072 3401.36 4704
+53.973184 3401.36 4704
+53.987296 3401.36 4704
+54.001408 3401.36 4704
+54.015520 3401.36 4704
+54.029536 3424.66 4672
+54.043552 3424.66 4672
+54.057568 3424.66 4672
+54.071584 3424.66 4672
+54.085600 3424.66 4672
+54.099616 3424.66 4672
+54.113632 3424.66 4672
+54.127648 3424.66 4672
+54.141664 3424.66 4672
+54.155680 3424.66 4672
+54.169696 3424.66 4672
+54.183712 3424.66 4672
+54.197728 3424.66 4672
+54.211744 3424.66 4672
+54.225760 3424.66 4672
+54.239776 3424.66 4672
+54.253792 3424.66 4672
+54.267808 3424.66 4672
+54.281824 3424.66 4672
+54.295840 3424.66 4672
+54.309856 3424.66 4672
+54.323776 3448.28 4640
+54.337696 3448.28 4640
+54.351616 3448.28 4640
+54.365536 3448.28 4640
+54.379456 3448.28 4640
+54.393376 3448.28 4640
+54.407296 3448.28 4640
+54.421216 3448.28 4640
+54.435136 3448.28 4640
+54.449056 3448.28 4640
+54.462976 3448.28 4640
+54.476896 3448.28 4640
+54.490816 3448.28 4640
+54.504736 3448.28 4640
+54.518656 3448.28 4640
+54.532576 3448.28 4640
+54.546496 3448.28 4640
+54.560416 3448.28 4640
+54.574336 3448.28 4640
+54.588256 3448.28 4640
+54.602176 3448.28 4640
+54.616000 3472.22 4608
+54.629824 3472.22 4608
+54.643648 3472.22 4608
+54.657472 3472.22 4608
+54.671296 3472.22 4608
+54.685120 3472.22 4608
+54.698944 3472.22 4608
+54.712768 3472.22 4608
+54.726592 3472.22 4608
+54.740416 3472.22 4608
+54.754240 3472.22 4608
+54.768064 3472.22 4608
+54.781888 3472.22 4608
+54.795712 3472.22 4608
+54.809536 3472.22 4608
+54.823360 3472.22 4608
+54.837184 3472.22 4608
+54.851008 3472.22 4608
+54.864832 3472.22 4608
+54.878656 3472.22 4608
+54.892480 3472.22 4608
+54.906304 3472.22 4608
+54.920128 3472.22 4608
+54.933952 3472.22 4608
+54.947776 3472.22 4608
+54.961600 3472.22 4608
+54.975424 3472.22 4608
+54.989248 3472.22 4608
+55.003072 3472.22 4608
+55.016896 3472.22 4608
+55.030720 3472.22 4608
+55.044544 3472.22 4608
+55.058368 3472.22 4608
+55.072192 3472.22 4608
+55.086016 3472.22 4608
+55.099840 3472.22 4608
+55.113664 3472.22 4608
+55.127488 3472.22 4608
+55.141312 3472.22 4608
+55.155136 3472.22 4608
+55.168960 3472.22 4608
+55.182784 3472.22 4608
+55.196608 3472.22 4608
+55.210336 3496.50 4576
+55.224064 3496.50 4576
+55.237792 3496.50 4576
+55.251520 3496.50 4576
+55.265248 3496.50 4576
+55.278976 3496.50 4576
+55.292704 3496.50 4576
+55.306432 3496.50 4576
+55.320160 3496.50 4576
+55.333888 3496.50 4576
+55.347616 3496.50 4576
+55.361344 3496.50 4576
+55.375072 3496.50 4576
+55.388800 3496.50 4576
+55.402528 3496.50 4576
+55.416256 3496.50 4576
+55.429984 3496.50 4576
+55.443712 3496.50 4576
+55.457440 3496.50 4576
+55.471168 3496.50 4576
+55.484896 3496.50 4576
+55.498528 3521.13 4544
+55.512160 3521.13 4544
+55.525792 3521.13 4544
+55.539424 3521.13 4544
+55.553056 3521.13 4544
+55.566688 3521.13 4544
+55.580320 3521.13 4544
+55.593952 3521.13 4544
+55.607584 3521.13 4544
+55.621216 3521.13 4544
+55.634848 3521.13 4544
+55.648480 3521.13 4544
+55.662112 3521.13 4544
+55.675744 3521.13 4544
+55.689376 3521.13 4544
+55.703008 3521.13 4544
+55.716640 3521.13 4544
+55.730272 3521.13 4544
+55.743904 3521.13 4544
+55.757536 3521.13 4544
+55.771168 3521.13 4544
+55.784800 3521.13 4544
+55.798336 3546.10 4512
+55.811872 3546.10 4512
+55.825408 3546.10 4512
+55.838944 3546.10 4512
+55.852480 3546.10 4512
+55.866016 3546.10 4512
+55.879552 3546.10 4512
+55.893088 3546.10 4512
+55.906624 3546.10 4512
+55.920160 3546.10 4512
+55.933696 3546.10 4512
+55.947232 3546.10 4512
+55.960768 3546.10 4512
+55.974304 3546.10 4512
+55.987840 3546.10 4512
+56.001376 3546.10 4512
+56.014912 3546.10 4512
+56.028448 3546.10 4512
+56.041984 3546.10 4512
+56.055520 3546.10 4512
+56.069056 3546.10 4512
+56.082592 3546.10 4512
+56.096128 3546.10 4512
+56.109664 3546.10 4512
+56.123200 3546.10 4512
+56.136736 3546.10 4512
+56.150272 3546.10 4512
+56.163808 3546.10 4512
+56.177344 3546.10 4512
+56.190880 3546.10 4512
+56.204416 3546.10 4512
+56.217952 3546.10 4512
+56.231392 3571.43 4480
+56.244832 3571.43 4480
+56.258272 3571.43 4480
+56.271712 3571.43 4480
+56.285152 3571.43 4480
+56.298592 3571.43 4480
+56.312032 3571.43 4480
+56.325472 3571.43 4480
+56.338912 3571.43 4480
+56.352352 3571.43 4480
+56.365792 3571.43 4480
+56.379232 3571.43 4480
+56.392672 3571.43 4480
+56.406112 3571.43 4480
+56.419552 3571.43 4480
+56.432992 3571.43 4480
+56.446432 3571.43 4480
+56.459872 3571.43 4480
+56.473312 3571.43 4480
+56.486752 3571.43 4480
+56.500192 3571.43 4480
+56.513632 3571.43 4480
+56.527072 3571.43 4480
+56.540512 3571.43 4480
+56.553952 3571.43 4480
+56.567392 3571.43 4480
+56.580832 3571.43 4480
+56.594272 3571.43 4480
+56.607712 3571.43 4480
+56.621152 3571.43 4480
+56.634592 3571.43 4480
+56.648032 3571.43 4480
+56.661472 3571.43 4480
+56.674912 3571.43 4480
+56.688352 3571.43 4480
+56.701792 3571.43 4480
+56.715232 3571.43 4480
+56.728672 3571.43 4480
+56.742112 3571.43 4480
+56.755552 3571.43 4480
+56.768992 3571.43 4480
+56.782432 3571.43 4480
+56.795776 3597.12 4448
+56.809120 3597.12 4448
+56.822464 3597.12 4448
+56.835808 3597.12 4448
+56.849152 3597.12 4448
+56.862496 3597.12 4448
+56.875840 3597.12 4448
+56.889184 3597.12 4448
+56.902528 3597.12 4448
+56.915872 3597.12 4448
+56.929216 3597.12 4448
+56.942560 3597.12 4448
+56.955904 3597.12 4448
+56.969248 3597.12 4448
+56.982592 3597.12 4448
+56.995936 3597.12 4448
+57.009280 3597.12 4448
+57.022624 3597.12 4448
+57.035968 3597.12 4448
+57.049312 3597.12 4448
+57.062656 3597.12 4448
+57.076000 3597.12 4448
+57.089248 3623.19 4416
+57.102496 3623.19 4416
+57.115744 3623.19 4416
+57.128992 3623.19 4416
+57.142240 3623.19 4416
+57.155488 3623.19 4416
+57.168736 3623.19 4416
+57.181984 3623.19 4416
+57.195232 3623.19 4416
+57.208480 3623.19 4416
+57.221728 3623.19 4416
+57.234976 3623.19 4416
+57.248224 3623.19 4416
+57.261472 3623.19 4416
+57.274720 3623.19 4416
+57.287968 3623.19 4416
+57.301216 3623.19 4416
+57.314464 3623.19 4416
+57.327712 3623.19 4416
+57.340960 3623.19 4416
+57.354208 3623.19 4416
+57.367360 3649.64 4384
+57.380512 3649.64 4384
+57.393664 3649.64 4384
+57.406816 3649.64 4384
+57.419968 3649.64 4384
+57.433120 3649.64 4384
+57.446272 3649.64 4384
+57.459424 3649.64 4384
+57.472576 3649.64 4384
+57.485728 3649.64 4384
+57.498880 3649.64 4384
+57.512032 3649.64 4384
+57.525184 3649.64 4384
+57.538336 3649.64 4384
+57.551488 3649.64 4384
+57.564640 3649.64 4384
+57.577792 3649.64 4384
+57.590944 3649.64 4384
+57.604096 3649.64 4384
+57.617248 3649.64 4384
+57.630400 3649.64 4384
+57.643552 3649.64 4384
+57.656704 3649.64 4384
+57.669856 3649.64 4384
+57.683008 3649.64 4384
+57.696160 3649.64 4384
+57.709312 3649.64 4384
+57.722464 3649.64 4384
+57.735616 3649.64 4384
+57.748768 3649.64 4384
+57.761920 3649.64 4384
+57.775072 3649.64 4384
+57.788224 3649.64 4384
+57.801376 3649.64 4384
+57.814528 3649.64 4384
+57.827680 3649.64 4384
+57.840832 3649.64 4384
+57.853984 3649.64 4384
+57.867136 3649.64 4384
+57.880288 3649.64 4384
+57.893440 3649.64 4384
+57.906592 3649.64 4384
+57.919744 3649.64 4384
+57.932896 3649.64 4384
+57.946048 3649.64 4384
+57.959200 3649.64 4384
+57.972352 3649.64 4384
+57.985504 3649.64 4384
+57.998656 3649.64 4384
+58.011808 3649.64 4384
+58.024960 3649.64 4384
+58.038112 3649.64 4384
+58.051264 3649.64 4384
+58.064320 3676.47 4352
+58.077376 3676.47 4352
+58.090432 3676.47 4352
+58.103488 3676.47 4352
+58.116544 3676.47 4352
+58.129600 3676.47 4352
+58.142656 3676.47 4352
+58.155712 3676.47 4352
+58.168768 3676.47 4352
+58.181824 3676.47 4352
+58.194880 3676.47 4352
+58.207936 3676.47 4352
+58.220992 3676.47 4352
+58.234048 3676.47 4352
+58.247104 3676.47 4352
+58.260160 3676.47 4352
+58.273216 3676.47 4352
+58.286272 3676.47 4352
+58.299328 3676.47 4352
+58.312384 3676.47 4352
+58.325440 3676.47 4352
+58.338496 3676.47 4352
+58.351456 3703.70 4320
+58.364416 3703.70 4320
+58.377376 3703.70 4320
+58.390336 3703.70 4320
+58.403296 3703.70 4320
+58.416256 3703.70 4320
+58.429216 3703.70 4320
+58.442176 3703.70 4320
+58.455136 3703.70 4320
+58.468096 3703.70 4320
+58.481056 3703.70 4320
+58.494016 3703.70 4320
+58.506976 3703.70 4320
+58.519936 3703.70 4320
+58.532896 3703.70 4320
+58.545856 3703.70 4320
+58.558816 3703.70 4320
+58.571776 3703.70 4320
+58.584736 3703.70 4320
+58.597696 3703.70 4320
+58.610656 3703.70 4320
+58.623616 3703.70 4320
+58.636576 3703.70 4320
+58.649536 3703.70 4320
+58.662496 3703.70 4320
+58.675456 3703.70 4320
+58.688416 3703.70 4320
+58.701376 3703.70 4320
+58.714336 3703.70 4320
+58.727296 3703.70 4320
+58.740256 3703.70 4320
+58.753216 3703.70 4320
+58.766176 3703.70 4320
+58.779136 3703.70 4320
+58.792096 3703.70 4320
+58.805056 3703.70 4320
+58.818016 3703.70 4320
+58.830976 3703.70 4320
+58.843936 3703.70 4320
+58.856896 3703.70 4320
+58.869856 3703.70 4320
+58.882816 3703.70 4320
+58.895776 3703.70 4320
+58.908736 3703.70 4320
+58.921696 3703.70 4320
+58.934656 3703.70 4320
+58.947616 3703.70 4320
+58.960576 3703.70 4320
+58.973536 3703.70 4320
+58.986496 3703.70 4320
+58.999456 3703.70 4320
+59.012416 3703.70 4320
+59.025376 3703.70 4320
+59.038240 3731.34 4288
+59.051104 3731.34 4288
+59.063968 3731.34 4288
+59.076832 3731.34 4288
+59.089696 3731.34 4288
+59.102560 3731.34 4288
+59.115424 3731.34 4288
+59.128288 3731.34 4288
+59.141152 3731.34 4288
+59.154016 3731.34 4288
+59.166880 3731.34 4288
+59.179744 3731.34 4288
+59.192608 3731.34 4288
+59.205472 3731.34 4288
+59.218336 3731.34 4288
+59.231200 3731.34 4288
+59.244064 3731.34 4288
+59.256928 3731.34 4288
+59.269792 3731.34 4288
+59.282656 3731.34 4288
+59.295520 3731.34 4288
+59.308288 3759.40 4256
+59.321056 3759.40 4256
+59.333824 3759.40 4256
+59.346592 3759.40 4256
+59.359360 3759.40 4256
+59.372128 3759.40 4256
+59.384896 3759.40 4256
+59.397664 3759.40 4256
+59.410432 3759.40 4256
+59.423200 3759.40 4256
+59.435968 3759.40 4256
+59.448736 3759.40 4256
+59.461504 3759.40 4256
+59.474272 3759.40 4256
+59.487040 3759.40 4256
+59.499808 3759.40 4256
+59.512576 3759.40 4256
+59.525344 3759.40 4256
+59.538112 3759.40 4256
+59.550880 3759.40 4256
+59.563648 3759.40 4256
+59.576416 3759.40 4256
+59.589088 3787.88 4224
+59.601760 3787.88 4224
+59.614432 3787.88 4224
+59.627104 3787.88 4224
+59.639776 3787.88 4224
+59.652448 3787.88 4224
+59.665120 3787.88 4224
+59.677792 3787.88 4224
+59.690464 3787.88 4224
+59.703136 3787.88 4224
+59.715808 3787.88 4224
+59.728480 3787.88 4224
+59.741152 3787.88 4224
+59.753824 3787.88 4224
+59.766496 3787.88 4224
+59.779168 3787.88 4224
+59.791840 3787.88 4224
+59.804512 3787.88 4224
+59.817184 3787.88 4224
+59.829856 3787.88 4224
+59.842528 3787.88 4224
+59.855200 3787.88 4224
+59.867872 3787.88 4224
+59.880544 3787.88 4224
+59.893216 3787.88 4224
+59.905888 3787.88 4224
+59.918560 3787.88 4224
+59.931232 3787.88 4224
+59.943904 3787.88 4224
+59.956576 3787.88 4224
+59.969248 3787.88 4224
+59.981920 3787.88 4224
+59.994592 3787.88 4224
+60.007264 3787.88 4224
+60.019936 3787.88 4224
+60.032608 3787.88 4224
+60.045280 3787.88 4224
+60.057952 3787.88 4224
+60.070624 3787.88 4224
+60.083296 3787.88 4224
+60.095968 3787.88 4224
+60.108640 3787.88 4224
+60.121312 3787.88 4224
+60.133984 3787.88 4224
+60.146656 3787.88 4224
+60.159328 3787.88 4224
+60.172000 3787.88 4224
+60.184672 3787.88 4224
+60.197344 3787.88 4224
+60.210016 3787.88 4224
+60.222688 3787.88 4224
+60.235360 3787.88 4224
+60.248032 3787.88 4224
+60.260608 3816.79 4192
+60.273184 3816.79 4192
+60.285760 3816.79 4192
+60.298336 3816.79 4192
+60.310912 3816.79 4192
+60.323488 3816.79 4192
+60.336064 3816.79 4192
+60.348640 3816.79 4192
+60.361216 3816.79 4192
+60.373792 3816.79 4192
+60.386368 3816.79 4192
+60.398944 3816.79 4192
+60.411520 3816.79 4192
+60.424096 3816.79 4192
+60.436672 3816.79 4192
+60.449248 3816.79 4192
+60.461824 3816.79 4192
+60.474400 3816.79 4192
+60.486976 3816.79 4192
+60.499552 3816.79 4192
+60.512128 3816.79 4192
+60.524704 3816.79 4192
+60.537280 3816.79 4192
+60.549856 3816.79 4192
+60.562432 3816.79 4192
+60.575008 3816.79 4192
+60.587584 3816.79 4192
+60.600160 3816.79 4192
+60.612736 3816.79 4192
+60.625312 3816.79 4192
+60.637888 3816.79 4192
+60.650464 3816.79 4192
+60.662944 3846.15 4160
+60.675424 3846.15 4160
+60.687904 3846.15 4160
+60.700384 3846.15 4160
+60.712864 3846.15 4160
+60.725344 3846.15 4160
+60.737824 3846.15 4160
+60.750304 3846.15 4160
+60.762784 3846.15 4160
+60.775264 3846.15 4160
+60.787744 3846.15 4160
+60.800224 3846.15 4160
+60.812704 3846.15 4160
+60.825184 3846.15 4160
+60.837664 3846.15 4160
+60.850144 3846.15 4160
+60.862624 3846.15 4160
+60.875104 3846.15 4160
+60.887584 3846.15 4160
+60.900064 3846.15 4160
+60.912544 3846.15 4160
+60.924928 3875.97 4128
+60.937312 3875.97 4128
+60.949696 3875.97 4128
+60.962080 3875.97 4128
+60.974464 3875.97 4128
+60.986848 3875.97 4128
+60.999232 3875.97 4128
+61.011616 3875.97 4128
+61.024000 3875.97 4128
+61.036384 3875.97 4128
+61.048768 3875.97 4128
+61.061152 3875.97 4128
+61.073536 3875.97 4128
+61.085920 3875.97 4128
+61.098304 3875.97 4128
+61.110688 3875.97 4128
+61.123072 3875.97 4128
+61.135456 3875.97 4128
+61.147840 3875.97 4128
+61.160224 3875.97 4128
+61.172608 3875.97 4128
+61.184992 3875.97 4128
+61.197376 3875.97 4128
+61.209760 3875.97 4128
+61.222144 3875.97 4128
+61.234528 3875.97 4128
+61.246912 3875.97 4128
+61.259296 3875.97 4128
+61.271680 3875.97 4128
+61.284064 3875.97 4128
+61.296448 3875.97 4128
+61.308832 3875.97 4128
+61.321216 3875.97 4128
+61.333600 3875.97 4128
+61.345984 3875.97 4128
+61.358368 3875.97 4128
+61.370752 3875.97 4128
+61.383136 3875.97 4128
+61.395520 3875.97 4128
+61.407904 3875.97 4128
+61.420288 3875.97 4128
+61.432672 3875.97 4128
+61.445056 3875.97 4128
+61.457440 3875.97 4128
+61.469824 3875.97 4128
+61.482208 3875.97 4128
+61.494592 3875.97 4128
+61.506976 3875.97 4128
+61.519360 3875.97 4128
+61.531744 3875.97 4128
+61.544128 3875.97 4128
+61.556512 3875.97 4128
+61.568896 3875.97 4128
+61.581280 3875.97 4128
+61.593568 3906.25 4096
+61.605856 3906.25 4096
+61.618144 3906.25 4096
+61.630432 3906.25 4096
+61.642720 3906.25 4096
+61.655008 3906.25 4096
+61.667296 3906.25 4096
+61.679584 3906.25 4096
+61.691872 3906.25 4096
+61.704160 3906.25 4096
+61.716448 3906.25 4096
+61.728736 3906.25 4096
+61.741024 3906.25 4096
+61.753312 3906.25 4096
+61.765600 3906.25 4096
+61.777888 3906.25 4096
+61.790176 3906.25 4096
+61.802464 3906.25 4096
+61.814752 3906.25 4096
+61.827040 3906.25 4096
+61.839328 3906.25 4096
+61.851616 3906.25 4096
+61.863904 3906.25 4096
+61.876192 3906.25 4096
+61.888480 3906.25 4096
+61.900768 3906.25 4096
+61.913056 3906.25 4096
+61.925344 3906.25 4096
+61.937632 3906.25 4096
+61.949920 3906.25 4096
+61.962208 3906.25 4096
+61.974496 3906.25 4096
+61.986736 3921.57 4080
+61.998976 3921.57 4080
+62.011216 3921.57 4080
+62.023456 3921.57 4080
+62.035696 3921.57 4080
+62.047936 3921.57 4080
+62.060176 3921.57 4080
+62.072416 3921.57 4080
+62.084656 3921.57 4080
+62.096896 3921.57 4080
+62.109136 3921.57 4080
+62.121376 3921.57 4080
+62.133616 3921.57 4080
+62.145856 3921.57 4080
+62.158096 3921.57 4080
+62.170336 3921.57 4080
+62.182576 3921.57 4080
+62.194816 3921.57 4080
+62.207056 3921.57 4080
+62.219296 3921.57 4080
+62.231536 3921.57 4080
+62.243728 3937.01 4064
+62.255920 3937.01 4064
+62.268112 3937.01 4064
+62.280304 3937.01 4064
+62.292496 3937.01 4064
+62.304688 3937.01 4064
+62.316880 3937.01 4064
+62.329072 3937.01 4064
+62.341264 3937.01 4064
+62.353456 3937.01 4064
+62.365648 3937.01 4064
+62.377840 3937.01 4064
+62.390032 3937.01 4064
+62.402224 3937.01 4064
+62.414416 3937.01 4064
+62.426608 3937.01 4064
+62.438800 3937.01 4064
+62.450992 3937.01 4064
+62.463184 3937.01 4064
+62.475376 3937.01 4064
+62.487568 3937.01 4064
+62.499760 3937.01 4064
+62.511952 3937.01 4064
+62.524144 3937.01 4064
+62.536336 3937.01 4064
+62.548528 3937.01 4064
+62.560720 3937.01 4064
+62.572912 3937.01 4064
+62.585104 3937.01 4064
+62.597296 3937.01 4064
+62.609488 3937.01 4064
+62.621680 3937.01 4064
+62.633776 3968.25 4032
+62.645872 3968.25 4032
+62.657968 3968.25 4032
+62.670064 3968.25 4032
+62.682160 3968.25 4032
+62.694256 3968.25 4032
+62.706352 3968.25 4032
+62.718448 3968.25 4032
+62.730544 3968.25 4032
+62.742640 3968.25 4032
+62.754736 3968.25 4032
+62.766832 3968.25 4032
+62.778928 3968.25 4032
+62.791024 3968.25 4032
+62.803120 3968.25 4032
+62.815216 3968.25 4032
+62.827312 3968.25 4032
+62.839408 3968.25 4032
+62.851504 3968.25 4032
+62.863600 3968.25 4032
+62.875696 3968.25 4032
+62.887792 3968.25 4032
+62.899888 3968.25 4032
+62.911984 3968.25 4032
+62.924080 3968.25 4032
+62.936176 3968.25 4032
+62.948272 3968.25 4032
+62.960368 3968.25 4032
+62.972464 3968.25 4032
+62.984560 3968.25 4032
+62.996656 3968.25 4032
+63.008752 3968.25 4032
+63.020800 3984.06 4016
+63.032848 3984.06 4016
+63.044896 3984.06 4016
+63.056944 3984.06 4016
+63.068992 3984.06 4016
+63.081040 3984.06 4016
+63.093088 3984.06 4016
+63.105136 3984.06 4016
+63.117184 3984.06 4016
+63.129232 3984.06 4016
+63.141280 3984.06 4016
+63.153328 3984.06 4016
+63.165376 3984.06 4016
+63.177424 3984.06 4016
+63.189472 3984.06 4016
+63.201520 3984.06 4016
+63.213568 3984.06 4016
+63.225616 3984.06 4016
+63.237664 3984.06 4016
+63.249712 3984.06 4016
+63.261760 3984.06 4016
+63.273760 4000.00 4000
+63.433760 4000.00 4000
+63.593760 4000.00 4000
+63.753760 4000.00 4000
+63.913760 4000.00 4000
+64.073760 4000.00 4000
+64.233760 4000.00 4000
+64.393760 4000.00 4000
+64.553760 4000.00 4000
+64.713760 4000.00 4000
+64.873760 4000.00 4000
+65.033760 4000.00 4000
+65.193760 4000.00 4000
+65.353760 4000.00 4000
+65.513760 4000.00 4000
+65.673760 4000.00 4000
+65.833760 4000.00 4000
+65.993760 4000.00 4000
+66.153760 4000.00 4000
+66.313760 4000.00 4000
+66.473760 4000.00 4000
+66.633760 4000.00 4000
+66.793760 4000.00 4000
+66.953760 4000.00 4000
+67.113760 4000.00 4000
+67.273760 4000.00 4000
+67.433760 4000.00 4000
+67.593760 4000.00 4000
+67.753760 4000.00 4000
+67.913760 4000.00 4000
+68.073760 4000.00 4000
+68.233760 4000.00 4000
+68.393760 4000.00 4000
+68.553760 4000.00 4000
+68.713760 4000.00 4000
+68.873760 4000.00 4000
+69.033760 4000.00 4000
+69.193760 4000.00 4000
+69.353760 4000.00 4000
+69.513760 4000.00 4000
+69.673760 4000.00 4000
+69.833760 4000.00 4000
+69.993760 4000.00 4000
+70.153760 4000.00 4000
+70.313760 4000.00 4000
+70.473760 4000.00 4000
+70.633760 4000.00 4000
+70.793760 4000.00 4000
+70.953760 4000.00 4000
+71.113760 4000.00 4000
+71.273760 4000.00 4000
+71.433760 4000.00 4000
+71.593760 4000.00 4000
+71.753760 4000.00 4000
+71.913760 4000.00 4000
+72.073760 4000.00 4000
+72.233760 4000.00 4000
+72.393760 4000.00 4000
+72.553760 4000.00 4000
+72.713760 4000.00 4000
+72.873760 4000.00 4000
+73.033760 4000.00 4000
+73.193760 4000.00 4000
+73.353760 4000.00 4000
+73.513760 4000.00 4000
+73.673760 4000.00 4000
+73.833760 4000.00 4000
+73.993760 4000.00 4000
+74.153760 4000.00 4000
+74.313760 4000.00 4000
+74.473760 4000.00 4000
+74.633760 4000.00 4000
+74.793760 4000.00 4000
+74.953760 4000.00 4000
+75.113760 4000.00 4000
+75.273760 4000.00 4000
+75.433760 4000.00 4000
+75.593760 4000.00 4000
+75.753760 4000.00 4000
+75.913760 4000.00 4000
+76.073760 4000.00 4000
+76.233760 4000.00 4000
+76.393760 4000.00 4000
+76.553760 4000.00 4000
+76.713760 4000.00 4000
+76.873760 4000.00 4000
+77.033760 4000.00 4000
+77.193760 4000.00 4000
+77.353760 4000.00 4000
+77.513760 4000.00 4000
+77.673760 4000.00 4000
+77.833760 4000.00 4000
+77.993760 4000.00 4000
+78.153760 4000.00 4000
+78.313760 4000.00 4000
+78.473760 4000.00 4000
+78.633760 4000.00 4000
+78.793760 4000.00 4000
+78.953760 4000.00 4000
+79.113760 4000.00 4000
+79.273760 4000.00 4000
+79.433760 4000.00 4000
+79.593760 4000.00 4000
+79.753760 4000.00 4000
+79.913760 4000.00 4000
+80.073760 4000.00 4000
+80.233760 4000.00 4000
+80.393760 4000.00 4000
+80.553760 4000.00 4000
+80.713760 4000.00 4000
+80.873760 4000.00 4000
+81.033760 4000.00 4000
+81.193760 4000.00 4000
+81.353760 4000.00 4000
+81.513760 4000.00 4000
+81.673760 4000.00 4000
+81.833760 4000.00 4000
+81.993760 4000.00 4000
+82.153760 4000.00 4000
+82.313760 4000.00 4000
+82.473760 4000.00 4000
+82.633760 4000.00 4000
+82.793760 4000.00 4000
+82.953760 4000.00 4000
+83.113760 4000.00 4000
+83.273760 4000.00 4000
+83.433760 4000.00 4000
+83.593760 4000.00 4000
+83.753760 4000.00 4000
+83.913760 4000.00 4000
+84.073760 4000.00 4000
+84.233760 4000.00 4000
+84.393760 4000.00 4000
+84.553760 4000.00 4000
+84.713760 4000.00 4000
+84.873760 4000.00 4000
+85.033760 4000.00 4000
+85.193760 4000.00 4000
+85.353760 4000.00 4000
+85.513760 4000.00 4000
+85.673760 4000.00 4000
+85.833760 4000.00 4000
+85.993760 4000.00 4000
+86.153760 4000.00 4000
+86.313760 4000.00 4000
+86.473760 4000.00 4000
+86.633760 4000.00 4000
+86.793760 4000.00 4000
+86.953760 4000.00 4000
+87.113760 4000.00 4000
+87.273760 4000.00 4000
+87.433760 4000.00 4000
+87.593760 4000.00 4000
+87.753760 4000.00 4000
+87.913760 4000.00 4000
+88.073760 4000.00 4000
+88.233760 4000.00 4000
+88.393760 4000.00 4000
+88.553760 4000.00 4000
+88.713760 4000.00 4000
+88.873760 4000.00 4000
+89.033760 4000.00 4000
+89.193760 4000.00 4000
+89.353760 4000.00 4000
+89.513760 4000.00 4000
+89.673760 4000.00 4000
+89.833760 4000.00 4000
+89.993760 4000.00 4000
+90.153760 4000.00 4000
+90.313760 4000.00 4000
+90.473760 4000.00 4000
+90.633760 4000.00 4000
+90.793760 4000.00 4000
+90.953760 4000.00 4000
+91.113760 4000.00 4000
+91.273760 4000.00 4000
+91.433760 4000.00 4000
+91.593760 4000.00 4000
+91.753760 4000.00 4000
+91.913760 4000.00 4000
+92.073760 4000.00 4000
+92.233760 4000.00 4000
+92.393760 4000.00 4000
+92.553760 4000.00 4000
+92.713760 4000.00 4000
+92.873760 4000.00 4000
+93.033760 4000.00 4000
+93.193760 4000.00 4000
+93.353760 4000.00 4000
+93.513760 4000.00 4000
+93.673760 4000.00 4000
+93.833760 4000.00 4000
+93.993760 4000.00 4000
+94.153760 4000.00 4000
+94.313760 4000.00 4000
+94.473760 4000.00 4000
+94.633760 4000.00 4000
+94.793760 4000.00 4000
+94.953760 4000.00 4000
+95.113760 4000.00 4000
+95.273760 4000.00 4000
+95.433760 4000.00 4000
+95.593760 4000.00 4000
+95.753760 4000.00 4000
+95.913760 4000.00 4000
+96.073760 4000.00 4000
+96.233760 4000.00 4000
+96.393760 4000.00 4000
+96.553760 4000.00 4000
+96.713760 4000.00 4000
+96.873760 4000.00 4000
+97.033760 4000.00 4000
+97.193760 4000.00 4000
+97.353760 4000.00 4000
+97.513760 4000.00 4000
+97.673760 4000.00 4000
+97.833760 4000.00 4000
+97.993760 4000.00 4000
+98.153760 4000.00 4000
+98.313760 4000.00 4000
+98.473760 4000.00 4000
+98.633760 4000.00 4000
+98.793760 4000.00 4000
+98.953760 4000.00 4000
+99.113760 4000.00 4000
+99.273760 4000.00 4000
+99.433760 4000.00 4000
+99.593760 4000.00 4000
+99.753760 4000.00 4000
+99.913760 4000.00 4000
+100.073760 4000.00 4000
+100.233760 4000.00 4000
+100.393760 4000.00 4000
+100.553760 4000.00 4000
+100.713760 4000.00 4000
+100.873760 4000.00 4000
+101.033760 4000.00 4000
+101.193760 4000.00 4000
+101.353760 4000.00 4000
+101.513760 4000.00 4000
+101.673760 4000.00 4000
+101.833760 4000.00 4000
+101.993760 4000.00 4000
+102.153760 4000.00 4000
+102.313760 4000.00 4000
+102.473760 4000.00 4000
+102.633760 4000.00 4000
+102.793760 4000.00 4000
+102.953760 4000.00 4000
+103.113760 4000.00 4000
+103.273760 4000.00 4000
+103.433760 4000.00 4000
+103.593760 4000.00 4000
+103.753760 4000.00 4000
+103.913760 4000.00 4000
+104.073760 4000.00 4000
+104.233760 4000.00 4000
+104.393760 4000.00 4000
+104.553760 4000.00 4000
+104.713760 4000.00 4000
+104.873760 4000.00 4000
+105.033760 4000.00 4000
+105.193760 4000.00 4000
+105.353760 4000.00 4000
+105.513760 4000.00 4000
+105.673760 4000.00 4000
+105.833760 4000.00 4000
+105.993760 4000.00 4000
+106.153760 4000.00 4000
+106.313760 4000.00 4000
+106.473760 4000.00 4000
+106.633760 4000.00 4000
+106.793760 4000.00 4000
+106.953760 4000.00 4000
+107.113760 4000.00 4000
+107.273760 4000.00 4000
+107.433760 4000.00 4000
+107.593760 4000.00 4000
+107.753760 4000.00 4000
+107.913760 4000.00 4000
+108.073760 4000.00 4000
+108.233760 4000.00 4000
+108.393760 4000.00 4000
+108.553760 4000.00 4000
+108.713760 4000.00 4000
+108.873760 4000.00 4000
+109.033760 4000.00 4000
+109.193760 4000.00 4000
+109.353760 4000.00 4000
+109.513760 4000.00 4000
+109.673760 4000.00 4000
+109.833760 4000.00 4000
+109.993760 4000.00 4000
+110.153760 4000.00 4000
+110.313760 4000.00 4000
+110.473760 4000.00 4000
+110.633760 4000.00 4000
+110.793760 4000.00 4000
+110.953760 4000.00 4000
+111.113760 4000.00 4000
+111.273760 4000.00 4000
+111.433760 4000.00 4000
+111.593760 4000.00 4000
+111.753760 4000.00 4000
+111.913760 4000.00 4000
+112.073760 4000.00 4000
+112.233760 4000.00 4000
+112.393760 4000.00 4000
+112.553760 4000.00 4000
+112.713760 4000.00 4000
+112.873760 4000.00 4000
+113.033760 4000.00 4000
+113.193760 4000.00 4000
+113.353760 4000.00 4000
+113.513760 4000.00 4000
+113.673760 4000.00 4000
+113.833760 4000.00 4000
+113.993760 4000.00 4000
+114.153760 4000.00 4000
+114.313760 4000.00 4000
+114.473760 4000.00 4000
+114.633760 4000.00 4000
+114.793760 4000.00 4000
+114.953760 4000.00 4000
+115.113760 4000.00 4000
+115.273760 4000.00 4000
+115.433760 4000.00 4000
+115.593760 4000.00 4000
+115.753760 4000.00 4000
+115.913760 4000.00 4000
+116.073760 4000.00 4000
+116.233760 4000.00 4000
+116.393760 4000.00 4000
+116.553760 4000.00 4000
+116.713760 4000.00 4000
+116.873760 4000.00 4000
+117.033760 4000.00 4000
+117.193760 4000.00 4000
+117.353760 4000.00 4000
+117.513760 4000.00 4000
+117.673760 4000.00 4000
+117.833760 4000.00 4000
+117.993760 4000.00 4000
+118.153760 4000.00 4000
+118.313760 4000.00 4000
+118.473760 4000.00 4000
+118.633760 4000.00 4000
+118.793760 4000.00 4000
+118.953760 4000.00 4000
+119.113760 4000.00 4000
+119.273760 4000.00 4000
+119.433760 4000.00 4000
+119.593760 4000.00 4000
+119.753760 4000.00 4000
+119.913760 4000.00 4000
+120.073760 4000.00 4000
+120.233760 4000.00 4000
+120.393760 4000.00 4000
+120.553760 4000.00 4000
+120.713760 4000.00 4000
+120.873760 4000.00 4000
+121.033760 4000.00 4000
+121.193760 4000.00 4000
+121.353760 4000.00 4000
+121.513760 4000.00 4000
+121.673760 4000.00 4000
+121.833760 4000.00 4000
+121.993760 4000.00 4000
+122.153760 4000.00 4000
+122.313760 4000.00 4000
+122.473760 4000.00 4000
+122.633760 4000.00 4000
+122.793760 4000.00 4000
+122.953760 4000.00 4000
+123.113760 4000.00 4000
+123.273760 4000.00 4000
+123.433760 4000.00 4000
+123.593760 4000.00 4000
+123.753760 4000.00 4000
+123.913760 4000.00 4000
+124.073760 4000.00 4000
+124.233760 4000.00 4000
+124.393760 4000.00 4000
+124.553760 4000.00 4000
+124.713760 4000.00 4000
+124.873760 4000.00 4000
+125.033760 4000.00 4000
+125.193760 4000.00 4000
+125.353760 4000.00 4000
+125.513760 4000.00 4000
+125.673760 4000.00 4000
+125.833760 4000.00 4000
+125.993760 4000.00 4000
+126.153760 4000.00 4000
+126.313760 4000.00 4000
+126.473760 4000.00 4000
+126.633760 4000.00 4000
+126.793760 4000.00 4000
+126.953760 4000.00 4000
+127.113760 4000.00 4000
+127.273760 4000.00 4000
+127.433760 4000.00 4000
+127.593760 4000.00 4000
+127.753760 4000.00 4000
+127.913760 4000.00 4000
+128.073760 4000.00 4000
+128.233760 4000.00 4000
+128.393760 4000.00 4000
+128.553760 4000.00 4000
+128.713760 4000.00 4000
+128.873760 4000.00 4000
+129.033760 4000.00 4000
+129.193760 4000.00 4000
+129.353760 4000.00 4000
+129.513760 4000.00 4000
+129.673760 4000.00 4000
+129.833760 4000.00 4000
+129.993760 4000.00 4000
+130.153760 4000.00 4000
+130.313760 4000.00 4000
+130.473760 4000.00 4000
+130.633760 4000.00 4000
+130.793760 4000.00 4000
+130.953760 4000.00 4000
+131.113760 4000.00 4000
+131.273760 4000.00 4000
+131.433760 4000.00 4000
+131.593760 4000.00 4000
+131.753760 4000.00 4000
+131.913760 4000.00 4000
+132.073760 4000.00 4000
+132.233760 4000.00 4000
+132.393760 4000.00 4000
+132.553760 4000.00 4000
+132.713760 4000.00 4000
+132.873760 4000.00 4000
+133.033760 4000.00 4000
+133.193760 4000.00 4000
+133.353760 4000.00 4000
+133.513760 4000.00 4000
+133.673760 4000.00 4000
+133.833760 4000.00 4000
+133.993760 4000.00 4000
+134.153760 4000.00 4000
+134.313760 4000.00 4000
+134.473760 4000.00 4000
+134.633760 4000.00 4000
+134.793760 4000.00 4000
+134.953760 4000.00 4000
+135.113760 4000.00 4000
+135.273760 4000.00 4000
+135.433760 4000.00 4000
+135.593760 4000.00 4000
+135.753760 4000.00 4000
+135.913760 4000.00 4000
+136.073760 4000.00 4000
+136.233760 4000.00 4000
+136.393760 4000.00 4000
+136.553760 4000.00 4000
+136.713760 4000.00 4000
+136.873760 4000.00 4000
+137.033760 4000.00 4000
+137.193760 4000.00 4000
+137.353760 4000.00 4000
+137.513760 4000.00 4000
+137.673760 4000.00 4000
+137.833760 4000.00 4000
+137.993760 4000.00 4000
+138.153760 4000.00 4000
+138.313760 4000.00 4000
+138.473760 4000.00 4000
+138.633760 4000.00 4000
+138.793760 4000.00 4000
+138.953760 4000.00 4000
+139.113760 4000.00 4000
+139.273760 4000.00 4000
+139.433760 4000.00 4000
+139.593760 4000.00 4000
+139.753760 4000.00 4000
+139.913760 4000.00 4000
+140.073760 4000.00 4000
+140.233760 4000.00 4000
+140.393760 4000.00 4000
+140.553760 4000.00 4000
+140.713760 4000.00 4000
+140.873760 4000.00 4000
+141.033760 4000.00 4000
+141.193760 4000.00 4000
+141.353760 4000.00 4000
+141.513760 4000.00 4000
+141.673760 4000.00 4000
+141.833760 4000.00 4000
+141.993760 4000.00 4000
+142.153760 4000.00 4000
+142.313760 4000.00 4000
+142.473760 4000.00 4000
+142.633760 4000.00 4000
+142.793760 4000.00 4000
+142.953760 4000.00 4000
+143.113760 4000.00 4000
+143.273760 4000.00 4000
+143.433760 4000.00 4000
+143.593760 4000.00 4000
+143.753760 4000.00 4000
+143.913760 4000.00 4000
+144.073760 4000.00 4000
+144.233760 4000.00 4000
+144.393760 4000.00 4000
+144.553760 4000.00 4000
+144.713760 4000.00 4000
+144.873760 4000.00 4000
+145.033760 4000.00 4000
+145.193760 4000.00 4000
+145.353760 4000.00 4000
+145.513760 4000.00 4000
+145.673760 4000.00 4000
+145.833760 4000.00 4000
+145.993760 4000.00 4000
+146.153760 4000.00 4000
+146.313760 4000.00 4000
+146.473760 4000.00 4000
+146.633760 4000.00 4000
+146.793760 4000.00 4000
+146.953760 4000.00 4000
+147.113760 4000.00 4000
+147.273760 4000.00 4000
+147.433760 4000.00 4000
+147.593760 4000.00 4000
+147.753760 4000.00 4000
+147.913760 4000.00 4000
+148.073760 4000.00 4000
+148.233760 4000.00 4000
+148.393760 4000.00 4000
+148.553760 4000.00 4000
+148.713760 4000.00 4000
+148.873760 4000.00 4000
+149.033760 4000.00 4000
+149.193760 4000.00 4000
+149.353760 4000.00 4000
+149.513760 4000.00 4000
+149.673760 4000.00 4000
+149.833760 4000.00 4000
+149.993760 4000.00 4000
+150.153760 4000.00 4000
+150.313760 4000.00 4000
+150.473760 4000.00 4000
+150.633760 4000.00 4000
+150.793760 4000.00 4000
+150.953760 4000.00 4000
+151.113760 4000.00 4000
+151.273760 4000.00 4000
+151.433760 4000.00 4000
+151.593760 4000.00 4000
+151.753760 4000.00 4000
+151.913760 4000.00 4000
+152.073760 4000.00 4000
+152.233760 4000.00 4000
+152.393760 4000.00 4000
+152.553760 4000.00 4000
+152.713760 4000.00 4000
+152.873760 4000.00 4000
+153.033760 4000.00 4000
+153.193760 4000.00 4000
+153.353760 4000.00 4000
+153.513760 4000.00 4000
+153.673760 4000.00 4000
+153.833760 4000.00 4000
+153.993760 4000.00 4000
+154.153760 4000.00 4000
+154.313760 4000.00 4000
+154.473760 4000.00 4000
+154.633760 4000.00 4000
+154.793760 4000.00 4000
+154.953760 4000.00 4000
+155.113760 4000.00 4000
+155.273760 4000.00 4000
+155.433760 4000.00 4000
+155.593760 4000.00 4000
+155.753760 4000.00 4000
+155.913760 4000.00 4000
+156.073760 4000.00 4000
+156.233760 4000.00 4000
+156.393760 4000.00 4000
+156.553760 4000.00 4000
+156.713760 4000.00 4000
+156.873760 4000.00 4000
+157.033760 4000.00 4000
+157.193760 4000.00 4000
+157.353760 4000.00 4000
+157.513760 4000.00 4000
+157.673760 4000.00 4000
+157.833760 4000.00 4000
+157.993760 4000.00 4000
+158.153760 4000.00 4000
+158.313760 4000.00 4000
+158.473760 4000.00 4000
+158.633760 4000.00 4000
+158.793760 4000.00 4000
+158.953760 4000.00 4000
+159.113760 4000.00 4000
+159.273760 4000.00 4000
+159.433760 4000.00 4000
+159.593760 4000.00 4000
+159.753760 4000.00 4000
+159.913760 4000.00 4000
+160.073760 4000.00 4000
+160.233760 4000.00 4000
+160.393760 4000.00 4000
+160.553760 4000.00 4000
+160.713760 4000.00 4000
+160.873760 4000.00 4000
+161.033760 4000.00 4000
+161.193760 4000.00 4000
+161.353760 4000.00 4000
+161.513760 4000.00 4000
+161.673760 4000.00 4000
+161.833760 4000.00 4000
+161.993760 4000.00 4000
+162.153760 4000.00 4000
+162.313760 4000.00 4000
+162.473760 4000.00 4000
+162.633760 4000.00 4000
+162.793760 4000.00 4000
+162.953760 4000.00 4000
+163.113760 4000.00 4000
+163.273760 4000.00 4000
+163.433760 4000.00 4000
+163.593760 4000.00 4000
+163.753760 4000.00 4000
+163.913760 4000.00 4000
+164.073760 4000.00 4000
+164.233760 4000.00 4000
+164.393760 4000.00 4000
+164.553760 4000.00 4000
+164.713760 4000.00 4000
+164.873760 4000.00 4000
+165.033760 4000.00 4000
+165.193760 4000.00 4000
+165.353760 4000.00 4000
+165.513760 4000.00 4000
+165.673760 4000.00 4000
+165.833760 4000.00 4000
+165.993760 4000.00 4000
+166.153760 4000.00 4000
+166.313760 4000.00 4000
+166.473760 4000.00 4000
+166.633760 4000.00 4000
+166.793760 4000.00 4000
+166.953760 4000.00 4000
+167.113760 4000.00 4000
+167.273760 4000.00 4000
+167.433760 4000.00 4000
+167.593760 4000.00 4000
+167.753760 4000.00 4000
+167.913760 4000.00 4000
+168.073760 4000.00 4000
+168.233760 4000.00 4000
+168.393760 4000.00 4000
+168.553760 4000.00 4000
+168.713760 4000.00 4000
+168.873760 4000.00 4000
+169.033760 4000.00 4000
+169.193760 4000.00 4000
+169.353760 4000.00 4000
+169.513760 4000.00 4000
+169.673760 4000.00 4000
+169.833760 4000.00 4000
+169.993760 4000.00 4000
+170.153760 4000.00 4000
+170.313760 4000.00 4000
+170.473760 4000.00 4000
+170.633760 4000.00 4000
+170.793760 4000.00 4000
+170.953760 4000.00 4000
+171.113760 4000.00 4000
+171.273760 4000.00 4000
+171.433760 4000.00 4000
+171.593760 4000.00 4000
+171.753760 4000.00 4000
+171.913760 4000.00 4000
+172.073760 4000.00 4000
+172.233760 4000.00 4000
+172.393760 4000.00 4000
+172.553760 4000.00 4000
+172.713760 4000.00 4000
+172.873760 4000.00 4000
+173.033760 4000.00 4000
+173.193760 4000.00 4000
+173.353760 4000.00 4000
+173.513760 4000.00 4000
+173.673760 4000.00 4000
+173.833760 4000.00 4000
+173.993760 4000.00 4000
+174.153760 4000.00 4000
+174.313760 4000.00 4000
+174.473760 4000.00 4000
+174.633760 4000.00 4000
+174.793760 4000.00 4000
+174.953760 4000.00 4000
+175.113760 4000.00 4000
+175.273760 4000.00 4000
+175.433760 4000.00 4000
+175.593760 4000.00 4000
+175.753760 4000.00 4000
+175.913760 4000.00 4000
+176.073760 4000.00 4000
+176.233760 4000.00 4000
+176.393760 4000.00 4000
+176.553760 4000.00 4000
+176.713760 4000.00 4000
+176.873760 4000.00 4000
+177.033760 4000.00 4000
+177.193760 4000.00 4000
+177.353760 4000.00 4000
+177.513760 4000.00 4000
+177.673760 4000.00 4000
+177.833760 4000.00 4000
+177.993760 4000.00 4000
+178.153760 4000.00 4000
+178.313760 4000.00 4000
+178.473760 4000.00 4000
+178.633760 4000.00 4000
+178.793760 4000.00 4000
+178.953760 4000.00 4000
+179.113760 4000.00 4000
+179.273760 4000.00 4000
+179.433760 4000.00 4000
+179.593760 4000.00 4000
+179.753760 4000.00 4000
+179.913760 4000.00 4000
+180.073760 4000.00 4000
+180.233760 4000.00 4000
+180.393760 4000.00 4000
+180.553760 4000.00 4000
+180.713760 4000.00 4000
+180.873760 4000.00 4000
+181.033760 4000.00 4000
+181.193760 4000.00 4000
+181.353760 4000.00 4000
+181.513760 4000.00 4000
+181.673760 4000.00 4000
+181.833760 4000.00 4000
+181.993760 4000.00 4000
+182.153760 4000.00 4000
+182.313760 4000.00 4000
+182.473760 4000.00 4000
+182.633760 4000.00 4000
+182.793760 4000.00 4000
+182.953760 4000.00 4000
+183.113760 4000.00 4000
+183.273760 4000.00 4000
+183.433760 4000.00 4000
+183.593760 4000.00 4000
+183.753760 4000.00 4000
+183.913760 4000.00 4000
+184.073760 4000.00 4000
+184.233760 4000.00 4000
+184.393760 4000.00 4000
+184.553760 4000.00 4000
+184.713760 4000.00 4000
+184.873760 4000.00 4000
+185.033760 4000.00 4000
+185.193760 4000.00 4000
+185.353760 4000.00 4000
+185.513760 4000.00 4000
+185.673760 4000.00 4000
+185.833760 4000.00 4000
+185.993760 4000.00 4000
+186.153760 4000.00 4000
+186.313760 4000.00 4000
+186.473760 4000.00 4000
+186.633760 4000.00 4000
+186.793760 4000.00 4000
+186.953760 4000.00 4000
+187.113760 4000.00 4000
+187.273760 4000.00 4000
+187.433760 4000.00 4000
+187.593760 4000.00 4000
+187.753760 4000.00 4000
+187.913760 4000.00 4000
+188.073760 4000.00 4000
+188.233760 4000.00 4000
+188.393760 4000.00 4000
+188.553760 4000.00 4000
+188.713760 4000.00 4000
+188.873760 4000.00 4000
+189.033760 4000.00 4000
+189.193760 4000.00 4000
+189.353760 4000.00 4000
+189.513760 4000.00 4000
+189.673760 4000.00 4000
+189.833760 4000.00 4000
+189.993760 4000.00 4000
+190.153760 4000.00 4000
+190.313760 4000.00 4000
+190.473760 4000.00 4000
+190.633760 4000.00 4000
+190.793760 4000.00 4000
+190.953760 4000.00 4000
+191.113760 4000.00 4000
+191.273760 4000.00 4000
+191.433760 4000.00 4000
+191.593760 4000.00 4000
+191.753760 4000.00 4000
+191.913760 4000.00 4000
+192.073760 4000.00 4000
+192.233760 4000.00 4000
+192.393760 4000.00 4000
+192.553760 4000.00 4000
+192.713760 4000.00 4000
+192.873760 4000.00 4000
+193.033760 4000.00 4000
+193.193760 4000.00 4000
+193.353760 4000.00 4000
+193.513760 4000.00 4000
+193.673760 4000.00 4000
+193.833760 4000.00 4000
+193.993760 4000.00 4000
+194.153760 4000.00 4000
+194.313760 4000.00 4000
+194.473760 4000.00 4000
+194.633760 4000.00 4000
+194.793760 4000.00 4000
+194.953760 4000.00 4000
+195.113760 4000.00 4000
+195.273760 4000.00 4000
+195.433760 4000.00 4000
+195.593760 4000.00 4000
+195.753760 4000.00 4000
+195.913760 4000.00 4000
+196.073760 4000.00 4000
+196.233760 4000.00 4000
+196.393760 4000.00 4000
+196.553760 4000.00 4000
+196.713760 4000.00 4000
+196.873760 4000.00 4000
+197.033760 4000.00 4000
+197.193760 4000.00 4000
+197.353760 4000.00 4000
+197.513760 4000.00 4000
+197.673760 4000.00 4000
+197.833760 4000.00 4000
+197.993760 4000.00 4000
+198.153760 4000.00 4000
+198.313760 4000.00 4000
+198.473760 4000.00 4000
+198.633760 4000.00 4000
+198.793760 4000.00 4000
+198.953760 4000.00 4000
+199.113760 4000.00 4000
+199.273760 4000.00 4000
+199.433760 4000.00 4000
+199.593760 4000.00 4000
+199.753760 4000.00 4000
+199.913760 4000.00 4000
+200.073760 4000.00 4000
+200.233760 4000.00 4000
+200.393760 4000.00 4000
+200.553760 4000.00 4000
+200.713760 4000.00 4000
+200.873760 4000.00 4000
+201.033760 4000.00 4000
+201.193760 4000.00 4000
+201.353760 4000.00 4000
+201.513760 4000.00 4000
+201.673760 4000.00 4000
+201.833760 4000.00 4000
+201.993760 4000.00 4000
+202.153760 4000.00 4000
+202.313760 4000.00 4000
+202.473760 4000.00 4000
+202.633760 4000.00 4000
+202.793760 4000.00 4000
+202.953760 4000.00 4000
+203.113760 4000.00 4000
+203.273760 4000.00 4000
+203.433760 4000.00 4000
+203.593760 4000.00 4000
+203.753760 4000.00 4000
+203.913760 4000.00 4000
+204.073760 4000.00 4000
+204.233760 4000.00 4000
+204.393760 4000.00 4000
+204.553760 4000.00 4000
+204.713760 4000.00 4000
+204.873760 4000.00 4000
+205.033760 4000.00 4000
+205.193760 4000.00 4000
+205.353760 4000.00 4000
+205.513760 4000.00 4000
+205.673760 4000.00 4000
+205.833760 4000.00 4000
+205.993760 4000.00 4000
+206.153760 4000.00 4000
+206.313760 4000.00 4000
+206.473760 4000.00 4000
+206.633760 4000.00 4000
+206.793760 4000.00 4000
+206.953760 4000.00 4000
+207.113760 4000.00 4000
+207.273760 4000.00 4000
+207.433760 4000.00 4000
+207.593760 4000.00 4000
+207.753760 4000.00 4000
+207.913760 4000.00 4000
+208.073760 4000.00 4000
+208.233760 4000.00 4000
+208.393760 4000.00 4000
+208.553760 4000.00 4000
+208.713760 4000.00 4000
+208.873760 4000.00 4000
+209.033760 4000.00 4000
+209.193760 4000.00 4000
+209.353760 4000.00 4000
+209.513760 4000.00 4000
+209.673760 4000.00 4000
+209.833760 4000.00 4000
+209.993760 4000.00 4000
+210.153760 4000.00 4000
+210.313760 4000.00 4000
+210.473760 4000.00 4000
+210.633760 4000.00 4000
+210.793760 4000.00 4000
+210.953760 4000.00 4000
+211.113760 4000.00 4000
+211.273760 4000.00 4000
+211.433760 4000.00 4000
+211.593760 4000.00 4000
+211.753760 4000.00 4000
+211.913760 4000.00 4000
+212.073760 4000.00 4000
+212.233760 4000.00 4000
+212.393760 4000.00 4000
+212.553760 4000.00 4000
+212.713760 4000.00 4000
+212.873760 4000.00 4000
+213.033760 4000.00 4000
+213.193760 4000.00 4000
+213.353760 4000.00 4000
+213.513760 4000.00 4000
+213.673760 4000.00 4000
+213.833760 4000.00 4000
+213.993760 4000.00 4000
+214.153760 4000.00 4000
+214.313760 4000.00 4000
+214.473760 4000.00 4000
+214.633760 4000.00 4000
+214.793760 4000.00 4000
+214.953760 4000.00 4000
+215.113760 4000.00 4000
+215.273760 4000.00 4000
+215.433760 4000.00 4000
+215.593760 4000.00 4000
+215.753760 4000.00 4000
+215.913760 4000.00 4000
+216.073760 4000.00 4000
+216.233760 4000.00 4000
+216.393760 4000.00 4000
+216.553760 4000.00 4000
+216.713760 4000.00 4000
+216.873760 4000.00 4000
+217.033760 4000.00 4000
+217.193760 4000.00 4000
+217.353760 4000.00 4000
+217.513760 4000.00 4000
+217.673760 4000.00 4000
+217.833760 4000.00 4000
+217.993760 4000.00 4000
+218.153760 4000.00 4000
+218.313760 4000.00 4000
+218.473760 4000.00 4000
+218.633760 4000.00 4000
+218.793760 4000.00 4000
+218.953760 4000.00 4000
+219.113760 4000.00 4000
+219.273760 4000.00 4000
+219.433760 4000.00 4000
+219.593760 4000.00 4000
+219.753760 4000.00 4000
+219.913760 4000.00 4000
+220.073760 4000.00 4000
+220.233760 4000.00 4000
+220.393760 4000.00 4000
+220.553760 4000.00 4000
+220.713760 4000.00 4000
+220.873760 4000.00 4000
+221.033760 4000.00 4000
+221.193760 4000.00 4000
+221.353760 4000.00 4000
+221.513760 4000.00 4000
+221.673760 4000.00 4000
+221.833760 4000.00 4000
+221.993760 4000.00 4000
+222.153760 4000.00 4000
+222.313760 4000.00 4000
+222.473760 4000.00 4000
+222.633760 4000.00 4000
+222.793760 4000.00 4000
+222.953760 4000.00 4000
+223.113760 4000.00 4000
+223.273760 4000.00 4000
+223.433760 4000.00 4000
+223.593760 4000.00 4000
+223.753760 4000.00 4000
+223.913760 4000.00 4000
+224.073760 4000.00 4000
+224.233760 4000.00 4000
+224.393760 4000.00 4000
+224.553760 4000.00 4000
+224.713760 4000.00 4000
+224.873760 4000.00 4000
+225.033760 4000.00 4000
+225.193760 4000.00 4000
+225.353760 4000.00 4000
+225.513760 4000.00 4000
+225.673760 4000.00 4000
+225.833760 4000.00 4000
+225.993760 4000.00 4000
+226.153760 4000.00 4000
+226.313760 4000.00 4000
+226.473760 4000.00 4000
+226.633760 4000.00 4000
+226.793760 4000.00 4000
+226.953760 4000.00 4000
+227.113760 4000.00 4000
+227.273760 4000.00 4000
+227.433760 4000.00 4000
+227.593760 4000.00 4000
+227.753760 4000.00 4000
+227.913760 4000.00 4000
+228.073760 4000.00 4000
+228.233760 4000.00 4000
+228.393760 4000.00 4000
+228.553760 4000.00 4000
+228.713760 4000.00 4000
+228.873760 4000.00 4000
+229.033760 4000.00 4000
+229.193760 4000.00 4000
+229.353760 4000.00 4000
+229.513760 4000.00 4000
+229.673760 4000.00 4000
+229.833760 4000.00 4000
+229.993760 4000.00 4000
+230.153760 4000.00 4000
+230.313760 4000.00 4000
+230.473760 4000.00 4000
+230.633760 4000.00 4000
+230.793760 4000.00 4000
+230.953760 4000.00 4000
+231.113760 4000.00 4000
+231.273760 4000.00 4000
+231.433760 4000.00 4000
+231.593760 4000.00 4000
+231.753760 4000.00 4000
+231.913760 4000.00 4000
+232.073760 4000.00 4000
+232.233760 4000.00 4000
+232.393760 4000.00 4000
+232.553760 4000.00 4000
+232.713760 4000.00 4000
+232.873760 4000.00 4000
+233.033760 4000.00 4000
+233.193760 4000.00 4000
+233.353760 4000.00 4000
+233.513760 4000.00 4000
+233.673760 4000.00 4000
+233.833760 4000.00 4000
+233.993760 4000.00 4000
+234.153760 4000.00 4000
+234.313760 4000.00 4000
+234.473760 4000.00 4000
+234.633760 4000.00 4000
+234.793760 4000.00 4000
+234.953760 4000.00 4000
+235.113760 4000.00 4000
+235.273760 4000.00 4000
+235.433760 4000.00 4000
+235.593760 4000.00 4000
+235.753760 4000.00 4000
+235.913760 4000.00 4000
+236.073760 4000.00 4000
+236.233760 4000.00 4000
+236.393760 4000.00 4000
+236.553760 4000.00 4000
+236.713760 4000.00 4000
+236.873760 4000.00 4000
+237.033760 4000.00 4000
+237.193760 4000.00 4000
+237.353760 4000.00 4000
+237.513760 4000.00 4000
+237.673760 4000.00 4000
+237.833760 4000.00 4000
+237.993760 4000.00 4000
+238.153760 4000.00 4000
+238.313760 4000.00 4000
+238.473760 4000.00 4000
+238.633760 4000.00 4000
+238.793760 4000.00 4000
+238.953760 4000.00 4000
+239.113760 4000.00 4000
+239.273760 4000.00 4000
+239.433760 4000.00 4000
+239.593760 4000.00 4000
+239.753760 4000.00 4000
+239.913760 4000.00 4000
+240.073760 4000.00 4000
+240.233760 4000.00 4000
+240.393760 4000.00 4000
+240.553760 4000.00 4000
+240.713760 4000.00 4000
+240.873760 4000.00 4000
+241.033760 4000.00 4000
+241.193760 4000.00 4000
+241.353760 4000.00 4000
+241.513760 4000.00 4000
+241.673760 4000.00 4000
+241.833760 4000.00 4000
+241.993760 4000.00 4000
+242.153760 4000.00 4000
+242.313760 4000.00 4000
+242.473760 4000.00 4000
+242.633760 4000.00 4000
+242.793760 4000.00 4000
+242.953760 4000.00 4000
+243.113760 4000.00 4000
+243.273760 4000.00 4000
+243.433760 4000.00 4000
+243.593760 4000.00 4000
+243.753760 4000.00 4000
+243.913760 4000.00 4000
+244.073760 4000.00 4000
+244.233760 4000.00 4000
+244.393760 4000.00 4000
+244.553760 4000.00 4000
+244.713760 4000.00 4000
+244.873760 4000.00 4000
+245.033760 4000.00 4000
+245.193760 4000.00 4000
+245.353760 4000.00 4000
+245.513760 4000.00 4000
+245.673760 4000.00 4000
+245.833760 4000.00 4000
+245.993760 4000.00 4000
+246.153760 4000.00 4000
+246.313760 4000.00 4000
+246.473760 4000.00 4000
+246.633760 4000.00 4000
+246.793760 4000.00 4000
+246.953760 4000.00 4000
+247.113760 4000.00 4000
+247.273760 4000.00 4000
+247.433760 4000.00 4000
+247.593760 4000.00 4000
+247.753760 4000.00 4000
+247.913760 4000.00 4000
+248.073760 4000.00 4000
+248.233760 4000.00 4000
+248.393760 4000.00 4000
+248.553760 4000.00 4000
+248.713760 4000.00 4000
+248.873760 4000.00 4000
+249.033760 4000.00 4000
+249.193760 4000.00 4000
+249.353760 4000.00 4000
+249.513760 4000.00 4000
+249.673760 4000.00 4000
+249.833760 4000.00 4000
+249.993760 4000.00 4000
+250.153760 4000.00 4000
+250.313760 4000.00 4000
+250.473760 4000.00 4000
+250.633760 4000.00 4000
+250.793760 4000.00 4000
+250.953760 4000.00 4000
+251.113760 4000.00 4000
+251.273760 4000.00 4000
+251.433760 4000.00 4000
+251.593760 4000.00 4000
+251.753760 4000.00 4000
+251.913760 4000.00 4000
+252.073760 4000.00 4000
+252.233760 4000.00 4000
+252.393760 4000.00 4000
+252.553760 4000.00 4000
+252.713760 4000.00 4000
+252.873760 4000.00 4000
+253.033760 4000.00 4000
+253.193760 4000.00 4000
+253.353760 4000.00 4000
+253.513760 4000.00 4000
+253.673760 4000.00 4000
+253.833760 4000.00 4000
+253.993760 4000.00 4000
+254.153760 4000.00 4000
+254.313760 4000.00 4000
+254.473760 4000.00 4000
+254.633760 4000.00 4000
+254.793760 4000.00 4000
+254.953760 4000.00 4000
+255.113760 4000.00 4000
+255.273760 4000.00 4000
+255.433760 4000.00 4000
+255.593760 4000.00 4000
+255.753760 4000.00 4000
+255.913760 4000.00 4000
+256.073760 4000.00 4000
+256.233760 4000.00 4000
+256.393760 4000.00 4000
+256.553760 4000.00 4000
+256.713760 4000.00 4000
+256.873760 4000.00 4000
+257.033760 4000.00 4000
+257.193760 4000.00 4000
+257.353760 4000.00 4000
+257.513760 4000.00 4000
+257.673760 4000.00 4000
+257.833760 4000.00 4000
+257.993760 4000.00 4000
+258.153760 4000.00 4000
+258.313760 4000.00 4000
+258.473760 4000.00 4000
+258.633760 4000.00 4000
+258.793760 4000.00 4000
+258.953760 4000.00 4000
+259.113760 4000.00 4000
+259.273760 4000.00 4000
+259.433760 4000.00 4000
+259.593760 4000.00 4000
+259.753760 4000.00 4000
+259.913760 4000.00 4000
+260.073760 4000.00 4000
+260.233760 4000.00 4000
+260.393760 4000.00 4000
+260.553760 4000.00 4000
+260.713760 4000.00 4000
+260.873760 4000.00 4000
+261.033760 4000.00 4000
+261.193760 4000.00 4000
+261.353760 4000.00 4000
+261.513760 4000.00 4000
+261.673760 4000.00 4000
+261.833760 4000.00 4000
+261.993760 4000.00 4000
+262.153760 4000.00 4000
+262.313760 4000.00 4000
+262.473760 4000.00 4000
+262.633760 4000.00 4000
+262.793760 4000.00 4000
+262.953760 4000.00 4000
+263.113760 4000.00 4000
+263.273760 4000.00 4000
+263.433760 4000.00 4000
+263.593760 4000.00 4000
+263.753760 4000.00 4000
+263.913760 4000.00 4000
+264.073760 4000.00 4000
+264.233760 4000.00 4000
+264.393760 4000.00 4000
+264.553760 4000.00 4000
+264.713760 4000.00 4000
+264.873760 4000.00 4000
+265.033760 4000.00 4000
+265.193760 4000.00 4000
+265.353760 4000.00 4000
+265.513760 4000.00 4000
+265.673760 4000.00 4000
+265.833760 4000.00 4000
+265.993760 4000.00 4000
+266.153760 4000.00 4000
+266.313760 4000.00 4000
+266.473760 4000.00 4000
+266.633760 4000.00 4000
+266.793760 4000.00 4000
+266.953760 4000.00 4000
+267.113760 4000.00 4000
+267.273760 4000.00 4000
+267.433760 4000.00 4000
+267.593760 4000.00 4000
+267.753760 4000.00 4000
+267.913760 4000.00 4000
+268.073760 4000.00 4000
+268.233760 4000.00 4000
+268.393760 4000.00 4000
+268.553760 4000.00 4000
+268.713760 4000.00 4000
+268.873760 4000.00 4000
+269.033760 4000.00 4000
+269.193760 4000.00 4000
+269.353760 4000.00 4000
+269.513760 4000.00 4000
+269.673760 4000.00 4000
+269.833760 4000.00 4000
+269.993760 4000.00 4000
+270.153760 4000.00 4000
+270.313760 4000.00 4000
+270.473760 4000.00 4000
+270.633760 4000.00 4000
+270.793760 4000.00 4000
+270.953760 4000.00 4000
+271.113760 4000.00 4000
+271.273760 4000.00 4000
+271.433760 4000.00 4000
+271.593760 4000.00 4000
+271.753760 4000.00 4000
+271.913760 4000.00 4000
+272.073760 4000.00 4000
+272.233760 4000.00 4000
+272.393760 4000.00 4000
+272.553760 4000.00 4000
+272.713760 4000.00 4000
+272.873760 4000.00 4000
+273.033760 4000.00 4000
+273.193760 4000.00 4000
+273.353760 4000.00 4000
+273.513760 4000.00 4000
+273.673760 4000.00 4000
+273.833760 4000.00 4000
+273.993760 4000.00 4000
+274.153760 4000.00 4000
+274.313760 4000.00 4000
+274.473760 4000.00 4000
+274.633760 4000.00 4000
+274.793760 4000.00 4000
+274.953760 4000.00 4000
+275.113760 4000.00 4000
+275.273760 4000.00 4000
+275.433760 4000.00 4000
+275.593760 4000.00 4000
+275.753760 4000.00 4000
+275.913760 4000.00 4000
+276.073760 4000.00 4000
+276.233760 4000.00 4000
+276.393760 4000.00 4000
+276.553760 4000.00 4000
+276.713760 4000.00 4000
+276.873760 4000.00 4000
+277.033760 4000.00 4000
+277.193760 4000.00 4000
+277.353760 4000.00 4000
+277.513760 4000.00 4000
+277.673760 4000.00 4000
+277.833760 4000.00 4000
+277.993760 4000.00 4000
+278.153760 4000.00 4000
+278.313760 4000.00 4000
+278.473760 4000.00 4000
+278.633760 4000.00 4000
+278.793760 4000.00 4000
+278.953760 4000.00 4000
+279.113760 4000.00 4000
+279.273760 4000.00 4000
+279.433760 4000.00 4000
+279.593760 4000.00 4000
+279.753760 4000.00 4000
+279.913760 4000.00 4000
+280.073760 4000.00 4000
+280.233760 4000.00 4000
+280.393760 4000.00 4000
+280.553760 4000.00 4000
+280.713760 4000.00 4000
+280.873760 4000.00 4000
+281.033760 4000.00 4000
+281.193760 4000.00 4000
+281.353760 4000.00 4000
+281.513760 4000.00 4000
+281.673760 4000.00 4000
+281.833760 4000.00 4000
+281.993760 4000.00 4000
+282.153760 4000.00 4000
+282.313760 4000.00 4000
+282.473760 4000.00 4000
+282.633760 4000.00 4000
+282.793760 4000.00 4000
+282.953760 4000.00 4000
+283.113760 4000.00 4000
+283.273760 4000.00 4000
+283.433760 4000.00 4000
+283.593760 4000.00 4000
+283.753760 4000.00 4000
+283.913760 4000.00 4000
+284.073760 4000.00 4000
+284.233760 4000.00 4000
+284.393760 4000.00 4000
+284.553760 4000.00 4000
+284.713760 4000.00 4000
+284.873760 4000.00 4000
+285.033760 4000.00 4000
+285.193760 4000.00 4000
+285.353760 4000.00 4000
+285.513760 4000.00 4000
+285.673760 4000.00 4000
+285.833760 4000.00 4000
+285.993760 4000.00 4000
+286.153760 4000.00 4000
+286.313760 4000.00 4000
+286.473760 4000.00 4000
+286.633760 4000.00 4000
+286.793760 4000.00 4000
+286.953760 4000.00 4000
+287.113760 4000.00 4000
+287.273760 4000.00 4000
+287.433760 4000.00 4000
+287.529760 4000.00 4000
+287.545824 3984.06 4016
+287.557872 3984.06 4016
+287.569920 3984.06 4016
+287.581968 3984.06 4016
+287.594016 3984.06 4016
+287.606064 3984.06 4016
+287.618112 3984.06 4016
+287.630160 3984.06 4016
+287.642208 3984.06 4016
+287.654256 3984.06 4016
+287.666304 3984.06 4016
+287.678352 3984.06 4016
+287.690400 3984.06 4016
+287.702448 3984.06 4016
+287.714496 3984.06 4016
+287.726544 3984.06 4016
+287.738592 3984.06 4016
+287.750640 3984.06 4016
+287.762688 3984.06 4016
+287.774736 3984.06 4016
+287.786784 3984.06 4016
+287.798880 3968.25 4032
+287.810976 3968.25 4032
+287.823072 3968.25 4032
+287.835168 3968.25 4032
+287.847264 3968.25 4032
+287.859360 3968.25 4032
+287.871456 3968.25 4032
+287.883552 3968.25 4032
+287.895648 3968.25 4032
+287.907744 3968.25 4032
+287.919840 3968.25 4032
+287.931936 3968.25 4032
+287.944032 3968.25 4032
+287.956128 3968.25 4032
+287.968224 3968.25 4032
+287.980320 3968.25 4032
+287.992416 3968.25 4032
+288.004512 3968.25 4032
+288.016608 3968.25 4032
+288.028704 3968.25 4032
+288.040800 3968.25 4032
+288.052896 3968.25 4032
+288.064992 3968.25 4032
+288.077088 3968.25 4032
+288.089184 3968.25 4032
+288.101280 3968.25 4032
+288.113376 3968.25 4032
+288.125472 3968.25 4032
+288.137568 3968.25 4032
+288.149664 3968.25 4032
+288.161760 3968.25 4032
+288.173856 3968.25 4032
+288.186048 3937.01 4064
+288.198240 3937.01 4064
+288.210432 3937.01 4064
+288.222624 3937.01 4064
+288.234816 3937.01 4064
+288.247008 3937.01 4064
+288.259200 3937.01 4064
+288.271392 3937.01 4064
+288.283584 3937.01 4064
+288.295776 3937.01 4064
+288.307968 3937.01 4064
+288.320160 3937.01 4064
+288.332352 3937.01 4064
+288.344544 3937.01 4064
+288.356736 3937.01 4064
+288.368928 3937.01 4064
+288.381120 3937.01 4064
+288.393312 3937.01 4064
+288.405504 3937.01 4064
+288.417696 3937.01 4064
+288.429888 3937.01 4064
+288.442080 3937.01 4064
+288.454272 3937.01 4064
+288.466464 3937.01 4064
+288.478656 3937.01 4064
+288.490848 3937.01 4064
+288.503040 3937.01 4064
+288.515232 3937.01 4064
+288.527424 3937.01 4064
+288.539616 3937.01 4064
+288.551808 3937.01 4064
+288.564000 3937.01 4064
+288.576240 3921.57 4080
+288.588480 3921.57 4080
+288.600720 3921.57 4080
+288.612960 3921.57 4080
+288.625200 3921.57 4080
+288.637440 3921.57 4080
+288.649680 3921.57 4080
+288.661920 3921.57 4080
+288.674160 3921.57 4080
+288.686400 3921.57 4080
+288.698640 3921.57 4080
+288.710880 3921.57 4080
+288.723120 3921.57 4080
+288.735360 3921.57 4080
+288.747600 3921.57 4080
+288.759840 3921.57 4080
+288.772080 3921.57 4080
+288.784320 3921.57 4080
+288.796560 3921.57 4080
+288.808800 3921.57 4080
+288.821040 3921.57 4080
+288.833328 3906.25 4096
+288.845616 3906.25 4096
+288.857904 3906.25 4096
+288.870192 3906.25 4096
+288.882480 3906.25 4096
+288.894768 3906.25 4096
+288.907056 3906.25 4096
+288.919344 3906.25 4096
+288.931632 3906.25 4096
+288.943920 3906.25 4096
+288.956208 3906.25 4096
+288.968496 3906.25 4096
+288.980784 3906.25 4096
+288.993072 3906.25 4096
+289.005360 3906.25 4096
+289.017648 3906.25 4096
+289.029936 3906.25 4096
+289.042224 3906.25 4096
+289.054512 3906.25 4096
+289.066800 3906.25 4096
+289.079088 3906.25 4096
+289.091376 3906.25 4096
+289.103664 3906.25 4096
+289.115952 3906.25 4096
+289.128240 3906.25 4096
+289.140528 3906.25 4096
+289.152816 3906.25 4096
+289.165104 3906.25 4096
+289.177392 3906.25 4096
+289.189680 3906.25 4096
+289.201968 3906.25 4096
+289.214256 3906.25 4096
+289.226640 3875.97 4128
+289.239024 3875.97 4128
+289.251408 3875.97 4128
+289.263792 3875.97 4128
+289.276176 3875.97 4128
+289.288560 3875.97 4128
+289.300944 3875.97 4128
+289.313328 3875.97 4128
+289.325712 3875.97 4128
+289.338096 3875.97 4128
+289.350480 3875.97 4128
+289.362864 3875.97 4128
+289.375248 3875.97 4128
+289.387632 3875.97 4128
+289.400016 3875.97 4128
+289.412400 3875.97 4128
+289.424784 3875.97 4128
+289.437168 3875.97 4128
+289.449552 3875.97 4128
+289.461936 3875.97 4128
+289.474320 3875.97 4128
+289.486704 3875.97 4128
+289.499088 3875.97 4128
+289.511472 3875.97 4128
+289.523856 3875.97 4128
+289.536240 3875.97 4128
+289.548624 3875.97 4128
+289.561008 3875.97 4128
+289.573392 3875.97 4128
+289.585776 3875.97 4128
+289.598160 3875.97 4128
+289.610544 3875.97 4128
+289.622928 3875.97 4128
+289.635312 3875.97 4128
+289.647696 3875.97 4128
+289.660080 3875.97 4128
+289.672464 3875.97 4128
+289.684848 3875.97 4128
+289.697232 3875.97 4128
+289.709616 3875.97 4128
+289.722000 3875.97 4128
+289.734384 3875.97 4128
+289.746768 3875.97 4128
+289.759152 3875.97 4128
+289.771536 3875.97 4128
+289.783920 3875.97 4128
+289.796304 3875.97 4128
+289.808688 3875.97 4128
+289.821072 3875.97 4128
+289.833456 3875.97 4128
+289.845840 3875.97 4128
+289.858224 3875.97 4128
+289.870608 3875.97 4128
+289.883088 3846.15 4160
+289.895568 3846.15 4160
+289.908048 3846.15 4160
+289.920528 3846.15 4160
+289.933008 3846.15 4160
+289.945488 3846.15 4160
+289.957968 3846.15 4160
+289.970448 3846.15 4160
+289.982928 3846.15 4160
+289.995408 3846.15 4160
+290.007888 3846.15 4160
+290.020368 3846.15 4160
+290.032848 3846.15 4160
+290.045328 3846.15 4160
+290.057808 3846.15 4160
+290.070288 3846.15 4160
+290.082768 3846.15 4160
+290.095248 3846.15 4160
+290.107728 3846.15 4160
+290.120208 3846.15 4160
+290.132688 3846.15 4160
+290.145168 3846.15 4160
+290.157744 3816.79 4192
+290.170320 3816.79 4192
+290.182896 3816.79 4192
+290.195472 3816.79 4192
+290.208048 3816.79 4192
+290.220624 3816.79 4192
+290.233200 3816.79 4192
+290.245776 3816.79 4192
+290.258352 3816.79 4192
+290.270928 3816.79 4192
+290.283504 3816.79 4192
+290.296080 3816.79 4192
+290.308656 3816.79 4192
+290.321232 3816.79 4192
+290.333808 3816.79 4192
+290.346384 3816.79 4192
+290.358960 3816.79 4192
+290.371536 3816.79 4192
+290.384112 3816.79 4192
+290.396688 3816.79 4192
+290.409264 3816.79 4192
+290.421840 3816.79 4192
+290.434416 3816.79 4192
+290.446992 3816.79 4192
+290.459568 3816.79 4192
+290.472144 3816.79 4192
+290.484720 3816.79 4192
+290.497296 3816.79 4192
+290.509872 3816.79 4192
+290.522448 3816.79 4192
+290.535024 3816.79 4192
+290.547600 3816.79 4192
+290.560272 3787.88 4224
+290.572944 3787.88 4224
+290.585616 3787.88 4224
+290.598288 3787.88 4224
+290.610960 3787.88 4224
+290.623632 3787.88 4224
+290.636304 3787.88 4224
+290.648976 3787.88 4224
+290.661648 3787.88 4224
+290.674320 3787.88 4224
+290.686992 3787.88 4224
+290.699664 3787.88 4224
+290.712336 3787.88 4224
+290.725008 3787.88 4224
+290.737680 3787.88 4224
+290.750352 3787.88 4224
+290.763024 3787.88 4224
+290.775696 3787.88 4224
+290.788368 3787.88 4224
+290.801040 3787.88 4224
+290.813712 3787.88 4224
+290.826384 3787.88 4224
+290.839056 3787.88 4224
+290.851728 3787.88 4224
+290.864400 3787.88 4224
+290.877072 3787.88 4224
+290.889744 3787.88 4224
+290.902416 3787.88 4224
+290.915088 3787.88 4224
+290.927760 3787.88 4224
+290.940432 3787.88 4224
+290.953104 3787.88 4224
+290.965776 3787.88 4224
+290.978448 3787.88 4224
+290.991120 3787.88 4224
+291.003792 3787.88 4224
+291.016464 3787.88 4224
+291.029136 3787.88 4224
+291.041808 3787.88 4224
+291.054480 3787.88 4224
+291.067152 3787.88 4224
+291.079824 3787.88 4224
+291.092496 3787.88 4224
+291.105168 3787.88 4224
+291.117840 3787.88 4224
+291.130512 3787.88 4224
+291.143184 3787.88 4224
+291.155856 3787.88 4224
+291.168528 3787.88 4224
+291.181200 3787.88 4224
+291.193872 3787.88 4224
+291.206544 3787.88 4224
+291.219216 3787.88 4224
+291.231984 3759.40 4256
+291.244752 3759.40 4256
+291.257520 3759.40 4256
+291.270288 3759.40 4256
+291.283056 3759.40 4256
+291.295824 3759.40 4256
+291.308592 3759.40 4256
+291.321360 3759.40 4256
+291.334128 3759.40 4256
+291.346896 3759.40 4256
+291.359664 3759.40 4256
+291.372432 3759.40 4256
+291.385200 3759.40 4256
+291.397968 3759.40 4256
+291.410736 3759.40 4256
+291.423504 3759.40 4256
+291.436272 3759.40 4256
+291.449040 3759.40 4256
+291.461808 3759.40 4256
+291.474576 3759.40 4256
+291.487344 3759.40 4256
+291.500208 3731.34 4288
+291.513072 3731.34 4288
+291.525936 3731.34 4288
+291.538800 3731.34 4288
+291.551664 3731.34 4288
+291.564528 3731.34 4288
+291.577392 3731.34 4288
+291.590256 3731.34 4288
+291.603120 3731.34 4288
+291.615984 3731.34 4288
+291.628848 3731.34 4288
+291.641712 3731.34 4288
+291.654576 3731.34 4288
+291.667440 3731.34 4288
+291.680304 3731.34 4288
+291.693168 3731.34 4288
+291.706032 3731.34 4288
+291.718896 3731.34 4288
+291.731760 3731.34 4288
+291.744624 3731.34 4288
+291.757488 3731.34 4288
+291.770352 3731.34 4288
+291.783312 3703.70 4320
+291.796272 3703.70 4320
+291.809232 3703.70 4320
+291.822192 3703.70 4320
+291.835152 3703.70 4320
+291.848112 3703.70 4320
+291.861072 3703.70 4320
+291.874032 3703.70 4320
+291.886992 3703.70 4320
+291.899952 3703.70 4320
+291.912912 3703.70 4320
+291.925872 3703.70 4320
+291.938832 3703.70 4320
+291.951792 3703.70 4320
+291.964752 3703.70 4320
+291.977712 3703.70 4320
+291.990672 3703.70 4320
+292.003632 3703.70 4320
+292.016592 3703.70 4320
+292.029552 3703.70 4320
+292.042512 3703.70 4320
+292.055472 3703.70 4320
+292.068432 3703.70 4320
+292.081392 3703.70 4320
+292.094352 3703.70 4320
+292.107312 3703.70 4320
+292.120272 3703.70 4320
+292.133232 3703.70 4320
+292.146192 3703.70 4320
+292.159152 3703.70 4320
+292.172112 3703.70 4320
+292.185072 3703.70 4320
+292.198032 3703.70 4320
+292.210992 3703.70 4320
+292.223952 3703.70 4320
+292.236912 3703.70 4320
+292.249872 3703.70 4320
+292.262832 3703.70 4320
+292.275792 3703.70 4320
+292.288752 3703.70 4320
+292.301712 3703.70 4320
+292.314672 3703.70 4320
+292.327632 3703.70 4320
+292.340592 3703.70 4320
+292.353552 3703.70 4320
+292.366512 3703.70 4320
+292.379472 3703.70 4320
+292.392432 3703.70 4320
+292.405392 3703.70 4320
+292.418352 3703.70 4320
+292.431312 3703.70 4320
+292.444272 3703.70 4320
+292.457232 3703.70 4320
+292.470288 3676.47 4352
+292.483344 3676.47 4352
+292.496400 3676.47 4352
+292.509456 3676.47 4352
+292.522512 3676.47 4352
+292.535568 3676.47 4352
+292.548624 3676.47 4352
+292.561680 3676.47 4352
+292.574736 3676.47 4352
+292.587792 3676.47 4352
+292.600848 3676.47 4352
+292.613904 3676.47 4352
+292.626960 3676.47 4352
+292.640016 3676.47 4352
+292.653072 3676.47 4352
+292.666128 3676.47 4352
+292.679184 3676.47 4352
+292.692240 3676.47 4352
+292.705296 3676.47 4352
+292.718352 3676.47 4352
+292.731408 3676.47 4352
+292.744560 3649.64 4384
+292.757712 3649.64 4384
+292.770864 3649.64 4384
+292.784016 3649.64 4384
+292.797168 3649.64 4384
+292.810320 3649.64 4384
+292.823472 3649.64 4384
+292.836624 3649.64 4384
+292.849776 3649.64 4384
+292.862928 3649.64 4384
+292.876080 3649.64 4384
+292.889232 3649.64 4384
+292.902384 3649.64 4384
+292.915536 3649.64 4384
+292.928688 3649.64 4384
+292.941840 3649.64 4384
+292.954992 3649.64 4384
+292.968144 3649.64 4384
+292.981296 3649.64 4384
+292.994448 3649.64 4384
+293.007600 3649.64 4384
+293.020752 3649.64 4384
+293.033904 3649.64 4384
+293.047056 3649.64 4384
+293.060208 3649.64 4384
+293.073360 3649.64 4384
+293.086512 3649.64 4384
+293.099664 3649.64 4384
+293.112816 3649.64 4384
+293.125968 3649.64 4384
+293.139120 3649.64 4384
+293.152272 3649.64 4384
+293.165424 3649.64 4384
+293.178576 3649.64 4384
+293.191728 3649.64 4384
+293.204880 3649.64 4384
+293.218032 3649.64 4384
+293.231184 3649.64 4384
+293.244336 3649.64 4384
+293.257488 3649.64 4384
+293.270640 3649.64 4384
+293.283792 3649.64 4384
+293.296944 3649.64 4384
+293.310096 3649.64 4384
+293.323248 3649.64 4384
+293.336400 3649.64 4384
+293.349552 3649.64 4384
+293.362704 3649.64 4384
+293.375856 3649.64 4384
+293.389008 3649.64 4384
+293.402160 3649.64 4384
+293.415312 3649.64 4384
+293.428464 3649.64 4384
+293.441616 3649.64 4384
+293.454864 3623.19 4416
+293.468112 3623.19 4416
+293.481360 3623.19 4416
+293.494608 3623.19 4416
+293.507856 3623.19 4416
+293.521104 3623.19 4416
+293.534352 3623.19 4416
+293.547600 3623.19 4416
+293.560848 3623.19 4416
+293.574096 3623.19 4416
+293.587344 3623.19 4416
+293.600592 3623.19 4416
+293.613840 3623.19 4416
+293.627088 3623.19 4416
+293.640336 3623.19 4416
+293.653584 3623.19 4416
+293.666832 3623.19 4416
+293.680080 3623.19 4416
+293.693328 3623.19 4416
+293.706576 3623.19 4416
+293.719824 3623.19 4416
+293.733168 3597.12 4448
+293.746512 3597.12 4448
+293.759856 3597.12 4448
+293.773200 3597.12 4448
+293.786544 3597.12 4448
+293.799888 3597.12 4448
+293.813232 3597.12 4448
+293.826576 3597.12 4448
+293.839920 3597.12 4448
+293.853264 3597.12 4448
+293.866608 3597.12 4448
+293.879952 3597.12 4448
+293.893296 3597.12 4448
+293.906640 3597.12 4448
+293.919984 3597.12 4448
+293.933328 3597.12 4448
+293.946672 3597.12 4448
+293.960016 3597.12 4448
+293.973360 3597.12 4448
+293.986704 3597.12 4448
+294.000048 3597.12 4448
+294.013488 3571.43 4480
+294.026928 3571.43 4480
+294.040368 3571.43 4480
+294.053808 3571.43 4480
+294.067248 3571.43 4480
+294.080688 3571.43 4480
+294.094128 3571.43 4480
+294.107568 3571.43 4480
+294.121008 3571.43 4480
+294.134448 3571.43 4480
+294.147888 3571.43 4480
+294.161328 3571.43 4480
+294.174768 3571.43 4480
+294.188208 3571.43 4480
+294.201648 3571.43 4480
+294.215088 3571.43 4480
+294.228528 3571.43 4480
+294.241968 3571.43 4480
+294.255408 3571.43 4480
+294.268848 3571.43 4480
+294.282288 3571.43 4480
+294.295728 3571.43 4480
+294.309168 3571.43 4480
+294.322608 3571.43 4480
+294.336048 3571.43 4480
+294.349488 3571.43 4480
+294.362928 3571.43 4480
+294.376368 3571.43 4480
+294.389808 3571.43 4480
+294.403248 3571.43 4480
+294.416688 3571.43 4480
+294.430128 3571.43 4480
+294.443568 3571.43 4480
+294.457008 3571.43 4480
+294.470448 3571.43 4480
+294.483888 3571.43 4480
+294.497328 3571.43 4480
+294.510768 3571.43 4480
+294.524208 3571.43 4480
+294.537648 3571.43 4480
+294.551088 3571.43 4480
+294.564528 3571.43 4480
+294.577968 3571.43 4480
+294.591504 3546.10 4512
+294.605040 3546.10 4512
+294.618576 3546.10 4512
+294.632112 3546.10 4512
+294.645648 3546.10 4512
+294.659184 3546.10 4512
+294.672720 3546.10 4512
+294.686256 3546.10 4512
+294.699792 3546.10 4512
+294.713328 3546.10 4512
+294.726864 3546.10 4512
+294.740400 3546.10 4512
+294.753936 3546.10 4512
+294.767472 3546.10 4512
+294.781008 3546.10 4512
+294.794544 3546.10 4512
+294.808080 3546.10 4512
+294.821616 3546.10 4512
+294.835152 3546.10 4512
+294.848688 3546.10 4512
+294.862224 3546.10 4512
+294.875760 3546.10 4512
+294.889296 3546.10 4512
+294.902832 3546.10 4512
+294.916368 3546.10 4512
+294.929904 3546.10 4512
+294.943440 3546.10 4512
+294.956976 3546.10 4512
+294.970512 3546.10 4512
+294.984048 3546.10 4512
+294.997584 3546.10 4512
+295.011120 3546.10 4512
+295.024752 3521.13 4544
+295.038384 3521.13 4544
+295.052016 3521.13 4544
+295.065648 3521.13 4544
+295.079280 3521.13 4544
+295.092912 3521.13 4544
+295.106544 3521.13 4544
+295.120176 3521.13 4544
+295.133808 3521.13 4544
+295.147440 3521.13 4544
+295.161072 3521.13 4544
+295.174704 3521.13 4544
+295.188336 3521.13 4544
+295.201968 3521.13 4544
+295.215600 3521.13 4544
+295.229232 3521.13 4544
+295.242864 3521.13 4544
+295.256496 3521.13 4544
+295.270128 3521.13 4544
+295.283760 3521.13 4544
+295.297392 3521.13 4544
+295.311120 3496.50 4576
+295.324848 3496.50 4576
+295.338576 3496.50 4576
+295.352304 3496.50 4576
+295.366032 3496.50 4576
+295.379760 3496.50 4576
+295.393488 3496.50 4576
+295.407216 3496.50 4576
+295.420944 3496.50 4576
+295.434672 3496.50 4576
+295.448400 3496.50 4576
+295.462128 3496.50 4576
+295.475856 3496.50 4576
+295.489584 3496.50 4576
+295.503312 3496.50 4576
+295.517040 3496.50 4576
+295.530768 3496.50 4576
+295.544496 3496.50 4576
+295.558224 3496.50 4576
+295.571952 3496.50 4576
+295.585680 3496.50 4576
+295.599408 3496.50 4576
+295.613232 3472.22 4608
+295.627056 3472.22 4608
+295.640880 3472.22 4608
+295.654704 3472.22 4608
+295.668528 3472.22 4608
+295.682352 3472.22 4608
+295.696176 3472.22 4608
+295.710000 3472.22 4608
+295.723824 3472.22 4608
+295.737648 3472.22 4608
+295.751472 3472.22 4608
+295.765296 3472.22 4608
+295.779120 3472.22 4608
+295.792944 3472.22 4608
+295.806768 3472.22 4608
+295.820592 3472.22 4608
+295.834416 3472.22 4608
+295.848240 3472.22 4608
+295.862064 3472.22 4608
+295.875888 3472.22 4608
+295.889712 3472.22 4608
+295.903536 3472.22 4608
+295.917360 3472.22 4608
+295.931184 3472.22 4608
+295.945008 3472.22 4608
+295.958832 3472.22 4608
+295.972656 3472.22 4608
+295.986480 3472.22 4608
+296.000304 3472.22 4608
+296.014128 3472.22 4608
+296.027952 3472.22 4608
+296.041776 3472.22 4608
+296.055600 3472.22 4608
+296.069424 3472.22 4608
+296.083248 3472.22 4608
+296.097072 3472.22 4608
+296.110896 3472.22 4608
+296.124720 3472.22 4608
+296.138544 3472.22 4608
+296.152368 3472.22 4608
+296.166192 3472.22 4608
+296.180016 3472.22 4608
+296.193936 3448.28 4640
+296.207856 3448.28 4640
+296.221776 3448.28 4640
+296.235696 3448.28 4640
+296.249616 3448.28 4640
+296.263536 3448.28 4640
+296.277456 3448.28 4640
+296.291376 3448.28 4640
+296.305296 3448.28 4640
+296.319216 3448.28 4640
+296.333136 3448.28 4640
+296.347056 3448.28 4640
+296.360976 3448.28 4640
+296.374896 3448.28 4640
+296.388816 3448.28 4640
+296.402736 3448.28 4640
+296.416656 3448.28 4640
+296.430576 3448.28 4640
+296.444496 3448.28 4640
+296.458416 3448.28 4640
+296.472336 3448.28 4640
+296.486256 3448.28 4640
+296.500272 3424.66 4672
+296.514288 3424.66 4672
+296.528304 3424.66 4672
+296.542320 3424.66 4672
+296.556336 3424.66 4672
+296.570352 3424.66 4672
+296.584368 3424.66 4672
+296.598384 3424.66 4672
+296.612400 3424.66 4672
+296.626416 3424.66 4672
+296.640432 3424.66 4672
+296.654448 3424.66 4672
+296.668464 3424.66 4672
+296.682480 3424.66 4672
+296.696496 3424.66 4672
+296.710512 3424.66 4672
+296.724528 3424.66 4672
+296.738544 3424.66 4672
+296.752560 3424.66 4672
+296.766576 3424.66 4672
+296.780592 3424.66 4672
+296.794704 3401.36 4704
+296.808816 3401.36 4704
+296.822928 3401.36 4704
+296.837040 3401.36 4704
+296.851152 3401.36 4704
+296.865264 3401.36 4704
+296.879376 3401.36 4704
+296.893488 3401.36 4704
+296.907600 3401.36 4704
+296.921712 3401.36 4704
+296.935824 3401.36 4704
+296.949936 3401.36 4704
+296.964048 3401.36 4704
+296.978160 3401.36 4704
+296.992272 3401.36 4704
+297.006384 3401.36 4704
+297.020496 3401.36 4704
+297.034608 3401.36 4704
+297.048720 3401.36 4704
+297.062832 3401.36 4704
+297.076944 3401.36 4704
+297.091056 3401.36 4704
+297.105168 3401.36 4704
+297.119280 3401.36 4704
+297.133392 3401.36 4704
+297.147504 3401.36 4704
+297.161616 3401.36 4704
+297.175728 3401.36 4704
+297.189840 3401.36 4704
+297.203952 3401.36 4704
+297.218064 3401.36 4704
+297.232176 3401.36 4704
+297.246288 3401.36 4704
+297.260400 3401.36 4704
+297.274512 3401.36 4704
+297.288624 3401.36 4704
+297.302736 3401.36 4704
+297.316848 3401.36 4704
+297.330960 3401.36 4704
+297.345072 3401.36 4704
+297.359184 3401.36 4704
+297.373296 3401.36 4704
+297.387408 3401.36 4704
+297.401616 3378.38 4736
+297.415824 3378.38 4736
+297.430032 3378.38 4736
+297.444240 3378.38 4736
+297.458448 3378.38 4736
+297.472656 3378.38 4736
+297.486864 3378.38 4736
+297.501072 3378.38 4736
+297.515280 3378.38 4736
+297.529488 3378.38 4736
+297.543696 3378.38 4736
+297.557904 3378.38 4736
+297.572112 3378.38 4736
+297.586320 3378.38 4736
+297.600528 3378.38 4736
+297.614736 3378.38 4736
+297.628944 3378.38 4736
+297.643152 3378.38 4736
+297.657360 3378.38 4736
+297.671568 3378.38 4736
+297.685776 3378.38 4736
+297.700080 3355.70 4768
+297.714384 3355.70 4768
+297.728688 3355.70 4768
+297.742992 3355.70 4768
+297.757296 3355.70 4768
+297.771600 3355.70 4768
+297.785904 3355.70 4768
+297.800208 3355.70 4768
+297.814512 3355.70 4768
+297.828816 3355.70 4768
+297.843120 3355.70 4768
+297.857520 3333.33 4800
+297.871920 3333.33 4800
+297.886320 3333.33 4800
+297.900720 3333.33 4800
+297.915120 3333.33 4800
+297.929520 3333.33 4800
+297.943920 3333.33 4800
+297.958320 3333.33 4800
+297.972720 3333.33 4800
+297.987120 3333.33 4800
+298.001520 3333.33 4800
+298.015920 3333.33 4800
+298.030320 3333.33 4800
+298.044720 3333.33 4800
+298.059120 3333.33 4800
+298.073520 3333.33 4800
+298.087920 3333.33 4800
+298.102320 3333.33 4800
+298.116720 3333.33 4800
+298.131120 3333.33 4800
+298.145520 3333.33 4800
+298.160016 3311.26 4832
+298.174512 3311.26 4832
+298.189008 3311.26 4832
+298.203504 3311.26 4832
+298.218000 3311.26 4832
+298.232496 3311.26 4832
+298.246992 3311.26 4832
+298.261488 3311.26 4832
+298.275984 3311.26 4832
+298.290480 3311.26 4832
+298.304976 3311.26 4832
+298.319472 3311.26 4832
+298.333968 3311.26 4832
+298.348464 3311.26 4832
+298.362960 3311.26 4832
+298.377456 3311.26 4832
+298.391952 3311.26 4832
+298.406448 3311.26 4832
+298.420944 3311.26 4832
+298.435440 3311.26 4832
+298.449936 3311.26 4832
+298.464528 3289.47 4864
+298.479120 3289.47 4864
+298.493712 3289.47 4864
+298.508304 3289.47 4864
+298.522896 3289.47 4864
+298.537488 3289.47 4864
+298.552080 3289.47 4864
+298.566672 3289.47 4864
+298.581264 3289.47 4864
+298.595856 3289.47 4864
+298.610448 3289.47 4864
+298.625040 3289.47 4864
+298.639632 3289.47 4864
+298.654224 3289.47 4864
+298.668816 3289.47 4864
+298.683408 3289.47 4864
+298.698000 3289.47 4864
+298.712592 3289.47 4864
+298.727184 3289.47 4864
+298.741776 3289.47 4864
+298.756368 3289.47 4864
+298.770960 3289.47 4864
+298.785552 3289.47 4864
+298.800144 3289.47 4864
+298.814736 3289.47 4864
+298.829328 3289.47 4864
+298.843920 3289.47 4864
+298.858512 3289.47 4864
+298.873104 3289.47 4864
+298.887696 3289.47 4864
+298.902288 3289.47 4864
+298.916880 3289.47 4864
+298.931472 3289.47 4864
+298.946064 3289.47 4864
+298.960656 3289.47 4864
+298.975248 3289.47 4864
+298.989840 3289.47 4864
+299.004432 3289.47 4864
+299.019024 3289.47 4864
+299.033616 3289.47 4864
+299.048208 3289.47 4864
+299.062800 3289.47 4864
+299.077392 3289.47 4864
+299.092080 3267.97 4896
+299.106768 3267.97 4896
+299.121456 3267.97 4896
+299.136144 3267.97 4896
+299.150832 3267.97 4896
+299.165520 3267.97 4896
+299.180208 3267.97 4896
+299.194896 3267.97 4896
+299.209584 3267.97 4896
+299.224272 3267.97 4896
+299.238960 3267.97 4896
+299.253648 3267.97 4896
+299.268336 3267.97 4896
+299.283024 3267.97 4896
+299.297712 3267.97 4896
+299.312400 3267.97 4896
+299.327088 3267.97 4896
+299.341776 3267.97 4896
+299.356464 3267.97 4896
+299.371152 3267.97 4896
+299.385840 3267.97 4896
+299.400624 3246.75 4928
+299.415408 3246.75 4928
+299.430192 3246.75 4928
+299.444976 3246.75 4928
+299.459760 3246.75 4928
+299.474544 3246.75 4928
+299.489328 3246.75 4928
+299.504112 3246.75 4928
+299.518896 3246.75 4928
+299.533680 3246.75 4928
+299.548464 3246.75 4928
+299.563344 3225.81 4960
+299.578224 3225.81 4960
+299.593104 3225.81 4960
+299.607984 3225.81 4960
+299.622864 3225.81 4960
+299.637744 3225.81 4960
+299.652624 3225.81 4960
+299.667504 3225.81 4960
+299.682384 3225.81 4960
+299.697264 3225.81 4960
+299.712144 3225.81 4960
+299.727024 3225.81 4960
+299.741904 3225.81 4960
+299.756784 3225.81 4960
+299.771664 3225.81 4960
+299.786544 3225.81 4960
+299.801424 3225.81 4960
+299.816304 3225.81 4960
+299.831184 3225.81 4960
+299.846064 3225.81 4960
+299.860944 3225.81 4960
+299.875920 3205.13 4992
+299.890896 3205.13 4992
+299.905872 3205.13 4992
+299.920848 3205.13 4992
+299.935824 3205.13 4992
+299.950800 3205.13 4992
+299.965776 3205.13 4992
+299.980752 3205.13 4992
+299.995728 3205.13 4992
+300.010704 3205.13 4992
+300.025680 3205.13 4992
+300.040656 3205.13 4992
+300.055632 3205.13 4992
+300.070608 3205.13 4992
+300.085584 3205.13 4992
+300.100560 3205.13 4992
+300.115536 3205.13 4992
+300.130512 3205.13 4992
+300.145488 3205.13 4992
+300.160464 3205.13 4992
+300.175440 3205.13 4992
+300.190416 3205.13 4992
+300.205488 3184.71 5024
+300.220560 3184.71 5024
+300.235632 3184.71 5024
+300.250704 3184.71 5024
+300.265776 3184.71 5024
+300.280848 3184.71 5024
+300.295920 3184.71 5024
+300.310992 3184.71 5024
+300.326064 3184.71 5024
+300.341136 3184.71 5024
+300.356208 3184.71 5024
+300.371280 3184.71 5024
+300.386352 3184.71 5024
+300.401424 3184.71 5024
+300.416496 3184.71 5024
+300.431568 3184.71 5024
+300.446640 3184.71 5024
+300.461712 3184.71 5024
+300.476784 3184.71 5024
+300.491856 3184.71 5024
+300.506928 3184.71 5024
+300.522000 3184.71 5024
+300.537072 3184.71 5024
+300.552144 3184.71 5024
+300.567216 3184.71 5024
+300.582288 3184.71 5024
+300.597360 3184.71 5024
+300.612432 3184.71 5024
+300.627504 3184.71 5024
+300.642576 3184.71 5024
+300.657648 3184.71 5024
+300.672720 3184.71 5024
+300.687888 3164.56 5056
+300.703056 3164.56 5056
+300.718224 3164.56 5056
+300.733392 3164.56 5056
+300.748560 3164.56 5056
+300.763728 3164.56 5056
+300.778896 3164.56 5056
+300.794064 3164.56 5056
+300.809232 3164.56 5056
+300.824400 3164.56 5056
+300.839568 3164.56 5056
+300.854736 3164.56 5056
+300.869904 3164.56 5056
+300.885072 3164.56 5056
+300.900240 3164.56 5056
+300.915408 3164.56 5056
+300.930576 3164.56 5056
+300.945744 3164.56 5056
+300.960912 3164.56 5056
+300.976080 3164.56 5056
+300.991248 3164.56 5056
+301.006512 3144.65 5088
+301.021776 3144.65 5088
+301.037040 3144.65 5088
+301.052304 3144.65 5088
+301.067568 3144.65 5088
+301.082832 3144.65 5088
+301.098096 3144.65 5088
+301.113360 3144.65 5088
+301.128624 3144.65 5088
+301.143888 3144.65 5088
+301.159152 3144.65 5088
+301.174416 3144.65 5088
+301.189680 3144.65 5088
+301.204944 3144.65 5088
+301.220208 3144.65 5088
+301.235472 3144.65 5088
+301.250736 3144.65 5088
+301.266000 3144.65 5088
+301.281264 3144.65 5088
+301.296528 3144.65 5088
+301.311792 3144.65 5088
+301.327152 3125.00 5120
+301.342512 3125.00 5120
+301.357872 3125.00 5120
+301.373232 3125.00 5120
+301.388592 3125.00 5120
+301.403952 3125.00 5120
+301.419312 3125.00 5120
+301.434672 3125.00 5120
+301.450032 3125.00 5120
+301.465392 3125.00 5120
+301.480752 3125.00 5120
+301.496208 3105.59 5152
+301.511664 3105.59 5152
+301.527120 3105.59 5152
+301.542576 3105.59 5152
+301.558032 3105.59 5152
+301.573488 3105.59 5152
+301.588944 3105.59 5152
+301.604400 3105.59 5152
+301.619856 3105.59 5152
+301.635312 3105.59 5152
+301.650768 3105.59 5152
+301.666224 3105.59 5152
+301.681680 3105.59 5152
+301.697136 3105.59 5152
+301.712592 3105.59 5152
+301.728048 3105.59 5152
+301.743504 3105.59 5152
+301.758960 3105.59 5152
+301.774416 3105.59 5152
+301.789872 3105.59 5152
+301.805328 3105.59 5152
+301.820880 3086.42 5184
+301.836432 3086.42 5184
+301.851984 3086.42 5184
+301.867536 3086.42 5184
+301.883088 3086.42 5184
+301.898640 3086.42 5184
+301.914192 3086.42 5184
+301.929744 3086.42 5184
+301.945296 3086.42 5184
+301.960848 3086.42 5184
+301.976400 3086.42 5184
+301.991952 3086.42 5184
+302.007504 3086.42 5184
+302.023056 3086.42 5184
+302.038608 3086.42 5184
+302.054160 3086.42 5184
+302.069712 3086.42 5184
+302.085264 3086.42 5184
+302.100816 3086.42 5184
+302.116368 3086.42 5184
+302.131920 3086.42 5184
+302.147472 3086.42 5184
+302.163120 3067.48 5216
+302.178768 3067.48 5216
+302.194416 3067.48 5216
+302.210064 3067.48 5216
+302.225712 3067.48 5216
+302.241360 3067.48 5216
+302.257008 3067.48 5216
+302.272656 3067.48 5216
+302.288304 3067.48 5216
+302.303952 3067.48 5216
+302.319600 3067.48 5216
+302.335248 3067.48 5216
+302.350896 3067.48 5216
+302.366544 3067.48 5216
+302.382192 3067.48 5216
+302.397840 3067.48 5216
+302.413488 3067.48 5216
+302.429136 3067.48 5216
+302.444784 3067.48 5216
+302.460432 3067.48 5216
+302.476080 3067.48 5216
+302.491728 3067.48 5216
+302.507376 3067.48 5216
+302.523024 3067.48 5216
+302.538672 3067.48 5216
+302.554320 3067.48 5216
+302.569968 3067.48 5216
+302.585616 3067.48 5216
+302.601264 3067.48 5216
+302.616912 3067.48 5216
+302.632560 3067.48 5216
+302.648208 3067.48 5216
+302.663952 3048.78 5248
+302.679696 3048.78 5248
+302.695440 3048.78 5248
+302.711184 3048.78 5248
+302.726928 3048.78 5248
+302.742672 3048.78 5248
+302.758416 3048.78 5248
+302.774160 3048.78 5248
+302.789904 3048.78 5248
+302.805648 3048.78 5248
+302.821488 3030.30 5280
+302.837328 3030.30 5280
+302.853168 3030.30 5280
+302.869008 3030.30 5280
+302.884848 3030.30 5280
+302.900688 3030.30 5280
+302.916528 3030.30 5280
+302.932368 3030.30 5280
+302.948208 3030.30 5280
+302.964048 3030.30 5280
+302.979888 3030.30 5280
+302.995728 3030.30 5280
+303.011568 3030.30 5280
+303.027408 3030.30 5280
+303.043248 3030.30 5280
+303.059088 3030.30 5280
+303.074928 3030.30 5280
+303.090768 3030.30 5280
+303.106608 3030.30 5280
+303.122448 3030.30 5280
+303.138288 3030.30 5280
+303.154128 3030.30 5280
+303.170064 3012.05 5312
+303.186000 3012.05 5312
+303.201936 3012.05 5312
+303.217872 3012.05 5312
+303.233808 3012.05 5312
+303.249744 3012.05 5312
+303.265680 3012.05 5312
+303.281616 3012.05 5312
+303.297552 3012.05 5312
+303.313488 3012.05 5312
+303.329520 2994.01 5344
+303.340208 2994.01 5344
+303.350896 2994.01 5344
+303.361584 2994.01 5344
+303.372272 2994.01 5344
+303.382960 2994.01 5344
+303.393648 2994.01 5344
+303.404336 2994.01 5344
+303.415024 2994.01 5344
+303.425712 2994.01 5344
+303.436400 2994.01 5344
+303.447088 2994.01 5344
+303.457776 2994.01 5344
+303.468464 2994.01 5344
+303.479152 2994.01 5344
+303.489840 2994.01 5344
+303.500528 2994.01 5344
+303.511216 2994.01 5344
+303.521904 2994.01 5344
+303.532592 2994.01 5344
+303.543280 2994.01 5344
+303.553968 2994.01 5344
+303.564656 2994.01 5344
+303.575344 2994.01 5344
+303.586032 2994.01 5344
+303.596720 2994.01 5344
+303.607408 2994.01 5344
+303.618096 2994.01 5344
+303.628784 2994.01 5344
+303.639472 2994.01 5344
+303.650160 2994.01 5344
+303.660848 2994.01 5344
+303.671600 2976.19 5376
+303.682352 2976.19 5376
+303.693104 2976.19 5376
+303.703856 2976.19 5376
+303.714608 2976.19 5376
+303.725360 2976.19 5376
+303.736112 2976.19 5376
+303.746864 2976.19 5376
+303.757616 2976.19 5376
+303.768368 2976.19 5376
+303.779120 2976.19 5376
+303.789872 2976.19 5376
+303.800624 2976.19 5376
+303.811376 2976.19 5376
+303.822128 2976.19 5376
+303.832880 2976.19 5376
+303.843696 2958.58 5408
+303.854512 2958.58 5408
+303.865328 2958.58 5408
+303.876144 2958.58 5408
+303.886960 2958.58 5408
+303.897776 2958.58 5408
+303.908592 2958.58 5408
+303.919408 2958.58 5408
+303.930224 2958.58 5408
+303.941040 2958.58 5408
+303.951856 2958.58 5408
+303.962672 2958.58 5408
+303.973488 2958.58 5408
+303.984304 2958.58 5408
+303.995120 2958.58 5408
+304.005936 2958.58 5408
+304.016752 2958.58 5408
+304.027568 2958.58 5408
+304.038384 2958.58 5408
+304.049200 2958.58 5408
+304.060016 2958.58 5408
+304.070832 2958.58 5408
+304.081648 2958.58 5408
+304.092464 2958.58 5408
+304.103280 2958.58 5408
+304.114096 2958.58 5408
+304.124912 2958.58 5408
+304.135728 2958.58 5408
+304.146544 2958.58 5408
+304.157360 2958.58 5408
+304.168176 2958.58 5408
+304.178992 2958.58 5408
+304.189872 2941.18 5440
+304.200752 2941.18 5440
+304.211632 2941.18 5440
+304.222512 2941.18 5440
+304.233392 2941.18 5440
+304.244272 2941.18 5440
+304.255152 2941.18 5440
+304.266032 2941.18 5440
+304.276912 2941.18 5440
+304.287792 2941.18 5440
+304.298672 2941.18 5440
+304.309552 2941.18 5440
+304.320432 2941.18 5440
+304.331312 2941.18 5440
+304.342192 2941.18 5440
+304.353072 2941.18 5440
+304.364016 2923.98 5472
+304.374960 2923.98 5472
+304.385904 2923.98 5472
+304.396848 2923.98 5472
+304.407792 2923.98 5472
+304.418736 2923.98 5472
+304.429680 2923.98 5472
+304.440624 2923.98 5472
+304.451568 2923.98 5472
+304.462512 2923.98 5472
+304.473456 2923.98 5472
+304.484400 2923.98 5472
+304.495344 2923.98 5472
+304.506288 2923.98 5472
+304.517232 2923.98 5472
+304.528176 2923.98 5472
+304.539120 2923.98 5472
+304.550064 2923.98 5472
+304.561008 2923.98 5472
+304.571952 2923.98 5472
+304.582896 2923.98 5472
+304.593840 2923.98 5472
+304.604784 2923.98 5472
+304.615728 2923.98 5472
+304.626672 2923.98 5472
+304.637616 2923.98 5472
+304.648560 2923.98 5472
+304.659504 2923.98 5472
+304.670448 2923.98 5472
+304.681392 2923.98 5472
+304.692336 2923.98 5472
+304.703280 2923.98 5472
+304.714288 2906.98 5504
+304.725296 2906.98 5504
+304.736304 2906.98 5504
+304.747312 2906.98 5504
+304.758320 2906.98 5504
+304.769328 2906.98 5504
+304.780336 2906.98 5504
+304.791344 2906.98 5504
+304.802352 2906.98 5504
+304.813360 2906.98 5504
+304.824368 2906.98 5504
+304.835376 2906.98 5504
+304.846384 2906.98 5504
+304.857392 2906.98 5504
+304.868400 2906.98 5504
+304.879408 2906.98 5504
+304.890480 2890.17 5536
+304.901552 2890.17 5536
+304.912624 2890.17 5536
+304.923696 2890.17 5536
+304.934768 2890.17 5536
+304.945840 2890.17 5536
+304.956912 2890.17 5536
+304.967984 2890.17 5536
+304.979056 2890.17 5536
+304.990128 2890.17 5536
+305.001200 2890.17 5536
+305.012272 2890.17 5536
+305.023344 2890.17 5536
+305.034416 2890.17 5536
+305.045488 2890.17 5536
+305.056560 2890.17 5536
+305.067632 2890.17 5536
+305.078704 2890.17 5536
+305.089776 2890.17 5536
+305.100848 2890.17 5536
+305.111920 2890.17 5536
+305.122992 2890.17 5536
+305.134064 2890.17 5536
+305.145136 2890.17 5536
+305.156208 2890.17 5536
+305.167280 2890.17 5536
+305.178352 2890.17 5536
+305.189424 2890.17 5536
+305.200496 2890.17 5536
+305.211568 2890.17 5536
+305.222640 2890.17 5536
+305.233712 2890.17 5536
+305.244848 2873.56 5568
+305.255984 2873.56 5568
+305.267120 2873.56 5568
+305.278256 2873.56 5568
+305.289392 2873.56 5568
+305.300528 2873.56 5568
+305.311664 2873.56 5568
+305.322800 2873.56 5568
+305.333936 2873.56 5568
+305.345072 2873.56 5568
+305.356208 2873.56 5568
+305.367344 2873.56 5568
+305.378480 2873.56 5568
+305.389616 2873.56 5568
+305.400752 2873.56 5568
+305.411888 2873.56 5568
+305.423024 2873.56 5568
+305.434160 2873.56 5568
+305.445296 2873.56 5568
+305.456432 2873.56 5568
+305.467568 2873.56 5568
+305.478704 2873.56 5568
+305.489840 2873.56 5568
+305.500976 2873.56 5568
+305.512112 2873.56 5568
+305.523248 2873.56 5568
+305.534384 2873.56 5568
+305.545520 2873.56 5568
+305.556656 2873.56 5568
+305.567792 2873.56 5568
+305.578928 2873.56 5568
+305.590064 2873.56 5568
+305.601200 2873.56 5568
+305.612336 2873.56 5568
+305.623472 2873.56 5568
+305.634608 2873.56 5568
+305.645744 2873.56 5568
+305.656880 2873.56 5568
+305.668016 2873.56 5568
+305.679152 2873.56 5568
+305.690352 2857.14 5600
+305.701552 2857.14 5600
+305.712752 2857.14 5600
+305.723952 2857.14 5600
+305.735152 2857.14 5600
+305.746352 2857.14 5600
+305.757552 2857.14 5600
+305.768752 2857.14 5600
+305.779952 2857.14 5600
+305.791152 2857.14 5600
+305.802352 2857.14 5600
+305.813552 2857.14 5600
+305.824752 2857.14 5600
+305.835952 2857.14 5600
+305.847152 2857.14 5600
+305.858352 2857.14 5600
+305.869552 2857.14 5600
+305.880752 2857.14 5600
+305.891952 2857.14 5600
+305.903152 2857.14 5600
+305.914352 2857.14 5600
+305.925552 2857.14 5600
+305.936752 2857.14 5600
+305.947952 2857.14 5600
+305.959216 2840.91 5632
+305.970480 2840.91 5632
+305.981744 2840.91 5632
+305.993008 2840.91 5632
+306.004272 2840.91 5632
+306.015536 2840.91 5632
+306.026800 2840.91 5632
+306.038064 2840.91 5632
+306.049328 2840.91 5632
+306.060592 2840.91 5632
+306.071856 2840.91 5632
+306.083120 2840.91 5632
+306.094384 2840.91 5632
+306.105648 2840.91 5632
+306.116912 2840.91 5632
+306.128176 2840.91 5632
+306.139440 2840.91 5632
+306.150704 2840.91 5632
+306.161968 2840.91 5632
+306.173232 2840.91 5632
+306.184496 2840.91 5632
+306.195760 2840.91 5632
+306.207024 2840.91 5632
+306.218288 2840.91 5632
+306.229616 2824.86 5664
+306.240944 2824.86 5664
+306.252272 2824.86 5664
+306.263600 2824.86 5664
+306.274928 2824.86 5664
+306.286256 2824.86 5664
+306.297584 2824.86 5664
+306.308912 2824.86 5664
+306.320240 2824.86 5664
+306.331568 2824.86 5664
+306.342896 2824.86 5664
+306.354224 2824.86 5664
+306.365552 2824.86 5664
+306.376880 2824.86 5664
+306.388208 2824.86 5664
+306.399536 2824.86 5664
+306.410928 2808.99 5696
+306.422320 2808.99 5696
+306.433712 2808.99 5696
+306.445104 2808.99 5696
+306.456496 2808.99 5696
+306.467888 2808.99 5696
+306.479280 2808.99 5696
+306.490672 2808.99 5696
+306.502064 2808.99 5696
+306.513456 2808.99 5696
+306.524848 2808.99 5696
+306.536240 2808.99 5696
+306.547632 2808.99 5696
+306.559024 2808.99 5696
+306.570416 2808.99 5696
+306.581808 2808.99 5696
+306.593200 2808.99 5696
+306.604592 2808.99 5696
+306.615984 2808.99 5696
+306.627376 2808.99 5696
+306.638768 2808.99 5696
+306.650160 2808.99 5696
+306.661552 2808.99 5696
+306.672944 2808.99 5696
+306.684400 2793.30 5728
+306.695856 2793.30 5728
+306.707312 2793.30 5728
+306.718768 2793.30 5728
+306.730224 2793.30 5728
+306.741680 2793.30 5728
+306.753136 2793.30 5728
+306.764592 2793.30 5728
+306.776048 2793.30 5728
+306.787504 2793.30 5728
+306.798960 2793.30 5728
+306.810416 2793.30 5728
+306.821872 2793.30 5728
+306.833328 2793.30 5728
+306.844784 2793.30 5728
+306.856240 2793.30 5728
+306.867696 2793.30 5728
+306.879152 2793.30 5728
+306.890608 2793.30 5728
+306.902064 2793.30 5728
+306.913520 2793.30 5728
+306.924976 2793.30 5728
+306.936432 2793.30 5728
+306.947888 2793.30 5728
+306.959408 2777.78 5760
+306.970928 2777.78 5760
+306.982448 2777.78 5760
+306.993968 2777.78 5760
+307.005488 2777.78 5760
+307.017008 2777.78 5760
+307.028528 2777.78 5760
+307.040048 2777.78 5760
+307.051568 2777.78 5760
+307.063088 2777.78 5760
+307.074608 2777.78 5760
+307.086128 2777.78 5760
+307.097648 2777.78 5760
+307.109168 2777.78 5760
+307.120688 2777.78 5760
+307.132208 2777.78 5760
+307.143792 2762.43 5792
+307.155376 2762.43 5792
+307.166960 2762.43 5792
+307.178544 2762.43 5792
+307.190128 2762.43 5792
+307.201712 2762.43 5792
+307.213296 2762.43 5792
+307.224880 2762.43 5792
+307.236464 2762.43 5792
+307.248048 2762.43 5792
+307.259632 2762.43 5792
+307.271216 2762.43 5792
+307.282800 2762.43 5792
+307.294384 2762.43 5792
+307.305968 2762.43 5792
+307.317552 2762.43 5792
+307.329136 2762.43 5792
+307.340720 2762.43 5792
+307.352304 2762.43 5792
+307.363888 2762.43 5792
+307.375472 2762.43 5792
+307.387056 2762.43 5792
+307.398640 2762.43 5792
+307.410224 2762.43 5792
+307.421872 2747.25 5824
+307.433520 2747.25 5824
+307.445168 2747.25 5824
+307.456816 2747.25 5824
+307.468464 2747.25 5824
+307.480112 2747.25 5824
+307.491760 2747.25 5824
+307.503408 2747.25 5824
+307.515056 2747.25 5824
+307.526704 2747.25 5824
+307.538352 2747.25 5824
+307.550000 2747.25 5824
+307.561648 2747.25 5824
+307.573296 2747.25 5824
+307.584944 2747.25 5824
+307.596592 2747.25 5824
+307.608304 2732.24 5856
+307.620016 2732.24 5856
+307.631728 2732.24 5856
+307.643440 2732.24 5856
+307.655152 2732.24 5856
+307.666864 2732.24 5856
+307.678576 2732.24 5856
+307.690288 2732.24 5856
+307.702000 2732.24 5856
+307.713712 2732.24 5856
+307.725424 2732.24 5856
+307.737136 2732.24 5856
+307.748848 2732.24 5856
+307.760560 2732.24 5856
+307.772272 2732.24 5856
+307.783984 2732.24 5856
+307.795696 2732.24 5856
+307.807408 2732.24 5856
+307.819120 2732.24 5856
+307.830832 2732.24 5856
+307.842544 2732.24 5856
+307.854256 2732.24 5856
+307.865968 2732.24 5856
+307.877680 2732.24 5856
+307.889456 2717.39 5888
+307.901232 2717.39 5888
+307.913008 2717.39 5888
+307.924784 2717.39 5888
+307.936560 2717.39 5888
+307.948336 2717.39 5888
+307.960112 2717.39 5888
+307.971888 2717.39 5888
+307.983664 2717.39 5888
+307.995440 2717.39 5888
+308.007216 2717.39 5888
+308.018992 2717.39 5888
+308.030768 2717.39 5888
+308.042544 2717.39 5888
+308.054320 2717.39 5888
+308.066096 2717.39 5888
+308.077936 2702.70 5920
+308.089776 2702.70 5920
+308.101616 2702.70 5920
+308.113456 2702.70 5920
+308.125296 2702.70 5920
+308.137136 2702.70 5920
+308.148976 2702.70 5920
+308.160816 2702.70 5920
+308.172656 2702.70 5920
+308.184496 2702.70 5920
+308.196336 2702.70 5920
+308.208176 2702.70 5920
+308.220016 2702.70 5920
+308.231856 2702.70 5920
+308.243696 2702.70 5920
+308.255536 2702.70 5920
+308.267376 2702.70 5920
+308.279216 2702.70 5920
+308.291056 2702.70 5920
+308.302896 2702.70 5920
+308.314736 2702.70 5920
+308.326576 2702.70 5920
+308.338416 2702.70 5920
+308.350256 2702.70 5920
+308.362160 2688.17 5952
+308.374064 2688.17 5952
+308.385968 2688.17 5952
+308.397872 2688.17 5952
+308.409776 2688.17 5952
+308.421680 2688.17 5952
+308.433584 2688.17 5952
+308.445488 2688.17 5952
+308.457392 2688.17 5952
+308.469296 2688.17 5952
+308.481200 2688.17 5952
+308.493104 2688.17 5952
+308.505008 2688.17 5952
+308.516912 2688.17 5952
+308.528816 2688.17 5952
+308.540720 2688.17 5952
+308.552688 2673.80 5984
+308.564656 2673.80 5984
+308.576624 2673.80 5984
+308.588592 2673.80 5984
+308.600560 2673.80 5984
+308.612528 2673.80 5984
+308.624496 2673.80 5984
+308.636464 2673.80 5984
+308.648432 2673.80 5984
+308.660400 2673.80 5984
+308.672368 2673.80 5984
+308.684336 2673.80 5984
+308.696304 2673.80 5984
+308.708272 2673.80 5984
+308.720240 2673.80 5984
+308.732208 2673.80 5984
+308.744176 2673.80 5984
+308.756144 2673.80 5984
+308.768112 2673.80 5984
+308.780080 2673.80 5984
+308.792048 2673.80 5984
+308.804016 2673.80 5984
+308.815984 2673.80 5984
+308.827952 2673.80 5984
+308.839984 2659.57 6016
+308.852016 2659.57 6016
+308.864048 2659.57 6016
+308.876080 2659.57 6016
+308.888112 2659.57 6016
+308.900144 2659.57 6016
+308.912176 2659.57 6016
+308.924208 2659.57 6016
+308.936240 2659.57 6016
+308.948272 2659.57 6016
+308.960304 2659.57 6016
+308.972336 2659.57 6016
+308.984368 2659.57 6016
+308.996400 2659.57 6016
+309.008432 2659.57 6016
+309.020464 2659.57 6016
+309.032560 2645.50 6048
+309.044656 2645.50 6048
+309.056752 2645.50 6048
+309.068848 2645.50 6048
+309.080944 2645.50 6048
+309.093040 2645.50 6048
+309.105136 2645.50 6048
+309.117232 2645.50 6048
+309.129328 2645.50 6048
+309.141424 2645.50 6048
+309.153520 2645.50 6048
+309.165616 2645.50 6048
+309.177712 2645.50 6048
+309.189808 2645.50 6048
+309.201904 2645.50 6048
+309.214000 2645.50 6048
+309.226160 2631.58 6080
+309.238320 2631.58 6080
+309.250480 2631.58 6080
+309.262640 2631.58 6080
+309.274800 2631.58 6080
+309.286960 2631.58 6080
+309.299120 2631.58 6080
+309.311280 2631.58 6080
+309.323440 2631.58 6080
+309.335600 2631.58 6080
+309.347760 2631.58 6080
+309.359920 2631.58 6080
+309.372080 2631.58 6080
+309.384240 2631.58 6080
+309.396400 2631.58 6080
+309.408560 2631.58 6080
+309.420720 2631.58 6080
+309.432880 2631.58 6080
+309.445040 2631.58 6080
+309.457200 2631.58 6080
+309.469360 2631.58 6080
+309.481520 2631.58 6080
+309.493680 2631.58 6080
+309.505840 2631.58 6080
+309.518064 2617.80 6112
+309.530288 2617.80 6112
+309.542512 2617.80 6112
+309.554736 2617.80 6112
+309.566960 2617.80 6112
+309.579184 2617.80 6112
+309.591408 2617.80 6112
+309.603632 2617.80 6112
+309.615856 2617.80 6112
+309.628080 2617.80 6112
+309.640304 2617.80 6112
+309.652528 2617.80 6112
+309.664752 2617.80 6112
+309.676976 2617.80 6112
+309.689200 2617.80 6112
+309.701424 2617.80 6112
+309.713712 2604.17 6144
+309.726000 2604.17 6144
+309.738288 2604.17 6144
+309.750576 2604.17 6144
+309.762864 2604.17 6144
+309.775152 2604.17 6144
+309.787440 2604.17 6144
+309.799728 2604.17 6144
+309.812016 2604.17 6144
+309.824304 2604.17 6144
+309.836592 2604.17 6144
+309.848880 2604.17 6144
+309.861168 2604.17 6144
+309.873456 2604.17 6144
+309.885744 2604.17 6144
+309.898032 2604.17 6144
+309.910384 2590.67 6176
+309.922736 2590.67 6176
+309.935088 2590.67 6176
+309.947440 2590.67 6176
+309.959792 2590.67 6176
+309.972144 2590.67 6176
+309.984496 2590.67 6176
+309.996848 2590.67 6176
+310.009200 2590.67 6176
+310.021552 2590.67 6176
+310.033904 2590.67 6176
+310.046256 2590.67 6176
+310.058608 2590.67 6176
+310.070960 2590.67 6176
+310.083312 2590.67 6176
+310.095664 2590.67 6176
+310.108016 2590.67 6176
+310.120368 2590.67 6176
+310.132720 2590.67 6176
+310.145072 2590.67 6176
+310.157424 2590.67 6176
+310.169776 2590.67 6176
+310.182128 2590.67 6176
+310.194480 2590.67 6176
+310.206896 2577.32 6208
+310.219312 2577.32 6208
+310.231728 2577.32 6208
+310.244144 2577.32 6208
+310.256560 2577.32 6208
+310.268976 2577.32 6208
+310.281392 2577.32 6208
+310.293808 2577.32 6208
+310.306224 2577.32 6208
+310.318640 2577.32 6208
+310.331056 2577.32 6208
+310.343472 2577.32 6208
+310.355888 2577.32 6208
+310.368304 2577.32 6208
+310.380720 2577.32 6208
+310.393136 2577.32 6208
+310.405680 2551.02 6272
+310.418224 2551.02 6272
+310.430768 2551.02 6272
+310.443312 2551.02 6272
+310.455856 2551.02 6272
+310.468400 2551.02 6272
+310.480944 2551.02 6272
+310.493488 2551.02 6272
+310.506032 2551.02 6272
+310.518576 2551.02 6272
+310.531120 2551.02 6272
+310.543664 2551.02 6272
+310.556208 2551.02 6272
+310.568752 2551.02 6272
+310.581296 2551.02 6272
+310.593840 2551.02 6272
+310.606448 2538.07 6304
+310.619056 2538.07 6304
+310.631664 2538.07 6304
+310.644272 2538.07 6304
+310.656880 2538.07 6304
+310.669488 2538.07 6304
+310.682096 2538.07 6304
+310.694704 2538.07 6304
+310.707312 2538.07 6304
+310.719920 2538.07 6304
+310.732528 2538.07 6304
+310.745136 2538.07 6304
+310.757744 2538.07 6304
+310.770352 2538.07 6304
+310.782960 2538.07 6304
+310.795568 2538.07 6304
+310.808240 2525.25 6336
+310.820912 2525.25 6336
+310.833584 2525.25 6336
+310.846256 2525.25 6336
+310.858928 2525.25 6336
+310.871600 2525.25 6336
+310.884272 2525.25 6336
+310.896944 2525.25 6336
+310.909616 2525.25 6336
+310.922288 2525.25 6336
+310.934960 2525.25 6336
+310.947632 2525.25 6336
+310.960304 2525.25 6336
+310.972976 2525.25 6336
+310.985648 2525.25 6336
+310.998320 2525.25 6336
+311.011056 2512.56 6368
+311.023792 2512.56 6368
+311.036528 2512.56 6368
+311.049264 2512.56 6368
+311.062000 2512.56 6368
+311.074736 2512.56 6368
+311.087472 2512.56 6368
+311.100208 2512.56 6368
+311.112944 2512.56 6368
+311.125680 2512.56 6368
+311.138416 2512.56 6368
+311.151152 2512.56 6368
+311.163888 2512.56 6368
+311.176624 2512.56 6368
+311.189360 2512.56 6368
+311.202096 2512.56 6368
+311.214896 2500.00 6400
+311.227696 2500.00 6400
+311.240496 2500.00 6400
+311.253296 2500.00 6400
+311.266096 2500.00 6400
+311.278896 2500.00 6400
+311.291696 2500.00 6400
+311.304496 2500.00 6400
+311.317296 2500.00 6400
+311.330096 2500.00 6400
+311.342896 2500.00 6400
+311.355696 2500.00 6400
+311.368496 2500.00 6400
+311.381296 2500.00 6400
+311.394096 2500.00 6400
+311.406896 2500.00 6400
+311.419696 2500.00 6400
+311.432496 2500.00 6400
+311.445296 2500.00 6400
+311.458096 2500.00 6400
+311.470896 2500.00 6400
+311.483696 2500.00 6400
+311.496496 2500.00 6400
+311.509296 2500.00 6400
+311.522160 2487.56 6432
+311.535024 2487.56 6432
+311.547888 2487.56 6432
+311.560752 2487.56 6432
+311.573616 2487.56 6432
+311.586480 2487.56 6432
+311.599344 2487.56 6432
+311.612208 2487.56 6432
+311.625072 2487.56 6432
+311.637936 2487.56 6432
+311.650800 2487.56 6432
+311.663664 2487.56 6432
+311.676528 2487.56 6432
+311.689392 2487.56 6432
+311.702256 2487.56 6432
+311.715120 2487.56 6432
+311.728048 2475.25 6464
+311.740976 2475.25 6464
+311.753904 2475.25 6464
+311.766832 2475.25 6464
+311.779760 2475.25 6464
+311.792688 2475.25 6464
+311.805616 2475.25 6464
+311.818544 2475.25 6464
+311.831472 2475.25 6464
+311.844400 2475.25 6464
+311.857328 2475.25 6464
+311.870256 2475.25 6464
+311.883184 2475.25 6464
+311.896112 2475.25 6464
+311.909040 2475.25 6464
+311.921968 2475.25 6464
+311.934960 2463.05 6496
+311.947952 2463.05 6496
+311.960944 2463.05 6496
+311.973936 2463.05 6496
+311.986928 2463.05 6496
+311.999920 2463.05 6496
+312.012912 2463.05 6496
+312.025904 2463.05 6496
+312.038896 2463.05 6496
+312.051888 2463.05 6496
+312.064880 2463.05 6496
+312.077872 2463.05 6496
+312.090864 2463.05 6496
+312.103856 2463.05 6496
+312.116848 2463.05 6496
+312.129840 2463.05 6496
+312.142896 2450.98 6528
+312.155952 2450.98 6528
+312.169008 2450.98 6528
+312.182064 2450.98 6528
+312.195120 2450.98 6528
+312.208176 2450.98 6528
+312.221232 2450.98 6528
+312.234288 2450.98 6528
+312.247344 2450.98 6528
+312.260400 2450.98 6528
+312.273456 2450.98 6528
+312.286512 2450.98 6528
+312.299568 2450.98 6528
+312.312624 2450.98 6528
+312.325680 2450.98 6528
+312.338736 2450.98 6528
+312.351856 2439.02 6560
+312.364976 2439.02 6560
+312.378096 2439.02 6560
+312.391216 2439.02 6560
+312.404336 2439.02 6560
+312.417456 2439.02 6560
+312.430576 2439.02 6560
+312.443696 2439.02 6560
+312.456816 2439.02 6560
+312.469936 2439.02 6560
+312.483056 2439.02 6560
+312.496176 2439.02 6560
+312.509296 2439.02 6560
+312.522416 2439.02 6560
+312.535536 2439.02 6560
+312.548656 2439.02 6560
+312.561840 2427.18 6592
+312.575024 2427.18 6592
+312.588208 2427.18 6592
+312.601392 2427.18 6592
+312.614576 2427.18 6592
+312.627760 2427.18 6592
+312.640944 2427.18 6592
+312.654128 2427.18 6592
+312.667312 2427.18 6592
+312.680496 2427.18 6592
+312.693680 2427.18 6592
+312.706864 2427.18 6592
+312.720048 2427.18 6592
+312.733232 2427.18 6592
+312.746416 2427.18 6592
+312.759600 2427.18 6592
+312.772912 2403.85 6656
+312.786224 2403.85 6656
+312.799536 2403.85 6656
+312.812848 2403.85 6656
+312.826160 2403.85 6656
+312.839472 2403.85 6656
+312.852784 2403.85 6656
+312.866096 2403.85 6656
+312.879408 2403.85 6656
+312.892720 2403.85 6656
+312.906032 2403.85 6656
+312.919344 2403.85 6656
+312.932656 2403.85 6656
+312.945968 2403.85 6656
+312.959280 2403.85 6656
+312.972592 2403.85 6656
+312.985968 2392.34 6688
+312.999344 2392.34 6688
+313.012720 2392.34 6688
+313.026096 2392.34 6688
+313.039472 2392.34 6688
+313.052848 2392.34 6688
+313.066224 2392.34 6688
+313.079600 2392.34 6688
+313.092976 2392.34 6688
+313.106352 2392.34 6688
+313.119728 2392.34 6688
+313.133104 2392.34 6688
+313.146480 2392.34 6688
+313.159856 2392.34 6688
+313.173232 2392.34 6688
+313.186608 2392.34 6688
+313.200048 2380.95 6720
+313.213488 2380.95 6720
+313.226928 2380.95 6720
+313.240368 2380.95 6720
+313.253808 2380.95 6720
+313.267248 2380.95 6720
+313.280688 2380.95 6720
+313.294128 2380.95 6720
+313.307568 2380.95 6720
+313.321008 2380.95 6720
+313.334448 2380.95 6720
+313.347888 2380.95 6720
+313.361328 2380.95 6720
+313.374768 2380.95 6720
+313.388208 2380.95 6720
+313.401648 2380.95 6720
+313.415152 2369.67 6752
+313.428656 2369.67 6752
+313.442160 2369.67 6752
+313.455664 2369.67 6752
+313.469168 2369.67 6752
+313.482672 2369.67 6752
+313.496176 2369.67 6752
+313.509680 2369.67 6752
+313.523248 2358.49 6784
+313.536816 2358.49 6784
+313.550384 2358.49 6784
+313.563952 2358.49 6784
+313.577520 2358.49 6784
+313.591088 2358.49 6784
+313.604656 2358.49 6784
+313.618224 2358.49 6784
+313.631792 2358.49 6784
+313.645360 2358.49 6784
+313.658928 2358.49 6784
+313.672496 2358.49 6784
+313.686064 2358.49 6784
+313.699632 2358.49 6784
+313.713200 2358.49 6784
+313.726768 2358.49 6784
+313.740400 2347.42 6816
+313.754032 2347.42 6816
+313.767664 2347.42 6816
+313.781296 2347.42 6816
+313.794928 2347.42 6816
+313.808560 2347.42 6816
+313.822192 2347.42 6816
+313.835824 2347.42 6816
+313.849456 2347.42 6816
+313.863088 2347.42 6816
+313.876720 2347.42 6816
+313.890352 2347.42 6816
+313.903984 2347.42 6816
+313.917616 2347.42 6816
+313.931248 2347.42 6816
+313.944880 2347.42 6816
+313.958576 2336.45 6848
+313.972272 2336.45 6848
+313.985968 2336.45 6848
+313.999664 2336.45 6848
+314.013360 2336.45 6848
+314.027056 2336.45 6848
+314.040752 2336.45 6848
+314.054448 2336.45 6848
+314.068144 2336.45 6848
+314.081840 2336.45 6848
+314.095536 2336.45 6848
+314.109232 2336.45 6848
+314.122928 2336.45 6848
+314.136624 2336.45 6848
+314.150320 2336.45 6848
+314.164016 2336.45 6848
+314.177840 2314.81 6912
+314.191664 2314.81 6912
+314.205488 2314.81 6912
+314.219312 2314.81 6912
+314.233136 2314.81 6912
+314.246960 2314.81 6912
+314.260784 2314.81 6912
+314.274608 2314.81 6912
+314.288432 2314.81 6912
+314.302256 2314.81 6912
+314.316080 2314.81 6912
+314.329904 2314.81 6912
+314.343728 2314.81 6912
+314.357552 2314.81 6912
+314.371376 2314.81 6912
+314.385200 2314.81 6912
+314.399088 2304.15 6944
+314.412976 2304.15 6944
+314.426864 2304.15 6944
+314.440752 2304.15 6944
+314.454640 2304.15 6944
+314.468528 2304.15 6944
+314.482416 2304.15 6944
+314.496304 2304.15 6944
+314.510192 2304.15 6944
+314.524080 2304.15 6944
+314.537968 2304.15 6944
+314.551856 2304.15 6944
+314.565744 2304.15 6944
+314.579632 2304.15 6944
+314.593520 2304.15 6944
+314.607408 2304.15 6944
+314.621360 2293.58 6976
+314.635312 2293.58 6976
+314.649264 2293.58 6976
+314.663216 2293.58 6976
+314.677168 2293.58 6976
+314.691120 2293.58 6976
+314.705072 2293.58 6976
+314.719024 2293.58 6976
+314.733040 2283.11 7008
+314.747056 2283.11 7008
+314.761072 2283.11 7008
+314.775088 2283.11 7008
+314.789104 2283.11 7008
+314.803120 2283.11 7008
+314.817136 2283.11 7008
+314.831152 2283.11 7008
+314.845168 2283.11 7008
+314.859184 2283.11 7008
+314.873200 2283.11 7008
+314.887216 2283.11 7008
+314.901232 2283.11 7008
+314.915248 2283.11 7008
+314.929264 2283.11 7008
+314.943280 2283.11 7008
+314.957360 2272.73 7040
+314.971440 2272.73 7040
+314.985520 2272.73 7040
+314.999600 2272.73 7040
+315.013680 2272.73 7040
+315.027760 2272.73 7040
+315.041840 2272.73 7040
+315.055920 2272.73 7040
+315.070000 2272.73 7040
+315.084080 2272.73 7040
+315.098160 2272.73 7040
+315.112240 2272.73 7040
+315.126320 2272.73 7040
+315.140400 2272.73 7040
+315.154480 2272.73 7040
+315.168560 2272.73 7040
+315.182704 2262.44 7072
+315.196848 2262.44 7072
+315.210992 2262.44 7072
+315.225136 2262.44 7072
+315.239280 2262.44 7072
+315.253424 2262.44 7072
+315.267568 2262.44 7072
+315.281712 2262.44 7072
+315.295856 2262.44 7072
+315.310000 2262.44 7072
+315.324144 2262.44 7072
+315.338288 2262.44 7072
+315.352432 2262.44 7072
+315.366576 2262.44 7072
+315.380720 2262.44 7072
+315.394864 2262.44 7072
+315.409136 2242.15 7136
+315.423408 2242.15 7136
+315.437680 2242.15 7136
+315.451952 2242.15 7136
+315.466224 2242.15 7136
+315.480496 2242.15 7136
+315.494768 2242.15 7136
+315.509040 2242.15 7136
+315.523376 2232.14 7168
+315.537712 2232.14 7168
+315.552048 2232.14 7168
+315.566384 2232.14 7168
+315.580720 2232.14 7168
+315.595056 2232.14 7168
+315.609392 2232.14 7168
+315.623728 2232.14 7168
+315.638064 2232.14 7168
+315.652400 2232.14 7168
+315.666736 2232.14 7168
+315.681072 2232.14 7168
+315.695408 2232.14 7168
+315.709744 2232.14 7168
+315.724080 2232.14 7168
+315.738416 2232.14 7168
+315.752816 2222.22 7200
+315.767216 2222.22 7200
+315.781616 2222.22 7200
+315.796016 2222.22 7200
+315.810416 2222.22 7200
+315.824816 2222.22 7200
+315.839216 2222.22 7200
+315.853616 2222.22 7200
+315.868016 2222.22 7200
+315.882416 2222.22 7200
+315.896816 2222.22 7200
+315.911216 2222.22 7200
+315.925616 2222.22 7200
+315.940016 2222.22 7200
+315.954416 2222.22 7200
+315.968816 2222.22 7200
+315.983280 2212.39 7232
+315.997744 2212.39 7232
+316.012208 2212.39 7232
+316.026672 2212.39 7232
+316.041136 2212.39 7232
+316.055600 2212.39 7232
+316.070064 2212.39 7232
+316.084528 2212.39 7232
+316.099120 2192.98 7296
+316.113712 2192.98 7296
+316.128304 2192.98 7296
+316.142896 2192.98 7296
+316.157488 2192.98 7296
+316.172080 2192.98 7296
+316.186672 2192.98 7296
+316.201264 2192.98 7296
+316.215856 2192.98 7296
+316.230448 2192.98 7296
+316.245040 2192.98 7296
+316.259632 2192.98 7296
+316.274224 2192.98 7296
+316.288816 2192.98 7296
+316.303408 2192.98 7296
+316.318000 2192.98 7296
+316.332656 2183.41 7328
+316.347312 2183.41 7328
+316.361968 2183.41 7328
+316.376624 2183.41 7328
+316.391280 2183.41 7328
+316.405936 2183.41 7328
+316.420592 2183.41 7328
+316.435248 2183.41 7328
+316.449904 2183.41 7328
+316.464560 2183.41 7328
+316.479216 2183.41 7328
+316.493872 2183.41 7328
+316.508528 2183.41 7328
+316.523184 2183.41 7328
+316.537840 2183.41 7328
+316.552496 2183.41 7328
+316.567216 2173.91 7360
+316.581936 2173.91 7360
+316.596656 2173.91 7360
+316.611376 2173.91 7360
+316.626096 2173.91 7360
+316.640816 2173.91 7360
+316.655536 2173.91 7360
+316.670256 2173.91 7360
+316.685040 2164.50 7392
+316.699824 2164.50 7392
+316.714608 2164.50 7392
+316.729392 2164.50 7392
+316.744176 2164.50 7392
+316.758960 2164.50 7392
+316.773744 2164.50 7392
+316.788528 2164.50 7392
+316.803312 2164.50 7392
+316.818096 2164.50 7392
+316.832880 2164.50 7392
+316.847664 2164.50 7392
+316.862448 2164.50 7392
+316.877232 2164.50 7392
+316.892016 2164.50 7392
+316.906800 2164.50 7392
+316.921712 2145.92 7456
+316.936624 2145.92 7456
+316.951536 2145.92 7456
+316.966448 2145.92 7456
+316.981360 2145.92 7456
+316.996272 2145.92 7456
+317.011184 2145.92 7456
+317.026096 2145.92 7456
+317.041072 2136.75 7488
+317.056048 2136.75 7488
+317.071024 2136.75 7488
+317.086000 2136.75 7488
+317.100976 2136.75 7488
+317.115952 2136.75 7488
+317.130928 2136.75 7488
+317.145904 2136.75 7488
+317.160880 2136.75 7488
+317.175856 2136.75 7488
+317.190832 2136.75 7488
+317.205808 2136.75 7488
+317.220784 2136.75 7488
+317.235760 2136.75 7488
+317.250736 2136.75 7488
+317.265712 2136.75 7488
+317.280752 2127.66 7520
+317.295792 2127.66 7520
+317.310832 2127.66 7520
+317.325872 2127.66 7520
+317.340912 2127.66 7520
+317.355952 2127.66 7520
+317.370992 2127.66 7520
+317.386032 2127.66 7520
+317.401136 2118.64 7552
+317.416240 2118.64 7552
+317.431344 2118.64 7552
+317.446448 2118.64 7552
+317.461552 2118.64 7552
+317.476656 2118.64 7552
+317.491760 2118.64 7552
+317.506864 2118.64 7552
+317.521968 2118.64 7552
+317.537072 2118.64 7552
+317.552176 2118.64 7552
+317.567280 2118.64 7552
+317.582384 2118.64 7552
+317.597488 2118.64 7552
+317.612592 2118.64 7552
+317.627696 2118.64 7552
+317.642928 2100.84 7616
+317.658160 2100.84 7616
+317.673392 2100.84 7616
+317.688624 2100.84 7616
+317.703856 2100.84 7616
+317.719088 2100.84 7616
+317.734320 2100.84 7616
+317.749552 2100.84 7616
+317.764848 2092.05 7648
+317.780144 2092.05 7648
+317.795440 2092.05 7648
+317.810736 2092.05 7648
+317.826032 2092.05 7648
+317.841328 2092.05 7648
+317.856624 2092.05 7648
+317.871920 2092.05 7648
+317.887216 2092.05 7648
+317.902512 2092.05 7648
+317.917808 2092.05 7648
+317.933104 2092.05 7648
+317.948400 2092.05 7648
+317.963696 2092.05 7648
+317.978992 2092.05 7648
+317.994288 2092.05 7648
+318.009648 2083.33 7680
+318.025008 2083.33 7680
+318.040368 2083.33 7680
+318.055728 2083.33 7680
+318.071088 2083.33 7680
+318.086448 2083.33 7680
+318.101808 2083.33 7680
+318.117168 2083.33 7680
+318.132656 2066.12 7744
+318.148144 2066.12 7744
+318.163632 2066.12 7744
+318.179120 2066.12 7744
+318.194608 2066.12 7744
+318.210096 2066.12 7744
+318.225584 2066.12 7744
+318.241072 2066.12 7744
+318.256560 2066.12 7744
+318.272048 2066.12 7744
+318.287536 2066.12 7744
+318.303024 2066.12 7744
+318.318512 2066.12 7744
+318.334000 2066.12 7744
+318.349488 2066.12 7744
+318.364976 2066.12 7744
+318.380528 2057.61 7776
+318.396080 2057.61 7776
+318.411632 2057.61 7776
+318.427184 2057.61 7776
+318.442736 2057.61 7776
+318.458288 2057.61 7776
+318.473840 2057.61 7776
+318.489392 2057.61 7776
+318.505008 2049.18 7808
+318.520624 2049.18 7808
+318.536240 2049.18 7808
+318.551856 2049.18 7808
+318.567472 2049.18 7808
+318.583088 2049.18 7808
+318.598704 2049.18 7808
+318.614320 2049.18 7808
+318.629936 2049.18 7808
+318.645552 2049.18 7808
+318.661168 2049.18 7808
+318.676784 2049.18 7808
+318.692400 2049.18 7808
+318.708016 2049.18 7808
+318.723632 2049.18 7808
+318.739248 2049.18 7808
+318.754992 2032.52 7872
+318.770736 2032.52 7872
+318.786480 2032.52 7872
+318.802224 2032.52 7872
+318.817968 2032.52 7872
+318.833712 2032.52 7872
+318.849456 2032.52 7872
+318.865200 2032.52 7872
+318.881008 2024.29 7904
+318.896816 2024.29 7904
+318.912624 2024.29 7904
+318.928432 2024.29 7904
+318.944240 2024.29 7904
+318.960048 2024.29 7904
+318.975856 2024.29 7904
+318.991664 2024.29 7904
+319.007472 2024.29 7904
+319.023280 2024.29 7904
+319.039088 2024.29 7904
+319.054896 2024.29 7904
+319.070768 2016.13 7936
+319.086640 2016.13 7936
+319.102512 2016.13 7936
+319.118384 2016.13 7936
+319.134256 2016.13 7936
+319.150128 2016.13 7936
+319.166000 2016.13 7936
+319.181872 2016.13 7936
+319.197744 2016.13 7936
+319.213616 2016.13 7936
+319.229488 2016.13 7936
+319.245360 2016.13 7936
+319.261360 2000.00 8000
+319.277360 2000.00 8000
+319.293360 2000.00 8000
+319.309360 2000.00 8000
+319.325360 2000.00 8000
+319.341360 2000.00 8000
+319.357360 2000.00 8000
+319.373360 2000.00 8000
+319.389360 2000.00 8000
+319.405360 2000.00 8000
+319.421360 2000.00 8000
+319.437360 2000.00 8000
+319.453424 1992.03 8032
+319.461456 1992.03 8032
+319.469488 1992.03 8032
+319.477520 1992.03 8032
+319.485552 1992.03 8032
+319.493584 1992.03 8032
+319.501616 1992.03 8032
+319.509648 1992.03 8032
+319.517680 1992.03 8032
+319.525712 1992.03 8032
+319.533744 1992.03 8032
+319.541776 1992.03 8032
+319.549808 1992.03 8032
+319.557840 1992.03 8032
+319.565872 1992.03 8032
+319.573904 1992.03 8032
+319.581968 1984.13 8064
+319.590032 1984.13 8064
+319.598096 1984.13 8064
+319.606160 1984.13 8064
+319.614224 1984.13 8064
+319.622288 1984.13 8064
+319.630352 1984.13 8064
+319.638416 1984.13 8064
+319.646480 1984.13 8064
+319.654544 1984.13 8064
+319.662608 1984.13 8064
+319.670672 1984.13 8064
+319.678736 1984.13 8064
+319.686800 1984.13 8064
+319.694864 1984.13 8064
+319.702928 1984.13 8064
+319.710992 1984.13 8064
+319.719056 1984.13 8064
+319.727120 1984.13 8064
+319.735184 1984.13 8064
+319.743248 1984.13 8064
+319.751312 1984.13 8064
+319.759376 1984.13 8064
+319.767440 1984.13 8064
+319.775568 1968.50 8128
+319.783696 1968.50 8128
+319.791824 1968.50 8128
+319.799952 1968.50 8128
+319.808080 1968.50 8128
+319.816208 1968.50 8128
+319.824336 1968.50 8128
+319.832464 1968.50 8128
+319.840592 1968.50 8128
+319.848720 1968.50 8128
+319.856848 1968.50 8128
+319.864976 1968.50 8128
+319.873104 1968.50 8128
+319.881232 1968.50 8128
+319.889360 1968.50 8128
+319.897488 1968.50 8128
+319.905616 1968.50 8128
+319.913744 1968.50 8128
+319.921872 1968.50 8128
+319.930000 1968.50 8128
+319.938128 1968.50 8128
+319.946256 1968.50 8128
+319.954384 1968.50 8128
+319.962512 1968.50 8128
+319.970672 1960.78 8160
+319.978832 1960.78 8160
+319.986992 1960.78 8160
+319.995152 1960.78 8160
+320.003312 1960.78 8160
+320.011472 1960.78 8160
+320.019632 1960.78 8160
+320.027792 1960.78 8160
+320.035952 1960.78 8160
+320.044112 1960.78 8160
+320.052272 1960.78 8160
+320.060432 1960.78 8160
+320.068592 1960.78 8160
+320.076752 1960.78 8160
+320.084912 1960.78 8160
+320.093072 1960.78 8160
+320.101264 1953.12 8192
+320.109456 1953.12 8192
+320.117648 1953.12 8192
+320.125840 1953.12 8192
+320.134032 1953.12 8192
+320.142224 1953.12 8192
+320.150416 1953.12 8192
+320.158608 1953.12 8192
+320.166800 1953.12 8192
+320.174992 1953.12 8192
+320.183184 1953.12 8192
+320.191376 1953.12 8192
+320.199568 1953.12 8192
+320.207760 1953.12 8192
+320.215952 1953.12 8192
+320.224144 1953.12 8192
+320.232336 1953.12 8192
+320.240528 1953.12 8192
+320.248720 1953.12 8192
+320.256912 1953.12 8192
+320.265104 1953.12 8192
+320.273296 1953.12 8192
+320.281488 1953.12 8192
+320.289680 1953.12 8192
+320.297936 1937.98 8256
+320.306192 1937.98 8256
+320.314448 1937.98 8256
+320.322704 1937.98 8256
+320.330960 1937.98 8256
+320.339216 1937.98 8256
+320.347472 1937.98 8256
+320.355728 1937.98 8256
+320.363984 1937.98 8256
+320.372240 1937.98 8256
+320.380496 1937.98 8256
+320.388752 1937.98 8256
+320.397008 1937.98 8256
+320.405264 1937.98 8256
+320.413520 1937.98 8256
+320.421776 1937.98 8256
+320.430032 1937.98 8256
+320.438288 1937.98 8256
+320.446544 1937.98 8256
+320.454800 1937.98 8256
+320.463056 1937.98 8256
+320.471312 1937.98 8256
+320.479568 1937.98 8256
+320.487824 1937.98 8256
+320.496080 1937.98 8256
+320.504336 1937.98 8256
+320.512592 1937.98 8256
+320.520848 1937.98 8256
+320.529104 1937.98 8256
+320.537360 1937.98 8256
+320.545616 1937.98 8256
+320.553872 1937.98 8256
+320.562128 1937.98 8256
+320.570384 1937.98 8256
+320.578640 1937.98 8256
+320.586896 1937.98 8256
+320.595152 1937.98 8256
+320.603408 1937.98 8256
+320.611664 1937.98 8256
+320.619920 1937.98 8256
+320.628240 1923.08 8320
+320.636560 1923.08 8320
+320.644880 1923.08 8320
+320.653200 1923.08 8320
+320.661520 1923.08 8320
+320.669840 1923.08 8320
+320.678160 1923.08 8320
+320.686480 1923.08 8320
+320.694800 1923.08 8320
+320.703120 1923.08 8320
+320.711440 1923.08 8320
+320.719760 1923.08 8320
+320.728080 1923.08 8320
+320.736400 1923.08 8320
+320.744720 1923.08 8320
+320.753040 1923.08 8320
+320.761424 1908.40 8384
+320.769808 1908.40 8384
+320.778192 1908.40 8384
+320.786576 1908.40 8384
+320.794960 1908.40 8384
+320.803344 1908.40 8384
+320.811728 1908.40 8384
+320.820112 1908.40 8384
+320.828496 1908.40 8384
+320.836880 1908.40 8384
+320.845264 1908.40 8384
+320.853648 1908.40 8384
+320.862032 1908.40 8384
+320.870416 1908.40 8384
+320.878800 1908.40 8384
+320.887184 1908.40 8384
+320.895568 1908.40 8384
+320.903952 1908.40 8384
+320.912336 1908.40 8384
+320.920720 1908.40 8384
+320.929104 1908.40 8384
+320.937488 1908.40 8384
+320.945872 1908.40 8384
+320.954256 1908.40 8384
+320.962704 1893.94 8448
+320.971152 1893.94 8448
+320.979600 1893.94 8448
+320.988048 1893.94 8448
+320.996496 1893.94 8448
+321.004944 1893.94 8448
+321.013392 1893.94 8448
+321.021840 1893.94 8448
+321.030288 1893.94 8448
+321.038736 1893.94 8448
+321.047184 1893.94 8448
+321.055632 1893.94 8448
+321.064080 1893.94 8448
+321.072528 1893.94 8448
+321.080976 1893.94 8448
+321.089424 1893.94 8448
+321.097872 1893.94 8448
+321.106320 1893.94 8448
+321.114768 1893.94 8448
+321.123216 1893.94 8448
+321.131664 1893.94 8448
+321.140112 1893.94 8448
+321.148560 1893.94 8448
+321.157008 1893.94 8448
+321.165456 1893.94 8448
+321.173904 1893.94 8448
+321.182352 1893.94 8448
+321.190800 1893.94 8448
+321.199248 1893.94 8448
+321.207696 1893.94 8448
+321.216144 1893.94 8448
+321.224592 1893.94 8448
+321.233040 1893.94 8448
+321.241488 1893.94 8448
+321.249936 1893.94 8448
+321.258384 1893.94 8448
+321.266832 1893.94 8448
+321.275280 1893.94 8448
+321.283728 1893.94 8448
+321.292176 1893.94 8448
+321.300688 1879.70 8512
+321.309200 1879.70 8512
+321.317712 1879.70 8512
+321.326224 1879.70 8512
+321.334736 1879.70 8512
+321.343248 1879.70 8512
+321.351760 1879.70 8512
+321.360272 1879.70 8512
+321.368784 1879.70 8512
+321.377296 1879.70 8512
+321.385808 1879.70 8512
+321.394320 1879.70 8512
+321.402832 1879.70 8512
+321.411344 1879.70 8512
+321.419856 1879.70 8512
+321.428368 1879.70 8512
+321.436944 1865.67 8576
+321.445520 1865.67 8576
+321.454096 1865.67 8576
+321.462672 1865.67 8576
+321.471248 1865.67 8576
+321.479824 1865.67 8576
+321.488400 1865.67 8576
+321.496976 1865.67 8576
+321.505552 1865.67 8576
+321.514128 1865.67 8576
+321.522704 1865.67 8576
+321.531280 1865.67 8576
+321.539856 1865.67 8576
+321.548432 1865.67 8576
+321.557008 1865.67 8576
+321.565584 1865.67 8576
+321.574224 1851.85 8640
+321.582864 1851.85 8640
+321.591504 1851.85 8640
+321.600144 1851.85 8640
+321.608784 1851.85 8640
+321.617424 1851.85 8640
+321.626064 1851.85 8640
+321.634704 1851.85 8640
+321.643344 1851.85 8640
+321.651984 1851.85 8640
+321.660624 1851.85 8640
+321.669264 1851.85 8640
+321.677904 1851.85 8640
+321.686544 1851.85 8640
+321.695184 1851.85 8640
+321.703824 1851.85 8640
+321.712464 1851.85 8640
+321.721104 1851.85 8640
+321.729744 1851.85 8640
+321.738384 1851.85 8640
+321.747024 1851.85 8640
+321.755664 1851.85 8640
+321.764304 1851.85 8640
+321.772944 1851.85 8640
+321.781584 1851.85 8640
+321.790224 1851.85 8640
+321.798864 1851.85 8640
+321.807504 1851.85 8640
+321.816144 1851.85 8640
+321.824784 1851.85 8640
+321.833424 1851.85 8640
+321.842064 1851.85 8640
+321.850704 1851.85 8640
+321.859344 1851.85 8640
+321.867984 1851.85 8640
+321.876624 1851.85 8640
+321.885264 1851.85 8640
+321.893904 1851.85 8640
+321.902544 1851.85 8640
+321.911184 1851.85 8640
+321.919888 1838.24 8704
+321.928592 1838.24 8704
+321.937296 1838.24 8704
+321.946000 1838.24 8704
+321.954704 1838.24 8704
+321.963408 1838.24 8704
+321.972112 1838.24 8704
+321.980816 1838.24 8704
+321.989520 1838.24 8704
+321.998224 1838.24 8704
+322.006928 1838.24 8704
+322.015632 1838.24 8704
+322.024336 1838.24 8704
+322.033040 1838.24 8704
+322.041744 1838.24 8704
+322.050448 1838.24 8704
+322.059216 1824.82 8768
+322.067984 1824.82 8768
+322.076752 1824.82 8768
+322.085520 1824.82 8768
+322.094288 1824.82 8768
+322.103056 1824.82 8768
+322.111824 1824.82 8768
+322.120592 1824.82 8768
+322.129360 1824.82 8768
+322.138128 1824.82 8768
+322.146896 1824.82 8768
+322.155664 1824.82 8768
+322.164432 1824.82 8768
+322.173200 1824.82 8768
+322.181968 1824.82 8768
+322.190736 1824.82 8768
+322.199504 1824.82 8768
+322.208272 1824.82 8768
+322.217040 1824.82 8768
+322.225808 1824.82 8768
+322.234576 1824.82 8768
+322.243344 1824.82 8768
+322.252112 1824.82 8768
+322.260880 1824.82 8768
+322.269648 1824.82 8768
+322.278416 1824.82 8768
+322.287184 1824.82 8768
+322.295952 1824.82 8768
+322.304720 1824.82 8768
+322.313488 1824.82 8768
+322.322256 1824.82 8768
+322.331024 1824.82 8768
+322.339792 1824.82 8768
+322.348560 1824.82 8768
+322.357328 1824.82 8768
+322.366096 1824.82 8768
+322.374864 1824.82 8768
+322.383632 1824.82 8768
+322.392400 1824.82 8768
+322.401168 1824.82 8768
+322.410000 1811.59 8832
+322.418832 1811.59 8832
+322.427664 1811.59 8832
+322.436496 1811.59 8832
+322.445328 1811.59 8832
+322.454160 1811.59 8832
+322.462992 1811.59 8832
+322.471824 1811.59 8832
+322.480656 1811.59 8832
+322.489488 1811.59 8832
+322.498320 1811.59 8832
+322.507152 1811.59 8832
+322.515984 1811.59 8832
+322.524816 1811.59 8832
+322.533648 1811.59 8832
+322.542480 1811.59 8832
+322.551376 1798.56 8896
+322.560272 1798.56 8896
+322.569168 1798.56 8896
+322.578064 1798.56 8896
+322.586960 1798.56 8896
+322.595856 1798.56 8896
+322.604752 1798.56 8896
+322.613648 1798.56 8896
+322.622544 1798.56 8896
+322.631440 1798.56 8896
+322.640336 1798.56 8896
+322.649232 1798.56 8896
+322.658128 1798.56 8896
+322.667024 1798.56 8896
+322.675920 1798.56 8896
+322.684816 1798.56 8896
+322.693776 1785.71 8960
+322.702736 1785.71 8960
+322.711696 1785.71 8960
+322.720656 1785.71 8960
+322.729616 1785.71 8960
+322.738576 1785.71 8960
+322.747536 1785.71 8960
+322.756496 1785.71 8960
+322.765456 1785.71 8960
+322.774416 1785.71 8960
+322.783376 1785.71 8960
+322.792336 1785.71 8960
+322.801296 1785.71 8960
+322.810256 1785.71 8960
+322.819216 1785.71 8960
+322.828176 1785.71 8960
+322.837136 1785.71 8960
+322.846096 1785.71 8960
+322.855056 1785.71 8960
+322.864016 1785.71 8960
+322.872976 1785.71 8960
+322.881936 1785.71 8960
+322.890896 1785.71 8960
+322.899856 1785.71 8960
+322.908816 1785.71 8960
+322.917776 1785.71 8960
+322.926736 1785.71 8960
+322.935696 1785.71 8960
+322.944656 1785.71 8960
+322.953616 1785.71 8960
+322.962576 1785.71 8960
+322.971536 1785.71 8960
+322.980560 1773.05 9024
+322.989584 1773.05 9024
+322.998608 1773.05 9024
+323.007632 1773.05 9024
+323.016656 1773.05 9024
+323.025680 1773.05 9024
+323.034704 1773.05 9024
+323.043728 1773.05 9024
+323.052752 1773.05 9024
+323.061776 1773.05 9024
+323.070800 1773.05 9024
+323.079824 1773.05 9024
+323.088848 1773.05 9024
+323.097872 1773.05 9024
+323.106896 1773.05 9024
+323.115920 1773.05 9024
+323.124944 1773.05 9024
+323.133968 1773.05 9024
+323.142992 1773.05 9024
+323.152016 1773.05 9024
+323.161040 1773.05 9024
+323.170064 1773.05 9024
+323.179088 1773.05 9024
+323.188112 1773.05 9024
+323.197200 1760.56 9088
+323.206288 1760.56 9088
+323.215376 1760.56 9088
+323.224464 1760.56 9088
+323.233552 1760.56 9088
+323.242640 1760.56 9088
+323.251728 1760.56 9088
+323.260816 1760.56 9088
+323.269904 1760.56 9088
+323.278992 1760.56 9088
+323.288080 1760.56 9088
+323.297168 1760.56 9088
+323.306256 1760.56 9088
+323.315344 1760.56 9088
+323.324432 1760.56 9088
+323.333520 1760.56 9088
+323.342672 1748.25 9152
+323.351824 1748.25 9152
+323.360976 1748.25 9152
+323.370128 1748.25 9152
+323.379280 1748.25 9152
+323.388432 1748.25 9152
+323.397584 1748.25 9152
+323.406736 1748.25 9152
+323.415888 1748.25 9152
+323.425040 1748.25 9152
+323.434192 1748.25 9152
+323.443344 1748.25 9152
+323.452496 1748.25 9152
+323.461648 1748.25 9152
+323.470800 1748.25 9152
+323.479952 1748.25 9152
+323.489168 1736.11 9216
+323.498384 1736.11 9216
+323.507600 1736.11 9216
+323.516816 1736.11 9216
+323.526032 1736.11 9216
+323.535248 1736.11 9216
+323.544464 1736.11 9216
+323.553680 1736.11 9216
+323.562896 1736.11 9216
+323.572112 1736.11 9216
+323.581328 1736.11 9216
+323.590544 1736.11 9216
+323.599760 1736.11 9216
+323.608976 1736.11 9216
+323.618192 1736.11 9216
+323.627408 1736.11 9216
+323.636624 1736.11 9216
+323.645840 1736.11 9216
+323.655056 1736.11 9216
+323.664272 1736.11 9216
+323.673488 1736.11 9216
+323.682704 1736.11 9216
+323.691920 1736.11 9216
+323.701136 1736.11 9216
+323.710352 1736.11 9216
+323.719568 1736.11 9216
+323.728784 1736.11 9216
+323.738000 1736.11 9216
+323.747216 1736.11 9216
+323.756432 1736.11 9216
+323.765648 1736.11 9216
+323.774864 1736.11 9216
+323.784144 1724.14 9280
+323.793424 1724.14 9280
+323.802704 1724.14 9280
+323.811984 1724.14 9280
+323.821264 1724.14 9280
+323.830544 1724.14 9280
+323.839824 1724.14 9280
+323.849104 1724.14 9280
+323.858384 1724.14 9280
+323.867664 1724.14 9280
+323.876944 1724.14 9280
+323.886224 1724.14 9280
+323.895504 1724.14 9280
+323.904784 1724.14 9280
+323.914064 1724.14 9280
+323.923344 1724.14 9280
+323.932688 1712.33 9344
+323.942032 1712.33 9344
+323.951376 1712.33 9344
+323.960720 1712.33 9344
+323.970064 1712.33 9344
+323.979408 1712.33 9344
+323.988752 1712.33 9344
+323.998096 1712.33 9344
+324.007440 1712.33 9344
+324.016784 1712.33 9344
+324.026128 1712.33 9344
+324.035472 1712.33 9344
+324.044816 1712.33 9344
+324.054160 1712.33 9344
+324.063504 1712.33 9344
+324.072848 1712.33 9344
+324.082256 1700.68 9408
+324.091664 1700.68 9408
+324.101072 1700.68 9408
+324.110480 1700.68 9408
+324.119888 1700.68 9408
+324.129296 1700.68 9408
+324.138704 1700.68 9408
+324.148112 1700.68 9408
+324.157520 1700.68 9408
+324.166928 1700.68 9408
+324.176336 1700.68 9408
+324.185744 1700.68 9408
+324.195152 1700.68 9408
+324.204560 1700.68 9408
+324.213968 1700.68 9408
+324.223376 1700.68 9408
+324.232784 1700.68 9408
+324.242192 1700.68 9408
+324.251600 1700.68 9408
+324.261008 1700.68 9408
+324.270416 1700.68 9408
+324.279824 1700.68 9408
+324.289232 1700.68 9408
+324.298640 1700.68 9408
+324.308048 1700.68 9408
+324.317456 1700.68 9408
+324.326864 1700.68 9408
+324.336272 1700.68 9408
+324.345680 1700.68 9408
+324.355088 1700.68 9408
+324.364496 1700.68 9408
+324.373904 1700.68 9408
+324.383376 1689.19 9472
+324.392848 1689.19 9472
+324.402320 1689.19 9472
+324.411792 1689.19 9472
+324.421264 1689.19 9472
+324.430736 1689.19 9472
+324.440208 1689.19 9472
+324.449680 1689.19 9472
+324.459152 1689.19 9472
+324.468624 1689.19 9472
+324.478096 1689.19 9472
+324.487568 1689.19 9472
+324.497040 1689.19 9472
+324.506512 1689.19 9472
+324.515984 1689.19 9472
+324.525456 1689.19 9472
+324.534992 1677.85 9536
+324.544528 1677.85 9536
+324.554064 1677.85 9536
+324.563600 1677.85 9536
+324.573136 1677.85 9536
+324.582672 1677.85 9536
+324.592208 1677.85 9536
+324.601744 1677.85 9536
+324.611344 1666.67 9600
+324.620944 1666.67 9600
+324.630544 1666.67 9600
+324.640144 1666.67 9600
+324.649744 1666.67 9600
+324.659344 1666.67 9600
+324.668944 1666.67 9600
+324.678544 1666.67 9600
+324.688144 1666.67 9600
+324.697744 1666.67 9600
+324.707344 1666.67 9600
+324.716944 1666.67 9600
+324.726544 1666.67 9600
+324.736144 1666.67 9600
+324.745744 1666.67 9600
+324.755344 1666.67 9600
+324.765008 1655.63 9664
+324.774672 1655.63 9664
+324.784336 1655.63 9664
+324.794000 1655.63 9664
+324.803664 1655.63 9664
+324.813328 1655.63 9664
+324.822992 1655.63 9664
+324.832656 1655.63 9664
+324.842320 1655.63 9664
+324.851984 1655.63 9664
+324.861648 1655.63 9664
+324.871312 1655.63 9664
+324.880976 1655.63 9664
+324.890640 1655.63 9664
+324.900304 1655.63 9664
+324.909968 1655.63 9664
+324.919696 1644.74 9728
+324.929424 1644.74 9728
+324.939152 1644.74 9728
+324.948880 1644.74 9728
+324.958608 1644.74 9728
+324.968336 1644.74 9728
+324.978064 1644.74 9728
+324.987792 1644.74 9728
+324.997520 1644.74 9728
+325.007248 1644.74 9728
+325.016976 1644.74 9728
+325.026704 1644.74 9728
+325.036432 1644.74 9728
+325.046160 1644.74 9728
+325.055888 1644.74 9728
+325.065616 1644.74 9728
+325.075344 1644.74 9728
+325.085072 1644.74 9728
+325.094800 1644.74 9728
+325.104528 1644.74 9728
+325.114256 1644.74 9728
+325.123984 1644.74 9728
+325.133712 1644.74 9728
+325.143440 1644.74 9728
+325.153168 1644.74 9728
+325.162896 1644.74 9728
+325.172624 1644.74 9728
+325.182352 1644.74 9728
+325.192080 1644.74 9728
+325.201808 1644.74 9728
+325.211536 1644.74 9728
+325.221264 1644.74 9728
+325.231056 1633.99 9792
+325.240848 1633.99 9792
+325.250640 1633.99 9792
+325.260432 1633.99 9792
+325.270224 1633.99 9792
+325.280016 1633.99 9792
+325.289808 1633.99 9792
+325.299600 1633.99 9792
+325.309392 1633.99 9792
+325.319184 1633.99 9792
+325.328976 1633.99 9792
+325.338768 1633.99 9792
+325.348560 1633.99 9792
+325.358352 1633.99 9792
+325.368144 1633.99 9792
+325.377936 1633.99 9792
+325.387792 1623.38 9856
+325.397648 1623.38 9856
+325.407504 1623.38 9856
+325.417360 1623.38 9856
+325.427216 1623.38 9856
+325.437072 1623.38 9856
+325.446928 1623.38 9856
+325.456784 1623.38 9856
+325.466704 1612.90 9920
+325.476624 1612.90 9920
+325.486544 1612.90 9920
+325.496464 1612.90 9920
+325.506384 1612.90 9920
+325.516304 1612.90 9920
+325.526224 1612.90 9920
+325.536144 1612.90 9920
+325.546064 1612.90 9920
+325.555984 1612.90 9920
+325.565904 1612.90 9920
+325.575824 1612.90 9920
+325.585744 1612.90 9920
+325.595664 1612.90 9920
+325.605584 1612.90 9920
+325.615504 1612.90 9920
+325.625488 1602.56 9984
+325.635472 1602.56 9984
+325.645456 1602.56 9984
+325.655440 1602.56 9984
+325.665424 1602.56 9984
+325.675408 1602.56 9984
+325.685392 1602.56 9984
+325.695376 1602.56 9984
+325.705360 1602.56 9984
+325.715344 1602.56 9984
+325.725328 1602.56 9984
+325.735312 1602.56 9984
+325.745296 1602.56 9984
+325.755280 1602.56 9984
+325.765264 1602.56 9984
+325.775248 1602.56 9984
+325.785296 1592.36 10048
+325.795344 1592.36 10048
+325.805392 1592.36 10048
+325.815440 1592.36 10048
+325.825488 1592.36 10048
+325.835536 1592.36 10048
+325.845584 1592.36 10048
+325.855632 1592.36 10048
+325.865680 1592.36 10048
+325.875728 1592.36 10048
+325.885776 1592.36 10048
+325.895824 1592.36 10048
+325.905872 1592.36 10048
+325.915920 1592.36 10048
+325.925968 1592.36 10048
+325.936016 1592.36 10048
+325.946064 1592.36 10048
+325.956112 1592.36 10048
+325.966160 1592.36 10048
+325.976208 1592.36 10048
+325.986256 1592.36 10048
+325.996304 1592.36 10048
+326.006352 1592.36 10048
+326.016400 1592.36 10048
+326.026512 1582.28 10112
+326.036624 1582.28 10112
+326.046736 1582.28 10112
+326.056848 1582.28 10112
+326.066960 1582.28 10112
+326.077072 1582.28 10112
+326.087184 1582.28 10112
+326.097296 1582.28 10112
+326.107408 1582.28 10112
+326.117520 1582.28 10112
+326.127632 1582.28 10112
+326.137744 1582.28 10112
+326.147856 1582.28 10112
+326.157968 1582.28 10112
+326.168080 1582.28 10112
+326.178192 1582.28 10112
+326.188368 1572.33 10176
+326.198544 1572.33 10176
+326.208720 1572.33 10176
+326.218896 1572.33 10176
+326.229072 1572.33 10176
+326.239248 1572.33 10176
+326.249424 1572.33 10176
+326.259600 1572.33 10176
+326.269776 1572.33 10176
+326.279952 1572.33 10176
+326.290128 1572.33 10176
+326.300304 1572.33 10176
+326.310480 1572.33 10176
+326.320656 1572.33 10176
+326.330832 1572.33 10176
+326.341008 1572.33 10176
+326.351248 1562.50 10240
+326.361488 1562.50 10240
+326.371728 1562.50 10240
+326.381968 1562.50 10240
+326.392208 1562.50 10240
+326.402448 1562.50 10240
+326.412688 1562.50 10240
+326.422928 1562.50 10240
+326.433232 1552.80 10304
+326.443536 1552.80 10304
+326.453840 1552.80 10304
+326.464144 1552.80 10304
+326.474448 1552.80 10304
+326.484752 1552.80 10304
+326.495056 1552.80 10304
+326.505360 1552.80 10304
+326.515664 1552.80 10304
+326.525968 1552.80 10304
+326.536272 1552.80 10304
+326.546576 1552.80 10304
+326.556880 1552.80 10304
+326.567184 1552.80 10304
+326.577488 1552.80 10304
+326.587792 1552.80 10304
+326.598160 1543.21 10368
+326.608528 1543.21 10368
+326.618896 1543.21 10368
+326.629264 1543.21 10368
+326.639632 1543.21 10368
+326.650000 1543.21 10368
+326.660368 1543.21 10368
+326.670736 1543.21 10368
+326.681104 1543.21 10368
+326.691472 1543.21 10368
+326.701840 1543.21 10368
+326.712208 1543.21 10368
+326.722576 1543.21 10368
+326.732944 1543.21 10368
+326.743312 1543.21 10368
+326.753680 1543.21 10368
+326.764112 1533.74 10432
+326.774544 1533.74 10432
+326.784976 1533.74 10432
+326.795408 1533.74 10432
+326.805840 1533.74 10432
+326.816272 1533.74 10432
+326.826704 1533.74 10432
+326.837136 1533.74 10432
+326.847568 1533.74 10432
+326.858000 1533.74 10432
+326.868432 1533.74 10432
+326.878864 1533.74 10432
+326.889296 1533.74 10432
+326.899728 1533.74 10432
+326.910160 1533.74 10432
+326.920592 1533.74 10432
+326.931024 1533.74 10432
+326.941456 1533.74 10432
+326.951888 1533.74 10432
+326.962320 1533.74 10432
+326.972752 1533.74 10432
+326.983184 1533.74 10432
+326.993616 1533.74 10432
+327.004048 1533.74 10432
+327.014544 1524.39 10496
+327.025040 1524.39 10496
+327.035536 1524.39 10496
+327.046032 1524.39 10496
+327.056528 1524.39 10496
+327.067024 1524.39 10496
+327.077520 1524.39 10496
+327.088016 1524.39 10496
+327.098576 1515.15 10560
+327.109136 1515.15 10560
+327.119696 1515.15 10560
+327.130256 1515.15 10560
+327.140816 1515.15 10560
+327.151376 1515.15 10560
+327.161936 1515.15 10560
+327.172496 1515.15 10560
+327.183056 1515.15 10560
+327.193616 1515.15 10560
+327.204176 1515.15 10560
+327.214736 1515.15 10560
+327.225296 1515.15 10560
+327.235856 1515.15 10560
+327.246416 1515.15 10560
+327.256976 1515.15 10560
+327.267600 1506.02 10624
+327.278224 1506.02 10624
+327.288848 1506.02 10624
+327.299472 1506.02 10624
+327.310096 1506.02 10624
+327.320720 1506.02 10624
+327.331344 1506.02 10624
+327.341968 1506.02 10624
+327.352656 1497.01 10688
+327.363344 1497.01 10688
+327.374032 1497.01 10688
+327.384720 1497.01 10688
+327.395408 1497.01 10688
+327.406096 1497.01 10688
+327.416784 1497.01 10688
+327.427472 1497.01 10688
+327.438160 1497.01 10688
+327.448848 1497.01 10688
+327.459536 1497.01 10688
+327.470224 1497.01 10688
+327.480912 1497.01 10688
+327.491600 1497.01 10688
+327.502288 1497.01 10688
+327.512976 1497.01 10688
+327.523728 1488.10 10752
+327.534480 1488.10 10752
+327.545232 1488.10 10752
+327.555984 1488.10 10752
+327.566736 1488.10 10752
+327.577488 1488.10 10752
+327.588240 1488.10 10752
+327.598992 1488.10 10752
+327.609808 1479.29 10816
+327.620624 1479.29 10816
+327.631440 1479.29 10816
+327.642256 1479.29 10816
+327.653072 1479.29 10816
+327.663888 1479.29 10816
+327.674704 1479.29 10816
+327.685520 1479.29 10816
+327.696336 1479.29 10816
+327.707152 1479.29 10816
+327.717968 1479.29 10816
+327.728784 1479.29 10816
+327.739600 1479.29 10816
+327.750416 1479.29 10816
+327.761232 1479.29 10816
+327.772048 1479.29 10816
+327.782928 1470.59 10880
+327.793808 1470.59 10880
+327.804688 1470.59 10880
+327.815568 1470.59 10880
+327.826448 1470.59 10880
+327.837328 1470.59 10880
+327.848208 1470.59 10880
+327.859088 1470.59 10880
+327.870032 1461.99 10944
+327.880976 1461.99 10944
+327.891920 1461.99 10944
+327.902864 1461.99 10944
+327.913808 1461.99 10944
+327.924752 1461.99 10944
+327.935696 1461.99 10944
+327.946640 1461.99 10944
+327.957584 1461.99 10944
+327.968528 1461.99 10944
+327.979472 1461.99 10944
+327.990416 1461.99 10944
+328.001360 1461.99 10944
+328.012304 1461.99 10944
+328.023248 1461.99 10944
+328.034192 1461.99 10944
+328.045200 1453.49 11008
+328.056208 1453.49 11008
+328.067216 1453.49 11008
+328.078224 1453.49 11008
+328.089232 1453.49 11008
+328.100240 1453.49 11008
+328.111248 1453.49 11008
+328.122256 1453.49 11008
+328.133328 1445.09 11072
+328.144400 1445.09 11072
+328.155472 1445.09 11072
+328.166544 1445.09 11072
+328.177616 1445.09 11072
+328.188688 1445.09 11072
+328.199760 1445.09 11072
+328.210832 1445.09 11072
+328.221904 1445.09 11072
+328.232976 1445.09 11072
+328.244048 1445.09 11072
+328.255120 1445.09 11072
+328.266192 1445.09 11072
+328.277264 1445.09 11072
+328.288336 1445.09 11072
+328.299408 1445.09 11072
+328.310544 1436.78 11136
+328.321680 1436.78 11136
+328.332816 1436.78 11136
+328.343952 1436.78 11136
+328.355088 1436.78 11136
+328.366224 1436.78 11136
+328.377360 1436.78 11136
+328.388496 1436.78 11136
+328.399632 1436.78 11136
+328.410768 1436.78 11136
+328.421904 1436.78 11136
+328.433040 1436.78 11136
+328.444176 1436.78 11136
+328.455312 1436.78 11136
+328.466448 1436.78 11136
+328.477584 1436.78 11136
+328.488720 1436.78 11136
+328.499856 1436.78 11136
+328.510992 1436.78 11136
+328.522128 1436.78 11136
+328.533328 1428.57 11200
+328.544528 1428.57 11200
+328.555728 1428.57 11200
+328.566928 1428.57 11200
+328.578128 1428.57 11200
+328.589328 1428.57 11200
+328.600528 1428.57 11200
+328.611728 1428.57 11200
+328.622928 1428.57 11200
+328.634128 1428.57 11200
+328.645328 1428.57 11200
+328.656528 1428.57 11200
+328.667792 1420.45 11264
+328.679056 1420.45 11264
+328.690320 1420.45 11264
+328.701584 1420.45 11264
+328.712848 1420.45 11264
+328.724112 1420.45 11264
+328.735376 1420.45 11264
+328.746640 1420.45 11264
+328.757904 1420.45 11264
+328.769168 1420.45 11264
+328.780432 1420.45 11264
+328.791696 1420.45 11264
+328.803024 1412.43 11328
+328.814352 1412.43 11328
+328.825680 1412.43 11328
+328.837008 1412.43 11328
+328.848336 1412.43 11328
+328.859664 1412.43 11328
+328.870992 1412.43 11328
+328.882320 1412.43 11328
+328.893712 1404.49 11392
+328.905104 1404.49 11392
+328.916496 1404.49 11392
+328.927888 1404.49 11392
+328.939280 1404.49 11392
+328.950672 1404.49 11392
+328.962064 1404.49 11392
+328.973456 1404.49 11392
+328.984848 1404.49 11392
+328.996240 1404.49 11392
+329.007632 1404.49 11392
+329.019024 1404.49 11392
+329.030480 1396.65 11456
+329.041936 1396.65 11456
+329.053392 1396.65 11456
+329.064848 1396.65 11456
+329.076304 1396.65 11456
+329.087760 1396.65 11456
+329.099216 1396.65 11456
+329.110672 1396.65 11456
+329.122128 1396.65 11456
+329.133584 1396.65 11456
+329.145040 1396.65 11456
+329.156496 1396.65 11456
+329.168016 1388.89 11520
+329.179536 1388.89 11520
+329.191056 1388.89 11520
+329.202576 1388.89 11520
+329.214096 1388.89 11520
+329.225616 1388.89 11520
+329.237136 1388.89 11520
+329.248656 1388.89 11520
+329.260240 1381.22 11584
+329.271824 1381.22 11584
+329.283408 1381.22 11584
+329.294992 1381.22 11584
+329.306576 1381.22 11584
+329.318160 1381.22 11584
+329.329744 1381.22 11584
+329.341328 1381.22 11584
+329.352912 1381.22 11584
+329.364496 1381.22 11584
+329.376080 1381.22 11584
+329.387664 1381.22 11584
+329.399312 1373.63 11648
+329.410960 1373.63 11648
+329.422608 1373.63 11648
+329.434256 1373.63 11648
+329.445904 1373.63 11648
+329.457552 1373.63 11648
+329.469200 1373.63 11648
+329.480848 1373.63 11648
+329.492560 1366.12 11712
+329.504272 1366.12 11712
+329.515984 1366.12 11712
+329.527696 1366.12 11712
+329.539408 1366.12 11712
+329.551120 1366.12 11712
+329.562832 1366.12 11712
+329.574544 1366.12 11712
+329.586256 1366.12 11712
+329.597968 1366.12 11712
+329.609680 1366.12 11712
+329.621392 1366.12 11712
+329.633168 1358.70 11776
+329.644944 1358.70 11776
+329.656720 1358.70 11776
+329.668496 1358.70 11776
+329.680272 1358.70 11776
+329.692048 1358.70 11776
+329.703824 1358.70 11776
+329.715600 1358.70 11776
+329.727440 1351.35 11840
+329.739280 1351.35 11840
+329.751120 1351.35 11840
+329.762960 1351.35 11840
+329.774800 1351.35 11840
+329.786640 1351.35 11840
+329.798480 1351.35 11840
+329.810320 1351.35 11840
+329.822160 1351.35 11840
+329.834000 1351.35 11840
+329.845840 1351.35 11840
+329.857680 1351.35 11840
+329.869584 1344.09 11904
+329.881488 1344.09 11904
+329.893392 1344.09 11904
+329.905296 1344.09 11904
+329.917200 1344.09 11904
+329.929104 1344.09 11904
+329.941008 1344.09 11904
+329.952912 1344.09 11904
+329.964880 1336.90 11968
+329.976848 1336.90 11968
+329.988816 1336.90 11968
+330.000784 1336.90 11968
+330.012752 1336.90 11968
+330.024720 1336.90 11968
+330.036688 1336.90 11968
+330.048656 1336.90 11968
+330.060624 1336.90 11968
+330.072592 1336.90 11968
+330.084560 1336.90 11968
+330.096528 1336.90 11968
+330.108560 1329.79 12032
+330.120592 1329.79 12032
+330.132624 1329.79 12032
+330.144656 1329.79 12032
+330.156688 1329.79 12032
+330.168720 1329.79 12032
+330.180752 1329.79 12032
+330.192784 1329.79 12032
+330.204880 1322.75 12096
+330.216976 1322.75 12096
+330.229072 1322.75 12096
+330.241168 1322.75 12096
+330.253264 1322.75 12096
+330.265360 1322.75 12096
+330.277456 1322.75 12096
+330.289552 1322.75 12096
+330.301712 1315.79 12160
+330.313872 1315.79 12160
+330.326032 1315.79 12160
+330.338192 1315.79 12160
+330.350352 1315.79 12160
+330.362512 1315.79 12160
+330.374672 1315.79 12160
+330.386832 1315.79 12160
+330.398992 1315.79 12160
+330.411152 1315.79 12160
+330.423312 1315.79 12160
+330.435472 1315.79 12160
+330.447696 1308.90 12224
+330.459920 1308.90 12224
+330.472144 1308.90 12224
+330.484368 1308.90 12224
+330.496592 1308.90 12224
+330.508816 1308.90 12224
+330.521040 1308.90 12224
+330.533264 1308.90 12224
+330.545552 1302.08 12288
+330.557840 1302.08 12288
+330.570128 1302.08 12288
+330.582416 1302.08 12288
+330.594704 1302.08 12288
+330.606992 1302.08 12288
+330.619280 1302.08 12288
+330.631568 1302.08 12288
+330.643920 1295.34 12352
+330.656272 1295.34 12352
+330.668624 1295.34 12352
+330.680976 1295.34 12352
+330.693328 1295.34 12352
+330.705680 1295.34 12352
+330.718032 1295.34 12352
+330.730384 1295.34 12352
+330.742736 1295.34 12352
+330.755088 1295.34 12352
+330.767440 1295.34 12352
+330.779792 1295.34 12352
+330.792208 1288.66 12416
+330.804624 1288.66 12416
+330.817040 1288.66 12416
+330.829456 1288.66 12416
+330.841872 1288.66 12416
+330.854288 1288.66 12416
+330.866704 1288.66 12416
+330.879120 1288.66 12416
+330.891664 1275.51 12544
+330.904208 1275.51 12544
+330.916752 1275.51 12544
+330.929296 1275.51 12544
+330.941840 1275.51 12544
+330.954384 1275.51 12544
+330.966928 1275.51 12544
+330.979472 1275.51 12544
+330.992080 1269.04 12608
+331.004688 1269.04 12608
+331.017296 1269.04 12608
+331.029904 1269.04 12608
+331.042512 1269.04 12608
+331.055120 1269.04 12608
+331.067728 1269.04 12608
+331.080336 1269.04 12608
+331.093008 1262.63 12672
+331.105680 1262.63 12672
+331.118352 1262.63 12672
+331.131024 1262.63 12672
+331.143696 1262.63 12672
+331.156368 1262.63 12672
+331.169040 1262.63 12672
+331.181712 1262.63 12672
+331.194448 1256.28 12736
+331.207184 1256.28 12736
+331.219920 1256.28 12736
+331.232656 1256.28 12736
+331.245392 1256.28 12736
+331.258128 1256.28 12736
+331.270864 1256.28 12736
+331.283600 1256.28 12736
+331.296400 1250.00 12800
+331.309200 1250.00 12800
+331.322000 1250.00 12800
+331.334800 1250.00 12800
+331.347600 1250.00 12800
+331.360400 1250.00 12800
+331.373200 1250.00 12800
+331.386000 1250.00 12800
+331.398800 1250.00 12800
+331.411600 1250.00 12800
+331.424400 1250.00 12800
+331.437200 1250.00 12800
+331.450064 1243.78 12864
+331.462928 1243.78 12864
+331.475792 1243.78 12864
+331.488656 1243.78 12864
+331.501520 1243.78 12864
+331.514384 1243.78 12864
+331.527248 1243.78 12864
+331.540112 1243.78 12864
+331.553040 1237.62 12928
+331.565968 1237.62 12928
+331.578896 1237.62 12928
+331.591824 1237.62 12928
+331.604752 1237.62 12928
+331.617680 1237.62 12928
+331.630608 1237.62 12928
+331.643536 1237.62 12928
+331.656528 1231.53 12992
+331.669520 1231.53 12992
+331.682512 1231.53 12992
+331.695504 1231.53 12992
+331.708496 1231.53 12992
+331.721488 1231.53 12992
+331.734480 1231.53 12992
+331.747472 1231.53 12992
+331.760528 1225.49 13056
+331.773584 1225.49 13056
+331.786640 1225.49 13056
+331.799696 1225.49 13056
+331.812752 1225.49 13056
+331.825808 1225.49 13056
+331.838864 1225.49 13056
+331.851920 1225.49 13056
+331.865040 1219.51 13120
+331.878160 1219.51 13120
+331.891280 1219.51 13120
+331.904400 1219.51 13120
+331.917520 1219.51 13120
+331.930640 1219.51 13120
+331.943760 1219.51 13120
+331.956880 1219.51 13120
+331.970064 1213.59 13184
+331.983248 1213.59 13184
+331.996432 1213.59 13184
+332.009616 1213.59 13184
+332.022800 1213.59 13184
+332.035984 1213.59 13184
+332.049168 1213.59 13184
+332.062352 1213.59 13184
+332.075664 1201.92 13312
+332.088976 1201.92 13312
+332.102288 1201.92 13312
+332.115600 1201.92 13312
+332.128912 1201.92 13312
+332.142224 1201.92 13312
+332.155536 1201.92 13312
+332.168848 1201.92 13312
+332.182224 1196.17 13376
+332.195600 1196.17 13376
+332.208976 1196.17 13376
+332.222352 1196.17 13376
+332.235728 1196.17 13376
+332.249104 1196.17 13376
+332.262480 1196.17 13376
+332.275856 1196.17 13376
+332.289296 1190.48 13440
+332.302736 1190.48 13440
+332.316176 1190.48 13440
+332.329616 1190.48 13440
+332.343056 1190.48 13440
+332.356496 1190.48 13440
+332.369936 1190.48 13440
+332.383376 1190.48 13440
+332.396880 1184.83 13504
+332.410384 1184.83 13504
+332.423888 1184.83 13504
+332.437392 1184.83 13504
+332.450960 1179.25 13568
+332.464528 1179.25 13568
+332.478096 1179.25 13568
+332.491664 1179.25 13568
+332.505232 1179.25 13568
+332.518800 1179.25 13568
+332.532368 1179.25 13568
+332.545936 1179.25 13568
+332.559568 1173.71 13632
+332.573200 1173.71 13632
+332.586832 1173.71 13632
+332.600464 1173.71 13632
+332.614096 1173.71 13632
+332.627728 1173.71 13632
+332.641360 1173.71 13632
+332.654992 1173.71 13632
+332.668688 1168.22 13696
+332.682384 1168.22 13696
+332.696080 1168.22 13696
+332.709776 1168.22 13696
+332.723472 1168.22 13696
+332.737168 1168.22 13696
+332.750864 1168.22 13696
+332.764560 1168.22 13696
+332.778384 1157.41 13824
+332.792208 1157.41 13824
+332.806032 1157.41 13824
+332.819856 1157.41 13824
+332.833680 1157.41 13824
+332.847504 1157.41 13824
+332.861328 1157.41 13824
+332.875152 1157.41 13824
+332.889040 1152.07 13888
+332.902928 1152.07 13888
+332.916816 1152.07 13888
+332.930704 1152.07 13888
+332.944592 1152.07 13888
+332.958480 1152.07 13888
+332.972368 1152.07 13888
+332.986256 1152.07 13888
+333.000208 1146.79 13952
+333.014160 1146.79 13952
+333.028112 1146.79 13952
+333.042064 1146.79 13952
+333.056080 1141.55 14016
+333.070096 1141.55 14016
+333.084112 1141.55 14016
+333.098128 1141.55 14016
+333.112144 1141.55 14016
+333.126160 1141.55 14016
+333.140176 1141.55 14016
+333.154192 1141.55 14016
+333.168272 1136.36 14080
+333.182352 1136.36 14080
+333.196432 1136.36 14080
+333.210512 1136.36 14080
+333.224592 1136.36 14080
+333.238672 1136.36 14080
+333.252752 1136.36 14080
+333.266832 1136.36 14080
+333.280976 1131.22 14144
+333.295120 1131.22 14144
+333.309264 1131.22 14144
+333.323408 1131.22 14144
+333.337552 1131.22 14144
+333.351696 1131.22 14144
+333.365840 1131.22 14144
+333.379984 1131.22 14144
+333.394256 1121.08 14272
+333.408528 1121.08 14272
+333.422800 1121.08 14272
+333.437072 1121.08 14272
+333.451408 1116.07 14336
+333.465744 1116.07 14336
+333.480080 1116.07 14336
+333.494416 1116.07 14336
+333.508752 1116.07 14336
+333.523088 1116.07 14336
+333.537424 1116.07 14336
+333.551760 1116.07 14336
+333.566160 1111.11 14400
+333.580560 1111.11 14400
+333.594960 1111.11 14400
+333.609360 1111.11 14400
+333.623760 1111.11 14400
+333.638160 1111.11 14400
+333.652560 1111.11 14400
+333.666960 1111.11 14400
+333.681424 1106.19 14464
+333.695888 1106.19 14464
+333.710352 1106.19 14464
+333.724816 1106.19 14464
+333.739408 1096.49 14592
+333.754000 1096.49 14592
+333.768592 1096.49 14592
+333.783184 1096.49 14592
+333.797776 1096.49 14592
+333.812368 1096.49 14592
+333.826960 1096.49 14592
+333.841552 1096.49 14592
+333.856208 1091.70 14656
+333.870864 1091.70 14656
+333.885520 1091.70 14656
+333.900176 1091.70 14656
+333.914832 1091.70 14656
+333.929488 1091.70 14656
+333.944144 1091.70 14656
+333.958800 1091.70 14656
+333.973520 1086.96 14720
+333.988240 1086.96 14720
+334.002960 1086.96 14720
+334.017680 1086.96 14720
+334.032464 1082.25 14784
+334.047248 1082.25 14784
+334.062032 1082.25 14784
+334.076816 1082.25 14784
+334.091600 1082.25 14784
+334.106384 1082.25 14784
+334.121168 1082.25 14784
+334.135952 1082.25 14784
+334.150864 1072.96 14912
+334.165776 1072.96 14912
+334.180688 1072.96 14912
+334.195600 1072.96 14912
+334.210576 1068.38 14976
+334.225552 1068.38 14976
+334.240528 1068.38 14976
+334.255504 1068.38 14976
+334.270480 1068.38 14976
+334.285456 1068.38 14976
+334.300432 1068.38 14976
+334.315408 1068.38 14976
+334.330448 1063.83 15040
+334.345488 1063.83 15040
+334.360528 1063.83 15040
+334.375568 1063.83 15040
+334.390672 1059.32 15104
+334.405776 1059.32 15104
+334.420880 1059.32 15104
+334.435984 1059.32 15104
+334.451088 1059.32 15104
+334.466192 1059.32 15104
+334.481296 1059.32 15104
+334.496400 1059.32 15104
+334.511632 1050.42 15232
+334.526864 1050.42 15232
+334.542096 1050.42 15232
+334.557328 1050.42 15232
+334.572624 1046.03 15296
+334.587920 1046.03 15296
+334.603216 1046.03 15296
+334.618512 1046.03 15296
+334.633808 1046.03 15296
+334.649104 1046.03 15296
+334.664400 1046.03 15296
+334.679696 1046.03 15296
+334.695056 1041.67 15360
+334.710416 1041.67 15360
+334.725776 1041.67 15360
+334.741136 1041.67 15360
+334.756624 1033.06 15488
+334.772112 1033.06 15488
+334.787600 1033.06 15488
+334.803088 1033.06 15488
+334.818576 1033.06 15488
+334.834064 1033.06 15488
+334.849552 1033.06 15488
+334.865040 1033.06 15488
+334.880592 1028.81 15552
+334.896144 1028.81 15552
+334.911696 1028.81 15552
+334.927248 1028.81 15552
+334.942864 1024.59 15616
+334.958480 1024.59 15616
+334.974096 1024.59 15616
+334.989712 1024.59 15616
+335.005328 1024.59 15616
+335.020944 1024.59 15616
+335.036560 1024.59 15616
+335.052176 1024.59 15616
+335.067920 1016.26 15744
+335.083664 1016.26 15744
+335.099408 1016.26 15744
+335.115152 1016.26 15744
+335.130960 1012.15 15808
+335.146768 1012.15 15808
+335.162576 1012.15 15808
+335.178384 1012.15 15808
+335.194192 1012.15 15808
+335.210000 1012.15 15808
+335.225872 1008.06 15872
+335.241744 1008.06 15872
+335.257616 1008.06 15872
+335.273488 1008.06 15872
+335.289360 1008.06 15872
+335.305232 1008.06 15872
+335.321232 1000.00 16000
+335.337232 1000.00 16000
+335.353232 1000.00 16000
+335.369232 1000.00 16000
+335.385232 1000.00 16000
+335.401232 1000.00 16000
+335.417296 996.02 16064
+335.433360 996.02 16064
+335.449424 996.02 16064
+335.465488 996.02 16064
+335.481616 992.06 16128
+335.497744 992.06 16128
+335.513872 992.06 16128
+335.530000 992.06 16128
+335.546128 992.06 16128
+335.562256 992.06 16128
+335.578512 984.25 16256
+335.594768 984.25 16256
+335.611024 984.25 16256
+335.627280 984.25 16256
+335.643536 984.25 16256
+335.659792 984.25 16256
+335.676112 980.39 16320
+335.692432 980.39 16320
+335.708752 980.39 16320
+335.725072 980.39 16320
+335.741456 976.56 16384
+335.757840 976.56 16384
+335.774224 976.56 16384
+335.790608 976.56 16384
+335.806992 976.56 16384
+335.823376 976.56 16384
+335.839888 968.99 16512
+335.856400 968.99 16512
+335.872912 968.99 16512
+335.889424 968.99 16512
+335.905936 968.99 16512
+335.922448 968.99 16512
+335.938960 968.99 16512
+335.955472 968.99 16512
+335.971984 968.99 16512
+335.988496 968.99 16512
+336.005136 961.54 16640
+336.021776 961.54 16640
+336.038416 961.54 16640
+336.055056 961.54 16640
+336.071824 954.20 16768
+336.088592 954.20 16768
+336.105360 954.20 16768
+336.122128 954.20 16768
+336.138896 954.20 16768
+336.155664 954.20 16768
+336.172560 946.97 16896
+336.189456 946.97 16896
+336.206352 946.97 16896
+336.223248 946.97 16896
+336.240144 946.97 16896
+336.257040 946.97 16896
+336.273936 946.97 16896
+336.290832 946.97 16896
+336.307728 946.97 16896
+336.324624 946.97 16896
+336.341648 939.85 17024
+336.358672 939.85 17024
+336.375696 939.85 17024
+336.392720 939.85 17024
+336.409872 932.84 17152
+336.427024 932.84 17152
+336.444176 932.84 17152
+336.461328 932.84 17152
+336.478608 925.93 17280
+336.495888 925.93 17280
+336.513168 925.93 17280
+336.530448 925.93 17280
+336.547728 925.93 17280
+336.565008 925.93 17280
+336.582288 925.93 17280
+336.599568 925.93 17280
+336.616848 925.93 17280
+336.634128 925.93 17280
+336.651536 919.12 17408
+336.668944 919.12 17408
+336.686352 919.12 17408
+336.703760 919.12 17408
+336.721296 912.41 17536
+336.738832 912.41 17536
+336.756368 912.41 17536
+336.773904 912.41 17536
+336.791440 912.41 17536
+336.808976 912.41 17536
+336.826512 912.41 17536
+336.844048 912.41 17536
+336.861584 912.41 17536
+336.879120 912.41 17536
+336.896784 905.80 17664
+336.914448 905.80 17664
+336.932112 905.80 17664
+336.949776 905.80 17664
+336.967568 899.28 17792
+336.985360 899.28 17792
+337.003152 899.28 17792
+337.020944 899.28 17792
+337.038864 892.86 17920
+337.056784 892.86 17920
+337.074704 892.86 17920
+337.092624 892.86 17920
+337.110544 892.86 17920
+337.128464 892.86 17920
+337.146384 892.86 17920
+337.164304 892.86 17920
+337.182352 886.52 18048
+337.200400 886.52 18048
+337.218448 886.52 18048
+337.236496 886.52 18048
+337.254544 886.52 18048
+337.272592 886.52 18048
+337.290768 880.28 18176
+337.308944 880.28 18176
+337.327120 880.28 18176
+337.345296 880.28 18176
+337.363600 874.13 18304
+337.381904 874.13 18304
+337.400208 874.13 18304
+337.418512 874.13 18304
+337.436944 868.06 18432
+337.455376 868.06 18432
+337.473808 868.06 18432
+337.492240 868.06 18432
+337.510672 868.06 18432
+337.529104 868.06 18432
+337.547536 868.06 18432
+337.565968 868.06 18432
+337.584528 862.07 18560
+337.603088 862.07 18560
+337.621648 862.07 18560
+337.640208 862.07 18560
+337.658896 856.16 18688
+337.677584 856.16 18688
+337.696272 856.16 18688
+337.714960 856.16 18688
+337.733776 850.34 18816
+337.752592 850.34 18816
+337.771408 850.34 18816
+337.790224 850.34 18816
+337.809040 850.34 18816
+337.827856 850.34 18816
+337.846672 850.34 18816
+337.865488 850.34 18816
+337.884432 844.59 18944
+337.903376 844.59 18944
+337.922320 844.59 18944
+337.941264 844.59 18944
+337.960336 838.93 19072
+337.979408 838.93 19072
+337.998608 833.33 19200
+338.017808 833.33 19200
+338.037008 833.33 19200
+338.056208 833.33 19200
+338.075536 827.81 19328
+338.094864 827.81 19328
+338.114192 827.81 19328
+338.133520 827.81 19328
+338.152976 822.37 19456
+338.172432 822.37 19456
+338.191888 822.37 19456
+338.211344 822.37 19456
+338.230800 822.37 19456
+338.250256 822.37 19456
+338.269712 822.37 19456
+338.289168 822.37 19456
+338.308752 816.99 19584
+338.328336 816.99 19584
+338.347920 816.99 19584
+338.367504 816.99 19584
+338.387216 811.69 19712
+338.406928 811.69 19712
+338.426768 806.45 19840
+338.446608 806.45 19840
+338.466448 806.45 19840
+338.486288 806.45 19840
+338.506256 801.28 19968
+338.526224 801.28 19968
+338.546192 801.28 19968
+338.566160 801.28 19968
+338.586256 796.18 20096
+338.606352 796.18 20096
+338.626448 796.18 20096
+338.646544 796.18 20096
+338.666640 796.18 20096
+338.686736 796.18 20096
+338.706960 791.14 20224
+338.727184 791.14 20224
+338.747408 791.14 20224
+338.767632 791.14 20224
+338.787984 786.16 20352
+338.808336 786.16 20352
+338.828688 786.16 20352
+338.849040 786.16 20352
+338.869520 781.25 20480
+338.890000 781.25 20480
+338.910608 776.40 20608
+338.931216 776.40 20608
+338.951824 776.40 20608
+338.972432 776.40 20608
+338.993168 771.60 20736
+339.013904 771.60 20736
+339.034640 771.60 20736
+339.055376 771.60 20736
+339.076240 766.87 20864
+339.097104 766.87 20864
+339.117968 766.87 20864
+339.138832 766.87 20864
+339.159696 766.87 20864
+339.180560 766.87 20864
+339.201552 762.20 20992
+339.222544 762.20 20992
+339.243664 757.58 21120
+339.264784 757.58 21120
+339.285904 757.58 21120
+339.307024 757.58 21120
+339.328272 753.01 21248
+339.349520 753.01 21248
+339.370896 748.50 21376
+339.392272 748.50 21376
+339.413648 748.50 21376
+339.435024 748.50 21376
+339.456528 744.05 21504
+339.478032 744.05 21504
+339.499664 739.64 21632
+339.521296 739.64 21632
+339.542928 739.64 21632
+339.564560 739.64 21632
+339.586320 735.29 21760
+339.608080 735.29 21760
+339.629968 730.99 21888
+339.651856 730.99 21888
+339.673744 730.99 21888
+339.695632 730.99 21888
+339.717648 726.74 22016
+339.739664 726.74 22016
+339.761808 722.54 22144
+339.783952 722.54 22144
+339.806096 722.54 22144
+339.828240 722.54 22144
+339.850512 718.39 22272
+339.872784 718.39 22272
+339.895056 718.39 22272
+339.917328 718.39 22272
+339.939600 718.39 22272
+339.962000 714.29 22400
+339.984400 714.29 22400
+340.006800 714.29 22400
+340.029328 710.23 22528
+340.051856 710.23 22528
+340.074384 710.23 22528
+340.097040 706.21 22656
+340.119696 706.21 22656
+340.142480 702.25 22784
+340.165264 702.25 22784
+340.188048 702.25 22784
+340.210960 698.32 22912
+340.233872 698.32 22912
+340.256784 698.32 22912
+340.279824 694.44 23040
+340.302864 694.44 23040
+340.326032 690.61 23168
+340.349200 690.61 23168
+340.372368 690.61 23168
+340.395664 686.81 23296
+340.418960 686.81 23296
+340.442384 683.06 23424
+340.465808 683.06 23424
+340.489232 683.06 23424
+340.512784 679.35 23552
+340.536336 679.35 23552
+340.560016 675.68 23680
+340.583696 675.68 23680
+340.607376 675.68 23680
+340.631184 672.04 23808
+340.654992 672.04 23808
+340.678928 668.45 23936
+340.702864 668.45 23936
+340.726800 668.45 23936
+340.750864 664.89 24064
+340.774928 664.89 24064
+340.799120 661.38 24192
+340.823312 661.38 24192
+340.847632 657.89 24320
+340.871952 657.89 24320
+340.896272 657.89 24320
+340.920720 654.45 24448
+340.945168 654.45 24448
+340.969744 651.04 24576
+340.994320 651.04 24576
+341.019024 647.67 24704
+341.043728 647.67 24704
+341.068432 647.67 24704
+341.093264 644.33 24832
+341.118096 644.33 24832
+341.143184 637.76 25088
+341.168272 637.76 25088
+341.193488 634.52 25216
+341.218704 634.52 25216
+341.244048 631.31 25344
+341.269392 631.31 25344
+341.294864 628.14 25472
+341.320336 628.14 25472
+341.345936 625.00 25600
+341.371536 625.00 25600
+341.397136 625.00 25600
+341.422864 621.89 25728
+341.448592 621.89 25728
+341.474448 618.81 25856
+341.500304 618.81 25856
+341.526288 615.76 25984
+341.552272 615.76 25984
+341.578384 612.75 26112
+341.604496 612.75 26112
+341.630736 609.76 26240
+341.656976 609.76 26240
+341.683344 606.80 26368
+341.709712 606.80 26368
+341.736336 600.96 26624
+341.762960 600.96 26624
+341.789712 598.09 26752
+341.816464 598.09 26752
+341.843344 595.24 26880
+341.870224 595.24 26880
+341.897232 592.42 27008
+341.924368 589.62 27136
+341.951504 589.62 27136
+341.978768 586.85 27264
+342.006032 586.85 27264
+342.033424 584.11 27392
+342.060816 584.11 27392
+342.088464 578.70 27648
+342.116112 578.70 27648
+342.143888 576.04 27776
+342.171664 576.04 27776
+342.199568 573.39 27904
+342.227600 570.78 28032
+342.255632 570.78 28032
+342.283792 568.18 28160
+342.311952 568.18 28160
+342.340240 565.61 28288
+342.368528 565.61 28288
+342.397072 560.54 28544
+342.425744 558.04 28672
+342.454416 558.04 28672
+342.483216 555.56 28800
+342.512016 555.56 28800
+342.540944 553.10 28928
+342.570128 548.25 29184
+342.599312 548.25 29184
+342.628624 545.85 29312
+342.657936 545.85 29312
+342.687376 543.48 29440
+342.716944 541.13 29568
+342.746512 541.13 29568
+342.776336 536.48 29824
+342.806288 534.19 29952
+342.836240 534.19 29952
+342.866320 531.91 30080
+342.896528 529.66 30208
+342.926736 529.66 30208
+342.957200 525.21 30464
+342.987792 523.01 30592
+343.018384 523.01 30592
+343.049104 520.83 30720
+343.080080 516.53 30976
+343.111056 516.53 30976
+343.142160 514.40 31104
+343.173392 512.30 31232
+343.204624 512.30 31232
+343.236112 508.13 31488
+343.267728 506.07 31616
+343.299472 504.03 31744
+343.331216 504.03 31744
+343.363216 500.00 32000
+343.395344 498.01 32128
+343.427600 496.03 32256
+343.459856 496.03 32256
+343.492368 492.13 32512
+343.525008 490.20 32640
+343.557776 488.28 32768
+343.590544 488.28 32768
+343.623568 484.50 33024
+343.656592 484.50 33024
+343.689872 480.77 33280
+343.723408 477.10 33536
+343.756944 477.10 33536
+343.790736 473.48 33792
+343.824528 473.48 33792
+343.858576 469.92 34048
+343.892880 466.42 34304
+343.927440 462.96 34560
+343.962000 462.96 34560
+343.996560 462.96 34560
+344.031376 459.56 34816
+344.066448 456.20 35072
+344.101520 456.20 35072
+344.136848 452.90 35328
+344.172432 449.64 35584
+344.208272 446.43 35840
+344.244112 446.43 35840
+344.280208 443.26 36096
+344.316304 443.26 36096
+344.352656 440.14 36352
+344.389264 437.06 36608
+344.426128 434.03 36864
+344.462992 434.03 36864
+344.500112 431.03 37120
+344.537488 428.08 37376
+344.575120 425.17 37632
+344.612752 425.17 37632
+344.650640 422.30 37888
+344.689040 416.67 38400
+344.727696 413.91 38656
+344.766608 411.18 38912
+344.805520 411.18 38912
+344.844688 408.50 39168
+344.884112 405.84 39424
+344.923792 403.23 39680
+344.963728 400.64 39936
+345.003920 398.09 40192
+345.044368 395.57 40448
+345.085072 393.08 40704
+345.126032 390.62 40960
+345.167248 388.20 41216
+345.208720 385.80 41472
+345.250448 383.44 41728
+345.292432 381.10 41984
+345.334672 378.79 42240
+345.377424 374.25 42752
+345.420432 372.02 43008
+345.463696 369.82 43264
+345.507472 365.50 43776
+345.551504 363.37 44032
+345.595792 361.27 44288
+345.640336 359.20 44544
+345.685136 357.14 44800
+345.730448 353.11 45312
+345.776016 351.12 45568
+345.822096 347.22 46080
+345.868432 345.30 46336
+345.915280 341.53 46848
+345.962640 337.84 47360
+346.010256 336.02 47616
+346.058384 332.45 48128
+346.107024 328.95 48640
+346.155920 327.23 48896
+346.205328 323.83 49408
+346.255504 318.88 50176
+346.306192 315.66 50688
+346.357392 312.50 51200
+346.408848 310.95 51456
+346.460816 307.88 51968
+346.513296 304.88 52480
+346.566544 300.48 53248
+346.620304 297.62 53760
+346.674832 293.43 54528
+346.730128 289.35 55296
+346.785936 286.70 55808
+346.842256 284.09 56320
+346.899600 279.02 57344
+346.957456 276.55 57856
+347.016080 272.93 58624
+347.075728 268.24 59648
+347.136144 264.83 60416
+347.197328 261.51 61184
+347.259536 257.20 62208
+347.322768 253.04 63232
+347.387024 249.00 64256
+347.452304 245.10 65280
+347.518352 242.25 66048
+347.585936 236.74 67584
+347.655056 231.48 69120
+347.725200 228.10 70144
+347.796880 223.21 71680
+347.869584 220.07 72704
+347.943824 215.52 74240
+348.019600 211.15 75776
+348.097424 205.59 77824
+348.177296 200.32 79872
+348.259216 195.31 81920
+348.343184 190.55 83968
+348.429712 184.91 86528
+348.518800 179.60 89088
+348.610960 173.61 92160
+348.706192 168.01 95232
+348.805008 161.92 98816
+348.907920 155.47 102912
+349.015440 148.81 107520
+349.128080 142.05 112640
+349.247376 134.12 119296
+349.373840 126.52 126464
+349.509008 118.37 135168
+349.654416 110.04 145408
+349.814160 100.16 159744
+349.992336 89.80 178176
+350.198160 77.74 205824
+350.451088 63.26 252928
+350.807440 44.90 356352
+351.313296 31.63 505856
+EOF
+plot $data using 1:2 with linespoints
+pause -1
@@ -300,6 +300,28 @@ void perform_test() {
   xprintf("upm_shl(upm_sqrt(upm_shr(%x,42)),21)=0x%x (%x)\n", x1, x, back);
   test(back == 2, "upm_sqrt");
 
+  x1 = upm_from((uint32_t)(1000L * 1000));
+  x2 = upm_from((uint32_t)4);
+  x = upm_sqrt_div(x1, x2);
+  back = upm_to_u32(x);
+  xprintf("upm_sqrt_div(%x,%x)=0x%x (%d)\n", x1, x2, x, back);
+  test((back >= 498) && (back <= 502), "upm_sqrt_div");
+  x = upm_sqrt_div(x1, upm_from((uint32_t)8));
+  back = upm_to_u32(x);
+  xprintf("upm_sqrt_div(%x,8)=0x%x (%d)\n", x1, x, back);
+  test((back >= 351) && (back <= 356), "upm_sqrt_div");
+
+  x = upm_reciprocal(upm_from((uint32_t)16));
+  xprintf("upm_reciprocal(16)=0x%x\n", x);
+  test(x == 0x7c80, "upm_reciprocal");
+  x = upm_rsqrt(upm_from((uint32_t)16));
+  xprintf("upm_rsqrt(16)=0x%x\n", x);
+  test(x == 0x7e80, "upm_rsqrt");
+  x = upm_multiply(upm_rsqrt(upm_from((uint32_t)10000)), upm_from((uint32_t)100000));
+  back = upm_to_u32(x);
+  xprintf("upm_rsqrt(10000)*100000=0x%x (%d)\n", x, back);
+  test((back >= 995) && (back <= 1005), "upm_rsqrt");
+
   x1 = upm_from((uint32_t)250);
   x2 = upm_from((uint32_t)10000);
   x = upm_divide(x1, x2);
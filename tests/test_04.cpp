@@ -14,6 +14,7 @@ unsigned short OCR1A;
 unsigned short OCR1B;
 
 StepperQueue fas_queue[NUM_QUEUES];
+StepperQueueBuffer<QUEUE_LEN> fas_queue_buffer[NUM_QUEUES];
 
 void inject_fill_interrupt(int mark) {}
 void noInterrupts() {}
@@ -48,9 +49,8 @@ RampChecker::RampChecker() {
 void RampChecker::check_section(struct queue_entry *e) {
   uint8_t steps = e->steps;
   if (!first) {
-    assert((steps & 1) == 0);
+    assert(!e->toggle_dir);
   }
-  steps >>= 1;
   assert(steps >= 1);
   uint32_t start_dt = PERIOD_TICKS;
   start_dt *= e->n_periods;
@@ -101,6 +101,8 @@ void init_queue() {
   fas_queue[1].read_idx = 0;
   fas_queue[0].next_write_idx = 0;
   fas_queue[1].next_write_idx = 0;
+  fas_queue[0].attachBuffer(fas_queue_buffer[0].entry, QUEUE_LEN);
+  fas_queue[1].attachBuffer(fas_queue_buffer[1].entry, QUEUE_LEN);
 }
 
 int main() {
@@ -145,9 +147,10 @@ int main() {
     s.manage();
     uint32_t from_dt = rc.total_ticks;
     while (!s.isQueueEmpty()) {
-      rc.check_section(
-          &fas_queue[0].entry[fas_queue[0].read_idx & QUEUE_LEN_MASK]);
-      fas_queue[0].read_idx++;
+      struct queue_entry e;
+      fas_queue[0].read_idx +=
+          fas_queue[0].decodeEntry(fas_queue[0].read_idx, &e);
+      rc.check_section(&e);
     }
     uint32_t to_dt = rc.total_ticks;
     float planned_time = (to_dt - from_dt) * 1.0 / 16000000;
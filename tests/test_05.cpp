@@ -15,6 +15,7 @@ unsigned short OCR1B;
 
 FastAccelStepper *stepper;
 StepperQueue fas_queue[NUM_QUEUES];
+StepperQueueBuffer<QUEUE_LEN> fas_queue_buffer[NUM_QUEUES];
 
 int enable_inject_on_mark = -1;
 bool enable_stepper_manage_on_interrupts = false;
@@ -74,9 +75,8 @@ RampChecker::RampChecker() {
 void RampChecker::check_section(struct queue_entry *e) {
   uint8_t steps = e->steps;
   if (!first) {
-    assert((steps & 1) == 0);
+    assert(!e->toggle_dir);
   }
-  steps >>= 1;
   assert(steps >= 1);
   uint32_t start_dt = PERIOD_TICKS;
   start_dt *= e->n_periods;
@@ -128,6 +128,8 @@ void RampChecker::check_section(struct queue_entry *e) {
 void init_queue() {
   fas_queue[0]._initVars();
   fas_queue[1]._initVars();
+  fas_queue[0].attachBuffer(fas_queue_buffer[0].entry, QUEUE_LEN);
+  fas_queue[1].attachBuffer(fas_queue_buffer[1].entry, QUEUE_LEN);
 }
 
 void do_test() {
@@ -178,9 +180,10 @@ void do_test() {
     s.manage();
     uint32_t from_dt = rc.total_ticks;
     while (!s.isQueueEmpty()) {
-      rc.check_section(
-          &fas_queue[0].entry[fas_queue[0].read_idx & QUEUE_LEN_MASK]);
-      fas_queue[0].read_idx++;
+      struct queue_entry e;
+      fas_queue[0].read_idx +=
+          fas_queue[0].decodeEntry(fas_queue[0].read_idx, &e);
+      rc.check_section(&e);
     }
     in_manage = false;
     uint32_t to_dt = rc.total_ticks;
@@ -0,0 +1,179 @@
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "PoorManFloat.h"
+
+//
+// This test reports the worst case relative error of the upm operations for
+// the table size selected by UPM_TABLE_SIZE. It is compiled for each table
+// size by the Makefile.
+//
+
+#define test(x, msg) \
+  if (!(x)) {        \
+    puts(msg);       \
+    assert(false);   \
+  };
+
+double upm_to_double(upm_float x) {
+  int exponent = (x >> 8) - 128;
+  double mantissa = (x & 0xff) / 128.0;
+  return ldexp(mantissa, exponent);
+}
+
+double rel_error(double value, double expected) {
+  return fabs(value - expected) / expected;
+}
+
+// all mantissas for a given exponent
+#define FOR_ALL_MANTISSA(x, exponent)                    \
+  for (upm_float x = ((exponent) << 8) | 0x80;            \
+       ((x & 0xff) >= 0x80) && ((x >> 8) == (exponent)); x++)
+
+double worst_from() {
+  double worst = 0;
+  for (uint32_t i = 1; i < 0x80000000; i = i + (i >> 4) + 1) {
+    double e = rel_error(upm_to_double(upm_from(i)), i);
+    worst = fmax(worst, e);
+  }
+  return worst;
+}
+
+double worst_multiply() {
+  double worst = 0;
+  FOR_ALL_MANTISSA(x, 0x83) {
+    FOR_ALL_MANTISSA(y, 0x7d) {
+      double e = rel_error(upm_to_double(upm_multiply(x, y)),
+                           upm_to_double(x) * upm_to_double(y));
+      worst = fmax(worst, e);
+    }
+  }
+  return worst;
+}
+
+double worst_square() {
+  double worst = 0;
+  for (uint16_t ex = 0x78; ex <= 0x88; ex++) {
+    FOR_ALL_MANTISSA(x, ex) {
+      double v = upm_to_double(x);
+      double e = rel_error(upm_to_double(upm_square(x)), v * v);
+      worst = fmax(worst, e);
+    }
+  }
+  return worst;
+}
+
+double worst_divide() {
+  double worst = 0;
+  FOR_ALL_MANTISSA(x, 0x90) {
+    FOR_ALL_MANTISSA(y, 0x85) {
+      double e = rel_error(upm_to_double(upm_divide(x, y)),
+                           upm_to_double(x) / upm_to_double(y));
+      worst = fmax(worst, e);
+    }
+  }
+  return worst;
+}
+
+double worst_sqrt() {
+  double worst = 0;
+  for (uint16_t ex = 0x70; ex <= 0x90; ex++) {
+    FOR_ALL_MANTISSA(x, ex) {
+      double e =
+          rel_error(upm_to_double(upm_sqrt(x)), sqrt(upm_to_double(x)));
+      worst = fmax(worst, e);
+    }
+  }
+  return worst;
+}
+
+double worst_sqrt_div() {
+  double worst = 0;
+  for (uint16_t ex = 0x88; ex <= 0x89; ex++) {
+    FOR_ALL_MANTISSA(x, ex) {
+      FOR_ALL_MANTISSA(y, 0x83) {
+        double e = rel_error(upm_to_double(upm_sqrt_div(x, y)),
+                             sqrt(upm_to_double(x) / upm_to_double(y)));
+        worst = fmax(worst, e);
+      }
+    }
+  }
+  return worst;
+}
+
+double worst_sqrt_of_div() {
+  double worst = 0;
+  for (uint16_t ex = 0x88; ex <= 0x89; ex++) {
+    FOR_ALL_MANTISSA(x, ex) {
+      FOR_ALL_MANTISSA(y, 0x83) {
+        double e = rel_error(upm_to_double(upm_sqrt(upm_divide(x, y))),
+                             sqrt(upm_to_double(x) / upm_to_double(y)));
+        worst = fmax(worst, e);
+      }
+    }
+  }
+  return worst;
+}
+
+double worst_reciprocal() {
+  double worst = 0;
+  for (uint16_t ex = 0x78; ex <= 0x88; ex++) {
+    FOR_ALL_MANTISSA(x, ex) {
+      double v = upm_to_double(x);
+      double e = rel_error(upm_to_double(upm_reciprocal(x)), 1.0 / v);
+      worst = fmax(worst, e);
+    }
+  }
+  return worst;
+}
+
+double worst_rsqrt() {
+  double worst = 0;
+  for (uint16_t ex = 0x78; ex <= 0x88; ex++) {
+    FOR_ALL_MANTISSA(x, ex) {
+      double v = upm_to_double(x);
+      double e = rel_error(upm_to_double(upm_rsqrt(x)), 1.0 / sqrt(v));
+      worst = fmax(worst, e);
+    }
+  }
+  return worst;
+}
+
+int main() {
+  // Upper bounds of the relative error in percent for UPM_TABLE_SIZE 0/1/2
+  const double bound_divide[3] = {2.7, 1.6, 0.5};
+  const double bound_sqrt[3] = {1.2, 0.7, 0.4};
+
+  double e_from = 100 * worst_from();
+  double e_multiply = 100 * worst_multiply();
+  double e_square = 100 * worst_square();
+  double e_divide = 100 * worst_divide();
+  double e_sqrt = 100 * worst_sqrt();
+  double e_sqrt_div = 100 * worst_sqrt_div();
+  double e_sqrt_of_div = 100 * worst_sqrt_of_div();
+  double e_reciprocal = 100 * worst_reciprocal();
+  double e_rsqrt = 100 * worst_rsqrt();
+
+  printf("Worst case relative error for UPM_TABLE_SIZE=%d:\n", UPM_TABLE_SIZE);
+  printf("  upm_from       %.3f%%\n", e_from);
+  printf("  upm_multiply   %.3f%%\n", e_multiply);
+  printf("  upm_square     %.3f%%\n", e_square);
+  printf("  upm_divide     %.3f%%\n", e_divide);
+  printf("  upm_sqrt       %.3f%%\n", e_sqrt);
+  printf("  upm_sqrt_div   %.3f%% (upm_sqrt(upm_divide()) %.3f%%)\n", e_sqrt_div,
+         e_sqrt_of_div);
+  printf("  upm_reciprocal %.3f%%\n", e_reciprocal);
+  printf("  upm_rsqrt      %.3f%%\n", e_rsqrt);
+  fflush(stdout);
+
+  test(e_from < 0.8, "upm_from error too high");
+  test(e_multiply < 1.6, "upm_multiply error too high");
+  test(e_square < 1.6, "upm_square error too high");
+  test(e_divide < bound_divide[UPM_TABLE_SIZE], "upm_divide error too high");
+  test(e_sqrt < bound_sqrt[UPM_TABLE_SIZE], "upm_sqrt error too high");
+
+  printf("TEST_06 PASSED\n");
+}
@@ -0,0 +1,142 @@
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FastAccelStepper.h"
+#include "StepperISR.h"
+
+//
+// This test runs the command queue with a real producer thread and a real
+// consumer thread. The consumer mimics the stepper ISR. The queue must work
+// without any interrupt masking.
+//
+
+StepperQueue fas_queue[NUM_QUEUES];
+
+static int no_interrupts_cnt = 0;
+
+void inject_fill_interrupt(int mark) {}
+void noInterrupts() { no_interrupts_cnt++; }
+void interrupts() {}
+
+#define NUM_ENTRIES 200000
+
+// mix of compact and full entries
+static uint16_t expected_period(uint32_t i) {
+  return 1000 + (i & 0x7fff) * ((i & 0x100) ? 1 : 100);
+}
+// mix of 8 and 16 bit step counts
+static uint16_t expected_steps(uint32_t i) { return (i % 1000) + 1; }
+static bool expected_dir(uint32_t i) { return (i / 3) & 1; }
+
+// With stop_on_empty the consumer stops like the stepper ISR on an empty
+// queue: it clears isRunning and checks the queue again. A stopped consumer
+// continues only after the producer has started the queue. An entry, which
+// is published without start, would never be consumed.
+static bool stop_on_empty;
+static uint32_t stop_cnt;
+
+static void wait_for_entry(StepperQueue* q, uint8_t rp) {
+  if (!stop_on_empty) {
+    while (rp == fas_idx_load(q->next_write_idx)) {
+      sched_yield();
+    }
+    return;
+  }
+  if (rp != fas_idx_load(q->next_write_idx)) {
+    return;
+  }
+  q->isRunning = false;
+  fas_memory_fence();
+  if (rp != fas_idx_load(q->next_write_idx)) {
+    // the entry has arrived in time
+    q->isRunning = true;
+    return;
+  }
+  stop_cnt++;
+  uint32_t spins = 0;
+  while (!q->isRunning) {
+    spins++;
+    test(spins < 10000000, "entry stranded in stopped queue");
+    sched_yield();
+  }
+  test(rp != fas_idx_load(q->next_write_idx), "started without entry");
+}
+
+void* consumer(void* arg) {
+  StepperQueue* q = (StepperQueue*)arg;
+  bool dir = true;  // dir_at_queue_end after _initVars()
+  for (uint32_t i = 0; i < NUM_ENTRIES; i++) {
+    uint8_t rp = q->read_idx;
+    wait_for_entry(q, rp);
+    struct queue_entry e;
+    rp += q->decodeEntry(rp, &e);
+    test(e.period == expected_period(i), "wrong period");
+    test(e.n_periods == 0, "wrong n_periods");
+    test(e.steps == expected_steps(i), "wrong steps");
+    if (e.toggle_dir) {
+      dir = !dir;
+    }
+    test(dir == expected_dir(i), "wrong direction");
+    fas_idx_store(q->read_idx, rp);
+  }
+  return NULL;
+}
+
+void* producer(void* arg) {
+  StepperQueue* q = (StepperQueue*)arg;
+  uint32_t full_cnt = 0;
+  for (uint32_t i = 0; i < NUM_ENTRIES;) {
+    int res = q->addQueueEntry(expected_period(i), expected_steps(i),
+                               expected_dir(i));
+    if (res == AQE_OK) {
+      i++;
+    } else {
+      test(res == AQE_FULL, "unexpected return code");
+      full_cnt++;
+      sched_yield();
+    }
+    // these must be callable at any time
+    q->isQueueEmpty();
+    q->hasTicksInQueue(1000);
+  }
+  printf("queue was full %u times\n", full_cnt);
+  return NULL;
+}
+
+void run_test(union queue_unit* buffer, uint8_t queue_len, bool stop) {
+  printf("queue length %d%s...\n", queue_len, stop ? " with stops" : "");
+  StepperQueue* q = &fas_queue[0];
+  q->attachBuffer(buffer, queue_len);
+  q->init(0, 0);
+  stop_on_empty = stop;
+  stop_cnt = 0;
+  q->isRunning = true;
+
+  pthread_t cons, prod;
+  assert(pthread_create(&cons, NULL, consumer, q) == 0);
+  assert(pthread_create(&prod, NULL, producer, q) == 0);
+  pthread_join(prod, NULL);
+  pthread_join(cons, NULL);
+
+  test(q->isQueueEmpty(), "queue should be empty");
+  if (stop) {
+    printf("consumer stopped %u times\n", stop_cnt);
+    test(stop_cnt > 0, "consumer has never stopped");
+  }
+  puts("...done");
+}
+
+int main() {
+  StepperQueueBuffer<4> tiny;
+  StepperQueueBuffer<QUEUE_LEN> normal;
+  StepperQueueBuffer<128> deep;
+  run_test(tiny.entry, 4, false);
+  run_test(normal.entry, QUEUE_LEN, false);
+  run_test(deep.entry, 128, false);
+  run_test(normal.entry, QUEUE_LEN, true);
+  test(no_interrupts_cnt == 0, "interrupts have been disabled");
+  printf("TEST_07 PASSED\n");
+}
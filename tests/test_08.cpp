@@ -0,0 +1,212 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "FastAccelStepper.h"
+
+//
+// This test runs the library with the linux backend. The steps are generated
+// by the timer thread and the queues are filled by the manage thread. The
+// outputs are checked with a recording sink.
+//
+
+#define test(x, msg) \
+  if (!(x)) {        \
+    puts(msg);       \
+    assert(false);   \
+  };
+
+#define MAX_EVENTS 20000
+static struct fas_output_event_s events[MAX_EVENTS];
+static FasRecorderSink sink(events, MAX_EVENTS);
+
+FastAccelStepperEngine engine = FastAccelStepperEngine();
+
+static void wait_for_stop(FastAccelStepper* s) {
+  // at most 10s
+  for (uint16_t i = 0; i < 1000; i++) {
+    if (!s->isRunning() && !s->isRampGeneratorActive()) {
+      return;
+    }
+    usleep(10000);
+  }
+  test(false, "stepper does not stop");
+}
+
+// Returns the number of steps of step_pin and checks the step intervals
+static uint32_t check_steps(uint8_t step_pin, uint32_t min_ticks) {
+  uint32_t steps = 0;
+  uint32_t last = 0;
+  for (uint32_t i = 0; i < sink.count(); i++) {
+    const struct fas_output_event_s* ev = &sink.events()[i];
+    if (!ev->step || (ev->pin != step_pin)) {
+      continue;
+    }
+    if (steps > 0) {
+      uint32_t dt = ev->ticks - last;
+      test(dt < 0x80000000, "steps not in time order");
+      test(dt >= min_ticks, "steps too fast");
+    }
+    last = ev->ticks;
+    steps++;
+  }
+  return steps;
+}
+
+// Returns the last recorded level of the pin or -1
+static int last_level(uint8_t pin) {
+  int level = -1;
+  for (uint32_t i = 0; i < sink.count(); i++) {
+    const struct fas_output_event_s* ev = &sink.events()[i];
+    if (!ev->step && (ev->pin == pin)) {
+      level = ev->high ? 1 : 0;
+    }
+  }
+  return level;
+}
+
+static int cmp_ticks(const void* a, const void* b) {
+  int32_t d = ((const struct fas_output_event_s*)a)->ticks -
+              ((const struct fas_output_event_s*)b)->ticks;
+  return (d > 0) - (d < 0);
+}
+
+int main() {
+  engine.setOutputSink(&sink);
+  engine.init();
+
+  FastAccelStepper* s1 = engine.stepperConnectToPin(4);
+  FastAccelStepper* s2 = engine.stepperConnectToPin(6);
+  test(s1 != NULL, "cannot connect stepper 1");
+  test(s2 != NULL, "cannot connect stepper 2");
+  s1->setDirectionPin(5);
+  s2->setDirectionPin(7);
+  test(last_level(5) == 1, "dir pin 5 not initialized");
+
+  // 10 kHz max. The planned step times are exact, so allow only the
+  // rounding of the ramp generator.
+  uint32_t min_ticks = US_TO_TICKS(100) - US_TO_TICKS(100) / 20;
+  s1->setSpeed(100);
+  s1->setAcceleration(100000);
+  s2->setSpeed(100);
+  s2->setAcceleration(100000);
+  s1->moveTo(2000);
+  s2->moveTo(-1000);
+  wait_for_stop(s1);
+  wait_for_stop(s2);
+
+  test(s1->getCurrentPosition() == 2000, "stepper 1 not at target");
+  test(s2->getCurrentPosition() == -1000, "stepper 2 not at target");
+  test(check_steps(4, min_ticks) == 2000, "wrong step count of stepper 1");
+  test(check_steps(6, min_ticks) == 1000, "wrong step count of stepper 2");
+  test(last_level(5) == 1, "wrong direction of stepper 1");
+  test(last_level(7) == 0, "wrong direction of stepper 2");
+
+  // stop a long move while running
+  sink.clear();
+  s1->moveTo(100000);
+  usleep(200000);
+  test(s1->isRunning(), "stepper 1 should be running");
+  s1->stopMove();
+  wait_for_stop(s1);
+  int32_t pos = s1->getCurrentPosition();
+  test(pos > 2000, "stepper 1 has not moved");
+  test(pos < 100000, "stepper 1 has not stopped");
+  test(check_steps(4, min_ticks) == (uint32_t)(pos - 2000),
+       "steps do not match the position");
+
+  // Coordinated move with a slow follower, which runs empty between its
+  // steps. Each follower step is due, when the lead passes its share.
+  sink.clear();
+  FastAccelStepper* axes[2] = {s1, s2};
+  int32_t target[2] = {pos + 2000, -1000 + 10};
+  test(engine.moveLinear(axes, target, 2, 100, 100000) == MOVE_OK,
+       "coordinated move not accepted");
+  wait_for_stop(s1);
+  wait_for_stop(s2);
+  test(s1->getCurrentPosition() == pos + 2000, "lead not at target");
+  test(s2->getCurrentPosition() == -990, "follower not at target");
+  test(check_steps(4, min_ticks) == 2000, "wrong step count of lead");
+  test(check_steps(6, min_ticks) == 10, "wrong step count of follower");
+  // A late timer thread may record the steps out of order, so the planned
+  // times are compared: the follower steps with lead step 200, 400, ...
+  static uint32_t lead_ticks[2000];
+  uint32_t lead_steps = 0;
+  for (uint32_t i = 0; i < sink.count(); i++) {
+    const struct fas_output_event_s* ev = &sink.events()[i];
+    if (ev->step && (ev->pin == 4)) {
+      lead_ticks[lead_steps++] = ev->ticks;
+    }
+  }
+  uint32_t follow_steps = 0;
+  for (uint32_t i = 0; i < sink.count(); i++) {
+    const struct fas_output_event_s* ev = &sink.events()[i];
+    if (ev->step && (ev->pin == 6)) {
+      follow_steps++;
+      uint32_t dt = ev->ticks - lead_ticks[follow_steps * 200 - 1];
+      test((dt < 64) || (dt > (uint32_t)-64), "follower off the path");
+    }
+  }
+
+  // Half circle with radius 300 counter clockwise. The walk stays within
+  // half a step of the circle. An axis, which has run empty, may be
+  // restarted late by a busy manage thread, so two steps are allowed here.
+  sink.clear();
+  int32_t x0 = s1->getCurrentPosition();
+  int32_t y0 = s2->getCurrentPosition();
+  test(engine.arcTo(s1, s2, x0 - 300, y0, x0 - 600, y0, false, 100, 100000) ==
+           MOVE_OK,
+       "arc not accepted");
+  wait_for_stop(s1);
+  wait_for_stop(s2);
+  test(s1->getCurrentPosition() == x0 - 600, "x not at end of arc");
+  test(s2->getCurrentPosition() == y0, "y not at end of arc");
+  test(check_steps(4, min_ticks) == 600, "wrong step count of x");
+  test(check_steps(6, min_ticks) == 600, "wrong step count of y");
+  static struct fas_output_event_s arc_steps[1200];
+  uint32_t n = 0;
+  for (uint32_t i = 0; i < sink.count(); i++) {
+    const struct fas_output_event_s* ev = &sink.events()[i];
+    if (ev->step) {
+      arc_steps[n++] = *ev;
+    }
+  }
+  // direction: x moves down, y up for the first 300 steps
+  qsort(arc_steps, n, sizeof(arc_steps[0]), cmp_ticks);
+  int32_t x = 300;
+  int32_t y = 0;
+  uint32_t y_steps = 0;
+  for (uint32_t i = 0; i < n; i++) {
+    if (arc_steps[i].pin == 4) {
+      x--;
+    } else {
+      y += (y_steps++ < 300) ? 1 : -1;
+    }
+    if ((i + 1 < n) && (arc_steps[i + 1].ticks - arc_steps[i].ticks < 64)) {
+      continue;
+    }
+    int32_t dr2 = x * x + y * y - 300 * 300;
+    test(abs(dr2) <= 2 * 600, "arc off the circle");
+  }
+
+  // A position event fires with the step to its position and latches its time
+  sink.clear();
+  int32_t p = s1->getCurrentPosition();
+  int8_t id = s1->addPositionEvent(p + 500, NULL, NULL, PIN_UNDEFINED);
+  test(id >= 0, "position event not added");
+  s1->moveTo(p + 1000);
+  wait_for_stop(s1);
+  uint32_t event_ticks;
+  test(s1->getPositionEvent(id, &event_ticks), "position event not fired");
+  uint32_t steps = 0;
+  for (uint32_t i = 0; i < sink.count(); i++) {
+    const struct fas_output_event_s* ev = &sink.events()[i];
+    if (ev->step && (ev->pin == 4) && (++steps == 500)) {
+      test(ev->ticks == event_ticks, "position event not at its step");
+    }
+  }
+  test(steps == 1000, "wrong step count with position event");
+
+  printf("TEST_08 PASSED\n");
+}
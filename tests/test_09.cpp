@@ -0,0 +1,249 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "FasGcode.h"
+#include "FastAccelStepper.h"
+#include "StepperISR.h"
+
+char TCCR1A;
+char TCCR1B;
+char TCCR1C;
+char TIMSK1;
+char TIFR1;
+unsigned short OCR1A;
+unsigned short OCR1B;
+
+StepperQueue fas_queue[NUM_QUEUES];
+StepperQueueBuffer<QUEUE_LEN> fas_queue_buffer[NUM_QUEUES];
+
+void inject_fill_interrupt(int mark) {}
+void noInterrupts() {}
+void interrupts() {}
+
+//
+// This test feeds G-code to FasGcode and runs the stepper queues of x and y
+// with the virtual time base. The steps are collected with their times.
+//
+
+#define MAX_STEPS 20000
+struct axis_steps_s {
+  uint64_t t;  // time of the last step
+  bool count_up;
+  bool started;
+  int32_t pos;
+  uint32_t n;
+  uint64_t times[MAX_STEPS];
+  int32_t positions[MAX_STEPS];
+};
+static struct axis_steps_s steps_x;
+static struct axis_steps_s steps_y;
+
+static void init_axis(uint8_t q, struct axis_steps_s* a) {
+  fas_queue[q].read_idx = 0;
+  fas_queue[q].next_write_idx = 0;
+  fas_queue[q].attachBuffer(fas_queue_buffer[q].entry, QUEUE_LEN);
+  a->started = false;
+  a->count_up = fas_queue[q].dir_at_queue_end;
+  a->pos = 0;
+  a->n = 0;
+}
+
+static void drain(uint8_t q, struct axis_steps_s* a) {
+  if (!a->started) {
+    if (!fas_queue[q].isRunning) {
+      return;
+    }
+    a->started = true;
+    a->t = fas_queue[q].started_at_ticks;
+  }
+  while (!fas_queue[q].isQueueEmpty()) {
+    struct queue_entry e;
+    fas_queue[q].read_idx +=
+        fas_queue[q].decodeEntry(fas_queue[q].read_idx, &e);
+    if (e.toggle_dir) {
+      a->count_up = !a->count_up;
+    }
+    uint32_t ticks = e.n_periods * PERIOD_TICKS + e.period;
+    for (uint16_t i = 0; i < e.steps; i++) {
+      a->t += ticks;
+      a->pos += a->count_up ? 1 : -1;
+      test(a->n < MAX_STEPS, "too many steps");
+      a->positions[a->n] = a->pos;
+      a->times[a->n++] = a->t;
+    }
+  }
+}
+
+// Feeds the G-code and runs for the given time in 1 ms steps
+static void run(FasGcode* gcode, const char* code, uint32_t ms) {
+  uint16_t len = strlen(code);
+  for (uint32_t i = 0; i < ms; i++) {
+    if (len > 0) {
+      uint16_t n = gcode->feed(code, len);
+      code += n;
+      len -= n;
+    }
+    gcode->process();
+    drain(0, &steps_x);
+    drain(1, &steps_y);
+    fas_virtual_ticks += TICKS_PER_S / 1000;
+  }
+  test(len == 0, "G-code not consumed");
+}
+
+static FastAccelStepper sx;
+static FastAccelStepper sy;
+static FasGcode gcode;
+
+static void setup(bool dir_pins) {
+  sx = FastAccelStepper();
+  sy = FastAccelStepper();
+  sx.init(0, 0);
+  sy.init(1, 1);
+  if (dir_pins) {
+    sx.setDirectionPin(2);
+    sy.setDirectionPin(3);
+  }
+  init_axis(0, &steps_x);
+  init_axis(1, &steps_y);
+  fas_virtual_ticks = 0;
+  gcode.init(&sx, &sy, NULL);
+  // 100 steps/mm, 1000 mm/s², 20 µm junction deviation
+  gcode.setStepsPerMM(0, 100);
+  gcode.setStepsPerMM(1, 100);
+}
+
+// Largest interval between the steps from..to-1
+static uint64_t max_interval(struct axis_steps_s* a, uint32_t from,
+                             uint32_t to) {
+  uint64_t res = 0;
+  for (uint32_t i = from + 1; i < to; i++) {
+    res = max(res, a->times[i] - a->times[i - 1]);
+  }
+  return res;
+}
+
+// Feeds the G-code in chunks of three bytes and returns the error
+static int8_t feed_line(const char* code) {
+  uint16_t len = strlen(code);
+  for (uint16_t i = 0; i < len; i += 3) {
+    uint16_t n = min(len - i, 3);
+    test(gcode.feed(code + i, n) == n, "bytes not consumed");
+  }
+  return gcode.getError();
+}
+
+void parse_test() {
+  puts("parse_test...");
+  setup(false);
+  test(feed_line("G21 g90 (metric, absolute)\r\n") == GCODE_OK, "G21 G90");
+  test(feed_line("N10 G1 X1.5 F600 ; comment\n\n") == GCODE_OK, "G1");
+  test(feed_line("G2 X1 Y1 I1\n") == GCODE_ERR_UNSUPPORTED, "G2 accepted");
+  test(gcode.getErrorLine() == 3, "wrong error line");
+  test(feed_line("G1 X1..2\n") == GCODE_ERR_SYNTAX, "syntax error not found");
+  test(feed_line("G4 S300\n") == GCODE_ERR_DWELL_TOO_LONG,
+       "dwell beyond 32 bit ticks accepted");
+  // back without direction pin
+  test(feed_line("G1 X1\n") == GCODE_ERR_NO_DIRECTION_PIN,
+       "move without direction pin accepted");
+  test(feed_line("X2 Z5\n") == GCODE_OK, "modal G1");
+  run(&gcode, "", 1000);
+  test(gcode.getError() == GCODE_OK, "unexpected error");
+  test(steps_x.n == 200, "wrong number of steps");
+  test(steps_x.pos == 200, "x not at X2");
+  test(steps_y.n == 0, "y has moved");
+
+  setup(false);
+  run(&gcode, "G1 X1\n", 10);
+  test(gcode.getError() == GCODE_ERR_NO_FEEDRATE, "move without feed rate");
+  char line[GCODE_LINE_LEN + 10];
+  memset(line, 'X', sizeof(line) - 1);
+  line[sizeof(line) - 1] = '\n';
+  run(&gcode, line, 10);
+  test(gcode.getError() == GCODE_ERR_LINE_TOO_LONG, "long line accepted");
+  test(steps_x.n == 0, "x has moved");
+
+  // the limit applies to the position of the stepper at init()
+  setup(true);
+  sx.setPositionLimits(-1000, 500);
+  test(feed_line("G1 X5 F600\n") == GCODE_OK, "move to the limit rejected");
+  test(feed_line("G1 X5.01\n") == GCODE_ERR_POSITION_LIMIT,
+       "move beyond the limit accepted");
+  sx.clearPositionLimits();
+}
+
+// Collinear segments are passed without slowing down. The ring is smaller
+// than the program, so feed() stops consuming, while it is full.
+void continuity_test() {
+  puts("continuity_test...");
+  setup(true);
+  static char code[2000];
+  code[0] = 0;
+  strcat(code, "G1 F6000\n");
+  for (uint8_t i = 1; i <= 2 * GCODE_SEGMENTS; i++) {
+    sprintf(code + strlen(code), "G1 X%d\n", i * 2);
+  }
+  test(gcode.feed(code, strlen(code)) < strlen(code), "ring not full");
+  setup(true);
+  run(&gcode, code, 2000);
+  uint32_t n = 2 * GCODE_SEGMENTS * 200;
+  test(steps_x.n == n, "wrong number of steps");
+  test(steps_x.pos == (int32_t)n, "x not at end");
+  // 100 mm/s with 100 steps/mm is a period of 1600 ticks. The ramps take
+  // 500 steps each.
+  uint64_t coast = max_interval(&steps_x, 600, n - 600);
+  printf("max. period while coasting: %u\n", (uint32_t)coast);
+  test(coast <= 1600 + 1600 / 50, "slow down between the segments");
+  // ideal: 2 * 0.1 s for the ramps and (n - 1000) / 10000 s coasting
+  uint64_t total = steps_x.times[n - 1] - steps_x.times[0];
+  uint64_t ideal = TICKS_PER_S / 5 + (uint64_t)(n - 1000) * 1600;
+  printf("time: %u ticks, ideal %u ticks\n", (uint32_t)total, (uint32_t)ideal);
+  test(total < ideal + ideal / 50, "move too slow");
+}
+
+// A corner of 90° is passed with the junction speed and the diagonal
+// follows the path
+void corner_test() {
+  puts("corner_test...");
+  setup(true);
+  run(&gcode, "G1 X10 F6000\nG1 Y10\nG1 X0 Y0\n", 2000);
+  test(steps_x.n == 2000, "wrong number of x steps");
+  test(steps_y.n == 2000, "wrong number of y steps");
+  test(steps_x.pos == 0, "x not at end");
+  test(steps_y.pos == 0, "y not at end");
+  // v² = a * d * sin(45°) / (1 - sin(45°)) = 482843 (units/s)² => 6.9 mm/s
+  uint64_t corner = steps_y.times[0] - steps_x.times[999];
+  printf("corner: %u ticks\n", (uint32_t)corner);
+  test(corner > TICKS_PER_S / 1000, "corner passed too fast");
+  test(corner < TICKS_PER_S / 200, "stop at the corner");
+  // the diagonal back: x and y step together
+  for (uint32_t i = 1000; i < 2000; i++) {
+    int64_t dt = steps_x.times[i] - steps_y.times[i];
+    test(abs(dt) < 64, "diagonal off the path");
+  }
+}
+
+// The dwell stops the steppers for the given time
+void dwell_test() {
+  puts("dwell_test...");
+  setup(true);
+  run(&gcode, "G1 X1 F6000\nG4 P100\nG91 G1 X-1\nG4 S0.2\nX1\n", 2000);
+  test(steps_x.n == 300, "wrong number of steps");
+  test(steps_x.pos == 100, "x not at end");
+  uint64_t dwell = steps_x.times[100] - steps_x.times[99];
+  test(dwell > TICKS_PER_S / 10, "dwell too short");
+  test(dwell < TICKS_PER_S / 10 + TICKS_PER_S / 20, "dwell too long");
+  dwell = steps_x.times[200] - steps_x.times[199];
+  test(dwell > TICKS_PER_S / 5, "dwell too short");
+  test(max_interval(&steps_x, 0, 100) < TICKS_PER_S / 50, "stop within move");
+}
+
+int main() {
+  parse_test();
+  continuity_test();
+  corner_test();
+  dwell_test();
+  printf("TEST_09 PASSED\n");
+}
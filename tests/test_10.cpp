@@ -0,0 +1,89 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "FastAccelStepper.h"
+#include "StepperISR.h"
+
+char TCCR1A;
+char TCCR1B;
+char TCCR1C;
+char TIMSK1;
+char TIFR1;
+unsigned short OCR1A;
+unsigned short OCR1B;
+
+StepperQueue fas_queue[NUM_QUEUES];
+
+void inject_fill_interrupt(int mark) {}
+void noInterrupts() {}
+void interrupts() {}
+
+//
+// This test is compiled with a reduced configuration (see Makefile): one
+// hardware channel, one software timer channel, a queue depth of 16 units,
+// a single enable pin, no auto enable and no debug led.
+//
+
+void config_test() {
+  puts("config_test...");
+  test(MAX_STEPPER == 2, "wrong number of steppers");
+  test(NUM_HW_QUEUES == 1, "wrong number of hardware channels");
+  test(QUEUE_LEN == 16, "wrong queue depth");
+  printf("sizeof(FastAccelStepper) = %u\n", (unsigned)sizeof(FastAccelStepper));
+}
+
+void connect_test() {
+  puts("connect_test...");
+  FastAccelStepperEngine engine = FastAccelStepperEngine();
+  engine.init();
+  FastAccelStepper* s0 = engine.stepperConnectToPin(0);
+  FastAccelStepper* s1 = engine.stepperConnectToPin(1);
+  test(s0 != NULL, "stepper 0 not connected");
+  test(s1 != NULL, "stepper 1 not connected");
+  test(engine.stepperConnectToPin(2) == NULL, "more steppers than configured");
+  test(!fas_queue[0].isSoft, "hardware channel expected");
+  test(fas_queue[1].isSoft, "software channel expected");
+  test(fas_queue[0].queue_len_mask == QUEUE_LEN - 1, "wrong queue depth");
+  s0->setEnablePin(5, false);
+  s0->enableOutputs();
+  s0->disableOutputs();
+}
+
+// A complete move with the small queue
+void move_test() {
+  puts("move_test...");
+  FastAccelStepper s = FastAccelStepper();
+  static StepperQueueBuffer<QUEUE_LEN> buffer;
+  fas_queue[0].attachBuffer(buffer.entry, QUEUE_LEN);
+  s.init(0, 0);
+  s.setDirectionPin(3);
+  s.setSpeed(100);
+  s.setAcceleration(100000);
+  test(s.moveTo(2000) == MOVE_OK, "move not accepted");
+  StepperQueue* q = &fas_queue[0];
+  uint32_t steps = 0;
+  for (uint16_t i = 0; i < 1000; i++) {
+    s.manage();
+    if (!q->isRunning) {
+      q->startQueue();
+    }
+    while (!q->isQueueEmpty()) {
+      struct queue_entry e;
+      q->read_idx += q->decodeEntry(q->read_idx, &e);
+      steps += e.steps;
+    }
+    if (!s.isRampGeneratorActive()) {
+      break;
+    }
+  }
+  test(steps == 2000, "wrong number of steps");
+  test(s.getPositionAfterCommandsCompleted() == 2000, "not at target");
+}
+
+int main() {
+  config_test();
+  connect_test();
+  move_test();
+  printf("TEST_10 PASSED\n");
+}